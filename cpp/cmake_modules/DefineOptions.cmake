@@ -338,6 +338,12 @@ takes precedence over ccache if a storage backend is configured" ON)
                 DEPENDS
                 ARROW_FLIGHT)
 
+  define_option(ARROW_FLIGHT_SHM
+                "Build the shared-memory transport for Arrow Flight (Linux only)"
+                OFF
+                DEPENDS
+                ARROW_FLIGHT)
+
   define_option(ARROW_GANDIVA
                 "Build the Gandiva libraries"
                 OFF
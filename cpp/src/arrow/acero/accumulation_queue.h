@@ -36,7 +36,7 @@ using arrow::compute::ExecBatch;
 ///        be processed.
 class ARROW_ACERO_EXPORT AccumulationQueue {
  public:
-  AccumulationQueue() : row_count_(0) {}
+  AccumulationQueue() : row_count_(0), byte_count_(0) {}
   ~AccumulationQueue() = default;
 
   // We should never be copying ExecBatch around
@@ -49,6 +49,8 @@ class ARROW_ACERO_EXPORT AccumulationQueue {
   void Concatenate(AccumulationQueue&& that);
   void InsertBatch(ExecBatch batch);
   int64_t row_count() { return row_count_; }
+  /// \brief The total size of the buffers referenced by the queued batches
+  int64_t byte_count() { return byte_count_; }
   size_t batch_count() { return batches_.size(); }
   bool empty() const { return batches_.empty(); }
   void Clear();
@@ -56,6 +58,7 @@ class ARROW_ACERO_EXPORT AccumulationQueue {
 
  private:
   int64_t row_count_;
+  int64_t byte_count_;
   std::vector<ExecBatch> batches_;
 };
 
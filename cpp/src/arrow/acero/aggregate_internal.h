@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <forward_list>
 #include <mutex>
 #include <sstream>
@@ -30,6 +31,7 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/spill_internal.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
@@ -60,6 +62,13 @@
 // keys. When a segment group end is reached while scanning the input, output is pushed
 // and the accumulating state is cleared. If no segment-keys are given, then the entire
 // input is taken as one segment group. One batch per segment group is sent to output.
+//
+// When QueryOptions::spilling_memory_budget is set, a group-by without segment-keys
+// spills once the estimated size of its states exceeds the budget. Kernel states cannot
+// be serialized, so the remaining input rows are spilled instead, partitioned by a hash
+// of the keys. After the in-memory states are merged, each partition is read back: rows
+// of groups already known update the merged state, the rest are aggregated on their own
+// and output before moving on to the next partition.
 
 namespace arrow {
 
@@ -245,7 +254,8 @@ class GroupByNode : public ExecNode, public TracedNode {
               std::vector<std::vector<TypeHolder>> agg_src_types,
               std::vector<std::vector<int>> agg_src_fieldsets,
               std::vector<Aggregate> aggs,
-              std::vector<const HashAggregateKernel*> agg_kernels)
+              std::vector<const HashAggregateKernel*> agg_kernels,
+              Ordering ordering = Ordering::Unordered())
       : ExecNode(input->plan(), {input}, {"groupby"}, std::move(output_schema)),
         TracedNode(this),
         segmenter_(std::move(segmenter)),
@@ -254,7 +264,8 @@ class GroupByNode : public ExecNode, public TracedNode {
         agg_src_types_(std::move(agg_src_types)),
         agg_src_fieldsets_(std::move(agg_src_fieldsets)),
         aggs_(std::move(aggs)),
-        agg_kernels_(std::move(agg_kernels)) {}
+        agg_kernels_(std::move(agg_kernels)),
+        ordering_(std::move(ordering)) {}
 
   Status Init() override;
 
@@ -270,6 +281,8 @@ class GroupByNode : public ExecNode, public TracedNode {
 
   const char* kind_name() const override { return "GroupByNode"; }
 
+  const Ordering& ordering() const override { return ordering_; }
+
   Status Consume(ExecSpan batch);
 
   Status Merge();
@@ -309,6 +322,10 @@ class GroupByNode : public ExecNode, public TracedNode {
   struct ThreadLocalState {
     std::unique_ptr<Grouper> grouper;
     std::vector<std::unique_ptr<KernelState>> agg_states;
+    /// \brief Input consumed so far, used to estimate the size of the state
+    int64_t consumed_rows = 0;
+    int64_t consumed_bytes = 0;
+    int64_t estimated_bytes = 0;
   };
 
   ThreadLocalState* GetLocalState() {
@@ -318,6 +335,29 @@ class GroupByNode : public ExecNode, public TracedNode {
 
   Status InitLocalStateIfNeeded(ThreadLocalState* state);
 
+  /// \brief Update the aggregate states of `state` given the group ids of `batch`
+  Status ConsumeAggregates(ThreadLocalState* state, const ExecSpan& batch,
+                           const Datum& id_batch);
+
+  Result<ExecBatch> Finalize(ThreadLocalState* state);
+
+  /// \brief Add the input consumed by `state` to the estimated size of all states,
+  /// starting to spill once it exceeds the memory budget
+  Status UpdateMemoryEstimate(ThreadLocalState* state, const ExecSpan& batch);
+
+  Status StartSpilling();
+
+  Status SpillBatch(size_t thread_index, const ExecBatch& batch);
+
+  /// \brief Aggregate the spilled input, one partition at a time
+  ///
+  /// Must be called after all local states have been merged into the first one.
+  /// Spilled rows whose key is already in the merged state update it in place,
+  /// the others are aggregated and output per partition.
+  Status AggregateSpilledPartitions();
+
+  Status ConsumeSpilledBatch(ThreadLocalState* partition_state, const ExecBatch& batch);
+
   int output_batch_size() const {
     int result =
         static_cast<int>(plan_->query_context()->exec_context()->exec_chunksize());
@@ -341,13 +381,31 @@ class GroupByNode : public ExecNode, public TracedNode {
   const std::vector<std::vector<int>> agg_src_fieldsets_;
   const std::vector<Aggregate> aggs_;
   const std::vector<const HashAggregateKernel*> agg_kernels_;
+  /// \brief The ordering of the output, set when the input is sorted on the keys
+  const Ordering ordering_;
 
   AtomicCounter input_counter_;
   /// \brief Total number of output batches produced
   int total_output_batches_ = 0;
+  /// \brief Index of the first output batch of out_data_
+  int output_index_base_ = 0;
+  /// \brief Results of segments not output yet, when grouping on segment keys only
+  std::vector<ExecBatch> pending_results_;
+  int64_t pending_rows_ = 0;
 
   std::vector<ThreadLocalState> local_states_;
   ExecBatch out_data_;
+
+  static constexpr int kNumSpillPartitions = 16;
+  /// \brief Estimated size of the local states above which the remaining input is
+  /// spilled, or -1 if this node never spills
+  int64_t spilling_memory_budget_ = -1;
+  std::atomic<int64_t> estimated_state_bytes_{0};
+  std::atomic<bool> spilling_{false};
+  std::mutex spill_mutex_;
+  std::unique_ptr<SpillDirectory> spill_directory_;
+  std::vector<std::unique_ptr<SpillFile>> spill_files_;
+  HashPartitioner spill_partitioner_;
 };
 
 }  // namespace aggregate
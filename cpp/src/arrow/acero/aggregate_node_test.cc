@@ -213,6 +213,33 @@ TEST(GroupByNode, NoSkipNulls) {
   AssertExecBatchesEqualIgnoringOrder(out_schema, {expected_batch}, out_batches.batches);
 }
 
+TEST(GroupByNode, SortedKeys) {
+  // Sorted on the keys, the groups are runs of rows which are aggregated without
+  // hashing, in the order of the input
+  std::shared_ptr<Schema> in_schema = schema(
+      {field("k1", int32()), field("k2", utf8()), field("value", int32())});
+  std::vector<ExecBatch> batches = {
+      ExecBatchFromJSON({int32(), utf8(), int32()},
+                        R"([[2, "b", 1], [1, "a", 2], [null, "a", 3], [1, "a", 4]])"),
+      ExecBatchFromJSON({int32(), utf8(), int32()},
+                        R"([[2, "a", 5], [1, null, 6], [2, "b", 7], [null, "a", 8]])")};
+  Ordering ordering({compute::SortKey("k1"), compute::SortKey("k2")},
+                    compute::NullPlacement::AtEnd);
+
+  Declaration plan = Declaration::Sequence(
+      {{"exec_batch_source", ExecBatchSourceNodeOptions(in_schema, std::move(batches))},
+       {"order_by", OrderByNodeOptions(ordering)},
+       {"aggregate", AggregateNodeOptions({{"hash_sum", nullptr, "value", "sum_value"}},
+                                          {"k1", "k2"})}});
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                       DeclarationToTable(std::move(plan), /*use_threads=*/false));
+
+  std::shared_ptr<Table> expected = TableFromJSON(
+      schema({field("k1", int32()), field("k2", utf8()), field("sum_value", int64())}),
+      {R"([[1, "a", 6], [1, null, 6], [2, "a", 5], [2, "b", 8], [null, "a", 11]])"});
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST(ScalarAggregateNode, AnyAll) {
   // GH-43768: boolean_any and boolean_all with constant input should work well
   // when min_count != 0.
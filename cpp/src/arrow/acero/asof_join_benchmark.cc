@@ -163,7 +163,32 @@ void SetArgs(benchmark::internal::Benchmark* bench) {
   }
 }
 
+static void AsOfJoinPartitioned(benchmark::State& state) {
+  int64_t tolerance = 0;
+  int num_right_tables = int(state.range(2));
+  auto options = std::make_shared<AsofJoinNodeOptions>(
+      GetRepeatedOptions(num_right_tables + 1, kTimeCol, {kKeyCol}, tolerance));
+  options->num_partitions = int(state.range(0));
+  TableGenerationProperties table_properties{400,
+                                             20,
+                                             int(state.range(1)),
+                                             "",
+                                             kDefaultMinColumnVal,
+                                             kDefaultMaxColumnVal,
+                                             0,
+                                             kDefaultStart,
+                                             kDefaultEnd};
+  TableJoinOverhead(state, table_properties, table_properties, /*batch_size=*/4000,
+                    num_right_tables, "asofjoin", std::move(options));
+}
+
 BENCHMARK(AsOfJoinOverhead)->Apply(SetArgs);
 
+// The scaling of the join with the number of partitions of the by-key values
+BENCHMARK(AsOfJoinPartitioned)
+    ->ArgNames({"num_partitions", "ids", "num_right_tables"})
+    ->ArgsProduct({{1, 2, 4, 8}, {1000, 10000}, {1, 10}})
+    ->UseRealTime();
+
 }  // namespace acero
 }  // namespace arrow
@@ -42,10 +42,12 @@
 #include "arrow/acero/util.h"
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/buffer.h"
 #ifndef NDEBUG
 #  include "arrow/compute/function_internal.h"
 #endif
 #include "arrow/acero/time_series_util.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/key_hash_internal.h"
 #include "arrow/compute/light_array_internal.h"
 #include "arrow/record_batch.h"
@@ -457,19 +459,39 @@ class KeyHasher {
   arrow::util::TempVectorStack stack_;
 };
 
+// The queues of an input in all the partitions of the node share a controller state, and
+// the input is paused while any of these queues is paused
 class BackpressureController : public BackpressureControl {
  public:
   BackpressureController(ExecNode* node, ExecNode* output,
-                         std::atomic<int32_t>& backpressure_counter)
-      : node_(node), output_(output), backpressure_counter_(backpressure_counter) {}
-
-  void Pause() override { node_->PauseProducing(output_, ++backpressure_counter_); }
-  void Resume() override { node_->ResumeProducing(output_, ++backpressure_counter_); }
+                         std::atomic<int32_t>& backpressure_counter,
+                         std::atomic<int>& num_paused)
+      : node_(node),
+        output_(output),
+        backpressure_counter_(backpressure_counter),
+        num_paused_(num_paused) {}
+
+  void Pause() override {
+    if (num_paused_++ == 0) {
+      node_->PauseProducing(output_, ++backpressure_counter_);
+    }
+  }
+  void Resume() override {
+    // A resume is also forced on shutdown, without a matching pause
+    int num_paused = num_paused_.load();
+    while (num_paused > 0 &&
+           !num_paused_.compare_exchange_weak(num_paused, num_paused - 1)) {
+    }
+    if (num_paused <= 1) {
+      node_->ResumeProducing(output_, ++backpressure_counter_);
+    }
+  }
 
  private:
   ExecNode* node_;
   ExecNode* output_;
   std::atomic<int32_t>& backpressure_counter_;
+  std::atomic<int>& num_paused_;
 };
 
 class InputState : public util::SerialSequencingQueue::Processor {
@@ -505,13 +527,13 @@ class InputState : public util::SerialSequencingQueue::Processor {
   static Result<std::unique_ptr<InputState>> Make(
       size_t index, TolType tolerance, bool must_hash, bool may_rehash,
       KeyHasher* key_hasher, ExecNode* asof_input, AsofJoinNode* asof_node,
-      std::atomic<int32_t>& backpressure_counter,
+      std::atomic<int32_t>& backpressure_counter, std::atomic<int>& num_paused,
       const std::shared_ptr<arrow::Schema>& schema, const col_index_t time_col_index,
       const std::vector<col_index_t>& key_col_index) {
     constexpr size_t low_threshold = 4, high_threshold = 8;
     std::unique_ptr<BackpressureControl> backpressure_control =
         std::make_unique<BackpressureController>(
-            /*node=*/asof_input, /*output=*/asof_node, backpressure_counter);
+            /*node=*/asof_input, /*output=*/asof_node, backpressure_counter, num_paused);
     ARROW_ASSIGN_OR_RAISE(
         auto handler, BackpressureHandler::Make(asof_input, low_threshold, high_threshold,
                                                 std::move(backpressure_control)));
@@ -811,6 +833,30 @@ class InputState : public util::SerialSequencingQueue::Processor {
   std::vector<std::optional<col_index_t>> src_to_dst_;
 };
 
+// InputRouter corresponds to an input of a partitioned as-of-join node.  It sequences
+// the batches of the input and splits each of them by partition of its by-key values,
+// before they are queued up in the InputState of each partition.
+class InputRouter : public util::SerialSequencingQueue::Processor {
+ public:
+  InputRouter(AsofJoinNode* node, size_t index, std::shared_ptr<Schema> schema)
+      : sequencer_(util::SerialSequencingQueue::Make(this)),
+        node_(node),
+        index_(index),
+        schema_(std::move(schema)) {}
+
+  Status InsertBatch(ExecBatch batch) {
+    return sequencer_->InsertBatch(std::move(batch));
+  }
+
+  Status Process(ExecBatch batch) override;
+
+ private:
+  std::unique_ptr<util::SerialSequencingQueue> sequencer_;
+  AsofJoinNode* node_;
+  size_t index_;
+  std::shared_ptr<Schema> schema_;
+};
+
 /// Wrapper around UnmaterializedCompositeTable that knows how to emplace
 /// the join row-by-row
 template <size_t MAX_TABLES>
@@ -933,7 +979,24 @@ class CompositeTableBuilder {
 // values are processed. Thus, AsofJoinNode is currently limited to about 100k by-keys for
 // guaranteeing this probability is below 1 in a billion. The fix is 128-bit hashing.
 // See ARROW-17653
-class AsofJoinNode : public ExecNode {
+class AsofJoinNode : public ExecNode, public TracedNode {
+  // The inputs of the node restricted to a partition of the by-key values.  The rows of
+  // a partition are joined in on-key order, independently of the other partitions.
+  struct Partition {
+    // Hashers of the by-key of each input, used by the InputStates
+    std::vector<std::unique_ptr<KeyHasher>> key_hashers;
+    // Each input state corresponds to an input table
+    std::vector<std::unique_ptr<InputState>> state;
+    std::mutex gate;
+#ifdef ARROW_ENABLE_THREADING
+    // Queue for triggering processing of the partition
+    // (a false value is a poison pill)
+    ConcurrentQueue<bool> process;
+    // Worker thread
+    std::thread process_thread;
+#endif
+  };
+
   // A simple wrapper for the result of a single call to UpdateRhs(), identifying:
   // 1) If any RHS has advanced.
   // 2) If all RHS are up to date with LHS.
@@ -945,12 +1008,13 @@ class AsofJoinNode : public ExecNode {
   // and checks if all RHS are up to date with LHS. The reason they have to be performed
   // together is that they both depend on the emptiness of the RHS, which can be changed
   // by Push() executing in another thread.
-  Result<RhsUpdateState> UpdateRhs() {
-    auto& lhs = *state_.at(0);
+  Result<RhsUpdateState> UpdateRhs(
+      const std::vector<std::unique_ptr<InputState>>& state) {
+    auto& lhs = *state.at(0);
     auto lhs_latest_time = lhs.GetLatestTime();
     RhsUpdateState update_state{/*any_advanced=*/false, /*all_up_to_date_with_lhs=*/true};
-    for (size_t i = 1; i < state_.size(); ++i) {
-      auto& rhs = *state_[i];
+    for (size_t i = 1; i < state.size(); ++i) {
+      auto& rhs = *state[i];
 
       // Obtain RHS emptiness once for subsequent AdvanceAndMemoize() and CurrentEmpty().
       bool rhs_empty = rhs.Empty();
@@ -976,14 +1040,15 @@ class AsofJoinNode : public ExecNode {
     return update_state;
   }
 
-  Result<std::shared_ptr<RecordBatch>> ProcessInner() {
-    DCHECK(!state_.empty());
-    auto& lhs = *state_.at(0);
+  Result<std::shared_ptr<RecordBatch>> ProcessInner(
+      std::vector<std::unique_ptr<InputState>>& state) {
+    DCHECK(!state.empty());
+    auto& lhs = *state.at(0);
 
     // Construct new target table if needed
-    CompositeTableBuilder<MAX_JOIN_TABLES> dst(state_, output_schema_,
+    CompositeTableBuilder<MAX_JOIN_TABLES> dst(state, output_schema_,
                                                plan()->query_context()->memory_pool(),
-                                               DEBUG_ADD(state_.size(), this));
+                                               DEBUG_ADD(state.size(), this));
 
     // Generate rows into the dst table until we either run out of data or hit the row
     // limit, or run out of input
@@ -991,7 +1056,7 @@ class AsofJoinNode : public ExecNode {
       // If LHS is finished or empty then there's nothing we can do here
       if (lhs.Finished() || lhs.Empty()) break;
 
-      ARROW_ASSIGN_OR_RAISE(auto rhs_update_state, UpdateRhs());
+      ARROW_ASSIGN_OR_RAISE(auto rhs_update_state, UpdateRhs(state));
 
       // If we have received enough inputs to produce the next output batch
       // (decided by IsUpToDateWithLhsRow), we will perform the join and
@@ -999,7 +1064,7 @@ class AsofJoinNode : public ExecNode {
       // the LHS and adding joined row to rows_ (done by Emplace). Finally,
       // input batches that are no longer needed are removed to free up memory.
       if (rhs_update_state.all_up_to_date_with_lhs) {
-        dst.Emplace(state_, tolerance_);
+        dst.Emplace(state, tolerance_);
         ARROW_ASSIGN_OR_RAISE(bool advanced, lhs.Advance());
         if (!advanced) break;  // if we can't advance LHS, we're done for this batch
       } else {
@@ -1009,10 +1074,10 @@ class AsofJoinNode : public ExecNode {
 
     // Prune memo entries that have expired (to bound memory consumption)
     if (!lhs.Empty()) {
-      for (size_t i = 1; i < state_.size(); ++i) {
+      for (size_t i = 1; i < state.size(); ++i) {
         OnType ts = tolerance_.Expiry(lhs.GetLatestTime());
         if (ts != TolType::kMinValue) {
-          state_[i]->RemoveMemoEntriesWithLesserTime(ts);
+          state[i]->RemoveMemoEntriesWithLesserTime(ts);
         }
       }
     }
@@ -1035,7 +1100,15 @@ class AsofJoinNode : public ExecNode {
     ~Defer() noexcept { callable(); }
   };
 
+  // Called once by the process thread of each partition when it ends.  The node ends
+  // when all partitions have ended, or as soon as one fails.
   void EndFromProcessThread(Status st = Status::OK()) {
+    if (st.ok() && --partitions_running_ > 0) {
+      return;
+    }
+    if (ended_.exchange(true)) {
+      return;
+    }
     // We must spawn a new task to transfer off the process thread when
     // marking this finished.  Otherwise there is a chance that doing so could
     // mark the plan finished which may destroy the plan which will destroy this
@@ -1046,29 +1119,37 @@ class AsofJoinNode : public ExecNode {
           if (st.ok()) {
             st = output_->InputFinished(this, batches_produced_);
           }
-          for (const auto& s : state_) {
-            st &= s->ForceShutdown();
+          for (const auto& partition : partitions_) {
+            for (const auto& s : partition->state) {
+              st &= s->ForceShutdown();
+            }
           }
         }));
   }
 
-  bool CheckEnded() {
-    if (state_.at(0)->Finished()) {
+  bool CheckEnded(Partition* partition) {
+    if (partition->state.at(0)->Finished()) {
       EndFromProcessThread();
       return false;
     }
     return true;
   }
 
-  bool Process() {
-    std::lock_guard<std::mutex> guard(gate_);
-    if (!CheckEnded()) {
+  bool Process(Partition* partition) {
+    // The joining happens here, on the process thread, rather than in InputReceived
+    auto scope = TraceFinish();
+    std::lock_guard<std::mutex> guard(partition->gate);
+    if (!CheckEnded(partition)) {
       return false;
     }
 
     // Process batches while we have data
     for (;;) {
-      Result<std::shared_ptr<RecordBatch>> result = ProcessInner();
+      if (ended_) {
+        // Another partition failed
+        return false;
+      }
+      Result<std::shared_ptr<RecordBatch>> result = ProcessInner(partition->state);
 
       if (result.ok()) {
         auto out_rb = *result;
@@ -1080,6 +1161,7 @@ class AsofJoinNode : public ExecNode {
         Status st = output_->InputReceived(this, std::move(out_b));
         if (!st.ok()) {
           EndFromProcessThread(std::move(st));
+          return false;
         }
       } else {
         EndFromProcessThread(result.status());
@@ -1092,7 +1174,7 @@ class AsofJoinNode : public ExecNode {
     //
     // It may happen here in cases where InputFinished was called before we were finished
     // producing results (so we didn't know the output size at that time)
-    if (!CheckEnded()) {
+    if (!CheckEnded(partition)) {
       return false;
     }
 
@@ -1101,19 +1183,17 @@ class AsofJoinNode : public ExecNode {
     return true;
   }
 
-  void ProcessThread() {
+  void ProcessThread(Partition* partition) {
     for (;;) {
-      if (!process_.WaitAndPop()) {
+      if (!partition->process.WaitAndPop()) {
         EndFromProcessThread();
         return;
       }
-      if (!Process()) {
+      if (!Process(partition)) {
         return;
       }
     }
   }
-
-  static void ProcessThreadWrapper(AsofJoinNode* node) { node->ProcessThread(); }
 #endif
 
  public:
@@ -1121,26 +1201,42 @@ class AsofJoinNode : public ExecNode {
                const std::vector<col_index_t>& indices_of_on_key,
                const std::vector<std::vector<col_index_t>>& indices_of_by_key,
                AsofJoinNodeOptions join_options, std::shared_ptr<Schema> output_schema,
-               std::vector<std::unique_ptr<KeyHasher>> key_hashers, bool must_hash,
-               bool may_rehash);
+               bool must_hash, bool may_rehash, int num_partitions);
 
   Status Init() override {
     auto inputs = this->inputs();
-    for (size_t i = 0; i < inputs.size(); i++) {
-      RETURN_NOT_OK(key_hashers_[i]->Init(plan()->query_context()->exec_context(),
-                                          inputs[i]->output_schema()));
-      ARROW_ASSIGN_OR_RAISE(
-          auto input_state,
-          InputState::Make(i, tolerance_, must_hash_, may_rehash_, key_hashers_[i].get(),
-                           inputs[i], this, backpressure_counter_,
-                           inputs[i]->output_schema(), indices_of_on_key_[i],
-                           indices_of_by_key_[i]));
-      state_.push_back(std::move(input_state));
+    auto exec_context = plan()->query_context()->exec_context();
+    for (auto& partition : partitions_) {
+      for (size_t i = 0; i < inputs.size(); i++) {
+        auto key_hasher = std::make_unique<KeyHasher>(i, indices_of_by_key_[i]);
+        key_hasher->node_ = this;
+        RETURN_NOT_OK(key_hasher->Init(exec_context, inputs[i]->output_schema()));
+        ARROW_ASSIGN_OR_RAISE(
+            auto input_state,
+            InputState::Make(i, tolerance_, must_hash_, may_rehash_, key_hasher.get(),
+                             inputs[i], this, backpressure_counter_, num_paused_[i],
+                             inputs[i]->output_schema(), indices_of_on_key_[i],
+                             indices_of_by_key_[i]));
+        partition->key_hashers.push_back(std::move(key_hasher));
+        partition->state.push_back(std::move(input_state));
+      }
+
+      col_index_t dst_offset = 0;
+      for (auto& state : partition->state)
+        dst_offset = state->InitSrcToDstMapping(dst_offset, !!dst_offset);
     }
 
-    col_index_t dst_offset = 0;
-    for (auto& state : state_)
-      dst_offset = state->InitSrcToDstMapping(dst_offset, !!dst_offset);
+    if (partitions_.size() > 1) {
+      for (size_t i = 0; i < inputs.size(); i++) {
+        auto key_hasher = std::make_unique<KeyHasher>(i, indices_of_by_key_[i]);
+        key_hasher->node_ = this;
+        RETURN_NOT_OK(key_hasher->Init(exec_context, inputs[i]->output_schema()));
+        router_key_hashers_.push_back(std::move(key_hasher));
+        routers_.push_back(
+            std::make_unique<InputRouter>(this, i, inputs[i]->output_schema()));
+      }
+    }
+    partitions_running_ = static_cast<int>(partitions_.size());
 
     return Status::OK();
   }
@@ -1148,12 +1244,57 @@ class AsofJoinNode : public ExecNode {
   virtual ~AsofJoinNode() {
 #ifdef ARROW_ENABLE_THREADING
     PushProcess(false);
-    if (process_thread_.joinable()) {
-      process_thread_.join();
+    for (auto& partition : partitions_) {
+      if (partition->process_thread.joinable()) {
+        partition->process_thread.join();
+      }
     }
 #endif
   }
 
+  // Splits a batch of the given input by partition of its by-key values, and queues up
+  // the slices in the input's InputState of each partition.  The rows of a slice keep
+  // their relative order, so each partition still sees its rows in on-key order.
+  Status PartitionBatch(size_t input, const std::shared_ptr<RecordBatch>& rb) {
+    DEBUG_SYNC(this, "received batch from input ", input, ":", DEBUG_MANIP(std::endl),
+               rb->ToString(), DEBUG_MANIP(std::endl));
+    const auto num_partitions = static_cast<int64_t>(partitions_.size());
+    const int64_t num_rows = rb->num_rows();
+    const auto& hashes = router_key_hashers_[input]->HashesFor(rb.get());
+
+    // Stable counting sort of the row indices by partition
+    std::vector<uint16_t> row_partitions(num_rows);
+    std::vector<int64_t> offsets(num_partitions + 1, 0);
+    for (int64_t i = 0; i < num_rows; ++i) {
+      row_partitions[i] = static_cast<uint16_t>((hashes[i] >> 32) % num_partitions);
+      ++offsets[row_partitions[i] + 1];
+    }
+    for (int64_t p = 0; p < num_partitions; ++p) {
+      offsets[p + 1] += offsets[p];
+    }
+    auto exec_context = plan()->query_context()->exec_context();
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> indices,
+        AllocateBuffer(num_rows * sizeof(int64_t), exec_context->memory_pool()));
+    auto indices_data = indices->mutable_data_as<int64_t>();
+    std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+    for (int64_t i = 0; i < num_rows; ++i) {
+      indices_data[positions[row_partitions[i]]++] = i;
+    }
+    router_key_hashers_[input]->Invalidate();
+
+    ARROW_ASSIGN_OR_RAISE(
+        Datum taken,
+        compute::Take(rb, std::make_shared<Int64Array>(num_rows, std::move(indices)),
+                      compute::TakeOptions::NoBoundsCheck(), exec_context));
+    const auto& sorted = taken.record_batch();
+    for (int64_t p = 0; p < num_partitions; ++p) {
+      ARROW_RETURN_NOT_OK(partitions_[p]->state[input]->Push(
+          sorted->Slice(offsets[p], offsets[p + 1] - offsets[p])));
+    }
+    return Status::OK();
+  }
+
   const std::vector<col_index_t>& indices_of_on_key() { return indices_of_on_key_; }
   const std::vector<std::vector<col_index_t>>& indices_of_by_key() {
     return indices_of_by_key_;
@@ -1390,20 +1531,30 @@ class AsofJoinNode : public ExecNode {
         std::shared_ptr<Schema> output_schema,
         MakeOutputSchema(input_schema, indices_of_on_key, indices_of_by_key));
 
-    std::vector<std::unique_ptr<KeyHasher>> key_hashers;
-    for (size_t i = 0; i < n_input; i++) {
-      key_hashers.push_back(std::make_unique<KeyHasher>(i, indices_of_by_key[i]));
-    }
     bool must_hash =
         n_by > 1 ||
         (n_by == 1 &&
          !is_primitive(
              inputs[0]->output_schema()->field(indices_of_by_key[0][0])->type()->id()));
     bool may_rehash = n_by == 1 && !must_hash;
+    if (join_options.num_partitions < 1 ||
+        join_options.num_partitions > std::numeric_limits<uint16_t>::max()) {
+      return Status::Invalid("AsofJoinNode num_partitions must be in [1, 65535], got ",
+                             join_options.num_partitions);
+    }
+    // Without a by-key there is a single partition, and without threads the partitions
+    // could not be processed concurrently anyway
+    int num_partitions = join_options.num_partitions;
+#ifndef ARROW_ENABLE_THREADING
+    num_partitions = 1;
+#endif
+    if (n_by == 0) {
+      num_partitions = 1;
+    }
     return plan->EmplaceNode<AsofJoinNode>(
         plan, inputs, std::move(input_labels), std::move(indices_of_on_key),
         std::move(indices_of_by_key), std::move(join_options), std::move(output_schema),
-        std::move(key_hashers), must_hash, may_rehash);
+        must_hash, may_rehash, num_partitions);
   }
 
   const char* kind_name() const override { return "AsofJoinNode"; }
@@ -1416,6 +1567,8 @@ class AsofJoinNode : public ExecNode {
     if (::arrow::compute::kUnsequencedIndex == batch.index)
       return Status::Invalid("AsofJoin requires sequenced input");
 
+    auto scope = TraceInputReceived(batch, input);
+
     if (process_task_.is_finished()) {
       DEBUG_SYNC(this, "Input received while done. Short circuiting.",
                  DEBUG_MANIP(std::endl));
@@ -1427,7 +1580,11 @@ class AsofJoinNode : public ExecNode {
     size_t k = std_find(inputs_, input) - inputs_.begin();
 
     // Put into the sequencing queue
-    ARROW_RETURN_NOT_OK(state_.at(k)->InsertBatch(std::move(batch)));
+    if (routers_.empty()) {
+      ARROW_RETURN_NOT_OK(partitions_[0]->state.at(k)->InsertBatch(std::move(batch)));
+    } else {
+      ARROW_RETURN_NOT_OK(routers_.at(k)->InsertBatch(std::move(batch)));
+    }
 
     PushProcess(true);
 
@@ -1435,11 +1592,11 @@ class AsofJoinNode : public ExecNode {
   }
 
   Status InputFinished(ExecNode* input, int total_batches) override {
-    {
-      std::lock_guard<std::mutex> guard(gate_);
-      ARROW_DCHECK(std_has(inputs_, input));
-      size_t k = std_find(inputs_, input) - inputs_.begin();
-      state_.at(k)->set_total_batches(total_batches);
+    ARROW_DCHECK(std_has(inputs_, input));
+    size_t k = std_find(inputs_, input) - inputs_.begin();
+    for (auto& partition : partitions_) {
+      std::lock_guard<std::mutex> guard(partition->gate);
+      partition->state.at(k)->set_total_batches(total_batches);
     }
     // Trigger a process call
     // The reason for this is that there are cases at the end of a table where we don't
@@ -1451,7 +1608,9 @@ class AsofJoinNode : public ExecNode {
   }
   void PushProcess(bool value) {
 #ifdef ARROW_ENABLE_THREADING
-    process_.Push(value);
+    for (auto& partition : partitions_) {
+      partition->process.Push(value);
+    }
 #else
     if (value) {
       ProcessNonThreaded();
@@ -1463,8 +1622,9 @@ class AsofJoinNode : public ExecNode {
 
 #ifndef ARROW_ENABLE_THREADING
   bool ProcessNonThreaded() {
+    auto scope = TraceFinish();
     while (!process_task_.is_finished()) {
-      Result<std::shared_ptr<RecordBatch>> result = ProcessInner();
+      Result<std::shared_ptr<RecordBatch>> result = ProcessInner(partitions_[0]->state);
 
       if (result.ok()) {
         auto out_rb = *result;
@@ -1487,7 +1647,7 @@ class AsofJoinNode : public ExecNode {
         return false;
       }
     }
-    auto& lhs = *state_.at(0);
+    auto& lhs = *partitions_[0]->state.at(0);
     if (lhs.Finished() && !process_task_.is_finished()) {
       EndFromSingleThread(Status::OK());
     }
@@ -1499,7 +1659,7 @@ class AsofJoinNode : public ExecNode {
     if (st.ok()) {
       st = output_->InputFinished(this, batches_produced_);
     }
-    for (const auto& s : state_) {
+    for (const auto& s : partitions_[0]->state) {
       st &= s->ForceShutdown();
     }
   }
@@ -1507,6 +1667,7 @@ class AsofJoinNode : public ExecNode {
 #endif
 
   Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
     ARROW_ASSIGN_OR_RAISE(process_task_, plan_->query_context()->BeginExternalTask(
                                              "AsofJoinNode::ProcessThread"));
     if (!process_task_.is_valid()) {
@@ -1514,7 +1675,10 @@ class AsofJoinNode : public ExecNode {
       return Status::OK();
     }
 #ifdef ARROW_ENABLE_THREADING
-    process_thread_ = std::thread(&AsofJoinNode::ProcessThreadWrapper, this);
+    for (auto& partition : partitions_) {
+      partition->process_thread =
+          std::thread(&AsofJoinNode::ProcessThread, this, partition.get());
+    }
 #endif
     return Status::OK();
   }
@@ -1524,7 +1688,9 @@ class AsofJoinNode : public ExecNode {
 
   Status StopProducingImpl() override {
 #ifdef ARROW_ENABLE_THREADING
-    process_.Clear();
+    for (auto& partition : partitions_) {
+      partition->process.Clear();
+    }
 #endif
     PushProcess(false);
     return Status::OK();
@@ -1537,17 +1703,20 @@ class AsofJoinNode : public ExecNode {
 #endif
 
  private:
-  // Outputs from this node are always in ascending order according to the on key
+  // Outputs from this node are in ascending order according to the on key, unless they
+  // are produced by several partitions
   const Ordering ordering_;
   std::vector<col_index_t> indices_of_on_key_;
   std::vector<std::vector<col_index_t>> indices_of_by_key_;
-  std::vector<std::unique_ptr<KeyHasher>> key_hashers_;
   bool must_hash_;
   bool may_rehash_;
-  // InputStates
-  // Each input state corresponds to an input table
-  std::vector<std::unique_ptr<InputState>> state_;
-  std::mutex gate_;
+  std::vector<std::unique_ptr<Partition>> partitions_;
+  // Routers of the inputs to the partitions, only used with more than one partition
+  std::vector<std::unique_ptr<InputRouter>> routers_;
+  std::vector<std::unique_ptr<KeyHasher>> router_key_hashers_;
+  // Number of partitions whose process thread has not ended yet
+  std::atomic<int> partitions_running_{0};
+  std::atomic<bool> ended_{false};
   TolType tolerance_;
 #ifndef NDEBUG
   std::ostream* debug_os_;
@@ -1556,17 +1725,12 @@ class AsofJoinNode : public ExecNode {
 
   // Backpressure counter common to all inputs
   std::atomic<int32_t> backpressure_counter_;
-#ifdef ARROW_ENABLE_THREADING
-  // Queue for triggering processing of a given input
-  // (a false value is a poison pill)
-  ConcurrentQueue<bool> process_;
-  // Worker thread
-  std::thread process_thread_;
-#endif
+  // Number of partitions pausing each input
+  std::vector<std::atomic<int>> num_paused_;
   Future<> process_task_;
 
   // In-progress batches produced
-  int batches_produced_ = 0;
+  std::atomic<int> batches_produced_{0};
 };
 
 AsofJoinNode::AsofJoinNode(ExecPlan* plan, NodeVector inputs,
@@ -1574,15 +1738,15 @@ AsofJoinNode::AsofJoinNode(ExecPlan* plan, NodeVector inputs,
                            const std::vector<col_index_t>& indices_of_on_key,
                            const std::vector<std::vector<col_index_t>>& indices_of_by_key,
                            AsofJoinNodeOptions join_options,
-                           std::shared_ptr<Schema> output_schema,
-                           std::vector<std::unique_ptr<KeyHasher>> key_hashers,
-                           bool must_hash, bool may_rehash)
+                           std::shared_ptr<Schema> output_schema, bool must_hash,
+                           bool may_rehash, int num_partitions)
     : ExecNode(plan, inputs, input_labels,
                /*output_schema=*/std::move(output_schema)),
-      ordering_({SortKey(indices_of_on_key[0])}),
+      TracedNode(this),
+      ordering_(num_partitions > 1 ? Ordering::Unordered()
+                                   : Ordering({SortKey(indices_of_on_key[0])})),
       indices_of_on_key_(std::move(indices_of_on_key)),
       indices_of_by_key_(std::move(indices_of_by_key)),
-      key_hashers_(std::move(key_hashers)),
       must_hash_(must_hash),
       may_rehash_(may_rehash),
       tolerance_(TolType(join_options.tolerance)),
@@ -1590,18 +1754,17 @@ AsofJoinNode::AsofJoinNode(ExecPlan* plan, NodeVector inputs,
       debug_os_(join_options.debug_opts ? join_options.debug_opts->os : nullptr),
       debug_mutex_(join_options.debug_opts ? join_options.debug_opts->mutex : nullptr),
 #endif
-      backpressure_counter_(1)
-#ifdef ARROW_ENABLE_THREADING
-      ,
-      process_(),
-      process_thread_()
-#endif
-{
-  for (auto& key_hasher : key_hashers_) {
-    key_hasher->node_ = this;
+      backpressure_counter_(1),
+      num_paused_(inputs.size()) {
+  for (int i = 0; i < num_partitions; ++i) {
+    partitions_.push_back(std::make_unique<Partition>());
   }
 }
 
+Status InputRouter::Process(ExecBatch batch) {
+  return node_->PartitionBatch(index_, *batch.ToRecordBatch(schema_));
+}
+
 namespace internal {
 void RegisterAsofJoinNode(ExecFactoryRegistry* registry) {
   DCHECK_OK(registry->AddFactory("asofjoin", AsofJoinNode::Make));
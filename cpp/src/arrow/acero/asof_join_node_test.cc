@@ -1713,6 +1713,47 @@ TEST(AsofJoinTest, RhsEmptinessRace) {
   AssertExecBatchesEqualIgnoringOrder(result.schema, {exp_batch}, result.batches);
 }
 
+TEST(AsofJoinTest, PartitionedByKey) {
+  auto left_batch = ExecBatchFromJSON({int64(), utf8(), int32()}, R"([
+      [1, "a", 1], [1, "b", 2], [2, "c", 3], [3, "a", 4], [4, "d", 5],
+      [5, "b", 6], [6, "c", 7], [7, "e", 8], [8, "a", 9], [9, "d", 10]])");
+  auto right_batch = ExecBatchFromJSON({int64(), utf8(), float64()}, R"([
+      [0, "a", 1.0], [1, "c", 2.0], [2, "b", 3.0], [3, "d", 4.0], [4, "a", 5.0],
+      [6, "e", 6.0], [7, "b", 7.0], [8, "c", 8.0]])");
+  auto l_schema =
+      schema({field("on", int64()), field("key", utf8()), field("l", int32())});
+  auto r_schema =
+      schema({field("on", int64()), field("key", utf8()), field("r", float64())});
+
+  auto run = [&](int num_partitions) {
+    Declaration left{"exec_batch_source",
+                     ExecBatchSourceNodeOptions(l_schema, {left_batch})};
+    Declaration right{"exec_batch_source",
+                      ExecBatchSourceNodeOptions(r_schema, {right_batch})};
+    AsofJoinNodeOptions options = GetRepeatedOptions(2, "on", {"key"}, -2);
+    options.num_partitions = num_partitions;
+    return DeclarationToExecBatches(
+        {"asofjoin", {std::move(left), std::move(right)}, std::move(options)});
+  };
+  ASSERT_OK_AND_ASSIGN(auto expected, run(1));
+  for (int num_partitions : {2, 3, 8}) {
+    ARROW_SCOPED_TRACE("num_partitions = ", num_partitions);
+    ASSERT_OK_AND_ASSIGN(auto actual, run(num_partitions));
+    AssertExecBatchesEqualIgnoringOrder(expected.schema, expected.batches,
+                                        actual.batches);
+  }
+
+  AsofJoinNodeOptions options = GetRepeatedOptions(2, "on", {"key"}, 0);
+  options.num_partitions = 0;
+  Declaration invalid{"asofjoin",
+                      {Declaration{"exec_batch_source",
+                                   ExecBatchSourceNodeOptions(l_schema, {left_batch})},
+                       Declaration{"exec_batch_source",
+                                   ExecBatchSourceNodeOptions(r_schema, {right_batch})}},
+                      std::move(options)};
+  ASSERT_RAISES(Invalid, DeclarationToStatus(std::move(invalid)));
+}
+
 // Reproduction of GH-41149: Another case of the same root cause as GH-40675, but with
 // empty "by" columns.
 TEST(AsofJoinTest, RhsEmptinessRaceEmptyBy) {
@@ -1738,6 +1779,31 @@ TEST(AsofJoinTest, RhsEmptinessRaceEmptyBy) {
   AssertExecBatchesEqualIgnoringOrder(result.schema, {exp_batch}, result.batches);
 }
 
+TEST(AsofJoinTest, NodeStatistics) {
+  auto left_batch = ExecBatchFromJSON(
+      {int64(), utf8()}, R"([[1, "a"], [1, "b"], [5, "a"], [6, "b"], [7, "f"]])");
+  auto right_batch = ExecBatchFromJSON(
+      {int64(), utf8(), float64()}, R"([[2, "a", 1.0], [9, "b", 3.0], [15, "g", 5.0]])");
+
+  Declaration left{
+      "exec_batch_source",
+      ExecBatchSourceNodeOptions(schema({field("colA", int64()), field("col2", utf8())}),
+                                 {std::move(left_batch)})};
+  Declaration right{
+      "exec_batch_source",
+      ExecBatchSourceNodeOptions(schema({field("colB", int64()), field("col3", utf8()),
+                                         field("colC", float64())}),
+                                 {std::move(right_batch)})};
+  AsofJoinNodeOptions asof_join_opts({{{"colA"}, {{"col2"}}}, {{"colB"}, {{"col3"}}}}, 1);
+  Declaration asof_join{
+      "asofjoin", {std::move(left), std::move(right)}, std::move(asof_join_opts)};
+
+  ASSERT_OK_AND_ASSIGN(std::string explained,
+                       DeclarationToExplainAnalyze(std::move(asof_join)));
+  ASSERT_THAT(explained, testing::ContainsRegex("AsofJoinNode\\{\\} \\[input_batches=2 "
+                                                "input_rows=8 [^]]* output_rows=5 "));
+}
+
 // Reproduction of GH-44526: Provoke destruction of not started asofjoin node by providing
 // a sink that fails on creation
 TEST(AsofJoinTest, DestroyNonStartedAsofJoinNode) {
@@ -18,6 +18,7 @@
 #include "arrow/acero/exec_plan.h"
 
 #include <atomic>
+#include <iomanip>
 #include <optional>
 #include <sstream>
 #include <unordered_map>
@@ -464,6 +465,10 @@ ExecNode::ExecNode(ExecPlan* plan, NodeVector inputs,
     DCHECK(!input->is_sink()) << " attempt to add a sink node as input";
     input->output_ = this;
   }
+  if (plan_ != nullptr && plan_->query_context()->options().collect_node_statistics) {
+    statistics_ = std::make_shared<NodeStatisticsCollector>(
+        static_cast<int>(inputs_.size()), plan_->query_context()->memory_pool());
+  }
 }
 
 const Ordering& ExecNode::ordering() const {
@@ -525,11 +530,50 @@ std::string ExecNode::ToString(int indent) const {
   }
 
   ss << '}';
+  if (statistics_) {
+    ss << " " << statistics().ToString();
+  }
   return ss.str();
 }
 
 std::string ExecNode::ToStringExtra(int indent) const { return ""; }
 
+NodeStatistics ExecNode::statistics() const {
+  NodeStatistics stats;
+  if (!statistics_) return stats;
+  NodeStatisticsCollector::BatchCounts input = statistics_->total_input_counts();
+  stats.input_batches = input.batches;
+  stats.input_rows = input.rows;
+  stats.input_bytes = input.bytes;
+  if (output_ != nullptr && output_->statistics_) {
+    std::optional<int> index = GetNodeIndex(output_->inputs(), this);
+    if (index) {
+      NodeStatisticsCollector::BatchCounts output =
+          output_->statistics_->input_counts(*index);
+      stats.output_batches = output.batches;
+      stats.output_rows = output.rows;
+      stats.output_bytes = output.bytes;
+    }
+  }
+  stats.processing_time_nanos = statistics_->processing_time_nanos();
+  stats.paused_time_nanos = statistics_->paused_time_nanos();
+  stats.peak_memory_bytes = statistics_->peak_memory_bytes();
+  return stats;
+}
+
+std::string NodeStatistics::ToString() const {
+  auto millis = [](int64_t nanos) { return static_cast<double>(nanos) / 1e6; };
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(3) << "[input_batches=" << input_batches
+     << " input_rows=" << input_rows << " input_bytes=" << input_bytes
+     << " output_batches=" << output_batches << " output_rows=" << output_rows
+     << " output_bytes=" << output_bytes
+     << " processing_time_ms=" << millis(processing_time_nanos)
+     << " paused_time_ms=" << millis(paused_time_nanos)
+     << " peak_memory_bytes=" << peak_memory_bytes << "]";
+  return ss.str();
+}
+
 std::shared_ptr<RecordBatchReader> MakeGeneratorReader(
     std::shared_ptr<Schema> schema, std::function<Future<std::optional<ExecBatch>>()> gen,
     MemoryPool* pool) {
@@ -568,8 +612,44 @@ std::shared_ptr<RecordBatchReader> MakeGeneratorReader(
   return out;
 }
 
+namespace {
+
+// An order_by declaration directly followed by a fetch declaration only needs to keep
+// the fetched rows, which the topk node does without accumulating the whole input.
+//
+// Only the fetch declaration and its direct input are replaced.  Nothing else in the
+// tree is rewritten, so any other node between an order_by and a fetch (or an order_by
+// which is already an ExecNode) keeps the two apart.
+std::optional<Declaration> FuseOrderByFetch(const Declaration& declaration,
+                                            ExecFactoryRegistry* registry) {
+  if (declaration.factory_name != FetchNodeOptions::kName ||
+      declaration.inputs.size() != 1) {
+    return std::nullopt;
+  }
+  const auto* order_by = std::get_if<Declaration>(&declaration.inputs[0]);
+  if (order_by == nullptr || order_by->factory_name != OrderByNodeOptions::kName ||
+      order_by->inputs.size() != 1 ||
+      !registry->GetFactory(std::string(TopKNodeOptions::kName)).ok()) {
+    return std::nullopt;
+  }
+  const auto& fetch_options =
+      checked_cast<const FetchNodeOptions&>(*declaration.options);
+  const auto& order_by_options =
+      checked_cast<const OrderByNodeOptions&>(*order_by->options);
+  return Declaration(std::string(TopKNodeOptions::kName), order_by->inputs,
+                     TopKNodeOptions(order_by_options.ordering, fetch_options.offset,
+                                     fetch_options.count),
+                     declaration.label);
+}
+
+}  // namespace
+
 Result<ExecNode*> Declaration::AddToPlan(ExecPlan* plan,
                                          ExecFactoryRegistry* registry) const {
+  if (std::optional<Declaration> fused = FuseOrderByFetch(*this, registry)) {
+    return fused->AddToPlan(plan, registry);
+  }
+
   std::vector<ExecNode*> inputs(this->inputs.size());
 
   size_t i = 0;
@@ -755,6 +835,36 @@ Result<std::string> DeclarationToString(const Declaration& declaration,
   return exec_plan->ToString();
 }
 
+Result<std::string> DeclarationToExplainAnalyze(Declaration declaration,
+                                                QueryOptions query_options) {
+  if (query_options.custom_cpu_executor != nullptr) {
+    return Status::Invalid("Cannot use synchronous methods with a custom CPU executor");
+  }
+  query_options.collect_node_statistics = true;
+  return ::arrow::internal::RunSynchronously<Future<std::string>>(
+      [=, declaration = std::move(declaration)](
+          ::arrow::internal::Executor* executor) -> Future<std::string> {
+        ExecContext exec_ctx(query_options.memory_pool, executor,
+                             query_options.function_registry);
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ExecPlan> exec_plan,
+                              ExecPlan::Make(query_options, exec_ctx));
+        ARROW_ASSIGN_OR_RAISE(ExecNode * last_node,
+                              declaration.AddToPlan(exec_plan.get()));
+        if (!last_node->is_sink()) {
+          ConsumingSinkNodeOptions sink_options(NullSinkNodeConsumer::Make());
+          sink_options.sequence_output = query_options.sequence_output;
+          Declaration null_sink("consuming_sink", {last_node}, sink_options);
+          ARROW_RETURN_NOT_OK(null_sink.AddToPlan(exec_plan.get()));
+        }
+        ARROW_RETURN_NOT_OK(exec_plan->Validate());
+        exec_plan->StartProducing();
+        // Keep the exec_plan alive until it finishes
+        return exec_plan->finished().Then(
+            [exec_plan]() -> Result<std::string> { return exec_plan->ToString(); });
+      },
+      query_options.use_threads);
+}
+
 Future<std::shared_ptr<Table>> DeclarationToTableAsync(Declaration declaration,
                                                        ExecContext exec_context) {
   return DeclarationToTableImpl(declaration,
@@ -1107,6 +1217,7 @@ void RegisterSourceNode(ExecFactoryRegistry*);
 void RegisterFetchNode(ExecFactoryRegistry*);
 void RegisterFilterNode(ExecFactoryRegistry*);
 void RegisterOrderByNode(ExecFactoryRegistry*);
+void RegisterTopKNode(ExecFactoryRegistry*);
 void RegisterPivotLongerNode(ExecFactoryRegistry*);
 void RegisterProjectNode(ExecFactoryRegistry*);
 void RegisterUnionNode(ExecFactoryRegistry*);
@@ -1115,6 +1226,8 @@ void RegisterSinkNode(ExecFactoryRegistry*);
 void RegisterHashJoinNode(ExecFactoryRegistry*);
 void RegisterAsofJoinNode(ExecFactoryRegistry*);
 void RegisterSortedMergeNode(ExecFactoryRegistry*);
+void RegisterWindowNode(ExecFactoryRegistry*);
+void RegisterRepartitionNode(ExecFactoryRegistry*);
 
 }  // namespace internal
 
@@ -1126,6 +1239,7 @@ ExecFactoryRegistry* default_exec_factory_registry() {
       internal::RegisterFetchNode(this);
       internal::RegisterFilterNode(this);
       internal::RegisterOrderByNode(this);
+      internal::RegisterTopKNode(this);
       internal::RegisterPivotLongerNode(this);
       internal::RegisterProjectNode(this);
       internal::RegisterUnionNode(this);
@@ -1134,6 +1248,8 @@ ExecFactoryRegistry* default_exec_factory_registry() {
       internal::RegisterHashJoinNode(this);
       internal::RegisterAsofJoinNode(this);
       internal::RegisterSortedMergeNode(this);
+      internal::RegisterWindowNode(this);
+      internal::RegisterRepartitionNode(this);
     }
 
     Result<Factory> GetFactory(const std::string& factory_name) override {
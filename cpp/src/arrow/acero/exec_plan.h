@@ -118,6 +118,31 @@ class ARROW_ACERO_EXPORT ExecPlan : public std::enable_shared_from_this<ExecPlan
   std::string ToString() const;
 };
 
+/// \brief Runtime statistics of a single node, collected while the plan runs
+///
+/// Statistics are only collected if QueryOptions::collect_node_statistics is set.
+/// Nodes record their input as they receive it and the time spent processing it.
+/// The output of a node is the input recorded by the node it feeds.
+struct ARROW_ACERO_EXPORT NodeStatistics {
+  /// Number of batches, rows and bytes received from all inputs
+  int64_t input_batches = 0;
+  int64_t input_rows = 0;
+  int64_t input_bytes = 0;
+  /// Number of batches, rows and bytes delivered to the output
+  int64_t output_batches = 0;
+  int64_t output_rows = 0;
+  int64_t output_bytes = 0;
+  /// Time spent processing input and finishing, excluding time spent in other nodes
+  int64_t processing_time_nanos = 0;
+  /// Time a source node spent paused because of backpressure
+  int64_t paused_time_nanos = 0;
+  /// Largest number of bytes allocated from the plan's memory pool when this node
+  /// finished processing a batch
+  int64_t peak_memory_bytes = 0;
+
+  std::string ToString() const;
+};
+
 // Acero can be extended by providing custom implementations of ExecNode.  The methods
 // below are documented in detail and provide careful instruction on how to fulfill the
 // ExecNode contract.  It's suggested you familiarize yourself with the Acero
@@ -329,6 +354,17 @@ class ARROW_ACERO_EXPORT ExecNode {
 
   std::string ToString(int indent = 0) const;
 
+  /// \brief The statistics collected so far
+  ///
+  /// All counters are zero unless QueryOptions::collect_node_statistics was set
+  NodeStatistics statistics() const;
+
+  /// \brief The collector nodes should report their activity to
+  ///
+  /// This is null unless QueryOptions::collect_node_statistics was set.  Nodes
+  /// do not normally need to use this directly, see TracedNode.
+  NodeStatisticsCollector* statistics_collector() const { return statistics_.get(); }
+
  protected:
   ExecNode(ExecPlan* plan, NodeVector inputs, std::vector<std::string> input_labels,
            std::shared_ptr<Schema> output_schema);
@@ -347,6 +383,8 @@ class ARROW_ACERO_EXPORT ExecNode {
 
   std::shared_ptr<Schema> output_schema_;
   ExecNode* output_ = NULLPTR;
+
+  std::shared_ptr<NodeStatisticsCollector> statistics_;
 };
 
 /// \brief An extensible registry for factories of ExecNodes
@@ -548,6 +586,10 @@ struct ARROW_ACERO_EXPORT QueryOptions {
   /// Must be null or remain valid for the duration of the plan.  If this is null then
   /// a default thread pool will be chosen whose behavior will be controlled by
   /// the `use_threads` option.
+  ///
+  /// Plans which spawn many small tasks (e.g. several concurrent plans on a large
+  /// machine) may benefit from an `arrow::internal::WorkStealingThreadPool`, which
+  /// keeps a task queue per worker instead of a single shared queue.
   ::arrow::internal::Executor* custom_cpu_executor = NULLPTR;
 
   /// \brief custom executor to use for IO work
@@ -602,6 +644,77 @@ struct ARROW_ACERO_EXPORT QueryOptions {
   /// If this field is not set then it will be treated as kWarn unless overridden
   /// by the ACERO_ALIGNMENT_HANDLING environment variable
   std::optional<UnalignedBufferHandling> unaligned_buffer_handling;
+
+  /// \brief Memory budget, in bytes, for nodes that are able to spill to disk
+  ///
+  /// Nodes that support spilling will keep up to this many bytes of accumulated
+  /// input in memory.  Once the budget is exceeded they will write their input to
+  /// temporary files and process it, one partition or run at a time, once the input
+  /// is exhausted.
+  ///
+  /// Spill files are created in a temporary directory under the system temporary
+  /// directory (the TMPDIR environment variable is honored) and are removed when the
+  /// plan finishes.
+  ///
+  /// If this field is not set then nodes never spill to disk.
+  std::optional<int64_t> spilling_memory_budget;
+
+  /// \brief Budget, in bytes, for the data queued up by the nodes of the plan
+  ///
+  /// Nodes that hold on to batches until some other event (e.g. a hash join queuing
+  /// probe-side batches until its hash table is built, or a sink waiting for the
+  /// consumer) report the bytes they hold to the QueryContext.  While the total is
+  /// above the budget, source nodes wait before reading more data.
+  ///
+  /// Source nodes never wait while a node is accumulating its whole input (e.g. an
+  /// order by node, or the build side of a hash join), since that input is needed
+  /// before anything can be released.  Combine this with spilling_memory_budget to
+  /// bound the memory held by such nodes.
+  ///
+  /// If this field is not set then sources only respond to the backpressure of their
+  /// outputs.
+  std::optional<int64_t> queued_bytes_budget;
+
+  /// \brief Target number of rows of the batches that source nodes deliver
+  ///
+  /// Source nodes always slice batches larger than ExecPlan::kMaxBatchSize, without
+  /// copying.  If this field is set then they slice batches larger than this many
+  /// rows, and concatenate batches smaller than half of it, so that every task
+  /// processes a morsel of about this many rows.  Values above
+  /// ExecPlan::kMaxBatchSize are capped.
+  ///
+  /// This is ignored if use_legacy_batching is true.
+  std::optional<int64_t> morsel_size;
+
+  /// \brief Should source nodes adapt the size of morsels to the cost of processing
+  /// them
+  ///
+  /// If true then source nodes time the processing of every morsel and, while a
+  /// morsel takes longer than a millisecond, deliver smaller morsels (down to
+  /// MorselBatcher::kMinMorselSize rows) so that the work spreads over more tasks.
+  /// The size starts at morsel_size, or ExecPlan::kMaxBatchSize if that isn't set.
+  /// Small batches are concatenated, as if morsel_size was set.
+  bool adaptive_morsel_size = false;
+
+  /// \brief Should nodes collect runtime statistics
+  ///
+  /// If true then every node counts the batches, rows and bytes it receives and
+  /// measures the time it spends processing them.  The statistics are available
+  /// from ExecNode::statistics and are included in ExecPlan::ToString.
+  ///
+  /// Collecting statistics adds a small amount of overhead to every batch.
+  bool collect_node_statistics = false;
+
+  /// \brief Translates the expressions of project and filter nodes
+  ///
+  /// If set then project and filter nodes pass each of their expressions to it
+  /// and evaluate the compiled expressions it returns instead of interpreting
+  /// them with compute::ExecuteScalarExpression.  Expressions it doesn't
+  /// support are still interpreted.
+  ///
+  /// For example, gandiva::MakeAceroExpressionCompiler generates code for the
+  /// expressions that Gandiva supports.
+  std::shared_ptr<ExpressionCompiler> expression_compiler;
 };
 
 /// \brief Calculate the output schema of a declaration
@@ -777,6 +890,16 @@ DeclarationToStatus(Declaration declaration, bool use_threads = true,
 ARROW_ACERO_EXPORT Status DeclarationToStatus(Declaration declaration,
                                               QueryOptions query_options);
 
+/// \brief Run a declaration and describe the plan along with its runtime statistics
+///
+/// The plan is run to completion, as in DeclarationToStatus, with
+/// QueryOptions::collect_node_statistics enabled.  The returned string is the
+/// ExecPlan::ToString of the finished plan, which lists the statistics of every node.
+///
+/// \see DeclarationToTable for details on threading & execution
+ARROW_ACERO_EXPORT Result<std::string> DeclarationToExplainAnalyze(
+    Declaration declaration, QueryOptions query_options = {});
+
 /// \brief Asynchronous version of \see DeclarationToStatus
 ///
 /// This can be useful when the data are consumed as part of the plan itself, for
@@ -17,6 +17,7 @@
 
 #include "benchmark/benchmark.h"
 
+#include <limits>
 #include <thread>
 
 #include "arrow/acero/test_util_internal.h"
@@ -25,6 +26,7 @@
 #include "arrow/dataset/partition.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 
 namespace arrow {
@@ -106,6 +108,26 @@ static void ExecuteScalarExpressionOverhead(benchmark::State& state, Expression
       static_cast<double>(state.iterations() * num_batches), benchmark::Counter::kIsRate);
 }
 
+// Evaluate expr over batches of 1M rows, in tiles of state.range(0) rows.  A tile
+// length of 0 sizes the tiles from the L2 cache and INT64_MAX evaluates each call over
+// the whole batch.
+static void ExecuteScalarExpressionTiled(benchmark::State& state, Expression expr) {
+  constexpr int64_t kRowsPerBatch = 1000000;
+  ExecContext ctx;
+  ctx.set_expression_tile_length(state.range(0));
+  auto dataset_schema = schema({field("x", int64()), field("y", float64())});
+  random::RandomArrayGenerator rng(42);
+  ExecBatch input({rng.Int64(kRowsPerBatch, -100, 100, /*null_probability=*/0.1),
+                   rng.Float64(kRowsPerBatch, -100, 100, /*null_probability=*/0.1)},
+                  kRowsPerBatch);
+
+  ASSIGN_OR_ABORT(auto bound, expr.Bind(*dataset_schema));
+  for (auto _ : state) {
+    ABORT_NOT_OK(ExecuteScalarExpression(bound, input, &ctx).status());
+  }
+  state.SetItemsProcessed(state.iterations() * kRowsPerBatch);
+}
+
 /// \brief Baseline benchmarks are implemented in pure C++ without arrow for performance
 /// comparison.
 template <typename BenchmarkType>
@@ -160,6 +182,11 @@ auto simple_expression = call("negate", {field_ref("x")});
 auto zero_copy_expression =
     call("cast", {field_ref("x")}, compute::CastOptions::Safe(timestamp(TimeUnit::NANO)));
 auto ref_only_expression = field_ref("x");
+// (x * 2 + x) > y
+auto fusible_expression =
+    greater(call("add", {call("multiply", {field_ref("x"), literal(int64_t(2))}),
+                         field_ref("x")}),
+            field_ref("y"));
 
 // Negative queries (partition expressions that fail the filter)
 BENCHMARK_CAPTURE(SimplifyFilterWithGuarantee, negative_filter_simple_guarantee_simple,
@@ -297,5 +324,11 @@ BENCHMARK_CAPTURE(ExecuteScalarExpressionOverhead, ref_only_expression,
     ->DenseThreadRange(1, std::thread::hardware_concurrency(),
                        std::thread::hardware_concurrency())
     ->UseRealTime();
+BENCHMARK_CAPTURE(ExecuteScalarExpressionTiled, fusible_expression, fusible_expression)
+    ->ArgNames({"tile_length"})
+    ->Arg(0)
+    ->RangeMultiplier(4)
+    ->Range(1024, 1024 * 1024)
+    ->Arg(std::numeric_limits<int64_t>::max());
 }  // namespace acero
 }  // namespace arrow
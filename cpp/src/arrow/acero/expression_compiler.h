@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/acero/type_fwd.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/compute/type_fwd.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace acero {
+
+/// \brief An expression translated by an ExpressionCompiler
+class ARROW_ACERO_EXPORT CompiledExpression {
+ public:
+  virtual ~CompiledExpression() = default;
+
+  /// \brief Evaluate the expression on a non-empty batch
+  ///
+  /// The batch has the schema the expression was compiled for and no selection
+  /// vector.  The result must be an array of the expression's type and of the
+  /// batch's length, or a scalar.
+  virtual Result<Datum> Execute(const compute::ExecBatch& batch,
+                                compute::ExecContext* exec_context) const = 0;
+};
+
+/// \brief Translates the expressions of project and filter nodes for another
+/// execution engine, e.g. to generate code for them
+///
+/// See QueryOptions::expression_compiler.
+class ARROW_ACERO_EXPORT ExpressionCompiler {
+ public:
+  virtual ~ExpressionCompiler() = default;
+
+  /// \brief Compile a bound expression for batches of the given schema
+  ///
+  /// Return null if the expression, or any of its subexpressions, is not
+  /// supported: the node then evaluates it with compute::ExecuteScalarExpression.
+  /// A node compiles each of its expressions once, when it is created.
+  virtual Result<std::shared_ptr<CompiledExpression>> Compile(
+      const compute::Expression& expression, const std::shared_ptr<Schema>& schema) = 0;
+};
+
+}  // namespace acero
+}  // namespace arrow
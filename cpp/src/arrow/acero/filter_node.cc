@@ -15,10 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <limits>
+
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/expression_compiler.h"
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/array_primitive.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/expression.h"
@@ -41,9 +47,11 @@ namespace {
 class FilterNode : public MapNode {
  public:
   FilterNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
-             std::shared_ptr<Schema> output_schema, Expression filter)
+             std::shared_ptr<Schema> output_schema, Expression filter,
+             std::shared_ptr<CompiledExpression> compiled_filter)
       : MapNode(plan, std::move(inputs), std::move(output_schema)),
-        filter_(std::move(filter)) {}
+        filter_(std::move(filter)),
+        compiled_filter_(std::move(compiled_filter)) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -57,6 +65,8 @@ class FilterNode : public MapNode {
       ARROW_ASSIGN_OR_RAISE(
           filter_expression,
           filter_expression.Bind(*schema, plan->query_context()->exec_context()));
+    } else {
+      RETURN_NOT_OK(ValidateBoundExpression(filter_expression, *schema));
     }
 
     if (filter_expression.type()->id() != Type::BOOL) {
@@ -64,25 +74,27 @@ class FilterNode : public MapNode {
                                filter_expression.ToString(), " evaluates to ",
                                filter_expression.type()->ToString());
     }
+
+    std::shared_ptr<CompiledExpression> compiled_filter;
+    if (const auto& compiler = plan->query_context()->options().expression_compiler) {
+      ARROW_ASSIGN_OR_RAISE(compiled_filter,
+                            compiler->Compile(filter_expression, schema));
+    }
     return plan->EmplaceNode<FilterNode>(plan, std::move(inputs), std::move(schema),
-                                         std::move(filter_expression));
+                                         std::move(filter_expression),
+                                         std::move(compiled_filter));
   }
 
   const char* kind_name() const override { return "FilterNode"; }
 
-  Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
-    ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
-                          SimplifyWithGuarantee(filter_, batch.guarantee));
-
-    arrow::util::tracing::Span span;
-    START_COMPUTE_SPAN(span, "Filter",
-                       {{"filter.expression", ToStringExtra()},
-                        {"filter.expression.simplified", simplified_filter.ToString()},
-                        {"filter.length", batch.length}});
+  Status StartProducing() override {
+    auto map_output = dynamic_cast<const MapNode*>(output_);
+    defer_selection_ = map_output != nullptr && map_output->accepts_selection_vector();
+    return MapNode::StartProducing();
+  }
 
-    ARROW_ASSIGN_OR_RAISE(
-        Datum mask, ExecuteScalarExpression(simplified_filter, batch,
-                                            plan()->query_context()->exec_context()));
+  Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
+    ARROW_ASSIGN_OR_RAISE(Datum mask, ComputeMask(batch));
 
     if (mask.is_scalar()) {
       const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
@@ -96,6 +108,16 @@ class FilterNode : public MapNode {
     DCHECK(!std::all_of(batch.values.begin(), batch.values.end(),
                         [](const Datum& value) { return value.is_scalar(); }));
 
+    if (defer_selection_ && batch.length <= std::numeric_limits<int32_t>::max()) {
+      // The output only gathers the selected rows of the columns it uses
+      ARROW_ASSIGN_OR_RAISE(batch.selection_vector,
+                            compute::SelectionVector::FromMask(
+                                BooleanArray(mask.array()),
+                                plan()->query_context()->memory_pool()));
+      batch.length = batch.selection_vector->length();
+      return batch;
+    }
+
     auto values = batch.values;
     for (auto& value : values) {
       if (value.is_scalar()) continue;
@@ -110,7 +132,37 @@ class FilterNode : public MapNode {
   }
 
  private:
+  Result<Datum> ComputeMask(const ExecBatch& batch) {
+    // Batches of scalars are cheap to interpret, and must produce a scalar mask
+    if (compiled_filter_ && batch.length > 0 &&
+        std::any_of(batch.values.begin(), batch.values.end(),
+                    [](const Datum& value) { return value.is_array(); })) {
+      arrow::util::tracing::Span span;
+      START_COMPUTE_SPAN(span, "Filter",
+                         {{"filter.expression", ToStringExtra()},
+                          {"filter.length", batch.length}});
+      return compiled_filter_->Execute(batch, plan()->query_context()->exec_context());
+    }
+
+    ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
+                          SimplifyWithGuarantee(filter_, batch.guarantee));
+
+    arrow::util::tracing::Span span;
+    START_COMPUTE_SPAN(span, "Filter",
+                       {{"filter.expression", ToStringExtra()},
+                        {"filter.expression.simplified", simplified_filter.ToString()},
+                        {"filter.length", batch.length}});
+
+    return ExecuteScalarExpression(simplified_filter, batch,
+                                   plan()->query_context()->exec_context());
+  }
+
   Expression filter_;
+  // The translation of filter_ by QueryOptions::expression_compiler, or null if
+  // it is interpreted
+  std::shared_ptr<CompiledExpression> compiled_filter_;
+  // Whether to emit a selection vector instead of filtering each column
+  bool defer_selection_ = false;
 };
 }  // namespace
 
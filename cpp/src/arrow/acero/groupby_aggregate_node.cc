@@ -15,7 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <mutex>
+#include <optional>
 #include <sstream>
 #include <thread>
 #include <unordered_map>
@@ -27,6 +29,10 @@
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
 #include "arrow/acero/util.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/registry.h"
@@ -55,14 +61,124 @@ using compute::KernelState;
 using compute::RowSegmenter;
 using compute::ScalarAggregateKernel;
 using compute::Segment;
+using compute::SortKey;
 
 namespace acero {
 namespace aggregate {
 
+namespace {
+
+Result<ExecBatch> TakeRows(const ExecBatch& batch, const std::vector<int32_t>& row_ids,
+                           ExecContext* ctx) {
+  Int32Builder builder(ctx->memory_pool());
+  RETURN_NOT_OK(builder.AppendValues(row_ids));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> indices, builder.Finish());
+  std::vector<Datum> values(batch.values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(
+        values[i],
+        compute::Take(batch[i], indices, compute::TakeOptions::NoBoundsCheck(), ctx));
+  }
+  return ExecBatch(std::move(values), static_cast<int64_t>(row_ids.size()));
+}
+
+// If the input is sorted on the segment keys and keys, as a set, return the ordering
+// of the output, whose first fields are the segment keys followed by the keys
+Result<std::optional<Ordering>> GetSortedKeysOrdering(
+    const Schema& input_schema, const Ordering& input_ordering,
+    const std::vector<FieldRef>& segment_keys, const std::vector<FieldRef>& keys) {
+  std::unordered_map<int, int> output_field_ids;
+  for (const auto& key : segment_keys) {
+    ARROW_ASSIGN_OR_RAISE(auto match, key.FindOne(input_schema));
+    output_field_ids.emplace(match[0], static_cast<int>(output_field_ids.size()));
+  }
+  for (const auto& key : keys) {
+    ARROW_ASSIGN_OR_RAISE(auto match, key.FindOne(input_schema));
+    // Dictionary indices are only comparable within a single dictionary
+    if (input_schema.field(match[0])->type()->id() == Type::DICTIONARY) {
+      return std::nullopt;
+    }
+    output_field_ids.emplace(match[0], static_cast<int>(output_field_ids.size()));
+  }
+  const auto& sort_keys = input_ordering.sort_keys();
+  if (sort_keys.size() < output_field_ids.size()) {
+    return std::nullopt;
+  }
+  std::vector<SortKey> output_sort_keys;
+  std::unordered_set<int> seen;
+  for (size_t i = 0; i < output_field_ids.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto match, sort_keys[i].target.FindOneOrNone(input_schema));
+    if (match.empty()) {
+      return std::nullopt;
+    }
+    auto it = output_field_ids.find(match[0]);
+    if (it == output_field_ids.end() || !seen.insert(match[0]).second) {
+      return std::nullopt;
+    }
+    output_sort_keys.emplace_back(FieldRef(it->second), sort_keys[i].order);
+  }
+  return Ordering(std::move(output_sort_keys), input_ordering.null_placement());
+}
+
+// Concatenate batches, expanding their scalars to arrays
+Result<ExecBatch> ConcatenateBatches(const std::vector<ExecBatch>& batches,
+                                     MemoryPool* pool) {
+  DCHECK(!batches.empty());
+  if (batches.size() == 1) {
+    return batches[0];
+  }
+  int64_t length = 0;
+  for (const auto& batch : batches) {
+    length += batch.length;
+  }
+  ExecBatch out({}, length);
+  for (int i = 0; i < batches[0].num_values(); ++i) {
+    ArrayVector arrays;
+    for (const auto& batch : batches) {
+      const Datum& value = batch[i];
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto array, MakeArrayFromScalar(*value.scalar(), batch.length, pool));
+        arrays.push_back(std::move(array));
+      } else {
+        arrays.push_back(value.make_array());
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto array, Concatenate(arrays, pool));
+    out.values.emplace_back(std::move(array));
+  }
+  return out;
+}
+
+}  // namespace
+
 Status GroupByNode::Init() {
-  output_task_group_id_ = plan_->query_context()->RegisterTaskGroup(
+  QueryContext* ctx = plan_->query_context();
+  output_task_group_id_ = ctx->RegisterTaskGroup(
       [this](size_t, int64_t task_id) { return OutputNthBatch(task_id); },
       [](size_t) { return Status::OK(); });
+
+  // Spilled rows are aggregated after all other input, which would break ordered
+  // aggregates, and segments must be output as soon as they end.  Dictionary keys
+  // are hashed by index, which is only meaningful within a single dictionary.
+  const auto& input_schema = inputs_[0]->output_schema();
+  const auto& budget = ctx->options().spilling_memory_budget;
+  bool can_spill = budget.has_value() && !key_field_ids_.empty() &&
+                   segment_key_field_ids_.empty() &&
+                   std::none_of(agg_kernels_.begin(), agg_kernels_.end(),
+                                [](const HashAggregateKernel* kernel) {
+                                  return kernel->ordered;
+                                }) &&
+                   std::none_of(key_field_ids_.begin(), key_field_ids_.end(),
+                                [&](int field_id) {
+                                  return input_schema->field(field_id)->type()->id() ==
+                                         Type::DICTIONARY;
+                                });
+  if (can_spill) {
+    spilling_memory_budget_ = *budget;
+    RETURN_NOT_OK(spill_partitioner_.Init(ctx, key_field_ids_, kNumSpillPartitions,
+                                          ctx->max_concurrency()));
+  }
   return Status::OK();
 }
 
@@ -119,8 +235,13 @@ Result<AggregateNodeArgs<HashAggregateKernel>> GroupByNode::MakeAggregateNodeArg
     segment_key_types[i] = input_schema->field(segment_key_field_id)->type().get();
   }
 
-  ARROW_ASSIGN_OR_RAISE(auto segmenter, RowSegmenter::Make(std::move(segment_key_types),
-                                                           /*nullable_keys=*/false, ctx));
+  bool nullable_segment_keys = false;
+  for (const auto& segment_key_field_id : segment_key_field_ids) {
+    nullable_segment_keys |= input_schema->field(segment_key_field_id)->nullable();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto segmenter,
+                        RowSegmenter::Make(std::move(segment_key_types),
+                                           nullable_segment_keys, ctx));
 
   // Construct aggregates
   ARROW_ASSIGN_OR_RAISE(auto agg_kernels, GetKernels(ctx, aggs, agg_src_types));
@@ -183,13 +304,28 @@ Result<ExecNode*> GroupByNode::Make(ExecPlan* plan, std::vector<ExecNode*> input
 
   auto input = inputs[0];
   const auto& aggregate_options = checked_cast<const AggregateNodeOptions&>(options);
-  const auto& keys = aggregate_options.keys;
-  const auto& segment_keys = aggregate_options.segment_keys;
+  auto keys = aggregate_options.keys;
+  auto segment_keys = aggregate_options.segment_keys;
   auto aggs = aggregate_options.aggregates;
   bool is_cpu_parallel = plan->query_context()->executor()->GetCapacity() > 1;
 
   const auto& input_schema = input->output_schema();
   auto exec_ctx = plan->query_context()->exec_context();
+
+  // When the input is sorted on the keys, each group is a run of adjacent rows.  The
+  // keys are then segment keys, which are compared rather than hashed, and each group
+  // is final as soon as its run ends.  The output fields are the same.
+  Ordering ordering = Ordering::Unordered();
+  if (!is_cpu_parallel && !keys.empty()) {
+    ARROW_ASSIGN_OR_RAISE(auto sorted_keys_ordering,
+                          GetSortedKeysOrdering(*input_schema, input->ordering(),
+                                                segment_keys, keys));
+    if (sorted_keys_ordering.has_value()) {
+      ordering = std::move(*sorted_keys_ordering);
+      segment_keys.insert(segment_keys.end(), keys.begin(), keys.end());
+      keys.clear();
+    }
+  }
   ARROW_ASSIGN_OR_RAISE(
       auto args, MakeAggregateNodeArgs(input_schema, keys, segment_keys, aggs, exec_ctx,
                                        is_cpu_parallel));
@@ -198,7 +334,7 @@ Result<ExecNode*> GroupByNode::Make(ExecPlan* plan, std::vector<ExecNode*> input
       input, std::move(args.output_schema), std::move(args.grouping_key_field_ids),
       std::move(args.segment_key_field_ids), std::move(args.segmenter),
       std::move(args.kernel_intypes), std::move(args.target_fieldsets),
-      std::move(args.aggregates), std::move(args.kernels));
+      std::move(args.aggregates), std::move(args.kernels), std::move(ordering));
 }
 
 Status GroupByNode::ResetKernelStates() {
@@ -214,6 +350,10 @@ Status GroupByNode::Consume(ExecSpan batch) {
                               local_states_.size(), ")");
   }
 
+  if (spilling_.load()) {
+    return SpillBatch(thread_index, batch.ToExecBatch());
+  }
+
   auto state = &local_states_[thread_index];
   RETURN_NOT_OK(InitLocalStateIfNeeded(state));
 
@@ -227,6 +367,16 @@ Status GroupByNode::Consume(ExecSpan batch) {
   // Create a batch with group ids
   ARROW_ASSIGN_OR_RAISE(Datum id_batch, state->grouper->Consume(key_batch));
 
+  RETURN_NOT_OK(ConsumeAggregates(state, batch, id_batch));
+
+  if (spilling_memory_budget_ >= 0) {
+    RETURN_NOT_OK(UpdateMemoryEstimate(state, batch));
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::ConsumeAggregates(ThreadLocalState* state, const ExecSpan& batch,
+                                      const Datum& id_batch) {
   // Execute aggregate kernels
   for (size_t i = 0; i < agg_kernels_.size(); ++i) {
     arrow::util::tracing::Span span;
@@ -252,6 +402,124 @@ Status GroupByNode::Consume(ExecSpan batch) {
   return Status::OK();
 }
 
+Status GroupByNode::UpdateMemoryEstimate(ThreadLocalState* state,
+                                         const ExecSpan& batch) {
+  // Kernel states do not report their size, assume every group costs about as much
+  // as an input row.
+  state->consumed_rows += batch.length;
+  state->consumed_bytes += batch.ToExecBatch().TotalBufferSize();
+  if (state->consumed_rows == 0) {
+    return Status::OK();
+  }
+  int64_t estimated_bytes = static_cast<int64_t>(state->grouper->num_groups()) *
+                            state->consumed_bytes / state->consumed_rows;
+  int64_t total = estimated_state_bytes_.fetch_add(estimated_bytes -
+                                                   state->estimated_bytes) +
+                  estimated_bytes - state->estimated_bytes;
+  state->estimated_bytes = estimated_bytes;
+  if (total > spilling_memory_budget_ && !spilling_.load()) {
+    return StartSpilling();
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::StartSpilling() {
+  std::lock_guard<std::mutex> lock(spill_mutex_);
+  if (spill_directory_) {
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(spill_directory_, SpillDirectory::Make(plan_->query_context()));
+  spill_files_.resize(kNumSpillPartitions);
+  for (int partition = 0; partition < kNumSpillPartitions; ++partition) {
+    ARROW_ASSIGN_OR_RAISE(spill_files_[partition],
+                          spill_directory_->NewFile(inputs_[0]->output_schema()));
+  }
+  // Only publish once the files exist, other threads start appending right away
+  spilling_.store(true);
+  return Status::OK();
+}
+
+Status GroupByNode::SpillBatch(size_t thread_index, const ExecBatch& batch) {
+  if (batch.length == 0) {
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(std::vector<ExecBatch> partitions,
+                        spill_partitioner_.Split(thread_index, batch));
+  for (int partition = 0; partition < kNumSpillPartitions; ++partition) {
+    RETURN_NOT_OK(spill_files_[partition]->Append(partitions[partition]));
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::ConsumeSpilledBatch(ThreadLocalState* partition_state,
+                                        const ExecBatch& batch) {
+  ThreadLocalState* state0 = &local_states_[0];
+  ExecSpan span(batch);
+  std::vector<ExecValue> keys(key_field_ids_.size());
+  for (size_t i = 0; i < key_field_ids_.size(); ++i) {
+    keys[i] = span[key_field_ids_[i]];
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum ids,
+                        state0->grouper->Lookup(ExecSpan(std::move(keys), batch.length)));
+  if (ids.null_count() == 0) {
+    return ConsumeAggregates(state0, span, ids);
+  }
+
+  // Split the batch into rows of groups known to the merged state and new groups
+  std::shared_ptr<Array> id_array = ids.make_array();
+  std::vector<int32_t> known_rows;
+  std::vector<int32_t> new_rows;
+  for (int64_t i = 0; i < batch.length; ++i) {
+    (id_array->IsValid(i) ? known_rows : new_rows).push_back(static_cast<int32_t>(i));
+  }
+  auto ctx = plan_->query_context()->exec_context();
+  if (!known_rows.empty()) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch known, TakeRows(batch, known_rows, ctx));
+    ARROW_ASSIGN_OR_RAISE(ExecBatch known_ids,
+                          TakeRows(ExecBatch({ids}, batch.length), known_rows, ctx));
+    RETURN_NOT_OK(ConsumeAggregates(state0, ExecSpan(known), known_ids[0]));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(ExecBatch unknown, TakeRows(batch, new_rows, ctx));
+  RETURN_NOT_OK(InitLocalStateIfNeeded(partition_state));
+  ExecSpan unknown_span(unknown);
+  std::vector<ExecValue> new_keys(key_field_ids_.size());
+  for (size_t i = 0; i < key_field_ids_.size(); ++i) {
+    new_keys[i] = unknown_span[key_field_ids_[i]];
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum new_ids, partition_state->grouper->Consume(ExecSpan(
+                                           std::move(new_keys), unknown.length)));
+  return ConsumeAggregates(partition_state, unknown_span, new_ids);
+}
+
+Status GroupByNode::AggregateSpilledPartitions() {
+  RETURN_NOT_OK(InitLocalStateIfNeeded(&local_states_[0]));
+  for (int partition = 0; partition < kNumSpillPartitions; ++partition) {
+    ThreadLocalState partition_state;
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatchReader> reader,
+                          spill_files_[partition]->OpenReader());
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch, reader->Next());
+      if (!record_batch) break;
+      RETURN_NOT_OK(ConsumeSpilledBatch(&partition_state, ExecBatch(*record_batch)));
+    }
+    spill_files_[partition].reset();
+    if (!partition_state.grouper) {
+      continue;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(out_data_, Finalize(&partition_state));
+    int64_t num_output_batches =
+        bit_util::CeilDiv(out_data_.length, output_batch_size());
+    total_output_batches_ += static_cast<int>(num_output_batches);
+    for (int64_t i = 0; i < num_output_batches; i++) {
+      ARROW_RETURN_NOT_OK(OutputNthBatch(i));
+    }
+  }
+  spill_directory_.reset();
+  return Status::OK();
+}
+
 Status GroupByNode::Merge() {
   arrow::util::tracing::Span span;
   START_COMPUTE_SPAN(span, "Merge",
@@ -297,12 +565,13 @@ Status GroupByNode::Merge() {
   return Status::OK();
 }
 
-Result<ExecBatch> GroupByNode::Finalize() {
+Result<ExecBatch> GroupByNode::Finalize() { return Finalize(&local_states_[0]); }
+
+Result<ExecBatch> GroupByNode::Finalize(ThreadLocalState* state) {
   arrow::util::tracing::Span span;
   START_COMPUTE_SPAN(span, "Finalize",
                      {{"group_by", ToStringExtra(0)}, {"node.label", label()}});
 
-  ThreadLocalState* state = &local_states_[0];
   // If we never got any batches, then state won't have been initialized
   RETURN_NOT_OK(InitLocalStateIfNeeded(state));
 
@@ -338,7 +607,11 @@ Result<ExecBatch> GroupByNode::Finalize() {
 
 Status GroupByNode::OutputNthBatch(int64_t n) {
   int64_t batch_size = output_batch_size();
-  return output_->InputReceived(this, out_data_.Slice(batch_size * n, batch_size));
+  ExecBatch batch = out_data_.Slice(batch_size * n, batch_size);
+  if (!ordering_.is_unordered()) {
+    batch.index = output_index_base_ + static_cast<int>(n);
+  }
+  return output_->InputReceived(this, std::move(batch));
 }
 
 Status GroupByNode::OutputResult(bool is_last) {
@@ -351,9 +624,35 @@ Status GroupByNode::OutputResult(bool is_last) {
   }
 
   RETURN_NOT_OK(Merge());
+  if (spill_directory_) {
+    DCHECK(is_last);
+    RETURN_NOT_OK(AggregateSpilledPartitions());
+  }
   ARROW_ASSIGN_OR_RAISE(out_data_, Finalize());
 
+  // Without keys every segment has a single group, so its results are gathered
+  // until they fill an output batch
+  if (key_field_ids_.empty() && !segment_key_field_ids_.empty()) {
+    if (out_data_.length > 0) {
+      pending_rows_ += out_data_.length;
+      pending_results_.push_back(std::move(out_data_));
+    }
+    if (!is_last && pending_rows_ < output_batch_size()) {
+      return ResetKernelStates();
+    }
+    out_data_ = ExecBatch({}, 0);
+    if (!pending_results_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(
+          out_data_,
+          ConcatenateBatches(pending_results_,
+                             plan_->query_context()->exec_context()->memory_pool()));
+    }
+    pending_results_.clear();
+    pending_rows_ = 0;
+  }
+
   int64_t num_output_batches = bit_util::CeilDiv(out_data_.length, output_batch_size());
+  output_index_base_ = total_output_batches_;
   total_output_batches_ += static_cast<int>(num_output_batches);
   if (is_last) {
     ARROW_RETURN_NOT_OK(output_->InputFinished(this, total_output_batches_));
@@ -3548,6 +3548,37 @@ TEST_P(GroupBy, RandomArraySum) {
   }
 }
 
+TEST_P(GroupBy, RandomArraySumFewAndManyGroups) {
+  // Covers the reductions of non-null values over few groups, spread over several
+  // accumulators, and over many groups, blocked by group id
+  std::shared_ptr<ScalarAggregateOptions> options =
+      std::make_shared<ScalarAggregateOptions>(/*skip_nulls=*/true, /*min_count=*/0);
+  for (const auto& [max_key, length] :
+       {std::pair<std::string, int64_t>{"3", 1 << 12}, {"200", 1 << 12},
+        {"150000", 1 << 18}}) {
+    ARROW_SCOPED_TRACE("max_key = ", max_key, ", length = ", length);
+    auto batch = random::GenerateBatch(
+        {
+            field("agg_0", int64(),
+                  key_value_metadata(
+                      {{"null_probability", "0"}, {"min", "-1000"}, {"max", "1000"}})),
+            field("key", int64(), key_value_metadata({{"min", "0"}, {"max", max_key}})),
+        },
+        length, 0xDEADBEEF);
+
+    ValidateGroupBy(
+        {
+            {"hash_sum", options, "agg_0", "hash_sum"},
+            {"hash_mean", options, "agg_0", "hash_mean"},
+            {"hash_product", options, "agg_0", "hash_product"},
+        },
+        {batch->GetColumnByName("agg_0"), batch->GetColumnByName("agg_0"),
+         batch->GetColumnByName("agg_0")},
+        {batch->GetColumnByName("key")},
+        /*naive=*/false);
+  }
+}
+
 TEST_P(GroupBy, WithChunkedArray) {
   auto table =
       TableFromJSON(schema({field("argument", float64()), field("key", int64())}),
@@ -4715,6 +4746,36 @@ TEST_P(GroupBy, PivotUnexpectedKeyName) {
         RunPivot(key_type, value_type, options, table_json, use_threads));
   }
 }
+TEST_P(GroupBy, PivotDictionaryKeys) {
+  auto key_type = dictionary(int32(), utf8());
+  auto value_type = float32();
+  // Each chunk gets its own dictionary
+  std::vector<std::string> table_json = {R"([
+      [1, "width", 10.5],
+      [2, "width", 11.5]
+      ])",
+                                         R"([
+      [2, "height", 12.5],
+      [3, "width",  13.5],
+      [1, "depth",  15.5],
+      [1, "height", 14.5]
+      ])"};
+  PivotWiderOptions options(/*key_names=*/{"height", "width"});
+  std::string expected_json = R"([
+      [1, {"height": 14.5, "width": 10.5} ],
+      [2, {"height": 12.5, "width": 11.5} ],
+      [3, {"height": null, "width": 13.5} ]
+      ])";
+  TestPivot(key_type, value_type, options, table_json, expected_json);
+  options.unexpected_key_behavior = PivotWiderOptions::kRaise;
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        KeyError, HasSubstr("Unexpected pivot key: depth"),
+        RunPivot(key_type, value_type, options, table_json, use_threads));
+  }
+}
+
 TEST_P(GroupBy, PivotNullKeys) {
   auto key_type = utf8();
   auto value_type = float32();
@@ -5336,6 +5397,47 @@ TEST_P(SegmentedKeyGroupBy, PivotSegmentKeyDuplicateValues) {
       ])"});
 }
 
+TEST(GroupBy, Spilling) {
+  // Keys repeat across batches so that spilled rows both update groups already held
+  // in memory and create new ones.
+  ASSERT_OK_AND_ASSIGN(
+      auto input,
+      MakeIntegerBatches({[](int row) -> int64_t { return row % 997; },
+                          [](int row) -> int64_t { return row % 3; },
+                          [](int row) -> int64_t { return row; }},
+                         schema({field("key0", int32()), field("key1", int32()),
+                                 field("value", int32())}),
+                         /*num_batches=*/8, /*batch_size=*/256));
+
+  for (std::vector<FieldRef> keys :
+       {std::vector<FieldRef>{"key0"}, std::vector<FieldRef>{"key0", "key1"}}) {
+    for (bool use_threads : {false, true}) {
+      ARROW_SCOPED_TRACE("num_keys=", keys.size(), " use_threads=", use_threads);
+      Declaration source{"exec_batch_source",
+                         ExecBatchSourceNodeOptions(input.schema, input.batches)};
+      AggregateNodeOptions agg_opts(
+          {{"hash_count", nullptr, "value", "count"},
+           {"hash_sum", nullptr, "value", "sum"},
+           {"hash_mean", nullptr, "value", "mean"},
+           {"hash_min_max", nullptr, "value", "min_max"},
+           {"hash_count_distinct", nullptr, "key1", "count_distinct"}},
+          keys);
+      Declaration group_by{"aggregate", {std::move(source)}, std::move(agg_opts)};
+
+      QueryOptions query_options;
+      query_options.use_threads = use_threads;
+      ASSERT_OK_AND_ASSIGN(auto expected, DeclarationToTable(group_by, query_options));
+
+      for (int64_t budget : {0, 4096}) {
+        ARROW_SCOPED_TRACE("spilling_memory_budget=", budget);
+        query_options.spilling_memory_budget = budget;
+        ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(group_by, query_options));
+        AssertTablesEqualIgnoringOrder(expected, actual);
+      }
+    }
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(SegmentedScalarGroupBy, SegmentedScalarGroupBy,
                          ::testing::Values(RunSegmentedGroupByImpl));
 
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_set>
@@ -26,7 +27,9 @@
 #include "arrow/acero/hash_join_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/schema_util.h"
+#include "arrow/acero/spill_internal.h"
 #include "arrow/acero/util.h"
+#include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/key_hash_internal.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
@@ -349,7 +352,7 @@ std::shared_ptr<Schema> HashJoinSchema::MakeOutputSchema(
 Result<Expression> HashJoinSchema::BindFilter(Expression filter,
                                               const Schema& left_schema,
                                               const Schema& right_schema,
-                                              ExecContext* exec_context) {
+                                              compute::ExecContext* exec_context) {
   if (filter.IsBound() || filter == literal(true)) {
     return filter;
   }
@@ -490,6 +493,10 @@ class HashJoinNode;
 // pushdown target. Once a join has received all of its Bloom filters, it will evaluate it
 // on every batch that has been queued so far as well as any new probe-side batch that
 // comes in.
+//
+// Alongside the Bloom filter, the min/max of each build-side key is collected.  If the
+// node feeding the pushdown target's probe side is a RuntimeFilterTarget (e.g. a dataset
+// scan) it receives those ranges as a filter and can skip data before it is ever read.
 struct BloomFilterPushdownContext {
   using RegisterTaskGroupCallback = std::function<int(
       std::function<Status(size_t, int64_t)>, std::function<Status(size_t)>)>;
@@ -515,6 +522,9 @@ struct BloomFilterPushdownContext {
   // Sends the Bloom filter to the pushdown target.
   Status PushBloomFilter(size_t thread_index);
 
+  // Sends the key ranges of the build side to the source below the pushdown target.
+  Status PushRuntimeFilter();
+
   // Receives a Bloom filter and its associated column map.
   Status ReceiveBloomFilter(size_t thread_index,
                             std::unique_ptr<BlockedBloomFilter> filter,
@@ -625,6 +635,10 @@ struct BloomFilterPushdownContext {
   // the disable_bloom_filter_ flag.
   std::pair<HashJoinNode*, std::vector<int>> GetPushdownTarget(HashJoinNode* start);
 
+  // Sets up the key range filter for the input of the pushdown target, if that input
+  // accepts runtime filters and the filter would be correct for this join.
+  void InitRuntimeFilter(HashJoinNode* owner);
+
   StartTaskGroupCallback start_task_group_callback_;
   bool disable_bloom_filter_;
   HashJoinSchema* schema_mgr_;
@@ -641,6 +655,10 @@ struct BloomFilterPushdownContext {
     std::unique_ptr<BlockedBloomFilter> bloom_filter_;
     HashJoinNode* pushdown_target_;
     std::vector<int> column_map_;
+    // Null if no key range filter is pushed
+    RuntimeFilterTarget* runtime_filter_target_ = nullptr;
+    // The keys whose range is collected, as (key index, target column index)
+    std::vector<std::pair<int, int>> range_keys_;
   } push_;
 
   struct {
@@ -660,6 +678,9 @@ struct BloomFilterPushdownContext {
 
   struct ThreadLocalData {
     arrow::util::TempVectorStack stack;
+    // For each of push_.range_keys_ the min and max of every batch with a non-null key
+    std::vector<ScalarVector> key_mins;
+    std::vector<ScalarVector> key_maxes;
   };
   std::vector<ThreadLocalData> tld_;
 };
@@ -697,7 +718,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
   HashJoinNode(ExecPlan* plan, NodeVector inputs, const HashJoinNodeOptions& join_options,
                std::shared_ptr<Schema> output_schema,
                std::unique_ptr<HashJoinSchema> schema_mgr, Expression filter,
-               std::unique_ptr<HashJoinImpl> impl)
+               std::unique_ptr<HashJoinImpl> impl, bool can_spill)
       : ExecNode(plan, std::move(inputs), {"left", "right"},
                  /*output_schema=*/std::move(output_schema)),
         TracedNode(this),
@@ -706,6 +727,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
         filter_(std::move(filter)),
         schema_mgr_(std::move(schema_mgr)),
         impl_(std::move(impl)),
+        can_spill_(can_spill),
         disable_bloom_filter_(join_options.disable_bloom_filter) {
     complete_.store(false);
   }
@@ -764,9 +786,13 @@ class HashJoinNode : public ExecNode, public TracedNode {
       ARROW_ASSIGN_OR_RAISE(impl, HashJoinImpl::MakeBasic());
     }
 
+    // Spilling partitions the inputs by hashing the key columns and builds one
+    // SwissJoin hash table per partition.
+    bool can_spill = use_swiss_join;
+
     return plan->EmplaceNode<HashJoinNode>(
         plan, inputs, join_options, std::move(output_schema), std::move(schema_mgr),
-        std::move(filter), std::move(impl));
+        std::move(filter), std::move(impl), can_spill);
   }
 
   const char* kind_name() const override { return "HashJoinNode"; }
@@ -775,12 +801,28 @@ class HashJoinNode : public ExecNode, public TracedNode {
     if (batch.length == 0) {
       return Status::OK();
     }
-    std::lock_guard<std::mutex> guard(build_side_mutex_);
-    build_accumulator_.InsertBatch(std::move(batch));
+    AccumulationQueue to_spill;
+    {
+      std::lock_guard<std::mutex> guard(build_side_mutex_);
+      if (!spilling_) {
+        build_accumulator_.InsertBatch(std::move(batch));
+        if (!spill_ || build_accumulator_.byte_count() <= spilling_memory_budget_) {
+          return Status::OK();
+        }
+        RETURN_NOT_OK(StartSpilling());
+        to_spill = std::move(build_accumulator_);
+      } else {
+        to_spill.InsertBatch(std::move(batch));
+      }
+    }
+    for (size_t i = 0; i < to_spill.batch_count(); ++i) {
+      RETURN_NOT_OK(SpillBatch(/*side=*/1, thread_index, to_spill[i]));
+    }
     return Status::OK();
   }
 
   Status OnBuildSideFinished(size_t thread_index) {
+    EndBuildSideAccumulation();
     return pushdown_context_.BuildBloomFilter(
         thread_index, std::move(build_accumulator_),
         [this](size_t thread_index, AccumulationQueue batches) {
@@ -790,6 +832,14 @@ class HashJoinNode : public ExecNode, public TracedNode {
 
   Status OnBloomFilterFinished(size_t thread_index, AccumulationQueue batches) {
     RETURN_NOT_OK(pushdown_context_.PushBloomFilter(thread_index));
+    if (spilling_) {
+      // The build side has been partitioned to disk.  Probe-side batches are
+      // partitioned the same way and joined once both inputs are exhausted.
+      for (size_t i = 0; i < batches.batch_count(); ++i) {
+        RETURN_NOT_OK(SpillBatch(/*side=*/1, thread_index, batches[i]));
+      }
+      return OnHashTableFinished(thread_index);
+    }
     return impl_->BuildHashTable(
         thread_index, std::move(batches),
         [this](size_t thread_index) { return OnHashTableFinished(thread_index); });
@@ -808,11 +858,19 @@ class HashJoinNode : public ExecNode, public TracedNode {
     return Status::OK();
   }
 
+  // Queue up a probe-side batch until the hash table is ready
+  void QueueProbeSideBatch(ExecBatch batch) {
+    int64_t num_bytes = batch.TotalBufferSize();
+    probe_queued_bytes_ += num_bytes;
+    plan_->query_context()->ReportQueuedBytes(num_bytes);
+    probe_accumulator_.InsertBatch(std::move(batch));
+  }
+
   Status OnProbeSideBatch(size_t thread_index, ExecBatch batch) {
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
       if (!bloom_filters_ready_) {
-        probe_accumulator_.InsertBatch(std::move(batch));
+        QueueProbeSideBatch(std::move(batch));
         return Status::OK();
       }
     }
@@ -821,11 +879,11 @@ class HashJoinNode : public ExecNode, public TracedNode {
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
       if (!hash_table_ready_) {
-        probe_accumulator_.InsertBatch(std::move(batch));
+        QueueProbeSideBatch(std::move(batch));
         return Status::OK();
       }
     }
-    RETURN_NOT_OK(impl_->ProbeSingleBatch(thread_index, std::move(batch)));
+    RETURN_NOT_OK(ProbeSingleBatch(thread_index, std::move(batch)));
     return Status::OK();
   }
 
@@ -836,7 +894,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
       probing_finished = queued_batches_probed_ && !probe_side_finished_;
       probe_side_finished_ = true;
     }
-    if (probing_finished) return impl_->ProbingFinished(thread_index);
+    if (probing_finished) return ProbingFinished(thread_index);
     return Status::OK();
   }
 
@@ -877,18 +935,19 @@ class HashJoinNode : public ExecNode, public TracedNode {
 
   Status OnQueuedBatchesProbed(size_t thread_index) {
     queued_batches_to_probe_.Clear();
+    plan_->query_context()->ReportQueuedBytes(-probe_queued_bytes_.exchange(0));
     bool probing_finished;
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
       probing_finished = !queued_batches_probed_ && probe_side_finished_;
       queued_batches_probed_ = true;
     }
-    if (probing_finished) return impl_->ProbingFinished(thread_index);
+    if (probing_finished) return ProbingFinished(thread_index);
     return Status::OK();
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    auto scope = TraceInputReceived(batch);
+    auto scope = TraceInputReceived(batch, input);
     ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
     if (complete_.load()) {
       return Status::OK();
@@ -942,6 +1001,13 @@ class HashJoinNode : public ExecNode, public TracedNode {
     // we will change it back to just the CPU's thread pool capacity.
     size_t num_threads = (GetCpuThreadPoolCapacity() + io::GetIOThreadPoolCapacity() + 1);
 
+    if (can_spill_ && ctx->options().spilling_memory_budget.has_value()) {
+      // The Bloom filter for the probe side needs every build-side batch, which we
+      // will not have in memory if the build side is spilled.
+      disable_bloom_filter_ = true;
+      RETURN_NOT_OK(InitSpilling(ctx, num_threads));
+    }
+
     RETURN_NOT_OK(pushdown_context_.Init(
         this, num_threads,
         [ctx](std::function<Status(size_t, int64_t)> fn,
@@ -971,8 +1037,8 @@ class HashJoinNode : public ExecNode, public TracedNode {
 
     task_group_probe_ = ctx->RegisterTaskGroup(
         [this](size_t thread_index, int64_t task_id) -> Status {
-          return impl_->ProbeSingleBatch(thread_index,
-                                         std::move(queued_batches_to_probe_[task_id]));
+          return ProbeSingleBatch(thread_index,
+                                  std::move(queued_batches_to_probe_[task_id]));
         },
         [this](size_t thread_index) -> Status {
           return OnQueuedBatchesProbed(thread_index);
@@ -983,6 +1049,9 @@ class HashJoinNode : public ExecNode, public TracedNode {
 
   Status StartProducing() override {
     NoteStartProducing(ToStringExtra());
+    // Nothing is released before the whole build side is received
+    build_side_accumulating_ = true;
+    plan_->query_context()->BeginAccumulation();
     RETURN_NOT_OK(
         pushdown_context_.StartProducing(plan_->query_context()->GetThreadIndex()));
     return Status::OK();
@@ -997,9 +1066,16 @@ class HashJoinNode : public ExecNode, public TracedNode {
   }
 
   Status StopProducingImpl() override {
+    EndBuildSideAccumulation();
     bool expected = false;
     if (complete_.compare_exchange_strong(expected, true)) {
       impl_->Abort([]() {});
+      if (spill_) {
+        std::lock_guard<std::mutex> guard(spill_->mutex);
+        for (auto& impl : spill_->impls) {
+          if (impl) impl->Abort([]() {});
+        }
+      }
     }
     return Status::OK();
   }
@@ -1010,6 +1086,12 @@ class HashJoinNode : public ExecNode, public TracedNode {
   }
 
  private:
+  void EndBuildSideAccumulation() {
+    if (build_side_accumulating_.exchange(false)) {
+      plan_->query_context()->EndAccumulation();
+    }
+  }
+
   Status OutputBatchCallback(ExecBatch batch) {
     return output_->InputReceived(this, std::move(batch));
   }
@@ -1022,6 +1104,151 @@ class HashJoinNode : public ExecNode, public TracedNode {
     return Status::OK();
   }
 
+  Status ProbeSingleBatch(size_t thread_index, ExecBatch batch) {
+    if (spilling_) {
+      return SpillBatch(/*side=*/0, thread_index, batch);
+    }
+    return impl_->ProbeSingleBatch(thread_index, std::move(batch));
+  }
+
+  Status ProbingFinished(size_t thread_index) {
+    if (spilling_) {
+      return JoinSpilledPartition(thread_index, /*partition=*/0);
+    }
+    return impl_->ProbingFinished(thread_index);
+  }
+
+  // Spilling (grace hash join)
+  //
+  // When the build side grows beyond the query's spilling memory budget, both inputs
+  // are hash partitioned on their key columns and written to spill files.  Once the
+  // probe side is exhausted the partitions are joined one at a time, each with its
+  // own hash table, so that only one partition of the build side is in memory at
+  // once.  Rows with equal keys always land in the same partition, which keeps the
+  // per-partition results (including unmatched rows of outer joins) correct.
+  //
+  // Hash tables and task groups have to be created in Init, so one join
+  // implementation per partition is prepared up front.  They are cheap until they
+  // are given batches to build.
+  static constexpr int kNumSpillPartitions = 16;
+
+  Status InitSpilling(QueryContext* ctx, size_t num_threads) {
+    spilling_memory_budget_ = *ctx->options().spilling_memory_budget;
+    spill_ = std::make_unique<SpillState>();
+    for (int side = 0; side <= 1; ++side) {
+      SchemaProjectionMap key_to_in = schema_mgr_->proj_maps[side].map(
+          HashJoinProjection::KEY, HashJoinProjection::INPUT);
+      std::vector<int> key_columns(key_to_in.num_cols);
+      for (int i = 0; i < key_to_in.num_cols; ++i) {
+        key_columns[i] = key_to_in.get(i);
+      }
+      RETURN_NOT_OK(spill_->partitioners[side].Init(ctx, std::move(key_columns),
+                                                    kNumSpillPartitions, num_threads));
+    }
+
+    spill_->impls.resize(kNumSpillPartitions);
+    spill_->task_group_probe.resize(kNumSpillPartitions);
+    for (int partition = 0; partition < kNumSpillPartitions; ++partition) {
+      ARROW_ASSIGN_OR_RAISE(spill_->impls[partition], HashJoinImpl::MakeSwiss());
+      RETURN_NOT_OK(spill_->impls[partition]->Init(
+          ctx, join_type_, num_threads, &(schema_mgr_->proj_maps[0]),
+          &(schema_mgr_->proj_maps[1]), key_cmp_, filter_,
+          [ctx](std::function<Status(size_t, int64_t)> fn,
+                std::function<Status(size_t)> on_finished) {
+            return ctx->RegisterTaskGroup(std::move(fn), std::move(on_finished));
+          },
+          [ctx](int task_group_id, int64_t num_tasks) {
+            return ctx->StartTaskGroup(task_group_id, num_tasks);
+          },
+          [this](int64_t, ExecBatch batch) { return this->OutputBatchCallback(batch); },
+          [this, partition](int64_t num_batches) {
+            return OnSpilledPartitionFinished(partition, num_batches);
+          }));
+
+      spill_->task_group_probe[partition] = ctx->RegisterTaskGroup(
+          [this, partition](size_t thread_index, int64_t task_id) -> Status {
+            return spill_->impls[partition]->ProbeSingleBatch(
+                thread_index, std::move(spill_->batches_to_probe[task_id]));
+          },
+          [this, partition](size_t thread_index) -> Status {
+            spill_->batches_to_probe.Clear();
+            return spill_->impls[partition]->ProbingFinished(thread_index);
+          });
+    }
+    return Status::OK();
+  }
+
+  // Must be called with build_side_mutex_ held
+  Status StartSpilling() {
+    ARROW_ASSIGN_OR_RAISE(spill_->directory,
+                          SpillDirectory::Make(plan_->query_context()));
+    for (int side = 0; side <= 1; ++side) {
+      spill_->files[side].resize(kNumSpillPartitions);
+      for (int partition = 0; partition < kNumSpillPartitions; ++partition) {
+        ARROW_ASSIGN_OR_RAISE(spill_->files[side][partition],
+                              spill_->directory->NewFile(inputs_[side]->output_schema()));
+      }
+    }
+    spilling_ = true;
+    return Status::OK();
+  }
+
+  Status SpillBatch(int side, size_t thread_index, const ExecBatch& batch) {
+    if (batch.length == 0) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(std::vector<ExecBatch> partitions,
+                          spill_->partitioners[side].Split(thread_index, batch));
+    for (int partition = 0; partition < kNumSpillPartitions; ++partition) {
+      RETURN_NOT_OK(spill_->files[side][partition]->Append(partitions[partition]));
+    }
+    return Status::OK();
+  }
+
+  Status JoinSpilledPartition(size_t thread_index, int partition) {
+    if (partition == kNumSpillPartitions) {
+      return FinishedCallback(spill_->num_output_batches);
+    }
+    ARROW_ASSIGN_OR_RAISE(std::vector<ExecBatch> build_batches,
+                          spill_->files[1][partition]->ReadAll());
+    spill_->files[1][partition].reset();
+    AccumulationQueue batches;
+    for (ExecBatch& batch : build_batches) {
+      batches.InsertBatch(std::move(batch));
+    }
+    return spill_->impls[partition]->BuildHashTable(
+        thread_index, std::move(batches), [this, partition](size_t thread_index) {
+          return ProbeSpilledPartition(thread_index, partition);
+        });
+  }
+
+  Status ProbeSpilledPartition(size_t thread_index, int partition) {
+    ARROW_ASSIGN_OR_RAISE(std::vector<ExecBatch> probe_batches,
+                          spill_->files[0][partition]->ReadAll());
+    spill_->files[0][partition].reset();
+    for (ExecBatch& batch : probe_batches) {
+      spill_->batches_to_probe.InsertBatch(std::move(batch));
+    }
+    return plan_->query_context()->StartTaskGroup(
+        spill_->task_group_probe[partition], spill_->batches_to_probe.batch_count());
+  }
+
+  Status OnSpilledPartitionFinished(int partition, int64_t num_batches) {
+    spill_->num_output_batches += num_batches;
+    // This is called from within the partition's join implementation, so release its
+    // hash table (and move on to the next partition) from a separate task.
+    plan_->query_context()->ScheduleTask(
+        [this, partition](size_t thread_index) {
+          {
+            std::lock_guard<std::mutex> guard(spill_->mutex);
+            spill_->impls[partition].reset();
+          }
+          return JoinSpilledPartition(thread_index, partition + 1);
+        },
+        "HashJoinNode::JoinSpilledPartition");
+    return Status::OK();
+  }
+
  private:
   AtomicCounter batch_count_[2];
   std::atomic<bool> complete_;
@@ -1033,6 +1260,9 @@ class HashJoinNode : public ExecNode, public TracedNode {
   util::AccumulationQueue build_accumulator_;
   util::AccumulationQueue probe_accumulator_;
   util::AccumulationQueue queued_batches_to_probe_;
+  // Bytes of the probe-side batches queued up until the hash table is ready
+  std::atomic<int64_t> probe_queued_bytes_{0};
+  std::atomic<bool> build_side_accumulating_{false};
 
   std::mutex build_side_mutex_;
   std::mutex probe_side_mutex_;
@@ -1044,6 +1274,24 @@ class HashJoinNode : public ExecNode, public TracedNode {
   bool queued_batches_probed_ = false;
   bool probe_side_finished_ = false;
 
+  struct SpillState {
+    std::unique_ptr<SpillDirectory> directory;
+    HashPartitioner partitioners[2];
+    // Spill files, indexed by side and then by partition
+    std::vector<std::unique_ptr<SpillFile>> files[2];
+    // Join implementations, one per partition.  Guarded by `mutex` once running.
+    std::vector<std::unique_ptr<HashJoinImpl>> impls;
+    std::vector<int> task_group_probe;
+    AccumulationQueue batches_to_probe;
+    int64_t num_output_batches = 0;
+    std::mutex mutex;
+  };
+
+  bool can_spill_;
+  int64_t spilling_memory_budget_ = 0;
+  std::atomic<bool> spilling_{false};
+  std::unique_ptr<SpillState> spill_;
+
   friend struct BloomFilterPushdownContext;
   bool disable_bloom_filter_;
   BloomFilterPushdownContext pushdown_context_;
@@ -1090,6 +1338,11 @@ Status BloomFilterPushdownContext::Init(
   for (auto& local_data : tld_) {
     RETURN_NOT_OK(local_data.stack.Init(ctx_->memory_pool(), kTempStackUsage));
   }
+  if (!disable_bloom_filter_) InitRuntimeFilter(owner);
+  for (auto& local_data : tld_) {
+    local_data.key_mins.resize(push_.range_keys_.size());
+    local_data.key_maxes.resize(push_.range_keys_.size());
+  }
 
   return Status::OK();
 }
@@ -1119,12 +1372,60 @@ Status BloomFilterPushdownContext::BuildBloomFilter(size_t thread_index,
 }
 
 Status BloomFilterPushdownContext::PushBloomFilter(size_t thread_index) {
-  if (!disable_bloom_filter_)
+  if (!disable_bloom_filter_) {
+    RETURN_NOT_OK(PushRuntimeFilter());
     return push_.pushdown_target_->pushdown_context_.ReceiveBloomFilter(
         thread_index, std::move(push_.bloom_filter_), std::move(push_.column_map_));
+  }
   return Status::OK();
 }
 
+namespace {
+
+// Reduces the per-batch bounds of a key to a single min (or max)
+Result<std::shared_ptr<Scalar>> CombineKeyBounds(const ScalarVector& bounds, bool min,
+                                                  compute::ExecContext* exec_context) {
+  ARROW_ASSIGN_OR_RAISE(std::unique_ptr<ArrayBuilder> builder,
+                        MakeBuilder(bounds[0]->type, exec_context->memory_pool()));
+  RETURN_NOT_OK(builder->AppendScalars(bounds));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> array, builder->Finish());
+  ARROW_ASSIGN_OR_RAISE(
+      Datum min_max,
+      compute::MinMax(array, compute::ScalarAggregateOptions::Defaults(), exec_context));
+  return checked_cast<const StructScalar&>(*min_max.scalar()).value[min ? 0 : 1];
+}
+
+}  // namespace
+
+Status BloomFilterPushdownContext::PushRuntimeFilter() {
+  if (push_.runtime_filter_target_ == nullptr) return Status::OK();
+  std::vector<compute::Expression> ranges;
+  for (size_t i = 0; i < push_.range_keys_.size(); i++) {
+    ScalarVector mins, maxes;
+    for (ThreadLocalData& local_data : tld_) {
+      mins.insert(mins.end(), local_data.key_mins[i].begin(),
+                  local_data.key_mins[i].end());
+      maxes.insert(maxes.end(), local_data.key_maxes[i].begin(),
+                   local_data.key_maxes[i].end());
+      local_data.key_mins[i].clear();
+      local_data.key_maxes[i].clear();
+    }
+    if (mins.empty()) {
+      // The build side has no non-null key, so no probe-side row can match
+      return push_.runtime_filter_target_->AddRuntimeFilter(compute::literal(false));
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Scalar> min,
+                          CombineKeyBounds(mins, /*min=*/true, ctx_->exec_context()));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Scalar> max,
+                          CombineKeyBounds(maxes, /*min=*/false, ctx_->exec_context()));
+    compute::Expression column = compute::field_ref(push_.range_keys_[i].second);
+    ranges.push_back(compute::greater_equal(column, compute::literal(std::move(min))));
+    ranges.push_back(compute::less_equal(column, compute::literal(std::move(max))));
+  }
+  return push_.runtime_filter_target_->AddRuntimeFilter(
+      compute::and_(std::move(ranges)));
+}
+
 Status BloomFilterPushdownContext::BuildBloomFilter_exec_task(size_t thread_index,
                                                               int64_t task_id) {
   const ExecBatch& input_batch = build_.batches_[task_id];
@@ -1142,6 +1443,18 @@ Status BloomFilterPushdownContext::BuildBloomFilter_exec_task(size_t thread_inde
   }
   ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, ExecBatch::Make(std::move(key_columns)));
 
+  for (size_t i = 0; i < push_.range_keys_.size(); i++) {
+    ARROW_ASSIGN_OR_RAISE(Datum min_max,
+                          compute::MinMax(key_batch[push_.range_keys_[i].first],
+                                          compute::ScalarAggregateOptions::Defaults(),
+                                          ctx_->exec_context()));
+    const auto& bounds = checked_cast<const StructScalar&>(*min_max.scalar()).value;
+    if (bounds[0]->is_valid) {
+      tld_[thread_index].key_mins[i].push_back(bounds[0]);
+      tld_[thread_index].key_maxes[i].push_back(bounds[1]);
+    }
+  }
+
   arrow::util::TempVectorStack* stack = &tld_[thread_index].stack;
   arrow::util::TempVectorHolder<uint32_t> hash_holder(
       stack, arrow::util::MiniBatch::kMiniBatchLength);
@@ -1265,6 +1578,26 @@ std::pair<HashJoinNode*, std::vector<int>> BloomFilterPushdownContext::GetPushdo
 #endif  // ARROW_LITTLE_ENDIAN
 }
 
+void BloomFilterPushdownContext::InitRuntimeFilter(HashJoinNode* owner) {
+  // Any key may match a null key with IS, which a range cannot express
+  for (JoinKeyCmp cmp : owner->key_cmp_) {
+    if (cmp != JoinKeyCmp::EQ) return;
+  }
+  ExecNode* source = push_.pushdown_target_->inputs()[0];
+  auto* target = dynamic_cast<RuntimeFilterTarget*>(source);
+  if (target == nullptr) return;
+
+  // Floating point keys are left out since NaN is not ordered
+  for (int i = 0; i < static_cast<int>(push_.column_map_.size()); i++) {
+    int column = push_.column_map_[i];
+    Type::type id = source->output_schema()->field(column)->type()->id();
+    if (is_integer(id) || is_decimal(id) || is_temporal(id) || is_base_binary_like(id)) {
+      push_.range_keys_.emplace_back(i, column);
+    }
+  }
+  if (!push_.range_keys_.empty()) push_.runtime_filter_target_ = target;
+}
+
 namespace internal {
 void RegisterHashJoinNode(ExecFactoryRegistry* registry) {
   DCHECK_OK(registry->AddFactory("hashjoin", HashJoinNode::Make));
@@ -23,6 +23,7 @@
 #include <unordered_set>
 
 #include "arrow/acero/options.h"
+#include "arrow/acero/swiss_join_internal.h"
 #include "arrow/acero/test_util_internal.h"
 #include "arrow/acero/util.h"
 #include "arrow/api.h"
@@ -2099,6 +2100,64 @@ TEST(HashJoin, TrivialResidualFilter) {
   }
 }
 
+TEST(HashJoin, SemiAntiDenseIntegerKeys) {
+  // Semi and anti joins on a dense range of integer keys look them up in a bit set
+  // instead of the hash table.  A sparse build side falls back to the hash table.
+  BatchesWithSchema input_left;
+  input_left.batches = {ExecBatchFromJSON({int64(), utf8()}, R"([
+                            [-3, "a"],
+                            [-2, "b"],
+                            [0, "c"],
+                            [null, "d"]])"),
+                        ExecBatchFromJSON({int64(), utf8()}, R"([
+                            [4, "e"],
+                            [5, "f"],
+                            [1000000000, "g"],
+                            [-9223372036854775808, "h"]])")};
+  input_left.schema = schema({field("l_key", int64()), field("l_str", utf8())});
+
+  auto expected = [](const std::string& rows) {
+    return std::vector<ExecBatch>{ExecBatchFromJSON({int64(), utf8()}, rows)};
+  };
+  // A residual filter referring to the probe side only
+  Expression filter = not_equal(field_ref("l_str"), literal("b"));
+
+  for (bool dense : {true, false}) {
+    ARROW_SCOPED_TRACE(dense ? "dense" : "sparse");
+    BatchesWithSchema input_right;
+    input_right.batches = {
+        ExecBatchFromJSON({int64()}, dense ? "[[-2], [null], [4]]"
+                                           : "[[-2], [null], [4], [1000000000]]"),
+        ExecBatchFromJSON({int64()}, "[[4], [-3], [1]]")};
+    input_right.schema = schema({field("r_key", int64())});
+    const ResidualFilterCaseRunner runner{input_left, std::move(input_right)};
+
+    if (dense) {
+      runner.Run(JoinType::LEFT_SEMI, {"l_key"}, {"r_key"}, literal(true),
+                 expected(R"([[-3, "a"], [-2, "b"], [4, "e"]])"));
+      runner.Run(JoinType::LEFT_ANTI, {"l_key"}, {"r_key"}, literal(true),
+                 expected(R"([[0, "c"], [null, "d"], [5, "f"], [1000000000, "g"],
+                              [-9223372036854775808, "h"]])"));
+      runner.Run(JoinType::LEFT_SEMI, {"l_key"}, {"r_key"}, filter,
+                 expected(R"([[-3, "a"], [4, "e"]])"));
+      runner.Run(JoinType::LEFT_ANTI, {"l_key"}, {"r_key"}, filter,
+                 expected(R"([[-2, "b"], [0, "c"], [null, "d"], [5, "f"],
+                              [1000000000, "g"], [-9223372036854775808, "h"]])"));
+    } else {
+      runner.Run(JoinType::LEFT_SEMI, {"l_key"}, {"r_key"}, literal(true),
+                 expected(R"([[-3, "a"], [-2, "b"], [4, "e"], [1000000000, "g"]])"));
+      runner.Run(JoinType::LEFT_ANTI, {"l_key"}, {"r_key"}, literal(true),
+                 expected(R"([[0, "c"], [null, "d"], [5, "f"],
+                              [-9223372036854775808, "h"]])"));
+      runner.Run(JoinType::LEFT_SEMI, {"l_key"}, {"r_key"}, filter,
+                 expected(R"([[-3, "a"], [4, "e"], [1000000000, "g"]])"));
+      runner.Run(JoinType::LEFT_ANTI, {"l_key"}, {"r_key"}, filter,
+                 expected(R"([[-2, "b"], [0, "c"], [null, "d"], [5, "f"],
+                              [-9223372036854775808, "h"]])"));
+    }
+  }
+}
+
 TEST(HashJoin, FineGrainedResidualFilter) {
   struct JoinSchema {
     std::shared_ptr<Schema> left, right;
@@ -3548,5 +3607,135 @@ TEST(HashJoin, BuildSideLargeRowIds) {
   AssertRowCountEq(std::move(filter), num_match_rows * num_match_rows);
 }
 
+// A join whose build side exceeds the spilling memory budget must produce the same
+// results as the in-memory join.
+TEST(HashJoin, SpillBuildSide) {
+  // The key ranges only partially overlap so that every join type sees both matched
+  // and unmatched rows on both sides.
+  ASSERT_OK_AND_ASSIGN(
+      auto left_batches,
+      MakeIntegerBatches({[](int row) -> int64_t { return row % 151; },
+                          [](int row) -> int64_t { return row; }},
+                         schema({field("l_key", int32()), field("l_payload", int32())}),
+                         /*num_batches=*/8, /*batch_size=*/256));
+  ASSERT_OK_AND_ASSIGN(
+      auto right_batches,
+      MakeIntegerBatches({[](int row) -> int64_t { return 100 + row % 131; },
+                          [](int row) -> int64_t { return -row; }},
+                         schema({field("r_key", int32()), field("r_payload", int32())}),
+                         /*num_batches=*/8, /*batch_size=*/256));
+
+  for (JoinType join_type :
+       {JoinType::INNER, JoinType::LEFT_OUTER, JoinType::RIGHT_OUTER,
+        JoinType::FULL_OUTER, JoinType::LEFT_SEMI, JoinType::LEFT_ANTI,
+        JoinType::RIGHT_SEMI, JoinType::RIGHT_ANTI}) {
+    for (bool use_threads : {false, true}) {
+      ARROW_SCOPED_TRACE("join_type=", ToString(join_type),
+                         " use_threads=", use_threads);
+      Declaration left{"exec_batch_source",
+                       ExecBatchSourceNodeOptions(left_batches.schema,
+                                                  left_batches.batches)};
+      Declaration right{"exec_batch_source",
+                        ExecBatchSourceNodeOptions(right_batches.schema,
+                                                   right_batches.batches)};
+      HashJoinNodeOptions join_opts(join_type, /*left_keys=*/{"l_key"},
+                                    /*right_keys=*/{"r_key"});
+      Declaration join{"hashjoin", {std::move(left), std::move(right)}, join_opts};
+
+      QueryOptions query_options;
+      query_options.use_threads = use_threads;
+      ASSERT_OK_AND_ASSIGN(auto expected, DeclarationToTable(join, query_options));
+
+      // Every build-side batch exceeds this budget
+      query_options.spilling_memory_budget = 1;
+      ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(join, query_options));
+      AssertTablesEqualIgnoringOrder(expected, actual);
+    }
+  }
+}
+
+TEST(HashJoin, ChooseProbeClusterBits) {
+  constexpr int64_t kCacheSize = 1 << 20;
+  ASSERT_EQ(ChooseProbeClusterBits(4 * kCacheSize, kCacheSize), 0);
+  ASSERT_EQ(ChooseProbeClusterBits(4 * kCacheSize + 1, kCacheSize), 2);
+  ASSERT_EQ(ChooseProbeClusterBits(100 * kCacheSize, kCacheSize), 7);
+  ASSERT_EQ(ChooseProbeClusterBits(int64_t{1} << 40, kCacheSize), 10);
+  // An unknown cache size disables clustering
+  ASSERT_EQ(ChooseProbeClusterBits(int64_t{1} << 40, 0), 0);
+}
+
+TEST(HashJoin, LargeBuildSideClusteredProbe) {
+  // A build side many times the size of the cache makes the join reorder probe batches
+  // by key hash before probing.  The cache size is fixed so that this does not depend
+  // on the CPU, and a cache larger than the build side is the unclustered baseline.
+  constexpr int kBuildBatchSize = 1 << 12;
+  constexpr int kNumBuildBatches = 32;
+  constexpr int64_t kNumBuildRows = int64_t{kBuildBatchSize} * kNumBuildBatches;
+  constexpr int kProbeBatchSize = 1 << 12;
+  constexpr int kNumProbeBatches = 16;
+  // Unique probe keys, about half of which are found on the build side
+  auto probe_key = [](int row) -> int64_t {
+    return (row * int64_t{7919}) % (2 * kNumBuildRows);
+  };
+  ASSERT_OK_AND_ASSIGN(
+      auto left_batches,
+      MakeIntegerBatches({probe_key, [](int row) -> int64_t { return row; }},
+                         schema({field("l_key", int64()), field("l_payload", int64())}),
+                         kNumProbeBatches, kProbeBatchSize));
+  ASSERT_OK_AND_ASSIGN(
+      auto right_batches,
+      MakeIntegerBatches({[](int row) -> int64_t { return row; },
+                          [](int row) -> int64_t { return -row; }},
+                         schema({field("r_key", int64()), field("r_payload", int64())}),
+                         kNumBuildBatches, kBuildBatchSize));
+  int64_t num_matches = 0;
+  for (int row = 0; row < kProbeBatchSize * kNumProbeBatches; ++row) {
+    num_matches += probe_key(row) < kNumBuildRows;
+  }
+
+  struct ResetCacheSize {
+    ~ResetCacheSize() { SetProbeClusterCacheSizeForTesting(-1); }
+  } reset_cache_size;
+  for (auto [join_type, cache_size] :
+       std::vector<std::pair<JoinType, int64_t>>{{JoinType::INNER, 1 << 14},
+                                                 {JoinType::INNER, int64_t{1} << 40},
+                                                 {JoinType::LEFT_SEMI, 1 << 14},
+                                                 {JoinType::LEFT_ANTI, 1 << 14},
+                                                 {JoinType::RIGHT_ANTI, 1 << 14}}) {
+    ARROW_SCOPED_TRACE("join_type=", ToString(join_type), " cache_size=", cache_size);
+    SetProbeClusterCacheSizeForTesting(cache_size);
+    Declaration left{"exec_batch_source", ExecBatchSourceNodeOptions(
+                                              left_batches.schema, left_batches.batches)};
+    Declaration right{"exec_batch_source",
+                      ExecBatchSourceNodeOptions(right_batches.schema,
+                                                 right_batches.batches)};
+    Declaration join{"hashjoin",
+                     {std::move(left), std::move(right)},
+                     HashJoinNodeOptions(join_type, {"l_key"}, {"r_key"})};
+    ASSERT_OK_AND_ASSIGN(auto result, DeclarationToTable(std::move(join)));
+
+    switch (join_type) {
+      case JoinType::INNER: {
+        ASSERT_EQ(result->num_rows(), num_matches);
+        ASSERT_OK_AND_ASSIGN(Datum keys_equal,
+                             compute::CallFunction("equal", {result->column(0),
+                                                             result->column(2)}));
+        ASSERT_OK_AND_ASSIGN(Datum all_equal, compute::CallFunction("all", {keys_equal}));
+        ASSERT_TRUE(all_equal.scalar_as<BooleanScalar>().value);
+        break;
+      }
+      case JoinType::LEFT_SEMI:
+        ASSERT_EQ(result->num_rows(), num_matches);
+        break;
+      case JoinType::LEFT_ANTI:
+        ASSERT_EQ(result->num_rows(), kProbeBatchSize * kNumProbeBatches - num_matches);
+        break;
+      default:
+        ASSERT_EQ(result->num_rows(), kNumBuildRows - num_matches);
+        break;
+    }
+  }
+}
+
 }  // namespace acero
 }  // namespace arrow
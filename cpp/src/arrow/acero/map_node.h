@@ -58,6 +58,11 @@ class ARROW_ACERO_EXPORT MapNode : public ExecNode, public TracedNode {
 
   const Ordering& ordering() const override;
 
+  /// Whether ProcessBatch accepts batches with a selection vector
+  ///
+  /// An input may then defer a filter to this node instead of materializing it.
+  virtual bool accepts_selection_vector() const { return false; }
+
  protected:
   Status StopProducingImpl() override;
 
@@ -535,7 +535,8 @@ class ARROW_ACERO_EXPORT OrderBySinkNodeOptions : public SinkNodeOptions {
 /// Currently this node works by accumulating all data, sorting, and then emitting
 /// the new data with an updated batch index.
 ///
-/// Larger-than-memory sort is not currently supported.
+/// If QueryOptions::spilling_memory_budget is set, accumulated data beyond the budget
+/// is sorted and spilled to disk, and the spilled runs are merged at the end.
 class ARROW_ACERO_EXPORT OrderByNodeOptions : public ExecNodeOptions {
  public:
   static constexpr std::string_view kName = "order_by";
@@ -545,6 +546,30 @@ class ARROW_ACERO_EXPORT OrderByNodeOptions : public ExecNodeOptions {
   Ordering ordering;
 };
 
+/// \brief Sort data and keep only a specified range of the sorted rows
+///
+/// This is equivalent to an order_by node followed by a fetch node but only keeps
+/// offset + count candidate rows per thread instead of the whole input.
+/// Rows with equal keys are emitted in input (batch index) order, whereas order_by
+/// emits them in arrival order, so the two may differ on ties when batches arrive out
+/// of order.
+///
+/// Declaration::AddToPlan uses this node when a fetch declaration directly consumes an
+/// order_by declaration.
+class ARROW_ACERO_EXPORT TopKNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "topk";
+  TopKNodeOptions(Ordering ordering, int64_t offset, int64_t count)
+      : ordering(std::move(ordering)), offset(offset), count(count) {}
+
+  /// \brief The ordering to apply to outgoing data
+  Ordering ordering;
+  /// \brief the number of sorted rows to skip
+  int64_t offset;
+  /// \brief the number of sorted rows to keep (not counting skipped rows)
+  int64_t count;
+};
+
 enum class JoinType {
   LEFT_SEMI,
   RIGHT_SEMI,
@@ -730,6 +755,13 @@ class ARROW_ACERO_EXPORT AsofJoinNodeOptions : public ExecNodeOptions {
   ///
   /// The tolerance is interpreted in the same units as the "on" key.
   int64_t tolerance;
+  /// \brief Number of partitions of the "by" key values joined concurrently.
+  ///
+  /// With more than one partition, the rows of each input are hashed by their "by" key
+  /// and the partitions are joined on separate threads.  The output rows of a partition
+  /// are in "on" key order, but the output is not ordered across partitions.  Ignored
+  /// if the "by" key is empty or if Arrow is built without threading.
+  int num_partitions = 1;
 };
 
 /// \brief a node which select top_k/bottom_k rows passed through it
@@ -863,6 +895,133 @@ class ARROW_ACERO_EXPORT PivotLongerNodeOptions : public ExecNodeOptions {
   std::vector<std::string> measurement_field_names;
 };
 
+/// \brief Split the input into partitions, by hashing keys or by ranges of a key
+///
+/// Every output batch holds the rows of a single partition, and its last column,
+/// named `partition_field_name`, is the int32 number of that partition.  Nodes have a
+/// single output, so the partitions share one stream and downstream nodes tell them
+/// apart by that column, e.g. to filter a partition or to group on it.
+///
+/// With hash partitioning, rows with equal keys are always in the same partition.
+/// With range partitioning on a single key, partition i holds the rows whose key is
+/// at least range_boundaries[i - 1] and less than range_boundaries[i].  Rows whose key
+/// is null are in partition 0.
+///
+/// Within an input batch, rows are bucket sorted on their partition without changing
+/// their relative order, so each partition costs a slice rather than a separate take.
+class ARROW_ACERO_EXPORT RepartitionNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "repartition";
+  /// \brief Hash partitioning on `keys` into `num_partitions` partitions
+  RepartitionNodeOptions(std::vector<FieldRef> keys, int num_partitions,
+                         std::string partition_field_name = "partition")
+      : keys(std::move(keys)),
+        num_partitions(num_partitions),
+        partition_field_name(std::move(partition_field_name)) {}
+
+  /// \brief Range partitioning on `key` into range_boundaries->length() + 1
+  /// partitions
+  static RepartitionNodeOptions Range(FieldRef key,
+                                      std::shared_ptr<Array> range_boundaries,
+                                      std::string partition_field_name = "partition") {
+    const int num_partitions = static_cast<int>(range_boundaries->length()) + 1;
+    RepartitionNodeOptions options({std::move(key)}, num_partitions,
+                                   std::move(partition_field_name));
+    options.range_boundaries = std::move(range_boundaries);
+    return options;
+  }
+
+  /// The keys to hash, or the single key of range partitioning
+  std::vector<FieldRef> keys;
+  /// The number of partitions, between 1 and 2^15
+  int num_partitions;
+  /// Sorted, non-null values of the key separating the partitions, null for hash
+  /// partitioning
+  std::shared_ptr<Array> range_boundaries;
+  /// The name of the output column holding the partition number
+  std::string partition_field_name;
+};
+
+/// \brief The set of rows, relative to the current row, that a window function sees
+///
+/// With ROWS frames the bounds count rows.  With RANGE frames the bounds are distances
+/// between values of the (single, integer or temporal) ordering key, and rows with an
+/// equal key, called peers, are always in the same frame.
+///
+/// The frame never extends past the partition of the current row.
+struct ARROW_ACERO_EXPORT WindowFrame {
+  enum Units { ROWS, RANGE };
+
+  /// \brief The default frame, from the start of the partition to the current row
+  /// (and its peers if ordered by RANGE)
+  WindowFrame() = default;
+  WindowFrame(Units units, std::optional<int64_t> preceding,
+              std::optional<int64_t> following)
+      : units(units), preceding(preceding), following(following) {}
+
+  Units units = RANGE;
+  /// How far before the current row the frame starts, or nullopt for UNBOUNDED
+  /// PRECEDING.  Must not be negative.
+  std::optional<int64_t> preceding;
+  /// How far after the current row the frame ends, or nullopt for UNBOUNDED
+  /// FOLLOWING.  Must not be negative, 0 corresponds to CURRENT ROW.
+  std::optional<int64_t> following = 0;
+};
+
+/// \brief A function evaluated over a window of rows by a "window" node
+struct ARROW_ACERO_EXPORT WindowFunction {
+  WindowFunction(std::string function, std::optional<FieldRef> target, std::string name,
+                 WindowFrame frame = {}, int64_t offset = 1)
+      : function(std::move(function)),
+        target(std::move(target)),
+        name(std::move(name)),
+        frame(frame),
+        offset(offset) {}
+
+  /// The function to evaluate, one of:
+  ///
+  /// - "row_number", "rank", "dense_rank": ranking functions, which take no target
+  /// - "lag", "lead": the target value `offset` rows before/after the current row in
+  ///   the same partition, or null
+  /// - "sum", "count", "mean", "min", "max": aggregates of the non-null target values
+  ///   in the frame of the current row
+  std::string function;
+  /// The field the function is computed over, nullopt for ranking functions
+  std::optional<FieldRef> target;
+  /// The name of the output column
+  std::string name;
+  /// The frame over which aggregates are computed, ignored by other functions
+  WindowFrame frame;
+  /// The offset used by "lag" and "lead"
+  int64_t offset;
+};
+
+/// \brief Evaluate window functions over partitions of the input
+///
+/// The input is accumulated in memory, partitioned by `partition_keys` and sorted by
+/// `ordering` within each partition.  The node outputs all input columns, sorted by
+/// the partition keys and then by `ordering`, followed by one column per window
+/// function.  Aggregates are evaluated incrementally as the frame slides over the
+/// partition, instead of being recomputed for every row.
+class ARROW_ACERO_EXPORT WindowNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "window";
+  WindowNodeOptions(std::vector<WindowFunction> functions,
+                    std::vector<FieldRef> partition_keys = {},
+                    Ordering ordering = Ordering::Unordered())
+      : functions(std::move(functions)),
+        partition_keys(std::move(partition_keys)),
+        ordering(std::move(ordering)) {}
+
+  /// The window functions to evaluate
+  std::vector<WindowFunction> functions;
+  /// The keys by which rows are partitioned (PARTITION BY), may be empty
+  std::vector<FieldRef> partition_keys;
+  /// The order of rows within each partition (ORDER BY), may be unordered in which
+  /// case all rows of a partition are peers
+  Ordering ordering;
+};
+
 /// @}
 
 }  // namespace acero
@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -25,7 +27,10 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/spill_internal.h"
 #include "arrow/acero/util.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
 #include "arrow/util/checked_cast.h"
@@ -35,18 +40,196 @@ namespace arrow {
 
 using internal::checked_cast;
 
+using compute::NullPlacement;
+using compute::SortKey;
 using compute::TakeOptions;
+using compute::internal::MultipleKeyComparator;
+using compute::internal::ResolvedRecordBatchSortKey;
+using compute::internal::ResolvedTableSortKey;
 
 namespace acero {
 namespace {
 
+// Merges sorted runs into a single sorted stream of batches.
+//
+// Rows are compared with the same comparators the table sort kernels use.  The
+// comparators resolve one chunk per run (the run's current batch), so they are
+// rebuilt whenever a run moves on to its next batch.
+class SortedRunMerger {
+ public:
+  SortedRunMerger(std::shared_ptr<Schema> schema, const Ordering& ordering,
+                  ExecContext* ctx)
+      : schema_(std::move(schema)),
+        sort_keys_(ordering.sort_keys()),
+        null_placement_(ordering.null_placement()),
+        ctx_(ctx) {}
+
+  Status Init(std::vector<std::shared_ptr<RecordBatchReader>> runs) {
+    runs_ = std::move(runs);
+    current_.resize(runs_.size());
+    positions_.assign(runs_.size(), 0);
+    pending_index_.assign(runs_.size(), -1);
+    for (size_t run = 0; run < runs_.size(); ++run) {
+      RETURN_NOT_OK(LoadNextBatch(static_cast<int>(run)));
+    }
+    RETURN_NOT_OK(ResolveCurrentBatches());
+    for (size_t run = 0; run < runs_.size(); ++run) {
+      if (current_[run]) heap_.push_back(static_cast<int>(run));
+    }
+    std::make_heap(heap_.begin(), heap_.end(), heap_order());
+    return Status::OK();
+  }
+
+  // Return the next batch of at most `max_rows` rows, or null once all runs are
+  // exhausted.
+  Result<std::shared_ptr<RecordBatch>> Next(int64_t max_rows) {
+    selection_.clear();
+    while (!heap_.empty() && static_cast<int64_t>(selection_.size()) < max_rows) {
+      std::pop_heap(heap_.begin(), heap_.end(), heap_order());
+      int run = heap_.back();
+      selection_.push_back(pending_offsets_[pending_index_[run]] + positions_[run]);
+      if (++positions_[run] < current_[run]->num_rows()) {
+        std::push_heap(heap_.begin(), heap_.end(), heap_order());
+        continue;
+      }
+      // The run's current batch is exhausted.  It stays pending until the
+      // selected rows have been materialized.
+      heap_.pop_back();
+      RETURN_NOT_OK(LoadNextBatch(run));
+      RETURN_NOT_OK(ResolveCurrentBatches());
+      if (current_[run]) {
+        heap_.push_back(run);
+        std::push_heap(heap_.begin(), heap_.end(), heap_order());
+      }
+    }
+    if (selection_.empty()) {
+      return nullptr;
+    }
+    return Materialize();
+  }
+
+ private:
+  struct HeapOrder {
+    SortedRunMerger* merger;
+    // std heaps are max-heaps, so order by "comes after"
+    bool operator()(int left, int right) const { return merger->Before(right, left); }
+  };
+  HeapOrder heap_order() { return {this}; }
+
+  bool Before(int left, int right) {
+    ChunkLocation left_loc{left, positions_[left]};
+    ChunkLocation right_loc{right, positions_[right]};
+    if (comparator_->Compare(left_loc, right_loc, 0)) return true;
+    if (comparator_->Compare(right_loc, left_loc, 0)) return false;
+    // Keep the merge deterministic for equal keys
+    return left < right;
+  }
+
+  Status LoadNextBatch(int run) {
+    std::shared_ptr<RecordBatch> batch;
+    do {
+      ARROW_ASSIGN_OR_RAISE(batch, runs_[run]->Next());
+    } while (batch && batch->num_rows() == 0);
+    current_[run] = batch;
+    positions_[run] = 0;
+    if (batch) {
+      pending_index_[run] = static_cast<int>(pending_batches_.size());
+      pending_offsets_.push_back(pending_rows_);
+      pending_rows_ += batch->num_rows();
+      pending_batches_.push_back(std::move(batch));
+    }
+    return Status::OK();
+  }
+
+  Status ResolveCurrentBatches() {
+    RecordBatchVector batches(current_.size());
+    for (size_t run = 0; run < current_.size(); ++run) {
+      if (current_[run]) {
+        batches[run] = current_[run];
+      } else {
+        ARROW_ASSIGN_OR_RAISE(batches[run], RecordBatch::MakeEmpty(schema_));
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema_, batches));
+    ARROW_ASSIGN_OR_RAISE(resolved_keys_,
+                          ResolvedTableSortKey::Make(*table, batches, sort_keys_));
+    comparator_ = std::make_unique<MultipleKeyComparator<ResolvedTableSortKey>>(
+        resolved_keys_, null_placement_);
+    return comparator_->status();
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Materialize() {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(schema_, pending_batches_));
+    Int64Builder builder(ctx_->memory_pool());
+    RETURN_NOT_OK(builder.AppendValues(selection_));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> indices, builder.Finish());
+    ARROW_ASSIGN_OR_RAISE(Datum taken,
+                          Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> out,
+                          taken.table()->CombineChunksToBatch(ctx_->memory_pool()));
+
+    // Only the current batch of each run may still be referenced
+    pending_batches_.clear();
+    pending_offsets_.clear();
+    pending_rows_ = 0;
+    for (size_t run = 0; run < current_.size(); ++run) {
+      if (!current_[run]) continue;
+      pending_index_[run] = static_cast<int>(pending_batches_.size());
+      pending_offsets_.push_back(pending_rows_);
+      pending_rows_ += current_[run]->num_rows();
+      pending_batches_.push_back(current_[run]);
+    }
+    return out;
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::vector<SortKey> sort_keys_;
+  NullPlacement null_placement_;
+  ExecContext* ctx_;
+
+  std::vector<std::shared_ptr<RecordBatchReader>> runs_;
+  // The batch each run is currently positioned in, null if the run is exhausted
+  std::vector<std::shared_ptr<RecordBatch>> current_;
+  std::vector<int64_t> positions_;
+  std::vector<int> heap_;
+
+  std::vector<ResolvedTableSortKey> resolved_keys_;
+  std::unique_ptr<MultipleKeyComparator<ResolvedTableSortKey>> comparator_;
+
+  // Batches that rows of the next output batch may be selected from
+  std::vector<std::shared_ptr<RecordBatch>> pending_batches_;
+  std::vector<int64_t> pending_offsets_;
+  int64_t pending_rows_ = 0;
+  std::vector<int> pending_index_;
+  std::vector<int64_t> selection_;
+};
+
+// Whether the comparators used to merge sorted runs support the sort keys
+bool CanMergeSortedRuns(const std::shared_ptr<Schema>& schema,
+                        const Ordering& ordering) {
+  auto maybe_empty = RecordBatch::MakeEmpty(schema);
+  if (!maybe_empty.ok()) return false;
+  auto maybe_keys = compute::internal::ResolveSortKeys<ResolvedRecordBatchSortKey>(
+      **maybe_empty, ordering.sort_keys());
+  if (!maybe_keys.ok()) return false;
+  MultipleKeyComparator<ResolvedRecordBatchSortKey> comparator(
+      *maybe_keys, ordering.null_placement());
+  return comparator.status().ok();
+}
+
 class OrderByNode : public ExecNode, public TracedNode {
  public:
   OrderByNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
               std::shared_ptr<Schema> output_schema, Ordering new_ordering)
       : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
         TracedNode(this),
-        ordering_(std::move(new_ordering)) {}
+        ordering_(std::move(new_ordering)) {
+    const auto& budget = plan_->query_context()->options().spilling_memory_budget;
+    if (budget.has_value() && CanMergeSortedRuns(output_schema_, ordering_)) {
+      spilling_memory_budget_ = *budget;
+    }
+  }
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -80,6 +263,9 @@ class OrderByNode : public ExecNode, public TracedNode {
 
   Status StartProducing() override {
     NoteStartProducing(ToStringExtra());
+    // The whole input is needed before any of it is released
+    accumulating_ = true;
+    plan_->query_context()->BeginAccumulation();
     return Status::OK();
   }
 
@@ -91,7 +277,10 @@ class OrderByNode : public ExecNode, public TracedNode {
     inputs_[0]->ResumeProducing(this, counter);
   }
 
-  Status StopProducingImpl() override { return Status::OK(); }
+  Status StopProducingImpl() override {
+    EndAccumulation();
+    return Status::OK();
+  }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
     auto scope = TraceInputReceived(batch);
@@ -100,9 +289,21 @@ class OrderByNode : public ExecNode, public TracedNode {
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
                           batch.ToRecordBatch(output_schema_));
 
+    std::vector<std::shared_ptr<RecordBatch>> to_spill;
     {
       std::lock_guard lk(mutex_);
       accumulation_queue_.push_back(std::move(record_batch));
+      accumulated_bytes_ += batch.TotalBufferSize();
+      plan_->query_context()->ReportQueuedBytes(batch.TotalBufferSize());
+      if (spilling_memory_budget_ >= 0 && accumulated_bytes_ > spilling_memory_budget_) {
+        to_spill = std::move(accumulation_queue_);
+        accumulation_queue_.clear();
+        plan_->query_context()->ReportQueuedBytes(-accumulated_bytes_);
+        accumulated_bytes_ = 0;
+      }
+    }
+    if (!to_spill.empty()) {
+      RETURN_NOT_OK(SpillSortedRun(std::move(to_spill)));
     }
 
     if (counter_.Increment()) {
@@ -111,16 +312,95 @@ class OrderByNode : public ExecNode, public TracedNode {
     return Status::OK();
   }
 
-  Status DoFinish() {
-    ARROW_ASSIGN_OR_RAISE(
-        auto table,
-        Table::FromRecordBatches(output_schema_, std::move(accumulation_queue_)));
+  Result<std::shared_ptr<Table>> Sort(std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(output_schema_, std::move(batches)));
     SortOptions sort_options(ordering_.sort_keys(), ordering_.null_placement());
     ExecContext* ctx = plan_->query_context()->exec_context();
     ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, sort_options, ctx));
     ARROW_ASSIGN_OR_RAISE(Datum sorted,
                           Take(table, indices, TakeOptions::NoBoundsCheck(), ctx));
-    const std::shared_ptr<Table>& sorted_table = sorted.table();
+    return sorted.table();
+  }
+
+  // Sort the given batches and write them to disk as one sorted run
+  Status SpillSortedRun(std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> sorted_table, Sort(std::move(batches)));
+    std::unique_ptr<SpillFile> run;
+    {
+      std::lock_guard lk(mutex_);
+      if (!spill_directory_) {
+        ARROW_ASSIGN_OR_RAISE(spill_directory_,
+                              SpillDirectory::Make(plan_->query_context()));
+      }
+      ARROW_ASSIGN_OR_RAISE(run, spill_directory_->NewFile(output_schema_));
+    }
+    TableBatchReader reader(*sorted_table);
+    reader.set_chunksize(ExecPlan::kMaxBatchSize);
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, reader.Next());
+      if (!next) break;
+      RETURN_NOT_OK(run->Append(ExecBatch(*next)));
+    }
+    std::lock_guard lk(mutex_);
+    spilled_runs_.push_back(std::move(run));
+    return Status::OK();
+  }
+
+  // Merge the spilled runs and whatever is still in memory, emitting the result
+  // one batch at a time
+  Status MergeSortedRuns() {
+    std::vector<std::shared_ptr<RecordBatchReader>> runs;
+    for (auto& spilled_run : spilled_runs_) {
+      ARROW_ASSIGN_OR_RAISE(auto reader, spilled_run->OpenReader());
+      runs.push_back(std::move(reader));
+    }
+    if (!accumulation_queue_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> sorted_table,
+                            Sort(std::move(accumulation_queue_)));
+      auto reader = std::make_shared<TableBatchReader>(std::move(sorted_table));
+      reader->set_chunksize(ExecPlan::kMaxBatchSize);
+      runs.push_back(std::move(reader));
+    }
+
+    SortedRunMerger merger(output_schema_, ordering_,
+                           plan_->query_context()->exec_context());
+    RETURN_NOT_OK(merger.Init(std::move(runs)));
+    int batch_index = 0;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next,
+                            merger.Next(ExecPlan::kMaxBatchSize));
+      if (!next) break;
+      ExecBatch exec_batch(*next);
+      exec_batch.index = batch_index++;
+      RETURN_NOT_OK(output_->InputReceived(this, std::move(exec_batch)));
+    }
+    spilled_runs_.clear();
+    return output_->InputFinished(this, batch_index);
+  }
+
+  // Note the end of the accumulation of the input, once
+  void EndAccumulation() {
+    if (accumulating_.exchange(false)) {
+      plan_->query_context()->EndAccumulation();
+    }
+  }
+
+  Status DoFinish() {
+    EndAccumulation();
+    {
+      std::lock_guard lk(mutex_);
+      plan_->query_context()->ReportQueuedBytes(-accumulated_bytes_);
+      accumulated_bytes_ = 0;
+    }
+    if (!spilled_runs_.empty()) {
+      // Merging reads the runs back from disk, do it off the calling thread
+      plan_->query_context()->ScheduleTask([this]() { return MergeSortedRuns(); },
+                                           "OrderByNode::MergeSortedRuns");
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> sorted_table,
+                          Sort(std::move(accumulation_queue_)));
     TableBatchReader reader(*sorted_table);
     reader.set_chunksize(ExecPlan::kMaxBatchSize);
     int batch_index = 0;
@@ -151,6 +431,12 @@ class OrderByNode : public ExecNode, public TracedNode {
   AtomicCounter counter_;
   Ordering ordering_;
   std::vector<std::shared_ptr<RecordBatch>> accumulation_queue_;
+  int64_t accumulated_bytes_ = 0;
+  std::atomic<bool> accumulating_{false};
+  // Negative if the node never spills
+  int64_t spilling_memory_budget_ = -1;
+  std::unique_ptr<SpillDirectory> spill_directory_;
+  std::vector<std::unique_ptr<SpillFile>> spilled_runs_;
   std::mutex mutex_;
 };
 
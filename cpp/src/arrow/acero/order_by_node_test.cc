@@ -19,6 +19,8 @@
 
 #include <gmock/gmock-matchers.h>
 
+#include <optional>
+
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/test_nodes.h"
@@ -32,6 +34,7 @@ namespace arrow {
 
 using internal::checked_pointer_cast;
 
+using compute::NullPlacement;
 using compute::SortKey;
 using compute::SortOrder;
 
@@ -47,7 +50,8 @@ std::shared_ptr<Table> TestTable() {
       ->Table(kRowsPerBatch, kNumBatches);
 }
 
-void CheckOrderBy(OrderByNodeOptions options) {
+void CheckOrderBy(OrderByNodeOptions options,
+                  std::optional<int64_t> spilling_memory_budget = std::nullopt) {
   constexpr random::SeedType kSeed = 42;
   constexpr int kJitterMod = 4;
   RegisterTestNodes();
@@ -60,6 +64,7 @@ void CheckOrderBy(OrderByNodeOptions options) {
     QueryOptions query_options;
     query_options.sequence_output = true;
     query_options.use_threads = use_threads;
+    query_options.spilling_memory_budget = spilling_memory_budget;
     ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
                          DeclarationToTable(plan, query_options));
 
@@ -82,6 +87,41 @@ TEST(OrderByNode, Basic) {
       OrderByNodeOptions({{SortKey("up"), SortKey("down", SortOrder::Descending)}}));
 }
 
+TEST(OrderByNode, Spilling) {
+  // Small enough that the input is spilled as many sorted runs of a few batches
+  constexpr int64_t kBudget = 64;
+  CheckOrderBy(OrderByNodeOptions({{SortKey("up")}}), kBudget);
+  CheckOrderBy(OrderByNodeOptions({{SortKey("down", SortOrder::Descending)}}), kBudget);
+  CheckOrderBy(
+      OrderByNodeOptions({{SortKey("up"), SortKey("down", SortOrder::Descending)}}),
+      kBudget);
+  // Every batch is a sorted run of its own
+  CheckOrderBy(OrderByNodeOptions({{SortKey("down", SortOrder::Descending)}}),
+               /*spilling_memory_budget=*/0);
+}
+
+TEST(OrderByNode, SpillingWithNulls) {
+  std::shared_ptr<Table> input = TableFromJSON(
+      schema({field("key", int32()), field("value", utf8())}),
+      {R"([[3, "a"], [null, "b"], [1, "c"]])", R"([[2, "d"], [null, "e"]])",
+       R"([[5, "f"], [0, "g"], [4, "h"]])"});
+  for (auto null_placement : {NullPlacement::AtStart, NullPlacement::AtEnd}) {
+    Declaration plan = Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(input, /*max_batch_size=*/3)},
+         {"order_by",
+          OrderByNodeOptions(Ordering({SortKey("key")}, null_placement))}});
+    QueryOptions query_options;
+    query_options.sequence_output = true;
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> expected,
+                         DeclarationToTable(plan, query_options));
+    query_options.spilling_memory_budget = 0;
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                         DeclarationToTable(plan, query_options));
+    AssertChunkedEqual(*expected->GetColumnByName("key"),
+                       *actual->GetColumnByName("key"));
+  }
+}
+
 TEST(OrderByNode, Large) {
   constexpr random::SeedType kSeed = 42;
   constexpr int kJitterMod = 4;
@@ -16,11 +16,91 @@
 // under the License.
 
 #include "arrow/acero/partition_util.h"
+
+#include <algorithm>
 #include <mutex>
 
+#include "arrow/acero/exec_plan.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/compute/api_vector.h"
+
 namespace arrow {
 namespace acero {
 
+Result<std::vector<ExecBatch>> SplitByPartition(const ExecBatch& batch,
+                                                const uint16_t* partition_ids,
+                                                int num_partitions,
+                                                compute::ExecContext* ctx) {
+  std::vector<ExecBatch> out(num_partitions);
+  // The start of every partition in the sorted rows
+  std::vector<int64_t> starts(num_partitions + 1, 0);
+  ARROW_ASSIGN_OR_RAISE(
+      std::shared_ptr<Buffer> indices,
+      AllocateBuffer(batch.length * sizeof(int32_t), ctx->memory_pool()));
+  if (batch.length > 0) {
+    // PartitionSort handles up to kMaxBatchSize rows, so longer batches are sorted in
+    // chunks whose partitions are then laid out one after the other
+    const int64_t chunk_size = ExecPlan::kMaxBatchSize;
+    const int64_t num_chunks = bit_util::CeilDiv(batch.length, chunk_size);
+    std::vector<uint16_t> chunk_ranges(num_chunks * (num_partitions + 1));
+    std::vector<uint16_t> chunk_rows(batch.length);
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+      const int64_t offset = chunk * chunk_size;
+      const int64_t length = std::min(chunk_size, batch.length - offset);
+      uint16_t* ranges = chunk_ranges.data() + chunk * (num_partitions + 1);
+      uint16_t* rows = chunk_rows.data() + offset;
+      PartitionSort::Eval(
+          length, num_partitions, ranges,
+          [&](int64_t row) { return partition_ids[offset + row]; },
+          [&](int64_t row, int pos) { rows[pos] = static_cast<uint16_t>(row); });
+      for (int prtn = 0; prtn < num_partitions; ++prtn) {
+        starts[prtn + 1] += ranges[prtn + 1] - ranges[prtn];
+      }
+    }
+    for (int prtn = 0; prtn < num_partitions; ++prtn) {
+      starts[prtn + 1] += starts[prtn];
+    }
+    auto* out_indices = indices->mutable_data_as<int32_t>();
+    std::vector<int64_t> positions(starts.begin(), starts.end() - 1);
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+      const int64_t offset = chunk * chunk_size;
+      const uint16_t* ranges = chunk_ranges.data() + chunk * (num_partitions + 1);
+      const uint16_t* rows = chunk_rows.data() + offset;
+      for (int prtn = 0; prtn < num_partitions; ++prtn) {
+        for (int pos = ranges[prtn]; pos < ranges[prtn + 1]; ++pos) {
+          out_indices[positions[prtn]++] = static_cast<int32_t>(offset + rows[pos]);
+        }
+      }
+    }
+  }
+
+  std::vector<Datum> sorted(batch.values.size());
+  int64_t largest = 0;
+  for (int prtn = 0; prtn < num_partitions; ++prtn) {
+    largest = std::max(largest, starts[prtn + 1] - starts[prtn]);
+  }
+  if (largest == batch.length) {
+    // A single partition has all the rows, in their original order
+    sorted = batch.values;
+  } else {
+    Int32Array index_array(batch.length, std::move(indices));
+    for (size_t col = 0; col < sorted.size(); ++col) {
+      if (batch[col].is_scalar()) {
+        sorted[col] = batch[col];
+      } else {
+        ARROW_ASSIGN_OR_RAISE(sorted[col],
+                              compute::Take(batch[col], index_array,
+                                            compute::TakeOptions::NoBoundsCheck(), ctx));
+      }
+    }
+  }
+  ExecBatch sorted_batch(std::move(sorted), batch.length);
+  for (int prtn = 0; prtn < num_partitions; ++prtn) {
+    out[prtn] = sorted_batch.Slice(starts[prtn], starts[prtn + 1] - starts[prtn]);
+  }
+  return out;
+}
+
 PartitionLocks::PartitionLocks() : num_prtns_(0), locks_(nullptr), rngs_(nullptr) {}
 
 PartitionLocks::~PartitionLocks() { CleanUp(); }
@@ -22,6 +22,8 @@
 #include <cstdint>
 #include <functional>
 #include <random>
+#include <vector>
+
 #include "arrow/acero/util.h"
 #include "arrow/buffer.h"
 #include "arrow/util/pcg_random.h"
@@ -88,6 +90,19 @@ class PartitionSort {
   }
 };
 
+/// \brief Split a batch into one batch per partition, given the partition of every row
+///
+/// Rows are bucket sorted on their partition with PartitionSort, keeping their
+/// relative order, and every array column is gathered with a single take.  The batch
+/// of each partition is a slice of the gathered columns, empty if no row falls in it.
+///
+/// partition_ids must hold batch.length values less than num_partitions.
+ARROW_ACERO_EXPORT
+Result<std::vector<ExecBatch>> SplitByPartition(const ExecBatch& batch,
+                                                const uint16_t* partition_ids,
+                                                int num_partitions,
+                                                compute::ExecContext* ctx);
+
 /// \brief A control for synchronizing threads on a partitionable workload
 class PartitionLocks {
  public:
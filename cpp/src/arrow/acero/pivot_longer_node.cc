@@ -25,6 +25,7 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/util.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
@@ -40,7 +41,8 @@ namespace {
 
 // A row template that's been bound to a schema
 struct BoundRowTemplate {
-  std::vector<std::string> feature_values;
+  // The feature values as string scalars, created once rather than for every batch
+  std::vector<Datum> feature_values;
   std::vector<std::optional<FieldPath>> measurement_paths;
 
   static Result<BoundRowTemplate> Make(const PivotLongerRowTemplate& unbound,
@@ -59,11 +61,15 @@ struct BoundRowTemplate {
         measurement_paths.push_back(std::nullopt);
       }
     }
-    return BoundRowTemplate(unbound.feature_values, std::move(measurement_paths));
+    std::vector<Datum> feature_values;
+    for (const auto& feature_val : unbound.feature_values) {
+      feature_values.push_back(Datum(feature_val));
+    }
+    return BoundRowTemplate(std::move(feature_values), std::move(measurement_paths));
   }
 
  private:
-  BoundRowTemplate(std::vector<std::string> feature_values,
+  BoundRowTemplate(std::vector<Datum> feature_values,
                    std::vector<std::optional<FieldPath>> measurement_paths)
       : feature_values(std::move(feature_values)),
         measurement_paths(std::move(measurement_paths)) {}
@@ -157,7 +163,8 @@ class PivotLongerNode : public ExecNode, public TracedNode {
     std::size_t num_measurements = options_.measurement_field_names.size();
     std::size_t meas_offset = num_out_fields - num_measurements;
     for (std::size_t i = 0; i < num_measurements; i++) {
-      meas_types_.push_back(output_schema_->fields()[meas_offset + i]->type());
+      null_measurements_.push_back(
+          MakeNullScalar(output_schema_->fields()[meas_offset + i]->type()));
     }
   }
 
@@ -208,18 +215,19 @@ class PivotLongerNode : public ExecNode, public TracedNode {
   Status StopProducingImpl() override { return Status::OK(); }
 
   ExecBatch ApplyTemplate(const BoundRowTemplate& templ, const ExecBatch& input) const {
-    std::vector<Datum> values(input.values);
-    for (const auto& feature_val : templ.feature_values) {
-      // Feature names are added as string scalars
-      values.push_back(Datum(feature_val));
-    }
+    std::vector<Datum> values;
+    values.reserve(input.values.size() + templ.feature_values.size() +
+                   templ.measurement_paths.size());
+    values.insert(values.end(), input.values.begin(), input.values.end());
+    // Feature names are added as string scalars
+    values.insert(values.end(), templ.feature_values.begin(), templ.feature_values.end());
     for (std::size_t meas_idx = 0; meas_idx < templ.measurement_paths.size();
          meas_idx++) {
       const std::optional<FieldPath>& opt_meas_path = templ.measurement_paths[meas_idx];
       if (opt_meas_path) {
         values.push_back(input.values[opt_meas_path->indices()[0]]);
       } else {
-        values.push_back(MakeNullScalar(meas_types_[meas_idx]));
+        values.push_back(null_measurements_[meas_idx]);
       }
     }
     return ExecBatch(std::move(values), input.length);
@@ -265,7 +273,8 @@ class PivotLongerNode : public ExecNode, public TracedNode {
  private:
   PivotLongerNodeOptions options_;
   std::vector<BoundRowTemplate> templates_;
-  std::vector<std::shared_ptr<DataType>> meas_types_;
+  // A null scalar of the type of each measurement column
+  std::vector<Datum> null_measurements_;
 };
 
 }  // namespace
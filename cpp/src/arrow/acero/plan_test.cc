@@ -17,11 +17,14 @@
 
 #include <gmock/gmock-matchers.h>
 
+#include <atomic>
 #include <functional>
 #include <memory>
 
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/expression_compiler.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
 #include "arrow/acero/test_nodes.h"
 #include "arrow/acero/test_util_internal.h"
 #include "arrow/acero/util.h"
@@ -466,6 +469,60 @@ TEST(ExecPlanExecution, SinkNodeBackpressure) {
   CheckFinishesCancelledOrOk(plan->finished());
 }
 
+TEST(QueryContext, QueuedBytesBudget) {
+  QueryOptions options;
+  options.queued_bytes_budget = 100;
+  QueryContext ctx(options);
+
+  ctx.ReportQueuedBytes(100);
+  ASSERT_FINISHES_OK(ctx.WaitForQueuedBytes());
+
+  // Over budget, sources wait until enough bytes are released
+  ctx.ReportQueuedBytes(50);
+  ASSERT_EQ(ctx.queued_bytes(), 150);
+  Future<> waiting = ctx.WaitForQueuedBytes();
+  ASSERT_FALSE(waiting.is_finished());
+  ctx.ReportQueuedBytes(-20);
+  ASSERT_FALSE(waiting.is_finished());
+  ctx.ReportQueuedBytes(-30);
+  ASSERT_FINISHES_OK(waiting);
+
+  // Sources never wait while a node accumulates its input
+  ctx.ReportQueuedBytes(50);
+  waiting = ctx.WaitForQueuedBytes();
+  ASSERT_FALSE(waiting.is_finished());
+  ctx.BeginAccumulation();
+  ASSERT_FINISHES_OK(waiting);
+  ASSERT_FINISHES_OK(ctx.WaitForQueuedBytes());
+  ctx.EndAccumulation();
+
+  // Stopped sources are released
+  waiting = ctx.WaitForQueuedBytes();
+  ASSERT_FALSE(waiting.is_finished());
+  ctx.ResumeSources();
+  ASSERT_FINISHES_OK(waiting);
+  ASSERT_FALSE(ctx.WaitForQueuedBytes().is_finished());
+  ctx.ResumeSources();
+
+  // Without a budget sources never wait
+  QueryContext unbounded;
+  unbounded.ReportQueuedBytes(1 << 30);
+  ASSERT_FINISHES_OK(unbounded.WaitForQueuedBytes());
+}
+
+TEST(ExecPlanExecution, QueuedBytesBudgetWithAccumulation) {
+  // A budget smaller than any batch must not block nodes that need their whole input
+  auto basic_data = MakeBasicBatches();
+  Declaration plan = Declaration::Sequence(
+      {{"source", SourceNodeOptions{basic_data.schema, basic_data.gen(/*parallel=*/true,
+                                                                      /*slow=*/false)}},
+       {"order_by", OrderByNodeOptions(Ordering({SortKey("i32")}))}});
+  QueryOptions options;
+  options.queued_bytes_budget = 1;
+  ASSERT_OK_AND_ASSIGN(auto table, DeclarationToTable(std::move(plan), options));
+  ASSERT_EQ(table->num_rows(), 5);
+}
+
 TEST(ExecPlan, ToString) {
   auto basic_data = MakeBasicBatches();
   AsyncGenerator<std::optional<ExecBatch>> sink_gen;
@@ -1044,6 +1101,163 @@ TEST(ExecPlanExecution, SourceProjectSink) {
   AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
 }
 
+TEST(ExecPlanExecution, SourceFilterProjectSink) {
+  // The filter defers its selection to the project node
+  auto basic_data = MakeBasicBatches();
+  for (bool parallel : {false, true}) {
+    Declaration plan = Declaration::Sequence(
+        {{"source",
+          SourceNodeOptions{basic_data.schema, basic_data.gen(parallel, /*slow=*/false)}},
+         {"filter", FilterNodeOptions{greater(field_ref("i32"), literal(4))}},
+         {"project", ProjectNodeOptions{{call("add", {field_ref("i32"), literal(1)}),
+                                         field_ref("bool")},
+                                        {"i32 + 1", "bool"}}}});
+    auto exp_batches = {ExecBatchFromJSON({int32(), boolean()}, "[]"),
+                        ExecBatchFromJSON({int32(), boolean()},
+                                          "[[6, null], [7, false], [8, false]]")};
+    ASSERT_OK_AND_ASSIGN(auto result,
+                         DeclarationToExecBatches(std::move(plan), parallel));
+    AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
+  }
+}
+
+TEST(ExecPlanExecution, NodeStatistics) {
+  auto basic_data = MakeBasicBatches();
+  QueryOptions query_options;
+  query_options.collect_node_statistics = true;
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<ExecPlan> plan, ExecPlan::Make(query_options));
+  AsyncGenerator<std::optional<ExecBatch>> sink_gen;
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * source,
+      Declaration("source", SourceNodeOptions{basic_data.schema,
+                                              basic_data.gen(/*parallel=*/false,
+                                                             /*slow=*/false)})
+          .AddToPlan(plan.get()));
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * filter,
+      Declaration("filter", {source},
+                  FilterNodeOptions{equal(field_ref("i32"), literal(6))})
+          .AddToPlan(plan.get()));
+  ASSERT_OK(Declaration("sink", {filter}, SinkNodeOptions{&sink_gen})
+                .AddToPlan(plan.get()));
+  ASSERT_FINISHES_OK(StartAndCollect(plan.get(), sink_gen));
+
+  NodeStatistics source_stats = source->statistics();
+  ASSERT_EQ(0, source_stats.input_rows);
+  ASSERT_EQ(2, source_stats.output_batches);
+  ASSERT_EQ(5, source_stats.output_rows);
+  NodeStatistics filter_stats = filter->statistics();
+  ASSERT_EQ(2, filter_stats.input_batches);
+  ASSERT_EQ(5, filter_stats.input_rows);
+  ASSERT_EQ(source_stats.output_bytes, filter_stats.input_bytes);
+  ASSERT_EQ(1, filter_stats.output_rows);
+  ASSERT_GT(filter_stats.processing_time_nanos, 0);
+  ASSERT_THAT(plan->ToString(), HasSubstr("output_rows=1 "));
+}
+
+TEST(ExecPlanExecution, NodeStatisticsNotCollectedByDefault) {
+  auto basic_data = MakeBasicBatches();
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<ExecPlan> plan, ExecPlan::Make());
+  AsyncGenerator<std::optional<ExecBatch>> sink_gen;
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * source,
+      Declaration("source", SourceNodeOptions{basic_data.schema,
+                                              basic_data.gen(/*parallel=*/false,
+                                                             /*slow=*/false)})
+          .AddToPlan(plan.get()));
+  ASSERT_OK(Declaration("sink", {source}, SinkNodeOptions{&sink_gen})
+                .AddToPlan(plan.get()));
+  ASSERT_FINISHES_OK(StartAndCollect(plan.get(), sink_gen));
+  ASSERT_EQ(nullptr, source->statistics_collector());
+  ASSERT_EQ(0, source->statistics().output_rows);
+  ASSERT_THAT(plan->ToString(), testing::Not(HasSubstr("output_rows")));
+}
+
+namespace {
+
+// Compiles calls to "add", which it still evaluates with ExecuteScalarExpression
+class AddCompiler : public ExpressionCompiler {
+ public:
+  class Compiled : public CompiledExpression {
+   public:
+    Compiled(Expression expr, std::atomic<int>* num_executions)
+        : expr_(std::move(expr)), num_executions_(num_executions) {}
+
+    Result<Datum> Execute(const ExecBatch& batch,
+                          compute::ExecContext* exec_context) const override {
+      EXPECT_EQ(batch.selection_vector, nullptr);
+      EXPECT_GT(batch.length, 0);
+      ++*num_executions_;
+      return ExecuteScalarExpression(expr_, batch, exec_context);
+    }
+
+   private:
+    Expression expr_;
+    std::atomic<int>* num_executions_;
+  };
+
+  Result<std::shared_ptr<CompiledExpression>> Compile(
+      const Expression& expr, const std::shared_ptr<Schema>& schema) override {
+    EXPECT_TRUE(expr.IsBound());
+    auto expr_call = expr.call();
+    if (expr_call == nullptr || expr_call->function_name != "add") {
+      return nullptr;
+    }
+    ++num_compiled;
+    return std::make_shared<Compiled>(expr, &num_executions);
+  }
+
+  int num_compiled = 0;
+  std::atomic<int> num_executions{0};
+};
+
+}  // namespace
+
+TEST(ExecPlanExecution, ExpressionCompiler) {
+  auto basic_data = MakeBasicBatches();
+  Declaration plan = Declaration::Sequence(
+      {{"source",
+        SourceNodeOptions{basic_data.schema, basic_data.gen(/*parallel=*/false,
+                                                            /*slow=*/false)}},
+       {"filter", FilterNodeOptions{greater(call("add", {field_ref("i32"), literal(1)}),
+                                            literal(5))}},
+       {"project", ProjectNodeOptions{{call("add", {field_ref("i32"), literal(10)}),
+                                       field_ref("bool")},
+                                      {"i32 + 10", "bool"}}}});
+  auto compiler = std::make_shared<AddCompiler>();
+  QueryOptions query_options;
+  query_options.use_threads = false;
+  query_options.expression_compiler = compiler;
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                       DeclarationToTable(std::move(plan), query_options));
+
+  auto expected = TableFromJSON(
+      schema({field("i32 + 10", int32()), field("bool", boolean())}),
+      {R"([[15, null], [16, false], [17, false]])"});
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  ASSERT_EQ(compiler->num_compiled, 2);
+  ASSERT_GT(compiler->num_executions, 0);
+}
+
+TEST(ExecPlanExecution, DeclarationToExplainAnalyze) {
+  auto basic_data = MakeBasicBatches();
+  for (bool use_threads : {false, true}) {
+    Declaration plan = Declaration::Sequence(
+        {{"source",
+          SourceNodeOptions{basic_data.schema, basic_data.gen(/*parallel=*/use_threads,
+                                                              /*slow=*/false)}},
+         {"project", ProjectNodeOptions{{field_ref("i32")}}}});
+    QueryOptions query_options;
+    query_options.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(std::string explained,
+                         DeclarationToExplainAnalyze(std::move(plan), query_options));
+    ASSERT_THAT(explained, HasSubstr("ProjectNode{projection=[i32]} [input_batches=2 "
+                                     "input_rows=5 "));
+    ASSERT_THAT(explained, HasSubstr("processing_time_ms="));
+    ASSERT_THAT(explained, HasSubstr("paused_time_ms="));
+  }
+}
+
 TEST(ExecPlanExecution, ProjectMaintainsOrder) {
   RegisterTestNodes();
   constexpr int kRandomSeed = 42;
@@ -1160,6 +1374,30 @@ TEST(ExecPlanExecution, SourceGroupedSum) {
   }
 }
 
+#ifdef ARROW_ENABLE_THREADING
+TEST(ExecPlanExecution, SourceGroupedSumWorkStealingExecutor) {
+  ASSERT_OK_AND_ASSIGN(auto executor, ::arrow::internal::WorkStealingThreadPool::Make(4));
+  auto input = MakeGroupableBatches(/*multiplicity=*/100);
+
+  Declaration plan = Declaration::Sequence(
+      {{"source", SourceNodeOptions{input.schema, input.gen(/*parallel=*/true,
+                                                            /*slow=*/false)}},
+       {"aggregate",
+        AggregateNodeOptions{/*aggregates=*/{{"hash_sum", nullptr, "i32", "sum(i32)"}},
+                             /*keys=*/{"str"}}}});
+  QueryOptions query_options;
+  query_options.custom_cpu_executor = executor.get();
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                       DeclarationToTable(std::move(plan), std::move(query_options)));
+
+  auto expected =
+      TableFromJSON(schema({field("str", utf8()), field("sum(i32)", int64())}),
+                    {R"([["alfa", 800], ["beta", 1000], ["gama", 400]])"});
+  AssertTablesEqualIgnoringOrder(expected, actual);
+  ASSERT_OK(executor->Shutdown());
+}
+#endif
+
 TEST(ExecPlanExecution, SourceMinMaxScalar) {
   // Regression test for ARROW-16904
   for (bool parallel : {false, true}) {
@@ -1622,6 +1860,40 @@ TEST(ExecPlan, SourceEnforcesBatchLimit) {
   }
 }
 
+TEST(ExecPlan, SourceMorselSize) {
+  auto generator = gen::Gen({{"x", gen::Step()}})->FailOnError();
+  std::vector<ExecBatch> input = generator->ExecBatches(/*rows_per_batch=*/10,
+                                                        /*num_batches=*/50);
+  for (auto& batch : generator->ExecBatches(/*rows_per_batch=*/1000, /*num_batches=*/1)) {
+    input.push_back(std::move(batch));
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, TableFromExecBatches(generator->Schema(), input));
+
+  for (bool adaptive : {false, true}) {
+    SCOPED_TRACE(adaptive ? "adaptive" : "fixed");
+    Declaration plan(
+        "exec_batch_source", ExecBatchSourceNodeOptions(generator->Schema(), input));
+    QueryOptions query_options;
+    query_options.morsel_size = 100;
+    query_options.adaptive_morsel_size = adaptive;
+    ASSERT_OK_AND_ASSIGN(auto result,
+                         DeclarationToExecBatches(std::move(plan), query_options));
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         TableFromExecBatches(result.schema, result.batches));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+    for (const auto& batch : result.batches) {
+      ASSERT_LE(batch.length, 100);
+    }
+    if (!adaptive) {
+      // The small batches are concatenated five at a time and the large one is sliced
+      ASSERT_EQ(result.batches.size(), 20);
+      for (const auto& batch : result.batches) {
+        ASSERT_GE(batch.length, 50);
+      }
+    }
+  }
+}
+
 TEST(ExecPlanExecution, SegmentedAggregationWithMultiThreading) {
 #ifndef ARROW_ENABLE_THREADING
   GTEST_SKIP() << "Test requires threading enabled";
@@ -0,0 +1,228 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/prepared_plan.h"
+
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/options.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/expression_internal.h"
+#include "arrow/compute/util.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace acero {
+
+using compute::ExecContext;
+
+namespace {
+
+// Return the options of a filter or project declaration with `transform` applied
+// to their expressions, or null for the options of other declarations
+template <typename Transform>
+Result<std::shared_ptr<ExecNodeOptions>> TransformExpressions(
+    const ExecNodeOptions* options, const Transform& transform) {
+  if (auto filter = dynamic_cast<const FilterNodeOptions*>(options)) {
+    ARROW_ASSIGN_OR_RAISE(auto expr, transform(filter->filter_expression));
+    return std::make_shared<FilterNodeOptions>(std::move(expr));
+  }
+  if (auto project = dynamic_cast<const ProjectNodeOptions*>(options)) {
+    std::vector<Expression> exprs;
+    exprs.reserve(project->expressions.size());
+    for (const auto& expr : project->expressions) {
+      ARROW_ASSIGN_OR_RAISE(auto transformed, transform(expr));
+      exprs.push_back(std::move(transformed));
+    }
+    // Keep the names the project node would derive from the original expressions
+    auto names = project->names;
+    if (names.empty()) {
+      for (const auto& expr : project->expressions) {
+        names.push_back(expr.ToString());
+      }
+    }
+    return std::make_shared<ProjectNodeOptions>(std::move(exprs), std::move(names));
+  }
+  return nullptr;
+}
+
+// Replace the references to parameters in unbound expressions by null literals
+// of the parameters' types, so that the declaration can be added to a plan
+Result<Declaration> WithPlaceholders(const Declaration& declaration,
+                                     const Schema& parameters) {
+  Declaration probe = declaration;
+  for (auto& input : probe.inputs) {
+    if (auto* input_decl = std::get_if<Declaration>(&input)) {
+      ARROW_ASSIGN_OR_RAISE(*input_decl, WithPlaceholders(*input_decl, parameters));
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      auto options,
+      TransformExpressions(
+          declaration.options.get(), [&](const Expression& expr) -> Result<Expression> {
+            if (expr.IsBound()) {
+              return expr;
+            }
+            return compute::ModifyExpression(
+                expr,
+                [&](Expression sub_expr) -> Result<Expression> {
+                  const FieldRef* ref = sub_expr.field_ref();
+                  if (ref != nullptr && ref->name() != nullptr) {
+                    if (auto param = parameters.GetFieldByName(*ref->name())) {
+                      return compute::literal(MakeNullScalar(param->type()));
+                    }
+                  }
+                  return sub_expr;
+                },
+                [](Expression sub_expr, ...) { return sub_expr; });
+          }));
+  if (options) {
+    probe.options = std::move(options);
+  }
+  return probe;
+}
+
+// Bind the expressions of a declaration whose placeholder version was added to a
+// plan as `node`, against their input schema extended with the parameters
+Result<Declaration> BindExpressions(const Declaration& declaration, const ExecNode* node,
+                                    const Schema& parameters,
+                                    ExecContext* exec_context) {
+  if (node->inputs().size() != declaration.inputs.size()) {
+    return Status::NotImplemented("Preparing a '", declaration.factory_name,
+                                  "' declaration which doesn't map to a single node");
+  }
+  Declaration bound = declaration;
+  for (size_t i = 0; i < declaration.inputs.size(); ++i) {
+    if (auto* input_decl = std::get_if<Declaration>(&declaration.inputs[i])) {
+      ARROW_ASSIGN_OR_RAISE(
+          bound.inputs[i],
+          BindExpressions(*input_decl, node->inputs()[i], parameters, exec_context));
+    }
+  }
+  if (node->inputs().size() != 1) {
+    return bound;
+  }
+  FieldVector fields = node->inputs()[0]->output_schema()->fields();
+  fields.insert(fields.end(), parameters.fields().begin(), parameters.fields().end());
+  const Schema schema(std::move(fields));
+  ARROW_ASSIGN_OR_RAISE(
+      auto options,
+      TransformExpressions(declaration.options.get(),
+                           [&](const Expression& expr) -> Result<Expression> {
+                             if (expr.IsBound()) {
+                               return expr;
+                             }
+                             return expr.Bind(schema, exec_context);
+                           }));
+  if (options) {
+    bound.options = std::move(options);
+  }
+  return bound;
+}
+
+Result<Declaration> InstantiateDeclaration(
+    const Declaration& declaration, const compute::KnownFieldValues& known_values,
+    const std::unordered_map<std::string, Declaration>& inputs,
+    std::unordered_set<std::string>* replaced_labels) {
+  if (!declaration.label.empty()) {
+    auto it = inputs.find(declaration.label);
+    if (it != inputs.end()) {
+      replaced_labels->insert(declaration.label);
+      return it->second;
+    }
+  }
+  Declaration instance = declaration;
+  for (auto& input : instance.inputs) {
+    if (auto* input_decl = std::get_if<Declaration>(&input)) {
+      ARROW_ASSIGN_OR_RAISE(*input_decl, InstantiateDeclaration(
+                                             *input_decl, known_values, inputs,
+                                             replaced_labels));
+    }
+  }
+  if (!known_values.map.empty()) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto options,
+        TransformExpressions(declaration.options.get(), [&](const Expression& expr) {
+          return compute::ReplaceFieldsWithKnownValues(known_values, expr);
+        }));
+    if (options) {
+      instance.options = std::move(options);
+    }
+  }
+  return instance;
+}
+
+}  // namespace
+
+Result<PreparedDeclaration> PreparedDeclaration::Make(
+    Declaration declaration, std::shared_ptr<Schema> parameters,
+    FunctionRegistry* function_registry) {
+  if (parameters == nullptr) {
+    parameters = schema({});
+  }
+  // Add a version of the declaration without parameters to a plan, which is never
+  // started, to learn the input schemas of the nodes
+  ARROW_ASSIGN_OR_RAISE(Declaration probe, WithPlaceholders(declaration, *parameters));
+  ExecContext exec_context(default_memory_pool(), ::arrow::internal::GetCpuThreadPool(),
+                           function_registry);
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ExecPlan> plan, ExecPlan::Make(exec_context));
+  ARROW_ASSIGN_OR_RAISE(ExecNode * node, probe.AddToPlan(plan.get()));
+  ARROW_ASSIGN_OR_RAISE(Declaration bound, BindExpressions(declaration, node, *parameters,
+                                                           &exec_context));
+  return PreparedDeclaration(std::move(bound), std::move(parameters));
+}
+
+Result<Declaration> PreparedDeclaration::Instantiate(
+    const ParameterValues& values,
+    const std::unordered_map<std::string, Declaration>& inputs) const {
+  for (const auto& [name, value] : values) {
+    if (parameters_->GetFieldByName(name) == nullptr) {
+      return Status::Invalid("Unknown parameter '", name, "'");
+    }
+    if (!value.is_scalar()) {
+      return Status::TypeError("The value of parameter '", name,
+                               "' must be a scalar, got ", value.ToString());
+    }
+  }
+  compute::KnownFieldValues known_values;
+  for (const auto& param : parameters_->fields()) {
+    auto it = values.find(param->name());
+    if (it == values.end()) {
+      return Status::Invalid("No value given for parameter '", param->name(), "'");
+    }
+    known_values.map.emplace(FieldRef(param->name()), it->second);
+  }
+
+  std::unordered_set<std::string> replaced_labels;
+  ARROW_ASSIGN_OR_RAISE(
+      Declaration instance,
+      InstantiateDeclaration(declaration_, known_values, inputs, &replaced_labels));
+  for (const auto& input : inputs) {
+    if (replaced_labels.count(input.first) == 0) {
+      return Status::Invalid("No declaration labeled '", input.first, "' to replace");
+    }
+  }
+  return instance;
+}
+
+}  // namespace acero
+}  // namespace arrow
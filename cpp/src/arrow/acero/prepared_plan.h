@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// NOTE: API is EXPERIMENTAL and will change without going through a
+// deprecation cycle
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace acero {
+
+/// \addtogroup acero-api
+/// @{
+
+/// \brief The values of the parameters of a prepared declaration, by name
+using ParameterValues = std::unordered_map<std::string, Datum>;
+
+/// \brief A declaration whose expressions are bound once, to be run many times
+///
+/// Running a declaration binds the expressions of its filter and project nodes,
+/// which dispatches and initializes their kernels.  For small inputs this can
+/// cost more than executing the plan.  A PreparedDeclaration binds them once;
+/// instantiating it only substitutes parameter values and inputs, and the
+/// nodes of the resulting declaration reuse the bound expressions.
+///
+/// Parameters are referenced in filter and project expressions by field
+/// references to their names, as if they were input columns.  Their names must
+/// not be those of input columns.
+class ARROW_ACERO_EXPORT PreparedDeclaration {
+ public:
+  /// \brief Prepare a declaration
+  ///
+  /// \param[in] declaration the declaration to prepare
+  /// \param[in] parameters the names and types of the parameters
+  /// \param[in] function_registry the registry to look functions up in, or null
+  /// for the default registry
+  static Result<PreparedDeclaration> Make(
+      Declaration declaration, std::shared_ptr<Schema> parameters = NULLPTR,
+      FunctionRegistry* function_registry = NULLPTR);
+
+  /// \brief Return a declaration to run with the given parameters and inputs
+  ///
+  /// \param[in] values a scalar for each parameter, cast to the parameter's type
+  /// if needed
+  /// \param[in] inputs declarations replacing the declarations of the given
+  /// labels, which must produce the same schema
+  Result<Declaration> Instantiate(
+      const ParameterValues& values = {},
+      const std::unordered_map<std::string, Declaration>& inputs = {}) const;
+
+  /// \brief The prepared declaration, with parameters left to substitute
+  const Declaration& declaration() const { return declaration_; }
+
+  const std::shared_ptr<Schema>& parameters() const { return parameters_; }
+
+ private:
+  PreparedDeclaration(Declaration declaration, std::shared_ptr<Schema> parameters)
+      : declaration_(std::move(declaration)), parameters_(std::move(parameters)) {}
+
+  Declaration declaration_;
+  std::shared_ptr<Schema> parameters_;
+};
+
+/// @}
+
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,159 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/prepared_plan.h"
+#include "arrow/compute/expression.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+
+using compute::call;
+using compute::field_ref;
+
+namespace acero {
+
+namespace {
+
+std::shared_ptr<Schema> InputSchema() {
+  return schema({field("a", int32()), field("b", utf8())});
+}
+
+std::shared_ptr<Table> InputTable() {
+  return TableFromJSON(InputSchema(),
+                       {R"([[1, "x"], [2, "y"], [3, "z"], [null, "w"]])"});
+}
+
+// SELECT a + offset AS c, b WHERE a > threshold
+Declaration ParameterizedQuery(std::shared_ptr<Table> input) {
+  return Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(std::move(input)), "input"},
+       {"filter",
+        FilterNodeOptions(call("greater", {field_ref("a"), field_ref("threshold")}))},
+       {"project", ProjectNodeOptions({call("add", {field_ref("a"), field_ref("offset")}),
+                                       field_ref("b")},
+                                      {"c", "b"})}});
+}
+
+std::shared_ptr<Schema> Parameters() {
+  return schema({field("threshold", int32()), field("offset", int64())});
+}
+
+ParameterValues MakeValues(int32_t threshold, int64_t offset) {
+  return {{"threshold", Datum(threshold)}, {"offset", Datum(offset)}};
+}
+
+void AssertRunsTo(const Declaration& declaration, const std::string& expected_json) {
+  ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(declaration,
+                                                       /*use_threads=*/false));
+  auto expected =
+      TableFromJSON(schema({field("c", int64()), field("b", utf8())}), {expected_json});
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+}  // namespace
+
+TEST(PreparedDeclaration, Parameters) {
+  ASSERT_OK_AND_ASSIGN(auto prepared,
+                       PreparedDeclaration::Make(ParameterizedQuery(InputTable()),
+                                                 Parameters()));
+
+  ASSERT_OK_AND_ASSIGN(auto instance, prepared.Instantiate(MakeValues(1, 10)));
+  AssertRunsTo(instance, R"([[12, "y"], [13, "z"]])");
+  // An instance can be run several times
+  AssertRunsTo(instance, R"([[12, "y"], [13, "z"]])");
+
+  ASSERT_OK_AND_ASSIGN(instance, prepared.Instantiate(MakeValues(2, -3)));
+  AssertRunsTo(instance, R"([[0, "z"]])");
+
+  // Values are cast to the type of their parameter
+  ASSERT_OK_AND_ASSIGN(instance, prepared.Instantiate({{"threshold", Datum(int64_t(0))},
+                                                       {"offset", Datum(int32_t(1))}}));
+  AssertRunsTo(instance, R"([[2, "x"], [3, "y"], [4, "z"]])");
+}
+
+TEST(PreparedDeclaration, ReplaceInputs) {
+  ASSERT_OK_AND_ASSIGN(auto prepared,
+                       PreparedDeclaration::Make(ParameterizedQuery(InputTable()),
+                                                 Parameters()));
+
+  auto other_input = TableFromJSON(InputSchema(), {R"([[5, "v"], [0, "u"]])"});
+  Declaration other_source{"table_source", TableSourceNodeOptions(other_input)};
+  ASSERT_OK_AND_ASSIGN(auto instance,
+                       prepared.Instantiate(MakeValues(1, 0), {{"input", other_source}}));
+  AssertRunsTo(instance, R"([[5, "v"]])");
+
+  // The replacing input must have the prepared schema
+  auto bad_input =
+      TableFromJSON(schema({field("a", int64()), field("b", utf8())}), {R"([[5, "v"]])"});
+  Declaration bad_source{"table_source", TableSourceNodeOptions(bad_input)};
+  ASSERT_OK_AND_ASSIGN(instance,
+                       prepared.Instantiate(MakeValues(1, 0), {{"input", bad_source}}));
+  ASSERT_RAISES(TypeError, DeclarationToTable(instance));
+
+  ASSERT_RAISES(Invalid,
+                prepared.Instantiate(MakeValues(1, 0), {{"no_such_label", bad_source}}));
+}
+
+TEST(PreparedDeclaration, WithoutParameters) {
+  auto declaration = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(InputTable())},
+       {"project", ProjectNodeOptions({call("add", {field_ref("a"), literal(int64_t(1))}),
+                                       field_ref("b")},
+                                      {"c", "b"})}});
+  ASSERT_OK_AND_ASSIGN(auto prepared, PreparedDeclaration::Make(declaration));
+  ASSERT_EQ(prepared.parameters()->num_fields(), 0);
+
+  // The prepared declaration can be run directly
+  AssertRunsTo(prepared.declaration(), R"([[2, "x"], [3, "y"], [4, "z"], [null, "w"]])");
+  ASSERT_OK_AND_ASSIGN(auto instance, prepared.Instantiate());
+  AssertRunsTo(instance, R"([[2, "x"], [3, "y"], [4, "z"], [null, "w"]])");
+}
+
+TEST(PreparedDeclaration, Errors) {
+  // Parameters must not shadow columns
+  ASSERT_NOT_OK(PreparedDeclaration::Make(ParameterizedQuery(InputTable()),
+                                          schema({field("a", int32()),
+                                                  field("threshold", int32()),
+                                                  field("offset", int64())})));
+  // Unknown fields
+  ASSERT_NOT_OK(PreparedDeclaration::Make(ParameterizedQuery(InputTable())));
+
+  ASSERT_OK_AND_ASSIGN(auto prepared,
+                       PreparedDeclaration::Make(ParameterizedQuery(InputTable()),
+                                                 Parameters()));
+  ASSERT_RAISES(Invalid, prepared.Instantiate({{"threshold", Datum(1)}}));
+  ASSERT_RAISES(Invalid, prepared.Instantiate({{"threshold", Datum(1)},
+                                               {"offset", Datum(int64_t(1))},
+                                               {"limit", Datum(1)}}));
+  ParameterValues array_values = {{"threshold", Datum(1)},
+                                  {"offset", ArrayFromJSON(int64(), "[1]")}};
+  ASSERT_RAISES(TypeError, prepared.Instantiate(array_values));
+
+  // The prepared declaration still references its parameters
+  ASSERT_RAISES(TypeError, DeclarationToTable(prepared.declaration()));
+}
+
+}  // namespace acero
+}  // namespace arrow
@@ -15,9 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <sstream>
 
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/expression_compiler.h"
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
@@ -42,9 +44,26 @@ namespace {
 class ProjectNode : public MapNode {
  public:
   ProjectNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
-              std::shared_ptr<Schema> output_schema, std::vector<Expression> exprs)
+              std::shared_ptr<Schema> output_schema, std::vector<Expression> exprs,
+              std::vector<std::shared_ptr<CompiledExpression>> compiled_exprs)
       : MapNode(plan, std::move(inputs), std::move(output_schema)),
-        exprs_(std::move(exprs)) {}
+        exprs_(std::move(exprs)),
+        compiled_exprs_(std::move(compiled_exprs)) {
+    std::vector<int> column_references(inputs_[0]->output_schema()->num_fields(), 0);
+    for (const Expression& expr : exprs_) {
+      for (const FieldRef& ref : FieldsInExpression(expr)) {
+        auto path = ref.FindOne(*inputs_[0]->output_schema());
+        if (path.ok()) ++column_references[path->indices()[0]];
+      }
+    }
+    shares_columns_ = std::any_of(column_references.begin(), column_references.end(),
+                                  [](int count) { return count > 1; });
+    has_compiled_exprs_ =
+        std::any_of(compiled_exprs_.begin(), compiled_exprs_.end(),
+                    [](const std::shared_ptr<CompiledExpression>& compiled) {
+                      return compiled != nullptr;
+                    });
+  }
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -62,22 +81,41 @@ class ProjectNode : public MapNode {
     }
 
     FieldVector fields(exprs.size());
+    std::vector<std::shared_ptr<CompiledExpression>> compiled_exprs(exprs.size());
+    const auto& compiler = plan->query_context()->options().expression_compiler;
     int i = 0;
     for (auto& expr : exprs) {
       if (!expr.IsBound()) {
         ARROW_ASSIGN_OR_RAISE(expr, expr.Bind(*inputs[0]->output_schema(),
                                               plan->query_context()->exec_context()));
+      } else {
+        RETURN_NOT_OK(ValidateBoundExpression(expr, *inputs[0]->output_schema()));
       }
       fields[i] = field(std::move(names[i]), expr.type()->GetSharedPtr());
+      if (compiler) {
+        ARROW_ASSIGN_OR_RAISE(compiled_exprs[i],
+                              compiler->Compile(expr, inputs[0]->output_schema()));
+      }
       ++i;
     }
     return plan->EmplaceNode<ProjectNode>(plan, std::move(inputs),
-                                          schema(std::move(fields)), std::move(exprs));
+                                          schema(std::move(fields)), std::move(exprs),
+                                          std::move(compiled_exprs));
   }
 
   const char* kind_name() const override { return "ProjectNode"; }
 
+  bool accepts_selection_vector() const override { return true; }
+
   Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
+    // Each expression computes the selected rows of the columns it reads, unless
+    // columns are read several times, or by compiled expressions: they are then
+    // gathered once upfront
+    if (batch.selection_vector && (shares_columns_ || has_compiled_exprs_)) {
+      ARROW_ASSIGN_OR_RAISE(batch,
+                            compute::ApplySelectionVector(
+                                exprs_, batch, plan()->query_context()->exec_context()));
+    }
     std::vector<Datum> values{exprs_.size()};
     for (size_t i = 0; i < exprs_.size(); ++i) {
       arrow::util::tracing::Span span;
@@ -85,6 +123,12 @@ class ProjectNode : public MapNode {
                          {{"project.type", exprs_[i].type()->ToString()},
                           {"project.length", batch.length},
                           {"project.expression", exprs_[i].ToString()}});
+      if (compiled_exprs_[i] && batch.length > 0) {
+        ARROW_ASSIGN_OR_RAISE(
+            values[i], compiled_exprs_[i]->Execute(
+                           batch, plan()->query_context()->exec_context()));
+        continue;
+      }
       ARROW_ASSIGN_OR_RAISE(Expression simplified_expr,
                             SimplifyWithGuarantee(exprs_[i], batch.guarantee));
 
@@ -113,6 +157,12 @@ class ProjectNode : public MapNode {
 
  private:
   std::vector<Expression> exprs_;
+  // The translation of each expression by QueryOptions::expression_compiler, or
+  // null if it is interpreted
+  std::vector<std::shared_ptr<CompiledExpression>> compiled_exprs_;
+  bool has_compiled_exprs_;
+  // Whether a column of the input is referenced more than once in exprs_
+  bool shares_columns_;
 };
 
 }  // namespace
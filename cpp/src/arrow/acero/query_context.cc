@@ -87,5 +87,63 @@ int QueryContext::RegisterTaskGroup(std::function<Status(size_t, int64_t)> task,
 Status QueryContext::StartTaskGroup(int task_group_id, int64_t num_tasks) {
   return task_scheduler_->StartTaskGroup(GetThreadIndex(), task_group_id, num_tasks);
 }
+
+void QueryContext::ReportQueuedBytes(int64_t delta) {
+  queued_bytes_.fetch_add(delta);
+  if (delta < 0 && sources_waiting_.load()) {
+    MaybeResumeSources();
+  }
+}
+
+void QueryContext::BeginAccumulation() {
+  ++num_accumulating_;
+  if (sources_waiting_.load()) {
+    MaybeResumeSources();
+  }
+}
+
+void QueryContext::EndAccumulation() { --num_accumulating_; }
+
+bool QueryContext::ShouldSourcesWait() const {
+  const auto& budget = options_.queued_bytes_budget;
+  return budget.has_value() && num_accumulating_.load() == 0 &&
+         queued_bytes_.load() > *budget;
+}
+
+void QueryContext::ResumeSources() { MaybeResumeSources(/*force=*/true); }
+
+void QueryContext::MaybeResumeSources(bool force) {
+  Future<> to_finish;
+  {
+    std::lock_guard<std::mutex> lk(sources_mutex_);
+    if (!sources_waiting_.load() || (!force && ShouldSourcesWait())) {
+      return;
+    }
+    sources_waiting_.store(false);
+    to_finish = std::move(sources_resumed_);
+  }
+  to_finish.MarkFinished();
+}
+
+Future<> QueryContext::WaitForQueuedBytes() {
+  if (!ShouldSourcesWait()) {
+    return Future<>::MakeFinished();
+  }
+  std::unique_lock<std::mutex> lk(sources_mutex_);
+  // Publish the waiting flag before checking again, so that a concurrent release of
+  // queued bytes either is seen here or sees the flag
+  if (!sources_waiting_.load()) {
+    sources_resumed_ = Future<>::Make();
+    sources_waiting_.store(true);
+  }
+  if (ShouldSourcesWait()) {
+    return sources_resumed_;
+  }
+  sources_waiting_.store(false);
+  Future<> to_finish = std::move(sources_resumed_);
+  lk.unlock();
+  to_finish.MarkFinished();
+  return to_finish;
+}
 }  // namespace acero
 }  // namespace arrow
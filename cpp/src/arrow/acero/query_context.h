@@ -16,6 +16,8 @@
 // under the License.
 #pragma once
 
+#include <atomic>
+#include <mutex>
 #include <string_view>
 
 #include "arrow/acero/exec_plan.h"
@@ -24,6 +26,7 @@
 #include "arrow/compute/exec.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/util/async_util.h"
+#include "arrow/util/future.h"
 #include "arrow/util/type_fwd.h"
 
 namespace arrow {
@@ -133,6 +136,32 @@ class ARROW_ACERO_EXPORT QueryContext {
 
   size_t GetCurrentTempFileIO() { return in_flight_bytes_to_disk_.load(); }
 
+  /// \brief Report a change of the number of bytes queued up by a node
+  ///
+  /// \see QueryOptions::queued_bytes_budget
+  void ReportQueuedBytes(int64_t delta);
+
+  /// \brief The total number of bytes currently queued up by the nodes of the plan
+  int64_t queued_bytes() const { return queued_bytes_.load(); }
+
+  /// \brief Note that a node started accumulating an input it needs entirely
+  ///
+  /// Sources don't wait for queued bytes until the matching EndAccumulation call,
+  /// which must happen once the input is complete or the node is stopped.
+  void BeginAccumulation();
+  void EndAccumulation();
+
+  /// \brief Get a future that completes once sources may read more data
+  ///
+  /// The future is already finished if no QueryOptions::queued_bytes_budget is set, or
+  /// if the plan is within budget.  Otherwise it finishes once enough queued bytes are
+  /// released or a node begins accumulating.
+  Future<> WaitForQueuedBytes();
+
+  /// \brief Finish the future returned by WaitForQueuedBytes, e.g. when a source is
+  /// stopped.  Sources that are still over budget will wait again.
+  void ResumeSources();
+
  private:
   QueryOptions options_;
   // To be replaced with Acero-specific context once scheduler is done and
@@ -146,6 +175,16 @@ class ARROW_ACERO_EXPORT QueryContext {
   ThreadIndexer thread_indexer_;
 
   std::atomic<size_t> in_flight_bytes_to_disk_{0};
+
+  // Accounting of QueryOptions::queued_bytes_budget
+  bool ShouldSourcesWait() const;
+  void MaybeResumeSources(bool force = false);
+
+  std::atomic<int64_t> queued_bytes_{0};
+  std::atomic<int> num_accumulating_{0};
+  std::atomic<bool> sources_waiting_{false};
+  std::mutex sources_mutex_;
+  Future<> sources_resumed_;
 };
 }  // namespace acero
 }  // namespace arrow
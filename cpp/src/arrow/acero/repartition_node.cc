@@ -0,0 +1,263 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/partition_util.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/spill_internal.h"
+#include "arrow/acero/util.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/result.h"
+#include "arrow/scalar.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace acero {
+namespace {
+
+// Splits every input batch into one output batch per non-empty partition, tagged
+// with the partition number.
+//
+// Hash partitioning reuses the HashPartitioner of spilling nodes.  Range partitioning
+// counts, for every row, the boundaries that are less than or equal to its key.
+class RepartitionNode : public ExecNode, public TracedNode {
+ public:
+  RepartitionNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                  std::shared_ptr<Schema> output_schema, std::vector<int> key_ids,
+                  int num_partitions, std::vector<std::shared_ptr<Scalar>> boundaries)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        key_ids_(std::move(key_ids)),
+        num_partitions_(num_partitions),
+        boundaries_(std::move(boundaries)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "RepartitionNode"));
+    const auto& repartition_options =
+        checked_cast<const RepartitionNodeOptions&>(options);
+    const int num_partitions = repartition_options.num_partitions;
+    if (num_partitions < 1 || num_partitions > (1 << 15)) {
+      return Status::Invalid("`num_partitions` must be between 1 and 32768, got ",
+                             num_partitions);
+    }
+    if (repartition_options.keys.empty()) {
+      return Status::Invalid("RepartitionNode requires at least one key");
+    }
+
+    const auto& input_schema = inputs[0]->output_schema();
+    std::vector<int> key_ids;
+    for (const auto& key : repartition_options.keys) {
+      ARROW_ASSIGN_OR_RAISE(auto match, key.FindOne(*input_schema));
+      key_ids.push_back(match[0]);
+    }
+
+    std::vector<std::shared_ptr<Scalar>> boundaries;
+    if (const auto& range_boundaries = repartition_options.range_boundaries) {
+      if (key_ids.size() != 1) {
+        return Status::Invalid("Range partitioning requires a single key");
+      }
+      const auto& key_type = input_schema->field(key_ids[0])->type();
+      if (!range_boundaries->type()->Equals(*key_type)) {
+        return Status::TypeError("Range boundaries of type ", *range_boundaries->type(),
+                                 " for a key of type ", *key_type);
+      }
+      if (range_boundaries->length() != num_partitions - 1) {
+        return Status::Invalid("Range partitioning into ", num_partitions,
+                               " partitions requires ", num_partitions - 1,
+                               " boundaries, got ", range_boundaries->length());
+      }
+      if (range_boundaries->null_count() > 0) {
+        return Status::Invalid("Range boundaries must not be null");
+      }
+      RETURN_NOT_OK(CheckAscending(*range_boundaries,
+                                   plan->query_context()->exec_context()));
+      for (int64_t i = 0; i < range_boundaries->length(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(auto boundary, range_boundaries->GetScalar(i));
+        boundaries.push_back(std::move(boundary));
+      }
+    }
+
+    FieldVector fields = input_schema->fields();
+    fields.push_back(
+        field(repartition_options.partition_field_name, int32(), /*nullable=*/false));
+    return plan->EmplaceNode<RepartitionNode>(
+        plan, std::move(inputs), schema(std::move(fields)), std::move(key_ids),
+        num_partitions, std::move(boundaries));
+  }
+
+  const char* kind_name() const override { return "RepartitionNode"; }
+
+  Status Init() override {
+    if (boundaries_.empty()) {
+      QueryContext* ctx = plan_->query_context();
+      RETURN_NOT_OK(
+          partitioner_.Init(ctx, key_ids_, num_partitions_, ctx->max_concurrency()));
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    DCHECK_EQ(input, inputs_[0]);
+
+    if (batch.length > 0) {
+      std::vector<uint16_t> partition_ids;
+      if (boundaries_.empty()) {
+        RETURN_NOT_OK(partitioner_.PartitionIds(plan_->query_context()->GetThreadIndex(),
+                                                batch, &partition_ids));
+      } else {
+        RETURN_NOT_OK(RangePartitionIds(batch, &partition_ids));
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          std::vector<ExecBatch> partitions,
+          SplitByPartition(batch, partition_ids.data(), num_partitions_,
+                           plan_->query_context()->exec_context()));
+      for (int prtn = 0; prtn < num_partitions_; ++prtn) {
+        ExecBatch& out = partitions[prtn];
+        if (out.length == 0) {
+          continue;
+        }
+        out.values.emplace_back(MakeScalar(static_cast<int32_t>(prtn)));
+        num_output_batches_.fetch_add(1);
+        RETURN_NOT_OK(output_->InputReceived(this, std::move(out)));
+      }
+    }
+
+    if (counter_.Increment()) {
+      return output_->InputFinished(this, num_output_batches_.load());
+    }
+    return Status::OK();
+  }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    if (counter_.SetTotal(total_batches)) {
+      return output_->InputFinished(this, num_output_batches_.load());
+    }
+    return Status::OK();
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    const auto& input_schema = inputs_[0]->output_schema();
+    ss << (boundaries_.empty() ? "hash" : "range") << " keys=[";
+    for (size_t i = 0; i < key_ids_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << '"' << input_schema->field(key_ids_[i])->name() << '"';
+    }
+    ss << "] partitions=" << num_partitions_;
+    return ss.str();
+  }
+
+ private:
+  static Status CheckAscending(const Array& boundaries, ExecContext* ctx) {
+    if (boundaries.length() < 2) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        Datum ascending,
+        compute::CallFunction("less", {boundaries.Slice(0, boundaries.length() - 1),
+                                       boundaries.Slice(1)},
+                              ctx));
+    ARROW_ASSIGN_OR_RAISE(
+        Datum all_ascending,
+        compute::All(ascending, compute::ScalarAggregateOptions(), ctx));
+    if (!checked_cast<const BooleanScalar&>(*all_ascending.scalar()).value) {
+      return Status::Invalid("Range boundaries must be strictly ascending");
+    }
+    return Status::OK();
+  }
+
+  // The partition of a row is the number of boundaries less than or equal to its key
+  Status RangePartitionIds(const ExecBatch& batch, std::vector<uint16_t>* partition_ids) {
+    partition_ids->assign(static_cast<size_t>(batch.length), 0);
+    const Datum& key = batch[key_ids_[0]];
+    ExecContext* ctx = plan_->query_context()->exec_context();
+    for (const auto& boundary : boundaries_) {
+      ARROW_ASSIGN_OR_RAISE(
+          Datum at_least, compute::CallFunction("greater_equal", {key, boundary}, ctx));
+      if (at_least.is_scalar()) {
+        const auto& scalar = checked_cast<const BooleanScalar&>(*at_least.scalar());
+        if (scalar.is_valid && scalar.value) {
+          for (auto& id : *partition_ids) ++id;
+        }
+        continue;
+      }
+      ArraySpan span(*at_least.array());
+      const uint8_t* values = span.buffers[1].data;
+      for (int64_t i = 0; i < span.length; ++i) {
+        if (span.IsValid(i) && bit_util::GetBit(values, span.offset + i)) {
+          ++(*partition_ids)[i];
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  const std::vector<int> key_ids_;
+  const int num_partitions_;
+  // Empty for hash partitioning
+  const std::vector<std::shared_ptr<Scalar>> boundaries_;
+  HashPartitioner partitioner_;
+  AtomicCounter counter_;
+  std::atomic<int> num_output_batches_{0};
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterRepartitionNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory(std::string(RepartitionNodeOptions::kName),
+                                 RepartitionNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <unordered_map>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/matchers.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using compute::SortKey;
+using internal::checked_pointer_cast;
+
+namespace acero {
+
+namespace {
+
+std::shared_ptr<Table> MakeInput() {
+  return TableFromJSON(schema({field("k", int32()), field("v", int32())}),
+                       {R"([[5, 1], [20, 2], [null, 3], [10, 4]])",
+                        R"([[15, 5], [5, 6], [25, 7], [10, 8]])"});
+}
+
+Result<std::shared_ptr<Table>> RunRepartition(std::shared_ptr<Table> input,
+                                              RepartitionNodeOptions options) {
+  Declaration plan = Declaration::Sequence({
+      {"table_source", TableSourceNodeOptions(std::move(input))},
+      {"repartition", std::move(options)},
+      {"order_by", OrderByNodeOptions(Ordering({SortKey("v")}))},
+  });
+  return DeclarationToTable(std::move(plan));
+}
+
+}  // namespace
+
+TEST(RepartitionNode, Hash) {
+  constexpr int kNumPartitions = 3;
+  ASSERT_OK_AND_ASSIGN(auto output,
+                       RunRepartition(MakeInput(), RepartitionNodeOptions(
+                                                       {"k"}, kNumPartitions, "p")));
+  ASSERT_EQ(output->num_rows(), 8);
+  ASSERT_EQ(output->schema()->field(2)->name(), "p");
+  ASSERT_OK_AND_ASSIGN(output, output->CombineChunks());
+
+  auto keys = checked_pointer_cast<Int32Array>(output->column(0)->chunk(0));
+  auto values = checked_pointer_cast<Int32Array>(output->column(1)->chunk(0));
+  auto partitions = checked_pointer_cast<Int32Array>(output->column(2)->chunk(0));
+  std::unordered_map<int32_t, int32_t> partition_of_key;
+  for (int64_t i = 0; i < output->num_rows(); ++i) {
+    ASSERT_EQ(values->Value(i), i + 1);
+    ASSERT_GE(partitions->Value(i), 0);
+    ASSERT_LT(partitions->Value(i), kNumPartitions);
+    if (keys->IsNull(i)) continue;
+    auto inserted = partition_of_key.emplace(keys->Value(i), partitions->Value(i));
+    // Rows with equal keys are in the same partition
+    ASSERT_EQ(inserted.first->second, partitions->Value(i));
+  }
+}
+
+TEST(RepartitionNode, Range) {
+  ASSERT_OK_AND_ASSIGN(
+      auto output,
+      RunRepartition(MakeInput(), RepartitionNodeOptions::Range(
+                                      "k", ArrayFromJSON(int32(), "[10, 20]"))));
+  auto expected =
+      TableFromJSON(schema({field("k", int32()), field("v", int32()),
+                            field("partition", int32(), /*nullable=*/false)}),
+                    {R"([[5, 1, 0], [20, 2, 2], [null, 3, 0], [10, 4, 1],
+                         [15, 5, 1], [5, 6, 0], [25, 7, 2], [10, 8, 1]])"});
+  AssertTablesEqual(*expected, *output, /*same_chunk_layout=*/false);
+}
+
+TEST(RepartitionNode, InvalidOptions) {
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("must be between 1 and 32768"),
+      RunRepartition(MakeInput(), RepartitionNodeOptions({"k"}, 0)));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("strictly ascending"),
+      RunRepartition(MakeInput(), RepartitionNodeOptions::Range(
+                                      "k", ArrayFromJSON(int32(), "[20, 10]"))));
+  RepartitionNodeOptions too_few_boundaries({"k"}, 3);
+  too_few_boundaries.range_boundaries = ArrayFromJSON(int32(), "[20]");
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("requires 2 boundaries"),
+      RunRepartition(MakeInput(), std::move(too_few_boundaries)));
+}
+
+}  // namespace acero
+}  // namespace arrow
@@ -195,6 +195,7 @@ class SinkNode : public ExecNode,
   }
 
   void RecordBackpressureBytesUsed(const ExecBatch& batch) {
+    plan_->query_context()->ReportQueuedBytes(batch.TotalBufferSize());
     if (backpressure_queue_.enabled()) {
       uint64_t bytes_used = static_cast<uint64_t>(batch.TotalBufferSize());
       auto state_change = backpressure_queue_.RecordProduced(bytes_used);
@@ -208,6 +209,7 @@ class SinkNode : public ExecNode,
   }
 
   void RecordBackpressureBytesFreed(const ExecBatch& batch) {
+    plan_->query_context()->ReportQueuedBytes(-batch.TotalBufferSize());
     if (backpressure_queue_.enabled()) {
       uint64_t bytes_freed = static_cast<uint64_t>(batch.TotalBufferSize());
       auto state_change = backpressure_queue_.RecordConsumed(bytes_freed);
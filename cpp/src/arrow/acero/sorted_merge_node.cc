@@ -17,7 +17,9 @@
 
 #include <any>
 #include <atomic>
+#include <limits>
 #include <mutex>
+#include <optional>
 #include <sstream>
 #include <thread>
 #include <tuple>
@@ -164,38 +166,35 @@ class InputState {
 
   bool Finished() const { return batches_processed_ == total_batches_; }
 
-  void Advance(SingleRecordBatchSliceBuilder& builder) {
-    // Advance the row until a new time is encountered or the record batch
-    // ends. This will return a range of {-1, -1} and a nullptr if there is
-    // no input
-    bool active =
-        (latest_ref_row_ > 0 /*short circuit the lock on the queue*/) || !queue_.Empty();
-
-    if (!active) {
-      return;
-    }
+  // Advance over all the rows of the latest batch up to a time of `bound` (inclusive),
+  // adding them as a single slice.  The latest row must have a time of at most `bound`.
+  void AdvanceUpTo(SingleRecordBatchSliceBuilder& builder, time_unit_t bound) {
+    DCHECK(!Empty());
+    DCHECK_LE(GetLatestTime(), bound);
+    std::shared_ptr<arrow::RecordBatch> batch = queue_.Front();
+    auto rows_in_batch = static_cast<row_index_t>(batch->num_rows());
 
+    // The rows are sorted by time, so binary search the end of the run
     row_index_t start = latest_ref_row_;
-    row_index_t end = latest_ref_row_;
-    time_unit_t startTime = GetLatestTime();
-    std::shared_ptr<arrow::RecordBatch> batch = queue_.Front();
-    auto rows_in_batch = (row_index_t)batch->num_rows();
-
-    while (GetLatestTime() == startTime) {
-      end = ++latest_ref_row_;
-      if (latest_ref_row_ >= rows_in_batch) {
-        // hit the end of the batch, need to get the next batch if
-        // possible.
-        ++batches_processed_;
-        latest_ref_row_ = 0;
-        active &= !queue_.TryPop();
-        if (active) {
-          DCHECK_GT(queue_.Front()->num_rows(),
-                    0);  // empty batches disallowed, sanity check
-        }
-        break;
+    row_index_t end = start + 1;
+    row_index_t count = rows_in_batch - end;
+    while (count > 0) {
+      row_index_t step = count / 2;
+      if (GetTime(batch.get(), time_type_id_, time_col_index_, end + step) <= bound) {
+        end += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
       }
     }
+
+    if (end >= rows_in_batch) {
+      ++batches_processed_;
+      latest_ref_row_ = 0;
+      queue_.TryPop();
+    } else {
+      latest_ref_row_ = end;
+    }
     builder.AddEntry(batch, start, end);
   }
 
@@ -235,23 +234,97 @@ class InputState {
   time_unit_t latest_time_ = std::numeric_limits<time_unit_t>::lowest();
 };
 
-struct InputStateComparator {
-  bool operator()(const std::shared_ptr<InputState>& lhs,
-                  const std::shared_ptr<InputState>& rhs) const {
-    // True if lhs is ahead of time of rhs
-    if (lhs->Finished()) {
-      return false;
+/// A tournament tree of losers over the latest times of the inputs
+///
+/// Each internal node holds the input that lost the match played there, and the root
+/// holds the overall winner, the input with the smallest time.  Once the winner has
+/// advanced, replaying its path to the root takes log(n) comparisons, where a binary heap
+/// would take about twice as many.  Ties are broken by input index, and finished inputs
+/// lose against all others.
+class LoserTree {
+ public:
+  explicit LoserTree(const std::vector<std::shared_ptr<InputState>>& inputs)
+      : inputs_(inputs),
+        num_leaves_(inputs.size()),
+        times_(num_leaves_),
+        tree_(num_leaves_) {
+    for (size_t i = 0; i < num_leaves_; ++i) {
+      UpdateTime(i);
+    }
+    // Play all the matches bottom up, leaf i being at position num_leaves_ + i
+    std::vector<size_t> winners(2 * num_leaves_);
+    for (size_t i = 0; i < num_leaves_; ++i) {
+      winners[num_leaves_ + i] = i;
+    }
+    for (size_t node = num_leaves_ - 1; node >= 1; --node) {
+      size_t a = winners[2 * node], b = winners[2 * node + 1];
+      bool a_wins = Less(a, b);
+      winners[node] = a_wins ? a : b;
+      tree_[node] = a_wins ? b : a;
     }
-    if (rhs->Finished()) {
+    tree_[0] = num_leaves_ > 1 ? winners[1] : 0;
+  }
+
+  /// The input with the smallest latest time
+  size_t winner() const { return tree_[0]; }
+
+  /// Whether all the inputs are finished
+  bool done() const { return !times_[winner()].has_value(); }
+
+  /// The smallest latest time of the inputs other than the winner, or the maximum
+  /// time if all of them are finished.  The winner can emit all its rows up to it.
+  time_unit_t RunnerUpTime() const {
+    time_unit_t bound = std::numeric_limits<time_unit_t>::max();
+    for (size_t node = (num_leaves_ + winner()) / 2; node >= 1; node /= 2) {
+      const auto& time = times_[tree_[node]];
+      if (time.has_value() && *time < bound) {
+        bound = *time;
+      }
+    }
+    return bound;
+  }
+
+  /// Replay the matches of the winner after it advanced.  The winner must not be empty
+  /// unless it is finished.
+  void ReplayWinner() {
+    size_t candidate = winner();
+    UpdateTime(candidate);
+    for (size_t node = (num_leaves_ + candidate) / 2; node >= 1; node /= 2) {
+      if (Less(tree_[node], candidate)) {
+        std::swap(tree_[node], candidate);
+      }
+    }
+    tree_[0] = candidate;
+  }
+
+ private:
+  void UpdateTime(size_t i) {
+    if (inputs_[i]->Finished()) {
+      times_[i].reset();
+    } else {
+      times_[i] = inputs_[i]->GetLatestTime();
+    }
+  }
+
+  bool Less(size_t a, size_t b) const {
+    if (!times_[b].has_value()) {
+      return times_[a].has_value() || a < b;
+    }
+    if (!times_[a].has_value()) {
       return false;
     }
-    time_unit_t lFirst = lhs->GetLatestTime();
-    time_unit_t rFirst = rhs->GetLatestTime();
-    return lFirst > rFirst;
+    return *times_[a] < *times_[b] || (*times_[a] == *times_[b] && a < b);
   }
+
+  const std::vector<std::shared_ptr<InputState>>& inputs_;
+  size_t num_leaves_;
+  // The latest time of each input, or nullopt if it is finished
+  std::vector<std::optional<time_unit_t>> times_;
+  // The loser of each internal node, and the winner at index 0
+  std::vector<size_t> tree_;
 };
 
-class SortedMergeNode : public ExecNode {
+class SortedMergeNode : public ExecNode, public TracedNode {
   static constexpr int64_t kTargetOutputBatchSize = 1024 * 1024;
 
  public:
@@ -260,6 +333,7 @@ class SortedMergeNode : public ExecNode {
                   std::shared_ptr<arrow::Schema> output_schema,
                   arrow::Ordering new_ordering)
       : ExecNode(plan, inputs, GetInputLabels(inputs), std::move(output_schema)),
+        TracedNode(this),
         ordering_(std::move(new_ordering)),
         input_counter(inputs_.size()),
         output_counter(inputs_.size())
@@ -350,6 +424,7 @@ class SortedMergeNode : public ExecNode {
   arrow::Status InputReceived(arrow::acero::ExecNode* input,
                               arrow::ExecBatch batch) override {
     ARROW_DCHECK(std_has(inputs_, input));
+    auto scope = TraceInputReceived(batch, input);
     const size_t index = std_find(inputs_, input) - inputs_.begin();
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> rb,
                           batch.ToRecordBatch(output_schema_));
@@ -392,6 +467,7 @@ class SortedMergeNode : public ExecNode {
   }
 
   arrow::Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
     ARROW_ASSIGN_OR_RAISE(process_task, plan_->query_context()->BeginExternalTask(
                                             "SortedMergeNode::ProcessThread"));
     if (!process_task.is_valid()) {
@@ -417,7 +493,7 @@ class SortedMergeNode : public ExecNode {
   void ResumeProducing(arrow::acero::ExecNode* output, int32_t counter) override {}
 
  protected:
-  std::string ToStringExtra(int indent) const override {
+  std::string ToStringExtra(int indent = 0) const override {
     std::stringstream ss;
     ss << "ordering=" << ordering_.ToString();
     return ss.str();
@@ -468,23 +544,7 @@ class SortedMergeNode : public ExecNode {
       }
     }
 
-    std::vector<std::shared_ptr<InputState>> heap = state;
-    // filter out finished states
-    heap.erase(std::remove_if(
-                   heap.begin(), heap.end(),
-                   [](const std::shared_ptr<InputState>& s) { return s->Finished(); }),
-               heap.end());
-
-    // If any are Empty(), then return early since we don't have enough data
-    if (std::any_of(heap.begin(), heap.end(),
-                    [](const std::shared_ptr<InputState>& s) { return s->Empty(); })) {
-      return nullptr;
-    }
-
-    // Currently we only support one sort key
-    const auto sort_col = *ordering_.sort_keys().at(0).target.name();
-    const auto comp = InputStateComparator();
-    std::make_heap(heap.begin(), heap.end(), comp);
+    LoserTree tree(state);
 
     // Each slice only has one record batch with the same schema as the output
     std::unordered_map<int, std::pair<int, int>> output_col_to_src;
@@ -496,36 +556,22 @@ class SortedMergeNode : public ExecNode {
                                            plan()->query_context()->memory_pool());
 
     // Generate rows until we run out of data or we exceed the target output
-    // size
-    bool waiting_for_more_data = false;
-    while (!waiting_for_more_data && !heap.empty() &&
-           output.Size() < kTargetOutputBatchSize) {
-      std::pop_heap(heap.begin(), heap.end(), comp);
-
-      auto& next_item = heap.back();
-      time_unit_t latest_time = std::numeric_limits<time_unit_t>::min();
-      time_unit_t new_time = next_item->GetLatestTime();
-      ARROW_CHECK(new_time >= latest_time)
-          << "Input state " << next_item->index()
-          << " has out of order data. newTime=" << new_time
-          << " latestTime=" << latest_time;
-
-      latest_time = new_time;
+    // size.  Each step emits the run of rows of the winning input up to the time of
+    // the runner-up as a single slice.
+    while (!tree.done() && output.Size() < kTargetOutputBatchSize) {
+      auto& next_item = state[tree.winner()];
       SingleRecordBatchSliceBuilder builder{&output};
-      next_item->Advance(builder);
+      next_item->AdvanceUpTo(builder, tree.RunnerUpTime());
 
       if (builder.Size() > 0) {
         output_counter[next_item->index()] += builder.Size();
         builder.Finalize();
       }
-      if (next_item->Finished()) {
-        heap.pop_back();
-      } else if (next_item->Empty()) {
+      if (next_item->Empty() && !next_item->Finished()) {
         // We've run out of data on one of the inputs
-        waiting_for_more_data = true;
-        continue;  // skip the unnecessary make_heap
+        break;
       }
-      std::make_heap(heap.begin(), heap.end(), comp);
+      tree.ReplayWinner();
     }
 
     // Emit the batch
@@ -539,6 +585,8 @@ class SortedMergeNode : public ExecNode {
   /// Gets a batch. Returns true if there is more data to process, false if we
   /// are done or an error occurred
   bool PollOnce() {
+    // The merging happens here, on the process thread, rather than in InputReceived
+    auto scope = TraceFinish();
     std::lock_guard<std::mutex> guard(gate);
     if (!CheckEnded()) {
       return false;
@@ -15,8 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/options.h"
@@ -83,4 +87,55 @@ TEST(SortedMergeNode, Basic) {
   AssertArraysEqual(*expected_ts, *output_ts);
 }
 
+TEST(SortedMergeNode, ManyInputs) {
+  // Enough inputs for several levels of the tournament tree, with runs of rows that
+  // span batches and ties between inputs
+  constexpr int kNumInputs = 37;
+  std::vector<Declaration::Input> src_decls;
+  std::vector<int> expected;
+  for (int i = 0; i < kNumInputs; ++i) {
+    int start = i % 7, step = i % 3, rows_per_batch = i % 4 + 1, num_batches = 3;
+    for (int row = 0; row < rows_per_batch * num_batches; ++row) {
+      expected.push_back(start + row * step);
+    }
+    src_decls.emplace_back(Declaration(
+        "table_source",
+        TableSourceNodeOptions(TestTable(start, step, rows_per_batch, num_batches))));
+  }
+  std::sort(expected.begin(), expected.end());
+
+  auto ops = OrderByNodeOptions(compute::Ordering({compute::SortKey("timestamp")}));
+  Declaration sorted_merge{"sorted_merge", src_decls, ops};
+  ASSERT_OK_AND_ASSIGN(auto output,
+                       DeclarationToTable(sorted_merge, /*use_threads=*/false));
+  ASSERT_OK_AND_ASSIGN(auto output_ts, Concatenate(output->column(0)->chunks()));
+
+  ASSERT_OK_AND_ASSIGN(auto expected_ts_builder,
+                       MakeBuilder(int32(), default_memory_pool()));
+  for (auto i : expected) {
+    ASSERT_OK(expected_ts_builder->AppendScalar(*MakeScalar(i)));
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected_ts, expected_ts_builder->Finish());
+  AssertArraysEqual(*expected_ts, *output_ts);
+}
+
+TEST(SortedMergeNode, NodeStatistics) {
+  std::vector<Declaration::Input> src_decls;
+  src_decls.emplace_back(
+      Declaration("table_source", TableSourceNodeOptions(TestTable(0, 2, 2, 3))));
+  src_decls.emplace_back(
+      Declaration("table_source", TableSourceNodeOptions(TestTable(1, 2, 3, 2))));
+
+  auto ops = OrderByNodeOptions(compute::Ordering({compute::SortKey("timestamp")}));
+  Declaration sorted_merge{"sorted_merge", src_decls, ops};
+  QueryOptions query_options;
+  query_options.use_threads = false;
+  ASSERT_OK_AND_ASSIGN(std::string explained,
+                       DeclarationToExplainAnalyze(sorted_merge, query_options));
+  ASSERT_THAT(explained,
+              testing::ContainsRegex(
+                  "SortedMergeNode\\{[^}]*\\} \\[input_batches=5 input_rows=12 "
+                  "[^]]* output_rows=12 "));
+}
+
 }  // namespace arrow::acero
@@ -99,7 +99,10 @@ struct SourceNode : ExecNode, public TracedNode {
       : ExecNode(plan, {}, {}, std::move(output_schema)),
         TracedNode(this),
         generator_(std::move(generator)),
-        ordering_(std::move(ordering)) {}
+        ordering_(std::move(ordering)),
+        batcher_(plan->query_context()->options().morsel_size,
+                 plan->query_context()->options().adaptive_morsel_size,
+                 plan->query_context()->memory_pool()) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -118,50 +121,51 @@ struct SourceNode : ExecNode, public TracedNode {
   [[noreturn]] Status InputReceived(ExecNode*, ExecBatch) override { NoInputs(); }
   [[noreturn]] Status InputFinished(ExecNode*, int) override { NoInputs(); }
 
-  void SliceAndDeliverMorsel(const ExecBatch& morsel) {
-    bool use_legacy_batching = plan_->query_context()->options().use_legacy_batching;
-    int64_t morsel_length = static_cast<int64_t>(morsel.length);
-    int initial_batch_index = batch_count_;
-    if (use_legacy_batching || morsel_length == 0) {
-      // For various reasons (e.g. ARROW-13982) we pass empty batches
-      // through
-      batch_count_++;
-    } else {
-      int num_batches =
-          static_cast<int>(bit_util::CeilDiv(morsel_length, ExecPlan::kMaxBatchSize));
-      batch_count_ += num_batches;
-    }
+  void DeliverBatch(ExecBatch batch) {
+    int batch_index = batch_count_++;
     plan_->query_context()->ScheduleTask(
-        [this, morsel_length, use_legacy_batching, initial_batch_index, morsel,
-         has_ordering = !ordering_.is_unordered()]() {
-          int64_t offset = 0;
-          int batch_index = initial_batch_index;
-          do {
-            int64_t batch_size =
-                std::min<int64_t>(morsel_length - offset, ExecPlan::kMaxBatchSize);
-            // In order for the legacy batching model to work we must
-            // not slice batches from the source
-            if (use_legacy_batching) {
-              batch_size = morsel_length;
-            }
-            ExecBatch batch = morsel.Slice(offset, batch_size);
-            UnalignedBufferHandling unaligned_buffer_handling =
-                plan_->query_context()->options().unaligned_buffer_handling.value_or(
-                    GetDefaultUnalignedBufferHandling());
-            ARROW_RETURN_NOT_OK(
-                HandleUnalignedBuffers(&batch, unaligned_buffer_handling));
-            if (has_ordering) {
-              batch.index = batch_index;
-            }
-            offset += batch_size;
-            batch_index++;
-            ARROW_RETURN_NOT_OK(output_->InputReceived(this, std::move(batch)));
-          } while (offset < morsel.length);
-          return Status::OK();
+        [this, batch_index, batch = std::move(batch),
+         has_ordering = !ordering_.is_unordered()]() mutable {
+          UnalignedBufferHandling unaligned_buffer_handling =
+              plan_->query_context()->options().unaligned_buffer_handling.value_or(
+                  GetDefaultUnalignedBufferHandling());
+          ARROW_RETURN_NOT_OK(HandleUnalignedBuffers(&batch, unaligned_buffer_handling));
+          if (has_ordering) {
+            batch.index = batch_index;
+          }
+          const int64_t num_rows = batch.length;
+          return batcher_.RunMorsel(num_rows, [&] {
+            return output_->InputReceived(this, std::move(batch));
+          });
         },
         "SourceNode::ProcessMorsel");
   }
 
+  // Deliver a batch read from the generator as one or more morsels, each processed
+  // by its own task
+  Status SliceAndDeliverMorsel(const ExecBatch& morsel) {
+    // In order for the legacy batching model to work we must
+    // not slice batches from the source
+    if (plan_->query_context()->options().use_legacy_batching) {
+      DeliverBatch(morsel);
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(std::vector<ExecBatch> batches, batcher_.Push(morsel));
+    for (auto& batch : batches) {
+      DeliverBatch(std::move(batch));
+    }
+    return Status::OK();
+  }
+
+  // Deliver the rows the batcher still holds once the generator is exhausted
+  Status FinishMorsels() {
+    ARROW_ASSIGN_OR_RAISE(std::vector<ExecBatch> batches, batcher_.Finish());
+    for (auto& batch : batches) {
+      DeliverBatch(std::move(batch));
+    }
+    return Status::OK();
+  }
+
   Status StartProducing() override {
     NoteStartProducing(ToStringExtra());
     {
@@ -203,17 +207,29 @@ struct SourceNode : ExecNode, public TracedNode {
           [this](
               const std::optional<ExecBatch>& morsel_or_end) -> Future<ControlFlow<int>> {
             std::unique_lock<std::mutex> lock(mutex_);
-            if (IsIterationEnd(morsel_or_end) || stop_requested_) {
+            if (stop_requested_) {
+              return Break(batch_count_);
+            }
+            if (IsIterationEnd(morsel_or_end)) {
+              lock.unlock();
+              ARROW_RETURN_NOT_OK(FinishMorsels());
               return Break(batch_count_);
             }
             lock.unlock();
-            SliceAndDeliverMorsel(*morsel_or_end);
+            ARROW_RETURN_NOT_OK(SliceAndDeliverMorsel(*morsel_or_end));
             lock.lock();
             if (!backpressure_future_.is_finished()) {
               EVENT_ON_CURRENT_SPAN("SourceNode::BackpressureApplied");
               return backpressure_future_.Then(
                   []() -> ControlFlow<int> { return Continue(); });
             }
+            lock.unlock();
+            // Wait for the plan to release queued bytes if it is over budget
+            Future<> queued_bytes = plan_->query_context()->WaitForQueuedBytes();
+            if (!queued_bytes.is_finished()) {
+              EVENT_ON_CURRENT_SPAN("SourceNode::QueuedBytesBudgetExceeded");
+              return queued_bytes.Then([]() -> ControlFlow<int> { return Continue(); });
+            }
             return Future<ControlFlow<int>>::MakeFinished(Continue());
           },
           [](const Status& err) -> Future<ControlFlow<int>> { return err; }, options);
@@ -246,6 +262,7 @@ struct SourceNode : ExecNode, public TracedNode {
       return;
     }
     backpressure_future_ = Future<>::Make();
+    NotePauseProducing();
   }
 
   void ResumeProducing(ExecNode* output, int32_t counter) override {
@@ -261,6 +278,7 @@ struct SourceNode : ExecNode, public TracedNode {
       }
       to_finish = backpressure_future_;
       backpressure_future_ = Future<>::MakeFinished();
+      NoteResumeProducing();
     }
     to_finish.MarkFinished();
   }
@@ -279,7 +297,10 @@ struct SourceNode : ExecNode, public TracedNode {
       to_finish.MarkFinished();
     }
     // only then stop
-    return ExecNode::StopProducing();
+    ARROW_RETURN_NOT_OK(ExecNode::StopProducing());
+    // Once stopped, a source waiting for the plan to release queued bytes can end
+    plan_->query_context()->ResumeSources();
+    return Status::OK();
   }
 
   Status StopProducingImpl() override {
@@ -297,6 +318,7 @@ struct SourceNode : ExecNode, public TracedNode {
   int batch_count_{0};
   const AsyncGenerator<std::optional<ExecBatch>> generator_;
   const Ordering ordering_;
+  MorselBatcher batcher_;
 };
 
 struct TableSourceNode : public SourceNode {
@@ -0,0 +1,219 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/spill_internal.h"
+
+#include <algorithm>
+
+#include "arrow/acero/partition_util.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using compute::Hashing32;
+using compute::KeyColumnArray;
+using internal::TemporaryDir;
+
+namespace acero {
+
+SpillFile::SpillFile(QueryContext* ctx, std::string path, std::shared_ptr<Schema> schema)
+    : ctx_(ctx), path_(std::move(path)), schema_(std::move(schema)) {}
+
+SpillFile::~SpillFile() {
+  if (!sink_) {
+    return;
+  }
+  if (!sink_->closed()) {
+    ARROW_WARN_NOT_OK(sink_->Close(), "Failed to close spill file");
+  }
+  // Release the disk space as soon as possible, the spill directory is only
+  // removed at the end of the plan.
+  auto file_name = internal::PlatformFilename::FromString(path_);
+  if (file_name.ok()) {
+    ARROW_WARN_NOT_OK(internal::DeleteFile(*file_name).status(),
+                      "Failed to delete spill file");
+  }
+}
+
+Status SpillFile::Append(const ExecBatch& batch) {
+  if (batch.length == 0) {
+    return Status::OK();
+  }
+  // Materialize outside of the lock, writing is the only serialized part
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                        batch.ToRecordBatch(schema_, ctx_->memory_pool()));
+  auto io_mark = ctx_->ReportTempFileIO(static_cast<size_t>(batch.TotalBufferSize()));
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!writer_) {
+    if (sink_) {
+      return Status::Invalid("Cannot append to spill file ", path_,
+                             " after it has been read");
+    }
+    ARROW_ASSIGN_OR_RAISE(sink_, io::FileOutputStream::Open(path_));
+    ipc::IpcWriteOptions options = ipc::IpcWriteOptions::Defaults();
+    options.memory_pool = ctx_->memory_pool();
+    ARROW_ASSIGN_OR_RAISE(writer_, ipc::MakeStreamWriter(sink_, schema_, options));
+  }
+  RETURN_NOT_OK(writer_->WriteRecordBatch(*record_batch));
+  num_rows_ += batch.length;
+  num_batches_ += 1;
+  ARROW_ASSIGN_OR_RAISE(bytes_written_, sink_->Tell());
+  return Status::OK();
+}
+
+Status SpillFile::FinishWriting() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (writer_) {
+    RETURN_NOT_OK(writer_->Close());
+    writer_.reset();
+    RETURN_NOT_OK(sink_->Close());
+  }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<RecordBatchReader>> SpillFile::OpenReader() {
+  RETURN_NOT_OK(FinishWriting());
+  if (num_batches_ == 0) {
+    return RecordBatchReader::Make({}, schema_);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto source, io::ReadableFile::Open(path_, ctx_->memory_pool()));
+  ipc::IpcReadOptions options = ipc::IpcReadOptions::Defaults();
+  options.memory_pool = ctx_->memory_pool();
+  return ipc::RecordBatchStreamReader::Open(std::move(source), options);
+}
+
+Result<std::vector<ExecBatch>> SpillFile::ReadAll() {
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatchReader> reader, OpenReader());
+  std::vector<ExecBatch> batches;
+  batches.reserve(static_cast<size_t>(num_batches_));
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch, reader->Next());
+    if (!record_batch) break;
+    batches.emplace_back(*record_batch);
+  }
+  return batches;
+}
+
+Result<std::unique_ptr<SpillDirectory>> SpillDirectory::Make(QueryContext* ctx) {
+  ARROW_ASSIGN_OR_RAISE(std::unique_ptr<TemporaryDir> dir,
+                        TemporaryDir::Make("acero-spill-"));
+  return std::unique_ptr<SpillDirectory>(new SpillDirectory(ctx, std::move(dir)));
+}
+
+Result<std::unique_ptr<SpillFile>> SpillDirectory::NewFile(
+    std::shared_ptr<Schema> schema) {
+  int64_t file_id;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    file_id = next_file_id_++;
+  }
+  std::string path = dir_->path().ToString() + "spill-" + std::to_string(file_id) +
+                     ".arrows";
+  return std::make_unique<SpillFile>(ctx_, std::move(path), std::move(schema));
+}
+
+namespace {
+
+constexpr int64_t kPartitionerTempStackUsage =
+    Hashing32::kHashBatchTempStackUsage +
+    (sizeof(uint32_t) + /*extra=*/1) * arrow::util::MiniBatch::kMiniBatchLength;
+
+}  // namespace
+
+Status HashPartitioner::Init(QueryContext* ctx, std::vector<int> key_columns,
+                             int num_partitions, size_t num_threads) {
+  DCHECK_GT(num_partitions, 0);
+  if (num_partitions > (1 << 15)) {
+    return Status::Invalid("Too many partitions: ", num_partitions);
+  }
+  ctx_ = ctx;
+  key_columns_ = std::move(key_columns);
+  num_partitions_ = num_partitions;
+  tld_.resize(num_threads);
+  for (auto& local_data : tld_) {
+    RETURN_NOT_OK(local_data.stack.Init(ctx_->memory_pool(), kPartitionerTempStackUsage));
+  }
+  return Status::OK();
+}
+
+Status HashPartitioner::PartitionIds(size_t thread_index, const ExecBatch& batch,
+                                     std::vector<uint16_t>* partition_ids) {
+  DCHECK_LT(thread_index, tld_.size());
+  partition_ids->resize(static_cast<size_t>(batch.length));
+  if (num_partitions_ == 1) {
+    std::fill(partition_ids->begin(), partition_ids->end(), 0);
+    return Status::OK();
+  }
+
+  std::vector<Datum> key_columns(key_columns_.size());
+  for (size_t i = 0; i < key_columns_.size(); ++i) {
+    key_columns[i] = batch[key_columns_[i]];
+    if (key_columns[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(key_columns[i],
+                            MakeArrayFromScalar(*key_columns[i].scalar(), batch.length,
+                                                ctx_->memory_pool()));
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch,
+                        ExecBatch::Make(std::move(key_columns), batch.length));
+
+  arrow::util::TempVectorStack* stack = &tld_[thread_index].stack;
+  arrow::util::TempVectorHolder<uint32_t> hash_holder(
+      stack, arrow::util::MiniBatch::kMiniBatchLength);
+  uint32_t* hashes = hash_holder.mutable_data();
+  std::vector<KeyColumnArray> temp_column_arrays;
+  for (int64_t start = 0; start < key_batch.length;
+       start += arrow::util::MiniBatch::kMiniBatchLength) {
+    int64_t length =
+        std::min(static_cast<int64_t>(key_batch.length - start),
+                 static_cast<int64_t>(arrow::util::MiniBatch::kMiniBatchLength));
+    RETURN_NOT_OK(Hashing32::HashBatch(key_batch, hashes, temp_column_arrays,
+                                       ctx_->cpu_info()->hardware_flags(), stack, start,
+                                       length));
+    for (int64_t i = 0; i < length; ++i) {
+      // Remix the hash before taking the top bits.  Hash tables built over a
+      // single partition also index by the hash, and would otherwise see the same
+      // value in the bits selecting the partition for every row.  Scaling by the
+      // number of partitions takes the top bits when it is a power of two.
+      uint32_t remixed = hashes[i] * 0x9E3779B1U;
+      (*partition_ids)[start + i] = static_cast<uint16_t>(
+          (static_cast<uint64_t>(remixed) * static_cast<uint64_t>(num_partitions_)) >>
+          32);
+    }
+  }
+  return Status::OK();
+}
+
+Result<std::vector<ExecBatch>> HashPartitioner::Split(size_t thread_index,
+                                                      const ExecBatch& batch) {
+  if (num_partitions_ == 1) {
+    return std::vector<ExecBatch>{batch};
+  }
+  std::vector<uint16_t> partition_ids;
+  RETURN_NOT_OK(PartitionIds(thread_index, batch, &partition_ids));
+  return SplitByPartition(batch, partition_ids.data(), num_partitions_,
+                          ctx_->exec_context());
+}
+
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,152 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/util_internal.h"
+#include "arrow/io/type_fwd.h"
+#include "arrow/ipc/type_fwd.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+
+using compute::ExecBatch;
+
+namespace acero {
+
+/// \brief A temporary file holding a sequence of spilled batches
+///
+/// Batches are written using the IPC stream format.  Appending batches is
+/// thread-safe.  Once all batches have been appended the file can be read
+/// back, either all at once or incrementally.
+class ARROW_ACERO_EXPORT SpillFile {
+ public:
+  SpillFile(QueryContext* ctx, std::string path, std::shared_ptr<Schema> schema);
+  ~SpillFile();
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(SpillFile);
+
+  /// \brief Append a batch to the file
+  ///
+  /// Scalar columns are broadcast to arrays before being written.
+  Status Append(const ExecBatch& batch);
+
+  /// \brief Finish writing and open a reader over the spilled batches
+  ///
+  /// No more batches may be appended after this has been called.
+  Result<std::shared_ptr<RecordBatchReader>> OpenReader();
+
+  /// \brief Finish writing and read every spilled batch back into memory
+  Result<std::vector<ExecBatch>> ReadAll();
+
+  const std::string& path() const { return path_; }
+  int64_t num_rows() const { return num_rows_; }
+  int64_t num_batches() const { return num_batches_; }
+  /// \brief The number of bytes written to disk so far
+  int64_t bytes_written() const { return bytes_written_; }
+
+ private:
+  Status FinishWriting();
+
+  QueryContext* ctx_;
+  std::string path_;
+  std::shared_ptr<Schema> schema_;
+
+  std::mutex mutex_;
+  std::shared_ptr<io::OutputStream> sink_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+  int64_t num_rows_ = 0;
+  int64_t num_batches_ = 0;
+  int64_t bytes_written_ = 0;
+};
+
+/// \brief A temporary directory that owns the spill files of a node
+///
+/// The directory is created under the system temporary directory (the TMPDIR
+/// environment variable is honored) and is removed, along with all files in
+/// it, when this object is destroyed.
+class ARROW_ACERO_EXPORT SpillDirectory {
+ public:
+  static Result<std::unique_ptr<SpillDirectory>> Make(QueryContext* ctx);
+
+  /// \brief Create a new, empty spill file for batches of the given schema
+  Result<std::unique_ptr<SpillFile>> NewFile(std::shared_ptr<Schema> schema);
+
+ private:
+  SpillDirectory(QueryContext* ctx, std::unique_ptr<::arrow::internal::TemporaryDir> dir)
+      : ctx_(ctx), dir_(std::move(dir)) {}
+
+  QueryContext* ctx_;
+  std::unique_ptr<::arrow::internal::TemporaryDir> dir_;
+  std::mutex mutex_;
+  int64_t next_file_id_ = 0;
+};
+
+/// \brief Splits batches into a fixed number of partitions by hashing key columns
+///
+/// Rows with equal keys are always assigned to the same partition, so operators
+/// that only need to see equal keys together (joins, aggregations) can process
+/// the partitions independently of each other.
+class ARROW_ACERO_EXPORT HashPartitioner {
+ public:
+  /// \brief Initialize the partitioner
+  ///
+  /// \param ctx the query context, used for memory allocation and CPU flags
+  /// \param key_columns the indices of the columns to hash
+  /// \param num_partitions the number of partitions, at most 2^15
+  /// \param num_threads the number of thread indices that may call Split
+  Status Init(QueryContext* ctx, std::vector<int> key_columns, int num_partitions,
+              size_t num_threads);
+
+  int num_partitions() const { return num_partitions_; }
+
+  /// \brief Compute the partition of every row of `batch`
+  Status PartitionIds(size_t thread_index, const ExecBatch& batch,
+                      std::vector<uint16_t>* partition_ids);
+
+  /// \brief Split `batch` into one batch per partition
+  ///
+  /// The result always contains num_partitions() batches, some of which may be
+  /// empty.
+  Result<std::vector<ExecBatch>> Split(size_t thread_index, const ExecBatch& batch);
+
+ private:
+  QueryContext* ctx_ = NULLPTR;
+  std::vector<int> key_columns_;
+  int num_partitions_ = 0;
+
+  struct ThreadLocalData {
+    arrow::util::TempVectorStack stack;
+  };
+  std::vector<ThreadLocalData> tld_;
+};
+
+}  // namespace acero
+}  // namespace arrow
@@ -19,11 +19,15 @@
 #include <algorithm>  // std::upper_bound
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <mutex>
+#include <numeric>
 #include "arrow/acero/hash_join.h"
 #include "arrow/acero/swiss_join_internal.h"
 #include "arrow/acero/util.h"
 #include "arrow/array/util.h"  // MakeArrayFromScalar
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/key_hash_internal.h"
 #include "arrow/compute/row/compare_internal.h"
 #include "arrow/compute/row/encode_internal.h"
@@ -1102,8 +1106,7 @@ uint32_t SwissTableForJoin::payload_id_to_key_id(uint32_t payload_id) const {
 }
 
 Status SwissTableForJoinBuild::Init(SwissTableForJoin* target, int dop, int64_t num_rows,
-                                    int64_t num_batches, bool reject_duplicate_keys,
-                                    bool no_payload,
+                                    bool reject_duplicate_keys, bool no_payload,
                                     const std::vector<KeyColumnMetadata>& key_types,
                                     const std::vector<KeyColumnMetadata>& payload_types,
                                     MemoryPool* pool, int64_t hardware_flags) {
@@ -1124,9 +1127,12 @@ Status SwissTableForJoinBuild::Init(SwissTableForJoin* target, int dop, int64_t
   pool_ = pool;
   hardware_flags_ = hardware_flags;
 
-  batch_states_.resize(num_batches);
   prtn_states_.resize(num_prtns_);
   thread_states_.resize(dop_);
+  for (ThreadState& thread_state : thread_states_) {
+    thread_state.temp_prtn_ids.resize(num_prtns_);
+  }
+  prtn_locks_.Init(dop_, num_prtns_);
 
   RowTableMetadata key_row_metadata;
   key_row_metadata.FromColumnMetadataVector(key_types,
@@ -1155,54 +1161,73 @@ Status SwissTableForJoinBuild::Init(SwissTableForJoin* target, int dop, int64_t
   return Status::OK();
 }
 
-Status SwissTableForJoinBuild::PartitionBatch(size_t thread_id, int64_t batch_id,
+Status SwissTableForJoinBuild::PushNextBatch(size_t thread_id,
+                                             const ExecBatch& key_batch,
+                                             const ExecBatch* payload_batch_maybe_null,
+                                             arrow::util::TempVectorStack* temp_stack) {
+  DCHECK_LT(thread_id, thread_states_.size());
+  ThreadState& locals = thread_states_[thread_id];
+  RETURN_NOT_OK(PartitionBatch(thread_id, key_batch, temp_stack));
+
+  // Insert the rows of each partition while holding its lock.  Partitions locked by
+  // other threads are skipped and retried once the free ones are done.
+  //
+  return prtn_locks_.ForEachPartition(
+      thread_id, locals.temp_prtn_ids.data(),
+      [&locals](int prtn_id) {
+        return locals.prtn_ranges[prtn_id + 1] == locals.prtn_ranges[prtn_id];
+      },
+      [&](int prtn_id) {
+        return ProcessPartition(thread_id, prtn_id, key_batch, payload_batch_maybe_null,
+                                temp_stack);
+      });
+}
+
+Status SwissTableForJoinBuild::PartitionBatch(size_t thread_id,
                                               const ExecBatch& key_batch,
                                               arrow::util::TempVectorStack* temp_stack) {
-  DCHECK_LT(thread_id, thread_states_.size());
-  DCHECK_LT(batch_id, static_cast<int64_t>(batch_states_.size()));
   ThreadState& locals = thread_states_[thread_id];
-  BatchState& batch_state = batch_states_[batch_id];
   uint16_t num_rows = static_cast<uint16_t>(key_batch.length);
 
   // Compute hash
   //
-  batch_state.hashes.resize(num_rows);
-  RETURN_NOT_OK(Hashing32::HashBatch(key_batch, batch_state.hashes.data(),
+  locals.hashes.resize(num_rows);
+  RETURN_NOT_OK(Hashing32::HashBatch(key_batch, locals.hashes.data(),
                                      locals.temp_column_arrays, hardware_flags_,
                                      temp_stack, /*start_row=*/0, num_rows));
 
   // Partition on hash
   //
-  batch_state.prtn_ranges.resize(num_prtns_ + 1);
-  batch_state.prtn_row_ids.resize(num_rows);
+  locals.prtn_ranges.resize(num_prtns_ + 1);
+  locals.prtn_row_ids.resize(num_rows);
   if (num_prtns_ == 1) {
     // We treat single partition case separately to avoid extra checks in row
     // partitioning implementation for general case.
     //
-    batch_state.prtn_ranges[0] = 0;
-    batch_state.prtn_ranges[1] = num_rows;
+    locals.prtn_ranges[0] = 0;
+    locals.prtn_ranges[1] = num_rows;
     for (uint16_t i = 0; i < num_rows; ++i) {
-      batch_state.prtn_row_ids[i] = i;
+      locals.prtn_row_ids[i] = i;
     }
   } else {
     PartitionSort::Eval(
-        num_rows, num_prtns_, batch_state.prtn_ranges.data(),
-        [this, &batch_state](int64_t i) {
+        num_rows, num_prtns_, locals.prtn_ranges.data(),
+        [this, &locals](int64_t i) {
           // SwissTable uses the highest bits of the hash for block index.
           // We want each partition to correspond to a range of block indices,
           // so we also partition on the highest bits of the hash.
           //
-          return batch_state.hashes[i] >> (SwissTable::bits_hash_ - log_num_prtns_);
+          return locals.hashes[i] >> (SwissTable::bits_hash_ - log_num_prtns_);
         },
-        [&batch_state](int64_t i, int pos) {
-          batch_state.prtn_row_ids[pos] = static_cast<uint16_t>(i);
+        [&locals](int64_t i, int pos) {
+          locals.prtn_row_ids[pos] = static_cast<uint16_t>(i);
         });
 
     // Update hashes, shifting left to get rid of the bits that were already used
     // for partitioning.
     //
-    for (size_t i = 0; i < batch_state.hashes.size(); ++i) {
-      batch_state.hashes[i] <<= log_num_prtns_;
+    for (size_t i = 0; i < locals.hashes.size(); ++i) {
+      locals.hashes[i] <<= log_num_prtns_;
     }
   }
 
@@ -1210,19 +1235,16 @@ Status SwissTableForJoinBuild::PartitionBatch(size_t thread_id, int64_t batch_id
 }
 
 Status SwissTableForJoinBuild::ProcessPartition(
-    size_t thread_id, int64_t batch_id, int prtn_id, const ExecBatch& key_batch,
+    size_t thread_id, int prtn_id, const ExecBatch& key_batch,
     const ExecBatch* payload_batch_maybe_null, arrow::util::TempVectorStack* temp_stack) {
-  DCHECK_LT(thread_id, thread_states_.size());
-  DCHECK_LT(batch_id, static_cast<int64_t>(batch_states_.size()));
   DCHECK_LT(static_cast<size_t>(prtn_id), prtn_states_.size());
   ThreadState& locals = thread_states_[thread_id];
-  BatchState& batch_state = batch_states_[batch_id];
   PartitionState& prtn_state = prtn_states_[prtn_id];
 
   int num_rows_new =
-      batch_state.prtn_ranges[prtn_id + 1] - batch_state.prtn_ranges[prtn_id];
+      locals.prtn_ranges[prtn_id + 1] - locals.prtn_ranges[prtn_id];
   const uint16_t* row_ids =
-      batch_state.prtn_row_ids.data() + batch_state.prtn_ranges[prtn_id];
+      locals.prtn_row_ids.data() + locals.prtn_ranges[prtn_id];
   size_t num_rows_before = prtn_state.key_ids.size();
   // Insert new keys into hash table associated with the current partition
   // and map existing keys to integer ids.
@@ -1231,7 +1253,7 @@ Status SwissTableForJoinBuild::ProcessPartition(
   SwissTableWithKeys::Input input(&key_batch, num_rows_new, row_ids, temp_stack,
                                   &locals.temp_column_arrays, &locals.temp_group_ids);
   RETURN_NOT_OK(prtn_state.keys.MapWithInserts(
-      &input, batch_state.hashes.data(), prtn_state.key_ids.data() + num_rows_before));
+      &input, locals.hashes.data(), prtn_state.key_ids.data() + num_rows_before));
   // Append input batch rows from current partition to an array of payload
   // rows for this partition.
   //
@@ -2219,8 +2241,112 @@ Result<ExecBatch> JoinResidualFilter::MaterializeFilterInput(
   return out;
 }
 
+namespace {
+
+// Calls `visit_fn(row, key)` for the rows of an integer array in the given range,
+// with the values widened to int64_t.
+//
+template <typename CType, typename VISIT_FN>
+void VisitIntegerKeys(const ArraySpan& keys, int64_t start_row, int64_t num_rows,
+                      VISIT_FN visit_fn) {
+  const CType* values = keys.GetValues<CType>(1);
+  for (int64_t i = start_row; i < start_row + num_rows; ++i) {
+    visit_fn(i, static_cast<int64_t>(values[i]));
+  }
+}
+
+template <typename VISIT_FN>
+void VisitIntegerKeys(const ArraySpan& keys, int64_t start_row, int64_t num_rows,
+                      VISIT_FN visit_fn) {
+  switch (keys.type->id()) {
+    case Type::INT8:
+      return VisitIntegerKeys<int8_t>(keys, start_row, num_rows, visit_fn);
+    case Type::INT16:
+      return VisitIntegerKeys<int16_t>(keys, start_row, num_rows, visit_fn);
+    case Type::INT32:
+      return VisitIntegerKeys<int32_t>(keys, start_row, num_rows, visit_fn);
+    case Type::INT64:
+      return VisitIntegerKeys<int64_t>(keys, start_row, num_rows, visit_fn);
+    case Type::UINT8:
+      return VisitIntegerKeys<uint8_t>(keys, start_row, num_rows, visit_fn);
+    case Type::UINT16:
+      return VisitIntegerKeys<uint16_t>(keys, start_row, num_rows, visit_fn);
+    case Type::UINT32:
+      return VisitIntegerKeys<uint32_t>(keys, start_row, num_rows, visit_fn);
+    default:
+      ARROW_DCHECK(false);
+  }
+}
+
+}  // namespace
+
+bool JoinDenseKeySet::IsSupportedType(const DataType& type) {
+  switch (type.id()) {
+    case Type::INT8:
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64:
+    case Type::UINT8:
+    case Type::UINT16:
+    case Type::UINT32:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool JoinDenseKeySet::Init(int64_t hardware_flags, int64_t min_key, int64_t max_key,
+                           int64_t num_rows) {
+  if (num_rows == 0 || min_key > max_key) {
+    return false;
+  }
+  // Computed on unsigned integers, since the difference of two int64 values may
+  // overflow
+  //
+  uint64_t range = static_cast<uint64_t>(max_key) - static_cast<uint64_t>(min_key);
+  if (range >= static_cast<uint64_t>(num_rows * kMaxBitsPerRow)) {
+    return false;
+  }
+  hardware_flags_ = hardware_flags;
+  min_key_ = min_key;
+  num_bits_ = static_cast<int64_t>(range) + 1;
+  bits_ = std::vector<std::atomic<uint64_t>>(bit_util::CeilDiv(num_bits_, 64));
+  return true;
+}
+
+void JoinDenseKeySet::MinMax(const ArraySpan& keys, int64_t* min_key, int64_t* max_key) {
+  VisitIntegerKeys(keys, 0, keys.length, [&](int64_t i, int64_t key) {
+    if (keys.IsValid(i)) {
+      *min_key = std::min(*min_key, key);
+      *max_key = std::max(*max_key, key);
+    }
+  });
+}
+
+void JoinDenseKeySet::Insert(const ArraySpan& keys) {
+  VisitIntegerKeys(keys, 0, keys.length, [&](int64_t i, int64_t key) {
+    if (keys.IsValid(i)) {
+      uint64_t bit = static_cast<uint64_t>(key) - static_cast<uint64_t>(min_key_);
+      bits_[bit / 64].fetch_or(uint64_t{1} << (bit % 64), std::memory_order_relaxed);
+    }
+  });
+}
+
+void JoinDenseKeySet::Lookup(const ArraySpan& keys, int start_row, int num_rows,
+                             uint8_t* match_bitvector) const {
+  std::memset(match_bitvector, 0, bit_util::BytesForBits(num_rows));
+  VisitIntegerKeys(keys, start_row, num_rows, [&](int64_t i, int64_t key) {
+    uint64_t bit = static_cast<uint64_t>(key) - static_cast<uint64_t>(min_key_);
+    if (bit < static_cast<uint64_t>(num_bits_) &&
+        ((bits_[bit / 64].load(std::memory_order_relaxed) >> (bit % 64)) & 1)) {
+      bit_util::SetBit(match_bitvector, i - start_row);
+    }
+  });
+}
+
 void JoinProbeProcessor::Init(int num_key_columns, JoinType join_type,
                               SwissTableForJoin* hash_table,
+                              const JoinDenseKeySet* dense_keys,
                               JoinResidualFilter* residual_filter,
                               std::vector<JoinResultMaterialize*> materialize,
                               const std::vector<JoinKeyCmp>* cmp,
@@ -2228,6 +2354,7 @@ void JoinProbeProcessor::Init(int num_key_columns, JoinType join_type,
   num_key_columns_ = num_key_columns;
   join_type_ = join_type;
   hash_table_ = hash_table;
+  dense_keys_ = dense_keys;
   residual_filter_ = residual_filter;
   materialize_.resize(materialize.size());
   for (size_t i = 0; i < materialize.size(); ++i) {
@@ -2240,7 +2367,12 @@ void JoinProbeProcessor::Init(int num_key_columns, JoinType join_type,
 Status JoinProbeProcessor::OnNextBatch(int64_t thread_id,
                                        const ExecBatch& keypayload_batch,
                                        arrow::util::TempVectorStack* temp_stack,
-                                       std::vector<KeyColumnArray>* temp_column_arrays) {
+                                       std::vector<KeyColumnArray>* temp_column_arrays,
+                                       const uint32_t* hashes) {
+  if (dense_keys_->enabled()) {
+    return OnNextBatchDenseKeys(thread_id, keypayload_batch, temp_stack);
+  }
+
   bool no_duplicate_keys = (hash_table_->key_to_payload() == nullptr);
   const SwissTable* swiss_table = hash_table_->keys()->swiss_table();
   int64_t hardware_flags = swiss_table->hardware_flags();
@@ -2276,8 +2408,14 @@ Status JoinProbeProcessor::OnNextBatch(int64_t thread_id,
     SwissTableWithKeys::Input input(&key_batch, minibatch_start,
                                     minibatch_start + minibatch_size_next, temp_stack,
                                     temp_column_arrays);
-    hash_table_->keys()->Hash(&input, hashes_buf.mutable_data(), hardware_flags);
-    hash_table_->keys()->MapReadOnly(&input, hashes_buf.mutable_data(),
+    const uint32_t* minibatch_hashes;
+    if (hashes != nullptr) {
+      minibatch_hashes = hashes + minibatch_start;
+    } else {
+      hash_table_->keys()->Hash(&input, hashes_buf.mutable_data(), hardware_flags);
+      minibatch_hashes = hashes_buf.mutable_data();
+    }
+    hash_table_->keys()->MapReadOnly(&input, minibatch_hashes,
                                      match_bitvector_buf.mutable_data(),
                                      key_ids_buf.mutable_data());
 
@@ -2405,6 +2543,57 @@ Status JoinProbeProcessor::OnNextBatch(int64_t thread_id,
   return Status::OK();
 }
 
+Status JoinProbeProcessor::OnNextBatchDenseKeys(
+    int64_t thread_id, const ExecBatch& keypayload_batch,
+    arrow::util::TempVectorStack* temp_stack) {
+  DCHECK(join_type_ == JoinType::LEFT_SEMI || join_type_ == JoinType::LEFT_ANTI);
+  DCHECK_EQ(num_key_columns_, 1);
+  constexpr int minibatch_size = arrow::util::MiniBatch::kMiniBatchLength;
+  int num_rows = static_cast<int>(keypayload_batch.length);
+  ArraySpan keys(*keypayload_batch.values[0].array());
+
+  auto match_bitvector_buf = arrow::util::TempVectorHolder<uint8_t>(
+      temp_stack, static_cast<uint32_t>(bit_util::BytesForBits(minibatch_size)));
+  auto passing_batch_ids_buf =
+      arrow::util::TempVectorHolder<uint16_t>(temp_stack, minibatch_size);
+
+  for (int minibatch_start = 0; minibatch_start < num_rows;) {
+    int minibatch_size_next = std::min(minibatch_size, num_rows - minibatch_start);
+
+    dense_keys_->Lookup(keys, minibatch_start, minibatch_size_next,
+                        match_bitvector_buf.mutable_data());
+    bool ignored;
+    JoinNullFilter::Filter(keypayload_batch, minibatch_start, minibatch_size_next, *cmp_,
+                           &ignored,
+                           /*and_with_input=*/true, match_bitvector_buf.mutable_data());
+
+    // The residual filter does not refer to the build side, so it needs no key ids
+    //
+    int num_passing_ids = 0;
+    if (join_type_ == JoinType::LEFT_SEMI) {
+      RETURN_NOT_OK(residual_filter_->FilterLeftSemi(
+          keypayload_batch, minibatch_start, minibatch_size_next,
+          match_bitvector_buf.mutable_data(), /*key_ids=*/NULLPTR,
+          /*no_duplicate_keys=*/true, temp_stack, &num_passing_ids,
+          passing_batch_ids_buf.mutable_data()));
+    } else {
+      RETURN_NOT_OK(residual_filter_->FilterLeftAnti(
+          keypayload_batch, minibatch_start, minibatch_size_next,
+          match_bitvector_buf.mutable_data(), /*key_ids=*/NULLPTR,
+          /*no_duplicate_keys=*/true, temp_stack, &num_passing_ids,
+          passing_batch_ids_buf.mutable_data()));
+    }
+
+    RETURN_NOT_OK(materialize_[thread_id]->AppendProbeOnly(
+        keypayload_batch, num_passing_ids, passing_batch_ids_buf.mutable_data(),
+        [&](ExecBatch batch) { return output_batch_fn_(thread_id, std::move(batch)); }));
+
+    minibatch_start += minibatch_size_next;
+  }
+
+  return Status::OK();
+}
+
 Status JoinProbeProcessor::OnFinished() {
   // Flush all instances of materialize that have non-zero accumulated output
   // rows.
@@ -2418,6 +2607,26 @@ Status JoinProbeProcessor::OnFinished() {
   return Status::OK();
 }
 
+namespace {
+
+std::atomic<int64_t> probe_cluster_cache_size_for_testing{-1};
+
+constexpr int kMaxProbeClusterBits = 10;
+
+}  // namespace
+
+int ChooseProbeClusterBits(int64_t build_side_bytes, int64_t cache_size) {
+  if (cache_size <= 0 || build_side_bytes <= 4 * cache_size) {
+    return 0;
+  }
+  int bits = bit_util::Log2(static_cast<uint64_t>(build_side_bytes / cache_size));
+  return std::min(bits, kMaxProbeClusterBits);
+}
+
+void SetProbeClusterCacheSizeForTesting(int64_t cache_size) {
+  probe_cluster_cache_size_for_testing.store(cache_size);
+}
+
 class SwissJoin : public HashJoinImpl {
  public:
   static constexpr auto kTempStackUsage = 64 * arrow::util::MiniBatch::kMiniBatchLength;
@@ -2479,8 +2688,8 @@ class SwissJoin : public HashJoinImpl {
                           proj_map_right, &hash_table_);
 
     probe_processor_.Init(proj_map_left->num_cols(HashJoinProjection::KEY), join_type_,
-                          &hash_table_, &residual_filter_, materialize, &key_cmp_,
-                          output_batch_callback_);
+                          &hash_table_, &dense_keys_, &residual_filter_, materialize,
+                          &key_cmp_, output_batch_callback_);
 
     InitTaskGroups();
 
@@ -2488,13 +2697,6 @@ class SwissJoin : public HashJoinImpl {
   }
 
   void InitTaskGroups() {
-    task_group_partition_ = register_task_group_callback_(
-        [this](size_t thread_index, int64_t task_id) -> Status {
-          return PartitionTask(thread_index, task_id);
-        },
-        [this](size_t thread_index) -> Status {
-          return PartitionFinished(thread_index);
-        });
     task_group_build_ = register_task_group_callback_(
         [this](size_t thread_index, int64_t task_id) -> Status {
           return BuildTask(thread_index, task_id);
@@ -2520,10 +2722,17 @@ class SwissJoin : public HashJoinImpl {
     ExecBatch keypayload_batch;
     ARROW_ASSIGN_OR_RAISE(keypayload_batch, KeyPayloadFromInput(/*side=*/0, &batch));
     arrow::util::TempVectorStack* temp_stack = &local_states_[thread_index].stack;
+    // The hashes computed to cluster the batch are reused for probing it
+    std::vector<uint32_t> hashes;
+    if (probe_cluster_bits_ > 0) {
+      RETURN_NOT_OK(
+          CancelIfNotOK(ClusterProbeBatch(thread_index, &keypayload_batch, &hashes)));
+    }
 
-    return CancelIfNotOK(
-        probe_processor_.OnNextBatch(thread_index, keypayload_batch, temp_stack,
-                                     &local_states_[thread_index].temp_column_arrays));
+    return CancelIfNotOK(probe_processor_.OnNextBatch(
+        thread_index, keypayload_batch, temp_stack,
+        &local_states_[thread_index].temp_column_arrays,
+        hashes.empty() ? nullptr : hashes.data()));
   }
 
   Status ProbingFinished(size_t thread_index) override {
@@ -2557,6 +2766,15 @@ class SwissJoin : public HashJoinImpl {
 
  private:
   Status StartBuildHashTable(int64_t thread_id) {
+    RETURN_NOT_OK(CancelIfNotOK(InitDenseKeySet()));
+    if (dense_keys_.enabled()) {
+      // The probe side is looked up with a bit test, there are no hashes to cluster on
+      //
+      probe_cluster_bits_ = 0;
+      return CancelIfNotOK(start_task_group_callback_(task_group_build_,
+                                                      build_side_batches_.batch_count()));
+    }
+
     // Initialize build class instance
     //
     const HashJoinProjectionMaps* schema = schema_[1];
@@ -2581,100 +2799,171 @@ class SwissJoin : public HashJoinImpl {
           ColumnMetadataFromDataType(schema->data_type(HashJoinProjection::PAYLOAD, i)));
       payload_types.push_back(metadata);
     }
+    probe_cluster_bits_ =
+        ChooseProbeClusterBits(build_side_batches_.byte_count(), ProbeClusterCacheSize());
+
     hash_table_build_ = std::make_unique<SwissTableForJoinBuild>();
     RETURN_NOT_OK(CancelIfNotOK(hash_table_build_->Init(
         &hash_table_, num_threads_, build_side_batches_.row_count(),
-        build_side_batches_.batch_count(), reject_duplicate_keys, no_payload, key_types,
-        payload_types, pool_, hardware_flags_)));
+        reject_duplicate_keys, no_payload, key_types, payload_types, pool_,
+        hardware_flags_)));
 
-    // Process all input batches
+    // Process all input batches, each task partitioning one batch and inserting it
+    // into the partitions of the hash table
     //
-    return CancelIfNotOK(start_task_group_callback_(task_group_partition_,
+    return CancelIfNotOK(start_task_group_callback_(task_group_build_,
                                                     build_side_batches_.batch_count()));
   }
 
-  Status PartitionTask(size_t thread_id, int64_t batch_id) {
-    if (IsCancelled()) {
+  // Left semi and left anti joins only need to know which keys are on the build side.
+  // A single integer key whose values are dense enough is kept in an exact bit set
+  // instead of the hash table, as long as nulls never match and the residual filter
+  // does not refer to the build side.
+  //
+  Status InitDenseKeySet() {
+    const HashJoinProjectionMaps* schema = schema_[1];
+    if ((join_type_ != JoinType::LEFT_SEMI && join_type_ != JoinType::LEFT_ANTI) ||
+        schema->num_cols(HashJoinProjection::KEY) != 1 ||
+        key_cmp_[0] != JoinKeyCmp::EQ || residual_filter_.NumBuildKeysReferred() > 0 ||
+        residual_filter_.NumBuildPayloadsReferred() > 0 ||
+        !JoinDenseKeySet::IsSupportedType(
+            *schema->data_type(HashJoinProjection::KEY, 0)) ||
+        !JoinDenseKeySet::IsSupportedType(
+            *schema_[0]->data_type(HashJoinProjection::KEY, 0))) {
       return Status::OK();
     }
 
-    DCHECK_GT(build_side_batches_[batch_id].length, 0);
-
-    const HashJoinProjectionMaps* schema = schema_[1];
-    ExecBatch input_batch;
-    ARROW_ASSIGN_OR_RAISE(
-        input_batch, KeyPayloadFromInput(/*side=*/1, &build_side_batches_[batch_id]));
-
-    ExecBatch key_batch({}, input_batch.length);
-    key_batch.values.resize(schema->num_cols(HashJoinProjection::KEY));
-    for (size_t icol = 0; icol < key_batch.values.size(); ++icol) {
-      key_batch.values[icol] = input_batch.values[icol];
+    int64_t min_key = std::numeric_limits<int64_t>::max();
+    int64_t max_key = std::numeric_limits<int64_t>::min();
+    for (size_t batch_id = 0; batch_id < build_side_batches_.batch_count(); ++batch_id) {
+      ARROW_ASSIGN_OR_RAISE(
+          ExecBatch input_batch,
+          KeyPayloadFromInput(/*side=*/1, &build_side_batches_[batch_id]));
+      JoinDenseKeySet::MinMax(ArraySpan(*input_batch.values[0].array()), &min_key,
+                              &max_key);
     }
-    arrow::util::TempVectorStack* temp_stack = &local_states_[thread_id].stack;
-
-    DCHECK_NE(hash_table_build_, nullptr);
-    return hash_table_build_->PartitionBatch(static_cast<int64_t>(thread_id), batch_id,
-                                             key_batch, temp_stack);
+    dense_keys_.Init(hardware_flags_, min_key, max_key, build_side_batches_.row_count());
+    return Status::OK();
   }
 
-  Status PartitionFinished(size_t thread_id) {
-    RETURN_NOT_OK(status());
+  // Radix clustering of the probe side
+  //
+  // Both the blocks of the hash table and its key and payload rows are laid out in
+  // the order of the top bits of the key hashes.  A build side much larger than the
+  // L2 cache makes every lookup of a probe batch in arrival order a cache miss.
+  // Reordering each probe batch by the top bits of its hashes first means that
+  // consecutive lookups touch the same region of the hash table.
+  //
+  // The reordering costs a copy of the probe batch, so it is only used once the build
+  // side is large enough for the cache misses to dominate, see ChooseProbeClusterBits.
+  int64_t ProbeClusterCacheSize() const {
+    int64_t cache_size = probe_cluster_cache_size_for_testing.load();
+    if (cache_size >= 0) {
+      return cache_size;
+    }
+    return ctx_->cpu_info()->CacheSize(::arrow::internal::CpuInfo::CacheLevel::L2);
+  }
+
+  // Reorders the rows of the batch and fills `hashes` with the hashes of their keys in
+  // the new order.  Batches too small to gain from reordering are left untouched and
+  // `hashes` empty.
+  Status ClusterProbeBatch(size_t thread_index, ExecBatch* keypayload_batch,
+                           std::vector<uint32_t>* hashes) {
+    const int num_rows = static_cast<int>(keypayload_batch->length);
+    const int num_clusters = 1 << probe_cluster_bits_;
+    // Small batches gain little locality from being reordered
+    if (num_rows < 4 * num_clusters) {
+      return Status::OK();
+    }
 
-    DCHECK_NE(hash_table_build_, nullptr);
-    return CancelIfNotOK(
-        start_task_group_callback_(task_group_build_, hash_table_build_->num_prtns()));
+    ExecBatch key_batch({}, num_rows);
+    const int num_keys = schema_[0]->num_cols(HashJoinProjection::KEY);
+    key_batch.values.assign(keypayload_batch->values.begin(),
+                            keypayload_batch->values.begin() + num_keys);
+    std::vector<uint32_t> row_hashes(num_rows);
+    const int minibatch_size = hash_table_.keys()->swiss_table()->minibatch_size();
+    for (int start = 0; start < num_rows; start += minibatch_size) {
+      SwissTableWithKeys::Input input(&key_batch, start,
+                                      std::min(start + minibatch_size, num_rows),
+                                      &local_states_[thread_index].stack,
+                                      &local_states_[thread_index].temp_column_arrays);
+      hash_table_.keys()->Hash(&input, row_hashes.data() + start, hardware_flags_);
+    }
+
+    // Counting sort of the row ids on the top bits of their hashes
+    const int shift = SwissTable::bits_hash_ - probe_cluster_bits_;
+    std::vector<int32_t> offsets(num_clusters + 1, 0);
+    for (uint32_t hash : row_hashes) {
+      ++offsets[(hash >> shift) + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> row_ids,
+                          AllocateBuffer(num_rows * sizeof(int32_t), pool_));
+    auto* row_ids_data = row_ids->mutable_data_as<int32_t>();
+    hashes->resize(num_rows);
+    for (int i = 0; i < num_rows; ++i) {
+      int32_t pos = offsets[row_hashes[i] >> shift]++;
+      row_ids_data[pos] = i;
+      (*hashes)[pos] = row_hashes[i];
+    }
+    auto indices = std::make_shared<Int32Array>(num_rows, std::move(row_ids));
+
+    for (Datum& value : keypayload_batch->values) {
+      if (value.is_array()) {
+        ARROW_ASSIGN_OR_RAISE(
+            value, compute::Take(value, indices, compute::TakeOptions::NoBoundsCheck(),
+                                 ctx_->exec_context()));
+      }
+    }
+    return Status::OK();
   }
 
-  Status BuildTask(size_t thread_id, int64_t prtn_id) {
+  Status BuildTask(size_t thread_id, int64_t batch_id) {
     if (IsCancelled()) {
       return Status::OK();
     }
 
+    DCHECK_GT(build_side_batches_[batch_id].length, 0);
+
+    ExecBatch input_batch;
+    ARROW_ASSIGN_OR_RAISE(
+        input_batch, KeyPayloadFromInput(/*side=*/1, &build_side_batches_[batch_id]));
+    if (dense_keys_.enabled()) {
+      dense_keys_.Insert(ArraySpan(*input_batch.values[0].array()));
+      return Status::OK();
+    }
+
     const HashJoinProjectionMaps* schema = schema_[1];
     DCHECK_NE(hash_table_build_, nullptr);
     bool no_payload = hash_table_build_->no_payload();
-    ExecBatch key_batch, payload_batch;
+
+    // Split batch into key batch and optional payload batch
+    //
+    // Input batch is key-payload batch (key columns followed by payload
+    // columns). We split it into two separate batches.
+    //
+    // TODO: Change SwissTableForJoinBuild interface to use key-payload
+    // batch instead to avoid this operation, which involves increasing
+    // shared pointer ref counts.
+    //
     auto num_keys = schema->num_cols(HashJoinProjection::KEY);
-    auto num_payloads = schema->num_cols(HashJoinProjection::PAYLOAD);
+    ExecBatch key_batch({}, input_batch.length);
     key_batch.values.resize(num_keys);
-    if (!no_payload) {
-      payload_batch.values.resize(num_payloads);
+    for (size_t icol = 0; icol < key_batch.values.size(); ++icol) {
+      key_batch.values[icol] = input_batch.values[icol];
     }
-    arrow::util::TempVectorStack* temp_stack = &local_states_[thread_id].stack;
-
-    for (int64_t batch_id = 0;
-         batch_id < static_cast<int64_t>(build_side_batches_.batch_count()); ++batch_id) {
-      ExecBatch input_batch;
-      ARROW_ASSIGN_OR_RAISE(
-          input_batch, KeyPayloadFromInput(/*side=*/1, &build_side_batches_[batch_id]));
-
-      // Split batch into key batch and optional payload batch
-      //
-      // Input batch is key-payload batch (key columns followed by payload
-      // columns). We split it into two separate batches.
-      //
-      // TODO: Change SwissTableForJoinBuild interface to use key-payload
-      // batch instead to avoid this operation, which involves increasing
-      // shared pointer ref counts.
-      //
-      key_batch.length = input_batch.length;
-      for (size_t icol = 0; icol < key_batch.values.size(); ++icol) {
-        key_batch.values[icol] = input_batch.values[icol];
-      }
 
-      if (!no_payload) {
-        payload_batch.length = input_batch.length;
-        for (size_t icol = 0; icol < payload_batch.values.size(); ++icol) {
-          payload_batch.values[icol] = input_batch.values[num_keys + icol];
-        }
+    ExecBatch payload_batch({}, input_batch.length);
+    if (!no_payload) {
+      payload_batch.values.resize(schema->num_cols(HashJoinProjection::PAYLOAD));
+      for (size_t icol = 0; icol < payload_batch.values.size(); ++icol) {
+        payload_batch.values[icol] = input_batch.values[num_keys + icol];
       }
-
-      RETURN_NOT_OK(CancelIfNotOK(hash_table_build_->ProcessPartition(
-          thread_id, batch_id, static_cast<int>(prtn_id), key_batch,
-          no_payload ? nullptr : &payload_batch, temp_stack)));
     }
+    arrow::util::TempVectorStack* temp_stack = &local_states_[thread_id].stack;
 
-    return Status::OK();
+    return CancelIfNotOK(hash_table_build_->PushNextBatch(
+        thread_id, key_batch, no_payload ? nullptr : &payload_batch, temp_stack));
   }
 
   Status BuildFinished(size_t thread_id) {
@@ -2682,6 +2971,10 @@ class SwissJoin : public HashJoinImpl {
 
     build_side_batches_.Clear();
 
+    if (dense_keys_.enabled()) {
+      return CancelIfNotOK(OnBuildHashTableFinished(static_cast<int64_t>(thread_id)));
+    }
+
     // On a single thread prepare for merging partitions of the resulting hash
     // table.
     //
@@ -2713,6 +3006,12 @@ class SwissJoin : public HashJoinImpl {
       return status();
     }
 
+    if (dense_keys_.enabled()) {
+      // Only probe side rows are output and filtered
+      //
+      return build_finished_callback_(thread_id);
+    }
+
     DCHECK_NE(hash_table_build_, nullptr);
     hash_table_build_.reset();
 
@@ -2925,11 +3224,14 @@ class SwissJoin : public HashJoinImpl {
   const HashJoinProjectionMaps* schema_[2];
 
   // Task scheduling
-  int task_group_partition_;
   int task_group_build_;
   int task_group_merge_;
   int task_group_scan_;
 
+  // Number of top hash bits that probe batches are clustered on, 0 if they are probed
+  // in arrival order
+  int probe_cluster_bits_ = 0;
+
   // Callbacks
   RegisterTaskGroupCallback register_task_group_callback_;
   StartTaskGroupCallback start_task_group_callback_;
@@ -2948,6 +3250,8 @@ class SwissJoin : public HashJoinImpl {
   SwissTableForJoin hash_table_;
   JoinProbeProcessor probe_processor_;
   JoinResidualFilter residual_filter_;
+  // Replaces hash_table_ when enabled
+  JoinDenseKeySet dense_keys_;
   // Temporarily used during build phase, and released afterward.
   std::unique_ptr<SwissTableForJoinBuild> hash_table_build_;
   AccumulationQueue build_side_batches_;
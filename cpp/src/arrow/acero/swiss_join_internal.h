@@ -17,7 +17,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <vector>
+
 #include "arrow/acero/options.h"
 #include "arrow/acero/partition_util.h"
 #include "arrow/acero/schema_util.h"
@@ -523,27 +526,23 @@ class SwissTableForJoin {
 //
 class SwissTableForJoinBuild {
  public:
-  Status Init(SwissTableForJoin* target, int dop, int64_t num_rows, int64_t num_batches,
+  Status Init(SwissTableForJoin* target, int dop, int64_t num_rows,
               bool reject_duplicate_keys, bool no_payload,
               const std::vector<KeyColumnMetadata>& key_types,
               const std::vector<KeyColumnMetadata>& payload_types, MemoryPool* pool,
               int64_t hardware_flags);
 
   // In the first phase of parallel hash table build, each thread picks unprocessed exec
-  // batches, hashes the batches and preserve the hashes, then partition the rows based on
-  // hashes.
+  // batches, hashes and partitions their rows, and inserts the rows of every partition
+  // into the hash table of that partition.
   //
-  Status PartitionBatch(size_t thread_id, int64_t batch_id, const ExecBatch& key_batch,
-                        arrow::util::TempVectorStack* temp_stack);
-
-  // In the second phase of parallel hash table build, each thread picks the given
-  // partition of all batches, and updates that particular partition with information
-  // related to that batch of rows.
+  // Threads lock one partition at a time and pick the partitions that no other thread
+  // holds first, so batches are inserted concurrently without waiting for all of them
+  // to be partitioned.
   //
-  Status ProcessPartition(size_t thread_id, int64_t batch_id, int prtn_id,
-                          const ExecBatch& key_batch,
-                          const ExecBatch* payload_batch_maybe_null,
-                          arrow::util::TempVectorStack* temp_stack);
+  Status PushNextBatch(size_t thread_id, const ExecBatch& key_batch,
+                       const ExecBatch* payload_batch_maybe_null,
+                       arrow::util::TempVectorStack* temp_stack);
 
   // Allocate memory and initialize counters required for parallel merging of
   // hash table partitions.
@@ -551,7 +550,7 @@ class SwissTableForJoinBuild {
   //
   Status PreparePrtnMerge();
 
-  // Third phase of parallel hash table build.
+  // Second phase of parallel hash table build.
   // Each partition can be processed by a different thread.
   // Parallel step.
   //
@@ -573,6 +572,18 @@ class SwissTableForJoinBuild {
  private:
   void InitRowArray();
 
+  // Hashes the rows of a batch and sorts their ids on partition
+  //
+  Status PartitionBatch(size_t thread_id, const ExecBatch& key_batch,
+                        arrow::util::TempVectorStack* temp_stack);
+
+  // Inserts the rows of the partitioned batch that belong to the given, locked,
+  // partition
+  //
+  Status ProcessPartition(size_t thread_id, int prtn_id, const ExecBatch& key_batch,
+                          const ExecBatch* payload_batch_maybe_null,
+                          arrow::util::TempVectorStack* temp_stack);
+
   SwissTableForJoin* target_;
   // DOP stands for Degree Of Parallelism - the maximum number of participating
   // threads.
@@ -609,22 +620,6 @@ class SwissTableForJoinBuild {
   MemoryPool* pool_;
   int64_t hardware_flags_;
 
-  // One per batch.
-  //
-  // Informations like hashes and partitions of each batch gathered in the partition phase
-  // and used in the build phase.
-  //
-  struct BatchState {
-    // Hashes for the batch, preserved in the partition phase to avoid recomputation in
-    // the build phase. One element per row in the batch.
-    std::vector<uint32_t> hashes;
-    // Accumulative number of rows in each partition for the batch. `num_prtns_` + 1
-    // elements.
-    std::vector<uint16_t> prtn_ranges;
-    // Row ids after partition sorting the batch. One element per row in the batch.
-    std::vector<uint16_t> prtn_row_ids;
-  };
-
   // One per partition.
   //
   struct PartitionState {
@@ -641,13 +636,22 @@ class SwissTableForJoinBuild {
   // batches.
   //
   struct ThreadState {
+    // Hashes of the rows of the batch being pushed, one element per row
+    std::vector<uint32_t> hashes;
+    // Accumulative number of rows in each partition for the batch being pushed,
+    // `num_prtns_` + 1 elements
+    std::vector<uint16_t> prtn_ranges;
+    // Row ids of the batch being pushed after partition sorting, one element per row
+    std::vector<uint16_t> prtn_row_ids;
+    // Scratch space of PartitionLocks::ForEachPartition, one element per partition
+    std::vector<int> temp_prtn_ids;
     std::vector<uint32_t> temp_group_ids;
     std::vector<KeyColumnArray> temp_column_arrays;
   };
 
-  std::vector<BatchState> batch_states_;
   std::vector<PartitionState> prtn_states_;
   std::vector<ThreadState> thread_states_;
+  PartitionLocks prtn_locks_;
 
   std::vector<int64_t> partition_keys_first_row_id_;
   std::vector<int64_t> partition_payloads_first_row_id_;
@@ -1002,17 +1006,81 @@ class JoinResidualFilter {
 // Implements entire processing of a probe side exec batch,
 // provided the join hash table is already built and available.
 //
+// Exact set of the build side keys of a left semi or left anti join on a single
+// integer key, used instead of the hash table when the key values span a range that
+// is not much larger than the number of build side rows.
+//
+// The set keeps one bit for every value between the smallest and the largest key,
+// so neither the key rows nor the slots of a hash table are stored, and a probe is
+// a single bit test instead of hashing and comparing keys.
+//
+// Null keys are never inserted, so the set only serves EQ key comparisons.
+//
+class JoinDenseKeySet {
+ public:
+  // Bits of the set allowed per build side row
+  static constexpr int64_t kMaxBitsPerRow = 64;
+
+  static bool IsSupportedType(const DataType& type);
+
+  // Enables the set for keys between `min_key` and `max_key` inclusive if the range
+  // is dense enough for `num_rows` build side rows, returns whether it did.
+  //
+  bool Init(int64_t hardware_flags, int64_t min_key, int64_t max_key, int64_t num_rows);
+
+  bool enabled() const { return !bits_.empty(); }
+  int64_t hardware_flags() const { return hardware_flags_; }
+
+  // Updates `min_key` and `max_key` with the non-null values of `keys`
+  //
+  static void MinMax(const ArraySpan& keys, int64_t* min_key, int64_t* max_key);
+
+  // Can be called concurrently from multiple threads
+  //
+  void Insert(const ArraySpan& keys);
+
+  // Sets the bits of `match_bitvector` of the rows of `keys` in the given range that
+  // are in the set. Bits of null rows are unspecified.
+  //
+  void Lookup(const ArraySpan& keys, int start_row, int num_rows,
+              uint8_t* match_bitvector) const;
+
+ private:
+  int64_t hardware_flags_ = 0;
+  int64_t min_key_ = 0;
+  int64_t num_bits_ = 0;
+  std::vector<std::atomic<uint64_t>> bits_;
+};
+
+// Number of top hash bits that SwissJoin clusters probe batches on, given the byte size
+// of the build side and of the cache (normally the L2 cache).  0, meaning that probe
+// batches are probed in arrival order, unless the build side is more than four times
+// the size of the cache.
+//
+ARROW_ACERO_EXPORT int ChooseProbeClusterBits(int64_t build_side_bytes,
+                                              int64_t cache_size);
+
+// Overrides the cache size that SwissJoin passes to ChooseProbeClusterBits, so that
+// tests do not depend on the CPU they run on.  A negative size restores the L2 cache
+// size of the CPU.
+//
+ARROW_ACERO_EXPORT void SetProbeClusterCacheSizeForTesting(int64_t cache_size);
+
 class JoinProbeProcessor {
  public:
   using OutputBatchFn = std::function<Status(int64_t, ExecBatch)>;
 
   void Init(int num_key_columns, JoinType join_type, SwissTableForJoin* hash_table,
-            JoinResidualFilter* residual_filter,
+            const JoinDenseKeySet* dense_keys, JoinResidualFilter* residual_filter,
             std::vector<JoinResultMaterialize*> materialize,
             const std::vector<JoinKeyCmp>* cmp, OutputBatchFn output_batch_fn);
+  // If given, `hashes` holds the hashes of the keys of all rows of the batch, so that
+  // they are not computed again.
+  //
   Status OnNextBatch(int64_t thread_id, const ExecBatch& keypayload_batch,
                      arrow::util::TempVectorStack* temp_stack,
-                     std::vector<KeyColumnArray>* temp_column_arrays);
+                     std::vector<KeyColumnArray>* temp_column_arrays,
+                     const uint32_t* hashes = NULLPTR);
 
   // Must be called by a single-thread having exclusive access to the instance
   // of this class. The caller is responsible for ensuring that.
@@ -1020,10 +1088,16 @@ class JoinProbeProcessor {
   Status OnFinished();
 
  private:
+  // Probes the dense key set instead of the hash table when it is enabled
+  //
+  Status OnNextBatchDenseKeys(int64_t thread_id, const ExecBatch& keypayload_batch,
+                              arrow::util::TempVectorStack* temp_stack);
+
   int num_key_columns_;
   JoinType join_type_;
 
   SwissTableForJoin* hash_table_;
+  const JoinDenseKeySet* dense_keys_;
   JoinResidualFilter* residual_filter_;
   // One element per thread
   //
@@ -0,0 +1,289 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/result.h"
+#include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+using compute::NullPlacement;
+using compute::SelectKOptions;
+using compute::SortKey;
+using compute::SortOrder;
+using compute::TakeOptions;
+
+namespace acero {
+namespace {
+
+// Keeps the first offset + count rows of the ordering without accumulating the input.
+//
+// Each thread collects candidate rows and, once it holds more than twice as many as
+// it needs, reduces them to the best k.  At the end the candidates of all threads are
+// reduced once more and the requested range is emitted.
+//
+// Every row is tagged with its batch index and its position in the batch, which are
+// used as the last sort keys.  Selecting by (ordering, batch, row) is a total order, so
+// the result does not depend on how the rows were split between threads.  Rows with
+// equal keys are kept in input order.  An order_by node keeps them in arrival order
+// instead, so the two only agree on ties when the input arrives in order.  If the
+// input is not sequenced the arrival order of the batches is used.
+class TopKNode : public ExecNode, public TracedNode {
+ public:
+  TopKNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+           std::shared_ptr<Schema> output_schema, Ordering ordering, int64_t offset,
+           int64_t count)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        ordering_(std::move(ordering)),
+        offset_(offset),
+        count_(count),
+        k_(offset + count) {
+    std::vector<std::shared_ptr<Field>> fields = output_schema_->fields();
+    int batch_index = static_cast<int>(fields.size());
+    fields.push_back(field("__topk_batch", int64(), /*nullable=*/false));
+    fields.push_back(field("__topk_row", int64(), /*nullable=*/false));
+    candidate_schema_ = schema(std::move(fields));
+    sort_keys_ = ordering_.sort_keys();
+    sort_keys_.emplace_back(FieldRef(batch_index), SortOrder::Ascending);
+    sort_keys_.emplace_back(FieldRef(batch_index + 1), SortOrder::Ascending);
+    thread_states_.resize(plan_->query_context()->max_concurrency());
+  }
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "TopKNode"));
+
+    const auto& topk_options = checked_cast<const TopKNodeOptions&>(options);
+
+    if (topk_options.ordering.is_implicit() || topk_options.ordering.is_unordered()) {
+      return Status::Invalid("`ordering` must be an explicit non-empty ordering");
+    }
+    if (topk_options.offset < 0) {
+      return Status::Invalid("`offset` must be non-negative");
+    }
+    if (topk_options.count < 0) {
+      return Status::Invalid("`count` must be non-negative");
+    }
+    if (topk_options.count > std::numeric_limits<int64_t>::max() - topk_options.offset) {
+      return Status::Invalid("`offset` + `count` must fit in an int64");
+    }
+
+    std::shared_ptr<Schema> output_schema = inputs[0]->output_schema();
+    return plan->EmplaceNode<TopKNode>(plan, std::move(inputs), std::move(output_schema),
+                                       topk_options.ordering, topk_options.offset,
+                                       topk_options.count);
+  }
+
+  const char* kind_name() const override { return "TopKNode"; }
+
+  const Ordering& ordering() const override { return ordering_; }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    if (counter_.SetTotal(total_batches)) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    DCHECK_EQ(input, inputs_[0]);
+
+    if (k_ > 0 && batch.length > 0) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> candidates,
+                            AddSequenceNumbers(batch));
+      ThreadState& state = thread_states_[plan_->query_context()->GetThreadIndex()];
+      state.num_rows += candidates->num_rows();
+      state.candidates.push_back(std::move(candidates));
+      if (state.num_rows > 2 * k_) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> best,
+                              SelectBest(std::move(state.candidates)));
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> combined,
+                              best->CombineChunksToBatch(pool()));
+        state.num_rows = combined->num_rows();
+        state.candidates = {std::move(combined)};
+      }
+    }
+
+    if (counter_.Increment()) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "ordering=" << ordering_.ToString() << " offset=" << offset_
+       << " count=" << count_;
+    return ss.str();
+  }
+
+ private:
+  struct ThreadState {
+    std::vector<std::shared_ptr<RecordBatch>> candidates;
+    int64_t num_rows = 0;
+  };
+
+  MemoryPool* pool() const { return plan_->query_context()->memory_pool(); }
+
+  Result<std::shared_ptr<RecordBatch>> AddSequenceNumbers(const ExecBatch& batch) {
+    int64_t batch_index = batch.index;
+    if (batch_index == compute::kUnsequencedIndex) {
+      batch_index = next_unsequenced_index_.fetch_add(1);
+    }
+    Int64Builder builder(pool());
+    RETURN_NOT_OK(builder.Resize(batch.length));
+    for (int64_t i = 0; i < batch.length; ++i) {
+      builder.UnsafeAppend(i);
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> rows, builder.Finish());
+    ExecBatch tagged = batch;
+    tagged.values.emplace_back(batch_index);
+    tagged.values.emplace_back(std::move(rows));
+    return tagged.ToRecordBatch(candidate_schema_, pool());
+  }
+
+  // select_k drops rows whose first sort key is null or NaN and places nulls in the
+  // other sort keys at the end.  Where that could change the result use a full sort.
+  Result<bool> CanSelectK(const Table& table) {
+    for (size_t i = 0; i + 1 < sort_keys_.size(); ++i) {
+      if (i > 0 && ordering_.null_placement() == NullPlacement::AtEnd) break;
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ChunkedArray> column,
+                            sort_keys_[i].target.GetOneFlattened(table, pool()));
+      if (column->null_count() > 0 || is_floating(column->type()->id())) return false;
+    }
+    return true;
+  }
+
+  // Return the best k_ candidates, in sorted order
+  Result<std::shared_ptr<Table>> SelectBest(
+      std::vector<std::shared_ptr<RecordBatch>> candidates) {
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Table> table,
+        Table::FromRecordBatches(candidate_schema_, std::move(candidates)));
+    if (table->num_rows() == 0) return table;
+    ExecContext* ctx = plan_->query_context()->exec_context();
+    std::shared_ptr<Array> indices;
+    ARROW_ASSIGN_OR_RAISE(bool can_select_k, CanSelectK(*table));
+    if (can_select_k) {
+      ARROW_ASSIGN_OR_RAISE(
+          indices, SelectKUnstable(table, SelectKOptions(k_, sort_keys_), ctx));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(
+          indices,
+          SortIndices(table, SortOptions(sort_keys_, ordering_.null_placement()), ctx));
+      indices = indices->Slice(0, std::min(k_, indices->length()));
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum best,
+                          Take(table, indices, TakeOptions::NoBoundsCheck(), ctx));
+    return best.table();
+  }
+
+  Status DoFinish() {
+    std::vector<std::shared_ptr<RecordBatch>> candidates;
+    for (ThreadState& state : thread_states_) {
+      for (auto& batch : state.candidates) candidates.push_back(std::move(batch));
+      state.candidates.clear();
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> best,
+                          SelectBest(std::move(candidates)));
+    ARROW_ASSIGN_OR_RAISE(best, best->RemoveColumn(best->num_columns() - 1));
+    ARROW_ASSIGN_OR_RAISE(best, best->RemoveColumn(best->num_columns() - 1));
+    if (offset_ >= best->num_rows()) {
+      return output_->InputFinished(this, 0);
+    }
+    std::shared_ptr<Table> selected = best->Slice(offset_, count_);
+
+    TableBatchReader reader(*selected);
+    reader.set_chunksize(ExecPlan::kMaxBatchSize);
+    int batch_index = 0;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, reader.Next());
+      if (!next) {
+        return output_->InputFinished(this, batch_index);
+      }
+      int index = batch_index++;
+      plan_->query_context()->ScheduleTask(
+          [this, batch = std::move(next), index]() mutable {
+            ExecBatch exec_batch(*batch);
+            exec_batch.index = index;
+            return output_->InputReceived(this, std::move(exec_batch));
+          },
+          "TopKNode::ProcessBatch");
+    }
+  }
+
+  AtomicCounter counter_;
+  Ordering ordering_;
+  int64_t offset_;
+  int64_t count_;
+  int64_t k_;
+  // The output schema plus the batch index and row columns
+  std::shared_ptr<Schema> candidate_schema_;
+  std::vector<SortKey> sort_keys_;
+  std::atomic<int64_t> next_unsequenced_index_{0};
+  std::vector<ThreadState> thread_states_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterTopKNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory(std::string(TopKNodeOptions::kName), TopKNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,169 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/test_nodes.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/expression.h"
+#include "arrow/table.h"
+#include "arrow/testing/generator.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+
+using compute::NullPlacement;
+using compute::SortKey;
+using compute::SortOrder;
+
+namespace acero {
+
+static constexpr int kRowsPerBatch = 16;
+static constexpr int kNumBatches = 32;
+
+// "key" has many duplicates and nulls, "id" is unique
+std::shared_ptr<Table> TestTable(int32_t max_key = 20) {
+  std::shared_ptr<Table> ids =
+      gen::Gen({{"id", gen::Step()}})->FailOnError()->Table(kRowsPerBatch, kNumBatches);
+  random::RandomArrayGenerator rng(/*seed=*/42);
+  std::shared_ptr<Array> keys =
+      rng.Int32(ids->num_rows(), /*min=*/0, max_key, /*null_probability=*/0.2);
+  EXPECT_OK_AND_ASSIGN(std::shared_ptr<Table> table,
+                       ids->AddColumn(0, field("key", int32()),
+                                      std::make_shared<ChunkedArray>(keys)));
+  return table;
+}
+
+std::shared_ptr<Table> SortAndSlice(const std::shared_ptr<Table>& input,
+                                    const Ordering& ordering, int64_t offset,
+                                    int64_t count) {
+  compute::SortOptions sort_options(ordering.sort_keys(), ordering.null_placement());
+  EXPECT_OK_AND_ASSIGN(auto indices, compute::SortIndices(input, sort_options));
+  EXPECT_OK_AND_ASSIGN(Datum sorted, compute::Take(input, indices));
+  return sorted.table()->Slice(offset, count);
+}
+
+void CheckTopK(const Ordering& ordering, int64_t offset, int64_t count,
+               bool use_threads, int32_t max_key = 20) {
+  constexpr random::SeedType kSeed = 42;
+  constexpr int kJitterMod = 4;
+  RegisterTestNodes();
+  std::shared_ptr<Table> input = TestTable(max_key);
+  Declaration plan =
+      Declaration::Sequence({{"table_source", TableSourceNodeOptions(input)},
+                             {"jitter", JitterNodeOptions(kSeed, kJitterMod)},
+                             {"topk", TopKNodeOptions(ordering, offset, count)}});
+  QueryOptions query_options;
+  query_options.sequence_output = true;
+  query_options.use_threads = use_threads;
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                       DeclarationToTable(plan, query_options));
+
+  if (offset >= input->num_rows() || count == 0) {
+    ASSERT_EQ(0, actual->num_rows());
+  } else {
+    AssertTablesEqual(*SortAndSlice(input, ordering, offset, count), *actual,
+                      /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(TopKNode, Basic) {
+  for (NullPlacement null_placement : {NullPlacement::AtEnd, NullPlacement::AtStart}) {
+    for (SortOrder order : {SortOrder::Ascending, SortOrder::Descending}) {
+      // The unique second key makes the result independent of the input order
+      Ordering ordering({SortKey("key", order), SortKey("id")}, null_placement);
+      for (bool use_threads : {false, true}) {
+        ARROW_SCOPED_TRACE("use_threads=", use_threads, " ordering=",
+                           ordering.ToString());
+        CheckTopK(ordering, 0, 10, use_threads);
+        CheckTopK(ordering, 20, 50, use_threads);
+        CheckTopK(ordering, 0, 1000, use_threads);
+        CheckTopK(ordering, 1000, 10, use_threads);
+        CheckTopK(ordering, 5, 0, use_threads);
+      }
+    }
+  }
+}
+
+TEST(TopKNode, TiesKeepInputOrder) {
+  // Rows with equal keys are emitted in input order, even when the batches arrive out
+  // of order or on different threads
+  for (NullPlacement null_placement : {NullPlacement::AtEnd, NullPlacement::AtStart}) {
+    Ordering ordering({SortKey("key")}, null_placement);
+    for (bool use_threads : {false, true}) {
+      ARROW_SCOPED_TRACE("use_threads=", use_threads, " ordering=",
+                         ordering.ToString());
+      CheckTopK(ordering, 0, 10, use_threads);
+      CheckTopK(ordering, 30, 100, use_threads);
+      // Only 3 distinct keys, so every fetch boundary falls inside a run of ties and
+      // the candidates of the threads have to be reduced across equal keys
+      CheckTopK(ordering, 0, 10, use_threads, /*max_key=*/2);
+      CheckTopK(ordering, 37, 101, use_threads, /*max_key=*/2);
+      CheckTopK(ordering, 150, 200, use_threads, /*max_key=*/2);
+    }
+  }
+}
+
+TEST(TopKNode, FusesOrderByAndFetch) {
+  std::shared_ptr<Table> input = TestTable();
+  Ordering ordering({SortKey("key", SortOrder::Descending), SortKey("id")});
+  Declaration plan =
+      Declaration::Sequence({{"table_source", TableSourceNodeOptions(input)},
+                             {"order_by", OrderByNodeOptions(ordering)},
+                             {"fetch", FetchNodeOptions(10, 20)}});
+  ASSERT_OK_AND_ASSIGN(std::string plan_str, DeclarationToString(plan));
+  ASSERT_THAT(plan_str, testing::HasSubstr("TopKNode"));
+  ASSERT_THAT(plan_str, testing::Not(testing::HasSubstr("OrderByNode")));
+
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual, DeclarationToTable(plan));
+  AssertTablesEqual(*SortAndSlice(input, ordering, 10, 20), *actual,
+                    /*same_chunk_layout=*/false);
+}
+
+TEST(TopKNode, OnlyFusesAdjacentOrderByAndFetch) {
+  Ordering ordering({SortKey("key"), SortKey("id")});
+  Declaration plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(TestTable())},
+       {"order_by", OrderByNodeOptions(ordering)},
+       {"project", ProjectNodeOptions({compute::field_ref("id")}, {"id"})},
+       {"fetch", FetchNodeOptions(10, 20)}});
+  ASSERT_OK_AND_ASSIGN(std::string plan_str, DeclarationToString(plan));
+  ASSERT_THAT(plan_str, testing::HasSubstr("OrderByNode"));
+  ASSERT_THAT(plan_str, testing::HasSubstr("FetchNode"));
+  ASSERT_THAT(plan_str, testing::Not(testing::HasSubstr("TopKNode")));
+}
+
+TEST(TopKNode, Invalid) {
+  auto check_invalid = [](TopKNodeOptions options, const std::string& message) {
+    Declaration plan = Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(TestTable())}, {"topk", options}});
+    EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, testing::HasSubstr(message),
+                                    DeclarationToStatus(std::move(plan)));
+  };
+  check_invalid({Ordering::Unordered(), 0, 10}, "`ordering` must be an explicit");
+  check_invalid({Ordering::Implicit(), 0, 10}, "`ordering` must be an explicit");
+  check_invalid({Ordering({SortKey("id")}), -1, 10}, "`offset` must be non-negative");
+  check_invalid({Ordering({SortKey("id")}), 0, -1}, "`count` must be non-negative");
+}
+
+}  // namespace acero
+}  // namespace arrow
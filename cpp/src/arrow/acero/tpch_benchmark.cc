@@ -15,115 +15,970 @@
 // specific language governing permissions and limitations
 // under the License.
 
+// Runs the 22 TPC-H queries as Acero declarations over tables generated by TpchGen.
+//
+// The tables are generated once per scale factor, outside of the timed region, and
+// their fixed size binary columns are converted to trimmed strings so that queries
+// compare them against plain string literals.  Correlated subqueries are rewritten
+// as joins against aggregates, and EXISTS / IN subqueries as semi and anti joins.
+//
+// Every benchmark reports the peak memory allocated by the query and the number of
+// result rows.  The scale factors default to 1 and can be set with a comma separated
+// list in the ACERO_TPCH_SCALE_FACTORS environment variable.  If the
+// ACERO_TPCH_NODE_STATS environment variable is set, every query is run once more
+// with node statistics and the analyzed plan is printed to stderr.
+
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
-#include "arrow/acero/test_util_internal.h"
 #include "arrow/acero/tpch_node.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
-#include "arrow/testing/future_util.h"
-
-#include <memory>
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/string.h"
+#include "arrow/vendored/datetime.h"
 
 namespace arrow {
 
+using compute::and_;
 using compute::call;
-using compute::CountOptions;
 using compute::field_ref;
-using compute::ScalarAggregateOptions;
+using compute::or_;
 using compute::SortKey;
+using compute::SortOrder;
 
 namespace acero {
 namespace internal {
 
-std::shared_ptr<ExecPlan> Plan_Q1(AsyncGenerator<std::optional<ExecBatch>>* sink_gen,
-                                  int scale_factor) {
-  std::shared_ptr<ExecPlan> plan = *ExecPlan::Make();
-  std::unique_ptr<TpchGen> gen =
-      *TpchGen::Make(plan.get(), static_cast<double>(scale_factor));
-
-  ExecNode* lineitem =
-      *gen->Lineitem({"L_QUANTITY", "L_EXTENDEDPRICE", "L_TAX", "L_DISCOUNT",
-                      "L_SHIPDATE", "L_RETURNFLAG", "L_LINESTATUS"});
-
-  auto sept_2_1998 = std::make_shared<Date32Scalar>(
-      10471);  // September 2, 1998 is 10471 days after January 1, 1970
-  Expression filter =
-      less_equal(field_ref("L_SHIPDATE"), literal(std::move(sept_2_1998)));
-  FilterNodeOptions filter_opts(filter);
-
-  Expression l_returnflag = field_ref("L_RETURNFLAG");
-  Expression l_linestatus = field_ref("L_LINESTATUS");
-  Expression quantity = field_ref("L_QUANTITY");
-  Expression base_price = field_ref("L_EXTENDEDPRICE");
-
-  std::shared_ptr<Decimal128Scalar> decimal_1 =
-      std::make_shared<Decimal128Scalar>(Decimal128{0, 100}, decimal128(12, 2));
-  Expression discount_multiplier =
-      call("subtract", {literal(decimal_1), field_ref("L_DISCOUNT")});
-  Expression tax_multiplier = call("add", {literal(decimal_1), field_ref("L_TAX")});
-  Expression disc_price =
-      call("multiply", {field_ref("L_EXTENDEDPRICE"), discount_multiplier});
-  Expression charge =
-      call("multiply",
-           {call("cast",
-                 {call("multiply", {field_ref("L_EXTENDEDPRICE"), discount_multiplier})},
-                 compute::CastOptions::Unsafe(decimal128(12, 2))),
-            tax_multiplier});
-  Expression discount = field_ref("L_DISCOUNT");
-
-  std::vector<Expression> projection_list = {l_returnflag, l_linestatus, quantity,
-                                             base_price,   disc_price,   charge,
-                                             quantity,     base_price,   discount};
-  std::vector<std::string> project_names = {
-      "l_returnflag", "l_linestatus", "sum_qty",   "sum_base_price", "sum_disc_price",
-      "sum_charge",   "avg_qty",      "avg_price", "avg_disc"};
-  ProjectNodeOptions project_opts(std::move(projection_list), std::move(project_names));
-
-  auto sum_opts =
-      std::make_shared<ScalarAggregateOptions>(ScalarAggregateOptions::Defaults());
-  auto count_opts = std::make_shared<CountOptions>(CountOptions::CountMode::ALL);
-  std::vector<arrow::compute::Aggregate> aggs = {
-      {"hash_sum", sum_opts, "sum_qty", "sum_qty"},
-      {"hash_sum", sum_opts, "sum_base_price", "sum_base_price"},
-      {"hash_sum", sum_opts, "sum_disc_price", "sum_disc_price"},
-      {"hash_sum", sum_opts, "sum_charge", "sum_charge"},
-      {"hash_mean", sum_opts, "avg_qty", "avg_qty"},
-      {"hash_mean", sum_opts, "avg_price", "avg_price"},
-      {"hash_mean", sum_opts, "avg_disc", "avg_disc"},
-      {"hash_count", count_opts, "sum_qty", "count_order"}};
-
-  std::vector<FieldRef> keys = {"l_returnflag", "l_linestatus"};
-  AggregateNodeOptions agg_opts(aggs, keys);
-
-  SortKey l_returnflag_key("l_returnflag");
-  SortKey l_linestatus_key("l_linestatus");
-  SortOptions sort_opts({l_returnflag_key, l_linestatus_key});
-  OrderBySinkNodeOptions order_by_opts(sort_opts, sink_gen);
-
-  Declaration filter_decl("filter", {Declaration::Input(lineitem)}, filter_opts);
-  Declaration project_decl("project", project_opts);
-  Declaration aggregate_decl("aggregate", agg_opts);
-  Declaration orderby_decl("order_by_sink", order_by_opts);
-
-  Declaration q1 =
-      Declaration::Sequence({filter_decl, project_decl, aggregate_decl, orderby_decl});
-  std::ignore = *q1.AddToPlan(plan.get());
-  return plan;
-}
-
-static void BM_Tpch_Q1(benchmark::State& st) {
+namespace {
+
+using Tables = std::unordered_map<std::string, std::shared_ptr<Table>>;
+
+// Lower cases the column names and converts fixed size binary columns, which TpchGen
+// pads with zeros, to strings
+Result<std::shared_ptr<Table>> NormalizeTable(const Table& table) {
+  compute::TrimOptions padding(std::string("\0 ", 2));
+  FieldVector fields;
+  ChunkedArrayVector columns;
+  for (int i = 0; i < table.num_columns(); ++i) {
+    Datum column = table.column(i);
+    if (column.type()->id() == Type::FIXED_SIZE_BINARY) {
+      ARROW_ASSIGN_OR_RAISE(column, compute::Cast(column, utf8()));
+      ARROW_ASSIGN_OR_RAISE(column,
+                            compute::CallFunction("ascii_rtrim", {column}, &padding));
+    }
+    fields.push_back(field(::arrow::internal::AsciiToLower(table.field(i)->name()),
+                           column.type()));
+    columns.push_back(column.chunked_array());
+  }
+  return Table::Make(schema(std::move(fields)), std::move(columns));
+}
+
+Result<Tables> GenerateTables(int scale_factor) {
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ExecPlan> plan, ExecPlan::Make());
+  ARROW_ASSIGN_OR_RAISE(std::unique_ptr<TpchGen> gen,
+                        TpchGen::Make(plan.get(), static_cast<double>(scale_factor)));
+  std::vector<std::pair<std::string, Result<ExecNode*>>> sources;
+  sources.emplace_back("lineitem", gen->Lineitem());
+  sources.emplace_back("orders", gen->Orders());
+  sources.emplace_back("customer", gen->Customer());
+  sources.emplace_back("part", gen->Part());
+  sources.emplace_back("partsupp", gen->PartSupp());
+  sources.emplace_back("supplier", gen->Supplier());
+  sources.emplace_back("nation", gen->Nation());
+  sources.emplace_back("region", gen->Region());
+
+  std::vector<std::shared_ptr<Table>> generated(sources.size());
+  for (size_t i = 0; i < sources.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(ExecNode * source, sources[i].second);
+    Declaration sink("table_sink", {Declaration::Input(source)},
+                     TableSinkNodeOptions(&generated[i]));
+    RETURN_NOT_OK(sink.AddToPlan(plan.get()).status());
+  }
+  plan->StartProducing();
+  RETURN_NOT_OK(plan->finished().status());
+
+  Tables tables;
+  for (size_t i = 0; i < sources.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(tables[sources[i].first], NormalizeTable(*generated[i]));
+  }
+  return tables;
+}
+
+const Tables& GetTables(int scale_factor) {
+  static std::map<int, Tables> tables_by_scale_factor;
+  auto it = tables_by_scale_factor.find(scale_factor);
+  if (it == tables_by_scale_factor.end()) {
+    it = tables_by_scale_factor.emplace(scale_factor, *GenerateTables(scale_factor))
+             .first;
+  }
+  return it->second;
+}
+
+Declaration Scan(const Tables& tables, const std::string& name,
+                 std::vector<std::string> columns) {
+  std::vector<Expression> fields;
+  for (const auto& column : columns) {
+    fields.push_back(field_ref(column));
+  }
+  return Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(tables.at(name), ExecPlan::kMaxBatchSize)},
+       {"project", ProjectNodeOptions(std::move(fields), std::move(columns))}});
+}
+
+Declaration Filter(Declaration input, Expression predicate) {
+  return Declaration("filter", {std::move(input)},
+                     FilterNodeOptions(std::move(predicate)));
+}
+
+Declaration Project(Declaration input, std::vector<Expression> expressions,
+                    std::vector<std::string> names) {
+  return Declaration("project", {std::move(input)},
+                     ProjectNodeOptions(std::move(expressions), std::move(names)));
+}
+
+Declaration Join(JoinType join_type, Declaration left, Declaration right,
+                 std::vector<FieldRef> left_keys, std::vector<FieldRef> right_keys,
+                 Expression filter = literal(true)) {
+  return Declaration("hashjoin", {std::move(left), std::move(right)},
+                     HashJoinNodeOptions(join_type, std::move(left_keys),
+                                         std::move(right_keys), std::move(filter)));
+}
+
+Declaration Aggregate(Declaration input, std::vector<compute::Aggregate> aggregates,
+                      std::vector<FieldRef> keys = {}) {
+  return Declaration("aggregate", {std::move(input)},
+                     AggregateNodeOptions(std::move(aggregates), std::move(keys)));
+}
+
+Declaration OrderBy(Declaration input, std::vector<SortKey> sort_keys) {
+  return Declaration("order_by", {std::move(input)},
+                     OrderByNodeOptions(Ordering(std::move(sort_keys))));
+}
+
+Declaration Limit(Declaration input, int64_t count) {
+  return Declaration("fetch", {std::move(input)}, FetchNodeOptions(0, count));
+}
+
+SortKey Desc(FieldRef target) {
+  return SortKey(std::move(target), SortOrder::Descending);
+}
+
+Expression Date(int year, unsigned month, unsigned day) {
+  namespace date = arrow_vendored::date;
+  const date::sys_days days{
+      date::year_month_day{date::year{year}, date::month{month}, date::day{day}}};
+  return literal(std::make_shared<Date32Scalar>(
+      static_cast<int32_t>(days.time_since_epoch().count())));
+}
+
+// A literal of the decimal type of prices, quantities and discounts
+Expression Money(int64_t cents) {
+  return literal(
+      std::make_shared<Decimal128Scalar>(Decimal128(cents), decimal128(12, 2)));
+}
+
+Expression Between(const std::string& name, Expression low, Expression high) {
+  return and_(greater_equal(field_ref(name), std::move(low)),
+              less_equal(field_ref(name), std::move(high)));
+}
+
+// The half-open interval [low, high)
+Expression InRange(const std::string& name, Expression low, Expression high) {
+  return and_(greater_equal(field_ref(name), std::move(low)),
+              less(field_ref(name), std::move(high)));
+}
+
+Expression IsIn(const std::string& name, std::shared_ptr<DataType> type,
+                const std::string& json) {
+  return call("is_in", {field_ref(name)},
+              compute::SetLookupOptions(ArrayFromJSON(std::move(type), json)));
+}
+
+Expression Like(const std::string& name, std::string pattern) {
+  return call("match_like", {field_ref(name)},
+              compute::MatchSubstringOptions(std::move(pattern)));
+}
+
+Expression StartsWith(const std::string& name, std::string prefix) {
+  return call("starts_with", {field_ref(name)},
+              compute::MatchSubstringOptions(std::move(prefix)));
+}
+
+Expression ToDouble(Expression value) {
+  return call("cast", {std::move(value)}, compute::CastOptions::Safe(float64()));
+}
+
+Expression Year(const std::string& name) { return call("year", {field_ref(name)}); }
+
+// l_extendedprice * (1 - l_discount)
+Expression Revenue() {
+  return call("multiply", {field_ref("l_extendedprice"),
+                           call("subtract", {Money(100), field_ref("l_discount")})});
+}
+
+// Nations of a region, with columns n_nationkey, n_name and n_regionkey
+Declaration RegionNations(const Tables& t, const char* region) {
+  return Join(JoinType::LEFT_SEMI,
+              Scan(t, "nation", {"n_nationkey", "n_name", "n_regionkey"}),
+              Filter(Scan(t, "region", {"r_regionkey", "r_name"}),
+                     equal(field_ref("r_name"), literal(region))),
+              {"n_regionkey"}, {"r_regionkey"});
+}
+
+Declaration Q01(const Tables& t, int) {
+  Declaration lineitem =
+      Filter(Scan(t, "lineitem",
+                  {"l_quantity", "l_extendedprice", "l_discount", "l_tax", "l_returnflag",
+                   "l_linestatus", "l_shipdate"}),
+             less_equal(field_ref("l_shipdate"), Date(1998, 9, 2)));
+  Expression charge = call(
+      "multiply",
+      {call("cast", {Revenue()}, compute::CastOptions::Unsafe(decimal128(12, 2))),
+       call("add", {Money(100), field_ref("l_tax")})});
+  Declaration items =
+      Project(std::move(lineitem),
+              {field_ref("l_returnflag"), field_ref("l_linestatus"),
+               field_ref("l_quantity"), field_ref("l_extendedprice"), Revenue(),
+               std::move(charge), field_ref("l_discount")},
+              {"l_returnflag", "l_linestatus", "l_quantity", "l_extendedprice",
+               "disc_price", "charge", "l_discount"});
+  Declaration summary =
+      Aggregate(std::move(items),
+                {{"hash_sum", "l_quantity", "sum_qty"},
+                 {"hash_sum", "l_extendedprice", "sum_base_price"},
+                 {"hash_sum", "disc_price", "sum_disc_price"},
+                 {"hash_sum", "charge", "sum_charge"},
+                 {"hash_mean", "l_quantity", "avg_qty"},
+                 {"hash_mean", "l_extendedprice", "avg_price"},
+                 {"hash_mean", "l_discount", "avg_disc"},
+                 {"hash_count_all", "count_order"}},
+                {"l_returnflag", "l_linestatus"});
+  return OrderBy(std::move(summary), {SortKey("l_returnflag"), SortKey("l_linestatus")});
+}
+
+// Supply costs of suppliers in EUROPE, with the supplier and nation columns
+Declaration EuropeanSupplyCosts(const Tables& t, std::vector<std::string> columns) {
+  columns.push_back("s_suppkey");
+  columns.push_back("s_nationkey");
+  Declaration suppliers =
+      Join(JoinType::INNER, Scan(t, "supplier", std::move(columns)),
+           RegionNations(t, "EUROPE"), {"s_nationkey"}, {"n_nationkey"});
+  return Join(JoinType::INNER,
+              Scan(t, "partsupp", {"ps_partkey", "ps_suppkey", "ps_supplycost"}),
+              std::move(suppliers), {"ps_suppkey"}, {"s_suppkey"});
+}
+
+Declaration Q02(const Tables& t, int) {
+  Declaration min_costs = Project(
+      Aggregate(EuropeanSupplyCosts(t, {}),
+                {{"hash_min", "ps_supplycost", "min_supplycost"}}, {"ps_partkey"}),
+      {field_ref("ps_partkey"), field_ref("min_supplycost")},
+      {"min_partkey", "min_supplycost"});
+  Declaration parts =
+      Filter(Scan(t, "part", {"p_partkey", "p_mfgr", "p_size", "p_type"}),
+             and_(equal(field_ref("p_size"), literal(15)),
+                  call("ends_with", {field_ref("p_type")},
+                       compute::MatchSubstringOptions("BRASS"))));
+  Declaration candidates = Join(
+      JoinType::INNER,
+      EuropeanSupplyCosts(t,
+                          {"s_acctbal", "s_name", "s_address", "s_phone", "s_comment"}),
+      std::move(parts), {"ps_partkey"}, {"p_partkey"});
+  Declaration cheapest =
+      Join(JoinType::LEFT_SEMI, std::move(candidates), std::move(min_costs),
+           {"ps_partkey", "ps_supplycost"}, {"min_partkey", "min_supplycost"});
+  Declaration result =
+      Project(std::move(cheapest),
+              {field_ref("s_acctbal"), field_ref("s_name"), field_ref("n_name"),
+               field_ref("p_partkey"), field_ref("p_mfgr"), field_ref("s_address"),
+               field_ref("s_phone"), field_ref("s_comment")},
+              {"s_acctbal", "s_name", "n_name", "p_partkey", "p_mfgr", "s_address",
+               "s_phone", "s_comment"});
+  return Limit(OrderBy(std::move(result), {Desc("s_acctbal"), SortKey("n_name"),
+                                           SortKey("s_name"), SortKey("p_partkey")}),
+               100);
+}
+
+Declaration Q03(const Tables& t, int) {
+  Declaration customers =
+      Filter(Scan(t, "customer", {"c_custkey", "c_mktsegment"}),
+             equal(field_ref("c_mktsegment"), literal("BUILDING")));
+  Declaration orders = Join(
+      JoinType::LEFT_SEMI,
+      Filter(Scan(t, "orders",
+                  {"o_orderkey", "o_custkey", "o_orderdate", "o_shippriority"}),
+             less(field_ref("o_orderdate"), Date(1995, 3, 15))),
+      std::move(customers), {"o_custkey"}, {"c_custkey"});
+  Declaration lineitem =
+      Filter(Scan(t, "lineitem",
+                  {"l_orderkey", "l_extendedprice", "l_discount", "l_shipdate"}),
+             greater(field_ref("l_shipdate"), Date(1995, 3, 15)));
+  Declaration items = Project(
+      Join(JoinType::INNER, std::move(lineitem), std::move(orders), {"l_orderkey"},
+           {"o_orderkey"}),
+      {field_ref("l_orderkey"), field_ref("o_orderdate"), field_ref("o_shippriority"),
+       Revenue()},
+      {"l_orderkey", "o_orderdate", "o_shippriority", "revenue"});
+  Declaration revenue = Project(
+      Aggregate(std::move(items), {{"hash_sum", "revenue", "revenue"}},
+                {"l_orderkey", "o_orderdate", "o_shippriority"}),
+      {field_ref("l_orderkey"), field_ref("revenue"), field_ref("o_orderdate"),
+       field_ref("o_shippriority")},
+      {"l_orderkey", "revenue", "o_orderdate", "o_shippriority"});
+  return Limit(OrderBy(std::move(revenue), {Desc("revenue"), SortKey("o_orderdate")}),
+               10);
+}
+
+Declaration Q04(const Tables& t, int) {
+  Declaration orders =
+      Filter(Scan(t, "orders", {"o_orderkey", "o_orderdate", "o_orderpriority"}),
+             InRange("o_orderdate", Date(1993, 7, 1), Date(1993, 10, 1)));
+  Declaration late =
+      Filter(Scan(t, "lineitem", {"l_orderkey", "l_commitdate", "l_receiptdate"}),
+             less(field_ref("l_commitdate"), field_ref("l_receiptdate")));
+  // The filtered orders are smaller than the late line items, so they are the build
+  // side of the semi join
+  Declaration late_orders = Join(JoinType::RIGHT_SEMI, std::move(late), std::move(orders),
+                                 {"l_orderkey"}, {"o_orderkey"});
+  return OrderBy(Aggregate(std::move(late_orders), {{"hash_count_all", "order_count"}},
+                           {"o_orderpriority"}),
+                 {SortKey("o_orderpriority")});
+}
+
+Declaration Q05(const Tables& t, int) {
+  Declaration suppliers =
+      Join(JoinType::INNER, Scan(t, "supplier", {"s_suppkey", "s_nationkey"}),
+           RegionNations(t, "ASIA"), {"s_nationkey"}, {"n_nationkey"});
+  Declaration orders =
+      Join(JoinType::INNER,
+           Filter(Scan(t, "orders", {"o_orderkey", "o_custkey", "o_orderdate"}),
+                  InRange("o_orderdate", Date(1994, 1, 1), Date(1995, 1, 1))),
+           Scan(t, "customer", {"c_custkey", "c_nationkey"}), {"o_custkey"},
+           {"c_custkey"});
+  Declaration lineitem =
+      Join(JoinType::INNER,
+           Scan(t, "lineitem",
+                {"l_orderkey", "l_suppkey", "l_extendedprice", "l_discount"}),
+           std::move(orders), {"l_orderkey"}, {"o_orderkey"});
+  Declaration local =
+      Join(JoinType::INNER, std::move(lineitem), std::move(suppliers),
+           {"l_suppkey", "c_nationkey"}, {"s_suppkey", "s_nationkey"});
+  Declaration revenue =
+      Aggregate(Project(std::move(local), {field_ref("n_name"), Revenue()},
+                        {"n_name", "revenue"}),
+                {{"hash_sum", "revenue", "revenue"}}, {"n_name"});
+  return OrderBy(std::move(revenue), {Desc("revenue")});
+}
+
+Declaration Q06(const Tables& t, int) {
+  Declaration lineitem = Filter(
+      Scan(t, "lineitem", {"l_quantity", "l_extendedprice", "l_discount", "l_shipdate"}),
+      and_({InRange("l_shipdate", Date(1994, 1, 1), Date(1995, 1, 1)),
+            Between("l_discount", Money(5), Money(7)),
+            less(field_ref("l_quantity"), Money(2400))}));
+  return Aggregate(
+      Project(std::move(lineitem),
+              {call("multiply", {field_ref("l_extendedprice"), field_ref("l_discount")})},
+              {"revenue"}),
+      {{"sum", "revenue", "revenue"}});
+}
+
+// Nations named FRANCE or GERMANY
+Declaration FranceAndGermany(const Tables& t) {
+  return Filter(Scan(t, "nation", {"n_nationkey", "n_name"}),
+                IsIn("n_name", utf8(), R"(["FRANCE", "GERMANY"])"));
+}
+
+Declaration Q07(const Tables& t, int) {
+  Declaration suppliers =
+      Project(Join(JoinType::INNER, Scan(t, "supplier", {"s_suppkey", "s_nationkey"}),
+                   FranceAndGermany(t), {"s_nationkey"}, {"n_nationkey"}),
+              {field_ref("s_suppkey"), field_ref("n_name")},
+              {"s_suppkey", "supp_nation"});
+  Declaration customers =
+      Project(Join(JoinType::INNER, Scan(t, "customer", {"c_custkey", "c_nationkey"}),
+                   FranceAndGermany(t), {"c_nationkey"}, {"n_nationkey"}),
+              {field_ref("c_custkey"), field_ref("n_name")},
+              {"c_custkey", "cust_nation"});
+  Declaration orders =
+      Join(JoinType::INNER, Scan(t, "orders", {"o_orderkey", "o_custkey"}),
+           std::move(customers), {"o_custkey"}, {"c_custkey"});
+  Declaration lineitem = Join(
+      JoinType::INNER,
+      Filter(Scan(t, "lineitem",
+                  {"l_orderkey", "l_suppkey", "l_extendedprice", "l_discount",
+                   "l_shipdate"}),
+             Between("l_shipdate", Date(1995, 1, 1), Date(1996, 12, 31))),
+      std::move(suppliers), {"l_suppkey"}, {"s_suppkey"});
+  // Both nations are FRANCE or GERMANY, so they are one of each when they differ
+  Declaration shipping = Filter(
+      Join(JoinType::INNER, std::move(lineitem), std::move(orders), {"l_orderkey"},
+           {"o_orderkey"}),
+      not_equal(field_ref("supp_nation"), field_ref("cust_nation")));
+  Declaration volumes = Project(
+      std::move(shipping),
+      {field_ref("supp_nation"), field_ref("cust_nation"), Year("l_shipdate"), Revenue()},
+      {"supp_nation", "cust_nation", "l_year", "volume"});
+  return OrderBy(Aggregate(std::move(volumes), {{"hash_sum", "volume", "revenue"}},
+                           {"supp_nation", "cust_nation", "l_year"}),
+                 {SortKey("supp_nation"), SortKey("cust_nation"), SortKey("l_year")});
+}
+
+Declaration Q08(const Tables& t, int) {
+  Declaration customers =
+      Join(JoinType::LEFT_SEMI, Scan(t, "customer", {"c_custkey", "c_nationkey"}),
+           RegionNations(t, "AMERICA"), {"c_nationkey"}, {"n_nationkey"});
+  Declaration orders =
+      Join(JoinType::LEFT_SEMI,
+           Filter(Scan(t, "orders", {"o_orderkey", "o_custkey", "o_orderdate"}),
+                  Between("o_orderdate", Date(1995, 1, 1), Date(1996, 12, 31))),
+           std::move(customers), {"o_custkey"}, {"c_custkey"});
+  Declaration parts =
+      Filter(Scan(t, "part", {"p_partkey", "p_type"}),
+             equal(field_ref("p_type"), literal("ECONOMY ANODIZED STEEL")));
+  Declaration suppliers =
+      Join(JoinType::INNER, Scan(t, "supplier", {"s_suppkey", "s_nationkey"}),
+           Scan(t, "nation", {"n_nationkey", "n_name"}), {"s_nationkey"},
+           {"n_nationkey"});
+  Declaration lineitem = Join(JoinType::LEFT_SEMI,
+                              Scan(t, "lineitem",
+                                   {"l_orderkey", "l_partkey", "l_suppkey",
+                                    "l_extendedprice", "l_discount"}),
+                              std::move(parts), {"l_partkey"}, {"p_partkey"});
+  Declaration joined = Join(
+      JoinType::INNER,
+      Join(JoinType::INNER, std::move(lineitem), std::move(orders), {"l_orderkey"},
+           {"o_orderkey"}),
+      std::move(suppliers), {"l_suppkey"}, {"s_suppkey"});
+  Expression volume = ToDouble(Revenue());
+  Declaration volumes = Project(
+      std::move(joined),
+      {Year("o_orderdate"), volume,
+       call("if_else",
+            {equal(field_ref("n_name"), literal("BRAZIL")), volume, literal(0.0)})},
+      {"o_year", "volume", "brazil_volume"});
+  Declaration totals = Aggregate(std::move(volumes),
+                                 {{"hash_sum", "volume", "volume"},
+                                  {"hash_sum", "brazil_volume", "brazil_volume"}},
+                                 {"o_year"});
+  return OrderBy(
+      Project(std::move(totals),
+              {field_ref("o_year"),
+               call("divide", {field_ref("brazil_volume"), field_ref("volume")})},
+              {"o_year", "mkt_share"}),
+      {SortKey("o_year")});
+}
+
+Declaration Q09(const Tables& t, int) {
+  Declaration green =
+      Filter(Scan(t, "part", {"p_partkey", "p_name"}),
+             call("match_substring", {field_ref("p_name")},
+                  compute::MatchSubstringOptions("green")));
+  Declaration partsupp =
+      Join(JoinType::LEFT_SEMI,
+           Scan(t, "partsupp", {"ps_partkey", "ps_suppkey", "ps_supplycost"}),
+           std::move(green), {"ps_partkey"}, {"p_partkey"});
+  Declaration suppliers =
+      Join(JoinType::INNER, Scan(t, "supplier", {"s_suppkey", "s_nationkey"}),
+           Scan(t, "nation", {"n_nationkey", "n_name"}), {"s_nationkey"},
+           {"n_nationkey"});
+  Declaration lineitem = Join(
+      JoinType::INNER,
+      Join(JoinType::INNER,
+           Scan(t, "lineitem",
+                {"l_orderkey", "l_partkey", "l_suppkey", "l_quantity", "l_extendedprice",
+                 "l_discount"}),
+           std::move(partsupp), {"l_partkey", "l_suppkey"}, {"ps_partkey", "ps_suppkey"}),
+      std::move(suppliers), {"l_suppkey"}, {"s_suppkey"});
+  // The line items of green parts are fewer than the orders, so they are the build side
+  Declaration joined =
+      Join(JoinType::INNER, Scan(t, "orders", {"o_orderkey", "o_orderdate"}),
+           std::move(lineitem), {"o_orderkey"}, {"l_orderkey"});
+  Expression amount = call(
+      "subtract", {Revenue(), call("multiply", {field_ref("ps_supplycost"),
+                                                field_ref("l_quantity")})});
+  Declaration profits =
+      Project(std::move(joined), {field_ref("n_name"), Year("o_orderdate"), amount},
+              {"nation", "o_year", "amount"});
+  return OrderBy(Aggregate(std::move(profits), {{"hash_sum", "amount", "sum_profit"}},
+                           {"nation", "o_year"}),
+                 {SortKey("nation"), Desc("o_year")});
+}
+
+Declaration Q10(const Tables& t, int) {
+  Declaration orders =
+      Filter(Scan(t, "orders", {"o_orderkey", "o_custkey", "o_orderdate"}),
+             InRange("o_orderdate", Date(1993, 10, 1), Date(1994, 1, 1)));
+  Declaration returned = Filter(
+      Scan(t, "lineitem",
+           {"l_orderkey", "l_extendedprice", "l_discount", "l_returnflag"}),
+      equal(field_ref("l_returnflag"), literal("R")));
+  // The customer determines the other grouped columns, so the revenue is aggregated
+  // before joining the customer details
+  Declaration revenue = Aggregate(
+      Project(Join(JoinType::INNER, std::move(returned), std::move(orders),
+                   {"l_orderkey"}, {"o_orderkey"}),
+              {field_ref("o_custkey"), Revenue()}, {"o_custkey", "revenue"}),
+      {{"hash_sum", "revenue", "revenue"}}, {"o_custkey"});
+  Declaration customers = Join(
+      JoinType::INNER,
+      Scan(t, "customer",
+           {"c_custkey", "c_name", "c_address", "c_nationkey", "c_phone", "c_acctbal",
+            "c_comment"}),
+      Scan(t, "nation", {"n_nationkey", "n_name"}), {"c_nationkey"}, {"n_nationkey"});
+  Declaration result = Project(
+      Join(JoinType::INNER, std::move(customers), std::move(revenue), {"c_custkey"},
+           {"o_custkey"}),
+      {field_ref("c_custkey"), field_ref("c_name"), field_ref("revenue"),
+       field_ref("c_acctbal"), field_ref("n_name"), field_ref("c_address"),
+       field_ref("c_phone"), field_ref("c_comment")},
+      {"c_custkey", "c_name", "revenue", "c_acctbal", "n_name", "c_address", "c_phone",
+       "c_comment"});
+  return Limit(OrderBy(std::move(result), {Desc("revenue")}), 20);
+}
+
+// ps_partkey and the stock value of every part supplied from GERMANY
+Declaration GermanStockValues(const Tables& t) {
+  Declaration suppliers = Join(
+      JoinType::LEFT_SEMI, Scan(t, "supplier", {"s_suppkey", "s_nationkey"}),
+      Filter(Scan(t, "nation", {"n_nationkey", "n_name"}),
+             equal(field_ref("n_name"), literal("GERMANY"))),
+      {"s_nationkey"}, {"n_nationkey"});
+  Declaration partsupp = Join(
+      JoinType::LEFT_SEMI,
+      Scan(t, "partsupp", {"ps_partkey", "ps_suppkey", "ps_availqty", "ps_supplycost"}),
+      std::move(suppliers), {"ps_suppkey"}, {"s_suppkey"});
+  Expression availqty = call("cast", {field_ref("ps_availqty")},
+                             compute::CastOptions::Safe(decimal128(10, 0)));
+  return Project(std::move(partsupp),
+                 {field_ref("ps_partkey"),
+                  call("multiply", {field_ref("ps_supplycost"), std::move(availqty)})},
+                 {"ps_partkey", "value"});
+}
+
+Declaration Q11(const Tables& t, int scale_factor) {
+  Declaration values = Project(
+      Aggregate(GermanStockValues(t), {{"hash_sum", "value", "value"}}, {"ps_partkey"}),
+      {field_ref("ps_partkey"), field_ref("value"), ToDouble(field_ref("value")),
+       literal(1)},
+      {"ps_partkey", "value", "value_double", "join_key"});
+  Declaration threshold = Project(
+      Aggregate(GermanStockValues(t), {{"sum", "value", "total_value"}}),
+      {call("multiply", {ToDouble(field_ref("total_value")),
+                         literal(0.0001 / static_cast<double>(scale_factor))}),
+       literal(1)},
+      {"threshold", "threshold_key"});
+  Declaration important =
+      Join(JoinType::INNER, std::move(values), std::move(threshold), {"join_key"},
+           {"threshold_key"}, greater(field_ref("value_double"), field_ref("threshold")));
+  return OrderBy(Project(std::move(important),
+                         {field_ref("ps_partkey"), field_ref("value")},
+                         {"ps_partkey", "value"}),
+                 {Desc("value")});
+}
+
+Declaration Q12(const Tables& t, int) {
+  Declaration lineitem = Filter(
+      Scan(t, "lineitem",
+           {"l_orderkey", "l_shipdate", "l_commitdate", "l_receiptdate", "l_shipmode"}),
+      and_({IsIn("l_shipmode", utf8(), R"(["MAIL", "SHIP"])"),
+            less(field_ref("l_commitdate"), field_ref("l_receiptdate")),
+            less(field_ref("l_shipdate"), field_ref("l_commitdate")),
+            InRange("l_receiptdate", Date(1994, 1, 1), Date(1995, 1, 1))}));
+  Declaration joined =
+      Join(JoinType::INNER, Scan(t, "orders", {"o_orderkey", "o_orderpriority"}),
+           std::move(lineitem), {"o_orderkey"}, {"l_orderkey"});
+  Expression high = IsIn("o_orderpriority", utf8(), R"(["1-URGENT", "2-HIGH"])");
+  Declaration lines = Project(
+      std::move(joined),
+      {field_ref("l_shipmode"),
+       call("cast", {high}, compute::CastOptions::Safe(int64())),
+       call("cast", {not_(high)}, compute::CastOptions::Safe(int64()))},
+      {"l_shipmode", "high_line", "low_line"});
+  return OrderBy(Aggregate(std::move(lines),
+                           {{"hash_sum", "high_line", "high_line_count"},
+                            {"hash_sum", "low_line", "low_line_count"}},
+                           {"l_shipmode"}),
+                 {SortKey("l_shipmode")});
+}
+
+Declaration Q13(const Tables& t, int) {
+  Declaration orders = Filter(Scan(t, "orders", {"o_orderkey", "o_custkey", "o_comment"}),
+                              not_(Like("o_comment", "%special%requests%")));
+  Declaration counts = Aggregate(
+      Join(JoinType::LEFT_OUTER, Scan(t, "customer", {"c_custkey"}), std::move(orders),
+           {"c_custkey"}, {"o_custkey"}),
+      {{"hash_count", "o_orderkey", "c_count"}}, {"c_custkey"});
+  return OrderBy(
+      Aggregate(std::move(counts), {{"hash_count_all", "custdist"}}, {"c_count"}),
+      {Desc("custdist"), Desc("c_count")});
+}
+
+Declaration Q14(const Tables& t, int) {
+  Declaration lineitem = Filter(
+      Scan(t, "lineitem", {"l_partkey", "l_extendedprice", "l_discount", "l_shipdate"}),
+      InRange("l_shipdate", Date(1995, 9, 1), Date(1995, 10, 1)));
+  Declaration joined = Join(JoinType::INNER, std::move(lineitem),
+                            Scan(t, "part", {"p_partkey", "p_type"}), {"l_partkey"},
+                            {"p_partkey"});
+  Expression volume = ToDouble(Revenue());
+  Declaration volumes = Project(
+      std::move(joined),
+      {call("if_else", {StartsWith("p_type", "PROMO"), volume, literal(0.0)}), volume},
+      {"promo_volume", "volume"});
+  Declaration totals = Aggregate(
+      std::move(volumes),
+      {{"sum", "promo_volume", "promo_volume"}, {"sum", "volume", "volume"}});
+  return Project(
+      std::move(totals),
+      {call("multiply", {literal(100.0), call("divide", {field_ref("promo_volume"),
+                                                         field_ref("volume")})})},
+      {"promo_revenue"});
+}
+
+// The revenue0 view: supplier_no and total_revenue of the first quarter of 1996
+Declaration SupplierRevenue(const Tables& t) {
+  Declaration lineitem = Filter(
+      Scan(t, "lineitem", {"l_suppkey", "l_extendedprice", "l_discount", "l_shipdate"}),
+      InRange("l_shipdate", Date(1996, 1, 1), Date(1996, 4, 1)));
+  return Aggregate(Project(std::move(lineitem), {field_ref("l_suppkey"), Revenue()},
+                           {"supplier_no", "revenue"}),
+                   {{"hash_sum", "revenue", "total_revenue"}}, {"supplier_no"});
+}
+
+Declaration Q15(const Tables& t, int) {
+  Declaration top = Join(
+      JoinType::LEFT_SEMI, SupplierRevenue(t),
+      Aggregate(SupplierRevenue(t), {{"max", "total_revenue", "max_revenue"}}),
+      {"total_revenue"}, {"max_revenue"});
+  Declaration joined = Join(
+      JoinType::INNER,
+      Scan(t, "supplier", {"s_suppkey", "s_name", "s_address", "s_phone"}),
+      std::move(top), {"s_suppkey"}, {"supplier_no"});
+  return OrderBy(Project(std::move(joined),
+                         {field_ref("s_suppkey"), field_ref("s_name"),
+                          field_ref("s_address"), field_ref("s_phone"),
+                          field_ref("total_revenue")},
+                         {"s_suppkey", "s_name", "s_address", "s_phone",
+                          "total_revenue"}),
+                 {SortKey("s_suppkey")});
+}
+
+Declaration Q16(const Tables& t, int) {
+  Declaration parts = Filter(
+      Scan(t, "part", {"p_partkey", "p_brand", "p_type", "p_size"}),
+      and_({not_equal(field_ref("p_brand"), literal("Brand#45")),
+            not_(StartsWith("p_type", "MEDIUM POLISHED")),
+            IsIn("p_size", int32(), "[49, 14, 23, 45, 19, 3, 36, 9]")}));
+  Declaration complaints = Filter(Scan(t, "supplier", {"s_suppkey", "s_comment"}),
+                                  Like("s_comment", "%Customer%Complaints%"));
+  Declaration partsupp =
+      Join(JoinType::LEFT_ANTI, Scan(t, "partsupp", {"ps_partkey", "ps_suppkey"}),
+           std::move(complaints), {"ps_suppkey"}, {"s_suppkey"});
+  Declaration joined = Join(JoinType::INNER, std::move(partsupp), std::move(parts),
+                            {"ps_partkey"}, {"p_partkey"});
+  return OrderBy(Aggregate(std::move(joined),
+                           {{"hash_count_distinct", "ps_suppkey", "supplier_cnt"}},
+                           {"p_brand", "p_type", "p_size"}),
+                 {Desc("supplier_cnt"), SortKey("p_brand"), SortKey("p_type"),
+                  SortKey("p_size")});
+}
+
+// Line items of Brand#23 parts in MED BOX containers
+Declaration MediumBoxLineitems(const Tables& t) {
+  Declaration parts = Filter(Scan(t, "part", {"p_partkey", "p_brand", "p_container"}),
+                             and_(equal(field_ref("p_brand"), literal("Brand#23")),
+                                  equal(field_ref("p_container"), literal("MED BOX"))));
+  return Project(Join(JoinType::LEFT_SEMI,
+                      Scan(t, "lineitem", {"l_partkey", "l_quantity", "l_extendedprice"}),
+                      std::move(parts), {"l_partkey"}, {"p_partkey"}),
+                 {field_ref("l_partkey"), ToDouble(field_ref("l_quantity")),
+                  field_ref("l_extendedprice")},
+                 {"l_partkey", "quantity", "l_extendedprice"});
+}
+
+Declaration Q17(const Tables& t, int) {
+  Declaration thresholds = Project(
+      Aggregate(MediumBoxLineitems(t), {{"hash_mean", "quantity", "avg_quantity"}},
+                {"l_partkey"}),
+      {field_ref("l_partkey"),
+       call("multiply", {literal(0.2), field_ref("avg_quantity")})},
+      {"threshold_partkey", "max_quantity"});
+  Declaration small =
+      Join(JoinType::INNER, MediumBoxLineitems(t), std::move(thresholds), {"l_partkey"},
+           {"threshold_partkey"}, less(field_ref("quantity"), field_ref("max_quantity")));
+  return Project(Aggregate(std::move(small), {{"sum", "l_extendedprice", "total_price"}}),
+                 {call("divide", {ToDouble(field_ref("total_price")), literal(7.0)})},
+                 {"avg_yearly"});
+}
+
+Declaration Q18(const Tables& t, int) {
+  Declaration large = Filter(
+      Aggregate(Scan(t, "lineitem", {"l_orderkey", "l_quantity"}),
+                {{"hash_sum", "l_quantity", "sum_quantity"}}, {"l_orderkey"}),
+      greater(field_ref("sum_quantity"), Money(30000)));
+  // The quantity summed over all line items of an order is the one of the large order,
+  // so the line items aren't joined again
+  Declaration orders = Join(
+      JoinType::INNER,
+      Scan(t, "orders", {"o_orderkey", "o_custkey", "o_orderdate", "o_totalprice"}),
+      std::move(large), {"o_orderkey"}, {"l_orderkey"});
+  Declaration joined = Join(JoinType::INNER, std::move(orders),
+                            Scan(t, "customer", {"c_custkey", "c_name"}), {"o_custkey"},
+                            {"c_custkey"});
+  Declaration result =
+      Project(std::move(joined),
+              {field_ref("c_name"), field_ref("c_custkey"), field_ref("o_orderkey"),
+               field_ref("o_orderdate"), field_ref("o_totalprice"),
+               field_ref("sum_quantity")},
+              {"c_name", "c_custkey", "o_orderkey", "o_orderdate", "o_totalprice",
+               "sum_quantity"});
+  return Limit(OrderBy(std::move(result), {Desc("o_totalprice"), SortKey("o_orderdate")}),
+               100);
+}
+
+Expression DiscountedPartBracket(const char* brand, const std::string& containers,
+                                 int64_t min_quantity, int32_t max_size) {
+  return and_({equal(field_ref("p_brand"), literal(brand)),
+               IsIn("p_container", utf8(), containers),
+               Between("l_quantity", Money(min_quantity * 100),
+                       Money((min_quantity + 10) * 100)),
+               less_equal(field_ref("p_size"), literal(max_size))});
+}
+
+Declaration Q19(const Tables& t, int) {
+  Declaration lineitem = Filter(
+      Scan(t, "lineitem",
+           {"l_partkey", "l_quantity", "l_extendedprice", "l_discount", "l_shipinstruct",
+            "l_shipmode"}),
+      and_({IsIn("l_shipmode", utf8(), R"(["AIR", "AIR REG"])"),
+            equal(field_ref("l_shipinstruct"), literal("DELIVER IN PERSON")),
+            Between("l_quantity", Money(100), Money(3000))}));
+  Declaration parts =
+      Filter(Scan(t, "part", {"p_partkey", "p_brand", "p_size", "p_container"}),
+             and_(IsIn("p_brand", utf8(), R"(["Brand#12", "Brand#23", "Brand#34"])"),
+                  Between("p_size", literal(1), literal(15))));
+  Expression brackets = or_(
+      {DiscountedPartBracket("Brand#12", R"(["SM CASE", "SM BOX", "SM PACK", "SM PKG"])",
+                             1, 5),
+       DiscountedPartBracket("Brand#23",
+                             R"(["MED BAG", "MED BOX", "MED PKG", "MED PACK"])", 10, 10),
+       DiscountedPartBracket("Brand#34", R"(["LG CASE", "LG BOX", "LG PACK", "LG PKG"])",
+                             20, 15)});
+  Declaration joined = Join(JoinType::INNER, std::move(lineitem), std::move(parts),
+                            {"l_partkey"}, {"p_partkey"}, std::move(brackets));
+  return Aggregate(Project(std::move(joined), {Revenue()}, {"revenue"}),
+                   {{"sum", "revenue", "revenue"}});
+}
+
+Declaration ForestParts(const Tables& t) {
+  return Filter(Scan(t, "part", {"p_partkey", "p_name"}), StartsWith("p_name", "forest"));
+}
+
+Declaration Q20(const Tables& t, int) {
+  Declaration shipped = Project(
+      Aggregate(Join(JoinType::LEFT_SEMI,
+                     Filter(Scan(t, "lineitem",
+                                 {"l_partkey", "l_suppkey", "l_quantity", "l_shipdate"}),
+                            InRange("l_shipdate", Date(1994, 1, 1), Date(1995, 1, 1))),
+                     ForestParts(t), {"l_partkey"}, {"p_partkey"}),
+                {{"hash_sum", "l_quantity", "sum_quantity"}}, {"l_partkey", "l_suppkey"}),
+      {field_ref("l_partkey"), field_ref("l_suppkey"),
+       call("multiply", {literal(0.5), ToDouble(field_ref("sum_quantity"))})},
+      {"shipped_partkey", "shipped_suppkey", "half_quantity"});
+  Declaration partsupp = Project(
+      Join(JoinType::LEFT_SEMI,
+           Scan(t, "partsupp", {"ps_partkey", "ps_suppkey", "ps_availqty"}),
+           ForestParts(t), {"ps_partkey"}, {"p_partkey"}),
+      {field_ref("ps_partkey"), field_ref("ps_suppkey"),
+       ToDouble(field_ref("ps_availqty"))},
+      {"ps_partkey", "ps_suppkey", "availqty"});
+  // Without shipped line items the correlated sum is null and the comparison false,
+  // which an inner join matches
+  Declaration excess =
+      Join(JoinType::INNER, std::move(partsupp), std::move(shipped),
+           {"ps_partkey", "ps_suppkey"}, {"shipped_partkey", "shipped_suppkey"},
+           greater(field_ref("availqty"), field_ref("half_quantity")));
+  Declaration suppliers = Join(
+      JoinType::LEFT_SEMI,
+      Scan(t, "supplier", {"s_suppkey", "s_name", "s_address", "s_nationkey"}),
+      Filter(Scan(t, "nation", {"n_nationkey", "n_name"}),
+             equal(field_ref("n_name"), literal("CANADA"))),
+      {"s_nationkey"}, {"n_nationkey"});
+  Declaration promoted = Join(JoinType::LEFT_SEMI, std::move(suppliers),
+                              std::move(excess), {"s_suppkey"}, {"ps_suppkey"});
+  return OrderBy(Project(std::move(promoted),
+                         {field_ref("s_name"), field_ref("s_address")},
+                         {"s_name", "s_address"}),
+                 {SortKey("s_name")});
+}
+
+// Line items received after their commit date
+Declaration LateLineitems(const Tables& t) {
+  return Filter(
+      Scan(t, "lineitem", {"l_orderkey", "l_suppkey", "l_receiptdate", "l_commitdate"}),
+      greater(field_ref("l_receiptdate"), field_ref("l_commitdate")));
+}
+
+Declaration Q21(const Tables& t, int) {
+  Declaration suppliers = Join(
+      JoinType::LEFT_SEMI, Scan(t, "supplier", {"s_suppkey", "s_name", "s_nationkey"}),
+      Filter(Scan(t, "nation", {"n_nationkey", "n_name"}),
+             equal(field_ref("n_name"), literal("SAUDI ARABIA"))),
+      {"s_nationkey"}, {"n_nationkey"});
+  Declaration l1 = Join(JoinType::INNER, LateLineitems(t), std::move(suppliers),
+                        {"l_suppkey"}, {"s_suppkey"});
+  // The late line items of the suppliers are the smaller side of every join below, so
+  // they are the build side and the joins keep right rows
+  l1 = Join(JoinType::RIGHT_SEMI,
+            Filter(Scan(t, "orders", {"o_orderkey", "o_orderstatus"}),
+                   equal(field_ref("o_orderstatus"), literal("F"))),
+            std::move(l1), {"o_orderkey"}, {"l_orderkey"});
+  Declaration l2 = Project(Scan(t, "lineitem", {"l_orderkey", "l_suppkey"}),
+                           {field_ref("l_orderkey"), field_ref("l_suppkey")},
+                           {"l2_orderkey", "l2_suppkey"});
+  l1 = Join(JoinType::RIGHT_SEMI, std::move(l2), std::move(l1), {"l2_orderkey"},
+            {"l_orderkey"}, not_equal(field_ref("l2_suppkey"), field_ref("l_suppkey")));
+  Declaration l3 =
+      Project(LateLineitems(t), {field_ref("l_orderkey"), field_ref("l_suppkey")},
+              {"l3_orderkey", "l3_suppkey"});
+  l1 = Join(JoinType::RIGHT_ANTI, std::move(l3), std::move(l1), {"l3_orderkey"},
+            {"l_orderkey"}, not_equal(field_ref("l3_suppkey"), field_ref("l_suppkey")));
+  return Limit(
+      OrderBy(Aggregate(std::move(l1), {{"hash_count_all", "numwait"}}, {"s_name"}),
+              {Desc("numwait"), SortKey("s_name")}),
+      100);
+}
+
+// Customers whose phone number starts with one of the country codes of Q22
+Declaration CountryCodeCustomers(const Tables& t) {
+  Declaration customers = Project(
+      Scan(t, "customer", {"c_custkey", "c_phone", "c_acctbal"}),
+      {field_ref("c_custkey"),
+       call("utf8_slice_codeunits", {field_ref("c_phone")}, compute::SliceOptions(0, 2)),
+       field_ref("c_acctbal")},
+      {"c_custkey", "cntrycode", "c_acctbal"});
+  return Filter(std::move(customers),
+                IsIn("cntrycode", utf8(),
+                     R"(["13", "31", "23", "29", "30", "18", "17"])"));
+}
+
+Declaration Q22(const Tables& t, int) {
+  Declaration average = Project(
+      Aggregate(Filter(CountryCodeCustomers(t),
+                       greater(field_ref("c_acctbal"), Money(0))),
+                {{"mean", "c_acctbal", "avg_acctbal"}}),
+      {field_ref("avg_acctbal"), literal(1)}, {"avg_acctbal", "avg_key"});
+  Declaration customers = Join(
+      JoinType::INNER,
+      Project(CountryCodeCustomers(t),
+              {field_ref("c_custkey"), field_ref("cntrycode"), field_ref("c_acctbal"),
+               literal(1)},
+              {"c_custkey", "cntrycode", "c_acctbal", "join_key"}),
+      std::move(average), {"join_key"}, {"avg_key"},
+      greater(field_ref("c_acctbal"), field_ref("avg_acctbal")));
+  // The customers are fewer than the orders, so they are the build side of the anti join
+  Declaration idle = Join(JoinType::RIGHT_ANTI, Scan(t, "orders", {"o_custkey"}),
+                          std::move(customers), {"o_custkey"}, {"c_custkey"});
+  return OrderBy(Aggregate(std::move(idle),
+                           {{"hash_count_all", "numcust"},
+                            {"hash_sum", "c_acctbal", "totacctbal"}},
+                           {"cntrycode"}),
+                 {SortKey("cntrycode")});
+}
+
+using MakeQuery = Declaration (*)(const Tables&, int);
+
+void BM_Tpch(benchmark::State& st, MakeQuery make_query, const char* query_name) {
+  const int scale_factor = static_cast<int>(st.range(0));
+  const Tables& tables = GetTables(scale_factor);
+  int64_t peak_memory = 0;
+  int64_t num_rows = 0;
   for (auto _ : st) {
     st.PauseTiming();
-    AsyncGenerator<std::optional<ExecBatch>> sink_gen;
-    std::shared_ptr<ExecPlan> plan = Plan_Q1(&sink_gen, static_cast<int>(st.range(0)));
+    Declaration query = make_query(tables, scale_factor);
+    ProxyMemoryPool pool(default_memory_pool());
+    QueryOptions query_options;
+    query_options.memory_pool = &pool;
     st.ResumeTiming();
-    auto fut = StartAndCollect(plan.get(), sink_gen);
-    auto res = *fut.MoveResult();
+    auto result = DeclarationToTable(std::move(query), std::move(query_options));
+    if (!result.ok()) {
+      st.SkipWithError(result.status().ToString().c_str());
+      return;
+    }
+    peak_memory = std::max(peak_memory, pool.max_memory());
+    num_rows = (*result)->num_rows();
+  }
+  st.counters["peak_memory"] = static_cast<double>(peak_memory);
+  st.counters["rows"] = static_cast<double>(num_rows);
+
+  if (::arrow::internal::GetEnvVar("ACERO_TPCH_NODE_STATS").ok()) {
+    auto explained = DeclarationToExplainAnalyze(make_query(tables, scale_factor));
+    std::cerr << query_name << " at scale factor " << scale_factor << ":\n"
+              << (explained.ok() ? *explained : explained.status().ToString())
+              << std::endl;
   }
 }
 
-BENCHMARK(BM_Tpch_Q1)->Args({1})->ArgNames({"ScaleFactor"});
+void ScaleFactorArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"ScaleFactor"});
+  auto scale_factors = ::arrow::internal::GetEnvVar("ACERO_TPCH_SCALE_FACTORS");
+  if (!scale_factors.ok()) {
+    bench->Arg(1);
+    return;
+  }
+  for (std::string_view scale_factor :
+       ::arrow::internal::SplitString(*scale_factors, ',')) {
+    bench->Arg(std::stoi(std::string(scale_factor)));
+  }
+}
+
+}  // namespace
+
+#define TPCH_BENCHMARK(QUERY)                      \
+  BENCHMARK_CAPTURE(BM_Tpch, QUERY, QUERY, #QUERY) \
+      ->Apply(ScaleFactorArgs)                     \
+      ->Unit(benchmark::kMillisecond)              \
+      ->UseRealTime()
+
+TPCH_BENCHMARK(Q01);
+TPCH_BENCHMARK(Q02);
+TPCH_BENCHMARK(Q03);
+TPCH_BENCHMARK(Q04);
+TPCH_BENCHMARK(Q05);
+TPCH_BENCHMARK(Q06);
+TPCH_BENCHMARK(Q07);
+TPCH_BENCHMARK(Q08);
+TPCH_BENCHMARK(Q09);
+TPCH_BENCHMARK(Q10);
+TPCH_BENCHMARK(Q11);
+TPCH_BENCHMARK(Q12);
+TPCH_BENCHMARK(Q13);
+TPCH_BENCHMARK(Q14);
+TPCH_BENCHMARK(Q15);
+TPCH_BENCHMARK(Q16);
+TPCH_BENCHMARK(Q17);
+TPCH_BENCHMARK(Q18);
+TPCH_BENCHMARK(Q19);
+TPCH_BENCHMARK(Q20);
+TPCH_BENCHMARK(Q21);
+TPCH_BENCHMARK(Q22);
+
+#undef TPCH_BENCHMARK
+
 }  // namespace internal
 }  // namespace acero
 }  // namespace arrow
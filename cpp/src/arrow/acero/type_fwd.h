@@ -31,6 +31,8 @@ class QueryContext;
 struct QueryOptions;
 struct Declaration;
 class SinkNodeConsumer;
+class NodeStatisticsCollector;
+class ExpressionCompiler;
 
 }  // namespace acero
 }  // namespace arrow
@@ -77,7 +77,7 @@ class UnionNode : public ExecNode, public TracedNode {
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    NoteInputReceived(batch);
+    NoteInputReceived(batch, input);
     ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
 
     if (inputs_.size() > 1) {
@@ -17,7 +17,12 @@
 
 #include "arrow/acero/util.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "arrow/acero/exec_plan.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/table.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
@@ -44,6 +49,22 @@ Status ValidateExecNodeInputs(ExecPlan* plan, const std::vector<ExecNode*>& inpu
   return Status::OK();
 }
 
+Status ValidateBoundExpression(const Expression& expr, const Schema& schema) {
+  if (const Expression::Parameter* param = expr.parameter()) {
+    const FieldPath path(std::vector<int>(param->indices.begin(), param->indices.end()));
+    auto maybe_field = path.Get(schema);
+    if (!maybe_field.ok() || !(*maybe_field)->type()->Equals(*param->type)) {
+      return Status::TypeError("Expression ", expr.ToString(),
+                               " was bound to another schema than ", schema.ToString());
+    }
+  } else if (const Expression::Call* call = expr.call()) {
+    for (const Expression& argument : call->arguments) {
+      RETURN_NOT_OK(ValidateBoundExpression(argument, schema));
+    }
+  }
+  return Status::OK();
+}
+
 Result<std::shared_ptr<Table>> TableFromExecBatches(
     const std::shared_ptr<Schema>& schema, const std::vector<ExecBatch>& exec_batches) {
   RecordBatchVector batches;
@@ -96,13 +117,222 @@ Future<> TableSinkNodeConsumer::Finish() {
   return Status::OK();
 }
 
-[[nodiscard]] ::arrow::internal::tracing::Scope TracedNode::TraceStartProducing(
-    std::string extra_details) const {
+namespace {
+
+int64_t NowNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// The innermost open scope of the current thread which collects statistics
+thread_local TracedScope* current_traced_scope = nullptr;
+
+}  // namespace
+
+MorselBatcher::MorselBatcher(std::optional<int64_t> morsel_size, bool adaptive,
+                             MemoryPool* pool)
+    : max_size_(std::clamp<int64_t>(morsel_size.value_or(ExecPlan::kMaxBatchSize), 1,
+                                    ExecPlan::kMaxBatchSize)),
+      coalesce_(morsel_size.has_value() || adaptive),
+      adaptive_(adaptive),
+      pool_(pool) {}
+
+int64_t MorselBatcher::target_size() const {
+  if (!adaptive_) {
+    return max_size_;
+  }
+  std::lock_guard<std::mutex> lock(cost_mutex_);
+  if (cost_rows_ < kMinMorselSize || cost_nanos_ <= 0) {
+    return max_size_;
+  }
+  const double rows = kTargetMorselNanos * cost_rows_ / cost_nanos_;
+  if (rows >= static_cast<double>(max_size_)) {
+    return max_size_;
+  }
+  return std::max(std::min(kMinMorselSize, max_size_), static_cast<int64_t>(rows));
+}
+
+Status MorselBatcher::RunMorsel(int64_t num_rows,
+                                const std::function<Status()>& process) {
+  if (!adaptive_) {
+    return process();
+  }
+  int64_t start = NowNanos();
+  Status st = process();
+  int64_t elapsed = NowNanos() - start;
+  std::lock_guard<std::mutex> lock(cost_mutex_);
+  // Decay the history so that the target follows changes in the cost of a row
+  if (cost_rows_ > 16.0 * ExecPlan::kMaxBatchSize) {
+    cost_rows_ /= 2;
+    cost_nanos_ /= 2;
+  }
+  cost_rows_ += static_cast<double>(num_rows);
+  cost_nanos_ += static_cast<double>(elapsed);
+  return st;
+}
+
+Result<std::vector<ExecBatch>> MorselBatcher::Push(ExecBatch batch) {
+  std::vector<ExecBatch> morsels;
+  const int64_t target = target_size();
+  if (coalesce_ && batch.length > 0 && batch.length < target / 2) {
+    held_rows_ += batch.length;
+    held_.push_back(std::move(batch));
+    if (held_rows_ >= target / 2) {
+      ARROW_ASSIGN_OR_RAISE(ExecBatch held, ConcatenateHeld());
+      morsels.push_back(std::move(held));
+    }
+    return morsels;
+  }
+  if (!held_.empty()) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch held, ConcatenateHeld());
+    morsels.push_back(std::move(held));
+  }
+  // For various reasons (e.g. ARROW-13982) empty batches are passed through
+  int64_t offset = 0;
+  do {
+    morsels.push_back(batch.Slice(offset, target));
+    offset += target;
+  } while (offset < batch.length);
+  return morsels;
+}
+
+Result<std::vector<ExecBatch>> MorselBatcher::Finish() {
+  std::vector<ExecBatch> morsels;
+  if (!held_.empty()) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch held, ConcatenateHeld());
+    morsels.push_back(std::move(held));
+  }
+  return morsels;
+}
+
+Result<ExecBatch> MorselBatcher::ConcatenateHeld() {
+  std::vector<ExecBatch> batches = std::move(held_);
+  held_.clear();
+  ExecBatch out({}, held_rows_);
+  held_rows_ = 0;
+  if (batches.size() == 1) {
+    out.values = std::move(batches[0].values);
+    return out;
+  }
+  for (int i = 0; i < batches[0].num_values(); ++i) {
+    // A column with the same scalar in every batch, e.g. a partition column, stays
+    // a scalar
+    const Datum& first = batches[0][i];
+    if (first.is_scalar() &&
+        std::all_of(batches.begin(), batches.end(), [&](const ExecBatch& batch) {
+          return batch[i].is_scalar() && batch[i].scalar()->Equals(*first.scalar());
+        })) {
+      out.values.push_back(first);
+      continue;
+    }
+    ArrayVector arrays;
+    for (const auto& batch : batches) {
+      if (batch[i].is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(
+            auto array, MakeArrayFromScalar(*batch[i].scalar(), batch.length, pool_));
+        arrays.push_back(std::move(array));
+      } else {
+        arrays.push_back(batch[i].make_array());
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto array, Concatenate(arrays, pool_));
+    out.values.emplace_back(std::move(array));
+  }
+  return out;
+}
+
+NodeStatisticsCollector::NodeStatisticsCollector(int num_inputs, MemoryPool* pool)
+    : num_inputs_(num_inputs),
+      pool_(pool),
+      inputs_(new AtomicBatchCounts[std::max(num_inputs, 1)]) {}
+
+void NodeStatisticsCollector::RecordInput(int input_index, const ExecBatch& batch) {
+  DCHECK_GE(input_index, 0);
+  DCHECK_LT(input_index, std::max(num_inputs_, 1));
+  AtomicBatchCounts& counts = inputs_[input_index];
+  counts.batches.fetch_add(1);
+  counts.rows.fetch_add(batch.length);
+  counts.bytes.fetch_add(batch.TotalBufferSize());
+}
+
+void NodeStatisticsCollector::RecordProcessing(int64_t nanos) {
+  processing_time_nanos_.fetch_add(nanos);
+  int64_t in_use = pool_->bytes_allocated();
+  int64_t peak = peak_memory_bytes_.load();
+  while (in_use > peak && !peak_memory_bytes_.compare_exchange_weak(peak, in_use)) {
+  }
+}
+
+void NodeStatisticsCollector::RecordPause() {
+  std::lock_guard<std::mutex> lg(pause_mutex_);
+  if (paused_) return;
+  paused_ = true;
+  paused_since_nanos_ = NowNanos();
+}
+
+void NodeStatisticsCollector::RecordResume() {
+  std::lock_guard<std::mutex> lg(pause_mutex_);
+  if (!paused_) return;
+  paused_ = false;
+  paused_time_nanos_ += NowNanos() - paused_since_nanos_;
+}
+
+NodeStatisticsCollector::BatchCounts NodeStatisticsCollector::input_counts(
+    int input_index) const {
+  const AtomicBatchCounts& counts = inputs_[input_index];
+  return {counts.batches.load(), counts.rows.load(), counts.bytes.load()};
+}
+
+NodeStatisticsCollector::BatchCounts NodeStatisticsCollector::total_input_counts()
+    const {
+  BatchCounts total;
+  for (int i = 0; i < num_inputs_; ++i) {
+    BatchCounts counts = input_counts(i);
+    total.batches += counts.batches;
+    total.rows += counts.rows;
+    total.bytes += counts.bytes;
+  }
+  return total;
+}
+
+int64_t NodeStatisticsCollector::paused_time_nanos() const {
+  std::lock_guard<std::mutex> lg(pause_mutex_);
+  if (paused_) return paused_time_nanos_ + NowNanos() - paused_since_nanos_;
+  return paused_time_nanos_;
+}
+
+TracedScope::TracedScope(std::unique_ptr<::arrow::internal::tracing::Scope> span_scope,
+                         NodeStatisticsCollector* statistics)
+    : span_scope_(std::move(span_scope)), statistics_(statistics) {
+  if (statistics_ != nullptr) {
+    parent_ = current_traced_scope;
+    current_traced_scope = this;
+    start_nanos_ = NowNanos();
+  }
+}
+
+TracedScope::~TracedScope() {
+  if (statistics_ == nullptr) return;
+  int64_t elapsed = NowNanos() - start_nanos_;
+  statistics_->RecordProcessing(std::max<int64_t>(elapsed - child_nanos_, 0));
+  DCHECK_EQ(current_traced_scope, this);
+  current_traced_scope = parent_;
+  if (parent_ != nullptr) {
+    parent_->child_nanos_ += elapsed;
+  }
+}
+
+TracedScope TracedNode::TraceStartProducing(std::string extra_details) const {
+  std::unique_ptr<::arrow::internal::tracing::Scope> span_scope;
+#ifdef ARROW_WITH_OPENTELEMETRY
   std::string node_kind(node_->kind_name());
   arrow::util::tracing::Span span;
-  return START_SCOPED_SPAN(
+  span_scope.reset(new START_SCOPED_SPAN(
       span, node_kind + "::StartProducing",
-      {{"node.details", extra_details}, {"node.label", node_->label()}});
+      {{"node.details", extra_details}, {"node.label", node_->label()}}));
+#endif
+  return TracedScope(std::move(span_scope), node_->statistics_collector());
 }
 
 void TracedNode::NoteStartProducing(std::string extra_details) const {
@@ -111,27 +341,62 @@ void TracedNode::NoteStartProducing(std::string extra_details) const {
                                                          {"node.label", node_->label()}});
 }
 
-[[nodiscard]] ::arrow::internal::tracing::Scope TracedNode::TraceInputReceived(
-    const ExecBatch& batch) const {
+void TracedNode::RecordInput(const ExecBatch& batch, const ExecNode* input) const {
+  NodeStatisticsCollector* statistics = node_->statistics_collector();
+  if (statistics == nullptr) return;
+  int input_index = 0;
+  if (input != nullptr) {
+    const auto& inputs = node_->inputs();
+    input_index =
+        static_cast<int>(std::find(inputs.begin(), inputs.end(), input) - inputs.begin());
+    DCHECK_LT(input_index, static_cast<int>(inputs.size()));
+  }
+  statistics->RecordInput(input_index, batch);
+}
+
+TracedScope TracedNode::TraceInputReceived(const ExecBatch& batch,
+                                           const ExecNode* input) const {
+  RecordInput(batch, input);
+  std::unique_ptr<::arrow::internal::tracing::Scope> span_scope;
+#ifdef ARROW_WITH_OPENTELEMETRY
   std::string node_kind(node_->kind_name());
   arrow::util::tracing::Span span;
-  return START_SCOPED_SPAN(
+  span_scope.reset(new START_SCOPED_SPAN(
       span, node_kind + "::InputReceived",
-      {{"node.label", node_->label()}, {"node.batch_length", batch.length}});
+      {{"node.label", node_->label()}, {"node.batch_length", batch.length}}));
+#endif
+  return TracedScope(std::move(span_scope), node_->statistics_collector());
 }
 
-void TracedNode::NoteInputReceived(const ExecBatch& batch) const {
+void TracedNode::NoteInputReceived(const ExecBatch& batch, const ExecNode* input) const {
+  RecordInput(batch, input);
   std::string node_kind(node_->kind_name());
   EVENT_ON_CURRENT_SPAN(
       node_kind + "::InputReceived",
       {{"node.label", node_->label()}, {"node.batch_length", batch.length}});
 }
 
-[[nodiscard]] ::arrow::internal::tracing::Scope TracedNode::TraceFinish() const {
+TracedScope TracedNode::TraceFinish() const {
+  std::unique_ptr<::arrow::internal::tracing::Scope> span_scope;
+#ifdef ARROW_WITH_OPENTELEMETRY
   std::string node_kind(node_->kind_name());
   arrow::util::tracing::Span span;
-  return START_SCOPED_SPAN(span, node_kind + "::Finish",
-                           {{"node.label", node_->label()}});
+  span_scope.reset(new START_SCOPED_SPAN(span, node_kind + "::Finish",
+                                         {{"node.label", node_->label()}}));
+#endif
+  return TracedScope(std::move(span_scope), node_->statistics_collector());
+}
+
+void TracedNode::NotePauseProducing() const {
+  if (NodeStatisticsCollector* statistics = node_->statistics_collector()) {
+    statistics->RecordPause();
+  }
+}
+
+void TracedNode::NoteResumeProducing() const {
+  if (NodeStatisticsCollector* statistics = node_->statistics_collector()) {
+    statistics->RecordResume();
+  }
 }
 
 }  // namespace acero
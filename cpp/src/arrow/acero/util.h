@@ -19,6 +19,9 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <thread>
 #include <unordered_map>
@@ -47,6 +50,14 @@ ARROW_ACERO_EXPORT
 Status ValidateExecNodeInputs(ExecPlan* plan, const std::vector<ExecNode*>& inputs,
                               int expected_num_inputs, const char* kind_name);
 
+/// \brief Check that the fields referenced by a bound expression have the types
+/// it was bound to in the given schema
+///
+/// Nodes given an expression bound beforehand don't bind it again, this catches
+/// expressions bound to another schema than the node's input.
+ARROW_ACERO_EXPORT
+Status ValidateBoundExpression(const Expression& expr, const Schema& schema);
+
 ARROW_ACERO_EXPORT
 Result<std::shared_ptr<Table>> TableFromExecBatches(
     const std::shared_ptr<Schema>& schema, const std::vector<ExecBatch>& exec_batches);
@@ -141,6 +152,82 @@ class ARROW_ACERO_EXPORT NullSinkNodeConsumer : public SinkNodeConsumer {
   }
 };
 
+/// \brief Thread-safe accumulator for the runtime statistics of one node
+///
+/// \see QueryOptions::collect_node_statistics
+class ARROW_ACERO_EXPORT NodeStatisticsCollector {
+ public:
+  struct BatchCounts {
+    int64_t batches = 0;
+    int64_t rows = 0;
+    int64_t bytes = 0;
+  };
+
+  NodeStatisticsCollector(int num_inputs, MemoryPool* pool);
+
+  /// Record a batch received on the input with the given index
+  void RecordInput(int input_index, const ExecBatch& batch);
+
+  /// Record time spent processing and sample the memory in use
+  void RecordProcessing(int64_t nanos);
+
+  /// Record that the node paused or resumed producing because of backpressure
+  ///
+  /// Repeated calls without a change of state are ignored.
+  void RecordPause();
+  void RecordResume();
+
+  BatchCounts input_counts(int input_index) const;
+  BatchCounts total_input_counts() const;
+  int64_t processing_time_nanos() const { return processing_time_nanos_.load(); }
+  /// Includes the current pause, if the node is paused
+  int64_t paused_time_nanos() const;
+  int64_t peak_memory_bytes() const { return peak_memory_bytes_.load(); }
+
+ private:
+  struct AtomicBatchCounts {
+    std::atomic<int64_t> batches{0};
+    std::atomic<int64_t> rows{0};
+    std::atomic<int64_t> bytes{0};
+  };
+
+  int num_inputs_;
+  MemoryPool* pool_;
+  std::unique_ptr<AtomicBatchCounts[]> inputs_;
+  std::atomic<int64_t> processing_time_nanos_{0};
+  std::atomic<int64_t> peak_memory_bytes_{0};
+
+  mutable std::mutex pause_mutex_;
+  bool paused_ = false;
+  int64_t paused_since_nanos_ = 0;
+  int64_t paused_time_nanos_ = 0;
+};
+
+/// \brief The scope of some work done by a node
+///
+/// Holds the tracing span of the work, if tracing is enabled, and records the time
+/// spent in the node's statistics, if statistics are collected.  Work done by other
+/// nodes while the scope is open (e.g. an output processing a batch synchronously) is
+/// not counted.
+class ARROW_ACERO_EXPORT TracedScope {
+ public:
+  TracedScope(std::unique_ptr<::arrow::internal::tracing::Scope> span_scope,
+              NodeStatisticsCollector* statistics);
+  ~TracedScope();
+
+  TracedScope(const TracedScope&) = delete;
+  TracedScope(TracedScope&&) = delete;
+  TracedScope& operator=(const TracedScope&) = delete;
+  TracedScope& operator=(TracedScope&&) = delete;
+
+ private:
+  std::unique_ptr<::arrow::internal::tracing::Scope> span_scope_;
+  NodeStatisticsCollector* statistics_;
+  TracedScope* parent_ = NULLPTR;
+  int64_t start_nanos_ = 0;
+  int64_t child_nanos_ = 0;
+};
+
 /// CRTP helper for tracing helper functions
 
 class ARROW_ACERO_EXPORT TracedNode {
@@ -152,8 +239,7 @@ class ARROW_ACERO_EXPORT TracedNode {
   explicit TracedNode(ExecNode* node) : node_(node) {}
 
   // Create a span to record the StartProducing work
-  [[nodiscard]] ::arrow::internal::tracing::Scope TraceStartProducing(
-      std::string extra_details) const;
+  [[nodiscard]] TracedScope TraceStartProducing(std::string extra_details) const;
 
   // Record a call to StartProducing without creating with a span
   void NoteStartProducing(std::string extra_details) const;
@@ -161,24 +247,108 @@ class ARROW_ACERO_EXPORT TracedNode {
   // All nodes should call TraceInputReceived for each batch they receive.  This call
   // should track the time spent processing the batch.  NoteInputReceived is available
   // but usually won't be used unless a node is simply adding batches to a trivial queue.
+  //
+  // Nodes with more than one input should pass the input the batch came from.
 
   // Create a span to record the InputReceived work
-  [[nodiscard]] ::arrow::internal::tracing::Scope TraceInputReceived(
-      const ExecBatch& batch) const;
+  [[nodiscard]] TracedScope TraceInputReceived(const ExecBatch& batch,
+                                               const ExecNode* input = NULLPTR) const;
 
   // Record a call to InputReceived without creating with a span
-  void NoteInputReceived(const ExecBatch& batch) const;
+  void NoteInputReceived(const ExecBatch& batch, const ExecNode* input = NULLPTR) const;
 
   // Create a span to record any "finish" work.  This should NOT be called as part of
   // InputFinished and many nodes may not need to call this at all.  This should be used
   // when a node has some extra work that has to be done once it has received all of its
   // data.  For example, an aggregation node calculating aggregations.  This will
   // typically be called as a result of InputFinished OR InputReceived.
-  [[nodiscard]] ::arrow::internal::tracing::Scope TraceFinish() const;
+  [[nodiscard]] TracedScope TraceFinish() const;
+
+  // Source nodes should call these when they actually pause or resume in response to
+  // backpressure so the time spent paused can be reported.
+  void NotePauseProducing() const;
+  void NoteResumeProducing() const;
 
  private:
+  void RecordInput(const ExecBatch& batch, const ExecNode* input) const;
+
   ExecNode* node_;
 };
 
+/// \brief Turns the batches read by a source into morsels, the batches it delivers
+///
+/// Batches larger than the target size are sliced, without copying, so that a single
+/// huge batch doesn't become a single task.  If a morsel size is configured or the
+/// size adapts, batches smaller than half the target are held and concatenated with
+/// the following ones, so that tiny batches don't each pay for scheduling a task.
+///
+/// An adaptive target starts at the configured size and is lowered, down to
+/// kMinMorselSize rows, while processing a morsel takes more than kTargetMorselNanos,
+/// as measured by RunMorsel, so that expensive plans get more, smaller tasks.
+///
+/// Push and Finish must not be called concurrently.  RunMorsel is thread-safe.
+///
+/// \see QueryOptions::morsel_size
+class ARROW_ACERO_EXPORT MorselBatcher {
+ public:
+  static constexpr int64_t kMinMorselSize = 1024;
+  static constexpr int64_t kTargetMorselNanos = 1000000;
+
+  MorselBatcher(std::optional<int64_t> morsel_size, bool adaptive, MemoryPool* pool);
+
+  /// \brief Add a batch, returning the morsels that are ready, in order
+  ///
+  /// Empty batches are passed through.
+  Result<std::vector<ExecBatch>> Push(ExecBatch batch);
+
+  /// \brief Return the rows still held, if any, as a last morsel
+  Result<std::vector<ExecBatch>> Finish();
+
+  /// \brief Process a morsel of the given number of rows, timing it if the target
+  /// size adapts
+  Status RunMorsel(int64_t num_rows, const std::function<Status()>& process);
+
+  /// \brief The current target number of rows of a morsel
+  int64_t target_size() const;
+
+ private:
+  Result<ExecBatch> ConcatenateHeld();
+
+  const int64_t max_size_;
+  const bool coalesce_;
+  const bool adaptive_;
+  MemoryPool* pool_;
+
+  std::vector<ExecBatch> held_;
+  int64_t held_rows_ = 0;
+
+  // Recent processing cost, with older morsels weighing less
+  mutable std::mutex cost_mutex_;
+  double cost_rows_ = 0;
+  double cost_nanos_ = 0;
+};
+
+/// Mixin for nodes which can use predicates that only become known while the plan runs
+///
+/// A hash join, once it has accumulated its build side, knows the range of key values
+/// that can possibly find a match.  If the node feeding its probe side implements this
+/// interface the join hands it that range as a filter, which a source node may use to
+/// skip data whose statistics or guarantees contradict it.
+///
+/// Runtime filters are advisory: rows they exclude would have been dropped downstream
+/// anyway, so a node may apply a filter to some of its data and not to the rest, for
+/// example only to fragments it has not yet started reading.
+class ARROW_ACERO_EXPORT RuntimeFilterTarget {
+ public:
+  virtual ~RuntimeFilterTarget() = default;
+
+  /// \brief Receive a filter
+  ///
+  /// The filter is unbound and refers to the columns of the node's output schema.
+  /// This may be called from any thread and more than once; all filters received
+  /// apply.
+  virtual Status AddRuntimeFilter(compute::Expression filter) = 0;
+};
+
 }  // namespace acero
 }  // namespace arrow
@@ -0,0 +1,855 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/row/grouper.h"
+#include "arrow/result.h"
+#include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/int_util_overflow.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+using compute::ExecSpan;
+using compute::NullPlacement;
+using compute::RowSegmenter;
+using compute::Segment;
+using compute::SortKey;
+using compute::SortOrder;
+using compute::TakeOptions;
+
+namespace acero {
+namespace {
+
+enum class WindowFunctionKind {
+  kRowNumber,
+  kRank,
+  kDenseRank,
+  kLag,
+  kLead,
+  kSum,
+  kCount,
+  kMean,
+  kMin,
+  kMax
+};
+
+Result<WindowFunctionKind> GetWindowFunctionKind(const std::string& name) {
+  static const std::vector<std::pair<std::string, WindowFunctionKind>> kinds = {
+      {"row_number", WindowFunctionKind::kRowNumber},
+      {"rank", WindowFunctionKind::kRank},
+      {"dense_rank", WindowFunctionKind::kDenseRank},
+      {"lag", WindowFunctionKind::kLag},
+      {"lead", WindowFunctionKind::kLead},
+      {"sum", WindowFunctionKind::kSum},
+      {"count", WindowFunctionKind::kCount},
+      {"mean", WindowFunctionKind::kMean},
+      {"min", WindowFunctionKind::kMin},
+      {"max", WindowFunctionKind::kMax}};
+  for (const auto& kind : kinds) {
+    if (kind.first == name) return kind.second;
+  }
+  return Status::Invalid("Unknown window function '", name, "'");
+}
+
+bool IsRankingFunction(WindowFunctionKind kind) {
+  return kind == WindowFunctionKind::kRowNumber || kind == WindowFunctionKind::kRank ||
+         kind == WindowFunctionKind::kDenseRank;
+}
+
+bool IsFrameAggregate(WindowFunctionKind kind) {
+  return kind == WindowFunctionKind::kSum || kind == WindowFunctionKind::kCount ||
+         kind == WindowFunctionKind::kMean || kind == WindowFunctionKind::kMin ||
+         kind == WindowFunctionKind::kMax;
+}
+
+// A RANGE frame with an offset is computed on the ordering key reinterpreted as int64
+bool IsRangeKeyType(const DataType& type) {
+  switch (type.id()) {
+    case Type::DATE32:
+    case Type::DATE64:
+    case Type::TIMESTAMP:
+    case Type::TIME32:
+    case Type::TIME64:
+    case Type::DURATION:
+      return true;
+    default:
+      return is_integer(type.id());
+  }
+}
+
+// The type aggregates accumulate values of the given type in
+Result<std::shared_ptr<DataType>> AccumulatorType(const DataType& type) {
+  if (is_signed_integer(type.id())) return int64();
+  if (is_unsigned_integer(type.id())) return uint64();
+  if (type.id() == Type::FLOAT || type.id() == Type::DOUBLE) return float64();
+  return Status::NotImplemented("Window aggregates over values of type ", type);
+}
+
+Result<std::shared_ptr<DataType>> OutputType(WindowFunctionKind kind,
+                                             const std::shared_ptr<DataType>& target) {
+  switch (kind) {
+    case WindowFunctionKind::kRowNumber:
+    case WindowFunctionKind::kRank:
+    case WindowFunctionKind::kDenseRank:
+    case WindowFunctionKind::kCount:
+      return int64();
+    case WindowFunctionKind::kLag:
+    case WindowFunctionKind::kLead:
+      return target;
+    case WindowFunctionKind::kMean:
+      RETURN_NOT_OK(AccumulatorType(*target));
+      return float64();
+    case WindowFunctionKind::kSum:
+      return AccumulatorType(*target);
+    case WindowFunctionKind::kMin:
+    case WindowFunctionKind::kMax:
+      RETURN_NOT_OK(AccumulatorType(*target));
+      return target;
+  }
+  return Status::UnknownError("unreachable");
+}
+
+// The frame of every row, as a range [begin, end) of row indices.  Both bounds are
+// non-decreasing over the sorted input, which is what allows sliding aggregation.
+struct FrameBounds {
+  std::vector<int64_t> begin;
+  std::vector<int64_t> end;
+};
+
+// Sums the non-null values in the frame.  Non-finite floating point values are
+// counted apart so that removing them from the frame does not leave NaNs behind,
+// and finite ones are summed with Neumaier's compensated summation, so that
+// removing large values does not leave their rounding errors behind.
+template <typename CType>
+class SlidingSum {
+ public:
+  SlidingSum(const CType* values, const uint8_t* validity, int64_t validity_offset)
+      : values_(values), validity_(validity), validity_offset_(validity_offset) {}
+
+  void Add(int64_t i) {
+    if (!IsValid(i)) return;
+    ++count_;
+    Update(values_[i], +1);
+  }
+
+  void Remove(int64_t i) {
+    if (!IsValid(i)) return;
+    --count_;
+    Update(values_[i], -1);
+  }
+
+  int64_t count() const { return count_; }
+
+  CType sum() const {
+    if constexpr (std::is_floating_point_v<CType>) {
+      if (num_nan_ > 0 || (num_pos_inf_ > 0 && num_neg_inf_ > 0)) {
+        return std::numeric_limits<CType>::quiet_NaN();
+      }
+      if (num_pos_inf_ > 0) return std::numeric_limits<CType>::infinity();
+      if (num_neg_inf_ > 0) return -std::numeric_limits<CType>::infinity();
+    }
+    if constexpr (std::is_floating_point_v<CType>) {
+      return sum_ + compensation_;
+    }
+    return sum_;
+  }
+
+ private:
+  bool IsValid(int64_t i) const {
+    return validity_ == NULLPTR || bit_util::GetBit(validity_, validity_offset_ + i);
+  }
+
+  void Update(CType value, int sign) {
+    if constexpr (std::is_floating_point_v<CType>) {
+      if (std::isnan(value)) {
+        num_nan_ += sign;
+        return;
+      }
+      if (std::isinf(value)) {
+        (value > 0 ? num_pos_inf_ : num_neg_inf_) += sign;
+        return;
+      }
+      num_finite_ += sign;
+      if (num_finite_ == 0) {
+        // Start over from an exact zero when the frame has no finite values left
+        sum_ = compensation_ = 0;
+        return;
+      }
+      const CType addend = sign * value;
+      const CType new_sum = sum_ + addend;
+      // The low-order bits lost by the addition
+      if (std::abs(sum_) >= std::abs(addend)) {
+        compensation_ += (sum_ - new_sum) + addend;
+      } else {
+        compensation_ += (addend - new_sum) + sum_;
+      }
+      sum_ = new_sum;
+    } else {
+      // Integer sums wrap around on overflow, like the "sum" kernel
+      sum_ = sign > 0 ? arrow::internal::SafeSignedAdd(sum_, value)
+                      : arrow::internal::SafeSignedSubtract(sum_, value);
+    }
+  }
+
+  const CType* values_;
+  const uint8_t* validity_;
+  int64_t validity_offset_;
+  CType sum_ = 0;
+  CType compensation_ = 0;
+  int64_t count_ = 0;
+  int64_t num_finite_ = 0;
+  int64_t num_nan_ = 0;
+  int64_t num_pos_inf_ = 0;
+  int64_t num_neg_inf_ = 0;
+};
+
+// Tracks the minimum (or maximum) of the non-null values in the frame with a
+// monotonic queue of row indices, which is amortized O(1) per row.
+template <typename CType, bool kIsMin>
+class SlidingExtremum {
+ public:
+  SlidingExtremum(const CType* values, const uint8_t* validity, int64_t validity_offset)
+      : values_(values), validity_(validity), validity_offset_(validity_offset) {}
+
+  void Add(int64_t i) {
+    if (validity_ != NULLPTR && !bit_util::GetBit(validity_, validity_offset_ + i)) {
+      return;
+    }
+    if constexpr (std::is_floating_point_v<CType>) {
+      // Like the "min_max" kernel, NaNs are ignored
+      if (std::isnan(values_[i])) return;
+    }
+    while (!queue_.empty() && !Better(values_[queue_.back()], values_[i])) {
+      queue_.pop_back();
+    }
+    queue_.push_back(i);
+  }
+
+  void Remove(int64_t i) {
+    if (!queue_.empty() && queue_.front() == i) queue_.pop_front();
+  }
+
+  bool empty() const { return queue_.empty(); }
+  CType value() const { return values_[queue_.front()]; }
+
+ private:
+  static bool Better(CType left, CType right) {
+    return kIsMin ? left < right : left > right;
+  }
+
+  const CType* values_;
+  const uint8_t* validity_;
+  int64_t validity_offset_;
+  std::deque<int64_t> queue_;
+};
+
+// Slides `state` over the frames of all rows, calling `emit(state)` for every row
+template <typename State, typename Emit>
+void SlideFrames(const FrameBounds& frames, State* state, Emit&& emit) {
+  int64_t num_rows = static_cast<int64_t>(frames.begin.size());
+  int64_t begin = 0;
+  int64_t end = 0;
+  for (int64_t row = 0; row < num_rows; ++row) {
+    int64_t frame_begin = frames.begin[row];
+    int64_t frame_end = frames.end[row];
+    if (frame_begin >= end) {
+      // The frame does not overlap the previous one, e.g. in a new partition
+      for (; begin < end; ++begin) state->Remove(begin);
+      begin = end = frame_begin;
+    }
+    for (; end < frame_end; ++end) state->Add(end);
+    for (; begin < frame_begin; ++begin) state->Remove(begin);
+    emit(*state);
+  }
+}
+
+template <typename CType>
+Result<Datum> SlidingAggregate(WindowFunctionKind kind, const ArrayData& values,
+                               const FrameBounds& frames, MemoryPool* pool) {
+  using AccArrowType = typename CTypeTraits<CType>::ArrowType;
+  const CType* data = values.GetValues<CType>(1);
+  const uint8_t* validity =
+      values.MayHaveNulls() ? values.buffers[0]->data() : NULLPTR;
+  int64_t num_rows = static_cast<int64_t>(frames.begin.size());
+
+  switch (kind) {
+    case WindowFunctionKind::kCount: {
+      Int64Builder builder(pool);
+      RETURN_NOT_OK(builder.Reserve(num_rows));
+      SlidingSum<CType> state(data, validity, values.offset);
+      SlideFrames(frames, &state, [&](const SlidingSum<CType>& current) {
+        builder.UnsafeAppend(current.count());
+      });
+      return builder.Finish();
+    }
+    case WindowFunctionKind::kSum: {
+      NumericBuilder<AccArrowType> builder(pool);
+      RETURN_NOT_OK(builder.Reserve(num_rows));
+      SlidingSum<CType> state(data, validity, values.offset);
+      SlideFrames(frames, &state, [&](const SlidingSum<CType>& current) {
+        if (current.count() == 0) {
+          builder.UnsafeAppendNull();
+        } else {
+          builder.UnsafeAppend(current.sum());
+        }
+      });
+      return builder.Finish();
+    }
+    case WindowFunctionKind::kMean: {
+      DoubleBuilder builder(pool);
+      RETURN_NOT_OK(builder.Reserve(num_rows));
+      SlidingSum<CType> state(data, validity, values.offset);
+      SlideFrames(frames, &state, [&](const SlidingSum<CType>& current) {
+        if (current.count() == 0) {
+          builder.UnsafeAppendNull();
+        } else {
+          builder.UnsafeAppend(static_cast<double>(current.sum()) /
+                               static_cast<double>(current.count()));
+        }
+      });
+      return builder.Finish();
+    }
+    case WindowFunctionKind::kMin:
+    case WindowFunctionKind::kMax: {
+      NumericBuilder<AccArrowType> builder(pool);
+      RETURN_NOT_OK(builder.Reserve(num_rows));
+      auto emit = [&](const auto& current) {
+        if (current.empty()) {
+          builder.UnsafeAppendNull();
+        } else {
+          builder.UnsafeAppend(current.value());
+        }
+      };
+      if (kind == WindowFunctionKind::kMin) {
+        SlidingExtremum<CType, /*kIsMin=*/true> state(data, validity, values.offset);
+        SlideFrames(frames, &state, emit);
+      } else {
+        SlidingExtremum<CType, /*kIsMin=*/false> state(data, validity, values.offset);
+        SlideFrames(frames, &state, emit);
+      }
+      return builder.Finish();
+    }
+    default:
+      break;
+  }
+  return Status::UnknownError("unreachable");
+}
+
+// Turns segments into the sorted list of their start offsets, followed by `num_rows`
+std::vector<int64_t> SegmentBoundaries(const std::vector<Segment>& segments,
+                                       int64_t num_rows) {
+  std::vector<int64_t> boundaries;
+  boundaries.reserve(segments.size() + 1);
+  for (const auto& segment : segments) {
+    boundaries.push_back(segment.offset);
+  }
+  boundaries.push_back(num_rows);
+  return boundaries;
+}
+
+class WindowNode : public ExecNode, public TracedNode {
+ public:
+  struct ResolvedFunction {
+    WindowFunctionKind kind;
+    // -1 for ranking functions
+    int target_index;
+    WindowFrame frame;
+    int64_t offset;
+  };
+
+  WindowNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+             std::shared_ptr<Schema> output_schema, std::vector<int> partition_key_ids,
+             std::vector<int> order_key_ids, Ordering ordering, Ordering output_ordering,
+             std::vector<ResolvedFunction> functions)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        partition_key_ids_(std::move(partition_key_ids)),
+        order_key_ids_(std::move(order_key_ids)),
+        ordering_(std::move(ordering)),
+        output_ordering_(std::move(output_ordering)),
+        functions_(std::move(functions)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "WindowNode"));
+    const auto& window_options = checked_cast<const WindowNodeOptions&>(options);
+    const std::shared_ptr<Schema>& input_schema = inputs[0]->output_schema();
+
+    if (window_options.ordering.is_implicit()) {
+      return Status::Invalid("`ordering` must be explicit or unordered");
+    }
+
+    std::vector<int> partition_key_ids;
+    std::vector<SortKey> output_sort_keys;
+    for (const auto& key : window_options.partition_keys) {
+      ARROW_ASSIGN_OR_RAISE(auto match, key.FindOne(*input_schema));
+      partition_key_ids.push_back(match[0]);
+      output_sort_keys.emplace_back(key, SortOrder::Ascending);
+    }
+    std::vector<int> order_key_ids;
+    for (const auto& sort_key : window_options.ordering.sort_keys()) {
+      ARROW_ASSIGN_OR_RAISE(auto match, sort_key.target.FindOne(*input_schema));
+      order_key_ids.push_back(match[0]);
+      output_sort_keys.push_back(sort_key);
+    }
+    Ordering output_ordering =
+        output_sort_keys.empty()
+            ? Ordering::Unordered()
+            : Ordering(std::move(output_sort_keys),
+                       window_options.ordering.null_placement());
+
+    FieldVector output_fields = input_schema->fields();
+    std::vector<ResolvedFunction> functions;
+    for (const auto& function : window_options.functions) {
+      ARROW_ASSIGN_OR_RAISE(WindowFunctionKind kind,
+                            GetWindowFunctionKind(function.function));
+      ResolvedFunction resolved{kind, -1, function.frame, function.offset};
+      std::shared_ptr<DataType> target_type;
+      if (IsRankingFunction(kind)) {
+        if (function.target.has_value()) {
+          return Status::Invalid("Window function '", function.function,
+                                 "' does not take a target");
+        }
+      } else {
+        if (!function.target.has_value()) {
+          return Status::Invalid("Window function '", function.function,
+                                 "' requires a target");
+        }
+        ARROW_ASSIGN_OR_RAISE(auto match, function.target->FindOne(*input_schema));
+        resolved.target_index = match[0];
+        target_type = input_schema->field(match[0])->type();
+      }
+      if (IsFrameAggregate(kind)) {
+        RETURN_NOT_OK(ValidateFrame(function.frame, window_options.ordering,
+                                    *input_schema, order_key_ids));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto output_type, OutputType(kind, target_type));
+      output_fields.push_back(field(function.name, std::move(output_type)));
+      functions.push_back(resolved);
+    }
+
+    return plan->EmplaceNode<WindowNode>(
+        plan, std::move(inputs), schema(std::move(output_fields)),
+        std::move(partition_key_ids), std::move(order_key_ids), window_options.ordering,
+        std::move(output_ordering), std::move(functions));
+  }
+
+  static Status ValidateFrame(const WindowFrame& frame, const Ordering& ordering,
+                              const Schema& input_schema,
+                              const std::vector<int>& order_key_ids) {
+    if (frame.preceding.value_or(0) < 0 || frame.following.value_or(0) < 0) {
+      return Status::Invalid("Window frame bounds must not be negative");
+    }
+    bool has_offset = frame.preceding.value_or(0) > 0 || frame.following.value_or(0) > 0;
+    if (frame.units == WindowFrame::RANGE && has_offset) {
+      if (order_key_ids.size() != 1) {
+        return Status::Invalid(
+            "RANGE window frames with an offset require exactly one ordering key");
+      }
+      const DataType& key_type = *input_schema.field(order_key_ids[0])->type();
+      if (!IsRangeKeyType(key_type)) {
+        return Status::NotImplemented("RANGE window frames with an offset over ",
+                                      key_type, " ordering keys");
+      }
+    }
+    return Status::OK();
+  }
+
+  const char* kind_name() const override { return "WindowNode"; }
+
+  const Ordering& ordering() const override { return output_ordering_; }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    if (counter_.SetTotal(total_batches)) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    DCHECK_EQ(input, inputs_[0]);
+
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                          batch.ToRecordBatch(inputs_[0]->output_schema()));
+    {
+      std::lock_guard lk(mutex_);
+      accumulation_queue_.push_back(std::move(record_batch));
+    }
+
+    if (counter_.Increment()) {
+      return DoFinish();
+    }
+    return Status::OK();
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    const auto& input_schema = inputs_[0]->output_schema();
+    ss << "partition_keys=[";
+    for (size_t i = 0; i < partition_key_ids_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << '"' << input_schema->field(partition_key_ids_[i])->name() << '"';
+    }
+    ss << "], ordering=" << ordering_.ToString() << ", functions=[";
+    int num_input_fields = input_schema->num_fields();
+    for (size_t i = 0; i < functions_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << '"' << output_schema_->field(num_input_fields + static_cast<int>(i))->name()
+         << '"';
+    }
+    ss << ']';
+    return ss.str();
+  }
+
+ private:
+  // Sort the input by partition keys, then by the ordering within partitions
+  Result<std::shared_ptr<RecordBatch>> SortInput() {
+    const std::shared_ptr<Schema>& input_schema = inputs_[0]->output_schema();
+    ExecContext* ctx = plan_->query_context()->exec_context();
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(
+                                          input_schema, std::move(accumulation_queue_)));
+    if (!output_ordering_.is_unordered()) {
+      SortOptions sort_options(output_ordering_.sort_keys(),
+                               output_ordering_.null_placement());
+      ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, sort_options, ctx));
+      ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                            Take(table, indices, TakeOptions::NoBoundsCheck(), ctx));
+      table = sorted.table();
+    }
+    return table->CombineChunksToBatch(ctx->memory_pool());
+  }
+
+  // Find where runs of equal values of the given key columns start
+  Result<std::vector<int64_t>> FindBoundaries(const RecordBatch& batch,
+                                              const std::vector<int>& key_ids) {
+    int64_t num_rows = batch.num_rows();
+    if (key_ids.empty() || num_rows == 0) {
+      std::vector<int64_t> boundaries;
+      if (num_rows > 0) boundaries.push_back(0);
+      boundaries.push_back(num_rows);
+      return boundaries;
+    }
+    std::vector<TypeHolder> key_types;
+    std::vector<Datum> key_values;
+    for (int key_id : key_ids) {
+      key_types.emplace_back(batch.schema()->field(key_id)->type());
+      key_values.emplace_back(batch.column(key_id));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto segmenter,
+                          RowSegmenter::Make(key_types, /*nullable_keys=*/true,
+                                             plan_->query_context()->exec_context()));
+    ExecBatch key_batch(std::move(key_values), num_rows);
+    ARROW_ASSIGN_OR_RAISE(auto segments, segmenter->GetSegments(ExecSpan(key_batch)));
+    return SegmentBoundaries(segments, num_rows);
+  }
+
+  // Compute the frame of every row.  `partitions` and `peers` are segment boundaries
+  // as returned by FindBoundaries, peer groups never span partitions.
+  Result<FrameBounds> ComputeFrames(const WindowFrame& frame, const RecordBatch& batch,
+                                    const std::vector<int64_t>& partitions,
+                                    const std::vector<int64_t>& peers) {
+    int64_t num_rows = batch.num_rows();
+    FrameBounds frames;
+    frames.begin.resize(num_rows);
+    frames.end.resize(num_rows);
+
+    bool range_offset =
+        frame.units == WindowFrame::RANGE &&
+        (frame.preceding.value_or(0) > 0 || frame.following.value_or(0) > 0);
+    std::shared_ptr<ArrayData> keys;
+    if (range_offset) {
+      // Compare the ordering key as int64, through its physical representation
+      std::shared_ptr<Array> key_column = batch.column(order_key_ids_[0]);
+      const auto& key_type = checked_cast<const FixedWidthType&>(*key_column->type());
+      if (!is_integer(key_type.id())) {
+        ARROW_ASSIGN_OR_RAISE(key_column,
+                              key_column->View(key_type.bit_width() == 32 ? int32()
+                                                                            : int64()));
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          Datum cast_keys,
+          compute::Cast(key_column, int64(), compute::CastOptions::Safe(),
+                        plan_->query_context()->exec_context()));
+      keys = cast_keys.array();
+    }
+    bool descending = !ordering_.sort_keys().empty() &&
+                      ordering_.sort_keys()[0].order == SortOrder::Descending;
+
+    size_t peer = 0;
+    for (size_t p = 0; p + 1 < partitions.size(); ++p) {
+      int64_t partition_begin = partitions[p];
+      int64_t partition_end = partitions[p + 1];
+
+      // Rows with a non-null key are contiguous since nulls are sorted together
+      int64_t valid_begin = partition_begin, valid_end = partition_end;
+      if (range_offset) {
+        while (valid_begin < valid_end && keys->IsNull(valid_begin)) ++valid_begin;
+        while (valid_end > valid_begin && keys->IsNull(valid_end - 1)) --valid_end;
+      }
+      const int64_t* key_values = keys ? keys->GetValues<int64_t>(1) : NULLPTR;
+      int64_t lower = valid_begin, upper = valid_begin;
+
+      for (int64_t row = partition_begin; row < partition_end; ++row) {
+        while (peers[peer + 1] <= row) ++peer;
+        int64_t peer_begin = peers[peer];
+        int64_t peer_end = peers[peer + 1];
+        int64_t& begin = frames.begin[row];
+        int64_t& end = frames.end[row];
+
+        if (frame.units == WindowFrame::ROWS) {
+          begin = frame.preceding ? std::max(partition_begin, row - *frame.preceding)
+                                  : partition_begin;
+          end = frame.following
+                    ? std::min(partition_end, row + 1 + std::min(*frame.following,
+                                                                   partition_end))
+                    : partition_end;
+          continue;
+        }
+
+        begin = frame.preceding ? peer_begin : partition_begin;
+        end = frame.following ? peer_end : partition_end;
+        if (!range_offset || keys->IsNull(row)) {
+          // Without an offset (or a key to apply it to) the bounds are the peers
+          continue;
+        }
+        // The frame covers keys in [value - preceding, value + following], or the
+        // reverse if sorted in descending order.  Saturate instead of overflowing.
+        int64_t value = key_values[row];
+        auto add = [](int64_t a, int64_t b) {
+          int64_t out;
+          if (arrow::internal::AddWithOverflow(a, b, &out)) {
+            return b > 0 ? std::numeric_limits<int64_t>::max()
+                         : std::numeric_limits<int64_t>::min();
+          }
+          return out;
+        };
+        if (frame.preceding) {
+          int64_t first = descending ? add(value, *frame.preceding)
+                                     : add(value, -*frame.preceding);
+          while (lower < valid_end && (descending ? key_values[lower] > first
+                                                  : key_values[lower] < first)) {
+            ++lower;
+          }
+          begin = lower;
+        }
+        if (frame.following) {
+          int64_t last = descending ? add(value, -*frame.following)
+                                    : add(value, *frame.following);
+          upper = std::max(upper, lower);
+          while (upper < valid_end && (descending ? key_values[upper] >= last
+                                                  : key_values[upper] <= last)) {
+            ++upper;
+          }
+          end = upper;
+        }
+      }
+    }
+    return frames;
+  }
+
+  Result<Datum> EvaluateRanking(const ResolvedFunction& function,
+                                const std::vector<int64_t>& partitions,
+                                const std::vector<int64_t>& peers) {
+    int64_t num_rows = partitions.back();
+    Int64Builder builder(plan_->query_context()->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(num_rows));
+    size_t peer = 0;
+    for (size_t p = 0; p + 1 < partitions.size(); ++p) {
+      int64_t dense_rank = 0;
+      for (int64_t row = partitions[p]; row < partitions[p + 1]; ++row) {
+        if (peers[peer + 1] <= row) ++peer;
+        if (peers[peer] == row) ++dense_rank;
+        switch (function.kind) {
+          case WindowFunctionKind::kRowNumber:
+            builder.UnsafeAppend(row - partitions[p] + 1);
+            break;
+          case WindowFunctionKind::kRank:
+            builder.UnsafeAppend(peers[peer] - partitions[p] + 1);
+            break;
+          default:
+            builder.UnsafeAppend(dense_rank);
+            break;
+        }
+      }
+    }
+    return builder.Finish();
+  }
+
+  Result<Datum> EvaluateOffset(const ResolvedFunction& function, const RecordBatch& batch,
+                               const std::vector<int64_t>& partitions) {
+    int64_t num_rows = batch.num_rows();
+    int64_t offset =
+        function.kind == WindowFunctionKind::kLag ? -function.offset : function.offset;
+    Int64Builder indices(plan_->query_context()->memory_pool());
+    RETURN_NOT_OK(indices.Reserve(num_rows));
+    for (size_t p = 0; p + 1 < partitions.size(); ++p) {
+      for (int64_t row = partitions[p]; row < partitions[p + 1]; ++row) {
+        // row + offset cannot overflow as long as it is compared this way
+        if (offset < partitions[p] - row || offset >= partitions[p + 1] - row) {
+          indices.UnsafeAppendNull();
+        } else {
+          indices.UnsafeAppend(row + offset);
+        }
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto index_array, indices.Finish());
+    return Take(batch.column(function.target_index), index_array,
+                TakeOptions::NoBoundsCheck(), plan_->query_context()->exec_context());
+  }
+
+  Result<Datum> EvaluateAggregate(const ResolvedFunction& function,
+                                  const RecordBatch& batch,
+                                  const std::vector<int64_t>& partitions,
+                                  const std::vector<int64_t>& peers) {
+    ExecContext* ctx = plan_->query_context()->exec_context();
+    ARROW_ASSIGN_OR_RAISE(FrameBounds frames,
+                          ComputeFrames(function.frame, batch, partitions, peers));
+    std::shared_ptr<Array> target = batch.column(function.target_index);
+    ARROW_ASSIGN_OR_RAISE(auto acc_type, AccumulatorType(*target->type()));
+    ARROW_ASSIGN_OR_RAISE(
+        Datum values, compute::Cast(target, acc_type, compute::CastOptions::Safe(), ctx));
+    const ArrayData& data = *values.array();
+
+    Datum out;
+    if (acc_type->id() == Type::INT64) {
+      ARROW_ASSIGN_OR_RAISE(out, SlidingAggregate<int64_t>(function.kind, data, frames,
+                                                           ctx->memory_pool()));
+    } else if (acc_type->id() == Type::UINT64) {
+      ARROW_ASSIGN_OR_RAISE(out, SlidingAggregate<uint64_t>(function.kind, data, frames,
+                                                            ctx->memory_pool()));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(out, SlidingAggregate<double>(function.kind, data, frames,
+                                                          ctx->memory_pool()));
+    }
+    if (function.kind == WindowFunctionKind::kMin ||
+        function.kind == WindowFunctionKind::kMax) {
+      // Extremums are input values, so casting them back is lossless
+      return compute::Cast(out, target->type(), compute::CastOptions::Safe(), ctx);
+    }
+    return out;
+  }
+
+  Result<std::shared_ptr<Table>> Evaluate() {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> sorted, SortInput());
+    ARROW_ASSIGN_OR_RAISE(std::vector<int64_t> partitions,
+                          FindBoundaries(*sorted, partition_key_ids_));
+    // Peers share the same partition and ordering key
+    std::vector<int> peer_key_ids = partition_key_ids_;
+    peer_key_ids.insert(peer_key_ids.end(), order_key_ids_.begin(), order_key_ids_.end());
+    ARROW_ASSIGN_OR_RAISE(std::vector<int64_t> peers,
+                          FindBoundaries(*sorted, peer_key_ids));
+
+    std::vector<std::shared_ptr<Array>> columns = sorted->columns();
+    for (const auto& function : functions_) {
+      Datum column;
+      if (IsRankingFunction(function.kind)) {
+        ARROW_ASSIGN_OR_RAISE(column, EvaluateRanking(function, partitions, peers));
+      } else if (IsFrameAggregate(function.kind)) {
+        ARROW_ASSIGN_OR_RAISE(column,
+                              EvaluateAggregate(function, *sorted, partitions, peers));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(column, EvaluateOffset(function, *sorted, partitions));
+      }
+      columns.push_back(column.make_array());
+    }
+    return Table::Make(output_schema_, std::move(columns), sorted->num_rows());
+  }
+
+  Status DoFinish() {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> result, Evaluate());
+    TableBatchReader reader(*result);
+    reader.set_chunksize(ExecPlan::kMaxBatchSize);
+    int batch_index = 0;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, reader.Next());
+      if (!next) {
+        return output_->InputFinished(this, batch_index);
+      }
+      int index = batch_index++;
+      plan_->query_context()->ScheduleTask(
+          [this, batch = std::move(next), index]() mutable {
+            ExecBatch exec_batch(*batch);
+            exec_batch.index = index;
+            return output_->InputReceived(this, std::move(exec_batch));
+          },
+          "WindowNode::ProcessBatch");
+    }
+  }
+
+  AtomicCounter counter_;
+  const std::vector<int> partition_key_ids_;
+  const std::vector<int> order_key_ids_;
+  const Ordering ordering_;
+  const Ordering output_ordering_;
+  const std::vector<ResolvedFunction> functions_;
+  std::vector<std::shared_ptr<RecordBatch>> accumulation_queue_;
+  std::mutex mutex_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterWindowNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(
+      registry->AddFactory(std::string(WindowNodeOptions::kName), WindowNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
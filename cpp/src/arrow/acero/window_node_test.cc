@@ -0,0 +1,178 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/matchers.h"
+
+namespace arrow {
+
+using compute::SortKey;
+using compute::SortOrder;
+
+namespace acero {
+
+namespace {
+
+std::shared_ptr<Table> MakeInput() {
+  return TableFromJSON(schema({field("part", utf8()), field("ts", int64()),
+                               field("val", int32())}),
+                       {R"([["b", 3, 30], ["a", 2, null], ["a", 1, 10], ["b", 1, 5]])",
+                        R"([["a", 4, 40], ["a", 2, 20], ["b", 6, 60]])"});
+}
+
+Result<std::shared_ptr<Table>> RunWindow(std::shared_ptr<Table> input,
+                                         WindowNodeOptions options) {
+  Declaration plan = Declaration::Sequence({
+      {"table_source", TableSourceNodeOptions(std::move(input))},
+      {"window", std::move(options)},
+  });
+  // Rows with equal keys keep their input order, which needs a serial source
+  return DeclarationToTable(std::move(plan), /*use_threads=*/false);
+}
+
+}  // namespace
+
+TEST(WindowNode, RankingAndOffsets) {
+  WindowNodeOptions options({{"row_number", std::nullopt, "row_number"},
+                             {"rank", std::nullopt, "rank"},
+                             {"dense_rank", std::nullopt, "dense_rank"},
+                             {"lag", FieldRef("val"), "lag", {}, /*offset=*/1},
+                             {"lead", FieldRef("val"), "lead", {}, /*offset=*/2}},
+                            {"part"}, Ordering({SortKey("ts")}));
+  ASSERT_OK_AND_ASSIGN(auto output, RunWindow(MakeInput(), std::move(options)));
+
+  auto expected = TableFromJSON(
+      schema({field("part", utf8()), field("ts", int64()), field("val", int32()),
+              field("row_number", int64()), field("rank", int64()),
+              field("dense_rank", int64()), field("lag", int32()),
+              field("lead", int32())}),
+      {R"([
+        ["a", 1, 10,   1, 1, 1, null, 20],
+        ["a", 2, null, 2, 2, 2, 10,   40],
+        ["a", 2, 20,   3, 2, 2, null, null],
+        ["a", 4, 40,   4, 4, 3, 20,   null],
+        ["b", 1, 5,    1, 1, 1, null, 60],
+        ["b", 3, 30,   2, 2, 2, 5,    null],
+        ["b", 6, 60,   3, 3, 3, 30,   null]
+      ])"});
+  AssertTablesEqual(*expected, *output, /*same_chunk_layout=*/false);
+}
+
+TEST(WindowNode, FrameAggregates) {
+  WindowFrame rows_around(WindowFrame::ROWS, 1, 1);
+  WindowFrame rows_next(WindowFrame::ROWS, 0, 1);
+  WindowFrame range_before(WindowFrame::RANGE, 1, 0);
+  WindowFrame range_after(WindowFrame::RANGE, 0, 2);
+  WindowNodeOptions options({{"sum", FieldRef("val"), "running_sum"},
+                             {"sum", FieldRef("val"), "sum", rows_around},
+                             {"count", FieldRef("val"), "count", rows_around},
+                             {"mean", FieldRef("val"), "mean", rows_next},
+                             {"min", FieldRef("val"), "min", range_before},
+                             {"max", FieldRef("val"), "max", range_after}},
+                            {"part"}, Ordering({SortKey("ts")}));
+  ASSERT_OK_AND_ASSIGN(auto output, RunWindow(MakeInput(), std::move(options)));
+
+  auto expected = TableFromJSON(
+      schema({field("part", utf8()), field("ts", int64()), field("val", int32()),
+              field("running_sum", int64()), field("sum", int64()),
+              field("count", int64()), field("mean", float64()), field("min", int32()),
+              field("max", int32())}),
+      {R"([
+        ["a", 1, 10,   10, 10, 1, 10.0, 10, 20],
+        ["a", 2, null, 30, 30, 2, 20.0, 10, 40],
+        ["a", 2, 20,   30, 60, 2, 30.0, 10, 40],
+        ["a", 4, 40,   70, 60, 2, 40.0, 40, 40],
+        ["b", 1, 5,    5,  35, 2, 17.5, 5,  30],
+        ["b", 3, 30,   35, 95, 3, 45.0, 30, 30],
+        ["b", 6, 60,   95, 90, 2, 60.0, 60, 60]
+      ])"});
+  AssertTablesEqual(*expected, *output, /*same_chunk_layout=*/false);
+}
+
+TEST(WindowNode, FloatingPointSums) {
+  // A large value leaving the frame neither leaves its rounding error nor, when
+  // infinite, a non-finite sum behind
+  auto input = TableFromJSON(
+      schema({field("ts", int32()), field("val", float64())}),
+      {R"([[0, 1e16], [1, 1.0], [2, 1.0], [3, 1.0], [4, Inf], [5, 1.0], [6, 2.0]])"});
+  WindowNodeOptions options(
+      {{"sum", FieldRef("val"), "sum", WindowFrame(WindowFrame::ROWS, 1, 0)}},
+      /*partition_keys=*/{}, Ordering({SortKey("ts")}));
+  ASSERT_OK_AND_ASSIGN(auto output, RunWindow(std::move(input), std::move(options)));
+
+  auto expected = TableFromJSON(
+      schema({field("ts", int32()), field("val", float64()), field("sum", float64())}),
+      {R"([[0, 1e16, 1e16], [1, 1.0, 1e16], [2, 1.0, 2.0], [3, 1.0, 2.0],
+           [4, Inf, Inf], [5, 1.0, Inf], [6, 2.0, 3.0]])"});
+  AssertTablesEqual(*expected, *output, /*same_chunk_layout=*/false);
+}
+
+TEST(WindowNode, DescendingRange) {
+  auto input = TableFromJSON(schema({field("ts", int32()), field("val", int64())}),
+                             {R"([[2, 2], [5, 5], [1, 1], [3, 3], [null, 7]])"});
+  WindowNodeOptions options(
+      {{"sum", FieldRef("val"), "sum", WindowFrame(WindowFrame::RANGE, 1, 0)}},
+      /*partition_keys=*/{}, Ordering({SortKey("ts", SortOrder::Descending)}));
+  ASSERT_OK_AND_ASSIGN(auto output, RunWindow(std::move(input), std::move(options)));
+
+  // Rows with a null key only see their peers
+  auto expected = TableFromJSON(
+      schema({field("ts", int32()), field("val", int64()), field("sum", int64())}),
+      {R"([[5, 5, 5], [3, 3, 3], [2, 2, 5], [1, 1, 3], [null, 7, 7]])"});
+  AssertTablesEqual(*expected, *output, /*same_chunk_layout=*/false);
+}
+
+TEST(WindowNode, EmptyInput) {
+  auto input = TableFromJSON(schema({field("ts", int32()), field("val", int64())}), {});
+  WindowNodeOptions options({{"row_number", std::nullopt, "row_number"},
+                             {"sum", FieldRef("val"), "sum"}},
+                            /*partition_keys=*/{}, Ordering({SortKey("ts")}));
+  ASSERT_OK_AND_ASSIGN(auto output, RunWindow(std::move(input), std::move(options)));
+  ASSERT_EQ(output->num_rows(), 0);
+  ASSERT_EQ(output->num_columns(), 4);
+}
+
+TEST(WindowNode, Errors) {
+  auto check_error = [](WindowFunction function, const std::string& message) {
+    WindowNodeOptions options({std::move(function)}, {"part"},
+                              Ordering({SortKey("part")}));
+    EXPECT_THAT(RunWindow(MakeInput(), std::move(options)),
+                Raises(StatusCode::Invalid, ::testing::HasSubstr(message)));
+  };
+  check_error({"median", FieldRef("val"), "out"}, "Unknown window function 'median'");
+  check_error({"rank", FieldRef("val"), "out"}, "does not take a target");
+  check_error({"sum", std::nullopt, "out"}, "requires a target");
+  check_error({"sum", FieldRef("val"), "out", WindowFrame(WindowFrame::ROWS, -1, 0)},
+              "must not be negative");
+
+  // RANGE offsets need a numeric ordering key
+  WindowNodeOptions options(
+      {{"sum", FieldRef("val"), "out", WindowFrame(WindowFrame::RANGE, 1, 0)}},
+      /*partition_keys=*/{}, Ordering({SortKey("part")}));
+  EXPECT_THAT(RunWindow(MakeInput(), std::move(options)),
+              Raises(StatusCode::NotImplemented, ::testing::HasSubstr("RANGE")));
+}
+
+}  // namespace acero
+}  // namespace arrow
@@ -18,10 +18,13 @@
 #include "arrow/adapters/orc/adapter.h"
 
 #include <algorithm>
+#include <deque>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #ifdef ARROW_ORC_NEED_TIME_ZONE_DATABASE_CHECK
@@ -29,6 +32,7 @@
 #endif
 
 #include "arrow/adapters/orc/util.h"
+#include "arrow/array/statistics.h"
 #include "arrow/builder.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
@@ -40,9 +44,12 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/future.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 #include "orc/Exceptions.hh"
+#include "orc/Statistics.hh"
 
 // alias to not interfere with nested orc namespace
 namespace liborc = orc;
@@ -132,14 +139,20 @@ class ArrowInputFile : public liborc::InputStream {
 // The number of rows to read in a ColumnVectorBatch
 constexpr int64_t kReadRowsBatch = 1000;
 
+// A range of rows, given by the number of its first row in the file and its length
+using RowRange = std::pair<int64_t, int64_t>;
+
 class OrcStripeReader : public RecordBatchReader {
  public:
+  // If row_ranges isn't empty, only the rows in these ranges are read
   OrcStripeReader(std::unique_ptr<liborc::RowReader> row_reader,
-                  std::shared_ptr<Schema> schema, int64_t batch_size, MemoryPool* pool)
+                  std::shared_ptr<Schema> schema, int64_t batch_size, MemoryPool* pool,
+                  std::vector<RowRange> row_ranges = {})
       : row_reader_(std::move(row_reader)),
         schema_(schema),
         pool_(pool),
-        batch_size_{batch_size} {}
+        batch_size_{batch_size},
+        row_ranges_(std::move(row_ranges)) {}
 
   std::shared_ptr<Schema> schema() const override { return schema_; }
 
@@ -148,13 +161,29 @@ class OrcStripeReader : public RecordBatchReader {
     std::unique_ptr<RecordBatchBuilder> builder;
 
     ORC_BEGIN_CATCH_NOT_OK
-    batch = row_reader_->createRowBatch(batch_size_);
+    int64_t num_rows = batch_size_;
+    if (!row_ranges_.empty()) {
+      if (range_remaining_ == 0) {
+        if (next_range_ == row_ranges_.size()) {
+          out->reset();
+          return Status::OK();
+        }
+        const RowRange& range = row_ranges_[next_range_++];
+        row_reader_->seekToRow(static_cast<uint64_t>(range.first));
+        range_remaining_ = range.second;
+      }
+      num_rows = std::min(num_rows, range_remaining_);
+    }
+    batch = row_reader_->createRowBatch(num_rows);
 
     const liborc::Type& type = row_reader_->getSelectedType();
     if (!row_reader_->next(*batch)) {
       out->reset();
       return Status::OK();
     }
+    if (!row_ranges_.empty()) {
+      range_remaining_ -= static_cast<int64_t>(batch->numElements);
+    }
 
     ARROW_ASSIGN_OR_RAISE(builder,
                           RecordBatchBuilder::Make(schema_, pool_, batch->numElements));
@@ -175,6 +204,9 @@ class OrcStripeReader : public RecordBatchReader {
   std::shared_ptr<Schema> schema_;
   MemoryPool* pool_;
   int64_t batch_size_;
+  std::vector<RowRange> row_ranges_;
+  size_t next_range_ = 0;
+  int64_t range_remaining_ = 0;
 };
 
 liborc::RowReaderOptions DefaultRowReaderOptions() {
@@ -204,6 +236,55 @@ Status CheckTimeZoneDatabaseAvailability() {
 }
 #endif
 
+// Convert the statistics of a top-level column with the given number of rows, or
+// return null if there are none
+std::shared_ptr<ArrayStatistics> ConvertColumnStatistics(
+    const liborc::ColumnStatistics* orc_statistics, int64_t num_rows) {
+  if (orc_statistics == nullptr) {
+    return nullptr;
+  }
+  auto statistics = std::make_shared<ArrayStatistics>();
+  // The number of values excludes nulls
+  const auto num_values = static_cast<int64_t>(orc_statistics->getNumberOfValues());
+  if (!orc_statistics->hasNull()) {
+    statistics->null_count = 0;
+  } else if (num_values <= num_rows) {
+    statistics->null_count = num_rows - num_values;
+  }
+
+  auto set_min_max = [&](ArrayStatistics::ValueType min, ArrayStatistics::ValueType max) {
+    statistics->min = std::move(min);
+    statistics->is_min_exact = true;
+    statistics->max = std::move(max);
+    statistics->is_max_exact = true;
+  };
+  if (auto integer_statistics =
+          dynamic_cast<const liborc::IntegerColumnStatistics*>(orc_statistics)) {
+    if (integer_statistics->hasMinimum() && integer_statistics->hasMaximum()) {
+      set_min_max(integer_statistics->getMinimum(), integer_statistics->getMaximum());
+    }
+  } else if (auto double_statistics =
+                 dynamic_cast<const liborc::DoubleColumnStatistics*>(orc_statistics)) {
+    if (double_statistics->hasMinimum() && double_statistics->hasMaximum()) {
+      set_min_max(double_statistics->getMinimum(), double_statistics->getMaximum());
+    }
+  } else if (auto string_statistics =
+                 dynamic_cast<const liborc::StringColumnStatistics*>(orc_statistics)) {
+    // Strings longer than the writer's limit only have (inexact) bounds, which
+    // hasMinimum() and hasMaximum() don't report
+    if (string_statistics->hasMinimum() && string_statistics->hasMaximum()) {
+      set_min_max(string_statistics->getMinimum(), string_statistics->getMaximum());
+    }
+  } else if (auto boolean_statistics =
+                 dynamic_cast<const liborc::BooleanColumnStatistics*>(orc_statistics)) {
+    if (boolean_statistics->hasCount() && num_values > 0) {
+      set_min_max(boolean_statistics->getFalseCount() == 0,
+                  boolean_statistics->getTrueCount() > 0);
+    }
+  }
+  return statistics;
+}
+
 }  // namespace
 
 class ORCFileReader::Impl {
@@ -313,6 +394,65 @@ class ORCFileReader::Impl {
 
   std::string GetSerializedFileTail() { return reader_->getSerializedFileTail(); }
 
+  Result<std::shared_ptr<ArrayStatistics>> GetColumnStatistics(int field_index) {
+    ARROW_ASSIGN_OR_RAISE(auto column_id, GetColumnId(field_index));
+    std::unique_ptr<liborc::Statistics> statistics;
+    ORC_CATCH_NOT_OK(statistics = reader_->getStatistics());
+    return ConvertColumnStatistics(statistics->getColumnStatistics(column_id),
+                                   NumberOfRows());
+  }
+
+  Result<std::shared_ptr<ArrayStatistics>> GetStripeColumnStatistics(int64_t stripe,
+                                                                     int field_index) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    ARROW_ASSIGN_OR_RAISE(auto column_id, GetColumnId(field_index));
+    if (stripe >= GetNumberOfStripeStatistics()) {
+      return nullptr;
+    }
+    std::unique_ptr<liborc::StripeStatistics> statistics;
+    ORC_CATCH_NOT_OK(statistics = reader_->getStripeStatistics(
+                         static_cast<uint64_t>(stripe), /*includeRowIndex=*/false));
+    return ConvertColumnStatistics(statistics->getColumnStatistics(column_id),
+                                   stripes_[static_cast<size_t>(stripe)].num_rows);
+  }
+
+  Result<std::vector<std::shared_ptr<ArrayStatistics>>> GetRowGroupColumnStatistics(
+      int64_t stripe, int field_index) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    ARROW_ASSIGN_OR_RAISE(auto column_id, GetColumnId(field_index));
+    std::vector<std::shared_ptr<ArrayStatistics>> row_group_statistics;
+    const int64_t stride = GetRowIndexStride();
+    if (stride <= 0 || stripe >= GetNumberOfStripeStatistics()) {
+      return row_group_statistics;
+    }
+    std::unique_ptr<liborc::StripeStatistics> statistics;
+    {
+      // Reading the row index may update the state of the ORC reader
+      std::lock_guard<std::mutex> lock(mutex_);
+      ORC_CATCH_NOT_OK(statistics = reader_->getStripeStatistics(
+                           static_cast<uint64_t>(stripe), /*includeRowIndex=*/true));
+    }
+    const int64_t num_rows = stripes_[static_cast<size_t>(stripe)].num_rows;
+    const auto num_row_groups = statistics->getNumberOfRowIndexStats(column_id);
+    for (uint32_t i = 0; i < num_row_groups; ++i) {
+      const int64_t first_row = i * stride;
+      row_group_statistics.push_back(
+          ConvertColumnStatistics(statistics->getRowIndexStatistics(column_id, i),
+                                  std::min(stride, num_rows - first_row)));
+    }
+    return row_group_statistics;
+  }
+
+  Result<uint32_t> GetColumnId(int field_index) {
+    const liborc::Type& type = reader_->getType();
+    ARROW_RETURN_IF(
+        field_index < 0 || static_cast<uint64_t>(field_index) >= type.getSubtypeCount(),
+        Status::Invalid("Out of bounds field index: ", field_index));
+    return static_cast<uint32_t>(type.getSubtype(field_index)->getColumnId());
+  }
+
   Result<std::shared_ptr<Schema>> ReadSchema() {
     const liborc::Type& type = reader_->getType();
     return GetArrowSchema(type);
@@ -526,6 +666,47 @@ class ORCFileReader::Impl {
                                              pool_);
   }
 
+  Result<std::shared_ptr<RecordBatchReader>> GetStripeReader(
+      int64_t stripe, int64_t batch_size, const std::vector<int>& include_indices,
+      const std::vector<int>& row_groups) {
+    liborc::RowReaderOptions opts = DefaultRowReaderOptions();
+    if (!include_indices.empty()) {
+      RETURN_NOT_OK(SelectIndices(&opts, include_indices));
+    }
+    RETURN_NOT_OK(SelectStripe(&opts, stripe));
+    const StripeInformation& stripe_info = stripes_[static_cast<size_t>(stripe)];
+
+    // Merge the consecutive row groups in ranges of rows
+    std::vector<RowRange> row_ranges;
+    if (!row_groups.empty()) {
+      const int64_t stride = GetRowIndexStride();
+      ARROW_RETURN_IF(stride <= 0, Status::Invalid("The ORC file has no row index"));
+      int previous_row_group = -1;
+      for (int row_group : row_groups) {
+        const int64_t first_row = row_group * stride;
+        ARROW_RETURN_IF(
+            row_group <= previous_row_group || first_row >= stripe_info.num_rows,
+            Status::Invalid("Invalid row group: ", row_group));
+        const int64_t num_rows = std::min(stride, stripe_info.num_rows - first_row);
+        if (row_group == previous_row_group + 1 && !row_ranges.empty()) {
+          row_ranges.back().second += num_rows;
+        } else {
+          row_ranges.emplace_back(stripe_info.first_row_id + first_row, num_rows);
+        }
+        previous_row_group = row_group;
+      }
+    }
+
+    std::unique_ptr<liborc::RowReader> row_reader;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ORC_CATCH_NOT_OK(row_reader = reader_->createRowReader(opts));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto schema, GetArrowSchema(row_reader->getSelectedType()));
+    return std::make_shared<OrcStripeReader>(std::move(row_reader), std::move(schema),
+                                             batch_size, pool_, std::move(row_ranges));
+  }
+
   Result<std::shared_ptr<RecordBatchReader>> GetRecordBatchReader(
       int64_t batch_size, const std::vector<std::string>& include_names) {
     liborc::RowReaderOptions opts = DefaultRowReaderOptions();
@@ -553,6 +734,9 @@ class ORCFileReader::Impl {
   std::unique_ptr<liborc::Reader> reader_;
   std::vector<StripeInformation> stripes_;
   int64_t current_row_;
+  // Serializes the calls to the ORC reader made by the methods which can be called
+  // concurrently
+  std::mutex mutex_;
 };
 
 ORCFileReader::ORCFileReader() { impl_.reset(new ORCFileReader::Impl()); }
@@ -630,6 +814,12 @@ Result<std::shared_ptr<RecordBatchReader>> ORCFileReader::NextStripeReader(
   return impl_->NextStripeReader(batch_size, include_indices);
 }
 
+Result<std::shared_ptr<RecordBatchReader>> ORCFileReader::GetStripeReader(
+    int64_t stripe, int64_t batch_size, const std::vector<int>& include_indices,
+    const std::vector<int>& row_groups) {
+  return impl_->GetStripeReader(stripe, batch_size, include_indices, row_groups);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
@@ -678,6 +868,21 @@ std::string ORCFileReader::GetSerializedFileTail() {
   return impl_->GetSerializedFileTail();
 }
 
+Result<std::shared_ptr<ArrayStatistics>> ORCFileReader::GetColumnStatistics(
+    int field_index) {
+  return impl_->GetColumnStatistics(field_index);
+}
+
+Result<std::shared_ptr<ArrayStatistics>> ORCFileReader::GetStripeColumnStatistics(
+    int64_t stripe, int field_index) {
+  return impl_->GetStripeColumnStatistics(stripe, field_index);
+}
+
+Result<std::vector<std::shared_ptr<ArrayStatistics>>>
+ORCFileReader::GetRowGroupColumnStatistics(int64_t stripe, int field_index) {
+  return impl_->GetRowGroupColumnStatistics(stripe, field_index);
+}
+
 namespace {
 
 class ArrowOutputStream : public liborc::OutputStream {
@@ -786,6 +991,14 @@ class ORCFileWriter::Impl {
             *arrow_schema_, "\nCurrent:\n", *table.schema());
       }
     }
+    if (write_options_.use_threads &&
+        !::arrow::internal::GetCpuThreadPool()->OwnsThisThread()) {
+      return WriteConcurrently(table);
+    }
+    // Keep the order of the batches of previous writes
+    while (!pending_batches_.empty()) {
+      RETURN_NOT_OK(AddPendingBatch());
+    }
     auto batch_size = static_cast<uint64_t>(write_options_.batch_size);
     int64_t num_rows = table.num_rows();
     const int num_cols = table.num_columns();
@@ -810,6 +1023,9 @@ class ORCFileWriter::Impl {
   }
 
   Status Close() {
+    while (!pending_batches_.empty()) {
+      RETURN_NOT_OK(AddPendingBatch());
+    }
     if (writer_) {
       writer_->close();
     }
@@ -817,11 +1033,62 @@ class ORCFileWriter::Impl {
   }
 
  private:
+  // A batch of rows being converted to ORC on the CPU thread pool
+  struct PendingBatch {
+    // Keeps alive the Arrow data referenced by the ORC batch
+    std::shared_ptr<Table> slice;
+    Future<std::shared_ptr<liborc::ColumnVectorBatch>> batch;
+  };
+
+  // Convert the batches of rows of the table in parallel, and add them to the ORC
+  // writer in order, while at most max_pending_batches are converted ahead of it
+  Status WriteConcurrently(const Table& table) {
+    const int64_t batch_size = write_options_.batch_size;
+    const auto max_pending_batches =
+        static_cast<size_t>(std::max(write_options_.max_pending_batches, 1));
+    auto executor = ::arrow::internal::GetCpuThreadPool();
+    for (int64_t offset = 0; offset < table.num_rows(); offset += batch_size) {
+      while (pending_batches_.size() >= max_pending_batches) {
+        RETURN_NOT_OK(AddPendingBatch());
+      }
+      std::shared_ptr<liborc::ColumnVectorBatch> batch;
+      ORC_CATCH_NOT_OK(batch = writer_->createRowBatch(static_cast<uint64_t>(batch_size)))
+      auto slice = table.Slice(offset, batch_size);
+      auto converted = DeferNotOk(executor->Submit(
+          [slice, batch]() -> Result<std::shared_ptr<liborc::ColumnVectorBatch>> {
+            auto root = internal::checked_cast<liborc::StructVectorBatch*>(batch.get());
+            ORC_BEGIN_CATCH_NOT_OK
+            for (int i = 0; i < slice->num_columns(); i++) {
+              int arrow_chunk_offset = 0;
+              int64_t arrow_index_offset = 0;
+              RETURN_NOT_OK(adapters::orc::WriteBatch(
+                  *slice->column(i), slice->num_rows(), &arrow_chunk_offset,
+                  &arrow_index_offset, root->fields[i]));
+            }
+            ORC_END_CATCH_NOT_OK
+            root->numElements = static_cast<uint64_t>(slice->num_rows());
+            return batch;
+          }));
+      pending_batches_.push_back({std::move(slice), std::move(converted)});
+    }
+    return Status::OK();
+  }
+
+  // Add the oldest pending batch to the ORC writer, once it is converted
+  Status AddPendingBatch() {
+    PendingBatch pending = std::move(pending_batches_.front());
+    pending_batches_.pop_front();
+    ARROW_ASSIGN_OR_RAISE(auto batch, pending.batch.result());
+    ORC_CATCH_NOT_OK(writer_->add(*batch));
+    return Status::OK();
+  }
+
   std::unique_ptr<liborc::Writer> writer_;
   std::unique_ptr<liborc::OutputStream> out_stream_;
   std::shared_ptr<Schema> arrow_schema_;
   WriteOptions write_options_;
   std::unique_ptr<liborc::Type> orc_schema_;
+  std::deque<PendingBatch> pending_batches_;
 };
 
 ORCFileWriter::~ORCFileWriter() {}
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "arrow/adapters/orc/options.h"
+#include "arrow/array/statistics.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
@@ -163,6 +164,24 @@ class ARROW_EXPORT ORCFileReader {
   Result<std::shared_ptr<RecordBatchReader>> NextStripeReader(
       int64_t batch_size, const std::vector<int>& include_indices);
 
+  /// \brief Get a record batch iterator for a single stripe.
+  ///
+  /// Unlike NextStripeReader(), this doesn't depend on the position set by Seek(),
+  /// and can be called concurrently from several threads.  The returned readers
+  /// are independent, so different stripes can be read in parallel.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \param[in] batch_size the maximum number of rows in each record batch
+  /// \param[in] include_indices the selected field indices to read, if not empty
+  /// (otherwise all fields are read)
+  /// \param[in] row_groups the indices of the row groups of the stripe to read, in
+  /// increasing order, if not empty (otherwise all rows are read).  A row group
+  /// has GetRowIndexStride() rows, except the last one of the stripe.
+  /// \return the stripe reader
+  Result<std::shared_ptr<RecordBatchReader>> GetStripeReader(
+      int64_t stripe, int64_t batch_size, const std::vector<int>& include_indices,
+      const std::vector<int>& row_groups = {});
+
   /// \brief Get a record batch iterator for the entire file.
   ///
   /// Each record batch will have up to `batch_size` rows.
@@ -262,6 +281,40 @@ class ARROW_EXPORT ORCFileReader {
   /// \return a string of bytes with the file tail
   std::string GetSerializedFileTail();
 
+  /// \brief Return the statistics of a top-level field over the whole file
+  ///
+  /// The null count is filled in, and the minimum and maximum values for integer,
+  /// floating-point, string and boolean fields.
+  ///
+  /// \param[in] field_index the index of the field in the schema of the file
+  /// \return the statistics, or null if the file has none for the field
+  Result<std::shared_ptr<ArrayStatistics>> GetColumnStatistics(int field_index);
+
+  /// \brief Return the statistics of a top-level field in a stripe
+  ///
+  /// \see GetColumnStatistics
+  ///
+  /// \param[in] stripe the index of the stripe
+  /// \param[in] field_index the index of the field in the schema of the file
+  /// \return the statistics, or null if the file has none for the stripe or field
+  Result<std::shared_ptr<ArrayStatistics>> GetStripeColumnStatistics(int64_t stripe,
+                                                                     int field_index);
+
+  /// \brief Return the statistics of a top-level field in each row group of a stripe
+  ///
+  /// The statistics are read from the row index of the stripe, and can be used to
+  /// select the row groups passed to GetStripeReader().  This can be called
+  /// concurrently from several threads.
+  ///
+  /// \see GetColumnStatistics
+  ///
+  /// \param[in] stripe the index of the stripe
+  /// \param[in] field_index the index of the field in the schema of the file
+  /// \return the statistics of each row group, null for the row groups without
+  /// statistics, or empty if the file has no row index
+  Result<std::vector<std::shared_ptr<ArrayStatistics>>> GetRowGroupColumnStatistics(
+      int64_t stripe, int field_index);
+
   /// \brief Return the metadata read from the ORC file
   ///
   /// \return A KeyValueMetadata object containing the ORC metadata
@@ -456,6 +456,120 @@ TEST(TestAdapterRead, ReadIntAndStringFileMultipleStripes) {
   EXPECT_EQ(num_rows / reader_batch_size, batches);
 }
 
+TEST(TestAdapterRead, ReadColumnStatistics) {
+  MemoryOutputStream mem_stream(kDefaultMemStreamSize);
+  std::unique_ptr<liborc::Type> type(
+      liborc::Type::buildTypeFromString("struct<col1:bigint,col2:string>"));
+
+  constexpr uint64_t stripe_size = 1024;  // 1K
+  constexpr uint64_t stripe_count = 3;
+  constexpr uint64_t stripe_row_count = 16384;
+  const std::string stripe_strings[stripe_count] = {"a", "b", "c"};
+
+  auto writer = CreateWriter(stripe_size, *type, &mem_stream);
+  auto batch = writer->createRowBatch(stripe_row_count);
+  auto struct_batch = internal::checked_cast<liborc::StructVectorBatch*>(batch.get());
+  auto long_batch =
+      internal::checked_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+  auto str_batch =
+      internal::checked_cast<liborc::StringVectorBatch*>(struct_batch->fields[1]);
+  for (uint64_t j = 0; j < stripe_count; ++j) {
+    for (uint64_t i = 0; i < stripe_row_count; ++i) {
+      long_batch->data[i] = static_cast<int64_t>(j * stripe_row_count + i);
+      str_batch->data[i] = const_cast<char*>(stripe_strings[j].data());
+      str_batch->length[i] = static_cast<int64_t>(stripe_strings[j].size());
+    }
+    struct_batch->numElements = stripe_row_count;
+    long_batch->numElements = stripe_row_count;
+    str_batch->numElements = stripe_row_count;
+    writer->add(*batch);
+  }
+  writer->close();
+
+  std::shared_ptr<io::RandomAccessFile> in_stream(new io::BufferReader(
+      std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(mem_stream.getData()),
+                               static_cast<int64_t>(mem_stream.getLength()))));
+  ASSERT_OK_AND_ASSIGN(
+      auto reader, adapters::orc::ORCFileReader::Open(in_stream, default_memory_pool()));
+  ASSERT_EQ(stripe_count, reader->NumberOfStripes());
+
+  ArrayStatistics expected;
+  expected.null_count = 0;
+  expected.min = int64_t{0};
+  expected.is_min_exact = true;
+  expected.max = static_cast<int64_t>(stripe_count * stripe_row_count - 1);
+  expected.is_max_exact = true;
+  ASSERT_OK_AND_ASSIGN(auto statistics, reader->GetColumnStatistics(0));
+  ASSERT_NE(statistics, nullptr);
+  ASSERT_EQ(expected, *statistics);
+
+  for (uint64_t j = 0; j < stripe_count; ++j) {
+    expected.min = static_cast<int64_t>(j * stripe_row_count);
+    expected.max = static_cast<int64_t>((j + 1) * stripe_row_count - 1);
+    ASSERT_OK_AND_ASSIGN(statistics, reader->GetStripeColumnStatistics(j, 0));
+    ASSERT_NE(statistics, nullptr);
+    ASSERT_EQ(expected, *statistics);
+
+    ASSERT_OK_AND_ASSIGN(statistics, reader->GetStripeColumnStatistics(j, 1));
+    ASSERT_NE(statistics, nullptr);
+    ASSERT_EQ(ArrayStatistics::ValueType{stripe_strings[j]}, statistics->min);
+    ASSERT_EQ(ArrayStatistics::ValueType{stripe_strings[j]}, statistics->max);
+  }
+
+  ASSERT_RAISES(Invalid, reader->GetColumnStatistics(2));
+  ASSERT_RAISES(Invalid, reader->GetStripeColumnStatistics(stripe_count, 0));
+}
+
+TEST(TestAdapterRead, ReadRowGroups) {
+  auto table_schema = schema({field("i64", int64()), field("str", utf8())});
+  auto table = TableFromJSON(
+      table_schema, {R"([[1, "a"], [2, "b"], [3, "c"], [null, "d"], [5, "e"], [6, "f"],
+                        [7, "g"]])"});
+  auto write_options = adapters::orc::WriteOptions();
+  write_options.row_index_stride = 2;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       adapters::orc::ORCFileWriter::Open(sink.get(), write_options));
+  ASSERT_OK(writer->Write(*table));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  std::shared_ptr<io::RandomAccessFile> in_stream(new io::BufferReader(buffer));
+  ASSERT_OK_AND_ASSIGN(
+      auto reader, adapters::orc::ORCFileReader::Open(in_stream, default_memory_pool()));
+  ASSERT_EQ(1, reader->NumberOfStripes());
+
+  ASSERT_OK_AND_ASSIGN(auto statistics, reader->GetRowGroupColumnStatistics(0, 0));
+  ASSERT_EQ(4u, statistics.size());
+  ArrayStatistics expected;
+  expected.null_count = 1;
+  expected.min = int64_t{3};
+  expected.is_min_exact = true;
+  expected.max = int64_t{3};
+  expected.is_max_exact = true;
+  ASSERT_NE(statistics[1], nullptr);
+  ASSERT_EQ(expected, *statistics[1]);
+  expected.null_count = 0;
+  expected.min = int64_t{7};
+  expected.max = int64_t{7};
+  ASSERT_NE(statistics[3], nullptr);
+  ASSERT_EQ(expected, *statistics[3]);
+
+  // The consecutive row groups 2 and 3 are read together, in batches of 2 rows
+  ASSERT_OK_AND_ASSIGN(auto stripe_reader,
+                       reader->GetStripeReader(0, /*batch_size=*/2, {1}, {0, 2, 3}));
+  ASSERT_OK_AND_ASSIGN(auto batches, stripe_reader->ToRecordBatches());
+  ASSERT_EQ(3u, batches.size());
+  ASSERT_OK_AND_ASSIGN(auto read_table,
+                       Table::FromRecordBatches(stripe_reader->schema(), batches));
+  AssertTablesEqual(*TableFromJSON(schema({field("str", utf8())}),
+                                   {R"([["a"], ["b"], ["e"], ["f"], ["g"]])"}),
+                    *read_table, /*same_chunk_layout=*/false);
+
+  ASSERT_RAISES(Invalid, reader->GetStripeReader(0, 2, {}, {2, 1}));
+  ASSERT_RAISES(Invalid, reader->GetStripeReader(0, 2, {}, {4}));
+  ASSERT_RAISES(Invalid, reader->GetRowGroupColumnStatistics(1, 0));
+}
+
 TEST(TestAdapterRead, ReadCharAndVarcharType) {
   MemoryOutputStream mem_stream(kDefaultMemStreamSize);
   auto orc_type = liborc::Type::buildTypeFromString("struct<c1:char(6),c2:varchar(6)>");
@@ -818,6 +932,33 @@ TEST_F(TestORCWriterNoConversion, writeNoNulls) {
 TEST_F(TestORCWriterNoConversion, writeMixed) {
   SchemaORCWriteReadTest(table_schema, 9405, 1, 20, 0.6, kDefaultSmallMemStreamSize * 5);
 }
+TEST_F(TestORCWriterNoConversion, writeWithThreads) {
+  const std::shared_ptr<Table> table =
+      GenerateRandomTable(table_schema, 9405, 1, 20, 0.6);
+  // Converting the batches on other threads doesn't change the written file
+  auto write = [&](bool use_threads) -> std::shared_ptr<Buffer> {
+    EXPECT_OK_AND_ASSIGN(auto buffer_output_stream,
+                         io::BufferOutputStream::Create(kDefaultSmallMemStreamSize * 5));
+    auto write_options = adapters::orc::WriteOptions();
+    write_options.use_threads = use_threads;
+    write_options.max_pending_batches = 2;
+    EXPECT_OK_AND_ASSIGN(auto writer, adapters::orc::ORCFileWriter::Open(
+                                          buffer_output_stream.get(), write_options));
+    ARROW_EXPECT_OK(writer->Write(*table->Slice(0, 5000)));
+    ARROW_EXPECT_OK(writer->Write(*table->Slice(5000)));
+    ARROW_EXPECT_OK(writer->Close());
+    EXPECT_OK_AND_ASSIGN(auto buffer, buffer_output_stream->Finish());
+    return buffer;
+  };
+  auto buffer = write(/*use_threads=*/true);
+  AssertBufferEqual(*write(/*use_threads=*/false), *buffer);
+
+  std::shared_ptr<io::RandomAccessFile> in_stream(new io::BufferReader(buffer));
+  ASSERT_OK_AND_ASSIGN(
+      auto reader, adapters::orc::ORCFileReader::Open(in_stream, default_memory_pool()));
+  ASSERT_OK_AND_ASSIGN(auto read_table, reader->Read());
+  AssertTablesEqual(*table, *read_table, false, false);
+}
 TEST_F(TestORCWriterNoConversion, writeAllNulls) {
   SchemaORCWriteReadTest(table_schema, 4006, 1, 5, 1);
 }
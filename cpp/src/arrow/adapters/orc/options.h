@@ -113,6 +113,14 @@ struct ARROW_EXPORT WriteOptions {
   std::vector<int64_t> bloom_filter_columns;
   /// The upper limit of the false-positive rate of the bloom filter, default 0.05
   double bloom_filter_fpp = 0.05;
+  /// Convert the next batches of rows from Arrow to ORC on the CPU thread pool while
+  /// the ORC writer encodes and compresses the current one, default false.  The
+  /// batches are written in order.  This is ignored when writing from a thread of the
+  /// CPU thread pool.
+  bool use_threads = false;
+  /// The maximum number of batches of rows converted ahead of the ORC writer when
+  /// use_threads is true, which bounds the memory used by the conversion, default 8
+  int32_t max_pending_batches = 8;
 };
 
 }  // namespace orc
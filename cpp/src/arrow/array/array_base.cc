@@ -211,12 +211,86 @@ struct ScalarFromArraySlotImpl {
   std::shared_ptr<Scalar> out_;
 };
 
+// Resolves the array type once and then materializes a whole range of slots.
+// Primitive and base binary values are wrapped directly in their concrete scalar
+// type, skipping the per-slot type switches of MakeScalar and GetScalar. Other
+// types defer to ScalarFromArraySlotImpl slot by slot.
+struct ScalarsFromArrayRangeImpl {
+  template <typename T>
+  using ScalarType = typename TypeTraits<T>::ScalarType;
+
+  template <typename ArrayType, typename MakeValue>
+  Status FinishEach(const ArrayType& a, MakeValue&& make_value) {
+    using T = typename ArrayType::TypeClass;
+    const std::shared_ptr<DataType>& type = a.type();
+    // Null slots share a single null scalar
+    std::shared_ptr<Scalar> null;
+    for (int64_t i = 0; i < length_; ++i) {
+      const int64_t index = offset_ + i;
+      if (a.IsNull(index)) {
+        if (!null) null = MakeNullScalar(type);
+        out_.push_back(null);
+      } else {
+        out_.push_back(std::make_shared<ScalarType<T>>(make_value(index), type));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Dispatch on the most derived array class, so that e.g. StringArray produces
+  // StringScalar rather than the BinaryScalar of its BaseBinaryArray base.
+  template <typename ArrayType, typename T = typename ArrayType::TypeClass>
+  enable_if_has_c_type<T, Status> Visit(const ArrayType& a) {
+    return FinishEach(a, [&](int64_t i) { return a.Value(i); });
+  }
+
+  template <typename ArrayType, typename T = typename ArrayType::TypeClass>
+  enable_if_base_binary<T, Status> Visit(const ArrayType& a) {
+    return FinishEach(
+        a, [&](int64_t i) { return Buffer::FromString(std::string(a.GetView(i))); });
+  }
+
+  Status Visit(const Array& a) {
+    for (int64_t i = 0; i < length_; ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto scalar,
+                            ScalarFromArraySlotImpl(a, offset_ + i).Finish());
+      out_.push_back(std::move(scalar));
+    }
+    return Status::OK();
+  }
+
+  Result<ScalarVector> Finish() && {
+    if (offset_ < 0 || length_ < 0 || offset_ > array_.length() - length_) {
+      return Status::IndexError("range [", offset_, ", ", offset_ + length_,
+                                ") is out-of-bounds for array of length ",
+                                array_.length());
+    }
+    out_.reserve(static_cast<size_t>(length_));
+    RETURN_NOT_OK(VisitArrayInline(array_, this));
+    return std::move(out_);
+  }
+
+  ScalarsFromArrayRangeImpl(const Array& array, int64_t offset, int64_t length)
+      : array_(array), offset_(offset), length_(length) {}
+
+  const Array& array_;
+  int64_t offset_;
+  int64_t length_;
+  ScalarVector out_;
+};
+
 }  // namespace internal
 
 Result<std::shared_ptr<Scalar>> Array::GetScalar(int64_t i) const {
   return internal::ScalarFromArraySlotImpl{*this, i}.Finish();
 }
 
+Result<ScalarVector> Array::GetScalars(int64_t offset, int64_t length) const {
+  return internal::ScalarsFromArrayRangeImpl{*this, offset, length}.Finish();
+}
+
+Result<ScalarVector> Array::GetScalars() const { return GetScalars(0, length()); }
+
 std::string Array::Diff(const Array& other) const {
   std::stringstream diff;
   ARROW_IGNORE_EXPR(Equals(other, EqualOptions().diff_sink(&diff)));
@@ -82,6 +82,15 @@ class ARROW_EXPORT Array {
   /// \brief Return a Scalar containing the value of this array at i
   Result<std::shared_ptr<Scalar>> GetScalar(int64_t i) const;
 
+  /// \brief Return Scalars for the values in [offset, offset + length)
+  ///
+  /// Equivalent to calling GetScalar() for each slot, but the type dispatch
+  /// happens once for the whole range. Null slots may share a Scalar instance.
+  Result<ScalarVector> GetScalars(int64_t offset, int64_t length) const;
+
+  /// \brief Return Scalars for all values of this array
+  Result<ScalarVector> GetScalars() const;
+
   /// Size in the number of elements this array contains.
   int64_t length() const { return data_->length; }
 
@@ -663,6 +663,60 @@ class TestStringBuilder : public ::testing::Test {
     CheckStringArray(*result_, strings, valid_bytes, reps);
   }
 
+  void TestOffsetsAppend() {
+    std::vector<std::string> strings = {"", "bb", "a", "", "ccc"};
+    std::vector<uint8_t> valid_bytes = {1, 1, 1, 0, 1};
+    const std::string data = "zzbbaccc";
+    const std::vector<offset_type> offsets = {2, 2, 4, 5, 5, 8};
+    // Validity bitmap starting at bit 3
+    std::vector<uint8_t> validity(2, 0);
+    for (size_t i = 0; i < valid_bytes.size(); ++i) {
+      bit_util::SetBitTo(validity.data(), 3 + i, valid_bytes[i] != 0);
+    }
+
+    int N = static_cast<int>(strings.size());
+    int reps = 100;
+
+    for (int j = 0; j < reps; ++j) {
+      ASSERT_OK(builder_->AppendValues(offsets.data(),
+                                       reinterpret_cast<const uint8_t*>(data.data()), N,
+                                       validity.data(), /*validity_offset=*/3));
+    }
+    ASSERT_OK(builder_->AppendValues(offsets.data(),
+                                     reinterpret_cast<const uint8_t*>(data.data()), 0));
+    Done();
+
+    ASSERT_EQ(reps * N, result_->length());
+    ASSERT_EQ(reps, result_->null_count());
+    ASSERT_EQ(reps * 6, result_->value_data()->size());
+
+    CheckStringArray(*result_, strings, valid_bytes, reps);
+  }
+
+  void TestStringViewsAppend() {
+    std::vector<std::string> strings = {"", "bb", "a", "", "ccc"};
+    std::vector<uint8_t> valid_bytes = {1, 1, 1, 0, 1};
+    std::vector<std::string_view> views = {"", "bb", "a", "ignored", "ccc"};
+    std::vector<uint8_t> validity(1, 0);
+    for (size_t i = 0; i < valid_bytes.size(); ++i) {
+      bit_util::SetBitTo(validity.data(), i, valid_bytes[i] != 0);
+    }
+
+    int N = static_cast<int>(strings.size());
+    int reps = 100;
+
+    for (int j = 0; j < reps; ++j) {
+      ASSERT_OK(builder_->AppendValues(views.data(), N, validity.data()));
+    }
+    Done();
+
+    ASSERT_EQ(reps * N, result_->length());
+    ASSERT_EQ(reps, result_->null_count());
+    ASSERT_EQ(reps * 6, result_->value_data()->size());
+
+    CheckStringArray(*result_, strings, valid_bytes, reps);
+  }
+
   void TestAppendCStringsWithValidBytes() {
     const char* strings[] = {nullptr, "aaa", nullptr, "ignored", ""};
     std::vector<uint8_t> valid_bytes = {1, 1, 1, 0, 1};
@@ -788,6 +842,10 @@ TYPED_TEST(TestStringBuilder, TestExtendCurrentUnsafe) {
 
 TYPED_TEST(TestStringBuilder, TestVectorAppend) { this->TestVectorAppend(); }
 
+TYPED_TEST(TestStringBuilder, TestOffsetsAppend) { this->TestOffsetsAppend(); }
+
+TYPED_TEST(TestStringBuilder, TestStringViewsAppend) { this->TestStringViewsAppend(); }
+
 TYPED_TEST(TestStringBuilder, TestAppendCStringsWithValidBytes) {
   this->TestAppendCStringsWithValidBytes();
 }
@@ -763,6 +763,38 @@ TEST_F(TestArray, TestMakeArrayFromScalar) {
   }
 }
 
+void AssertGetScalarsMatchGetScalar(const Array& array, int64_t offset, int64_t length) {
+  ASSERT_OK_AND_ASSIGN(auto scalars, array.GetScalars(offset, length));
+  ASSERT_EQ(static_cast<int64_t>(scalars.size()), length);
+  for (int64_t i = 0; i < length; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto expected, array.GetScalar(offset + i));
+    ASSERT_EQ(typeid(*scalars[i]), typeid(*expected));
+    AssertScalarsEqual(*expected, *scalars[i], /*verbose=*/true);
+  }
+}
+
+TEST_F(TestArray, TestGetScalars) {
+  for (auto scalar : GetScalars()) {
+    ARROW_SCOPED_TRACE("scalar type: ", scalar->type->ToString());
+    ASSERT_OK_AND_ASSIGN(auto array, MakeArrayFromScalar(*scalar, 8));
+    AssertGetScalarsMatchGetScalar(*array, 0, 8);
+    AssertGetScalarsMatchGetScalar(*array->Slice(3), 1, 4);
+    AssertGetScalarsMatchGetScalar(*array, 8, 0);
+
+    ASSERT_OK_AND_ASSIGN(auto nulls, MakeArrayOfNull(scalar->type, 3));
+    AssertGetScalarsMatchGetScalar(*nulls, 0, 3);
+  }
+
+  auto strings = ArrayFromJSON(utf8(), R"(["a", null, "bc", ""])");
+  AssertGetScalarsMatchGetScalar(*strings, 0, 4);
+  ASSERT_OK_AND_ASSIGN(auto all, strings->GetScalars());
+  ASSERT_EQ(all.size(), 4);
+
+  ASSERT_RAISES(IndexError, strings->GetScalars(2, 3));
+  ASSERT_RAISES(IndexError, strings->GetScalars(-1, 1));
+  ASSERT_RAISES(IndexError, strings->GetScalars(0, -1));
+}
+
 TEST_F(TestArray, TestMakeArrayFromScalarSliced) {
   // Regression test for ARROW-13437
   auto scalars = GetScalars();
@@ -3975,7 +4007,21 @@ TEST_F(TestArrayDataStatistics, CopyTo) {
 
 TEST_F(TestArrayDataStatistics, Slice) {
   auto sliced_data = data_->Slice(0, 1);
-  ASSERT_FALSE(sliced_data->statistics);
+  ASSERT_TRUE(sliced_data->statistics);
+  // The slice may have fewer nulls
+  ASSERT_FALSE(sliced_data->statistics->null_count.has_value());
+
+  ASSERT_TRUE(sliced_data->statistics->min.has_value());
+  ASSERT_EQ(min_, std::get<int64_t>(sliced_data->statistics->min.value()));
+  ASSERT_FALSE(sliced_data->statistics->is_min_exact);
+
+  ASSERT_TRUE(sliced_data->statistics->max.has_value());
+  ASSERT_EQ(max_, std::get<int64_t>(sliced_data->statistics->max.value()));
+  ASSERT_FALSE(sliced_data->statistics->is_max_exact);
+
+  // A slice over the whole array keeps its statistics
+  sliced_data = data_->Slice(0, data_->length);
+  ASSERT_EQ(sliced_data->statistics, data_->statistics);
 }
 
 template <typename PType>
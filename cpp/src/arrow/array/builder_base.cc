@@ -24,6 +24,7 @@
 #include "arrow/array/array_base.h"
 #include "arrow/array/builder_dict.h"
 #include "arrow/array/data.h"
+#include "arrow/array/statistics.h"
 #include "arrow/array/util.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
@@ -171,10 +172,8 @@ struct AppendScalarImpl {
           } else {
             RETURN_NOT_OK(builder->Append(/*is_valid=*/true, list.length()));
           }
-          for (int64_t i = 0; i < list.length(); i++) {
-            ARROW_ASSIGN_OR_RAISE(auto scalar, list.GetScalar(i));
-            RETURN_NOT_OK(builder->value_builder()->AppendScalar(*scalar));
-          }
+          ARROW_ASSIGN_OR_RAISE(auto scalars, list.GetScalars());
+          RETURN_NOT_OK(builder->value_builder()->AppendScalars(scalars));
         } else {
           RETURN_NOT_OK(builder_->AppendNull());
         }
@@ -361,6 +360,9 @@ Status ArrayBuilder::AppendScalars(const ScalarVector& scalars) {
 Status ArrayBuilder::Finish(std::shared_ptr<Array>* out) {
   std::shared_ptr<ArrayData> internal_data;
   RETURN_NOT_OK(FinishInternal(&internal_data));
+  if (attach_statistics_) {
+    internal_data->statistics = ComputeArrayStatistics(*internal_data);
+  }
   *out = MakeArray(internal_data);
   return Status::OK();
 }
@@ -203,6 +203,16 @@ class ARROW_EXPORT ArrayBuilder {
   /// \return The finalized Array object
   Result<std::shared_ptr<Array>> Finish();
 
+  /// \brief Whether Finish() attaches the statistics of the built array
+  ///
+  /// When enabled, Finish() computes the null count, minimum and maximum of
+  /// the built array in one pass (see ComputeArrayStatistics()) and attaches
+  /// them to the array. Disabled by default.
+  void set_attach_statistics(bool attach_statistics) {
+    attach_statistics_ = attach_statistics;
+  }
+  bool attach_statistics() const { return attach_statistics_; }
+
   /// \brief Return the type of the built Array
   virtual std::shared_ptr<DataType> type() const = 0;
 
@@ -312,6 +322,8 @@ class ARROW_EXPORT ArrayBuilder {
   int64_t length_ = 0;
   int64_t capacity_ = 0;
 
+  bool attach_statistics_ = false;
+
   // Child value array builders. These are owned by this class
   std::vector<std::shared_ptr<ArrayBuilder>> children_;
 
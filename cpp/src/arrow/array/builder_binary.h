@@ -283,26 +283,70 @@ class BaseBinaryBuilder
     return Status::OK();
   }
 
-  Status AppendArraySlice(const ArraySpan& array, int64_t offset,
-                          int64_t length) override {
-    auto bitmap = array.GetValues<uint8_t>(0, 0);
-    auto offsets = array.GetValues<offset_type>(1);
-    auto data = array.GetValues<uint8_t>(2, 0);
-    auto total_length = offsets[offset + length] - offsets[offset];
+  /// \brief Append a sequence of values given as Arrow offsets into their data
+  ///
+  /// The i-th value spans `data[offsets[i], offsets[i + 1])`.  The data of all the
+  /// values, null ones included, is copied at once and the offsets are rebased
+  /// without branching on validity.
+  ///
+  /// \param[in] offsets the length + 1 offsets of the values
+  /// \param[in] data the data the offsets point into
+  /// \param[in] length the number of values to append
+  /// \param[in] validity an optional validity bitmap, all values are valid if null
+  /// \param[in] validity_offset the offset of the first value in the validity bitmap
+  /// \return Status
+  Status AppendValues(const offset_type* offsets, const uint8_t* data, int64_t length,
+                      const uint8_t* validity = NULLPTR, int64_t validity_offset = 0) {
+    const int64_t total_length = offsets[length] - offsets[0];
     ARROW_RETURN_NOT_OK(Reserve(length));
     ARROW_RETURN_NOT_OK(ReserveData(total_length));
-    for (int64_t i = 0; i < length; i++) {
-      if (!bitmap || bit_util::GetBit(bitmap, array.offset + offset + i)) {
-        const offset_type start = offsets[offset + i];
-        const offset_type end = offsets[offset + i + 1];
-        UnsafeAppend(data + start, end - start);
-      } else {
-        UnsafeAppendNull();
-      }
+    const int64_t delta = value_data_builder_.length() - offsets[0];
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(static_cast<offset_type>(offsets[i] + delta));
     }
+    if (total_length > 0) {
+      value_data_builder_.UnsafeAppend(data + offsets[0], total_length);
+    }
+    UnsafeAppendToBitmap(validity, validity_offset, length);
     return Status::OK();
   }
 
+  /// \brief Append a sequence of string views in one shot
+  ///
+  /// Their total length is computed first so that the data is reserved at once.
+  /// The data of null values is not copied.
+  ///
+  /// \param[in] values the values to append
+  /// \param[in] length the number of values to append
+  /// \param[in] validity an optional validity bitmap, all values are valid if null
+  /// \param[in] validity_offset the offset of the first value in the validity bitmap
+  /// \return Status
+  Status AppendValues(const std::string_view* values, int64_t length,
+                      const uint8_t* validity = NULLPTR, int64_t validity_offset = 0) {
+    int64_t total_length = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      total_length += static_cast<int64_t>(values[i].size());
+    }
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ReserveData(total_length));
+    for (int64_t i = 0; i < length; ++i) {
+      const bool is_valid =
+          validity == NULLPTR || bit_util::GetBit(validity, validity_offset + i);
+      UnsafeAppendNextOffset();
+      value_data_builder_.UnsafeAppend(reinterpret_cast<const uint8_t*>(values[i].data()),
+                                       is_valid ? values[i].size() : 0);
+    }
+    UnsafeAppendToBitmap(validity, validity_offset, length);
+    return Status::OK();
+  }
+
+  Status AppendArraySlice(const ArraySpan& array, int64_t offset,
+                          int64_t length) override {
+    return AppendValues(array.GetValues<offset_type>(1) + offset,
+                        array.GetValues<uint8_t>(2, 0), length,
+                        array.GetValues<uint8_t>(0, 0), array.offset + offset);
+  }
+
   void Reset() override {
     ArrayBuilder::Reset();
     offsets_builder_.Reset();
@@ -15,7 +15,163 @@
 // specific language governing permissions and limitations
 // under the License.
 
-// This empty .cc file is for embedding not inlined symbols in
-// arrow::ArrayStatistics into libarrow.
-
 #include "arrow/array/statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string_view>
+#include <type_traits>
+
+#include "arrow/array/data.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bitmap_ops.h"
+
+namespace arrow {
+
+namespace {
+
+template <typename ArrowType>
+void ComputeMinMax(const ArrayData& data, ArrayStatistics* statistics) {
+  using CType = typename ArrowType::c_type;
+  using ValueType =
+      std::conditional_t<std::is_floating_point_v<CType>, double,
+                         std::conditional_t<std::is_signed_v<CType>, int64_t, uint64_t>>;
+  const CType* values = data.GetValues<CType>(1);
+  const uint8_t* validity = data.MayHaveNulls() ? data.buffers[0]->data() : nullptr;
+
+  bool found = false;
+  CType min_value{}, max_value{};
+  ::arrow::internal::VisitSetBitRunsVoid(
+      validity, data.offset, data.length, [&](int64_t position, int64_t length) {
+        for (int64_t i = position; i < position + length; ++i) {
+          const CType value = values[i];
+          if constexpr (std::is_floating_point_v<CType>) {
+            if (std::isnan(value)) {
+              continue;
+            }
+          }
+          if (!found) {
+            min_value = max_value = value;
+            found = true;
+          } else {
+            min_value = std::min(min_value, value);
+            max_value = std::max(max_value, value);
+          }
+        }
+      });
+  if (found) {
+    statistics->min = static_cast<ValueType>(min_value);
+    statistics->is_min_exact = true;
+    statistics->max = static_cast<ValueType>(max_value);
+    statistics->is_max_exact = true;
+  }
+}
+
+template <typename OffsetType>
+void ComputeBinaryMinMax(const ArrayData& data, ArrayStatistics* statistics) {
+  const OffsetType* offsets = data.GetValues<OffsetType>(1);
+  const char* bytes =
+      data.buffers[2] ? reinterpret_cast<const char*>(data.buffers[2]->data()) : "";
+  const uint8_t* validity = data.MayHaveNulls() ? data.buffers[0]->data() : nullptr;
+
+  bool found = false;
+  std::string_view min_value, max_value;
+  ::arrow::internal::VisitSetBitRunsVoid(
+      validity, data.offset, data.length, [&](int64_t position, int64_t length) {
+        for (int64_t i = position; i < position + length; ++i) {
+          const std::string_view value(bytes + offsets[i], offsets[i + 1] - offsets[i]);
+          if (!found) {
+            min_value = max_value = value;
+            found = true;
+          } else {
+            min_value = std::min(min_value, value);
+            max_value = std::max(max_value, value);
+          }
+        }
+      });
+  if (found) {
+    statistics->min = std::string(min_value);
+    statistics->is_min_exact = true;
+    statistics->max = std::string(max_value);
+    statistics->is_max_exact = true;
+  }
+}
+
+void ComputeBooleanMinMax(const ArrayData& data, ArrayStatistics* statistics) {
+  const uint8_t* values = data.buffers[1]->data();
+  const uint8_t* validity = data.MayHaveNulls() ? data.buffers[0]->data() : nullptr;
+
+  bool has_true = false, has_false = false;
+  ::arrow::internal::VisitSetBitRunsVoid(
+      validity, data.offset, data.length, [&](int64_t position, int64_t length) {
+        const int64_t num_true = ::arrow::internal::CountSetBits(
+            values, data.offset + position, length);
+        has_true |= num_true > 0;
+        has_false |= num_true < length;
+      });
+  if (has_true || has_false) {
+    statistics->min = !has_false;
+    statistics->is_min_exact = true;
+    statistics->max = has_true;
+    statistics->is_max_exact = true;
+  }
+}
+
+}  // namespace
+
+std::shared_ptr<ArrayStatistics> ComputeArrayStatistics(const ArrayData& data) {
+  auto statistics = std::make_shared<ArrayStatistics>();
+  statistics->null_count = data.GetNullCount();
+  if (statistics->null_count == data.length) {
+    return statistics;
+  }
+  switch (data.type->id()) {
+#define MIN_MAX_CASE(TYPE_CLASS)                            \
+  case TYPE_CLASS##Type::type_id:                           \
+    ComputeMinMax<TYPE_CLASS##Type>(data, statistics.get()); \
+    break;
+
+    MIN_MAX_CASE(Int8)
+    MIN_MAX_CASE(Int16)
+    MIN_MAX_CASE(Int32)
+    MIN_MAX_CASE(Int64)
+    MIN_MAX_CASE(UInt8)
+    MIN_MAX_CASE(UInt16)
+    MIN_MAX_CASE(UInt32)
+    MIN_MAX_CASE(UInt64)
+    MIN_MAX_CASE(Float)
+    MIN_MAX_CASE(Double)
+
+#undef MIN_MAX_CASE
+    case Type::BOOL:
+      ComputeBooleanMinMax(data, statistics.get());
+      break;
+    case Type::BINARY:
+    case Type::STRING:
+      ComputeBinaryMinMax<int32_t>(data, statistics.get());
+      break;
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      ComputeBinaryMinMax<int64_t>(data, statistics.get());
+      break;
+    default:
+      break;
+  }
+  return statistics;
+}
+
+std::shared_ptr<ArrayStatistics> SliceArrayStatistics(const ArrayStatistics& statistics) {
+  auto sliced = std::make_shared<ArrayStatistics>();
+  if (statistics.null_count == 0) {
+    sliced->null_count = 0;
+  }
+  sliced->min = statistics.min;
+  sliced->max = statistics.max;
+  if (!sliced->null_count.has_value() && !sliced->min.has_value() &&
+      !sliced->max.has_value()) {
+    return nullptr;
+  }
+  return sliced;
+}
+
+}  // namespace arrow
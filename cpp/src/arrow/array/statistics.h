@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <variant>
@@ -139,4 +140,25 @@ struct ARROW_EXPORT ArrayStatistics {
   bool operator!=(const ArrayStatistics& other) const { return !Equals(other); }
 };
 
+/// \brief Compute the statistics of an array in one pass over its values
+///
+/// The null count is always set. The exact minimum and maximum are set for
+/// boolean, integer, floating-point (ignoring NaNs), binary and string arrays
+/// with non-null values. The distinct count isn't computed.
+///
+/// \param[in] data the array data, whose attached statistics are ignored
+/// \return the statistics of the array
+ARROW_EXPORT std::shared_ptr<ArrayStatistics> ComputeArrayStatistics(
+    const ArrayData& data);
+
+/// \brief Derive the statistics of a slice of an array from those of the array
+///
+/// The minimum and maximum of the array are inexact bounds for the slice, and a
+/// null count of zero still holds. Other statistics are dropped.
+///
+/// \param[in] statistics the statistics of the sliced array
+/// \return the statistics of the slice, or null if none are left
+ARROW_EXPORT std::shared_ptr<ArrayStatistics> SliceArrayStatistics(
+    const ArrayStatistics& statistics);
+
 }  // namespace arrow
@@ -17,7 +17,10 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/data.h"
 #include "arrow/array/statistics.h"
+#include "arrow/testing/gtest_util.h"
 
 namespace arrow {
 
@@ -98,4 +101,102 @@ TEST(ArrayStatisticsTest, TestEquality) {
   ASSERT_EQ(statistics1, statistics2);
 }
 
+TEST(ComputeArrayStatisticsTest, Integer) {
+  auto array = ArrayFromJSON(int32(), "[5, null, -3, 8, null]");
+  auto statistics = ComputeArrayStatistics(*array->data());
+  ASSERT_EQ(2, statistics->null_count);
+  ASSERT_EQ(ArrayStatistics::ValueType{int64_t{-3}}, statistics->min);
+  ASSERT_TRUE(statistics->is_min_exact);
+  ASSERT_EQ(ArrayStatistics::ValueType{int64_t{8}}, statistics->max);
+  ASSERT_TRUE(statistics->is_max_exact);
+  ASSERT_FALSE(statistics->distinct_count.has_value());
+
+  // Only the values of the slice are visited
+  statistics = ComputeArrayStatistics(*array->Slice(2, 1)->data());
+  ASSERT_EQ(0, statistics->null_count);
+  ASSERT_EQ(ArrayStatistics::ValueType{int64_t{-3}}, statistics->min);
+  ASSERT_EQ(ArrayStatistics::ValueType{int64_t{-3}}, statistics->max);
+
+  array = ArrayFromJSON(uint64(), "[18446744073709551615, 1]");
+  statistics = ComputeArrayStatistics(*array->data());
+  ASSERT_EQ(ArrayStatistics::ValueType{uint64_t{1}}, statistics->min);
+  ASSERT_EQ(ArrayStatistics::ValueType{uint64_t{18446744073709551615ULL}},
+            statistics->max);
+}
+
+TEST(ComputeArrayStatisticsTest, FloatingPoint) {
+  auto array = ArrayFromJSON(float64(), "[NaN, 2.5, null, -1.5]");
+  auto statistics = ComputeArrayStatistics(*array->data());
+  ASSERT_EQ(1, statistics->null_count);
+  ASSERT_EQ(ArrayStatistics::ValueType{-1.5}, statistics->min);
+  ASSERT_EQ(ArrayStatistics::ValueType{2.5}, statistics->max);
+
+  // NaNs have no minimum and maximum
+  array = ArrayFromJSON(float32(), "[NaN]");
+  statistics = ComputeArrayStatistics(*array->data());
+  ASSERT_EQ(0, statistics->null_count);
+  ASSERT_FALSE(statistics->min.has_value());
+  ASSERT_FALSE(statistics->max.has_value());
+}
+
+TEST(ComputeArrayStatisticsTest, BooleanAndString) {
+  auto array = ArrayFromJSON(boolean(), "[true, null, true]");
+  auto statistics = ComputeArrayStatistics(*array->data());
+  ASSERT_EQ(ArrayStatistics::ValueType{true}, statistics->min);
+  ASSERT_EQ(ArrayStatistics::ValueType{true}, statistics->max);
+
+  array = ArrayFromJSON(large_utf8(), R"(["pear", "apple", null, "fig"])");
+  statistics = ComputeArrayStatistics(*array->data());
+  ASSERT_EQ(1, statistics->null_count);
+  ASSERT_EQ(ArrayStatistics::ValueType{std::string("apple")}, statistics->min);
+  ASSERT_EQ(ArrayStatistics::ValueType{std::string("pear")}, statistics->max);
+}
+
+TEST(ComputeArrayStatisticsTest, AllNull) {
+  auto array = ArrayFromJSON(int8(), "[null, null]");
+  auto statistics = ComputeArrayStatistics(*array->data());
+  ASSERT_EQ(2, statistics->null_count);
+  ASSERT_FALSE(statistics->min.has_value());
+  ASSERT_FALSE(statistics->max.has_value());
+}
+
+TEST(SliceArrayStatisticsTest, Basics) {
+  ArrayStatistics statistics;
+  statistics.null_count = 0;
+  statistics.distinct_count = 3;
+  statistics.min = int64_t{1};
+  statistics.is_min_exact = true;
+  statistics.max = int64_t{9};
+  statistics.is_max_exact = true;
+
+  auto sliced = SliceArrayStatistics(statistics);
+  ASSERT_NE(nullptr, sliced);
+  ASSERT_EQ(0, sliced->null_count);
+  ASSERT_FALSE(sliced->distinct_count.has_value());
+  ASSERT_EQ(statistics.min, sliced->min);
+  ASSERT_FALSE(sliced->is_min_exact);
+  ASSERT_EQ(statistics.max, sliced->max);
+  ASSERT_FALSE(sliced->is_max_exact);
+
+  ArrayStatistics counts_only;
+  counts_only.null_count = 2;
+  counts_only.distinct_count = 3;
+  ASSERT_EQ(nullptr, SliceArrayStatistics(counts_only));
+}
+
+TEST(ArrayBuilderStatisticsTest, AttachStatistics) {
+  Int16Builder builder;
+  ASSERT_OK(builder.AppendValues({3, 1, 2}));
+  ASSERT_OK_AND_ASSIGN(auto array, builder.Finish());
+  ASSERT_EQ(nullptr, array->statistics());
+
+  builder.set_attach_statistics(true);
+  ASSERT_OK(builder.AppendValues({3, 1, 2}));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK_AND_ASSIGN(array, builder.Finish());
+  ASSERT_NE(nullptr, array->statistics());
+  ASSERT_EQ(*ComputeArrayStatistics(*array->data()), *array->statistics());
+  ASSERT_EQ(1, array->statistics()->null_count);
+}
+
 }  // namespace arrow
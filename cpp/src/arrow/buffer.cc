@@ -26,8 +26,10 @@
 #include "arrow/status.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/slice_util_internal.h"
 #include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -207,6 +209,49 @@ Status AllocateEmptyBitmap(int64_t length, std::shared_ptr<Buffer>* out) {
   return AllocateEmptyBitmap(length).Value(out);
 }
 
+namespace {
+
+// Concatenations of at least this many bytes are copied by the CPU thread pool, as a
+// single thread can't saturate the memory bandwidth
+constexpr int64_t kMinParallelConcatenateBytes = 8 << 20;
+constexpr int64_t kMinParallelConcatenateTaskBytes = 1 << 20;
+
+// Copy `buffers` to `out_data` with one task per range of the output
+Status ParallelConcatenateBuffers(const std::vector<std::shared_ptr<Buffer>>& buffers,
+                                  int64_t out_length, uint8_t* out_data,
+                                  ::arrow::internal::Executor* executor) {
+  // The output offset of each buffer
+  std::vector<int64_t> starts(buffers.size() + 1, 0);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    starts[i + 1] = starts[i] + buffers[i]->size();
+  }
+  const int64_t task_bytes = std::max(
+      kMinParallelConcatenateTaskBytes,
+      bit_util::CeilDiv(out_length, int64_t{4} * executor->GetCapacity()));
+  const auto num_tasks = static_cast<int>(bit_util::CeilDiv(out_length, task_bytes));
+  return ::arrow::internal::ParallelFor(
+      num_tasks,
+      [&](int task) {
+        const int64_t begin = task * task_bytes;
+        const int64_t end = std::min(out_length, begin + task_bytes);
+        // The last buffer starting at or before `begin`
+        auto i =
+            std::upper_bound(starts.begin(), starts.end(), begin) - starts.begin() - 1;
+        for (int64_t position = begin; position < end; ++i) {
+          const int64_t length = std::min(end, starts[i + 1]) - position;
+          if (length > 0) {
+            std::memcpy(out_data + position, buffers[i]->data() + (position - starts[i]),
+                        static_cast<size_t>(length));
+            position += length;
+          }
+        }
+        return Status::OK();
+      },
+      executor);
+}
+
+}  // namespace
+
 Result<std::shared_ptr<Buffer>> ConcatenateBuffers(
     const std::vector<std::shared_ptr<Buffer>>& buffers, MemoryPool* pool) {
   int64_t out_length = 0;
@@ -215,6 +260,14 @@ Result<std::shared_ptr<Buffer>> ConcatenateBuffers(
   }
   ARROW_ASSIGN_OR_RAISE(auto out, AllocateBuffer(out_length, pool));
   auto out_data = out->mutable_data();
+  if (out_length >= kMinParallelConcatenateBytes) {
+    auto executor = ::arrow::internal::GetCpuThreadPool();
+    // Waiting for other tasks of the pool from one of its threads could deadlock it
+    if (executor->GetCapacity() > 1 && !executor->OwnsThisThread()) {
+      RETURN_NOT_OK(ParallelConcatenateBuffers(buffers, out_length, out_data, executor));
+      return std::shared_ptr<Buffer>(std::move(out));
+    }
+  }
   for (const auto& buffer : buffers) {
     // Passing nullptr to std::memcpy is undefined behavior, so skip empty buffers
     if (buffer->size() != 0) {
@@ -576,6 +576,9 @@ Result<std::shared_ptr<Buffer>> AllocateEmptyBitmap(int64_t length, int64_t alig
 
 /// \brief Concatenate multiple buffers into a single buffer
 ///
+/// Large concatenations are copied in parallel by the CPU thread pool, unless called
+/// from one of its threads.
+///
 /// \param[in] buffers to be concatenated
 /// \param[in] pool memory pool to allocate the new buffer from
 ARROW_EXPORT
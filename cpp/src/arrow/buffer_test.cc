@@ -1018,6 +1018,27 @@ TEST(TestBufferConcatenation, EmptyBuffer) {
   AssertMyBufferEqual(*result, contents);
 }
 
+TEST(TestBufferConcatenation, LargeBuffers) {
+  // Large enough to be copied in parallel, with pieces of uneven sizes
+  std::vector<std::string> pieces;
+  std::string expected;
+  for (int64_t size : {int64_t{3} << 20, int64_t{0}, int64_t{5} << 20, int64_t{12345},
+                       int64_t{1} << 20}) {
+    std::string piece(static_cast<size_t>(size), '\0');
+    for (size_t i = 0; i < piece.size(); ++i) {
+      piece[i] = static_cast<char>((i * 31 + pieces.size()) % 251);
+    }
+    expected += piece;
+    pieces.push_back(std::move(piece));
+  }
+  BufferVector buffers;
+  for (const auto& piece : pieces) {
+    buffers.push_back(std::make_shared<Buffer>(piece));
+  }
+  ASSERT_OK_AND_ASSIGN(auto result, ConcatenateBuffers(buffers));
+  AssertMyBufferEqual(*result, expected);
+}
+
 TEST(TestDeviceRegistry, Basics) {
   // Test the error cases for the device registry
 
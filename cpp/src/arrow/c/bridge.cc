@@ -678,6 +678,21 @@ struct ArrayExporter {
   bool device_interface_ = false;
 };
 
+// Wrap the batch columns in struct ArrayData for export.  This is much cheaper than
+// RecordBatch::ToStructArray(), which boxes the result and every column as Arrays.
+Result<std::shared_ptr<ArrayData>> RecordBatchToStructData(const RecordBatch& batch) {
+  const ArrayDataVector& columns = batch.column_data();
+  for (size_t i = 0; i < columns.size(); ++i) {
+    if (ARROW_PREDICT_FALSE(columns[i]->length != batch.num_rows())) {
+      return Status::Invalid("Number of rows in column ", i,
+                             " did not match batch: ", columns[i]->length, " vs ",
+                             batch.num_rows());
+    }
+  }
+  return ArrayData::Make(struct_(batch.schema()->fields()), batch.num_rows(),
+                         {nullptr}, columns, /*null_count=*/0, /*offset=*/0);
+}
+
 }  // namespace
 
 Status ExportArray(const Array& array, struct ArrowArray* out,
@@ -695,8 +710,7 @@ Status ExportArray(const Array& array, struct ArrowArray* out,
 
 Status ExportRecordBatch(const RecordBatch& batch, struct ArrowArray* out,
                          struct ArrowSchema* out_schema) {
-  // XXX perhaps bypass ToStructArray() for speed?
-  ARROW_ASSIGN_OR_RAISE(auto array, batch.ToStructArray());
+  ARROW_ASSIGN_OR_RAISE(auto data, RecordBatchToStructData(batch));
 
   SchemaExportGuard guard(out_schema);
   if (out_schema != nullptr) {
@@ -704,7 +718,7 @@ Status ExportRecordBatch(const RecordBatch& batch, struct ArrowArray* out,
     RETURN_NOT_OK(ExportSchema(*batch.schema(), out_schema));
   }
   ArrayExporter exporter;
-  RETURN_NOT_OK(exporter.Export(array->data()));
+  RETURN_NOT_OK(exporter.Export(data));
   exporter.Finish(out);
   guard.Detach();
   return Status::OK();
@@ -753,8 +767,32 @@ Result<std::pair<std::optional<DeviceAllocationType>, int64_t>> ValidateDeviceIn
   return std::make_pair(device_type, device_id);
 }
 
+// The sync event of the buffers of imported data, so that it isn't lost when
+// the data is exported again
+std::shared_ptr<Device::SyncEvent> GetBufferSyncEvent(const ArrayData& data) {
+  for (const auto& buf : data.buffers) {
+    if (buf) {
+      if (auto sync = buf->device_sync_event()) {
+        return sync;
+      }
+    }
+  }
+  for (const auto& child : data.child_data) {
+    if (auto sync = GetBufferSyncEvent(*child)) {
+      return sync;
+    }
+  }
+  if (data.dictionary) {
+    return GetBufferSyncEvent(*data.dictionary);
+  }
+  return nullptr;
+}
+
 Status ExportDeviceArray(const Array& array, std::shared_ptr<Device::SyncEvent> sync,
                          struct ArrowDeviceArray* out, struct ArrowSchema* out_schema) {
+  if (!sync) {
+    sync = GetBufferSyncEvent(*array.data());
+  }
   void* sync_event = sync ? sync->get_raw() : nullptr;
 
   SchemaExportGuard guard(out_schema);
@@ -786,21 +824,23 @@ Status ExportDeviceRecordBatch(const RecordBatch& batch,
                                std::shared_ptr<Device::SyncEvent> sync,
                                struct ArrowDeviceArray* out,
                                struct ArrowSchema* out_schema) {
+  ARROW_ASSIGN_OR_RAISE(auto data, RecordBatchToStructData(batch));
+
+  if (!sync) {
+    sync = GetBufferSyncEvent(*data);
+  }
   void* sync_event{nullptr};
   if (sync) {
     sync_event = sync->get_raw();
   }
 
-  // XXX perhaps bypass ToStructArray for speed?
-  ARROW_ASSIGN_OR_RAISE(auto array, batch.ToStructArray());
-
   SchemaExportGuard guard(out_schema);
   if (out_schema != nullptr) {
     // Export the schema, not the struct type, so as not to lose top-level metadata
     RETURN_NOT_OK(ExportSchema(*batch.schema(), out_schema));
   }
 
-  ARROW_ASSIGN_OR_RAISE(auto device_info, ValidateDeviceInfo(*array->data()));
+  ARROW_ASSIGN_OR_RAISE(auto device_info, ValidateDeviceInfo(*data));
   if (!device_info.first) {
     out->device_type = ARROW_DEVICE_CPU;
   } else {
@@ -809,7 +849,7 @@ Status ExportDeviceRecordBatch(const RecordBatch& batch,
   out->device_id = device_info.second;
 
   ArrayExporter exporter(/*device_interface*/ true);
-  RETURN_NOT_OK(exporter.Export(array->data()));
+  RETURN_NOT_OK(exporter.Export(data));
   exporter.Finish(&out->array);
 
   auto* pdata = reinterpret_cast<ExportedArrayPrivateData*>(out->array.private_data);
@@ -2373,8 +2413,10 @@ class ArrayStreamBatchReader : public RecordBatchReader,
 
  public:
   explicit ArrayStreamBatchReader(
-      StreamType* stream, const DeviceMemoryMapper& mapper = DefaultDeviceMemoryMapper)
-      : ArrayStreamReader<IsDevice>(stream, mapper) {}
+      StreamType* stream, const DeviceMemoryMapper& mapper = DefaultDeviceMemoryMapper,
+      std::shared_ptr<Device::Stream> consumer_stream = nullptr)
+      : ArrayStreamReader<IsDevice>(stream, mapper),
+        consumer_stream_(std::move(consumer_stream)) {}
 
   Status Init() {
     ARROW_ASSIGN_OR_RAISE(schema_, this->ReadSchema());
@@ -2393,9 +2435,15 @@ class ArrayStreamBatchReader : public RecordBatchReader,
       // End of stream
       batch->reset();
       return Status::OK();
-    } else {
-      return this->ImportRecordBatchInternal(&c_array, schema_).Value(batch);
     }
+    ARROW_RETURN_NOT_OK(this->ImportRecordBatchInternal(&c_array, schema_).Value(batch));
+    const auto& sync_event = (*batch)->GetSyncEvent();
+    if (consumer_stream_ && sync_event) {
+      // Work enqueued on the consumer's stream from now on waits for the
+      // producer, but the host doesn't
+      ARROW_RETURN_NOT_OK(consumer_stream_->WaitEvent(*sync_event));
+    }
+    return Status::OK();
   }
 
   Status Close() override {
@@ -2407,6 +2455,7 @@ class ArrayStreamBatchReader : public RecordBatchReader,
 
  private:
   std::shared_ptr<Schema> schema_;
+  std::shared_ptr<Device::Stream> consumer_stream_;
 };
 
 template <bool IsDevice>
@@ -2455,12 +2504,14 @@ template <bool IsDevice, typename StreamTraits = std::conditional_t<
                              internal::ArrayStreamExportTraits>>
 Result<std::shared_ptr<RecordBatchReader>> ImportReader(
     typename StreamTraits::CType* stream,
-    const DeviceMemoryMapper& mapper = DefaultDeviceMemoryMapper) {
+    const DeviceMemoryMapper& mapper = DefaultDeviceMemoryMapper,
+    std::shared_ptr<Device::Stream> consumer_stream = nullptr) {
   if (StreamTraits::IsReleasedFunc(stream)) {
     return Status::Invalid("Cannot import released Arrow Stream");
   }
 
-  auto reader = std::make_shared<ArrayStreamBatchReader<IsDevice>>(stream, mapper);
+  auto reader = std::make_shared<ArrayStreamBatchReader<IsDevice>>(
+      stream, mapper, std::move(consumer_stream));
   ARROW_RETURN_NOT_OK(reader->Init());
   return reader;
 }
@@ -2506,6 +2557,15 @@ Result<std::shared_ptr<RecordBatchReader>> ImportDeviceRecordBatchReader(
   return ImportReader</*IsDevice=*/true>(stream, mapper);
 }
 
+Result<std::shared_ptr<RecordBatchReader>> ImportDeviceRecordBatchReader(
+    struct ArrowDeviceArrayStream* stream,
+    std::shared_ptr<Device::Stream> consumer_stream, const DeviceMemoryMapper& mapper) {
+  if (consumer_stream == nullptr) {
+    return Status::Invalid("Consumer stream must not be null");
+  }
+  return ImportReader</*IsDevice=*/true>(stream, mapper, std::move(consumer_stream));
+}
+
 Result<std::shared_ptr<ChunkedArray>> ImportChunkedArray(
     struct ArrowArrayStream* stream) {
   return ImportChunked</*IsDevice=*/false>(stream);
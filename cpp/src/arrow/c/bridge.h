@@ -182,7 +182,9 @@ Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(struct ArrowArray* array,
 /// will be returned.
 ///
 /// If sync is non-null, get_event will be called on it in order to
-/// potentially provide an event for consumers to synchronize on.
+/// potentially provide an event for consumers to synchronize on. Otherwise,
+/// the sync event of the array's buffers is used, if any (e.g. if the array
+/// was imported from the C device data interface).
 ///
 /// \param[in] array Array object to export
 /// \param[in] sync shared_ptr to object derived from Device::SyncEvent or null
@@ -204,7 +206,8 @@ Status ExportDeviceArray(const Array& array, std::shared_ptr<Device::SyncEvent>
 /// they should be exported using different ArrowDeviceArray instances.
 ///
 /// If sync is non-null, get_event will be called on it in order to
-/// potentially provide an event for consumers to synchronize on.
+/// potentially provide an event for consumers to synchronize on. Otherwise,
+/// the sync event of the batch's buffers is used, if any.
 ///
 /// \param[in] batch Record batch to export
 /// \param[in] sync shared_ptr to object derived from Device::SyncEvent or null
@@ -327,6 +330,8 @@ Status ExportChunkedArray(std::shared_ptr<ChunkedArray> chunked_array,
 /// The resulting ArrowDeviceArrayStream struct keeps the record batch reader
 /// alive until its release callback is called by the consumer. The device
 /// type is determined by calling device_type() on the RecordBatchReader.
+/// Each batch is exported with its GetSyncEvent(), or else the sync event of
+/// its buffers, so that the consumer can synchronize without blocking.
 ///
 /// \param[in] reader RecordBatchReader object to export
 /// \param[out] out C struct to export the stream to
@@ -337,7 +342,8 @@ Status ExportDeviceRecordBatchReader(std::shared_ptr<RecordBatchReader> reader,
 /// \brief Export C++ ChunkedArray using the C device data interface format.
 ///
 /// The resulting ArrowDeviceArrayStream keeps the chunked array data and buffers
-/// alive until its release callback is called by the consumer.
+/// alive until its release callback is called by the consumer. Each chunk is
+/// exported with the sync event of its buffers, if any.
 ///
 /// \param[in] chunked_array ChunkedArray object to export
 /// \param[in] device_type the device type the data is located on
@@ -374,10 +380,9 @@ Result<std::shared_ptr<ChunkedArray>> ImportChunkedArray(struct ArrowArrayStream
 /// The ArrowDeviceArrayStream struct has its contents moved to a private object
 /// held alive by the resulting record batch reader.
 ///
-/// \note If there was a required sync event, sync events are accessible by individual
-/// buffers of columns. We are not yet bubbling the sync events from the buffers up to
-/// the `GetSyncEvent` method of an imported RecordBatch. This will be added in a future
-/// update.
+/// \note If the producer provided a sync event for a batch, it is returned by
+/// the `GetSyncEvent` method of the imported RecordBatch, and by the buffers of
+/// its columns. It must be waited on before accessing the data.
 ///
 /// \param[in,out] stream C device stream interface struct
 /// \param[in] mapper mapping from device type and ID to memory manager
@@ -387,6 +392,24 @@ Result<std::shared_ptr<RecordBatchReader>> ImportDeviceRecordBatchReader(
     struct ArrowDeviceArrayStream* stream,
     const DeviceMemoryMapper& mapper = DefaultDeviceMemoryMapper);
 
+/// \brief Import C++ RecordBatchReader from the C device stream interface,
+/// synchronizing lazily on the consumer's stream
+///
+/// As above, but the sync event of each batch, if any, is also waited on by
+/// consumer_stream (see Device::Stream::WaitEvent) before the batch is
+/// returned.  Work enqueued on consumer_stream afterwards can then use the
+/// batch, without the host ever blocking on the producer.
+///
+/// \param[in,out] stream C device stream interface struct
+/// \param[in] consumer_stream the stream the batches will be used on
+/// \param[in] mapper mapping from device type and ID to memory manager
+/// \return Imported RecordBatchReader object
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatchReader>> ImportDeviceRecordBatchReader(
+    struct ArrowDeviceArrayStream* stream,
+    std::shared_ptr<Device::Stream> consumer_stream,
+    const DeviceMemoryMapper& mapper = DefaultDeviceMemoryMapper);
+
 /// \brief Import C++ ChunkedArray from the C device stream interface
 ///
 /// The ArrowDeviceArrayStream struct has its contents moved to a private object,
@@ -146,6 +146,57 @@ static void ExportImportRecordBatch(
   state.SetItemsProcessed(state.iterations());
 }
 
+// Yields the same batch forever, to measure the per-batch cost of streams
+class RepeatingRecordBatchReader : public RecordBatchReader {
+ public:
+  explicit RepeatingRecordBatchReader(std::shared_ptr<RecordBatch> batch)
+      : batch_(std::move(batch)) {}
+
+  std::shared_ptr<Schema> schema() const override { return batch_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    // Like IPC readers, hand out batches whose columns are not boxed yet
+    *batch = RecordBatch::Make(batch_->schema(), batch_->num_rows(),
+                               batch_->column_data());
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<RecordBatch> batch_;
+};
+
+static void ExportRecordBatchStream(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArrayStream c_stream;
+  struct ArrowArray c_export;
+  auto reader = std::make_shared<RepeatingRecordBatchReader>(ExampleRecordBatch());
+  ABORT_NOT_OK(ExportRecordBatchReader(reader, &c_stream));
+
+  for (auto _ : state) {
+    if (ARROW_PREDICT_FALSE(c_stream.get_next(&c_stream, &c_export) != 0)) {
+      state.SkipWithError(c_stream.get_last_error(&c_stream));
+      break;
+    }
+    ArrowArrayRelease(&c_export);
+  }
+  ArrowArrayStreamRelease(&c_stream);
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void ExportImportRecordBatchStream(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArrayStream c_stream;
+  auto reader = std::make_shared<RepeatingRecordBatchReader>(ExampleRecordBatch());
+  ABORT_NOT_OK(ExportRecordBatchReader(reader, &c_stream));
+  auto imported = ImportRecordBatchReader(&c_stream).ValueOrDie();
+
+  std::shared_ptr<RecordBatch> batch;
+  for (auto _ : state) {
+    ABORT_NOT_OK(imported->ReadNext(&batch));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
 BENCHMARK(ExportType);
 BENCHMARK(ExportSchema);
 BENCHMARK(ExportArray);
@@ -155,5 +206,7 @@ BENCHMARK(ExportImportType);
 BENCHMARK(ExportImportSchema);
 BENCHMARK(ExportImportArray);
 BENCHMARK(ExportImportRecordBatch);
+BENCHMARK(ExportRecordBatchStream);
+BENCHMARK(ExportImportRecordBatchStream);
 
 }  // namespace arrow
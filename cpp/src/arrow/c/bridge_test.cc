@@ -1278,6 +1278,12 @@ TEST_F(TestArrayExport, ExportRecordBatch) {
     batch = batch_factory();
     checker(&c_array, *batch);
   }
+  {
+    // Columns of the wrong length are rejected
+    auto batch = RecordBatch::Make(schema, 2, {arr0, arr1});
+    ASSERT_RAISES(Invalid, ExportRecordBatch(*batch, &c_array));
+    ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -5308,6 +5314,68 @@ TEST_F(TestArrayDeviceStreamRoundtrip, ChunkedArrayRoundtrip) {
   });
 }
 
+class MyStream : public Device::Stream {
+ public:
+  MyStream() : Device::Stream(nullptr, nullptr) {}
+
+  Status WaitEvent(const Device::SyncEvent& event) override {
+    waited_events.push_back(&event);
+    return Status::OK();
+  }
+  Status Synchronize() const override { return Status::OK(); }
+
+  std::vector<const Device::SyncEvent*> waited_events;
+};
+
+TEST_F(TestArrayDeviceStreamRoundtrip, SyncEvents) {
+  std::shared_ptr<Device> device = std::make_shared<MyDevice>(1);
+  auto mm = device->default_memory_manager();
+
+  ASSERT_OK_AND_ASSIGN(auto arr1,
+                       ToDevice(mm, *ArrayFromJSON(int32(), "[1, 2]")->data()));
+  ASSERT_OK_AND_ASSIGN(auto arr2,
+                       ToDevice(mm, *ArrayFromJSON(int32(), "[4, 5, null]")->data()));
+  ASSERT_OK_AND_ASSIGN(auto sync, mm->MakeDeviceSyncEvent());
+  auto orig_schema = arrow::schema({field("ints", int32())});
+  RecordBatchVector batches = {RecordBatch::Make(orig_schema, 2, {arr1}, sync),
+                               RecordBatch::Make(orig_schema, 3, {arr2})};
+  ASSERT_OK_AND_ASSIGN(
+      auto reader, RecordBatchReader::Make(batches, orig_schema, device->device_type()));
+
+  struct ArrowDeviceArrayStream c_stream;
+  ASSERT_OK(ExportDeviceRecordBatchReader(std::move(reader), &c_stream));
+  auto consumer_stream = std::make_shared<MyStream>();
+  ASSERT_OK_AND_ASSIGN(auto imported, ImportDeviceRecordBatchReader(
+                                          &c_stream, consumer_stream,
+                                          TestDeviceArrayRoundtrip::DeviceMapper));
+
+  // The sync event of the first batch is waited on by the consumer's stream
+  ASSERT_OK_AND_ASSIGN(auto batch, imported->Next());
+  AssertBatchesEqual(*batches[0], *batch);
+  ASSERT_NE(batch->GetSyncEvent(), nullptr);
+  ASSERT_EQ(batch->GetSyncEvent()->get_raw(), kMyEventPtr);
+  std::vector<const Device::SyncEvent*> expected_waits = {batch->GetSyncEvent().get()};
+  ASSERT_EQ(consumer_stream->waited_events, expected_waits);
+
+  // The event follows the imported data when it is exported again
+  struct ArrowDeviceArray c_array;
+  ASSERT_OK(ExportDeviceArray(*batch->column(0), nullptr, &c_array));
+  ASSERT_EQ(c_array.sync_event, kMyEventPtr);
+  ArrowArrayRelease(&c_array.array);
+
+  ASSERT_OK_AND_ASSIGN(batch, imported->Next());
+  AssertBatchesEqual(*batches[1], *batch);
+  ASSERT_EQ(batch->GetSyncEvent(), nullptr);
+  ASSERT_EQ(consumer_stream->waited_events, expected_waits);
+  AssertReaderEnd(imported);
+
+  ASSERT_OK(ExportDeviceRecordBatchReader(
+      std::make_shared<FailingRecordBatchReader>(Status::Invalid("unused")), &c_stream));
+  ASSERT_RAISES(Invalid, ImportDeviceRecordBatchReader(
+                             &c_stream, std::shared_ptr<Device::Stream>{}));
+  ArrowDeviceArrayStreamRelease(&c_stream);
+}
+
 TEST_F(TestArrayDeviceStreamRoundtrip, ChunkedArrayRoundtripEmpty) {
   ASSERT_OK_AND_ASSIGN(auto src, ChunkedArray::Make({}, int32()));
 
@@ -17,14 +17,27 @@
 
 #include "arrow/c/dlpack.h"
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include "arrow/array/array_base.h"
 #include "arrow/c/dlpack_abi.h"
 #include "arrow/device.h"
+#include "arrow/extension_type.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/config.h"
+
+#ifdef ARROW_JSON
+#  include "arrow/extension/fixed_shape_tensor.h"
+#endif
 
 namespace arrow::dlpack {
 
+using internal::checked_cast;
+
 namespace {
 
 Result<DLDataType> GetDLDataType(const DataType& type) {
@@ -58,45 +71,162 @@ Result<DLDataType> GetDLDataType(const DataType& type) {
   }
 }
 
+// Where the values of an array start and how they are laid out as a tensor
+struct TensorLayout {
+  const ArrayData* values;
+  // In values, from the start of values->buffers[1]
+  int64_t offset;
+  std::vector<int64_t> shape;
+  // In values, empty for a compact row-major layout
+  std::vector<int64_t> strides;
+};
+
+Status CheckNoNulls(const ArrayData& data) {
+  if (data.GetNullCount() > 0) {
+    return Status::TypeError("Can only use DLPack on arrays with no nulls.");
+  }
+  return Status::OK();
+}
+
+Status CheckValueType(const DataType& type) {
+  if (type.id() == Type::BOOL) {
+    return Status::TypeError("Bit-packed boolean data type not supported by DLPack.");
+  }
+  if (!is_integer(type.id()) && !is_floating(type.id())) {
+    return Status::TypeError("DataType is not compatible with DLPack spec: ",
+                             type.ToString());
+  }
+  return Status::OK();
+}
+
+#ifdef ARROW_JSON
+// A fixed shape tensor is stored as a fixed size list of its flattened cells,
+// with the cell dimensions in the order given by the permutation
+void SetTensorCellLayout(const extension::FixedShapeTensorType& type,
+                         TensorLayout* layout) {
+  const std::vector<int64_t>& cell_shape = type.shape();
+  const std::vector<int64_t>& permutation = type.permutation();
+  layout->shape.resize(1);
+  layout->shape.insert(layout->shape.end(), cell_shape.begin(), cell_shape.end());
+  if (permutation.empty()) {
+    return;
+  }
+  layout->strides.resize(layout->shape.size());
+  int64_t stride = 1;
+  for (auto it = permutation.rbegin(); it != permutation.rend(); ++it) {
+    layout->strides[*it + 1] = stride;
+    stride *= cell_shape[*it];
+  }
+  layout->strides[0] = stride;
+}
+#endif
+
+Result<TensorLayout> GetTensorLayout(const ArrayData& data) {
+  TensorLayout layout;
+  layout.shape.push_back(data.length);
+  layout.offset = data.offset;
+
+  const DataType* type = data.type.get();
+  const ArrayData* values = &data;
+  if (type->id() == Type::EXTENSION) {
+    // Other extension types are rejected below along with their storage
+#ifdef ARROW_JSON
+    const auto& ext_type = checked_cast<const ExtensionType&>(*type);
+    if (ext_type.extension_name() == "arrow.fixed_shape_tensor") {
+      SetTensorCellLayout(checked_cast<const extension::FixedShapeTensorType&>(ext_type),
+                          &layout);
+      RETURN_NOT_OK(CheckNoNulls(*values));
+      const auto list_size =
+          checked_cast<const FixedSizeListType&>(*ext_type.storage_type()).list_size();
+      values = values->child_data[0].get();
+      layout.offset = layout.offset * list_size + values->offset;
+      type = values->type.get();
+    }
+#endif
+  } else {
+    // Nested fixed size lists add one dimension each
+    while (type->id() == Type::FIXED_SIZE_LIST) {
+      RETURN_NOT_OK(CheckNoNulls(*values));
+      const auto list_size = checked_cast<const FixedSizeListType&>(*type).list_size();
+      layout.shape.push_back(list_size);
+      values = values->child_data[0].get();
+      layout.offset = layout.offset * list_size + values->offset;
+      type = values->type.get();
+    }
+  }
+
+  RETURN_NOT_OK(CheckNoNulls(*values));
+  RETURN_NOT_OK(CheckValueType(*type));
+  layout.values = values;
+  return layout;
+}
+
+Result<DLDevice> GetDLDevice(const Buffer& buffer) {
+  // DLDeviceType and DeviceAllocationType share their enumerator values
+  DLDevice device;
+  device.device_type = static_cast<DLDeviceType>(buffer.device_type());
+  switch (buffer.device_type()) {
+    case DeviceAllocationType::kCPU:
+    case DeviceAllocationType::kCUDA_HOST:
+      device.device_id = 0;
+      return device;
+    case DeviceAllocationType::kCUDA:
+    case DeviceAllocationType::kCUDA_MANAGED:
+    case DeviceAllocationType::kROCM:
+      device.device_id = static_cast<int32_t>(buffer.device()->device_id());
+      return device;
+    default:
+      return Status::NotImplemented(
+          "DLPack support is not implemented for buffers on device type ",
+          static_cast<int>(buffer.device_type()));
+  }
+}
+
 struct ManagerCtx {
   std::shared_ptr<ArrayData> array;
+  std::vector<int64_t> shape;
+  std::vector<int64_t> strides;
   DLManagedTensor tensor;
 };
 
 }  // namespace
 
 Result<DLManagedTensor*> ExportArray(const std::shared_ptr<Array>& arr) {
-  // Define DLDevice struct nad check if array type is supported
-  // by the DLPack protocol at the same time. Raise TypeError if not.
-  // Supported data types: int, uint, float with no validity buffer.
-  ARROW_ASSIGN_OR_RAISE(auto device, ExportDevice(arr))
+  // Check if the array is supported by the DLPack protocol and define the
+  // DLDevice struct. Supported data types: int, uint, float with no validity
+  // buffer, possibly in fixed size lists or a fixed shape tensor.
+  ARROW_ASSIGN_OR_RAISE(auto layout, GetTensorLayout(*arr->data()));
+  ARROW_ASSIGN_OR_RAISE(auto device, GetDLDevice(*layout.values->buffers[1]));
 
   // Define the DLDataType struct
-  const DataType& type = *arr->type();
-  std::shared_ptr<ArrayData> data = arr->data();
+  const DataType& type = *layout.values->type;
   ARROW_ASSIGN_OR_RAISE(auto dlpack_type, GetDLDataType(type));
 
   // Create ManagerCtx that will serve as the owner of the DLManagedTensor
   std::unique_ptr<ManagerCtx> ctx(new ManagerCtx);
 
   // Define the data pointer to the DLTensor
-  // If array is of length 0, data pointer should be NULL
-  if (arr->length() == 0) {
+  // If the tensor is empty, data pointer should be NULL
+  const bool empty = std::find(layout.shape.begin(), layout.shape.end(), 0) !=
+                     layout.shape.end();
+  if (empty) {
     ctx->tensor.dl_tensor.data = NULL;
   } else {
-    const auto data_offset = data->offset * type.byte_width();
+    const auto data_offset = layout.offset * type.byte_width();
     ctx->tensor.dl_tensor.data =
-        const_cast<uint8_t*>(data->buffers[1]->data() + data_offset);
+        const_cast<uint8_t*>(layout.values->buffers[1]->data() + data_offset);
   }
 
+  ctx->shape = std::move(layout.shape);
+  ctx->strides = std::move(layout.strides);
   ctx->tensor.dl_tensor.device = device;
-  ctx->tensor.dl_tensor.ndim = 1;
+  ctx->tensor.dl_tensor.ndim = static_cast<int32_t>(ctx->shape.size());
   ctx->tensor.dl_tensor.dtype = dlpack_type;
-  ctx->tensor.dl_tensor.shape = const_cast<int64_t*>(&data->length);
-  ctx->tensor.dl_tensor.strides = NULL;
+  ctx->tensor.dl_tensor.shape = ctx->shape.data();
+  ctx->tensor.dl_tensor.strides = ctx->strides.empty() ? NULL : ctx->strides.data();
   ctx->tensor.dl_tensor.byte_offset = 0;
 
-  ctx->array = std::move(data);
+  ctx->array = arr->data();
   ctx->tensor.manager_ctx = ctx.get();
   ctx->tensor.deleter = [](struct DLManagedTensor* self) {
     delete reinterpret_cast<ManagerCtx*>(self->manager_ctx);
@@ -105,29 +235,8 @@ Result<DLManagedTensor*> ExportArray(const std::shared_ptr<Array>& arr) {
 }
 
 Result<DLDevice> ExportDevice(const std::shared_ptr<Array>& arr) {
-  // Check if array is supported by the DLPack protocol.
-  if (arr->null_count() > 0) {
-    return Status::TypeError("Can only use DLPack on arrays with no nulls.");
-  }
-  const DataType& type = *arr->type();
-  if (type.id() == Type::BOOL) {
-    return Status::TypeError("Bit-packed boolean data type not supported by DLPack.");
-  }
-  if (!is_integer(type.id()) && !is_floating(type.id())) {
-    return Status::TypeError("DataType is not compatible with DLPack spec: ",
-                             type.ToString());
-  }
-
-  // Define DLDevice struct
-  DLDevice device;
-  if (arr->data()->buffers[1]->device_type() == DeviceAllocationType::kCPU) {
-    device.device_id = 0;
-    device.device_type = DLDeviceType::kDLCPU;
-    return device;
-  } else {
-    return Status::NotImplemented(
-        "DLPack support is implemented only for buffers on CPU device.");
-  }
+  ARROW_ASSIGN_OR_RAISE(auto layout, GetTensorLayout(*arr->data()));
+  return GetDLDevice(*layout.values->buffers[1]);
 }
 
 }  // namespace arrow::dlpack
@@ -30,6 +30,10 @@ namespace arrow::dlpack {
 /// Data types for which the protocol is supported are
 /// integer and floating-point data types.
 ///
+/// Fixed size lists of such values are exported without copying as
+/// tensors with one more dimension per level of nesting, and fixed
+/// shape tensor arrays as tensors of shape [length, shape...].
+///
 /// DLPack protocol only supports arrays with one contiguous
 /// memory region which means Arrow Arrays with validity buffers
 /// are not supported.
@@ -43,6 +47,8 @@ Result<DLManagedTensor*> ExportArray(const std::shared_ptr<Array>& arr);
 /// type of the device data is stored on and index of the
 /// device which is 0 by default for CPU.
 ///
+/// Values on CPU and CUDA devices are supported.
+///
 /// \param[in] arr Arrow array
 /// \return DLDevice struct
 ARROW_EXPORT
@@ -18,10 +18,16 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array/array_base.h"
+#include "arrow/array/array_nested.h"
 #include "arrow/c/dlpack.h"
 #include "arrow/c/dlpack_abi.h"
 #include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/config.h"
+
+#ifdef ARROW_JSON
+#  include "arrow/extension/fixed_shape_tensor.h"
+#endif
 
 namespace arrow::dlpack {
 
@@ -101,6 +107,75 @@ TEST_F(TestExportArray, TestSupportedArray) {
   ASSERT_EQ(allocated_bytes, arrow::default_memory_pool()->bytes_allocated());
 }
 
+void CheckDLTensorValues(const std::shared_ptr<Array>& arr,
+                         const std::vector<int64_t>& shape,
+                         const std::vector<int64_t>& strides,
+                         const std::vector<int32_t>& values) {
+  ASSERT_OK_AND_ASSIGN(auto dlmtensor, arrow::dlpack::ExportArray(arr));
+  auto dltensor = dlmtensor->dl_tensor;
+
+  ASSERT_EQ(static_cast<int32_t>(shape.size()), dltensor.ndim);
+  ASSERT_EQ(shape, std::vector<int64_t>(dltensor.shape, dltensor.shape + dltensor.ndim));
+  if (strides.empty()) {
+    ASSERT_EQ(NULL, dltensor.strides);
+  } else {
+    ASSERT_EQ(strides,
+              std::vector<int64_t>(dltensor.strides, dltensor.strides + dltensor.ndim));
+  }
+  ASSERT_EQ(DLDataTypeCode::kDLInt, dltensor.dtype.code);
+  ASSERT_EQ(32, dltensor.dtype.bits);
+  ASSERT_EQ(DLDeviceType::kDLCPU, dltensor.device.device_type);
+
+  // The values are in row-major order of the physical layout
+  const auto* data = reinterpret_cast<const int32_t*>(dltensor.data);
+  ASSERT_EQ(values, std::vector<int32_t>(data, data + values.size()));
+
+  dlmtensor->deleter(dlmtensor);
+}
+
+TEST_F(TestExportArray, TestFixedSizeList) {
+  const auto allocated_bytes = arrow::default_memory_pool()->bytes_allocated();
+
+  auto array = ArrayFromJSON(fixed_size_list(int32(), 2), "[[1, 2], [3, 4], [5, 6]]");
+  CheckDLTensorValues(array, {3, 2}, {}, {1, 2, 3, 4, 5, 6});
+  CheckDLTensorValues(array->Slice(1), {2, 2}, {}, {3, 4, 5, 6});
+
+  // The values of a slice of the list values start at their own offset
+  auto values = ArrayFromJSON(int32(), "[0, 1, 2, 3, 4, 5, 6]");
+  ASSERT_OK_AND_ASSIGN(array, FixedSizeListArray::FromArrays(values->Slice(1), 3));
+  CheckDLTensorValues(array->Slice(1), {1, 3}, {}, {4, 5, 6});
+
+  auto nested = ArrayFromJSON(fixed_size_list(fixed_size_list(int32(), 2), 2),
+                              "[[[1, 2], [3, 4]], [[5, 6], [7, 8]]]");
+  CheckDLTensorValues(nested, {2, 2, 2}, {}, {1, 2, 3, 4, 5, 6, 7, 8});
+  CheckDLTensorValues(nested->Slice(1), {1, 2, 2}, {}, {5, 6, 7, 8});
+
+  ASSERT_OK_AND_ASSIGN(auto dlmtensor,
+                       arrow::dlpack::ExportArray(nested->Slice(0, 0)));
+  ASSERT_EQ(NULL, dlmtensor->dl_tensor.data);
+  dlmtensor->deleter(dlmtensor);
+
+  ASSERT_EQ(allocated_bytes, arrow::default_memory_pool()->bytes_allocated());
+}
+
+#ifdef ARROW_JSON
+TEST_F(TestExportArray, TestFixedShapeTensor) {
+  auto storage = ArrayFromJSON(fixed_size_list(int32(), 6),
+                               "[[1, 2, 3, 4, 5, 6], [7, 8, 9, 10, 11, 12]]");
+
+  auto ext_type = extension::fixed_shape_tensor(int32(), {2, 3});
+  auto array = ExtensionType::WrapArray(ext_type, storage);
+  CheckDLTensorValues(array, {2, 2, 3}, {}, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+  CheckDLTensorValues(array->Slice(1), {1, 2, 3}, {}, {7, 8, 9, 10, 11, 12});
+
+  // Each cell is stored as its transpose
+  ext_type = extension::fixed_shape_tensor(int32(), {2, 3}, {1, 0});
+  array = ExtensionType::WrapArray(ext_type, storage);
+  CheckDLTensorValues(array, {2, 2, 3}, {6, 1, 2},
+                      {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+}
+#endif
+
 TEST_F(TestExportArray, TestErrors) {
   const std::shared_ptr<Array> array_null = ArrayFromJSON(null(), "[]");
   ASSERT_RAISES_WITH_MESSAGE(TypeError,
@@ -124,6 +199,25 @@ TEST_F(TestExportArray, TestErrors) {
   ASSERT_RAISES_WITH_MESSAGE(
       TypeError, "Type error: Bit-packed boolean data type not supported by DLPack.",
       arrow::dlpack::ExportDevice(array_boolean));
+
+  const std::shared_ptr<Array> list_with_null =
+      ArrayFromJSON(fixed_size_list(int32(), 2), "[[1, 2], null]");
+  ASSERT_RAISES_WITH_MESSAGE(TypeError,
+                             "Type error: Can only use DLPack on arrays with no nulls.",
+                             arrow::dlpack::ExportArray(list_with_null));
+
+  const std::shared_ptr<Array> list_with_null_value =
+      ArrayFromJSON(fixed_size_list(int32(), 2), "[[1, 2], [3, null]]");
+  ASSERT_RAISES_WITH_MESSAGE(TypeError,
+                             "Type error: Can only use DLPack on arrays with no nulls.",
+                             arrow::dlpack::ExportArray(list_with_null_value));
+
+  const std::shared_ptr<Array> list_of_strings =
+      ArrayFromJSON(fixed_size_list(utf8(), 1), R"([["a"], ["b"]])");
+  ASSERT_RAISES_WITH_MESSAGE(TypeError,
+                             "Type error: DataType is not compatible with DLPack spec: " +
+                                 utf8()->ToString(),
+                             arrow::dlpack::ExportArray(list_of_strings));
 }
 
 }  // namespace arrow::dlpack
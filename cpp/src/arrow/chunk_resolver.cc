@@ -58,40 +58,42 @@ inline std::vector<int64_t> MakeChunksOffsets(span<T> chunks) {
 }
 
 template <typename IndexType>
-inline TypedChunkLocation<IndexType> ResolveOneInline(uint32_t num_offsets,
-                                                      const uint64_t* offsets,
-                                                      IndexType typed_logical_index,
-                                                      int32_t num_chunks,
-                                                      int32_t chunk_hint) {
-  const auto index = static_cast<uint64_t>(typed_logical_index);
-  // use or update chunk_hint
-  if (index >= offsets[chunk_hint] &&
-      (chunk_hint == num_chunks || index < offsets[chunk_hint + 1])) {
-    // hint is correct!
-  } else {
-    // lo < hi is guaranteed by `num_offsets = chunks.size() + 1`
-    auto chunk_index =
-        ChunkResolver::Bisect(index, offsets, /*lo=*/0, /*hi=*/num_offsets);
-    chunk_hint = static_cast<int32_t>(chunk_index);
-  }
+inline TypedChunkLocation<IndexType> MakeChunkLocation(const uint64_t* offsets,
+                                                       IndexType typed_logical_index,
+                                                       int32_t num_chunks,
+                                                       int32_t chunk_index) {
   // chunk_index is in [0, chunks.size()] no matter what the value
   // of logical_index is, so it's always safe to dereference offsets
   // as it contains chunks.size()+1 values.
   auto loc = TypedChunkLocation<IndexType>(
-      /*chunk_index=*/chunk_hint,
+      /*chunk_index=*/chunk_index,
       /*index_in_chunk=*/typed_logical_index -
-          static_cast<IndexType>(offsets[chunk_hint]));
+          static_cast<IndexType>(offsets[chunk_index]));
 #if defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER)
   // Make it more likely that Valgrind/ASAN can catch an invalid memory
   // access by poisoning the index-in-chunk value when the logical
   // index is out-of-bounds.
-  if (static_cast<int32_t>(loc.chunk_index) == num_chunks) {
+  if (chunk_index == num_chunks) {
     loc.index_in_chunk = std::numeric_limits<IndexType>::max();
   }
 #endif
   return loc;
 }
 
+inline bool HintIsCorrect(const uint64_t* offsets, uint64_t index, int32_t num_chunks,
+                          int32_t chunk_hint) {
+  return index >= offsets[chunk_hint] &&
+         (chunk_hint == num_chunks || index < offsets[chunk_hint + 1]);
+}
+
+// Up to this many chunks, indices are resolved by comparing them with all the
+// offsets, which the compiler vectorizes, rather than by bisecting them
+constexpr int32_t kMaxLinearScanChunks = 16;
+
+// The number of indices bisected together.  Their searches are branch-free and take
+// the same number of steps, so that their memory accesses overlap.
+constexpr int64_t kBisectBatchSize = 8;
+
 /// \pre all the pre-conditions of ChunkResolver::ResolveMany()
 /// \pre num_offsets - 1 <= std::numeric_limits<IndexType>::max()
 template <typename IndexType>
@@ -102,12 +104,64 @@ void ResolveManyInline(uint32_t num_offsets, const int64_t* signed_offsets,
   auto* offsets = reinterpret_cast<const uint64_t*>(signed_offsets);
   const auto num_chunks = static_cast<int32_t>(num_offsets - 1);
   // chunk_hint in [0, num_offsets) per the precondition.
-  for (int64_t i = 0; i < n_indices; i++) {
+  if (num_chunks <= kMaxLinearScanChunks) {
+    for (int64_t i = 0; i < n_indices; i++) {
+      const auto typed_logical_index = logical_index_vec[i];
+      const auto index = static_cast<uint64_t>(typed_logical_index);
+      // The chunk index is the number of chunks after the first starting at or before
+      // the index, and the number of chunks if the index is out of bounds
+      int32_t chunk_index = 0;
+      for (int32_t k = 1; k <= num_chunks; ++k) {
+        chunk_index += static_cast<int32_t>(index >= offsets[k]);
+      }
+      out_chunk_location_vec[i] =
+          MakeChunkLocation(offsets, typed_logical_index, num_chunks, chunk_index);
+    }
+    return;
+  }
+
+  int64_t i = 0;
+  for (; i + kBisectBatchSize <= n_indices; i += kBisectBatchSize) {
+    const IndexType* batch = logical_index_vec + i;
+    bool hint_is_correct = true;
+    for (int64_t j = 0; j < kBisectBatchSize; ++j) {
+      hint_is_correct &= HintIsCorrect(offsets, static_cast<uint64_t>(batch[j]),
+                                       num_chunks, chunk_hint);
+    }
+    if (hint_is_correct) {
+      // Typical of sorted or clustered indices
+      for (int64_t j = 0; j < kBisectBatchSize; ++j) {
+        out_chunk_location_vec[i + j] =
+            MakeChunkLocation(offsets, batch[j], num_chunks, chunk_hint);
+      }
+      continue;
+    }
+    // Like ChunkResolver::Bisect, but without branches: the range of the search
+    // shrinks to ceil(n / 2) whichever half the index is in.
+    uint32_t lo[kBisectBatchSize] = {};
+    for (uint32_t n = num_offsets; n > 1; n -= n >> 1) {
+      const uint32_t m = n >> 1;
+      for (int64_t j = 0; j < kBisectBatchSize; ++j) {
+        lo[j] += static_cast<uint32_t>(static_cast<uint64_t>(batch[j]) >=
+                                       offsets[lo[j] + m]) *
+                 m;
+      }
+    }
+    for (int64_t j = 0; j < kBisectBatchSize; ++j) {
+      out_chunk_location_vec[i + j] = MakeChunkLocation(
+          offsets, batch[j], num_chunks, static_cast<int32_t>(lo[j]));
+    }
+    chunk_hint = static_cast<int32_t>(lo[kBisectBatchSize - 1]);
+  }
+  for (; i < n_indices; i++) {
     const auto typed_logical_index = logical_index_vec[i];
-    const auto loc = ResolveOneInline(num_offsets, offsets, typed_logical_index,
-                                      num_chunks, chunk_hint);
-    out_chunk_location_vec[i] = loc;
-    chunk_hint = static_cast<int32_t>(loc.chunk_index);
+    const auto index = static_cast<uint64_t>(typed_logical_index);
+    if (!HintIsCorrect(offsets, index, num_chunks, chunk_hint)) {
+      // lo < hi is guaranteed by `num_offsets = chunks.size() + 1`
+      chunk_hint = ChunkResolver::Bisect(index, offsets, /*lo=*/0, /*hi=*/num_offsets);
+    }
+    out_chunk_location_vec[i] =
+        MakeChunkLocation(offsets, typed_logical_index, num_chunks, chunk_hint);
   }
 }
 
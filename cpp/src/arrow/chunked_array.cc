@@ -18,6 +18,7 @@
 #include "arrow/chunked_array.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <memory>
 #include <sstream>
@@ -34,6 +35,8 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -113,6 +116,27 @@ bool ChunkedArray::Equals(const ChunkedArray& other, const EqualOptions& opts) c
 
   // Check contents of the underlying arrays. This checks for equality of
   // the underlying data independently of the chunk size.
+  if (auto* executor = internal::GetParallelChunksExecutor(
+          length_, std::max(num_chunks(), other.num_chunks()))) {
+    std::vector<std::pair<std::shared_ptr<Array>, std::shared_ptr<Array>>> pieces;
+    internal::MultipleChunkIterator iterator(*this, other);
+    std::shared_ptr<Array> left_piece, right_piece;
+    while (iterator.Next(&left_piece, &right_piece)) {
+      pieces.emplace_back(std::move(left_piece), std::move(right_piece));
+    }
+    std::atomic<bool> unequal{false};
+    DCHECK_OK(internal::ParallelFor(
+        static_cast<int>(pieces.size()),
+        [&](int i) {
+          if (!unequal.load(std::memory_order_relaxed) &&
+              !pieces[i].first->Equals(*pieces[i].second, opts)) {
+            unequal.store(true, std::memory_order_relaxed);
+          }
+          return Status::OK();
+        },
+        executor));
+    return !unequal.load();
+  }
   return internal::ApplyBinaryChunked(
              *this, other,
              [&](const Array& left_piece, const Array& right_piece,
@@ -192,11 +216,11 @@ Result<std::shared_ptr<Scalar>> ChunkedArray::GetScalar(int64_t index) const {
 std::shared_ptr<ChunkedArray> ChunkedArray::Slice(int64_t offset, int64_t length) const {
   ARROW_CHECK_LE(offset, length_) << "Slice offset greater than array length";
   bool offset_equals_length = offset == length_;
-  int curr_chunk = 0;
-  while (curr_chunk < num_chunks() && offset >= chunk(curr_chunk)->length()) {
-    offset -= chunk(curr_chunk)->length();
-    curr_chunk++;
-  }
+  // Skips any empty chunks before the offset, and gives num_chunks() if the offset
+  // equals the length
+  const auto loc = chunk_resolver_.Resolve(offset);
+  int curr_chunk = static_cast<int>(loc.chunk_index);
+  offset = loc.index_in_chunk;
 
   ArrayVector new_chunks;
   if (num_chunks() > 0 && (offset_equals_length || length == 0)) {
@@ -277,13 +301,38 @@ Status ValidateChunks(const ArrayVector& chunks, bool full_validation) {
                              " but saw ", chunk.type()->ToString());
     }
   }
-  // Validate the chunks themselves
-  for (size_t i = 0; i < chunks.size(); ++i) {
+  // Validate the chunks themselves, reporting the first invalid one
+  auto validate_chunk = [&](size_t i) {
     const Array& chunk = *chunks[i];
-    const Status st = full_validation ? internal::ValidateArrayFull(chunk)
-                                      : internal::ValidateArray(chunk);
-    if (!st.ok()) {
-      return Status::Invalid("In chunk ", i, ": ", st.ToString());
+    return full_validation ? internal::ValidateArrayFull(chunk)
+                           : internal::ValidateArray(chunk);
+  };
+  int64_t length = 0;
+  for (const auto& chunk : chunks) {
+    length += chunk->length();
+  }
+  std::vector<Status> statuses(chunks.size());
+  // Only full validation scans the data and is worth parallelizing
+  auto* executor = full_validation ? internal::GetParallelChunksExecutor(
+                                         length, static_cast<int64_t>(chunks.size()))
+                                   : nullptr;
+  if (executor != nullptr) {
+    DCHECK_OK(internal::ParallelFor(
+        static_cast<int>(chunks.size()),
+        [&](int i) {
+          statuses[i] = validate_chunk(i);
+          return Status::OK();
+        },
+        executor));
+  } else {
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      statuses[i] = validate_chunk(i);
+      if (!statuses[i].ok()) break;
+    }
+  }
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    if (!statuses[i].ok()) {
+      return Status::Invalid("In chunk ", i, ": ", statuses[i].ToString());
     }
   }
   return Status::OK();
@@ -301,6 +350,25 @@ Status ChunkedArray::ValidateFull() const {
 
 namespace internal {
 
+namespace {
+
+// Below this many rows, spawning tasks costs more than it saves
+constexpr int64_t kMinParallelChunksLength = 1 << 16;
+
+}  // namespace
+
+::arrow::internal::Executor* GetParallelChunksExecutor(int64_t length,
+                                                       int64_t num_tasks) {
+  if (num_tasks < 2 || length < kMinParallelChunksLength) {
+    return nullptr;
+  }
+  auto* executor = GetCpuThreadPool();
+  if (executor->GetCapacity() <= 1 || executor->OwnsThisThread()) {
+    return nullptr;
+  }
+  return executor;
+}
+
 bool MultipleChunkIterator::Next(std::shared_ptr<Array>* next_left,
                                  std::shared_ptr<Array>* next_right) {
   if (pos_ == length_) return false;
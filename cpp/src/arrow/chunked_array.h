@@ -30,6 +30,7 @@
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -246,6 +247,15 @@ class ARROW_EXPORT MultipleChunkIterator {
   int64_t chunk_pos_right_;
 };
 
+/// \brief Return the CPU thread pool if `num_tasks` tasks over `length` rows in
+/// total are worth running in parallel, or null to run them serially.
+///
+/// Nested work never runs in parallel when called from a thread of the pool, as
+/// waiting for the nested tasks could then deadlock.
+ARROW_EXPORT
+::arrow::internal::Executor* GetParallelChunksExecutor(int64_t length,
+                                                       int64_t num_tasks);
+
 /// \brief Evaluate binary function on two ChunkedArray objects having possibly
 /// different chunk layouts. The passed binary function / functor should have
 /// the following signature.
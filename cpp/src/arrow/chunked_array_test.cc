@@ -17,12 +17,16 @@
 
 #include "arrow/chunked_array.h"
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/chunk_resolver.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
@@ -216,6 +220,24 @@ TEST_F(TestChunkedArray, SliceEquals) {
   ASSERT_TRUE(slice5->type()->Equals(one_->type()));
 }
 
+TEST_F(TestChunkedArray, SliceAcrossEmptyChunks) {
+  auto chunked = ChunkedArrayFromJSON(int32(), {"[]", "[1, 2]", "[]", "[]", "[3]", "[]"});
+
+  auto sliced = chunked->Slice(2, 1);
+  ASSERT_EQ(sliced->num_chunks(), 1);
+  AssertChunkedEqual(*ChunkedArrayFromJSON(int32(), {"[3]"}), *sliced);
+
+  sliced = chunked->Slice(1);
+  AssertChunkedEquivalent(*ChunkedArrayFromJSON(int32(), {"[2, 3]"}), *sliced);
+
+  // Empty slices keep a single, empty chunk
+  for (int64_t offset : {0, 2, 3}) {
+    sliced = chunked->Slice(offset, 0);
+    ASSERT_EQ(sliced->num_chunks(), 1);
+    ASSERT_EQ(sliced->length(), 0);
+  }
+}
+
 TEST_F(TestChunkedArray, ZeroChunksIssues) {
   ArrayVector empty = {};
   auto no_chunks = std::make_shared<ChunkedArray>(empty, int8());
@@ -254,6 +276,45 @@ TEST_F(TestChunkedArray, Validate) {
   ASSERT_RAISES(Invalid, one_->ValidateFull());
 }
 
+TEST_F(TestChunkedArray, EqualsAndValidateManyLargeChunks) {
+  // Large enough to compare and validate chunks in parallel
+  random::RandomArrayGenerator gen(42);
+  for (int i = 0; i < 8; ++i) {
+    arrays_one_.push_back(gen.String(20000, 0, 10, 0.1));
+  }
+  Construct();
+  ASSERT_OK(one_->ValidateFull());
+
+  // Same values with a different chunk layout
+  ArrayVector rechunked;
+  for (int64_t offset = 0; offset < one_->length(); offset += 30000) {
+    auto piece = one_->Slice(offset, 30000);
+    ASSERT_OK_AND_ASSIGN(auto array, Concatenate(piece->chunks()));
+    rechunked.push_back(array);
+  }
+  another_ = std::make_shared<ChunkedArray>(rechunked);
+  ASSERT_TRUE(one_->Equals(*another_));
+
+  ArrayVector modified = rechunked;
+  modified[3] = gen.String(30000, 0, 10, 0.1);
+  ASSERT_FALSE(one_->Equals(*std::make_shared<ChunkedArray>(modified)));
+
+  // The first invalid chunk is reported
+  ASSERT_OK_AND_ASSIGN(auto invalid_utf8,
+                       ArrayFromJSON(binary(), R"(["abc", "def"])")->View(utf8()));
+  auto invalid_data = invalid_utf8->data()->Copy();
+  ASSERT_OK_AND_ASSIGN(invalid_data->buffers[2],
+                       AllocateBuffer(invalid_data->buffers[2]->size()));
+  std::memset(invalid_data->buffers[2]->mutable_data(), 0xff,
+              invalid_data->buffers[2]->size());
+  ArrayVector invalid = arrays_one_;
+  invalid[5] = MakeArray(invalid_data);
+  invalid[2] = MakeArray(invalid_data);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("In chunk 2: Invalid: Invalid UTF8"),
+      std::make_shared<ChunkedArray>(invalid)->ValidateFull());
+}
+
 TEST_F(TestChunkedArray, PrintDiff) {
   random::RandomArrayGenerator gen(0);
   arrays_one_.push_back(gen.Int32(50, 0, 100, 0.1));
@@ -525,7 +586,8 @@ class TestChunkResolverMany : public ::testing::Test {
     }
   }
 
-  void TestRandomInput(int32_t num_chunks, int64_t chunked_array_len) {
+  void TestRandomInput(int32_t num_chunks, int64_t chunked_array_len,
+                       bool sorted = false) {
     random::pcg64 rng(42);
 
     // Generate random chunk offsets...
@@ -562,6 +624,10 @@ class TestChunkResolverMany : public ::testing::Test {
       }
     }
 
+    if (sorted) {
+      std::sort(logical_index_vec.begin(), logical_index_vec.end());
+    }
+
     ChunkResolver resolver(std::move(offsets));
     CheckResolveMany(resolver, logical_index_vec);
   }
@@ -572,6 +638,9 @@ class TestChunkResolverMany : public ::testing::Test {
     const int64_t avg_chunk_length = 20;
     const int64_t chunked_array_len = num_chunks * 2 * avg_chunk_length;
     TestRandomInput(num_chunks, chunked_array_len);
+    TestRandomInput(num_chunks, chunked_array_len, /*sorted=*/true);
+    // Few enough chunks to be scanned linearly
+    TestRandomInput(10, 10 * 2 * avg_chunk_length);
   }
 };
 
@@ -22,6 +22,7 @@
 #include "benchmark/benchmark.h"
 
 #include "arrow/array.h"
+#include "arrow/chunked_array.h"
 #include "arrow/compare.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -151,6 +152,56 @@ static void ArrayRangeEqualsDenseUnion(benchmark::State& state) {
   BenchmarkArrayRangeEquals(array, state);
 }
 
+static std::shared_ptr<ChunkedArray> MakeChunkedStrings(int64_t size, int num_chunks) {
+  auto rng = random::RandomArrayGenerator(kSeed);
+  ArrayVector chunks;
+  for (int i = 0; i < num_chunks; ++i) {
+    chunks.push_back(rng.String(size / num_chunks, /*min_length=*/0, /*max_length=*/15,
+                                /*null_probability=*/0.01));
+  }
+  return std::make_shared<ChunkedArray>(std::move(chunks));
+}
+
+// Chunked comparison and validation run in parallel on the CPU thread pool
+static void ChunkedArrayEqualsString(benchmark::State& state) {
+  const int64_t size = state.range(0);
+  const auto left = MakeChunkedStrings(size, static_cast<int>(state.range(1)));
+  // Different chunk layout, and no pointer equality shortcut
+  ArrayVector right_chunks;
+  for (int64_t offset = 0; offset < left->length(); offset += size / 3 + 1) {
+    for (const auto& chunk : left->Slice(offset, size / 3 + 1)->chunks()) {
+      right_chunks.push_back(MakeArray(chunk->data()->Copy()));
+    }
+  }
+  const ChunkedArray right(std::move(right_chunks));
+
+  for (auto _ : state) {
+    if (ARROW_PREDICT_FALSE(!left->Equals(right))) {
+      ARROW_LOG(FATAL) << "Chunked arrays should have compared equal";
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+static void ChunkedArrayValidateFullString(benchmark::State& state) {
+  const int64_t size = state.range(0);
+  const auto chunked = MakeChunkedStrings(size, static_cast<int>(state.range(1)));
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(chunked->ValidateFull());
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+static void ChunkedSetArgs(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"size", "chunks"})->UseRealTime();
+  for (int64_t size : {1 << 16, 1 << 22}) {
+    for (int64_t num_chunks : {1, 16}) {
+      bench->Args({size, num_chunks});
+    }
+  }
+}
+
 BENCHMARK(ArrayRangeEqualsInt32)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsFloat32)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsBoolean)->Apply(RegressionSetArgs);
@@ -160,5 +211,7 @@ BENCHMARK(ArrayRangeEqualsListOfInt32)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsStruct)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsSparseUnion)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsDenseUnion)->Apply(RegressionSetArgs);
+BENCHMARK(ChunkedArrayEqualsString)->Apply(ChunkedSetArgs);
+BENCHMARK(ChunkedArrayValidateFullString)->Apply(ChunkedSetArgs);
 
 }  // namespace arrow
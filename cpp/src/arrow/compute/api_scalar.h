@@ -554,6 +554,9 @@ class ARROW_EXPORT RandomOptions : public FunctionOptions {
   /// The type of initialization for random number generation - system or provided seed.
   Initializer initializer;
   /// The seed value used to initialize the random number generation.
+  ///
+  /// The values generated with a seed are the successive outputs of a single
+  /// generator, across all the batches an expression is executed on.
   uint64_t seed;
 };
 
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -43,12 +44,15 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_generate.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/trace_events.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -781,6 +785,11 @@ class KernelExecutorImpl : public KernelExecutor {
 class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
  public:
   Status Execute(const ExecBatch& batch, ExecListener* listener) override {
+    util::tracing::ScopedTraceEvent trace_event("compute", "ScalarExecutor::Execute");
+    trace_event.set_value(batch.length);
+    if (batch.selection_vector) {
+      return ExecuteSelected(batch, listener);
+    }
     RETURN_NOT_OK(span_iterator_.Init(batch, exec_context()->exec_chunksize()));
 
     if (batch.length == 0) {
@@ -894,6 +903,51 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     return Status::OK();
   }
 
+  // Compute the selected rows of the batch only, in a single kernel invocation
+  Status ExecuteSelected(const ExecBatch& batch, ExecListener* listener) {
+    if (kernel_->selective_exec == nullptr) {
+      return Status::NotImplemented("Kernel doesn't support selection vectors");
+    }
+    const SelectionVector& selection = *batch.selection_vector;
+    ExecSpan input(batch);
+    // The values are indexed by the selection, so the span covers all of them
+    input.length = 0;
+    for (const Datum& value : batch.values) {
+      if (value.is_chunked_array()) {
+        return Status::NotImplemented(
+            "Executing kernels with a selection vector on chunked arrays");
+      }
+      if (value.is_array()) {
+        input.length = std::max(input.length, value.length());
+      }
+    }
+
+    RETURN_NOT_OK(SetupPreallocation(selection.length(), batch.values));
+    if (!preallocating_all_buffers_) {
+      return Status::NotImplemented("Kernels computing selected rows must preallocate");
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ArrayData> preallocation,
+                          PrepareOutput(selection.length()));
+    ExecResult output;
+    ArraySpan* output_span = output.array_span_mutable();
+    output_span->SetMembers(*preallocation);
+
+    const SelectionVectorSpan selection_span(selection);
+    if (output_type_.type->id() == Type::NA) {
+      output_span->null_count = output_span->length;
+    } else if (kernel_->null_handling == NullHandling::INTERSECTION) {
+      if (!elide_validity_bitmap_) {
+        PropagateNullsSelected(input, selection_span, output_span);
+      }
+    } else if (kernel_->null_handling == NullHandling::OUTPUT_NOT_NULL) {
+      output_span->null_count = 0;
+    }
+    RETURN_NOT_OK(kernel_->selective_exec(kernel_ctx_, input, selection_span, &output));
+    DCHECK(output.is_array_span());
+    preallocation->null_count = output_span->null_count;
+    return listener->OnResult(std::move(preallocation));
+  }
+
   Status ExecuteNonSpans(ExecListener* listener) {
     // ARROW-16756: Kernel is going to allocate some memory and so
     // for the time being we pass in an empty or partially-filled
@@ -1022,6 +1076,8 @@ Status CheckCanExecuteChunked(const VectorKernel* kernel) {
 class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
  public:
   Status Execute(const ExecBatch& batch, ExecListener* listener) override {
+    util::tracing::ScopedTraceEvent trace_event("compute", "VectorExecutor::Execute");
+    trace_event.set_value(batch.length);
     // Some vector kernels have a separate code path for handling
     // chunked arrays (VectorKernel::exec_chunked) so we check if we
     // have any chunked arrays. If we do and an exec_chunked function
@@ -1219,6 +1275,47 @@ Status PropagateNulls(KernelContext* ctx, const ExecSpan& batch, ArrayData* outp
   return propagator.Execute();
 }
 
+void PropagateNullsSelected(const ExecSpan& batch, const SelectionVectorSpan& selection,
+                            ArraySpan* out) {
+  if (out->type->id() == Type::NA) {
+    return;
+  }
+
+  std::vector<const ArraySpan*> arrays_with_nulls;
+  for (const ExecValue& value : batch.values) {
+    auto null_generalization = NullGeneralization::Get(value);
+    if (null_generalization == NullGeneralization::ALL_NULL) {
+      out->null_count = out->length;
+      bit_util::SetBitsTo(out->buffers[0].data, out->offset, out->length, false);
+      return;
+    }
+    if (null_generalization != NullGeneralization::ALL_VALID && value.is_array()) {
+      arrays_with_nulls.push_back(&value.array);
+    }
+  }
+  uint8_t* out_bitmap = out->buffers[0].data;
+  if (arrays_with_nulls.empty()) {
+    out->null_count = 0;
+    if (out_bitmap != nullptr) {
+      bit_util::SetBitsTo(out_bitmap, out->offset, out->length, true);
+    }
+    return;
+  }
+
+  // A selected row is valid if it is valid in all the arrays
+  const int32_t* indices = selection.indices();
+  arrow::internal::GenerateBitsUnrolled(out_bitmap, out->offset, out->length, [&]() {
+    const int32_t index = *indices++;
+    for (const ArraySpan* array : arrays_with_nulls) {
+      if (!bit_util::GetBit(array->buffers[0].data, array->offset + index)) {
+        return false;
+      }
+    }
+    return true;
+  });
+  out->null_count = kUnknownNullCount;
+}
+
 void PropagateNullsSpans(const ExecSpan& batch, ArraySpan* out) {
   if (out->type->id() == Type::NA) {
     // Null output type is a no-op (rare when this would happen but we at least
@@ -1355,17 +1452,89 @@ SelectionVector::SelectionVector(const Array& arr) : SelectionVector(arr.data())
 int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->length); }
 
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
-    const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+    const BooleanArray& arr, MemoryPool* pool) {
+  if (arr.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Selection vector masks must be shorter than 2^31 values");
+  }
+  const int64_t num_selected = arr.true_count();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices,
+                        AllocateBuffer(num_selected * sizeof(int32_t), pool));
+  auto out = indices->mutable_data_as<int32_t>();
+  const uint8_t* validity = arr.null_count() > 0 ? arr.null_bitmap_data() : nullptr;
+  ::arrow::internal::SetBitRunReader reader(arr.values()->data(), arr.offset(),
+                                            arr.length());
+  for (auto run = reader.NextRun(); run.length > 0; run = reader.NextRun()) {
+    for (int64_t i = run.position; i < run.position + run.length; ++i) {
+      if (validity == nullptr || bit_util::GetBit(validity, arr.offset() + i)) {
+        *out++ = static_cast<int32_t>(i);
+      }
+    }
+  }
+  DCHECK_EQ(out, indices->data_as<int32_t>() + num_selected);
+  return std::make_shared<SelectionVector>(
+      ArrayData::Make(int32(), num_selected, {nullptr, std::move(indices)},
+                      /*null_count=*/0));
+}
+
+namespace {
+
+// The device type of the first buffer of the array that isn't on the CPU
+DeviceAllocationType GetDeviceType(const ArrayData& data) {
+  for (const auto& buffer : data.buffers) {
+    if (buffer && !buffer->is_cpu()) {
+      return buffer->device_type();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    auto device_type = GetDeviceType(*child);
+    if (device_type != DeviceAllocationType::kCPU) {
+      return device_type;
+    }
+  }
+  if (data.dictionary) {
+    return GetDeviceType(*data.dictionary);
+  }
+  return DeviceAllocationType::kCPU;
+}
+
+DeviceAllocationType GetDeviceType(const std::vector<Datum>& args) {
+  for (const auto& arg : args) {
+    DeviceAllocationType device_type = DeviceAllocationType::kCPU;
+    if (arg.is_array()) {
+      device_type = GetDeviceType(*arg.array());
+    } else if (arg.is_chunked_array()) {
+      for (const auto& chunk : arg.chunked_array()->chunks()) {
+        device_type = GetDeviceType(*chunk->data());
+        if (device_type != DeviceAllocationType::kCPU) break;
+      }
+    }
+    if (device_type != DeviceAllocationType::kCPU) {
+      return device_type;
+    }
+  }
+  return DeviceAllocationType::kCPU;
 }
 
+// Arguments with data on another device than the CPU are passed to the function
+// registered for that device
+Result<std::shared_ptr<const Function>> GetFunctionForArgs(
+    const std::string& func_name, const std::vector<Datum>& args, ExecContext* ctx) {
+  auto device_type = GetDeviceType(args);
+  if (device_type != DeviceAllocationType::kCPU) {
+    return ctx->func_registry()->GetDeviceFunction(device_type, func_name);
+  }
+  return ctx->func_registry()->GetFunction(func_name);
+}
+
+}  // namespace
+
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
                            const FunctionOptions* options, ExecContext* ctx) {
   if (ctx == nullptr) {
     ctx = default_exec_context();
   }
   ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
-                        ctx->func_registry()->GetFunction(func_name));
+                        GetFunctionForArgs(func_name, args, ctx));
   return func->Execute(args, options, ctx);
 }
 
@@ -1380,7 +1549,7 @@ Result<Datum> CallFunction(const std::string& func_name, const ExecBatch& batch,
     ctx = default_exec_context();
   }
   ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
-                        ctx->func_registry()->GetFunction(func_name));
+                        GetFunctionForArgs(func_name, batch.values, ctx));
   return func->Execute(batch, options, ctx);
 }
 
@@ -110,12 +110,28 @@ class ARROW_EXPORT ExecContext {
   /// set_preallocate_contiguous() for more information.
   bool preallocate_contiguous() const { return preallocate_contiguous_; }
 
+  /// \brief Set the number of rows evaluated at a time by ExecuteScalarExpression()
+  ///
+  /// Nested calls of fixed-width kernels are evaluated one tile of rows at a time,
+  /// so that their intermediate results stay in cache, and the outermost call writes
+  /// into a contiguous output.  The default of 0 sizes the tiles from the L2 cache.
+  /// Other lengths are rounded up to a multiple of 64 rows.  Setting INT64_MAX
+  /// evaluates each call over whole batches instead.
+  void set_expression_tile_length(int64_t tile_length) {
+    expression_tile_length_ = tile_length;
+  }
+
+  /// \brief The number of rows evaluated at a time by ExecuteScalarExpression(), or 0
+  /// if sized from the L2 cache. See set_expression_tile_length().
+  int64_t expression_tile_length() const { return expression_tile_length_; }
+
  private:
   MemoryPool* pool_;
   ::arrow::internal::Executor* executor_;
   FunctionRegistry* func_registry_;
   int64_t exec_chunksize_ = std::numeric_limits<int64_t>::max();
   bool preallocate_contiguous_ = true;
+  int64_t expression_tile_length_ = 0;
   bool use_threads_ = true;
 };
 
@@ -131,7 +147,10 @@ class ARROW_EXPORT ExecContext {
 /// implementations. This is especially relevant for aggregations but also
 /// applies to scalar operations.
 ///
-/// We are not yet using this so this is mostly a placeholder for now.
+/// ExecuteScalarExpression() honors the selection vector of its input batch.  Scalar
+/// kernels providing a ScalarKernel::selective_exec function compute the selected
+/// rows of their inputs only; for other kernels the referenced columns are gathered
+/// at the selected positions before the kernels run.
 ///
 /// [1]: http://cidrdb.org/cidr2005/papers/P19.pdf
 class ARROW_EXPORT SelectionVector {
@@ -141,8 +160,12 @@ class ARROW_EXPORT SelectionVector {
   explicit SelectionVector(const Array& arr);
 
   /// \brief Create SelectionVector from boolean mask
-  static Result<std::shared_ptr<SelectionVector>> FromMask(const BooleanArray& arr);
+  ///
+  /// Null values in the mask are not selected.
+  static Result<std::shared_ptr<SelectionVector>> FromMask(
+      const BooleanArray& arr, MemoryPool* pool = default_memory_pool());
 
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
   const int32_t* indices() const { return indices_; }
   int32_t length() const;
 
@@ -151,6 +174,26 @@ class ARROW_EXPORT SelectionVector {
   const int32_t* indices_;
 };
 
+/// \brief A non-owning view of selection indices, as passed to kernels computing
+/// the selected rows of their inputs only
+class ARROW_EXPORT SelectionVectorSpan {
+ public:
+  SelectionVectorSpan() = default;
+
+  SelectionVectorSpan(const int32_t* indices, int64_t length)
+      : indices_(indices), length_(length) {}
+
+  explicit SelectionVectorSpan(const SelectionVector& selection)
+      : SelectionVectorSpan(selection.indices(), selection.length()) {}
+
+  const int32_t* indices() const { return indices_; }
+  int64_t length() const { return length_; }
+
+ private:
+  const int32_t* indices_ = NULLPTR;
+  int64_t length_ = 0;
+};
+
 /// An index to represent that a batch does not belong to an ordered stream
 constexpr int64_t kUnsequencedIndex = -1;
 
@@ -165,6 +165,12 @@ Status PropagateNulls(KernelContext* ctx, const ExecSpan& batch, ArrayData* out)
 ARROW_EXPORT
 void PropagateNullsSpans(const ExecSpan& batch, ArraySpan* out);
 
+/// \brief Compute the validity bitmap of the selected rows of a batch, like
+/// PropagateNullsSpans, into a preallocated output with one row per selection index
+ARROW_EXPORT
+void PropagateNullsSelected(const ExecSpan& batch, const SelectionVectorSpan& selection,
+                            ArraySpan* out);
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
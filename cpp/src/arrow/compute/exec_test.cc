@@ -153,6 +153,27 @@ TEST(SelectionVector, Basics) {
   ASSERT_EQ(3, sel_vector->indices()[1]);
 }
 
+TEST(SelectionVector, FromMask) {
+  auto check = [](const std::string& mask_json, const std::string& expected_json) {
+    auto mask = ArrayFromJSON(boolean(), mask_json);
+    ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(
+                                              checked_cast<const BooleanArray&>(*mask)));
+    AssertArraysEqual(*ArrayFromJSON(int32(), expected_json),
+                      *MakeArray(sel_vector->data()), /*verbose=*/true);
+  };
+  check("[]", "[]");
+  check("[false, false]", "[]");
+  check("[true, false, true, true]", "[0, 2, 3]");
+  check("[true, null, false, true, null]", "[0, 3]");
+
+  // Sliced masks produce indices relative to the slice
+  auto mask = ArrayFromJSON(boolean(), "[true, false, true, null, true]")->Slice(1);
+  ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(
+                                            checked_cast<const BooleanArray&>(*mask)));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 3]"), *MakeArray(sel_vector->data()),
+                    /*verbose=*/true);
+}
+
 void AssertValidityZeroExtraBits(const uint8_t* data, int64_t length, int64_t offset) {
   const int64_t bit_extent = ((offset + length + 7) / 8) * 8;
   for (int64_t i = offset + length; i < bit_extent; ++i) {
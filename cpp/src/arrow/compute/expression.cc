@@ -20,10 +20,14 @@
 #include "arrow/compute/expression.h"
 
 #include <algorithm>
+#include <limits>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/api_vector.h"
@@ -36,6 +40,7 @@
 #  include "arrow/ipc/reader.h"
 #  include "arrow/ipc/writer.h"
 #endif
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/hash_util.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
@@ -721,6 +726,408 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Schema& full
   return ExecuteScalarExpression(expr, input, exec_context);
 }
 
+namespace {
+
+void MarkReferencedColumns(const Expression& expr, std::vector<bool>* referenced) {
+  if (auto param = expr.parameter()) {
+    // A parameter of null type is replaced by a null scalar and needs no column
+    if (!param->indices.empty()) (*referenced)[param->indices[0]] = true;
+    return;
+  }
+  if (auto call = expr.call()) {
+    for (const Expression& arg : call->arguments) {
+      MarkReferencedColumns(arg, referenced);
+    }
+  }
+}
+
+}  // namespace
+
+Result<ExecBatch> ApplySelectionVector(const std::vector<Expression>& exprs,
+                                       const ExecBatch& input,
+                                       compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    exec_context = default_exec_context();
+  }
+  DCHECK_NE(input.selection_vector, nullptr);
+  const SelectionVector& selection = *input.selection_vector;
+  std::vector<bool> referenced(input.values.size(), false);
+  for (const Expression& expr : exprs) {
+    MarkReferencedColumns(expr, &referenced);
+  }
+
+  ExecBatch selected = input;
+  selected.selection_vector = nullptr;
+  selected.length = selection.length();
+  for (size_t i = 0; i < selected.values.size(); ++i) {
+    if (selected.values[i].is_scalar()) continue;
+    if (!referenced[i]) {
+      // Unused, but the batch must still be consistent with its length
+      selected.values[i] = MakeNullScalar(selected.values[i].type());
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(selected.values[i],
+                          compute::Take(selected.values[i], selection.data(),
+                                        compute::TakeOptions::NoBoundsCheck(),
+                                        exec_context));
+  }
+  return selected;
+}
+
+namespace {
+
+// Run the kernel of a call on its evaluated arguments.  If selection is not null, the
+// kernel computes the selected rows of the arguments only.
+Result<Datum> ExecuteCall(const Expression::Call& call, std::vector<Datum> arguments,
+                          int64_t input_length,
+                          std::shared_ptr<SelectionVector> selection,
+                          compute::ExecContext* exec_context) {
+  bool all_scalar = true;
+  for (const Datum& argument : arguments) {
+    all_scalar &= argument.is_scalar();
+  }
+  if (!arguments.empty() && all_scalar) {
+    // all inputs are scalar, so use a 1-long batch to avoid
+    // computing input.length equivalent outputs
+    input_length = 1;
+    selection = nullptr;
+  }
+
+  auto executor = compute::detail::KernelExecutor::MakeScalar();
+
+  compute::KernelContext kernel_context(exec_context, call.kernel);
+  kernel_context.SetState(call.kernel_state.get());
+
+  const Kernel* kernel = call.kernel;
+  std::vector<TypeHolder> types = GetTypes(arguments);
+  auto options = call.options.get();
+  RETURN_NOT_OK(executor->Init(&kernel_context, {kernel, types, options}));
+
+  ExecBatch batch(std::move(arguments), input_length);
+  batch.selection_vector = std::move(selection);
+  compute::detail::DatumAccumulator listener;
+  RETURN_NOT_OK(executor->Execute(batch, &listener));
+  const auto out = executor->WrapResults(batch.values, listener.values());
+#ifndef NDEBUG
+  DCHECK_OK(executor->CheckResultType(out, call.function_name.c_str()));
+#endif
+  return out;
+}
+
+// Whether the kernel of a call can run on tiles of its arguments and write tiles of a
+// preallocated fixed-width output
+bool IsFusibleCall(const Expression::Call& call) {
+  if (call.function->kind() != compute::Function::SCALAR) return false;
+  const auto* kernel = static_cast<const ScalarKernel*>(call.kernel);
+  if (kernel->mem_allocation != MemAllocation::PREALLOCATE ||
+      !kernel->can_write_into_slices) {
+    return false;
+  }
+  switch (kernel->null_handling) {
+    case NullHandling::INTERSECTION:
+    case NullHandling::OUTPUT_NOT_NULL:
+    case NullHandling::COMPUTED_PREALLOCATE:
+      break;
+    default:
+      return false;
+  }
+  return is_primitive(call.type.id()) || is_decimal(call.type.id());
+}
+
+// The number of fusible calls in the tree of fusible calls rooted at expr
+int CountFusibleCalls(const Expression& expr) {
+  auto call = expr.call();
+  if (call == nullptr || !IsFusibleCall(*call)) return 0;
+  int count = 1;
+  for (const Expression& argument : call->arguments) {
+    count += CountFusibleCalls(argument);
+  }
+  return count;
+}
+
+// Evaluates a tree of fusible calls one tile of rows at a time.  Each call writes its
+// result for the tile into a scratch buffer reused for all the tiles, which is read
+// by the parent call while still in cache, so no full-length intermediate array is
+// materialized.  Only the root call writes into a full-length output.  The arguments
+// which aren't fusible calls are evaluated upfront.
+class FusedExpression {
+ public:
+  explicit FusedExpression(compute::ExecContext* exec_context)
+      : exec_context_(exec_context) {}
+
+  // Evaluate expr, or return nullopt if it can't be fused
+  Result<std::optional<Datum>> Execute(const Expression& expr, const ExecBatch& input) {
+    ARROW_ASSIGN_OR_RAISE(Operand root, AddOperand(expr, input));
+    if (root.node < 0) {
+      // No argument is an array
+      return root.leaf;
+    }
+    for (const Node& node : nodes_) {
+      for (const Operand& argument : node.arguments) {
+        if (argument.node < 0 && argument.leaf.is_chunked_array()) return std::nullopt;
+      }
+    }
+    const int64_t tile_length = TileLength();
+    RETURN_NOT_OK(Prepare(input.length, tile_length));
+    for (int64_t offset = 0, length = 0; offset < input.length; offset += length) {
+      length = std::min(tile_length, input.length - offset);
+      for (size_t i = 0; i < nodes_.size(); ++i) {
+        const bool is_root = i == nodes_.size() - 1;
+        RETURN_NOT_OK(ExecuteTile(&nodes_[i], offset, is_root ? offset : 0, length));
+      }
+    }
+
+    const Node& root_node = nodes_.back();
+    return Datum(ArrayData::Make(root_node.call->type.GetSharedPtr(), input.length,
+                                 {root_node.bitmap, root_node.values},
+                                 root_node.bitmap ? kUnknownNullCount : 0));
+  }
+
+ private:
+  static constexpr int64_t kMinTileLength = 1024;
+  static constexpr int64_t kMaxTileLength = 64 * 1024;
+
+  // An argument of a fused call: either another fused call or a value evaluated
+  // upfront
+  struct Operand {
+    int node = -1;
+    Datum leaf;
+  };
+
+  struct Node {
+    const Expression::Call* call;
+    const ScalarKernel* kernel;
+    KernelContext kernel_context;
+    std::vector<Operand> arguments;
+    // The result of the call for one tile, or for all the rows for the root
+    std::shared_ptr<Buffer> bitmap;
+    std::shared_ptr<Buffer> values;
+    ExecSpan input;
+    ExecResult output;
+  };
+
+  // Add the nodes of the fusible calls in expr in post-order, so that the arguments
+  // of a call are computed before it
+  Result<Operand> AddOperand(const Expression& expr, const ExecBatch& input) {
+    auto call = expr.call();
+    if (call == nullptr || !IsFusibleCall(*call)) {
+      ARROW_ASSIGN_OR_RAISE(Datum leaf,
+                            ExecuteScalarExpression(expr, input, exec_context_));
+      return Operand{-1, std::move(leaf)};
+    }
+
+    std::vector<Operand> arguments(call->arguments.size());
+    bool any_array = false;
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(arguments[i], AddOperand(call->arguments[i], input));
+      any_array |= arguments[i].node >= 0 || !arguments[i].leaf.is_scalar();
+    }
+    if (!any_array) {
+      // Only scalar arguments, so no node was added for them
+      std::vector<Datum> values;
+      for (Operand& argument : arguments) values.push_back(std::move(argument.leaf));
+      ARROW_ASSIGN_OR_RAISE(Datum leaf,
+                            ExecuteCall(*call, std::move(values), input.length,
+                                        /*selection=*/nullptr, exec_context_));
+      return Operand{-1, std::move(leaf)};
+    }
+
+    Node node{call,
+              static_cast<const ScalarKernel*>(call->kernel),
+              KernelContext(exec_context_, call->kernel),
+              std::move(arguments)};
+    node.kernel_context.SetState(call->kernel_state.get());
+    nodes_.push_back(std::move(node));
+    return Operand{static_cast<int>(nodes_.size()) - 1, {}};
+  }
+
+  // Unless set in the ExecContext, tiles are sized so that the tiles of the arguments
+  // and results of all the calls take about half of the L2 cache.  Either way the
+  // length is a multiple of 64, which keeps the bitmaps of the tiles word-aligned.
+  int64_t TileLength() const {
+    const int64_t requested = exec_context_->expression_tile_length();
+    if (requested > std::numeric_limits<int64_t>::max() - 63) {
+      return requested;
+    }
+    if (requested > 0) {
+      return (requested + 63) & ~int64_t{63};
+    }
+    int64_t bits_per_row = 0;
+    for (const Node& node : nodes_) {
+      bits_per_row += node.call->type.type->bit_width() + 1;
+      for (const Operand& argument : node.arguments) {
+        if (argument.node >= 0 || argument.leaf.is_scalar()) continue;
+        const int bit_width = argument.leaf.type()->bit_width();
+        bits_per_row += (bit_width > 0 ? bit_width : 64) + 1;
+      }
+    }
+    const int64_t cache_size =
+        ::arrow::internal::CpuInfo::GetInstance()->CacheSize(
+            ::arrow::internal::CpuInfo::CacheLevel::L2);
+    const int64_t tile_length = cache_size * 8 / 2 / bits_per_row;
+    return std::clamp(tile_length, kMinTileLength, kMaxTileLength) & ~int64_t{63};
+  }
+
+  Status Prepare(int64_t length, int64_t tile_length) {
+    MemoryPool* pool = exec_context_->memory_pool();
+    const int64_t scratch_length = std::min(length, tile_length);
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+      Node& node = nodes_[i];
+      const int64_t buffer_length = i == nodes_.size() - 1 ? length : scratch_length;
+      if (node.kernel->null_handling != NullHandling::OUTPUT_NOT_NULL) {
+        ARROW_ASSIGN_OR_RAISE(node.bitmap, AllocateBitmap(buffer_length, pool));
+      }
+      const int bit_width = node.call->type.type->bit_width();
+      ARROW_ASSIGN_OR_RAISE(
+          node.values,
+          AllocateBuffer(bit_util::BytesForBits(buffer_length * bit_width), pool));
+
+      ArraySpan* out = node.output.array_span_mutable();
+      out->type = node.call->type.type;
+      if (node.bitmap) out->SetBuffer(0, node.bitmap);
+      out->SetBuffer(1, node.values);
+
+      node.input.values.resize(node.arguments.size());
+      for (size_t j = 0; j < node.arguments.size(); ++j) {
+        const Operand& argument = node.arguments[j];
+        if (argument.node >= 0) continue;
+        if (argument.leaf.is_scalar()) {
+          node.input.values[j].SetScalar(argument.leaf.scalar().get());
+        } else {
+          node.input.values[j].SetArray(*argument.leaf.array());
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  Status ExecuteTile(Node* node, int64_t offset, int64_t out_offset, int64_t length) {
+    ExecSpan& input = node->input;
+    input.length = length;
+    for (size_t j = 0; j < node->arguments.size(); ++j) {
+      const Operand& argument = node->arguments[j];
+      ExecValue& value = input.values[j];
+      if (argument.node >= 0) {
+        value.array = *nodes_[argument.node].output.array_span();
+      } else if (value.is_array()) {
+        value.array.SetSlice(argument.leaf.array()->offset + offset, length);
+      }
+    }
+
+    ArraySpan* out = node->output.array_span_mutable();
+    out->offset = out_offset;
+    out->length = length;
+    switch (node->kernel->null_handling) {
+      case NullHandling::INTERSECTION:
+        detail::PropagateNullsSpans(input, out);
+        break;
+      case NullHandling::OUTPUT_NOT_NULL:
+        out->null_count = 0;
+        break;
+      default:
+        out->null_count = kUnknownNullCount;
+        break;
+    }
+    RETURN_NOT_OK(node->kernel->exec(&node->kernel_context, input, &node->output));
+    DCHECK(node->output.is_array_span());
+    return Status::OK();
+  }
+
+  compute::ExecContext* exec_context_;
+  std::vector<Node> nodes_;
+};
+
+// The fraction of selected rows above which computing all the rows then gathering
+// the selected results is cheaper than computing the selected rows only
+constexpr double kMaxSelectivityForSelectedExecution = 0.5;
+
+// Whether the kernel of a call can compute the selected rows of its arguments, which
+// are read directly from the input
+bool CanComputeSelectedRows(const Expression::Call& call) {
+  if (call.function->kind() != compute::Function::SCALAR) return false;
+  if (static_cast<const ScalarKernel*>(call.kernel)->selective_exec == nullptr) {
+    return false;
+  }
+  return std::all_of(call.arguments.begin(), call.arguments.end(),
+                     [](const Expression& argument) {
+                       return argument.literal() || argument.parameter();
+                     });
+}
+
+Result<Datum> ExecuteSelectedRows(const Expression& expr, const ExecBatch& input,
+                                  compute::ExecContext* exec_context) {
+  const std::shared_ptr<SelectionVector>& selection = input.selection_vector;
+  ExecBatch unselected = input;
+  unselected.selection_vector = nullptr;
+  // The length of the batch is that of the selection, the values are longer
+  unselected.length = -1;
+  for (const Datum& value : input.values) {
+    if (!value.is_scalar()) {
+      unselected.length = std::max(unselected.length, value.length());
+    }
+  }
+  if (unselected.length < 0) {
+    // Only scalars, the selection doesn't matter
+    unselected.length = input.length;
+    return ExecuteScalarExpression(expr, unselected, exec_context);
+  }
+
+  if (selection->length() > kMaxSelectivityForSelectedExecution * unselected.length) {
+    // Most rows are selected: compute them all, then gather the selected results
+    ARROW_ASSIGN_OR_RAISE(Datum out,
+                          ExecuteScalarExpression(expr, unselected, exec_context));
+    if (out.is_scalar()) return out;
+    return compute::Take(out, selection->data(), compute::TakeOptions::NoBoundsCheck(),
+                         exec_context);
+  }
+
+  if (auto lit = expr.literal()) return *lit;
+
+  if (expr.parameter()) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch selected,
+                          ApplySelectionVector({expr}, input, exec_context));
+    return ExecuteScalarExpression(expr, selected, exec_context);
+  }
+
+  auto call = CallNotNull(expr);
+  std::vector<Datum> arguments(call->arguments.size());
+
+  if (CanComputeSelectedRows(*call)) {
+    bool any_array = false;
+    bool any_chunked = false;
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(
+          arguments[i],
+          ExecuteScalarExpression(call->arguments[i], unselected, exec_context));
+      any_array |= arguments[i].is_array();
+      any_chunked |= arguments[i].is_chunked_array();
+    }
+    if (any_array && !any_chunked) {
+      return ExecuteCall(*call, std::move(arguments), unselected.length, selection,
+                         exec_context);
+    }
+    for (Datum& argument : arguments) {
+      if (argument.is_scalar()) continue;
+      ARROW_ASSIGN_OR_RAISE(argument,
+                            compute::Take(argument, selection->data(),
+                                          compute::TakeOptions::NoBoundsCheck(),
+                                          exec_context));
+    }
+    return ExecuteCall(*call, std::move(arguments), input.length,
+                       /*selection=*/nullptr, exec_context);
+  }
+
+  // Compute the selected rows of the arguments, then run the kernel on them
+  for (size_t i = 0; i < arguments.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(arguments[i],
+                          ExecuteSelectedRows(call->arguments[i], input, exec_context));
+  }
+  return ExecuteCall(*call, std::move(arguments), input.length,
+                     /*selection=*/nullptr, exec_context);
+}
+
+}  // namespace
+
 Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
                                       compute::ExecContext* exec_context) {
   if (exec_context == nullptr) {
@@ -737,6 +1144,10 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
         "ExecuteScalarExpression cannot Execute non-scalar expression ", expr.ToString());
   }
 
+  if (input.selection_vector) {
+    return ExecuteSelectedRows(expr, input, exec_context);
+  }
+
   if (auto lit = expr.literal()) return *lit;
 
   if (auto param = expr.parameter()) {
@@ -762,42 +1173,21 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
 
   auto call = CallNotNull(expr);
 
-  std::vector<Datum> arguments(call->arguments.size());
+  if (input.length > 0 &&
+      exec_context->expression_tile_length() != std::numeric_limits<int64_t>::max() &&
+      CountFusibleCalls(expr) > 1) {
+    FusedExpression fused(exec_context);
+    ARROW_ASSIGN_OR_RAISE(std::optional<Datum> out, fused.Execute(expr, input));
+    if (out.has_value()) return std::move(*out);
+  }
 
-  bool all_scalar = true;
+  std::vector<Datum> arguments(call->arguments.size());
   for (size_t i = 0; i < arguments.size(); ++i) {
     ARROW_ASSIGN_OR_RAISE(
         arguments[i], ExecuteScalarExpression(call->arguments[i], input, exec_context));
-    all_scalar &= arguments[i].is_scalar();
   }
-
-  int64_t input_length;
-  if (!arguments.empty() && all_scalar) {
-    // all inputs are scalar, so use a 1-long batch to avoid
-    // computing input.length equivalent outputs
-    input_length = 1;
-  } else {
-    input_length = input.length;
-  }
-
-  auto executor = compute::detail::KernelExecutor::MakeScalar();
-
-  compute::KernelContext kernel_context(exec_context, call->kernel);
-  kernel_context.SetState(call->kernel_state.get());
-
-  const Kernel* kernel = call->kernel;
-  std::vector<TypeHolder> types = GetTypes(arguments);
-  auto options = call->options.get();
-  RETURN_NOT_OK(executor->Init(&kernel_context, {kernel, types, options}));
-
-  compute::detail::DatumAccumulator listener;
-  RETURN_NOT_OK(
-      executor->Execute(ExecBatch(std::move(arguments), input_length), &listener));
-  const auto out = executor->WrapResults(arguments, listener.values());
-#ifndef NDEBUG
-  DCHECK_OK(executor->CheckResultType(out, call->function_name.c_str()));
-#endif
-  return out;
+  return ExecuteCall(*call, std::move(arguments), input.length, /*selection=*/nullptr,
+                     exec_context);
 }
 
 namespace {
@@ -1153,6 +1543,117 @@ Result<Expression> Canonicalize(Expression expr, compute::ExecContext* exec_cont
 
 namespace {
 
+/// The value set of an `is_in` call, sorted without nulls and NaNs, so that the
+/// values satisfying an inequality guarantee can be found by binary search.
+///
+/// A filter is simplified against the guarantee of every fragment; without this,
+/// each simplification compares and filters the whole value set.  Sorted value sets
+/// are cached per SetLookupOptions instance, which all the bound copies of a filter
+/// share.
+struct SortedValueSet {
+  std::shared_ptr<Array> values;
+  bool has_nulls = false;
+  bool has_nans = false;
+
+  /// \return the sorted value set, or null if the value set can't be sorted
+  static std::shared_ptr<const SortedValueSet> Get(
+      const std::shared_ptr<FunctionOptions>& options) {
+    static std::mutex mutex;
+    static std::unordered_map<const FunctionOptions*,
+                              std::pair<std::weak_ptr<FunctionOptions>,
+                                        std::shared_ptr<const SortedValueSet>>>
+        cache;
+    // Enough for the is_in calls of a few concurrent queries
+    constexpr size_t kMaxCached = 64;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = cache.find(options.get());
+      // The options may have been destroyed and their address reused
+      if (it != cache.end() && it->second.first.lock() == options) {
+        return it->second.second;
+      }
+    }
+
+    // Value sets which can't be sorted are cached as null too
+    std::shared_ptr<const SortedValueSet> sorted =
+        Make(checked_cast<const SetLookupOptions&>(*options)).ValueOr(nullptr);
+    std::lock_guard<std::mutex> lock(mutex);
+    if (cache.size() >= kMaxCached) {
+      for (auto it = cache.begin(); it != cache.end();) {
+        it = it->second.first.expired() ? cache.erase(it) : std::next(it);
+      }
+      if (cache.size() >= kMaxCached) cache.clear();
+    }
+    cache[options.get()] = {options, sorted};
+    return sorted;
+  }
+
+  static Result<std::shared_ptr<const SortedValueSet>> Make(
+      const SetLookupOptions& options) {
+    if (!options.value_set.is_array()) return nullptr;
+    const auto value_set = options.value_set.make_array();
+    auto maybe_indices = SortIndices(*value_set);
+    if (!maybe_indices.ok()) return nullptr;
+    ARROW_ASSIGN_OR_RAISE(Datum sorted, Take(value_set, *maybe_indices));
+
+    auto out = std::make_shared<SortedValueSet>();
+    out->has_nulls = value_set->null_count() > 0;
+    // Nulls are sorted last, and NaNs right before them
+    int64_t length = value_set->length() - value_set->null_count();
+    if (is_floating(value_set->type_id())) {
+      ARROW_ASSIGN_OR_RAISE(Datum is_nan, CallFunction("is_nan", {value_set}));
+      ARROW_ASSIGN_OR_RAISE(Datum num_nans, Sum(is_nan));
+      if (num_nans.scalar()->is_valid) {
+        const int64_t count = num_nans.scalar_as<UInt64Scalar>().value;
+        out->has_nans = count > 0;
+        length -= count;
+      }
+    }
+    out->values = sorted.make_array()->Slice(0, length);
+    return out;
+  }
+
+  /// \return the range of values v such that `v cmp bound`, or nullopt if the
+  /// values can't be compared to the bound
+  Result<std::optional<std::pair<int64_t, int64_t>>> Range(Comparison::type cmp,
+                                                           const Datum& bound) const {
+    // The first value for which `less(value, bound)` (or `less_equal`) is false
+    auto partition_point = [&](const char* function) -> Result<std::optional<int64_t>> {
+      int64_t begin = 0, end = values->length();
+      while (begin < end) {
+        const int64_t mid = begin + (end - begin) / 2;
+        ARROW_ASSIGN_OR_RAISE(auto value, values->GetScalar(mid));
+        auto result = CallFunction(function, {Datum(std::move(value)), bound});
+        if (!result.ok() || !result->scalar()->is_valid) return std::nullopt;
+        if (result->scalar_as<BooleanScalar>().value) {
+          begin = mid + 1;
+        } else {
+          end = mid;
+        }
+      }
+      return begin;
+    };
+    ARROW_ASSIGN_OR_RAISE(auto lower, partition_point("less"));
+    ARROW_ASSIGN_OR_RAISE(auto upper, partition_point("less_equal"));
+    if (!lower || !upper) return std::nullopt;
+    const int64_t length = values->length();
+    switch (cmp) {
+      case Comparison::EQUAL:
+        return std::make_pair(*lower, *upper);
+      case Comparison::LESS:
+        return std::make_pair(int64_t{0}, *lower);
+      case Comparison::LESS_EQUAL:
+        return std::make_pair(int64_t{0}, *upper);
+      case Comparison::GREATER:
+        return std::make_pair(*upper, length);
+      case Comparison::GREATER_EQUAL:
+        return std::make_pair(*lower, length);
+      default:
+        return std::nullopt;
+    }
+  }
+};
+
 // An inequality comparison which a target Expression is known to satisfy. If nullable,
 // the target may evaluate to null in addition to values satisfying the comparison.
 struct Inequality {
@@ -1282,13 +1783,35 @@ struct Inequality {
         break;
       case SetLookupOptions::INCONCLUSIVE:
         if (guarantee.nullable) return std::nullopt;
-        ARROW_ASSIGN_OR_RAISE(Datum is_null, IsNull(options->value_set));
-        ARROW_ASSIGN_OR_RAISE(Datum any_null, Any(is_null));
-        if (any_null.scalar_as<BooleanScalar>().value) return std::nullopt;
+        if (options->value_set.null_count() > 0) return std::nullopt;
         null_selection = FilterOptions::DROP;
         break;
     }
 
+    auto sorted = SortedValueSet::Get(is_in_call->options);
+    if (sorted && guarantee.bound.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(auto range, sorted->Range(guarantee.cmp, guarantee.bound));
+      if (range) {
+        const auto [begin, end] = *range;
+        const bool keep_null =
+            sorted->has_nulls && null_selection == FilterOptions::EMIT_NULL;
+        if (begin == end && !keep_null) return literal(false);
+        if (end - begin == sorted->values->length() && !sorted->has_nans &&
+            (keep_null || !sorted->has_nulls)) {
+          return std::nullopt;
+        }
+        std::shared_ptr<Array> simplified_value_set =
+            sorted->values->Slice(begin, end - begin);
+        if (keep_null) {
+          ARROW_ASSIGN_OR_RAISE(auto null, MakeArrayOfNull(simplified_value_set->type(),
+                                                           /*length=*/1));
+          ARROW_ASSIGN_OR_RAISE(simplified_value_set,
+                                Concatenate({simplified_value_set, null}));
+        }
+        return MakeIsIn(is_in_call, std::move(simplified_value_set));
+      }
+    }
+
     std::string func_name = Comparison::GetName(guarantee.cmp);
     DCHECK_NE(func_name, "na");
     std::vector<Datum> args{options->value_set, guarantee.bound};
@@ -1299,13 +1822,19 @@ struct Inequality {
 
     if (simplified_value_set.length() == 0) return literal(false);
     if (simplified_value_set.length() == options->value_set.length()) return std::nullopt;
+    return MakeIsIn(is_in_call, std::move(simplified_value_set));
+  }
 
+  /// Bind a copy of `is_in_call` looking up into another value set
+  static Result<std::optional<Expression>> MakeIsIn(const Expression::Call* is_in_call,
+                                                    Datum value_set) {
+    const auto& options = checked_cast<const SetLookupOptions&>(*is_in_call->options);
     ExecContext exec_context;
     Expression::Call simplified_call;
     simplified_call.function_name = "is_in";
     simplified_call.arguments = is_in_call->arguments;
     simplified_call.options = std::make_shared<SetLookupOptions>(
-        simplified_value_set, options->null_matching_behavior);
+        std::move(value_set), options.null_matching_behavior);
     ARROW_ASSIGN_OR_RAISE(
         Expression simplified_expr,
         BindNonRecursive(std::move(simplified_call),
@@ -243,6 +243,13 @@ ARROW_EXPORT Result<ExecBatch> MakeExecBatch(const Schema& full_schema,
 
 /// Execute a scalar expression against the provided state and input ExecBatch. This
 /// expression must be bound.
+///
+/// If the input has a selection vector then the result has the length of the
+/// selection.  When few rows are selected, the expression is only evaluated for the
+/// selected rows: calls whose kernels support selection vectors read their arguments
+/// at the selected positions, and the columns referenced by other calls are gathered.
+/// When most rows are selected, all the rows are evaluated and the selected results
+/// are gathered.
 ARROW_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const ExecBatch& input,
                                       ExecContext* = NULLPTR);
@@ -252,6 +259,16 @@ ARROW_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const Schema& full_schema,
                                       const Datum& partial_input, ExecContext* = NULLPTR);
 
+/// Gather the rows of an ExecBatch selected by its selection vector, to evaluate the
+/// given bound expressions on them.
+///
+/// Only the array columns referenced by the expressions are gathered, once even if
+/// several expressions reference them.  The other array columns are replaced by null
+/// scalars.  The result has no selection vector.
+ARROW_EXPORT
+Result<ExecBatch> ApplySelectionVector(const std::vector<Expression>& exprs,
+                                       const ExecBatch& input, ExecContext* = NULLPTR);
+
 // Serialization
 
 ARROW_EXPORT
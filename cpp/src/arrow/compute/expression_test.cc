@@ -19,6 +19,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -33,6 +34,7 @@
 #include "arrow/compute/registry.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
+#include "arrow/testing/random.h"
 
 using testing::Eq;
 using testing::HasSubstr;
@@ -910,6 +912,169 @@ TEST(Expression, ExecuteCallWithNoArguments) {
   EXPECT_EQ(actual.length(), kCount);
 }
 
+TEST(Expression, ExecuteWithSelectionVector) {
+  auto in_schema =
+      schema({field("a", float64()), field("b", float64()), field("c", utf8())});
+  ExecBatch input({ArrayFromJSON(float64(), "[1, 2, 3, null, 5]"),
+                   ArrayFromJSON(float64(), "[10, 20, 30, 40, 50]"),
+                   ArrayFromJSON(utf8(), R"(["v", "w", "x", "y", "z"])")},
+                  5);
+  input.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 3, 4]"));
+  input.length = 3;
+
+  ASSERT_OK_AND_ASSIGN(auto expr, add(field_ref("a"), field_ref("b")).Bind(*in_schema));
+  ASSERT_OK_AND_ASSIGN(Datum actual, ExecuteScalarExpression(expr, input));
+  AssertDatumsEqual(ArrayFromJSON(float64(), "[11, null, 55]"), actual,
+                    /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(expr, field_ref("c").Bind(*in_schema));
+  ASSERT_OK_AND_ASSIGN(actual, ExecuteScalarExpression(expr, input));
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["v", "y", "z"])"), actual,
+                    /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(expr, literal(1.5).Bind(*in_schema));
+  ASSERT_OK_AND_ASSIGN(actual, ExecuteScalarExpression(expr, input));
+  AssertDatumsEqual(Datum(1.5), actual, /*verbose=*/true);
+}
+
+TEST(Expression, ExecuteSelectedRows) {
+  auto in_schema = schema({field("a", int32()), field("b", int32()), field("c", utf8()),
+                           field("d", boolean())});
+  ExecBatch input({ArrayFromJSON(int32(), "[1, 2, 3, null, 5, 6, 7, 8, 9, 10]"),
+                   ArrayFromJSON(int32(), "[10, 20, 30, 40, 50, 60, 70, 80, 90, null]"),
+                   ArrayFromJSON(utf8(), R"(["a", "b", "c", "d", "e",
+                                            "f", "g", null, "i", "j"])"),
+                   ArrayFromJSON(boolean(),
+                                 "[true, false, true, true, null, true, true, false, "
+                                 "false, true]")},
+                  10);
+
+  auto check = [&](const std::string& selection, const Expression& unbound_expr) {
+    ARROW_SCOPED_TRACE("selection: ", selection,
+                       ", expression: ", unbound_expr.ToString());
+    ASSERT_OK_AND_ASSIGN(auto expr, unbound_expr.Bind(*in_schema));
+    auto indices = ArrayFromJSON(int32(), selection);
+    ExecBatch selected = input;
+    selected.selection_vector = std::make_shared<SelectionVector>(*indices);
+    selected.length = indices->length();
+
+    ASSERT_OK_AND_ASSIGN(Datum all, ExecuteScalarExpression(expr, input));
+    ASSERT_OK_AND_ASSIGN(Datum expected,
+                         Take(all, indices, TakeOptions::NoBoundsCheck()));
+    ASSERT_OK_AND_ASSIGN(Datum actual, ExecuteScalarExpression(expr, selected));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  };
+
+  // Few selected rows are computed directly, many are gathered after computing all
+  for (const std::string selection :
+       {"[]", "[3]", "[0, 3, 7]", "[0, 1, 2, 3, 4, 5, 7, 9]"}) {
+    check(selection, add(field_ref("a"), field_ref("b")));
+    check(selection, add(field_ref("a"), literal(5)));
+    check(selection, call("negate", {field_ref("a")}));
+    check(selection, greater(field_ref("a"), literal(4)));
+    check(selection, less_equal(field_ref("c"), literal("d")));
+    check(selection, equal(field_ref("c"), field_ref("c")));
+    check(selection, equal(field_ref("d"), literal(true)));
+    check(selection, and_(greater(add(field_ref("a"), field_ref("b")), literal(30)),
+                          not_equal(field_ref("c"), literal("g"))));
+    // Checked arithmetic doesn't compute selected rows, the columns are gathered
+    check(selection, call("add_checked", {field_ref("a"), field_ref("b")}));
+  }
+}
+
+TEST(Expression, ExecuteFused) {
+  // Long enough to span several tiles, with a partial last one
+  constexpr int64_t kLength = 200 * 1000 + 17;
+  constexpr int64_t kNoTiling = std::numeric_limits<int64_t>::max();
+  auto in_schema = schema({field("a", int32()), field("b", int32()),
+                           field("c", float64()), field("d", utf8())});
+  random::RandomArrayGenerator rng(42);
+  ExecBatch input({rng.Int32(kLength, -1000, 1000, /*null_probability=*/0.1),
+                   rng.Int32(kLength, -1000, 1000, /*null_probability=*/0),
+                   rng.Float64(kLength, -3000, 3000, /*null_probability=*/0.2),
+                   rng.String(kLength, 0, 4, /*null_probability=*/0.1)},
+                  kLength);
+  // Slices exercise the offsets of the arguments
+  ExecBatch sliced = input.Slice(123, kLength - 1000);
+
+  ExecContext exec_context;
+  auto check = [&](const ExecBatch& batch, const Expression& unbound_expr) {
+    ARROW_SCOPED_TRACE("expression: ", unbound_expr.ToString());
+    ASSERT_OK_AND_ASSIGN(auto expr, unbound_expr.Bind(*in_schema));
+    ASSERT_OK_AND_ASSIGN(Datum actual,
+                         ExecuteScalarExpression(expr, batch, &exec_context));
+
+    // Evaluate the calls one by one
+    std::function<Result<Datum>(const Expression&)> evaluate =
+        [&](const Expression& node) -> Result<Datum> {
+      if (auto lit = node.literal()) return *lit;
+      if (auto param = node.parameter()) return batch[param->indices[0]];
+      auto call = node.call();
+      std::vector<Datum> arguments;
+      for (const Expression& argument : call->arguments) {
+        ARROW_ASSIGN_OR_RAISE(Datum value, evaluate(argument));
+        arguments.push_back(std::move(value));
+      }
+      return CallFunction(call->function_name, arguments, call->options.get());
+    };
+    ASSERT_OK_AND_ASSIGN(Datum expected, evaluate(expr));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  };
+
+  // Tiles sized from the cache, a length rounded up to 128 rows, and no tiling
+  for (int64_t tile_length : {int64_t{0}, int64_t{100}, kNoTiling}) {
+    ARROW_SCOPED_TRACE("tile_length: ", tile_length);
+    exec_context.set_expression_tile_length(tile_length);
+    for (const ExecBatch& batch : {input, sliced}) {
+      check(batch,
+            greater(add(call("multiply", {field_ref("a"), literal(2)}), field_ref("b")),
+                    field_ref("c")));
+      check(batch, and_(greater(field_ref("a"), literal(0)),
+                        less(call("negate", {field_ref("c")}), literal(100.0))));
+      check(batch, call("is_null", {add(field_ref("a"), field_ref("b"))}));
+      // A call which isn't fused in the middle of the tree
+      check(batch, greater(add(call("utf8_length", {field_ref("d")}), field_ref("a")),
+                           literal(2)));
+      // Scalar subexpressions
+      check(batch, add(add(literal(1), literal(2)),
+                       call("multiply", {field_ref("a"), literal(3)})));
+    }
+  }
+
+  // Errors of the fused calls are reported
+  ASSERT_OK_AND_ASSIGN(
+      auto expr, call("multiply_checked", {call("add_checked", {field_ref("b"),
+                                                                literal(2147483000)}),
+                                           literal(2)})
+                     .Bind(*in_schema));
+  ASSERT_RAISES(Invalid, ExecuteScalarExpression(expr, input));
+}
+
+TEST(Expression, ApplySelectionVector) {
+  auto in_schema =
+      schema({field("a", float64()), field("b", float64()), field("c", utf8())});
+  ExecBatch input({ArrayFromJSON(float64(), "[1, 2, 3, null, 5]"),
+                   ArrayFromJSON(float64(), "[10, 20, 30, 40, 50]"),
+                   ArrayFromJSON(utf8(), R"(["v", "w", "x", "y", "z"])")},
+                  5);
+  input.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 3, 4]"));
+  input.length = 3;
+
+  ASSERT_OK_AND_ASSIGN(auto sum, add(field_ref("a"), field_ref("b")).Bind(*in_schema));
+  ASSERT_OK_AND_ASSIGN(auto a, field_ref("a").Bind(*in_schema));
+  ASSERT_OK_AND_ASSIGN(ExecBatch selected, ApplySelectionVector({sum, a}, input));
+  ASSERT_EQ(selected.selection_vector, nullptr);
+  ASSERT_EQ(selected.length, 3);
+  AssertDatumsEqual(ArrayFromJSON(float64(), "[1, null, 5]"), selected.values[0],
+                    /*verbose=*/true);
+  AssertDatumsEqual(ArrayFromJSON(float64(), "[10, 40, 50]"), selected.values[1],
+                    /*verbose=*/true);
+  // Columns which are not referenced are not gathered
+  AssertDatumsEqual(MakeNullScalar(utf8()), selected.values[2], /*verbose=*/true);
+}
+
 TEST(Expression, ExecuteChunkedArray) {
   // GH-41923: compute should generate the right result if input
   // ExecBatch is `chunked_array`.
@@ -1755,6 +1920,54 @@ TEST(Expression, SimplifyIsIn) {
       .ExpectUnchanged();
 }
 
+TEST(Expression, SimplifyIsInUnsortedValueSet) {
+  auto is_in = [](Expression field, std::shared_ptr<DataType> value_set_type,
+                  std::string json_array) {
+    SetLookupOptions options{ArrayFromJSON(value_set_type, json_array)};
+    return call("is_in", {field}, options);
+  };
+
+  // The simplified value sets are sorted, duplicates and NaNs satisfying no
+  // inequality are dropped
+  auto in_floats = is_in(field_ref("f64"), float64(), "[9, NaN, 1, 5, null, 5, 3]");
+  Simplify{in_floats}
+      .WithGuarantee(greater(field_ref("f64"), literal(3.0)))
+      .Expect(is_in(field_ref("f64"), float64(), "[5, 5, 9]"));
+  Simplify{in_floats}
+      .WithGuarantee(less_equal(field_ref("f64"), literal(3.0)))
+      .Expect(is_in(field_ref("f64"), float64(), "[1, 3]"));
+  Simplify{in_floats}
+      .WithGuarantee(equal(field_ref("f64"), literal(4.0)))
+      .Expect(false);
+
+  auto in_strings = is_in(field_ref("str"), utf8(), R"(["b", "a", "d", "c"])");
+  Simplify{in_strings}
+      .WithGuarantee(equal(field_ref("str"), literal("c")))
+      .Expect(is_in(field_ref("str"), utf8(), R"(["c"])"));
+  Simplify{in_strings}
+      .WithGuarantee(greater_equal(field_ref("str"), literal("b")))
+      .Expect(is_in(field_ref("str"), utf8(), R"(["b", "c", "d"])"));
+  Simplify{in_strings}
+      .WithGuarantee(greater(field_ref("str"), literal("d")))
+      .Expect(false);
+
+  // Many values, simplified against many equality guarantees
+  Int32Builder builder;
+  for (int32_t i = 9998; i >= 0; i -= 2) {
+    ASSERT_OK(builder.Append(i));
+  }
+  ASSERT_OK_AND_ASSIGN(auto value_set, builder.Finish());
+  auto in_evens = call("is_in", {field_ref("i32")}, SetLookupOptions{value_set});
+  for (int32_t i = -1; i <= 10000; i += 7) {
+    auto simplify = Simplify{in_evens}.WithGuarantee(equal(field_ref("i32"), literal(i)));
+    if (i % 2 == 0 && i < 10000) {
+      simplify.Expect(is_in(field_ref("i32"), int32(), "[" + std::to_string(i) + "]"));
+    } else {
+      simplify.Expect(false);
+    }
+  }
+}
+
 TEST(Expression, SimplifyThenExecute) {
   auto filter =
       or_({equal(field_ref("f32"), literal(0)),
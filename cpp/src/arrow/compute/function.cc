@@ -19,20 +19,25 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <sstream>
 
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
+#include "arrow/compute/cast_internal.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/function_internal.h"
 #include "arrow/compute/function_options.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/ree_util_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/datum.h"
 #include "arrow/device_allocation_type_set.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/ree_util.h"
 #include "arrow/util/tracing_internal.h"
 
 namespace arrow {
@@ -217,9 +222,39 @@ struct FunctionExecutorImpl : public FunctionExecutor {
       exec_ctx = default_exec_context();
     }
     kernel_ctx = KernelContext{exec_ctx, kernel};
+    casts.clear();
     return KernelInit(options);
   }
 
+  // Cast the i-th argument to the kernel's input type, reusing the cast executor
+  // of previous calls if the argument type is the same
+  Result<Datum> CastArgument(size_t i, const Datum& arg) {
+    ExecContext* ctx = kernel_ctx.exec_context();
+    const auto& in_type = in_types[i];
+    if (arg.type() == NULLPTR || is_nested(in_type.id())) {
+      // Leave the subtleties of nested types to the cast meta function
+      return Cast(arg, CastOptions::Safe(in_type), ctx);
+    }
+    if (casts.empty()) {
+      casts.resize(in_types.size());
+    }
+    auto& cast = casts[i];
+    if (cast == NULLPTR || cast->from_type != arg.type()) {
+      cast = std::make_unique<CachedCast>(
+          CachedCast{arg.type(), CastOptions::Safe(in_type), NULLPTR});
+      auto maybe_cast_func = internal::GetCastFunction(*in_type);
+      if (!maybe_cast_func.ok()) {
+        // Let the cast meta function report the error
+        cast.reset();
+        return Cast(arg, CastOptions::Safe(in_type), ctx);
+      }
+      ARROW_ASSIGN_OR_RAISE(cast->executor,
+                            (*maybe_cast_func)->GetBestExecutor({arg.type()}));
+      RETURN_NOT_OK(cast->executor->Init(&cast->options, ctx));
+    }
+    return cast->executor->Execute({arg});
+  }
+
   Result<Datum> Execute(const std::vector<Datum>& args, int64_t passed_length) override {
     util::tracing::Span span;
 
@@ -237,14 +272,13 @@ struct FunctionExecutorImpl : public FunctionExecutor {
     if (!inited) {
       ARROW_RETURN_NOT_OK(Init(NULLPTR, default_exec_context()));
     }
-    ExecContext* ctx = kernel_ctx.exec_context();
     // Cast arguments if necessary
     std::vector<Datum> args_with_cast(args.size());
     for (size_t i = 0; i != args.size(); ++i) {
       const auto& in_type = in_types[i];
       auto arg = args[i];
       if (in_type != args[i].type()) {
-        ARROW_ASSIGN_OR_RAISE(arg, Cast(args[i], CastOptions::Safe(in_type), ctx));
+        ARROW_ASSIGN_OR_RAISE(arg, CastArgument(i, args[i]));
       }
       args_with_cast[i] = std::move(arg);
     }
@@ -291,6 +325,14 @@ struct FunctionExecutorImpl : public FunctionExecutor {
   std::unique_ptr<KernelState> state;
   const FunctionOptions* options;
   bool inited;
+
+  struct CachedCast {
+    TypeHolder from_type;
+    CastOptions options;
+    std::shared_ptr<FunctionExecutor> executor;
+  };
+  // The casts of the arguments in the last call, by argument
+  std::vector<std::unique_ptr<CachedCast>> casts;
 };
 
 }  // namespace detail
@@ -334,10 +376,192 @@ Result<std::shared_ptr<FunctionExecutor>> Function::GetBestExecutor(
 
 namespace {
 
+// Whether some of the arguments are run-end encoded arrays, none being chunked
+bool HasRunEndEncodedArrays(const std::vector<Datum>& args) {
+  bool has_ree_array = false;
+  for (const auto& arg : args) {
+    if (arg.is_chunked_array()) {
+      return false;
+    }
+    has_ree_array |= arg.is_array() && arg.type()->id() == Type::RUN_END_ENCODED;
+  }
+  return has_ree_array;
+}
+
+// Scalar functions being elementwise, those which don't have kernels accepting run-end
+// encoded arrays are applied to their physical values instead, once per run.  The
+// result is run-end encoded with the runs of the arguments, or with the runs common to
+// all of them if they differ.  Run-end encoded arrays mixed with other arrays are
+// decoded.
+Result<Datum> ExecuteOnRuns(const Function& func, const std::vector<Datum>& args,
+                            const FunctionOptions* options, ExecContext* ctx) {
+  std::vector<const ArraySpan*> ree_arrays;
+  std::vector<ArraySpan> spans(args.size());
+  bool has_other_arrays = false;
+  for (size_t i = 0; i < args.size(); ++i) {
+    if (!args[i].is_array()) {
+      continue;
+    }
+    spans[i].SetMembers(*args[i].array());
+    if (args[i].type()->id() == Type::RUN_END_ENCODED) {
+      ree_arrays.push_back(&spans[i]);
+    } else {
+      has_other_arrays = true;
+    }
+  }
+  for (const auto* ree_array : ree_arrays) {
+    if (ree_array->length != ree_arrays[0]->length) {
+      return Status::Invalid("Array arguments must all be the same length");
+    }
+  }
+
+  std::vector<Datum> physical_args = args;
+  for (auto& arg : physical_args) {
+    if (arg.is_scalar() && arg.type()->id() == Type::RUN_END_ENCODED) {
+      arg = checked_cast<const RunEndEncodedScalar&>(*arg.scalar()).value;
+    }
+  }
+  if (has_other_arrays) {
+    for (size_t i = 0; i < args.size(); ++i) {
+      if (args[i].is_array() && args[i].type()->id() == Type::RUN_END_ENCODED) {
+        ARROW_ASSIGN_OR_RAISE(physical_args[i], RunEndDecode(args[i], ctx));
+      }
+    }
+    return func.Execute(physical_args, options, ctx);
+  }
+
+  const ArraySpan& first = *ree_arrays[0];
+  bool same_runs = true;
+  for (const auto* ree_array : ree_arrays) {
+    same_runs &= ree_array->offset == first.offset &&
+                 ree_array->child_data[0].buffers[1].data ==
+                     first.child_data[0].buffers[1].data &&
+                 ree_array->child_data[0].offset == first.child_data[0].offset;
+  }
+
+  std::shared_ptr<ArrayData> run_ends;
+  int64_t logical_offset = 0;
+  if (same_runs) {
+    // Only the values of the runs in the logical range are needed
+    const auto [physical_offset, physical_length] =
+        ::arrow::ree_util::FindPhysicalRange(first, first.offset, first.length);
+    run_ends = first.child_data[0].ToArrayData()->Slice(physical_offset, physical_length);
+    logical_offset = first.offset;
+    for (size_t i = 0; i < args.size(); ++i) {
+      if (args[i].is_array()) {
+        physical_args[i] =
+            args[i].array()->child_data[1]->Slice(physical_offset, physical_length);
+      }
+    }
+  } else {
+    ARROW_ASSIGN_OR_RAISE(auto common_runs, internal::ree_util::FindCommonRuns(
+                                                ree_arrays, ctx->memory_pool()));
+    run_ends = std::move(common_runs.run_ends);
+    for (size_t i = 0, j = 0; i < args.size(); ++i) {
+      if (args[i].is_array()) {
+        ARROW_ASSIGN_OR_RAISE(physical_args[i],
+                              Take(args[i].array()->child_data[1],
+                                   common_runs.physical_indices[j++],
+                                   TakeOptions::NoBoundsCheck(), ctx));
+      }
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(Datum values, func.Execute(physical_args, options, ctx));
+  DCHECK(values.is_array());
+  auto ree_type = run_end_encoded(run_ends->type, values.type());
+  return ArrayData::Make(std::move(ree_type), first.length, {NULLPTR},
+                         {std::move(run_ends), values.array()}, /*null_count=*/0,
+                         logical_offset);
+}
+
+// The position of the only array argument if it is dictionary encoded, the other
+// arguments being scalars, else -1
+int FindSingleDictionaryArray(const std::vector<Datum>& args) {
+  int dict_index = -1;
+  for (size_t i = 0; i < args.size(); ++i) {
+    if (args[i].is_scalar()) {
+      continue;
+    }
+    if (dict_index >= 0 || !args[i].is_array() ||
+        args[i].type()->id() != Type::DICTIONARY) {
+      return -1;
+    }
+    dict_index = static_cast<int>(i);
+  }
+  return dict_index;
+}
+
+// Scalar functions without kernels for dictionary arrays decode them first.  When
+// the dictionary is smaller than the array, the function is rather applied once to
+// the dictionary values and its results gathered through the indices.  This is only
+// valid if null indices give null results, and falls back to decoding if evaluating
+// the dictionary fails, as values not referenced by the indices may be invalid inputs.
+Result<std::optional<Datum>> ExecuteOnDictionary(const Function& func,
+                                                 const std::vector<Datum>& args,
+                                                 const std::vector<TypeHolder>& inputs,
+                                                 int dict_index,
+                                                 const FunctionOptions* options,
+                                                 ExecContext* ctx) {
+  const ArrayData& dict_array = *args[dict_index].array();
+  const auto& dict_type = checked_cast<const DictionaryType&>(*dict_array.type);
+  if (dict_array.dictionary->length > dict_array.length ||
+      func.DispatchExact(inputs).ok()) {
+    return std::nullopt;
+  }
+  std::vector<TypeHolder> dispatch_types = inputs;
+  auto maybe_kernel = func.DispatchBest(&dispatch_types);
+  if (!maybe_kernel.ok() || !dispatch_types[dict_index].type->Equals(
+                                *dict_type.value_type())) {
+    return std::nullopt;
+  }
+  const auto* kernel = static_cast<const ScalarKernel*>(*maybe_kernel);
+  if (kernel->null_handling != NullHandling::INTERSECTION &&
+      dict_array.GetNullCount() != 0) {
+    return std::nullopt;
+  }
+
+  std::vector<Datum> dict_args = args;
+  dict_args[dict_index] = dict_array.dictionary;
+  auto maybe_values = func.Execute(dict_args, options, ctx);
+  if (!maybe_values.ok()) {
+    return std::nullopt;
+  }
+  auto indices = dict_array.Copy();
+  indices->type = dict_type.index_type();
+  indices->dictionary = NULLPTR;
+  ARROW_ASSIGN_OR_RAISE(
+      Datum out, Take(*maybe_values, indices, TakeOptions::NoBoundsCheck(), ctx));
+  return out;
+}
+
+bool IsElementwise(const Function& func) {
+  return func.kind() == Function::SCALAR && func.is_pure() &&
+         dynamic_cast<const internal::CastFunction*>(&func) == nullptr;
+}
+
 Result<Datum> ExecuteInternal(const Function& func, std::vector<Datum> args,
                               int64_t passed_length, const FunctionOptions* options,
                               ExecContext* ctx) {
   ARROW_ASSIGN_OR_RAISE(auto inputs, internal::GetFunctionArgumentTypes(args));
+  const bool is_elementwise = IsElementwise(func);
+  if (is_elementwise && HasRunEndEncodedArrays(args)) {
+    std::vector<TypeHolder> dispatch_types = inputs;
+    if (!func.DispatchBest(&dispatch_types).ok()) {
+      return ExecuteOnRuns(func, args, options,
+                           ctx != nullptr ? ctx : default_exec_context());
+    }
+  }
+  if (is_elementwise) {
+    if (int dict_index = FindSingleDictionaryArray(args); dict_index >= 0) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto out, ExecuteOnDictionary(func, args, inputs, dict_index, options,
+                                        ctx != nullptr ? ctx : default_exec_context()));
+      if (out.has_value()) {
+        return std::move(*out);
+      }
+    }
+  }
   ARROW_ASSIGN_OR_RAISE(auto func_exec, func.GetBestExecutor(inputs));
   ARROW_RETURN_NOT_OK(func_exec->Init(options, ctx));
   return func_exec->Execute(args, passed_length);
@@ -355,6 +579,48 @@ Result<Datum> Function::Execute(const ExecBatch& batch, const FunctionOptions* o
   return ExecuteInternal(*this, batch.values, batch.length, options, ctx);
 }
 
+BoundFunctionCall::BoundFunctionCall(std::shared_ptr<const Function> func,
+                                     const FunctionOptions* options, ExecContext* ctx)
+    : func_(std::move(func)),
+      options_(options != NULLPTR ? options->Copy() : NULLPTR),
+      ctx_(ctx) {}
+
+BoundFunctionCall::~BoundFunctionCall() = default;
+
+Result<std::unique_ptr<BoundFunctionCall>> BoundFunctionCall::Make(
+    const std::string& func_name, const FunctionOptions* options, ExecContext* ctx) {
+  FunctionRegistry* registry =
+      ctx != NULLPTR ? ctx->func_registry() : GetFunctionRegistry();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<const Function> func,
+                        registry->GetFunction(func_name));
+  RETURN_NOT_OK(CheckOptions(*func, options));
+  return std::make_unique<BoundFunctionCall>(std::move(func), options, ctx);
+}
+
+Result<Datum> BoundFunctionCall::Call(const std::vector<Datum>& args, int64_t length) {
+  if (func_->kind() == Function::META ||
+      (IsElementwise(*func_) &&
+       (HasRunEndEncodedArrays(args) || FindSingleDictionaryArray(args) >= 0))) {
+    if (length == -1) {
+      return func_->Execute(args, options_.get(), ctx_);
+    }
+    return func_->Execute(ExecBatch(args, length), options_.get(), ctx_);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto types, internal::GetFunctionArgumentTypes(args));
+  for (const auto& [cached_types, executor] : executors_) {
+    if (cached_types == types) {
+      return executor->Execute(args, length);
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto executor, func_->GetBestExecutor(types));
+  RETURN_NOT_OK(executor->Init(options_.get(), ctx_));
+  if (executors_.size() >= static_cast<size_t>(kMaxCachedSignatures)) {
+    executors_.erase(executors_.begin());
+  }
+  executors_.emplace_back(std::move(types), executor);
+  return executor->Execute(args, length);
+}
+
 namespace {
 
 Status ValidateFunctionSummary(const std::string& s) {
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -135,6 +136,56 @@ class ARROW_EXPORT FunctionExecutor {
   virtual Result<Datum> Execute(const std::vector<Datum>& args, int64_t length = -1) = 0;
 };
 
+/// \brief A reusable call of a function with fixed options
+///
+/// Calling a function by name looks it up, dispatches a kernel and initializes
+/// its state every time, which can cost as much as the computation itself on
+/// small inputs.  A BoundFunctionCall does this once per distinct list of
+/// argument types and reuses the initialized executor, including the casts of
+/// arguments to the kernel's input types, on later calls with the same types.
+///
+/// Meta functions, and elementwise functions given dictionary or run-end
+/// encoded arrays, are executed through Function::Execute on every call.
+///
+/// A BoundFunctionCall is not thread-safe.
+class ARROW_EXPORT BoundFunctionCall {
+ public:
+  /// \param[in] func the function to call
+  /// \param[in] options the options of the calls, copied; null for the defaults
+  /// \param[in] ctx the context of the calls; null for the default context
+  explicit BoundFunctionCall(std::shared_ptr<const Function> func,
+                             const FunctionOptions* options = NULLPTR,
+                             ExecContext* ctx = NULLPTR);
+  ~BoundFunctionCall();
+
+  /// \brief Bind a call of the function of the given name in the context's registry
+  static Result<std::unique_ptr<BoundFunctionCall>> Make(
+      const std::string& func_name, const FunctionOptions* options = NULLPTR,
+      ExecContext* ctx = NULLPTR);
+
+  /// \brief Call the function, with the same semantics as Function::Execute
+  ///
+  /// \param[in] args the arguments of the call
+  /// \param[in] length the batch length, or -1 to infer it (see
+  /// FunctionExecutor::Execute)
+  Result<Datum> Call(const std::vector<Datum>& args, int64_t length = -1);
+
+  const Function& function() const { return *func_; }
+
+  /// \brief The number of argument type lists with a cached executor
+  int num_cached_signatures() const { return static_cast<int>(executors_.size()); }
+
+  /// The maximum number of cached executors; the oldest is evicted beyond that
+  static constexpr int kMaxCachedSignatures = 16;
+
+ private:
+  std::shared_ptr<const Function> func_;
+  std::unique_ptr<FunctionOptions> options_;
+  ExecContext* ctx_;
+  std::vector<std::pair<std::vector<TypeHolder>, std::shared_ptr<FunctionExecutor>>>
+      executors_;
+};
+
 /// \brief Base class for compute functions. Function implementations contain a
 /// collection of "kernels" which are implementations of the function for
 /// specific argument types. Selecting a viable kernel for executing a function
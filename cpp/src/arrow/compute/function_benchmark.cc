@@ -174,6 +174,34 @@ void BM_ExecuteScalarKernelOnScalar(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * N);
 }
 
+void BM_CallFunctionOnSmallArrays(benchmark::State& state) {
+  // Call a function by name on tiny inputs needing an implicit cast:
+  // lookup, dispatch, kernel init and cast dispatch happen on every call
+  random::RandomArrayGenerator rag(kSeed);
+  const std::vector<Datum> args = {rag.Int32(8, 0, 100), rag.Int64(8, 0, 100)};
+
+  for (auto _ : state) {
+    ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("add", args));
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_BoundCallOnSmallArrays(benchmark::State& state) {
+  // Same as above, reusing the dispatched kernels through a BoundFunctionCall
+  random::RandomArrayGenerator rag(kSeed);
+  const std::vector<Datum> args = {rag.Int32(8, 0, 100), rag.Int64(8, 0, 100)};
+  ASSERT_OK_AND_ASSIGN(auto call, BoundFunctionCall::Make("add"));
+
+  for (auto _ : state) {
+    ASSERT_OK_AND_ASSIGN(Datum result, call->Call(args));
+    benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
 void BM_ExecSpanIterator(benchmark::State& state) {
   // Measure overhead related to splitting ExecBatch into smaller non-owning
   // ExecSpans for parallelism or more optimal CPU cache affinity
@@ -215,6 +243,8 @@ BENCHMARK(BM_CastDispatchBaseline);
 BENCHMARK(BM_AddDispatch);
 BENCHMARK(BM_ExecuteScalarFunctionOnScalar);
 BENCHMARK(BM_ExecuteScalarKernelOnScalar);
+BENCHMARK(BM_CallFunctionOnSmallArrays);
+BENCHMARK(BM_BoundCallOnSmallArrays);
 BENCHMARK(BM_ExecSpanIterator)->RangeMultiplier(4)->Range(1024, 64 * 1024);
 
 }  // namespace compute
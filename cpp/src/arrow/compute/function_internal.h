@@ -521,9 +521,9 @@ GenericFromScalar(const std::shared_ptr<Scalar>& value) {
   }
   const auto& holder = checked_cast<const BaseListScalar&>(*value);
   if (!holder.is_valid) return Status::Invalid("Got null scalar");
+  ARROW_ASSIGN_OR_RAISE(auto scalars, holder.value->GetScalars());
   std::vector<ValueType> result;
-  for (int i = 0; i < holder.value->length(); i++) {
-    ARROW_ASSIGN_OR_RAISE(auto scalar, holder.value->GetScalar(i));
+  for (const auto& scalar : scalars) {
     ARROW_ASSIGN_OR_RAISE(auto v, GenericFromScalar<ValueType>(scalar));
     result.push_back(std::move(v));
   }
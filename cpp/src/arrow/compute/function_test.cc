@@ -461,5 +461,78 @@ TEST(FunctionExecutor, Basics) {
   }
 }
 
+namespace {
+
+// Add one to int32 values, implicitly casting int8 values to int32
+class AddOneFunction : public ScalarFunction {
+ public:
+  AddOneFunction()
+      : ScalarFunction("test_add_one", Arity::Unary(), /*doc=*/FunctionDoc::Empty()) {}
+
+  Result<const Kernel*> DispatchBest(std::vector<TypeHolder>* values) const override {
+    if (values->size() == 1 && (*values)[0].id() == Type::INT8) {
+      (*values)[0] = int32();
+    }
+    return DispatchExact(*values);
+  }
+};
+
+Status AddOneExec(KernelContext*, const ExecSpan& batch, ExecResult* out) {
+  const int32_t* values = batch[0].array.GetValues<int32_t>(1);
+  int32_t* out_values = out->array_span_mutable()->GetValues<int32_t>(1);
+  for (int64_t i = 0; i < batch.length; ++i) {
+    out_values[i] = values[i] + 1;
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+TEST(BoundFunctionCall, Basics) {
+  auto func = std::make_shared<AddOneFunction>();
+  int init_calls = 0;
+  auto init = [&](KernelContext*,
+                  const KernelInitArgs&) -> Result<std::unique_ptr<KernelState>> {
+    ++init_calls;
+    return nullptr;
+  };
+  ASSERT_OK(func->AddKernel({int32()}, int32(), AddOneExec, init));
+
+  BoundFunctionCall call(func);
+  ASSERT_EQ(0, call.num_cached_signatures());
+
+  // The kernel is only dispatched and initialized on the first call
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto result, call.Call({ArrayFromJSON(int32(), "[1, null]")}));
+    AssertDatumsEqual(ArrayFromJSON(int32(), "[2, null]"), result);
+  }
+  ASSERT_EQ(1, init_calls);
+  ASSERT_EQ(1, call.num_cached_signatures());
+
+  // Implicitly cast arguments get an executor of their own
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto result, call.Call({ArrayFromJSON(int8(), "[3]")}));
+    AssertDatumsEqual(ArrayFromJSON(int32(), "[4]"), result);
+  }
+  ASSERT_EQ(2, init_calls);
+  ASSERT_EQ(2, call.num_cached_signatures());
+
+  ASSERT_RAISES(NotImplemented, call.Call({ArrayFromJSON(int64(), "[1]")}));
+  ASSERT_RAISES(Invalid, call.Call({ArrayFromJSON(int32(), "[1]"),
+                                    ArrayFromJSON(int32(), "[1]")}));
+  ASSERT_EQ(2, call.num_cached_signatures());
+}
+
+TEST(BoundFunctionCall, Make) {
+  ASSERT_RAISES(KeyError, BoundFunctionCall::Make("no_such_function"));
+
+  CastOptions options = CastOptions::Safe(int64());
+  ASSERT_OK_AND_ASSIGN(auto call, BoundFunctionCall::Make("cast", &options));
+  // The options are copied
+  options.to_type = int16();
+  ASSERT_OK_AND_ASSIGN(auto result, call->Call({ArrayFromJSON(int32(), "[1, 2]")}));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[1, 2]"), result);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -536,6 +536,12 @@ struct ARROW_EXPORT Kernel {
 /// employed this may not be possible.
 using ArrayKernelExec = Status (*)(KernelContext*, const ExecSpan&, ExecResult*);
 
+/// \brief Type-erased function pointer for executing a scalar kernel on the
+/// selected rows of its inputs only: the output has one row per selection index,
+/// computed from the input values at that index.
+using ArrayKernelSelectiveExec = Status (*)(KernelContext*, const ExecSpan&,
+                                            const SelectionVectorSpan&, ExecResult*);
+
 /// \brief Kernel data structure for implementations of ScalarFunction. In
 /// addition to the members found in Kernel, contains the null handling
 /// and memory pre-allocation preferences.
@@ -556,6 +562,13 @@ struct ARROW_EXPORT ScalarKernel : public Kernel {
   /// through the KernelContext.
   ArrayKernelExec exec;
 
+  /// \brief Optionally, compute the selected rows of the inputs only. Used for
+  /// batches with a selection vector, instead of gathering the selected rows of
+  /// the inputs first. The output is preallocated and its validity bitmap
+  /// computed according to null_handling, so this requires
+  /// MemAllocation::PREALLOCATE and a fixed-width output type.
+  ArrayKernelSelectiveExec selective_exec = NULLPTR;
+
   /// \brief Writing execution results into larger contiguous allocations
   /// requires that the kernel be able to write into sliced output ArrayData*,
   /// including sliced output validity bitmaps. Some kernel implementations may
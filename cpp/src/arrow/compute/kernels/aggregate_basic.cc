@@ -15,6 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_basic_internal.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
@@ -101,7 +105,10 @@ struct CountImpl : public ScalarAggregator {
       this->non_nulls += batch.length;
     } else if (batch[0].is_array()) {
       const ArraySpan& input = batch[0].array;
-      const int64_t nulls = input.GetNullCount();
+      // The nulls of run-end encoded arrays are in their values
+      const int64_t nulls = input.type->id() == Type::RUN_END_ENCODED
+                                ? input.ComputeLogicalNullCount()
+                                : input.GetNullCount();
       this->nulls += nulls;
       this->non_nulls += input.length - nulls;
     } else {
@@ -220,53 +227,147 @@ struct CountDistinctImpl : public ScalarAggregator {
   std::unique_ptr<MemoTable> memo_table_;
 };
 
+// ----------------------------------------------------------------------
+// Approximate distinct count implementation
+//
+// A HyperLogLog sketch: each value is hashed, the top bits of the hash pick one of
+// the registers which keeps the maximum rank of the first set bit among the
+// remaining bits.  Sketches merge by taking the maximum of each register.
+
 template <typename Type, typename VisitorArgType>
+struct ApproximateCountDistinctImpl : public ScalarAggregator {
+  // 2^14 registers, for a relative standard error of 1.04 / sqrt(2^14) ~ 0.8%
+  static constexpr int kPrecision = 14;
+  static constexpr int kNumRegisters = 1 << kPrecision;
+
+  ApproximateCountDistinctImpl(MemoryPool*, CountOptions options)
+      : options(std::move(options)), registers(kNumRegisters, 0) {}
+
+  void Update(VisitorArgType value) {
+    const uint64_t hash = arrow::internal::MixHash(
+        arrow::internal::ScalarHelper<VisitorArgType>::ComputeHash(value));
+    const uint64_t index = hash >> (64 - kPrecision);
+    // The sentinel bit bounds the rank when all remaining bits are zero
+    const uint64_t rest = (hash << kPrecision) | (uint64_t{1} << (kPrecision - 1));
+    const auto rank = static_cast<uint8_t>(bit_util::CountLeadingZeros(rest) + 1);
+    registers[index] = std::max(registers[index], rank);
+  }
+
+  Status Consume(KernelContext*, const ExecSpan& batch) override {
+    if (batch[0].is_array()) {
+      const ArraySpan& arr = batch[0].array;
+      this->has_nulls = this->has_nulls || arr.GetNullCount() > 0;
+      VisitArraySpanInline<Type>(
+          arr, [&](VisitorArgType value) { Update(value); }, [] {});
+    } else {
+      const Scalar& input = *batch[0].scalar;
+      this->has_nulls = this->has_nulls || !input.is_valid;
+      if (input.is_valid) {
+        Update(UnboxScalar<Type>::Unbox(input));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other_state = checked_cast<const ApproximateCountDistinctImpl&>(src);
+    for (int i = 0; i < kNumRegisters; ++i) {
+      registers[i] = std::max(registers[i], other_state.registers[i]);
+    }
+    this->has_nulls = this->has_nulls || other_state.has_nulls;
+    return Status::OK();
+  }
+
+  int64_t Estimate() const {
+    constexpr double m = kNumRegisters;
+    const double alpha = 0.7213 / (1 + 1.079 / m);
+    double sum = 0;
+    int64_t num_zeros = 0;
+    for (const uint8_t rank : registers) {
+      sum += std::ldexp(1.0, -rank);
+      num_zeros += rank == 0;
+    }
+    double estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && num_zeros > 0) {
+      // Linear counting is more accurate for small cardinalities
+      estimate = m * std::log(m / static_cast<double>(num_zeros));
+    }
+    return static_cast<int64_t>(std::llround(estimate));
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    const auto& state = checked_cast<const ApproximateCountDistinctImpl&>(*ctx->state());
+    const int64_t nulls = state.has_nulls ? 1 : 0;
+    switch (state.options.mode) {
+      case CountOptions::ONLY_VALID:
+        *out = Datum(state.Estimate());
+        break;
+      case CountOptions::ALL:
+        *out = Datum(state.Estimate() + nulls);
+        break;
+      case CountOptions::ONLY_NULL:
+        *out = Datum(nulls);
+        break;
+      default:
+        DCHECK(false) << "unreachable";
+    }
+    return Status::OK();
+  }
+
+  const CountOptions options;
+  bool has_nulls = false;
+  std::vector<uint8_t> registers;
+};
+
+template <template <typename...> class Impl, typename Type, typename VisitorArgType>
 Result<std::unique_ptr<KernelState>> CountDistinctInit(KernelContext* ctx,
                                                        const KernelInitArgs& args) {
-  return std::make_unique<CountDistinctImpl<Type, VisitorArgType>>(
+  return std::make_unique<Impl<Type, VisitorArgType>>(
       ctx->memory_pool(), static_cast<const CountOptions&>(*args.options));
 }
 
-template <typename Type, typename VisitorArgType = typename Type::c_type>
+template <template <typename...> class Impl, typename Type,
+          typename VisitorArgType = typename Type::c_type>
 void AddCountDistinctKernel(InputType type, ScalarAggregateFunction* func) {
   AddAggKernel(KernelSignature::Make({type}, int64()),
-               CountDistinctInit<Type, VisitorArgType>, func);
+               CountDistinctInit<Impl, Type, VisitorArgType>, func);
 }
 
+template <template <typename...> class Impl>
 void AddCountDistinctKernels(ScalarAggregateFunction* func) {
   // Boolean
-  AddCountDistinctKernel<BooleanType>(boolean(), func);
+  AddCountDistinctKernel<Impl, BooleanType>(boolean(), func);
   // Number
-  AddCountDistinctKernel<Int8Type>(int8(), func);
-  AddCountDistinctKernel<Int16Type>(int16(), func);
-  AddCountDistinctKernel<Int32Type>(int32(), func);
-  AddCountDistinctKernel<Int64Type>(int64(), func);
-  AddCountDistinctKernel<UInt8Type>(uint8(), func);
-  AddCountDistinctKernel<UInt16Type>(uint16(), func);
-  AddCountDistinctKernel<UInt32Type>(uint32(), func);
-  AddCountDistinctKernel<UInt64Type>(uint64(), func);
-  AddCountDistinctKernel<HalfFloatType>(float16(), func);
-  AddCountDistinctKernel<FloatType>(float32(), func);
-  AddCountDistinctKernel<DoubleType>(float64(), func);
+  AddCountDistinctKernel<Impl, Int8Type>(int8(), func);
+  AddCountDistinctKernel<Impl, Int16Type>(int16(), func);
+  AddCountDistinctKernel<Impl, Int32Type>(int32(), func);
+  AddCountDistinctKernel<Impl, Int64Type>(int64(), func);
+  AddCountDistinctKernel<Impl, UInt8Type>(uint8(), func);
+  AddCountDistinctKernel<Impl, UInt16Type>(uint16(), func);
+  AddCountDistinctKernel<Impl, UInt32Type>(uint32(), func);
+  AddCountDistinctKernel<Impl, UInt64Type>(uint64(), func);
+  AddCountDistinctKernel<Impl, HalfFloatType>(float16(), func);
+  AddCountDistinctKernel<Impl, FloatType>(float32(), func);
+  AddCountDistinctKernel<Impl, DoubleType>(float64(), func);
   // Date
-  AddCountDistinctKernel<Date32Type>(date32(), func);
-  AddCountDistinctKernel<Date64Type>(date64(), func);
+  AddCountDistinctKernel<Impl, Date32Type>(date32(), func);
+  AddCountDistinctKernel<Impl, Date64Type>(date64(), func);
   // Time
-  AddCountDistinctKernel<Time32Type>(match::SameTypeId(Type::TIME32), func);
-  AddCountDistinctKernel<Time64Type>(match::SameTypeId(Type::TIME64), func);
+  AddCountDistinctKernel<Impl, Time32Type>(match::SameTypeId(Type::TIME32), func);
+  AddCountDistinctKernel<Impl, Time64Type>(match::SameTypeId(Type::TIME64), func);
   // Timestamp & Duration
-  AddCountDistinctKernel<TimestampType>(match::SameTypeId(Type::TIMESTAMP), func);
-  AddCountDistinctKernel<DurationType>(match::SameTypeId(Type::DURATION), func);
+  AddCountDistinctKernel<Impl, TimestampType>(match::SameTypeId(Type::TIMESTAMP), func);
+  AddCountDistinctKernel<Impl, DurationType>(match::SameTypeId(Type::DURATION), func);
   // Interval
-  AddCountDistinctKernel<MonthIntervalType>(month_interval(), func);
-  AddCountDistinctKernel<DayTimeIntervalType>(day_time_interval(), func);
-  AddCountDistinctKernel<MonthDayNanoIntervalType>(month_day_nano_interval(), func);
+  AddCountDistinctKernel<Impl, MonthIntervalType>(month_interval(), func);
+  AddCountDistinctKernel<Impl, DayTimeIntervalType>(day_time_interval(), func);
+  AddCountDistinctKernel<Impl, MonthDayNanoIntervalType>(month_day_nano_interval(), func);
   // Binary & String
-  AddCountDistinctKernel<BinaryType, std::string_view>(match::BinaryLike(), func);
-  AddCountDistinctKernel<LargeBinaryType, std::string_view>(match::LargeBinaryLike(),
-                                                            func);
+  AddCountDistinctKernel<Impl, BinaryType, std::string_view>(match::BinaryLike(), func);
+  AddCountDistinctKernel<Impl, LargeBinaryType, std::string_view>(
+      match::LargeBinaryLike(), func);
   // Fixed binary & Decimal
-  AddCountDistinctKernel<FixedSizeBinaryType, std::string_view>(
+  AddCountDistinctKernel<Impl, FixedSizeBinaryType, std::string_view>(
       match::FixedSizeBinaryLike(), func);
 }
 
@@ -524,6 +625,99 @@ void AddMinOrMaxAggKernel(ScalarAggregateFunction* func,
   AddAggKernel(std::move(sig), std::move(init), std::move(finalize), func);
 }
 
+// ----------------------------------------------------------------------
+// Run-end encoded implementation
+
+// Aggregates which don't depend on how many times each value repeats, such as
+// min_max, consume the physical values of run-end encoded arrays with the kernel of
+// their values type.
+struct RunEndEncodedValuesAggregator : public ScalarAggregator {
+  RunEndEncodedValuesAggregator(const Kernel* values_kernel,
+                                std::unique_ptr<KernelState> values_state)
+      : values_kernel(values_kernel), values_state(std::move(values_state)) {}
+
+  Status Consume(KernelContext* ctx, const ExecSpan& batch) override {
+    ExecValue value;
+    int64_t length = batch.length;
+    if (batch[0].is_array()) {
+      const ArraySpan& data = batch[0].array;
+      int64_t physical_offset;
+      std::tie(physical_offset, length) =
+          ::arrow::ree_util::FindPhysicalRange(data, data.offset, data.length);
+      value.array = ::arrow::ree_util::ValuesArray(data);
+      value.array.SetSlice(value.array.offset + physical_offset, length);
+    } else {
+      value.SetScalar(
+          checked_cast<const RunEndEncodedScalar&>(*batch[0].scalar).value.get());
+    }
+    KernelContext values_ctx = MakeValuesContext(ctx);
+    return values_aggregator().Consume(&values_ctx, ExecSpan({std::move(value)}, length));
+  }
+
+  Status MergeFrom(KernelContext* ctx, KernelState&& src) override {
+    auto& other = checked_cast<RunEndEncodedValuesAggregator&>(src);
+    KernelContext values_ctx = MakeValuesContext(ctx);
+    return values_aggregator().MergeFrom(&values_ctx, std::move(*other.values_state));
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    KernelContext values_ctx = MakeValuesContext(ctx);
+    return values_aggregator().Finalize(&values_ctx, out);
+  }
+
+  KernelContext MakeValuesContext(KernelContext* ctx) {
+    KernelContext values_ctx(ctx->exec_context(), values_kernel);
+    values_ctx.SetState(values_state.get());
+    return values_ctx;
+  }
+
+  ScalarAggregator& values_aggregator() {
+    return checked_cast<ScalarAggregator&>(*values_state);
+  }
+
+  const Kernel* values_kernel;
+  std::unique_ptr<KernelState> values_state;
+};
+
+// Add a kernel for run-end encoded arrays to `func`, delegating to its kernel for
+// their values type
+void AddRunEndEncodedValuesAggKernel(ScalarAggregateFunction* func, OutputType out_type,
+                                     bool ordered = false) {
+  auto sig = KernelSignature::Make({InputType(Type::RUN_END_ENCODED)}, out_type);
+  auto init = [func](KernelContext* ctx,
+                     const KernelInitArgs& args) -> Result<std::unique_ptr<KernelState>> {
+    std::vector<TypeHolder> value_types = {
+        checked_cast<const RunEndEncodedType&>(*args.inputs[0]).value_type()};
+    ARROW_ASSIGN_OR_RAISE(auto kernel, func->DispatchExact(value_types));
+    KernelInitArgs values_args{kernel, value_types, args.options};
+    ARROW_ASSIGN_OR_RAISE(auto values_state, kernel->init(ctx, values_args));
+    return std::make_unique<RunEndEncodedValuesAggregator>(kernel,
+                                                           std::move(values_state));
+  };
+  AddAggKernel(std::move(sig), std::move(init), func, SimdLevel::NONE, ordered);
+}
+
+// Output type of a kernel for run-end encoded arrays, resolved from their values type
+OutputType RunEndEncodedOutputType(OutputType::Resolver values_resolver) {
+  return OutputType([values_resolver](KernelContext* ctx,
+                                      const std::vector<TypeHolder>& types) {
+    return values_resolver(
+        ctx, {checked_cast<const RunEndEncodedType&>(*types[0]).value_type()});
+  });
+}
+
+// Add kernels to `func` for run-end encoded arrays of the given value types, which are
+// consumed by the `init` state as is
+void AddRunEndEncodedAggKernels(KernelInit init,
+                                const std::vector<std::shared_ptr<DataType>>& types,
+                                OutputType out_type, ScalarAggregateFunction* func) {
+  for (const auto& ty : types) {
+    auto sig =
+        KernelSignature::Make({InputType(match::RunEndEncoded(ty->id()))}, out_type);
+    AddAggKernel(std::move(sig), init, func, SimdLevel::NONE);
+  }
+}
+
 // ----------------------------------------------------------------------
 // Any implementation
 
@@ -930,6 +1124,15 @@ const FunctionDoc count_distinct_doc{"Count the number of unique values",
                                      {"array"},
                                      "CountOptions"};
 
+const FunctionDoc approximate_count_distinct_doc{
+    "Approximate the number of unique values",
+    ("The count of non-null unique values is estimated with a HyperLogLog sketch,\n"
+     "with a relative standard error of about 0.8%, in constant memory.\n"
+     "By default, only non-null values are counted.\n"
+     "This can be changed through CountOptions."),
+    {"array"},
+    "CountOptions"};
+
 const FunctionDoc sum_doc{
     "Compute the sum of a numeric array",
     ("Null values are ignored by default. Minimum count of non-null\n"
@@ -1042,7 +1245,13 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   func = std::make_shared<ScalarAggregateFunction>(
       "count_distinct", Arity::Unary(), count_distinct_doc, &default_count_options);
   // Takes any input, outputs int64 scalar
-  AddCountDistinctKernels(func.get());
+  AddCountDistinctKernels<CountDistinctImpl>(func.get());
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
+  func = std::make_shared<ScalarAggregateFunction>(
+      "approximate_count_distinct", Arity::Unary(), approximate_count_distinct_doc,
+      &default_count_options);
+  AddCountDistinctKernels<ApproximateCountDistinctImpl>(func.get());
   DCHECK_OK(registry->AddFunction(std::move(func)));
 
   func = std::make_shared<ScalarAggregateFunction>("sum", Arity::Unary(), sum_doc,
@@ -1056,6 +1265,12 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddArrayScalarAggKernels(SumInit, UnsignedIntTypes(), uint64(), func.get());
   AddArrayScalarAggKernels(SumInit, FloatingPointTypes(), float64(), func.get());
   AddArrayScalarAggKernels(SumInit, {null()}, int64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, {boolean()}, uint64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, {decimal128(1, 0), decimal256(1, 0)},
+                             RunEndEncodedOutputType(FirstType), func.get());
+  AddRunEndEncodedAggKernels(SumInit, SignedIntTypes(), int64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, UnsignedIntTypes(), uint64(), func.get());
+  AddRunEndEncodedAggKernels(SumInit, FloatingPointTypes(), float64(), func.get());
   // Add the SIMD variants for sum
 #if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
   auto cpu_info = arrow::internal::CpuInfo::GetInstance();
@@ -1081,6 +1296,10 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddAggKernel(KernelSignature::Make({Type::DECIMAL256}, FirstType), MeanInit, func.get(),
                SimdLevel::NONE);
   AddArrayScalarAggKernels(MeanInit, {null()}, float64(), func.get());
+  AddRunEndEncodedAggKernels(MeanInit, {boolean()}, float64(), func.get());
+  AddRunEndEncodedAggKernels(MeanInit, NumericTypes(), float64(), func.get());
+  AddRunEndEncodedAggKernels(MeanInit, {decimal128(1, 0), decimal256(1, 0)},
+                             RunEndEncodedOutputType(FirstType), func.get());
   // Add the SIMD variants for mean
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
@@ -1103,6 +1322,8 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddFirstLastKernels(FirstLastInit, NumericTypes(), func.get());
   AddFirstLastKernels(FirstLastInit, BaseBinaryTypes(), func.get());
   AddFirstLastKernels(FirstLastInit, TemporalTypes(), func.get());
+  AddRunEndEncodedValuesAggKernel(func.get(), RunEndEncodedOutputType(FirstLastType),
+                                  /*ordered=*/true);
   DCHECK_OK(registry->AddFunction(std::move(func)));
 
   // Add first/last as convenience functions
@@ -1127,6 +1348,7 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddMinMaxKernel(MinMaxInitDefault, Type::INTERVAL_MONTHS, func.get());
   AddMinMaxKernel(MinMaxInitDefault, Type::DECIMAL128, func.get());
   AddMinMaxKernel(MinMaxInitDefault, Type::DECIMAL256, func.get());
+  AddRunEndEncodedValuesAggKernel(func.get(), RunEndEncodedOutputType(MinMaxType));
   // Add the SIMD variants for min max
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (cpu_info->IsSupported(arrow::internal::CpuInfo::AVX2)) {
@@ -24,6 +24,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -37,6 +38,7 @@
 #include "arrow/util/align_util.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow::compute::internal {
 namespace {
@@ -53,12 +55,21 @@ struct SumImpl : public ScalarAggregator {
   using SumCType = typename TypeTraits<SumType>::CType;
   using OutputType = typename TypeTraits<SumType>::ScalarType;
 
+  // Decimal128 and Decimal256 values of a precision of at most 18 digits are
+  // summed on int64 lanes
+  static constexpr bool kMaybeSmallDecimal =
+      std::is_same_v<ArrowType, Decimal128Type> ||
+      std::is_same_v<ArrowType, Decimal256Type>;
+
   SumImpl(std::shared_ptr<DataType> out_type, ScalarAggregateOptions options_)
       : out_type(std::move(out_type)), options(std::move(options_)) {}
 
   Status Consume(KernelContext*, const ExecSpan& batch) override {
     if (batch[0].is_array()) {
       const ArraySpan& data = batch[0].array;
+      if (data.type->id() == Type::RUN_END_ENCODED) {
+        return ConsumeRuns(data);
+      }
       this->count += data.length - data.GetNullCount();
       this->nulls_observed = this->nulls_observed || data.GetNullCount();
 
@@ -69,11 +80,22 @@ struct SumImpl : public ScalarAggregator {
 
       if (is_boolean_type<ArrowType>::value) {
         this->sum += GetTrueCount(data);
+      } else if constexpr (kMaybeSmallDecimal) {
+        if (checked_cast<const ArrowType&>(*data.type).precision() <=
+            std::numeric_limits<int64_t>::digits10) {
+          this->sum += SumSmallDecimalArray<SumCType, SimdLevel>(data);
+        } else {
+          this->sum += SumArray<CType, SumCType, SimdLevel>(data);
+        }
       } else {
         this->sum += SumArray<CType, SumCType, SimdLevel>(data);
       }
     } else {
-      const Scalar& data = *batch[0].scalar;
+      const Scalar& data = batch[0].scalar->type->id() == Type::RUN_END_ENCODED
+                               ? *checked_cast<const RunEndEncodedScalar&>(
+                                      *batch[0].scalar)
+                                      .value
+                               : *batch[0].scalar;
       this->count += data.is_valid * batch.length;
       this->nulls_observed = this->nulls_observed || !data.is_valid;
       if (data.is_valid) {
@@ -84,6 +106,50 @@ struct SumImpl : public ScalarAggregator {
     return Status::OK();
   }
 
+  // Each physical value of a run-end encoded array is added once, multiplied by the
+  // length of its run
+  Status ConsumeRuns(const ArraySpan& data) {
+    const int64_t null_count = data.ComputeLogicalNullCount();
+    this->count += data.length - null_count;
+    this->nulls_observed = this->nulls_observed || null_count;
+
+    if (!options.skip_nulls && this->nulls_observed) {
+      // Short-circuit
+      return Status::OK();
+    }
+
+    switch (checked_cast<const RunEndEncodedType&>(*data.type).run_end_type()->id()) {
+      case Type::INT16:
+        AddRuns<int16_t>(data);
+        break;
+      case Type::INT32:
+        AddRuns<int32_t>(data);
+        break;
+      default:
+        AddRuns<int64_t>(data);
+        break;
+    }
+    return Status::OK();
+  }
+
+  template <typename RunEndCType>
+  void AddRuns(const ArraySpan& data) {
+    const ArraySpan& values = ::arrow::ree_util::ValuesArray(data);
+    const ::arrow::ree_util::RunEndEncodedArraySpan<RunEndCType> ree_span(data);
+    for (auto it = ree_span.begin(); !it.is_end(ree_span); ++it) {
+      const int64_t i = it.index_into_array();
+      if (values.IsValid(i)) {
+        SumCType value;
+        if constexpr (is_boolean_type<ArrowType>::value) {
+          value = bit_util::GetBit(values.buffers[1].data, values.offset + i);
+        } else {
+          value = static_cast<SumCType>(values.GetValues<CType>(1)[i]);
+        }
+        this->sum += value * static_cast<SumCType>(it.run_length());
+      }
+    }
+  }
+
   Status MergeFrom(KernelContext*, KernelState&& src) override {
     const auto& other = checked_cast<const ThisType&>(src);
     this->count += other.count;
@@ -188,11 +254,16 @@ struct SumLikeInit {
   }
 
   template <typename Type>
-  enable_if_decimal<Type, Status> Visit(const Type&) {
-    state.reset(new KernelClass<Type>(type, options));
+  enable_if_decimal<Type, Status> Visit(const Type& value_type) {
+    state.reset(new KernelClass<Type>(value_type.GetSharedPtr(), options));
     return Status::OK();
   }
 
+  Status Visit(const RunEndEncodedType& ree_type) {
+    // Run-end encoded arrays are handled by the implementation for their values
+    return VisitTypeInline(*ree_type.value_type(), this);
+  }
+
   virtual Status Visit(const NullType&) {
     state.reset(new NullSumImpl<Int64Type>(options));
     return Status::OK();
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <initializer_list>
 
@@ -255,4 +256,45 @@ SumType SumArray(const ArraySpan& data) {
       data, [](ValueType v) { return static_cast<SumType>(v); });
 }
 
+// Summation for Decimal128 and Decimal256 arrays whose precision fits in an int64
+// (i.e. up to 18 digits).  Only the low words of the values are significant: they are
+// summed in two int64 lanes holding their signed upper and unsigned lower 32-bit
+// halves, which can't overflow over a block and which the compiler can vectorize,
+// instead of the multiword additions with carries.
+template <typename DecimalCType, SimdLevel::type SimdLevel>
+DecimalCType SumSmallDecimalArray(const ArraySpan& data) {
+  using arrow::internal::VisitSetBitRunsVoid;
+
+  constexpr int kNumWords = DecimalCType::kNumWords;
+#if ARROW_LITTLE_ENDIAN
+  constexpr int kLowWordIndex = 0;
+#else
+  constexpr int kLowWordIndex = kNumWords - 1;
+#endif
+  // Each lower half is below 2^32, so 2^30 of them sum up to less than 2^62
+  constexpr int64_t kBlockSize = int64_t{1} << 30;
+
+  const auto* words = reinterpret_cast<const uint64_t*>(data.buffers[1].data) +
+                      data.offset * kNumWords + kLowWordIndex;
+  DecimalCType sum = 0;
+  VisitSetBitRunsVoid(
+      data.buffers[0].data, data.offset, data.length, [&](int64_t pos, int64_t len) {
+        while (len > 0) {
+          const int64_t block_length = std::min(len, kBlockSize);
+          int64_t sum_upper = 0;
+          int64_t sum_lower = 0;
+          for (int64_t i = 0; i < block_length; ++i) {
+            const auto value = static_cast<int64_t>(words[(pos + i) * kNumWords]);
+            sum_upper += value >> 32;
+            sum_lower += value & 0xFFFFFFFF;
+          }
+          sum += DecimalCType(sum_upper) * DecimalCType(int64_t{1} << 32) +
+                 DecimalCType(sum_lower);
+          pos += block_length;
+          len -= block_length;
+        }
+      });
+  return sum;
+}
+
 }  // namespace arrow::compute::internal
@@ -52,18 +52,20 @@ struct PivotImpl : public ScalarAggregator {
       ARROW_ASSIGN_OR_RAISE(span<const PivotWiderKeyIndex> keys,
                             key_mapper_->MapKeys(batch[0].array));
       if (batch[1].is_array()) {
-        // Array keys, array values
-        auto values = batch[1].array.ToArray();
+        // Array keys, array values: find the row of each key's value first, then
+        // extract one scalar per output field
+        const ArraySpan& values = batch[1].array;
+        value_rows_.assign(values_.size(), -1);
         for (int64_t i = 0; i < batch.length; ++i) {
           PivotWiderKeyIndex key = keys[i];
-          if (key != kNullPivotKey && !values->IsNull(i)) {
-            if (ARROW_PREDICT_FALSE(values_[key]->is_valid)) {
+          if (key != kNullPivotKey && values.IsValid(i)) {
+            if (ARROW_PREDICT_FALSE(value_rows_[key] >= 0 || values_[key]->is_valid)) {
               return DuplicateValue();
             }
-            ARROW_ASSIGN_OR_RAISE(values_[key], values->GetScalar(i));
-            DCHECK(values_[key]->is_valid);
+            value_rows_[key] = i;
           }
         }
+        RETURN_NOT_OK(ExtractValues(values));
       } else {
         // Array keys, scalar value
         const Scalar* value = batch[1].scalar;
@@ -85,16 +87,17 @@ struct PivotImpl : public ScalarAggregator {
       if (key != kNullPivotKey) {
         if (batch[1].is_array()) {
           // Scalar key, array values
-          auto values = batch[1].array.ToArray();
+          const ArraySpan& values = batch[1].array;
+          value_rows_.assign(values_.size(), -1);
           for (int64_t i = 0; i < batch.length; ++i) {
-            if (!values->IsNull(i)) {
-              if (ARROW_PREDICT_FALSE(values_[key]->is_valid)) {
+            if (values.IsValid(i)) {
+              if (ARROW_PREDICT_FALSE(value_rows_[key] >= 0 || values_[key]->is_valid)) {
                 return DuplicateValue();
               }
-              ARROW_ASSIGN_OR_RAISE(values_[key], values->GetScalar(i));
-              DCHECK(values_[key]->is_valid);
+              value_rows_[key] = i;
             }
           }
+          RETURN_NOT_OK(ExtractValues(values));
         } else {
           // Scalar key, scalar value
           const Scalar* value = batch[1].scalar;
@@ -110,6 +113,22 @@ struct PivotImpl : public ScalarAggregator {
     return Status::OK();
   }
 
+  // Set the value of each output field which has a row in value_rows_
+  Status ExtractValues(const ArraySpan& values) {
+    std::shared_ptr<Array> values_array;
+    for (size_t key = 0; key < values_.size(); ++key) {
+      if (value_rows_[key] < 0) {
+        continue;
+      }
+      if (values_array == nullptr) {
+        values_array = values.ToArray();
+      }
+      ARROW_ASSIGN_OR_RAISE(values_[key], values_array->GetScalar(value_rows_[key]));
+      DCHECK(values_[key]->is_valid);
+    }
+    return Status::OK();
+  }
+
   Status MergeFrom(KernelContext*, KernelState&& src) override {
     const auto& other_state = checked_cast<const PivotImpl&>(src);
     for (int64_t key = 0; key < static_cast<int64_t>(values_.size()); ++key) {
@@ -140,13 +159,16 @@ struct PivotImpl : public ScalarAggregator {
   const PivotWiderOptions* options_;
   std::unique_ptr<PivotWiderKeyMapper> key_mapper_;
   ScalarVector values_;
+  // The row of the value of each output field in the consumed batch, or -1
+  std::vector<int64_t> value_rows_;
 };
 
 Result<std::unique_ptr<KernelState>> PivotInit(KernelContext* ctx,
                                                const KernelInitArgs& args) {
   const auto& options = checked_cast<const PivotWiderOptions&>(*args.options);
   DCHECK_EQ(args.inputs.size(), 2);
-  DCHECK(is_base_binary_like(args.inputs[0].id()));
+  DCHECK(is_base_binary_like(args.inputs[0].id()) ||
+         args.inputs[0].id() == Type::DICTIONARY);
   auto state = std::make_unique<PivotImpl>();
   RETURN_NOT_OK(state->Init(options, args.inputs));
   return state;
@@ -165,7 +187,8 @@ const FunctionDoc pivot_doc{
      "If more than one non-null value is encountered for a given pivot key,\n"
      "Invalid is raised.\n"
      "Behavior of unexpected pivot keys is controlled by `unexpected_key_behavior`\n"
-     "in PivotWiderOptions."),
+     "in PivotWiderOptions.\n"
+     "Pivot keys can be dictionary-encoded."),
     {"pivot_keys", "pivot_values"},
     "PivotWiderOptions"};
 
@@ -182,6 +205,10 @@ void RegisterScalarAggregatePivot(FunctionRegistry* registry) {
                                      OutputType(ResolveOutputType));
     AddAggKernel(std::move(sig), PivotInit, func.get());
   }
+  // Dictionary-encoded keys, with a binary-like value type
+  auto sig = KernelSignature::Make({InputType(Type::DICTIONARY), InputType::Any()},
+                                   OutputType(ResolveOutputType));
+  AddAggKernel(std::move(sig), PivotInit, func.get());
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
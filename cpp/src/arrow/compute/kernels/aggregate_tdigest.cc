@@ -15,11 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <string_view>
+
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/common_internal.h"
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/tdigest.h"
+#include "arrow/visit_data_inline.h"
 
 namespace arrow {
 namespace compute {
@@ -30,14 +33,50 @@ namespace {
 using arrow::internal::TDigest;
 using arrow::internal::VisitSetBitRunsVoid;
 
+// Whether a tdigest aggregate yields quantiles or the serialized tdigest
+enum class TDigestOutput { kQuantiles, kSketch };
+
+Status FinalizeQuantiles(KernelContext* ctx, const TDigestOptions& options,
+                         const TDigest& tdigest, bool valid, Datum* out) {
+  const int64_t out_length = options.q.size();
+  auto out_data = ArrayData::Make(float64(), out_length, 0);
+  out_data->buffers.resize(2, nullptr);
+  ARROW_ASSIGN_OR_RAISE(out_data->buffers[1], ctx->Allocate(out_length * sizeof(double)));
+  double* out_buffer = out_data->template GetMutableValues<double>(1);
+
+  if (tdigest.is_empty() || !valid) {
+    ARROW_ASSIGN_OR_RAISE(out_data->buffers[0], ctx->AllocateBitmap(out_length));
+    std::memset(out_data->buffers[0]->mutable_data(), 0x00, out_data->buffers[0]->size());
+    std::fill(out_buffer, out_buffer + out_length, 0.0);
+    out_data->null_count = out_length;
+  } else {
+    for (int64_t i = 0; i < out_length; ++i) {
+      out_buffer[i] = tdigest.Quantile(options.q[i]);
+    }
+  }
+  *out = Datum(std::move(out_data));
+  return Status::OK();
+}
+
+Status FinalizeSketch(const TDigest& tdigest, bool valid, Datum* out) {
+  if (!valid) {
+    *out = MakeNullScalar(binary());
+  } else {
+    *out = std::make_shared<BinaryScalar>(Buffer::FromString(tdigest.Serialize()));
+  }
+  return Status::OK();
+}
+
 template <typename ArrowType>
 struct TDigestImpl : public ScalarAggregator {
   using ThisType = TDigestImpl<ArrowType>;
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
   using CType = typename TypeTraits<ArrowType>::CType;
 
-  TDigestImpl(const TDigestOptions& options, const DataType& in_type)
+  TDigestImpl(const TDigestOptions& options, const DataType& in_type,
+              TDigestOutput output)
       : options{options},
+        output{output},
         tdigest{options.delta, options.buffer_size},
         count{0},
         decimal_scale{0},
@@ -99,44 +138,96 @@ struct TDigestImpl : public ScalarAggregator {
   }
 
   Status Finalize(KernelContext* ctx, Datum* out) override {
-    const int64_t out_length = options.q.size();
-    auto out_data = ArrayData::Make(float64(), out_length, 0);
-    out_data->buffers.resize(2, nullptr);
-    ARROW_ASSIGN_OR_RAISE(out_data->buffers[1],
-                          ctx->Allocate(out_length * sizeof(double)));
-    double* out_buffer = out_data->template GetMutableValues<double>(1);
-
-    if (this->tdigest.is_empty() || !this->all_valid || this->count < options.min_count) {
-      ARROW_ASSIGN_OR_RAISE(out_data->buffers[0], ctx->AllocateBitmap(out_length));
-      std::memset(out_data->buffers[0]->mutable_data(), 0x00,
-                  out_data->buffers[0]->size());
-      std::fill(out_buffer, out_buffer + out_length, 0.0);
-      out_data->null_count = out_length;
-    } else {
-      for (int64_t i = 0; i < out_length; ++i) {
-        out_buffer[i] = this->tdigest.Quantile(this->options.q[i]);
-      }
+    if (output == TDigestOutput::kSketch) {
+      // min_count is left to the consumer of the sketch
+      return FinalizeSketch(this->tdigest, this->all_valid, out);
     }
-    *out = Datum(std::move(out_data));
-    return Status::OK();
+    return FinalizeQuantiles(ctx, this->options, this->tdigest,
+                             this->all_valid && this->count >= options.min_count, out);
   }
 
   const TDigestOptions options;
+  const TDigestOutput output;
   TDigest tdigest;
   int64_t count;
   int32_t decimal_scale;
   bool all_valid;
 };
 
+// Merges the serialized tdigests of a binary array
+template <typename ArrowType>
+struct TDigestMergeImpl : public ScalarAggregator {
+  using ThisType = TDigestMergeImpl<ArrowType>;
+
+  TDigestMergeImpl(const TDigestOptions& options, TDigestOutput output)
+      : options{options},
+        output{output},
+        tdigest{options.delta, options.buffer_size},
+        all_valid{true} {}
+
+  Status MergeSketch(std::string_view sketch) {
+    ARROW_ASSIGN_OR_RAISE(auto other, TDigest::Deserialize(sketch, options.buffer_size));
+    this->tdigest.Merge(other);
+    return Status::OK();
+  }
+
+  Status Consume(KernelContext*, const ExecSpan& batch) override {
+    if (!this->all_valid) return Status::OK();
+    if (!options.skip_nulls && batch[0].null_count() > 0) {
+      this->all_valid = false;
+      return Status::OK();
+    }
+    if (batch[0].is_array()) {
+      return VisitArraySpanInline<ArrowType>(
+          batch[0].array, [&](std::string_view sketch) { return MergeSketch(sketch); },
+          [] { return Status::OK(); });
+    }
+    const auto& scalar = checked_cast<const BaseBinaryScalar&>(*batch[0].scalar);
+    if (scalar.is_valid) {
+      ARROW_ASSIGN_OR_RAISE(auto other,
+                            TDigest::Deserialize(scalar.view(), options.buffer_size));
+      for (int64_t i = 0; i < batch.length; i++) {
+        this->tdigest.Merge(other);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other = checked_cast<const ThisType&>(src);
+    if (!this->all_valid || !other.all_valid) {
+      this->all_valid = false;
+      return Status::OK();
+    }
+    this->tdigest.Merge(other.tdigest);
+    return Status::OK();
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    if (output == TDigestOutput::kSketch) {
+      return FinalizeSketch(this->tdigest, this->all_valid, out);
+    }
+    return FinalizeQuantiles(
+        ctx, this->options, this->tdigest,
+        this->all_valid && this->tdigest.total_weight() >= options.min_count, out);
+  }
+
+  const TDigestOptions options;
+  const TDigestOutput output;
+  TDigest tdigest;
+  bool all_valid;
+};
+
 struct TDigestInitState {
   std::unique_ptr<KernelState> state;
   KernelContext* ctx;
   const DataType& in_type;
   const TDigestOptions& options;
+  TDigestOutput output;
 
   TDigestInitState(KernelContext* ctx, const DataType& in_type,
-                   const TDigestOptions& options)
-      : ctx(ctx), in_type(in_type), options(options) {}
+                   const TDigestOptions& options, TDigestOutput output)
+      : ctx(ctx), in_type(in_type), options(options), output(output) {}
 
   Status Visit(const DataType&) {
     return Status::NotImplemented("No tdigest implemented");
@@ -148,13 +239,13 @@ struct TDigestInitState {
 
   template <typename Type>
   enable_if_number<Type, Status> Visit(const Type&) {
-    state.reset(new TDigestImpl<Type>(options, in_type));
+    state.reset(new TDigestImpl<Type>(options, in_type, output));
     return Status::OK();
   }
 
   template <typename Type>
   enable_if_decimal<Type, Status> Visit(const Type&) {
-    state.reset(new TDigestImpl<Type>(options, in_type));
+    state.reset(new TDigestImpl<Type>(options, in_type, output));
     return Status::OK();
   }
 
@@ -164,18 +255,30 @@ struct TDigestInitState {
   }
 };
 
+template <TDigestOutput Output>
 Result<std::unique_ptr<KernelState>> TDigestInit(KernelContext* ctx,
                                                  const KernelInitArgs& args) {
   TDigestInitState visitor(ctx, *args.inputs[0].type,
-                           static_cast<const TDigestOptions&>(*args.options));
+                           static_cast<const TDigestOptions&>(*args.options), Output);
   return visitor.Create();
 }
 
+template <TDigestOutput Output>
+Result<std::unique_ptr<KernelState>> TDigestMergeInit(KernelContext* ctx,
+                                                      const KernelInitArgs& args) {
+  const auto& options = static_cast<const TDigestOptions&>(*args.options);
+  if (args.inputs[0].id() == Type::LARGE_BINARY) {
+    return std::make_unique<TDigestMergeImpl<LargeBinaryType>>(options, Output);
+  }
+  return std::make_unique<TDigestMergeImpl<BinaryType>>(options, Output);
+}
+
 void AddTDigestKernels(KernelInit init,
                        const std::vector<std::shared_ptr<DataType>>& types,
+                       const std::shared_ptr<DataType>& out_type,
                        ScalarAggregateFunction* func) {
   for (const auto& ty : types) {
-    auto sig = KernelSignature::Make({InputType(ty->id())}, float64());
+    auto sig = KernelSignature::Make({InputType(ty->id())}, out_type);
     AddAggKernel(std::move(sig), init, func);
   }
 }
@@ -188,6 +291,32 @@ const FunctionDoc tdigest_doc{
     {"array"},
     "TDigestOptions"};
 
+const FunctionDoc tdigest_sketch_doc{
+    "Serialized T-Digest of a numeric array",
+    ("The sketch is returned as a binary scalar, which can be stored and merged\n"
+     "with other sketches by \"merge_tdigest\" or \"merge_tdigest_sketch\".\n"
+     "Nulls and NaNs are ignored.  A null scalar is returned if nulls are not\n"
+     "skipped and the array has some."),
+    {"array"},
+    "TDigestOptions"};
+
+const FunctionDoc merge_tdigest_doc{
+    "Approximate quantiles of the data summarized by T-Digest sketches",
+    ("The sketches are binary values produced by \"tdigest_sketch\".\n"
+     "By default, 0.5 quantile (median) is returned.\n"
+     "Null sketches are ignored.\n"
+     "An array of nulls is returned if there is no valid data point."),
+    {"sketches"},
+    "TDigestOptions"};
+
+const FunctionDoc merge_tdigest_sketch_doc{
+    "Merge T-Digest sketches into a single sketch",
+    ("The sketches are binary values produced by \"tdigest_sketch\".\n"
+     "Null sketches are ignored.  A null scalar is returned if nulls are not\n"
+     "skipped and the array has some."),
+    {"sketches"},
+    "TDigestOptions"};
+
 const FunctionDoc approximate_median_doc{
     "Approximate median of a numeric array with T-Digest algorithm",
     ("Nulls and NaNs are ignored.\n"
@@ -199,8 +328,32 @@ std::shared_ptr<ScalarAggregateFunction> AddTDigestAggKernels() {
   static auto default_tdigest_options = TDigestOptions::Defaults();
   auto func = std::make_shared<ScalarAggregateFunction>(
       "tdigest", Arity::Unary(), tdigest_doc, &default_tdigest_options);
-  AddTDigestKernels(TDigestInit, NumericTypes(), func.get());
-  AddTDigestKernels(TDigestInit, {decimal128(1, 1), decimal256(1, 1)}, func.get());
+  AddTDigestKernels(TDigestInit<TDigestOutput::kQuantiles>, NumericTypes(), float64(),
+                    func.get());
+  AddTDigestKernels(TDigestInit<TDigestOutput::kQuantiles>,
+                    {decimal128(1, 1), decimal256(1, 1)}, float64(), func.get());
+  return func;
+}
+
+std::shared_ptr<ScalarAggregateFunction> AddTDigestSketchAggKernels() {
+  static auto default_tdigest_options = TDigestOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "tdigest_sketch", Arity::Unary(), tdigest_sketch_doc, &default_tdigest_options);
+  AddTDigestKernels(TDigestInit<TDigestOutput::kSketch>, NumericTypes(), binary(),
+                    func.get());
+  AddTDigestKernels(TDigestInit<TDigestOutput::kSketch>,
+                    {decimal128(1, 1), decimal256(1, 1)}, binary(), func.get());
+  return func;
+}
+
+template <TDigestOutput Output>
+std::shared_ptr<ScalarAggregateFunction> AddTDigestMergeAggKernels(
+    std::string name, const FunctionDoc& doc, const std::shared_ptr<DataType>& out_type) {
+  static auto default_tdigest_options = TDigestOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      std::move(name), Arity::Unary(), doc, &default_tdigest_options);
+  AddTDigestKernels(TDigestMergeInit<Output>, {binary(), large_binary()}, out_type,
+                    func.get());
   return func;
 }
 
@@ -249,6 +402,12 @@ void RegisterScalarAggregateTDigest(FunctionRegistry* registry) {
 
   auto approx_median = AddApproximateMedianAggKernels(tdigest.get());
   DCHECK_OK(registry->AddFunction(approx_median));
+
+  DCHECK_OK(registry->AddFunction(AddTDigestSketchAggKernels()));
+  DCHECK_OK(registry->AddFunction(AddTDigestMergeAggKernels<TDigestOutput::kQuantiles>(
+      "merge_tdigest", merge_tdigest_doc, float64())));
+  DCHECK_OK(registry->AddFunction(AddTDigestMergeAggKernels<TDigestOutput::kSketch>(
+      "merge_tdigest_sketch", merge_tdigest_sketch_doc, binary())));
 }
 
 }  // namespace internal
@@ -26,6 +26,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/api_scalar.h"
@@ -535,6 +536,24 @@ TEST(TestDecimalSumKernel, SimpleSum) {
   }
 }
 
+TEST(TestDecimalSumKernel, SmallPrecision) {
+  // Values of precision <= 18 are summed on int64 lanes
+  for (const auto& ty : {decimal128(18, 4), decimal256(18, 4)}) {
+    auto arr = ArrayFromJSON(ty, R"(["49999999999999.9999", "49999999999999.9999",
+                                    "-0.0001", null, "-12345678901234.5678"])");
+    EXPECT_THAT(Sum(arr), ResultWith(ScalarFromJSON(ty, R"("87654321098765.4319")")));
+    EXPECT_THAT(Sum(arr->Slice(2)),
+                ResultWith(ScalarFromJSON(ty, R"("-12345678901234.5679")")));
+  }
+
+  // The sum itself may need more than 64 bits
+  auto value = ScalarFromJSON(decimal128(18, 4), R"("-1234567890123.4567")");
+  ASSERT_OK_AND_ASSIGN(auto arr, MakeArrayFromScalar(*value, 1000));
+  ASSERT_OK_AND_ASSIGN(Datum result, Sum(arr));
+  ASSERT_EQ(checked_cast<const Decimal128Scalar&>(*result.scalar()).value,
+            Decimal128(-12345678901234567) * Decimal128(1000));
+}
+
 TEST(TestDecimalSumKernel, ScalarAggregateOptions) {
   for (const auto& ty : {decimal128(3, 2), decimal256(3, 2)}) {
     Datum null = ScalarFromJSON(ty, R"(null)");
@@ -1141,6 +1160,49 @@ TEST_F(TestCountDistinctKernel, Random) {
   Check(input, memo.size(), false);
 }
 
+TEST(TestApproximateCountDistinctKernel, Basics) {
+  CountOptions only_valid{CountOptions::ONLY_VALID};
+  CountOptions only_null{CountOptions::ONLY_NULL};
+  CountOptions all{CountOptions::ALL};
+  auto check = [&](const Datum& input, int64_t expected_valid, int64_t expected_null) {
+    CheckScalar("approximate_count_distinct", {input}, Datum(expected_valid),
+                &only_valid);
+    CheckScalar("approximate_count_distinct", {input}, Datum(expected_null), &only_null);
+    CheckScalar("approximate_count_distinct", {input},
+                Datum(expected_valid + expected_null), &all);
+  };
+  // Small counts are exact
+  check(ArrayFromJSON(int32(), "[]"), 0, 0);
+  check(ArrayFromJSON(int32(), "[1, 2, null, 2, 3, 1]"), 3, 1);
+  check(ArrayFromJSON(boolean(), "[true, false, true]"), 2, 0);
+  check(ArrayFromJSON(float64(), "[1.5, null, 1.5, -2.5]"), 2, 1);
+  check(ArrayFromJSON(utf8(), R"(["a", "bc", null, "a", "", "bc"])"), 3, 1);
+  check(ArrayFromJSON(fixed_size_binary(2), R"(["ab", "cd", "ab"])"), 2, 0);
+  check(ArrayFromJSON(decimal128(5, 2), R"(["1.23", "4.56", null])"), 2, 1);
+  check(ChunkedArrayFromJSON(int64(), {"[1, 2, null]", "[2, 3]", "[]", "[4, 1]"}), 4, 1);
+  check(ScalarFromJSON(int64(), "5"), 1, 0);
+  check(ScalarFromJSON(int64(), "null"), 0, 1);
+}
+
+TEST(TestApproximateCountDistinctKernel, Random) {
+  // The estimate is within a few standard errors (~0.8%) of the exact count
+  auto rand = random::RandomArrayGenerator(0x1205643);
+  ArrayVector arrays = {
+      rand.Int64(300000, 0, 100000, /*null_probability=*/0.01),
+      rand.StringWithRepeats(300000, /*unique=*/100000, /*min_length=*/0,
+                             /*max_length=*/16, /*null_probability=*/0.01)};
+  for (const auto& array : arrays) {
+    ARROW_SCOPED_TRACE("type = ", array->type()->ToString());
+    ASSERT_OK_AND_ASSIGN(Datum exact, CallFunction("count_distinct", {array}));
+    ASSERT_OK_AND_ASSIGN(Datum approximate,
+                         CallFunction("approximate_count_distinct", {array}));
+    const auto expected = exact.scalar_as<Int64Scalar>().value;
+    const auto actual = approximate.scalar_as<Int64Scalar>().value;
+    ASSERT_NEAR(static_cast<double>(actual), static_cast<double>(expected),
+                0.03 * static_cast<double>(expected));
+  }
+}
+
 //
 // Mean
 //
@@ -4469,6 +4531,58 @@ TEST(TestTDigestKernel, ApproximateMedian) {
   }
 }
 
+TEST(TestTDigestKernel, Sketches) {
+  TDigestOptions options(std::vector<double>{0.0, 0.5, 1.0});
+  auto ty = float64();
+
+  // Sketches of partitions are merged into the quantiles of the whole data
+  std::vector<std::string> sketches;
+  for (const auto& json : {"[1, 2, null]", "[4, 5]", "[NaN, 3]", "[]"}) {
+    ASSERT_OK_AND_ASSIGN(Datum sketch,
+                         CallFunction("tdigest_sketch", {ArrayFromJSON(ty, json)},
+                                      &options));
+    ASSERT_TRUE(sketch.scalar()->is_valid);
+    sketches.push_back(
+        checked_cast<const BinaryScalar&>(*sketch.scalar()).value->ToString());
+  }
+  BinaryBuilder builder;
+  ASSERT_OK(builder.Append(sketches[0]));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.AppendValues({sketches[1], sketches[2], sketches[3]}));
+  ASSERT_OK_AND_ASSIGN(auto sketch_array, builder.Finish());
+
+  EXPECT_THAT(CallFunction("merge_tdigest", {sketch_array}, &options),
+              ResultWith(ArrayFromJSON(ty, "[1, 3, 5]")));
+  ASSERT_OK_AND_ASSIGN(auto large_sketch_array, Cast(*sketch_array, large_binary()));
+  EXPECT_THAT(CallFunction("merge_tdigest", {large_sketch_array}, &options),
+              ResultWith(ArrayFromJSON(ty, "[1, 3, 5]")));
+
+  // Merged sketches can themselves be merged
+  ASSERT_OK_AND_ASSIGN(Datum merged, CallFunction("merge_tdigest_sketch",
+                                                  {sketch_array->Slice(0, 3)}, &options));
+  ASSERT_OK_AND_ASSIGN(auto merged_array, MakeArrayFromScalar(*merged.scalar(), 1));
+  ASSERT_OK_AND_ASSIGN(auto all_sketches,
+                       Concatenate({merged_array, sketch_array->Slice(3)}));
+  EXPECT_THAT(CallFunction("merge_tdigest", {all_sketches}, &options),
+              ResultWith(ArrayFromJSON(ty, "[1, 3, 5]")));
+
+  // Nulls, if not skipped, give a null sketch
+  TDigestOptions keep_nulls(/*q=*/0.5, /*delta=*/100, /*buffer_size=*/500,
+                            /*skip_nulls=*/false, /*min_count=*/0);
+  EXPECT_THAT(CallFunction("tdigest_sketch", {ArrayFromJSON(ty, "[1, null]")},
+                           &keep_nulls),
+              ResultWith(MakeNullScalar(binary())));
+  EXPECT_THAT(CallFunction("merge_tdigest", {sketch_array}, &keep_nulls),
+              ResultWith(ArrayFromJSON(ty, "[null]")));
+
+  // No data
+  EXPECT_THAT(CallFunction("merge_tdigest", {ArrayFromJSON(binary(), "[]")}, &options),
+              ResultWith(ArrayFromJSON(ty, "[null, null, null]")));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Invalid tdigest sketch"),
+      CallFunction("merge_tdigest", {ArrayFromJSON(binary(), R"(["abc"])")}));
+}
+
 //
 // Pivot
 //
@@ -4694,6 +4808,52 @@ TEST_F(TestPivotKernel, UnexpectedKey) {
   }
 }
 
+TEST_F(TestPivotKernel, DictionaryKeys) {
+  auto value_type = float32();
+  auto expected_type = struct_({field("height", value_type), field("width", value_type)});
+  auto options = PivotWiderOptions(/*key_names=*/{"height", "width"});
+  auto options_raise =
+      PivotWiderOptions(/*key_names=*/{"height", "width"}, PivotWiderOptions::kRaise);
+
+  for (auto index_type : {int8(), uint16(), int32(), int64()}) {
+    ARROW_SCOPED_TRACE("index_type = ", index_type->ToString());
+    auto key_type = dictionary(index_type, utf8());
+    {
+      auto keys = DictArrayFromJSON(key_type, "[1, 0, 0, 1]",
+                                    R"(["width", "height", "depth"])");
+      auto values = ArrayFromJSON(value_type, "[null, 10.5, null, 11.5]");
+      auto expected = ScalarFromJSON(expected_type, "[11.5, 10.5]");
+      AssertPivot(keys, values, *expected, options);
+    }
+    {
+      // Chunks with different dictionaries
+      auto keys = std::make_shared<ChunkedArray>(ArrayVector{
+          DictArrayFromJSON(key_type, "[0]", R"(["width", "height"])"),
+          DictArrayFromJSON(key_type, "[0, 1]", R"(["height", "depth"])")});
+      auto values = ChunkedArrayFromJSON(value_type, {"[10.5]", "[11.5, 12.5]"});
+      auto expected = ScalarFromJSON(expected_type, "[11.5, 10.5]");
+      AssertPivot(keys, values, *expected, options);
+      EXPECT_RAISES_WITH_MESSAGE_THAT(
+          KeyError, ::testing::HasSubstr("Unexpected pivot key: depth"),
+          CallFunction("pivot_wider", {keys, values}, &options_raise));
+    }
+    {
+      // Unexpected dictionary values are only an error if they are referenced
+      auto keys = DictArrayFromJSON(key_type, "[1]", R"(["depth", "width"])");
+      auto values = ArrayFromJSON(value_type, "[10.5]");
+      auto expected = ScalarFromJSON(expected_type, "[null, 10.5]");
+      AssertPivot(keys, values, *expected, options_raise);
+    }
+    {
+      // Scalar key
+      auto keys = DictScalarFromJSON(key_type, "1", R"(["width", "height"])");
+      auto values = ArrayFromJSON(value_type, "[null, 10.5]");
+      auto expected = ScalarFromJSON(expected_type, "[10.5, null]");
+      AssertPivot(keys, values, *expected, options);
+    }
+  }
+}
+
 TEST_F(TestPivotKernel, NullKey) {
   auto key_type = utf8();
   auto value_type = float32();
@@ -4758,5 +4918,49 @@ TEST_F(TestPivotKernel, DuplicateValues) {
   }
 }
 
+TEST(TestRunEndEncodedAggregates, Basics) {
+  // Aggregating a run-end encoded array gives the same results as aggregating
+  // its decoded values
+  const std::vector<std::pair<std::shared_ptr<DataType>, std::string>> cases = {
+      {int32(), "[1, 1, 1, null, null, -4, 5, 5, 5, 5]"},
+      {uint8(), "[7, 7, null, 1, 1, 1, 0, 0, null, null]"},
+      {float64(), "[1.5, 1.5, 1.5, 2.5, null, null, null, -3.0, -3.0, 10.0]"},
+      {boolean(), "[true, true, false, false, null, true, true, true, false, false]"},
+      {decimal128(5, 2), R"(["1.25", "1.25", null, "-3.00", "-3.00", "-3.00", "2.50",
+                             "2.50", "2.50", null])"},
+  };
+  const ScalarAggregateOptions skip_nulls(/*skip_nulls=*/true, /*min_count=*/0);
+  const ScalarAggregateOptions keep_nulls(/*skip_nulls=*/false, /*min_count=*/0);
+  for (const auto& [type, json] : cases) {
+    ARROW_SCOPED_TRACE("type = ", type->ToString());
+    auto decoded = ArrayFromJSON(type, json);
+    ASSERT_OK_AND_ASSIGN(Datum encoded, RunEndEncode(decoded));
+    for (const auto& [offset, length] : {std::pair<int64_t, int64_t>{0, 10}, {1, 5},
+                                         {4, 6}, {3, 0}}) {
+      ARROW_SCOPED_TRACE("slice = ", offset, ", ", length);
+      auto values = decoded->Slice(offset, length);
+      auto runs = encoded.make_array()->Slice(offset, length);
+      for (const auto& func : {"count", "sum", "mean", "min_max", "first_last"}) {
+        if (is_decimal(type->id()) && std::string(func) == "first_last") {
+          continue;
+        }
+        for (const auto* options : {&skip_nulls, &keep_nulls}) {
+          ARROW_SCOPED_TRACE(func, " ", options->ToString());
+          const FunctionOptions* func_options = options;
+          CountOptions count_options(options->skip_nulls ? CountOptions::ONLY_VALID
+                                                         : CountOptions::ALL);
+          if (std::string(func) == "count") {
+            func_options = &count_options;
+          }
+          ASSERT_OK_AND_ASSIGN(Datum expected,
+                               CallFunction(func, {values}, func_options));
+          ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(func, {runs}, func_options));
+          AssertDatumsEqual(expected, actual, /*verbose=*/true);
+        }
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
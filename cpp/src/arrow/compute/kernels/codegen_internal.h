@@ -38,6 +38,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_block_counter.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_generate.h"
 #include "arrow/util/bitmap_reader.h"
@@ -322,6 +323,18 @@ struct ArrayIterator<Type, enable_if_base_binary<Type>> {
   }
 };
 
+template <typename Type>
+struct ArrayIterator<Type, enable_if_binary_view_like<Type>> {
+  const BinaryViewType::c_type* views;
+  const std::shared_ptr<Buffer>* data_buffers;
+
+  explicit ArrayIterator(const ArraySpan& arr)
+      : views(arr.GetValues<BinaryViewType::c_type>(1)),
+        data_buffers(arr.GetVariadicBuffers().data()) {}
+
+  std::string_view operator()() { return util::FromBinaryView(*views++, data_buffers); }
+};
+
 template <>
 struct ArrayIterator<FixedSizeBinaryType> {
   const ArraySpan& arr;
@@ -342,6 +355,84 @@ struct ArrayIterator<FixedSizeBinaryType> {
   }
 };
 
+// Iterator over the values of an array at the indices of a selection, in order
+
+template <typename Type, typename Enable = void>
+struct SelectedArrayIterator;
+
+template <typename Type>
+struct SelectedArrayIterator<Type, enable_if_c_number_or_decimal<Type>> {
+  using T = typename TypeTraits<Type>::ScalarType::ValueType;
+  const T* values;
+  const int32_t* indices;
+
+  SelectedArrayIterator(const ArraySpan& arr, const int32_t* indices)
+      : values(arr.GetValues<T>(1)), indices(indices) {}
+  T operator()() { return values[*indices++]; }
+};
+
+template <typename Type>
+struct SelectedArrayIterator<Type, enable_if_boolean<Type>> {
+  const uint8_t* bitmap;
+  const int64_t offset;
+  const int32_t* indices;
+
+  SelectedArrayIterator(const ArraySpan& arr, const int32_t* indices)
+      : bitmap(arr.buffers[1].data), offset(arr.offset), indices(indices) {}
+  bool operator()() { return bit_util::GetBit(bitmap, offset + *indices++); }
+};
+
+template <typename Type>
+struct SelectedArrayIterator<Type, enable_if_base_binary<Type>> {
+  using offset_type = typename Type::offset_type;
+  const offset_type* offsets;
+  const char* data;
+  const int32_t* indices;
+
+  SelectedArrayIterator(const ArraySpan& arr, const int32_t* indices)
+      : offsets(arr.GetValues<offset_type>(1)),
+        data(reinterpret_cast<const char*>(arr.buffers[2].data)),
+        indices(indices) {}
+
+  std::string_view operator()() {
+    const int32_t index = *indices++;
+    return std::string_view(data + offsets[index], offsets[index + 1] - offsets[index]);
+  }
+};
+
+template <typename Type>
+struct SelectedArrayIterator<Type, enable_if_binary_view_like<Type>> {
+  const BinaryViewType::c_type* views;
+  const std::shared_ptr<Buffer>* data_buffers;
+  const int32_t* indices;
+
+  SelectedArrayIterator(const ArraySpan& arr, const int32_t* indices)
+      : views(arr.GetValues<BinaryViewType::c_type>(1)),
+        data_buffers(arr.GetVariadicBuffers().data()),
+        indices(indices) {}
+
+  std::string_view operator()() {
+    return util::FromBinaryView(views[*indices++], data_buffers);
+  }
+};
+
+template <>
+struct SelectedArrayIterator<FixedSizeBinaryType> {
+  const char* data;
+  const int32_t width;
+  const int32_t* indices;
+
+  SelectedArrayIterator(const ArraySpan& arr, const int32_t* indices)
+      : data(reinterpret_cast<const char*>(arr.buffers[1].data) +
+             arr.offset * arr.type->byte_width()),
+        width(arr.type->byte_width()),
+        indices(indices) {}
+
+  std::string_view operator()() {
+    return std::string_view(data + static_cast<int64_t>(*indices++) * width, width);
+  }
+};
+
 // Iterator over various output array types, taking a GetOutputType<Type>
 
 template <typename Type, typename Enable = void>
@@ -612,6 +703,19 @@ struct ScalarUnary {
         }));
     return st;
   }
+
+  // Compute the selected values only (see ScalarKernel::selective_exec)
+  static Status ExecSelected(KernelContext* ctx, const ExecSpan& batch,
+                             const SelectionVectorSpan& selection, ExecResult* out) {
+    DCHECK(batch[0].is_array());
+    Status st = Status::OK();
+    SelectedArrayIterator<Arg0Type> arg0_it(batch[0].array, selection.indices());
+    RETURN_NOT_OK(
+        OutputAdapter<OutType>::Write(ctx, out->array_span_mutable(), [&]() -> OutValue {
+          return Op::template Call<OutValue, Arg0Value>(ctx, arg0_it(), &st);
+        }));
+    return st;
+  }
 };
 
 // An alternative to ScalarUnary that Applies a scalar operation with state on
@@ -805,6 +909,38 @@ struct ScalarBinary {
       }
     }
   }
+
+  // Compute the selected values only (see ScalarKernel::selective_exec)
+  static Status ExecSelected(KernelContext* ctx, const ExecSpan& batch,
+                             const SelectionVectorSpan& selection, ExecResult* out) {
+    Status st = Status::OK();
+    ArraySpan* out_span = out->array_span_mutable();
+    const int32_t* indices = selection.indices();
+    if (batch[0].is_array() && batch[1].is_array()) {
+      SelectedArrayIterator<Arg0Type> arg0_it(batch[0].array, indices);
+      SelectedArrayIterator<Arg1Type> arg1_it(batch[1].array, indices);
+      RETURN_NOT_OK(OutputAdapter<OutType>::Write(ctx, out_span, [&]() -> OutValue {
+        return Op::template Call<OutValue, Arg0Value, Arg1Value>(ctx, arg0_it(),
+                                                                 arg1_it(), &st);
+      }));
+    } else if (batch[0].is_array()) {
+      SelectedArrayIterator<Arg0Type> arg0_it(batch[0].array, indices);
+      auto arg1_val = UnboxScalar<Arg1Type>::Unbox(*batch[1].scalar);
+      RETURN_NOT_OK(OutputAdapter<OutType>::Write(ctx, out_span, [&]() -> OutValue {
+        return Op::template Call<OutValue, Arg0Value, Arg1Value>(ctx, arg0_it(),
+                                                                 arg1_val, &st);
+      }));
+    } else {
+      DCHECK(batch[1].is_array());
+      auto arg0_val = UnboxScalar<Arg0Type>::Unbox(*batch[0].scalar);
+      SelectedArrayIterator<Arg1Type> arg1_it(batch[1].array, indices);
+      RETURN_NOT_OK(OutputAdapter<OutType>::Write(ctx, out_span, [&]() -> OutValue {
+        return Op::template Call<OutValue, Arg0Value, Arg1Value>(ctx, arg0_val,
+                                                                 arg1_it(), &st);
+      }));
+    }
+    return st;
+  }
 };
 
 // An alternative to ScalarBinary that Applies a scalar operation with state on
@@ -923,6 +1059,21 @@ template <typename OutType, typename ArgType, typename Op>
 using ScalarBinaryNotNullStatefulEqualTypes =
     ScalarBinaryNotNullStateful<OutType, ArgType, ArgType, Op>;
 
+// Adapts a ScalarUnary or ScalarBinary kernel functor so that kernel
+// generator-dispatchers return its ExecSelected function rather than its Exec one,
+// e.g. ArithmeticExecFromOp<SelectiveExecOf<ScalarBinaryEqualTypes>::Kernel, Op,
+// ArrayKernelSelectiveExec>(type)
+template <template <typename...> class KernelGenerator>
+struct SelectiveExecOf {
+  template <typename Type0, typename Type1, typename Op>
+  struct Kernel {
+    static Status Exec(KernelContext* ctx, const ExecSpan& batch,
+                       const SelectionVectorSpan& selection, ExecResult* out) {
+      return KernelGenerator<Type0, Type1, Op>::ExecSelected(ctx, batch, selection, out);
+    }
+  };
+};
+
 }  // namespace applicator
 
 // ----------------------------------------------------------------------
@@ -980,6 +1131,14 @@ struct FailFunctor<ArrayKernelExec> {
   }
 };
 
+template <>
+struct FailFunctor<ArrayKernelSelectiveExec> {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch,
+                     const SelectionVectorSpan& selection, ExecResult* out) {
+    return Status::NotImplemented("This kernel is malformed");
+  }
+};
+
 template <>
 struct FailFunctor<VectorKernel::ChunkedExec> {
   static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
@@ -17,6 +17,7 @@
 
 #include <cmath>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -481,6 +482,13 @@ struct GroupedReducingAggregator : public GroupedAggregator {
     int64_t* counts = counts_.mutable_data();
     uint8_t* no_nulls = no_nulls_.mutable_data();
 
+    if constexpr (!std::is_same_v<Type, BooleanType>) {
+      if (batch[0].is_array() && batch[0].array.GetNullCount() == 0) {
+        ConsumeNonNull(batch[0].array.GetValues<InputCType>(1),
+                       batch[1].array.GetValues<uint32_t>(1), batch.length);
+        return Status::OK();
+      }
+    }
     VisitGroupedValues<Type>(
         batch,
         [&](uint32_t g, InputCType value) {
@@ -491,6 +499,71 @@ struct GroupedReducingAggregator : public GroupedAggregator {
     return Status::OK();
   }
 
+  // Reduce values without nulls.  With few groups, consecutive rows are spread over
+  // several copies of the accumulators, so that rows of the same group don't wait on
+  // each other's update.  With many groups, rows are reduced in blocks of group ids
+  // (by a counting sort on their high bits) so that the accumulators being updated
+  // stay in cache.
+  void ConsumeNonNull(const InputCType* values, const uint32_t* g, int64_t length) {
+    constexpr int64_t kLanes = 4;
+    constexpr int64_t kMaxFewGroups = 256;
+    constexpr int kGroupBlockBits = 14;
+    constexpr int64_t kMinBlockedGroups = int64_t{1} << (kGroupBlockBits + 3);
+
+    CType* reduced = reduced_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    auto reduce_row = [&](int64_t i) {
+      reduced[g[i]] =
+          Impl::Reduce(*out_type_, reduced[g[i]], static_cast<CType>(values[i]));
+      counts[g[i]]++;
+    };
+
+    if (num_groups_ <= kMaxFewGroups && length >= kLanes * num_groups_) {
+      std::vector<CType> lane_reduced(kLanes * num_groups_, Impl::NullValue(*out_type_));
+      std::vector<int64_t> lane_counts(kLanes * num_groups_, 0);
+      int64_t i = 0;
+      for (; i + kLanes <= length; i += kLanes) {
+        for (int64_t lane = 0; lane < kLanes; ++lane) {
+          const int64_t slot = g[i + lane] * kLanes + lane;
+          lane_reduced[slot] = Impl::Reduce(*out_type_, lane_reduced[slot],
+                                            static_cast<CType>(values[i + lane]));
+          ++lane_counts[slot];
+        }
+      }
+      for (; i < length; ++i) {
+        reduce_row(i);
+      }
+      for (int64_t group = 0; group < num_groups_; ++group) {
+        for (int64_t lane = 0; lane < kLanes; ++lane) {
+          const int64_t slot = group * kLanes + lane;
+          reduced[group] = Impl::Reduce(*out_type_, reduced[group], lane_reduced[slot]);
+          counts[group] += lane_counts[slot];
+        }
+      }
+    } else if (num_groups_ >= kMinBlockedGroups &&
+               length <= std::numeric_limits<uint32_t>::max()) {
+      const int64_t num_blocks = (num_groups_ >> kGroupBlockBits) + 1;
+      std::vector<uint32_t> block_starts(num_blocks + 1, 0);
+      for (int64_t i = 0; i < length; ++i) {
+        ++block_starts[(g[i] >> kGroupBlockBits) + 1];
+      }
+      for (int64_t block = 0; block < num_blocks; ++block) {
+        block_starts[block + 1] += block_starts[block];
+      }
+      std::vector<uint32_t> rows(length);
+      for (int64_t i = 0; i < length; ++i) {
+        rows[block_starts[g[i] >> kGroupBlockBits]++] = static_cast<uint32_t>(i);
+      }
+      for (const uint32_t row : rows) {
+        reduce_row(row);
+      }
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        reduce_row(i);
+      }
+    }
+  }
+
   Status Merge(GroupedAggregator&& raw_other,
                const ArrayData& group_id_mapping) override {
     auto other =
@@ -4006,7 +4079,8 @@ const FunctionDoc hash_pivot_doc{
      "If more than one non-null value is encountered in the same group for a\n"
      "given pivot key, Invalid is raised.\n"
      "Behavior of unexpected pivot keys is controlled by `unexpected_key_behavior`\n"
-     "in PivotWiderOptions."),
+     "in PivotWiderOptions.\n"
+     "Pivot keys can be dictionary-encoded."),
     {"pivot_keys", "pivot_values", "group_id_array"},
     "PivotWiderOptions"};
 
@@ -4276,6 +4350,12 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
       DCHECK_OK(func->AddKernel(
           MakeKernel(std::move(sig), HashAggregateInit<GroupedPivotImpl>)));
     }
+    // Dictionary-encoded keys, with a binary-like value type
+    auto sig = KernelSignature::Make(
+        {InputType(Type::DICTIONARY), InputType::Any(), InputType(Type::UINT32)},
+        OutputType(ResolveGroupOutputType));
+    DCHECK_OK(func->AddKernel(
+        MakeKernel(std::move(sig), HashAggregateInit<GroupedPivotImpl>)));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 }
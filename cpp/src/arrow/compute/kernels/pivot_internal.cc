@@ -18,12 +18,15 @@
 #include "arrow/compute/kernels/pivot_internal.h"
 
 #include <cstdint>
+#include <string_view>
+#include <vector>
 
 #include "arrow/compute/exec.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/scalar.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow::compute::internal {
@@ -105,18 +108,154 @@ struct TypedPivotKeyMapper : public BasePivotKeyMapper {
   }
 };
 
-Result<std::unique_ptr<PivotWiderKeyMapper>> PivotWiderKeyMapper::Make(
-    const DataType& key_type, const PivotWiderOptions* options) {
-  std::unique_ptr<PivotWiderKeyMapper> instance;
+// Dictionary-encoded keys are mapped to column indices once per dictionary, and
+// each batch of keys is then mapped by gathering the dictionary's column indices.
+template <typename KeyType>
+struct DictionaryPivotKeyMapper : public BasePivotKeyMapper {
+  using offset_type = typename KeyType::offset_type;
+
+  Result<span<const PivotWiderKeyIndex>> MapKeys(const ArraySpan& array) override {
+    const ArraySpan& dictionary = array.dictionary();
+    RETURN_NOT_OK(MapDictionary(dictionary));
+    RETURN_NOT_OK(this->key_indices_buffer_.Reserve(array.length));
+    PivotWiderKeyIndex* key_indices = this->key_indices_buffer_.mutable_data();
+    const auto& dict_type = checked_cast<const DictionaryType&>(*array.type);
+    switch (dict_type.index_type()->id()) {
+      case Type::INT8:
+        RETURN_NOT_OK(GatherKeys<int8_t>(array, dictionary, key_indices));
+        break;
+      case Type::UINT8:
+        RETURN_NOT_OK(GatherKeys<uint8_t>(array, dictionary, key_indices));
+        break;
+      case Type::INT16:
+        RETURN_NOT_OK(GatherKeys<int16_t>(array, dictionary, key_indices));
+        break;
+      case Type::UINT16:
+        RETURN_NOT_OK(GatherKeys<uint16_t>(array, dictionary, key_indices));
+        break;
+      case Type::INT32:
+        RETURN_NOT_OK(GatherKeys<int32_t>(array, dictionary, key_indices));
+        break;
+      case Type::UINT32:
+        RETURN_NOT_OK(GatherKeys<uint32_t>(array, dictionary, key_indices));
+        break;
+      case Type::INT64:
+        RETURN_NOT_OK(GatherKeys<int64_t>(array, dictionary, key_indices));
+        break;
+      case Type::UINT64:
+        RETURN_NOT_OK(GatherKeys<uint64_t>(array, dictionary, key_indices));
+        break;
+      default:
+        return Status::TypeError("Invalid dictionary index type: ",
+                                 *dict_type.index_type());
+    }
+    return span(key_indices, array.length);
+  }
 
+  Result<PivotWiderKeyIndex> MapKey(const Scalar& scalar) override {
+    if (!scalar.is_valid) {
+      return NullKeyName();
+    }
+    const auto& dict_scalar = checked_cast<const DictionaryScalar&>(scalar);
+    ARROW_ASSIGN_OR_RAISE(auto value, dict_scalar.GetEncodedValue());
+    if (!value->is_valid) {
+      return NullKeyName();
+    }
+    return LookupKey(checked_cast<const BaseBinaryScalar&>(*value).view());
+  }
+
+ private:
+  // Entries of dictionary_keys_ for dictionary values which aren't column indices
+  static constexpr int16_t kNullEntry = -1;
+  static constexpr int16_t kUnexpectedEntry = -2;
+
+  std::string_view GetDictionaryValue(const ArraySpan& dictionary, int64_t index) {
+    const offset_type* offsets = dictionary.GetValues<offset_type>(1);
+    const char* data = dictionary.buffers[2].data_as<char>();
+    return std::string_view(data + offsets[index], offsets[index + 1] - offsets[index]);
+  }
+
+  Status MapDictionary(const ArraySpan& dictionary) {
+    // The batches of a stream usually share their dictionary. The buffers of the
+    // last mapped dictionary are kept alive so that their addresses identify it.
+    if (last_offsets_ != NULLPTR && last_data_ != NULLPTR &&
+        dictionary.buffers[1].data == last_offsets_->data() &&
+        dictionary.buffers[2].data == last_data_->data() &&
+        dictionary.offset == last_offset_ && dictionary.length == last_length_) {
+      return Status::OK();
+    }
+    last_offsets_.reset();
+    last_data_.reset();
+    dictionary_keys_.resize(dictionary.length);
+    int64_t i = 0;
+    VisitArraySpanInline<KeyType>(
+        dictionary,
+        [&](std::string_view key_name) {
+          const auto it = this->key_name_map_.find(key_name);
+          if (it != this->key_name_map_.end()) {
+            dictionary_keys_[i] = it->second;
+          } else if (unexpected_key_behavior_ == PivotWiderOptions::kIgnore) {
+            dictionary_keys_[i] = kNullPivotKey;
+          } else {
+            dictionary_keys_[i] = kUnexpectedEntry;
+          }
+          ++i;
+        },
+        [&]() { dictionary_keys_[i++] = kNullEntry; });
+    if (dictionary.buffers[1].owner != NULLPTR &&
+        dictionary.buffers[2].owner != NULLPTR) {
+      last_offsets_ = *dictionary.buffers[1].owner;
+      last_data_ = *dictionary.buffers[2].owner;
+    }
+    last_offset_ = dictionary.offset;
+    last_length_ = dictionary.length;
+    return Status::OK();
+  }
+
+  template <typename IndexCType>
+  Status GatherKeys(const ArraySpan& indices, const ArraySpan& dictionary,
+                    PivotWiderKeyIndex* key_indices) {
+    const IndexCType* raw_indices = indices.GetValues<IndexCType>(1);
+    const int16_t* dictionary_keys = dictionary_keys_.data();
+    const bool may_have_nulls = indices.MayHaveNulls();
+    for (int64_t i = 0; i < indices.length; ++i) {
+      if (may_have_nulls && !indices.IsValid(i)) {
+        return NullKeyName();
+      }
+      const int64_t index = static_cast<int64_t>(raw_indices[i]);
+      if (ARROW_PREDICT_FALSE(index < 0 || index >= dictionary.length)) {
+        return Status::IndexError("Dictionary index out of bounds: ", index);
+      }
+      const int16_t key = dictionary_keys[index];
+      if (ARROW_PREDICT_FALSE(key < 0)) {
+        if (key == kNullEntry) {
+          return NullKeyName();
+        }
+        return KeyNotFound(GetDictionaryValue(dictionary, index)).status();
+      }
+      key_indices[i] = static_cast<PivotWiderKeyIndex>(key);
+    }
+    return Status::OK();
+  }
+
+  std::vector<int16_t> dictionary_keys_;
+  std::shared_ptr<Buffer> last_offsets_;
+  std::shared_ptr<Buffer> last_data_;
+  int64_t last_offset_ = -1;
+  int64_t last_length_ = -1;
+};
+
+template <template <typename> class MapperType>
+Result<std::unique_ptr<PivotWiderKeyMapper>> MakeKeyMapper(
+    const DataType& key_type, const PivotWiderOptions* options) {
   auto visit_key_type =
       [&](auto&& key_type) -> Result<std::unique_ptr<PivotWiderKeyMapper>> {
     using T = std::decay_t<decltype(key_type)>;
     // Only binary-like keys are supported for now
     if constexpr (is_base_binary_type<T>::value) {
-      instance = std::make_unique<TypedPivotKeyMapper<T>>();
+      std::unique_ptr<PivotWiderKeyMapper> instance = std::make_unique<MapperType<T>>();
       RETURN_NOT_OK(instance->Init(options));
-      return std::move(instance);
+      return instance;
     }
     return Status::NotImplemented("Pivot key type: ", key_type);
   };
@@ -124,4 +263,13 @@ Result<std::unique_ptr<PivotWiderKeyMapper>> PivotWiderKeyMapper::Make(
   return VisitType(key_type, visit_key_type);
 }
 
+Result<std::unique_ptr<PivotWiderKeyMapper>> PivotWiderKeyMapper::Make(
+    const DataType& key_type, const PivotWiderOptions* options) {
+  if (key_type.id() == Type::DICTIONARY) {
+    const auto& value_type = *checked_cast<const DictionaryType&>(key_type).value_type();
+    return MakeKeyMapper<DictionaryPivotKeyMapper>(value_type, options);
+  }
+  return MakeKeyMapper<TypedPivotKeyMapper>(key_type, options);
+}
+
 }  // namespace arrow::compute::internal
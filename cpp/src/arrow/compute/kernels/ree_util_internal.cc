@@ -15,8 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/kernels/ree_util_internal.h"
 
@@ -25,7 +28,9 @@
 #include "arrow/result.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 namespace compute {
@@ -136,6 +141,89 @@ Result<std::shared_ptr<ArrayData>> MakeNullREEArray(
                          /*null_count=*/0);
 }
 
+namespace {
+
+int64_t GetRunEnd(const ArraySpan& run_ends, int64_t physical_index) {
+  switch (run_ends.type->id()) {
+    case Type::INT16:
+      return run_ends.GetValues<int16_t>(1)[physical_index];
+    case Type::INT32:
+      return run_ends.GetValues<int32_t>(1)[physical_index];
+    default:
+      DCHECK_EQ(run_ends.type->id(), Type::INT64);
+      return run_ends.GetValues<int64_t>(1)[physical_index];
+  }
+}
+
+template <typename RunEndCType>
+void WriteRunEnds(const std::vector<int64_t>& run_ends, ArrayData* run_ends_data) {
+  auto* output_run_ends = run_ends_data->GetMutableValues<RunEndCType>(1);
+  for (size_t i = 0; i < run_ends.size(); ++i) {
+    output_run_ends[i] = static_cast<RunEndCType>(run_ends[i]);
+  }
+}
+
+}  // namespace
+
+Result<CommonRuns> FindCommonRuns(const std::vector<const ArraySpan*>& arrays,
+                                  MemoryPool* pool) {
+  DCHECK(!arrays.empty());
+  const int64_t length = arrays[0]->length;
+  std::vector<int64_t> physical_positions(arrays.size());
+  for (size_t i = 0; i < arrays.size(); ++i) {
+    DCHECK_EQ(arrays[i]->length, length);
+    physical_positions[i] =
+        ::arrow::ree_util::FindPhysicalIndex(*arrays[i], 0, arrays[i]->offset);
+  }
+
+  std::vector<int64_t> run_ends;
+  std::vector<std::vector<int64_t>> physical_indices(arrays.size());
+  for (int64_t position = 0; position < length;) {
+    int64_t run_end = length;
+    for (size_t i = 0; i < arrays.size(); ++i) {
+      run_end = std::min(run_end, GetRunEnd(arrays[i]->child_data[0],
+                                            physical_positions[i]) -
+                                      arrays[i]->offset);
+    }
+    run_ends.push_back(run_end);
+    for (size_t i = 0; i < arrays.size(); ++i) {
+      physical_indices[i].push_back(physical_positions[i]);
+      if (GetRunEnd(arrays[i]->child_data[0], physical_positions[i]) -
+              arrays[i]->offset ==
+          run_end) {
+        ++physical_positions[i];
+      }
+    }
+    position = run_end;
+  }
+
+  CommonRuns common_runs;
+  const auto& run_end_type =
+      ::arrow::internal::checked_cast<const RunEndEncodedType&>(*arrays[0]->type)
+          .run_end_type();
+  const auto num_runs = static_cast<int64_t>(run_ends.size());
+  ARROW_ASSIGN_OR_RAISE(common_runs.run_ends,
+                        PreallocateRunEndsArray(run_end_type, num_runs, pool));
+  switch (run_end_type->id()) {
+    case Type::INT16:
+      WriteRunEnds<int16_t>(run_ends, common_runs.run_ends.get());
+      break;
+    case Type::INT32:
+      WriteRunEnds<int32_t>(run_ends, common_runs.run_ends.get());
+      break;
+    default:
+      DCHECK_EQ(run_end_type->id(), Type::INT64);
+      WriteRunEnds<int64_t>(run_ends, common_runs.run_ends.get());
+      break;
+  }
+  for (auto& indices : physical_indices) {
+    common_runs.physical_indices.push_back(ArrayData::Make(
+        int64(), num_runs, {NULLPTR, Buffer::FromVector(std::move(indices))},
+        /*null_count=*/0));
+  }
+  return common_runs;
+}
+
 }  // namespace ree_util
 }  // namespace internal
 }  // namespace compute
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "arrow/array/data.h"
 #include "arrow/compute/exec.h"
@@ -381,6 +382,25 @@ Result<std::shared_ptr<ArrayData>> MakeNullREEArray(
     const std::shared_ptr<DataType>& run_end_type, int64_t logical_length,
     MemoryPool* pool);
 
+/// \brief The runs common to several run-end encoded arrays of the same length
+///
+/// A common run spans logical positions over which none of the arrays changes value.
+struct CommonRuns {
+  /// \brief The ends of the common runs, relative to the logical offset of the
+  /// arrays, of the run-end type of the first array
+  std::shared_ptr<ArrayData> run_ends;
+  /// \brief For each array, the physical index (as an int64 array) of its value in
+  /// each common run
+  std::vector<std::shared_ptr<ArrayData>> physical_indices;
+};
+
+/// \brief Find the runs common to run-end encoded arrays of the same length
+///
+/// Taking the physical indices of each array from its values gives the physical
+/// values of the arrays re-encoded with the common run ends.
+Result<CommonRuns> FindCommonRuns(const std::vector<const ArraySpan*>& arrays,
+                                  MemoryPool* pool);
+
 }  // namespace ree_util
 }  // namespace internal
 }  // namespace compute
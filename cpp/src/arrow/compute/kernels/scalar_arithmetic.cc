@@ -55,6 +55,7 @@ using applicator::ScalarBinaryNotNullEqualTypes;
 using applicator::ScalarUnary;
 using applicator::ScalarUnaryNotNull;
 using applicator::ScalarUnaryNotNullStateful;
+using applicator::SelectiveExecOf;
 
 namespace {
 
@@ -872,8 +873,12 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunction(std::string name,
                                                        FunctionDoc doc) {
   auto func = std::make_shared<FunctionImpl>(name, Arity::Binary(), std::move(doc));
   for (const auto& ty : NumericTypes()) {
-    auto exec = ArithmeticExecFromOp<ScalarBinaryEqualTypes, Op>(ty);
-    DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
+    ScalarKernel kernel({ty, ty}, ty,
+                        ArithmeticExecFromOp<ScalarBinaryEqualTypes, Op>(ty));
+    kernel.selective_exec =
+        ArithmeticExecFromOp<SelectiveExecOf<ScalarBinaryEqualTypes>::Kernel, Op,
+                             ArrayKernelSelectiveExec>(ty);
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
   AddNullExec(func.get());
   return func;
@@ -898,8 +903,11 @@ std::shared_ptr<ScalarFunction> MakeUnaryArithmeticFunction(std::string name,
                                                             FunctionDoc doc) {
   auto func = std::make_shared<ArithmeticFunction>(name, Arity::Unary(), std::move(doc));
   for (const auto& ty : NumericTypes()) {
-    auto exec = ArithmeticExecFromOp<ScalarUnary, Op>(ty);
-    DCHECK_OK(func->AddKernel({ty}, ty, exec));
+    ScalarKernel kernel({ty}, ty, ArithmeticExecFromOp<ScalarUnary, Op>(ty));
+    kernel.selective_exec =
+        ArithmeticExecFromOp<SelectiveExecOf<ScalarUnary>::Kernel, Op,
+                             ArrayKernelSelectiveExec>(ty);
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
   }
   AddNullExec(func.get());
   return func;
@@ -2926,6 +2926,60 @@ TYPED_TEST(TestUnaryArithmeticFloating, Sign) {
   this->AssertUnaryOp(sign, this->MakeScalar(max), this->MakeScalar(1));
 }
 
+
+std::shared_ptr<Array> RunEndEncodedFromJSON(const std::shared_ptr<DataType>& type,
+                                             const std::string& json) {
+  EXPECT_OK_AND_ASSIGN(Datum encoded, RunEndEncode(ArrayFromJSON(type, json),
+                                                   RunEndEncodeOptions(int32())));
+  return encoded.make_array();
+}
+
+std::shared_ptr<Array> Decode(const Datum& datum) {
+  EXPECT_TRUE(datum.type()->id() == Type::RUN_END_ENCODED);
+  EXPECT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(datum));
+  return decoded.make_array();
+}
+
+TEST(TestBinaryArithmetic, RunEndEncoded) {
+  auto left_json = "[1, 1, 1, 2, 2, null, null, 3, 3, 3]";
+  auto right_json = "[10, 10, 20, 20, 20, 20, 30, 30, 30, 30]";
+  auto expected = ArrayFromJSON(int32(), "[11, 11, 21, 22, 22, null, null, 33, 33, 33]");
+  auto left = RunEndEncodedFromJSON(int32(), left_json);
+  auto right = RunEndEncodedFromJSON(int32(), right_json);
+
+  // Arguments with different runs
+  ASSERT_OK_AND_ASSIGN(Datum out, Add(left, right));
+  AssertArraysEqual(*expected, *Decode(out), /*verbose=*/true);
+
+  // Arguments sharing their runs
+  ASSERT_OK_AND_ASSIGN(out, Add(left, left));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, 2, 2, 4, 4, null, null, 6, 6, 6]"),
+                    *Decode(out), /*verbose=*/true);
+
+  // Sliced arguments
+  ASSERT_OK_AND_ASSIGN(out, Add(left->Slice(2, 6), right->Slice(2, 6)));
+  AssertArraysEqual(*expected->Slice(2, 6), *Decode(out), /*verbose=*/true);
+
+  // A scalar argument
+  ASSERT_OK_AND_ASSIGN(out, Add(left, *MakeScalar(int32(), 100)));
+  AssertArraysEqual(
+      *ArrayFromJSON(int32(), "[101, 101, 101, 102, 102, null, null, 103, 103, 103]"),
+      *Decode(out), /*verbose=*/true);
+
+  // A plain array argument gives a plain result
+  ASSERT_OK_AND_ASSIGN(out, Add(left, ArrayFromJSON(int32(), right_json)));
+  AssertArraysEqual(*expected, *out.make_array(), /*verbose=*/true);
+
+  // Unary functions and comparisons
+  ASSERT_OK_AND_ASSIGN(out, Negate(left->Slice(1, 4)));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[-1, -1, -2, -2]"), *Decode(out),
+                    /*verbose=*/true);
+  ASSERT_OK_AND_ASSIGN(out, CallFunction("less", {left, right}));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), R"([true, true, true, true, true, null,
+                                                  null, true, true, true])"),
+                    *Decode(out), /*verbose=*/true);
+}
+
 }  // namespace
 }  // namespace compute
 }  // namespace arrow
@@ -17,6 +17,7 @@
 
 #include "benchmark/benchmark.h"
 
+#include <string>
 #include <vector>
 
 #include "arrow/compute/cast.h"
@@ -58,6 +59,20 @@ static void BenchmarkFloatingToIntegerCast(benchmark::State& state,
   }
 }
 
+static void BenchmarkTimestampToStringCast(benchmark::State& state,
+                                           const std::string& timezone) {
+  GenericItemsArgs args(state);
+  random::RandomArrayGenerator rand(kSeed);
+  // Nanoseconds between 1970 and 2033
+  auto array = rand.Numeric<Int64Type>(args.size, int64_t{0},
+                                       int64_t{2000000000} * 1000000000,
+                                       args.null_proportion);
+  auto timestamps = *array->View(timestamp(TimeUnit::NANO, timezone));
+  for (auto _ : state) {
+    ABORT_NOT_OK(Cast(timestamps, utf8()).status());
+  }
+}
+
 std::vector<int64_t> g_data_sizes = {kL2Size};
 
 void CastSetArgs(benchmark::internal::Benchmark* bench) {
@@ -103,6 +118,14 @@ static void CastDoubleToInt32Unsafe(benchmark::State& state) {
                                             CastOptions::Unsafe(), -1000, 1000);
 }
 
+static void CastTimestampToString(benchmark::State& state) {
+  BenchmarkTimestampToStringCast(state, "");
+}
+
+static void CastZonedTimestampToString(benchmark::State& state) {
+  BenchmarkTimestampToStringCast(state, "America/New_York");
+}
+
 BENCHMARK(CastInt64ToInt32Safe)->Apply(CastSetArgs);
 BENCHMARK(CastInt64ToInt32Unsafe)->Apply(CastSetArgs);
 BENCHMARK(CastUInt32ToInt32Safe)->Apply(CastSetArgs);
@@ -112,5 +135,8 @@ BENCHMARK(CastInt64ToDoubleUnsafe)->Apply(CastSetArgs);
 BENCHMARK(CastDoubleToInt32Safe)->Apply(CastSetArgs);
 BENCHMARK(CastDoubleToInt32Unsafe)->Apply(CastSetArgs);
 
+BENCHMARK(CastTimestampToString)->Apply(CastSetArgs);
+BENCHMARK(CastZonedTimestampToString)->Apply(CastSetArgs);
+
 }  // namespace compute
 }  // namespace arrow
@@ -49,10 +49,71 @@ Result<std::shared_ptr<Buffer>> GetNullBitmapBuffer(const ArraySpan& in_array,
     return in_array.GetBuffer(0);
   }
 
-  // If a non-zero offset, we need to shift the bitmap
+  // A byte-aligned offset only needs a slice of the bitmap
+  if (in_array.offset % 8 == 0) {
+    return SliceBuffer(in_array.GetBuffer(0), in_array.offset / 8,
+                       bit_util::BytesForBits(in_array.length));
+  }
+
+  // Otherwise, we need to shift the bitmap
   return CopyBitmap(pool, in_array.buffers[0].data, in_array.offset, in_array.length);
 }
 
+// Whether an array of type `from` can be reinterpreted as `to` without touching any
+// of its buffers: the types may only differ in the names of list fields, or in the
+// names of map fields and the nullability of struct fields when it is loosened.
+bool CanCastZeroCopy(const DataType& from, const DataType& to) {
+  if (from.id() != to.id()) {
+    return false;
+  }
+  switch (from.id()) {
+    case Type::LIST:
+    case Type::LARGE_LIST:
+    case Type::LIST_VIEW:
+    case Type::LARGE_LIST_VIEW:
+      return CanCastZeroCopy(*from.field(0)->type(), *to.field(0)->type());
+    case Type::FIXED_SIZE_LIST:
+      return checked_cast<const FixedSizeListType&>(from).list_size() ==
+                 checked_cast<const FixedSizeListType&>(to).list_size() &&
+             CanCastZeroCopy(*from.field(0)->type(), *to.field(0)->type());
+    case Type::MAP: {
+      const auto& from_map = checked_cast<const MapType&>(from);
+      const auto& to_map = checked_cast<const MapType&>(to);
+      return CanCastZeroCopy(*from_map.key_type(), *to_map.key_type()) &&
+             CanCastZeroCopy(*from_map.item_type(), *to_map.item_type());
+    }
+    case Type::STRUCT: {
+      if (from.num_fields() != to.num_fields()) {
+        return false;
+      }
+      for (int i = 0; i < from.num_fields(); ++i) {
+        const auto& from_field = from.field(i);
+        const auto& to_field = to.field(i);
+        if (from_field->name() != to_field->name() ||
+            (from_field->nullable() && !to_field->nullable()) ||
+            !CanCastZeroCopy(*from_field->type(), *to_field->type())) {
+          return false;
+        }
+      }
+      return true;
+    }
+    default:
+      return from.Equals(to);
+  }
+}
+
+// If the cast doesn't change the layout of the input, emit a view of it that shares
+// all its buffers and children instead of rebuilding it.
+Result<bool> TryCastZeroCopy(const ArraySpan& in_array, ExecResult* out) {
+  if (!CanCastZeroCopy(*in_array.type, *out->type())) {
+    return false;
+  }
+  ARROW_ASSIGN_OR_RAISE(out->value,
+                        ::arrow::internal::GetArrayView(in_array.ToArrayData(),
+                                                        out->type()->GetSharedPtr()));
+  return true;
+}
+
 // (Large)List<T> -> (Large)List<U>
 
 // TODO(wesm): memory could be preallocated here and it would make
@@ -124,6 +185,10 @@ struct CastList {
     auto child_type = checked_cast<const DestType&>(*out->type()).value_type();
 
     const ArraySpan& in_array = batch[0].array;
+    ARROW_ASSIGN_OR_RAISE(bool zero_copy, TryCastZeroCopy(in_array, out));
+    if (zero_copy) {
+      return Status::OK();
+    }
 
     ArrayData* out_array = out->array_data().get();
     ARROW_ASSIGN_OR_RAISE(out_array->buffers[0],
@@ -323,6 +388,11 @@ struct CastFixedList {
     }
 
     const ArraySpan& in_array = batch[0].array;
+    ARROW_ASSIGN_OR_RAISE(bool zero_copy, TryCastZeroCopy(in_array, out));
+    if (zero_copy) {
+      return Status::OK();
+    }
+
     std::shared_ptr<ArrayData> values = in_array.child_data[0].ToArrayData();
     ArrayData* out_array = out->array_data().get();
     out_array->buffers[0] = in_array.GetBuffer(0);
@@ -346,6 +416,13 @@ struct CastStruct {
     const CastOptions& options = CastState::Get(ctx);
     const auto& in_type = checked_cast<const StructType&>(*batch[0].type());
     const auto& out_type = checked_cast<const StructType&>(*out->type());
+
+    const ArraySpan& in_array = batch[0].array;
+    ARROW_ASSIGN_OR_RAISE(bool zero_copy, TryCastZeroCopy(in_array, out));
+    if (zero_copy) {
+      return Status::OK();
+    }
+
     const int in_field_count = in_type.num_fields();
     const int out_field_count = out_type.num_fields();
 
@@ -389,14 +466,9 @@ struct CastStruct {
       }
     }
 
-    const ArraySpan& in_array = batch[0].array;
     ArrayData* out_array = out->array_data().get();
-
-    if (in_array.buffers[0].data != nullptr) {
-      ARROW_ASSIGN_OR_RAISE(out_array->buffers[0],
-                            CopyBitmap(ctx->memory_pool(), in_array.buffers[0].data,
-                                       in_array.offset, in_array.length));
-    }
+    ARROW_ASSIGN_OR_RAISE(out_array->buffers[0],
+                          GetNullBitmapBuffer(in_array, ctx->memory_pool()));
 
     int out_field_index = 0;
     for (int in_field_index : fields_to_select) {
@@ -456,20 +528,18 @@ struct CastMap {
     std::shared_ptr<DataType> value_type = entry_type->field(1)->type();
 
     const ArraySpan& in_array = batch[0].array;
+    ARROW_ASSIGN_OR_RAISE(bool zero_copy, TryCastZeroCopy(in_array, out));
+    if (zero_copy) {
+      return Status::OK();
+    }
 
     ArrayData* out_array = out->array_data().get();
-    out_array->buffers[0] = in_array.GetBuffer(0);
+    ARROW_ASSIGN_OR_RAISE(out_array->buffers[0],
+                          GetNullBitmapBuffer(in_array, ctx->memory_pool()));
     out_array->buffers[1] = in_array.GetBuffer(1);
 
     std::shared_ptr<ArrayData> entries = in_array.child_data[0].ToArrayData();
 
-    // Shift bitmap in case the source offset is non-zero
-    if (in_array.offset != 0 && in_array.buffers[0].data != nullptr) {
-      ARROW_ASSIGN_OR_RAISE(out_array->buffers[0],
-                            CopyBitmap(ctx->memory_pool(), in_array.buffers[0].data,
-                                       in_array.offset, in_array.length));
-    }
-
     RETURN_NOT_OK(CastListImpl::HandleOffsets(ctx, in_array, out_array, &entries));
 
     // Handle keys
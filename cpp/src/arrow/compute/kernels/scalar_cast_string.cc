@@ -204,7 +204,7 @@ struct TemporalToStringCastFunctor<O, TimestampType> {
         input,
         [&](value_type v) {
           ARROW_ASSIGN_OR_RAISE(auto formatted, formatter(v));
-          return builder->Append(std::move(formatted));
+          return builder->Append(formatted);
         },
         [&]() {
           builder->UnsafeAppendNull();
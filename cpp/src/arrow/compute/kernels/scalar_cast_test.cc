@@ -4168,6 +4168,57 @@ TEST(Cast, StructToDifferentNullabilityStruct) {
   }
 }
 
+TEST(Cast, NestedZeroCopy) {
+  // Casts that only rename list fields or loosen nullability share all buffers
+  auto list_src = ArrayFromJSON(list(int32()), "[[1, 2], null, [], [3]]");
+  auto list_dest = list(field("x", int32(), /*nullable=*/false));
+  for (const auto& input : {list_src, list_src->Slice(1)}) {
+    CheckCastZeroCopy(input, list_dest);
+    ASSERT_OK_AND_ASSIGN(auto converted, Cast(*input, list_dest));
+    ASSERT_EQ(converted->offset(), input->offset());
+    ASSERT_EQ(converted->data()->child_data[0].get(), input->data()->child_data[0].get());
+  }
+
+  auto struct_src = ArrayFromJSON(
+      struct_({field("a", int8(), /*nullable=*/false), field("b", list(utf8()))}),
+      R"([{"a": 1, "b": ["x"]}, null, {"a": 3, "b": null}])");
+  CheckCastZeroCopy(struct_src,
+                    struct_({field("a", int8()), field("b", list(field("y", utf8())))}));
+
+  auto map_src = ArrayFromJSON(map(utf8(), int16()), R"([[["a", 1]], null, []])");
+  CheckCastZeroCopy(map_src, map(utf8(), field("v", int16()), /*keys_sorted=*/false));
+
+  CheckCastZeroCopy(ArrayFromJSON(fixed_size_list(int32(), 2), "[[1, 2], null]"),
+                    fixed_size_list(field("z", int32()), 2));
+}
+
+TEST(Cast, StructOneFieldChangedSharesOtherFields) {
+  const char* json =
+      R"([{"a": 0, "b": "x"}, {"a": 1, "b": "y"}, {"a": 2, "b": "z"}, null,
+          {"a": 4, "b": "u"}, {"a": 5, "b": "v"}, {"a": 6, "b": "w"}, {"a": 7, "b": null},
+          {"a": 8, "b": "s"}, null, {"a": 10, "b": "t"}])";
+  auto dest_type = struct_({field("a", int64()), field("b", utf8())});
+  auto src = ArrayFromJSON(struct_({field("a", int32()), field("b", utf8())}), json);
+  auto dest = ArrayFromJSON(dest_type, json);
+  for (int64_t offset : {0, 8}) {
+    auto input = src->Slice(offset);
+    ASSERT_OK_AND_ASSIGN(auto converted, Cast(*input, dest_type));
+    ValidateOutput(*converted);
+    AssertArraysEqual(*dest->Slice(offset), *converted);
+
+    // The validity bitmap is sliced rather than copied since the offset is
+    // byte-aligned, and the unchanged field keeps its buffers
+    const auto& in_data = *input->data();
+    const auto& out_data = *converted->data();
+    ASSERT_EQ(out_data.buffers[0]->data(),
+              in_data.buffers[0]->data() + in_data.offset / 8);
+    for (size_t i = 0; i < in_data.child_data[1]->buffers.size(); ++i) {
+      ASSERT_EQ(out_data.child_data[1]->buffers[i].get(),
+                in_data.child_data[1]->buffers[i].get());
+    }
+  }
+}
+
 TEST(Cast, IdentityCasts) {
   // ARROW-4102
   auto CheckIdentityCast = [](std::shared_ptr<DataType> type, const std::string& json) {
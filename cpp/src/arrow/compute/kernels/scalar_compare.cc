@@ -328,13 +328,48 @@ ScalarKernel GetCompareKernel(InputType ty, Type::type compare_type,
   return kernel;
 }
 
+template <typename Type, typename Op>
+using SelectiveCompareKernel = typename applicator::SelectiveExecOf<
+    applicator::ScalarBinaryEqualTypes>::template Kernel<BooleanType, Type, Op>;
+
 template <typename Op>
 void AddPrimitiveCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
   ArrayKernelExec exec = GeneratePhysicalNumeric<CompareKernel>(ty);
   ScalarKernel kernel = GetCompareKernel<Op>(ty, ty->id(), exec);
+  kernel.selective_exec =
+      GeneratePhysicalNumericGeneric<ArrayKernelSelectiveExec, SelectiveCompareKernel,
+                                     Op>(ty);
   DCHECK_OK(func->AddKernel(kernel));
 }
 
+template <typename Op>
+void AddBinaryCompare(const std::shared_ptr<DataType>& ty, ScalarFunction* func) {
+  ArrayKernelExec exec =
+      is_binary_view_like(*ty)
+          ? GenerateVarBinaryViewBase<applicator::ScalarBinaryEqualTypes, BooleanType,
+                                      Op>(*ty)
+          : GenerateVarBinaryBase<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(
+                *ty);
+  ScalarKernel kernel({ty, ty}, boolean(), std::move(exec));
+  switch (ty->id()) {
+    case Type::BINARY:
+    case Type::STRING:
+      kernel.selective_exec = SelectiveCompareKernel<BinaryType, Op>::Exec;
+      break;
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      kernel.selective_exec = SelectiveCompareKernel<LargeBinaryType, Op>::Exec;
+      break;
+    case Type::BINARY_VIEW:
+    case Type::STRING_VIEW:
+      kernel.selective_exec = SelectiveCompareKernel<BinaryViewType, Op>::Exec;
+      break;
+    default:
+      DCHECK(false);
+  }
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+}
+
 struct CompareFunction : ScalarFunction {
   using ScalarFunction::ScalarFunction;
 
@@ -389,9 +424,13 @@ template <typename Op>
 std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name, FunctionDoc doc) {
   auto func = std::make_shared<CompareFunction>(name, Arity::Binary(), std::move(doc));
 
-  DCHECK_OK(func->AddKernel(
-      {boolean(), boolean()}, boolean(),
-      applicator::ScalarBinary<BooleanType, BooleanType, BooleanType, Op>::Exec));
+  {
+    ScalarKernel kernel(
+        {boolean(), boolean()}, boolean(),
+        applicator::ScalarBinary<BooleanType, BooleanType, BooleanType, Op>::Exec);
+    kernel.selective_exec = SelectiveCompareKernel<BooleanType, Op>::Exec;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
 
   for (const std::shared_ptr<DataType>& ty : NumericTypes()) {
     AddPrimitiveCompare<Op>(ty, func.get());
@@ -427,9 +466,10 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name, FunctionDo
   }
 
   for (const std::shared_ptr<DataType>& ty : BaseBinaryTypes()) {
-    auto exec =
-        GenerateVarBinaryBase<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(*ty);
-    DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
+    AddBinaryCompare<Op>(ty, func.get());
+  }
+  for (const std::shared_ptr<DataType>& ty : BinaryViewTypes()) {
+    AddBinaryCompare<Op>(ty, func.get());
   }
 
   for (const auto id : {Type::DECIMAL128, Type::DECIMAL256}) {
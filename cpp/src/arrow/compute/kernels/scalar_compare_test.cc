@@ -1175,6 +1175,28 @@ TEST_F(TestStringCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TEST_F(TestStringCompareKernel, CompareBinaryViews) {
+  // Comparing views must give the same results as comparing the equivalent strings,
+  // whether the values are inlined in the views or not
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  for (auto null_probability : {0.0, 0.1, 1.0}) {
+    auto lhs = rand.String(256, 0, 24, null_probability);
+    auto rhs = rand.String(256, 0, 24, null_probability);
+    ASSERT_OK_AND_ASSIGN(Datum lhs_views, Cast(lhs, utf8_view()));
+    ASSERT_OK_AND_ASSIGN(Datum rhs_views, Cast(rhs, utf8_view()));
+    auto hello = Datum(std::make_shared<StringScalar>("hello"));
+    auto hello_view = Datum(std::make_shared<StringViewScalar>("hello"));
+    for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+      const auto function_name = CompareOperatorToFunctionName(op);
+      ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(function_name, {lhs, rhs}));
+      ValidateCompare<StringViewType>(CompareOptions(op), lhs_views, rhs_views, expected);
+      ASSERT_OK_AND_ASSIGN(expected, CallFunction(function_name, {lhs, hello}));
+      ValidateCompare<StringViewType>(CompareOptions(op), lhs_views, hello_view,
+                                      expected);
+    }
+  }
+}
+
 template <typename T>
 class TestVarArgsCompare : public ::testing::Test {
  protected:
@@ -2128,5 +2150,25 @@ TEST(TestMaxElementWiseMinElementWise, CommonTemporal) {
               ResultWith(ScalarFromJSON(duration(TimeUnit::MILLI), "1000")));
 }
 
+TEST(TestCompareKernel, DictionaryArrayWithLiteral) {
+  // The comparison is evaluated on the dictionary values, then gathered
+  auto dict_type = dictionary(int8(), utf8());
+  auto arr = DictArrayFromJSON(dict_type, "[0, 1, null, 2, 0, 1, 0, 2]",
+                               R"(["a", "b", null])");
+  EXPECT_THAT(CallFunction("equal", {arr, ScalarFromJSON(utf8(), R"("a")")}),
+              ResultWith(ArrayFromJSON(
+                  boolean(), "[true, false, null, null, true, false, true, null]")));
+  EXPECT_THAT(CallFunction("less", {ScalarFromJSON(utf8(), R"("a")"), arr->Slice(1, 5)}),
+              ResultWith(ArrayFromJSON(boolean(), "[true, null, null, false, true]")));
+  EXPECT_THAT(CallFunction("utf8_upper", {arr}),
+              ResultWith(ArrayFromJSON(
+                  utf8(), R"(["A", "B", null, null, "A", "B", "A", null])")));
+
+  // Dictionary values not referenced by the indices don't make the function fail
+  auto ints = DictArrayFromJSON(dictionary(int8(), int8()), "[0, 0, 0]", "[1, 127]");
+  EXPECT_THAT(CallFunction("add_checked", {ints, ScalarFromJSON(int8(), "1")}),
+              ResultWith(ArrayFromJSON(int8(), "[2, 2, 2]")));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -298,6 +298,70 @@ struct IfElseNullPromoter {
 using Word = uint64_t;
 static constexpr int64_t word_len = sizeof(Word) * 8;
 
+// A word with the lowest `length` bits set
+inline Word BlockMask(int64_t length) {
+  return length >= word_len ? ~Word(0) : (Word(1) << length) - 1;
+}
+
+// Read `length` (at most 64) bits of a bitmap starting at `offset` into the lowest
+// bits of a word, without reading past the last byte holding them.  A null bitmap
+// reads as all set.
+inline Word ReadBitmapWord(const uint8_t* bitmap, int64_t offset, int64_t length) {
+  const Word mask = BlockMask(length);
+  if (bitmap == nullptr) {
+    return mask;
+  }
+  bitmap += offset / 8;
+  const int shift = static_cast<int>(offset % 8);
+  const int64_t num_bytes = bit_util::BytesForBits(shift + length);
+  Word word = 0;
+  std::memcpy(&word, bitmap, std::min<int64_t>(num_bytes, sizeof(Word)));
+  word = bit_util::FromLittleEndian(word) >> shift;
+  if (num_bytes > static_cast<int64_t>(sizeof(Word))) {
+    word |= static_cast<Word>(bitmap[sizeof(Word)]) << (word_len - shift);
+  }
+  return word & mask;
+}
+
+// Write the lowest `length` (at most 64) bits of `word` to a bitmap at `offset`
+inline void WriteBitmapWord(uint8_t* bitmap, int64_t offset, int64_t length, Word word) {
+  word = bit_util::ToLittleEndian(word);
+  if (offset % 8 == 0 && length == word_len) {
+    std::memcpy(bitmap + offset / 8, &word, sizeof(Word));
+  } else {
+    arrow::internal::CopyBitmap(reinterpret_cast<const uint8_t*>(&word), 0, length,
+                                bitmap, offset);
+  }
+}
+
+// Overwrite the `length` (at most 64) values of `out` whose bit is set in `mask`
+// with those of `source`, or with `scalar` if `source` is null.  Rather than
+// branching on every bit, both sides are loaded and blended, which compilers turn
+// into vector selects.
+template <typename T>
+void BlendValues(Word mask, const T* source, const T& scalar, T* out, int64_t length) {
+  if (mask == 0) {
+    return;
+  }
+  if (mask == BlockMask(length)) {
+    if (source != nullptr) {
+      std::memcpy(out, source, length * sizeof(T));
+    } else {
+      std::fill(out, out + length, scalar);
+    }
+    return;
+  }
+  if (source != nullptr) {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = ((mask >> i) & 1) ? source[i] : out[i];
+    }
+  } else {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = ((mask >> i) & 1) ? scalar : out[i];
+    }
+  }
+}
+
 /// Runs the main if_else loop. Here, it is expected that the right data has already
 /// been copied to the output.
 /// If `invert` is meant to invert the cond.data. If is set to `true`, then the
@@ -311,10 +375,15 @@ static constexpr int64_t word_len = sizeof(Word) * 8;
 ///     [](int64_t offset, int64_t length){...}
 /// It should copy `length` number of elements from source array to output array with
 /// `offset` offset in both arrays
-template <typename HandleBlock, bool invert = false>
-void RunIfElseLoop(const ArraySpan& cond, const HandleBlock& handle_block) {
+/// `HandleMixed` has the signature:
+///     [](int64_t offset, Word mask, int64_t length){...}
+/// It is called for blocks of at most 64 elements where only some are selected, the
+/// selected elements being given by the set bits of `mask` (already inverted if
+/// `invert` is true).
+template <bool invert = false, typename HandleBlock, typename HandleMixed>
+void RunIfElseLoop(const ArraySpan& cond, const HandleBlock& handle_block,
+                   const HandleMixed& handle_mixed) {
   int64_t data_offset = 0;
-  int64_t bit_offset = cond.offset;
   const auto* cond_data = cond.buffers[1].data;  // this is a BoolArray
 
   BitmapWordReader<Word> cond_reader(cond_data, cond.offset, cond.length);
@@ -329,14 +398,9 @@ void RunIfElseLoop(const ArraySpan& cond, const HandleBlock& handle_block) {
     if (word == pickAll) {
       handle_block(data_offset, word_len);
     } else if (word != pickNone) {
-      for (int64_t i = 0; i < word_len; ++i) {
-        if (bit_util::GetBit(cond_data, bit_offset + i) != invert) {
-          handle_block(data_offset + i, 1);
-        }
-      }
+      handle_mixed(data_offset, invert ? ~word : word, word_len);
     }
     data_offset += word_len;
-    bit_offset += word_len;
   }
 
   constexpr uint8_t pickAllByte = invert ? 0 : UINT8_MAX;
@@ -351,17 +415,25 @@ void RunIfElseLoop(const ArraySpan& cond, const HandleBlock& handle_block) {
     if (byte == pickAllByte && valid_bits == 8) {
       handle_block(data_offset, 8);
     } else if (byte != pickNoneByte) {
-      for (int i = 0; i < valid_bits; ++i) {
-        if (bit_util::GetBit(cond_data, bit_offset + i) != invert) {
-          handle_block(data_offset + i, 1);
-        }
-      }
+      const Word mask = (invert ? ~Word(byte) : Word(byte)) & BlockMask(valid_bits);
+      handle_mixed(data_offset, mask, valid_bits);
     }
     data_offset += 8;
-    bit_offset += 8;
   }
 }
 
+template <typename HandleBlock, bool invert = false>
+void RunIfElseLoop(const ArraySpan& cond, const HandleBlock& handle_block) {
+  RunIfElseLoop<invert>(cond, handle_block,
+                        [&](int64_t data_offset, Word mask, int64_t length) {
+                          for (int64_t i = 0; i < length; ++i) {
+                            if ((mask >> i) & 1) {
+                              handle_block(data_offset + i, 1);
+                            }
+                          }
+                        });
+}
+
 template <typename HandleBlock>
 void RunIfElseLoopInverted(const ArraySpan& cond, const HandleBlock& handle_block) {
   RunIfElseLoop<HandleBlock, true>(cond, handle_block);
@@ -457,10 +529,16 @@ struct IfElseFunctor<Type,
 
     // selectively copy values from left data
     const T* left_data = left.GetValues<T>(1);
-    RunIfElseLoop(cond, [&](int64_t data_offset, int64_t num_elems) {
-      std::memcpy(out_values + data_offset, left_data + data_offset,
-                  num_elems * sizeof(T));
-    });
+    RunIfElseLoop(
+        cond,
+        [&](int64_t data_offset, int64_t num_elems) {
+          std::memcpy(out_values + data_offset, left_data + data_offset,
+                      num_elems * sizeof(T));
+        },
+        [&](int64_t data_offset, Word mask, int64_t num_elems) {
+          BlendValues(mask, left_data + data_offset, T{}, out_values + data_offset,
+                      num_elems);
+        });
 
     return Status::OK();
   }
@@ -480,10 +558,15 @@ struct IfElseFunctor<Type,
     // selectively copy values from left data
     T left_data = internal::UnboxScalar<Type>::Unbox(left);
 
-    RunIfElseLoop(cond, [&](int64_t data_offset, int64_t num_elems) {
-      std::fill(out_values + data_offset, out_values + data_offset + num_elems,
-                left_data);
-    });
+    RunIfElseLoop(
+        cond,
+        [&](int64_t data_offset, int64_t num_elems) {
+          std::fill(out_values + data_offset, out_values + data_offset + num_elems,
+                    left_data);
+        },
+        [&](int64_t data_offset, Word mask, int64_t num_elems) {
+          BlendValues<T>(mask, nullptr, left_data, out_values + data_offset, num_elems);
+        });
 
     return Status::OK();
   }
@@ -503,10 +586,15 @@ struct IfElseFunctor<Type,
 
     T right_data = internal::UnboxScalar<Type>::Unbox(right);
 
-    RunIfElseLoopInverted(cond, [&](int64_t data_offset, int64_t num_elems) {
-      std::fill(out_values + data_offset, out_values + data_offset + num_elems,
-                right_data);
-    });
+    RunIfElseLoop</*invert=*/true>(
+        cond,
+        [&](int64_t data_offset, int64_t num_elems) {
+          std::fill(out_values + data_offset, out_values + data_offset + num_elems,
+                    right_data);
+        },
+        [&](int64_t data_offset, Word mask, int64_t num_elems) {
+          BlendValues<T>(mask, nullptr, right_data, out_values + data_offset, num_elems);
+        });
 
     return Status::OK();
   }
@@ -522,10 +610,15 @@ struct IfElseFunctor<Type,
 
     // selectively copy values from left data
     T left_data = internal::UnboxScalar<Type>::Unbox(left);
-    RunIfElseLoop(cond, [&](int64_t data_offset, int64_t num_elems) {
-      std::fill(out_values + data_offset, out_values + data_offset + num_elems,
-                left_data);
-    });
+    RunIfElseLoop(
+        cond,
+        [&](int64_t data_offset, int64_t num_elems) {
+          std::fill(out_values + data_offset, out_values + data_offset + num_elems,
+                    left_data);
+        },
+        [&](int64_t data_offset, Word mask, int64_t num_elems) {
+          BlendValues<T>(mask, nullptr, left_data, out_values + data_offset, num_elems);
+        });
 
     return Status::OK();
   }
@@ -1507,6 +1600,96 @@ Status ExecScalarCaseWhen(KernelContext* ctx, const ExecSpan& batch, ExecResult*
   return Status::OK();
 }
 
+// The storage types which GenerateTypeAgnosticPrimitive maps fixed-width types onto,
+// for which 'case when' and 'coalesce' blend values rather than copying them
+template <typename Type>
+constexpr bool kIsBlendType =
+    std::is_same<Type, UInt8Type>::value || std::is_same<Type, UInt16Type>::value ||
+    std::is_same<Type, UInt32Type>::value || std::is_same<Type, UInt64Type>::value;
+
+// A value argument of the blend implementations of 'case when' and 'coalesce',
+// read 64 rows at a time
+template <typename T>
+struct BlendSource {
+  explicit BlendSource(const ExecValue& value) {
+    if (value.is_scalar()) {
+      const auto& scalar =
+          checked_cast<const arrow::internal::PrimitiveScalarBase&>(*value.scalar);
+      valid = scalar.is_valid;
+      if (valid) {
+        std::memcpy(&scalar_value, scalar.view().data(), sizeof(T));
+      }
+    } else {
+      values = value.array.GetValues<T>(1);
+      validity = value.array.buffers[0].data;
+      offset = value.array.offset;
+    }
+  }
+
+  Word ValidWord(int64_t row, int64_t length) const {
+    if (values == nullptr) {
+      return valid ? BlockMask(length) : 0;
+    }
+    return ReadBitmapWord(validity, offset + row, length);
+  }
+
+  void Blend(Word mask, int64_t row, int64_t length, T* out) const {
+    BlendValues(mask, values == nullptr ? nullptr : values + row, scalar_value, out,
+                length);
+  }
+
+  const T* values = nullptr;
+  T scalar_value{};
+  bool valid = false;
+  const uint8_t* validity = nullptr;
+  int64_t offset = 0;
+};
+
+// 'case when' for fixed-width types stored as unsigned integers.  For each block of 64
+// rows, the rows still unassigned are tracked in a word and each branch blends its
+// values into the rows it takes, so there is no per-row branching however the
+// conditions interleave.
+template <typename Type>
+Status ExecArrayCaseWhenBlend(const ExecSpan& batch, ExecResult* out) {
+  using T = typename TypeTraits<Type>::CType;
+  const ArraySpan& conds_array = batch[0].array;
+  const int num_conds = conds_array.type->num_fields();
+  const bool have_else_arg = static_cast<size_t>(num_conds) < batch.values.size() - 1;
+  std::vector<BlendSource<T>> sources;
+  sources.reserve(batch.values.size() - 1);
+  for (size_t i = 1; i < batch.values.size(); ++i) {
+    sources.emplace_back(batch[i]);
+  }
+
+  ArraySpan* output = out->array_span_mutable();
+  uint8_t* out_valid = output->buffers[0].data;
+  T* out_values = output->GetValues<T>(1);
+  for (int64_t row = 0; row < batch.length; row += word_len) {
+    const int64_t length = std::min<int64_t>(word_len, batch.length - row);
+    T* block_values = out_values + row;
+    // Rows taken by no branch are null, with zeroed values
+    std::fill(block_values, block_values + length, T{});
+    Word remaining = BlockMask(length);
+    Word valid = 0;
+    for (int i = 0; i < num_conds && remaining != 0; ++i) {
+      const ArraySpan& cond = conds_array.child_data[i];
+      const int64_t cond_offset = conds_array.offset + cond.offset + row;
+      const Word take = remaining &
+                        ReadBitmapWord(cond.buffers[1].data, cond_offset, length) &
+                        ReadBitmapWord(cond.buffers[0].data, cond_offset, length);
+      remaining &= ~take;
+      sources[i].Blend(take, row, length, block_values);
+      valid |= take & sources[i].ValidWord(row, length);
+    }
+    if (have_else_arg) {
+      sources.back().Blend(remaining, row, length, block_values);
+      valid |= remaining & sources.back().ValidWord(row, length);
+    }
+    WriteBitmapWord(out_valid, output->offset + row, length, valid);
+  }
+  return Status::OK();
+}
+
 // Implement 'case when' for any mix of scalar/array arguments for any fixed-width type,
 // given helper functions to copy data from a source array to a target array
 template <typename Type>
@@ -1517,6 +1700,9 @@ Status ExecArrayCaseWhen(KernelContext* ctx, const ExecSpan& batch, ExecResult*
         "cond struct must not be a null scalar or "
         "have top-level nulls");
   }
+  if constexpr (kIsBlendType<Type>) {
+    return ExecArrayCaseWhenBlend<Type>(batch, out);
+  }
   ArraySpan* output = out->array_span_mutable();
   const int64_t out_offset = output->offset;
   const auto num_value_args = batch.values.size() - 1;
@@ -2057,9 +2243,48 @@ void InitializeNullSlots(const DataType& type, uint8_t* out_valid, uint8_t* out_
   DCHECK_EQ(offset, length);
 }
 
+// 'coalesce' for fixed-width types stored as unsigned integers.  For each block of 64
+// rows, each argument blends its valid values into the rows still null.
+template <typename Type>
+Status ExecArrayCoalesceBlend(const ExecSpan& batch, ExecResult* out) {
+  using T = typename TypeTraits<Type>::CType;
+  std::vector<BlendSource<T>> sources;
+  sources.reserve(batch.values.size());
+  for (const ExecValue& value : batch.values) {
+    sources.emplace_back(value);
+  }
+
+  ArraySpan* output = out->array_span_mutable();
+  uint8_t* out_valid = output->buffers[0].data;
+  T* out_values = output->GetValues<T>(1);
+  for (int64_t row = 0; row < batch.length; row += word_len) {
+    const int64_t length = std::min<int64_t>(word_len, batch.length - row);
+    T* block_values = out_values + row;
+    Word remaining = BlockMask(length);
+    for (const auto& source : sources) {
+      const Word take = remaining & source.ValidWord(row, length);
+      if (take != remaining && remaining == BlockMask(length)) {
+        // Some rows may stay null, with zeroed values
+        std::fill(block_values, block_values + length, T{});
+      }
+      source.Blend(take, row, length, block_values);
+      remaining &= ~take;
+      if (remaining == 0) {
+        break;
+      }
+    }
+    WriteBitmapWord(out_valid, output->offset + row, length,
+                    BlockMask(length) & ~remaining);
+  }
+  return Status::OK();
+}
+
 // Implement 'coalesce' for any mix of scalar/array arguments for any fixed-width type
 template <typename Type>
 Status ExecArrayCoalesce(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  if constexpr (kIsBlendType<Type>) {
+    return ExecArrayCoalesceBlend<Type>(batch, out);
+  }
   ArraySpan* output = out->array_span_mutable();
   const int64_t out_offset = output->offset;
   // Use output validity buffer as mask to decide what values to copy
@@ -2626,6 +2626,31 @@ TYPED_TEST(TestCoalesceNumeric, Basics) {
   }
 }
 
+TYPED_TEST(TestCoalesceNumeric, Random) {
+  auto type = default_type_instance<TypeParam>();
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  const int64_t len = 300;
+  std::vector<std::shared_ptr<Array>> values;
+  for (double null_probability : {0.9, 0.5, 0.1}) {
+    values.push_back(rand.ArrayOf(type, len, null_probability));
+  }
+  auto scalar = ScalarFromJSON(type, "7");
+
+  ASSERT_OK_AND_ASSIGN(auto builder, MakeBuilder(type));
+  for (int64_t i = 0; i < len; ++i) {
+    if (values[0]->IsValid(i)) {
+      ASSERT_OK(builder->AppendArraySlice(ArraySpan(*values[0]->data()), i, 1));
+    } else if (values[1]->IsValid(i)) {
+      ASSERT_OK(builder->AppendArraySlice(ArraySpan(*values[1]->data()), i, 1));
+    } else {
+      ASSERT_OK(builder->AppendScalar(*scalar));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected, builder->Finish());
+  // Arguments after a valid scalar are never read
+  CheckScalar("coalesce", {values[0], values[1], scalar, values[2]}, expected);
+}
+
 TYPED_TEST(TestCoalesceNumeric, ListOfType) {
   auto type = list(default_type_instance<TypeParam>());
   auto scalar_null = ScalarFromJSON(type, "null");
@@ -18,15 +18,20 @@
 // Vector kernels involving nested types
 
 #include <cmath>
+#include <cstring>
 #include "arrow/array/array_base.h"
 #include "arrow/array/builder_nested.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common_internal.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_generate.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/string.h"
 #include "arrow/util/unreachable.h"
 
@@ -195,6 +200,11 @@ struct ListSlice {
     ARROW_ASSIGN_OR_RAISE(auto output_type_holder, ListSliceOutputType(opts, *list_type));
     constexpr auto kInputTypeId = InListType::type_id;
     auto output_type = output_type_holder.GetSharedPtr();
+    if constexpr (is_list_view(kInputTypeId)) {
+      if (output_type->id() == kInputTypeId && opts.step == 1) {
+        return SliceListViews(ctx, opts.start, opts.stop, list_array, out);
+      }
+    }
     switch (output_type->id()) {
       // The various `if constexpr` guards below avoid generating
       // ListSlice<InListType>::BuildArray<ListBuilder> specializations
@@ -235,6 +245,52 @@ struct ListSlice {
     return Status::OK();
   }
 
+  /// \brief Slices list-views without copying their values
+  ///
+  /// Only new offsets and sizes are allocated: the values are shared with the
+  /// input, and so is the validity bitmap unless the input has an offset.
+  static Status SliceListViews(KernelContext* ctx, int64_t start,
+                               std::optional<int64_t> stop, const ArraySpan& list_array,
+                               ExecResult* out) {
+    const int64_t length = list_array.length;
+    const auto* offsets = list_array.GetValues<offset_type>(1);
+    const auto* sizes = list_array.GetValues<offset_type>(2);
+    ARROW_ASSIGN_OR_RAISE(auto out_offsets, ctx->Allocate(length * sizeof(offset_type)));
+    ARROW_ASSIGN_OR_RAISE(auto out_sizes, ctx->Allocate(length * sizeof(offset_type)));
+    auto* out_offsets_data = out_offsets->mutable_data_as<offset_type>();
+    auto* out_sizes_data = out_sizes->mutable_data_as<offset_type>();
+    for (int64_t i = 0; i < length; ++i) {
+      if (list_array.IsNull(i)) {
+        out_offsets_data[i] = 0;
+        out_sizes_data[i] = 0;
+        continue;
+      }
+      const int64_t list_size = sizes[i];
+      const int64_t begin = std::min(start, list_size);
+      const int64_t end = std::min(stop.value_or(list_size), list_size);
+      out_offsets_data[i] = static_cast<offset_type>(offsets[i] + begin);
+      out_sizes_data[i] = static_cast<offset_type>(std::max<int64_t>(end - begin, 0));
+    }
+
+    std::shared_ptr<Buffer> validity;
+    const int64_t null_count = list_array.GetNullCount();
+    if (null_count > 0) {
+      if (list_array.offset == 0 && list_array.buffers[0].owner != nullptr) {
+        validity = list_array.GetBuffer(0);
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            validity, arrow::internal::CopyBitmap(ctx->memory_pool(),
+                                                  list_array.buffers[0].data,
+                                                  list_array.offset, length));
+      }
+    }
+    out->value = ArrayData::Make(
+        list_array.type->GetSharedPtr(), length,
+        {std::move(validity), std::move(out_offsets), std::move(out_sizes)},
+        {list_array.child_data[0].ToArrayData()}, null_count);
+    return Status::OK();
+  }
+
   /// \brief Builds the array of list slices from the input list array
   template <typename BuilderType>
   static Status BuildArray(MemoryPool* pool, const ListSliceOptions& opts,
@@ -425,44 +481,156 @@ const FunctionDoc list_slice_doc(
     {"lists"}, "ListSliceOptions",
     /*options_required=*/true);
 
+template <int64_t kByteWidth, typename ValuePosition>
+int64_t GatherFixedWidthValues(const ArraySpan& list, const ArraySpan& values,
+                               int64_t byte_width, ValuePosition&& value_position,
+                               uint8_t* out_validity, uint8_t* out_values) {
+  if constexpr (kByteWidth > 0) {
+    DCHECK_EQ(byte_width, kByteWidth);
+    byte_width = kByteWidth;
+  }
+  const uint8_t* in_values = values.buffers[1].data;
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < list.length; ++i) {
+    bool is_valid = list.IsValid(i);
+    int64_t position = 0;
+    if (is_valid) {
+      position = value_position(i);
+      is_valid = values.IsValid(position);
+    }
+    bit_util::SetBitTo(out_validity, i, is_valid);
+    uint8_t* out_value = out_values + i * byte_width;
+    if (is_valid) {
+      std::memcpy(out_value, in_values + (values.offset + position) * byte_width,
+                  byte_width);
+    } else {
+      std::memset(out_value, 0, byte_width);
+      ++null_count;
+    }
+  }
+  return null_count;
+}
+
+/// \brief Emits the value at `value_position(i)` of every valid list slot i,
+/// and a null for every null list slot
+///
+/// `value_position` returns a position in the values of `list` and is only
+/// called on valid list slots, whose index has been bounds-checked.
+/// Fixed-width values are gathered straight into the output buffers.
+template <typename ValuePosition>
+Status GatherListElements(KernelContext* ctx, const ArraySpan& list,
+                          ValuePosition&& value_position, ExecResult* out) {
+  const ArraySpan& values = list.child_data[0];
+  const DataType* value_type = values.type;
+  const int64_t length = list.length;
+  if (!is_primitive(value_type->id()) && !is_fixed_size_binary(value_type->id())) {
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(
+        MakeBuilder(ctx->memory_pool(), value_type->GetSharedPtr(), &builder));
+    RETURN_NOT_OK(builder->Reserve(length));
+    for (int64_t i = 0; i < length; ++i) {
+      if (list.IsNull(i)) {
+        RETURN_NOT_OK(builder->AppendNull());
+        continue;
+      }
+      RETURN_NOT_OK(builder->AppendArraySlice(values, value_position(i), 1));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto result, builder->Finish());
+    out->value = result->data();
+    return Status::OK();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto validity, ctx->AllocateBitmap(length));
+  uint8_t* out_validity = validity->mutable_data();
+  std::shared_ptr<Buffer> out_values;
+  int64_t null_count = 0;
+  const int bit_width = value_type->bit_width();
+  if (bit_width == 1) {
+    ARROW_ASSIGN_OR_RAISE(out_values, ctx->AllocateBitmap(length));
+    uint8_t* out_bits = out_values->mutable_data();
+    const uint8_t* in_bits = values.buffers[1].data;
+    for (int64_t i = 0; i < length; ++i) {
+      bool is_valid = list.IsValid(i);
+      bool value = false;
+      if (is_valid) {
+        const int64_t position = value_position(i);
+        is_valid = values.IsValid(position);
+        value = is_valid && bit_util::GetBit(in_bits, values.offset + position);
+      }
+      bit_util::SetBitTo(out_validity, i, is_valid);
+      bit_util::SetBitTo(out_bits, i, value);
+      null_count += !is_valid;
+    }
+  } else {
+    const int64_t byte_width = bit_width / 8;
+    ARROW_ASSIGN_OR_RAISE(out_values, ctx->Allocate(length * byte_width));
+    uint8_t* out_bytes = out_values->mutable_data();
+    switch (byte_width) {
+      case 1:
+        null_count = GatherFixedWidthValues<1>(list, values, byte_width, value_position,
+                                               out_validity, out_bytes);
+        break;
+      case 2:
+        null_count = GatherFixedWidthValues<2>(list, values, byte_width, value_position,
+                                               out_validity, out_bytes);
+        break;
+      case 4:
+        null_count = GatherFixedWidthValues<4>(list, values, byte_width, value_position,
+                                               out_validity, out_bytes);
+        break;
+      case 8:
+        null_count = GatherFixedWidthValues<8>(list, values, byte_width, value_position,
+                                               out_validity, out_bytes);
+        break;
+      default:
+        null_count = GatherFixedWidthValues<0>(list, values, byte_width, value_position,
+                                               out_validity, out_bytes);
+        break;
+    }
+  }
+  out->value = ArrayData::Make(value_type->GetSharedPtr(), length,
+                               {null_count > 0 ? std::move(validity) : nullptr,
+                                std::move(out_values)},
+                               null_count);
+  return Status::OK();
+}
+
 template <typename Type, typename IndexType>
 struct ListElement {
-  using ListArrayType = typename TypeTraits<Type>::ArrayType;
   using IndexScalarType = typename TypeTraits<IndexType>::ScalarType;
   using IndexValueType = typename IndexScalarType::ValueType;
   using offset_type = typename Type::offset_type;
 
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    constexpr bool kIsListView = is_list_view(Type::type_id);
     const ArraySpan& list = batch[0].array;
-    const ArraySpan& list_values = list.child_data[0];
     const offset_type* offsets = list.GetValues<offset_type>(1);
+    const offset_type* sizes = nullptr;
+    if constexpr (kIsListView) {
+      sizes = list.GetValues<offset_type>(2);
+    }
 
     IndexValueType index = 0;
     RETURN_NOT_OK(GetListElementIndex<IndexScalarType>(batch[1], &index));
 
-    std::unique_ptr<ArrayBuilder> builder;
-
-    const Type* list_type = checked_cast<const Type*>(list.type);
-    RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), list_type->value_type(), &builder));
-    RETURN_NOT_OK(builder->Reserve(list.length));
-    for (int i = 0; i < list.length; ++i) {
+    for (int64_t i = 0; i < list.length; ++i) {
       if (list.IsNull(i)) {
-        RETURN_NOT_OK(builder->AppendNull());
         continue;
       }
-
-      const offset_type value_offset = offsets[i];
-      const offset_type value_length = offsets[i + 1] - offsets[i];
+      const offset_type value_length =
+          kIsListView ? sizes[i] : offsets[i + 1] - offsets[i];
       if (ARROW_PREDICT_FALSE(index >=
                               static_cast<typename IndexType::c_type>(value_length))) {
         return Status::Invalid("Index ", index, " is out of bounds: should be in [0, ",
                                value_length, ")");
       }
-      RETURN_NOT_OK(builder->AppendArraySlice(list_values, value_offset + index, 1));
     }
-    ARROW_ASSIGN_OR_RAISE(auto result, builder->Finish());
-    out->value = result->data();
-    return Status::OK();
+    return GatherListElements(
+        ctx, list,
+        [&](int64_t i) {
+          return static_cast<int64_t>(offsets[i]) + static_cast<int64_t>(index);
+        },
+        out);
   }
 };
 
@@ -472,34 +640,22 @@ struct FixedSizeListElement {
   using IndexValueType = typename IndexScalarType::ValueType;
 
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-    auto item_size = checked_cast<const FixedSizeListType&>(*batch[0].type()).list_size();
+    const int64_t item_size =
+        checked_cast<const FixedSizeListType&>(*batch[0].type()).list_size();
     const ArraySpan& list = batch[0].array;
-    const ArraySpan& list_values = list.child_data[0];
 
     IndexValueType index = 0;
     RETURN_NOT_OK(GetListElementIndex<IndexScalarType>(batch[1], &index));
 
-    std::unique_ptr<ArrayBuilder> builder;
-
-    const Type* list_type = checked_cast<const Type*>(list.type);
-    RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), list_type->value_type(), &builder));
-    RETURN_NOT_OK(builder->Reserve(list.length));
-    for (int i = 0; i < list.length; ++i) {
-      if (list.IsNull(i)) {
-        RETURN_NOT_OK(builder->AppendNull());
-        continue;
-      }
-      if (ARROW_PREDICT_FALSE(index >=
-                              static_cast<typename IndexType::c_type>(item_size))) {
-        return Status::Invalid("Index ", index, " is out of bounds: should be in [0, ",
-                               item_size, ")");
-      }
-      RETURN_NOT_OK(builder->AppendArraySlice(list_values,
-                                              (list.offset + i) * item_size + index, 1));
+    if (ARROW_PREDICT_FALSE(
+            list.GetNullCount() < list.length &&
+            index >= static_cast<typename IndexType::c_type>(item_size))) {
+      return Status::Invalid("Index ", index, " is out of bounds: should be in [0, ",
+                             item_size, ")");
     }
-    ARROW_ASSIGN_OR_RAISE(auto result, builder->Finish());
-    out->value = result->data();
-    return Status::OK();
+    const int64_t base_position = list.offset * item_size + static_cast<int64_t>(index);
+    return GatherListElements(
+        ctx, list, [&](int64_t i) { return base_position + i * item_size; }, out);
   }
 };
 
@@ -731,42 +887,43 @@ const FunctionDoc make_struct_doc{"Wrap Arrays into a StructArray",
 template <typename KeyType>
 struct MapLookupFunctor {
   using UnboxedKey = typename UnboxScalar<KeyType>::T;
-  static Result<int64_t> GetOneMatchingIndex(const ArraySpan& keys, UnboxedKey query_key,
-                                             const bool use_last) {
-    int64_t match_index = -1;
-    RETURN_NOT_OK(FindMatchingIndices(keys, query_key, [&](int64_t index) -> Status {
-      match_index = index;
-      if (use_last) {
-        return Status::OK();
-      } else {
-        // If use_last is false, then this will abort the loop
-        return Status::Cancelled("Found match, short-circuiting");
-      }
-    }));
-    return match_index;
-  }
-
-  template <typename FoundItem>
-  static Status FindMatchingIndices(const ArraySpan& keys, UnboxedKey query_key,
-                                    FoundItem callback) {
-    int64_t index = 0;
-    Status status = VisitArrayValuesInline<KeyType>(
-        keys,
-        [&](UnboxedKey key) -> Status {
-          if (key == query_key) {
-            return callback(index++);
-          }
-          ++index;
-          return Status::OK();
-        },
-        [&]() -> Status {
-          ++index;
-          return Status::OK();
-        });
-    if (!status.ok() && !status.IsCancelled()) {
-      return status;
+
+  // Compares all the keys against the query key in a single pass, and returns a
+  // bitmap of the matching keys
+  static Result<std::shared_ptr<Buffer>> MatchKeys(KernelContext* ctx,
+                                                   const ArraySpan& keys,
+                                                   const UnboxedKey& query_key) {
+    ARROW_ASSIGN_OR_RAISE(auto matches, ctx->AllocateBitmap(keys.length));
+    uint8_t* match_bits = matches->mutable_data();
+    if constexpr (is_base_binary_type<KeyType>::value) {
+      using offset_type = typename KeyType::offset_type;
+      const offset_type* offsets = keys.GetValues<offset_type>(1);
+      const uint8_t* data = keys.buffers[2].data;
+      const auto query_length = static_cast<offset_type>(query_key.size());
+      int64_t i = 0;
+      ::arrow::internal::GenerateBitsUnrolled(match_bits, 0, keys.length, [&] {
+        const offset_type key_offset = offsets[i];
+        const offset_type key_length = offsets[i + 1] - key_offset;
+        ++i;
+        // Most keys differ in length from the query key, skip the memcmp for those
+        return key_length == query_length &&
+               std::memcmp(data + key_offset, query_key.data(), query_length) == 0;
+      });
+    } else if constexpr (is_boolean_type<KeyType>::value ||
+                         is_fixed_size_binary_type<KeyType>::value) {
+      ArrayIterator<KeyType> key_it(keys);
+      ::arrow::internal::GenerateBitsUnrolled(match_bits, 0, keys.length,
+                                              [&] { return key_it() == query_key; });
+    } else {
+      const UnboxedKey* key_values = keys.GetValues<UnboxedKey>(1);
+      ::arrow::internal::GenerateBitsUnrolled(
+          match_bits, 0, keys.length, [&] { return *key_values++ == query_key; });
     }
-    return Status::OK();
+    if (keys.GetNullCount() > 0) {
+      ::arrow::internal::BitmapAnd(match_bits, 0, keys.buffers[0].data, keys.offset,
+                                   keys.length, 0, match_bits);
+    }
+    return matches;
   }
 
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
@@ -777,78 +934,89 @@ struct MapLookupFunctor {
     const int32_t* offsets = map.GetValues<int32_t>(1);
 
     // The struct holding the keys and values may have an offset
-    int64_t kv_offset = map.child_data[0].offset;
+    const int64_t kv_offset = map.child_data[0].offset;
 
-    // We create a copy of the keys array because we will adjust the
-    // offset and length for the map probes below
+    // Only look at the keys referenced by this span of maps
+    const int32_t first_offset = map.length > 0 ? offsets[0] : 0;
+    const int32_t end_offset = map.length > 0 ? offsets[map.length] : 0;
+    const int64_t first_key = kv_offset + first_offset;
     ArraySpan map_keys = map.child_data[0].child_data[0];
-    const ArraySpan& map_items = map.child_data[0].child_data[1];
+    map_keys.SetSlice(map_keys.offset + first_key, end_offset - first_offset);
+    ARROW_ASSIGN_OR_RAISE(auto matches, MatchKeys(ctx, map_keys, query_key));
+    const uint8_t* match_bits = matches->data();
 
+    // The matching items are gathered with a single take
     std::shared_ptr<DataType> item_type =
         checked_cast<const MapType*>(map.type)->item_type();
+    std::shared_ptr<ArrayData> map_items =
+        map.child_data[0].child_data[1].ToArrayData()->Slice(first_key,
+                                                              map_keys.length);
+    Int64Builder indices_builder(ctx->memory_pool());
 
-    std::unique_ptr<ArrayBuilder> builder;
     if (options.occurrence == MapLookupOptions::Occurrence::ALL) {
-      RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), list(item_type), &builder));
-      auto list_builder = checked_cast<ListBuilder*>(builder.get());
-      auto value_builder = list_builder->value_builder();
-
+      ARROW_ASSIGN_OR_RAISE(auto list_offsets,
+                            ctx->Allocate((map.length + 1) * sizeof(int32_t)));
+      ARROW_ASSIGN_OR_RAISE(auto list_validity, ctx->AllocateBitmap(map.length));
+      auto* out_offsets = list_offsets->mutable_data_as<int32_t>();
+      uint8_t* out_validity = list_validity->mutable_data();
+      int64_t null_count = 0;
+      out_offsets[0] = 0;
       for (int64_t map_index = 0; map_index < map.length; ++map_index) {
-        if (!map.IsValid(map_index)) {
-          RETURN_NOT_OK(list_builder->AppendNull());
-          continue;
-        }
-
-        const int64_t item_offset = offsets[map_index] + kv_offset;
-        const int32_t item_size = offsets[map_index + 1] - offsets[map_index];
-
-        // Adjust the keys view to just the map slot that we are about to search
-        map_keys.SetSlice(item_offset, item_size);
-
-        bool found_at_least_one_key = false;
-        RETURN_NOT_OK(FindMatchingIndices(map_keys, query_key, [&](int64_t key_index) {
-          if (!found_at_least_one_key) {
-            RETURN_NOT_OK(list_builder->Append(true));
+        const int64_t num_found = indices_builder.length();
+        if (map.IsValid(map_index)) {
+          const int64_t begin = offsets[map_index] - first_offset;
+          ::arrow::internal::SetBitRunReader reader(match_bits, begin,
+                                                    offsets[map_index + 1] -
+                                                        offsets[map_index]);
+          for (auto run = reader.NextRun(); run.length > 0; run = reader.NextRun()) {
+            for (int64_t j = 0; j < run.length; ++j) {
+              RETURN_NOT_OK(indices_builder.Append(begin + run.position + j));
+            }
           }
-          found_at_least_one_key = true;
-          return value_builder->AppendArraySlice(map_items, item_offset + key_index, 1);
-        }));
-        if (!found_at_least_one_key) {
-          // Key was not found in this map element, so we append a null list
-          RETURN_NOT_OK(list_builder->AppendNull());
         }
+        // Maps without the key give a null list
+        const bool found = indices_builder.length() > num_found;
+        bit_util::SetBitTo(out_validity, map_index, found);
+        null_count += !found;
+        out_offsets[map_index + 1] = static_cast<int32_t>(indices_builder.length());
       }
-      ARROW_ASSIGN_OR_RAISE(auto result, list_builder->Finish());
-      out->value = std::move(result->data());
+      ARROW_ASSIGN_OR_RAISE(auto indices, indices_builder.Finish());
+      ARROW_ASSIGN_OR_RAISE(Datum values,
+                            Take(map_items, indices, TakeOptions::NoBoundsCheck(),
+                                 ctx->exec_context()));
+      out->value = ArrayData::Make(
+          list(item_type), map.length,
+          {null_count > 0 ? std::move(list_validity) : nullptr, std::move(list_offsets)},
+          {values.array()}, null_count);
     } else { /* occurrence == FIRST || LAST */
-      RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), item_type, &builder));
-      RETURN_NOT_OK(builder->Reserve(batch.length));
+      const bool use_last = options.occurrence == MapLookupOptions::LAST;
+      RETURN_NOT_OK(indices_builder.Reserve(map.length));
       for (int64_t map_index = 0; map_index < map.length; ++map_index) {
         if (!map.IsValid(map_index)) {
-          RETURN_NOT_OK(builder->AppendNull());
+          indices_builder.UnsafeAppendNull();
           continue;
         }
-
-        const int64_t item_offset = offsets[map_index] + kv_offset;
-        const int32_t item_size = offsets[map_index + 1] - offsets[map_index];
-
-        // Adjust the keys view to just the map slot that we are about to search
-        map_keys.SetSlice(item_offset, item_size);
-
-        ARROW_ASSIGN_OR_RAISE(
-            int64_t item_index,
-            GetOneMatchingIndex(map_keys, query_key,
-                                options.occurrence == MapLookupOptions::LAST));
-
-        if (item_index != -1) {
-          RETURN_NOT_OK(
-              builder->AppendArraySlice(map_items, item_offset + item_index, 1));
+        const int64_t begin = offsets[map_index] - first_offset;
+        const int64_t length = offsets[map_index + 1] - offsets[map_index];
+        ::arrow::internal::SetBitRun run;
+        if (use_last) {
+          run = ::arrow::internal::ReverseSetBitRunReader(match_bits, begin, length)
+                    .NextRun();
+          run.position += run.length - 1;
+        } else {
+          run = ::arrow::internal::SetBitRunReader(match_bits, begin, length).NextRun();
+        }
+        if (run.length > 0) {
+          indices_builder.UnsafeAppend(begin + run.position);
         } else {
-          RETURN_NOT_OK(builder->AppendNull());
+          indices_builder.UnsafeAppendNull();
         }
       }
-      ARROW_ASSIGN_OR_RAISE(auto result, builder->Finish());
-      out->value = std::move(result->data());
+      ARROW_ASSIGN_OR_RAISE(auto indices, indices_builder.Finish());
+      ARROW_ASSIGN_OR_RAISE(Datum values,
+                            Take(map_items, indices, TakeOptions::NoBoundsCheck(),
+                                 ctx->exec_context()));
+      out->value = values.array();
     }
     return Status::OK();
   }
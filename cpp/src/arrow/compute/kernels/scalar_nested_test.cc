@@ -128,6 +128,66 @@ TEST(TestScalarNested, ListElementInvalid) {
               Raises(StatusCode::Invalid));
 }
 
+TEST(TestScalarNested, ListElementOutOfOrderListViews) {
+  // [[3, 4], null, [0, null], [null, 1, 3]], views are not in value order
+  auto offsets = ArrayFromJSON(int32(), "[3, 0, 0, 1]");
+  auto sizes = ArrayFromJSON(int32(), "[2, 0, 2, 3]");
+  auto values = ArrayFromJSON(int64(), "[0, null, 1, 3, 4]");
+  auto validity =
+      ArrayFromJSON(boolean(), "[true, false, true, true]")->data()->buffers[1];
+  ASSERT_OK_AND_ASSIGN(auto input, ListViewArray::FromArrays(*offsets, *sizes, *values,
+                                                             default_memory_pool(),
+                                                             validity, /*null_count=*/1));
+  auto index = ScalarFromJSON(int32(), "1");
+  CheckScalar("list_element", {input, index},
+              ArrayFromJSON(int64(), "[4, null, null, 1]"));
+  CheckScalar("list_element", {input->Slice(2), index},
+              ArrayFromJSON(int64(), "[null, 1]"));
+
+  index = ScalarFromJSON(int32(), "2");
+  EXPECT_THAT(CallFunction("list_element", {input, index}), Raises(StatusCode::Invalid));
+  CheckScalar("list_element", {input->Slice(3), index}, ArrayFromJSON(int64(), "[3]"));
+}
+
+TEST(TestScalarNested, ListElementValueTypes) {
+  struct Case {
+    std::shared_ptr<DataType> type;
+    std::string values;
+    std::string expected;
+  };
+  const std::vector<Case> cases = {
+      {boolean(), "[true, false, null, true, true, false]", "[false, true, null]"},
+      {fixed_size_binary(3), R"(["abc", "def", "ghi", null, "jkl", "mno"])",
+       R"(["def", null, null])"},
+      {decimal128(5, 2), R"(["1.00", "2.00", null, "3.00", "4.00", "5.00"])",
+       R"(["2.00", "3.00", null])"},
+      {month_day_nano_interval(),
+       "[[1, 1, 1], [2, 2, 2], null, [3, 3, 3], [4, 4, 4], [5, 5, 5]]",
+       "[[2, 2, 2], [3, 3, 3], null]"},
+      {utf8(), R"(["a", "bc", null, "def", "", "gh"])", R"(["bc", "def", null])"},
+  };
+  auto index = ScalarFromJSON(int8(), "1");
+  for (const auto& c : cases) {
+    ARROW_SCOPED_TRACE("value type = ", *c.type);
+    auto values = ArrayFromJSON(c.type, c.values);
+    auto expected = ArrayFromJSON(c.type, c.expected);
+    // Three lists of two values, the last of which is null
+    auto validity = ArrayFromJSON(boolean(), "[true, true, false]")->data()->buffers[1];
+    auto fixed_size = std::make_shared<FixedSizeListArray>(
+        fixed_size_list(c.type, 2), 3, values, validity, /*null_count=*/1);
+    ASSERT_OK_AND_ASSIGN(
+        auto var_size,
+        ListArray::FromArrays(*ArrayFromJSON(int32(), "[0, 2, 4, 6]"), *values,
+                              default_memory_pool(), validity, /*null_count=*/1));
+    for (const std::shared_ptr<Array>& input :
+         {std::static_pointer_cast<Array>(fixed_size),
+          std::static_pointer_cast<Array>(var_size)}) {
+      CheckScalar("list_element", {input, index}, expected);
+      CheckScalar("list_element", {input->Slice(1), index}, expected->Slice(1));
+    }
+  }
+}
+
 using VarLenListLikeTypeFactory =
     std::shared_ptr<DataType> (*)(std::shared_ptr<DataType>);
 static const VarLenListLikeTypeFactory kVarLenListTypeFactories[] = {
@@ -290,6 +350,32 @@ TEST(TestScalarNested, ListSliceChildArrayOffset) {
   CheckScalarUnary("list_slice", input, expected, &args);
 }
 
+TEST(TestScalarNested, ListSliceListViewSharesValues) {
+  const VarLenListLikeTypeFactory kListViewTypeFactories[] = {list_view,
+                                                              large_list_view};
+  for (auto list_type_factory : kListViewTypeFactories) {
+    auto input = ArrayFromJSON(list_type_factory(int16()),
+                               "[[1, 2, 3], null, [4, 5], [], [6, null, 7, 8]]");
+    ListSliceOptions args(/*start=*/1, /*stop=*/3, /*step=*/1);
+    auto expected =
+        ArrayFromJSON(list_type_factory(int16()), "[[2, 3], null, [5], [], [null, 7]]");
+    CheckScalarUnary("list_slice", input, expected, &args);
+
+    ASSERT_OK_AND_ASSIGN(Datum out,
+                         CallFunction("list_slice", {Datum(input->Slice(1))}, &args));
+    AssertArraysEqual(*expected->Slice(1), *out.make_array(), /*verbose=*/true);
+    ASSERT_EQ(out.array()->child_data[0]->buffers[1]->data(),
+              input->data()->child_data[0]->buffers[1]->data());
+
+    // Strided slices still copy
+    args.step = 2;
+    args.stop = std::nullopt;
+    expected =
+        ArrayFromJSON(list_type_factory(int16()), "[[2], null, [5], [], [null, 8]]");
+    CheckScalarUnary("list_slice", input, expected, &args);
+  }
+}
+
 TEST(TestScalarNested, ListSliceOutputEqualsInputType) {
   const char* kVarLenListJSON = "[[1, 2, 3], [4, 5], [6, null], null]";
   const char* kFixedLenListJSON = "[[1, 2], [4, 5], [6, null], null]";
@@ -638,6 +724,32 @@ TEST_F(TestMapLookupKernel, FixedSizeBinary) {
                                      expected_first, expected_last);
 }
 
+TEST_F(TestMapLookupKernel, SlicedStringMaps) {
+  auto map_type = map(utf8(), utf8());
+  auto map_array = ArrayFromJSON(map_type, R"([
+    [["host", "a"], ["port", "1"]],
+    [["hostname", "b"], ["hosts", "c"], ["host", "d"], ["host", "e"]],
+    null,
+    [["hos", "f"], ["tsoh", "g"]],
+    [],
+    [["host", "h"]]
+  ])");
+  auto query_key = ScalarFromJSON(utf8(), R"("host")");
+  CheckMapLookupWithDifferentOptions(
+      map_array, query_key,
+      ArrayFromJSON(list(utf8()), R"([["a"], ["d", "e"], null, null, null, ["h"]])"),
+      ArrayFromJSON(utf8(), R"(["a", "d", null, null, null, "h"])"),
+      ArrayFromJSON(utf8(), R"(["a", "e", null, null, null, "h"])"));
+  CheckMapLookupWithDifferentOptions(
+      map_array->Slice(1, 4), query_key,
+      ArrayFromJSON(list(utf8()), R"([["d", "e"], null, null, null])"),
+      ArrayFromJSON(utf8(), R"(["d", null, null, null])"),
+      ArrayFromJSON(utf8(), R"(["e", null, null, null])"));
+  CheckMapLookupWithDifferentOptions(
+      map_array->Slice(4, 0), query_key, ArrayFromJSON(list(utf8()), "[]"),
+      ArrayFromJSON(utf8(), "[]"), ArrayFromJSON(utf8(), "[]"));
+}
+
 TEST_F(TestMapLookupKernel, Errors) {
   auto map_type = map(int32(), utf8());
   const char* input = R"(
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <random>
@@ -48,7 +49,31 @@ double generate_uniform(random::pcg64_oneseq* rng) {
   return ((*rng)() >> 11) * (1.0 / 9007199254740992.0);
 }
 
-using RandomState = OptionsWrapper<RandomOptions>;
+// The state of a random kernel.  With a seed, the generated numbers are the
+// successive outputs of a single generator: each execution seeks a generator to
+// the position it reserves in that stream.  Executions on several chunks of a
+// batch, or on several threads sharing the kernel state, therefore produce
+// non-overlapping parts of the same stream.
+struct RandomState : public KernelState {
+  explicit RandomState(RandomOptions options) : options(std::move(options)) {}
+
+  static Result<std::unique_ptr<KernelState>> Init(KernelContext* ctx,
+                                                   const KernelInitArgs& args) {
+    if (auto options = static_cast<const RandomOptions*>(args.options)) {
+      return std::make_unique<RandomState>(*options);
+    }
+    return Status::Invalid(
+        "Attempted to initialize KernelState from null FunctionOptions");
+  }
+
+  // Reserve `length` numbers of the stream, returning the position of the first
+  uint64_t Reserve(int64_t length) {
+    return next_position.fetch_add(static_cast<uint64_t>(length));
+  }
+
+  RandomOptions options;
+  std::atomic<uint64_t> next_position{0};
+};
 
 random::pcg64_oneseq MakeSeedGenerator() {
   arrow_vendored::pcg_extras::seed_seq_from<std::random_device> seed_source;
@@ -61,10 +86,13 @@ Status ExecRandom(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
   static std::mutex seed_gen_mutex;
 
   random::pcg64_oneseq gen;
-  const RandomOptions& options = RandomState::Get(ctx);
+  auto state = checked_cast<RandomState*>(ctx->state());
+  const RandomOptions& options = state->options;
 
   if (options.initializer == RandomOptions::Seed) {
     gen.seed(options.seed);
+    // PCG generators advance by any distance in logarithmic time
+    gen.advance(state->Reserve(batch.length));
   } else {
     std::lock_guard<std::mutex> seed_gen_lock(seed_gen_mutex);
     gen.seed(seed_gen());
@@ -79,7 +107,9 @@ Status ExecRandom(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
 const FunctionDoc random_doc{
     "Generate numbers in the range [0, 1)",
     ("Generated values are uniformly-distributed, double-precision in range [0, 1).\n"
-     "Algorithm and seed can be changed via RandomOptions."),
+     "Algorithm and seed can be changed via RandomOptions.\n"
+     "With a seed, all the values generated for an expression come from a\n"
+     "single deterministic stream, even if it is executed in several batches."),
     {},
     "RandomOptions"};
 
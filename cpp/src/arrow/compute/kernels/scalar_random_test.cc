@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "arrow/compute/api.h"
@@ -81,6 +84,54 @@ TEST(TestRandom, SeedIsDeterministic) {
   AssertDatumsEqual(first_call, second_call);
 }
 
+TEST(TestRandom, SeedIsContinuousAcrossChunks) {
+  const int kCount = 100;
+  auto random_options = RandomOptions::FromSeed(/*seed=*/0);
+
+  ExecBatch input({}, kCount);
+  ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction("random", input, &random_options));
+  ExecContext chunked_ctx;
+  chunked_ctx.set_exec_chunksize(7);
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       CallFunction("random", input, &random_options, &chunked_ctx));
+  AssertDatumsEqual(expected, actual);
+}
+
+TEST(TestRandom, SeedWithSharedStateMultiThreaded) {
+  const int kCount = 100;
+  const int kThreadCount = 8;
+  const int kCallCount = 50;
+
+  // Concurrent executions of a bound expression take distinct parts of the stream
+  // of its seed
+  auto random_options = RandomOptions::FromSeed(/*seed=*/42);
+  ASSERT_OK_AND_ASSIGN(auto expr,
+                       call("random", {}, random_options).Bind(*schema({})));
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(kThreadCount));
+  ExecBatch input({}, kCount);
+  std::vector<Future<Datum>> futures;
+  for (int i = 0; i < kCallCount; ++i) {
+    futures.push_back(
+        DeferNotOk(pool->Submit([&]() { return ExecuteScalarExpression(expr, input); })));
+  }
+  std::vector<double> actual;
+  for (int i = 0; i < kCallCount; ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum result, futures[i].result());
+    const auto& values = *result.array();
+    actual.insert(actual.end(), values.GetValues<double>(1),
+                  values.GetValues<double>(1) + values.length);
+  }
+
+  ExecBatch all_input({}, kCount * kCallCount);
+  ASSERT_OK_AND_ASSIGN(Datum all, CallFunction("random", all_input, &random_options));
+  const auto& all_values = *all.array();
+  std::vector<double> expected(all_values.GetValues<double>(1),
+                               all_values.GetValues<double>(1) + all_values.length);
+  std::sort(actual.begin(), actual.end());
+  std::sort(expected.begin(), expected.end());
+  ASSERT_EQ(actual, expected);
+}
+
 TEST(TestRandom, SystemRandomDifferentResultsSingleThreaded) {
   const int kCount = 100;
   auto random_options = RandomOptions::FromSystemRandom();
@@ -15,11 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <mutex>
+
 #include "arrow/array/array_base.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/common_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
+#include "arrow/compute/row/grouper.h"
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_writer.h"
@@ -138,6 +141,92 @@ struct SetLookupState<NullType> : public SetLookupStateBase {
   SetLookupOptions::NullMatchingBehavior null_matching_behavior;
 };
 
+// Struct values are looked up as composite keys made of their fields: the fields of
+// the value set are consumed once by a Grouper (which hashes them in a Swiss table
+// for most field types), and the fields of the input are then looked up in it.
+// Nulls in fields are matched like any other field value, only null structs follow
+// the null matching behavior.
+template <>
+struct SetLookupState<StructType> : public SetLookupStateBase {
+  explicit SetLookupState(MemoryPool* pool) : exec_context(pool) {}
+
+  // The fields of a struct array as a batch of keys
+  static ExecBatch FieldsBatch(const ArraySpan& data) {
+    std::vector<Datum> fields;
+    for (const auto& child : data.child_data) {
+      ArraySpan field = child;
+      field.SetSlice(child.offset + data.offset, data.length);
+      fields.emplace_back(field.ToArrayData());
+    }
+    return ExecBatch(std::move(fields), data.length);
+  }
+
+  Status Init(const SetLookupOptions& options) {
+    null_matching_behavior = options.GetNullMatchingBehavior();
+    value_set_type = options.value_set.type();
+    std::vector<TypeHolder> field_types;
+    for (const auto& field : value_set_type->fields()) {
+      field_types.emplace_back(field->type());
+    }
+    ARROW_ASSIGN_OR_RAISE(grouper, Grouper::Make(field_types, &exec_context));
+
+    ArrayVector chunks;
+    if (options.value_set.is_array()) {
+      chunks.push_back(options.value_set.make_array());
+    } else if (options.value_set.kind() == Datum::CHUNKED_ARRAY) {
+      chunks = options.value_set.chunked_array()->chunks();
+    } else {
+      return Status::Invalid("value_set should be an array or chunked array");
+    }
+    int32_t index = 0;
+    for (const auto& chunk : chunks) {
+      const ArraySpan data(*chunk->data());
+      const ExecBatch fields = FieldsBatch(data);
+      ARROW_ASSIGN_OR_RAISE(Datum group_ids, grouper->Consume(ExecSpan(fields)));
+      const uint32_t* ids = group_ids.array()->GetValues<uint32_t>(1);
+      group_value_index.resize(grouper->num_groups(), -1);
+      for (int64_t i = 0; i < data.length; ++i, ++index) {
+        if (!data.IsValid(i)) {
+          if (null_index == -1 && null_matching_behavior != SetLookupOptions::SKIP) {
+            null_index = index;
+          }
+        } else if (group_value_index[ids[i]] == -1) {
+          group_value_index[ids[i]] = index;
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  // The index in the value set of each input struct, -1 if it is null or not found
+  Result<std::vector<int32_t>> Lookup(const ArraySpan& input) const {
+    const ExecBatch fields = FieldsBatch(input);
+    Datum group_ids;
+    {
+      // The grouper uses temporary buffers for lookups
+      std::lock_guard<std::mutex> lock(grouper_mutex);
+      ARROW_ASSIGN_OR_RAISE(group_ids, grouper->Lookup(ExecSpan(fields)));
+    }
+    const ArrayData& ids = *group_ids.array();
+    const uint32_t* id_values = ids.GetValues<uint32_t>(1);
+    std::vector<int32_t> indices(input.length, -1);
+    for (int64_t i = 0; i < input.length; ++i) {
+      if (input.IsValid(i) && ids.IsValid(i)) {
+        indices[i] = group_value_index[id_values[i]];
+      }
+    }
+    return indices;
+  }
+
+  ExecContext exec_context;
+  std::unique_ptr<Grouper> grouper;
+  mutable std::mutex grouper_mutex;
+  // The index in the value set of the first valid struct of each group
+  std::vector<int32_t> group_value_index;
+  int32_t null_index = -1;
+  SetLookupOptions::NullMatchingBehavior null_matching_behavior;
+};
+
 // TODO: Put this concept somewhere reusable
 template <int width>
 struct UnsignedIntType;
@@ -208,6 +297,8 @@ struct InitStateVisitor {
     return Init<MonthDayNanoIntervalType>();
   }
 
+  Status Visit(const StructType& type) { return Init<StructType>(); }
+
   Result<std::unique_ptr<KernelState>> GetResult() {
     if (arg_type.id() == Type::TIMESTAMP &&
         options.value_set.type()->id() == Type::TIMESTAMP) {
@@ -382,6 +473,21 @@ struct IndexInVisitor {
     return ProcessIndexIn<MonthDayNanoIntervalType>();
   }
 
+  Status ProcessIndexIn(const SetLookupState<StructType>& state, const ArraySpan& input) {
+    ARROW_ASSIGN_OR_RAISE(auto indices, state.Lookup(input));
+    const int32_t null_index =
+        state.null_matching_behavior == SetLookupOptions::MATCH ? state.null_index : -1;
+    int32_t* out_data = out->GetValues<int32_t>(1);
+    for (int64_t i = 0; i < input.length; ++i) {
+      const int32_t index = input.IsValid(i) ? indices[i] : null_index;
+      bit_util::SetBitTo(out_bitmap, out->offset + i, index != -1);
+      out_data[i] = index != -1 ? index : 0;
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const StructType& type) { return ProcessIndexIn<StructType>(); }
+
   Status Execute() {
     const auto& state = checked_cast<const SetLookupStateBase&>(*ctx->state());
     return VisitTypeInline(*state.value_set_type, this);
@@ -523,6 +629,28 @@ struct IsInVisitor {
     return ProcessIsIn<MonthDayNanoIntervalType>();
   }
 
+  Status ProcessIsIn(const SetLookupState<StructType>& state, const ArraySpan& input) {
+    ARROW_ASSIGN_OR_RAISE(auto indices, state.Lookup(input));
+    const bool value_set_has_null = state.null_index != -1;
+    for (int64_t i = 0; i < input.length; ++i) {
+      bool is_in = false, is_valid = true;
+      if (input.IsValid(i)) {
+        is_in = indices[i] != -1;
+        is_valid = is_in || !value_set_has_null ||
+                   state.null_matching_behavior != SetLookupOptions::INCONCLUSIVE;
+      } else if (state.null_matching_behavior == SetLookupOptions::MATCH) {
+        is_in = value_set_has_null;
+      } else {
+        is_valid = state.null_matching_behavior == SetLookupOptions::SKIP;
+      }
+      bit_util::SetBitTo(out_boolean_bitmap, out->offset + i, is_in);
+      bit_util::SetBitTo(out_null_bitmap, out->offset + i, is_valid);
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const StructType& type) { return ProcessIsIn<StructType>(); }
+
   Status Execute() {
     const auto& state = checked_cast<const SetLookupStateBase&>(*ctx->state());
     return VisitTypeInline(*state.value_set_type, this);
@@ -541,6 +669,7 @@ Status ExecIsIn(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
 // * Simple temporal types (date, time, timestamp)
 // * Base binary types
 // * Decimal
+// * Struct (looked up by its fields)
 
 void AddBasicSetLookupKernels(ScalarKernel kernel,
                               const std::shared_ptr<DataType>& out_ty,
@@ -559,7 +688,7 @@ void AddBasicSetLookupKernels(ScalarKernel kernel,
   AddKernels({month_day_nano_interval()});
 
   std::vector<Type::type> other_types = {Type::BOOL, Type::DECIMAL128, Type::DECIMAL256,
-                                         Type::FIXED_SIZE_BINARY};
+                                         Type::FIXED_SIZE_BINARY, Type::STRUCT};
   for (auto ty : other_types) {
     kernel.signature = KernelSignature::Make({ty}, out_ty);
     DCHECK_OK(func->AddKernel(kernel));
@@ -929,6 +929,37 @@ TEST_F(TestIsInKernel, DictionaryArray) {
   }
 }
 
+TEST_F(TestIsInKernel, Struct) {
+  auto type = struct_({field("a", int32()), field("b", utf8())});
+  const std::string input =
+      R"([[1, "x"], [1, "y"], null, [2, "x"], [null, "x"], [2, null], [1, "x"]])";
+
+  CheckIsIn(type, input, R"([[2, "x"], [1, "x"], [null, "x"]])",
+            "[true, false, false, true, true, false, true]");
+  CheckIsIn(type, input, R"([[2, "x"], null, [2, null]])",
+            "[false, false, true, true, false, true, false]");
+  CheckIsIn(type, input, R"([[2, "x"], null, [2, null]])",
+            "[false, false, false, true, false, true, false]",
+            /*null_matching_behavior=*/SetLookupOptions::SKIP);
+  CheckIsIn(type, input, R"([[2, "x"], null, [2, null]])",
+            "[false, false, null, true, false, true, false]",
+            /*null_matching_behavior=*/SetLookupOptions::EMIT_NULL);
+  CheckIsIn(type, input, R"([[2, "x"], null, [2, null]])",
+            "[null, null, null, true, null, true, null]",
+            /*null_matching_behavior=*/SetLookupOptions::INCONCLUSIVE);
+
+  // Sliced input and value set
+  auto sliced_input = ArrayFromJSON(type, input)->Slice(3);
+  auto sliced_value_set =
+      ArrayFromJSON(type, R"([[1, "x"], [2, "x"], [2, null]])")->Slice(1);
+  CheckIsIn(sliced_input, sliced_value_set, "[true, false, true, false]");
+
+  // Field types differing from the value set are cast
+  CheckIsIn(ArrayFromJSON(struct_({field("a", int8()), field("b", utf8())}), input),
+            ArrayFromJSON(type, R"([[1, "y"]])"),
+            "[false, true, false, false, false, false, false]");
+}
+
 TEST_F(TestIsInKernel, ChunkedArrayInvoke) {
   auto input = ChunkedArrayFromJSON(
       utf8(), {R"(["abc", "def", "", "abc", "jkl"])", R"(["def", null, "abc", "zzz"])"});
@@ -1652,6 +1683,29 @@ TEST_F(TestIndexInKernel, MonthDayNanoInterval) {
       /*null_matching_behavior=*/SetLookupOptions::MATCH);
 }
 
+TEST_F(TestIndexInKernel, Struct) {
+  auto type = struct_({field("a", int32()), field("b", utf8())});
+  const std::string input =
+      R"([[1, "x"], [1, "y"], null, [2, "x"], [null, "x"], [2, null], [1, "x"]])";
+
+  // Duplicates in value_set
+  CheckIndexIn(type, input, R"([[2, "x"], [1, "x"], [2, "x"], [null, "x"], [1, "x"]])",
+               "[1, null, null, 0, 3, null, 1]");
+  CheckIndexIn(type, input, R"([[2, null], null, [1, "y"], null])",
+               "[null, 2, 1, null, null, 0, null]");
+  CheckIndexIn(type, input, R"([[2, null], null, [1, "y"], null])",
+               "[null, 2, null, null, null, 0, null]",
+               /*null_matching_behavior=*/SetLookupOptions::SKIP);
+
+  // Chunked value set
+  SetLookupOptions options(ChunkedArrayFromJSON(
+      type, {R"([[1, "y"], null])", "[]", R"([[1, "x"], [1, "y"]])"}));
+  ASSERT_OK_AND_ASSIGN(Datum actual, IndexIn(ArrayFromJSON(type, input), options));
+  ValidateOutput(actual);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, 0, 1, null, null, null, 2]"),
+                    *actual.make_array(), /*verbose=*/true);
+}
+
 TEST_F(TestIndexInKernel, Decimal) {
   for (const auto& type : {decimal128(2, 0), decimal256(2, 0)}) {
     CheckIndexIn(type,
@@ -17,13 +17,16 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/array/builder_nested.h"
 #include "arrow/compute/kernels/scalar_string_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/cache_internal.h"
 #include "arrow/util/config.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string.h"
@@ -77,6 +80,202 @@ template <typename T>
 RE2::Options MakeRE2Options(bool ignore_case = false, bool literal = false) {
   return MakeRE2Options(T::is_utf8, ignore_case, literal);
 }
+
+// Whether a regex atom followed by the quantifier at `pos` may occur zero times
+bool IsOptionalQuantifier(std::string_view pattern, size_t pos) {
+  return pos < pattern.size() &&
+         (pattern[pos] == '?' || pattern[pos] == '*' ||
+          (pattern[pos] == '{' && pos + 1 < pattern.size() && pattern[pos + 1] == '0'));
+}
+
+// Return the longest literal which all matches of a case-sensitive regex contain,
+// or an empty string if none is found.
+//
+// This is a conservative scan of the pattern syntax rather than a full parse:
+// patterns with alternations, flags or escapes it doesn't know about are given up
+// on, and non-ASCII characters only break literals.
+std::string RequiredRegexLiteral(std::string_view pattern) {
+  const size_t n = pattern.size();
+  // Find the closing parenthesis of each group
+  std::vector<size_t> group_ends(n, std::string_view::npos);
+  std::vector<size_t> open_groups;
+  for (size_t i = 0; i < n; ++i) {
+    if (pattern[i] == '\\') {
+      ++i;
+    } else if (pattern[i] == '[') {
+      // Skip character classes, where a leading ']' is literal
+      i += (i + 1 < n && pattern[i + 1] == '^') ? 2 : 1;
+      if (i < n && pattern[i] == ']') ++i;
+      while (i < n && pattern[i] != ']') {
+        i += pattern[i] == '\\' ? 2 : 1;
+      }
+    } else if (pattern[i] == '(') {
+      open_groups.push_back(i);
+    } else if (pattern[i] == ')') {
+      if (open_groups.empty()) return "";
+      group_ends[open_groups.back()] = i;
+      open_groups.pop_back();
+    }
+  }
+  if (!open_groups.empty()) return "";
+
+  std::string longest, current;
+  // Whether the last atom is the last character of `current`
+  bool last_atom_is_literal = false;
+  auto end_literal = [&]() {
+    if (current.size() > longest.size()) {
+      longest = current;
+    }
+    current.clear();
+    last_atom_is_literal = false;
+  };
+  size_t i = 0;
+  while (i < n) {
+    const char c = pattern[i];
+    switch (c) {
+      case '|':
+        return "";
+      case '(': {
+        end_literal();
+        if (IsOptionalQuantifier(pattern, group_ends[i] + 1)) {
+          // The group may not occur at all, skip it
+          i = group_ends[i] + 1;
+          break;
+        }
+        ++i;
+        if (i < n && pattern[i] == '?') {
+          if (i + 1 < n && pattern[i + 1] == ':') {
+            i += 2;
+          } else if (i + 1 < n && (pattern[i + 1] == 'P' || pattern[i + 1] == '<')) {
+            // Named group
+            i = pattern.find('>', i);
+            if (i == std::string_view::npos) return "";
+            ++i;
+          } else {
+            // Flags, e.g. case insensitivity
+            return "";
+          }
+        }
+        break;
+      }
+      case '[': {
+        end_literal();
+        i += (i + 1 < n && pattern[i + 1] == '^') ? 2 : 1;
+        if (i < n && pattern[i] == ']') ++i;
+        while (i < n && pattern[i] != ']') {
+          i += pattern[i] == '\\' ? 2 : 1;
+        }
+        ++i;
+        break;
+      }
+      case '?':
+      case '*':
+        // The previous atom may not occur
+        if (last_atom_is_literal) {
+          current.pop_back();
+        }
+        end_literal();
+        ++i;
+        break;
+      case '{': {
+        size_t j = i + 1;
+        while (j < n && (std::isdigit(static_cast<unsigned char>(pattern[j])) ||
+                         pattern[j] == ',')) {
+          ++j;
+        }
+        if (j < n && pattern[j] == '}') {
+          // A repetition, the previous atom may not occur if the minimum is zero
+          if (last_atom_is_literal && IsOptionalQuantifier(pattern, i)) {
+            current.pop_back();
+          }
+          i = j + 1;
+        } else {
+          ++i;
+        }
+        end_literal();
+        break;
+      }
+      case '\\': {
+        if (i + 1 >= n) return "";
+        const char escaped = pattern[i + 1];
+        if (std::isalnum(static_cast<unsigned char>(escaped))) {
+          // Only single character classes, assertions and control characters
+          if (std::strchr("dDwWsSbBAzfnrtv", escaped) == nullptr) return "";
+          end_literal();
+        } else {
+          current.push_back(escaped);
+          last_atom_is_literal = true;
+        }
+        i += 2;
+        break;
+      }
+      default:
+        if (static_cast<unsigned char>(c) >= 0x80 || c == '.' || c == '^' || c == '$' ||
+            c == ')' || c == '+') {
+          end_literal();
+        } else {
+          current.push_back(c);
+          last_atom_is_literal = true;
+        }
+        ++i;
+    }
+  }
+  end_literal();
+  return longest;
+}
+
+// A compiled regex, along with a literal which all its matches contain
+struct CompiledRegex {
+  CompiledRegex(const std::string& pattern, const RE2::Options& options)
+      : regex(pattern, options) {
+    // The literal is searched for case-sensitively
+    if (options.case_sensitive()) {
+      required_literal = options.literal() ? pattern : RequiredRegexLiteral(pattern);
+    }
+    // Searching for a single character wouldn't rule out many strings
+    if (required_literal.size() < 2) {
+      required_literal.clear();
+    }
+  }
+
+  // Whether `s` may contain a match: if not, it can be ruled out without running
+  // the regex
+  bool MayMatch(std::string_view s) const {
+    return required_literal.empty() || s.find(required_literal) != std::string_view::npos;
+  }
+
+  const RE2 regex;
+  std::string required_literal;
+};
+
+// Return the compiled regex for the given pattern and options.
+//
+// The regexes are cached process-wide, so that they aren't recompiled for each
+// batch (RE2 objects can be used concurrently).
+Result<std::shared_ptr<const CompiledRegex>> GetCompiledRegex(const std::string& pattern,
+                                                              bool is_utf8,
+                                                              bool ignore_case = false,
+                                                              bool literal = false) {
+  using CompileResult = Result<std::shared_ptr<const CompiledRegex>>;
+  static constexpr int32_t kCacheCapacity = 128;
+  static auto compile = ::arrow::internal::MemoizeLru(
+      [](const std::string& key) -> CompileResult {
+        // See below for the key layout
+        const auto options = MakeRE2Options(key[0] == 'u', key[1] == 'i', key[2] == 'l');
+        auto compiled = std::make_shared<const CompiledRegex>(key.substr(3), options);
+        RETURN_NOT_OK(RegexStatus(compiled->regex));
+        return compiled;
+      },
+      kCacheCapacity);
+
+  std::string key;
+  key.reserve(pattern.size() + 3);
+  key += is_utf8 ? 'u' : 'b';
+  key += ignore_case ? 'i' : 'c';
+  key += literal ? 'l' : 'r';
+  key += pattern;
+  return compile(key);
+}
 #endif
 
 // ----------------------------------------------------------------------
@@ -716,17 +915,8 @@ static inline uint8_t ascii_toupper(uint8_t utf8_code_unit) {
                                                               : utf8_code_unit;
 }
 
-static inline uint8_t ascii_swapcase(uint8_t utf8_code_unit) {
-  if (IsLowerCaseCharacterAscii(utf8_code_unit)) {
-    utf8_code_unit -= 32;
-  } else if (IsUpperCaseCharacterAscii(utf8_code_unit)) {
-    utf8_code_unit += 32;
-  }
-  return utf8_code_unit;
-}
-
 void TransformAsciiUpper(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_toupper);
+  TransformAsciiCase<true, false>(input, length, output);
 }
 
 template <typename Type>
@@ -737,7 +927,7 @@ struct AsciiUpper {
 };
 
 void TransformAsciiLower(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_tolower);
+  TransformAsciiCase<false, true>(input, length, output);
 }
 
 template <typename Type>
@@ -748,7 +938,7 @@ struct AsciiLower {
 };
 
 void TransformAsciiSwapCase(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_swapcase);
+  TransformAsciiCase<true, true>(input, length, output);
 }
 
 template <typename Type>
@@ -889,6 +1079,11 @@ void AddAsciiStringLength(FunctionRegistry* registry) {
             ty);
     DCHECK_OK(func->AddKernel({ty}, int64(), std::move(exec)));
   }
+  for (const auto& ty : BinaryViewTypes()) {
+    auto exec = GenerateVarBinaryViewBase<applicator::ScalarUnaryNotNull, Int32Type,
+                                          BinaryLength>(ty);
+    DCHECK_OK(func->AddKernel({ty}, int32(), std::move(exec)));
+  }
   DCHECK_OK(func->AddKernel({InputType(Type::FIXED_SIZE_BINARY)}, int32(),
                             BinaryLength::FixedSizeExec));
   DCHECK_OK(registry->AddFunction(std::move(func)));
@@ -1312,35 +1507,55 @@ struct PlainEndsWithMatcher {
 
 #ifdef ARROW_WITH_RE2
 struct RegexSubstringMatcher {
-  const MatchSubstringOptions& options_;
-  const RE2 regex_match_;
+  std::shared_ptr<const CompiledRegex> regex_match_;
 
   static Result<std::unique_ptr<RegexSubstringMatcher>> Make(
       const MatchSubstringOptions& options, bool is_utf8 = true, bool literal = false) {
-    auto matcher = std::make_unique<RegexSubstringMatcher>(options, is_utf8, literal);
-    RETURN_NOT_OK(RegexStatus(matcher->regex_match_));
-    return matcher;
+    ARROW_ASSIGN_OR_RAISE(auto regex, GetCompiledRegex(options.pattern, is_utf8,
+                                                       options.ignore_case, literal));
+    return std::make_unique<RegexSubstringMatcher>(std::move(regex));
   }
 
-  explicit RegexSubstringMatcher(const MatchSubstringOptions& options,
-                                 bool is_utf8 = true, bool literal = false)
-      : options_(options),
-        regex_match_(options_.pattern,
-                     MakeRE2Options(is_utf8, options.ignore_case, literal)) {}
+  explicit RegexSubstringMatcher(std::shared_ptr<const CompiledRegex> regex)
+      : regex_match_(std::move(regex)) {}
 
   bool Match(std::string_view current) const {
     auto piece = re2::StringPiece(current.data(), current.length());
-    return RE2::PartialMatch(piece, regex_match_);
+    return regex_match_->MayMatch(current) &&
+           RE2::PartialMatch(piece, regex_match_->regex);
   }
 };
 #endif
 
 template <typename Type, typename Matcher>
 struct MatchSubstringImpl {
-  using offset_type = typename Type::offset_type;
-
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out,
                      const Matcher* matcher) {
+    if constexpr (is_binary_view_like_type<Type>::value) {
+      // Views are matched in place, without gathering their characters first
+      const ArraySpan& input = batch[0].array;
+      ArraySpan* out_arr = out->array_span_mutable();
+      FirstTimeBitmapWriter bitmap_writer(out_arr->buffers[1].data, out_arr->offset,
+                                          input.length);
+      VisitArraySpanInline<Type>(
+          input,
+          [&](std::string_view value) {
+            if (matcher->Match(value)) {
+              bitmap_writer.Set();
+            }
+            bitmap_writer.Next();
+          },
+          [&]() { bitmap_writer.Next(); });
+      bitmap_writer.Finish();
+      return Status::OK();
+    } else {
+      return ExecOffsets(ctx, batch, out, matcher);
+    }
+  }
+
+  static Status ExecOffsets(KernelContext* ctx, const ExecSpan& batch, ExecResult* out,
+                            const Matcher* matcher) {
+    using offset_type = typename Type::offset_type;
     StringBoolTransform<Type>(
         ctx, batch,
         [&matcher](const void* raw_offsets, const uint8_t* data, int64_t length,
@@ -1375,7 +1590,6 @@ struct MatchSubstring {
 template <typename Type>
 struct MatchSubstring<Type, RegexSubstringMatcher> {
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-    // TODO Cache matcher across invocations (for regex compilation)
     ARROW_ASSIGN_OR_RAISE(auto matcher,
                           RegexSubstringMatcher::Make(MatchSubstringState::Get(ctx),
                                                       /*is_utf8=*/Type::is_utf8));
@@ -1611,12 +1825,34 @@ const FunctionDoc match_like_doc(
     {"strings"}, "MatchSubstringOptions", /*options_required=*/true);
 #endif
 
+// The match kernels also accept binary views, which are matched without copying
+const std::vector<std::shared_ptr<DataType>>& MatchSubstringTypes() {
+  static const auto kTypes = [] {
+    auto types = BaseBinaryTypes();
+    types.insert(types.end(), BinaryViewTypes().begin(), BinaryViewTypes().end());
+    return types;
+  }();
+  return kTypes;
+}
+
+template <template <typename...> class Generator, typename... Args>
+ArrayKernelExec GenerateMatchSubstring(const DataType& ty) {
+  switch (ty.id()) {
+    case Type::BINARY_VIEW:
+      return Generator<BinaryViewType, Args...>::Exec;
+    case Type::STRING_VIEW:
+      return Generator<StringViewType, Args...>::Exec;
+    default:
+      return GenerateVarBinaryToVarBinary<Generator, Args...>(ty);
+  }
+}
+
 void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
   {
     auto func = std::make_shared<ScalarFunction>("match_substring", Arity::Unary(),
                                                  match_substring_doc);
-    for (const auto& ty : BaseBinaryTypes()) {
-      auto exec = GenerateVarBinaryToVarBinary<MatchSubstring, PlainSubstringMatcher>(ty);
+    for (const auto& ty : MatchSubstringTypes()) {
+      auto exec = GenerateMatchSubstring<MatchSubstring, PlainSubstringMatcher>(*ty);
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
@@ -1625,9 +1861,8 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
   {
     auto func =
         std::make_shared<ScalarFunction>("starts_with", Arity::Unary(), starts_with_doc);
-    for (const auto& ty : BaseBinaryTypes()) {
-      auto exec =
-          GenerateVarBinaryToVarBinary<MatchSubstring, PlainStartsWithMatcher>(ty);
+    for (const auto& ty : MatchSubstringTypes()) {
+      auto exec = GenerateMatchSubstring<MatchSubstring, PlainStartsWithMatcher>(*ty);
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
@@ -1636,8 +1871,8 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
   {
     auto func =
         std::make_shared<ScalarFunction>("ends_with", Arity::Unary(), ends_with_doc);
-    for (const auto& ty : BaseBinaryTypes()) {
-      auto exec = GenerateVarBinaryToVarBinary<MatchSubstring, PlainEndsWithMatcher>(ty);
+    for (const auto& ty : MatchSubstringTypes()) {
+      auto exec = GenerateMatchSubstring<MatchSubstring, PlainEndsWithMatcher>(*ty);
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
@@ -1647,8 +1882,8 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
   {
     auto func = std::make_shared<ScalarFunction>("match_substring_regex", Arity::Unary(),
                                                  match_substring_regex_doc);
-    for (const auto& ty : BaseBinaryTypes()) {
-      auto exec = GenerateVarBinaryToVarBinary<MatchSubstring, RegexSubstringMatcher>(ty);
+    for (const auto& ty : MatchSubstringTypes()) {
+      auto exec = GenerateMatchSubstring<MatchSubstring, RegexSubstringMatcher>(*ty);
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
@@ -1657,8 +1892,8 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
   {
     auto func =
         std::make_shared<ScalarFunction>("match_like", Arity::Unary(), match_like_doc);
-    for (const auto& ty : BaseBinaryTypes()) {
-      auto exec = GenerateVarBinaryToVarBinary<MatchLike>(ty);
+    for (const auto& ty : MatchSubstringTypes()) {
+      auto exec = GenerateMatchSubstring<MatchLike>(*ty);
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
@@ -1683,30 +1918,25 @@ struct FindSubstring {
 
 #ifdef ARROW_WITH_RE2
 struct FindSubstringRegex {
-  std::unique_ptr<RE2> regex_match_;
+  std::shared_ptr<const CompiledRegex> regex_match_;
 
   static Result<FindSubstringRegex> Make(const MatchSubstringOptions& options,
                                          bool is_utf8 = true, bool literal = false) {
-    auto matcher = FindSubstringRegex(options, is_utf8, literal);
-    RETURN_NOT_OK(RegexStatus(*matcher.regex_match_));
-    return matcher;
-  }
-
-  explicit FindSubstringRegex(const MatchSubstringOptions& options, bool is_utf8 = true,
-                              bool literal = false) {
     std::string regex = "(";
     regex.reserve(options.pattern.length() + 2);
     regex += literal ? RE2::QuoteMeta(options.pattern) : options.pattern;
     regex += ")";
-    regex_match_ = std::make_unique<RE2>(
-        regex, MakeRE2Options(is_utf8, options.ignore_case, /*literal=*/false));
+    ARROW_ASSIGN_OR_RAISE(auto compiled,
+                          GetCompiledRegex(regex, is_utf8, options.ignore_case));
+    return FindSubstringRegex{std::move(compiled)};
   }
 
   template <typename OutValue, typename... Ignored>
   OutValue Call(KernelContext*, std::string_view val, Status*) const {
     re2::StringPiece piece(val.data(), val.length());
     re2::StringPiece match;
-    if (RE2::PartialMatch(piece, *regex_match_, &match)) {
+    if (regex_match_->MayMatch(val) &&
+        RE2::PartialMatch(piece, regex_match_->regex, &match)) {
       return static_cast<OutValue>(match.data() - piece.data());
     }
     return -1;
@@ -1825,26 +2055,24 @@ struct CountSubstring {
 
 #ifdef ARROW_WITH_RE2
 struct CountSubstringRegex {
-  std::unique_ptr<RE2> regex_match_;
-
-  explicit CountSubstringRegex(const MatchSubstringOptions& options, bool is_utf8 = true,
-                               bool literal = false)
-      : regex_match_(new RE2(options.pattern,
-                             MakeRE2Options(is_utf8, options.ignore_case, literal))) {}
+  std::shared_ptr<const CompiledRegex> regex_match_;
 
   static Result<CountSubstringRegex> Make(const MatchSubstringOptions& options,
                                           bool is_utf8 = true, bool literal = false) {
-    CountSubstringRegex counter(options, is_utf8, literal);
-    RETURN_NOT_OK(RegexStatus(*counter.regex_match_));
-    return counter;
+    ARROW_ASSIGN_OR_RAISE(auto compiled, GetCompiledRegex(options.pattern, is_utf8,
+                                                          options.ignore_case, literal));
+    return CountSubstringRegex{std::move(compiled)};
   }
 
   template <typename OutValue, typename... Ignored>
   OutValue Call(KernelContext*, std::string_view val, Status*) const {
     OutValue count = 0;
+    if (!regex_match_->MayMatch(val)) {
+      return count;
+    }
     re2::StringPiece input(val.data(), val.size());
     auto last_size = input.size();
-    while (RE2::FindAndConsume(&input, *regex_match_)) {
+    while (RE2::FindAndConsume(&input, regex_match_->regex)) {
       count++;
       if (last_size == input.size()) {
         // 0-length match
@@ -2042,15 +2270,21 @@ struct PlainSubstringReplacer {
 template <typename Type>
 struct RegexSubstringReplacer {
   const ReplaceSubstringOptions& options_;
-  const RE2 regex_find_;
-  const RE2 regex_replacement_;
+  std::shared_ptr<const CompiledRegex> compiled_find_;
+  std::shared_ptr<const CompiledRegex> compiled_replacement_;
+  const RE2& regex_find_;
+  const RE2& regex_replacement_;
 
   static Result<std::unique_ptr<RegexSubstringReplacer>> Make(
       const ReplaceSubstringOptions& options) {
-    auto replacer = std::make_unique<RegexSubstringReplacer>(options);
-
-    RETURN_NOT_OK(RegexStatus(replacer->regex_find_));
-    RETURN_NOT_OK(RegexStatus(replacer->regex_replacement_));
+    // Using RE2::FindAndConsume we can only find the pattern if it is a group,
+    // therefore we have 2 regexes, one with () around it, one without.
+    ARROW_ASSIGN_OR_RAISE(auto compiled_find,
+                          GetCompiledRegex("(" + options.pattern + ")", Type::is_utf8));
+    ARROW_ASSIGN_OR_RAISE(auto compiled_replacement,
+                          GetCompiledRegex(options.pattern, Type::is_utf8));
+    auto replacer = std::make_unique<RegexSubstringReplacer>(
+        options, std::move(compiled_find), std::move(compiled_replacement));
 
     std::string replacement_error;
     if (!replacer->regex_replacement_.CheckRewriteString(replacer->options_.replacement,
@@ -2062,14 +2296,20 @@ struct RegexSubstringReplacer {
     return replacer;
   }
 
-  // Using RE2::FindAndConsume we can only find the pattern if it is a group, therefore
-  // we have 2 regexes, one with () around it, one without.
-  explicit RegexSubstringReplacer(const ReplaceSubstringOptions& options)
+  RegexSubstringReplacer(const ReplaceSubstringOptions& options,
+                         std::shared_ptr<const CompiledRegex> compiled_find,
+                         std::shared_ptr<const CompiledRegex> compiled_replacement)
       : options_(options),
-        regex_find_("(" + options_.pattern + ")", MakeRE2Options<Type>()),
-        regex_replacement_(options_.pattern, MakeRE2Options<Type>()) {}
+        compiled_find_(std::move(compiled_find)),
+        compiled_replacement_(std::move(compiled_replacement)),
+        regex_find_(compiled_find_->regex),
+        regex_replacement_(compiled_replacement_->regex) {}
 
   Status ReplaceString(std::string_view s, TypedBufferBuilder<uint8_t>* builder) const {
+    if (!compiled_replacement_->MayMatch(s)) {
+      // Nothing to replace
+      return builder->Append(reinterpret_cast<const uint8_t*>(s.data()), s.length());
+    }
     re2::StringPiece piece(s.data(), s.length());
     return ReplaceStringImpl(piece, builder);
   }
@@ -2184,16 +2424,15 @@ void AddAsciiStringReplaceSubstring(FunctionRegistry* registry) {
 
 using ExtractRegexState = OptionsWrapper<ExtractRegexOptions>;
 
-// TODO cache this once per ExtractRegexOptions
 struct ExtractRegexData {
-  // Use unique_ptr<> because RE2 is non-movable (for ARROW_ASSIGN_OR_RAISE)
-  std::unique_ptr<RE2> regex;
+  std::shared_ptr<const CompiledRegex> compiled;
+  const RE2* regex;
   std::vector<std::string> group_names;
 
   static Result<ExtractRegexData> Make(const ExtractRegexOptions& options,
                                        bool is_utf8 = true) {
-    ExtractRegexData data(options.pattern, is_utf8);
-    RETURN_NOT_OK(RegexStatus(*data.regex));
+    ARROW_ASSIGN_OR_RAISE(auto compiled, GetCompiledRegex(options.pattern, is_utf8));
+    ExtractRegexData data(std::move(compiled));
 
     const int group_count = data.regex->NumberOfCapturingGroups();
     const auto& name_map = data.regex->CapturingGroupNames();
@@ -2228,8 +2467,8 @@ struct ExtractRegexData {
   }
 
  private:
-  explicit ExtractRegexData(const std::string& pattern, bool is_utf8 = true)
-      : regex(new RE2(pattern, MakeRE2Options(is_utf8))) {}
+  explicit ExtractRegexData(std::shared_ptr<const CompiledRegex> compiled)
+      : compiled(std::move(compiled)), regex(&this->compiled->regex) {}
 };
 
 Result<TypeHolder> ResolveExtractRegexOutput(KernelContext* ctx,
@@ -2265,7 +2504,8 @@ struct ExtractRegexBase {
   }
 
   bool Match(std::string_view s) {
-    return RE2::PartialMatchN(ToStringPiece(s), *data.regex, args_pointers_start,
+    return data.compiled->MayMatch(s) &&
+           RE2::PartialMatchN(ToStringPiece(s), *data.regex, args_pointers_start,
                               group_count);
   }
 };
@@ -2814,7 +3054,8 @@ template <typename Type>
 struct SplitRegexFinder : public StringSplitFinderBase<SplitPatternOptions> {
   using Options = SplitPatternOptions;
 
-  std::unique_ptr<RE2> regex_split;
+  std::shared_ptr<const CompiledRegex> compiled_split;
+  const RE2* regex_split = nullptr;
 
   Status PreExec(const SplitPatternOptions& options) override {
     if (options.reverse) {
@@ -2826,8 +3067,9 @@ struct SplitRegexFinder : public StringSplitFinderBase<SplitPatternOptions> {
     pattern.reserve(options.pattern.size() + 2);
     pattern += options.pattern;
     pattern += ')';
-    regex_split = std::make_unique<RE2>(pattern, MakeRE2Options<Type>());
-    return RegexStatus(*regex_split);
+    ARROW_ASSIGN_OR_RAISE(compiled_split, GetCompiledRegex(pattern, Type::is_utf8));
+    regex_split = &compiled_split->regex;
+    return Status::OK();
   }
 
   bool Find(const uint8_t* begin, const uint8_t* end, const uint8_t** separator_begin,
@@ -19,8 +19,13 @@
 
 #include <sstream>
 
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+#  include <xsimd/xsimd.hpp>
+#endif
+
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/util/simd.h"
 
 namespace arrow {
 namespace compute {
@@ -48,6 +53,44 @@ struct StringTransformBase {
   }
 };
 
+// Map the case of ASCII letters, bytes above 0x7f are copied as is: lower case
+// letters are upper cased if kToUpper, upper case letters lower cased if kToLower.
+template <bool kToUpper, bool kToLower>
+void TransformAsciiCase(const uint8_t* input, int64_t length, uint8_t* output) {
+  int64_t i = 0;
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+  using simd_batch = xsimd::make_sized_batch_t<int8_t, 16>;
+
+  // Non-ASCII bytes are negative as signed bytes, so out of the letter ranges
+  const simd_batch lower_a('a'), lower_z('z'), upper_a('A'), upper_z('Z');
+  const simd_batch case_delta(static_cast<int8_t>('a' - 'A'));
+  for (; length - i >= 16; i += 16) {
+    const simd_batch chars =
+        simd_batch::load_unaligned(reinterpret_cast<const int8_t*>(input + i));
+    simd_batch mapped = chars;
+    if (kToUpper) {
+      mapped = xsimd::select((chars >= lower_a) & (chars <= lower_z),
+                             chars - case_delta, mapped);
+    }
+    if (kToLower) {
+      mapped = xsimd::select((chars >= upper_a) & (chars <= upper_z),
+                             chars + case_delta, mapped);
+    }
+    mapped.store_unaligned(reinterpret_cast<int8_t*>(output + i));
+  }
+#endif
+  for (; i < length; ++i) {
+    const uint8_t c = input[i];
+    if (kToUpper && c >= 'a' && c <= 'z') {
+      output[i] = c - ('a' - 'A');
+    } else if (kToLower && c >= 'A' && c <= 'Z') {
+      output[i] = c + ('a' - 'A');
+    } else {
+      output[i] = c;
+    }
+  }
+}
+
 template <typename offset_type>
 static int64_t GetVarBinaryValuesLength(const ArraySpan& span) {
   const offset_type* offsets = span.GetValues<offset_type>(1);
@@ -1156,6 +1156,44 @@ TYPED_TEST(TestStringKernels, Utf8Normalize) {
 
 #endif
 
+TEST(TestStringKernels, BinaryViews) {
+  // Short values are inlined in the views, longer ones are in a data buffer
+  for (const auto& ty : {binary_view(), utf8_view()}) {
+    ARROW_SCOPED_TRACE("type = ", *ty);
+    auto input = ArrayFromJSON(
+        ty, R"(["abc", "", null, "xyz and some padding beyond 12", "abxyz"])");
+    CheckScalarUnary("binary_length", input,
+                     ArrayFromJSON(int32(), "[3, 0, null, 30, 5]"));
+
+    MatchSubstringOptions options{"xyz"};
+    CheckScalarUnary("match_substring", input,
+                     ArrayFromJSON(boolean(), "[false, false, null, true, true]"),
+                     &options);
+    options = MatchSubstringOptions{"ab"};
+    CheckScalarUnary("starts_with", input,
+                     ArrayFromJSON(boolean(), "[true, false, null, false, true]"),
+                     &options);
+    options = MatchSubstringOptions{"12"};
+    CheckScalarUnary("ends_with", input,
+                     ArrayFromJSON(boolean(), "[false, false, null, true, false]"),
+                     &options);
+#ifdef ARROW_WITH_RE2
+    options = MatchSubstringOptions{"x.z$"};
+    CheckScalarUnary("match_substring_regex", input,
+                     ArrayFromJSON(boolean(), "[false, false, null, false, true]"),
+                     &options);
+    options = MatchSubstringOptions{"%xyz%"};
+    CheckScalarUnary("match_like", input,
+                     ArrayFromJSON(boolean(), "[false, false, null, true, true]"),
+                     &options);
+#endif
+  }
+
+  auto utf8_input =
+      ArrayFromJSON(utf8_view(), R"(["héllo", null, "a much longer string ☃"])");
+  CheckScalarUnary("utf8_length", utf8_input, ArrayFromJSON(int32(), "[5, null, 22]"));
+}
+
 TEST(TestStringKernels, LARGE_MEMORY_TEST(Utf8Upper32bitGrowth)) {
   // 0x7fff * 0xffff is the max a 32 bit string array can hold
   // since the utf8_upper kernel can grow it by 3/2, the max we should accept is is
@@ -1181,6 +1219,28 @@ TYPED_TEST(TestStringKernels, Utf8Length) {
                    this->offset_type(), "[3, null, 5, 6, 6, 0, 1]");
 }
 
+TYPED_TEST(TestStringKernels, Utf8LongAsciiRuns) {
+  // Long runs of ASCII characters are processed in bulk
+  const std::string input =
+      R"(["The quick brown fox jumps over the lazy dog, déjà vu!",
+          "æÆ and then a long run of Mixed Case ASCII text, Ⱥ"])";
+  this->CheckUnary("utf8_length", input, this->offset_type(), "[53, 50]");
+  this->CheckUnary("utf8_reverse", input, this->type(),
+                   R"(["!uv àjéd ,god yzal eht revo spmuj xof nworb kciuq ehT",
+                       "Ⱥ ,txet IICSA esaC dexiM fo nur gnol a neht dna Ææ"])");
+#ifdef ARROW_WITH_UTF8PROC
+  this->CheckUnary("utf8_upper", input, this->type(),
+                   R"(["THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, DÉJÀ VU!",
+                       "ÆÆ AND THEN A LONG RUN OF MIXED CASE ASCII TEXT, Ⱥ"])");
+  this->CheckUnary("utf8_lower", input, this->type(),
+                   R"(["the quick brown fox jumps over the lazy dog, déjà vu!",
+                       "ææ and then a long run of mixed case ascii text, ⱥ"])");
+  this->CheckUnary("utf8_swapcase", input, this->type(),
+                   R"(["tHE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, DÉJÀ VU!",
+                       "Ææ AND THEN A LONG RUN OF mIXED cASE ascii TEXT, ⱥ"])");
+#endif
+}
+
 #ifdef ARROW_WITH_UTF8PROC
 
 TYPED_TEST(TestStringKernels, Utf8Upper) {
@@ -1639,6 +1699,46 @@ TYPED_TEST(TestBaseBinaryKernels, MatchSubstringRegexInvalid) {
       CallFunction("match_substring_regex", {input}, &options));
 }
 
+TYPED_TEST(TestBaseBinaryKernels, RegexRequiredLiteral) {
+  // Strings without the literal that all matches contain are ruled out before
+  // running the regex, parts of the pattern which may not occur mustn't be required
+  MatchSubstringOptions options{"ab?cd"};
+  this->CheckUnary("match_substring_regex", R"(["acd", "abcd", "xacdx", "abd", null])",
+                   boolean(), "[true, true, true, false, null]", &options);
+  options = MatchSubstringOptions{"x(yz)?w"};
+  this->CheckUnary("match_substring_regex", R"(["xw", "xyzw", "yzw", "xy"])", boolean(),
+                   "[true, true, false, false]", &options);
+  options = MatchSubstringOptions{"\\d+ error: time"};
+  this->CheckUnary("match_substring_regex",
+                   R"(["12 error: timeout", "error: time", "1 error: time", "1 err"])",
+                   boolean(), "[true, false, true, false]", &options);
+  options = MatchSubstringOptions{"abc{0,2}de"};
+  this->CheckUnary("match_substring_regex", R"(["abde", "abccde", "abcde", "bcde"])",
+                   boolean(), "[true, true, true, false]", &options);
+  options = MatchSubstringOptions{"FOO.*bar", /*ignore_case=*/true};
+  this->CheckUnary("match_substring_regex", R"(["foobar", "Foo BAR", "barfoo"])",
+                   boolean(), "[true, true, false]", &options);
+  // Literal patterns are only required as-is when case-sensitive
+  options = MatchSubstringOptions{"aBc", /*ignore_case=*/true};
+  this->CheckUnary("match_substring", R"(["xabcx", "ABC", "ab"])", boolean(),
+                   "[true, true, false]", &options);
+  this->CheckUnary("count_substring", R"(["abcABC", "ab"])", this->offset_type(),
+                   "[2, 0]", &options);
+  this->CheckUnary("find_substring", R"(["xxAbC", "ab"])", this->offset_type(),
+                   "[2, -1]", &options);
+
+  options = MatchSubstringOptions{"ab?cd"};
+  this->CheckUnary("count_substring_regex", R"(["acdabcdxacd", "bcd", ""])",
+                   this->offset_type(), "[3, 0, 0]", &options);
+  options = MatchSubstringOptions{"foo.*bar"};
+  this->CheckUnary("find_substring_regex", R"(["xfoo bar", "bar foo"])",
+                   this->offset_type(), "[1, -1]", &options);
+
+  ReplaceSubstringOptions replace_options{"ab?cd", "X"};
+  this->CheckUnary("replace_substring_regex", R"(["acdabcd", "bcd", ""])", this->type(),
+                   R"(["XX", "bcd", ""])", &replace_options);
+}
+
 TYPED_TEST(TestStringKernels, MatchLike) {
   auto inputs = R"(["foo", "bar", "foobar", "barfoo", "o", "\nfoo", "foo\n", null])";
 
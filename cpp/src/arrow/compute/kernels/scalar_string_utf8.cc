@@ -364,10 +364,22 @@ struct StringTransformCodepoint : public FunctionalCaseMappingTransform {
   int64_t Transform(const uint8_t* input, int64_t input_string_ncodeunits,
                     uint8_t* output) {
     uint8_t* output_start = output;
-    if (ARROW_PREDICT_FALSE(
-            !arrow::util::UTF8Transform(input, input + input_string_ncodeunits, &output,
-                                        CodepointTransform::TransformCodepoint))) {
-      return kStringTransformError;
+    const uint8_t* end = input + input_string_ncodeunits;
+    while (input < end) {
+      // Runs of ASCII characters are mapped in bulk
+      const int64_t ascii_length = util::AsciiPrefixLength(input, end - input);
+      CodepointTransform::TransformAscii(input, ascii_length, output);
+      input += ascii_length;
+      output += ascii_length;
+      if (input == end) {
+        break;
+      }
+      uint32_t codepoint = 0;
+      if (ARROW_PREDICT_FALSE(!util::UTF8Decode(&input, &codepoint))) {
+        return kStringTransformError;
+      }
+      output =
+          util::UTF8Encode(output, CodepointTransform::TransformCodepoint(codepoint));
     }
     return output - output_start;
   }
@@ -378,6 +390,10 @@ struct UTF8UpperTransform : public FunctionalCaseMappingTransform {
     return codepoint <= kMaxCodepointLookup ? lut_upper_codepoint[codepoint]
                                             : utf8proc_toupper(codepoint);
   }
+
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    TransformAsciiCase<true, false>(input, length, output);
+  }
 };
 
 template <typename Type>
@@ -388,6 +404,10 @@ struct UTF8LowerTransform : public FunctionalCaseMappingTransform {
     return codepoint <= kMaxCodepointLookup ? lut_lower_codepoint[codepoint]
                                             : utf8proc_tolower(codepoint);
   }
+
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    TransformAsciiCase<false, true>(input, length, output);
+  }
 };
 
 template <typename Type>
@@ -407,6 +427,10 @@ struct UTF8SwapCaseTransform : public FunctionalCaseMappingTransform {
 
     return codepoint;
   }
+
+  static void TransformAscii(const uint8_t* input, int64_t length, uint8_t* output) {
+    TransformAsciiCase<true, true>(input, length, output);
+  }
 };
 
 template <typename Type>
@@ -683,6 +707,11 @@ void AddUtf8StringLength(FunctionRegistry* registry) {
         applicator::ScalarUnaryNotNull<Int64Type, LargeStringType, Utf8Length>::Exec;
     DCHECK_OK(func->AddKernel({large_utf8()}, int64(), std::move(exec)));
   }
+  {
+    auto exec =
+        applicator::ScalarUnaryNotNull<Int32Type, StringViewType, Utf8Length>::Exec;
+    DCHECK_OK(func->AddKernel({utf8_view()}, int32(), std::move(exec)));
+  }
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -694,6 +723,15 @@ struct Utf8ReverseTransform : public StringTransformBase {
                     uint8_t* output) {
     int64_t i = 0;
     while (i < input_string_ncodeunits) {
+      // Runs of ASCII characters are reversed in bulk
+      const int64_t ascii_length =
+          util::AsciiPrefixLength(input + i, input_string_ncodeunits - i);
+      std::reverse_copy(input + i, input + i + ascii_length,
+                        output + input_string_ncodeunits - i - ascii_length);
+      i += ascii_length;
+      if (i == input_string_ncodeunits) {
+        break;
+      }
       int64_t char_end = std::min(i + util::ValidUtf8CodepointByteSize(input + i),
                                   input_string_ncodeunits);
       std::copy(input + i, input + char_end, output + input_string_ncodeunits - char_end);
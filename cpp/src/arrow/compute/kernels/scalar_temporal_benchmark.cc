@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <functional>
 
 #include "benchmark/benchmark.h"
@@ -33,6 +34,9 @@ constexpr auto kSeed = 0x94378165;
 std::vector<int64_t> g_data_sizes = {kL2Size};
 static constexpr int64_t kInt64Min = -2000000000;  // 1906-08-16 20:26:40
 static constexpr int64_t kInt64Max = 2000000000;   // 2033-05-18 03:33:20
+// Nanoseconds
+static constexpr int64_t kTimeSeriesStart = 1577836800000000000;  // 2020-01-01
+static constexpr int64_t kTimeSeriesEnd = 1640995200000000000;    // 2022-01-01
 
 void SetArgs(benchmark::internal::Benchmark* bench) {
   for (const auto inverse_null_proportion : std::vector<ArgsType>({100, 0})) {
@@ -65,6 +69,19 @@ static void BenchmarkTemporalRounding(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * array_size);
 }
 
+// Sorted timestamps over two years, as in a time series.  In a time zone with
+// daylight saving time they cross a few transitions.
+std::shared_ptr<Array> MakeTimeSeries(int64_t length, double null_proportion,
+                                      const std::shared_ptr<DataType>& timestamp_type) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = rand.Numeric<Int64Type>(length, kTimeSeriesStart, kTimeSeriesEnd,
+                                       null_proportion);
+  int64_t* values = array->data()->GetMutableValues<int64_t>(1);
+  std::sort(values, values + length);
+  EXPECT_OK_AND_ASSIGN(auto timestamp_array, array->View(timestamp_type));
+  return timestamp_array;
+}
+
 template <UnaryOp& Op, std::shared_ptr<DataType>& timestamp_type>
 static void BenchmarkTemporal(benchmark::State& state) {
   RegressionArgs args(state);
@@ -166,7 +183,57 @@ static void BenchmarkAssumeTimezone(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * array_size);
 }
 
+template <UnaryOp& Op, std::shared_ptr<DataType>& timestamp_type>
+static void BenchmarkTemporalTimeSeries(benchmark::State& state) {
+  RegressionArgs args(state);
+  ExecContext* ctx = default_exec_context();
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto timestamp_array = MakeTimeSeries(array_size, args.null_proportion, timestamp_type);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(Op(timestamp_array, ctx).status());
+  }
+
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+template <std::shared_ptr<DataType>& timestamp_type>
+static void BenchmarkStrftimeTimeSeries(benchmark::State& state) {
+  RegressionArgs args(state);
+  ExecContext* ctx = default_exec_context();
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto timestamp_array = MakeTimeSeries(array_size, args.null_proportion, timestamp_type);
+
+  auto options = StrftimeOptions("%Y-%m-%dT%H:%M:%S%z");
+  for (auto _ : state) {
+    ABORT_NOT_OK(Strftime(timestamp_array, options, ctx).status());
+  }
+
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void BenchmarkAssumeTimezoneTimeSeries(benchmark::State& state) {
+  RegressionArgs args(state);
+  ExecContext* ctx = default_exec_context();
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto timestamp_array =
+      MakeTimeSeries(array_size, args.null_proportion, timestamp(TimeUnit::NANO));
+
+  auto options = AssumeTimezoneOptions(
+      "America/New_York", AssumeTimezoneOptions::Ambiguous::AMBIGUOUS_LATEST,
+      AssumeTimezoneOptions::Nonexistent::NONEXISTENT_EARLIEST);
+  for (auto _ : state) {
+    ABORT_NOT_OK(AssumeTimezone(timestamp_array, options, ctx).status());
+  }
+
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
 auto zoned = timestamp(TimeUnit::NANO, "Pacific/Marquesas");
+auto zoned_dst = timestamp(TimeUnit::NANO, "America/New_York");
 auto non_zoned = timestamp(TimeUnit::NANO);
 auto time32_type = time32(TimeUnit::MILLI);
 auto time64_type = time64(TimeUnit::NANO);
@@ -247,6 +314,16 @@ BENCHMARK_TEMPLATE(BenchmarkStrptime, non_zoned)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BenchmarkStrptime, zoned)->Apply(SetArgs);
 BENCHMARK(BenchmarkAssumeTimezone)->Apply(SetArgs);
 
+// Zoned benchmarks over time series
+BENCHMARK_TEMPLATE(BenchmarkTemporalTimeSeries, Hour, zoned_dst)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchmarkTemporalTimeSeries, Day, zoned_dst)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchmarkTemporalTimeSeries, IsDaylightSavings, zoned_dst)
+    ->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchmarkTemporalTimeSeries, LocalTimestamp, zoned_dst)
+    ->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchmarkStrftimeTimeSeries, zoned_dst)->Apply(SetArgs);
+BENCHMARK(BenchmarkAssumeTimezoneTimeSeries)->Apply(SetArgs);
+
 // binary temporal benchmarks
 DECLARE_TEMPORAL_BINARY_BENCHMARKS_DATES_AND_TIMESTAMPS(YearsBetween);
 DECLARE_TEMPORAL_BINARY_BENCHMARKS_DATES_AND_TIMESTAMPS(QuartersBetween);
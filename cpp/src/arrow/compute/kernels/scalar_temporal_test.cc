@@ -1875,6 +1875,46 @@ TEST_F(ScalarTemporalTest, TestLocalTimestamp) {
   }
 }
 
+TEST_F(ScalarTemporalTest, TestZonedAcrossTransitions) {
+  // Sorted timestamps around daylight saving time transitions in New York, then
+  // back to the first transition
+  const char* times =
+      R"(["2021-03-14T05:00:00", "2021-03-14T06:59:59", "2021-03-14T07:00:00",
+          "2021-11-07T05:59:59", "2021-11-07T06:00:00", "2021-11-07T07:00:00",
+          "2021-03-14T06:30:00", "2021-07-01T12:00:00", null])";
+  const char* expected_local =
+      R"(["2021-03-14T00:00:00", "2021-03-14T01:59:59", "2021-03-14T03:00:00",
+          "2021-11-07T01:59:59", "2021-11-07T01:00:00", "2021-11-07T02:00:00",
+          "2021-03-14T01:30:00", "2021-07-01T08:00:00", null])";
+  const char* expected_is_dst =
+      "[false, false, true, true, false, false, false, true, null]";
+  const char* expected_strftime =
+      R"(["2021-03-14T00:00:00-0500", "2021-03-14T01:59:59-0500",
+          "2021-03-14T03:00:00-0400", "2021-11-07T01:59:59-0400",
+          "2021-11-07T01:00:00-0500", "2021-11-07T02:00:00-0500",
+          "2021-03-14T01:30:00-0500", "2021-07-01T08:00:00-0400", null])";
+  // Ambiguous local times resolve to the earliest
+  const char* expected_assumed =
+      R"(["2021-03-14T05:00:00", "2021-03-14T06:59:59", "2021-03-14T07:00:00",
+          "2021-11-07T05:59:59", "2021-11-07T05:00:00", "2021-11-07T07:00:00",
+          "2021-03-14T06:30:00", "2021-07-01T12:00:00", null])";
+
+  const std::string timezone = "America/New_York";
+  AssumeTimezoneOptions assume_options(
+      timezone, AssumeTimezoneOptions::Ambiguous::AMBIGUOUS_EARLIEST);
+  for (auto u : TimeUnit::values()) {
+    CheckScalarUnary("local_timestamp", timestamp(u, timezone), times, timestamp(u),
+                     expected_local);
+    CheckScalarUnary("is_dst", timestamp(u, timezone), times, boolean(),
+                     expected_is_dst);
+    CheckScalarUnary("assume_timezone", timestamp(u), expected_local,
+                     timestamp(u, timezone), expected_assumed, &assume_options);
+  }
+  StrftimeOptions strftime_options("%Y-%m-%dT%H:%M:%S%z");
+  CheckScalarUnary("strftime", timestamp(TimeUnit::SECOND, timezone), times, utf8(),
+                   expected_strftime, &strftime_options);
+}
+
 TEST_F(ScalarTemporalTest, TestAssumeTimezone) {
   std::string timezone_utc = "UTC";
   std::string timezone_kolkata = "Asia/Kolkata";
@@ -2082,6 +2122,31 @@ TEST_F(ScalarTemporalTest, Strftime) {
                    &options_ymdhms);
 }
 
+TEST_F(ScalarTemporalTest, StrftimeFieldByField) {
+  // Formats made of these fields are written without an ostream for the years
+  // 0 to 9999
+  auto options = StrftimeOptions("%FT%T%Ez %Z %%");
+
+  const char* seconds =
+      "[253402300799, 253402300800, -30636384833, -62135596800, -62167219200, "
+      "-62167219201, null]";
+  const char* string_seconds =
+      R"(["9999-12-31T23:59:59+00:00 UTC %", "10000-01-01T00:00:00+00:00 UTC %",
+          "0999-03-04T05:06:07+00:00 UTC %", "0001-01-01T00:00:00+00:00 UTC %",
+          "0000-01-01T00:00:00+00:00 UTC %", "-0001-12-31T23:59:59+00:00 UTC %",
+          null])";
+  CheckScalarUnary("strftime", timestamp(TimeUnit::SECOND, "UTC"), seconds, utf8(),
+                   string_seconds, &options);
+
+  const char* milliseconds =
+      R"(["2021-08-18T15:11:50.123", "2021-01-18T15:11:50.000", null])";
+  const char* string_milliseconds =
+      R"(["2021-08-18T12:41:50.123-02:30 NDT %", "2021-01-18T11:41:50.000-03:30 NST %",
+          null])";
+  CheckScalarUnary("strftime", timestamp(TimeUnit::MILLI, "America/St_Johns"),
+                   milliseconds, utf8(), string_milliseconds, &options);
+}
+
 TEST_F(ScalarTemporalTest, StrftimeNoTimezone) {
   auto options_default = StrftimeOptions();
   const char* seconds = R"(["1970-01-01T00:00:59", null])";
@@ -32,6 +32,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -711,5 +712,44 @@ TEST_F(TestSelectKWithTable, BottomKMultipleColumnKeys) {
   Check(schema, input, options, expected);
 }
 
+// Selecting in parallel must select the same values as selecting serially
+TEST(TestSelectKParallel, ChunkedArrayAndTable) {
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+  ::arrow::random::RandomArrayGenerator rng(0x5487655);
+
+  ArrayVector a_chunks, b_chunks;
+  for (int i = 0; i < 17; ++i) {
+    a_chunks.push_back(rng.Int32(1000, -100, 100, /*null_probability=*/0.1));
+    b_chunks.push_back(rng.Int64(1000, -1000000, 1000000, /*null_probability=*/0.0));
+  }
+  ASSERT_OK_AND_ASSIGN(auto a, ChunkedArray::Make(a_chunks));
+  ASSERT_OK_AND_ASSIGN(auto b, ChunkedArray::Make(b_chunks));
+  auto table = Table::Make(schema({field("a", int32()), field("b", int64())}), {a, b});
+
+  for (int64_t k : {0, 1, 10, 1000, 20000}) {
+    for (auto options :
+         {SelectKOptions::TopKDefault(k), SelectKOptions::BottomKDefault(k)}) {
+      ARROW_SCOPED_TRACE("options = ", options.ToString());
+      // Ties make the selected indices unspecified, but not the selected values
+      ASSERT_OK_AND_ASSIGN(auto expected, SelectKUnstable(a, options));
+      ASSERT_OK_AND_ASSIGN(auto actual, SelectKUnstable(a, options, &parallel_ctx));
+      ValidateOutput(*actual);
+      ASSERT_OK_AND_ASSIGN(auto expected_values, Take(a, expected));
+      ASSERT_OK_AND_ASSIGN(auto actual_values, Take(a, actual));
+      AssertDatumsEqual(expected_values, actual_values);
+
+      options.sort_keys = {SortKey("a", options.sort_keys[0].order),
+                           SortKey("b", SortOrder::Ascending)};
+      ASSERT_OK_AND_ASSIGN(expected, SelectKUnstable(table, options));
+      ASSERT_OK_AND_ASSIGN(actual, SelectKUnstable(table, options, &parallel_ctx));
+      ValidateOutput(*actual);
+      ASSERT_OK_AND_ASSIGN(expected_values, Take(table, expected));
+      ASSERT_OK_AND_ASSIGN(actual_values, Take(table, actual));
+      AssertDatumsEqual(expected_values, actual_values);
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
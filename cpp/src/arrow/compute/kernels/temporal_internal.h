@@ -17,10 +17,18 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/api_scalar.h"
+#include "arrow/util/formatting.h"
 #include "arrow/vendored/datetime.h"
 
 namespace arrow {
@@ -31,9 +39,13 @@ namespace internal {
 using arrow_vendored::date::days;
 using arrow_vendored::date::floor;
 using arrow_vendored::date::local_days;
+using arrow_vendored::date::local_info;
+using arrow_vendored::date::local_seconds;
 using arrow_vendored::date::local_time;
 using arrow_vendored::date::locate_zone;
 using arrow_vendored::date::sys_days;
+using arrow_vendored::date::sys_info;
+using arrow_vendored::date::sys_seconds;
 using arrow_vendored::date::sys_time;
 using arrow_vendored::date::time_zone;
 using arrow_vendored::date::year_month_day;
@@ -96,19 +108,92 @@ struct NonZonedLocalizer {
   sys_days ConvertDays(sys_days d) const { return d; }
 };
 
+// Remembers the interval of constant UTC offset found by the last lookup in a
+// time zone, so that converting time points in the same interval only takes an
+// addition rather than a search of the time zone's transitions.
+//
+// Not thread-safe: each kernel invocation should use its own instance.
+class TimeZoneIntervalCache {
+ public:
+  explicit TimeZoneIntervalCache(const time_zone* tz) : tz_(tz) {}
+
+  const time_zone* tz() const { return tz_; }
+
+  // The UTC offset interval containing `t`
+  template <typename Duration>
+  const sys_info& GetInfo(sys_time<Duration> t) const {
+    const auto seconds = floor<std::chrono::seconds>(t);
+    if (seconds < info_.begin || seconds >= info_.end) {
+      SetInfo(tz_->get_info(seconds));
+    }
+    return info_;
+  }
+
+  // Same as time_zone::to_local()
+  template <typename Duration>
+  local_time<std::common_type_t<Duration, std::chrono::seconds>> ToLocal(
+      sys_time<Duration> t) const {
+    const auto offset = GetInfo(t).offset;
+    return local_time<std::common_type_t<Duration, std::chrono::seconds>>{
+        (t + offset).time_since_epoch()};
+  }
+
+  // Convert `t` if it maps to exactly one time point, return false otherwise
+  template <typename Duration>
+  bool ToSysUnique(local_time<Duration> t, sys_time<Duration>* out) const {
+    const auto seconds = floor<std::chrono::seconds>(t);
+    if (seconds < local_begin_ || seconds >= local_end_) {
+      local_info info = tz_->get_info(seconds);
+      if (info.result != local_info::unique) {
+        return false;
+      }
+      SetInfo(std::move(info.first));
+    }
+    *out = sys_time<Duration>{(t - info_.offset).time_since_epoch()};
+    return true;
+  }
+
+ private:
+  static constexpr std::chrono::hours kMaxOffsetChange{48};
+
+  void SetInfo(sys_info info) const {
+    info_ = std::move(info);
+    // Local times this far from the ends of the interval cannot fall in any
+    // other interval, as UTC offsets are less than a day in magnitude
+    local_begin_ =
+        local_seconds{(info_.begin + info_.offset).time_since_epoch()} + kMaxOffsetChange;
+    local_end_ =
+        local_seconds{(info_.end + info_.offset).time_since_epoch()} - kMaxOffsetChange;
+  }
+
+  const time_zone* tz_;
+  // Empty until the first lookup
+  mutable sys_info info_{};
+  // The local times that map only to time points in `info_`, possibly shrunk
+  mutable local_seconds local_begin_{};
+  mutable local_seconds local_end_{};
+};
+
 struct ZonedLocalizer {
   using days_t = local_days;
 
+  explicit ZonedLocalizer(const time_zone* tz) : tz(tz), cache(tz) {}
+
   // Timezone-localizing conversions: UTC -> local time
   const time_zone* tz;
+  TimeZoneIntervalCache cache;
 
   template <typename Duration>
   local_time<Duration> ConvertTimePoint(int64_t t) const {
-    return tz->to_local(sys_time<Duration>(Duration{t}));
+    return cache.ToLocal(sys_time<Duration>(Duration{t}));
   }
 
   template <typename Duration>
   Duration ConvertLocalToSys(Duration t, Status* st) const {
+    sys_time<Duration> sys;
+    if (cache.ToSysUnique(local_time<Duration>(t), &sys)) {
+      return sys.time_since_epoch();
+    }
     try {
       return zoned_time<Duration>{tz, local_time<Duration>(t)}
           .get_sys_time()
@@ -125,31 +210,257 @@ struct ZonedLocalizer {
   local_days ConvertDays(sys_days d) const { return local_days(year_month_day(d)); }
 };
 
+// A strftime() format made only of the fields %Y, %m, %d, %H, %M, %S, %F, %T, %z,
+// %Ez, %Oz, %Z and %%, and of literal characters.  Time points in the years 0 to 9999
+// are written field by field into a buffer, with the same output as
+// date::to_stream() in the "C" locale.  Other time points are left to to_stream().
+template <typename Duration>
+class FastStrftimeFormat {
+ public:
+  // The duration to_stream() formats local times of Duration in
+  using LocalDuration = std::common_type_t<Duration, std::chrono::seconds>;
+
+  static std::optional<FastStrftimeFormat> Make(const std::string& format) {
+    FastStrftimeFormat out;
+    for (size_t i = 0; i < format.size(); ++i) {
+      if (format[i] != '%') {
+        out.AddItem(Item::kLiteral, format[i]);
+        continue;
+      }
+      if (++i == format.size()) {
+        return std::nullopt;
+      }
+      if (format[i] == 'E' || format[i] == 'O') {
+        if (++i == format.size() || format[i] != 'z') {
+          return std::nullopt;
+        }
+        out.AddItem(Item::kOffsetWithColon);
+        continue;
+      }
+      switch (format[i]) {
+        case 'Y':
+          out.AddItem(Item::kYear);
+          break;
+        case 'm':
+          out.AddItem(Item::kMonth);
+          break;
+        case 'd':
+          out.AddItem(Item::kDay);
+          break;
+        case 'H':
+          out.AddItem(Item::kHour);
+          break;
+        case 'M':
+          out.AddItem(Item::kMinute);
+          break;
+        case 'S':
+          out.AddItem(Item::kSecond);
+          break;
+        case 'F':
+          out.AddItem(Item::kYear);
+          out.AddItem(Item::kLiteral, '-');
+          out.AddItem(Item::kMonth);
+          out.AddItem(Item::kLiteral, '-');
+          out.AddItem(Item::kDay);
+          break;
+        case 'T':
+          out.AddItem(Item::kHour);
+          out.AddItem(Item::kLiteral, ':');
+          out.AddItem(Item::kMinute);
+          out.AddItem(Item::kLiteral, ':');
+          out.AddItem(Item::kSecond);
+          break;
+        case 'z':
+          out.AddItem(Item::kOffset);
+          break;
+        case 'Z':
+          out.AddItem(Item::kAbbrev);
+          break;
+        case '%':
+          out.AddItem(Item::kLiteral, '%');
+          break;
+        default:
+          return std::nullopt;
+      }
+    }
+    return out;
+  }
+
+  // The most characters Format() may write, given the time zone abbreviation
+  size_t max_size(const std::string& abbrev) const {
+    return fixed_size_ + num_abbrevs_ * abbrev.size();
+  }
+
+  // Write `t` to `out`, which must have room for max_size(info.abbrev) characters.
+  // Return the end of the output, or nullptr if `t` is out of range.
+  char* Format(local_time<LocalDuration> t, const sys_info& info, char* out) const {
+    using arrow::internal::detail::FormatAllDigitsLeftPadded;
+    using arrow::internal::detail::FormatTwoDigits;
+
+    const auto day_point = floor<days>(t);
+    const year_month_day ymd{day_point};
+    const int year = static_cast<int>(ymd.year());
+    if (year < 0 || year > 9999) {
+      return nullptr;
+    }
+    const arrow_vendored::date::hh_mm_ss<LocalDuration> hms{t - day_point};
+
+    auto write_two_digits = [&](int64_t value) {
+      out += 2;
+      char* cursor = out;
+      FormatTwoDigits(value, &cursor);
+    };
+    for (const Item& item : items_) {
+      switch (item.kind) {
+        case Item::kLiteral:
+          *out++ = item.literal;
+          break;
+        case Item::kYear:
+          write_two_digits(year / 100);
+          write_two_digits(year % 100);
+          break;
+        case Item::kMonth:
+          write_two_digits(static_cast<unsigned>(ymd.month()));
+          break;
+        case Item::kDay:
+          write_two_digits(static_cast<unsigned>(ymd.day()));
+          break;
+        case Item::kHour:
+          write_two_digits(hms.hours().count());
+          break;
+        case Item::kMinute:
+          write_two_digits(hms.minutes().count());
+          break;
+        case Item::kSecond:
+          write_two_digits(hms.seconds().count());
+          if constexpr (kFractionalWidth > 0) {
+            *out++ = '.';
+            out += kFractionalWidth;
+            char* cursor = out;
+            FormatAllDigitsLeftPadded(hms.subseconds().count(), kFractionalWidth, '0',
+                                      &cursor);
+          }
+          break;
+        case Item::kOffset:
+        case Item::kOffsetWithColon: {
+          // Whole minutes, rounded towards zero
+          const int64_t offset = std::chrono::duration_cast<std::chrono::minutes>(
+                                     info.offset)
+                                     .count();
+          const int64_t abs_offset = offset < 0 ? -offset : offset;
+          *out++ = offset < 0 ? '-' : '+';
+          write_two_digits(abs_offset / 60);
+          if (item.kind == Item::kOffsetWithColon) {
+            *out++ = ':';
+          }
+          write_two_digits(abs_offset % 60);
+          break;
+        }
+        case Item::kAbbrev:
+          out = std::copy(info.abbrev.begin(), info.abbrev.end(), out);
+          break;
+      }
+    }
+    return out;
+  }
+
+ private:
+  static constexpr size_t kFractionalWidth =
+      arrow_vendored::date::hh_mm_ss<LocalDuration>::fractional_width;
+
+  struct Item {
+    enum Kind {
+      kLiteral,
+      kYear,
+      kMonth,
+      kDay,
+      kHour,
+      kMinute,
+      kSecond,
+      kOffset,
+      kOffsetWithColon,
+      kAbbrev
+    };
+
+    Kind kind;
+    char literal;
+  };
+
+  void AddItem(typename Item::Kind kind, char literal = 0) {
+    items_.push_back({kind, literal});
+    switch (kind) {
+      case Item::kLiteral:
+        fixed_size_ += 1;
+        break;
+      case Item::kYear:
+        fixed_size_ += 4;
+        break;
+      case Item::kSecond:
+        fixed_size_ += 2 + (kFractionalWidth > 0 ? 1 + kFractionalWidth : 0);
+        break;
+      case Item::kOffset:
+      case Item::kOffsetWithColon:
+        // Offsets are less than 100 hours
+        fixed_size_ += 6;
+        break;
+      case Item::kAbbrev:
+        ++num_abbrevs_;
+        break;
+      default:
+        fixed_size_ += 2;
+        break;
+    }
+  }
+
+  std::vector<Item> items_;
+  size_t fixed_size_ = 0;
+  size_t num_abbrevs_ = 0;
+};
+
+// Formats timestamps of Duration, the result of a call being valid until the next
 template <typename Duration>
 struct TimestampFormatter {
-  const char* format;
-  const time_zone* tz;
+  const std::string format;
+  TimeZoneIntervalCache tz_cache;
+  // Only for the "C" locale
+  std::optional<FastStrftimeFormat<Duration>> fast_format;
   std::ostringstream bufstream;
+  std::string buffer;
 
   explicit TimestampFormatter(const std::string& format, const time_zone* tz,
                               const std::locale& locale)
-      : format(format.c_str()), tz(tz) {
+      : format(format), tz_cache(tz) {
+    if (locale == std::locale::classic()) {
+      fast_format = FastStrftimeFormat<Duration>::Make(format);
+    }
     bufstream.imbue(locale);
     // Propagate errors as C++ exceptions (to get an actual error message)
     bufstream.exceptions(std::ios::failbit | std::ios::badbit);
   }
 
-  Result<std::string> operator()(int64_t arg) {
+  Result<std::string_view> operator()(int64_t arg) {
+    // Same as formatting a zoned_time, without looking up the time zone every time
+    const auto t = sys_time<Duration>(Duration{arg});
+    const sys_info& info = tz_cache.GetInfo(t);
+    const auto local = tz_cache.ToLocal(t);
+    if (fast_format) {
+      buffer.resize(fast_format->max_size(info.abbrev));
+      const char* end = fast_format->Format(local, info, buffer.data());
+      if (end != nullptr) {
+        return std::string_view(buffer.data(), end - buffer.data());
+      }
+    }
     bufstream.str("");
-    const auto zt = zoned_time<Duration>{tz, sys_time<Duration>(Duration{arg})};
     try {
-      arrow_vendored::date::to_stream(bufstream, format, zt);
+      arrow_vendored::date::to_stream(bufstream, format.c_str(), local, &info.abbrev,
+                                      &info.offset);
     } catch (const std::runtime_error& ex) {
       bufstream.clear();
       return Status::Invalid("Failed formatting timestamp: ", ex.what());
     }
-    // XXX could return a view with std::ostringstream::view() (C++20)
-    return std::move(bufstream).str();
+    // XXX could use std::ostringstream::view() (C++20)
+    buffer = bufstream.str();
+    return std::string_view(buffer);
   }
 };
 
@@ -27,6 +27,7 @@
 #include "arrow/result.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow::compute::internal {
@@ -83,6 +84,11 @@ struct CumulativeBinaryOp {
         Op::template Call<OutValue, ArgValue, ArgValue>(ctx, arg, current_value, st);
     return current_value;
   }
+
+  // Continue with the values accumulated by `other`, as if they followed
+  void Merge(KernelContext* ctx, const CumulativeBinaryOp& other, Status* st) {
+    Call(ctx, other.current_value, st);
+  }
 };
 
 template <typename ArgType>
@@ -102,6 +108,11 @@ struct CumulativeMean {
     ++count;
     return sum / count;
   }
+
+  void Merge(KernelContext*, const CumulativeMean& other, Status*) {
+    sum += other.sum;
+    count += other.count;
+  }
 };
 
 // The driver kernel for all cumulative compute functions.
@@ -147,6 +158,20 @@ struct Accumulator {
 
     return st;
   }
+
+  // Update the state with `input` without appending the results
+  Status Reduce(const ArraySpan& input) {
+    Status st = Status::OK();
+    VisitArrayValuesInline<ArgType>(
+        input,
+        [&](ArgValue v) {
+          if (!encountered_null) {
+            current_state.Call(ctx, v, &st);
+          }
+        },
+        [&]() { encountered_null = encountered_null || !skip_nulls; });
+    return st;
+  }
 };
 
 template <typename ArgType, typename CumulativeState, typename OptionsType>
@@ -173,23 +198,36 @@ struct CumulativeKernel {
   }
 };
 
+// Chunked arrays this long are scanned in parallel when threads are enabled
+constexpr int64_t kMinParallelScanLength = 1 << 16;
+
 template <typename ArgType, typename CumulativeState, typename OptionsType>
 struct CumulativeKernelChunked {
   using OutType = typename CumulativeState::OutType;
   using OutValue = typename GetOutputType<OutType>::T;
+  using AccumulatorType = Accumulator<ArgType, CumulativeState>;
+
+  static CumulativeState InitialState(const OptionsType& options) {
+    return options.start.has_value() ? CumulativeState(options.start.value())
+                                     : CumulativeState();
+  }
+
   static Status Exec(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
     const auto& options = CumulativeOptionsWrapper<OptionsType>::Get(ctx);
-    Accumulator<ArgType, CumulativeState> accumulator(ctx);
-    if (options.start.has_value()) {
-      accumulator.current_state = CumulativeState(options.start.value());
-    } else {
-      accumulator.current_state = CumulativeState();
+    const ChunkedArray& chunked_input = *batch[0].chunked_array();
+    if (ctx->exec_context()->use_threads() && chunked_input.num_chunks() > 1 &&
+        chunked_input.length() >= kMinParallelScanLength) {
+      ARROW_ASSIGN_OR_RAISE(bool scanned, ExecParallel(ctx, options, chunked_input, out));
+      if (scanned) {
+        return Status::OK();
+      }
     }
+
+    AccumulatorType accumulator(ctx);
+    accumulator.current_state = InitialState(options);
     accumulator.skip_nulls = options.skip_nulls;
 
-    const ChunkedArray& chunked_input = *batch[0].chunked_array();
     RETURN_NOT_OK(accumulator.builder.Reserve(chunked_input.length()));
-    std::vector<std::shared_ptr<Array>> out_chunks;
     for (const auto& chunk : chunked_input.chunks()) {
       RETURN_NOT_OK(accumulator.Accumulate(*chunk->data()));
     }
@@ -198,6 +236,67 @@ struct CumulativeKernelChunked {
     out->value = std::move(result);
     return Status::OK();
   }
+
+  // A two-pass parallel prefix scan: the chunks are first reduced concurrently, then
+  // each of them is scanned from the merged reductions of the preceding chunks.  The
+  // output keeps the chunk layout of the input.
+  //
+  // Return false if a chunk overflowed on its own: the sequential scan then decides
+  // whether the whole input overflows.
+  static Result<bool> ExecParallel(KernelContext* ctx, const OptionsType& options,
+                                   const ChunkedArray& chunked_input, Datum* out) {
+    const ArrayVector& chunks = chunked_input.chunks();
+    const int num_chunks = chunked_input.num_chunks();
+    auto* executor = ctx->exec_context()->executor();
+    if (executor == nullptr) {
+      executor = ::arrow::internal::GetCpuThreadPool();
+    }
+
+    std::vector<std::unique_ptr<AccumulatorType>> accumulators(num_chunks);
+    const Status reduced = ::arrow::internal::ParallelFor(
+        num_chunks,
+        [&](int i) {
+          accumulators[i] = std::make_unique<AccumulatorType>(ctx);
+          accumulators[i]->current_state = CumulativeState();
+          accumulators[i]->skip_nulls = options.skip_nulls;
+          return accumulators[i]->Reduce(*chunks[i]->data());
+        },
+        executor);
+    if (!reduced.ok()) {
+      return false;
+    }
+
+    // Turn the reductions into the states the chunks are scanned from
+    CumulativeState prefix = InitialState(options);
+    bool prefix_has_null = false;
+    for (auto& accumulator : accumulators) {
+      const CumulativeState reduction = accumulator->current_state;
+      const bool reduction_has_null = accumulator->encountered_null;
+      accumulator->current_state = prefix;
+      accumulator->encountered_null = prefix_has_null;
+      if (!prefix_has_null) {
+        Status st = Status::OK();
+        prefix.Merge(ctx, reduction, &st);
+        if (!st.ok()) {
+          return false;
+        }
+        prefix_has_null = reduction_has_null;
+      }
+    }
+
+    ArrayVector out_chunks(num_chunks);
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_chunks,
+        [&](int i) {
+          AccumulatorType& accumulator = *accumulators[i];
+          RETURN_NOT_OK(accumulator.builder.Reserve(chunks[i]->length()));
+          RETURN_NOT_OK(accumulator.Accumulate(*chunks[i]->data()));
+          return accumulator.builder.Finish(&out_chunks[i]);
+        },
+        executor));
+    out->value = std::make_shared<ChunkedArray>(std::move(out_chunks), out->type());
+    return true;
+  }
 };
 
 const FunctionDoc cumulative_sum_doc{
@@ -26,6 +26,7 @@
 #include "arrow/compute/api_vector.h"
 #include "arrow/scalar.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 
@@ -949,5 +950,42 @@ TEST(TestCumulative, NaN) {
   CheckVectorUnary("cumulative_mean", ArrayFromJSON(float64(), "[5, 4, NaN, 2, 1]"),
                    ArrayFromJSON(float64(), "[5, 4.5, NaN, NaN, NaN]"));
 }
+
+TEST(TestCumulative, ParallelChunkedScan) {
+  // Long enough chunked arrays are scanned in parallel, chunk by chunk
+  auto rng = random::RandomArrayGenerator(0x5eed);
+  for (double null_probability : {0.0, 0.0001}) {
+    auto values = rng.Int32(100000, -3, 3, null_probability);
+    ArrayVector chunks;
+    const int64_t chunk_lengths[] = {1, 0, 30000, 2, 0, 19997, 50000};
+    int64_t offset = 0;
+    for (const int64_t chunk_length : chunk_lengths) {
+      chunks.push_back(values->Slice(offset, chunk_length));
+      offset += chunk_length;
+    }
+    ASSERT_EQ(offset, values->length());
+    auto input = std::make_shared<ChunkedArray>(chunks);
+
+    for (const auto& function : kCumulativeFunctionNames) {
+      for (bool skip_nulls : {false, true}) {
+        ARROW_SCOPED_TRACE(function, ", skip_nulls = ", skip_nulls,
+                           ", null_probability = ", null_probability);
+        CumulativeOptions options(/*start=*/5, skip_nulls);
+        auto expected = CallFunction(function, {values}, &options);
+        auto actual = CallFunction(function, {input}, &options);
+        if (!expected.ok()) {
+          // The products overflow
+          ASSERT_RAISES(Invalid, actual);
+          continue;
+        }
+        ASSERT_OK(actual);
+        ValidateOutput(*actual);
+        AssertDatumsEqual(std::make_shared<ChunkedArray>(expected->make_array()), *actual,
+                          /*verbose=*/true);
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -15,9 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_dict.h"
@@ -30,15 +32,19 @@
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/row/grouper.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/int_util.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/unreachable.h"
 
 namespace arrow {
 
 using internal::DictionaryTraits;
 using internal::HashTraits;
+using internal::MixHash;
 using internal::TransposeInts;
 
 namespace compute {
@@ -257,9 +263,17 @@ class HashKernel : public KernelState {
   // data structures) and visit the given input with Action.
   virtual Status Append(const ArraySpan& arr) = 0;
 
+  // The uniques of a whole chunked array, if computed outside of the kernel
+  // (see UniqueExecChunked)
+  const std::shared_ptr<ArrayData>& chunked_uniques() const { return chunked_uniques_; }
+  void set_chunked_uniques(std::shared_ptr<ArrayData> uniques) {
+    chunked_uniques_ = std::move(uniques);
+  }
+
  protected:
   const FunctionOptions* options_;
   std::mutex lock_;
+  std::shared_ptr<ArrayData> chunked_uniques_;
 };
 
 // ----------------------------------------------------------------------
@@ -371,6 +385,119 @@ class RegularHashKernel : public HashKernel {
   std::unique_ptr<MemoTable> memo_table_;
 };
 
+// ----------------------------------------------------------------------
+// Hash kernel implementation using the vectorized SwissTable of the Grouper, for
+// fixed-width types of 4 bytes or more and binary types
+
+template <typename Action, bool with_error_status = Action::with_error_status>
+class SwissHashKernel : public HashKernel {
+ public:
+  SwissHashKernel(const std::shared_ptr<DataType>& type, const FunctionOptions* options,
+                  MemoryPool* pool)
+      : HashKernel(options),
+        pool_(pool),
+        type_(type),
+        action_(type, options, pool),
+        exec_context_(pool) {}
+
+  Status Reset() override {
+    ARROW_ASSIGN_OR_RAISE(grouper_, Grouper::Make({type_}, &exec_context_));
+    memo_index_of_group_.clear();
+    group_of_memo_index_.clear();
+    return action_.Reset();
+  }
+
+  Status Append(const ArraySpan& arr) override {
+    RETURN_NOT_OK(action_.Reserve(arr.length));
+    ARROW_ASSIGN_OR_RAISE(Datum group_ids,
+                          grouper_->Consume(ExecSpan({ExecValue(arr)}, arr.length)));
+    const uint32_t* groups = group_ids.array()->GetValues<uint32_t>(1);
+    memo_index_of_group_.resize(grouper_->num_groups(), -1);
+
+    // The table numbers the groups in its own order, which may differ from the order
+    // of first appearance in case of collisions.  Memo indices are assigned in order
+    // of first appearance instead, like those of the memo tables.
+    const uint8_t* validity = arr.MayHaveNulls() ? arr.buffers[0].data : NULLPTR;
+    const bool encode_nulls = action_.ShouldEncodeNulls();
+    Status status;
+    for (int64_t i = 0; i < arr.length; ++i) {
+      const bool is_null =
+          validity != NULLPTR && !bit_util::GetBit(validity, arr.offset + i);
+      if (is_null && !encode_nulls) {
+        // The group of nulls is left out of the dictionary
+        if constexpr (!with_error_status) {
+          action_.ObserveNullNotFound(-1);
+        }
+        continue;
+      }
+      int32_t& memo_index = memo_index_of_group_[groups[i]];
+      if (memo_index >= 0) {
+        if (is_null) {
+          action_.ObserveNullFound(memo_index);
+        } else {
+          action_.ObserveFound(memo_index);
+        }
+        continue;
+      }
+      memo_index = static_cast<int32_t>(group_of_memo_index_.size());
+      group_of_memo_index_.push_back(groups[i]);
+      if constexpr (with_error_status) {
+        if (is_null) {
+          action_.ObserveNullNotFound(memo_index, &status);
+        } else {
+          action_.ObserveNotFound(memo_index, &status);
+        }
+        RETURN_NOT_OK(status);
+      } else {
+        if (is_null) {
+          action_.ObserveNullNotFound(memo_index);
+        } else {
+          action_.ObserveNotFound(memo_index);
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Flush(ExecResult* out) override { return action_.Flush(out); }
+
+  Status FlushFinal(ExecResult* out) override { return action_.FlushFinal(out); }
+
+  Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, grouper_->GetUniques());
+    const auto num_groups = static_cast<int64_t>(memo_index_of_group_.size());
+    const auto num_memo_indices = static_cast<int64_t>(group_of_memo_index_.size());
+    bool in_group_order = num_memo_indices == num_groups;
+    for (int64_t i = 0; in_group_order && i < num_memo_indices; ++i) {
+      in_group_order = group_of_memo_index_[i] == static_cast<uint32_t>(i);
+    }
+    if (in_group_order) {
+      *out = uniques.values[0].array();
+      return Status::OK();
+    }
+    UInt32Array indices(num_memo_indices, Buffer::Wrap(group_of_memo_index_));
+    ExecContext exec_context(pool_);
+    ARROW_ASSIGN_OR_RAISE(Datum dictionary,
+                          Take(uniques.values[0], indices, TakeOptions::NoBoundsCheck(),
+                               &exec_context));
+    *out = dictionary.array();
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> value_type() const override { return type_; }
+
+ private:
+  MemoryPool* pool_;
+  std::shared_ptr<DataType> type_;
+  Action action_;
+  ExecContext exec_context_;
+  std::unique_ptr<Grouper> grouper_;
+  // The memo index of each group, or -1 for the group of nulls when they aren't
+  // encoded
+  std::vector<int32_t> memo_index_of_group_;
+  std::vector<uint32_t> group_of_memo_index_;
+};
+
 // ----------------------------------------------------------------------
 // Hash kernel implementation for nulls
 
@@ -535,7 +662,7 @@ Result<std::unique_ptr<KernelState>> HashInit(KernelContext* ctx,
 }
 
 template <typename Action>
-KernelInit GetHashInit(Type::type type_id) {
+KernelInit GetMemoTableHashInit(Type::type type_id) {
   // ARROW-8933: Generate only a single hash kernel per physical data
   // representation
   switch (type_id) {
@@ -585,14 +712,50 @@ KernelInit GetHashInit(Type::type type_id) {
   }
 }
 
+template <typename Action>
+KernelInit GetHashInit(Type::type type_id) {
+#if ARROW_LITTLE_ENDIAN
+  // The memo tables of booleans and small integers are direct-mapped, and those of
+  // large and view binary types aren't supported by the Grouper
+  switch (type_id) {
+    case Type::INT32:
+    case Type::UINT32:
+    case Type::FLOAT:
+    case Type::DATE32:
+    case Type::TIME32:
+    case Type::INTERVAL_MONTHS:
+    case Type::INT64:
+    case Type::UINT64:
+    case Type::DOUBLE:
+    case Type::DATE64:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+    case Type::DURATION:
+    case Type::INTERVAL_DAY_TIME:
+    case Type::INTERVAL_MONTH_DAY_NANO:
+    case Type::BINARY:
+    case Type::STRING:
+    case Type::FIXED_SIZE_BINARY:
+    case Type::DECIMAL128:
+    case Type::DECIMAL256:
+      return HashInit<SwissHashKernel<Action>>;
+    default:
+      break;
+  }
+#endif
+  return GetMemoTableHashInit<Action>(type_id);
+}
+
 using DictionaryEncodeState = OptionsWrapper<DictionaryEncodeOptions>;
 
 template <typename Action>
 Result<std::unique_ptr<KernelState>> DictionaryHashInit(KernelContext* ctx,
                                                         const KernelInitArgs& args) {
   const auto& dict_type = checked_cast<const DictionaryType&>(*args.inputs[0].type);
-  ARROW_ASSIGN_OR_RAISE(auto indices_hasher,
-                        GetHashInit<Action>(dict_type.index_type()->id())(ctx, args));
+  // The indices are hashed with the type of the dictionary array
+  ARROW_ASSIGN_OR_RAISE(
+      auto indices_hasher,
+      GetMemoTableHashInit<Action>(dict_type.index_type()->id())(ctx, args));
   return std::make_unique<DictionaryHashKernel>(
       checked_pointer_cast<HashKernel>(std::move(indices_hasher)),
       dict_type.value_type());
@@ -605,10 +768,198 @@ Status HashExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Parallel unique of chunked arrays
+//
+// The rows of each chunk are hashed and partitioned on the top bits of their hash,
+// in parallel over the chunks.  Equal values land in the same partition, so the
+// partitions are then deduplicated independently, in parallel, each by its own
+// Grouper.  Finally the uniques of all partitions are put back in order of first
+// appearance, as the sequential kernel yields them.
+
+constexpr int64_t kMinParallelUniqueLength = 1 << 16;
+constexpr int kMaxUniquePartitions = 64;
+
+template <typename OffsetType>
+void HashBinaryValues(const ArraySpan& values, uint64_t* hashes) {
+  const OffsetType* offsets = values.GetValues<OffsetType>(1);
+  const uint8_t* data = values.buffers[2].data;
+  for (int64_t i = 0; i < values.length; ++i) {
+    hashes[i] = MixHash(::arrow::internal::ComputeStringHash<0>(
+        data + offsets[i], static_cast<int64_t>(offsets[i + 1] - offsets[i])));
+  }
+}
+
+// Hash the values of a fixed-width or base binary array, nulls hash to 0
+void HashValues(const ArraySpan& values, uint64_t* hashes) {
+  switch (values.type->id()) {
+    case Type::BOOL:
+      for (int64_t i = 0; i < values.length; ++i) {
+        hashes[i] =
+            MixHash(bit_util::GetBit(values.buffers[1].data, values.offset + i) ? 2 : 1);
+      }
+      break;
+    case Type::BINARY:
+    case Type::STRING:
+      HashBinaryValues<int32_t>(values, hashes);
+      break;
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      HashBinaryValues<int64_t>(values, hashes);
+      break;
+    default: {
+      const int byte_width = values.type->byte_width();
+      const uint8_t* data = values.buffers[1].data + values.offset * byte_width;
+      for (int64_t i = 0; i < values.length; ++i) {
+        hashes[i] =
+            MixHash(::arrow::internal::ComputeStringHash<0>(data + i * byte_width,
+                                                           byte_width));
+      }
+    }
+  }
+  if (values.MayHaveNulls()) {
+    for (int64_t i = 0; i < values.length; ++i) {
+      if (!bit_util::GetBit(values.buffers[0].data, values.offset + i)) {
+        hashes[i] = 0;
+      }
+    }
+  }
+}
+
+::arrow::internal::Executor* GetParallelUniqueExecutor(ExecContext* ctx,
+                                                       const ChunkedArray& values) {
+  auto* executor = ctx->use_threads() ? ctx->executor() : nullptr;
+  if (executor == nullptr || executor->GetCapacity() <= 1 ||
+      executor->OwnsThisThread() || values.num_chunks() < 2 ||
+      values.length() < kMinParallelUniqueLength) {
+    return nullptr;
+  }
+  const Type::type id = values.type()->id();
+  const bool supported = is_base_binary_like(id) ||
+                         (is_fixed_width(id) && id != Type::NA &&
+                          id != Type::DICTIONARY && id != Type::EXTENSION);
+  return supported ? executor : nullptr;
+}
+
+Result<std::shared_ptr<ArrayData>> ParallelUnique(const ChunkedArray& values,
+                                                  ::arrow::internal::Executor* executor,
+                                                  ExecContext* ctx) {
+  const int num_chunks = values.num_chunks();
+  const int num_partitions = static_cast<int>(std::min<int64_t>(
+      kMaxUniquePartitions,
+      bit_util::NextPower2(std::max(executor->GetCapacity(), 2))));
+  const int partition_shift = 64 - bit_util::Log2(num_partitions);
+
+  // Partition the row indices of each chunk
+  std::vector<int64_t> chunk_offsets(num_chunks);
+  std::vector<std::shared_ptr<Buffer>> row_ids(num_chunks);
+  std::vector<std::vector<int64_t>> partition_offsets(num_chunks);
+  for (int c = 1; c < num_chunks; ++c) {
+    chunk_offsets[c] = chunk_offsets[c - 1] + values.chunk(c - 1)->length();
+  }
+  RETURN_NOT_OK(::arrow::internal::ParallelFor(
+      num_chunks,
+      [&](int c) -> Status {
+        const ArraySpan chunk(*values.chunk(c)->data());
+        std::vector<uint64_t> hashes(chunk.length);
+        HashValues(chunk, hashes.data());
+
+        auto& offsets = partition_offsets[c];
+        offsets.assign(num_partitions + 1, 0);
+        for (const uint64_t hash : hashes) {
+          ++offsets[(hash >> partition_shift) + 1];
+        }
+        for (int p = 0; p < num_partitions; ++p) {
+          offsets[p + 1] += offsets[p];
+        }
+        ARROW_ASSIGN_OR_RAISE(row_ids[c], AllocateBuffer(chunk.length * sizeof(int32_t),
+                                                         ctx->memory_pool()));
+        auto* out = row_ids[c]->mutable_data_as<int32_t>();
+        std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+        for (int64_t i = 0; i < chunk.length; ++i) {
+          out[positions[hashes[i] >> partition_shift]++] = static_cast<int32_t>(i);
+        }
+        return Status::OK();
+      },
+      executor));
+
+  // Deduplicate each partition, recording the position where each unique appears first
+  std::vector<std::shared_ptr<Array>> partition_uniques(num_partitions);
+  std::vector<std::vector<int64_t>> first_positions(num_partitions);
+  RETURN_NOT_OK(::arrow::internal::ParallelFor(
+      num_partitions,
+      [&](int p) -> Status {
+        ARROW_ASSIGN_OR_RAISE(auto grouper, Grouper::Make({values.type()}, ctx));
+        auto& positions = first_positions[p];
+        for (int c = 0; c < num_chunks; ++c) {
+          const int64_t begin = partition_offsets[c][p];
+          const int64_t end = partition_offsets[c][p + 1];
+          if (begin == end) continue;
+          auto indices =
+              std::make_shared<Int32Array>(end - begin, row_ids[c], nullptr, 0, begin);
+          ARROW_ASSIGN_OR_RAISE(Datum rows, Take(values.chunk(c), indices,
+                                                 TakeOptions::NoBoundsCheck(), ctx));
+          const ExecBatch keys({rows}, end - begin);
+          ARROW_ASSIGN_OR_RAISE(Datum group_ids, grouper->Consume(ExecSpan(keys)));
+          positions.resize(grouper->num_groups(), -1);
+          const auto* ids = group_ids.array()->GetValues<uint32_t>(1);
+          for (int64_t i = 0; i < end - begin; ++i) {
+            if (positions[ids[i]] < 0) {
+              positions[ids[i]] = chunk_offsets[c] + indices->Value(i);
+            }
+          }
+        }
+        ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, grouper->GetUniques());
+        partition_uniques[p] = uniques.values[0].make_array();
+        return Status::OK();
+      },
+      executor));
+
+  // Restore the order of first appearance
+  ARROW_ASSIGN_OR_RAISE(auto uniques, Concatenate(partition_uniques, ctx->memory_pool()));
+  std::vector<int64_t> positions;
+  positions.reserve(uniques->length());
+  for (const auto& partition_positions : first_positions) {
+    positions.insert(positions.end(), partition_positions.begin(),
+                     partition_positions.end());
+  }
+  Int64Builder order_builder(ctx->memory_pool());
+  RETURN_NOT_OK(order_builder.Resize(uniques->length()));
+  for (int64_t i = 0; i < uniques->length(); ++i) {
+    order_builder.UnsafeAppend(i);
+  }
+  std::shared_ptr<Int64Array> order;
+  RETURN_NOT_OK(order_builder.Finish(&order));
+  auto* order_values = order->data()->GetMutableValues<int64_t>(1);
+  std::sort(order_values, order_values + order->length(),
+            [&](int64_t a, int64_t b) { return positions[a] < positions[b]; });
+  ARROW_ASSIGN_OR_RAISE(Datum ordered,
+                        Take(uniques, order, TakeOptions::NoBoundsCheck(), ctx));
+  return ordered.array();
+}
+
+// Compute the uniques of a whole chunked array, in parallel if possible
+Status UniqueExecChunked(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  auto hash_impl = checked_cast<HashKernel*>(ctx->state());
+  const ChunkedArray& values = *batch[0].chunked_array();
+  if (auto* executor = GetParallelUniqueExecutor(ctx->exec_context(), values)) {
+    ARROW_ASSIGN_OR_RAISE(auto uniques,
+                          ParallelUnique(values, executor, ctx->exec_context()));
+    hash_impl->set_chunked_uniques(std::move(uniques));
+    return Status::OK();
+  }
+  for (const auto& chunk : values.chunks()) {
+    RETURN_NOT_OK(hash_impl->Append(ctx, ArraySpan(*chunk->data())));
+  }
+  return Status::OK();
+}
+
 Status UniqueFinalize(KernelContext* ctx, std::vector<Datum>* out) {
   auto hash_impl = checked_cast<HashKernel*>(ctx->state());
-  std::shared_ptr<ArrayData> uniques;
-  RETURN_NOT_OK(hash_impl->GetDictionary(&uniques));
+  std::shared_ptr<ArrayData> uniques = hash_impl->chunked_uniques();
+  if (uniques == nullptr) {
+    RETURN_NOT_OK(hash_impl->GetDictionary(&uniques));
+  }
   *out = {Datum(uniques)};
   return Status::OK();
 }
@@ -787,7 +1138,12 @@ void RegisterVectorHash(FunctionRegistry* registry) {
   base.finalize = UniqueFinalize;
   base.output_chunked = false;
   auto unique = std::make_shared<VectorFunction>("unique", Arity::Unary(), unique_doc);
+  // Chunked arrays are handled as a whole so that they can be partitioned in parallel
+  base.can_execute_chunkwise = false;
+  base.exec_chunked = UniqueExecChunked;
   AddHashKernels<UniqueAction>(unique.get(), base, FirstType);
+  base.can_execute_chunkwise = true;
+  base.exec_chunked = nullptr;
 
   // Dictionary unique
   base.init = DictionaryHashInit<UniqueAction>;
@@ -138,6 +138,17 @@ void BenchUnique(benchmark::State& state, const ParamType& params) {
   params.SetMetadata(state);
 }
 
+template <typename ParamType>
+void BenchValueCounts(benchmark::State& state, const ParamType& params) {
+  std::shared_ptr<Array> arr;
+  params.GenerateTestData(&arr);
+
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(ValueCounts(arr).status());
+  }
+  params.SetMetadata(state);
+}
+
 template <typename ParamType>
 void BenchDictionaryEncode(benchmark::State& state, const ParamType& params) {
   std::shared_ptr<Array> arr;
@@ -182,6 +193,8 @@ std::vector<HashBenchCase> general_bench_cases = {
   {kHashBenchmarkLength, 100000, 0.5},
   {kHashBenchmarkLength, 100000, 0.99},
   {kHashBenchmarkLength, 100000, 1},
+  {kHashBenchmarkLength, 1000000, 0},
+  {kHashBenchmarkLength, 1000000, 0.1},
 };
 // clang-format on
 
@@ -199,6 +212,25 @@ static void UniqueString100bytes(benchmark::State& state) {
   BenchUnique(state, HashParams<StringType>{general_bench_cases[state.range(0)], 100});
 }
 
+static void ValueCountsInt64(benchmark::State& state) {
+  BenchValueCounts(state, HashParams<Int64Type>{general_bench_cases[state.range(0)]});
+}
+
+static void DictionaryEncodeInt32(benchmark::State& state) {
+  BenchDictionaryEncode(state,
+                        HashParams<Int32Type>{general_bench_cases[state.range(0)]});
+}
+
+static void DictionaryEncodeInt64(benchmark::State& state) {
+  BenchDictionaryEncode(state,
+                        HashParams<Int64Type>{general_bench_cases[state.range(0)]});
+}
+
+static void DictionaryEncodeString10bytes(benchmark::State& state) {
+  BenchDictionaryEncode(
+      state, HashParams<StringType>{general_bench_cases[state.range(0)], 10});
+}
+
 template <typename ParamType>
 void BenchValueCountsDictionaryChunks(benchmark::State& state, const ParamType& params) {
   std::shared_ptr<Array> arr;
@@ -238,6 +270,10 @@ BENCHMARK(BuildStringDictionary);
 BENCHMARK(UniqueInt64)->Apply(HashSetArgs);
 BENCHMARK(UniqueString10bytes)->Apply(HashSetArgs);
 BENCHMARK(UniqueString100bytes)->Apply(HashSetArgs);
+BENCHMARK(ValueCountsInt64)->Apply(HashSetArgs);
+BENCHMARK(DictionaryEncodeInt32)->Apply(HashSetArgs);
+BENCHMARK(DictionaryEncodeInt64)->Apply(HashSetArgs);
+BENCHMARK(DictionaryEncodeString10bytes)->Apply(HashSetArgs);
 
 void DictionaryChunksHashSetArgs(benchmark::internal::Benchmark* bench) {
   for (int i = 0; i < static_cast<int>(general_bench_cases.size()); ++i) {
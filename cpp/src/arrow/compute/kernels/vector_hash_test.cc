@@ -21,8 +21,10 @@
 #include <functional>
 #include <locale>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -33,6 +35,7 @@
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
 #include "arrow/status.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
@@ -857,6 +860,106 @@ TEST_F(TestHashKernel, NullEncodingSchemes) {
   AssertArraysEqual(*expected, *result);
 }
 
+// Check unique, value_counts and dictionary_encode against results computed with a
+// std::unordered_map, in order of first appearance
+template <typename ArrayType>
+void CheckHashKernelsRandom(const std::shared_ptr<Array>& input) {
+  using ValueType = decltype(std::declval<ArrayType>().GetView(0));
+  const auto& values = checked_cast<const ArrayType&>(*input);
+
+  std::unordered_map<std::optional<ValueType>, int32_t> memo;
+  std::vector<int64_t> first_indices, non_null_first_indices;
+  std::vector<int64_t> counts;
+  std::vector<int32_t> indices;
+  for (int64_t i = 0; i < values.length(); ++i) {
+    std::optional<ValueType> value;
+    if (values.IsValid(i)) value = values.GetView(i);
+    auto inserted = memo.emplace(value, static_cast<int32_t>(first_indices.size()));
+    if (inserted.second) {
+      first_indices.push_back(i);
+      counts.push_back(0);
+      if (value.has_value()) non_null_first_indices.push_back(i);
+    }
+    ++counts[inserted.first->second];
+  }
+  // The indices of the non-null values in the dictionary of dictionary_encode
+  std::unordered_map<ValueType, int32_t> dictionary_memo;
+  for (int64_t index : non_null_first_indices) {
+    dictionary_memo.emplace(values.GetView(index),
+                            static_cast<int32_t>(dictionary_memo.size()));
+  }
+  for (int64_t i = 0; i < values.length(); ++i) {
+    indices.push_back(values.IsValid(i) ? dictionary_memo[values.GetView(i)] : 0);
+  }
+
+  std::shared_ptr<Array> first_indices_array, non_null_first_indices_array;
+  ArrayFromVector<Int64Type>(first_indices, &first_indices_array);
+  ArrayFromVector<Int64Type>(non_null_first_indices, &non_null_first_indices_array);
+  ASSERT_OK_AND_ASSIGN(auto expected_uniques, Take(*input, *first_indices_array));
+  ASSERT_OK_AND_ASSIGN(auto expected_dictionary,
+                       Take(*input, *non_null_first_indices_array));
+  std::shared_ptr<Array> expected_counts, expected_indices;
+  ArrayFromVector<Int64Type>(counts, &expected_counts);
+  std::vector<bool> is_valid(values.length());
+  for (int64_t i = 0; i < values.length(); ++i) is_valid[i] = values.IsValid(i);
+  ArrayFromVector<Int32Type>(is_valid, indices, &expected_indices);
+
+  CheckUnique(input, expected_uniques);
+  CheckValueCounts(input, expected_uniques, expected_counts);
+  CheckDictEncode(input, expected_dictionary, expected_indices);
+}
+
+TEST_F(TestHashKernel, RandomHighCardinality) {
+  // Enough distinct values to resize the hash tables several times
+  random::RandomArrayGenerator rng(42);
+  const int64_t length = 100000;
+
+  auto int64_values = rng.Int64(length, 0, 50000, /*null_probability=*/0.05);
+  CheckHashKernelsRandom<Int64Array>(int64_values);
+  CheckHashKernelsRandom<Int64Array>(int64_values->Slice(1234, 56789));
+
+  auto double_values = rng.Float64(length, -1000, 1000, /*null_probability=*/0.05);
+  CheckHashKernelsRandom<DoubleArray>(double_values);
+
+  auto string_values = rng.StringWithRepeats(length, /*unique=*/40000, /*min_length=*/0,
+                                             /*max_length=*/16,
+                                             /*null_probability=*/0.05);
+  CheckHashKernelsRandom<StringArray>(string_values);
+  CheckHashKernelsRandom<StringArray>(string_values->Slice(4321, 56789));
+
+  auto large_string_values = rng.LargeString(length, /*min_length=*/0,
+                                             /*max_length=*/4,
+                                             /*null_probability=*/0.05);
+  CheckHashKernelsRandom<LargeStringArray>(large_string_values);
+}
+
+TEST_F(TestHashKernel, UniqueChunkedParallel) {
+  // Large chunked arrays are partitioned and deduplicated in parallel, the uniques
+  // should still come in order of first appearance
+  random::RandomArrayGenerator rng(42);
+  const int64_t chunk_length = 10000;
+  ArrayVector values = {
+      rng.Int32(20 * chunk_length, 0, 5000, /*null_probability=*/0.01),
+      rng.Int64(20 * chunk_length, 0, 150000, /*null_probability=*/0.01),
+      rng.StringWithRepeats(20 * chunk_length, /*unique=*/30000, /*min_length=*/0,
+                            /*max_length=*/16, /*null_probability=*/0.01),
+      rng.ArrayOf(boolean(), 20 * chunk_length, /*null_probability=*/0.01),
+      rng.ArrayOf(decimal128(12, 2), 20 * chunk_length, /*null_probability=*/0.01)};
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  for (const auto& array : values) {
+    ARROW_SCOPED_TRACE("type = ", array->type()->ToString());
+    ArrayVector chunks;
+    for (int64_t offset = 0; offset < array->length(); offset += chunk_length) {
+      chunks.push_back(array->Slice(offset, chunk_length));
+    }
+    auto chunked = std::make_shared<ChunkedArray>(std::move(chunks));
+    ASSERT_OK_AND_ASSIGN(auto expected, Unique(array, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(auto actual, Unique(chunked));
+    AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+  }
+}
+
 TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
   // ARROW-6857
   auto chunked_array = std::make_shared<ChunkedArray>(ArrayVector{}, utf8());
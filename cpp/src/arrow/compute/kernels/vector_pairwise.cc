@@ -17,6 +17,7 @@
 
 // Vector kernels for pairwise computation
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 
@@ -36,6 +37,7 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow::compute::internal {
 namespace {
@@ -88,26 +90,109 @@ Status PairwiseExecImpl(KernelContext* ctx, const ArraySpan& input,
   return Status::OK();
 }
 
-Status PairwiseExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-  const auto& state = checked_cast<const PairwiseState&>(*ctx->state());
-  auto input = batch[0].array;
-
-  // The scalar diff kernel will only write into the non-null output area.
-  // We must therefore pre-initialize the output, otherwise the left or right
-  // margin would be left uninitialized.
-  ARROW_ASSIGN_OR_RAISE(auto builder,
-                        MakeBuilder(out->type()->GetSharedPtr(), ctx->memory_pool()));
+// The scalar diff kernel will only write into the non-null output area.
+// We must therefore pre-initialize the output, otherwise the left or right
+// margin would be left uninitialized.
+Result<std::shared_ptr<ArrayData>> MakeNullOutput(KernelContext* ctx,
+                                                  const std::shared_ptr<DataType>& type,
+                                                  int64_t length) {
+  ARROW_ASSIGN_OR_RAISE(auto builder, MakeBuilder(type, ctx->memory_pool()));
   // Append nulls rather than empty values, so as to allocate a null bitmap.
-  RETURN_NOT_OK(builder->AppendNulls(out->length()));
+  RETURN_NOT_OK(builder->AppendNulls(length));
   std::shared_ptr<ArrayData> out_data;
   RETURN_NOT_OK(builder->FinishInternal(&out_data));
   out_data->null_count = kUnknownNullCount;
-  out->value = std::move(out_data);
+  return out_data;
+}
 
+Status PairwiseExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const auto& state = checked_cast<const PairwiseState&>(*ctx->state());
+  ARROW_ASSIGN_OR_RAISE(
+      out->value, MakeNullOutput(ctx, out->type()->GetSharedPtr(), out->length()));
   return PairwiseExecImpl(ctx, batch[0].array, state.scalar_exec, state.periods,
                           out->array_data_mutable());
 }
 
+/// Compute the pairwise results of a chunked array without concatenating it: every
+/// output chunk is computed, in parallel, from the pieces of the input where both
+/// the elements and their partners `periods` positions before lie in single chunks.
+Status PairwiseExecChunked(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const auto& state = checked_cast<const PairwiseState&>(*ctx->state());
+  const ChunkedArray& input = *batch[0].chunked_array();
+  const ArrayVector& chunks = input.chunks();
+  const int num_chunks = input.num_chunks();
+  const int64_t length = input.length();
+  const int64_t periods = state.periods;
+  const std::shared_ptr<DataType> out_type = out->type();
+
+  std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+  for (int i = 0; i < num_chunks; ++i) {
+    chunk_offsets[i + 1] = chunk_offsets[i] + chunks[i]->length();
+  }
+
+  ArrayVector out_chunks(num_chunks);
+  auto compute_chunk = [&](int i) -> Status {
+    const int64_t chunk_start = chunk_offsets[i];
+    const int64_t chunk_end = chunk_offsets[i + 1];
+    ARROW_ASSIGN_OR_RAISE(auto result,
+                          MakeNullOutput(ctx, out_type, chunk_end - chunk_start));
+    const ArraySpan chunk(*chunks[i]->data());
+    uint8_t* out_bitmap = result->buffers[0]->mutable_data();
+    int64_t valid_count = 0;
+
+    int64_t position = chunk_start;
+    while (position < chunk_end) {
+      const int64_t partner = position - periods;
+      if (partner < 0) {
+        // Left margin
+        position = std::min(chunk_end, periods);
+        continue;
+      }
+      if (partner >= length) {
+        // Right margin
+        break;
+      }
+      const auto partner_chunk = static_cast<int>(
+          std::upper_bound(chunk_offsets.begin(), chunk_offsets.end(), partner) -
+          chunk_offsets.begin() - 1);
+      const int64_t piece_length =
+          std::min(chunk_end - position, chunk_offsets[partner_chunk + 1] - partner);
+
+      ArraySpan left(chunk);
+      left.SetSlice(chunk.offset + position - chunk_start, piece_length);
+      ArraySpan right(*chunks[partner_chunk]->data());
+      right.SetSlice(right.offset + partner - chunk_offsets[partner_chunk],
+                     piece_length);
+      for (int64_t j = 0; j < piece_length; ++j) {
+        if (left.IsValid(j) && right.IsValid(j)) {
+          bit_util::SetBit(out_bitmap, position - chunk_start + j);
+          ++valid_count;
+        }
+      }
+      ArraySpan output_span;
+      output_span.SetMembers(*result);
+      output_span.offset = position - chunk_start;
+      output_span.length = piece_length;
+      ExecResult output{output_span};
+      RETURN_NOT_OK(
+          state.scalar_exec(ctx, ExecSpan({left, right}, piece_length), &output));
+      position += piece_length;
+    }
+    result->null_count = result->length - valid_count;
+    out_chunks[i] = MakeArray(std::move(result));
+    return Status::OK();
+  };
+
+  auto* executor = ctx->exec_context()->executor();
+  if (executor == nullptr) {
+    executor = ::arrow::internal::GetCpuThreadPool();
+  }
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      ctx->exec_context()->use_threads(), num_chunks, compute_chunk, executor));
+  out->value = std::make_shared<ChunkedArray>(std::move(out_chunks), out_type);
+  return Status::OK();
+}
+
 const FunctionDoc pairwise_diff_doc(
     "Compute first order difference of an array",
     ("Computes the first order difference of an array, It internally calls \n"
@@ -170,6 +255,7 @@ void RegisterPairwiseDiffKernels(std::string_view func_name,
     kernel.signature =
         KernelSignature::Make({base_func_kernel_sig->in_types()[0]}, out_type);
     kernel.exec = PairwiseExec;
+    kernel.exec_chunked = PairwiseExecChunked;
     kernel.init = [scalar_exec = base_func_kernel->exec](KernelContext* ctx,
                                                          const KernelInitArgs& args) {
       return std::make_unique<PairwiseState>(
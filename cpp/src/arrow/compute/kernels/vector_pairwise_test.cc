@@ -214,4 +214,30 @@ TEST_F(TestPairwiseDiff, Decimal) {
                                     CallFunction("pairwise_diff", {input}, &options));
   }
 }
+TEST_F(TestPairwiseDiff, ChunkedArray) {
+  auto rng = random::RandomArrayGenerator(0x5eed);
+  auto values = rng.Int32(1000, -100, 100, /*null_probability=*/0.1);
+  // Irregular chunks, some of them empty
+  ArrayVector chunks;
+  const int64_t chunk_lengths[] = {1, 0, 300, 2, 0, 97, 500, 100};
+  int64_t offset = 0;
+  for (const int64_t chunk_length : chunk_lengths) {
+    chunks.push_back(values->Slice(offset, chunk_length));
+    offset += chunk_length;
+  }
+  ASSERT_EQ(offset, values->length());
+  auto input = std::make_shared<ChunkedArray>(chunks);
+
+  for (int64_t period : {-1000, -400, -3, -1, 0, 1, 2, 299, 999, 1001}) {
+    ARROW_SCOPED_TRACE("period = ", period);
+    PairwiseOptions options(period);
+    ASSERT_OK_AND_ASSIGN(Datum expected,
+                         CallFunction("pairwise_diff", {values}, &options));
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction("pairwise_diff", {input}, &options));
+    ValidateOutput(actual);
+    AssertDatumsEqual(std::make_shared<ChunkedArray>(expected.make_array()), actual,
+                      /*verbose=*/true);
+  }
+}
+
 }  // namespace arrow::compute
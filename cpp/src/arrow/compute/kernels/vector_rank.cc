@@ -15,8 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <numeric>
+#include <vector>
 
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
@@ -36,21 +39,49 @@ namespace {
 // is the same as the value at the previous sort index.
 constexpr uint64_t kDuplicateMask = 1ULL << 63;
 
+// Inputs are sorted, and rankings computed, in parallel in parts of at least
+// this length
+constexpr int64_t kMinParallelRankLength = 1 << 16;
+
+// The number of parts to process `length` values in
+int NumRankParts(::arrow::internal::Executor* executor, int64_t length) {
+  if (executor == nullptr) {
+    return 1;
+  }
+  return static_cast<int>(std::clamp<int64_t>(length / kMinParallelRankLength, 1,
+                                              executor->GetCapacity()));
+}
+
 template <typename ValueSelector>
-void MarkDuplicates(const NullPartitionResult& sorted, ValueSelector&& value_selector) {
+Status MarkDuplicates(const NullPartitionResult& sorted, ValueSelector&& value_selector,
+                      ::arrow::internal::Executor* executor) {
   using T = decltype(value_selector(int64_t{}));
 
-  // Process non-nulls
-  if (sorted.non_nulls_end != sorted.non_nulls_begin) {
-    auto it = sorted.non_nulls_begin;
-    T prev_value = value_selector(*it);
-    while (++it < sorted.non_nulls_end) {
-      T curr_value = value_selector(*it);
-      if (curr_value == prev_value) {
-        *it |= kDuplicateMask;
-      }
-      prev_value = curr_value;
+  // Process non-nulls, in parts
+  const int64_t num_non_nulls = sorted.non_nulls_end - sorted.non_nulls_begin;
+  if (num_non_nulls > 0) {
+    const int num_parts = NumRankParts(executor, num_non_nulls);
+    auto part_begin = [&](int part) {
+      return sorted.non_nulls_begin + num_non_nulls * part / num_parts;
+    };
+    // Read the value preceding each part before any index gets marked
+    std::vector<T> preceding_values;
+    for (int part = 1; part < num_parts; ++part) {
+      preceding_values.push_back(value_selector(*(part_begin(part) - 1)));
     }
+    RETURN_NOT_OK(SortParallelFor(executor, num_parts, [&](int part) {
+      auto it = part_begin(part);
+      const auto end = part_begin(part + 1);
+      T prev_value = part == 0 ? value_selector(*it++) : preceding_values[part - 1];
+      for (; it < end; ++it) {
+        T curr_value = value_selector(*it);
+        if (curr_value == prev_value) {
+          *it |= kDuplicateMask;
+        }
+        prev_value = curr_value;
+      }
+      return Status::OK();
+    }));
   }
 
   // Process nulls
@@ -61,6 +92,7 @@ void MarkDuplicates(const NullPartitionResult& sorted, ValueSelector&& value_sel
       *it |= kDuplicateMask;
     }
   }
+  return Status::OK();
 }
 
 template <typename ArrowType>
@@ -71,18 +103,34 @@ Result<NullPartitionResult> DoSortAndMarkDuplicate(
   using GetView = GetViewType<ArrowType>;
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
 
-  ARROW_ASSIGN_OR_RAISE(auto array_sorter, GetArraySorter(*physical_type));
-
   ArrayType array(input.data());
-  ARROW_ASSIGN_OR_RAISE(auto sorted,
-                        array_sorter(indices_begin, indices_end, array, 0,
-                                     ArraySortOptions(order, null_placement), ctx));
+  NullPartitionResult sorted;
+  auto* executor = GetSortExecutor(ctx);
+  const int num_parts = NumRankParts(executor, input.length());
+  if (num_parts > 1) {
+    // Sort slices in parallel and merge them, like the chunks of a chunked array
+    auto physical_array = GetPhysicalArray(input, physical_type);
+    ArrayVector slices;
+    for (int part = 0; part < num_parts; ++part) {
+      const int64_t begin = input.length() * part / num_parts;
+      const int64_t end = input.length() * (part + 1) / num_parts;
+      slices.push_back(physical_array->Slice(begin, end - begin));
+    }
+    ARROW_ASSIGN_OR_RAISE(sorted,
+                          SortChunkedArray(ctx, indices_begin, indices_end, physical_type,
+                                           slices, order, null_placement));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(auto array_sorter, GetArraySorter(*physical_type));
+    ARROW_ASSIGN_OR_RAISE(sorted,
+                          array_sorter(indices_begin, indices_end, array, 0,
+                                       ArraySortOptions(order, null_placement), ctx));
+  }
 
   if (needs_duplicates) {
     auto value_selector = [&array](int64_t index) {
       return GetView::LogicalValue(array.GetView(index));
     };
-    MarkDuplicates(sorted, value_selector);
+    RETURN_NOT_OK(MarkDuplicates(sorted, value_selector, executor));
   }
   return sorted;
 }
@@ -104,7 +152,7 @@ Result<NullPartitionResult> DoSortAndMarkDuplicate(
     auto value_selector = [resolver = ChunkedArrayResolver(span(arrays))](int64_t index) {
       return resolver.Resolve(index).Value<ArrowType>();
     };
-    MarkDuplicates(sorted, value_selector);
+    RETURN_NOT_OK(MarkDuplicates(sorted, value_selector, GetSortExecutor(ctx)));
   }
   return sorted;
 }
@@ -155,6 +203,42 @@ class SortAndMarkDuplicate : public TypeVisitor {
   NullPartitionResult sorted_{};
 };
 
+// The sorted indices split in parts which start runs of duplicates, so that
+// rankings can be computed for each part independently, in parallel
+class RankParts {
+ public:
+  RankParts(ExecContext* ctx, const NullPartitionResult& sorted)
+      : executor_(GetSortExecutor(ctx)) {
+    const int64_t length = sorted.overall_end() - sorted.overall_begin();
+    const int num_parts = NumRankParts(executor_, length);
+    bounds_.push_back(sorted.overall_begin());
+    for (int part = 1; part < num_parts; ++part) {
+      auto it = std::max(bounds_.back(),
+                         sorted.overall_begin() + length * part / num_parts);
+      while (it < sorted.overall_end() && (*it & kDuplicateMask) != 0) {
+        ++it;
+      }
+      bounds_.push_back(it);
+    }
+    bounds_.push_back(sorted.overall_end());
+  }
+
+  int size() const { return static_cast<int>(bounds_.size()) - 1; }
+
+  // Call `func(part, begin, end)` for each part
+  template <typename Function>
+  Status Visit(Function&& func) const {
+    return SortParallelFor(executor_, size(), [&](int part) {
+      func(part, bounds_[part], bounds_[part + 1]);
+      return Status::OK();
+    });
+  }
+
+ private:
+  ::arrow::internal::Executor* executor_;
+  std::vector<uint64_t*> bounds_;
+};
+
 // A CRTP-based helper class for "rank_normal" and "rank_quantile"
 template <typename Derived>
 struct BaseQuantileRanker {
@@ -167,27 +251,26 @@ struct BaseQuantileRanker {
     auto is_duplicate = [](uint64_t index) { return (index & kDuplicateMask) != 0; };
     auto original_index = [](uint64_t index) { return index & ~kDuplicateMask; };
 
-    // The count of values strictly less than the value being considered
-    int64_t cum_freq = 0;
-    auto it = sorted.overall_begin();
-
-    while (it < sorted.overall_end()) {
-      // Look for a run of duplicate values
-      DCHECK(!is_duplicate(*it));
-      auto run_end = it;
-      while (++run_end < sorted.overall_end() && is_duplicate(*run_end)) {
-      }
-      // The run length, i.e. the frequency of the current value
-      int64_t freq = run_end - it;
-      const double quantile = (cum_freq + 0.5 * freq) / static_cast<double>(length);
-      const double value = Derived::TransformValue(quantile);
-      // Output quantile rank values
-      for (; it < run_end; ++it) {
-        out_begin[original_index(*it)] = value;
+    RETURN_NOT_OK(RankParts(ctx, sorted).Visit([&](int, uint64_t* it, uint64_t* end) {
+      // The count of values strictly less than the value being considered
+      int64_t cum_freq = it - sorted.overall_begin();
+      while (it < end) {
+        // Look for a run of duplicate values
+        DCHECK(!is_duplicate(*it));
+        auto run_end = it;
+        while (++run_end < end && is_duplicate(*run_end)) {
+        }
+        // The run length, i.e. the frequency of the current value
+        int64_t freq = run_end - it;
+        const double quantile = (cum_freq + 0.5 * freq) / static_cast<double>(length);
+        const double value = Derived::TransformValue(quantile);
+        // Output quantile rank values
+        for (; it < run_end; ++it) {
+          out_begin[original_index(*it)] = value;
+        }
+        cum_freq += freq;
       }
-      cum_freq += freq;
-    }
-    DCHECK_EQ(cum_freq, length);
+    }));
     return Datum(rankings);
   }
 };
@@ -213,55 +296,71 @@ struct OrdinalRanker {
     ARROW_ASSIGN_OR_RAISE(auto rankings,
                           MakeMutableUInt64Array(length, ctx->memory_pool()));
     auto out_begin = rankings->GetMutableValues<uint64_t>(1);
-    uint64_t rank;
+    const auto sorted_begin = sorted.overall_begin();
 
     auto is_duplicate = [](uint64_t index) { return (index & kDuplicateMask) != 0; };
     auto original_index = [](uint64_t index) { return index & ~kDuplicateMask; };
 
+    const RankParts parts(ctx, sorted);
     switch (tiebreaker_) {
       case RankOptions::Dense: {
-        rank = 0;
-        for (auto it = sorted.overall_begin(); it < sorted.overall_end(); ++it) {
-          if (!is_duplicate(*it)) {
-            ++rank;
+        // The dense rank preceding each part is the number of distinct values in
+        // the previous parts
+        std::vector<uint64_t> part_ranks(parts.size() + 1, 0);
+        RETURN_NOT_OK(parts.Visit([&](int part, uint64_t* begin, uint64_t* end) {
+          part_ranks[part + 1] = std::count_if(
+              begin, end, [&](uint64_t index) { return !is_duplicate(index); });
+        }));
+        std::partial_sum(part_ranks.begin(), part_ranks.end(), part_ranks.begin());
+        RETURN_NOT_OK(parts.Visit([&](int part, uint64_t* begin, uint64_t* end) {
+          uint64_t rank = part_ranks[part];
+          for (auto it = begin; it < end; ++it) {
+            if (!is_duplicate(*it)) {
+              ++rank;
+            }
+            out_begin[original_index(*it)] = rank;
           }
-          out_begin[original_index(*it)] = rank;
-        }
+        }));
         break;
       }
 
       case RankOptions::First: {
-        rank = 0;
-        for (auto it = sorted.overall_begin(); it < sorted.overall_end(); it++) {
-          // No duplicate marks expected for RankOptions::First
-          DCHECK(!is_duplicate(*it));
-          out_begin[*it] = ++rank;
-        }
+        RETURN_NOT_OK(parts.Visit([&](int, uint64_t* begin, uint64_t* end) {
+          for (auto it = begin; it < end; it++) {
+            // No duplicate marks expected for RankOptions::First
+            DCHECK(!is_duplicate(*it));
+            out_begin[*it] = (it - sorted_begin) + 1;
+          }
+        }));
         break;
       }
 
       case RankOptions::Min: {
-        rank = 0;
-        for (auto it = sorted.overall_begin(); it < sorted.overall_end(); ++it) {
-          if (!is_duplicate(*it)) {
-            rank = (it - sorted.overall_begin()) + 1;
+        RETURN_NOT_OK(parts.Visit([&](int, uint64_t* begin, uint64_t* end) {
+          uint64_t rank = 0;
+          for (auto it = begin; it < end; ++it) {
+            if (!is_duplicate(*it)) {
+              rank = (it - sorted_begin) + 1;
+            }
+            out_begin[original_index(*it)] = rank;
           }
-          out_begin[original_index(*it)] = rank;
-        }
+        }));
         break;
       }
 
       case RankOptions::Max: {
-        rank = length;
-        for (auto it = sorted.overall_end() - 1; it >= sorted.overall_begin(); --it) {
-          out_begin[original_index(*it)] = rank;
-          // If the current index isn't marked as duplicate, then it's the last
-          // tie in a row (since we iterate in reverse order), so update rank
-          // for the next row of ties.
-          if (!is_duplicate(*it)) {
-            rank = it - sorted.overall_begin();
+        RETURN_NOT_OK(parts.Visit([&](int, uint64_t* begin, uint64_t* end) {
+          uint64_t rank = end - sorted_begin;
+          for (auto it = end - 1; it >= begin; --it) {
+            out_begin[original_index(*it)] = rank;
+            // If the current index isn't marked as duplicate, then it's the last
+            // tie in a row (since we iterate in reverse order), so update rank
+            // for the next row of ties.
+            if (!is_duplicate(*it)) {
+              rank = it - sorted_begin;
+            }
           }
-        }
+        }));
         break;
       }
     }
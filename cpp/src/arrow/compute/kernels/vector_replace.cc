@@ -73,37 +73,41 @@ int64_t ReplaceMaskArrayImpl(const ArraySpan& array, const ArraySpan& mask,
   arrow::internal::OptionalBinaryBitBlockCounter counter(
       mask_values, mask.offset + mask_offset, mask_bitmap, mask.offset + mask_offset,
       std::min(mask.length, array.length));
+  // Copy a run of selected slots from the next replacements
+  auto copy_run = [&](int64_t position, int64_t length) {
+    CopyDataUtils<Type>::CopyData(*array.type, replacements, replacements_offset,
+                                  out_values, out_offset + position, length);
+    if (replacements_bitmap) {
+      copy_bitmap.CopyBitmap(out_bitmap, out_offset + position, replacements_offset,
+                             length);
+    } else if (out_bitmap) {
+      bit_util::SetBitsTo(out_bitmap, out_offset + position, length, true);
+    }
+    replacements_offset += length;
+  };
   int64_t write_offset = 0;
   while (write_offset < array.length) {
     BitBlockCount block = counter.NextAndBlock();
     if (block.AllSet()) {
-      // Copy from replacement array
-      CopyDataUtils<Type>::CopyData(*array.type, replacements, replacements_offset,
-                                    out_values, out_offset + write_offset, block.length);
-
-      if (replacements_bitmap) {
-        copy_bitmap.CopyBitmap(out_bitmap, out_offset + write_offset, replacements_offset,
-                               block.length);
-      } else if (out_bitmap) {
-        bit_util::SetBitsTo(out_bitmap, out_offset + write_offset, block.length, true);
-      }
-      replacements_offset += block.length;
+      copy_run(write_offset, block.length);
     } else if (block.popcount) {
-      for (int64_t i = 0; i < block.length; ++i) {
-        if (bit_util::GetBit(mask_values, write_offset + mask.offset + mask_offset + i) &&
-            (!mask_bitmap || bit_util::GetBit(mask_bitmap, write_offset + mask.offset +
-                                                               mask_offset + i))) {
-          CopyDataUtils<Type>::CopyData(*array.type, replacements, replacements_offset,
-                                        out_values, out_offset + write_offset + i,
-                                        /*length=*/1);
-          if (replacements_bitmap) {
-            copy_bitmap.SetBit(out_bitmap, out_offset + write_offset + i,
-                               replacements_offset);
-          } else if (out_bitmap) {
-            bit_util::SetBitTo(out_bitmap, out_offset + write_offset + i, true);
-          }
-          replacements_offset++;
-        }
+      // Gather the selected slots of the block into a word, and copy each run of
+      // them at once rather than testing the mask bit by bit
+      const int64_t mask_position = write_offset + mask.offset + mask_offset;
+      uint64_t selected = 0;
+      auto selected_bitmap = reinterpret_cast<uint8_t*>(&selected);
+      if (mask_bitmap) {
+        arrow::internal::BitmapAnd(mask_values, mask_position, mask_bitmap,
+                                   mask_position, block.length, /*out_offset=*/0,
+                                   selected_bitmap);
+      } else {
+        arrow::internal::CopyBitmap(mask_values, mask_position, block.length,
+                                    selected_bitmap, /*dest_offset=*/0);
+      }
+      arrow::internal::SetBitRunReader reader(selected_bitmap, /*start_offset=*/0,
+                                              block.length);
+      for (auto run = reader.NextRun(); run.length > 0; run = reader.NextRun()) {
+        copy_run(write_offset + run.position, run.length);
       }
     }
     write_offset += block.length;
@@ -446,11 +450,32 @@ struct ReplaceMaskChunked {
   }
 };
 
+// Set `length` slots of `out` from `out_offset` to the value at `in_offset` of `in`
+template <typename Type>
+void BroadcastValue(const ArraySpan& in, int64_t in_offset, uint8_t* out,
+                    int64_t out_offset, int64_t length) {
+  if constexpr (is_boolean_type<Type>::value) {
+    bit_util::SetBitsTo(out, out_offset, length,
+                        bit_util::GetBit(in.buffers[1].data, in.offset + in_offset));
+  } else if constexpr (has_c_type<Type>::value) {
+    using CType = typename TypeTraits<Type>::CType;
+    const CType value = in.GetValues<CType>(1)[in_offset];
+    CType* begin = reinterpret_cast<CType*>(out) + out_offset;
+    std::fill(begin, begin + length, value);
+  } else {
+    const int64_t width = in.type->byte_width();
+    const uint8_t* value = in.buffers[1].data + (in.offset + in_offset) * width;
+    uint8_t* begin = out + out_offset * width;
+    for (int64_t i = 0; i < length; ++i) {
+      std::memcpy(begin + i * width, value, width);
+    }
+  }
+}
+
 // This is for fixed-size types only
 template <typename Type>
-void FillNullInDirectionImpl(const ArraySpan& current_chunk, const uint8_t* null_bitmap,
-                             ExecResult* out, int8_t direction,
-                             const ArraySpan& last_valid_value_chunk,
+void FillNullInDirectionImpl(const ArraySpan& current_chunk, ExecResult* out,
+                             int8_t direction, const ArraySpan& last_valid_value_chunk,
                              int64_t* last_valid_value_offset) {
   ArrayData* out_arr = out->array_data().get();
   uint8_t* out_bitmap = out_arr->buffers[0]->mutable_data();
@@ -461,55 +486,41 @@ void FillNullInDirectionImpl(const ArraySpan& current_chunk, const uint8_t* null
                                 out_values, /*out_offset=*/out_arr->offset,
                                 current_chunk.length);
 
-  bool has_fill_value = *last_valid_value_offset != -1;
-  int64_t write_offset = direction == 1 ? 0 : current_chunk.length - 1;
-  int64_t bitmap_offset = 0;
-
-  arrow::internal::OptionalBitBlockCounter counter(null_bitmap, out_arr->offset,
+  // The runs of valid values are found a word at a time, and each run of nulls
+  // between them is filled at once with the last valid value seen
+  const ArraySpan* fill_chunk = &last_valid_value_chunk;
+  auto fill_nulls = [&](int64_t position, int64_t length) {
+    if (*last_valid_value_offset == -1 || length == 0) {
+      return;
+    }
+    BroadcastValue<Type>(*fill_chunk, *last_valid_value_offset, out_values,
+                         out_arr->offset + position, length);
+    bit_util::SetBitsTo(out_bitmap, out_arr->offset + position, length, true);
+  };
+  const uint8_t* bitmap = current_chunk.buffers[0].data;
+  if (direction == 1) {
+    arrow::internal::SetBitRunReader reader(bitmap, current_chunk.offset,
+                                            current_chunk.length);
+    int64_t position = 0;
+    for (auto run = reader.NextRun(); run.length > 0; run = reader.NextRun()) {
+      fill_nulls(position, run.position - position);
+      position = run.position + run.length;
+      fill_chunk = &current_chunk;
+      *last_valid_value_offset = position - 1;
+    }
+    fill_nulls(position, current_chunk.length - position);
+  } else {
+    arrow::internal::ReverseSetBitRunReader reader(bitmap, current_chunk.offset,
                                                    current_chunk.length);
-  bool use_current_chunk = false;
-  while (bitmap_offset < current_chunk.length) {
-    BitBlockCount block = counter.NextBlock();
-    if (block.AllSet()) {
-      *last_valid_value_offset =
-          write_offset + direction * (block.length - 1 + bitmap_offset);
-      has_fill_value = true;
-      use_current_chunk = true;
-    } else {
-      uint64_t block_start_offset = write_offset + direction * bitmap_offset;
-      uint64_t write_value_offset = block_start_offset;
-      if (block.popcount) {
-        for (int64_t i = 0; i < block.length; i++, write_value_offset += direction) {
-          auto current_bit = bit_util::GetBit(null_bitmap, bitmap_offset + i);
-          if (!current_bit) {
-            if (has_fill_value) {
-              CopyDataUtils<Type>::CopyData(
-                  *current_chunk.type,
-                  use_current_chunk ? current_chunk : last_valid_value_chunk,
-                  *last_valid_value_offset, out_values, write_value_offset,
-                  /*length=*/1);
-              bit_util::SetBitTo(out_bitmap, write_value_offset, true);
-            }
-          } else {
-            has_fill_value = true;
-            use_current_chunk = true;
-            *last_valid_value_offset = write_value_offset;
-          }
-        }
-      } else {
-        for (int64_t i = 0; i < block.length; i++, write_value_offset += direction) {
-          if (has_fill_value) {
-            CopyDataUtils<Type>::CopyData(
-                *current_chunk.type,
-                use_current_chunk ? current_chunk : last_valid_value_chunk,
-                *last_valid_value_offset, out_values, write_value_offset,
-                /*length=*/1);
-            bit_util::SetBitTo(out_bitmap, write_value_offset, true);
-          }
-        }
-      }
+    int64_t end = current_chunk.length;
+    for (auto run = reader.NextRun(); run.length > 0; run = reader.NextRun()) {
+      const int64_t run_end = run.position + run.length;
+      fill_nulls(run_end, end - run_end);
+      end = run.position;
+      fill_chunk = &current_chunk;
+      *last_valid_value_offset = run.position;
     }
-    bitmap_offset += block.length;
+    fill_nulls(0, end);
   }
   out_arr->null_count = kUnknownNullCount;
 }
@@ -523,12 +534,11 @@ struct FillNullImpl<
     enable_if_t<is_number_type<Type>::value || is_boolean_type<Type>::value ||
                 is_boolean_type<Type>::value || is_fixed_size_binary_type<Type>::value ||
                 std::is_same<Type, MonthDayNanoIntervalType>::value>> {
-  static Status Exec(KernelContext* ctx, const ArraySpan& array,
-                     const uint8_t* reversed_bitmap, ExecResult* out, int8_t direction,
-                     const ArraySpan& last_valid_value_chunk,
+  static Status Exec(KernelContext* ctx, const ArraySpan& array, ExecResult* out,
+                     int8_t direction, const ArraySpan& last_valid_value_chunk,
                      int64_t* last_valid_value_offset) {
-    FillNullInDirectionImpl<Type>(array, reversed_bitmap, out, direction,
-                                  last_valid_value_chunk, last_valid_value_offset);
+    FillNullInDirectionImpl<Type>(array, out, direction, last_valid_value_chunk,
+                                  last_valid_value_offset);
     return Status::OK();
   }
 };
@@ -539,10 +549,21 @@ struct FillNullImpl<Type, enable_if_base_binary<Type>> {
   using BuilderType = typename TypeTraits<Type>::BuilderType;
 
   static Status Exec(KernelContext* ctx, const ArraySpan& current_chunk,
-                     const uint8_t* reversed_bitmap, ExecResult* out, int8_t direction,
+                     ExecResult* out, int8_t direction,
                      const ArraySpan& last_valid_value_chunk,
                      int64_t* last_valid_value_offset) {
-    ArrayData* out_arr = out->array_data().get();
+    // The validity bitmap is visited in the direction of the fill
+    const uint8_t* bitmap = current_chunk.buffers[0].data;
+    int64_t bitmap_offset = current_chunk.offset;
+    std::shared_ptr<Buffer> reversed_bitmap;
+    if (direction == -1) {
+      ARROW_ASSIGN_OR_RAISE(
+          reversed_bitmap,
+          arrow::internal::ReverseBitmap(ctx->memory_pool(), bitmap,
+                                         current_chunk.offset, current_chunk.length));
+      bitmap = reversed_bitmap->data();
+      bitmap_offset = 0;
+    }
 
     BuilderType builder(current_chunk.type->GetSharedPtr(), ctx->memory_pool());
     RETURN_NOT_OK(builder.Reserve(current_chunk.length));
@@ -558,11 +579,9 @@ struct FillNullImpl<Type, enable_if_base_binary<Type>> {
     /*tuple for store: <use current_chunk(true) or last_valid_chunk(false),
      * start offset of the current value, end offset for the current value>*/
 
-    // TODO(wesm): using out_arr->offset here is a bit ugly because we
-    // discard it later in the function
     std::vector<std::tuple<bool, offset_type, offset_type>> offsets_reversed;
     RETURN_NOT_OK(VisitNullBitmapInline<>(
-        reversed_bitmap, out_arr->offset, current_chunk.length,
+        bitmap, bitmap_offset, current_chunk.length,
         current_chunk.GetNullCount(),
         [&]() {
           const offset_type offset0 = offsets[array_value_index];
@@ -626,9 +645,8 @@ struct FillNullImpl<Type, enable_if_base_binary<Type>> {
 
 template <typename Type>
 struct FillNullImpl<Type, enable_if_null<Type>> {
-  static Status Exec(KernelContext* ctx, const ArraySpan& array,
-                     const uint8_t* reversed_bitmap, ExecResult* out, int8_t direction,
-                     const ArraySpan& last_valid_value_chunk,
+  static Status Exec(KernelContext* ctx, const ArraySpan& array, ExecResult* out,
+                     int8_t direction, const ArraySpan& last_valid_value_chunk,
                      int64_t* last_valid_value_offset) {
     out->value = array.ToArrayData();
     return Status::OK();
@@ -650,12 +668,8 @@ struct FillNullForward {
     output->length = array.length;
     int8_t direction = 1;
     if (array.MayHaveNulls()) {
-      ARROW_ASSIGN_OR_RAISE(
-          auto null_bitmap,
-          arrow::internal::CopyBitmap(ctx->memory_pool(), array.buffers[0].data,
-                                      array.offset, array.length));
-      return FillNullImpl<Type>::Exec(ctx, array, null_bitmap->data(), out, direction,
-                                      last_valid_value_chunk, last_valid_value_offset);
+      return FillNullImpl<Type>::Exec(ctx, array, out, direction, last_valid_value_chunk,
+                                      last_valid_value_offset);
     } else {
       // TODO(wesm): zero copy optimization is a bit ugly...
       if (array.length > 0) {
@@ -730,12 +744,8 @@ struct FillNullBackward {
     int8_t direction = -1;
 
     if (array.MayHaveNulls()) {
-      ARROW_ASSIGN_OR_RAISE(
-          auto reversed_bitmap,
-          arrow::internal::ReverseBitmap(ctx->memory_pool(), array.buffers[0].data,
-                                         array.offset, array.length));
-      return FillNullImpl<Type>::Exec(ctx, array, reversed_bitmap->data(), out, direction,
-                                      last_valid_value_chunk, last_valid_value_offset);
+      return FillNullImpl<Type>::Exec(ctx, array, out, direction, last_valid_value_chunk,
+                                      last_valid_value_offset);
     } else {
       // Zero copy optimization
       if (array.length > 0) {
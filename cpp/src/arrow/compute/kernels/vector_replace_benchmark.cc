@@ -81,10 +81,69 @@ static void ReplaceWithMaskHighSelectivityBench(
   state.SetBytesProcessed(state.iterations() * (len - offset) * 8);
 }
 
+// Replace values with a mask whose true slots have the given proportion, in
+// thousandths
+static void ReplaceWithMaskDensityBench(
+    benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator generator(kRandomSeed);
+  const int64_t len = state.range(0);
+  const double true_probability = static_cast<double>(state.range(1)) / 1000;
+
+  auto values =
+      generator.Int64(len, /*min=*/-65536, /*max=*/65536, /*null_probability=*/0.1);
+  auto mask = checked_pointer_cast<BooleanArray>(
+      generator.Boolean(len, true_probability, /*null_probability=*/0));
+  auto replacements = MakeReplacements(&generator, *mask);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(ReplaceWithMask(values, mask, replacements));
+  }
+  state.SetBytesProcessed(state.iterations() * len * 8);
+}
+
+// Fill the nulls of values whose nulls have the given proportion, in thousandths
+template <bool Forward>
+static void FillNullBench(benchmark::State& state) {  // NOLINT non-const reference
+  random::RandomArrayGenerator generator(kRandomSeed);
+  const int64_t len = state.range(0);
+  const double null_probability = static_cast<double>(state.range(1)) / 1000;
+
+  auto values = generator.Int64(len, /*min=*/-65536, /*max=*/65536, null_probability);
+
+  for (auto _ : state) {
+    if (Forward) {
+      ABORT_NOT_OK(FillNullForward(values));
+    } else {
+      ABORT_NOT_OK(FillNullBackward(values));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * len * 8);
+}
+
+static void FillNullForwardBench(
+    benchmark::State& state) {  // NOLINT non-const reference
+  FillNullBench</*Forward=*/true>(state);
+}
+
+static void FillNullBackwardBench(
+    benchmark::State& state) {  // NOLINT non-const reference
+  FillNullBench</*Forward=*/false>(state);
+}
+
+// Sparse and dense distributions of nulls or of replaced slots
+static void DensityArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t density : {1, 100, 500, 900, 999}) {
+    bench->Args({kLongLength, density});
+  }
+}
+
 BENCHMARK(ReplaceWithMaskLowSelectivityBench)->Args({kLongLength, 0});
 BENCHMARK(ReplaceWithMaskLowSelectivityBench)->Args({kLongLength, 99});
 BENCHMARK(ReplaceWithMaskHighSelectivityBench)->Args({kLongLength, 0});
 BENCHMARK(ReplaceWithMaskHighSelectivityBench)->Args({kLongLength, 99});
+BENCHMARK(ReplaceWithMaskDensityBench)->Apply(DensityArgs);
+BENCHMARK(FillNullForwardBench)->Apply(DensityArgs);
+BENCHMARK(FillNullBackwardBench)->Apply(DensityArgs);
 
 }  // namespace compute
 }  // namespace arrow
@@ -28,6 +28,7 @@
 #include "arrow/util/key_value_metadata.h"
 
 #include <memory>
+#include <optional>
 
 namespace arrow {
 namespace compute {
@@ -1518,6 +1519,43 @@ TYPED_TEST(TestFillNullNumeric, FillNullBackwardLargeInput) {
   }
 }
 
+TYPED_TEST(TestFillNullNumeric, FillNullRandom) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+  using BuilderType = typename TypeTraits<TypeParam>::BuilderType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  const int64_t length = 1023;
+
+  // Sparse and dense nulls, so that the fill spans both short and long null runs
+  for (double null_probability : {0.01, 0.5, 0.99}) {
+    ARROW_SCOPED_TRACE("null_probability = ", null_probability);
+    auto array = rand.ArrayOf(this->type(), length, null_probability);
+    for (int64_t offset : {0, 5, 67}) {
+      auto sliced = checked_pointer_cast<ArrayType>(array->Slice(offset));
+      for (bool forward : {true, false}) {
+        std::vector<CType> values(sliced->length());
+        std::vector<bool> is_valid(sliced->length(), false);
+        std::optional<CType> fill_value;
+        for (int64_t j = 0; j < sliced->length(); ++j) {
+          const int64_t i = forward ? j : sliced->length() - 1 - j;
+          if (sliced->IsValid(i)) {
+            fill_value = sliced->Value(i);
+          }
+          if (fill_value) {
+            values[i] = *fill_value;
+            is_valid[i] = true;
+          }
+        }
+        BuilderType builder(this->type(), default_memory_pool());
+        ASSERT_OK(builder.AppendValues(values, is_valid));
+        ASSERT_OK_AND_ASSIGN(auto expected, builder.Finish());
+        this->AssertFillNullArray(forward ? FillNullForward : FillNullBackward, sliced,
+                                  expected);
+      }
+    }
+  }
+}
+
 TYPED_TEST(TestFillNullNumeric, FillNullForwardSliced) {
   if (std::is_same<TypeParam, Date64Type>::value) {
     auto first_input_array = this->array(
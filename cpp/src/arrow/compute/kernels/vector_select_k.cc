@@ -15,7 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <numeric>
 #include <queue>
+#include <vector>
 
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
@@ -164,6 +167,41 @@ struct TypedHeapItem {
   ArrayType* array;
 };
 
+// Keep in the max-heap `heap` the first `k` items according to `cmp`
+template <typename T, typename Compare>
+void PushBounded(std::vector<T>* heap, int64_t k, const T& item, const Compare& cmp) {
+  if (static_cast<int64_t>(heap->size()) < k) {
+    heap->push_back(item);
+    std::push_heap(heap->begin(), heap->end(), cmp);
+  } else if (k > 0 && cmp(item, heap->front())) {
+    std::pop_heap(heap->begin(), heap->end(), cmp);
+    heap->back() = item;
+    std::push_heap(heap->begin(), heap->end(), cmp);
+  }
+}
+
+// Select the first `k` items according to `cmp` among the candidates selected from
+// each part of the input, and return their indices in order
+template <typename T, typename Compare, typename GetIndex>
+Result<Datum> MergeSelected(const std::vector<std::vector<T>>& candidates, int64_t k,
+                            const Compare& cmp, const GetIndex& get_index,
+                            MemoryPool* pool) {
+  std::vector<T> heap;
+  for (const auto& part_candidates : candidates) {
+    for (const auto& item : part_candidates) {
+      PushBounded(&heap, k, item, cmp);
+    }
+  }
+  std::sort_heap(heap.begin(), heap.end(), cmp);
+  ARROW_ASSIGN_OR_RAISE(auto take_indices,
+                        MakeMutableUInt64Array(static_cast<int64_t>(heap.size()), pool));
+  auto* out = take_indices->GetMutableValues<uint64_t>(1);
+  for (const auto& item : heap) {
+    *out++ = get_index(item);
+  }
+  return Datum(take_indices);
+}
+
 class ChunkedArraySelector : public TypeVisitor {
  public:
   ChunkedArraySelector(ExecContext* ctx, const ChunkedArray& chunked_array,
@@ -203,64 +241,49 @@ class ChunkedArraySelector : public TypeVisitor {
     if (k_ > chunked_array_.length()) {
       k_ = chunked_array_.length();
     }
-    std::function<bool(const HeapItem&, const HeapItem&)> cmp;
     SelectKComparator<sort_order> comparator;
-
-    cmp = [&comparator](const HeapItem& left, const HeapItem& right) -> bool {
+    auto cmp = [&comparator](const HeapItem& left, const HeapItem& right) -> bool {
       const auto lval = GetView::LogicalValue(left.array->GetView(left.index));
       const auto rval = GetView::LogicalValue(right.array->GetView(right.index));
       return comparator(lval, rval);
     };
-    using HeapContainer =
-        std::priority_queue<HeapItem, std::vector<HeapItem>, decltype(cmp)>;
 
-    HeapContainer heap(cmp);
-    std::vector<std::shared_ptr<ArrayType>> chunks_holder;
+    std::vector<std::shared_ptr<ArrayType>> chunks;
+    std::vector<uint64_t> offsets;
     uint64_t offset = 0;
     for (const auto& chunk : physical_chunks_) {
-      if (chunk->length() == 0) continue;
-      chunks_holder.emplace_back(std::make_shared<ArrayType>(chunk->data()));
-      ArrayType& arr = *chunks_holder[chunks_holder.size() - 1];
-
-      std::vector<uint64_t> indices(arr.length());
-      uint64_t* indices_begin = indices.data();
-      uint64_t* indices_end = indices_begin + indices.size();
-      std::iota(indices_begin, indices_end, 0);
-
-      const auto p = PartitionNulls<ArrayType, NonStablePartitioner>(
-          indices_begin, indices_end, arr, 0, NullPlacement::AtEnd);
-      const auto end_iter = p.non_nulls_end;
-
-      auto kth_begin = std::min(indices_begin + k_, end_iter);
-      uint64_t* iter = indices_begin;
-      for (; iter != kth_begin && heap.size() < static_cast<size_t>(k_); ++iter) {
-        heap.push(HeapItem{*iter, offset, &arr});
-      }
-      for (; iter != end_iter && !heap.empty(); ++iter) {
-        uint64_t x_index = *iter;
-        const auto& xval = GetView::LogicalValue(arr.GetView(x_index));
-        auto top_item = heap.top();
-        const auto& top_value =
-            GetView::LogicalValue(top_item.array->GetView(top_item.index));
-        if (comparator(xval, top_value)) {
-          heap.pop();
-          heap.push(HeapItem{x_index, offset, &arr});
-        }
+      if (chunk->length() > 0) {
+        chunks.push_back(std::make_shared<ArrayType>(chunk->data()));
+        offsets.push_back(offset);
       }
       offset += chunk->length();
     }
 
-    auto out_size = static_cast<int64_t>(heap.size());
-    ARROW_ASSIGN_OR_RAISE(auto take_indices,
-                          MakeMutableUInt64Array(out_size, ctx_->memory_pool()));
-    auto* out_cbegin = take_indices->GetMutableValues<uint64_t>(1) + out_size - 1;
-    while (heap.size() > 0) {
-      auto top_item = heap.top();
-      *out_cbegin = top_item.index + top_item.offset;
-      heap.pop();
-      --out_cbegin;
-    }
-    *output_ = Datum(take_indices);
+    // Select the first k values of each chunk, in parallel if the ExecContext
+    // allows it, then the first k values among those
+    std::vector<std::vector<HeapItem>> candidates(chunks.size());
+    RETURN_NOT_OK(SortParallelFor(
+        GetSortExecutor(ctx_), static_cast<int>(chunks.size()), [&](int i) {
+          ArrayType& arr = *chunks[i];
+          std::vector<uint64_t> indices(arr.length());
+          uint64_t* indices_begin = indices.data();
+          uint64_t* indices_end = indices_begin + indices.size();
+          std::iota(indices_begin, indices_end, 0);
+
+          const auto p = PartitionNulls<ArrayType, NonStablePartitioner>(
+              indices_begin, indices_end, arr, 0, NullPlacement::AtEnd);
+          auto& heap = candidates[i];
+          for (auto iter = indices_begin; iter != p.non_nulls_end; ++iter) {
+            PushBounded(&heap, k_, HeapItem{*iter, offsets[i], &arr}, cmp);
+          }
+          return Status::OK();
+        }));
+
+    ARROW_ASSIGN_OR_RAISE(
+        *output_, MergeSelected(
+                      candidates, k_, cmp,
+                      [](const HeapItem& item) { return item.index + item.offset; },
+                      ctx_->memory_pool()));
     return Status::OK();
   }
 
@@ -464,10 +487,11 @@ class TableSelector : public TypeVisitor {
                                              const ResolvedSortKey& first_sort_key) {
     using ArrayType = typename TypeTraits<Type>::ArrayType;
 
+    // The indices may only cover part of the table
     const auto p = PartitionNullsOnly<StablePartitioner>(
         indices_begin, indices_end, first_sort_key.resolver, first_sort_key.null_count,
         NullPlacement::AtEnd);
-    DCHECK_EQ(p.nulls_end - p.nulls_begin, first_sort_key.null_count);
+    DCHECK_LE(p.nulls_end - p.nulls_begin, first_sort_key.null_count);
 
     const auto q = PartitionNullLikes<ArrayType, StablePartitioner>(
         p.non_nulls_begin, p.non_nulls_end, first_sort_key.resolver,
@@ -488,7 +512,7 @@ class TableSelector : public TypeVisitor {
 
   // XXX this implementation is rather inefficient as it computes chunk indices
   // at every comparison.  Instead we should iterate over individual batches
-  // and remember ChunkLocation entries in the max-heap.
+  // and remember ChunkLocation entries in the max-heaps.
 
   template <typename InType, SortOrder sort_order>
   Status SelectKthInternal() {
@@ -502,9 +526,8 @@ class TableSelector : public TypeVisitor {
     if (k_ > table_.num_rows()) {
       k_ = table_.num_rows();
     }
-    std::function<bool(const uint64_t&, const uint64_t&)> cmp;
     SelectKComparator<sort_order> select_k_comparator;
-    cmp = [&](const uint64_t& left, const uint64_t& right) -> bool {
+    auto cmp = [&](const uint64_t& left, const uint64_t& right) -> bool {
       auto chunk_left = first_sort_key.GetChunk(left);
       auto chunk_right = first_sort_key.GetChunk(right);
       auto value_left = chunk_left.Value<InType>();
@@ -514,38 +537,36 @@ class TableSelector : public TypeVisitor {
       }
       return select_k_comparator(value_left, value_right);
     };
-    using HeapContainer =
-        std::priority_queue<uint64_t, std::vector<uint64_t>, decltype(cmp)>;
 
-    std::vector<uint64_t> indices(num_rows);
-    uint64_t* indices_begin = indices.data();
-    uint64_t* indices_end = indices_begin + indices.size();
-    std::iota(indices_begin, indices_end, 0);
-
-    const auto p =
-        this->PartitionNullsInternal<InType>(indices_begin, indices_end, first_sort_key);
-    const auto end_iter = p.non_nulls_end;
-    auto kth_begin = std::min(indices_begin + k_, end_iter);
-
-    HeapContainer heap(indices_begin, kth_begin, cmp);
-    for (auto iter = kth_begin; iter != end_iter && !heap.empty(); ++iter) {
-      uint64_t x_index = *iter;
-      uint64_t top_item = heap.top();
-      if (cmp(x_index, top_item)) {
-        heap.pop();
-        heap.push(x_index);
+    // Select the first k rows of each chunk of the first sort key, in parallel if
+    // the ExecContext allows it, then the first k rows among those
+    std::vector<int64_t> offsets = {0};
+    for (const auto& chunk : first_sort_key.chunks) {
+      if (chunk->length() > 0) {
+        offsets.push_back(offsets.back() + chunk->length());
       }
     }
-    auto out_size = static_cast<int64_t>(heap.size());
-    ARROW_ASSIGN_OR_RAISE(auto take_indices,
-                          MakeMutableUInt64Array(out_size, ctx_->memory_pool()));
-    auto* out_cbegin = take_indices->GetMutableValues<uint64_t>(1) + out_size - 1;
-    while (heap.size() > 0) {
-      *out_cbegin = heap.top();
-      heap.pop();
-      --out_cbegin;
-    }
-    *output_ = Datum(take_indices);
+    const int num_parts = static_cast<int>(offsets.size()) - 1;
+    std::vector<std::vector<uint64_t>> candidates(num_parts);
+    RETURN_NOT_OK(SortParallelFor(GetSortExecutor(ctx_), num_parts, [&](int i) {
+      std::vector<uint64_t> indices(offsets[i + 1] - offsets[i]);
+      uint64_t* indices_begin = indices.data();
+      uint64_t* indices_end = indices_begin + indices.size();
+      std::iota(indices_begin, indices_end, offsets[i]);
+
+      const auto p = this->PartitionNullsInternal<InType>(indices_begin, indices_end,
+                                                          first_sort_key);
+      auto& heap = candidates[i];
+      for (auto iter = indices_begin; iter != p.non_nulls_end; ++iter) {
+        PushBounded(&heap, k_, *iter, cmp);
+      }
+      return Status::OK();
+    }));
+
+    ARROW_ASSIGN_OR_RAISE(*output_,
+                          MergeSelected(
+                              candidates, k_, cmp, [](uint64_t index) { return index; },
+                              ctx_->memory_pool()));
     return Status::OK();
   }
 
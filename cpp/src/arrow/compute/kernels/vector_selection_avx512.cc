@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "arrow/compute/kernels/vector_selection_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/simd.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow::compute::internal {
+
+namespace {
+
+// Read the 64 bits of `bitmap` starting at an arbitrary bit offset
+inline uint64_t LoadBitmapWord(const uint8_t* bitmap, int64_t bit_offset) {
+  const uint8_t* bytes = bitmap + bit_offset / 8;
+  const int shift = static_cast<int>(bit_offset % 8);
+  uint64_t word = util::SafeLoadAs<uint64_t>(bytes);
+  if (shift != 0) {
+    word = (word >> shift) | (static_cast<uint64_t>(bytes[8]) << (64 - shift));
+  }
+  return word;
+}
+
+// Compress the 512-bit lanes of `values` selected by `mask` to `out`, return the
+// number of values written.  The masked store never writes past them.
+inline int CompressLanes(const uint32_t* values, __mmask16 mask, uint32_t* out) {
+  const __m512i selected = _mm512_maskz_compress_epi32(mask, _mm512_loadu_si512(values));
+  const int count = bit_util::PopCount(static_cast<uint64_t>(mask));
+  _mm512_mask_storeu_epi32(out, static_cast<__mmask16>((1U << count) - 1), selected);
+  return count;
+}
+
+inline int CompressLanes(const uint64_t* values, __mmask8 mask, uint64_t* out) {
+  const __m512i selected = _mm512_maskz_compress_epi64(mask, _mm512_loadu_si512(values));
+  const int count = bit_util::PopCount(static_cast<uint64_t>(mask));
+  _mm512_mask_storeu_epi64(out, static_cast<__mmask8>((1U << count) - 1), selected);
+  return count;
+}
+
+}  // namespace
+
+template <typename T>
+int64_t FilterValuesAvx512(const T* values, const uint8_t* filter, int64_t filter_offset,
+                           int64_t length, T* out) {
+  using Mask = std::conditional_t<sizeof(T) == 4, __mmask16, __mmask8>;
+  constexpr int kLanes = 64 / sizeof(T);
+
+  int64_t out_length = 0;
+  int64_t position = 0;
+  for (; position + 64 <= length; position += 64) {
+    const uint64_t word = LoadBitmapWord(filter, filter_offset + position);
+    if (word == 0) {
+      continue;
+    }
+    if (word == ~uint64_t{0}) {
+      memcpy(out + out_length, values + position, 64 * sizeof(T));
+      out_length += 64;
+      continue;
+    }
+    for (int lane = 0; lane < 64; lane += kLanes) {
+      const auto mask = static_cast<Mask>(word >> lane);
+      if (mask != 0) {
+        out_length += CompressLanes(values + position + lane, mask, out + out_length);
+      }
+    }
+  }
+  for (; position < length; ++position) {
+    if (bit_util::GetBit(filter, filter_offset + position)) {
+      out[out_length++] = values[position];
+    }
+  }
+  return out_length;
+}
+
+template <typename T, typename IndexCType>
+void TakeValuesAvx512(const T* values, const IndexCType* indices, int64_t length,
+                      T* out) {
+  // The masked gathers are used with a zeroed source since the unmasked ones trip
+  // -Wmaybe-uninitialized in some GCC versions
+  const __m512i zero = _mm512_setzero_si512();
+  int64_t position = 0;
+  if constexpr (sizeof(T) == 4 && sizeof(IndexCType) == 4) {
+    for (; position + 16 <= length; position += 16) {
+      const __m512i index = _mm512_loadu_si512(indices + position);
+      _mm512_storeu_si512(out + position,
+                          _mm512_mask_i32gather_epi32(zero, 0xFFFF, index, values, 4));
+    }
+  } else if constexpr (sizeof(T) == 4) {
+    for (; position + 8 <= length; position += 8) {
+      const __m512i index = _mm512_loadu_si512(indices + position);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + position),
+                          _mm512_mask_i64gather_epi32(_mm256_setzero_si256(), 0xFF,
+                                                      index, values, 4));
+    }
+  } else if constexpr (sizeof(IndexCType) == 4) {
+    for (; position + 8 <= length; position += 8) {
+      const __m256i index =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + position));
+      _mm512_storeu_si512(out + position,
+                          _mm512_mask_i32gather_epi64(zero, 0xFF, index, values, 8));
+    }
+  } else {
+    for (; position + 8 <= length; position += 8) {
+      const __m512i index = _mm512_loadu_si512(indices + position);
+      _mm512_storeu_si512(out + position,
+                          _mm512_mask_i64gather_epi64(zero, 0xFF, index, values, 8));
+    }
+  }
+  for (; position < length; ++position) {
+    out[position] = values[indices[position]];
+  }
+}
+
+template int64_t FilterValuesAvx512<uint32_t>(const uint32_t*, const uint8_t*, int64_t,
+                                              int64_t, uint32_t*);
+template int64_t FilterValuesAvx512<uint64_t>(const uint64_t*, const uint8_t*, int64_t,
+                                              int64_t, uint64_t*);
+
+template void TakeValuesAvx512<uint32_t, int32_t>(const uint32_t*, const int32_t*,
+                                                  int64_t, uint32_t*);
+template void TakeValuesAvx512<uint32_t, int64_t>(const uint32_t*, const int64_t*,
+                                                  int64_t, uint32_t*);
+template void TakeValuesAvx512<uint64_t, int32_t>(const uint64_t*, const int32_t*,
+                                                  int64_t, uint64_t*);
+template void TakeValuesAvx512<uint64_t, int64_t>(const uint64_t*, const int64_t*,
+                                                  int64_t, uint64_t*);
+
+}  // namespace arrow::compute::internal
@@ -148,6 +148,11 @@ struct TakeBenchmark {
     return std::make_shared<ChunkedArray>(std::move(chunks));
   }
 
+  void Int32() {
+    auto values = rand.Int32(args.size, -100, 100, args.null_proportion);
+    Bench(values);
+  }
+
   void Int64() {
     auto values = rand.Int64(args.size, -100, 100, args.null_proportion);
     Bench(values);
@@ -277,6 +282,12 @@ struct FilterBenchmark {
         rand(kSeed),
         filter_has_nulls(filter_has_nulls) {}
 
+  void Int32() {
+    const int64_t array_size = args.size / sizeof(int32_t);
+    auto values = rand.Int32(array_size, -100, 100, args.values_null_proportion);
+    Bench(values);
+  }
+
   void Int64() {
     const int64_t array_size = args.size / sizeof(int64_t);
     auto values = rand.Int64(array_size, -100, 100, args.values_null_proportion);
@@ -362,6 +373,14 @@ struct FilterBenchmark {
   }
 };
 
+static void FilterInt32FilterNoNulls(benchmark::State& state) {
+  FilterBenchmark(state, false).Int32();
+}
+
+static void FilterInt32FilterWithNulls(benchmark::State& state) {
+  FilterBenchmark(state, true).Int32();
+}
+
 static void FilterInt64FilterNoNulls(benchmark::State& state) {
   FilterBenchmark(state, false).Int64();
 }
@@ -402,6 +421,14 @@ static void FilterRecordBatchWithNulls(benchmark::State& state) {
   FilterBenchmark(state, true).BenchRecordBatch();
 }
 
+static void TakeInt32RandomIndicesNoNulls(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/false).Int32();
+}
+
+static void TakeInt32RandomIndicesWithNulls(benchmark::State& state) {
+  TakeBenchmark(state, /*indices_with_nulls=*/true).Int32();
+}
+
 static void TakeInt64RandomIndicesNoNulls(benchmark::State& state) {
   TakeBenchmark(state, /*indices_with_nulls=*/false).Int64();
 }
@@ -571,6 +598,8 @@ void FilterFSBSetArgs(benchmark::internal::Benchmark* bench) {
   }
 }
 
+BENCHMARK(FilterInt32FilterNoNulls)->Apply(FilterSetArgs);
+BENCHMARK(FilterInt32FilterWithNulls)->Apply(FilterSetArgs);
 BENCHMARK(FilterInt64FilterNoNulls)->Apply(FilterSetArgs);
 BENCHMARK(FilterInt64FilterWithNulls)->Apply(FilterSetArgs);
 BENCHMARK(FilterFixedSizeBinaryFilterNoNulls)->Apply(FilterFSBSetArgs);
@@ -611,6 +640,8 @@ void TakeFSBSetArgs(benchmark::internal::Benchmark* bench) {
 }
 
 // Flat values x Flat indices
+BENCHMARK(TakeInt32RandomIndicesNoNulls)->Apply(TakeSetArgs);
+BENCHMARK(TakeInt32RandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeInt64RandomIndicesNoNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeInt64RandomIndicesWithNulls)->Apply(TakeSetArgs);
 BENCHMARK(TakeInt64MonotonicIndices)->Apply(TakeSetArgs);
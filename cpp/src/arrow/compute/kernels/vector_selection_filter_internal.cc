@@ -243,6 +243,13 @@ class PrimitiveFilterImpl {
     const auto filter_offset = filter_.offset;
     if (filter_.null_count == 0 && values_null_count_ == 0) {
       // Fast filter when values and filter are not null
+      if constexpr (kByteWidth == 4 || kByteWidth == 8) {
+        using T = std::conditional_t<kByteWidth == 4, uint32_t, uint64_t>;
+        out_position_ += FilterValuesNoNulls(
+            reinterpret_cast<const T*>(values_data_), filter_data, filter_offset,
+            values_length_, reinterpret_cast<T*>(out_data_) + out_position_);
+        return;
+      }
       ::arrow::internal::VisitSetBitRunsVoid(
           filter_data, filter_.offset, values_length_,
           [&](int64_t position, int64_t length) { WriteValueSegment(position, length); });
@@ -1093,6 +1100,8 @@ void PopulateFilterKernels(std::vector<SelectionKernelData>* out) {
       {InputType(match::Primitive()), plain_filter, PrimitiveFilterExec},
       {InputType(match::BinaryLike()), plain_filter, BinaryFilterExec},
       {InputType(match::LargeBinaryLike()), plain_filter, BinaryFilterExec},
+      {InputType(Type::BINARY_VIEW), plain_filter, BinaryViewFilterExec},
+      {InputType(Type::STRING_VIEW), plain_filter, BinaryViewFilterExec},
       {InputType(null()), plain_filter, NullFilterExec},
       {InputType(Type::FIXED_SIZE_BINARY), plain_filter, PrimitiveFilterExec},
       {InputType(Type::DECIMAL128), plain_filter, PrimitiveFilterExec},
@@ -1113,6 +1122,8 @@ void PopulateFilterKernels(std::vector<SelectionKernelData>* out) {
       {InputType(match::Primitive()), ree_filter, PrimitiveFilterExec},
       {InputType(match::BinaryLike()), ree_filter, BinaryFilterExec},
       {InputType(match::LargeBinaryLike()), ree_filter, BinaryFilterExec},
+      {InputType(Type::BINARY_VIEW), ree_filter, BinaryViewFilterExec},
+      {InputType(Type::STRING_VIEW), ree_filter, BinaryViewFilterExec},
       {InputType(null()), ree_filter, NullFilterExec},
       {InputType(Type::FIXED_SIZE_BINARY), ree_filter, PrimitiveFilterExec},
       {InputType(Type::DECIMAL128), ree_filter, PrimitiveFilterExec},
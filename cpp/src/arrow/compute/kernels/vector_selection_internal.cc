@@ -16,9 +16,11 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/array/array_binary.h"
@@ -37,6 +39,7 @@
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/fixed_width_internal.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
@@ -924,6 +927,92 @@ Status LargeListViewFilterExec(KernelContext* ctx, const ExecSpan& batch,
   return FilterExec<ListViewSelectionImpl<LargeListViewType>>(ctx, batch, out);
 }
 
+// ----------------------------------------------------------------------
+// Selection of 32- and 64-bit values without nulls
+
+namespace {
+
+using ::arrow::internal::DispatchLevel;
+
+template <typename T>
+int64_t FilterValuesDefault(const T* values, const uint8_t* filter, int64_t filter_offset,
+                            int64_t length, T* out) {
+  int64_t out_length = 0;
+  ::arrow::internal::VisitSetBitRunsVoid(
+      filter, filter_offset, length, [&](int64_t position, int64_t run_length) {
+        memcpy(out + out_length, values + position, run_length * sizeof(T));
+        out_length += run_length;
+      });
+  return out_length;
+}
+
+template <typename T, typename IndexCType>
+void TakeValuesDefault(const T* values, const IndexCType* indices, int64_t length,
+                       T* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    memcpy(out + i, values + indices[i], sizeof(T));
+  }
+}
+
+template <typename T>
+struct FilterValuesDynamic {
+  using FunctionType = decltype(&FilterValuesDefault<T>);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, FilterValuesDefault<T>}
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+            ,
+            {DispatchLevel::AVX512, FilterValuesAvx512<T>}
+#endif
+    };
+  }
+};
+
+template <typename T, typename IndexCType>
+struct TakeValuesDynamic {
+  using FunctionType = decltype(&TakeValuesDefault<T, IndexCType>);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, TakeValuesDefault<T, IndexCType>}
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+            ,
+            {DispatchLevel::AVX512, TakeValuesAvx512<T, IndexCType>}
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+template <typename T>
+int64_t FilterValuesNoNulls(const T* values, const uint8_t* filter, int64_t filter_offset,
+                            int64_t length, T* out) {
+  static const ::arrow::internal::DynamicDispatch<FilterValuesDynamic<T>> dispatch;
+  return dispatch.func(values, filter, filter_offset, length, out);
+}
+
+template <typename T, typename IndexCType>
+void TakeValuesNoNulls(const T* values, const IndexCType* indices, int64_t length,
+                       T* out) {
+  static const ::arrow::internal::DynamicDispatch<TakeValuesDynamic<T, IndexCType>>
+      dispatch;
+  dispatch.func(values, indices, length, out);
+}
+
+template int64_t FilterValuesNoNulls<uint32_t>(const uint32_t*, const uint8_t*, int64_t,
+                                               int64_t, uint32_t*);
+template int64_t FilterValuesNoNulls<uint64_t>(const uint64_t*, const uint8_t*, int64_t,
+                                               int64_t, uint64_t*);
+
+template void TakeValuesNoNulls<uint32_t, int32_t>(const uint32_t*, const int32_t*,
+                                                   int64_t, uint32_t*);
+template void TakeValuesNoNulls<uint32_t, int64_t>(const uint32_t*, const int64_t*,
+                                                   int64_t, uint32_t*);
+template void TakeValuesNoNulls<uint64_t, int32_t>(const uint64_t*, const int32_t*,
+                                                   int64_t, uint64_t*);
+template void TakeValuesNoNulls<uint64_t, int64_t>(const uint64_t*, const int64_t*,
+                                                   int64_t, uint64_t*);
+
 Status FSLFilterExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
   const ArraySpan& values = batch[0].array;
 
@@ -942,6 +1031,37 @@ Status FSLFilterExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out)
   return FilterExec<FSLSelectionImpl>(ctx, batch, out);
 }
 
+namespace {
+
+// Select the 16-byte views of a binary view array with a fixed-width selection
+// kernel.  The views keep referencing the data buffers of the input, which are
+// shared with the output, so that no character data is copied.
+Status BinaryViewSelectionExec(KernelContext* ctx, const ExecSpan& batch,
+                               ExecResult* out, ArrayKernelExec fixed_width_exec) {
+  static const auto kViewsType = fixed_size_binary(BinaryViewType::kSize);
+  ExecSpan views_batch = batch;
+  views_batch.values[0].array.type = kViewsType.get();
+  ExecResult views_out;
+  views_out.value = std::make_shared<ArrayData>(kViewsType, /*length=*/0);
+  RETURN_NOT_OK(fixed_width_exec(ctx, views_batch, &views_out));
+
+  ArrayData* views = views_out.array_data_mutable();
+  ArrayData* out_arr = out->array_data_mutable();
+  out_arr->length = views->length;
+  out_arr->null_count = views->null_count.load();
+  out_arr->buffers = std::move(views->buffers);
+  for (const auto& data_buffer : batch[0].array.GetVariadicBuffers()) {
+    out_arr->buffers.push_back(data_buffer);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status BinaryViewFilterExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  return BinaryViewSelectionExec(ctx, batch, out, PrimitiveFilterExec);
+}
+
 Status DenseUnionFilterExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
   return FilterExec<DenseUnionSelectionImpl>(ctx, batch, out);
 }
@@ -972,6 +1092,10 @@ Status LargeVarBinaryTakeExec(KernelContext* ctx, const ExecSpan& batch,
   return TakeExec<VarBinarySelectionImpl<LargeBinaryType>>(ctx, batch, out);
 }
 
+Status BinaryViewTakeExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  return BinaryViewSelectionExec(ctx, batch, out, FixedWidthTakeExec);
+}
+
 Status ListTakeExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
   return TakeExec<ListSelectionImpl<ListType>>(ctx, batch, out);
 }
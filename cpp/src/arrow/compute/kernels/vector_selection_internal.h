@@ -70,12 +70,42 @@ Status LargeListFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status ListViewFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status LargeListViewFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status FSLFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
+Status BinaryViewFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status DenseUnionFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status MapFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
 
+/// \brief Copy the values whose bit is set in `filter` to `out`
+///
+/// Neither the values nor the filter may have nulls.  Implemented for uint32_t and
+/// uint64_t, using AVX-512 compress instructions when the CPU supports them.
+/// \return the number of values written
+template <typename T>
+int64_t FilterValuesNoNulls(const T* values, const uint8_t* filter, int64_t filter_offset,
+                            int64_t length, T* out);
+
+/// \brief Write `values[indices[i]]` to `out[i]` for each of the `length` indices
+///
+/// Neither the values nor the indices may have nulls, and the indices must be in
+/// bounds.  Implemented for uint32_t and uint64_t values with int32_t or int64_t
+/// indices, using AVX-512 gathers when the CPU supports them.
+template <typename T, typename IndexCType>
+void TakeValuesNoNulls(const T* values, const IndexCType* indices, int64_t length,
+                       T* out);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+// vector_selection_avx512.cc
+template <typename T>
+int64_t FilterValuesAvx512(const T* values, const uint8_t* filter, int64_t filter_offset,
+                           int64_t length, T* out);
+template <typename T, typename IndexCType>
+void TakeValuesAvx512(const T* values, const IndexCType* indices, int64_t length,
+                      T* out);
+#endif
+
 Status VarBinaryTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status LargeVarBinaryTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status FixedWidthTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
+Status BinaryViewTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status ListTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status LargeListTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status ListViewTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
@@ -19,6 +19,7 @@
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -389,6 +390,14 @@ struct FixedWidthTakeImpl {
       memset(out_is_valid, 0, bit_util::BytesForBits(out_arr->length));
       valid_count = gather.template Execute<OutputIsZeroInitialized::value>(
           /*src_validity=*/values, /*idx_validity=*/indices, out_is_valid);
+    } else if constexpr (!WithFactor::value &&
+                         (kValueWidthInBits == 32 || kValueWidthInBits == 64) &&
+                         (std::is_same_v<IndexCType, int32_t> ||
+                          std::is_same_v<IndexCType, int64_t>)) {
+      using T = std::conditional_t<kValueWidthInBits == 32, uint32_t, uint64_t>;
+      TakeValuesNoNulls(reinterpret_cast<const T*>(src), indices.GetValues<IndexCType>(1),
+                        indices.length, reinterpret_cast<T*>(out));
+      valid_count = indices.length;
     } else {
       valid_count = gather.Execute();
     }
@@ -739,6 +748,8 @@ void PopulateTakeKernels(std::vector<SelectionKernelData>* out) {
       {InputType(match::Primitive()), take_indices, FixedWidthTakeExec},
       {InputType(match::BinaryLike()), take_indices, VarBinaryTakeExec},
       {InputType(match::LargeBinaryLike()), take_indices, LargeVarBinaryTakeExec},
+      {InputType(Type::BINARY_VIEW), take_indices, BinaryViewTakeExec},
+      {InputType(Type::STRING_VIEW), take_indices, BinaryViewTakeExec},
       {InputType(match::FixedSizeBinaryLike()), take_indices, FixedWidthTakeExec},
       {InputType(null()), take_indices, NullTakeExec},
       {InputType(Type::DICTIONARY), take_indices, DictionaryTake},
@@ -665,7 +665,7 @@ class TestFilterKernelWithString : public TestFilterKernel {
   }
 };
 
-TYPED_TEST_SUITE(TestFilterKernelWithString, BaseBinaryArrowTypes);
+TYPED_TEST_SUITE(TestFilterKernelWithString, BaseBinaryOrBinaryViewLikeArrowTypes);
 
 TYPED_TEST(TestFilterKernelWithString, FilterString) {
   this->AssertFilter(R"(["a", "b", "c"])", "[0, 1, 0]", R"(["b"])");
@@ -1656,7 +1656,7 @@ class TestTakeKernelWithString : public TestTakeKernelTyped<TypeClass> {
   }
 };
 
-TYPED_TEST_SUITE(TestTakeKernelWithString, BaseBinaryArrowTypes);
+TYPED_TEST_SUITE(TestTakeKernelWithString, BaseBinaryOrBinaryViewLikeArrowTypes);
 
 TYPED_TEST(TestTakeKernelWithString, TakeString) {
   this->CheckTakeXA(R"(["a", "b", "c"])", "[0, 1, 0]", R"(["a", "b", "a"])");
@@ -2298,6 +2298,7 @@ TEST(TestFilter, RandomBoolean) { FilterRandomTest<>::Test(boolean()); }
 TEST(TestFilter, RandomString) {
   FilterRandomTest<>::Test(utf8());
   FilterRandomTest<>::Test(large_utf8());
+  FilterRandomTest<>::Test(utf8_view());
 }
 
 TEST(TestFilter, RandomFixedSizeBinary) {
@@ -2314,6 +2315,33 @@ TEST(TestTake, RandomBoolean) { TakeRandomTest<BooleanType>::Test(boolean()); }
 TEST(TestTake, RandomString) {
   TakeRandomTest<StringType>::Test(utf8());
   TakeRandomTest<LargeStringType>::Test(large_utf8());
+  TakeRandomTest<StringViewType>::Test(utf8_view());
+}
+
+TEST(TestSelection, BinaryViewSharesDataBuffers) {
+  auto values = ArrayFromJSON(utf8_view(), R"(["a string too long to be inlined",
+                                               "short", null,
+                                               "another string that is not inlined"])");
+  ASSERT_GT(values->data()->buffers.size(), 2);
+
+  auto check_shares_data = [&](const Datum& selected, const std::string& expected) {
+    const auto& out = selected.array();
+    ValidateOutput(*out);
+    AssertArraysEqual(*ArrayFromJSON(utf8_view(), expected), *selected.make_array(),
+                      /*verbose=*/true);
+    ASSERT_EQ(out->buffers.size(), values->data()->buffers.size());
+    for (size_t i = 2; i < out->buffers.size(); ++i) {
+      ASSERT_EQ(out->buffers[i], values->data()->buffers[i]);
+    }
+  };
+
+  ASSERT_OK_AND_ASSIGN(auto filtered,
+                       Filter(values, ArrayFromJSON(boolean(), "[0, 1, 1, 1]")));
+  check_shares_data(filtered, R"(["short", null, "another string that is not inlined"])");
+  ASSERT_OK_AND_ASSIGN(auto taken, Take(values, ArrayFromJSON(int32(), "[3, 0, 3]")));
+  check_shares_data(taken, R"(["another string that is not inlined",
+                               "a string too long to be inlined",
+                               "another string that is not inlined"])");
 }
 
 TEST(TestTake, RandomFixedSizeBinary) {
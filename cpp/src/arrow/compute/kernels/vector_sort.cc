@@ -15,11 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <array>
+#include <cstring>
+#include <numeric>
 #include <unordered_set>
 
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/compute/registry.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/ubsan.h"
 
 namespace arrow {
 
@@ -87,23 +92,26 @@ class ChunkedArraySorter : public TypeVisitor {
     const auto arrays = GetArrayPointers(physical_chunks_);
 
     // Sort each chunk independently and merge to sorted indices.
-    // This is a serial implementation.
+    // This runs in parallel if the ExecContext allows it.
+    auto* executor = GetSortExecutor(ctx_);
     std::vector<NullPartitionResult> sorted(num_chunks);
 
     // First sort all individual chunks
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
+    std::vector<int64_t> offsets(num_chunks + 1, 0);
     int64_t null_count = 0;
     for (int i = 0; i < num_chunks; ++i) {
-      const auto array = checked_cast<const ArrayType*>(arrays[i]);
-      end_offset += array->length();
-      null_count += array->null_count();
-      ARROW_ASSIGN_OR_RAISE(sorted[i], array_sorter_(indices_begin_ + begin_offset,
-                                                     indices_begin_ + end_offset, *array,
-                                                     begin_offset, options, ctx_));
-      begin_offset = end_offset;
+      offsets[i + 1] = offsets[i] + arrays[i]->length();
+      null_count += arrays[i]->null_count();
     }
-    DCHECK_EQ(end_offset, num_indices);
+    DCHECK_EQ(offsets[num_chunks], num_indices);
+    RETURN_NOT_OK(SortParallelFor(executor, num_chunks, [&](int i) -> Status {
+      const auto array = checked_cast<const ArrayType*>(arrays[i]);
+      ARROW_ASSIGN_OR_RAISE(
+          sorted[i], array_sorter_(indices_begin_ + offsets[i],
+                                   indices_begin_ + offsets[i + 1], *array, offsets[i],
+                                   options, ctx_));
+      return Status::OK();
+    }));
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -127,37 +135,31 @@ class ChunkedArraySorter : public TypeVisitor {
         }
       };
       auto merge_non_nulls =
-          [&](CompressedChunkLocation* range_begin, CompressedChunkLocation* range_middle,
-              CompressedChunkLocation* range_end, CompressedChunkLocation* temp_indices) {
-            MergeNonNulls<ArrayType>(range_begin, range_middle, range_end, arrays,
-                                     temp_indices);
+          [&](CompressedChunkLocation* left_begin, CompressedChunkLocation* left_end,
+              CompressedChunkLocation* right_begin, CompressedChunkLocation* right_end,
+              CompressedChunkLocation* out) {
+            MergeNonNulls<ArrayType>(left_begin, left_end, right_begin, right_end, arrays,
+                                     out);
           };
+      auto less = [&](CompressedChunkLocation left, CompressedChunkLocation right) {
+        using ArrowType = typename ArrayType::TypeClass;
+        if (order_ == SortOrder::Ascending) {
+          return ChunkValue<ArrowType>(arrays, left) <
+                 ChunkValue<ArrowType>(arrays, right);
+        }
+        return ChunkValue<ArrowType>(arrays, right) <
+               ChunkValue<ArrowType>(arrays, left);
+      };
 
       ChunkedMergeImpl merge_impl{null_placement_, std::move(merge_nulls),
-                                  std::move(merge_non_nulls)};
-      // std::merge is only called on non-null values, so size temp indices accordingly
-      RETURN_NOT_OK(merge_impl.Init(ctx_, num_indices - null_count));
-
-      while (chunk_sorted.size() > 1) {
-        // Merge all pairs of chunks
-        auto out_it = chunk_sorted.begin();
-        auto it = chunk_sorted.begin();
-        while (it < chunk_sorted.end() - 1) {
-          const auto& left = *it++;
-          const auto& right = *it++;
-          DCHECK_EQ(left.overall_end(), right.overall_begin());
-          const auto merged = merge_impl.Merge(left, right, null_count);
-          *out_it++ = merged;
-        }
-        if (it < chunk_sorted.end()) {
-          *out_it++ = *it++;
-        }
-        chunk_sorted.erase(out_it, chunk_sorted.end());
-      }
+                                  std::move(merge_non_nulls), std::move(less)};
+      RETURN_NOT_OK(merge_impl.Init(ctx_, num_indices));
+      ARROW_ASSIGN_OR_RAISE(auto merged,
+                            merge_impl.MergeAll(std::move(chunk_sorted), null_count));
 
       // Reverse everything
       sorted.resize(1);
-      sorted[0] = chunk_sorted[0].TranslateTo(chunked_indices_begin, indices_begin_);
+      sorted[0] = merged.TranslateTo(chunked_indices_begin, indices_begin_);
 
       RETURN_NOT_OK(chunked_mapper.PhysicalToLogical());
     }
@@ -173,20 +175,21 @@ class ChunkedArraySorter : public TypeVisitor {
   }
 
   template <typename ArrayType>
-  void MergeNonNulls(CompressedChunkLocation* range_begin,
-                     CompressedChunkLocation* range_middle,
-                     CompressedChunkLocation* range_end, span<const Array* const> arrays,
-                     CompressedChunkLocation* temp_indices) {
+  void MergeNonNulls(CompressedChunkLocation* left_begin,
+                     CompressedChunkLocation* left_end,
+                     CompressedChunkLocation* right_begin,
+                     CompressedChunkLocation* right_end, span<const Array* const> arrays,
+                     CompressedChunkLocation* out) {
     using ArrowType = typename ArrayType::TypeClass;
 
     if (order_ == SortOrder::Ascending) {
-      std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
+      std::merge(left_begin, left_end, right_begin, right_end, out,
                  [&](CompressedChunkLocation left, CompressedChunkLocation right) {
                    return ChunkValue<ArrowType>(arrays, left) <
                           ChunkValue<ArrowType>(arrays, right);
                  });
     } else {
-      std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
+      std::merge(left_begin, left_end, right_begin, right_end, out,
                  [&](CompressedChunkLocation left, CompressedChunkLocation right) {
                    // We don't use 'left > right' here to reduce required
                    // operator. If we use 'right < left' here, '<' is only
@@ -195,8 +198,6 @@ class ChunkedArraySorter : public TypeVisitor {
                           ChunkValue<ArrowType>(arrays, left);
                  });
     }
-    // Copy back temp area into main buffer
-    std::copy(temp_indices, temp_indices + (range_end - range_begin), range_begin);
   }
 
   template <typename ArrowType>
@@ -614,6 +615,426 @@ class MultipleKeyRecordBatchSorter : public TypeVisitor {
   Comparator comparator_;
 };
 
+// ----------------------------------------------------------------------
+// Normalized-key sorting implementation
+
+// A normalized key is a memcomparable encoding of the leading sort keys of a row:
+// comparing two normalized keys bytewise orders their rows like comparing the sort
+// keys one after the other.  Rows can therefore be radix sorted on their normalized
+// keys, without dispatching to a column comparator for each comparison.
+
+// The maximum width of normalized keys.  Only the leading sort keys fitting in this
+// width are encoded, rows with equal normalized keys are compared on the other ones.
+constexpr int64_t kMaxNormalizedKeyWidth = 32;
+
+// Normalized keys at most this wide are sorted with a LSD radix sort, wider ones
+// with a MSD radix sort.
+constexpr int64_t kMaxLsdRadixSortWidth = 8;
+
+// Ranges shorter than this are sorted by comparing their normalized keys
+// rather than by another MSD radix pass.
+constexpr int64_t kMinMsdRadixSortLength = 64;
+
+// The minimum number of indices for sorting the buckets of the first MSD radix
+// pass in parallel.
+constexpr int64_t kMinParallelRadixSortLength = 1 << 16;
+
+template <int kByteWidth>
+struct UnsignedOfWidth {};
+
+template <>
+struct UnsignedOfWidth<1> {
+  using type = uint8_t;
+};
+
+template <>
+struct UnsignedOfWidth<2> {
+  using type = uint16_t;
+};
+
+template <>
+struct UnsignedOfWidth<4> {
+  using type = uint32_t;
+};
+
+template <>
+struct UnsignedOfWidth<8> {
+  using type = uint64_t;
+};
+
+// Encode fixed-width sort keys into normalized keys.
+//
+// Each sort key is encoded as its value in big-endian order, with the sign bit
+// flipped for signed integers and floating-point values (and all other bits of
+// negative floating-point values inverted), and all bits inverted for descending
+// order.  Keys which may be null or NaN are prefixed with a byte ordering nulls,
+// NaNs and other values according to the null placement.
+class NormalizedKeyEncoder {
+ public:
+  explicit NormalizedKeyEncoder(NullPlacement null_placement)
+      : value_class_(null_placement == NullPlacement::AtStart ? 2 : 0),
+        null_class_(null_placement == NullPlacement::AtStart ? 0 : 2) {}
+
+  // Add a sort key of the given physical type.  Return false, leaving the encoder
+  // unchanged, if the key can't be encoded or doesn't fit in the normalized keys.
+  bool AddKey(const DataType& physical_type, SortOrder order, bool may_have_nulls) {
+    int64_t value_width;
+    bool may_have_nans = false;
+    switch (physical_type.id()) {
+      case Type::BOOL:
+        value_width = 1;
+        break;
+      case Type::INT8:
+      case Type::INT16:
+      case Type::INT32:
+      case Type::INT64:
+      case Type::UINT8:
+      case Type::UINT16:
+      case Type::UINT32:
+      case Type::UINT64:
+        value_width = physical_type.byte_width();
+        break;
+      case Type::FLOAT:
+      case Type::DOUBLE:
+        value_width = physical_type.byte_width();
+        may_have_nans = true;
+        break;
+      default:
+        return false;
+    }
+    const bool has_class = may_have_nulls || may_have_nans;
+    const int64_t key_width = value_width + (has_class ? 1 : 0);
+    if (row_width_ + key_width > kMaxNormalizedKeyWidth) {
+      return false;
+    }
+    keys_.push_back({physical_type.id(), order, row_width_, has_class});
+    row_width_ += key_width;
+    return true;
+  }
+
+  // Add the leading sort keys which can be encoded
+  template <typename ResolvedSortKey>
+  void AddKeys(const std::vector<ResolvedSortKey>& sort_keys) {
+    for (const auto& sort_key : sort_keys) {
+      if (!AddKey(*sort_key.type, sort_key.order, sort_key.null_count > 0)) {
+        break;
+      }
+    }
+  }
+
+  int num_keys() const { return static_cast<int>(keys_.size()); }
+  int64_t row_width() const { return row_width_; }
+
+  // Encode the values of the `key_index`-th sort key into the normalized keys of
+  // the consecutive rows starting at `rows`.
+  void Encode(int key_index, const Array& array, uint8_t* rows) const {
+    const KeyLayout& key = keys_[key_index];
+    switch (key.type_id) {
+      case Type::BOOL:
+        return EncodeKey<bool>(key, array, rows);
+      case Type::INT8:
+        return EncodeKey<int8_t>(key, array, rows);
+      case Type::INT16:
+        return EncodeKey<int16_t>(key, array, rows);
+      case Type::INT32:
+        return EncodeKey<int32_t>(key, array, rows);
+      case Type::INT64:
+        return EncodeKey<int64_t>(key, array, rows);
+      case Type::UINT8:
+        return EncodeKey<uint8_t>(key, array, rows);
+      case Type::UINT16:
+        return EncodeKey<uint16_t>(key, array, rows);
+      case Type::UINT32:
+        return EncodeKey<uint32_t>(key, array, rows);
+      case Type::UINT64:
+        return EncodeKey<uint64_t>(key, array, rows);
+      case Type::FLOAT:
+        return EncodeKey<float>(key, array, rows);
+      case Type::DOUBLE:
+        return EncodeKey<double>(key, array, rows);
+      default:
+        DCHECK(false) << "Unexpected type for normalized keys";
+    }
+  }
+
+ private:
+  struct KeyLayout {
+    Type::type type_id;
+    SortOrder order;
+    // The offset of the encoded key in the normalized keys
+    int64_t offset;
+    // Whether the encoded key starts with a byte ordering nulls and NaNs
+    bool has_class;
+  };
+
+  static constexpr uint8_t kNaNClass = 1;
+
+  template <typename CType>
+  void EncodeKey(const KeyLayout& key, const Array& array, uint8_t* rows) const {
+    const ArrayData& data = *array.data();
+    uint8_t* out = rows + key.offset;
+    for (int64_t i = 0; i < data.length; ++i, out += row_width_) {
+      const CType value = GetValue<CType>(data, i);
+      if (!key.has_class) {
+        EncodeValue(value, key.order, out);
+        continue;
+      }
+      uint8_t value_class = value_class_;
+      if (array.IsNull(i)) {
+        value_class = null_class_;
+      } else if constexpr (std::is_floating_point_v<CType>) {
+        if (std::isnan(value)) {
+          value_class = kNaNClass;
+        }
+      }
+      out[0] = value_class;
+      if (value_class == value_class_) {
+        EncodeValue(value, key.order, out + 1);
+      } else {
+        std::memset(out + 1, 0, sizeof(CType));
+      }
+    }
+  }
+
+  template <typename CType>
+  static CType GetValue(const ArrayData& data, int64_t i) {
+    if constexpr (std::is_same_v<CType, bool>) {
+      return bit_util::GetBit(data.buffers[1]->data(), data.offset + i);
+    } else {
+      return data.GetValues<CType>(1)[i];
+    }
+  }
+
+  template <typename CType>
+  static void EncodeValue(CType value, SortOrder order, uint8_t* out) {
+    using UnsignedType = typename UnsignedOfWidth<sizeof(CType)>::type;
+    constexpr auto kSignBit =
+        static_cast<UnsignedType>(UnsignedType{1} << (sizeof(CType) * 8 - 1));
+
+    UnsignedType bits;
+    if constexpr (std::is_floating_point_v<CType>) {
+      // -0.0 and 0.0 compare equal
+      bits = util::SafeCopy<UnsignedType>(value == 0 ? CType{0} : value);
+      bits = (bits & kSignBit) ? static_cast<UnsignedType>(~bits) : (bits | kSignBit);
+    } else if constexpr (std::is_signed_v<CType>) {
+      bits = static_cast<UnsignedType>(value) ^ kSignBit;
+    } else {
+      bits = static_cast<UnsignedType>(value);
+    }
+    if (order == SortOrder::Descending) {
+      bits = static_cast<UnsignedType>(~bits);
+    }
+    bits = bit_util::ToBigEndian(bits);
+    std::memcpy(out, &bits, sizeof(bits));
+  }
+
+  const uint8_t value_class_;
+  const uint8_t null_class_;
+  std::vector<KeyLayout> keys_;
+  int64_t row_width_ = 0;
+};
+
+// Stably sort indices on the normalized keys of the rows they point to.
+class NormalizedKeyRadixSorter {
+ public:
+  // `rows` holds the normalized key of the row at index `i` at `(i - offset) *
+  // row_width`, `temp_indices` must be as long as the indices to sort.
+  NormalizedKeyRadixSorter(const uint8_t* rows, int64_t row_width, int64_t offset,
+                           uint64_t* temp_indices, arrow::internal::Executor* executor)
+      : rows_(rows),
+        row_width_(row_width),
+        offset_(offset),
+        temp_indices_(temp_indices),
+        executor_(executor) {}
+
+  Status Sort(uint64_t* indices_begin, uint64_t* indices_end) {
+    indices_begin_ = indices_begin;
+    if (row_width_ <= kMaxLsdRadixSortWidth) {
+      LsdSort(indices_begin, indices_end);
+      return Status::OK();
+    }
+    auto* executor =
+        indices_end - indices_begin >= kMinParallelRadixSortLength ? executor_ : nullptr;
+    return MsdSort(indices_begin, indices_end, /*byte_index=*/0, executor);
+  }
+
+  // Visit the ranges of more than one index with equal normalized keys
+  template <typename Visitor>
+  void VisitEqualRanges(uint64_t* indices_begin, uint64_t* indices_end,
+                        Visitor&& visit) const {
+    if (indices_begin == indices_end) {
+      return;
+    }
+    auto range_start = indices_begin;
+    for (auto it = indices_begin + 1; it != indices_end; ++it) {
+      if (std::memcmp(Row(*range_start), Row(*it), row_width_) != 0) {
+        if (it - range_start > 1) {
+          visit(range_start, it);
+        }
+        range_start = it;
+      }
+    }
+    if (indices_end - range_start > 1) {
+      visit(range_start, indices_end);
+    }
+  }
+
+ private:
+  const uint8_t* Row(uint64_t index) const {
+    return rows_ + (static_cast<int64_t>(index) - offset_) * row_width_;
+  }
+
+  uint64_t* TempIndices(uint64_t* indices) const {
+    return temp_indices_ + (indices - indices_begin_);
+  }
+
+  // Sort on the normalized keys loaded as integers, one byte per pass from the
+  // least significant one.  Passes on bytes equal in all keys are skipped.
+  void LsdSort(uint64_t* indices_begin, uint64_t* indices_end) {
+    const int64_t length = indices_end - indices_begin;
+    std::vector<uint64_t> keys(length);
+    std::vector<uint64_t> temp_keys(length);
+    for (int64_t i = 0; i < length; ++i) {
+      const uint8_t* row = Row(indices_begin[i]);
+      uint64_t key = 0;
+      for (int64_t j = 0; j < row_width_; ++j) {
+        key = (key << 8) | row[j];
+      }
+      keys[i] = key;
+    }
+
+    uint64_t* indices = indices_begin;
+    uint64_t* temp_indices = TempIndices(indices_begin);
+    for (int64_t shift = 0; shift < row_width_ * 8; shift += 8) {
+      std::array<int64_t, 257> offsets{};
+      for (int64_t i = 0; i < length; ++i) {
+        ++offsets[((keys[i] >> shift) & 0xff) + 1];
+      }
+      if (std::find(offsets.begin() + 1, offsets.end(), length) != offsets.end()) {
+        continue;
+      }
+      std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+      for (int64_t i = 0; i < length; ++i) {
+        const int64_t pos = offsets[(keys[i] >> shift) & 0xff]++;
+        temp_keys[pos] = keys[i];
+        temp_indices[pos] = indices[i];
+      }
+      std::swap(keys, temp_keys);
+      std::swap(indices, temp_indices);
+    }
+    if (indices != indices_begin) {
+      std::copy(indices, indices + length, indices_begin);
+    }
+  }
+
+  // Sort on the `byte_index`-th byte of the normalized keys, then sort each bucket
+  // on the next bytes, in parallel if an executor is given.
+  Status MsdSort(uint64_t* indices_begin, uint64_t* indices_end, int64_t byte_index,
+                 arrow::internal::Executor* executor) {
+    const int64_t length = indices_end - indices_begin;
+    for (; byte_index < row_width_ && length > 1; ++byte_index) {
+      if (length < kMinMsdRadixSortLength) {
+        std::stable_sort(indices_begin, indices_end, [&](uint64_t left, uint64_t right) {
+          return std::memcmp(Row(left) + byte_index, Row(right) + byte_index,
+                             row_width_ - byte_index) < 0;
+        });
+        return Status::OK();
+      }
+      std::array<int64_t, 257> offsets{};
+      for (auto it = indices_begin; it != indices_end; ++it) {
+        ++offsets[Row(*it)[byte_index] + 1];
+      }
+      if (std::find(offsets.begin() + 1, offsets.end(), length) != offsets.end()) {
+        // All keys have the same byte, sort on the next one
+        continue;
+      }
+      std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+      auto positions = offsets;
+      uint64_t* temp_indices = TempIndices(indices_begin);
+      for (auto it = indices_begin; it != indices_end; ++it) {
+        temp_indices[positions[Row(*it)[byte_index]]++] = *it;
+      }
+      std::copy(temp_indices, temp_indices + length, indices_begin);
+
+      return SortParallelFor(executor, 256, [&](int bucket) {
+        return MsdSort(indices_begin + offsets[bucket],
+                       indices_begin + offsets[bucket + 1], byte_index + 1,
+                       /*executor=*/nullptr);
+      });
+    }
+    return Status::OK();
+  }
+
+  const uint8_t* rows_;
+  const int64_t row_width_;
+  const int64_t offset_;
+  uint64_t* temp_indices_;
+  arrow::internal::Executor* executor_;
+  uint64_t* indices_begin_ = nullptr;
+};
+
+// Sort a batch on the normalized keys of its leading sort keys, then sort the ranges
+// of equal normalized keys on the remaining sort keys.
+class NormalizedKeyRecordBatchSorter {
+ public:
+  using ResolvedSortKey = ResolvedRecordBatchSortKey;
+
+  NormalizedKeyRecordBatchSorter(ExecContext* ctx, uint64_t* indices_begin,
+                                 uint64_t* indices_end,
+                                 const std::vector<ResolvedSortKey>& sort_keys,
+                                 const SortOptions& options)
+      : ctx_(ctx),
+        indices_begin_(indices_begin),
+        indices_end_(indices_end),
+        sort_keys_(sort_keys),
+        encoder_(options.null_placement),
+        comparator_(sort_keys_, options.null_placement) {
+    encoder_.AddKeys(sort_keys_);
+  }
+
+  // Whether enough sort keys are normalized for this to beat other sorters
+  bool CanSort() const { return encoder_.num_keys() >= 2; }
+
+  Status Sort() {
+    RETURN_NOT_OK(comparator_.status());
+    const int64_t length = indices_end_ - indices_begin_;
+    const int64_t row_width = encoder_.row_width();
+    ARROW_ASSIGN_OR_RAISE(auto rows,
+                          AllocateBuffer(length * row_width, ctx_->memory_pool()));
+    for (int i = 0; i < encoder_.num_keys(); ++i) {
+      encoder_.Encode(i, sort_keys_[i].array, rows->mutable_data());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto temp_indices, AllocateBuffer(length * sizeof(uint64_t),
+                                                            ctx_->memory_pool()));
+
+    NormalizedKeyRadixSorter sorter(rows->data(), row_width, /*offset=*/0,
+                                    temp_indices->mutable_data_as<uint64_t>(),
+                                    GetSortExecutor(ctx_));
+    RETURN_NOT_OK(sorter.Sort(indices_begin_, indices_end_));
+
+    const auto num_keys = static_cast<size_t>(encoder_.num_keys());
+    if (num_keys < sort_keys_.size()) {
+      sorter.VisitEqualRanges(
+          indices_begin_, indices_end_, [&](uint64_t* range_begin, uint64_t* range_end) {
+            std::stable_sort(range_begin, range_end, [&](uint64_t left, uint64_t right) {
+              return comparator_.Compare(left, right, num_keys);
+            });
+          });
+    }
+    return comparator_.status();
+  }
+
+ private:
+  using Comparator = MultipleKeyComparator<ResolvedSortKey>;
+
+  ExecContext* ctx_;
+  uint64_t* indices_begin_;
+  uint64_t* indices_end_;
+  const std::vector<ResolvedSortKey>& sort_keys_;
+  NormalizedKeyEncoder encoder_;
+  Comparator comparator_;
+};
+
 // ----------------------------------------------------------------------
 // Table sorting implementation(s)
 
@@ -674,26 +1095,37 @@ class TableSorter {
     if (num_batches == 0) {
       return Status::OK();
     }
-    std::vector<NullPartitionResult> sorted(num_batches);
+    std::vector<int64_t> offsets(num_batches + 1, 0);
+    for (int64_t i = 0; i < num_batches; ++i) {
+      offsets[i + 1] = offsets[i] + batches_[i]->num_rows();
+    }
+    DCHECK_EQ(offsets[num_batches], indices_end_ - indices_begin_);
+
+    NormalizedKeyEncoder encoder(null_placement_);
+    encoder.AddKeys(sort_keys_);
+    if (encoder.num_keys() >= 2) {
+      return SortNormalizedKeys(encoder, offsets);
+    }
 
-    // First sort all individual batches
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
+    // First sort all individual batches, in parallel if the ExecContext allows it
+    std::vector<NullPartitionResult> sorted(num_batches);
+    RETURN_NOT_OK(SortParallelFor(
+        GetSortExecutor(ctx_), static_cast<int>(num_batches), [&](int i) -> Status {
+          const auto& batch = *batches_[i];
+          RadixRecordBatchSorter sorter(indices_begin_ + offsets[i],
+                                        indices_begin_ + offsets[i + 1], batch, options_);
+          ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(offsets[i]));
+          DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + offsets[i]);
+          DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + offsets[i + 1]);
+          DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(),
+                    batch.num_rows());
+          return Status::OK();
+        }));
     int64_t null_count = 0;
-    for (int64_t i = 0; i < num_batches; ++i) {
-      const auto& batch = *batches_[i];
-      end_offset += batch.num_rows();
-      RadixRecordBatchSorter sorter(indices_begin_ + begin_offset,
-                                    indices_begin_ + end_offset, batch, options_);
-      ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(begin_offset));
-      DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + begin_offset);
-      DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + end_offset);
-      DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(), batch.num_rows());
-      begin_offset = end_offset;
+    for (const auto& batch_sorted : sorted) {
       // XXX this is an upper bound on the true null count
-      null_count += sorted[i].null_count();
+      null_count += batch_sorted.null_count();
     }
-    DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -738,6 +1170,45 @@ class TableSorter {
     return Status::OK();
   }
 
+  // Sort the whole table on the normalized keys of its leading sort keys, rather than
+  // sorting each batch and merging them
+  Status SortNormalizedKeys(const NormalizedKeyEncoder& encoder,
+                            const std::vector<int64_t>& offsets) {
+    const int64_t length = indices_end_ - indices_begin_;
+    const int64_t row_width = encoder.row_width();
+    ARROW_ASSIGN_OR_RAISE(auto rows,
+                          AllocateBuffer(length * row_width, ctx_->memory_pool()));
+    uint8_t* rows_data = rows->mutable_data();
+    RETURN_NOT_OK(SortParallelFor(
+        GetSortExecutor(ctx_), static_cast<int>(batches_.size()), [&](int i) {
+          for (int key_index = 0; key_index < encoder.num_keys(); ++key_index) {
+            encoder.Encode(key_index, *sort_keys_[key_index].chunks[i],
+                           rows_data + offsets[i] * row_width);
+          }
+          return Status::OK();
+        }));
+    ARROW_ASSIGN_OR_RAISE(auto temp_indices, AllocateBuffer(length * sizeof(uint64_t),
+                                                            ctx_->memory_pool()));
+
+    NormalizedKeyRadixSorter sorter(rows->data(), row_width, /*offset=*/0,
+                                    temp_indices->mutable_data_as<uint64_t>(),
+                                    GetSortExecutor(ctx_));
+    RETURN_NOT_OK(sorter.Sort(indices_begin_, indices_end_));
+
+    const auto num_keys = static_cast<size_t>(encoder.num_keys());
+    if (num_keys < sort_keys_.size()) {
+      const ChunkResolver resolver(batches_);
+      sorter.VisitEqualRanges(
+          indices_begin_, indices_end_, [&](uint64_t* range_begin, uint64_t* range_end) {
+            std::stable_sort(range_begin, range_end, [&](uint64_t left, uint64_t right) {
+              return comparator_.Compare(resolver.Resolve(left), resolver.Resolve(right),
+                                         num_keys);
+            });
+          });
+    }
+    return comparator_.status();
+  }
+
   // Recursive merge routine, typed on the first sort key
   template <typename ArrowType>
   Status MergeInternal(std::vector<ChunkedNullPartitionResult>* sorted,
@@ -750,29 +1221,22 @@ class TableSorter {
                             null_count);
     };
     auto merge_non_nulls =
-        [&](CompressedChunkLocation* range_begin, CompressedChunkLocation* range_middle,
-            CompressedChunkLocation* range_end, CompressedChunkLocation* temp_indices) {
-          MergeNonNulls<ArrowType>(range_begin, range_middle, range_end, temp_indices);
+        [&](CompressedChunkLocation* left_begin, CompressedChunkLocation* left_end,
+            CompressedChunkLocation* right_begin, CompressedChunkLocation* right_end,
+            CompressedChunkLocation* out) {
+          MergeNonNulls<ArrowType>(left_begin, left_end, right_begin, right_end, out);
         };
+    auto less = [&](CompressedChunkLocation left, CompressedChunkLocation right) {
+      return NonNullsLess<ArrowType>(left, right);
+    };
 
     ChunkedMergeImpl merge_impl(options_.null_placement, std::move(merge_nulls),
-                                std::move(merge_non_nulls));
+                                std::move(merge_non_nulls), std::move(less));
     RETURN_NOT_OK(merge_impl.Init(ctx_, table_.num_rows()));
 
-    while (sorted->size() > 1) {
-      auto out_it = sorted->begin();
-      auto it = sorted->begin();
-      while (it < sorted->end() - 1) {
-        const auto& left = *it++;
-        const auto& right = *it++;
-        DCHECK_EQ(left.overall_end(), right.overall_begin());
-        *out_it++ = merge_impl.Merge(left, right, null_count);
-      }
-      if (it < sorted->end()) {
-        *out_it++ = *it++;
-      }
-      sorted->erase(out_it, sorted->end());
-    }
+    ARROW_ASSIGN_OR_RAISE(auto merged,
+                          merge_impl.MergeAll(std::move(*sorted), null_count));
+    sorted->assign(1, merged);
     return comparator_.status();
   }
 
@@ -830,49 +1294,46 @@ class TableSorter {
   // Merge rows with a non-null in the first sort key
   //
   template <typename ArrowType>
-  enable_if_t<!is_null_type<ArrowType>::value> MergeNonNulls(
-      CompressedChunkLocation* range_begin, CompressedChunkLocation* range_middle,
-      CompressedChunkLocation* range_end, CompressedChunkLocation* temp_indices) {
-    auto& comparator = comparator_;
-    const auto& first_sort_key = sort_keys_[0];
-
-    std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
-               [&](CompressedChunkLocation left, CompressedChunkLocation right) {
-                 // Both values are never null nor NaN.
-                 const auto left_loc = ChunkLocation{left};
-                 const auto right_loc = ChunkLocation{right};
-                 auto chunk_left = first_sort_key.GetChunk(left_loc);
-                 auto chunk_right = first_sort_key.GetChunk(right_loc);
-                 DCHECK(!chunk_left.IsNull());
-                 DCHECK(!chunk_right.IsNull());
-                 const auto value_left = chunk_left.Value<ArrowType>();
-                 const auto value_right = chunk_right.Value<ArrowType>();
-                 if (value_left == value_right) {
-                   // If the left value equals to the right value,
-                   // we need to compare the second and following
-                   // sort keys.
-                   return comparator.Compare(left_loc, right_loc, 1);
-                 } else {
-                   auto compared = value_left < value_right;
-                   if (first_sort_key.order == SortOrder::Ascending) {
-                     return compared;
-                   } else {
-                     return !compared;
-                   }
-                 }
-               });
-
-    // Copy back temp area into main buffer
-    std::copy(temp_indices, temp_indices + (range_end - range_begin), range_begin);
+  bool NonNullsLess(CompressedChunkLocation left, CompressedChunkLocation right) {
+    if constexpr (is_null_type<ArrowType>::value) {
+      // First column is always null
+      return comparator_.Compare(ChunkLocation{left}, ChunkLocation{right}, 1);
+    } else {
+      const auto& first_sort_key = sort_keys_[0];
+      // Both values are never null nor NaN.
+      const auto left_loc = ChunkLocation{left};
+      const auto right_loc = ChunkLocation{right};
+      auto chunk_left = first_sort_key.GetChunk(left_loc);
+      auto chunk_right = first_sort_key.GetChunk(right_loc);
+      DCHECK(!chunk_left.IsNull());
+      DCHECK(!chunk_right.IsNull());
+      const auto value_left = chunk_left.template Value<ArrowType>();
+      const auto value_right = chunk_right.template Value<ArrowType>();
+      if (value_left == value_right) {
+        // If the left value equals to the right value,
+        // we need to compare the second and following
+        // sort keys.
+        return comparator_.Compare(left_loc, right_loc, 1);
+      } else {
+        auto compared = value_left < value_right;
+        if (first_sort_key.order == SortOrder::Ascending) {
+          return compared;
+        } else {
+          return !compared;
+        }
+      }
+    }
   }
 
   template <typename ArrowType>
-  enable_if_null<ArrowType> MergeNonNulls(CompressedChunkLocation* range_begin,
-                                          CompressedChunkLocation* range_middle,
-                                          CompressedChunkLocation* range_end,
-                                          CompressedChunkLocation* temp_indices) {
-    const int64_t null_count = range_end - range_begin;
-    MergeNullsOnly(range_begin, range_middle, range_end, temp_indices, null_count);
+  void MergeNonNulls(CompressedChunkLocation* left_begin,
+                     CompressedChunkLocation* left_end,
+                     CompressedChunkLocation* right_begin,
+                     CompressedChunkLocation* right_end, CompressedChunkLocation* out) {
+    std::merge(left_begin, left_end, right_begin, right_end, out,
+               [&](CompressedChunkLocation left, CompressedChunkLocation right) {
+                 return NonNullsLess<ArrowType>(left, right);
+               });
   }
 
   Status status_;
@@ -1024,7 +1485,11 @@ class SortIndicesMetaFunction : public MetaFunction {
     auto out_end = out_begin + length;
     std::iota(out_begin, out_end, 0);
 
-    if (n_sort_keys <= kMaxRadixSortKeys) {
+    NormalizedKeyRecordBatchSorter normalized_key_sorter(ctx, out_begin, out_end,
+                                                         sort_keys, options);
+    if (normalized_key_sorter.CanSort()) {
+      ARROW_RETURN_NOT_OK(normalized_key_sorter.Sort());
+    } else if (n_sort_keys <= kMaxRadixSortKeys) {
       RadixRecordBatchSorter sorter(out_begin, out_end, std::move(sort_keys), options);
       ARROW_RETURN_NOT_OK(sorter.Sort());
     } else {
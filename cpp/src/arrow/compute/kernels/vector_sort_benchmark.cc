@@ -399,6 +399,48 @@ BatchOrTableBenchmarkData MakeBatchOrTableBenchmarkDataInt64(
   return data;
 }
 
+// Make columns of various fixed-width types, which can all be normalized
+BatchOrTableBenchmarkData MakeBatchOrTableBenchmarkDataFixedWidth(
+    const RecordBatchSortIndicesArgs& args, int64_t num_chunks) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  FieldVector fields;
+  BatchOrTableBenchmarkData data;
+
+  const auto num_records_in_array = args.num_records / num_chunks;
+  for (int64_t i = 0; i < args.num_columns; ++i) {
+    auto name = std::to_string(i);
+    auto order = (i % 2) == 0 ? SortOrder::Ascending : SortOrder::Descending;
+    data.sort_keys.emplace_back(name, order);
+    ArrayVector chunks;
+    for (int64_t j = 0; j < num_chunks; ++j) {
+      switch (i % 4) {
+        case 0:
+          chunks.push_back(
+              rand.Int16(num_records_in_array, -100, 100, args.null_proportion));
+          break;
+        case 1:
+          chunks.push_back(
+              rand.Float64(num_records_in_array, -1.0, 1.0, args.null_proportion));
+          break;
+        case 2:
+          chunks.push_back(rand.UInt8(num_records_in_array, 0, 10, args.null_proportion));
+          break;
+        default:
+          chunks.push_back(rand.Int32(num_records_in_array, -1000000, 1000000,
+                                      args.null_proportion));
+          break;
+      }
+    }
+    auto type = chunks[0]->type();
+    fields.push_back(field(name, type));
+    ASSIGN_OR_ABORT(auto chunked_array, ChunkedArray::Make(chunks, type));
+    data.columns.push_back(chunked_array);
+  }
+
+  data.schema = schema(fields);
+  return data;
+}
+
 static void RecordBatchSortIndicesInt64(benchmark::State& state, int64_t min,
                                         int64_t max) {
   RecordBatchSortIndicesArgs args(state);
@@ -442,6 +484,29 @@ static void TableSortIndicesInt64Wide(benchmark::State& state) {
                         std::numeric_limits<int64_t>::max());
 }
 
+static void RecordBatchSortIndicesFixedWidth(benchmark::State& state) {
+  RecordBatchSortIndicesArgs args(state);
+
+  auto data = MakeBatchOrTableBenchmarkDataFixedWidth(args, /*num_chunks=*/1);
+  ArrayVector columns;
+  for (const auto& chunked : data.columns) {
+    columns.push_back(chunked->chunk(0));
+  }
+
+  auto batch = RecordBatch::Make(data.schema, args.num_records, columns);
+  SortOptions options(data.sort_keys);
+  DatumSortIndicesBenchmark(state, Datum(*batch), options);
+}
+
+static void TableSortIndicesFixedWidth(benchmark::State& state) {
+  TableSortIndicesArgs args(state);
+
+  auto data = MakeBatchOrTableBenchmarkDataFixedWidth(args, args.num_chunks);
+  auto table = Table::Make(data.schema, data.columns, args.num_records);
+  SortOptions options(data.sort_keys);
+  DatumSortIndicesBenchmark(state, Datum(*table), options);
+}
+
 //
 // Sort benchmark declarations
 //
@@ -500,6 +565,23 @@ BENCHMARK(TableSortIndicesInt64Wide)
     })
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(RecordBatchSortIndicesFixedWidth)
+    ->ArgsProduct({
+        {1 << 20},      // the number of records
+        {100, 4, 0},    // inverse null proportion
+        {16, 8, 4, 2},  // the number of columns
+    })
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(TableSortIndicesFixedWidth)
+    ->ArgsProduct({
+        {1 << 20},      // the number of records
+        {100, 4, 0},    // inverse null proportion
+        {16, 8, 4, 2},  // the number of columns
+        {32, 4, 1},     // the number of chunks
+    })
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 //
 // Rank benchmark declarations
 //
@@ -24,10 +24,13 @@
 
 #include "arrow/array.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
 #include "arrow/compute/kernels/chunked_internal.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow::compute::internal {
 
@@ -340,43 +343,219 @@ NullPartitionResult PartitionNulls(uint64_t* indices_begin, uint64_t* indices_en
                              std::max(q.nulls_end, p.nulls_end)};
 }
 
+// Return the executor to sort on in parallel, or null to sort serially.
+//
+// Sorting doesn't run in parallel when called from a thread of the executor, as
+// waiting for the nested tasks could then deadlock.
+inline ::arrow::internal::Executor* GetSortExecutor(ExecContext* ctx) {
+  auto* executor = ctx->use_threads() ? ctx->executor() : NULLPTR;
+  if (executor == NULLPTR || executor->GetCapacity() <= 1 ||
+      executor->OwnsThisThread()) {
+    return NULLPTR;
+  }
+  return executor;
+}
+
+// Call `func(i)` for i in [0, num_tasks), in parallel on `executor` if not null
+template <typename Function>
+Status SortParallelFor(::arrow::internal::Executor* executor, int num_tasks,
+                       Function&& func) {
+  return ::arrow::internal::OptionalParallelFor(
+      executor != NULLPTR && num_tasks > 1, num_tasks, std::forward<Function>(func),
+      executor);
+}
+
 template <typename IndexType, typename NullPartitionResultType>
 struct GenericMergeImpl {
   using MergeNullsFunc = std::function<void(IndexType* nulls_begin,
                                             IndexType* nulls_middle, IndexType* nulls_end,
                                             IndexType* temp_indices, int64_t null_count)>;
 
+  // Merge two sorted ranges of non-null values into `out`
   using MergeNonNullsFunc =
-      std::function<void(IndexType* range_begin, IndexType* range_middle,
-                         IndexType* range_end, IndexType* temp_indices)>;
+      std::function<void(IndexType* left_begin, IndexType* left_end,
+                         IndexType* right_begin, IndexType* right_end, IndexType* out)>;
+
+  // The ordering of non-null values, as used by MergeNonNullsFunc
+  using NonNullsLessFunc = std::function<bool(IndexType left, IndexType right)>;
+
+  // Merges of non-null values are split in parts of at least this length to run in
+  // parallel
+  static constexpr int64_t kMinParallelMergeLength = 1 << 16;
 
   GenericMergeImpl(NullPlacement null_placement, MergeNullsFunc&& merge_nulls,
-                   MergeNonNullsFunc&& merge_non_nulls)
+                   MergeNonNullsFunc&& merge_non_nulls, NonNullsLessFunc&& less)
       : null_placement_(null_placement),
         merge_nulls_(std::move(merge_nulls)),
-        merge_non_nulls_(std::move(merge_non_nulls)) {}
+        merge_non_nulls_(std::move(merge_non_nulls)),
+        less_(std::move(less)) {}
 
+  // `temp_indices_length` must be the total length of the ranges to merge
   Status Init(ExecContext* ctx, int64_t temp_indices_length) {
     ARROW_ASSIGN_OR_RAISE(
         temp_buffer_,
         AllocateBuffer(sizeof(IndexType) * temp_indices_length, ctx->memory_pool()));
     temp_indices_ = reinterpret_cast<IndexType*>(temp_buffer_->mutable_data());
+    executor_ = GetSortExecutor(ctx);
     return Status::OK();
   }
 
+  // Merge adjacent sorted ranges by pairs, recursively, until a single one remains.
+  //
+  // When running in parallel, the merges of each round run concurrently and are
+  // split in independent parts, whose bounds are found with a binary search along
+  // the "merge path", so that all threads are busy during the last rounds as well.
+  Result<NullPartitionResultType> MergeAll(std::vector<NullPartitionResultType> sorted,
+                                           int64_t null_count) {
+    DCHECK(!sorted.empty());
+    base_indices_ = sorted.front().overall_begin();
+    while (sorted.size() > 1) {
+      const auto num_merges = static_cast<int>(sorted.size() / 2);
+      std::vector<NullPartitionResultType> merged(num_merges);
+      std::vector<NonNullsMerge> non_nulls_merges(num_merges);
+      // First merge nulls and lay out the non-null values of each pair
+      RETURN_NOT_OK(SortParallelFor(executor_, num_merges, [&](int i) {
+        const auto& left = sorted[2 * i];
+        const auto& right = sorted[2 * i + 1];
+        DCHECK_EQ(left.overall_end(), right.overall_begin());
+        merged[i] = Merge(left, right, null_count, &non_nulls_merges[i]);
+        return Status::OK();
+      }));
+      // Then merge the non-null values, in parts
+      const auto parts = SplitNonNullsMerges(non_nulls_merges);
+      RETURN_NOT_OK(
+          SortParallelFor(executor_, static_cast<int>(parts.size()), [&](int i) {
+            const auto& part = parts[i];
+            merge_non_nulls_(part.left_begin, part.left_end, part.right_begin,
+                             part.right_end, TempIndices(part.out));
+            return Status::OK();
+          }));
+      // Copy back temp area into main buffer, once all parts are merged
+      RETURN_NOT_OK(
+          SortParallelFor(executor_, static_cast<int>(parts.size()), [&](int i) {
+            const auto& part = parts[i];
+            const auto length = (part.left_end - part.left_begin) +
+                                (part.right_end - part.right_begin);
+            std::copy(TempIndices(part.out), TempIndices(part.out) + length, part.out);
+            return Status::OK();
+          }));
+      if (sorted.size() % 2 == 1) {
+        merged.push_back(sorted.back());
+      }
+      sorted = std::move(merged);
+    }
+    return sorted.front();
+  }
+
+ private:
+  // A merge of two sorted ranges of non-null values, whose result is written
+  // (through the temp area) from `out`
+  struct NonNullsMerge {
+    IndexType* left_begin = NULLPTR;
+    IndexType* left_end = NULLPTR;
+    IndexType* right_begin = NULLPTR;
+    IndexType* right_end = NULLPTR;
+    IndexType* out = NULLPTR;
+
+    int64_t length() const { return (left_end - left_begin) + (right_end - right_begin); }
+  };
+
+  // The temp area for the given range of indices
+  IndexType* TempIndices(IndexType* indices) const {
+    return temp_indices_ + (indices - base_indices_);
+  }
+
+  // Split merges in parts which can be merged independently
+  std::vector<NonNullsMerge> SplitNonNullsMerges(
+      const std::vector<NonNullsMerge>& merges) const {
+    std::vector<NonNullsMerge> parts;
+    if (executor_ == NULLPTR) {
+      for (const auto& merge : merges) {
+        if (merge.length() > 0) {
+          parts.push_back(merge);
+        }
+      }
+      return parts;
+    }
+    int64_t total_length = 0;
+    for (const auto& merge : merges) {
+      total_length += merge.length();
+    }
+    // Aim for a few parts per thread
+    const int64_t part_length =
+        std::max(kMinParallelMergeLength, total_length / (4 * executor_->GetCapacity()));
+    for (const auto& merge : merges) {
+      const int64_t length = merge.length();
+      if (length == 0) {
+        continue;
+      }
+      const int64_t num_parts = (length + part_length - 1) / part_length;
+      IndexType* left_split = merge.left_begin;
+      IndexType* right_split = merge.right_begin;
+      for (int64_t k = 1; k <= num_parts; ++k) {
+        NonNullsMerge part;
+        part.left_begin = left_split;
+        part.right_begin = right_split;
+        part.out = merge.out + (left_split - merge.left_begin) +
+                   (right_split - merge.right_begin);
+        if (k == num_parts) {
+          left_split = merge.left_end;
+          right_split = merge.right_end;
+        } else {
+          const auto [left_length, right_length] =
+              MergePathSplit(merge, k * length / num_parts);
+          left_split = merge.left_begin + left_length;
+          right_split = merge.right_begin + right_length;
+        }
+        part.left_end = left_split;
+        part.right_end = right_split;
+        parts.push_back(part);
+      }
+    }
+    return parts;
+  }
+
+  // Find how many values of the left and right ranges are among the first `n`
+  // merged values, with ties resolved in favor of the left range as std::merge does
+  std::pair<int64_t, int64_t> MergePathSplit(const NonNullsMerge& merge,
+                                             int64_t n) const {
+    const int64_t left_length = merge.left_end - merge.left_begin;
+    const int64_t right_length = merge.right_end - merge.right_begin;
+    // Find the smallest i such that the i first left values and the n - i first
+    // right values are the n first merged values
+    int64_t lo = std::max<int64_t>(0, n - right_length);
+    int64_t hi = std::min(n, left_length);
+    while (lo < hi) {
+      const int64_t i = lo + (hi - lo) / 2;
+      const int64_t j = n - i;
+      // Is the last right value taken before the next left value?
+      if (j > 0 && i < left_length &&
+          !less_(merge.right_begin[j - 1], merge.left_begin[i])) {
+        lo = i + 1;
+      } else {
+        hi = i;
+      }
+    }
+    return {lo, n - lo};
+  }
+
+  // Merge the nulls of two ranges and lay out their non-null values for
+  // `non_nulls_merge`
   NullPartitionResultType Merge(const NullPartitionResultType& left,
                                 const NullPartitionResultType& right,
-                                int64_t null_count) const {
+                                int64_t null_count,
+                                NonNullsMerge* non_nulls_merge) const {
     if (null_placement_ == NullPlacement::AtStart) {
-      return MergeNullsAtStart(left, right, null_count);
+      return MergeNullsAtStart(left, right, null_count, non_nulls_merge);
     } else {
-      return MergeNullsAtEnd(left, right, null_count);
+      return MergeNullsAtEnd(left, right, null_count, non_nulls_merge);
     }
   }
 
   NullPartitionResultType MergeNullsAtStart(const NullPartitionResultType& left,
                                             const NullPartitionResultType& right,
-                                            int64_t null_count) const {
+                                            int64_t null_count,
+                                            NonNullsMerge* non_nulls_merge) const {
     // Input layout:
     // [left nulls .... left non-nulls .... right nulls .... right non-nulls]
     DCHECK_EQ(left.nulls_end, left.non_nulls_begin);
@@ -396,22 +575,21 @@ struct GenericMergeImpl {
     // null-like values (e.g. NaN) are ordered equally.
     if (p.null_count()) {
       merge_nulls_(p.nulls_begin, p.nulls_begin + left.null_count(), p.nulls_end,
-                   temp_indices_, null_count);
+                   TempIndices(p.nulls_begin), null_count);
     }
 
-    // Merge the non-null values into temp area
+    // The non-null values are then merged into temp area
     DCHECK_EQ(right.non_nulls_begin - p.non_nulls_begin, left.non_null_count());
     DCHECK_EQ(p.non_nulls_end - right.non_nulls_begin, right.non_null_count());
-    if (p.non_null_count()) {
-      merge_non_nulls_(p.non_nulls_begin, right.non_nulls_begin, p.non_nulls_end,
-                       temp_indices_);
-    }
+    *non_nulls_merge = {p.non_nulls_begin, right.non_nulls_begin, right.non_nulls_begin,
+                        p.non_nulls_end, p.non_nulls_begin};
     return p;
   }
 
   NullPartitionResultType MergeNullsAtEnd(const NullPartitionResultType& left,
                                           const NullPartitionResultType& right,
-                                          int64_t null_count) const {
+                                          int64_t null_count,
+                                          NonNullsMerge* non_nulls_merge) const {
     // Input layout:
     // [left non-nulls .... left nulls .... right non-nulls .... right nulls]
     DCHECK_EQ(left.non_nulls_end, left.nulls_begin);
@@ -431,25 +609,25 @@ struct GenericMergeImpl {
     // null-like values (e.g. NaN) are ordered equally.
     if (p.null_count()) {
       merge_nulls_(p.nulls_begin, p.nulls_begin + left.null_count(), p.nulls_end,
-                   temp_indices_, null_count);
+                   TempIndices(p.nulls_begin), null_count);
     }
 
-    // Merge the non-null values into temp area
+    // The non-null values are then merged into temp area
     DCHECK_EQ(left.non_nulls_end - p.non_nulls_begin, left.non_null_count());
     DCHECK_EQ(p.non_nulls_end - left.non_nulls_end, right.non_null_count());
-    if (p.non_null_count()) {
-      merge_non_nulls_(p.non_nulls_begin, left.non_nulls_end, p.non_nulls_end,
-                       temp_indices_);
-    }
+    *non_nulls_merge = {p.non_nulls_begin, left.non_nulls_end, left.non_nulls_end,
+                        p.non_nulls_end, p.non_nulls_begin};
     return p;
   }
 
- private:
   NullPlacement null_placement_;
   MergeNullsFunc merge_nulls_;
   MergeNonNullsFunc merge_non_nulls_;
+  NonNullsLessFunc less_;
   std::unique_ptr<Buffer> temp_buffer_;
-  IndexType* temp_indices_ = nullptr;
+  IndexType* temp_indices_ = NULLPTR;
+  IndexType* base_indices_ = NULLPTR;
+  ::arrow::internal::Executor* executor_ = NULLPTR;
 };
 
 using MergeImpl = GenericMergeImpl<uint64_t, NullPartitionResult>;
@@ -513,6 +691,7 @@ Result<T> PrependInvalidColumn(Result<T> res) {
 }
 
 // Return the field indices of the sort keys, deduplicating them along the way
+ARROW_EXPORT
 Result<std::vector<SortField>> FindSortKeys(const Schema& schema,
                                             const std::vector<SortKey>& sort_keys);
 
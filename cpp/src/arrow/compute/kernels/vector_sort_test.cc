@@ -37,6 +37,7 @@
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -1186,6 +1187,30 @@ class TestChunkedArrayRandomNarrow : public TestChunkedArrayRandomBase<Type> {
 TYPED_TEST_SUITE(TestChunkedArrayRandomNarrow, IntegralArrowTypes);
 TYPED_TEST(TestChunkedArrayRandomNarrow, SortIndices) { this->TestSortIndices(1000); }
 
+// Parallel sorting must give the same result as serial sorting, as it is stable
+TEST(TestChunkedArraySortIndices, Parallel) {
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+  ::arrow::random::RandomArrayGenerator rng(0x5487655);
+
+  for (auto null_probability : {0.0, 0.1}) {
+    ArrayVector chunks;
+    for (int i = 0; i < 37; ++i) {
+      chunks.push_back(rng.Int32(10000, -5000, 5000, null_probability));
+    }
+    ASSERT_OK_AND_ASSIGN(auto chunked_array, ChunkedArray::Make(chunks));
+    for (auto order : AllOrders()) {
+      for (auto null_placement : AllNullPlacements()) {
+        ArraySortOptions options(order, null_placement);
+        ASSERT_OK_AND_ASSIGN(auto expected, SortIndices(*chunked_array, options));
+        ASSERT_OK_AND_ASSIGN(auto actual,
+                             SortIndices(*chunked_array, options, &parallel_ctx));
+        AssertArraysEqual(*expected, *actual);
+      }
+    }
+  }
+}
+
 // Test basic cases for record batch.
 class TestRecordBatchSortIndices : public ::testing::Test {};
 
@@ -2113,6 +2138,110 @@ INSTANTIATE_TEST_SUITE_P(AllNull, TestTableSortIndicesRandom,
                          testing::Combine(first_sort_keys, num_sort_keys,
                                           testing::Values(1.0)));
 
+// Sort tables large enough for MSD radix sorting of normalized keys
+class TestTableSortIndicesRandomFixedWidth : public TestTableSortIndicesRandom {};
+
+TEST_P(TestTableSortIndicesRandomFixedWidth, Sort) {
+  const auto first_sort_key_name = std::get<0>(GetParam());
+  const auto n_sort_keys = std::get<1>(GetParam());
+  const auto null_probability = std::get<2>(GetParam());
+  const auto nan_probability = (1.0 - null_probability) / 4;
+  const auto seed = 0x2c4e1a7f;
+
+  ARROW_SCOPED_TRACE("n_sort_keys = ", n_sort_keys);
+  ARROW_SCOPED_TRACE("null_probability = ", null_probability);
+
+  ::arrow::random::RandomArrayGenerator rng(seed);
+  const int64_t length = 5000;
+  const int64_t num_batches = 4;
+
+  // Small ranges make for many equal normalized keys
+  const FieldVector fields = {
+      field("int8", int8()),       field("uint16", uint16()), field("int32", int32()),
+      field("int64", int64()),     field("double", float64()),
+      field("boolean", boolean()), field("uint64", uint64()),
+  };
+  const auto schema = ::arrow::schema(fields);
+  RecordBatchVector batches;
+  for (int64_t i = 0; i < num_batches; ++i) {
+    const int64_t batch_length = length / num_batches;
+    batches.push_back(RecordBatch::Make(
+        schema, batch_length,
+        {
+            rng.Int8(batch_length, -3, 3, null_probability),
+            rng.UInt16(batch_length, 0, 5, /*null_probability=*/0.0),
+            rng.Int32(batch_length, -1000, 1000, null_probability),
+            rng.Int64(batch_length, -10, 10, null_probability),
+            rng.Float64(batch_length, -2.0, 2.0, null_probability, nan_probability),
+            rng.Boolean(batch_length, /*true_probability=*/0.3, null_probability),
+            rng.UInt64(batch_length, 0, 3, /*null_probability=*/0.0),
+        }));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(schema, batches));
+
+  std::default_random_engine engine(seed);
+  std::vector<SortKey> sort_keys;
+  for (const auto& field : fields) {
+    if (field->name() != first_sort_key_name) {
+      sort_keys.emplace_back(field->name(), (engine() & 1) ? SortOrder::Ascending
+                                                            : SortOrder::Descending);
+    }
+  }
+  std::shuffle(sort_keys.begin(), sort_keys.end(), engine);
+  sort_keys.emplace(sort_keys.begin(), first_sort_key_name, SortOrder::Descending);
+  sort_keys.erase(sort_keys.begin() + n_sort_keys, sort_keys.end());
+  SortOptions options(sort_keys);
+
+  for (auto null_placement : AllNullPlacements()) {
+    ARROW_SCOPED_TRACE("null_placement = ", null_placement);
+    options.null_placement = null_placement;
+    ASSERT_OK_AND_ASSIGN(auto offsets, SortIndices(Datum(*table), options));
+    Validate(*table, options, *checked_pointer_cast<UInt64Array>(offsets));
+
+    ASSERT_OK_AND_ASSIGN(auto combined, table->CombineChunksToBatch());
+    ASSERT_OK_AND_ASSIGN(offsets, SortIndices(Datum(combined), options));
+    Validate(*table, options, *checked_pointer_cast<UInt64Array>(offsets));
+  }
+}
+
+// All seven keys exceed the width of normalized keys
+INSTANTIATE_TEST_SUITE_P(NoNull, TestTableSortIndicesRandomFixedWidth,
+                         testing::Combine(testing::Values("int8", "int64", "double"),
+                                          testing::Values(2, 4, 7),
+                                          testing::Values(0.0)));
+
+INSTANTIATE_TEST_SUITE_P(SomeNulls, TestTableSortIndicesRandomFixedWidth,
+                         testing::Combine(testing::Values("int8", "int64", "double"),
+                                          testing::Values(2, 4, 7),
+                                          testing::Values(0.1)));
+
+TEST(TestTableSortIndices, Parallel) {
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+  ::arrow::random::RandomArrayGenerator rng(0x61549225);
+
+  const auto schema = ::arrow::schema({field("a", int16()), field("b", float64())});
+  RecordBatchVector batches;
+  for (int i = 0; i < 23; ++i) {
+    const int64_t length = 10000;
+    batches.push_back(RecordBatch::Make(
+        schema, length,
+        {rng.Int16(length, 0, 100, /*null_probability=*/0.1),
+         rng.Float64(length, -1.0, 1.0, /*null_probability=*/0.1,
+                     /*nan_probability=*/0.1)}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(schema, batches));
+  for (auto null_placement : AllNullPlacements()) {
+    SortOptions options(
+        {SortKey("a", SortOrder::Descending), SortKey("b", SortOrder::Ascending)},
+        null_placement);
+    ASSERT_OK_AND_ASSIGN(auto expected, SortIndices(Datum(table), options));
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         SortIndices(Datum(table), options, &parallel_ctx));
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
 class TestNestedSortIndices : public ::testing::Test {
  protected:
   static std::shared_ptr<Array> GetArray() {
@@ -2469,6 +2598,39 @@ TEST_F(TestRank, EmptyChunks) {
   }
 }
 
+// Ranking in parallel must give the same result as ranking serially
+TEST(TestRankParallel, ArrayAndChunkedArray) {
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+  ::arrow::random::RandomArrayGenerator rng(0x5487655);
+
+  // Large enough to be sorted and ranked in several parts, with many ties
+  auto array = rng.Int32(300000, -1000, 1000, /*null_probability=*/0.1);
+  ASSERT_OK_AND_ASSIGN(
+      auto chunked_array,
+      ChunkedArray::Make({array->Slice(0, 100000), array->Slice(100000)}));
+  for (const Datum& input : {Datum(array), Datum(chunked_array)}) {
+    for (auto order : AllOrders()) {
+      for (auto null_placement : AllNullPlacements()) {
+        for (auto tiebreaker : AllTiebreakers()) {
+          RankOptions options({SortKey("foo", order)}, null_placement, tiebreaker);
+          ARROW_SCOPED_TRACE("options = ", options.ToString());
+          ASSERT_OK_AND_ASSIGN(auto expected, CallFunction("rank", {input}, &options));
+          ASSERT_OK_AND_ASSIGN(auto actual,
+                               CallFunction("rank", {input}, &options, &parallel_ctx));
+          AssertDatumsEqual(expected, actual);
+        }
+        RankQuantileOptions options({SortKey("foo", order)}, null_placement);
+        ASSERT_OK_AND_ASSIGN(auto expected,
+                             CallFunction("rank_quantile", {input}, &options));
+        ASSERT_OK_AND_ASSIGN(auto actual, CallFunction("rank_quantile", {input}, &options,
+                                                       &parallel_ctx));
+        AssertDatumsEqual(expected, actual);
+      }
+    }
+  }
+}
+
 class TestRankQuantile : public BaseTestRank {
  public:
   void AssertRankQuantileGeneric(const std::string& function_name,
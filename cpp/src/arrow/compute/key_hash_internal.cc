@@ -29,6 +29,24 @@
 namespace arrow {
 namespace compute {
 
+namespace {
+
+// Integer keys of 1 to 8 bytes are hashed with MurmurHash3's 64-bit finalizer, which
+// makes every hash bit depend on every key bit.  A multiplication alone only carries
+// low key bits upwards, so keys differing only in their high bits (e.g. timestamps
+// truncated to a coarser unit) would share the top hash bits used to pick a Swiss
+// table block or a partition.
+inline uint64_t HashIntKey(uint64_t key) {
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  key *= 0xc4ceb9fe1a85ec53ULL;
+  key ^= key >> 33;
+  return key;
+}
+
+}  // namespace
+
 inline uint32_t Hashing32::Round(uint32_t acc, uint32_t input) {
   acc += input * PRIME32_2;
   acc = ROTL(acc, 13);
@@ -298,10 +316,8 @@ void Hashing32::HashBit(bool combine_hashes, int64_t bit_offset, uint32_t num_ke
 
 template <bool T_COMBINE_HASHES, typename T>
 void Hashing32::HashIntImp(uint32_t num_keys, const T* keys, uint32_t* hashes) {
-  constexpr uint64_t multiplier = 11400714785074694791ULL;
   for (uint32_t ikey = 0; ikey < num_keys; ++ikey) {
-    uint64_t x = static_cast<uint64_t>(keys[ikey]);
-    uint32_t hash = static_cast<uint32_t>(BYTESWAP(x * multiplier));
+    uint32_t hash = static_cast<uint32_t>(HashIntKey(static_cast<uint64_t>(keys[ikey])));
 
     if (T_COMBINE_HASHES) {
       hashes[ikey] = CombineHashesImp(hashes[ikey], hash);
@@ -751,10 +767,8 @@ void Hashing64::HashBit(bool combine_hashes, int64_t bit_offset, uint32_t num_ke
 
 template <bool T_COMBINE_HASHES, typename T>
 void Hashing64::HashIntImp(uint32_t num_keys, const T* keys, uint64_t* hashes) {
-  constexpr uint64_t multiplier = 11400714785074694791ULL;
   for (uint32_t ikey = 0; ikey < num_keys; ++ikey) {
-    uint64_t x = static_cast<uint64_t>(keys[ikey]);
-    uint64_t hash = static_cast<uint64_t>(BYTESWAP(x * multiplier));
+    uint64_t hash = static_cast<uint64_t>(HashIntKey(static_cast<uint64_t>(keys[ikey])));
 
     if (T_COMBINE_HASHES) {
       hashes[ikey] = CombineHashesImp(hashes[ikey], hash);
@@ -315,6 +315,38 @@ TEST(VectorHash, FixedLengthTailByteSafety) {
   HashFixedLengthFrom(/*key_length=*/19, /*num_rows=*/64, /*start_row=*/63);
 }
 
+// Integer keys differing only in their high bits must still spread over the top
+// hash bits, which pick the Swiss table block.
+TEST(VectorHash, IntegerKeysSpreadTopBits) {
+  constexpr int kNumKeys = 1 << 12;
+  constexpr int kTopBits = 16;
+  for (int shift : {0, 20, 40, 52}) {
+    ARROW_SCOPED_TRACE("shift = ", shift);
+    std::vector<uint64_t> keys(kNumKeys);
+    for (int i = 0; i < kNumKeys; ++i) {
+      keys[i] = static_cast<uint64_t>(i) << shift;
+    }
+    const auto* key_bytes = reinterpret_cast<const uint8_t*>(keys.data());
+
+    std::vector<uint32_t> hashes32(kNumKeys);
+    std::vector<uint64_t> hashes64(kNumKeys);
+    Hashing32::HashFixed(/*hardware_flags=*/0, /*combine_hashes=*/false, kNumKeys,
+                         sizeof(uint64_t), key_bytes, hashes32.data(),
+                         /*temp_hashes_for_combine=*/nullptr);
+    Hashing64::HashFixed(/*combine_hashes=*/false, kNumKeys, sizeof(uint64_t), key_bytes,
+                         hashes64.data());
+
+    std::unordered_set<uint32_t> top32, top64;
+    for (int i = 0; i < kNumKeys; ++i) {
+      top32.insert(hashes32[i] >> (32 - kTopBits));
+      top64.insert(static_cast<uint32_t>(hashes64[i] >> (64 - kTopBits)));
+    }
+    // With 2^16 buckets, about 3% of 2^12 random hashes share a bucket
+    ASSERT_GT(top32.size(), kNumKeys * 9 / 10);
+    ASSERT_GT(top64.size(), kNumKeys * 9 / 10);
+  }
+}
+
 // Make sure that Hashing32/64::HashBatch uses no more stack space than declared in
 // Hashing32/64::kHashBatchTempStackUsage.
 TEST(VectorHash, HashBatchTempStackUsage) {
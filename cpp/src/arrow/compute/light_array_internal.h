@@ -42,6 +42,10 @@ namespace compute {
 /// the execution engine.
 struct LightContext {
   bool has_avx2() const { return (hardware_flags & arrow::internal::CpuInfo::AVX2) > 0; }
+  bool has_avx512() const {
+    return (hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+           arrow::internal::CpuInfo::AVX512;
+  }
   int64_t hardware_flags;
   util::TempVectorStack* stack;
 };
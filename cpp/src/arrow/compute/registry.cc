@@ -18,6 +18,7 @@
 #include "arrow/compute/registry.h"
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -96,6 +97,38 @@ class FunctionRegistry::FunctionRegistryImpl {
     return it->second;
   }
 
+  Status AddDeviceFunction(DeviceAllocationType device_type,
+                           std::shared_ptr<Function> function, bool allow_overwrite) {
+#ifndef NDEBUG
+    RETURN_NOT_OK(function->Validate());
+#endif
+
+    std::lock_guard<std::mutex> mutation_guard(lock_);
+
+    auto key = std::make_pair(device_type, function->name());
+    if (!allow_overwrite && device_functions_.count(key) > 0) {
+      return Status::KeyError("Already have a function registered with name: ",
+                              key.second, " for device type ",
+                              static_cast<int>(device_type));
+    }
+    device_functions_[std::move(key)] = std::move(function);
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Function>> GetDeviceFunction(DeviceAllocationType device_type,
+                                                      const std::string& name) const {
+    auto it = device_functions_.find(std::make_pair(device_type, name));
+    if (it == device_functions_.end()) {
+      if (parent_ != NULLPTR) {
+        return parent_->GetDeviceFunction(device_type, name);
+      }
+      return Status::NotImplemented("No function registered with name: ", name,
+                                    " for device type ",
+                                    static_cast<int>(device_type));
+    }
+    return it->second;
+  }
+
   std::vector<std::string> GetFunctionNames() const {
     std::vector<std::string> results;
     if (parent_ != NULLPTR) {
@@ -210,6 +243,8 @@ class FunctionRegistry::FunctionRegistryImpl {
   std::mutex lock_;
   std::unordered_map<std::string, std::shared_ptr<Function>> name_to_function_;
   std::unordered_map<std::string, const FunctionOptionsType*> name_to_options_type_;
+  std::map<std::pair<DeviceAllocationType, std::string>, std::shared_ptr<Function>>
+      device_functions_;
 
   const Function* cast_function_;
 };
@@ -264,6 +299,17 @@ Result<std::shared_ptr<Function>> FunctionRegistry::GetFunction(
   return impl_->GetFunction(name);
 }
 
+Status FunctionRegistry::AddDeviceFunction(DeviceAllocationType device_type,
+                                           std::shared_ptr<Function> function,
+                                           bool allow_overwrite) {
+  return impl_->AddDeviceFunction(device_type, std::move(function), allow_overwrite);
+}
+
+Result<std::shared_ptr<Function>> FunctionRegistry::GetDeviceFunction(
+    DeviceAllocationType device_type, const std::string& name) const {
+  return impl_->GetDeviceFunction(device_type, name);
+}
+
 std::vector<std::string> FunctionRegistry::GetFunctionNames() const {
   return impl_->GetFunctionNames();
 }
@@ -26,6 +26,7 @@
 
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -95,6 +96,25 @@ class ARROW_EXPORT FunctionRegistry {
   /// \brief Retrieve a function by name from the registry.
   Result<std::shared_ptr<Function>> GetFunction(const std::string& name) const;
 
+  /// \brief Add a function for data resident on a device other than the CPU.
+  ///
+  /// CallFunction() executes it, instead of the function of the same name, when
+  /// an argument has a buffer on a device of this type.  Since kernels expect
+  /// CPU memory, such functions are usually MetaFunctions.
+  ///
+  /// \returns Status::KeyError if a function with the same name is already registered
+  /// for this device type.
+  Status AddDeviceFunction(DeviceAllocationType device_type,
+                           std::shared_ptr<Function> function,
+                           bool allow_overwrite = false);
+
+  /// \brief Retrieve a function by name for data resident on a device.
+  ///
+  /// \returns Status::NotImplemented if no function with this name is registered for
+  /// this device type.
+  Result<std::shared_ptr<Function>> GetDeviceFunction(DeviceAllocationType device_type,
+                                                      const std::string& name) const;
+
   /// \brief Return vector of all entry names in the registry.
   ///
   /// Helpful for displaying a manifest of available functions.
@@ -240,5 +240,30 @@ TEST(TestRegistry, RegisterNestedFunctions) {
   }
 }
 
+TEST(TestRegistry, RegisterDeviceFunctions) {
+  auto registry = FunctionRegistry::Make();
+  std::shared_ptr<Function> func = std::make_shared<ScalarFunction>(
+      "f1", Arity::Unary(), /*doc=*/FunctionDoc::Empty());
+  ASSERT_OK(registry->AddDeviceFunction(DeviceAllocationType::kCUDA, func));
+  ASSERT_RAISES(KeyError,
+                registry->AddDeviceFunction(DeviceAllocationType::kCUDA, func));
+  ASSERT_OK(registry->AddDeviceFunction(DeviceAllocationType::kCUDA, func,
+                                        /*allow_overwrite=*/true));
+
+  ASSERT_OK_AND_ASSIGN(auto f1,
+                       registry->GetDeviceFunction(DeviceAllocationType::kCUDA, "f1"));
+  ASSERT_EQ(f1, func);
+  // Device functions are separate from CPU functions and other devices' functions
+  ASSERT_RAISES(KeyError, registry->GetFunction("f1"));
+  ASSERT_RAISES(NotImplemented,
+                registry->GetDeviceFunction(DeviceAllocationType::kROCM, "f1"));
+  ASSERT_EQ(0, registry->num_functions());
+
+  // Nested registries see their parent's device functions
+  auto nested = FunctionRegistry::Make(registry.get());
+  ASSERT_OK_AND_ASSIGN(f1, nested->GetDeviceFunction(DeviceAllocationType::kCUDA, "f1"));
+  ASSERT_EQ(f1, func);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -174,6 +174,46 @@ class ARROW_EXPORT KeyCompare {
       const uint32_t* left_to_right_map, LightContext* ctx, const KeyColumnArray& col,
       const RowTableImpl& rows, uint8_t* match_bytevector);
 
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+
+  // Compare keys wider than 8 bytes one row at a time, 64 bytes at a time. Return 0
+  // for narrower fixed-length columns, which are left to the AVX2 version.
+  //
+  static uint32_t CompareBinaryColumnToRow_avx512(
+      bool use_selection, uint32_t offset_within_row, uint32_t num_rows_to_compare,
+      const uint16_t* sel_left_maybe_null, const uint32_t* left_to_right_map,
+      LightContext* ctx, const KeyColumnArray& col, const RowTableImpl& rows,
+      uint8_t* match_bytevector);
+
+  static uint32_t CompareVarBinaryColumnToRow_avx512(
+      bool use_selection, bool is_first_varbinary_col, uint32_t id_varlen_col,
+      uint32_t num_rows_to_compare, const uint16_t* sel_left_maybe_null,
+      const uint32_t* left_to_right_map, LightContext* ctx, const KeyColumnArray& col,
+      const RowTableImpl& rows, uint8_t* match_bytevector);
+
+  static uint32_t AndByteVectors_avx512(uint32_t num_elements, uint8_t* bytevector_A,
+                                        const uint8_t* bytevector_B);
+
+#endif
+
+#if defined(ARROW_HAVE_NEON)
+
+  // Same as the AVX-512 versions, 16 bytes at a time
+  //
+  static uint32_t CompareBinaryColumnToRow_neon(
+      bool use_selection, uint32_t offset_within_row, uint32_t num_rows_to_compare,
+      const uint16_t* sel_left_maybe_null, const uint32_t* left_to_right_map,
+      LightContext* ctx, const KeyColumnArray& col, const RowTableImpl& rows,
+      uint8_t* match_bytevector);
+
+  static uint32_t CompareVarBinaryColumnToRow_neon(
+      bool use_selection, bool is_first_varbinary_col, uint32_t id_varlen_col,
+      uint32_t num_rows_to_compare, const uint16_t* sel_left_maybe_null,
+      const uint32_t* left_to_right_map, LightContext* ctx, const KeyColumnArray& col,
+      const RowTableImpl& rows, uint8_t* match_bytevector);
+
 #endif
 };
 
@@ -0,0 +1,180 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/row/compare_internal.h"
+#include "arrow/compute/util.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// Compares 64 bytes at a time. The last, partial, stripe is read with masked loads,
+// which never touch memory past the given length, so unlike the AVX2 version no
+// rows at the end of the batch need to be left to the scalar version.
+//
+inline bool BytesEqual_avx512(const uint8_t* left, const uint8_t* right,
+                              uint32_t length) {
+  __m512i result_or = _mm512_setzero_si512();
+  uint32_t i = 0;
+  for (; i + 64 <= length; i += 64) {
+    __m512i key_left = _mm512_loadu_si512(left + i);
+    __m512i key_right = _mm512_loadu_si512(right + i);
+    result_or = _mm512_or_si512(result_or, _mm512_xor_si512(key_left, key_right));
+  }
+  if (i < length) {
+    __mmask64 tail_mask = ~0ULL >> (64 - (length - i));
+    __m512i key_left = _mm512_maskz_loadu_epi8(tail_mask, left + i);
+    __m512i key_right = _mm512_maskz_loadu_epi8(tail_mask, right + i);
+    result_or = _mm512_or_si512(result_or, _mm512_xor_si512(key_left, key_right));
+  }
+  return _mm512_test_epi64_mask(result_or, result_or) == 0;
+}
+
+template <bool use_selection>
+void CompareBinaryColumnToRowImp_avx512(uint32_t offset_within_row,
+                                        uint32_t num_rows_to_compare,
+                                        const uint16_t* sel_left_maybe_null,
+                                        const uint32_t* left_to_right_map,
+                                        const KeyColumnArray& col,
+                                        const RowTableImpl& rows,
+                                        uint8_t* match_bytevector) {
+  uint32_t col_width = col.metadata().fixed_length;
+  bool is_fixed_length = rows.metadata().is_fixed_length;
+  const uint8_t* rows_left = col.data(1);
+  const uint8_t* rows_right = is_fixed_length ? rows.fixed_length_rows(/*row_id=*/0)
+                                              : rows.var_length_rows();
+  for (uint32_t i = 0; i < num_rows_to_compare; ++i) {
+    uint32_t irow_left = use_selection ? sel_left_maybe_null[i] : i;
+    // irow_right is used to index into row data so promote to the row offset type.
+    RowTableImpl::offset_type irow_right = left_to_right_map[irow_left];
+    RowTableImpl::offset_type offset_right =
+        (is_fixed_length ? irow_right * rows.metadata().fixed_length
+                         : rows.offsets()[irow_right]) +
+        offset_within_row;
+    bool equal = BytesEqual_avx512(rows_left + irow_left * col_width,
+                                   rows_right + offset_right, col_width);
+    match_bytevector[i] = equal ? 0xff : 0;
+  }
+}
+
+template <bool use_selection, bool is_first_varbinary_col>
+void CompareVarBinaryColumnToRowImp_avx512(uint32_t id_varbinary_col,
+                                           uint32_t num_rows_to_compare,
+                                           const uint16_t* sel_left_maybe_null,
+                                           const uint32_t* left_to_right_map,
+                                           const KeyColumnArray& col,
+                                           const RowTableImpl& rows,
+                                           uint8_t* match_bytevector) {
+  const uint32_t* offsets_left = col.offsets();
+  const RowTableImpl::offset_type* offsets_right = rows.offsets();
+  const uint8_t* rows_left = col.data(2);
+  const uint8_t* rows_right = rows.var_length_rows();
+  for (uint32_t i = 0; i < num_rows_to_compare; ++i) {
+    uint32_t irow_left = use_selection ? sel_left_maybe_null[i] : i;
+    uint32_t irow_right = left_to_right_map[irow_left];
+    uint32_t begin_left = offsets_left[irow_left];
+    uint32_t length_left = offsets_left[irow_left + 1] - begin_left;
+    RowTableImpl::offset_type begin_right = offsets_right[irow_right];
+    uint32_t length_right;
+    uint32_t offset_within_row;
+    if (!is_first_varbinary_col) {
+      rows.metadata().nth_varbinary_offset_and_length(
+          rows_right + begin_right, id_varbinary_col, &offset_within_row, &length_right);
+    } else {
+      rows.metadata().first_varbinary_offset_and_length(
+          rows_right + begin_right, &offset_within_row, &length_right);
+    }
+    begin_right += offset_within_row;
+    bool equal = length_left == length_right &&
+                 BytesEqual_avx512(rows_left + begin_left, rows_right + begin_right,
+                                   length_left);
+    match_bytevector[i] = equal ? 0xff : 0;
+  }
+}
+
+}  // namespace
+
+uint32_t KeyCompare::CompareBinaryColumnToRow_avx512(
+    bool use_selection, uint32_t offset_within_row, uint32_t num_rows_to_compare,
+    const uint16_t* sel_left_maybe_null, const uint32_t* left_to_right_map,
+    LightContext* ctx, const KeyColumnArray& col, const RowTableImpl& rows,
+    uint8_t* match_bytevector) {
+  uint32_t col_width = col.metadata().fixed_length;
+  // Bits and 1, 2, 4 and 8 byte values are compared 8 rows at a time by the AVX2
+  // version
+  if (col_width == 0 || col_width == 1 || col_width == 2 || col_width == 4 ||
+      col_width == 8) {
+    return 0;
+  }
+
+  if (use_selection) {
+    CompareBinaryColumnToRowImp_avx512<true>(offset_within_row, num_rows_to_compare,
+                                             sel_left_maybe_null, left_to_right_map, col,
+                                             rows, match_bytevector);
+  } else {
+    CompareBinaryColumnToRowImp_avx512<false>(offset_within_row, num_rows_to_compare,
+                                              sel_left_maybe_null, left_to_right_map, col,
+                                              rows, match_bytevector);
+  }
+  return num_rows_to_compare;
+}
+
+uint32_t KeyCompare::CompareVarBinaryColumnToRow_avx512(
+    bool use_selection, bool is_first_varbinary_col, uint32_t id_varlen_col,
+    uint32_t num_rows_to_compare, const uint16_t* sel_left_maybe_null,
+    const uint32_t* left_to_right_map, LightContext* ctx, const KeyColumnArray& col,
+    const RowTableImpl& rows, uint8_t* match_bytevector) {
+  if (use_selection) {
+    if (is_first_varbinary_col) {
+      CompareVarBinaryColumnToRowImp_avx512<true, true>(
+          id_varlen_col, num_rows_to_compare, sel_left_maybe_null, left_to_right_map, col,
+          rows, match_bytevector);
+    } else {
+      CompareVarBinaryColumnToRowImp_avx512<true, false>(
+          id_varlen_col, num_rows_to_compare, sel_left_maybe_null, left_to_right_map, col,
+          rows, match_bytevector);
+    }
+  } else {
+    if (is_first_varbinary_col) {
+      CompareVarBinaryColumnToRowImp_avx512<false, true>(
+          id_varlen_col, num_rows_to_compare, sel_left_maybe_null, left_to_right_map, col,
+          rows, match_bytevector);
+    } else {
+      CompareVarBinaryColumnToRowImp_avx512<false, false>(
+          id_varlen_col, num_rows_to_compare, sel_left_maybe_null, left_to_right_map, col,
+          rows, match_bytevector);
+    }
+  }
+  return num_rows_to_compare;
+}
+
+uint32_t KeyCompare::AndByteVectors_avx512(uint32_t num_elements, uint8_t* bytevector_A,
+                                           const uint8_t* bytevector_B) {
+  constexpr int unroll = 64;
+  for (uint32_t i = 0; i < num_elements / unroll; ++i) {
+    __m512i result = _mm512_and_si512(
+        _mm512_loadu_si512(reinterpret_cast<const __m512i*>(bytevector_A) + i),
+        _mm512_loadu_si512(reinterpret_cast<const __m512i*>(bytevector_B) + i));
+    _mm512_storeu_si512(reinterpret_cast<__m512i*>(bytevector_A) + i, result);
+  }
+  return (num_elements - (num_elements % unroll));
+}
+
+}  // namespace compute
+}  // namespace arrow
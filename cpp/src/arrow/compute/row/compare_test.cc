@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <numeric>
 
 #include "arrow/compute/row/compare_internal.h"
@@ -273,6 +274,47 @@ void AssertCompareColumnsToRowsAllMatch(const std::vector<KeyColumnArray>& colum
 
 }  // namespace
 
+// Keys wider than a vector register, whose last partial stripe is compared with masked
+// or narrower loads
+TEST(KeyCompare, CompareColumnsToRowsWideKeys) {
+  constexpr int64_t num_rows = 1000;
+  for (int fixed_length : {3, 9, 63, 64, 65, 130}) {
+    ARROW_SCOPED_TRACE("fixed_length=", fixed_length);
+    ASSERT_OK_AND_ASSIGN(auto value_fixed_length,
+                         Random(fixed_size_binary(fixed_length))->Generate(num_rows));
+    auto value_var_length =
+        RandomArrayGenerator(kSeedMax).String(num_rows, /*min_length=*/17,
+                                              /*max_length=*/150,
+                                              /*null_probability=*/0);
+    for (auto values : std::vector<std::vector<Datum>>{{value_fixed_length},
+                                                       {value_var_length},
+                                                       {value_fixed_length,
+                                                        value_var_length}}) {
+      ExecBatch batch(std::move(values), num_rows);
+      std::vector<KeyColumnArray> columns;
+      ASSERT_OK(ColumnArraysFromExecBatch(batch, &columns));
+      ASSERT_OK_AND_ASSIGN(RowTableImpl row_table, MakeRowTableFromExecBatch(batch));
+
+      std::vector<uint32_t> row_ids(num_rows);
+      std::iota(row_ids.begin(), row_ids.end(), 0);
+      AssertCompareColumnsToRowsAllMatch(columns, row_table, row_ids);
+
+      // Every row compared to the next one, which is different
+      std::rotate(row_ids.begin(), row_ids.begin() + 1, row_ids.end());
+      TempVectorStack stack;
+      ASSERT_OK(stack.Init(default_memory_pool(),
+                           KeyCompare::CompareColumnsToRowsTempStackUsage(num_rows)));
+      LightContext ctx{CpuInfo::GetInstance()->hardware_flags(), &stack};
+      std::vector<uint8_t> match_bitvector(BytesForBits(num_rows));
+      KeyCompare::CompareColumnsToRows(
+          num_rows, /*sel_left_maybe_null=*/NULLPTR, row_ids.data(), &ctx,
+          /*out_num_rows=*/NULLPTR, /*out_sel_left_maybe_same=*/NULLPTR, columns,
+          row_table, /*are_cols_in_encoding_order=*/true, match_bitvector.data());
+      ASSERT_EQ(CountSetBits(match_bitvector.data(), 0, num_rows), 0);
+    }
+  }
+}
+
 // Compare columns to rows at offsets over 2GB within a row table.
 // Certain AVX2 instructions may behave unexpectedly causing troubles like GH-41813.
 TEST(KeyCompare, LARGE_MEMORY_TEST(CompareColumnsToRowsOver2GB)) {
@@ -778,17 +778,25 @@ void EncoderVarBinary::Decode(uint32_t start_row, uint32_t num_rows,
                               KeyColumnArray* col, LightContext* ctx) {
   // Output column varbinary buffer needs an extra 32B
   // at the end in avx2 version and 8B otherwise.
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (ctx->has_avx512()) {
+    DecodeHelper_avx512(start_row, num_rows, varbinary_col_id, rows, col);
+    return;
+  }
+#endif
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (ctx->has_avx2()) {
     DecodeHelper_avx2(start_row, num_rows, varbinary_col_id, rows, col);
-  } else {
+    return;
+  }
 #endif
-    if (varbinary_col_id == 0) {
-      DecodeImp<true>(start_row, num_rows, varbinary_col_id, rows, col);
-    } else {
-      DecodeImp<false>(start_row, num_rows, varbinary_col_id, rows, col);
-    }
-#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#if defined(ARROW_HAVE_NEON)
+  DecodeHelper_neon(start_row, num_rows, varbinary_col_id, rows, col);
+#else
+  if (varbinary_col_id == 0) {
+    DecodeImp<true>(start_row, num_rows, varbinary_col_id, rows, col);
+  } else {
+    DecodeImp<false>(start_row, num_rows, varbinary_col_id, rows, col);
   }
 #endif
 }
@@ -310,6 +310,24 @@ class EncoderVarBinary {
                              uint32_t varbinary_col_id, const RowTableImpl& rows,
                              KeyColumnArray* col);
 #endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  static void DecodeHelper_avx512(uint32_t start_row, uint32_t num_rows,
+                                  uint32_t varbinary_col_id, const RowTableImpl& rows,
+                                  KeyColumnArray* col);
+  template <bool first_varbinary_col>
+  static void DecodeImp_avx512(uint32_t start_row, uint32_t num_rows,
+                               uint32_t varbinary_col_id, const RowTableImpl& rows,
+                               KeyColumnArray* col);
+#endif
+#if defined(ARROW_HAVE_NEON)
+  static void DecodeHelper_neon(uint32_t start_row, uint32_t num_rows,
+                                uint32_t varbinary_col_id, const RowTableImpl& rows,
+                                KeyColumnArray* col);
+  template <bool first_varbinary_col>
+  static void DecodeImp_neon(uint32_t start_row, uint32_t num_rows,
+                             uint32_t varbinary_col_id, const RowTableImpl& rows,
+                             KeyColumnArray* col);
+#endif
 };
 
 class EncoderNulls {
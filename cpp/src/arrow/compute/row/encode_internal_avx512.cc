@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/row/encode_internal.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace compute {
+
+void EncoderVarBinary::DecodeHelper_avx512(uint32_t start_row, uint32_t num_rows,
+                                           uint32_t varbinary_col_id,
+                                           const RowTableImpl& rows,
+                                           KeyColumnArray* col) {
+  if (varbinary_col_id == 0) {
+    DecodeImp_avx512<true>(start_row, num_rows, varbinary_col_id, rows, col);
+  } else {
+    DecodeImp_avx512<false>(start_row, num_rows, varbinary_col_id, rows, col);
+  }
+}
+
+template <bool first_varbinary_col>
+void EncoderVarBinary::DecodeImp_avx512(uint32_t start_row, uint32_t num_rows,
+                                        uint32_t varbinary_col_id,
+                                        const RowTableImpl& rows, KeyColumnArray* col) {
+  DecodeHelper<first_varbinary_col>(
+      start_row, num_rows, varbinary_col_id, &rows, nullptr, col, col,
+      [](uint8_t* dst, const uint8_t* src, int64_t length) {
+        int64_t i = 0;
+        for (; i + 64 <= length; i += 64) {
+          _mm512_storeu_si512(dst + i, _mm512_loadu_si512(src + i));
+        }
+        // Masked copy of the last, partial, 64 bytes, which writes nothing past the
+        // value
+        if (i < length) {
+          __mmask64 tail_mask = ~0ULL >> (64 - (length - i));
+          _mm512_mask_storeu_epi8(dst + i, tail_mask,
+                                  _mm512_maskz_loadu_epi8(tail_mask, src + i));
+        }
+      });
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -17,15 +17,20 @@
 
 #include "arrow/compute/row/grouper.h"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <type_traits>
+#include <utility>
 
 #include "arrow/array/builder_primitive.h"
 
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/function.h"
+#include "arrow/compute/kernels/ree_util_internal.h"
 #include "arrow/compute/key_hash_internal.h"
 #include "arrow/compute/light_array_internal.h"
 #include "arrow/compute/registry.h"
@@ -431,6 +436,202 @@ struct AnyKeysSegmenter : public BaseRowSegmenter {
   group_id_t save_group_id_;
 };
 
+// Segments on any number of keys by comparing each row with the previous one,
+// column by column, without hashing.  This applies to keys of fixed-width
+// (other than dictionaries) and base binary types, which may be null.
+struct AdjacentKeysSegmenter : public BaseRowSegmenter {
+  static bool CanUse(const std::vector<TypeHolder>& key_types) {
+    for (const auto& key_type : key_types) {
+      const auto id = key_type.id();
+      if (id == Type::NA || id == Type::DICTIONARY || id == Type::EXTENSION ||
+          !(is_fixed_width(id) || is_base_binary_like(id))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static Result<std::unique_ptr<RowSegmenter>> Make(
+      const std::vector<TypeHolder>& key_types) {
+    DCHECK(CanUse(key_types));
+    return std::make_unique<AdjacentKeysSegmenter>(key_types);
+  }
+
+  explicit AdjacentKeysSegmenter(const std::vector<TypeHolder>& key_types)
+      : BaseRowSegmenter(key_types) {}
+
+  Status Reset() override {
+    save_keys_.clear();
+    return Status::OK();
+  }
+
+  ARROW_DEPRECATED("Deprecated in 18.0.0. Use GetSegments instead.")
+  Result<Segment> GetNextSegment(const ExecSpan& batch, int64_t offset) override {
+    ARROW_SUPPRESS_DEPRECATION_WARNING
+    ARROW_RETURN_NOT_OK(CheckForGetNextSegment(batch, offset, key_types_));
+    ARROW_UNSUPPRESS_DEPRECATION_WARNING
+    if (offset == batch.length) {
+      return MakeSegment(batch.length, offset, 0, kEmptyExtends);
+    }
+    std::vector<uint8_t> differs(batch.length, 0);
+    for (const auto& value : batch.values) {
+      MarkDiffering(value, differs.data());
+    }
+    int64_t cursor = offset + 1;
+    while (cursor < batch.length && !differs[cursor]) {
+      ++cursor;
+    }
+    ARROW_ASSIGN_OR_RAISE(bool extends, ExtendsAndSave(batch, offset));
+    return MakeSegment(batch.length, offset, cursor - offset, extends);
+  }
+
+  Result<std::vector<Segment>> GetSegments(const ExecSpan& batch) override {
+    RETURN_NOT_OK(CheckForGetSegments(batch, key_types_));
+    if (batch.length == 0) {
+      return std::vector<Segment>{};
+    }
+    ARROW_ASSIGN_OR_RAISE(bool extends, ExtendsAndSave(batch, 0));
+    // differs[i] is set if row i differs from row i - 1 in any key
+    std::vector<uint8_t> differs(batch.length, 0);
+    for (const auto& value : batch.values) {
+      MarkDiffering(value, differs.data());
+    }
+    std::vector<Segment> segments;
+    int64_t current_offset = 0;
+    for (int64_t cursor = 1; cursor < batch.length; ++cursor) {
+      if (differs[cursor]) {
+        segments.push_back(MakeSegment(batch.length, current_offset,
+                                       cursor - current_offset,
+                                       current_offset == 0 ? extends : false));
+        current_offset = cursor;
+      }
+    }
+    segments.push_back(MakeSegment(batch.length, current_offset,
+                                   batch.length - current_offset,
+                                   current_offset == 0 ? extends : false));
+    RETURN_NOT_OK(SaveKeys(batch, batch.length - 1));
+    return segments;
+  }
+
+ private:
+  template <typename CType>
+  static void MarkDifferingValues(const uint8_t* values, int64_t length,
+                                  uint8_t* differs) {
+    const auto* typed_values = reinterpret_cast<const CType*>(values);
+    for (int64_t i = 1; i < length; ++i) {
+      differs[i] |= typed_values[i] != typed_values[i - 1];
+    }
+  }
+
+  template <typename OffsetType>
+  static void MarkDifferingBinaries(const ArraySpan& data, uint8_t* differs) {
+    const OffsetType* offsets = data.GetValues<OffsetType>(1);
+    const uint8_t* bytes = data.buffers[2].data;
+    for (int64_t i = 1; i < data.length; ++i) {
+      const OffsetType length = offsets[i + 1] - offsets[i];
+      differs[i] |= length != offsets[i] - offsets[i - 1] ||
+                    memcmp(bytes + offsets[i], bytes + offsets[i - 1], length) != 0;
+    }
+  }
+
+  // Set differs[i] if row i of the value differs from row i - 1, where two nulls
+  // are equal.  A scalar doesn't change within a batch.
+  static void MarkDiffering(const ExecValue& value, uint8_t* differs) {
+    if (value.is_scalar()) {
+      return;
+    }
+    const ArraySpan& data = value.array;
+    if (data.length < 2) {
+      return;
+    }
+    // Compare the values in a buffer of their own when nulls must be masked out
+    std::vector<uint8_t> value_differs;
+    uint8_t* out = differs;
+    if (data.MayHaveNulls()) {
+      value_differs.assign(data.length, 0);
+      out = value_differs.data();
+    }
+    const auto id = data.type->id();
+    if (id == Type::BOOL) {
+      const uint8_t* bits = data.buffers[1].data;
+      for (int64_t i = 1; i < data.length; ++i) {
+        out[i] |= bit_util::GetBit(bits, data.offset + i) !=
+                  bit_util::GetBit(bits, data.offset + i - 1);
+      }
+    } else if (is_base_binary_like(id)) {
+      if (is_large_binary_like(id)) {
+        MarkDifferingBinaries<int64_t>(data, out);
+      } else {
+        MarkDifferingBinaries<int32_t>(data, out);
+      }
+    } else {
+      const int64_t byte_width = data.type->byte_width();
+      const uint8_t* values = data.buffers[1].data + data.offset * byte_width;
+      switch (byte_width) {
+        case 1:
+          MarkDifferingValues<uint8_t>(values, data.length, out);
+          break;
+        case 2:
+          MarkDifferingValues<uint16_t>(values, data.length, out);
+          break;
+        case 4:
+          MarkDifferingValues<uint32_t>(values, data.length, out);
+          break;
+        case 8:
+          MarkDifferingValues<uint64_t>(values, data.length, out);
+          break;
+        default:
+          for (int64_t i = 1; i < data.length; ++i) {
+            out[i] |= memcmp(values + i * byte_width, values + (i - 1) * byte_width,
+                             static_cast<size_t>(byte_width)) != 0;
+          }
+          break;
+      }
+    }
+    if (out != differs) {
+      const uint8_t* validity = data.buffers[0].data;
+      bool prev_valid = bit_util::GetBit(validity, data.offset);
+      for (int64_t i = 1; i < data.length; ++i) {
+        const bool valid = bit_util::GetBit(validity, data.offset + i);
+        differs[i] |= valid != prev_valid || (valid && out[i]);
+        prev_valid = valid;
+      }
+    }
+  }
+
+  static Result<std::shared_ptr<Scalar>> GetKey(const ExecValue& value, int64_t index) {
+    if (value.is_scalar()) {
+      return value.scalar->GetSharedPtr();
+    }
+    return value.array.ToArray()->GetScalar(index);
+  }
+
+  // Whether the row at the given index extends the last saved row, which it then
+  // replaces
+  Result<bool> ExtendsAndSave(const ExecSpan& batch, int64_t index) {
+    bool extends = kDefaultExtends;
+    if (!save_keys_.empty()) {
+      for (int i = 0; i < batch.num_values() && extends; ++i) {
+        ARROW_ASSIGN_OR_RAISE(auto key, GetKey(batch[i], index));
+        extends = key->Equals(*save_keys_[i]);
+      }
+    }
+    RETURN_NOT_OK(SaveKeys(batch, index));
+    return extends;
+  }
+
+  Status SaveKeys(const ExecSpan& batch, int64_t index) {
+    save_keys_.resize(batch.num_values());
+    for (int i = 0; i < batch.num_values(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(save_keys_[i], GetKey(batch[i], index));
+    }
+    return Status::OK();
+  }
+
+  // The keys of the last row seen, empty before the first batch
+  std::vector<std::shared_ptr<Scalar>> save_keys_;
+};
+
 }  // namespace
 
 Result<std::unique_ptr<RowSegmenter>> MakeAnyKeysSegmenter(
@@ -448,6 +649,9 @@ Result<std::unique_ptr<RowSegmenter>> RowSegmenter::Make(
       return SimpleKeySegmenter::Make(key_types[0]);
     }
   }
+  if (AdjacentKeysSegmenter::CanUse(key_types)) {
+    return AdjacentKeysSegmenter::Make(key_types);
+  }
   return AnyKeysSegmenter::Make(key_types, ctx);
 }
 
@@ -504,6 +708,12 @@ struct GrouperImpl : public Grouper {
         continue;
       }
 
+      if (is_binary_view_like(key->id())) {
+        impl->encoders_[i] =
+            std::make_unique<internal::VarLengthKeyEncoder<BinaryViewType>>(key);
+        continue;
+      }
+
       if (key->id() == Type::NA) {
         impl->encoders_[i] = std::make_unique<internal::NullKeyEncoder>();
         continue;
@@ -523,34 +733,42 @@ struct GrouperImpl : public Grouper {
     return Status::OK();
   }
 
-  Result<Datum> Consume(const ExecSpan& batch, int64_t offset, int64_t length) override {
-    ARROW_RETURN_NOT_OK(CheckAndCapLengthForConsume(batch.length, offset, &length));
-    if (offset != 0 || length != batch.length) {
-      auto batch_slice = batch.ToExecBatch().Slice(offset, length);
-      return Consume(ExecSpan(batch_slice), 0, -1);
-    }
-    std::vector<int32_t> offsets_batch(batch.length + 1);
+  Status EncodeKeys(const ExecSpan& batch, std::vector<int32_t>* offsets_batch,
+                    std::vector<uint8_t>* key_bytes_batch) {
+    offsets_batch->assign(batch.length + 1, 0);
     for (int i = 0; i < batch.num_values(); ++i) {
-      encoders_[i]->AddLength(batch[i], batch.length, offsets_batch.data());
+      encoders_[i]->AddLength(batch[i], batch.length, offsets_batch->data());
     }
 
     int32_t total_length = 0;
     for (int64_t i = 0; i < batch.length; ++i) {
       auto total_length_before = total_length;
-      total_length += offsets_batch[i];
-      offsets_batch[i] = total_length_before;
+      total_length += (*offsets_batch)[i];
+      (*offsets_batch)[i] = total_length_before;
     }
-    offsets_batch[batch.length] = total_length;
+    (*offsets_batch)[batch.length] = total_length;
 
-    std::vector<uint8_t> key_bytes_batch(total_length);
+    key_bytes_batch->resize(total_length);
     std::vector<uint8_t*> key_buf_ptrs(batch.length);
     for (int64_t i = 0; i < batch.length; ++i) {
-      key_buf_ptrs[i] = key_bytes_batch.data() + offsets_batch[i];
+      key_buf_ptrs[i] = key_bytes_batch->data() + (*offsets_batch)[i];
     }
 
     for (int i = 0; i < batch.num_values(); ++i) {
       RETURN_NOT_OK(encoders_[i]->Encode(batch[i], batch.length, key_buf_ptrs.data()));
     }
+    return Status::OK();
+  }
+
+  Result<Datum> Consume(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    ARROW_RETURN_NOT_OK(CheckAndCapLengthForConsume(batch.length, offset, &length));
+    if (offset != 0 || length != batch.length) {
+      auto batch_slice = batch.ToExecBatch().Slice(offset, length);
+      return Consume(ExecSpan(batch_slice), 0, -1);
+    }
+    std::vector<int32_t> offsets_batch;
+    std::vector<uint8_t> key_bytes_batch;
+    RETURN_NOT_OK(EncodeKeys(batch, &offsets_batch, &key_bytes_batch));
 
     TypedBufferBuilder<uint32_t> group_ids_batch(ctx_->memory_pool());
     RETURN_NOT_OK(group_ids_batch.Resize(batch.length));
@@ -583,6 +801,37 @@ struct GrouperImpl : public Grouper {
     return Datum(UInt32Array(batch.length, std::move(group_ids)));
   }
 
+  Result<Datum> Lookup(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    ARROW_RETURN_NOT_OK(CheckAndCapLengthForConsume(batch.length, offset, &length));
+    if (offset != 0 || length != batch.length) {
+      auto batch_slice = batch.ToExecBatch().Slice(offset, length);
+      return Lookup(ExecSpan(batch_slice), 0, -1);
+    }
+    std::vector<int32_t> offsets_batch;
+    std::vector<uint8_t> key_bytes_batch;
+    RETURN_NOT_OK(EncodeKeys(batch, &offsets_batch, &key_bytes_batch));
+
+    UInt32Builder group_ids_batch(ctx_->memory_pool());
+    RETURN_NOT_OK(group_ids_batch.Reserve(batch.length));
+
+    for (int64_t i = 0; i < batch.length; ++i) {
+      int32_t key_length = offsets_batch[i + 1] - offsets_batch[i];
+      std::string key(
+          reinterpret_cast<const char*>(key_bytes_batch.data() + offsets_batch[i]),
+          key_length);
+
+      auto it = map_.find(key);
+      if (it == map_.end()) {
+        group_ids_batch.UnsafeAppendNull();
+      } else {
+        group_ids_batch.UnsafeAppend(it->second);
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto group_ids, group_ids_batch.Finish());
+    return Datum(std::move(group_ids));
+  }
+
   uint32_t num_groups() const override { return num_groups_; }
 
   Result<ExecBatch> GetUniques() override {
@@ -622,7 +871,8 @@ struct GrouperFastImpl : public Grouper {
     }
 #if ARROW_LITTLE_ENDIAN
     for (size_t i = 0; i < key_types.size(); ++i) {
-      if (is_large_binary_like(key_types[i].id())) {
+      if (is_large_binary_like(key_types[i].id()) ||
+          is_binary_view_like(key_types[i].id())) {
         return false;
       }
     }
@@ -712,11 +962,12 @@ struct GrouperFastImpl : public Grouper {
     return Status::OK();
   }
 
-  Result<Datum> Consume(const ExecSpan& batch, int64_t offset, int64_t length) override {
+  Result<Datum> ConsumeOrLookup(const ExecSpan& batch, int64_t offset, int64_t length,
+                                bool insert) {
     ARROW_RETURN_NOT_OK(CheckAndCapLengthForConsume(batch.length, offset, &length));
     if (offset != 0 || length != batch.length) {
       auto batch_slice = batch.ToExecBatch().Slice(offset, length);
-      return Consume(ExecSpan(batch_slice), 0, -1);
+      return ConsumeOrLookup(ExecSpan(batch_slice), 0, -1, insert);
     }
     // ARROW-14027: broadcast scalar arguments for now
     for (int i = 0; i < batch.num_values(); i++) {
@@ -730,13 +981,23 @@ struct GrouperFastImpl : public Grouper {
                                     ctx_->memory_pool()));
           }
         }
-        return ConsumeImpl(ExecSpan(expanded));
+        return ConsumeImpl(ExecSpan(expanded), insert);
       }
     }
-    return ConsumeImpl(batch);
+    return ConsumeImpl(batch, insert);
+  }
+
+  Result<Datum> Consume(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    return ConsumeOrLookup(batch, offset, length, /*insert=*/true);
+  }
+
+  Result<Datum> Lookup(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    return ConsumeOrLookup(batch, offset, length, /*insert=*/false);
   }
 
-  Result<Datum> ConsumeImpl(const ExecSpan& batch) {
+  // If `insert` is false, keys missing from the map are not added and their ids are
+  // null in the output.
+  Result<Datum> ConsumeImpl(const ExecSpan& batch, bool insert) {
     int64_t num_rows = batch.length;
     int num_columns = batch.num_values();
     // Process dictionaries
@@ -759,6 +1020,13 @@ struct GrouperFastImpl : public Grouper {
     std::shared_ptr<arrow::Buffer> group_ids;
     ARROW_ASSIGN_OR_RAISE(
         group_ids, AllocateBuffer(sizeof(uint32_t) * num_rows, ctx_->memory_pool()));
+    std::shared_ptr<arrow::Buffer> group_ids_validity;
+    if (!insert) {
+      ARROW_ASSIGN_OR_RAISE(group_ids_validity,
+                            AllocateBitmap(num_rows, ctx_->memory_pool()));
+      // Ids of missing keys are left untouched by the map, zero them out
+      std::memset(group_ids->mutable_data(), 0, sizeof(uint32_t) * num_rows);
+    }
 
     for (int icol = 0; icol < num_columns; ++icol) {
       const uint8_t* non_nulls = NULLPTR;
@@ -810,16 +1078,22 @@ struct GrouperFastImpl : public Grouper {
                   reinterpret_cast<uint32_t*>(group_ids->mutable_data()) + start_row,
                   &temp_stack_, map_equal_impl_, nullptr);
       }
-      auto ids = util::TempVectorHolder<uint16_t>(&temp_stack_, batch_size_next);
-      int num_ids;
-      util::bit_util::bits_to_indexes(0, encode_ctx_.hardware_flags, batch_size_next,
-                                      match_bitvector.mutable_data(), &num_ids,
-                                      ids.mutable_data());
-
-      RETURN_NOT_OK(map_.map_new_keys(
-          num_ids, ids.mutable_data(), minibatch_hashes_.data(),
-          reinterpret_cast<uint32_t*>(group_ids->mutable_data()) + start_row,
-          &temp_stack_, map_equal_impl_, map_append_impl_, nullptr));
+      if (insert) {
+        auto ids = util::TempVectorHolder<uint16_t>(&temp_stack_, batch_size_next);
+        int num_ids;
+        util::bit_util::bits_to_indexes(0, encode_ctx_.hardware_flags, batch_size_next,
+                                        match_bitvector.mutable_data(), &num_ids,
+                                        ids.mutable_data());
+
+        RETURN_NOT_OK(map_.map_new_keys(
+            num_ids, ids.mutable_data(), minibatch_hashes_.data(),
+            reinterpret_cast<uint32_t*>(group_ids->mutable_data()) + start_row,
+            &temp_stack_, map_equal_impl_, map_append_impl_, nullptr));
+      } else {
+        arrow::internal::CopyBitmap(match_bitvector.mutable_data(), /*offset=*/0,
+                                    batch_size_next, group_ids_validity->mutable_data(),
+                                    start_row);
+      }
 
       start_row += batch_size_next;
 
@@ -828,6 +1102,13 @@ struct GrouperFastImpl : public Grouper {
       }
     }
 
+    if (!insert) {
+      int64_t null_count =
+          num_rows - arrow::internal::CountSetBits(group_ids_validity->data(),
+                                                   /*offset=*/0, num_rows);
+      return Datum(UInt32Array(batch.length, std::move(group_ids),
+                               std::move(group_ids_validity), null_count));
+    }
     return Datum(UInt32Array(batch.length, std::move(group_ids)));
   }
 
@@ -979,10 +1260,483 @@ struct GrouperFastImpl : public Grouper {
   SwissTable::AppendImpl map_append_impl_;
 };
 
+// Groups rows by keys of small integer domains (booleans, 8 and 16-bit integers, and
+// dictionaries with such indices) without hashing: the keys of a row are packed into
+// the slot of a direct-indexed table of group ids, each key taking one more value than
+// its domain for nulls.  Dictionaries must be the same for all batches, as with the
+// other groupers.
+struct SmallDomainGrouper : public Grouper {
+  static constexpr int64_t kMaxSlots = int64_t{1} << 17;
+
+  struct Key {
+    TypeHolder type;
+    // The type of the values, or of the indices of dictionaries
+    Type::type value_id;
+    int64_t min_value;
+    uint32_t stride;
+    std::shared_ptr<Array> dictionary;
+  };
+
+  // The values of a key type, if its domain is small, as [min_value, min_value + size)
+  static std::optional<std::pair<int64_t, int64_t>> GetDomain(Type::type id) {
+    switch (id) {
+      case Type::BOOL:
+        return std::make_pair(0, 2);
+      case Type::INT8:
+        return std::make_pair(-128, 256);
+      case Type::UINT8:
+        return std::make_pair(0, 256);
+      case Type::INT16:
+        return std::make_pair(-32768, 65536);
+      case Type::UINT16:
+        return std::make_pair(0, 65536);
+      default:
+        return std::nullopt;
+    }
+  }
+
+  static Type::type GetValueId(const TypeHolder& type) {
+    if (type.id() == Type::DICTIONARY) {
+      return checked_cast<const DictionaryType&>(*type).index_type()->id();
+    }
+    return type.id();
+  }
+
+  static bool CanUse(const std::vector<TypeHolder>& key_types) {
+    if (key_types.empty()) {
+      return false;
+    }
+    int64_t num_slots = 1;
+    for (const auto& key_type : key_types) {
+      auto domain = GetDomain(GetValueId(key_type));
+      if (!domain.has_value()) {
+        return false;
+      }
+      num_slots *= domain->second + 1;
+      if (num_slots > kMaxSlots) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static Result<std::unique_ptr<SmallDomainGrouper>> Make(
+      const std::vector<TypeHolder>& key_types, ExecContext* ctx) {
+    DCHECK(CanUse(key_types));
+    auto impl = std::make_unique<SmallDomainGrouper>();
+    impl->ctx_ = ctx;
+    int64_t num_slots = 1;
+    for (const auto& key_type : key_types) {
+      const auto value_id = GetValueId(key_type);
+      const auto domain = *GetDomain(value_id);
+      impl->keys_.push_back(
+          {key_type, value_id, domain.first, static_cast<uint32_t>(num_slots), NULLPTR});
+      num_slots *= domain.second + 1;
+    }
+    impl->slot_groups_.assign(num_slots, kNoGroupId);
+    return impl;
+  }
+
+  Status Reset() override {
+    std::fill(slot_groups_.begin(), slot_groups_.end(), kNoGroupId);
+    group_slots_.clear();
+    return Status::OK();
+  }
+
+  Result<Datum> Consume(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    return ConsumeOrLookup(batch, offset, length, /*insert=*/true);
+  }
+
+  Result<Datum> Lookup(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    return ConsumeOrLookup(batch, offset, length, /*insert=*/false);
+  }
+
+  uint32_t num_groups() const override {
+    return static_cast<uint32_t>(group_slots_.size());
+  }
+
+  Result<ExecBatch> GetUniques() override {
+    const int64_t num_groups = static_cast<int64_t>(group_slots_.size());
+    ExecBatch out({}, num_groups);
+    for (const auto& key : keys_) {
+      const auto num_values = static_cast<uint32_t>(GetDomain(key.value_id)->second + 1);
+      MemoryPool* pool = ctx_->memory_pool();
+      ARROW_ASSIGN_OR_RAISE(auto validity, AllocateBitmap(num_groups, pool));
+      int64_t null_count = 0;
+      std::shared_ptr<Buffer> values;
+      if (key.value_id == Type::BOOL) {
+        ARROW_ASSIGN_OR_RAISE(values, AllocateBitmap(num_groups, pool));
+      } else {
+        const int byte_width = bit_width(key.value_id) / 8;
+        ARROW_ASSIGN_OR_RAISE(values, AllocateBuffer(num_groups * byte_width, pool));
+      }
+      uint8_t* out_validity = validity->mutable_data();
+      uint8_t* out_values = values->mutable_data();
+      for (int64_t i = 0; i < num_groups; ++i) {
+        const uint32_t code = group_slots_[i] / key.stride % num_values;
+        bit_util::SetBitTo(out_validity, i, code != 0);
+        null_count += code == 0;
+        const int64_t value = code == 0 ? 0 : key.min_value + code - 1;
+        switch (key.value_id) {
+          case Type::BOOL:
+            bit_util::SetBitTo(out_values, i, value != 0);
+            break;
+          case Type::INT8:
+          case Type::UINT8:
+            out_values[i] = static_cast<uint8_t>(value);
+            break;
+          default:
+            reinterpret_cast<uint16_t*>(out_values)[i] = static_cast<uint16_t>(value);
+            break;
+        }
+      }
+      auto data = ArrayData::Make(key.type.GetSharedPtr(), num_groups,
+                                  {std::move(validity), std::move(values)}, null_count);
+      if (key.type.id() == Type::DICTIONARY) {
+        if (key.dictionary) {
+          data->dictionary = key.dictionary->data();
+        } else {
+          const auto& value_type =
+              checked_cast<const DictionaryType&>(*key.type).value_type();
+          ARROW_ASSIGN_OR_RAISE(auto dict, MakeArrayOfNull(value_type, 0));
+          data->dictionary = dict->data();
+        }
+      }
+      out.values.push_back(std::move(data));
+    }
+    return out;
+  }
+
+ private:
+  template <typename CType>
+  static void AddArrayCodes(const ArraySpan& data, const Key& key, uint32_t* slots) {
+    const CType* values = data.GetValues<CType>(1);
+    const uint8_t* validity = data.MayHaveNulls() ? data.buffers[0].data : NULLPTR;
+    for (int64_t i = 0; i < data.length; ++i) {
+      const bool valid =
+          validity == NULLPTR || bit_util::GetBit(validity, data.offset + i);
+      const auto code = valid ? static_cast<uint32_t>(values[i] - key.min_value + 1) : 0;
+      slots[i] += code * key.stride;
+    }
+  }
+
+  static int64_t ScalarValue(const Scalar& scalar, Type::type value_id) {
+    switch (value_id) {
+      case Type::BOOL:
+        return checked_cast<const BooleanScalar&>(scalar).value;
+      case Type::INT8:
+        return checked_cast<const Int8Scalar&>(scalar).value;
+      case Type::UINT8:
+        return checked_cast<const UInt8Scalar&>(scalar).value;
+      case Type::INT16:
+        return checked_cast<const Int16Scalar&>(scalar).value;
+      default:
+        return checked_cast<const UInt16Scalar&>(scalar).value;
+    }
+  }
+
+  static void AddCodes(const ExecValue& value, const Key& key, uint32_t* slots,
+                       int64_t length) {
+    if (value.is_scalar()) {
+      const Scalar* scalar = value.scalar;
+      uint32_t code = 0;
+      if (scalar->is_valid) {
+        if (scalar->type->id() == Type::DICTIONARY) {
+          scalar = checked_cast<const DictionaryScalar&>(*scalar).value.index.get();
+        }
+        code =
+            static_cast<uint32_t>(ScalarValue(*scalar, key.value_id) - key.min_value + 1);
+      }
+      for (int64_t i = 0; i < length; ++i) {
+        slots[i] += code * key.stride;
+      }
+      return;
+    }
+    const ArraySpan& data = value.array;
+    switch (key.value_id) {
+      case Type::BOOL: {
+        const uint8_t* validity = data.MayHaveNulls() ? data.buffers[0].data : NULLPTR;
+        for (int64_t i = 0; i < data.length; ++i) {
+          const bool valid =
+              validity == NULLPTR || bit_util::GetBit(validity, data.offset + i);
+          const uint32_t code =
+              valid ? 1 + bit_util::GetBit(data.buffers[1].data, data.offset + i) : 0;
+          slots[i] += code * key.stride;
+        }
+        break;
+      }
+      case Type::INT8:
+        return AddArrayCodes<int8_t>(data, key, slots);
+      case Type::UINT8:
+        return AddArrayCodes<uint8_t>(data, key, slots);
+      case Type::INT16:
+        return AddArrayCodes<int16_t>(data, key, slots);
+      default:
+        return AddArrayCodes<uint16_t>(data, key, slots);
+    }
+  }
+
+  Status CheckDictionary(const ExecValue& value, Key* key) {
+    std::shared_ptr<Array> dict;
+    if (value.is_scalar()) {
+      if (!value.scalar->is_valid) {
+        return Status::OK();
+      }
+      dict = checked_cast<const DictionaryScalar&>(*value.scalar).value.dictionary;
+    } else {
+      dict = MakeArray(value.array.dictionary().ToArrayData());
+    }
+    if (key->dictionary) {
+      if (!key->dictionary->Equals(dict)) {
+        return Status::NotImplemented("Unifying differing dictionaries");
+      }
+    } else {
+      key->dictionary = std::move(dict);
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> ConsumeOrLookup(const ExecSpan& batch, int64_t offset, int64_t length,
+                                bool insert) {
+    ARROW_RETURN_NOT_OK(CheckAndCapLengthForConsume(batch.length, offset, &length));
+    std::vector<uint32_t> slots(length, 0);
+    for (int i = 0; i < batch.num_values(); ++i) {
+      ExecValue value = batch[i];
+      if (value.is_array()) {
+        value.array.SetSlice(value.array.offset + offset, length);
+      }
+      if (keys_[i].type.id() == Type::DICTIONARY) {
+        RETURN_NOT_OK(CheckDictionary(value, &keys_[i]));
+      }
+      AddCodes(value, keys_[i], slots.data(), length);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto group_ids,
+                          AllocateBuffer(length * sizeof(uint32_t), ctx_->memory_pool()));
+    auto* out = group_ids->mutable_data_as<uint32_t>();
+    if (insert) {
+      for (int64_t i = 0; i < length; ++i) {
+        uint32_t& group = slot_groups_[slots[i]];
+        if (group == kNoGroupId) {
+          group = static_cast<uint32_t>(group_slots_.size());
+          group_slots_.push_back(slots[i]);
+        }
+        out[i] = group;
+      }
+      return Datum(UInt32Array(length, std::move(group_ids)));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto validity, AllocateBitmap(length, ctx_->memory_pool()));
+    int64_t null_count = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      const uint32_t group = slot_groups_[slots[i]];
+      const bool found = group != kNoGroupId;
+      bit_util::SetBitTo(validity->mutable_data(), i, found);
+      null_count += !found;
+      out[i] = found ? group : 0;
+    }
+    return Datum(UInt32Array(length, std::move(group_ids), std::move(validity),
+                             null_count));
+  }
+
+  ExecContext* ctx_;
+  std::vector<Key> keys_;
+  // The group id of each slot, or kNoGroupId
+  std::vector<uint32_t> slot_groups_;
+  // The slot of each group
+  std::vector<uint32_t> group_slots_;
+};
+
+// Groups rows by run-end encoded keys once per run: the physical values of the keys,
+// re-encoded with the runs common to all of them, are grouped by a grouper for their
+// value types, and the group ids of the runs are then decoded to the rows.  Keys
+// mixing run-end encoded arrays with other arrays are decoded instead.
+struct RunEndEncodedGrouper : public Grouper {
+  static Result<std::unique_ptr<RunEndEncodedGrouper>> Make(
+      const std::vector<TypeHolder>& key_types, ExecContext* ctx) {
+    auto impl = std::make_unique<RunEndEncodedGrouper>();
+    impl->ctx_ = ctx;
+    impl->key_types_ = key_types;
+
+    std::vector<TypeHolder> value_types;
+    for (const auto& key_type : key_types) {
+      if (key_type.id() == Type::RUN_END_ENCODED) {
+        value_types.emplace_back(
+            checked_cast<const RunEndEncodedType&>(*key_type).value_type());
+      } else {
+        value_types.push_back(key_type);
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(impl->values_grouper_, Grouper::Make(value_types, ctx));
+    return impl;
+  }
+
+  Status Reset() override { return values_grouper_->Reset(); }
+
+  Result<Datum> Consume(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    return ConsumeOrLookup(batch, offset, length, /*insert=*/true);
+  }
+
+  Result<Datum> Lookup(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    return ConsumeOrLookup(batch, offset, length, /*insert=*/false);
+  }
+
+  uint32_t num_groups() const override { return values_grouper_->num_groups(); }
+
+  Result<ExecBatch> GetUniques() override {
+    ARROW_ASSIGN_OR_RAISE(auto uniques, values_grouper_->GetUniques());
+    for (size_t i = 0; i < key_types_.size(); ++i) {
+      if (key_types_[i].id() == Type::RUN_END_ENCODED) {
+        const auto& ree_type = checked_cast<const RunEndEncodedType&>(*key_types_[i]);
+        ARROW_ASSIGN_OR_RAISE(
+            uniques.values[i],
+            RunEndEncode(uniques.values[i], RunEndEncodeOptions(ree_type.run_end_type()),
+                         ctx_));
+      }
+    }
+    return uniques;
+  }
+
+ private:
+  Result<Datum> ConsumeOrLookup(const ExecSpan& batch, int64_t offset, int64_t length,
+                                bool insert) {
+    ARROW_RETURN_NOT_OK(CheckAndCapLengthForConsume(batch.length, offset, &length));
+
+    std::vector<ArraySpan> spans(batch.num_values());
+    std::vector<const ArraySpan*> ree_arrays;
+    bool has_other_arrays = false;
+    for (int i = 0; i < batch.num_values(); ++i) {
+      if (!batch[i].is_array()) {
+        continue;
+      }
+      spans[i] = batch[i].array;
+      spans[i].SetSlice(spans[i].offset + offset, length);
+      if (spans[i].type->id() == Type::RUN_END_ENCODED) {
+        ree_arrays.push_back(&spans[i]);
+      } else {
+        has_other_arrays = true;
+      }
+    }
+
+    ExecBatch values_batch(std::vector<Datum>(batch.num_values()), length);
+    for (int i = 0; i < batch.num_values(); ++i) {
+      if (batch[i].is_scalar()) {
+        const Scalar& scalar = *batch[i].scalar;
+        values_batch.values[i] =
+            scalar.type->id() == Type::RUN_END_ENCODED
+                ? checked_cast<const RunEndEncodedScalar&>(scalar).value
+                : scalar.GetSharedPtr();
+      } else if (spans[i].type->id() != Type::RUN_END_ENCODED) {
+        values_batch.values[i] = spans[i].ToArrayData();
+      } else if (has_other_arrays) {
+        ARROW_ASSIGN_OR_RAISE(values_batch.values[i],
+                              RunEndDecode(spans[i].ToArrayData(), ctx_));
+      }
+    }
+    if (has_other_arrays || ree_arrays.empty()) {
+      return insert ? values_grouper_->Consume(ExecSpan(values_batch))
+                    : values_grouper_->Lookup(ExecSpan(values_batch));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto common_runs, internal::ree_util::FindCommonRuns(
+                                                ree_arrays, ctx_->memory_pool()));
+    values_batch.length = common_runs.run_ends->length;
+    for (int i = 0, j = 0; i < batch.num_values(); ++i) {
+      if (batch[i].is_array()) {
+        ARROW_ASSIGN_OR_RAISE(
+            values_batch.values[i],
+            Take(spans[i].child_data[1].ToArrayData(), common_runs.physical_indices[j++],
+                 TakeOptions::NoBoundsCheck(), ctx_));
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum run_group_ids,
+                          insert ? values_grouper_->Consume(ExecSpan(values_batch))
+                                 : values_grouper_->Lookup(ExecSpan(values_batch)));
+
+    auto ree_group_ids = ArrayData::Make(
+        run_end_encoded(common_runs.run_ends->type, run_group_ids.type()), length,
+        {nullptr}, {std::move(common_runs.run_ends), run_group_ids.array()},
+        /*null_count=*/0);
+    return RunEndDecode(std::move(ree_group_ids), ctx_);
+  }
+
+  ExecContext* ctx_;
+  std::vector<TypeHolder> key_types_;
+  std::unique_ptr<Grouper> values_grouper_;
+};
+
+// Puts all rows in a single group, for grouping on no keys
+struct NoKeysGrouper : public Grouper {
+  static Result<std::unique_ptr<NoKeysGrouper>> Make(ExecContext* ctx) {
+    auto impl = std::make_unique<NoKeysGrouper>();
+    impl->ctx_ = ctx;
+    return impl;
+  }
+
+  Status Reset() override {
+    num_groups_ = 0;
+    return Status::OK();
+  }
+
+  Result<Datum> Consume(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    ARROW_RETURN_NOT_OK(CheckAndCapLengthForConsume(batch.length, offset, &length));
+    if (length > 0) {
+      num_groups_ = 1;
+    }
+    return GroupIds(length);
+  }
+
+  Result<Datum> Lookup(const ExecSpan& batch, int64_t offset, int64_t length) override {
+    ARROW_RETURN_NOT_OK(CheckAndCapLengthForConsume(batch.length, offset, &length));
+    if (num_groups_ == 0) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto nulls, MakeArrayOfNull(g_group_id_type, length, ctx_->memory_pool()));
+      return Datum(std::move(nulls));
+    }
+    return GroupIds(length);
+  }
+
+  uint32_t num_groups() const override { return num_groups_; }
+
+  Result<ExecBatch> GetUniques() override { return ExecBatch({}, num_groups_); }
+
+ private:
+  // The ids of a run of rows, all 0, as a slice of a buffer of zeros that is only
+  // reallocated when a longer run comes
+  Result<Datum> GroupIds(int64_t length) {
+    const int64_t size = length * static_cast<int64_t>(sizeof(group_id_t));
+    if (zeros_ == NULLPTR || zeros_->size() < size) {
+      ARROW_ASSIGN_OR_RAISE(auto zeros, AllocateBuffer(size, ctx_->memory_pool()));
+      std::memset(zeros->mutable_data(), 0, static_cast<size_t>(size));
+      zeros_ = std::move(zeros);
+    }
+    return Datum(UInt32Array(length, SliceBuffer(zeros_, 0, size)));
+  }
+
+  ExecContext* ctx_;
+  uint32_t num_groups_ = 0;
+  std::shared_ptr<Buffer> zeros_;
+};
+
 }  // namespace
 
+Result<Datum> Grouper::Lookup(const ExecSpan& batch, int64_t offset, int64_t length) {
+  return Status::NotImplemented("Lookup is not supported by this Grouper");
+}
+
 Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<TypeHolder>& key_types,
                                                ExecContext* ctx) {
+  if (key_types.empty()) {
+    return NoKeysGrouper::Make(ctx);
+  }
+  for (const auto& key_type : key_types) {
+    if (key_type.id() == Type::RUN_END_ENCODED) {
+      return RunEndEncodedGrouper::Make(key_types, ctx);
+    }
+  }
+  if (SmallDomainGrouper::CanUse(key_types)) {
+    return SmallDomainGrouper::Make(key_types, ctx);
+  }
   if (GrouperFastImpl::CanUse(key_types)) {
     return GrouperFastImpl::Make(key_types, ctx);
   }
@@ -125,6 +125,13 @@ class ARROW_EXPORT Grouper {
   virtual Result<Datum> Consume(const ExecSpan& batch, int64_t offset = 0,
                                 int64_t length = -1) = 0;
 
+  /// Look up a batch of keys without inserting them, producing the corresponding group
+  /// ids as a uint32 array over a slice defined by an offset and length, which defaults
+  /// to the batch length.  Keys which have not been consumed before are null in the
+  /// output.  The default implementation returns NotImplemented.
+  virtual Result<Datum> Lookup(const ExecSpan& batch, int64_t offset = 0,
+                               int64_t length = -1);
+
   /// Get current unique keys. May be called multiple times.
   virtual Result<ExecBatch> GetUniques() = 0;
 
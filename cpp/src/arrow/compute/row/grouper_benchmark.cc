@@ -110,7 +110,9 @@ void SetArgs(benchmark::internal::Benchmark* bench) {
 //
 // It mainly covers:
 // 1. Basics types, including the impact of null ratio on performance (comparison
-//    operations will compare null values separately.)
+//    operations will compare null values separately.) Strings and wide fixed size
+//    binary keys are compared with the AVX-512, AVX2 or NEON versions depending on the
+//    CPU, so run them on both x86 and ARM machines.
 //
 // 2. Combination types which will break the CPU-pipeline in column comparision.
 //    Examples: https://github.com/apache/arrow/pull/41036#issuecomment-2048721547
@@ -128,6 +130,10 @@ BENCHMARK_CAPTURE(GrouperWithMultiTypes, "{utf8}", {utf8()})->Apply(SetArgs);
 BENCHMARK_CAPTURE(GrouperWithMultiTypes, "{fixed_size_binary(32)}",
                   {fixed_size_binary(32)})
     ->Apply(SetArgs);
+// wide enough for the comparison to loop over vector registers
+BENCHMARK_CAPTURE(GrouperWithMultiTypes, "{fixed_size_binary(128)}",
+                  {fixed_size_binary(128)})
+    ->Apply(SetArgs);
 
 // combination types
 BENCHMARK_CAPTURE(GrouperWithMultiTypes, "{boolean, utf8}", {boolean(), utf8()})
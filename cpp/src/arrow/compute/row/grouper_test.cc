@@ -356,6 +356,30 @@ TEST(RowSegmenter, MultipleSegmentsMultipleBatches) {
   }
 }
 
+TEST(RowSegmenter, NullableKeysMultipleBatches) {
+  std::vector<TypeHolder> types = {int32(), utf8(), boolean()};
+  std::vector<ExecBatch> batches = {
+      ExecBatchFromJSON(types, R"([[1, "a", true], [1, "a", true], [1, null, true]])"),
+      ExecBatchFromJSON(types, R"([[1, null, true], [null, null, null],
+                                   [null, null, null], [null, "a", false]])"),
+      ExecBatchFromJSON(types, R"([[null, "a", false], [2, "bb", false],
+                                   [2, "b", false], [2, "b", true]])"),
+      ExecBatchFromJSON(types, R"([[3, "b", true]])")};
+
+  ASSERT_OK_AND_ASSIGN(auto segmenter, RowSegmenter::Make(types, /*nullable_keys=*/true,
+                                                          default_exec_context()));
+  TestSegments(segmenter, ExecSpan(batches[0]),
+               {{0, 2, false, true}, {2, 1, true, false}});
+  TestSegments(segmenter, ExecSpan(batches[1]),
+               {{0, 1, false, true}, {1, 2, false, false}, {3, 1, true, false}});
+  TestSegments(segmenter, ExecSpan(batches[2]),
+               {{0, 1, false, true},
+                {1, 1, false, false},
+                {2, 1, false, false},
+                {3, 1, true, false}});
+  TestSegments(segmenter, ExecSpan(batches[3]), {{0, 1, true, false}});
+}
+
 void TestRowSegmenterConstantBatch(
     const std::shared_ptr<DataType>& type,
     std::function<ArgShape(int64_t key)> shape_func,
@@ -616,6 +640,13 @@ struct TestGrouper {
     AssertEquivalentIds(expected, ids);
   }
 
+  void ExpectLookup(const std::string& key_json, const std::string& expected) {
+    ExecBatch key_batch = ExecBatchFromJSON(types_, key_json);
+    ASSERT_OK_AND_ASSIGN(Datum ids, grouper_->Lookup(ExecSpan(key_batch)));
+    ValidateOutput(ids);
+    AssertDatumsEqual(ArrayFromJSON(uint32(), expected), ids, /*verbose=*/true);
+  }
+
   void ExpectUniques(const ExecBatch& uniques) {
     EXPECT_THAT(grouper_->GetUniques(), ResultWith(Eq(uniques)));
   }
@@ -731,6 +762,82 @@ TEST(Grouper, BooleanKey) {
                   "[0, 1, 0, 1, 2, 1, 2]");
 }
 
+TEST(Grouper, Lookup) {
+  // Covers both the swiss table based grouper and the fallback one used for
+  // large binary keys
+  for (auto ty : {int32(), utf8(), large_utf8()}) {
+    SCOPED_TRACE("key type: " + ty->ToString());
+    bool is_int = ty->id() == Type::INT32;
+
+    TestGrouper g({ty});
+    g.ExpectLookup(is_int ? "[[3], [null]]" : R"([["c"], [null]])", "[null, null]");
+    ASSERT_EQ(g.grouper_->num_groups(), 0);
+
+    g.ExpectConsume(is_int ? "[[3], [27], [null]]" : R"([["c"], ["bb"], [null]])",
+                    "[0, 1, 2]");
+    g.ExpectLookup(is_int ? "[[27], [5], [3], [null], [27]]"
+                          : R"([["bb"], ["e"], ["c"], [null], ["bb"]])",
+                   "[1, null, 0, 2, 1]");
+    // Looking up keys must not insert them
+    ASSERT_EQ(g.grouper_->num_groups(), 3);
+    g.ExpectConsume(is_int ? "[[5], [3]]" : R"([["e"], ["c"]])", "[3, 0]");
+    g.ExpectLookup(is_int ? "[[5]]" : R"([["e"]])", "[3]");
+  }
+}
+
+TEST(Grouper, RunEndEncodedKeys) {
+  auto int_keys = ArrayFromJSON(int32(), "[1, 1, 1, 2, 2, null, null, 1, 1, 3, 3, 3]");
+  auto str_keys = ArrayFromJSON(utf8(), R"(["a", "a", "b", "b", "b", "b", null, null,
+                                           "a", "a", "a", "a"])");
+  ASSERT_OK_AND_ASSIGN(Datum ree_int_keys, RunEndEncode(int_keys));
+  ASSERT_OK_AND_ASSIGN(Datum ree_str_keys,
+                       RunEndEncode(str_keys, RunEndEncodeOptions(int16())));
+
+  // Each combination of run-end encoded and plain keys groups as the decoded keys
+  const std::vector<std::vector<Datum>> cases = {
+      {ree_int_keys},
+      {ree_int_keys, ree_str_keys},
+      {ree_int_keys, str_keys},
+      {ree_str_keys, ScalarFromJSON(int32(), "5")},
+  };
+  for (const auto& keys : cases) {
+    std::vector<TypeHolder> types, decoded_types;
+    std::vector<Datum> decoded_keys;
+    for (const auto& key : keys) {
+      types.push_back(key.type());
+      if (key.type()->id() == Type::RUN_END_ENCODED) {
+        ASSERT_OK_AND_ASSIGN(decoded_keys.emplace_back(), RunEndDecode(key));
+      } else {
+        decoded_keys.push_back(key);
+      }
+      decoded_types.push_back(decoded_keys.back().type());
+    }
+    ARROW_SCOPED_TRACE("key types: ", TypeHolder::ToString(types));
+    ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make(types));
+    ASSERT_OK_AND_ASSIGN(auto expected_grouper, Grouper::Make(decoded_types));
+    ExecBatch batch(keys, int_keys->length());
+    ExecBatch decoded_batch(decoded_keys, int_keys->length());
+    for (const auto& [offset, length] : {std::pair<int64_t, int64_t>{0, 12}, {4, 6}}) {
+      ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(ExecSpan(batch), offset, length));
+      ASSERT_OK_AND_ASSIGN(
+          Datum expected_ids,
+          expected_grouper->Consume(ExecSpan(decoded_batch), offset, length));
+      AssertDatumsEqual(expected_ids, ids, /*verbose=*/true);
+    }
+    ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+    ASSERT_OK_AND_ASSIGN(ExecBatch expected_uniques, expected_grouper->GetUniques());
+    ASSERT_EQ(uniques.num_values(), keys.size());
+    for (int i = 0; i < uniques.num_values(); ++i) {
+      ASSERT_TRUE(uniques[i].type()->Equals(keys[i].type()));
+      Datum unique = uniques[i];
+      if (unique.type()->id() == Type::RUN_END_ENCODED) {
+        ASSERT_OK_AND_ASSIGN(unique, RunEndDecode(unique));
+      }
+      AssertDatumsEqual(expected_uniques[i], unique, /*verbose=*/true);
+    }
+  }
+}
+
 TEST(Grouper, NumericKey) {
   for (auto ty : {
            uint8(),
@@ -779,7 +886,7 @@ TEST(Grouper, FloatingPointKey) {
 }
 
 TEST(Grouper, StringKey) {
-  for (auto ty : {utf8(), large_utf8(), fixed_size_binary(2)}) {
+  for (auto ty : {utf8(), large_utf8(), utf8_view(), fixed_size_binary(2)}) {
     SCOPED_TRACE("key type: " + ty->ToString());
 
     TestGrouper g({ty});
@@ -909,6 +1016,51 @@ TEST(Grouper, RandomInt64Keys) {
   }
 }
 
+TEST(Grouper, RandomSmallDomainKeys) {
+  // Keys packed in a direct-indexed table, with and without nulls
+  for (const auto& types : std::vector<std::vector<TypeHolder>>{
+           {int8()}, {uint16()}, {boolean(), int8()}, {uint8(), boolean(), boolean()}}) {
+    ARROW_SCOPED_TRACE("key types: ", TypeHolder::ToString(types));
+    TestGrouper g(types);
+    for (int i = 0; i < 4; ++i) {
+      SCOPED_TRACE(ToChars(i) + "th key batch");
+      ExecBatch key_batch{
+          *random::GenerateBatch(g.key_schema_->fields(), 1 << 12, 0xDEADBEEF + i)};
+      g.ConsumeAndValidate(key_batch);
+    }
+  }
+}
+
+TEST(Grouper, SmallDomainDictAndScalarKeys) {
+  const auto dict = ArrayFromJSON(utf8(), R"(["ex", "why", "zee"])");
+  auto indices = ArrayFromJSON(int8(), "[2, 0, null, 2, 1, 0]");
+  ASSERT_OK_AND_ASSIGN(auto dict_arr, DictionaryArray::FromArrays(indices, dict));
+
+  TestGrouper g({dictionary(int8(), utf8()), int16()});
+  g.ExpectConsume({dict_arr, ArrayFromJSON(int16(), "[-32768, 7, 7, -32768, 7, 8]")},
+                  ArrayFromJSON(uint32(), "[0, 1, 2, 0, 3, 4]"));
+  g.ExpectConsume({dict_arr->Slice(1, 3), *MakeScalar(int16(), 7)},
+                  ArrayFromJSON(uint32(), "[1, 2, 5]"));
+  ASSERT_EQ(g.grouper_->num_groups(), 6);
+
+  ASSERT_OK_AND_ASSIGN(
+      auto lookup_batch,
+      ExecBatch::Make({dict_arr, ArrayFromJSON(int16(), "[-32768, 7, 8, 1, 7, 8]")}));
+  ASSERT_OK_AND_ASSIGN(Datum ids, g.grouper_->Lookup(ExecSpan(lookup_batch)));
+  AssertDatumsEqual(ArrayFromJSON(uint32(), "[0, 1, null, null, 3, 4]"), ids,
+                    /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(auto other_dict_arr,
+                       DictionaryArray::FromArrays(ArrayFromJSON(int8(), "[0]"),
+                                                   ArrayFromJSON(utf8(), R"(["a"])")));
+  ASSERT_OK_AND_ASSIGN(
+      auto other_batch,
+      ExecBatch::Make({other_dict_arr, ArrayFromJSON(int16(), "[1]")}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented,
+                                  HasSubstr("Unifying differing dictionaries"),
+                                  g.grouper_->Consume(ExecSpan(other_batch)));
+}
+
 TEST(Grouper, RandomStringInt64Keys) {
   TestGrouper g({utf8(), int64()});
   for (int i = 0; i < 4; ++i) {
@@ -920,6 +1072,17 @@ TEST(Grouper, RandomStringInt64Keys) {
   }
 }
 
+TEST(Grouper, RandomStringViewInt64Keys) {
+  TestGrouper g({utf8_view(), int64()});
+  for (int i = 0; i < 4; ++i) {
+    SCOPED_TRACE(ToChars(i) + "th key batch");
+
+    ExecBatch key_batch{
+        *random::GenerateBatch(g.key_schema_->fields(), 1 << 12, 0xDEADBEEF)};
+    g.ConsumeAndValidate(key_batch);
+  }
+}
+
 TEST(Grouper, RandomStringInt64DoubleInt32Keys) {
   TestGrouper g({utf8(), int64(), float64(), int32()});
   for (int i = 0; i < 4; ++i) {
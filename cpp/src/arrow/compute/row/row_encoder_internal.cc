@@ -301,6 +301,12 @@ void RowEncoder::Init(const std::vector<TypeHolder>& column_types, ExecContext*
       continue;
     }
 
+    if (is_binary_view_like(type.id())) {
+      encoders_[i] =
+          std::make_shared<VarLengthKeyEncoder<BinaryViewType>>(type.GetSharedPtr());
+      continue;
+    }
+
     // We should not get here
     ARROW_DCHECK(false);
   }
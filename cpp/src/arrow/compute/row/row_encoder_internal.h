@@ -20,6 +20,7 @@
 #include <cstdint>
 
 #include "arrow/compute/kernels/codegen_internal.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/visit_data_inline.h"
 
 namespace arrow {
@@ -136,9 +137,21 @@ struct ARROW_EXPORT DictionaryKeyEncoder : FixedWidthKeyEncoder {
   std::shared_ptr<Array> dictionary_;
 };
 
+template <typename T, typename Enable = void>
+struct VarLengthKeyOffset {
+  using type = typename T::offset_type;
+};
+
+// Binary views are encoded with 32-bit lengths and decoded to views of a single
+// data buffer
+template <typename T>
+struct VarLengthKeyOffset<T, enable_if_binary_view_like<T>> {
+  using type = int32_t;
+};
+
 template <typename T>
 struct VarLengthKeyEncoder : KeyEncoder {
-  using Offset = typename T::offset_type;
+  using Offset = typename VarLengthKeyOffset<T>::type;
 
   void AddLength(const ExecValue& data, int64_t batch_length, int32_t* lengths) override {
     if (data.is_array()) {
@@ -220,6 +233,11 @@ struct VarLengthKeyEncoder : KeyEncoder {
       length_sum += util::SafeLoadAs<Offset>(encoded_bytes[i]);
     }
 
+    if constexpr (is_binary_view_like_type<T>::value) {
+      return DecodeViews(encoded_bytes, length, length_sum, std::move(null_buf),
+                         null_count, pool);
+    }
+
     ARROW_ASSIGN_OR_RAISE(auto offset_buf,
                           AllocateBuffer(sizeof(Offset) * (1 + length), pool));
     ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(length_sum));
@@ -246,6 +264,37 @@ struct VarLengthKeyEncoder : KeyEncoder {
         null_count);
   }
 
+  Result<std::shared_ptr<ArrayData>> DecodeViews(uint8_t** encoded_bytes, int32_t length,
+                                                 Offset length_sum,
+                                                 std::shared_ptr<Buffer> null_buf,
+                                                 int32_t null_count, MemoryPool* pool) {
+    ARROW_ASSIGN_OR_RAISE(auto view_buf,
+                          AllocateBuffer(BinaryViewType::kSize * length, pool));
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(length_sum, pool));
+
+    auto raw_views = view_buf->mutable_data_as<BinaryViewType::c_type>();
+    auto raw_keys = key_buf->mutable_data();
+
+    Offset current_offset = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      auto key_length = util::SafeLoadAs<Offset>(encoded_bytes[i]);
+      encoded_bytes[i] += sizeof(Offset);
+
+      // Keys are appended to the data buffer even when they fit inline, which
+      // wastes a few bytes but avoids a second pass
+      memcpy(raw_keys + current_offset, encoded_bytes[i], key_length);
+      raw_views[i] = util::ToBinaryView(raw_keys + current_offset, key_length,
+                                        /*buffer_index=*/0, current_offset);
+      encoded_bytes[i] += key_length;
+
+      current_offset += key_length;
+    }
+
+    return ArrayData::Make(
+        type_, length, {std::move(null_buf), std::move(view_buf), std::move(key_buf)},
+        null_count);
+  }
+
   explicit VarLengthKeyEncoder(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
 
   std::shared_ptr<DataType> type_;
@@ -18,14 +18,20 @@
 #include "arrow/csv/chunker.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "arrow/csv/lexing_internal.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace csv {
@@ -47,12 +53,19 @@ class Lexer {
   };
 
   explicit Lexer(const ParseOptions& options)
-      : options_(options), bulk_filter_(options_) {
+      : options_(options), bulk_filter_(options_), scanner_(options_) {
     DCHECK_EQ(SpecializedOptions::quoting, options_.quoting);
     DCHECK_EQ(SpecializedOptions::escaping, options_.escaping);
   }
 
-  void Reset() { state_ = FIELD_START; }
+  // Must be called before reading another buffer
+  void Reset(State state = FIELD_START) {
+    state_ = state;
+    scanner_.Reset();
+  }
+
+  // The state at the end of the last truncated line
+  State state() const { return state_; }
 
   // Decide whether it's worth using a bulk filter over the given data area
   bool ShouldUseBulkFilter(const char* data, const char* data_end) {
@@ -236,37 +249,71 @@ class Lexer {
   using BulkFilterType = internal::PreferredBulkFilterType<SpecializedOptions>;
   using BulkWordType = typename BulkFilterType::WordType;
 
+  // Skip to the next special character, return null if none
   const char* RunBulkFilter(const char* data, const char* data_end) {
-    while (true) {
-      if (ARROW_PREDICT_FALSE(static_cast<size_t>(data_end - data) <
-                              sizeof(BulkWordType))) {
-        if (ARROW_PREDICT_FALSE(data == data_end)) {
-          return nullptr;
-        }
-        return data;
-      }
-      BulkWordType word;
-      memcpy(&word, data, sizeof(BulkWordType));
-      if (bulk_filter_.Matches(word)) {
-        return data;
-      }
-      // No special chars
-      data += sizeof(BulkWordType);
-    }
+    const char* special = scanner_.Next(data, data_end);
+    return ARROW_PREDICT_FALSE(special == data_end) ? nullptr : special;
   }
 
   const ParseOptions& options_;
+  // Only used to decide whether to use the scanner
   const BulkFilterType bulk_filter_;
+  internal::StructuralScanner<SpecializedOptions> scanner_;
   State state_ = FIELD_START;
 };
 
+// Run `func` over [0, num_tasks) on the calling thread and on helper tasks spawned
+// on `executor`.  Since the calling thread only waits for the tasks that helpers
+// have already started, this is safe to call from a thread of `executor`.
+void RunSharedTasks(::arrow::internal::Executor* executor, int64_t num_tasks,
+                    std::function<void(int64_t)> func) {
+  struct SharedState {
+    std::function<void(int64_t)> func;
+    int64_t num_tasks;
+    std::atomic<int64_t> next_task{0};
+    std::atomic<int64_t> remaining_tasks;
+    Future<> finished = Future<>::Make();
+
+    void Work() {
+      for (int64_t task = next_task++; task < num_tasks; task = next_task++) {
+        func(task);
+        if (--remaining_tasks == 0) {
+          finished.MarkFinished();
+        }
+      }
+    }
+  };
+  auto state = std::make_shared<SharedState>();
+  state->func = std::move(func);
+  state->num_tasks = num_tasks;
+  state->remaining_tasks = num_tasks;
+
+  const int64_t num_helpers = std::min<int64_t>(executor->GetCapacity(), num_tasks) - 1;
+  for (int64_t i = 0; i < num_helpers; ++i) {
+    if (!executor->Spawn([state] { state->Work(); }).ok()) {
+      break;
+    }
+  }
+  state->Work();
+  state->finished.Wait();
+}
+
 // A BoundaryFinder implementation that assumes CSV cells can contain raw newlines,
 // and uses actual CSV lexing to delimit them.
+//
+// If given an executor, FindLast() splits large blocks into segments starting after
+// a newline character, and lexes them in parallel under each lexer state possible
+// at such a position.  The segment results are then chained serially from the
+// state known at the start of the block, only picking the matching hypotheses.
 template <typename SpecializedOptions>
 class LexingBoundaryFinder : public BoundaryFinder {
  public:
-  explicit LexingBoundaryFinder(ParseOptions options)
-      : options_(std::move(options)), lexer_(options_) {}
+  using LexerType = Lexer<SpecializedOptions>;
+  using State = typename LexerType::State;
+
+  explicit LexingBoundaryFinder(ParseOptions options,
+                                ::arrow::internal::Executor* executor = NULLPTR)
+      : options_(std::move(options)), lexer_(options_), executor_(executor) {}
 
   Status FindFirst(std::string_view partial, std::string_view block,
                    int64_t* out_pos) override {
@@ -298,6 +345,14 @@ class LexingBoundaryFinder : public BoundaryFinder {
   }
 
   Status FindLast(std::string_view block, int64_t* out_pos) override {
+    if (executor_ != nullptr && executor_->GetCapacity() > 1 &&
+        static_cast<int64_t>(block.size()) >= 2 * kMinSegmentSize) {
+      return FindLastSpeculative(block, out_pos);
+    }
+    return FindLastSerial(block, out_pos);
+  }
+
+  Status FindLastSerial(std::string_view block, int64_t* out_pos) {
     lexer_.Reset();
     if (lexer_.ShouldUseBulkFilter(block.data(), block.data() + block.size())) {
       return FindLastInternal<true>(block, out_pos);
@@ -365,13 +420,131 @@ class LexingBoundaryFinder : public BoundaryFinder {
   }
 
  protected:
+  static constexpr int64_t kMinSegmentSize = 64 * 1024;
+
+  struct SegmentResult {
+    // The offset past the last complete line in the segment, -1 if none
+    int64_t last_line_end;
+    State end_state;
+  };
+
+  SegmentResult LexSegment(State start_state, const char* data,
+                           const char* data_end) const {
+    LexerType lexer(options_);
+    lexer.Reset(start_state);
+    const char* const segment_start = data;
+    const char* line_end = nullptr;
+    if (lexer.ShouldUseBulkFilter(data, data_end)) {
+      while (data < data_end &&
+             (line_end = lexer.template ReadLine<true>(data, data_end)) != nullptr) {
+        data = line_end;
+      }
+    } else {
+      while (data < data_end &&
+             (line_end = lexer.template ReadLine<false>(data, data_end)) != nullptr) {
+        data = line_end;
+      }
+    }
+    const bool found = (data != segment_start);
+    return {found ? static_cast<int64_t>(data - segment_start) : -1,
+            data == data_end ? LexerType::FIELD_START : lexer.state()};
+  }
+
+  Status FindLastSpeculative(std::string_view block, int64_t* out_pos) {
+    const char* const block_start = block.data();
+    const char* const block_end = block.data() + block.size();
+
+    // The lexer states possible right after a newline character: outside of a
+    // field, or inside a field if the newline was quoted or escaped.
+    std::vector<State> hypotheses = {LexerType::FIELD_START};
+    if (SpecializedOptions::quoting) {
+      hypotheses.push_back(LexerType::IN_QUOTED_FIELD);
+      if (SpecializedOptions::escaping) {
+        hypotheses.push_back(LexerType::IN_FIELD);
+      }
+    }
+    const auto num_hypotheses = static_cast<int64_t>(hypotheses.size());
+
+    // Guess segment boundaries after the first newline following evenly spaced points
+    const int64_t max_segments =
+        std::min<int64_t>(executor_->GetCapacity(),
+                          static_cast<int64_t>(block.size()) / kMinSegmentSize);
+    std::vector<const char*> segment_starts = {block_start};
+    for (int64_t i = 1; i < max_segments; ++i) {
+      const char* guess = block_start + static_cast<int64_t>(block.size()) * i /
+                                            max_segments;
+      guess = std::max(guess, segment_starts.back());
+      const void* newline = memchr(guess, '\n', block_end - guess);
+      if (newline == nullptr) {
+        break;
+      }
+      const char* segment_start = static_cast<const char*>(newline) + 1;
+      if (segment_start == block_end) {
+        break;
+      }
+      segment_starts.push_back(segment_start);
+    }
+    const auto num_segments = static_cast<int64_t>(segment_starts.size());
+    segment_starts.push_back(block_end);
+    if (num_segments == 1) {
+      return FindLastSerial(block, out_pos);
+    }
+
+    // The first segment starts outside of a field, the others are lexed under
+    // every hypothesis
+    std::vector<SegmentResult> results(1 + (num_segments - 1) * num_hypotheses);
+    RunSharedTasks(executor_, static_cast<int64_t>(results.size()), [&](int64_t task) {
+      const int64_t segment = (task == 0) ? 0 : 1 + (task - 1) / num_hypotheses;
+      const State state =
+          (task == 0) ? LexerType::FIELD_START : hypotheses[(task - 1) % num_hypotheses];
+      results[task] =
+          LexSegment(state, segment_starts[segment], segment_starts[segment + 1]);
+    });
+
+    // Chain the segments, re-lexing any whose actual start state wasn't guessed
+    State state = LexerType::FIELD_START;
+    int64_t last_line_end = -1;
+    for (int64_t segment = 0; segment < num_segments; ++segment) {
+      if (!SpecializedOptions::quoting && state == LexerType::IN_FIELD) {
+        // Without quoting, starting in a field is the same as starting a field
+        state = LexerType::FIELD_START;
+      }
+      SegmentResult result;
+      if (segment == 0) {
+        result = results[0];
+      } else {
+        const auto it = std::find(hypotheses.begin(), hypotheses.end(), state);
+        if (it != hypotheses.end()) {
+          const int64_t hypothesis = it - hypotheses.begin();
+          result = results[1 + (segment - 1) * num_hypotheses + hypothesis];
+        } else {
+          result =
+              LexSegment(state, segment_starts[segment], segment_starts[segment + 1]);
+        }
+      }
+      if (result.last_line_end >= 0) {
+        last_line_end = (segment_starts[segment] - block_start) + result.last_line_end;
+      }
+      state = result.end_state;
+    }
+    *out_pos = last_line_end;
+    DCHECK_NE(*out_pos, 0);
+    return Status::OK();
+  }
+
   ParseOptions options_;
   Lexer<SpecializedOptions> lexer_;
+  ::arrow::internal::Executor* executor_;
 };
 
 }  // namespace
 
 std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options) {
+  return MakeChunker(options, NULLPTR);
+}
+
+std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options,
+                                     ::arrow::internal::Executor* executor) {
   std::shared_ptr<BoundaryFinder> delimiter;
   if (!options.newlines_in_values) {
     delimiter = MakeNewlineBoundaryFinder();
@@ -379,18 +552,22 @@ std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options) {
     if (options.quoting) {
       if (options.escaping) {
         delimiter = std::make_shared<
-            LexingBoundaryFinder<internal::SpecializedOptions<true, true>>>(options);
+            LexingBoundaryFinder<internal::SpecializedOptions<true, true>>>(options,
+                                                                         executor);
       } else {
         delimiter = std::make_shared<
-            LexingBoundaryFinder<internal::SpecializedOptions<true, false>>>(options);
+            LexingBoundaryFinder<internal::SpecializedOptions<true, false>>>(options,
+                                                                          executor);
       }
     } else {
       if (options.escaping) {
         delimiter = std::make_shared<
-            LexingBoundaryFinder<internal::SpecializedOptions<false, true>>>(options);
+            LexingBoundaryFinder<internal::SpecializedOptions<false, true>>>(options,
+                                                                          executor);
       } else {
         delimiter = std::make_shared<
-            LexingBoundaryFinder<internal::SpecializedOptions<false, false>>>(options);
+            LexingBoundaryFinder<internal::SpecializedOptions<false, false>>>(options,
+                                                                           executor);
       }
     }
   }
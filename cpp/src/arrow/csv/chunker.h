@@ -24,6 +24,7 @@
 #include "arrow/status.h"
 #include "arrow/util/delimiting.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -32,5 +33,13 @@ namespace csv {
 ARROW_EXPORT
 std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options);
 
+/// \brief Create a Chunker which may use `executor` to find block boundaries
+///
+/// With `newlines_in_values`, the boundaries of large blocks are searched
+/// speculatively in parallel on `executor`.
+ARROW_EXPORT
+std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options,
+                                     ::arrow::internal::Executor* executor);
+
 }  // namespace csv
 }  // namespace arrow
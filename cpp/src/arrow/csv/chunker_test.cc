@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <memory>
 #include <numeric>
+#include <random>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -27,6 +28,7 @@
 #include "arrow/csv/options.h"
 #include "arrow/csv/test_common.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace csv {
@@ -379,5 +381,49 @@ TEST_P(BaseChunkerTest, ParseSkip) {
   }
 }
 
+TEST(SpeculativeChunker, MatchesSerialChunker) {
+  // Large blocks of quoted and escaped values containing newlines, so that
+  // segment boundaries fall both inside and outside of fields
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> char_dist(0, 9);
+  const char alphabet[] = {'a', 'b', 'c', 'd', ',', '"', '"', '\\', '\n', '\r'};
+  std::string csv;
+  while (csv.size() < 2 * 1024 * 1024) {
+    const bool quoted = char_dist(gen) < 3;
+    if (quoted) csv += '"';
+    for (int i = char_dist(gen) * 3; i > 0; --i) {
+      const char c = alphabet[char_dist(gen)];
+      if (c == '"' && !quoted) continue;
+      csv += c;
+      if (c == '"') csv += '"';
+    }
+    if (quoted) csv += '"';
+    csv += (char_dist(gen) < 7) ? "," : "\n";
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto pool, ::arrow::internal::ThreadPool::Make(4));
+  for (const bool escaping : {false, true}) {
+    for (const bool quoting : {false, true}) {
+      ARROW_SCOPED_TRACE("quoting = ", quoting, ", escaping = ", escaping);
+      auto options = ParseOptions::Defaults();
+      options.newlines_in_values = true;
+      options.quoting = quoting;
+      options.escaping = escaping;
+      auto serial_chunker = MakeChunker(options);
+      auto speculative_chunker = MakeChunker(options, pool.get());
+
+      for (const size_t size : {csv.size(), csv.size() / 2 + 1, csv.size() / 3 + 7}) {
+        auto block = std::make_shared<Buffer>(
+            reinterpret_cast<const uint8_t*>(csv.data()), static_cast<int64_t>(size));
+        std::shared_ptr<Buffer> expected_whole, expected_partial, whole, partial;
+        ASSERT_OK(serial_chunker->Process(block, &expected_whole, &expected_partial));
+        ASSERT_OK(speculative_chunker->Process(block, &whole, &partial));
+        ASSERT_EQ(whole->size(), expected_whole->size());
+        ASSERT_EQ(partial->size(), expected_partial->size());
+      }
+    }
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
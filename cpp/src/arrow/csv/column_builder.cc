@@ -215,7 +215,8 @@ class InferringColumnBuilder : public ConcreteColumnBuilder {
                          MemoryPool* pool, const std::shared_ptr<TaskGroup>& task_group)
       : ConcreteColumnBuilder(pool, task_group, col_index),
         options_(options),
-        infer_status_(options) {}
+        infer_status_(options),
+        classifier_(options) {}
 
   Status Init();
 
@@ -229,9 +230,12 @@ class InferringColumnBuilder : public ConcreteColumnBuilder {
   }
 
   Status UpdateType();
+  Status ClassifyChunk(int64_t chunk_index);
   Status TryConvertChunk(int64_t chunk_index);
   // This must be called unlocked!
   void ScheduleConvertChunk(int64_t chunk_index);
+  // This must be called locked
+  void ScheduleReconvertChunks(int64_t chunk_index, std::unique_lock<std::mutex>* lock);
 
   // CAUTION: ConvertOptions can grow large (if it customizes hundreds or
   // thousands of columns), so avoid copying it in each InferringColumnBuilder.
@@ -239,13 +243,17 @@ class InferringColumnBuilder : public ConcreteColumnBuilder {
 
   // Current inference status
   InferStatus infer_status_;
+  InferKindClassifier classifier_;
   std::shared_ptr<Converter> converter_;
 
   // The parsers corresponding to each chunk (for reconverting)
   std::vector<std::shared_ptr<BlockParser>> parsers_;
 };
 
-Status InferringColumnBuilder::Init() { return UpdateType(); }
+Status InferringColumnBuilder::Init() {
+  RETURN_NOT_OK(classifier_.Init());
+  return UpdateType();
+}
 
 Status InferringColumnBuilder::UpdateType() {
   return infer_status_.MakeConverter(pool_).Value(&converter_);
@@ -255,6 +263,43 @@ void InferringColumnBuilder::ScheduleConvertChunk(int64_t chunk_index) {
   task_group_->Append([this, chunk_index]() { return TryConvertChunk(chunk_index); });
 }
 
+void InferringColumnBuilder::ScheduleReconvertChunks(
+    int64_t chunk_index, std::unique_lock<std::mutex>* lock) {
+  // Reconvert past finished chunks
+  // (unfinished chunks will notice by themselves if they need reconverting)
+  const auto nchunks = static_cast<int64_t>(chunks_.size());
+  for (int64_t i = 0; i < nchunks; ++i) {
+    if (i != chunk_index && chunks_[i]) {
+      // We're assuming the chunk was converted using the wrong type
+      // (which should be true unless the executor reorders tasks)
+      chunks_[i].reset();
+      lock->unlock();
+      ScheduleConvertChunk(i);
+      lock->lock();
+    }
+  }
+}
+
+Status InferringColumnBuilder::ClassifyChunk(int64_t chunk_index) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  std::shared_ptr<BlockParser> parser = parsers_[chunk_index];
+  DCHECK_NE(parser, nullptr);
+
+  lock.unlock();
+  const uint32_t candidates =
+      classifier_.Classify(*parser, col_index_, options_.inference_sample_rows);
+  lock.lock();
+
+  // Skip the types that some values are sure not to convert to, rather than finding
+  // out by converting all chunks to each of them
+  if (infer_status_.NarrowDown(candidates)) {
+    RETURN_NOT_OK(UpdateType());
+    ScheduleReconvertChunks(chunk_index, &lock);
+  }
+  lock.unlock();
+  return TryConvertChunk(chunk_index);
+}
+
 Status InferringColumnBuilder::TryConvertChunk(int64_t chunk_index) {
   std::unique_lock<std::mutex> lock(mutex_);
   std::shared_ptr<Converter> converter = converter_;
@@ -286,20 +331,7 @@ Status InferringColumnBuilder::TryConvertChunk(int64_t chunk_index) {
   // Conversion failed, try another type
   infer_status_.LoosenType(maybe_array.status());
   RETURN_NOT_OK(UpdateType());
-
-  // Reconvert past finished chunks
-  // (unfinished chunks will notice by themselves if they need reconverting)
-  const auto nchunks = static_cast<int64_t>(chunks_.size());
-  for (int64_t i = 0; i < nchunks; ++i) {
-    if (i != chunk_index && chunks_[i]) {
-      // We're assuming the chunk was converted using the wrong type
-      // (which should be true unless the executor reorders tasks)
-      chunks_[i].reset();
-      lock.unlock();
-      ScheduleConvertChunk(i);
-      lock.lock();
-    }
-  }
+  ScheduleReconvertChunks(chunk_index, &lock);
 
   // Reconvert this chunk
   lock.unlock();
@@ -325,7 +357,7 @@ void InferringColumnBuilder::Insert(int64_t block_index,
     ReserveChunksUnlocked(block_index);
   }
 
-  ScheduleConvertChunk(chunk_index);
+  task_group_->Append([this, chunk_index]() { return ClassifyChunk(chunk_index); });
 }
 
 Result<std::shared_ptr<ChunkedArray>> InferringColumnBuilder::Finish() {
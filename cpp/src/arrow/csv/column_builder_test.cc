@@ -661,6 +661,23 @@ TEST_F(InferringColumnBuilderTest, MultipleChunkIntegerParallel) {
   CheckInferred(tg, {{"1", "2"}, {"3"}, {"4", "5"}, {"6", "7"}}, options, expected);
 }
 
+TEST_F(InferringColumnBuilderTest, InferenceSampleRows) {
+  // The sample only helps skip types, it doesn't change the inferred one
+  auto options = ConvertOptions::Defaults();
+  auto tg = TaskGroup::MakeSerial();
+
+  for (int64_t sample_rows : {-1, 0, 1, 2}) {
+    ARROW_SCOPED_TRACE("inference_sample_rows = ", sample_rows);
+    options.inference_sample_rows = sample_rows;
+    CheckInferred(tg, {{"1", "N/A", "2"}, {"3", "4.5"}}, options,
+                  {ArrayFromJSON(float64(), "[1, null, 2]"),
+                   ArrayFromJSON(float64(), "[3, 4.5]")});
+    CheckInferred(tg, {{"", "99"}, {"01:23:45", "1e3"}}, options,
+                  {ArrayFromJSON(utf8(), R"(["", "99"])"),
+                   ArrayFromJSON(utf8(), R"(["01:23:45", "1e3"])")});
+  }
+}
+
 TEST_F(InferringColumnBuilderTest, SingleChunkBinaryAutoDict) {
   auto options = ConvertOptions::Defaults();
   options.auto_dict_encode = true;
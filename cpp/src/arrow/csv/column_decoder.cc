@@ -134,6 +134,7 @@ class InferringColumnDecoder : public ConcreteColumnDecoder {
       : ConcreteColumnDecoder(pool, col_index),
         options_(options),
         infer_status_(options),
+        classifier_(options),
         type_frozen_(false) {
     first_inference_run_ = Future<>::Make();
     first_inferrer_ = 0;
@@ -159,13 +160,17 @@ class InferringColumnDecoder : public ConcreteColumnDecoder {
 
   // Current inference status
   InferStatus infer_status_;
+  InferKindClassifier classifier_;
   bool type_frozen_;
   std::atomic<int> first_inferrer_;
   Future<> first_inference_run_;
   std::shared_ptr<Converter> converter_;
 };
 
-Status InferringColumnDecoder::Init() { return UpdateType(); }
+Status InferringColumnDecoder::Init() {
+  RETURN_NOT_OK(classifier_.Init());
+  return UpdateType();
+}
 
 Status InferringColumnDecoder::UpdateType() {
   return infer_status_.MakeConverter(pool_).Value(&converter_);
@@ -173,6 +178,11 @@ Status InferringColumnDecoder::UpdateType() {
 
 Result<std::shared_ptr<Array>> InferringColumnDecoder::RunInference(
     const std::shared_ptr<BlockParser>& parser) {
+  // Skip the types that some values are sure not to convert to
+  if (infer_status_.NarrowDown(
+          classifier_.Classify(*parser, col_index_, options_.inference_sample_rows))) {
+    RETURN_NOT_OK(UpdateType());
+  }
   while (true) {
     // (no one else should be updating converter_ concurrently)
     auto maybe_array = converter_->Convert(*parser, col_index_);
@@ -213,7 +223,6 @@ Future<std::shared_ptr<Array>> InferringColumnDecoder::Decode(
   // without blocking a worker thread.
   return first_inference_run_.Then([this, parser] {
     DCHECK(type_frozen_);
-    auto maybe_array = converter_->Convert(*parser, col_index_);
     return WrapConversionError(converter_->Convert(*parser, col_index_));
   });
 }
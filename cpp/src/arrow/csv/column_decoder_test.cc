@@ -311,6 +311,20 @@ class InferringColumnDecoderTest : public ColumnDecoderTest {
     AssertFetch(ArrayFromJSON(type, "[901, null]"));
   }
 
+  void TestSampleRows() {
+    // The sample only helps skip types, it doesn't change the inferred one
+    auto options = default_options;
+    for (int64_t sample_rows : {-1, 0, 1, 3}) {
+      ARROW_SCOPED_TRACE("inference_sample_rows = ", sample_rows);
+      options.inference_sample_rows = sample_rows;
+      MakeDecoder(options);
+
+      AppendChunks({{"1", "N/A", "2", "3.5"}, {"4"}});
+      AssertFetch(ArrayFromJSON(float64(), "[1, null, 2, 3.5]"));
+      AssertFetch(ArrayFromJSON(float64(), "[4]"));
+    }
+  }
+
   void TestThreaded() {
 #ifndef ARROW_ENABLE_THREADING
     GTEST_SKIP() << "Test requires threading support";
@@ -383,6 +397,8 @@ class InferringColumnDecoderTest : public ColumnDecoderTest {
 
 TEST_F(InferringColumnDecoderTest, Integers) { this->TestIntegers(); }
 
+TEST_F(InferringColumnDecoderTest, SampleRows) { this->TestSampleRows(); }
+
 TEST_F(InferringColumnDecoderTest, Threaded) { this->TestThreaded(); }
 
 TEST_F(InferringColumnDecoderTest, Options) { this->TestOptions(); }
@@ -17,7 +17,9 @@
 
 #include "arrow/csv/converter.h"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstring>
 #include <limits>
 #include <sstream>
@@ -214,14 +216,19 @@ struct NumericValueDecoder : public ValueDecoder {
 
   Status Decode(const uint8_t* data, uint32_t size, bool quoted, value_type* out) {
     // XXX should quoted values be allowed at all?
-    TrimWhiteSpace(&data, &size);
-    if (ARROW_PREDICT_FALSE(!string_converter_.Convert(
-            concrete_type_, reinterpret_cast<const char*>(data), size, out))) {
+    if (ARROW_PREDICT_FALSE(!TryDecode(data, size, out))) {
+      TrimWhiteSpace(&data, &size);
       return GenericConversionError(type_, data, size);
     }
     return Status::OK();
   }
 
+  bool TryDecode(const uint8_t* data, uint32_t size, value_type* out) {
+    TrimWhiteSpace(&data, &size);
+    return string_converter_.Convert(concrete_type_, reinterpret_cast<const char*>(data),
+                                     size, out);
+  }
+
  protected:
   const T& concrete_type_;
   arrow::internal::StringConverter<T> string_converter_;
@@ -364,6 +371,9 @@ struct InlineISO8601ValueDecoder : public ValueDecoder {
   }
 
   Status Decode(const uint8_t* data, uint32_t size, bool quoted, value_type* out) {
+    if (ARROW_PREDICT_TRUE(TryDecode(data, size, out))) {
+      return Status::OK();
+    }
     bool zone_offset_present = false;
     if (ARROW_PREDICT_FALSE(
             !internal::ParseTimestampISO8601(reinterpret_cast<const char*>(data), size,
@@ -387,6 +397,13 @@ struct InlineISO8601ValueDecoder : public ValueDecoder {
     return Status::OK();
   }
 
+  bool TryDecode(const uint8_t* data, uint32_t size, value_type* out) {
+    bool zone_offset_present = false;
+    return internal::ParseTimestampISO8601(reinterpret_cast<const char*>(data), size,
+                                           unit_, out, &zone_offset_present) &&
+           zone_offset_present == expect_timezone_;
+  }
+
  protected:
   TimeUnit::type unit_;
   bool expect_timezone_;
@@ -520,6 +537,17 @@ class NullConverter : public ConcreteConverter {
 // Concrete Converter for primitives
 //
 
+// Whether a value decoder can tell cheaply, without a Status, if a value is valid
+template <typename ValueDecoderType, typename = void>
+struct HasTryDecode : std::false_type {};
+
+template <typename ValueDecoderType>
+struct HasTryDecode<ValueDecoderType,
+                    std::void_t<decltype(std::declval<ValueDecoderType&>().TryDecode(
+                        std::declval<const uint8_t*>(), uint32_t{},
+                        std::declval<typename ValueDecoderType::value_type*>()))>>
+    : std::true_type {};
+
 template <typename T, typename ValueDecoderType>
 class PrimitiveConverter : public ConcreteConverter {
  public:
@@ -535,6 +563,31 @@ class PrimitiveConverter : public ConcreteConverter {
     BuilderType builder(type_, pool_);
     RETURN_NOT_OK(PresizeBuilder(parser, &builder));
 
+    if constexpr (HasTryDecode<ValueDecoderType>::value) {
+      // Decode values straight away, and only look up null values on failure or
+      // if the decoded value is also that of a null value (such as NaN)
+      auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+        value_type value{};
+        if (ARROW_PREDICT_TRUE(decoder_.TryDecode(data, size, &value))) {
+          if (ARROW_PREDICT_FALSE(IsNullValue(value)) &&
+              decoder_.IsNull(data, size, quoted /* quoted */)) {
+            return builder.AppendNull();
+          }
+          builder.UnsafeAppend(value);
+          return Status::OK();
+        }
+        if (decoder_.IsNull(data, size, quoted /* quoted */)) {
+          return builder.AppendNull();
+        }
+        return decoder_.Decode(data, size, quoted, &value);
+      };
+      RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
+
+      std::shared_ptr<Array> res;
+      RETURN_NOT_OK(builder.Finish(&res));
+      return res;
+    }
+
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
       if (decoder_.IsNull(data, size, quoted /* quoted */)) {
         return builder.AppendNull();
@@ -552,9 +605,37 @@ class PrimitiveConverter : public ConcreteConverter {
   }
 
  protected:
-  Status Initialize() override { return decoder_.Initialize(); }
+  Status Initialize() override {
+    RETURN_NOT_OK(decoder_.Initialize());
+    if constexpr (HasTryDecode<ValueDecoderType>::value) {
+      for (const auto& null_value : options_.null_values) {
+        typename ValueDecoderType::value_type value{};
+        if (decoder_.TryDecode(reinterpret_cast<const uint8_t*>(null_value.data()),
+                               static_cast<uint32_t>(null_value.size()), &value)) {
+          null_decoded_values_.push_back(value);
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  // Whether a decoded value is also that of a null value
+  template <typename ValueType>
+  bool IsNullValue(ValueType value) const {
+    return std::any_of(null_decoded_values_.begin(), null_decoded_values_.end(),
+                       [&](ValueType null_value) {
+                         if constexpr (std::is_floating_point_v<ValueType>) {
+                           if (std::isnan(value)) {
+                             return std::isnan(null_value);
+                           }
+                         }
+                         return value == null_value;
+                       });
+  }
 
   ValueDecoderType decoder_;
+  // The decoded values of the null values which are also valid values
+  std::vector<typename ValueDecoderType::value_type> null_decoded_values_;
 };
 
 //
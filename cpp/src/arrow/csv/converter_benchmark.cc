@@ -22,6 +22,7 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/csv/column_decoder.h"
 #include "arrow/csv/converter.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
@@ -147,12 +148,37 @@ static void TimestampConversionStrptime(
   BenchmarkConversion(state, *parser, timestamp(TimeUnit::MILLI), options);
 }
 
+// Type inference of integers with a single real at the end, with and without
+// the inference sample
+static void InferIntegersThenReal(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<std::string> rows(num_rows, "123456\n");
+  rows.back() = "1.5\n";
+  std::shared_ptr<BlockParser> parser;
+  MakeCSVParser(rows, ParseOptions::Defaults(), -1, memory_tracker.memory_pool(),
+                &parser);
+  auto options = ConvertOptions::Defaults();
+  options.inference_sample_rows = state.range(0);
+
+  for (auto _ : state) {
+    auto decoder = *ColumnDecoder::Make(memory_tracker.memory_pool(), 0, options);
+    auto decoded = *decoder->Decode(parser).result();
+    if (decoded->type_id() != Type::DOUBLE) {
+      std::cerr << "Unexpected type " << decoded->type()->ToString() << "\n";
+      std::abort();
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * parser->num_rows());
+}
+
 BENCHMARK(Int64Conversion);
 BENCHMARK(FloatConversion);
 BENCHMARK(Decimal128Conversion);
 BENCHMARK(StringConversion);
 BENCHMARK(TimestampConversionDefault);
 BENCHMARK(TimestampConversionStrptime);
+BENCHMARK(InferIntegersThenReal)->ArgName("sample_rows")->Arg(0)->Arg(-1);
 
 }  // namespace csv
 }  // namespace arrow
@@ -376,6 +376,12 @@ TEST(IntegerConversion, CustomNulls) {
   AssertConversion<Int8Type, int8_t>(int8(), {"12,xxx\n", "zzz,-128\n"},
                                      {{12, 0}, {0, -128}}, {{true, false}, {false, true}},
                                      options);
+
+  // Nulls which are also valid values
+  options.null_values = {"-1", "0"};
+  AssertConversion<Int32Type, int32_t>(int32(), {"12,-1\n", "0,00\n"},
+                                       {{12, 0}, {0, 0}}, {{true, false}, {false, true}},
+                                       options);
 }
 
 TEST(IntegerConversion, Whitespace) {
@@ -411,6 +417,12 @@ TEST(FloatingPointConversion, CustomNulls) {
   AssertConversion<FloatType, float>(float32(), {"1.5,xxx\n", "zzz,-1e10\n"},
                                      {{1.5, 0.}, {0., -1e10f}},
                                      {{true, false}, {false, true}}, options);
+
+  // Nulls which are also valid values
+  options.null_values = {"0.0"};
+  AssertConversion<DoubleType, double>(float64(), {"0.0,0\n", "-0.0,0.0\n"},
+                                       {{0., -0.}, {0., 0.}},
+                                       {{false, true}, {true, false}}, options);
 }
 
 TEST(FloatingPointConversion, Whitespace) {
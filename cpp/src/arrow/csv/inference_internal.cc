@@ -0,0 +1,186 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/inference_internal.h"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arrow/csv/parser.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace csv {
+
+using internal::Trie;
+using internal::TrieBuilder;
+
+namespace {
+
+constexpr uint32_t kAllKinds = InferKindBit(InferKind::Binary) * 2 - 1;
+
+// The kinds that the classifier can rule out; the others may hold any value
+constexpr uint32_t kClassifiedKinds = InferKindBit(InferKind::TextDict) - 1;
+
+constexpr uint32_t kTimestampKinds =
+    InferKindBit(InferKind::Timestamp) | InferKindBit(InferKind::TimestampNS) |
+    InferKindBit(InferKind::TimestampWithZone) |
+    InferKindBit(InferKind::TimestampWithZoneNS);
+
+constexpr uint32_t kInteger = InferKindBit(InferKind::Integer);
+constexpr uint32_t kDate = InferKindBit(InferKind::Date);
+constexpr uint32_t kTime = InferKindBit(InferKind::Time);
+constexpr uint32_t kReal = InferKindBit(InferKind::Real);
+constexpr uint32_t kZonedTimestamps = InferKindBit(InferKind::TimestampWithZone) |
+                                      InferKindBit(InferKind::TimestampWithZoneNS);
+constexpr uint32_t kSubsecondTimestamps = InferKindBit(InferKind::TimestampNS) |
+                                          InferKindBit(InferKind::TimestampWithZoneNS);
+
+Status InitializeTrie(const std::vector<std::string>& inputs, Trie* trie) {
+  TrieBuilder builder;
+  for (const auto& s : inputs) {
+    RETURN_NOT_OK(builder.Append(s, true /* allow_duplicates */));
+  }
+  *trie = builder.Finish();
+  return Status::OK();
+}
+
+// Same as the whitespace trimmed by the numeric converters
+inline bool IsWhitespace(uint8_t c) { return c == ' ' || c == '\t'; }
+
+}  // namespace
+
+InferKindClassifier::InferKindClassifier(const ConvertOptions& options)
+    : options_(options) {}
+
+Status InferKindClassifier::Init() {
+  RETURN_NOT_OK(InitializeTrie(options_.null_values, &null_trie_));
+  RETURN_NOT_OK(InitializeTrie(options_.true_values, &true_trie_));
+  RETURN_NOT_OK(InitializeTrie(options_.false_values, &false_trie_));
+
+  // Nulls and booleans are matched against the tries, and the bytes don't rule out
+  // the string kinds
+  const uint32_t any_byte =
+      kAllKinds & ~(kInteger | kDate | kTime | kReal | kTimestampKinds);
+  byte_kinds_.fill(any_byte);
+  auto allow = [&](uint8_t c, uint32_t kinds) { byte_kinds_[c] |= kinds; };
+
+  for (uint8_t c = '0'; c <= '9'; ++c) {
+    allow(c, kInteger | kDate | kTime | kReal | kTimestampKinds);
+  }
+  allow(' ', kInteger | kDate | kTime | kReal | kTimestampKinds);
+  allow('\t', kInteger | kDate | kTime | kReal | kTimestampKinds);
+  allow('+', kInteger | kReal | kZonedTimestamps);
+  allow('-', kInteger | kDate | kReal | kTimestampKinds);
+  allow(':', kTime | kTimestampKinds);
+  allow('.', kReal | kSubsecondTimestamps);
+  allow(static_cast<uint8_t>(options_.decimal_point), kReal);
+  allow('T', kTimestampKinds);
+  allow('Z', kZonedTimestamps);
+  // Hexadecimal integers
+  for (uint8_t c : {'x', 'X', 'a', 'b', 'c', 'd', 'e', 'f', 'A', 'B', 'C', 'D', 'E',
+                    'F'}) {
+    allow(c, kInteger);
+  }
+  // Exponents, but also "inf", "infinity" and "nan(n-char-seq)" in any case
+  for (uint8_t c = 'a'; c <= 'z'; ++c) {
+    allow(c, kReal);
+    allow(static_cast<uint8_t>(c - 'a' + 'A'), kReal);
+  }
+  allow('(', kReal);
+  allow(')', kReal);
+  allow('_', kReal);
+
+  if (!options_.timestamp_parsers.empty()) {
+    // User-supplied formats may accept anything
+    for (auto& kinds : byte_kinds_) {
+      kinds |= kTimestampKinds;
+    }
+  }
+  return Status::OK();
+}
+
+uint32_t InferKindClassifier::ClassifyValue(const uint8_t* data, uint32_t size,
+                                            bool quoted, uint32_t candidates) const {
+  uint32_t kinds = kAllKinds & ~InferKindBit(InferKind::Null);
+  bool has_digit = false;
+  for (uint32_t i = 0; i < size; ++i) {
+    kinds &= byte_kinds_[data[i]];
+    has_digit |= static_cast<uint8_t>(data[i] - '0') < 10;
+  }
+  if (!has_digit) {
+    kinds &= ~(kInteger | kDate | kTime);
+    if (options_.timestamp_parsers.empty()) {
+      kinds &= ~kTimestampKinds;
+    }
+  }
+  uint32_t trimmed_size = size;
+  for (uint32_t i = 0; i < size && IsWhitespace(data[i]); ++i) {
+    --trimmed_size;
+  }
+  for (uint32_t i = size; trimmed_size > 0 && IsWhitespace(data[i - 1]); --i) {
+    --trimmed_size;
+  }
+  if (trimmed_size != 10) {
+    kinds &= ~kDate;
+  }
+  if (trimmed_size < 5) {
+    kinds &= ~kTime;
+  }
+  if (size < 10 && options_.timestamp_parsers.empty()) {
+    kinds &= ~kTimestampKinds;
+  }
+  if ((candidates & ~kinds) == 0 &&
+      (candidates & InferKindBit(InferKind::Boolean)) == 0) {
+    // Rules out nothing new, so no need to look up whether it is a null
+    return kinds;
+  }
+
+  const std::string_view view(reinterpret_cast<const char*>(data), size);
+  if ((!quoted || options_.quoted_strings_can_be_null) && null_trie_.Find(view) >= 0) {
+    // Nulls convert to any type
+    return kAllKinds;
+  }
+  if (true_trie_.Find(view) < 0 && false_trie_.Find(view) < 0) {
+    kinds &= ~InferKindBit(InferKind::Boolean);
+  }
+  return kinds;
+}
+
+uint32_t InferKindClassifier::Classify(const BlockParser& parser, int32_t col_index,
+                                       int64_t max_rows) const {
+  uint32_t candidates = kAllKinds;
+  int64_t num_rows = 0;
+  auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+    if ((max_rows >= 0 && num_rows >= max_rows) ||
+        (candidates & kClassifiedKinds) == 0) {
+      return Status::OK();
+    }
+    ++num_rows;
+    candidates &= ClassifyValue(data, size, quoted, candidates);
+    return Status::OK();
+  };
+  if (!parser.VisitColumn(col_index, visit).ok()) {
+    // Let the conversion report the error
+    return kAllKinds;
+  }
+  return candidates;
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -17,11 +17,14 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <memory>
 
 #include "arrow/csv/converter.h"
 #include "arrow/csv/options.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/trie.h"
 
 namespace arrow {
 namespace csv {
@@ -43,6 +46,37 @@ enum class InferKind {
   Binary
 };
 
+constexpr uint32_t InferKindBit(InferKind kind) { return 1U << static_cast<int>(kind); }
+
+/// \brief Rule out inferred kinds from the raw values of a column
+///
+/// Converting a whole block only to find out that a value near its end doesn't fit
+/// is expensive, so the values are first classified in a single pass over their
+/// bytes.  A kind is only ruled out when a value is certain not to convert to it, so
+/// narrowing an InferStatus down to the result never changes the inferred type.
+class InferKindClassifier {
+ public:
+  explicit InferKindClassifier(const ConvertOptions& options);
+
+  Status Init();
+
+  /// \brief Return the mask of the kinds (see InferKindBit) that the first
+  /// `max_rows` values of the column may convert to, all values if negative
+  uint32_t Classify(const BlockParser& parser, int32_t col_index,
+                    int64_t max_rows) const;
+
+ protected:
+  uint32_t ClassifyValue(const uint8_t* data, uint32_t size, bool quoted,
+                         uint32_t candidates) const;
+
+  const ConvertOptions& options_;
+  internal::Trie null_trie_;
+  internal::Trie true_trie_;
+  internal::Trie false_trie_;
+  // The kinds that a value containing each byte may convert to
+  std::array<uint32_t, 256> byte_kinds_;
+};
+
 class InferStatus {
  public:
   explicit InferStatus(const ConvertOptions& options)
@@ -100,6 +134,18 @@ class InferStatus {
     }
   }
 
+  /// \brief Loosen the type until it is one of `candidates` (as returned by
+  /// InferKindClassifier), return whether it changed
+  bool NarrowDown(uint32_t candidates) {
+    const InferKind initial_kind = kind_;
+    while (can_loosen_type_ && (candidates & InferKindBit(kind_)) == 0) {
+      // The conversion error is only looked at for dictionary kinds, which are never
+      // ruled out
+      LoosenType(Status::OK());
+    }
+    return kind_ != initial_kind;
+  }
+
   Result<std::shared_ptr<Converter>> MakeConverter(MemoryPool* pool) {
     auto make_converter =
         [&](std::shared_ptr<DataType> type) -> Result<std::shared_ptr<Converter>> {
@@ -18,8 +18,10 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 
 #include "arrow/csv/options.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/simd.h"
 
 namespace arrow {
@@ -208,6 +210,127 @@ template <typename SpecializedOptions>
 using PreferredBulkFilterType = BloomFilter4B<SpecializedOptions>;
 #endif
 
+//
+// Structural scanner, after simdjson's stage 1: each 64-byte block of the input is
+// classified once into a bitmask of its special characters, then the lexer jumps
+// from one special character to the next by counting trailing zeros, however dense
+// they are.
+//
+
+template <typename SpecializedOptions>
+class StructuralScanner {
+ public:
+  static constexpr int64_t kBlockSize = 64;
+
+  explicit StructuralScanner(const ParseOptions& options)
+      : delimiter_(static_cast<uint8_t>(options.delimiter)),
+        quote_(static_cast<uint8_t>(SpecializedOptions::quoting ? options.quote_char
+                                                                : '\n')),
+        escape_(static_cast<uint8_t>(SpecializedOptions::escaping ? options.escape_char
+                                                                  : '\n')) {}
+
+  /// Forget the classified block, which must be done before scanning another buffer
+  void Reset() {
+    block_ = nullptr;
+    mask_ = 0;
+  }
+
+  /// Return the first special character in [data, data_end), or data_end if none
+  const char* Next(const char* data, const char* data_end) {
+    while (true) {
+      if (block_ != nullptr && data >= block_ && data - block_ < kBlockSize) {
+        const uint64_t mask = mask_ & (~uint64_t{0} << (data - block_));
+        if (mask != 0) {
+          // The block may extend past data_end if the caller shortened it since
+          const char* special = block_ + bit_util::CountTrailingZeros(mask);
+          return special < data_end ? special : data_end;
+        }
+        data = block_ + kBlockSize;
+      }
+      if (data_end - data < kBlockSize) {
+        break;
+      }
+      block_ = data;
+      mask_ = Classify(reinterpret_cast<const uint8_t*>(data));
+    }
+    for (; data < data_end; ++data) {
+      if (IsSpecial(static_cast<uint8_t>(*data))) {
+        return data;
+      }
+    }
+    return data_end;
+  }
+
+ protected:
+  bool IsSpecial(uint8_t c) const {
+    return c == '\r' || c == '\n' || c == delimiter_ || c == quote_ || c == escape_;
+  }
+
+  // The bitmask of the special characters among the kBlockSize bytes at `data`
+  uint64_t Classify(const uint8_t* data) const {
+#if defined(ARROW_HAVE_SSE4_2)
+    const __m128i cr = _mm_set1_epi8('\r');
+    const __m128i lf = _mm_set1_epi8('\n');
+    const __m128i delimiter = _mm_set1_epi8(static_cast<char>(delimiter_));
+    const __m128i quote = _mm_set1_epi8(static_cast<char>(quote_));
+    const __m128i escape = _mm_set1_epi8(static_cast<char>(escape_));
+    uint64_t mask = 0;
+    for (int i = 0; i < 4; ++i) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i));
+      __m128i matches = _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf));
+      matches = _mm_or_si128(matches, _mm_cmpeq_epi8(v, delimiter));
+      if (SpecializedOptions::quoting) {
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(v, quote));
+      }
+      if (SpecializedOptions::escaping) {
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(v, escape));
+      }
+      mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(matches)))
+              << (16 * i);
+    }
+    return mask;
+#elif defined(ARROW_HAVE_NEON)
+    const uint8x16_t cr = vdupq_n_u8('\r');
+    const uint8x16_t lf = vdupq_n_u8('\n');
+    const uint8x16_t delimiter = vdupq_n_u8(delimiter_);
+    const uint8x16_t quote = vdupq_n_u8(quote_);
+    const uint8x16_t escape = vdupq_n_u8(escape_);
+    // Weights of the bytes in their group of 8, to gather the matches into bits
+    static const uint8_t kWeights[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                         1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t weights = vld1q_u8(kWeights);
+    uint8x16_t weighted[4];
+    for (int i = 0; i < 4; ++i) {
+      const uint8x16_t v = vld1q_u8(data + 16 * i);
+      uint8x16_t matches = vorrq_u8(vceqq_u8(v, cr), vceqq_u8(v, lf));
+      matches = vorrq_u8(matches, vceqq_u8(v, delimiter));
+      if (SpecializedOptions::quoting) {
+        matches = vorrq_u8(matches, vceqq_u8(v, quote));
+      }
+      if (SpecializedOptions::escaping) {
+        matches = vorrq_u8(matches, vceqq_u8(v, escape));
+      }
+      weighted[i] = vandq_u8(matches, weights);
+    }
+    uint8x16_t sum = vpaddq_u8(vpaddq_u8(weighted[0], weighted[1]),
+                               vpaddq_u8(weighted[2], weighted[3]));
+    sum = vpaddq_u8(sum, sum);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum), 0);
+#else
+    uint64_t mask = 0;
+    for (int64_t i = 0; i < kBlockSize; ++i) {
+      mask |= static_cast<uint64_t>(IsSpecial(data[i])) << i;
+    }
+    return mask;
+#endif
+  }
+
+  const uint8_t delimiter_, quote_, escape_;
+  // The last classified block and its bitmask
+  const char* block_ = nullptr;
+  uint64_t mask_ = 0;
+};
+
 }  // namespace internal
 }  // namespace csv
 }  // namespace arrow
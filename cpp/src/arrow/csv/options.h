@@ -104,6 +104,13 @@ struct ARROW_EXPORT ConvertOptions {
   bool auto_dict_encode = false;
   int32_t auto_dict_max_cardinality = 50;
 
+  /// Number of rows of each block that are scanned, before converting an inferred
+  /// column, to rule out the types that they can't convert to (-1 for all rows).
+  ///
+  /// This only saves reconverting the column to each such type: the inferred type
+  /// doesn't depend on it.
+  int64_t inference_sample_rows = -1;
+
   /// Decimal point character for floating-point and decimal data
   char decimal_point = '.';
 
@@ -188,6 +195,12 @@ struct ARROW_EXPORT WriteOptions {
   /// Whether to write an initial header line with column names
   bool include_header = true;
 
+  /// \brief Whether to use the global CPU thread pool
+  ///
+  /// If true, several batches of rows are converted in parallel while previously
+  /// converted ones are written to the output stream.  The output is identical.
+  bool use_threads = true;
+
   /// \brief Maximum number of rows processed at a time
   ///
   /// The CSV writer converts and writes data in batches of N rows.
@@ -76,16 +76,19 @@ class PresizedDataWriter {
 
   void BeginLine() { saved_parsed_size_ = parsed_size_; }
 
+  // All fields are stored
+  void StartField(int32_t col_index) {}
+  bool field_included() const { return true; }
+
   void PushFieldChar(char c) {
     DCHECK_LT(parsed_size_, parsed_capacity_);
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
-  template <typename Word>
-  void PushFieldWord(Word w) {
-    DCHECK_GE(parsed_capacity_ - parsed_size_, static_cast<int64_t>(sizeof(w)));
-    memcpy(parsed_ + parsed_size_, &w, sizeof(w));
-    parsed_size_ += sizeof(w);
+  void PushFieldBytes(const char* data, int64_t length) {
+    DCHECK_GE(parsed_capacity_ - parsed_size_, length);
+    memcpy(parsed_ + parsed_size_, data, static_cast<size_t>(length));
+    parsed_size_ += length;
   }
 
   // Rollback the state that was saved in BeginLine()
@@ -102,6 +105,41 @@ class PresizedDataWriter {
   int64_t saved_parsed_size_;
 };
 
+// A PresizedDataWriter only storing the fields of some columns
+class ProjectingDataWriter : public PresizedDataWriter {
+ public:
+  ProjectingDataWriter(MemoryPool* pool, uint32_t size,
+                       const std::vector<uint8_t>& included_columns)
+      : PresizedDataWriter(pool, size),
+        included_columns_(included_columns.data()),
+        num_columns_(static_cast<int32_t>(included_columns.size())) {}
+
+  void StartField(int32_t col_index) {
+    // Excess columns make an invalid row, don't bother storing them
+    field_included_ = col_index < num_columns_ && included_columns_[col_index];
+  }
+  bool field_included() const { return field_included_; }
+
+  void PushFieldChar(char c) {
+    // Avoid a branch by always writing the character, but only keeping it
+    // for included fields
+    DCHECK_LT(parsed_size_, parsed_capacity_);
+    parsed_[parsed_size_] = static_cast<uint8_t>(c);
+    parsed_size_ += field_included_;
+  }
+
+  void PushFieldBytes(const char* data, int64_t length) {
+    if (field_included_) {
+      PresizedDataWriter::PushFieldBytes(data, length);
+    }
+  }
+
+ protected:
+  const uint8_t* included_columns_;
+  int32_t num_columns_;
+  bool field_included_ = false;
+};
+
 template <typename Derived>
 class ValueDescWriter {
  public:
@@ -272,17 +310,21 @@ class BlockParserImpl {
   }
 
   template <typename SpecializedOptions, bool UseBulkFilter, typename ValueDescWriter,
-            typename DataWriter, typename BulkFilter>
+            typename DataWriter, typename Scanner>
   Status ParseLine(ValueDescWriter* values_writer, DataWriter* parsed_writer,
                    const char* data, const char* data_end, bool is_final,
-                   const char** out_data, const BulkFilter& bulk_filter) {
+                   const char** out_data, Scanner* scanner) {
     int32_t num_cols = 0;
     char c;
     const auto start = data;
 
     DCHECK_GT(data_end, data);
 
-    auto FinishField = [&]() { values_writer->FinishField(parsed_writer); };
+    auto FinishField = [&]() {
+      if (parsed_writer->field_included()) {
+        values_writer->FinishField(parsed_writer);
+      }
+    };
 
     values_writer->BeginLine();
     parsed_writer->BeginLine();
@@ -307,6 +349,7 @@ class BlockParserImpl {
 
   FieldStart:
     // At the start of a field
+    parsed_writer->StartField(num_cols);
     if (*data == options_.delimiter) {
       // Empty cells are very common in some files, shortcut them
       values_writer->StartField(false /* quoted */);
@@ -333,7 +376,7 @@ class BlockParserImpl {
   InField:
     // Inside a non-quoted part of a field
     if (UseBulkFilter) {
-      const char* bulk_end = RunBulkFilter(parsed_writer, data, data_end, bulk_filter);
+      const char* bulk_end = RunBulkFilter(parsed_writer, data, data_end, scanner);
       if (ARROW_PREDICT_FALSE(bulk_end == nullptr)) {
         if (is_final) {
           data = data_end;
@@ -377,7 +420,7 @@ class BlockParserImpl {
   InQuotedField:
     // Inside a quoted part of a field
     if (UseBulkFilter) {
-      const char* bulk_end = RunBulkFilter(parsed_writer, data, data_end, bulk_filter);
+      const char* bulk_end = RunBulkFilter(parsed_writer, data, data_end, scanner);
       if (ARROW_PREDICT_FALSE(bulk_end == nullptr)) {
         if (is_final) {
           data = data_end;
@@ -427,7 +470,7 @@ class BlockParserImpl {
     ++num_cols;
     if (ARROW_PREDICT_FALSE(num_cols != batch_.num_cols_)) {
       if (batch_.num_cols_ == -1) {
-        batch_.num_cols_ = num_cols;
+        batch_.num_cols_ = batch_.num_stored_cols_ = num_cols;
       } else {
         return HandleInvalidRow(values_writer, parsed_writer, start, data, num_cols,
                                 out_data);
@@ -451,10 +494,11 @@ class BlockParserImpl {
     if (!options_.ignore_empty_lines) {
       if (batch_.num_cols_ == -1) {
         // Consider as single value
-        batch_.num_cols_ = 1;
+        batch_.num_cols_ = batch_.num_stored_cols_ = 1;
       }
       // Record as row of empty (null?) values
-      while (num_cols++ < batch_.num_cols_) {
+      for (; num_cols < batch_.num_cols_; ++num_cols) {
+        parsed_writer->StartField(num_cols);
         values_writer->StartField(false /* quoted */);
         FinishField();
       }
@@ -464,36 +508,21 @@ class BlockParserImpl {
     return Status::OK();
   }
 
-  template <typename DataWriter, typename SpecializedBulkFilter>
+  // Copy the characters up to the next special one, return it or null if none
+  template <typename DataWriter, typename Scanner>
   const char* RunBulkFilter(DataWriter* data_writer, const char* data,
-                            const char* data_end,
-                            const SpecializedBulkFilter& bulk_filter) {
-    while (true) {
-      using WordType = typename SpecializedBulkFilter::WordType;
-
-      if (ARROW_PREDICT_FALSE(static_cast<size_t>(data_end - data) < sizeof(WordType))) {
-        if (ARROW_PREDICT_FALSE(data == data_end)) {
-          return nullptr;
-        }
-        return data;
-      }
-      WordType word;
-      memcpy(&word, data, sizeof(WordType));
-      if (bulk_filter.Matches(word)) {
-        return data;
-      }
-      // No special chars
-      data_writer->PushFieldWord(word);
-      data += sizeof(WordType);
-    }
+                            const char* data_end, Scanner* scanner) {
+    const char* special = scanner->Next(data, data_end);
+    data_writer->PushFieldBytes(data, special - data);
+    return ARROW_PREDICT_FALSE(special == data_end) ? nullptr : special;
   }
 
   template <typename SpecializedOptions, typename ValueDescWriter, typename DataWriter,
-            typename BulkFilter>
+            typename Scanner>
   Status ParseChunk(ValueDescWriter* values_writer, DataWriter* parsed_writer,
                     const char* data, const char* data_end, bool is_final,
                     int32_t rows_in_chunk, const char** out_data, bool* finished_parsing,
-                    const BulkFilter& bulk_filter) {
+                    Scanner* scanner) {
     const int32_t start_num_rows = batch_.num_rows_;
     const int32_t num_rows_deadline = batch_.num_rows_ + rows_in_chunk;
 
@@ -502,7 +531,7 @@ class BlockParserImpl {
         const char* line_end = data;
         RETURN_NOT_OK((ParseLine<SpecializedOptions, true>(values_writer, parsed_writer,
                                                            data, data_end, is_final,
-                                                           &line_end, bulk_filter)));
+                                                           &line_end, scanner)));
         RETURN_NOT_OK(values_writer->status());
         if (line_end == data) {
           // Cannot parse any further
@@ -516,7 +545,7 @@ class BlockParserImpl {
         const char* line_end = data;
         RETURN_NOT_OK((ParseLine<SpecializedOptions, false>(values_writer, parsed_writer,
                                                             data, data_end, is_final,
-                                                            &line_end, bulk_filter)));
+                                                            &line_end, scanner)));
         RETURN_NOT_OK(values_writer->status());
         if (line_end == data) {
           // Cannot parse any further
@@ -550,11 +579,6 @@ class BlockParserImpl {
   template <typename SpecializedOptions>
   Status ParseSpecialized(const std::vector<std::string_view>& views, bool is_final,
                           uint32_t* out_size) {
-    internal::PreferredBulkFilterType<SpecializedOptions> bulk_filter(options_);
-
-    batch_ = DataBatch{batch_.num_cols_};
-    values_size_ = 0;
-
     size_t total_view_length = 0;
     for (const auto& view : views) {
       total_view_length += view.length();
@@ -563,7 +587,29 @@ class BlockParserImpl {
       return Status::Invalid("CSV block too large");
     }
 
-    PresizedDataWriter parsed_writer(pool_, static_cast<uint32_t>(total_view_length));
+    if (included_columns_.empty()) {
+      PresizedDataWriter parsed_writer(pool_, static_cast<uint32_t>(total_view_length));
+      return ParseSpecialized<SpecializedOptions>(views, is_final, &parsed_writer,
+                                                  out_size);
+    }
+    ProjectingDataWriter parsed_writer(pool_, static_cast<uint32_t>(total_view_length),
+                                       included_columns_);
+    return ParseSpecialized<SpecializedOptions>(views, is_final, &parsed_writer,
+                                                out_size);
+  }
+
+  template <typename SpecializedOptions, typename DataWriter>
+  Status ParseSpecialized(const std::vector<std::string_view>& views, bool is_final,
+                          DataWriter* parsed_writer, uint32_t* out_size) {
+    internal::StructuralScanner<SpecializedOptions> scanner(options_);
+
+    auto column_slots = std::move(batch_.column_slots_);
+    const int32_t num_stored_cols = batch_.num_stored_cols_;
+    batch_ = DataBatch{batch_.num_cols_};
+    batch_.column_slots_ = std::move(column_slots);
+    batch_.num_stored_cols_ = num_stored_cols;
+    values_size_ = 0;
+
     uint32_t total_parsed_length = 0;
 
     for (const auto& view : views) {
@@ -576,11 +622,11 @@ class BlockParserImpl {
         // a single line
         const int32_t rows_in_chunk = 1;
         ARROW_ASSIGN_OR_RAISE(auto values_writer, ResizableValueDescWriter::Make(pool_));
-        values_writer.Start(parsed_writer);
+        values_writer.Start(*parsed_writer);
 
         RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
-            &values_writer, &parsed_writer, data, data_end, is_final, rows_in_chunk,
-            &data, &finished_parsing, bulk_filter));
+            &values_writer, parsed_writer, data, data_end, is_final, rows_in_chunk,
+            &data, &finished_parsing, &scanner));
         if (batch_.num_cols_ == -1) {
           return ParseError("Empty CSV file or block: cannot infer number of columns");
         }
@@ -593,21 +639,22 @@ class BlockParserImpl {
 
         int32_t rows_in_chunk;
         constexpr int32_t kTargetChunkSize = 32768;  // in number of values
-        if (batch_.num_cols_ > 0) {
-          rows_in_chunk = std::min(std::max(kTargetChunkSize / batch_.num_cols_, 512),
-                                   max_num_rows_ - batch_.num_rows_);
+        if (batch_.num_stored_cols_ > 0) {
+          rows_in_chunk =
+              std::min(std::max(kTargetChunkSize / batch_.num_stored_cols_, 512),
+                       max_num_rows_ - batch_.num_rows_);
         } else {
           rows_in_chunk = std::min(kTargetChunkSize, max_num_rows_ - batch_.num_rows_);
         }
 
         ARROW_ASSIGN_OR_RAISE(
             auto values_writer,
-            PresizedValueDescWriter::Make(pool_, rows_in_chunk, batch_.num_cols_));
-        values_writer.Start(parsed_writer);
+            PresizedValueDescWriter::Make(pool_, rows_in_chunk, batch_.num_stored_cols_));
+        values_writer.Start(*parsed_writer);
 
         RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
-            &values_writer, &parsed_writer, data, data_end, is_final, rows_in_chunk,
-            &data, &finished_parsing, bulk_filter));
+            &values_writer, parsed_writer, data, data_end, is_final, rows_in_chunk,
+            &data, &finished_parsing, &scanner));
       }
       DCHECK_GE(data, view.data());
       DCHECK_LE(data, data_end);
@@ -619,14 +666,14 @@ class BlockParserImpl {
       }
     }
 
-    parsed_writer.Finish(&batch_.parsed_buffer_);
+    parsed_writer->Finish(&batch_.parsed_buffer_);
     batch_.parsed_size_ = static_cast<int32_t>(batch_.parsed_buffer_->size());
     batch_.parsed_ = batch_.parsed_buffer_->data();
 
     if (batch_.num_cols_ == -1) {
       DCHECK_EQ(batch_.num_rows_, 0);
     }
-    DCHECK_EQ(values_size_, batch_.num_rows_ * batch_.num_cols_);
+    DCHECK_EQ(values_size_, batch_.num_rows_ * batch_.num_stored_cols_);
 #ifndef NDEBUG
     if (batch_.num_rows_ > 0) {
       // Ending parsed offset should be equal to number of parsed bytes
@@ -646,6 +693,32 @@ class BlockParserImpl {
     return Status::OK();
   }
 
+  Status SetIncludedColumns(const std::vector<int32_t>& column_indices) {
+    const int32_t num_cols = batch_.num_cols_;
+    if (num_cols < 0) {
+      return Status::Invalid(
+          "Cannot select CSV columns before the number of columns is known");
+    }
+    std::vector<uint8_t> included_columns(num_cols, 0);
+    for (const int32_t col_index : column_indices) {
+      if (col_index < 0 || col_index >= num_cols) {
+        return Status::IndexError("CSV column index ", col_index, " out of bounds");
+      }
+      included_columns[col_index] = 1;
+    }
+    std::vector<int32_t> column_slots(num_cols, -1);
+    int32_t num_stored_cols = 0;
+    for (int32_t col_index = 0; col_index < num_cols; ++col_index) {
+      if (included_columns[col_index]) {
+        column_slots[col_index] = num_stored_cols++;
+      }
+    }
+    included_columns_ = std::move(included_columns);
+    batch_.column_slots_ = std::move(column_slots);
+    batch_.num_stored_cols_ = num_stored_cols;
+    return Status::OK();
+  }
+
   Status Parse(const std::vector<std::string_view>& data, bool is_final,
                uint32_t* out_size) {
     if (options_.quoting) {
@@ -675,6 +748,8 @@ class BlockParserImpl {
   int32_t max_num_rows_;
 
   bool use_bulk_filter_ = false;
+  // Whether each column is stored, empty if all are
+  std::vector<uint8_t> included_columns_;
 
   // Unparsed data size
   int32_t values_size_;
@@ -714,6 +789,10 @@ const DataBatch& BlockParser::parsed_batch() const { return impl_->parsed_batch(
 
 int64_t BlockParser::first_row_num() const { return impl_->first_row_num(); }
 
+Status BlockParser::SetIncludedColumns(const std::vector<int32_t>& column_indices) {
+  return impl_->SetIncludedColumns(column_indices);
+}
+
 int32_t SkipRows(const uint8_t* data, uint32_t size, int32_t num_rows,
                  const uint8_t** out_data) {
   const auto end = data + size;
@@ -55,7 +55,8 @@ struct ParsedValueDesc {
 
 class ARROW_EXPORT DataBatch {
  public:
-  explicit DataBatch(int32_t num_cols) : num_cols_(num_cols) {}
+  explicit DataBatch(int32_t num_cols)
+      : num_cols_(num_cols), num_stored_cols_(num_cols) {}
 
   /// \brief Return the number of parsed rows (not skipped)
   int32_t num_rows() const { return num_rows_; }
@@ -70,13 +71,17 @@ class ARROW_EXPORT DataBatch {
   Status VisitColumn(int32_t col_index, int64_t first_row, Visitor&& visit) const {
     using detail::ParsedValueDesc;
 
+    const int32_t slot = column_slots_.empty() ? col_index : column_slots_[col_index];
+    if (ARROW_PREDICT_FALSE(slot < 0)) {
+      return Status::Invalid("CSV column #", col_index, " was not parsed");
+    }
     int32_t batch_row = 0;
     for (size_t buf_index = 0; buf_index < values_buffers_.size(); ++buf_index) {
       const auto& values_buffer = values_buffers_[buf_index];
       const auto values = reinterpret_cast<const ParsedValueDesc*>(values_buffer->data());
       const auto max_pos =
           static_cast<int32_t>(values_buffer->size() / sizeof(ParsedValueDesc)) - 1;
-      for (int32_t pos = col_index; pos < max_pos; pos += num_cols_, ++batch_row) {
+      for (int32_t pos = slot; pos < max_pos; pos += num_stored_cols_, ++batch_row) {
         auto start = values[pos].offset;
         auto stop = values[pos + 1].offset;
         auto quoted = values[pos + 1].quoted;
@@ -97,8 +102,8 @@ class ARROW_EXPORT DataBatch {
     const auto values = reinterpret_cast<const ParsedValueDesc*>(values_buffer->data());
     const auto start_pos =
         static_cast<int32_t>(values_buffer->size() / sizeof(ParsedValueDesc)) -
-        num_cols_ - 1;
-    for (int32_t col_index = 0; col_index < num_cols_; ++col_index) {
+        num_stored_cols_ - 1;
+    for (int32_t col_index = 0; col_index < num_stored_cols_; ++col_index) {
       auto start = values[start_pos + col_index].offset;
       auto stop = values[start_pos + col_index + 1].offset;
       auto quoted = values[start_pos + col_index + 1].quoted;
@@ -128,6 +133,10 @@ class ARROW_EXPORT DataBatch {
   int32_t num_rows_ = 0;
   // The number of columns
   int32_t num_cols_ = 0;
+  // The number of columns whose values are stored, and the index of each column
+  // among them (-1 if not stored), unless all columns are stored
+  int32_t num_stored_cols_ = 0;
+  std::vector<int32_t> column_slots_;
 
   // XXX should we ensure the parsed buffer is padded with 8 or 16 excess zero bytes?
   // It may help with null parsing...
@@ -203,6 +212,13 @@ class ARROW_EXPORT BlockParser {
   /// \brief Return the row number of the first row in the block or -1 if unsupported
   int64_t first_row_num() const;
 
+  /// \brief Only store the values of the given columns
+  ///
+  /// The fields of other columns are still delimited and counted, but their values
+  /// are neither copied nor indexed, and cannot be visited.  This requires the
+  /// number of columns to be given to the constructor.
+  Status SetIncludedColumns(const std::vector<int32_t>& column_indices);
+
   /// \brief Visit parsed values in a column
   ///
   /// The signature of the visitor is
@@ -213,6 +229,7 @@ class ARROW_EXPORT BlockParser {
                                       std::forward<Visitor>(visit));
   }
 
+  /// \brief Visit the stored values of the last parsed row
   template <typename Visitor>
   Status VisitLastRow(Visitor&& visit) const {
     return parsed_batch().VisitLastRow(std::forward<Visitor>(visit));
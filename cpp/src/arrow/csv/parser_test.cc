@@ -459,6 +459,61 @@ TEST(BlockParser, FinalTruncatedBulkFilterNoEol) {
                                   ParseFinal(parser, csv, &out_size));
 }
 
+TEST(BlockParser, LongFields) {
+  // Fields spanning several 64-byte scanning blocks, with special characters
+  // on both sides of block boundaries
+  const std::string a(63, 'a'), b(64, 'b'), c(130, 'c');
+  auto csv = MakeCSVData({a + "," + b + "\n", "\"" + c + ",\"," + a + "\n", b + "," + c});
+
+  BlockParser parser(ParseOptions::Defaults());
+  AssertParseFinal(parser, csv);
+  AssertColumnsEq(parser, {{a, c + ",", b}, {b, a, c}},
+                  {{false, true, false}, {false, false, false}} /* quoted */);
+}
+
+TEST(BlockParser, IncludedColumns) {
+  auto options = ParseOptions::Defaults();
+  options.ignore_empty_lines = false;
+  {
+    auto csv = MakeCSVData({"ab,\"c,d\",e\n", "gh,,ij\n", "\n", "kl,mn,\"op\"\n"});
+    BlockParser parser(options, /*num_cols=*/3);
+    ASSERT_OK(parser.SetIncludedColumns({2, 0}));
+    AssertParseOk(parser, csv);
+    ASSERT_EQ(parser.num_cols(), 3);
+    AssertColumnEq(parser, 0, {"ab", "gh", "", "kl"});
+    AssertColumnEq(parser, 2, {"e", "ij", "", "op"}, {false, false, false, true});
+    ASSERT_EQ(parser.num_bytes(), 11);
+    ASSERT_RAISES(Invalid, parser.VisitColumn(1, [](const uint8_t*, uint32_t, bool) {
+      return Status::OK();
+    }));
+  }
+  {
+    // Long values, skipped by the bulk filter
+    const std::string a(40, 'a'), b(40, 'b'), c(40, 'c');
+    std::vector<std::string> lines(1000, a + "," + b + "," + c + "\n");
+    auto csv = MakeCSVData(lines);
+    BlockParser parser(options, /*num_cols=*/3);
+    ASSERT_OK(parser.SetIncludedColumns({1}));
+    AssertParseOk(parser, csv);
+    AssertColumnEq(parser, 1, std::vector<std::string>(1000, b));
+    ASSERT_EQ(parser.num_bytes(), 40000);
+  }
+  {
+    // The number of columns is still checked
+    auto csv = MakeCSVData({"ab,cd,ef\n", "gh,ij\n"});
+    BlockParser parser(options, /*num_cols=*/3);
+    ASSERT_OK(parser.SetIncludedColumns({0}));
+    uint32_t out_size;
+    ASSERT_RAISES(Invalid, Parse(parser, csv, &out_size));
+  }
+  {
+    BlockParser parser(options);
+    ASSERT_RAISES(Invalid, parser.SetIncludedColumns({0}));
+    BlockParser other_parser(options, /*num_cols=*/3);
+    ASSERT_RAISES(IndexError, other_parser.SetIncludedColumns({3}));
+  }
+}
+
 TEST(BlockParser, QuotingSimple) {
   auto csv = MakeCSVData({"1,\",3,\",5\n"});
 
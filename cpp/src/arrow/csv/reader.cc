@@ -392,10 +392,12 @@ namespace {
 class BlockParsingOperator {
  public:
   BlockParsingOperator(io::IOContext io_context, ParseOptions parse_options,
-                       int num_csv_cols, int64_t first_row)
+                       int num_csv_cols, int64_t first_row,
+                       std::optional<std::vector<int32_t>> included_columns = {})
       : io_context_(io_context),
         parse_options_(parse_options),
         num_csv_cols_(num_csv_cols),
+        included_columns_(std::move(included_columns)),
         count_rows_(first_row >= 0),
         num_rows_seen_(first_row) {}
 
@@ -404,6 +406,9 @@ class BlockParsingOperator {
     constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
     auto parser = std::make_shared<BlockParser>(
         io_context_.pool(), parse_options_, num_csv_cols_, num_rows_seen_, max_num_rows);
+    if (included_columns_.has_value()) {
+      RETURN_NOT_OK(parser->SetIncludedColumns(*included_columns_));
+    }
 
     std::shared_ptr<Buffer> straddling;
     std::vector<std::string_view> views;
@@ -458,6 +463,8 @@ class BlockParsingOperator {
   io::IOContext io_context_;
   const ParseOptions parse_options_;
   const int num_csv_cols_;
+  // The CSV columns whose values are needed, if not all
+  const std::optional<std::vector<int32_t>> included_columns_;
   const bool count_rows_;
   int64_t num_rows_seen_;
 };
@@ -648,11 +655,22 @@ class ReaderMixin {
 
     int32_t num_csv_cols = static_cast<int32_t>(column_names_.size());
     DCHECK_GT(num_csv_cols, 0);
-    // Since we know the number of columns, we can instantiate the BlockParsingOperator
-    parsing_operator_.emplace(io_context_, parse_options_, num_csv_cols,
-                              count_rows_ ? num_rows_seen : -1);
-
     RETURN_NOT_OK(MakeConversionSchema());
+
+    // Since we know the number of columns, we can instantiate the BlockParsingOperator,
+    // letting it skip the values of the columns which are not converted
+    std::optional<std::vector<int32_t>> included_columns;
+    if (!convert_options_.include_columns.empty()) {
+      included_columns.emplace();
+      for (const auto& column : conversion_schema_.columns) {
+        if (!column.is_missing) {
+          included_columns->push_back(column.index);
+        }
+      }
+    }
+    parsing_operator_.emplace(io_context_, parse_options_, num_csv_cols,
+                              count_rows_ ? num_rows_seen : -1,
+                              std::move(included_columns));
     return bytes_consumed;
   }
 
@@ -698,7 +716,8 @@ class ReaderMixin {
 
     if (convert_options_.include_columns.empty()) {
       // Include all columns in CSV file order
-      for (int32_t col_index = 0; col_index < num_csv_cols(); ++col_index) {
+      for (int32_t col_index = 0; col_index < static_cast<int32_t>(column_names_.size());
+           ++col_index) {
         append_csv_column(column_names_[col_index], col_index);
       }
     } else {
@@ -1053,7 +1072,8 @@ class AsyncThreadedTableReader
     auto self = shared_from_this();
     return ProcessFirstBuffer().Then([self](const std::shared_ptr<Buffer>& first_buffer) {
       auto block_generator = ThreadedBlockReader::MakeAsyncIterator(
-          self->buffer_generator_, MakeChunker(self->parse_options_), first_buffer,
+          self->buffer_generator_,
+          MakeChunker(self->parse_options_, self->cpu_executor_), first_buffer,
           self->read_options_.skip_rows_after_names);
 
       std::function<Status(CSVBlock)> block_visitor =
@@ -17,17 +17,17 @@
 
 #include "arrow/csv/writer.h"
 #include "arrow/array.h"
-#include "arrow/compute/cast.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/stl_allocator.h"
-#include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/slice_writer_internal.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
 
+#include <algorithm>
 #include <memory>
 
 #if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
@@ -37,6 +37,7 @@
 namespace arrow {
 
 using internal::checked_pointer_cast;
+using internal::SliceWriter;
 
 namespace csv {
 // This implementation is intentionally light on configurability to minimize the size of
@@ -78,26 +79,6 @@ void CopyEndChars(char* dest, const char* src, size_t size) {
   }
 }
 
-struct SliceIteratorFunctor {
-  Result<std::shared_ptr<RecordBatch>> Next() {
-    if (current_offset < batch->num_rows()) {
-      std::shared_ptr<RecordBatch> next = batch->Slice(current_offset, slice_size);
-      current_offset += slice_size;
-      return next;
-    }
-    return IterationTraits<std::shared_ptr<RecordBatch>>::End();
-  }
-  const RecordBatch* const batch;
-  const int64_t slice_size;
-  int64_t current_offset;
-};
-
-RecordBatchIterator RecordBatchSliceIterator(const RecordBatch& batch,
-                                             int64_t slice_size) {
-  SliceIteratorFunctor functor = {&batch, slice_size, /*offset=*/static_cast<int64_t>(0)};
-  return RecordBatchIterator(std::move(functor));
-}
-
 // Counts the number of quotes in s.
 int64_t CountQuotes(std::string_view s) {
   return static_cast<int64_t>(std::count(s.begin(), s.end(), '"'));
@@ -123,24 +104,7 @@ class ColumnPopulator {
   // Adds the number of characters each entry in data will add to to elements
   // in row_lengths.
   Status UpdateRowLengths(const Array& data, int64_t* row_lengths) {
-    compute::ExecContext ctx(pool_);
-    // Populators are intented to be applied to reasonably small data.  In most cases
-    // threading overhead would not be justified.
-    ctx.set_use_threads(false);
-    if (data.type() && is_large_binary_like(data.type()->id())) {
-      ARROW_ASSIGN_OR_RAISE(array_, compute::Cast(data, /*to_type=*/large_utf8(),
-                                                  compute::CastOptions(), &ctx));
-    } else {
-      auto casted = compute::Cast(data, /*to_type=*/utf8(), compute::CastOptions(), &ctx);
-      if (casted.ok()) {
-        array_ = std::move(casted).ValueOrDie();
-      } else if (casted.status().IsCapacityError()) {
-        ARROW_ASSIGN_OR_RAISE(array_, compute::Cast(data, /*to_type=*/large_utf8(),
-                                                    compute::CastOptions(), &ctx));
-      } else {
-        return casted.status();
-      }
-    }
+    ARROW_ASSIGN_OR_RAISE(array_, internal::CastToStringArray(data, pool_));
     return UpdateRowLengths(row_lengths);
   }
 
@@ -489,6 +453,91 @@ Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
                        pool);
 }
 
+Result<std::vector<std::unique_ptr<ColumnPopulator>>> MakePopulators(
+    const Schema& schema, const std::shared_ptr<Buffer>& null_string,
+    const WriteOptions& options) {
+  std::vector<std::unique_ptr<ColumnPopulator>> populators(schema.num_fields());
+  std::string delimiter(1, options.delimiter);
+  for (int col = 0; col < schema.num_fields(); col++) {
+    const std::string& end_chars =
+        col < schema.num_fields() - 1 ? delimiter : options.eol;
+    ARROW_ASSIGN_OR_RAISE(
+        populators[col],
+        MakePopulator(*schema.field(col), end_chars, options.delimiter, null_string,
+                      options.quoting_style, options.io_context.pool()));
+  }
+  return populators;
+}
+
+// Converts slices of rows to CSV data.  Each formatter has its own populators and
+// data buffer, so that several of them can convert different slices concurrently.
+class CSVSliceFormatter : public internal::SliceFormatter {
+ public:
+  static Result<std::unique_ptr<internal::SliceFormatter>> Make(
+      const Schema& schema, const std::shared_ptr<Buffer>& null_string,
+      const WriteOptions& options) {
+    ARROW_ASSIGN_OR_RAISE(auto populators, MakePopulators(schema, null_string, options));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> data_buffer,
+                          AllocateResizableBuffer(0, options.io_context.pool()));
+    return std::make_unique<CSVSliceFormatter>(std::move(populators),
+                                               std::move(data_buffer), options);
+  }
+
+  CSVSliceFormatter(std::vector<std::unique_ptr<ColumnPopulator>> populators,
+                    std::shared_ptr<ResizableBuffer> data_buffer,
+                    const WriteOptions& options)
+      : internal::SliceFormatter(std::move(data_buffer)),
+        column_populators_(std::move(populators)),
+        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
+        eol_size_(static_cast<int32_t>(options.eol.size())) {}
+
+  Status Format(const RecordBatch& batch) override {
+    if (batch.num_rows() == 0) {
+      return data_buffer_->Resize(0, /*shrink_to_fit=*/false);
+    }
+    offsets_.resize(batch.num_rows());
+    std::fill(offsets_.begin(), offsets_.end(), 0);
+
+    // Calculate relative offsets for each row (excluding delimiters)
+    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
+      RETURN_NOT_OK(
+          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
+    }
+    // Calculate cumulative offsets for each row (including delimiters).
+    // - before conversion: offsets_[i] = length of i-th row
+    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
+    //   - offsets_[0] = 0
+    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
+    // Delimiters: ',' * (num_columns - 1) + eol
+    const int32_t delimiters_length =
+        static_cast<int32_t>(batch.num_columns() - 1 + eol_size_);
+    int64_t last_row_length = offsets_[0] + delimiters_length;
+    offsets_[0] = 0;
+    for (size_t row = 1; row < offsets_.size(); ++row) {
+      const int64_t this_row_length = offsets_[row] + delimiters_length;
+      offsets_[row] = offsets_[row - 1] + last_row_length;
+      last_row_length = this_row_length;
+    }
+    // Resize the target buffer to required size. We assume batch to batch sizes
+    // should be pretty close so don't shrink the buffer to avoid allocation churn.
+    RETURN_NOT_OK(
+        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
+
+    // Use the offsets to populate contents.
+    for (auto& populator : column_populators_) {
+      RETURN_NOT_OK(populator->PopulateRows(
+          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
+    }
+    DCHECK_EQ(data_buffer_->size(), offsets_.back());
+    return Status::OK();
+  }
+
+ private:
+  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
+  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
+  const int32_t eol_size_;
+};
+
 class CSVWriterImpl : public ipc::RecordBatchWriter {
  public:
   static Result<std::shared_ptr<CSVWriterImpl>> Make(
@@ -505,19 +554,14 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     memcpy(null_string->mutable_data(), options.null_string.data(),
            options.null_string.length());
 
-    std::vector<std::unique_ptr<ColumnPopulator>> populators(schema->num_fields());
-    std::string delimiter(1, options.delimiter);
-    for (int col = 0; col < schema->num_fields(); col++) {
-      const std::string& end_chars =
-          col < schema->num_fields() - 1 ? delimiter : options.eol;
-      ARROW_ASSIGN_OR_RAISE(
-          populators[col],
-          MakePopulator(*schema->field(col), end_chars, options.delimiter, null_string,
-                        options.quoting_style, options.io_context.pool()));
-    }
-    auto writer = std::make_shared<CSVWriterImpl>(
-        sink, std::move(owned_sink), std::move(schema), std::move(populators), options);
-    RETURN_NOT_OK(writer->PrepareForContentsWrite());
+    ARROW_ASSIGN_OR_RAISE(
+        auto slice_writer,
+        SliceWriter::Make(sink, options.use_threads, [&] {
+          return CSVSliceFormatter::Make(*schema, null_string, options);
+        }));
+    auto writer =
+        std::make_shared<CSVWriterImpl>(sink, std::move(owned_sink), std::move(schema),
+                                        std::move(slice_writer), options);
     if (options.include_header) {
       RETURN_NOT_OK(writer->WriteHeader());
     }
@@ -525,59 +569,32 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
   }
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
-    RecordBatchIterator iterator = RecordBatchSliceIterator(batch, options_.batch_size);
-    for (auto maybe_slice : iterator) {
-      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, maybe_slice);
-      RETURN_NOT_OK(TranslateMinimalBatch(*slice));
-      RETURN_NOT_OK(sink_->Write(data_buffer_));
-      stats_.num_record_batches++;
-    }
-    return Status::OK();
+    return slice_writer_->WriteRecordBatch(batch, options_.batch_size);
   }
 
   Status WriteTable(const Table& table, int64_t max_chunksize) override {
-    TableBatchReader reader(table);
-    reader.set_chunksize(max_chunksize > 0 ? max_chunksize : options_.batch_size);
-    std::shared_ptr<RecordBatch> batch;
-    RETURN_NOT_OK(reader.ReadNext(&batch));
-    while (batch != nullptr) {
-      RETURN_NOT_OK(TranslateMinimalBatch(*batch));
-      RETURN_NOT_OK(sink_->Write(data_buffer_));
-      RETURN_NOT_OK(reader.ReadNext(&batch));
-      stats_.num_record_batches++;
-    }
-
-    return Status::OK();
+    return slice_writer_->WriteTable(
+        table, max_chunksize > 0 ? max_chunksize : options_.batch_size);
   }
 
   Status Close() override { return Status::OK(); }
 
-  ipc::WriteStats stats() const override { return stats_; }
+  ipc::WriteStats stats() const override {
+    ipc::WriteStats stats;
+    stats.num_record_batches = slice_writer_->num_slices_written();
+    return stats;
+  }
 
   CSVWriterImpl(io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
                 std::shared_ptr<Schema> schema,
-                std::vector<std::unique_ptr<ColumnPopulator>> populators,
-                const WriteOptions& options)
+                std::unique_ptr<SliceWriter> slice_writer, const WriteOptions& options)
       : sink_(sink),
         owned_sink_(std::move(owned_sink)),
-        column_populators_(std::move(populators)),
-        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
+        slice_writer_(std::move(slice_writer)),
         schema_(std::move(schema)),
         options_(options) {}
 
  private:
-  Status PrepareForContentsWrite() {
-    // Only called once, as part of initialization
-    if (data_buffer_ == nullptr) {
-      ARROW_ASSIGN_OR_RAISE(
-          data_buffer_,
-          AllocateResizableBuffer(
-              options_.batch_size * schema_->num_fields() * kColumnSizeGuess,
-              options_.io_context.pool()));
-    }
-    return Status::OK();
-  }
-
   int64_t CalculateHeaderSize() const {
     int64_t header_length = 0;
     for (int col = 0; col < schema_->num_fields(); col++) {
@@ -592,8 +609,10 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
 
   Status WriteHeader() {
     // Only called once, as part of initialization
-    RETURN_NOT_OK(data_buffer_->Resize(CalculateHeaderSize(), /*shrink_to_fit=*/false));
-    char* next = reinterpret_cast<char*>(data_buffer_->mutable_data());
+    const std::shared_ptr<ResizableBuffer>& data_buffer =
+        slice_writer_->formatter()->data_buffer();
+    RETURN_NOT_OK(data_buffer->Resize(CalculateHeaderSize(), /*shrink_to_fit=*/false));
+    char* next = reinterpret_cast<char*>(data_buffer->mutable_data());
     for (int col = 0; col < schema_->num_fields(); ++col) {
       *next++ = '"';
       next = Escape(schema_->field(col)->name(), next);
@@ -605,60 +624,15 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     memcpy(next, options_.eol.data(), options_.eol.size());
     next += options_.eol.size();
     DCHECK_EQ(reinterpret_cast<uint8_t*>(next),
-              data_buffer_->data() + data_buffer_->size());
-    return sink_->Write(data_buffer_);
-  }
-
-  Status TranslateMinimalBatch(const RecordBatch& batch) {
-    if (batch.num_rows() == 0) {
-      return Status::OK();
-    }
-    offsets_.resize(batch.num_rows());
-    std::fill(offsets_.begin(), offsets_.end(), 0);
-
-    // Calculate relative offsets for each row (excluding delimiters)
-    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
-      RETURN_NOT_OK(
-          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
-    }
-    // Calculate cumulative offsets for each row (including delimiters).
-    // - before conversion: offsets_[i] = length of i-th row
-    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
-    //   - offsets_[0] = 0
-    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
-    // Delimiters: ',' * (num_columns - 1) + eol
-    const int32_t delimiters_length =
-        static_cast<int32_t>(batch.num_columns() - 1 + options_.eol.size());
-    int64_t last_row_length = offsets_[0] + delimiters_length;
-    offsets_[0] = 0;
-    for (size_t row = 1; row < offsets_.size(); ++row) {
-      const int64_t this_row_length = offsets_[row] + delimiters_length;
-      offsets_[row] = offsets_[row - 1] + last_row_length;
-      last_row_length = this_row_length;
-    }
-    // Resize the target buffer to required size. We assume batch to batch sizes
-    // should be pretty close so don't shrink the buffer to avoid allocation churn.
-    RETURN_NOT_OK(
-        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
-
-    // Use the offsets to populate contents.
-    for (auto& populator : column_populators_) {
-      RETURN_NOT_OK(populator->PopulateRows(
-          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
-    }
-    DCHECK_EQ(data_buffer_->size(), offsets_.back());
-    return Status::OK();
+              data_buffer->data() + data_buffer->size());
+    return sink_->Write(data_buffer);
   }
 
-  static constexpr int64_t kColumnSizeGuess = 8;
   io::OutputStream* sink_;
   std::shared_ptr<io::OutputStream> owned_sink_;
-  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
-  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
-  std::shared_ptr<ResizableBuffer> data_buffer_;
+  std::unique_ptr<SliceWriter> slice_writer_;
   const std::shared_ptr<Schema> schema_;
   const WriteOptions options_;
-  ipc::WriteStats stats_;
 };
 
 }  // namespace
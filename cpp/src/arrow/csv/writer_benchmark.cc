@@ -116,6 +116,14 @@ void WriteCsvNumeric(benchmark::State& state) {
   BenchmarkWriteCsv(state, WriteOptions::Defaults(), *batch);
 }
 
+// Same as WriteCsvNumeric, converting the slices on the calling thread
+void WriteCsvNumericSerial(benchmark::State& state) {
+  auto batch = MakeIntTestBatch(kCsvRows, kCsvCols, state.range(0));
+  auto options = WriteOptions::Defaults();
+  options.use_threads = false;
+  BenchmarkWriteCsv(state, options, *batch);
+}
+
 // Exercise QuotedColumnPopulator with string (without quote)
 void WriteCsvStringNoQuote(benchmark::State& state) {
   auto batch = MakeStrTestBatch(kCsvRows, kCsvCols, /*quote=*/false, state.range(0));
@@ -156,6 +164,7 @@ void NullPercents(benchmark::internal::Benchmark* bench) {
 }  // namespace
 
 BENCHMARK(WriteCsvNumeric)->Apply(NullPercents);
+BENCHMARK(WriteCsvNumericSerial)->Apply(NullPercents);
 BENCHMARK(WriteCsvStringNoQuote)->Apply(NullPercents);
 BENCHMARK(WriteCsvStringWithQuote)->Apply(NullPercents);
 BENCHMARK(WriteCsvStringRejectQuote)->Apply(NullPercents);
@@ -30,6 +30,7 @@
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
+#include "arrow/testing/random.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 
@@ -365,6 +366,36 @@ INSTANTIATE_TEST_SUITE_P(SingleColumnWriteCSVTest, TestWriteCSV,
                              "\n9999\n\n-15\n",
                              Status::OK())));
 
+TEST(TestWriteCSVThreaded, MatchesSerial) {
+  auto batch = random::GenerateBatch(
+      {field("int64", int64()), field("utf8", utf8()), field("float64", float64()),
+       field("bool", boolean())},
+      /*size=*/10000, /*seed=*/42);
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(
+                                       {batch->Slice(0, 3000), batch->Slice(3000)}));
+
+  auto to_csv_string = [](const auto& data, const WriteOptions& options) {
+    EXPECT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+    ARROW_EXPECT_OK(WriteCSV(data, options, out.get()));
+    EXPECT_OK_AND_ASSIGN(auto buffer, out->Finish());
+    return buffer->ToString();
+  };
+  for (const QuotingStyle quoting_style :
+       {QuotingStyle::Needed, QuotingStyle::AllValid}) {
+    ARROW_SCOPED_TRACE("quoting_style = ", static_cast<int>(quoting_style));
+    WriteOptions options = DefaultTestOptions(/*include_header=*/true, "NA",
+                                              quoting_style, "\r\n", ',',
+                                              /*batch_size=*/100);
+    options.use_threads = false;
+    const std::string expected = to_csv_string(*batch, options);
+    ASSERT_EQ(expected, to_csv_string(*table, options));
+
+    options.use_threads = true;
+    ASSERT_EQ(expected, to_csv_string(*batch, options));
+    ASSERT_EQ(expected, to_csv_string(*table, options));
+  }
+}
+
 #ifndef _WIN32
 // TODO(ARROW-13168):
 INSTANTIATE_TEST_SUITE_P(
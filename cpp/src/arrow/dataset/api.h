@@ -36,4 +36,6 @@
 #ifdef ARROW_PARQUET
 #  include "arrow/dataset/file_parquet.h"
 #endif
+#include "arrow/dataset/manifest.h"
+#include "arrow/dataset/plan_optimizer.h"
 #include "arrow/dataset/scanner.h"
@@ -16,7 +16,9 @@
 // under the License.
 
 #include <memory>
+#include <numeric>
 #include <utility>
+#include <vector>
 
 #include "arrow/acero/util.h"
 #include "arrow/dataset/dataset.h"
@@ -76,6 +78,14 @@ Future<std::optional<int64_t>> Fragment::CountRows(compute::Expression,
   return Future<std::optional<int64_t>>::MakeFinished(std::nullopt);
 }
 
+std::optional<FragmentStatistics> Fragment::GetCachedStatistics() {
+  return std::nullopt;
+}
+
+Result<FragmentVector> Fragment::SplitForScan(const std::shared_ptr<ScanOptions>&) {
+  return FragmentVector{shared_from_this()};
+}
+
 Status Fragment::ClearCachedMetadata() {
   auto lock = physical_schema_mutex_.Lock();
   physical_schema_.reset();
@@ -106,14 +116,17 @@ InMemoryFragment::InMemoryFragment(RecordBatchVector record_batches,
 Result<RecordBatchGenerator> InMemoryFragment::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options) {
   struct State {
-    State(std::shared_ptr<InMemoryFragment> fragment, int64_t batch_size)
+    State(std::shared_ptr<InMemoryFragment> fragment, std::vector<int> batch_indices,
+          int64_t batch_size)
         : fragment(std::move(fragment)),
+          batch_indices(std::move(batch_indices)),
           batch_index(0),
           offset(0),
           batch_size(batch_size) {}
 
     std::shared_ptr<RecordBatch> Next() {
-      const auto& next_parent = fragment->record_batches_[batch_index];
+      const auto& next_parent =
+          fragment->record_batches_[batch_indices[batch_index]];
       if (offset < next_parent->num_rows()) {
         auto next = next_parent->Slice(offset, batch_size);
         offset += batch_size;
@@ -124,17 +137,20 @@ Result<RecordBatchGenerator> InMemoryFragment::ScanBatchesAsync(
       return nullptr;
     }
 
-    bool Finished() { return batch_index >= fragment->record_batches_.size(); }
+    bool Finished() { return batch_index >= batch_indices.size(); }
 
     std::shared_ptr<InMemoryFragment> fragment;
+    std::vector<int> batch_indices;
     std::size_t batch_index;
     int64_t offset;
     int64_t batch_size;
   };
 
   struct Generator {
-    Generator(std::shared_ptr<InMemoryFragment> fragment, int64_t batch_size)
-        : state(std::make_shared<State>(std::move(fragment), batch_size)) {}
+    Generator(std::shared_ptr<InMemoryFragment> fragment, std::vector<int> batch_indices,
+              int64_t batch_size)
+        : state(std::make_shared<State>(std::move(fragment), std::move(batch_indices),
+                                        batch_size)) {}
 
     Future<std::shared_ptr<RecordBatch>> operator()() {
       while (!state->Finished()) {
@@ -148,8 +164,28 @@ Result<RecordBatchGenerator> InMemoryFragment::ScanBatchesAsync(
 
     std::shared_ptr<State> state;
   };
+
+  // Skip the record batches whose attached statistics don't match the filter
+  const int num_batches = static_cast<int>(record_batches_.size());
+  std::vector<int> batch_indices(num_batches);
+  std::iota(batch_indices.begin(), batch_indices.end(), 0);
+  if (num_batches > 0 && ExpressionHasFieldRefs(options->filter)) {
+    ARROW_ASSIGN_OR_RAISE(
+        batch_indices,
+        SelectPartsWithStatistics(
+            options->filter, *physical_schema_, num_batches,
+            [this](int field_index)
+                -> Result<std::vector<std::shared_ptr<ArrayStatistics>>> {
+              std::vector<std::shared_ptr<ArrayStatistics>> statistics;
+              statistics.reserve(record_batches_.size());
+              for (const auto& batch : record_batches_) {
+                statistics.push_back(batch->column_data(field_index)->statistics);
+              }
+              return statistics;
+            }));
+  }
   return Generator(checked_pointer_cast<InMemoryFragment>(shared_from_this()),
-                   options->batch_size);
+                   std::move(batch_indices), options->batch_size);
 }
 
 Future<std::optional<int64_t>> InMemoryFragment::CountRows(
@@ -164,6 +200,25 @@ Future<std::optional<int64_t>> InMemoryFragment::CountRows(
   return Future<std::optional<int64_t>>::MakeFinished(total);
 }
 
+std::optional<FragmentStatistics> InMemoryFragment::GetCachedStatistics() {
+  FragmentStatistics statistics;
+  for (const auto& batch : record_batches_) {
+    statistics.num_rows += batch->num_rows();
+  }
+  // The distinct counts of several batches can't be combined
+  if (record_batches_.size() == 1) {
+    const RecordBatch& batch = *record_batches_[0];
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      const auto& array_statistics = batch.column(i)->statistics();
+      if (array_statistics != nullptr && array_statistics->distinct_count.has_value()) {
+        statistics.distinct_counts[batch.schema()->field(i)->name()] =
+            *array_statistics->distinct_count;
+      }
+    }
+  }
+  return statistics;
+}
+
 Future<std::shared_ptr<InspectedFragment>> InMemoryFragment::InspectFragment(
     const FragmentScanOptions* format_options, compute::ExecContext* exec_context) {
   return std::make_shared<InspectedFragment>(physical_schema_->field_names());
@@ -23,6 +23,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -145,6 +146,15 @@ struct ARROW_DS_EXPORT InspectedFragment {
   std::vector<std::string> column_names;
 };
 
+/// \brief The size of a fragment, used to estimate the cost of plans
+struct ARROW_DS_EXPORT FragmentStatistics {
+  /// The number of rows of the fragment
+  int64_t num_rows = 0;
+  /// The number of distinct values of the top-level columns for which it is known,
+  /// by column name
+  std::unordered_map<std::string, int64_t> distinct_counts;
+};
+
 /// \brief A granular piece of a Dataset, such as an individual file.
 ///
 /// A Fragment can be read/scanned separately from other fragments. It yields a
@@ -190,6 +200,21 @@ class ARROW_DS_EXPORT Fragment : public std::enable_shared_from_this<Fragment> {
   virtual Future<std::optional<int64_t>> CountRows(
       compute::Expression predicate, const std::shared_ptr<ScanOptions>& options);
 
+  /// \brief Return the statistics of the fragment which are known without I/O
+  ///
+  /// This is std::nullopt by default, and when the metadata a fragment would need
+  /// wasn't read yet.
+  virtual std::optional<FragmentStatistics> GetCachedStatistics();
+
+  /// \brief Split this fragment into sub-fragments which can be scanned in parallel
+  ///
+  /// The batches of the sub-fragments, in order, are the batches of this fragment.
+  /// The scanner splits the fragments of a dataset before scanning them, so that
+  /// fragment_readahead also parallelizes the scan of a single large fragment.  This
+  /// may perform I/O to read metadata.  By default the fragment isn't split.
+  virtual Result<FragmentVector> SplitForScan(
+      const std::shared_ptr<ScanOptions>& options);
+
   /// \brief Clear any metadata that may have been cached by this object.
   ///
   /// A fragment may typically cache metadata to speed up repeated accesses.
@@ -257,6 +282,7 @@ class ARROW_DS_EXPORT InMemoryFragment : public Fragment {
   Future<std::optional<int64_t>> CountRows(
       compute::Expression predicate,
       const std::shared_ptr<ScanOptions>& options) override;
+  std::optional<FragmentStatistics> GetCachedStatistics() override;
 
   Future<std::shared_ptr<InspectedFragment>> InspectFragment(
       const FragmentScanOptions* format_options,
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -156,5 +157,52 @@ inline RecordBatchGenerator MakeChunkedBatchGenerator(RecordBatchGenerator gen,
       });
 }
 
+// Add a conjunct to an expression, dropping the initial literal(true)
+inline void FoldingAnd(compute::Expression* l, compute::Expression r) {
+  if (*l == compute::literal(true)) {
+    *l = std::move(r);
+  } else {
+    *l = compute::and_(std::move(*l), std::move(r));
+  }
+}
+
+// Return the indices of the parts of a file (record batches, stripes...) which may
+// hold rows matching a filter.  get_statistics returns the statistics of a top-level
+// field of the physical schema in each of the num_parts parts, with null pointers
+// where unknown; it is only called for the fields referenced by the filter.
+inline Result<std::vector<int>> SelectPartsWithStatistics(
+    const compute::Expression& filter, const Schema& physical_schema, int num_parts,
+    const std::function<Result<std::vector<std::shared_ptr<ArrayStatistics>>>(int)>&
+        get_statistics) {
+  std::vector<compute::Expression> guarantees(num_parts, compute::literal(true));
+  std::vector<bool> fields_seen(physical_schema.num_fields(), false);
+  for (const FieldRef& ref : compute::FieldsInExpression(filter)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema));
+    if (match.indices().size() != 1 || fields_seen[match[0]]) continue;
+    fields_seen[match[0]] = true;
+
+    ARROW_ASSIGN_OR_RAISE(auto statistics, get_statistics(match[0]));
+    const auto& field = *physical_schema.field(match[0]);
+    for (int i = 0; i < num_parts; ++i) {
+      if (statistics[i] == nullptr) continue;
+      if (auto expr = StatisticsAsExpression(field, *statistics[i])) {
+        FoldingAnd(&guarantees[i], std::move(*expr));
+      }
+    }
+  }
+
+  std::vector<int> selected;
+  for (int i = 0; i < num_parts; ++i) {
+    if (guarantees[i] != compute::literal(true)) {
+      ARROW_ASSIGN_OR_RAISE(auto guarantee, guarantees[i].Bind(physical_schema));
+      ARROW_ASSIGN_OR_RAISE(auto simplified,
+                            compute::SimplifyWithGuarantee(filter, guarantee));
+      if (!simplified.IsSatisfiable()) continue;
+    }
+    selected.push_back(i);
+  }
+  return selected;
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -50,6 +50,55 @@ TEST_F(TestInMemoryFragment, Scan) {
   AssertFragmentEquals(reader.get(), fragment.get());
 }
 
+TEST_F(TestInMemoryFragment, GetCachedStatistics) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(8, schema_);
+  auto i32_data = batch->column_data(0)->Copy();
+  i32_data->statistics = std::make_shared<ArrayStatistics>();
+  i32_data->statistics->distinct_count = 1;
+  batch = RecordBatch::Make(schema_, 8, {MakeArray(i32_data), batch->column(1)});
+
+  auto fragment = std::make_shared<InMemoryFragment>(RecordBatchVector{batch});
+  auto statistics = fragment->GetCachedStatistics();
+  ASSERT_TRUE(statistics.has_value());
+  ASSERT_EQ(statistics->num_rows, 8);
+  ASSERT_EQ(statistics->distinct_counts,
+            (std::unordered_map<std::string, int64_t>{{"i32", 1}}));
+
+  // The distinct counts of several batches are unknown
+  fragment = std::make_shared<InMemoryFragment>(RecordBatchVector{batch, batch});
+  statistics = fragment->GetCachedStatistics();
+  ASSERT_TRUE(statistics.has_value());
+  ASSERT_EQ(statistics->num_rows, 16);
+  ASSERT_TRUE(statistics->distinct_counts.empty());
+}
+
+TEST_F(TestInMemoryFragment, ScanPrunesWithStatistics) {
+  SetSchema({field("i32", int32())});
+  auto with_statistics = [&](const std::string& json) {
+    auto batch = RecordBatchFromJSON(schema_, json);
+    batch->column_data(0)->statistics = ComputeArrayStatistics(*batch->column_data(0));
+    return batch;
+  };
+  auto fragment = std::make_shared<InMemoryFragment>(RecordBatchVector{
+      with_statistics(R"([{"i32": 1}, {"i32": 2}])"),
+      with_statistics(R"([{"i32": 10}, {"i32": null}])"),
+      RecordBatchFromJSON(schema_, R"([{"i32": 20}])")});
+
+  // The first batch can't match, the last one has no statistics
+  SetFilter(greater(field_ref("i32"), literal(5)));
+  ASSERT_OK_AND_ASSIGN(auto batch_gen, fragment->ScanBatchesAsync(options_));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(batch_gen));
+  ASSERT_EQ(batches.size(), 2);
+  AssertBatchesEqual(*RecordBatchFromJSON(schema_, R"([{"i32": 10}, {"i32": null}])"),
+                     *batches[0]);
+
+  SetFilter(literal(true));
+  ASSERT_OK_AND_ASSIGN(batch_gen, fragment->ScanBatchesAsync(options_));
+  ASSERT_FINISHES_OK_AND_ASSIGN(batches, CollectAsyncGenerator(batch_gen));
+  ASSERT_EQ(batches.size(), 3);
+}
+
 class TestInMemoryDataset : public DatasetFixtureMixin {};
 
 TEST_F(TestInMemoryDataset, ReplaceSchema) {
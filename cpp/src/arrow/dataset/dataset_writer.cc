@@ -17,16 +17,22 @@
 
 #include "arrow/dataset/dataset_writer.h"
 
+#include <algorithm>
 #include <deque>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/map.h"
@@ -95,17 +101,27 @@ class Throttle {
 
 struct DatasetWriterState {
   DatasetWriterState(uint64_t rows_in_flight, uint64_t max_open_files,
-                     uint64_t max_rows_staged)
+                     uint64_t max_rows_staged, uint64_t bytes_in_flight)
       : rows_in_flight_throttle(rows_in_flight),
+        bytes_in_flight_throttle(bytes_in_flight),
         open_files_throttle(max_open_files),
         staged_rows_count(0),
-        max_rows_staged(max_rows_staged) {}
+        max_rows_staged(max_rows_staged),
+        staged_bytes_count(0),
+        max_bytes_staged(bytes_in_flight / 4) {}
 
   bool StagingFull() const { return staged_rows_count.load() >= max_rows_staged; }
 
+  bool StagedBytesFull() const {
+    return max_bytes_staged > 0 && staged_bytes_count.load() >= max_bytes_staged;
+  }
+
   // Throttle for how many rows the dataset writer will allow to be in process memory
   // When this is exceeded the dataset writer will pause / apply backpressure
   Throttle rows_in_flight_throttle;
+  // Same as rows_in_flight_throttle but for the bytes referenced by the rows, it is
+  // unthrottled unless max_bytes_queued is set
+  Throttle bytes_in_flight_throttle;
   // Control for how many files the dataset writer will open.  When this is exceeded
   // the dataset writer will pause and it will also close the largest open file.
   Throttle open_files_throttle;
@@ -117,10 +133,22 @@ struct DatasetWriterState {
   // are staged than max_rows_queued we will end up with deadlock.  To avoid this, once
   // we have too many staged rows we just ignore min_rows_per_group
   const uint64_t max_rows_staged;
+  // Control for how many bytes the dataset writer will allow to be staged.  Unlike
+  // staged rows, which are unstaged as they are pushed, the partition with the most
+  // staged bytes is unstaged when this is exceeded.
+  std::atomic<uint64_t> staged_bytes_count;
+  const uint64_t max_bytes_staged;
   // Mutex to guard access to the file visitors in the writer options
   std::mutex visitors_mutex;
 };
 
+// The memory held by a batch, only counting the parts of buffers it references
+uint64_t BatchBytes(const RecordBatch& batch) {
+  auto maybe_size = util::ReferencedBufferSize(batch);
+  return static_cast<uint64_t>(maybe_size.ok() ? *maybe_size
+                                               : util::TotalBufferSize(batch));
+}
+
 Result<std::shared_ptr<FileWriter>> OpenWriter(
     const FileSystemDatasetWriteOptions& write_options, std::shared_ptr<Schema> schema,
     const std::string& filename) {
@@ -131,12 +159,76 @@ Result<std::shared_ptr<FileWriter>> OpenWriter(
                                             {write_options.filesystem, filename});
 }
 
+// Compute the position of each row along a Z-order curve of the ranks of the sort keys
+Result<std::shared_ptr<Array>> ZOrderValues(
+    const RecordBatch& batch, const FileSystemDatasetWriteOptions& options) {
+  const int num_keys = static_cast<int>(options.sort_keys.size());
+  // Each key gets an equal share of the 64 bits of the curve position
+  const int bits_per_key = 64 / num_keys;
+  std::vector<std::shared_ptr<UInt64Array>> ranks;
+  std::vector<int> shifts;
+  for (const auto& key : options.sort_keys) {
+    ARROW_ASSIGN_OR_RAISE(auto column, key.target.GetOne(batch));
+    compute::RankOptions rank_options(key.order, options.sort_null_placement,
+                                      compute::RankOptions::Dense);
+    ARROW_ASSIGN_OR_RAISE(Datum rank,
+                          compute::CallFunction("rank", {column}, &rank_options));
+    auto key_ranks = rank.array_as<UInt64Array>();
+    // Drop the low bits of the ranks which don't fit in the share of the key
+    uint64_t max_rank = 0;
+    for (int64_t i = 0; i < key_ranks->length(); ++i) {
+      max_rank = std::max(max_rank, key_ranks->Value(i) - 1);
+    }
+    int rank_bits = 0;
+    while (rank_bits < 64 && (max_rank >> rank_bits) != 0) {
+      ++rank_bits;
+    }
+    shifts.push_back(std::max(0, rank_bits - bits_per_key));
+    ranks.push_back(std::move(key_ranks));
+  }
+
+  UInt64Builder builder;
+  RETURN_NOT_OK(builder.Reserve(batch.num_rows()));
+  for (int64_t row = 0; row < batch.num_rows(); ++row) {
+    uint64_t position = 0;
+    for (int bit = bits_per_key - 1; bit >= 0; --bit) {
+      for (int key = 0; key < num_keys; ++key) {
+        // Dense ranks start at 1
+        uint64_t rank = (ranks[key]->Value(row) - 1) >> shifts[key];
+        position = (position << 1) | ((rank >> bit) & 1);
+      }
+    }
+    builder.UnsafeAppend(position);
+  }
+  return builder.Finish();
+}
+
+// Sort the rows of a file as requested by the write options
+Result<std::shared_ptr<RecordBatch>> SortBatch(
+    const std::shared_ptr<RecordBatch>& batch,
+    const FileSystemDatasetWriteOptions& options) {
+  std::shared_ptr<Array> indices;
+  if (options.sort_z_order && options.sort_keys.size() > 1) {
+    ARROW_ASSIGN_OR_RAISE(auto positions, ZOrderValues(*batch, options));
+    ARROW_ASSIGN_OR_RAISE(indices, compute::SortIndices(*positions));
+  } else {
+    compute::SortOptions sort_options(options.sort_keys, options.sort_null_placement);
+    ARROW_ASSIGN_OR_RAISE(indices, compute::SortIndices(Datum(batch), sort_options));
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum sorted, compute::Take(batch, indices));
+  return sorted.record_batch();
+}
+
 class DatasetWriterFileQueue {
  public:
   explicit DatasetWriterFileQueue(const std::shared_ptr<Schema>& schema,
                                   const FileSystemDatasetWriteOptions& options,
-                                  DatasetWriterState* writer_state)
-      : options_(options), schema_(schema), writer_state_(writer_state) {}
+                                  DatasetWriterState* writer_state,
+                                  WritePartitionMetrics* metrics)
+      : options_(options),
+        schema_(schema),
+        writer_state_(writer_state),
+        metrics_(metrics) {}
 
   void Start(util::AsyncTaskScheduler* file_tasks, const std::string& filename) {
     file_tasks_ = file_tasks;
@@ -182,31 +274,53 @@ class DatasetWriterFileQueue {
     return table->CombineChunksToBatch();
   }
 
-  void ScheduleBatch(std::shared_ptr<RecordBatch> batch) {
+  void ScheduleBatch(std::shared_ptr<RecordBatch> batch, uint64_t bytes) {
     file_tasks_->AddSimpleTask(
-        [self = this, batch = std::move(batch)]() {
-          return self->WriteNext(std::move(batch));
+        [self = this, batch = std::move(batch), bytes]() {
+          return self->WriteNext(std::move(batch), bytes);
         },
         "DatasetWriter::WriteBatch"sv);
   }
 
-  Result<int64_t> PopAndDeliverStagedBatch() {
+  // `early` is true if the batch is delivered because too many rows or bytes are staged
+  Result<int64_t> PopAndDeliverStagedBatch(bool early = false) {
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next_batch, PopStagedBatch());
     int64_t rows_popped = next_batch->num_rows();
+    // Slicing and combining batches doesn't preserve the bytes they reference so the
+    // staged bytes are released in proportion to the rows
+    uint64_t bytes_popped = bytes_currently_staged_;
+    if (static_cast<uint64_t>(rows_popped) < rows_currently_staged_) {
+      bytes_popped = static_cast<uint64_t>(static_cast<double>(bytes_currently_staged_) *
+                                           rows_popped / rows_currently_staged_);
+    }
     rows_currently_staged_ -= next_batch->num_rows();
-    ScheduleBatch(std::move(next_batch));
+    bytes_currently_staged_ -= bytes_popped;
+    writer_state_->staged_bytes_count -= bytes_popped;
+    ++metrics_->num_row_groups;
+    metrics_->num_rows += rows_popped;
+    if (early && static_cast<uint64_t>(rows_popped) < options_.min_rows_per_group) {
+      ++metrics_->num_row_groups_flushed_early;
+    }
+    ScheduleBatch(std::move(next_batch), bytes_popped);
     return rows_popped;
   }
 
   // Stage batches, popping and delivering batches if enough data has arrived
-  Status Push(std::shared_ptr<RecordBatch> batch) {
+  Status Push(std::shared_ptr<RecordBatch> batch, uint64_t bytes) {
     uint64_t delta_staged = batch->num_rows();
     rows_currently_staged_ += delta_staged;
+    bytes_currently_staged_ += bytes;
+    writer_state_->staged_bytes_count += bytes;
+    metrics_->peak_bytes_staged =
+        std::max(metrics_->peak_bytes_staged, bytes_currently_staged_);
     staged_batches_.push_back(std::move(batch));
-    while (!staged_batches_.empty() &&
+    // Sorted files are staged whole, the dataset writer closes them if it holds too
+    // many rows
+    while (options_.sort_keys.empty() && !staged_batches_.empty() &&
            (writer_state_->StagingFull() ||
             rows_currently_staged_ >= options_.min_rows_per_group)) {
-      ARROW_ASSIGN_OR_RAISE(int64_t rows_popped, PopAndDeliverStagedBatch());
+      bool early = rows_currently_staged_ < options_.min_rows_per_group;
+      ARROW_ASSIGN_OR_RAISE(int64_t rows_popped, PopAndDeliverStagedBatch(early));
       delta_staged -= rows_popped;
     }
     // Note, delta_staged may be negative if we were able to deliver some data
@@ -214,8 +328,31 @@ class DatasetWriterFileQueue {
     return Status::OK();
   }
 
+  // Deliver the staged batches even if they don't reach min_rows_per_group
+  Status FlushStaged() {
+    while (!staged_batches_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(int64_t rows_popped,
+                            PopAndDeliverStagedBatch(/*early=*/true));
+      writer_state_->staged_rows_count -= rows_popped;
+    }
+    return Status::OK();
+  }
+
+  uint64_t rows_staged() const { return rows_currently_staged_; }
+  uint64_t bytes_staged() const { return bytes_currently_staged_; }
+
   Status Finish() {
     writer_state_->staged_rows_count -= rows_currently_staged_;
+    if (!options_.sort_keys.empty() && !staged_batches_.empty()) {
+      std::vector<std::shared_ptr<RecordBatch>> batches(
+          std::make_move_iterator(staged_batches_.begin()),
+          std::make_move_iterator(staged_batches_.end()));
+      staged_batches_.clear();
+      ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(batches));
+      ARROW_ASSIGN_OR_RAISE(auto batch, table->CombineChunksToBatch());
+      ARROW_ASSIGN_OR_RAISE(batch, SortBatch(batch, options_));
+      staged_batches_.push_back(std::move(batch));
+    }
     while (!staged_batches_.empty()) {
       RETURN_NOT_OK(PopAndDeliverStagedBatch());
     }
@@ -228,13 +365,14 @@ class DatasetWriterFileQueue {
   }
 
  private:
-  Future<> WriteNext(std::shared_ptr<RecordBatch> next) {
+  Future<> WriteNext(std::shared_ptr<RecordBatch> next, uint64_t bytes) {
     // May want to prototype / measure someday pushing the async write down further
     return DeferNotOk(options_.filesystem->io_context().executor()->Submit(
-        [self = this, batch = std::move(next)]() {
+        [self = this, batch = std::move(next), bytes]() {
           int64_t rows_to_release = batch->num_rows();
           Status status = self->writer_->Write(batch);
           self->writer_state_->rows_in_flight_throttle.Release(rows_to_release);
+          self->writer_state_->bytes_in_flight_throttle.Release(bytes);
           return status;
         }));
   }
@@ -253,11 +391,14 @@ class DatasetWriterFileQueue {
   const FileSystemDatasetWriteOptions& options_;
   const std::shared_ptr<Schema>& schema_;
   DatasetWriterState* writer_state_;
+  // Owned by the directory queue, which outlives its file queues
+  WritePartitionMetrics* metrics_;
   std::shared_ptr<FileWriter> writer_;
   // Batches are accumulated here until they are large enough to write out at which
   // point they are merged together and added to write_queue_
   std::deque<std::shared_ptr<RecordBatch>> staged_batches_;
   uint64_t rows_currently_staged_ = 0;
+  uint64_t bytes_currently_staged_ = 0;
   util::AsyncTaskScheduler* file_tasks_ = nullptr;
 };
 
@@ -277,7 +418,10 @@ class DatasetWriterDirectoryQueue {
         prefix_(std::move(prefix)),
         schema_(std::move(schema)),
         write_options_(write_options),
-        writer_state_(writer_state) {}
+        writer_state_(writer_state) {
+    metrics_.directory = directory_;
+    metrics_.prefix = prefix_;
+  }
 
   Result<std::shared_ptr<RecordBatch>> NextWritableChunk(
       std::shared_ptr<RecordBatch> batch, std::shared_ptr<RecordBatch>* remainder,
@@ -299,13 +443,13 @@ class DatasetWriterDirectoryQueue {
     return to_queue;
   }
 
-  Status StartWrite(const std::shared_ptr<RecordBatch>& batch) {
+  Status StartWrite(const std::shared_ptr<RecordBatch>& batch, uint64_t bytes) {
     rows_written_ += batch->num_rows();
     WriteTask task{current_filename_, static_cast<uint64_t>(batch->num_rows())};
     if (!latest_open_file_) {
       ARROW_RETURN_NOT_OK(OpenFileQueue(current_filename_));
     }
-    return latest_open_file_->Push(batch);
+    return latest_open_file_->Push(batch, bytes);
   }
 
   Result<std::string> GetNextFilename() {
@@ -338,10 +482,38 @@ class DatasetWriterDirectoryQueue {
     return GetNextFilename().Value(&current_filename_);
   }
 
+  // Close the current file before it reaches max_rows_per_file
+  Status CloseFileEarly() {
+    ++metrics_.num_files_closed_early;
+    return FinishCurrentFile();
+  }
+
+  // Write the staged rows of the current file, which closes it if it is sorted
+  Status FlushStaged() {
+    if (!latest_open_file_) {
+      return Status::OK();
+    }
+    if (!write_options_.sort_keys.empty()) {
+      return CloseFileEarly();
+    }
+    return latest_open_file_->FlushStaged();
+  }
+
+  uint64_t rows_staged() const {
+    return latest_open_file_ ? latest_open_file_->rows_staged() : 0;
+  }
+
+  uint64_t bytes_staged() const {
+    return latest_open_file_ ? latest_open_file_->bytes_staged() : 0;
+  }
+
+  const WritePartitionMetrics& metrics() const { return metrics_; }
+
   Status OpenFileQueue(const std::string& filename) {
-    auto file_queue =
-        std::make_unique<DatasetWriterFileQueue>(schema_, write_options_, writer_state_);
+    auto file_queue = std::make_unique<DatasetWriterFileQueue>(
+        schema_, write_options_, writer_state_, &metrics_);
     latest_open_file_ = file_queue.get();
+    ++metrics_.num_files;
     // Create a dedicated throttle for write jobs to this file and keep it alive until we
     // are finished and have closed the file.
     auto file_finish_task = [this, file_queue = std::move(file_queue)] {
@@ -367,8 +539,7 @@ class DatasetWriterDirectoryQueue {
     }
     init_future_ = Future<>::Make();
     auto create_dir_cb = [this] {
-      return DeferNotOk(write_options_.filesystem->io_context().executor()->Submit(
-          [this]() { return write_options_.filesystem->CreateDir(directory_); }));
+      return write_options_.filesystem->CreateDirAsync(directory_);
     };
     // We need to notify waiters whether the directory succeeded or failed.
     auto notify_waiters_cb = [this] { init_future_.MarkFinished(); };
@@ -403,6 +574,12 @@ class DatasetWriterDirectoryQueue {
       const FileSystemDatasetWriteOptions& write_options,
       DatasetWriterState* writer_state, std::shared_ptr<Schema> schema,
       std::string directory, std::string prefix) {
+    if (!write_options.sort_keys.empty()) {
+      schema = SchemaWithFileOrdering(
+          schema,
+          compute::Ordering(write_options.sort_keys, write_options.sort_null_placement),
+          write_options.sort_z_order && write_options.sort_keys.size() > 1);
+    }
     auto dir_queue = std::make_unique<DatasetWriterDirectoryQueue>(
         scheduler, std::move(directory), std::move(prefix), std::move(schema),
         write_options, writer_state);
@@ -428,6 +605,7 @@ class DatasetWriterDirectoryQueue {
   std::shared_ptr<Schema> schema_;
   const FileSystemDatasetWriteOptions& write_options_;
   DatasetWriterState* writer_state_;
+  WritePartitionMetrics metrics_;
   Future<> init_future_;
   std::string current_filename_;
   std::unordered_set<std::string> used_filenames_;
@@ -521,7 +699,8 @@ class DatasetWriter::DatasetWriterImpl {
             })),
         write_options_(std::move(write_options)),
         writer_state_(max_rows_queued, write_options_.max_open_files,
-                      CalculateMaxRowsStaged(max_rows_queued)),
+                      CalculateMaxRowsStaged(max_rows_queued),
+                      write_options_.max_bytes_queued),
         pause_callback_(std::move(pause_callback)),
         resume_callback_(std::move(resume_callback)) {}
 
@@ -584,6 +763,9 @@ class DatasetWriter::DatasetWriterImpl {
         [this]() -> Result<Future<>> {
           for (const auto& directory_queue : directory_queues_) {
             ARROW_RETURN_NOT_OK(directory_queue.second->Finish());
+            if (write_options_.partition_metrics_visitor) {
+              write_options_.partition_metrics_visitor(directory_queue.second->metrics());
+            }
           }
           // This task is purely synchronous but we add it to write_tasks_ for the
           // throttling task group benefits.
@@ -610,7 +792,42 @@ class DatasetWriter::DatasetWriterImpl {
       // GH-38011: If all written files has written 0 rows, we should not close any file
       return Status::OK();
     }
-    return largest->FinishCurrentFile();
+    return largest->CloseFileEarly();
+  }
+
+  // Write early the staged rows of the partitions staging the most until the writer is
+  // back within its limits.  Staged rows beyond max_rows_staged are already written as
+  // they are pushed, except for sorted files which are staged whole.
+  Status RelieveStagingPressure() {
+    const bool sorted = !write_options_.sort_keys.empty();
+    while (writer_state_.StagedBytesFull() || (sorted && writer_state_.StagingFull())) {
+      const bool by_bytes = writer_state_.StagedBytesFull();
+      std::shared_ptr<DatasetWriterDirectoryQueue> largest = nullptr;
+      uint64_t largest_staged = 0;
+      for (auto& dir_queue : directory_queues_) {
+        uint64_t staged = by_bytes ? dir_queue.second->bytes_staged()
+                                   : dir_queue.second->rows_staged();
+        if (staged > largest_staged) {
+          largest_staged = staged;
+          largest = dir_queue.second;
+        }
+      }
+      if (largest == nullptr) {
+        break;
+      }
+      RETURN_NOT_OK(largest->FlushStaged());
+    }
+    return Status::OK();
+  }
+
+  // The bytes accounted for a chunk.  They are capped so that a large chunk fits
+  // in max_bytes_queued along with the staged bytes.
+  uint64_t ChunkBytes(const RecordBatch& chunk) const {
+    uint64_t bytes = BatchBytes(chunk);
+    if (write_options_.max_bytes_queued > 0) {
+      bytes = std::min(bytes, write_options_.max_bytes_queued / 2);
+    }
+    return bytes;
   }
 
   Future<> DoWriteRecordBatch(std::shared_ptr<RecordBatch> batch,
@@ -648,16 +865,24 @@ class DatasetWriter::DatasetWriterImpl {
         EVENT_ON_CURRENT_SPAN("DatasetWriter::Backpressure::TooManyRowsQueued");
         break;
       }
+      uint64_t chunk_bytes = ChunkBytes(*next_chunk);
+      backpressure = writer_state_.bytes_in_flight_throttle.Acquire(chunk_bytes);
+      if (!backpressure.is_finished()) {
+        EVENT_ON_CURRENT_SPAN("DatasetWriter::Backpressure::TooManyBytesQueued");
+        writer_state_.rows_in_flight_throttle.Release(next_chunk->num_rows());
+        break;
+      }
       if (will_open_file) {
         backpressure = writer_state_.open_files_throttle.Acquire(1);
         if (!backpressure.is_finished()) {
           EVENT_ON_CURRENT_SPAN("DatasetWriter::Backpressure::TooManyOpenFiles");
           writer_state_.rows_in_flight_throttle.Release(next_chunk->num_rows());
+          writer_state_.bytes_in_flight_throttle.Release(chunk_bytes);
           RETURN_NOT_OK(TryCloseLargestFile());
           break;
         }
       }
-      auto s = dir_queue->StartWrite(next_chunk);
+      auto s = dir_queue->StartWrite(next_chunk, chunk_bytes);
       if (!s.ok()) {
         // If `StartWrite` succeeded, it will Release the
         // `rows_in_flight_throttle` when the write task is finished.
@@ -665,12 +890,14 @@ class DatasetWriter::DatasetWriterImpl {
         // `open_files_throttle` will be handed by `DatasetWriterDirectoryQueue`
         // so we don't need to release it here.
         writer_state_.rows_in_flight_throttle.Release(next_chunk->num_rows());
+        writer_state_.bytes_in_flight_throttle.Release(chunk_bytes);
         return s;
       }
       batch = std::move(remainder);
       if (batch) {
         RETURN_NOT_OK(dir_queue->FinishCurrentFile());
       }
+      RETURN_NOT_OK(RelieveStagingPressure());
     }
 
     if (batch) {
@@ -18,11 +18,13 @@
 #include "arrow/dataset/dataset_writer.h"
 
 #include <chrono>
+#include <map>
 #include <mutex>
 #include <optional>
 #include <vector>
 
 #include "arrow/array/builder_primitive.h"
+#include "arrow/compute/ordering.h"
 #include "arrow/dataset/file_ipc.h"
 #include "arrow/filesystem/mockfs.h"
 #include "arrow/filesystem/test_util.h"
@@ -31,6 +33,7 @@
 #include "arrow/table.h"
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/config.h"
 #include "gtest/gtest.h"
 
@@ -175,6 +178,14 @@ class DatasetWriterTestFixture : public testing::Test {
     return batch;
   }
 
+  std::shared_ptr<Schema> ReadSchema(std::string_view data) {
+    std::shared_ptr<io::RandomAccessFile> in_stream =
+        std::make_shared<io::BufferReader>(std::make_shared<Buffer>(data));
+    EXPECT_OK_AND_ASSIGN(std::shared_ptr<ipc::RecordBatchFileReader> reader,
+                         ipc::RecordBatchFileReader::Open(in_stream));
+    return reader->schema();
+  }
+
   void AssertFileCreated(const std::optional<MockFileInfo>& maybe_file,
                          const std::string& expected_filename) {
     ASSERT_TRUE(maybe_file.has_value())
@@ -419,6 +430,141 @@ TEST_F(DatasetWriterTestFixture, MinRowGroupBackpressure) {
   AssertCreatedData(expected_files);
 }
 
+TEST_F(DatasetWriterTestFixture, SortedFile) {
+  write_options_.sort_keys = {compute::SortKey("int64", compute::SortOrder::Descending)};
+  write_options_.min_rows_per_group = 100;
+  write_options_.max_rows_per_group = 10;
+  auto dataset_writer = MakeDatasetWriter();
+  dataset_writer->WriteRecordBatch(MakeBatch(15), "");
+  dataset_writer->WriteRecordBatch(MakeBatch(10), "");
+  EndWriterChecked(dataset_writer.get());
+
+  std::optional<MockFileInfo> written_file = FindFile("testdir/chunk-0.arrow");
+  AssertFileCreated(written_file, "testdir/chunk-0.arrow");
+  int num_batches = 0;
+  auto batch = ReadAsBatch(written_file->data, &num_batches);
+  // The rows are sorted as a whole and then split in groups of max_rows_per_group
+  ASSERT_EQ(3, num_batches);
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[24, 23, 22, 21, 20, 19, 18, 17, 16, 15, "
+                                            "14, 13, 12, 11, 10, 9, 8, 7, 6, 5, "
+                                            "4, 3, 2, 1, 0]"),
+                    *batch->column(0));
+
+  ASSERT_OK_AND_ASSIGN(auto ordering, GetFileOrdering(*ReadSchema(written_file->data)));
+  ASSERT_EQ(compute::Ordering({compute::SortKey("int64", compute::SortOrder::Descending)},
+                              compute::NullPlacement::AtEnd),
+            ordering);
+}
+
+TEST_F(DatasetWriterTestFixture, SortedFileStagingLimit) {
+  // Sorted files are closed early when the writer holds too many rows, here 10
+  write_options_.sort_keys = {compute::SortKey("int64", compute::SortOrder::Descending)};
+  auto dataset_writer = MakeDatasetWriter(40);
+  for (int i = 0; i < 4; i++) {
+    dataset_writer->WriteRecordBatch(MakeBatch(5), "");
+  }
+  EndWriterChecked(dataset_writer.get());
+
+  for (const auto& [filename, expected] :
+       std::vector<std::pair<std::string, std::string>>{
+           {"testdir/chunk-0.arrow", "[9, 8, 7, 6, 5, 4, 3, 2, 1, 0]"},
+           {"testdir/chunk-1.arrow", "[19, 18, 17, 16, 15, 14, 13, 12, 11, 10]"}}) {
+    std::optional<MockFileInfo> written_file = FindFile(filename);
+    AssertFileCreated(written_file, filename);
+    int num_batches = 0;
+    AssertArraysEqual(*ArrayFromJSON(int64(), expected),
+                      *ReadAsBatch(written_file->data, &num_batches)->column(0));
+  }
+}
+
+TEST_F(DatasetWriterTestFixture, ZOrderedFile) {
+  write_options_.sort_keys = {compute::SortKey("x"), compute::SortKey("y")};
+  write_options_.sort_z_order = true;
+  write_options_.max_rows_per_group = 4;
+  auto dataset_writer = MakeDatasetWriter();
+  auto grid_schema = schema({field("x", int32()), field("y", int32())});
+  dataset_writer->WriteRecordBatch(
+      RecordBatchFromJSON(grid_schema, R"([[3, 3], [0, 0], [2, 1], [1, 2], [0, 3],
+                                           [3, 0], [1, 1], [2, 2], [0, 1], [3, 2],
+                                           [1, 0], [2, 3], [0, 2], [1, 3], [2, 0],
+                                           [3, 1]])"),
+      "");
+  EndWriterChecked(dataset_writer.get());
+
+  std::optional<MockFileInfo> written_file = FindFile("testdir/chunk-0.arrow");
+  AssertFileCreated(written_file, "testdir/chunk-0.arrow");
+  int num_batches = 0;
+  auto batch = ReadAsBatch(written_file->data, &num_batches);
+  // Each row group holds a quadrant of the grid
+  ASSERT_EQ(4, num_batches);
+  AssertBatchesEqual(
+      *RecordBatchFromJSON(grid_schema, R"([[0, 0], [0, 1], [1, 0], [1, 1],
+                                            [0, 2], [0, 3], [1, 2], [1, 3],
+                                            [2, 0], [2, 1], [3, 0], [3, 1],
+                                            [2, 2], [2, 3], [3, 2], [3, 3]])"),
+      *batch);
+
+  // A Z-order is not an order of any column
+  ASSERT_OK_AND_ASSIGN(auto ordering, GetFileOrdering(*ReadSchema(written_file->data)));
+  ASSERT_TRUE(ordering.is_unordered());
+}
+
+TEST_F(DatasetWriterTestFixture, PartitionMetrics) {
+  write_options_.min_rows_per_group = 15;
+  write_options_.max_rows_per_group = 15;
+  std::map<std::string, WritePartitionMetrics> metrics;
+  write_options_.partition_metrics_visitor = [&](const WritePartitionMetrics& m) {
+    metrics[m.directory] = m;
+  };
+  auto dataset_writer = MakeDatasetWriter();
+  dataset_writer->WriteRecordBatch(MakeBatch(10), "a");
+  dataset_writer->WriteRecordBatch(MakeBatch(10), "a");
+  dataset_writer->WriteRecordBatch(MakeBatch(5), "b");
+  EndWriterChecked(dataset_writer.get());
+
+  ASSERT_EQ(2, metrics.size());
+  const auto& a = metrics["testdir/a"];
+  ASSERT_EQ(1, a.num_files);
+  ASSERT_EQ(0, a.num_files_closed_early);
+  ASSERT_EQ(20, a.num_rows);
+  ASSERT_EQ(2, a.num_row_groups);
+  ASSERT_EQ(0, a.num_row_groups_flushed_early);
+  const auto& b = metrics["testdir/b"];
+  ASSERT_EQ(1, b.num_files);
+  ASSERT_EQ(5, b.num_rows);
+  ASSERT_EQ(1, b.num_row_groups);
+  ASSERT_EQ(0, b.num_row_groups_flushed_early);
+  ASSERT_GT(a.peak_bytes_staged, b.peak_bytes_staged);
+  ASSERT_GT(b.peak_bytes_staged, 0);
+}
+
+TEST_F(DatasetWriterTestFixture, MaxBytesStaged) {
+  // Once a quarter of max_bytes_queued is staged the partition staging the most bytes
+  // is written even though it doesn't have min_rows_per_group rows
+  write_options_.min_rows_per_group = 100;
+  ASSERT_OK_AND_ASSIGN(int64_t batch_bytes,
+                       util::ReferencedBufferSize(*MakeBatch(0, 25)));
+  write_options_.max_bytes_queued = 4 * batch_bytes;
+  std::map<std::string, WritePartitionMetrics> metrics;
+  write_options_.partition_metrics_visitor = [&](const WritePartitionMetrics& m) {
+    metrics[m.directory] = m;
+  };
+  auto dataset_writer = MakeDatasetWriter();
+  dataset_writer->WriteRecordBatch(MakeBatch(10), "a");
+  dataset_writer->WriteRecordBatch(MakeBatch(10), "b");
+  dataset_writer->WriteRecordBatch(MakeBatch(10), "a");
+  EndWriterChecked(dataset_writer.get());
+
+  const auto& a = metrics["testdir/a"];
+  ASSERT_EQ(20, a.num_rows);
+  ASSERT_EQ(1, a.num_row_groups);
+  ASSERT_EQ(1, a.num_row_groups_flushed_early);
+  const auto& b = metrics["testdir/b"];
+  ASSERT_EQ(10, b.num_rows);
+  ASSERT_EQ(1, b.num_row_groups);
+  ASSERT_EQ(0, b.num_row_groups_flushed_early);
+}
+
 TEST_F(DatasetWriterTestFixture, ConcurrentWritesSameFile) {
 #ifndef ARROW_ENABLE_THREADING
   GTEST_SKIP() << "Concurrent writes tests need threads";
@@ -20,21 +20,27 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/file_base.h"
+#include "arrow/dataset/manifest.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/record_batch.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::StartsWith;
 
 namespace dataset {
@@ -180,35 +186,45 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
   }
 
   ARROW_ASSIGN_OR_RAISE(selector.base_dir, filesystem->NormalizePath(selector.base_dir));
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
 
-  // Filter out anything that's not a file or that's explicitly ignored
-  Status st;
-  auto files_end =
-      std::remove_if(files.begin(), files.end(), [&](const fs::FileInfo& info) {
-        if (!info.IsFile()) return true;
-
-        auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
-        if (!relative.has_value()) {
-          st = Status::Invalid("GetFileInfo() yielded path '", info.path(),
+  // Filter out anything that's not a file or that's explicitly ignored, and start
+  // prefetching the metadata of the files as their listing arrives
+  std::vector<fs::FileInfo> files;
+  std::unordered_map<std::string, Future<>> metadata_prefetches;
+  auto visit_files = [&](const fs::FileInfoVector& infos) -> Status {
+    for (const auto& info : infos) {
+      if (!info.IsFile()) continue;
+
+      auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
+      if (!relative.has_value()) {
+        return Status::Invalid("GetFileInfo() yielded path '", info.path(),
                                "', which is outside base dir '", selector.base_dir, "'");
-          return false;
-        }
+      }
 
-        if (StartsWithAnyOf(std::string(*relative), options.selector_ignore_prefixes)) {
-          return true;
-        }
+      if (StartsWithAnyOf(std::string(*relative), options.selector_ignore_prefixes)) {
+        continue;
+      }
 
-        return false;
-      });
-  RETURN_NOT_OK(st);
-  files.erase(files_end, files.end());
+      if (options.prefetch_metadata) {
+        metadata_prefetches.emplace(info.path(),
+                                    format->PrefetchMetadata({info, filesystem}));
+      }
+      files.push_back(info);
+    }
+    return Status::OK();
+  };
+  RETURN_NOT_OK(
+      VisitAsyncGenerator(filesystem->GetFileInfoGenerator(selector), visit_files)
+          .status());
 
   // Sorting by path guarantees a stability sometimes needed by unit tests.
   std::sort(files.begin(), files.end(), fs::FileInfo::ByPath());
 
-  return Make(std::move(filesystem), std::move(files), std::move(format),
-              std::move(options));
+  ARROW_ASSIGN_OR_RAISE(auto factory, Make(std::move(filesystem), std::move(files),
+                                           std::move(format), std::move(options)));
+  checked_cast<FileSystemDatasetFactory&>(*factory).metadata_prefetches_ =
+      std::move(metadata_prefetches);
+  return factory;
 }
 
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
@@ -233,21 +249,66 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
       {file_info}, std::move(filesystem), std::move(format), std::move(options)));
 }
 
+Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
+    std::shared_ptr<fs::FileSystem> filesystem, DatasetManifest manifest,
+    std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
+  std::vector<fs::FileInfo> files;
+  files.reserve(manifest.files.size());
+  for (const auto& file : manifest.files) {
+    files.push_back(file.info);
+  }
+  auto factory = std::shared_ptr<FileSystemDatasetFactory>(
+      new FileSystemDatasetFactory(std::move(files), std::move(filesystem),
+                                   std::move(format), std::move(options)));
+  factory->manifest_ = std::make_shared<DatasetManifest>(std::move(manifest));
+  return factory;
+}
+
 Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSchemas(
     InspectOptions options) {
-  std::vector<std::shared_ptr<Schema>> schemas;
+  if (manifest_ != nullptr) {
+    return std::vector<std::shared_ptr<Schema>>{manifest_->schema};
+  }
 
-  const bool has_fragments_limit = options.fragments >= 0;
-  int fragments = options.fragments;
-  for (const auto& info : files_) {
-    if (has_fragments_limit && fragments-- == 0) break;
+  size_t num_inspected = files_.size();
+  if (options.fragments >= 0) {
+    num_inspected = std::min(num_inspected, static_cast<size_t>(options.fragments));
+  }
+
+  auto inspect = [this](const fs::FileInfo& info) -> Result<std::shared_ptr<Schema>> {
+    auto prefetch = metadata_prefetches_.find(info.path());
+    if (prefetch != metadata_prefetches_.end()) {
+      // The prefetch is speculative, Inspect reports any error reading the file
+      prefetch->second.Wait();
+    }
     auto result = format_->Inspect({info, fs_});
     if (ARROW_PREDICT_FALSE(!result.ok())) {
       return result.status().WithMessage(
           "Error creating dataset. Could not read schema from '", info.path(),
           "'. Is this a '", format_->type_name(), "' file?: ", result.status().message());
     }
-    schemas.push_back(result.MoveValueUnsafe());
+    return result;
+  };
+
+  std::vector<std::shared_ptr<Schema>> schemas;
+  if (options_.inspect_parallelism > 1 && num_inspected > 1) {
+    // Inspect up to inspect_parallelism files at a time, keeping the file order
+    auto* executor = ::arrow::internal::GetCpuThreadPool();
+    auto inspected_files = MakeVectorGenerator(std::vector<fs::FileInfo>(
+        files_.begin(), files_.begin() + static_cast<ptrdiff_t>(num_inspected)));
+    auto inspect_async = [executor, inspect](const fs::FileInfo& info) {
+      return DeferNotOk(executor->Submit(inspect, info));
+    };
+    auto inspected_schemas = MakeReadaheadGenerator(
+        MakeMappedGenerator(std::move(inspected_files), std::move(inspect_async)),
+        options_.inspect_parallelism);
+    ARROW_ASSIGN_OR_RAISE(schemas,
+                          CollectAsyncGenerator(std::move(inspected_schemas)).result());
+  } else {
+    for (size_t i = 0; i < num_inspected; ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto schema, inspect(files_[i]));
+      schemas.push_back(std::move(schema));
+    }
   }
 
   ARROW_ASSIGN_OR_RAISE(auto partition_schema,
@@ -275,6 +336,14 @@ Result<std::shared_ptr<Dataset>> FileSystemDatasetFactory::Finish(FinishOptions
   }
 
   std::shared_ptr<Partitioning> partitioning = options_.partitioning.partitioning();
+  if (manifest_ != nullptr) {
+    if (partitioning == nullptr) {
+      partitioning = Partitioning::Default();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto fragments, manifest_->MakeFragments(fs_, format_));
+    return FileSystemDataset::Make(std::move(schema), root_partition_, format_, fs_,
+                                   std::move(fragments), std::move(partitioning));
+  }
   if (partitioning == nullptr) {
     auto factory = options_.partitioning.factory();
     ARROW_ASSIGN_OR_RAISE(partitioning, factory->Finish(schema));
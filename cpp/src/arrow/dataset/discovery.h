@@ -25,6 +25,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
@@ -33,6 +34,7 @@
 #include "arrow/dataset/visibility.h"
 #include "arrow/filesystem/type_fwd.h"
 #include "arrow/result.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
 
 namespace arrow {
@@ -196,6 +198,26 @@ struct FileSystemFactoryOptions {
       ".",
       "_",
   };
+
+  /// The maximum number of files whose schema is inspected concurrently, see
+  /// InspectOptions::fragments.
+  ///
+  /// Files are inspected on the CPU thread pool, which hides the latency of
+  /// remote file systems when several fragments are inspected.  A value of 1
+  /// inspects them one after the other on the calling thread.
+  int inspect_parallelism = kDefaultInspectParallelism;
+
+  /// When discovering from a Selector, start reading the metadata of each file
+  /// as soon as it is listed, e.g. the footer at the tail of a Parquet file.
+  ///
+  /// The reads are speculative: they are not waited for, except by the schema
+  /// inspection of the same file, and their errors are ignored.  Only formats
+  /// which cache file metadata take advantage of it, e.g. ParquetFileFormat when
+  /// its default ParquetFragmentScanOptions have a metadata_cache, which then
+  /// serves the inspection and the scans of the dataset.
+  bool prefetch_metadata = false;
+
+  static constexpr int kDefaultInspectParallelism = 8;
 };
 
 /// \brief FileSystemDatasetFactory creates a Dataset from a vector of
@@ -217,8 +239,9 @@ class ARROW_DS_EXPORT FileSystemDatasetFactory : public DatasetFactory {
   /// \brief Build a FileSystemDatasetFactory from a fs::FileSelector.
   ///
   /// The selector will expand to a vector of FileInfo. The expansion/crawling
-  /// is performed in this function call. Thus, the finalized Dataset is
-  /// working with a snapshot of the filesystem.
+  /// is performed in this function call, consuming the listing of
+  /// fs::FileSystem::GetFileInfoGenerator as it arrives. Thus, the finalized
+  /// Dataset is working with a snapshot of the filesystem.
   //
   /// If options.partition_base_dir is not provided, it will be overwritten
   /// with selector.base_dir.
@@ -252,6 +275,21 @@ class ARROW_DS_EXPORT FileSystemDatasetFactory : public DatasetFactory {
       std::shared_ptr<fs::FileSystem> filesystem, const std::vector<fs::FileInfo>& files,
       std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options);
 
+  /// \brief Build a FileSystemDatasetFactory from a DatasetManifest.
+  ///
+  /// Neither the file system is listed nor the files inspected: the schema is the
+  /// one of the manifest, and the fragments are made with the partition expressions
+  /// and statistics recorded in the manifest.  The partitioning of the dataset is
+  /// options.partitioning if it's an explicit Partitioning, the default one otherwise.
+  ///
+  /// \param[in] filesystem passed to FileSystemDataset
+  /// \param[in] manifest the files and schema of the dataset
+  /// \param[in] format passed to FileSystemDataset
+  /// \param[in] options see FileSystemFactoryOptions for more information.
+  static Result<std::shared_ptr<DatasetFactory>> Make(
+      std::shared_ptr<fs::FileSystem> filesystem, DatasetManifest manifest,
+      std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options);
+
   Result<std::vector<std::shared_ptr<Schema>>> InspectSchemas(
       InspectOptions options) override;
 
@@ -269,6 +307,10 @@ class ARROW_DS_EXPORT FileSystemDatasetFactory : public DatasetFactory {
   std::shared_ptr<fs::FileSystem> fs_;
   std::shared_ptr<FileFormat> format_;
   FileSystemFactoryOptions options_;
+  // Metadata reads started while listing, by file path (see prefetch_metadata)
+  std::unordered_map<std::string, Future<>> metadata_prefetches_;
+  // The manifest the factory was made from, if any
+  std::shared_ptr<DatasetManifest> manifest_;
 };
 
 }  // namespace dataset
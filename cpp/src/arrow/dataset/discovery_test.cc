@@ -364,6 +364,27 @@ TEST_F(FileSystemDatasetFactoryTest, InspectFragmentsLimit) {
   }
 }
 
+TEST_F(FileSystemDatasetFactoryTest, InspectInParallel) {
+  auto s = schema({field("f64", float64())});
+  format_ = std::make_shared<DummyFileFormat>(s);
+
+  std::vector<fs::FileInfo> files;
+  for (int i = 0; i < 20; ++i) {
+    files.push_back(fs::File("file" + std::to_string(i)));
+  }
+  InspectOptions options;
+  options.fragments = InspectOptions::kInspectAllFragments;
+  for (int parallelism : {1, 3, 8, 64}) {
+    ARROW_SCOPED_TRACE("inspect_parallelism = ", parallelism);
+    factory_options_.inspect_parallelism = parallelism;
+    factory_options_.prefetch_metadata = parallelism > 8;
+    MakeFactory(files);
+    ASSERT_OK_AND_ASSIGN(auto schemas, factory_->InspectSchemas(options));
+    EXPECT_THAT(schemas, SizeIs(files.size() + 1));
+    AssertInspect(s, options);
+  }
+}
+
 TEST_F(FileSystemDatasetFactoryTest, FilenameNotPartOfPartitions) {
   // ARROW-8726: Ensure filename is not a partition.
 
@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <memory>
 #include <unordered_map>
 #include <variant>
@@ -30,6 +31,7 @@
 #include "arrow/acero/query_context.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/dataset_writer.h"
 #include "arrow/dataset/forest_internal.h"
@@ -41,9 +43,12 @@
 #include "arrow/io/compressed.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/scalar.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/key_value_metadata.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/map.h"
 #include "arrow/util/string.h"
@@ -148,6 +153,15 @@ Future<std::optional<int64_t>> FileFormat::CountRows(
   return Future<std::optional<int64_t>>::MakeFinished(std::nullopt);
 }
 
+Result<compute::Expression> FileFormat::GetStatisticsExpression(
+    const FileSource& source) const {
+  return compute::literal(true);
+}
+
+Future<> FileFormat::PrefetchMetadata(const FileSource& source) const {
+  return Future<>::MakeFinished();
+}
+
 Future<std::shared_ptr<InspectedFragment>> FileFormat::InspectFragment(
     const FileSource& source, const FragmentScanOptions* format_options,
     compute::ExecContext* exec_context) const {
@@ -179,6 +193,72 @@ Result<std::shared_ptr<FileFragment>> FileFormat::MakeFragment(
                        std::move(partition_expression), std::move(physical_schema)));
 }
 
+Result<compute::Expression> FileFragment::GetStatisticsExpression() {
+  return format_->GetStatisticsExpression(source_);
+}
+
+namespace {
+
+bool IsNan(const Scalar& value) {
+  if (value.type->id() == Type::DOUBLE) {
+    return std::isnan(checked_cast<const DoubleScalar&>(value).value);
+  }
+  if (value.type->id() == Type::FLOAT) {
+    return std::isnan(checked_cast<const FloatScalar&>(value).value);
+  }
+  return false;
+}
+
+// Convert a minimum or maximum value to a scalar of the type of the column
+Result<std::shared_ptr<Scalar>> StatisticsValueAsScalar(
+    const ArrayStatistics::ValueType& value, const std::shared_ptr<DataType>& type) {
+  auto scalar = std::visit(
+      [](const auto& v) -> std::shared_ptr<Scalar> { return MakeScalar(v); }, value);
+  ARROW_ASSIGN_OR_RAISE(auto casted, compute::Cast(scalar, type));
+  return casted.scalar();
+}
+
+}  // namespace
+
+std::optional<compute::Expression> StatisticsAsExpression(
+    const Field& field, const ArrayStatistics& statistics) {
+  if (!statistics.min.has_value() || !statistics.max.has_value() ||
+      !statistics.is_min_exact || !statistics.is_max_exact) {
+    return std::nullopt;
+  }
+  // Failure to convert the statistics is ignored, the column is just not bounded
+  auto maybe_min = StatisticsValueAsScalar(*statistics.min, field.type());
+  auto maybe_max = StatisticsValueAsScalar(*statistics.max, field.type());
+  if (!maybe_min.ok() || !maybe_max.ok()) {
+    return std::nullopt;
+  }
+  auto min = maybe_min.MoveValueUnsafe();
+  auto max = maybe_max.MoveValueUnsafe();
+  if (IsNan(*min) || IsNan(*max)) {
+    return std::nullopt;
+  }
+
+  auto field_expr = compute::field_ref(field.name());
+  std::vector<compute::Expression> bounds;
+  if (min->Equals(*max)) {
+    bounds.push_back(compute::equal(field_expr, compute::literal(std::move(min))));
+  } else {
+    bounds.push_back(
+        compute::greater_equal(field_expr, compute::literal(std::move(min))));
+    bounds.push_back(compute::less_equal(field_expr, compute::literal(std::move(max))));
+  }
+  const bool may_have_null =
+      !statistics.null_count.has_value() || *statistics.null_count > 0;
+  if (may_have_null) {
+    // Each bound is disjuncted with is_null rather than the whole range, since
+    // SimplifyWithGuarantee only recognizes "comparison or is_null" guarantees
+    for (auto& bound : bounds) {
+      bound = compute::or_(std::move(bound), compute::is_null(field_expr));
+    }
+  }
+  return compute::and_(std::move(bounds));
+}
+
 Result<std::shared_ptr<Schema>> FileFragment::ReadPhysicalSchemaImpl() {
   return format_->Inspect(source_);
 }
@@ -370,6 +450,68 @@ Result<int64_t> FileWriter::GetBytesWritten() const {
 
 namespace {
 
+constexpr char kFileOrderingKey[] = "arrow.dataset.ordering";
+
+}  // namespace
+
+std::shared_ptr<Schema> SchemaWithFileOrdering(const std::shared_ptr<Schema>& schema,
+                                               const compute::Ordering& ordering,
+                                               bool z_order) {
+  // One line for the kind of order, then one line per sort key
+  std::string value = z_order ? "z_order" : "lexicographic";
+  value += ordering.null_placement() == compute::NullPlacement::AtStart ? " nulls_first"
+                                                                        : " nulls_last";
+  for (const auto& key : ordering.sort_keys()) {
+    value += key.order == compute::SortOrder::Ascending ? "\nascending "
+                                                        : "\ndescending ";
+    value += key.target.ToDotPath();
+  }
+  auto metadata = schema->metadata() ? schema->metadata()->Copy()
+                                     : std::make_shared<KeyValueMetadata>();
+  ARROW_CHECK_OK(metadata->Set(kFileOrderingKey, std::move(value)));
+  return schema->WithMetadata(std::move(metadata));
+}
+
+Result<compute::Ordering> GetFileOrdering(const Schema& physical_schema) {
+  const auto& metadata = physical_schema.metadata();
+  if (metadata == nullptr || !metadata->Contains(kFileOrderingKey)) {
+    return compute::Ordering::Unordered();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto value, metadata->Get(kFileOrderingKey));
+  auto lines = ::arrow::internal::SplitString(value, '\n');
+  auto invalid = [&] { return Status::Invalid("Invalid file ordering: '", value, "'"); };
+
+  auto kind = ::arrow::internal::SplitString(lines[0], ' ');
+  if (kind.size() != 2 || (kind[0] != "z_order" && kind[0] != "lexicographic") ||
+      (kind[1] != "nulls_first" && kind[1] != "nulls_last")) {
+    return invalid();
+  }
+  std::vector<compute::SortKey> sort_keys;
+  for (size_t i = 1; i < lines.size(); ++i) {
+    auto separator = lines[i].find(' ');
+    if (separator == std::string_view::npos) {
+      return invalid();
+    }
+    auto order = lines[i].substr(0, separator);
+    if (order != "ascending" && order != "descending") {
+      return invalid();
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto target, FieldRef::FromDotPath(std::string(lines[i].substr(separator + 1))));
+    sort_keys.emplace_back(std::move(target), order == "ascending"
+                                                  ? compute::SortOrder::Ascending
+                                                  : compute::SortOrder::Descending);
+  }
+  if (kind[0] == "z_order") {
+    return compute::Ordering::Unordered();
+  }
+  return compute::Ordering(std::move(sort_keys), kind[1] == "nulls_first"
+                                                     ? compute::NullPlacement::AtStart
+                                                     : compute::NullPlacement::AtEnd);
+}
+
+namespace {
+
 Status WriteBatch(
     std::shared_ptr<RecordBatch> batch, compute::Expression guarantee,
     FileSystemDatasetWriteOptions write_options,
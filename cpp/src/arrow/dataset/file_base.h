@@ -21,11 +21,14 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/statistics.h"
 #include "arrow/buffer.h"
+#include "arrow/compute/ordering.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/scanner.h"
@@ -107,6 +110,10 @@ class ARROW_DS_EXPORT FileSource : public util::EqualityComparable<FileSource> {
     return filesystem_ ? file_info_.path() : buffer_ ? buffer_path : custom_open_path;
   }
 
+  /// \brief Return the file information, if any. Only valid when file source wraps a
+  /// path.  The size and modification time may be unknown.
+  const fs::FileInfo& file_info() const { return file_info_; }
+
   /// \brief Return the filesystem, if any. Otherwise returns nullptr
   const std::shared_ptr<fs::FileSystem>& filesystem() const { return filesystem_; }
 
@@ -164,6 +171,20 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
   /// \brief Return the schema of the file if possible.
   virtual Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const = 0;
 
+  /// \brief Return an expression which is true for every row of the file, derived
+  /// from the statistics recorded in the file
+  ///
+  /// The default implementation returns literal(true).
+  /// \see FileFragment::GetStatisticsExpression
+  virtual Result<compute::Expression> GetStatisticsExpression(
+      const FileSource& source) const;
+
+  /// \brief Start reading the metadata of the file into a cache, if the format has one
+  ///
+  /// This lets discovery fetch the metadata of many files concurrently, ahead of
+  /// Inspect and of the scans.  The default implementation does nothing.
+  virtual Future<> PrefetchMetadata(const FileSource& source) const;
+
   /// \brief Learn what we need about the file before we start scanning it
   virtual Future<std::shared_ptr<InspectedFragment>> InspectFragment(
       const FileSource& source, const FragmentScanOptions* format_options,
@@ -212,6 +233,19 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
       : default_fragment_scan_options(std::move(default_fragment_scan_options)) {}
 };
 
+/// \brief Convert the statistics of a column to an expression which is true for each
+/// of its values, or return nullopt if the statistics don't bound the values
+///
+/// This is the common ground of the formats which record statistics for their files
+/// or for the parts of the files they read at once (record batches of IPC files,
+/// stripes of ORC files).  Only exact minimum and maximum values are used, and null
+/// values are allowed unless the statistics have a null count of zero.
+///
+/// \param[in] field the field of the column in the physical schema of the file
+/// \param[in] statistics the statistics of the column
+ARROW_DS_EXPORT std::optional<compute::Expression> StatisticsAsExpression(
+    const Field& field, const ArrayStatistics& statistics);
+
 /// \brief A Fragment that is stored in a file with a known format
 class ARROW_DS_EXPORT FileFragment : public Fragment,
                                      public util::EqualityComparable<FileFragment> {
@@ -235,6 +269,14 @@ class ARROW_DS_EXPORT FileFragment : public Fragment,
   const FileSource& source() const { return source_; }
   const std::shared_ptr<FileFormat>& format() const { return format_; }
 
+  /// \brief Return an expression which is true for every row of the file, derived
+  /// from the statistics recorded in the file
+  ///
+  /// The expression bounds the values of the columns of the whole file, regardless
+  /// of the partition expression.  This may read the metadata of the file.  The
+  /// default implementation defers to FileFormat::GetStatisticsExpression.
+  virtual Result<compute::Expression> GetStatisticsExpression();
+
   bool Equals(const FileFragment& other) const;
 
  protected:
@@ -385,6 +427,33 @@ class ARROW_DS_EXPORT FileWriter {
   std::optional<int64_t> bytes_written_;
 };
 
+/// \brief What the dataset writer did for one partition of a dataset
+///
+/// A partition is a directory and a basename prefix into which the dataset writer
+/// writes files.  These help tune `max_open_files`, `min_rows_per_group` and
+/// `max_bytes_queued` for a dataset: many files closed early hint that too few files
+/// may be open, many row groups flushed early that too many rows or bytes are staged.
+struct ARROW_DS_EXPORT WritePartitionMetrics {
+  /// The directory of the files of the partition
+  std::string directory;
+  /// The prefix of the basenames of the files of the partition
+  std::string prefix;
+  /// The number of files written
+  uint64_t num_files = 0;
+  /// The number of files closed before `max_rows_per_file` was reached, to respect
+  /// `max_open_files` or, for sorted files, the limits on staged rows or bytes
+  uint64_t num_files_closed_early = 0;
+  /// The number of rows written
+  uint64_t num_rows = 0;
+  /// The number of row groups written
+  uint64_t num_row_groups = 0;
+  /// The number of row groups written with fewer than `min_rows_per_group` rows because
+  /// the dataset writer staged too many rows or bytes
+  uint64_t num_row_groups_flushed_early = 0;
+  /// The largest number of bytes staged for the partition at once
+  uint64_t peak_bytes_staged = 0;
+};
+
 /// \brief Options for writing a dataset.
 struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
   /// Options for individual fragment writing.
@@ -438,6 +507,32 @@ struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
   /// group size is just barely larger than this value).
   uint64_t max_rows_per_group = 1 << 20;
 
+  /// If greater than 0 then this will limit how many bytes of data the dataset writer
+  /// holds, as measured by the buffers referenced by its batches.  When exceeded the
+  /// dataset writer will apply backpressure.  Staged rows (see `min_rows_per_group`) may
+  /// take up to a quarter of this, beyond which the rows staged for the partition with
+  /// the most staged bytes are written early.
+  uint64_t max_bytes_queued = 0;
+
+  /// If not empty then the rows of each file are sorted by these keys before they are
+  /// written, so that the row groups of a file cover narrow ranges of the keys and
+  /// scans can skip them using their statistics.  The order is recorded in the schema
+  /// metadata of the file (see GetFileOrdering).
+  ///
+  /// The rows of a file are held in memory until the file is closed, which ignores
+  /// `min_rows_per_group`.  Setting `max_rows_per_file` bounds that memory; besides,
+  /// when the dataset writer holds too many rows the largest open file is closed.
+  std::vector<compute::SortKey> sort_keys;
+
+  /// Whether nulls are placed before or after the other values when sorting.
+  compute::NullPlacement sort_null_placement = compute::NullPlacement::AtEnd;
+
+  /// If true then the rows are arranged along a Z-order curve of the ranks of the sort
+  /// keys instead of being sorted lexicographically.  Every key, rather than mostly
+  /// the first one, then gets narrow ranges in each row group, but the file is not
+  /// sorted by any of them.
+  bool sort_z_order = false;
+
   /// Controls what happens if an output directory already exists.
   ExistingDataBehavior existing_data_behavior = ExistingDataBehavior::kError;
 
@@ -457,11 +552,35 @@ struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
     return Status::OK();
   };
 
+  /// Callback to be invoked with the metrics of each partition once the dataset writer
+  /// has finished.
+  std::function<void(const WritePartitionMetrics&)> partition_metrics_visitor;
+
   const std::shared_ptr<FileFormat>& format() const {
     return file_write_options->format();
   }
 };
 
+/// \brief Record the order of the rows of a file in the metadata of its schema
+///
+/// \param[in] schema the schema of the file
+/// \param[in] ordering the sort keys and null placement of the rows
+/// \param[in] z_order whether the rows are arranged along a Z-order curve of the sort
+/// keys rather than sorted lexicographically
+ARROW_DS_EXPORT std::shared_ptr<Schema> SchemaWithFileOrdering(
+    const std::shared_ptr<Schema>& schema, const compute::Ordering& ordering,
+    bool z_order = false);
+
+/// \brief Get the order of the rows of a file recorded by SchemaWithFileOrdering
+///
+/// Files written with FileSystemDatasetWriteOptions::sort_keys record their order so
+/// that consumers, such as SortedMergeNode, can rely on it.  The unordered ordering is
+/// returned if the schema records no order or if the rows are arranged along a Z-order
+/// curve, which is not an order by any column.
+///
+/// \param[in] physical_schema the physical schema of the file
+ARROW_DS_EXPORT Result<compute::Ordering> GetFileOrdering(const Schema& physical_schema);
+
 /// \brief Wraps FileSystemDatasetWriteOptions for consumption as compute::ExecNodeOptions
 class ARROW_DS_EXPORT WriteNodeOptions : public acero::ExecNodeOptions {
  public:
@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -27,9 +29,11 @@
 #include "arrow/dataset/scanner.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/tracing_internal.h"
 
 namespace arrow {
@@ -124,6 +128,22 @@ static inline Result<ipc::IpcReadOptions> GetReadOptions(
   return options;
 }
 
+// Return the record batches which may hold rows matching the filter of a scan,
+// according to the statistics of the row index of the file
+static inline Result<std::vector<int>> SelectRecordBatches(
+    ipc::RecordBatchFileReader* reader, const ScanOptions& scan_options) {
+  if (!ExpressionHasFieldRefs(scan_options.filter)) {
+    std::vector<int> all_batches(reader->num_record_batches());
+    std::iota(all_batches.begin(), all_batches.end(), 0);
+    return all_batches;
+  }
+  return SelectPartsWithStatistics(
+      scan_options.filter, *reader->schema(), reader->num_record_batches(),
+      [reader](int field_index) {
+        return reader->GetRecordBatchStatistics(field_index);
+      });
+}
+
 IpcFileFormat::IpcFileFormat() : FileFormat(std::make_shared<IpcFragmentScanOptions>()) {}
 
 Result<bool> IpcFileFormat::IsSupported(const FileSource& source) const {
@@ -139,26 +159,50 @@ Result<std::shared_ptr<Schema>> IpcFileFormat::Inspect(const FileSource& source)
 Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options,
     const std::shared_ptr<FileFragment>& file) const {
+  using ReaderAndBatches =
+      std::pair<std::shared_ptr<ipc::RecordBatchFileReader>, std::vector<int>>;
   auto self = shared_from_this();
   auto source = file->source();
   auto open_reader = OpenReaderAsync(source);
   auto reopen_reader = [self, options,
                         source](std::shared_ptr<ipc::RecordBatchFileReader> reader)
-      -> Future<std::shared_ptr<ipc::RecordBatchFileReader>> {
-    ARROW_ASSIGN_OR_RAISE(auto options,
+      -> Result<ReaderAndBatches> {
+    ARROW_ASSIGN_OR_RAISE(auto read_options,
                           GetReadOptions(*reader->schema(), *self, *options));
-    return OpenReader(source, options);
+    ARROW_ASSIGN_OR_RAISE(auto selected_batches,
+                          SelectRecordBatches(reader.get(), *options));
+    ARROW_ASSIGN_OR_RAISE(reader, OpenReader(source, read_options));
+    return ReaderAndBatches(std::move(reader), std::move(selected_batches));
   };
   auto readahead_level = options->batch_readahead;
   auto default_fragment_scan_options = this->default_fragment_scan_options;
-  auto open_generator = [=](const std::shared_ptr<ipc::RecordBatchFileReader>& reader)
+  auto open_generator = [=](const ReaderAndBatches& reader_and_batches)
       -> Result<RecordBatchGenerator> {
+    const auto& [reader, selected_batches] = reader_and_batches;
     ARROW_ASSIGN_OR_RAISE(
         auto ipc_scan_options,
         GetFragmentScanOptions<IpcFragmentScanOptions>(kIpcTypeName, options.get(),
                                                        default_fragment_scan_options));
 
     RecordBatchGenerator generator;
+    if (static_cast<int>(selected_batches.size()) < reader->num_record_batches()) {
+      // Some record batches were pruned by their statistics: read the others one by
+      // one in the background
+      auto batch_it = MakeFunctionIterator(
+          [reader = reader, selected_batches = selected_batches,
+           next = size_t{0}]() mutable -> Result<std::shared_ptr<RecordBatch>> {
+            if (next == selected_batches.size()) {
+              return IterationEnd<std::shared_ptr<RecordBatch>>();
+            }
+            return reader->ReadRecordBatch(selected_batches[next++]);
+          });
+      ARROW_ASSIGN_OR_RAISE(auto background_gen,
+                            MakeBackgroundGenerator(std::move(batch_it),
+                                                    options->io_context.executor()));
+      generator = MakeTransferredGenerator(std::move(background_gen),
+                                           ::arrow::internal::GetCpuThreadPool());
+      return MakeChunkedBatchGenerator(std::move(generator), options->batch_size);
+    }
     if (ipc_scan_options->cache_options) {
       // Transferring helps performance when coalescing
       ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
@@ -180,6 +224,47 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
   return MakeFromFuture(open_reader.Then(reopen_reader).Then(open_generator));
 }
 
+Result<compute::Expression> IpcFileFormat::GetStatisticsExpression(
+    const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+  const auto& schema = *reader->schema();
+  std::optional<std::vector<int64_t>> row_offsets;
+
+  compute::Expression statistics = compute::literal(true);
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto batch_statistics, reader->GetRecordBatchStatistics(i));
+    if (std::all_of(batch_statistics.begin(), batch_statistics.end(),
+                    [](const auto& s) { return s == nullptr; })) {
+      continue;
+    }
+    if (!row_offsets) {
+      ARROW_ASSIGN_OR_RAISE(row_offsets, reader->GetRowOffsets());
+    }
+
+    // Merge the bounds of the record batches, which are all needed except for the
+    // empty ones
+    std::optional<ArrayStatistics> merged;
+    bool bounded = true;
+    for (int j = 0; j < reader->num_record_batches() && bounded; ++j) {
+      const auto& batch = batch_statistics[j];
+      if ((*row_offsets)[j] == (*row_offsets)[j + 1]) continue;
+      if (batch == nullptr) {
+        bounded = false;
+      } else if (!merged) {
+        merged = *batch;
+      } else {
+        merged->min = std::min(*merged->min, *batch->min);
+        merged->max = std::max(*merged->max, *batch->max);
+      }
+    }
+    if (!bounded || !merged) continue;
+    if (auto expr = StatisticsAsExpression(*schema.field(i), *merged)) {
+      FoldingAnd(&statistics, std::move(*expr));
+    }
+  }
+  return statistics;
+}
+
 Future<std::optional<int64_t>> IpcFileFormat::CountRows(
     const std::shared_ptr<FileFragment>& file, compute::Expression predicate,
     const std::shared_ptr<ScanOptions>& options) {
@@ -54,6 +54,11 @@ class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
   /// \brief Return the schema of the file if possible.
   Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override;
 
+  /// \brief Return the bounds of the columns recorded in the row index of the file
+  /// (see ipc::IpcWriteOptions::write_row_index)
+  Result<compute::Expression> GetStatisticsExpression(
+      const FileSource& source) const override;
+
   Result<RecordBatchGenerator> ScanBatchesAsync(
       const std::shared_ptr<ScanOptions>& options,
       const std::shared_ptr<FileFragment>& file) const override;
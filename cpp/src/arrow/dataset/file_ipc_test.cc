@@ -172,6 +172,48 @@ TEST_P(TestIpcFileFormatScan, FragmentScanOptions) {
   ASSERT_OK_AND_ASSIGN(auto batch_gen, fragment->ScanBatchesAsync(opts_));
   ASSERT_FINISHES_AND_RAISES(Invalid, CollectAsyncGenerator(batch_gen));
 }
+TEST_P(TestIpcFileFormatScan, PruneRecordBatchesWithStatistics) {
+  auto file_schema = schema({field("i32", int32()), field("s", utf8())});
+  RecordBatchVector batches = {
+      RecordBatchFromJSON(file_schema, R"([[1, "a"], [5, "b"]])"),
+      RecordBatchFromJSON(file_schema, R"([[10, "c"], [null, "d"]])"),
+      RecordBatchFromJSON(file_schema, R"([[20, "e"]])"),
+  };
+  auto ipc_options = ipc::IpcWriteOptions::Defaults();
+  ipc_options.write_row_index = true;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(sink, file_schema, ipc_options));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  SetSchema(file_schema->fields());
+  auto fragment = MakeFragment(FileSource(buffer));
+  // The record batches are returned whole, the filter isn't applied to their rows
+  auto scanned_rows = [&](compute::Expression filter) {
+    SetFilter(std::move(filter));
+    int64_t rows = 0;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      rows += batch->num_rows();
+    }
+    return rows;
+  };
+  ASSERT_EQ(scanned_rows(literal(true)), 5);
+  ASSERT_EQ(scanned_rows(greater(field_ref("i32"), literal(7))), 3);
+  ASSERT_EQ(scanned_rows(greater(field_ref("i32"), literal(15))), 1);
+  ASSERT_EQ(scanned_rows(less(field_ref("i32"), literal(0))), 0);
+  // The row index has no statistics for strings
+  ASSERT_EQ(scanned_rows(equal(field_ref("s"), literal("z"))), 5);
+
+  // The file statistics merge those of the record batches
+  ASSERT_OK_AND_ASSIGN(auto statistics, fragment->GetStatisticsExpression());
+  auto i32 = field_ref("i32");
+  ASSERT_EQ(statistics, and_(or_(greater_equal(i32, literal(1)), is_null(i32)),
+                             or_(less_equal(i32, literal(20)), is_null(i32))));
+}
 INSTANTIATE_TEST_SUITE_P(TestScan, TestIpcFileFormatScan,
                          ::testing::ValuesIn(TestFormatParams::Values()),
                          TestFormatParams::ToTestNameString);
@@ -18,11 +18,17 @@
 #include "arrow/dataset/file_orc.h"
 
 #include <memory>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
 
 #include "arrow/adapters/orc/adapter.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
@@ -58,88 +64,163 @@ Result<std::unique_ptr<arrow::adapters::orc::ORCFileReader>> OpenORCReader(
   return reader;
 }
 
-/// \brief A ScanTask backed by an ORC file.
-class OrcScanTask {
- public:
-  OrcScanTask(std::shared_ptr<FileFragment> fragment,
-              std::shared_ptr<ScanOptions> options)
-      : fragment_(std::move(fragment)), options_(std::move(options)) {}
-
-  Result<RecordBatchIterator> Execute() {
-    struct Impl {
-      static Result<RecordBatchIterator> Make(const FileSource& source,
-                                              const FileFormat& format,
-                                              const ScanOptions& scan_options) {
-        ARROW_ASSIGN_OR_RAISE(
-            auto reader,
-            OpenORCReader(source, std::make_shared<ScanOptions>(scan_options)));
-
-        auto materialized_fields = scan_options.MaterializedFields();
-        // filter out virtual columns
-        std::vector<std::string> included_fields;
-        ARROW_ASSIGN_OR_RAISE(auto schema, reader->ReadSchema());
-        for (const auto& ref : materialized_fields) {
-          ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*schema));
-          if (match.indices().empty()) continue;
-
-          included_fields.push_back(schema->field(match.indices()[0])->name());
+// Return the stripes which may hold rows matching the filter of a scan, according to
+// their statistics
+Result<std::vector<int>> SelectStripes(arrow::adapters::orc::ORCFileReader* reader,
+                                       const Schema& schema,
+                                       const ScanOptions& scan_options) {
+  const auto num_stripes = static_cast<int>(reader->NumberOfStripes());
+  if (!ExpressionHasFieldRefs(scan_options.filter)) {
+    std::vector<int> all_stripes(num_stripes);
+    std::iota(all_stripes.begin(), all_stripes.end(), 0);
+    return all_stripes;
+  }
+  return SelectPartsWithStatistics(
+      scan_options.filter, schema, num_stripes,
+      [&](int field_index) -> Result<std::vector<std::shared_ptr<ArrayStatistics>>> {
+        std::vector<std::shared_ptr<ArrayStatistics>> statistics(num_stripes);
+        for (int i = 0; i < num_stripes; ++i) {
+          ARROW_ASSIGN_OR_RAISE(statistics[i],
+                                reader->GetStripeColumnStatistics(i, field_index));
         }
+        return statistics;
+      });
+}
 
-        std::shared_ptr<RecordBatchReader> record_batch_reader;
-        ARROW_ASSIGN_OR_RAISE(
-            record_batch_reader,
-            reader->GetRecordBatchReader(scan_options.batch_size, included_fields));
-
-        return RecordBatchIterator(Impl{std::move(record_batch_reader)});
-      }
+// Return the row groups of a stripe which may hold rows matching the filter of a
+// scan, according to the statistics of the row index of the stripe
+Result<std::vector<int>> SelectRowGroups(arrow::adapters::orc::ORCFileReader* reader,
+                                         const Schema& schema,
+                                         const ScanOptions& scan_options, int stripe,
+                                         int num_row_groups) {
+  return SelectPartsWithStatistics(
+      scan_options.filter, schema, num_row_groups,
+      [&](int field_index) -> Result<std::vector<std::shared_ptr<ArrayStatistics>>> {
+        ARROW_ASSIGN_OR_RAISE(auto statistics,
+                              reader->GetRowGroupColumnStatistics(stripe, field_index));
+        // Row groups without statistics aren't pruned
+        statistics.resize(num_row_groups);
+        return statistics;
+      });
+}
 
-      Result<std::shared_ptr<RecordBatch>> Next() {
-        std::shared_ptr<RecordBatch> batch;
-        RETURN_NOT_OK(record_batch_reader_->ReadNext(&batch));
-        return batch;
+// The state shared by the tasks reading the stripes of an ORC file
+struct OrcStripesScan {
+  std::shared_ptr<arrow::adapters::orc::ORCFileReader> reader;
+  std::shared_ptr<Schema> schema;
+  std::shared_ptr<ScanOptions> options;
+  std::vector<int> included_indices;
+
+  // Read the row groups of a stripe which may match the filter
+  Result<RecordBatchGenerator> ReadStripe(int stripe) const {
+    std::vector<int> row_groups;
+    const int64_t stride = reader->GetRowIndexStride();
+    if (stride > 0 && ExpressionHasFieldRefs(options->filter)) {
+      const auto num_row_groups = static_cast<int>(
+          bit_util::CeilDiv(reader->GetStripeInformation(stripe).num_rows, stride));
+      if (num_row_groups > 1) {
+        ARROW_ASSIGN_OR_RAISE(
+            row_groups,
+            SelectRowGroups(reader.get(), *schema, *options, stripe, num_row_groups));
+        if (row_groups.empty()) {
+          return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+        }
+        if (static_cast<int>(row_groups.size()) == num_row_groups) {
+          row_groups.clear();
+        }
       }
-
-      std::shared_ptr<RecordBatchReader> record_batch_reader_;
-    };
-
-    return Impl::Make(fragment_->source(),
-                      *checked_pointer_cast<FileFragment>(fragment_)->format(),
-                      *options_);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto stripe_reader,
+                          reader->GetStripeReader(stripe, options->batch_size,
+                                                  included_indices, row_groups));
+    ARROW_ASSIGN_OR_RAISE(auto batches, stripe_reader->ToRecordBatches());
+    return MakeVectorGenerator(std::move(batches));
   }
-
- private:
-  std::shared_ptr<FileFragment> fragment_;
-  std::shared_ptr<ScanOptions> options_;
 };
 
-class OrcScanTaskIterator {
+// Read the selected stripes of an ORC file on the io executor, keeping enough stripes
+// in flight to hold the rows read ahead by the scanner, so that they are read in
+// parallel
+class OrcStripeGenerator {
  public:
-  static Result<Iterator<std::shared_ptr<OrcScanTask>>> Make(
-      std::shared_ptr<ScanOptions> options, std::shared_ptr<FileFragment> fragment) {
-    return Iterator<std::shared_ptr<OrcScanTask>>(
-        OrcScanTaskIterator(std::move(options), std::move(fragment)));
-  }
-
-  Result<std::shared_ptr<OrcScanTask>> Next() {
-    if (once_) {
-      // Iteration is done.
-      return nullptr;
+  OrcStripeGenerator(std::shared_ptr<OrcStripesScan> scan, std::vector<int> stripes,
+                     ::arrow::internal::Executor* io_executor,
+                     int64_t min_rows_in_flight)
+      : scan_(std::move(scan)),
+        stripes_(std::move(stripes)),
+        io_executor_(io_executor),
+        min_rows_in_flight_(min_rows_in_flight) {}
+
+  Future<RecordBatchGenerator> operator()() {
+    if (index_ >= stripes_.size()) {
+      return AsyncGeneratorEnd<RecordBatchGenerator>();
     }
-
-    once_ = true;
-    return std::make_shared<OrcScanTask>(fragment_, options_);
+    ++index_;
+    if (min_rows_in_flight_ == 0) {
+      // No readahead, read the stripe when it is asked for
+      FetchNext();
+    }
+    while (readahead_index_ < stripes_.size() && rows_in_flight_ < min_rows_in_flight_) {
+      FetchNext();
+    }
+    ReadRequest next = std::move(in_flight_reads_.front());
+    in_flight_reads_.pop();
+    rows_in_flight_ -= next.num_rows;
+    return next.read;
   }
 
  private:
-  OrcScanTaskIterator(std::shared_ptr<ScanOptions> options,
-                      std::shared_ptr<FileFragment> fragment)
-      : options_(std::move(options)), fragment_(std::move(fragment)) {}
+  struct ReadRequest {
+    Future<RecordBatchGenerator> read;
+    int64_t num_rows;
+  };
 
-  bool once_ = false;
-  std::shared_ptr<ScanOptions> options_;
-  std::shared_ptr<FileFragment> fragment_;
+  void FetchNext() {
+    const int stripe = stripes_[readahead_index_++];
+    const int64_t num_rows = scan_->reader->GetStripeInformation(stripe).num_rows;
+    rows_in_flight_ += num_rows;
+    auto read = DeferNotOk(io_executor_->Submit(
+        [scan = scan_, stripe]() { return scan->ReadStripe(stripe); }));
+    in_flight_reads_.push({std::move(read), num_rows});
+  }
+
+  std::shared_ptr<OrcStripesScan> scan_;
+  std::vector<int> stripes_;
+  ::arrow::internal::Executor* io_executor_;
+  int64_t min_rows_in_flight_;
+  int64_t rows_in_flight_ = 0;
+  size_t index_ = 0;
+  size_t readahead_index_ = 0;
+  std::queue<ReadRequest> in_flight_reads_;
 };
 
+Result<RecordBatchGenerator> MakeOrcStripesGenerator(
+    const FileSource& source, const std::shared_ptr<ScanOptions>& options) {
+  auto scan = std::make_shared<OrcStripesScan>();
+  ARROW_ASSIGN_OR_RAISE(scan->reader, OpenORCReader(source, options));
+  ARROW_ASSIGN_OR_RAISE(scan->schema, scan->reader->ReadSchema());
+  scan->options = options;
+
+  // filter out virtual columns
+  for (const auto& ref : options->MaterializedFields()) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*scan->schema));
+    if (match.indices().empty()) continue;
+    scan->included_indices.push_back(match.indices()[0]);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto selected_stripes,
+                        SelectStripes(scan->reader.get(), *scan->schema, *options));
+  std::vector<int> stripes;
+  for (int stripe : selected_stripes) {
+    if (scan->reader->GetStripeInformation(stripe).num_rows == 0) continue;
+    stripes.push_back(stripe);
+  }
+  const int64_t rows_to_readahead = options->batch_readahead * options->batch_size;
+  return MakeConcatenatedGenerator(AsyncGenerator<RecordBatchGenerator>(
+      OrcStripeGenerator(std::move(scan), std::move(stripes),
+                         options->io_context.executor(), rows_to_readahead)));
+}
+
 }  // namespace
 
 OrcFileFormat::OrcFileFormat() : FileFormat(/*default_fragment_scan_options=*/nullptr) {}
@@ -157,45 +238,26 @@ Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source)
 Result<RecordBatchGenerator> OrcFileFormat::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options,
     const std::shared_ptr<FileFragment>& file) const {
-  // TODO investigate "true" async version
-  // (https://issues.apache.org/jira/browse/ARROW-13795)
-  ARROW_ASSIGN_OR_RAISE(auto task_iter, OrcScanTaskIterator::Make(options, file));
-  struct IterState {
-    Iterator<std::shared_ptr<OrcScanTask>> iter;
-    RecordBatchIterator curr_iter;
-    bool first;
-    ::arrow::internal::Executor* io_executor;
-  };
-  struct {
-    Future<std::shared_ptr<RecordBatch>> operator()() {
-      auto state = state_;
-      return ::arrow::DeferNotOk(
-          state->io_executor->Submit([state]() -> Result<std::shared_ptr<RecordBatch>> {
-            if (state->first) {
-              ARROW_ASSIGN_OR_RAISE(auto task, state->iter.Next());
-              ARROW_ASSIGN_OR_RAISE(state->curr_iter, task->Execute());
-              state->first = false;
-            }
-            while (!IsIterationEnd(state->curr_iter)) {
-              ARROW_ASSIGN_OR_RAISE(auto next_batch, state->curr_iter.Next());
-              if (IsIterationEnd(next_batch)) {
-                ARROW_ASSIGN_OR_RAISE(auto task, state->iter.Next());
-                if (IsIterationEnd(task)) {
-                  state->curr_iter = IterationEnd<RecordBatchIterator>();
-                } else {
-                  ARROW_ASSIGN_OR_RAISE(state->curr_iter, task->Execute());
-                }
-              } else {
-                return next_batch;
-              }
-            }
-            return IterationEnd<std::shared_ptr<RecordBatch>>();
-          }));
+  // Opening the file and pruning its stripes read from it, so this is done on the io
+  // executor as well
+  auto source = file->source();
+  return MakeFromFuture(DeferNotOk(options->io_context.executor()->Submit(
+      [source, options]() { return MakeOrcStripesGenerator(source, options); })));
+}
+
+Result<compute::Expression> OrcFileFormat::GetStatisticsExpression(
+    const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenORCReader(source));
+  ARROW_ASSIGN_OR_RAISE(auto schema, reader->ReadSchema());
+  compute::Expression statistics = compute::literal(true);
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto column_statistics, reader->GetColumnStatistics(i));
+    if (column_statistics == nullptr) continue;
+    if (auto expr = StatisticsAsExpression(*schema->field(i), *column_statistics)) {
+      FoldingAnd(&statistics, std::move(*expr));
     }
-    std::shared_ptr<IterState> state_;
-  } iter_to_gen{std::shared_ptr<IterState>(
-      new IterState{std::move(task_iter), {}, true, options->io_context.executor()})};
-  return iter_to_gen;
+  }
+  return statistics;
 }
 
 Future<std::optional<int64_t>> OrcFileFormat::CountRows(
@@ -212,21 +274,52 @@ Future<std::optional<int64_t>> OrcFileFormat::CountRows(
       }));
 }
 
-// //
-// // OrcFileWriter, OrcFileWriteOptions
-// //
+//
+// OrcFileWriter, OrcFileWriteOptions
+//
 
 std::shared_ptr<FileWriteOptions> OrcFileFormat::DefaultWriteOptions() {
-  // TODO (https://issues.apache.org/jira/browse/ARROW-13796)
-  return nullptr;
+  std::shared_ptr<OrcFileWriteOptions> orc_options(
+      new OrcFileWriteOptions(shared_from_this()));
+  orc_options->write_options = std::make_shared<arrow::adapters::orc::WriteOptions>();
+  orc_options->write_options->use_threads = true;
+  return orc_options;
 }
 
 Result<std::shared_ptr<FileWriter>> OrcFileFormat::MakeWriter(
     std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
     std::shared_ptr<FileWriteOptions> options,
     fs::FileLocator destination_locator) const {
-  // TODO (https://issues.apache.org/jira/browse/ARROW-13796)
-  return Status::NotImplemented("ORC writer not yet implemented.");
+  if (!Equals(*options->format())) {
+    return Status::TypeError("Mismatching format/write options.");
+  }
+
+  auto orc_options = checked_pointer_cast<OrcFileWriteOptions>(options);
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<arrow::adapters::orc::ORCFileWriter> writer,
+                        arrow::adapters::orc::ORCFileWriter::Open(
+                            destination.get(), *orc_options->write_options));
+
+  return std::shared_ptr<FileWriter>(
+      new OrcFileWriter(std::move(destination), std::move(writer), std::move(schema),
+                        std::move(orc_options), std::move(destination_locator)));
+}
+
+OrcFileWriter::OrcFileWriter(std::shared_ptr<io::OutputStream> destination,
+                             std::shared_ptr<arrow::adapters::orc::ORCFileWriter> writer,
+                             std::shared_ptr<Schema> schema,
+                             std::shared_ptr<OrcFileWriteOptions> options,
+                             fs::FileLocator destination_locator)
+    : FileWriter(std::move(schema), std::move(options), std::move(destination),
+                 std::move(destination_locator)),
+      batch_writer_(std::move(writer)) {}
+
+Status OrcFileWriter::Write(const std::shared_ptr<RecordBatch>& batch) {
+  return batch_writer_->Write(*batch);
+}
+
+Future<> OrcFileWriter::FinishInternal() {
+  return DeferNotOk(destination_locator_.filesystem->io_context().executor()->Submit(
+      [this]() { return batch_writer_->Close(); }));
 }
 
 }  // namespace dataset
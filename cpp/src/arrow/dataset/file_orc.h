@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
@@ -29,6 +30,15 @@
 #include "arrow/result.h"
 
 namespace arrow {
+namespace adapters {
+namespace orc {
+
+class ORCFileWriter;
+struct WriteOptions;
+
+}  // namespace orc
+}  // namespace adapters
+
 namespace dataset {
 
 /// \addtogroup dataset-file-formats
@@ -53,6 +63,10 @@ class ARROW_DS_EXPORT OrcFileFormat : public FileFormat {
   /// \brief Return the schema of the file if possible.
   Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override;
 
+  /// \brief Return the bounds of the columns recorded in the statistics of the file
+  Result<compute::Expression> GetStatisticsExpression(
+      const FileSource& source) const override;
+
   Result<RecordBatchGenerator> ScanBatchesAsync(
       const std::shared_ptr<ScanOptions>& options,
       const std::shared_ptr<FileFragment>& file) const override;
@@ -69,6 +83,37 @@ class ARROW_DS_EXPORT OrcFileFormat : public FileFormat {
   std::shared_ptr<FileWriteOptions> DefaultWriteOptions() override;
 };
 
+class ARROW_DS_EXPORT OrcFileWriteOptions : public FileWriteOptions {
+ public:
+  /// Options passed to adapters::orc::ORCFileWriter::Open.  use_threads is enabled
+  /// by default, so that batches are converted to ORC while previous ones are encoded
+  std::shared_ptr<adapters::orc::WriteOptions> write_options;
+
+ protected:
+  explicit OrcFileWriteOptions(std::shared_ptr<FileFormat> format)
+      : FileWriteOptions(std::move(format)) {}
+
+  friend class OrcFileFormat;
+};
+
+class ARROW_DS_EXPORT OrcFileWriter : public FileWriter {
+ public:
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override;
+
+ private:
+  OrcFileWriter(std::shared_ptr<io::OutputStream> destination,
+                std::shared_ptr<adapters::orc::ORCFileWriter> writer,
+                std::shared_ptr<Schema> schema,
+                std::shared_ptr<OrcFileWriteOptions> options,
+                fs::FileLocator destination_locator);
+
+  Future<> FinishInternal() override;
+
+  std::shared_ptr<adapters::orc::ORCFileWriter> batch_writer_;
+
+  friend class OrcFileFormat;
+};
+
 /// @}
 
 }  // namespace dataset
@@ -54,7 +54,7 @@ class OrcFormatHelper {
 
 class TestOrcFileFormat : public FileFormatFixtureMixin<OrcFormatHelper> {};
 
-// TEST_F(TestOrcFileFormat, WriteRecordBatchReader) { TestWrite(); }
+TEST_F(TestOrcFileFormat, WriteRecordBatchReader) { TestWrite(); }
 
 TEST_F(TestOrcFileFormat, InspectFailureWithRelevantError) {
   TestInspectFailureWithRelevantError(StatusCode::IOError, "ORC");
@@ -88,6 +88,79 @@ TEST_P(TestOrcFileFormatScan, ScanRecordBatchReaderWithDuplicateColumnError) {
   TestScanWithDuplicateColumnError();
 }
 TEST_P(TestOrcFileFormatScan, ScanWithPushdownNulls) { TestScanWithPushdownNulls(); }
+TEST_P(TestOrcFileFormatScan, PruneStripesWithStatistics) {
+  auto table = TableFromJSON(schema({field("i64", int64())}),
+                             {R"([[1], [5], [10], [null], [20], [21]])"});
+  auto write_options = adapters::orc::WriteOptions();
+  write_options.batch_size = 2;
+  // A stripe for each batch
+  write_options.stripe_size = 1;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       adapters::orc::ORCFileWriter::Open(sink.get(), write_options));
+  ASSERT_OK(writer->Write(*table));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       adapters::orc::ORCFileReader::Open(
+                           std::make_shared<io::BufferReader>(buffer), default_memory_pool()));
+  ASSERT_EQ(reader->NumberOfStripes(), 3);
+
+  SetSchema(table->schema()->fields());
+  auto fragment = MakeFragment(FileSource(buffer));
+  // The stripes are returned whole, the filter isn't applied to their rows
+  auto scanned_rows = [&](compute::Expression filter) {
+    SetFilter(std::move(filter));
+    int64_t rows = 0;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      rows += batch->num_rows();
+    }
+    return rows;
+  };
+  ASSERT_EQ(scanned_rows(literal(true)), 6);
+  ASSERT_EQ(scanned_rows(greater(field_ref("i64"), literal(int64_t{7}))), 4);
+  ASSERT_EQ(scanned_rows(greater(field_ref("i64"), literal(int64_t{20}))), 2);
+  ASSERT_EQ(scanned_rows(less(field_ref("i64"), literal(int64_t{0}))), 0);
+  // Only the second stripe has a null
+  ASSERT_EQ(scanned_rows(is_null(field_ref("i64"))), 2);
+
+  ASSERT_OK_AND_ASSIGN(auto statistics, fragment->GetStatisticsExpression());
+  auto i64 = field_ref("i64");
+  ASSERT_EQ(statistics, and_(or_(greater_equal(i64, literal(int64_t{1})), is_null(i64)),
+                             or_(less_equal(i64, literal(int64_t{21})), is_null(i64))));
+}
+TEST_P(TestOrcFileFormatScan, PruneRowGroupsWithStatistics) {
+  auto table = TableFromJSON(schema({field("i64", int64())}),
+                             {R"([[1], [5], [10], [null], [20], [21], [30]])"});
+  auto write_options = adapters::orc::WriteOptions();
+  // A single stripe with row groups of 2 rows
+  write_options.row_index_stride = 2;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       adapters::orc::ORCFileWriter::Open(sink.get(), write_options));
+  ASSERT_OK(writer->Write(*table));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  SetSchema(table->schema()->fields());
+  auto fragment = MakeFragment(FileSource(buffer));
+  // The row groups are returned whole, the filter isn't applied to their rows
+  auto scanned_rows = [&](compute::Expression filter) {
+    SetFilter(std::move(filter));
+    int64_t rows = 0;
+    for (auto maybe_batch : PhysicalBatches(fragment)) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      rows += batch->num_rows();
+    }
+    return rows;
+  };
+  ASSERT_EQ(scanned_rows(literal(true)), 7);
+  ASSERT_EQ(scanned_rows(greater(field_ref("i64"), literal(int64_t{7}))), 5);
+  ASSERT_EQ(scanned_rows(greater(field_ref("i64"), literal(int64_t{20}))), 3);
+  ASSERT_EQ(scanned_rows(less(field_ref("i64"), literal(int64_t{5}))), 2);
+  ASSERT_EQ(scanned_rows(is_null(field_ref("i64"))), 2);
+}
 INSTANTIATE_TEST_SUITE_P(TestScan, TestOrcFileFormatScan,
                          ::testing::ValuesIn(TestFormatParams::Values()),
                          TestFormatParams::ToTestNameString);
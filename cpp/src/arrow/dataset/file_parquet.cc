@@ -17,13 +17,24 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_base.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset_internal.h"
@@ -40,10 +51,13 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_reader.h"
 #include "parquet/encryption/crypto_factory.h"
 #include "parquet/encryption/encryption.h"
 #include "parquet/encryption/kms_client.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -108,6 +122,16 @@ parquet::ReaderProperties MakeReaderProperties(
   return properties;
 }
 
+// Return the metadata cache to use for a file, if any.  Decrypted footers are not
+// shared.
+ParquetMetadataCache* GetMetadataCache(const ParquetFragmentScanOptions& scan_options,
+                                       const parquet::ReaderProperties& properties) {
+  if (properties.file_decryption_properties() != nullptr) {
+    return nullptr;
+  }
+  return scan_options.metadata_cache.get();
+}
+
 parquet::ArrowReaderProperties MakeArrowReaderProperties(
     const ParquetFileFormat& format, const parquet::FileMetaData& metadata) {
   parquet::ArrowReaderProperties properties(/* use_threads = */ false);
@@ -185,6 +209,76 @@ std::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
                                                              *statistics);
 }
 
+// Return an expression bounding the values of a column in all row groups of a file,
+// or nullopt if a row group doesn't have usable statistics for it.
+std::optional<compute::Expression> FileColumnStatisticsAsExpression(
+    const SchemaField& schema_field, const parquet::FileMetaData& metadata) {
+  if (!schema_field.is_leaf()) {
+    return std::nullopt;
+  }
+  const auto& type = schema_field.field->type();
+
+  bool may_have_null = false;
+  ScalarVector mins, maxes;
+  for (int i = 0; i < metadata.num_row_groups(); ++i) {
+    auto statistics =
+        metadata.RowGroup(i)->ColumnChunk(schema_field.column_index)->statistics();
+    if (statistics == nullptr) {
+      return std::nullopt;
+    }
+    may_have_null |= !statistics->HasNullCount() || statistics->null_count() > 0;
+    if (statistics->num_values() == 0) continue;
+
+    std::shared_ptr<Scalar> min, max;
+    if (!statistics->HasMinMax() || !StatisticsAsScalars(*statistics, &min, &max).ok()) {
+      return std::nullopt;
+    }
+    auto maybe_min = Cast(min, type);
+    auto maybe_max = Cast(max, type);
+    if (!maybe_min.ok() || !maybe_max.ok()) {
+      return std::nullopt;
+    }
+    mins.push_back(maybe_min.MoveValueUnsafe().scalar());
+    maxes.push_back(maybe_max.MoveValueUnsafe().scalar());
+    if (IsNan(*mins.back()) || IsNan(*maxes.back())) {
+      return std::nullopt;
+    }
+  }
+
+  auto field_expr = compute::field_ref(schema_field.field->name());
+  if (mins.empty()) {
+    // No row group has non-null values
+    return compute::is_null(std::move(field_expr));
+  }
+
+  auto min_max = [&](const ScalarVector& values) -> Result<std::shared_ptr<Scalar>> {
+    ARROW_ASSIGN_OR_RAISE(auto builder, MakeBuilder(type));
+    RETURN_NOT_OK(builder->AppendScalars(values));
+    ARROW_ASSIGN_OR_RAISE(auto array, builder->Finish());
+    ARROW_ASSIGN_OR_RAISE(auto min_max, compute::MinMax(array));
+    return min_max.scalar();
+  };
+  auto maybe_min = min_max(mins);
+  auto maybe_max = min_max(maxes);
+  if (!maybe_min.ok() || !maybe_max.ok()) {
+    return std::nullopt;
+  }
+  const auto& min = checked_cast<const StructScalar&>(**maybe_min).value[0];
+  const auto& max = checked_cast<const StructScalar&>(**maybe_max).value[1];
+
+  compute::Expression range;
+  if (min->Equals(*max)) {
+    range = compute::equal(field_expr, compute::literal(min));
+  } else {
+    range = compute::and_(compute::greater_equal(field_expr, compute::literal(min)),
+                          compute::less_equal(field_expr, compute::literal(max)));
+  }
+  if (may_have_null) {
+    return compute::or_(std::move(range), compute::is_null(std::move(field_expr)));
+  }
+  return range;
+}
+
 void AddColumnIndices(const SchemaField& schema_field,
                       std::vector<int>* column_projection) {
   if (schema_field.is_leaf()) {
@@ -197,6 +291,345 @@ void AddColumnIndices(const SchemaField& schema_field,
   }
 }
 
+// Return the field of the file referenced by `ref`, or nullptr if the file doesn't
+// have it.
+Result<const SchemaField*> FindSchemaField(const FieldRef& ref,
+                                           const Schema& physical_schema,
+                                           const SchemaManifest& manifest) {
+  ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema));
+  if (match.empty()) return nullptr;
+  const SchemaField* schema_field = &manifest.schema_fields[match[0]];
+  for (size_t i = 1; i < match.indices().size(); ++i) {
+    if (schema_field->field->type()->id() != Type::STRUCT) {
+      return Status::Invalid("nested paths only supported for structs");
+    }
+    schema_field = &schema_field->children[match[i]];
+  }
+  return schema_field;
+}
+
+// Use the page index to find the rows of a row group which may satisfy the predicate.
+// Returns std::nullopt if the page index doesn't allow excluding any row.
+Result<std::optional<parquet::RowRanges>> PageIndexRowRanges(
+    const compute::Expression& predicate, const Schema& physical_schema,
+    const SchemaManifest& manifest, parquet::ParquetFileReader* reader, int row_group) {
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  std::shared_ptr<parquet::PageIndexReader> page_index_reader =
+      reader->GetPageIndexReader();
+  if (page_index_reader == nullptr) return std::nullopt;
+  std::shared_ptr<parquet::RowGroupPageIndexReader> row_group_index =
+      page_index_reader->RowGroup(row_group);
+  if (row_group_index == nullptr) return std::nullopt;
+  const int64_t num_rows = reader->metadata()->RowGroup(row_group)->num_rows();
+
+  std::optional<parquet::RowRanges> result;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(const SchemaField* schema_field,
+                          FindSchemaField(ref, physical_schema, manifest));
+    if (schema_field == nullptr || !schema_field->is_leaf()) continue;
+    const int column = schema_field->column_index;
+    std::shared_ptr<parquet::ColumnIndex> column_index =
+        row_group_index->GetColumnIndex(column);
+    std::shared_ptr<parquet::OffsetIndex> offset_index =
+        row_group_index->GetOffsetIndex(column);
+    if (column_index == nullptr || offset_index == nullptr) continue;
+    const std::vector<parquet::PageLocation>& pages = offset_index->page_locations();
+    if (pages.size() != column_index->null_pages().size()) continue;
+
+    const parquet::ColumnDescriptor* descr = reader->metadata()->schema()->Column(column);
+    std::vector<parquet::RowRanges::Range> kept;
+    for (size_t i = 0; i < pages.size(); ++i) {
+      compute::Expression guarantee = compute::literal(true);
+      if (column_index->null_pages()[i]) {
+        guarantee = is_null(compute::field_ref(ref));
+      } else {
+        const bool has_null_counts = column_index->has_null_counts();
+        // The page index doesn't record the number of values, any non-zero count
+        // tells EvaluateStatisticsAsExpression that the page isn't all null
+        auto statistics = parquet::Statistics::Make(
+            descr, column_index->encoded_min_values()[i],
+            column_index->encoded_max_values()[i], /*num_values=*/1,
+            has_null_counts ? column_index->null_counts()[i] : 0,
+            /*distinct_count=*/0, /*has_min_max=*/true, has_null_counts,
+            /*has_distinct_count=*/false);
+        if (auto minmax = ParquetFileFragment::EvaluateStatisticsAsExpression(
+                *schema_field->field, ref, *statistics)) {
+          guarantee = std::move(*minmax);
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(guarantee, guarantee.Bind(physical_schema));
+      ARROW_ASSIGN_OR_RAISE(auto page_predicate,
+                            SimplifyWithGuarantee(predicate, guarantee));
+      if (page_predicate.IsSatisfiable()) {
+        int64_t end = i + 1 < pages.size() ? pages[i + 1].first_row_index : num_rows;
+        kept.push_back({pages[i].first_row_index, end});
+      }
+    }
+    parquet::RowRanges column_ranges(std::move(kept));
+    result = result ? result->Intersect(column_ranges) : std::move(column_ranges);
+  }
+
+  if (result && result->num_rows() == num_rows) return std::nullopt;
+  return result;
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
+// Hash a value the way a writer inserts it into the bloom filter of a column, or
+// return std::nullopt if the value can't be looked up in the bloom filter.
+std::optional<uint64_t> BloomFilterHash(const parquet::BloomFilter& bloom_filter,
+                                        const parquet::ColumnDescriptor& descr,
+                                        const Scalar& value) {
+  if (!value.is_valid) return std::nullopt;
+  const parquet::Type::type physical_type = descr.physical_type();
+  auto hash_int32 = [&](int32_t v) -> std::optional<uint64_t> {
+    if (physical_type != parquet::Type::INT32) return std::nullopt;
+    return bloom_filter.Hash(v);
+  };
+  auto hash_int64 = [&](int64_t v) -> std::optional<uint64_t> {
+    if (physical_type != parquet::Type::INT64) return std::nullopt;
+    return bloom_filter.Hash(v);
+  };
+  switch (value.type->id()) {
+    case Type::INT8:
+      return hash_int32(checked_cast<const Int8Scalar&>(value).value);
+    case Type::UINT8:
+      return hash_int32(checked_cast<const UInt8Scalar&>(value).value);
+    case Type::INT16:
+      return hash_int32(checked_cast<const Int16Scalar&>(value).value);
+    case Type::UINT16:
+      return hash_int32(checked_cast<const UInt16Scalar&>(value).value);
+    case Type::INT32:
+      return hash_int32(checked_cast<const Int32Scalar&>(value).value);
+    case Type::UINT32:
+      // Stored as the int32 of the same bits
+      return hash_int32(
+          static_cast<int32_t>(checked_cast<const UInt32Scalar&>(value).value));
+    case Type::DATE32:
+      return hash_int32(checked_cast<const Date32Scalar&>(value).value);
+    case Type::INT64:
+      return hash_int64(checked_cast<const Int64Scalar&>(value).value);
+    case Type::UINT64:
+      return hash_int64(
+          static_cast<int64_t>(checked_cast<const UInt64Scalar&>(value).value));
+    case Type::FLOAT: {
+      // NaNs may have other bit patterns in the file
+      const float v = checked_cast<const FloatScalar&>(value).value;
+      if (physical_type != parquet::Type::FLOAT || std::isnan(v)) return std::nullopt;
+      return bloom_filter.Hash(v);
+    }
+    case Type::DOUBLE: {
+      const double v = checked_cast<const DoubleScalar&>(value).value;
+      if (physical_type != parquet::Type::DOUBLE || std::isnan(v)) return std::nullopt;
+      return bloom_filter.Hash(v);
+    }
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY: {
+      if (physical_type != parquet::Type::BYTE_ARRAY) return std::nullopt;
+      parquet::ByteArray byte_array(
+          checked_cast<const BaseBinaryScalar&>(value).view());
+      return bloom_filter.Hash(&byte_array);
+    }
+    case Type::FIXED_SIZE_BINARY: {
+      std::string_view data = checked_cast<const BaseBinaryScalar&>(value).view();
+      if (physical_type != parquet::Type::FIXED_LEN_BYTE_ARRAY ||
+          static_cast<int>(data.size()) != descr.type_length()) {
+        return std::nullopt;
+      }
+      parquet::FixedLenByteArray flba(reinterpret_cast<const uint8_t*>(data.data()));
+      return bloom_filter.Hash(&flba, static_cast<uint32_t>(data.size()));
+    }
+    default:
+      return std::nullopt;
+  }
+}
+
+// Look up the equality and is_in comparisons of a predicate in the bloom filters of
+// a row group.  Each comparison of a field with literal values is passed to
+// `may_contain`, which returns false if the field can't contain any of the values.
+// Returns false if this shows that no row of the row group satisfies the predicate.
+// All comparisons are visited, even once the result is known.
+Result<bool> PredicateMayBeTrue(
+    const compute::Expression& predicate,
+    const std::function<Result<bool>(const FieldRef&, const ScalarVector&)>&
+        may_contain) {
+  const compute::Expression::Call* call = predicate.call();
+  if (call == nullptr) return true;
+  const std::string& name = call->function_name;
+
+  const bool is_and = name == "and_kleene" || name == "and";
+  if (is_and || name == "or_kleene" || name == "or") {
+    bool result = is_and;
+    for (const compute::Expression& argument : call->arguments) {
+      ARROW_ASSIGN_OR_RAISE(bool may_be_true, PredicateMayBeTrue(argument, may_contain));
+      result = is_and ? result && may_be_true : result || may_be_true;
+    }
+    return result;
+  }
+  if (name == "equal" && call->arguments.size() == 2) {
+    const compute::Expression* field = &call->arguments[0];
+    const compute::Expression* value = &call->arguments[1];
+    if (field->literal() != nullptr) std::swap(field, value);
+    if (field->field_ref() == nullptr || value->literal() == nullptr ||
+        !value->literal()->is_scalar()) {
+      return true;
+    }
+    return may_contain(*field->field_ref(), {value->literal()->scalar()});
+  }
+  if (name == "is_in" && call->arguments.size() == 1 &&
+      call->arguments[0].field_ref() != nullptr) {
+    const auto* options =
+        checked_cast<const compute::SetLookupOptions*>(call->options.get());
+    if (options == nullptr || !options->value_set.is_arraylike()) return true;
+    std::shared_ptr<Array> value_set = options->value_set.make_array();
+    // Nulls in the value set may match null rows, which aren't in the bloom filter
+    if (value_set->null_count() > 0) return true;
+    ScalarVector values(value_set->length());
+    for (int64_t i = 0; i < value_set->length(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(values[i], value_set->GetScalar(i));
+    }
+    return may_contain(*call->arguments[0].field_ref(), values);
+  }
+  return true;
+}
+
+// Use the bloom filters of the file to drop the row groups in which no row satisfies
+// the equality and is_in comparisons of the predicate.  The bloom filters of the
+// compared columns are prefetched for all row groups first.
+Result<std::vector<int>> BloomFilterRowGroups(
+    const compute::Expression& predicate, const Schema& physical_schema,
+    const SchemaManifest& manifest, const parquet::ArrowReaderProperties& properties,
+    parquet::ParquetFileReader* reader, std::vector<int> row_groups,
+    ParquetScanMetrics* metrics) {
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  // Collect the columns whose bloom filters may be looked up
+  std::vector<int32_t> columns;
+  auto collect_column = [&](const FieldRef& ref, const ScalarVector&) -> Result<bool> {
+    ARROW_ASSIGN_OR_RAISE(const SchemaField* schema_field,
+                          FindSchemaField(ref, physical_schema, manifest));
+    if (schema_field != nullptr && schema_field->is_leaf() &&
+        std::find(columns.begin(), columns.end(), schema_field->column_index) ==
+            columns.end()) {
+      columns.push_back(schema_field->column_index);
+    }
+    return true;
+  };
+  RETURN_NOT_OK(PredicateMayBeTrue(predicate, collect_column).status());
+  if (columns.empty()) return row_groups;
+
+  parquet::BloomFilterReader& bloom_filter_reader = reader->GetBloomFilterReader();
+  bloom_filter_reader.WillNeed(std::vector<int32_t>(row_groups.begin(), row_groups.end()),
+                               columns, properties.io_context(),
+                               properties.cache_options());
+  const parquet::SchemaDescriptor* schema = reader->metadata()->schema();
+
+  std::vector<int> kept;
+  for (int row_group : row_groups) {
+    std::shared_ptr<parquet::RowGroupBloomFilterReader> row_group_reader =
+        bloom_filter_reader.RowGroup(row_group);
+    std::unordered_map<int, std::unique_ptr<parquet::BloomFilter>> bloom_filters;
+    auto may_contain = [&](const FieldRef& ref,
+                           const ScalarVector& values) -> Result<bool> {
+      if (row_group_reader == nullptr) return true;
+      ARROW_ASSIGN_OR_RAISE(const SchemaField* schema_field,
+                            FindSchemaField(ref, physical_schema, manifest));
+      if (schema_field == nullptr || !schema_field->is_leaf()) return true;
+      const int column = schema_field->column_index;
+      auto it = bloom_filters.find(column);
+      if (it == bloom_filters.end()) {
+        it = bloom_filters.emplace(column, row_group_reader->GetColumnBloomFilter(column))
+                 .first;
+      }
+      const parquet::BloomFilter* bloom_filter = it->second.get();
+      if (bloom_filter == nullptr) return true;
+      for (const std::shared_ptr<Scalar>& value : values) {
+        if (!value->type->Equals(*schema_field->field->type())) return true;
+        if (internal::BloomFilterMayContain(*bloom_filter, *schema->Column(column),
+                                           *value)) {
+          return true;
+        }
+      }
+      return false;
+    };
+    ARROW_ASSIGN_OR_RAISE(bool may_be_true, PredicateMayBeTrue(predicate, may_contain));
+    if (may_be_true) {
+      kept.push_back(row_group);
+    } else if (metrics != nullptr) {
+      metrics->row_groups_pruned_by_bloom_filter.fetch_add(1);
+    }
+  }
+  return kept;
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
+// Decode the columns referenced by the predicate first and restrict each row group
+// to the rows satisfying it, so that the other projected columns are only decoded
+// for those rows.
+Status FilterRowGroupsByPredicate(const compute::Expression& predicate,
+                                  const Schema& physical_schema,
+                                  const std::vector<int>& column_projection,
+                                  const std::vector<int>& row_groups, MemoryPool* pool,
+                                  parquet::arrow::FileReader* reader) {
+  const SchemaManifest& manifest = reader->manifest();
+  std::vector<bool> is_predicate_field(physical_schema.num_fields(), false);
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema));
+    // Virtual columns are only known to the scanner, leave the filter to it
+    if (match.empty()) return Status::OK();
+    is_predicate_field[match[0]] = true;
+  }
+  // Fields are read in file order, which the predicate batch below relies on
+  std::vector<int> predicate_columns;
+  for (int i = 0; i < physical_schema.num_fields(); ++i) {
+    if (is_predicate_field[i]) {
+      AddColumnIndices(manifest.schema_fields[i], &predicate_columns);
+    }
+  }
+  // Nothing is saved unless other columns are read
+  std::unordered_set<int> predicate_column_set(predicate_columns.begin(),
+                                               predicate_columns.end());
+  if (std::all_of(column_projection.begin(), column_projection.end(),
+                  [&](int column) { return predicate_column_set.count(column) > 0; })) {
+    return Status::OK();
+  }
+
+  compute::ExecContext exec_context(pool);
+  auto maybe_bound = predicate.Bind(physical_schema, &exec_context);
+  // The file may not be able to evaluate a filter written against the dataset
+  // schema, leave the filter to the scanner then
+  if (!maybe_bound.ok()) return Status::OK();
+  compute::Expression bound = maybe_bound.MoveValueUnsafe();
+
+  auto evaluate = [&](const RecordBatch& batch)
+      -> Result<std::shared_ptr<BooleanArray>> {
+    // Fields not needed by the predicate are null
+    std::vector<Datum> values(physical_schema.num_fields());
+    int column = 0;
+    for (int i = 0; i < physical_schema.num_fields(); ++i) {
+      if (is_predicate_field[i]) {
+        values[i] = batch.column(column++);
+      } else {
+        values[i] = MakeNullScalar(physical_schema.field(i)->type());
+      }
+    }
+    compute::ExecBatch exec_batch(std::move(values), batch.num_rows());
+    ARROW_ASSIGN_OR_RAISE(Datum mask,
+                          ExecuteScalarExpression(bound, exec_batch, &exec_context));
+    if (mask.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<Array> array,
+          MakeArrayFromScalar(*mask.scalar(), batch.num_rows(), pool));
+      return checked_pointer_cast<BooleanArray>(std::move(array));
+    }
+    return checked_pointer_cast<BooleanArray>(mask.make_array());
+  };
+  for (int row_group : row_groups) {
+    RETURN_NOT_OK(reader->FilterRowGroup(row_group, predicate_columns, evaluate));
+  }
+  return Status::OK();
+}
+
 Status ResolveOneFieldRef(
     const SchemaManifest& manifest, const FieldRef& field_ref,
     const std::unordered_map<std::string, const SchemaField*>& field_lookup,
@@ -361,6 +794,29 @@ Result<bool> IsSupportedParquetFile(const ParquetFileFormat& format,
 
 }  // namespace
 
+namespace internal {
+
+bool BloomFilterMayContain(const parquet::BloomFilter& bloom_filter,
+                           const parquet::ColumnDescriptor& descr, const Scalar& value) {
+  std::optional<uint64_t> hash = BloomFilterHash(bloom_filter, descr, value);
+  if (!hash || bloom_filter.FindHash(*hash)) return true;
+  // Signed zeros compare equal but are hashed differently
+  switch (value.type->id()) {
+    case Type::FLOAT: {
+      const float v = checked_cast<const FloatScalar&>(value).value;
+      return v == 0 && bloom_filter.FindHash(bloom_filter.Hash(-v));
+    }
+    case Type::DOUBLE: {
+      const double v = checked_cast<const DoubleScalar&>(value).value;
+      return v == 0 && bloom_filter.FindHash(bloom_filter.Hash(-v));
+    }
+    default:
+      return false;
+  }
+}
+
+}  // namespace internal
+
 std::optional<compute::Expression> ParquetFileFragment::EvaluateStatisticsAsExpression(
     const Field& field, const FieldRef& field_ref,
     const parquet::Statistics& statistics) {
@@ -469,6 +925,29 @@ Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
   return schema;
 }
 
+Future<> ParquetFileFormat::PrefetchMetadata(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(
+      auto parquet_scan_options,
+      GetFragmentScanOptions<ParquetFragmentScanOptions>(kParquetTypeName, nullptr,
+                                                         default_fragment_scan_options));
+  auto properties = MakeReaderProperties(*this, parquet_scan_options.get(), source.path(),
+                                         source.filesystem());
+  std::shared_ptr<ParquetMetadataCache> metadata_cache;
+  if (GetMetadataCache(*parquet_scan_options, properties)) {
+    metadata_cache = parquet_scan_options->metadata_cache;
+  }
+  if (metadata_cache == nullptr || metadata_cache->Get(source) != nullptr) {
+    return Future<>::MakeFinished();
+  }
+  return source.OpenAsync().Then(
+      [=](const std::shared_ptr<io::RandomAccessFile>& input) mutable {
+        return parquet::ParquetFileReader::OpenAsync(input, std::move(properties))
+            .Then([=](const std::unique_ptr<parquet::ParquetFileReader>& reader) {
+              metadata_cache->Put(source, reader->metadata());
+            });
+      });
+}
+
 Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader(
     const FileSource& source, const std::shared_ptr<ScanOptions>& options) const {
   return GetReader(source, options, /*metadata=*/nullptr);
@@ -483,13 +962,17 @@ Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
                                                          default_fragment_scan_options));
   auto properties =
       MakeReaderProperties(*this, parquet_scan_options.get(), "", nullptr, options->pool);
+  ParquetMetadataCache* metadata_cache =
+      metadata == nullptr ? GetMetadataCache(*parquet_scan_options, properties) : nullptr;
+  std::shared_ptr<parquet::FileMetaData> known_metadata =
+      metadata_cache != nullptr ? metadata_cache->Get(source) : metadata;
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   // `parquet::ParquetFileReader::Open` will not wrap the exception as status,
   // so using `open_parquet_file` to wrap it.
   auto open_parquet_file = [&]() -> Result<std::unique_ptr<parquet::ParquetFileReader>> {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     auto reader = parquet::ParquetFileReader::Open(std::move(input),
-                                                   std::move(properties), metadata);
+                                                   std::move(properties), known_metadata);
     return reader;
     END_PARQUET_CATCH_EXCEPTIONS
   };
@@ -501,6 +984,9 @@ Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
   auto reader = std::move(reader_opt).ValueOrDie();
 
   std::shared_ptr<parquet::FileMetaData> reader_metadata = reader->metadata();
+  if (metadata_cache != nullptr && known_metadata == nullptr) {
+    metadata_cache->Put(source, reader_metadata);
+  }
   auto arrow_properties =
       MakeArrowReaderProperties(*this, *reader_metadata, *options, *parquet_scan_options);
   std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
@@ -524,15 +1010,24 @@ Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
                                                          default_fragment_scan_options));
   auto properties = MakeReaderProperties(*this, parquet_scan_options.get(), source.path(),
                                          source.filesystem(), options->pool);
+  std::shared_ptr<ParquetMetadataCache> metadata_cache;
+  if (metadata == nullptr && GetMetadataCache(*parquet_scan_options, properties)) {
+    metadata_cache = parquet_scan_options->metadata_cache;
+  }
+  std::shared_ptr<parquet::FileMetaData> known_metadata =
+      metadata_cache != nullptr ? metadata_cache->Get(source) : metadata;
   auto self = checked_pointer_cast<const ParquetFileFormat>(shared_from_this());
 
   return source.OpenAsync().Then(
       [=](const std::shared_ptr<io::RandomAccessFile>& input) mutable {
         return parquet::ParquetFileReader::OpenAsync(input, std::move(properties),
-                                                     metadata)
+                                                     known_metadata)
             .Then(
                 [=](const std::unique_ptr<parquet::ParquetFileReader>& reader) mutable
                 -> Result<std::shared_ptr<parquet::arrow::FileReader>> {
+                  if (metadata_cache != nullptr && known_metadata == nullptr) {
+                    metadata_cache->Put(source, reader->metadata());
+                  }
                   auto arrow_properties = MakeArrowReaderProperties(
                       *self, *reader->metadata(), *options, *parquet_scan_options);
 
@@ -633,6 +1128,47 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
         auto parquet_scan_options,
         GetFragmentScanOptions<ParquetFragmentScanOptions>(
             kParquetTypeName, options.get(), default_fragment_scan_options));
+    if ((parquet_scan_options->bloom_filter_filtering ||
+         parquet_scan_options->page_index_filtering ||
+         parquet_scan_options->late_materialization) &&
+        ExpressionHasFieldRefs(options->filter)) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto predicate,
+          SimplifyWithGuarantee(options->filter,
+                                parquet_fragment->partition_expression()));
+      // Bloom filters of encrypted files can't be read yet
+      if (parquet_scan_options->bloom_filter_filtering &&
+          !reader->parquet_reader()->metadata()->is_encryption_algorithm_set() &&
+          parquet_scan_options->reader_properties->file_decryption_properties() ==
+              nullptr &&
+          parquet_scan_options->parquet_decryption_config == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(
+            row_groups,
+            BloomFilterRowGroups(predicate, *parquet_fragment->physical_schema_,
+                                 *parquet_fragment->manifest_, reader->properties(),
+                                 reader->parquet_reader(), std::move(row_groups),
+                                 parquet_scan_options->scan_metrics.get()));
+        if (row_groups.empty()) {
+          return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+        }
+      }
+      for (int row_group : row_groups) {
+        if (!parquet_scan_options->page_index_filtering) break;
+        ARROW_ASSIGN_OR_RAISE(
+            auto row_ranges,
+            PageIndexRowRanges(predicate, *parquet_fragment->physical_schema_,
+                               *parquet_fragment->manifest_, reader->parquet_reader(),
+                               row_group));
+        if (row_ranges) {
+          RETURN_NOT_OK(reader->SetRowRanges(row_group, std::move(*row_ranges)));
+        }
+      }
+      if (parquet_scan_options->late_materialization) {
+        RETURN_NOT_OK(FilterRowGroupsByPredicate(
+            predicate, *parquet_fragment->physical_schema_, column_projection,
+            row_groups, options->pool, reader.get()));
+      }
+    }
     int batch_readahead = options->batch_readahead;
     int64_t rows_to_readahead = batch_readahead * options->batch_size;
     ARROW_ASSIGN_OR_RAISE(auto generator,
@@ -879,6 +1415,46 @@ Result<FragmentVector> ParquetFileFragment::SplitByRowGroup(
   return fragments;
 }
 
+Result<FragmentVector> ParquetFileFragment::SplitForScan(
+    const std::shared_ptr<ScanOptions>& options) {
+  ARROW_ASSIGN_OR_RAISE(auto parquet_scan_options,
+                        GetFragmentScanOptions<ParquetFragmentScanOptions>(
+                            kParquetTypeName, options.get(),
+                            parquet_format_.default_fragment_scan_options));
+  const int64_t split_rows = parquet_scan_options->scan_split_rows;
+  if (split_rows <= 0 || !options->use_threads) {
+    return FragmentVector{shared_from_this()};
+  }
+  RETURN_NOT_OK(EnsureCompleteMetadata());
+  ARROW_ASSIGN_OR_RAISE(auto row_groups, FilterRowGroups(options->filter));
+
+  std::vector<std::vector<int>> runs;
+  int64_t run_rows = split_rows;
+  for (int row_group : row_groups) {
+    if (run_rows >= split_rows) {
+      runs.emplace_back();
+      run_rows = 0;
+    }
+    runs.back().push_back(row_group);
+    run_rows += metadata_->RowGroup(row_group)->num_rows();
+  }
+  if (runs.size() <= 1) {
+    return FragmentVector{shared_from_this()};
+  }
+
+  FragmentVector fragments;
+  fragments.reserve(runs.size());
+  for (auto& run : runs) {
+    ARROW_ASSIGN_OR_RAISE(auto fragment,
+                          parquet_format_.MakeFragment(source_, partition_expression(),
+                                                       physical_schema_, std::move(run)));
+    RETURN_NOT_OK(fragment->SetMetadata(metadata_, manifest_,
+                                        /*original_metadata=*/original_metadata_));
+    fragments.push_back(std::move(fragment));
+  }
+  return fragments;
+}
+
 Result<std::shared_ptr<Fragment>> ParquetFileFragment::Subset(
     compute::Expression predicate) {
   RETURN_NOT_OK(EnsureCompleteMetadata());
@@ -897,14 +1473,6 @@ Result<std::shared_ptr<Fragment>> ParquetFileFragment::Subset(
   return new_fragment;
 }
 
-inline void FoldingAnd(compute::Expression* l, compute::Expression r) {
-  if (*l == compute::literal(true)) {
-    *l = std::move(r);
-  } else {
-    *l = and_(std::move(*l), std::move(r));
-  }
-}
-
 Result<std::vector<int>> ParquetFileFragment::FilterRowGroups(
     compute::Expression predicate) {
   std::vector<int> row_groups;
@@ -993,6 +1561,56 @@ Result<std::optional<int64_t>> ParquetFileFragment::TryCountRows(
   return metadata()->num_rows();
 }
 
+std::optional<FragmentStatistics> ParquetFileFragment::GetCachedStatistics() {
+  auto lock = physical_schema_mutex_.Lock();
+  if (metadata_ == nullptr) return std::nullopt;
+
+  FragmentStatistics statistics;
+  try {
+    for (int row_group : *row_groups_) {
+      statistics.num_rows += metadata_->RowGroup(row_group)->num_rows();
+    }
+    for (int i = 0; i < physical_schema_->num_fields(); ++i) {
+      const SchemaField& schema_field = manifest_->schema_fields[i];
+      if (!schema_field.is_leaf() || row_groups_->empty()) continue;
+      int64_t distinct_count = 0;
+      bool known = true;
+      for (int row_group : *row_groups_) {
+        auto column_statistics = metadata_->RowGroup(row_group)
+                                     ->ColumnChunk(schema_field.column_index)
+                                     ->statistics();
+        if (column_statistics == nullptr || !column_statistics->HasDistinctCount()) {
+          known = false;
+          break;
+        }
+        distinct_count = std::max(distinct_count, column_statistics->distinct_count());
+      }
+      if (known) {
+        statistics.distinct_counts[physical_schema_->field(i)->name()] = distinct_count;
+      }
+    }
+  } catch (const ::parquet::ParquetException&) {
+    return std::nullopt;
+  }
+  return statistics;
+}
+
+Result<compute::Expression> ParquetFileFragment::GetStatisticsExpression() {
+  RETURN_NOT_OK(EnsureCompleteMetadata());
+  auto lock = physical_schema_mutex_.Lock();
+
+  compute::Expression statistics = compute::literal(true);
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (int i = 0; i < physical_schema_->num_fields(); ++i) {
+    if (auto column_statistics =
+            FileColumnStatisticsAsExpression(manifest_->schema_fields[i], *metadata_)) {
+      FoldingAnd(&statistics, std::move(*column_statistics));
+    }
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  return statistics;
+}
+
 //
 // ParquetFragmentScanOptions
 //
@@ -1003,6 +1621,126 @@ ParquetFragmentScanOptions::ParquetFragmentScanOptions() {
       std::make_shared<parquet::ArrowReaderProperties>(/*use_threads=*/false);
 }
 
+//
+// ParquetMetadataCache
+//
+
+class ParquetMetadataCache::Impl {
+ public:
+  explicit Impl(int64_t capacity) : capacity_(capacity) {}
+
+  std::shared_ptr<parquet::FileMetaData> Get(const FileSource& source) {
+    std::optional<Key> key = MakeKey(source);
+    if (!key) return nullptr;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(*key);
+    if (it == entries_.end()) return nullptr;
+    // Move the entry to the front of the LRU list
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->metadata;
+  }
+
+  void Put(const FileSource& source, std::shared_ptr<parquet::FileMetaData> metadata) {
+    std::optional<Key> key = MakeKey(source);
+    if (!key || metadata == nullptr) return;
+    const int64_t size = static_cast<int64_t>(metadata->size());
+    if (size > capacity_) return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(*key);
+    if (it != entries_.end()) {
+      Erase(it);
+    }
+    lru_.push_front({*key, std::move(metadata), size});
+    entries_.emplace(std::move(*key), lru_.begin());
+    size_ += size;
+    while (size_ > capacity_) {
+      Erase(entries_.find(lru_.back().key));
+    }
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    size_ = 0;
+  }
+
+  int64_t capacity() const { return capacity_; }
+
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_;
+  }
+
+  int64_t num_entries() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(entries_.size());
+  }
+
+ private:
+  // "<filesystem type>:<path>:<size>:<mtime>"
+  using Key = std::string;
+
+  struct Entry {
+    Key key;
+    std::shared_ptr<parquet::FileMetaData> metadata;
+    int64_t size;
+  };
+  using EntryList = std::list<Entry>;
+
+  static std::optional<Key> MakeKey(const FileSource& source) {
+    const fs::FileInfo& info = source.file_info();
+    if (source.filesystem() == nullptr || info.size() == fs::kNoSize ||
+        info.mtime() == fs::kNoTime) {
+      return std::nullopt;
+    }
+    return source.filesystem()->type_name() + ":" + info.path() + ":" +
+           std::to_string(info.size()) + ":" +
+           std::to_string(info.mtime().time_since_epoch().count());
+  }
+
+  void Erase(std::unordered_map<Key, EntryList::iterator>::iterator it) {
+    size_ -= it->second->size;
+    lru_.erase(it->second);
+    entries_.erase(it);
+  }
+
+  const int64_t capacity_;
+  mutable std::mutex mutex_;
+  // Most recently used first
+  EntryList lru_;
+  std::unordered_map<Key, EntryList::iterator> entries_;
+  int64_t size_ = 0;
+};
+
+ParquetMetadataCache::ParquetMetadataCache(int64_t capacity)
+    : impl_(std::make_unique<Impl>(capacity)) {}
+
+ParquetMetadataCache::~ParquetMetadataCache() = default;
+
+const std::shared_ptr<ParquetMetadataCache>& ParquetMetadataCache::Default() {
+  static const auto cache = std::make_shared<ParquetMetadataCache>();
+  return cache;
+}
+
+std::shared_ptr<parquet::FileMetaData> ParquetMetadataCache::Get(
+    const FileSource& source) {
+  return impl_->Get(source);
+}
+
+void ParquetMetadataCache::Put(const FileSource& source,
+                               std::shared_ptr<parquet::FileMetaData> metadata) {
+  impl_->Put(source, std::move(metadata));
+}
+
+void ParquetMetadataCache::Clear() { impl_->Clear(); }
+
+int64_t ParquetMetadataCache::capacity() const { return impl_->capacity(); }
+
+int64_t ParquetMetadataCache::size() const { return impl_->size(); }
+
+int64_t ParquetMetadataCache::num_entries() const { return impl_->num_entries(); }
+
 //
 // ParquetDatasetFactory
 //
@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -33,6 +35,8 @@
 #include "arrow/io/caching.h"
 
 namespace parquet {
+class BloomFilter;
+class ColumnDescriptor;
 class ParquetFileReader;
 class Statistics;
 class ColumnChunkMetaData;
@@ -98,6 +102,10 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
   /// \brief Return the schema of the file if possible.
   Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override;
 
+  /// \brief Read the footer of the file into the metadata cache of the default
+  /// fragment scan options, if they have one.
+  Future<> PrefetchMetadata(const FileSource& source) const override;
+
   Result<RecordBatchGenerator> ScanBatchesAsync(
       const std::shared_ptr<ScanOptions>& options,
       const std::shared_ptr<FileFragment>& file) const override;
@@ -175,6 +183,27 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
 
   Status ClearCachedMetadata() override;
 
+  /// \brief Return the number of rows of the selected RowGroups, and the distinct counts
+  /// of the top-level primitive columns for which every RowGroup has one.
+  ///
+  /// The distinct count of a column is its largest distinct count in a RowGroup.
+  /// This is std::nullopt if the FileMetaData isn't in memory.
+  std::optional<FragmentStatistics> GetCachedStatistics() override;
+
+  /// \brief Split the selected RowGroups into runs of consecutive RowGroups of at
+  /// least ParquetFragmentScanOptions::scan_split_rows rows.
+  ///
+  /// RowGroups which can't satisfy the scan filter are dropped.  The fragment isn't
+  /// split if scan_split_rows is 0 or if the scan doesn't use threads.
+  Result<FragmentVector> SplitForScan(
+      const std::shared_ptr<ScanOptions>& options) override;
+
+  /// \brief Return the range of values of each column in all row groups of the file.
+  ///
+  /// Only top-level columns of primitive type are bounded, when every row group has
+  /// statistics for them.  The row groups selected by this fragment aren't considered.
+  Result<compute::Expression> GetStatisticsExpression() override;
+
   /// \brief Return fragment which selects a filtered subset of this fragment's RowGroups.
   Result<std::shared_ptr<Fragment>> Subset(compute::Expression predicate);
   Result<std::shared_ptr<Fragment>> Subset(std::vector<int> row_group_ids);
@@ -232,6 +261,56 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   friend class ParquetDatasetFactory;
 };
 
+/// \brief A size-bounded cache of Parquet file metadata, shared between scans
+///
+/// Footers are looked up by filesystem type, path, size and modification time, so a
+/// file which was rewritten is read again.  Only files whose size and modification
+/// time are known are cached, which is the case for the files discovered by a
+/// FileSystemDatasetFactory.  When the total serialized size of the cached footers
+/// exceeds the capacity, the least recently used ones are evicted.
+///
+/// This class is thread-safe.
+class ARROW_DS_EXPORT ParquetMetadataCache {
+ public:
+  /// \brief Create a cache holding up to `capacity` bytes of serialized footers
+  explicit ParquetMetadataCache(int64_t capacity = kDefaultCapacity);
+  ~ParquetMetadataCache();
+
+  static constexpr int64_t kDefaultCapacity = 64 << 20;
+
+  /// \brief Return a process-wide cache of the default capacity
+  static const std::shared_ptr<ParquetMetadataCache>& Default();
+
+  /// \brief Return the cached metadata of a file, or null if it isn't cached
+  std::shared_ptr<parquet::FileMetaData> Get(const FileSource& source);
+
+  /// \brief Add the metadata of a file, unless the file can't be cached
+  void Put(const FileSource& source, std::shared_ptr<parquet::FileMetaData> metadata);
+
+  /// \brief Remove all cached metadata
+  void Clear();
+
+  int64_t capacity() const;
+  /// \brief Return the total serialized size of the cached footers
+  int64_t size() const;
+  /// \brief Return the number of cached footers
+  int64_t num_entries() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Counters of the work saved while scanning Parquet fragments
+///
+/// The counters are updated concurrently by all fragments scanned with the
+/// ParquetFragmentScanOptions referencing them.
+struct ARROW_DS_EXPORT ParquetScanMetrics {
+  /// The number of row groups skipped because the bloom filters of their column
+  /// chunks show that no row can satisfy the scan filter
+  std::atomic<int64_t> row_groups_pruned_by_bloom_filter{0};
+};
+
 /// \brief Per-scan options for Parquet fragments
 class ARROW_DS_EXPORT ParquetFragmentScanOptions : public FragmentScanOptions {
  public:
@@ -247,6 +326,45 @@ class ARROW_DS_EXPORT ParquetFragmentScanOptions : public FragmentScanOptions {
   std::shared_ptr<parquet::ArrowReaderProperties> arrow_reader_properties;
   /// A configuration structure that provides decryption properties for a dataset
   std::shared_ptr<ParquetDecryptionConfig> parquet_decryption_config = NULLPTR;
+  /// Use the page index of the file, when present, to skip the data pages whose
+  /// statistics show that none of their rows can satisfy the scan filter.
+  ///
+  /// This is off by default since loading the page index costs additional IO which
+  /// is only worth it for selective filters.
+  bool page_index_filtering = false;
+  /// Decode the columns referenced by the scan filter first, evaluate the filter,
+  /// and then decode only the matching rows of the other projected columns.
+  ///
+  /// This saves decoding work on wide projections with selective filters on a few
+  /// narrow columns.  The filter columns are decoded twice, once to evaluate the filter
+  /// and once more for the matching rows, and all row groups of a fragment are
+  /// filtered before its first batch is returned.
+  bool late_materialization = false;
+  /// A cache of file metadata, e.g. ParquetMetadataCache::Default(), to look up before
+  /// reading the footer of a file and to add the footers read to.
+  ///
+  /// Without a cache, the footer of a file is read and parsed again by each fragment
+  /// made for it.  Footers of encrypted files are never cached.
+  std::shared_ptr<ParquetMetadataCache> metadata_cache;
+  /// Use the bloom filters of the file, when present, to skip the row groups in which
+  /// no row can satisfy the equality and `is_in` comparisons of the scan filter.
+  ///
+  /// The bloom filters of the compared columns are read with coalesced reads,
+  /// according to ArrowReaderProperties::cache_options(), before any row group is
+  /// read.  This is off by default since the additional IO is only worth it for
+  /// selective filters on high-cardinality columns.  Bloom filters of encrypted
+  /// files are not used.
+  bool bloom_filter_filtering = false;
+  /// If positive, a threaded scan splits each file into sub-fragments of consecutive
+  /// row groups with at least this many rows, and scans up to
+  /// ScanOptions::fragment_readahead of them in parallel.
+  ///
+  /// This lets the scan of a dataset of a few large files use more cores.  The
+  /// batches are still returned in order when the scan is ordered, but each
+  /// sub-fragment opens its own reader.
+  int64_t scan_split_rows = 0;
+  /// Where to count the work saved by the options above, may be null.
+  std::shared_ptr<ParquetScanMetrics> scan_metrics;
 };
 
 class ARROW_DS_EXPORT ParquetFileWriteOptions : public FileWriteOptions {
@@ -405,5 +523,17 @@ class ARROW_DS_EXPORT ParquetDatasetFactory : public DatasetFactory {
 
 /// @}
 
+namespace internal {
+
+/// \brief Whether the bloom filter of a Parquet column may contain a value
+///
+/// Returns true if the value can't be looked up in the bloom filter.  Exposed for
+/// testing.
+ARROW_DS_EXPORT bool BloomFilterMayContain(const parquet::BloomFilter& bloom_filter,
+                                           const parquet::ColumnDescriptor& descr,
+                                           const Scalar& value);
+
+}  // namespace internal
+
 }  // namespace dataset
 }  // namespace arrow
@@ -17,6 +17,7 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <limits>
 #include <memory>
 #include <thread>
 #include <utility>
@@ -24,8 +25,10 @@
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/discovery.h"
 #include "arrow/dataset/parquet_encryption_config.h"
 #include "arrow/dataset/test_util_internal.h"
+#include "arrow/filesystem/localfs.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/test_common.h"
@@ -40,8 +43,10 @@
 #include "arrow/util/range.h"
 
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/schema.h"
 #include "parquet/statistics.h"
 #include "parquet/types.h"
 
@@ -362,6 +367,124 @@ TEST_F(TestParquetFileFormat, CachedMetadata) {
   ASSERT_NE(nullptr, pq_fragment->metadata());
 }
 
+TEST_F(TestParquetFileFormat, MetadataCache) {
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(
+      fs::TimePoint(std::chrono::hours(1)));
+  auto table = TableFromJSON(schema({field("x", int32())}), {"[[0], [1], [2]]"});
+  std::vector<std::string> paths = {"/a.parquet", "/b.parquet"};
+  for (const std::string& path : paths) {
+    ASSERT_OK_AND_ASSIGN(auto out_stream, mock_fs->OpenOutputStream(path));
+    ASSERT_OK(parquet::arrow::WriteTable(*table, default_memory_pool(), out_stream));
+    ASSERT_OK(out_stream->Close());
+  }
+  ASSERT_OK_AND_ASSIGN(auto infos, mock_fs->GetFileInfo(paths));
+
+  auto cache = std::make_shared<ParquetMetadataCache>();
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->metadata_cache = cache;
+  format_->default_fragment_scan_options = fragment_scan_options;
+
+  // Fragments made for the same file share its metadata
+  auto get_metadata = [&](FileSource source) -> std::shared_ptr<parquet::FileMetaData> {
+    EXPECT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(std::move(source)));
+    auto& parquet_fragment = checked_cast<ParquetFileFragment&>(*fragment);
+    ARROW_EXPECT_OK(parquet_fragment.EnsureCompleteMetadata());
+    return parquet_fragment.metadata();
+  };
+  auto metadata = get_metadata({infos[0], mock_fs});
+  ASSERT_NE(nullptr, metadata);
+  ASSERT_EQ(1, cache->num_entries());
+  ASSERT_EQ(metadata->size(), cache->size());
+  ASSERT_EQ(metadata, get_metadata({infos[0], mock_fs}));
+  ASSERT_EQ(metadata, cache->Get({infos[0], mock_fs}));
+
+  // Another file, or the same file with another modification time, is read again
+  ASSERT_NE(metadata, get_metadata({infos[1], mock_fs}));
+  ASSERT_EQ(2, cache->num_entries());
+  fs::FileInfo modified = infos[0];
+  modified.set_mtime(modified.mtime() + std::chrono::seconds(1));
+  ASSERT_EQ(nullptr, cache->Get({modified, mock_fs}));
+  ASSERT_NE(metadata, get_metadata({modified, mock_fs}));
+  ASSERT_EQ(3, cache->num_entries());
+
+  // Files of unknown size or modification time are not cached
+  ASSERT_NE(nullptr, get_metadata({paths[0], mock_fs}));
+  ASSERT_EQ(3, cache->num_entries());
+
+  cache->Clear();
+  ASSERT_EQ(0, cache->num_entries());
+  ASSERT_EQ(0, cache->size());
+
+  // The least recently used metadata is evicted first
+  auto small_cache = std::make_shared<ParquetMetadataCache>(2 * metadata->size());
+  fragment_scan_options->metadata_cache = small_cache;
+  get_metadata({infos[0], mock_fs});
+  get_metadata({infos[1], mock_fs});
+  ASSERT_NE(nullptr, small_cache->Get({infos[0], mock_fs}));
+  get_metadata({modified, mock_fs});
+  ASSERT_EQ(2, small_cache->num_entries());
+  ASSERT_NE(nullptr, small_cache->Get({infos[0], mock_fs}));
+  ASSERT_EQ(nullptr, small_cache->Get({infos[1], mock_fs}));
+  ASSERT_NE(nullptr, small_cache->Get({modified, mock_fs}));
+}
+
+TEST_F(TestParquetFileFormat, StatisticsExpression) {
+  auto table = TableFromJSON(schema({field("x", int32()), field("y", utf8()),
+                                     field("s", struct_({field("z", int32())}))}),
+                             {R"([{"x": 1, "y": "b", "s": {"z": 1}},
+                                  {"x": 5, "y": "a", "s": {"z": 2}},
+                                  {"x": null, "y": "d", "s": {"z": 3}},
+                                  {"x": 3, "y": "c", "s": {"z": 4}}])"});
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK(parquet::arrow::WriteTable(*table, default_memory_pool(), sink,
+                                       /*chunk_size=*/2));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  // Nested columns are not bounded
+  auto x = field_ref("x");
+  auto y = field_ref("y");
+  ASSERT_OK_AND_ASSIGN(auto statistics, fragment->GetStatisticsExpression());
+  ASSERT_EQ(statistics,
+            and_(or_(and_(greater_equal(x, literal(1)), less_equal(x, literal(5))),
+                     is_null(x)),
+                 and_(greater_equal(y, literal("a")), less_equal(y, literal("d")))));
+}
+
+TEST_F(TestParquetFileFormat, PrefetchMetadataWhileListing) {
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(
+      fs::TimePoint(std::chrono::hours(1)));
+  auto table = TableFromJSON(schema({field("x", int32())}), {"[[0], [1], [2]]"});
+  for (const std::string path : {"/data/a.parquet", "/data/b.parquet"}) {
+    ASSERT_OK_AND_ASSIGN(auto out_stream, mock_fs->OpenOutputStream(path));
+    ASSERT_OK(parquet::arrow::WriteTable(*table, default_memory_pool(), out_stream));
+    ASSERT_OK(out_stream->Close());
+  }
+
+  // Without a metadata cache, there is nothing to prefetch into
+  ASSERT_FINISHES_OK(format_->PrefetchMetadata({"/data/a.parquet", mock_fs}));
+
+  auto cache = std::make_shared<ParquetMetadataCache>();
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->metadata_cache = cache;
+  format_->default_fragment_scan_options = fragment_scan_options;
+
+  fs::FileSelector selector;
+  selector.base_dir = "/data";
+  FileSystemFactoryOptions factory_options;
+  factory_options.prefetch_metadata = true;
+  ASSERT_OK_AND_ASSIGN(auto factory, FileSystemDatasetFactory::Make(
+                                         mock_fs, selector, format_, factory_options));
+  InspectOptions inspect_options;
+  inspect_options.fragments = InspectOptions::kInspectAllFragments;
+  ASSERT_OK_AND_ASSIGN(auto schema, factory->Inspect(inspect_options));
+  AssertSchemaEqual(*table->schema(), *schema, /*check_metadata=*/false);
+
+  // Wait for the prefetches which were not awaited by Inspect
+  BusyWait(10, [&] { return cache->num_entries() == 2; });
+  ASSERT_EQ(2, cache->num_entries());
+}
+
 TEST_F(TestParquetFileFormat, MultithreadedScan) {
   constexpr int64_t kNumRowGroups = 16;
 
@@ -387,6 +510,49 @@ TEST_F(TestParquetFileFormat, MultithreadedScan) {
   ASSERT_EQ(batches.size(), kNumRowGroups);
 }
 
+TEST_F(TestParquetFileFormat, SplitForScan) {
+  constexpr int64_t kNumRowGroups = 16;
+
+  // Row group i holds i + 1 rows, see PredicatePushdown test below
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+  auto fragment = MakeFragment(*source);
+  auto options = std::make_shared<ScanOptions>();
+  options->use_threads = true;
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  options->fragment_scan_options = fragment_scan_options;
+
+  ASSERT_OK_AND_ASSIGN(auto parts, fragment->SplitForScan(options));
+  ASSERT_EQ(parts.size(), 1U);
+  ASSERT_EQ(parts[0], fragment);
+
+  fragment_scan_options->scan_split_rows = 10;
+  ASSERT_OK_AND_ASSIGN(parts, fragment->SplitForScan(options));
+  std::vector<std::vector<int>> row_groups;
+  for (const auto& part : parts) {
+    row_groups.push_back(checked_cast<const ParquetFileFragment&>(*part).row_groups());
+  }
+  std::vector<std::vector<int>> expected_row_groups = {
+      {0, 1, 2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13}, {14, 15}};
+  ASSERT_EQ(row_groups, expected_row_groups);
+
+  // The parts are scanned in parallel and in order
+  FragmentDataset dataset(ArithmeticDatasetFixture::schema(), {fragment});
+  auto scan = [&](int64_t scan_split_rows) -> Result<std::shared_ptr<Table>> {
+    auto split_options = std::make_shared<ParquetFragmentScanOptions>();
+    split_options->scan_split_rows = scan_split_rows;
+    ScannerBuilder builder({&dataset, [](...) {}});
+    RETURN_NOT_OK(builder.UseThreads(true));
+    RETURN_NOT_OK(builder.FragmentScanOptions(split_options));
+    RETURN_NOT_OK(builder.Project({field_ref("i64")}, {"i64"}));
+    ARROW_ASSIGN_OR_RAISE(auto scanner, builder.Finish());
+    return scanner->ToTable();
+  };
+  ASSERT_OK_AND_ASSIGN(auto expected, scan(0));
+  ASSERT_OK_AND_ASSIGN(auto actual, scan(10));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST_F(TestParquetFileFormat, SingleThreadExecutor) {
   // Reset capacity for io executor
   struct PoolResetGuard {
@@ -410,6 +576,146 @@ TEST_F(TestParquetFileFormat, SingleThreadExecutor) {
   }
 }
 
+TEST_F(TestParquetFileFormat, PageIndexFiltering) {
+  // A single row group of four pages of two rows each
+  auto table = TableFromJSON(schema({field("i64", int64())}),
+                             {R"([[0], [1], [2], [3], [null], [5], [6], [7]])"});
+  auto properties = WriterProperties::Builder()
+                        .enable_write_page_index()
+                        ->data_pagesize(1)
+                        ->write_batch_size(2)
+                        ->build();
+  auto sink = parquet::CreateOutputStream();
+  ASSERT_OK(parquet::arrow::WriteTable(*table, default_memory_pool(), sink,
+                                       /*chunk_size=*/table->num_rows(), properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto fragment = MakeFragment(FileSource(buffer));
+  SetSchema(table->schema()->fields());
+
+  // Without post-filtering whole row groups are returned by default
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  opts_->fragment_scan_options = fragment_scan_options;
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(5)));
+  CountRowsAndBatchesInScan(fragment, 8, 1);
+
+  fragment_scan_options->page_index_filtering = true;
+  CountRowsAndBatchesInScan(fragment, 2, 1);
+  SetFilter(greater(field_ref("i64"), literal<int64_t>(5)));
+  CountRowsAndBatchesInScan(fragment, 2, 1);
+  SetFilter(is_null(field_ref("i64")));
+  CountRowsAndBatchesInScan(fragment, 2, 1);
+  SetFilter(or_(less(field_ref("i64"), literal<int64_t>(2)),
+                equal(field_ref("i64"), literal<int64_t>(6))));
+  CountRowsAndBatchesInScan(fragment, 4, 1);
+  SetFilter(literal(true));
+  CountRowsAndBatchesInScan(fragment, 8, 1);
+
+  SetFilter(greater_equal(field_ref("i64"), literal<int64_t>(3)));
+  AssertBatchesEqual(
+      *RecordBatchFromJSON(table->schema(), "[[2], [3], [null], [5], [6], [7]]"),
+      *SingleBatch(fragment.get()));
+}
+
+TEST_F(TestParquetFileFormat, LateMaterialization) {
+  auto table = TableFromJSON(schema({field("i64", int64()), field("str", utf8())}),
+                             {R"([[0, "a"], [1, "b"], [2, "c"], [null, "d"]])",
+                              R"([[4, "e"], [5, null], [6, "g"], [7, "h"]])"});
+  auto sink = parquet::CreateOutputStream();
+  ASSERT_OK(parquet::arrow::WriteTable(*table, default_memory_pool(), sink,
+                                       /*chunk_size=*/4));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto fragment = MakeFragment(FileSource(buffer));
+  SetSchema(table->schema()->fields());
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->late_materialization = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+
+  // Only the matching rows are decoded, even though the fragment is not post-filtered
+  SetFilter(greater(field_ref("i64"), literal<int64_t>(1)));
+  ASSERT_OK_AND_ASSIGN(auto batches, Batches(fragment.get()).ToVector());
+  ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(table->schema(), batches));
+  AssertTablesEqual(*TableFromJSON(table->schema(),
+                                   {R"([[2, "c"], [4, "e"], [5, null], [6, "g"],
+                                        [7, "h"]])"}),
+                    *actual, /*same_chunk_layout=*/false);
+
+  SetFilter(is_null(field_ref("str")));
+  CountRowsAndBatchesInScan(fragment, 1, 1);
+  SetFilter(and_(less(field_ref("i64"), literal<int64_t>(6)),
+                 equal(field_ref("str"), literal("e"))));
+  CountRowsAndBatchesInScan(fragment, 1, 1);
+  SetFilter(literal(true));
+  CountRowsAndBatchesInScan(fragment, 8, 2);
+}
+
+TEST_F(TestParquetFileFormat, BloomFilterFiltering) {
+  // A single row group with a bloom filter of its only, string, column
+  ASSERT_OK_AND_ASSIGN(std::string dir_string,
+                       arrow::internal::GetEnvVar("PARQUET_TEST_DATA"));
+  const std::string path = dir_string + "/data_index_bloom_encoding_stats.parquet";
+  const int64_t num_rows =
+      parquet::ParquetFileReader::OpenFile(path)->metadata()->num_rows();
+  FileSource source(path, std::make_shared<fs::LocalFileSystem>());
+  ASSERT_OK_AND_ASSIGN(auto physical_schema, format_->Inspect(source));
+  auto fragment = MakeFragment(source);
+  SetSchema(physical_schema->fields());
+  const std::string& name = physical_schema->field(0)->name();
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->scan_metrics = std::make_shared<ParquetScanMetrics>();
+  const auto& pruned =
+      fragment_scan_options->scan_metrics->row_groups_pruned_by_bloom_filter;
+  opts_->fragment_scan_options = fragment_scan_options;
+
+  // The value is within the statistics of the row group
+  SetFilter(equal(field_ref(name), literal("NOT_EXISTS")));
+  CountRowsAndBatchesInScan(fragment, num_rows, 1);
+  ASSERT_EQ(0, pruned.load());
+
+  fragment_scan_options->bloom_filter_filtering = true;
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  ASSERT_EQ(1, pruned.load());
+  SetFilter(equal(field_ref(name), literal("Hello")));
+  CountRowsAndBatchesInScan(fragment, num_rows, 1);
+  SetFilter(call("is_in", {field_ref(name)},
+                 compute::SetLookupOptions{ArrayFromJSON(utf8(), R"(["NOT_EXISTS"])")}));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  SetFilter(call("is_in", {field_ref(name)},
+                 compute::SetLookupOptions{
+                     ArrayFromJSON(utf8(), R"(["NOT_EXISTS", "Hello"])")}));
+  CountRowsAndBatchesInScan(fragment, num_rows, 1);
+  SetFilter(or_(equal(field_ref(name), literal("NOT_EXISTS")),
+                not_equal(field_ref(name), literal("Hello"))));
+  CountRowsAndBatchesInScan(fragment, num_rows, 1);
+  SetFilter(and_(equal(field_ref(name), literal("NOT_EXISTS")),
+                 not_equal(field_ref(name), literal("Hello"))));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  ASSERT_EQ(3, pruned.load());
+}
+
+TEST(BloomFilterMayContain, FloatingPoint) {
+  parquet::ColumnDescriptor descr(
+      parquet::schema::PrimitiveNode::Make("x", parquet::Repetition::OPTIONAL,
+                                           parquet::Type::DOUBLE),
+      /*max_definition_level=*/1, /*max_repetition_level=*/0);
+  parquet::BlockSplitBloomFilter bloom_filter;
+  bloom_filter.Init(parquet::BlockSplitBloomFilter::OptimalNumOfBytes(10, 0.001));
+  bloom_filter.InsertHash(bloom_filter.Hash(-0.0));
+  bloom_filter.InsertHash(bloom_filter.Hash(1.5));
+
+  ASSERT_TRUE(internal::BloomFilterMayContain(bloom_filter, descr, DoubleScalar(1.5)));
+  ASSERT_FALSE(internal::BloomFilterMayContain(bloom_filter, descr, DoubleScalar(2.5)));
+  // Both signed zeros may match a -0.0 in the row group
+  ASSERT_TRUE(internal::BloomFilterMayContain(bloom_filter, descr, DoubleScalar(0.0)));
+  ASSERT_TRUE(internal::BloomFilterMayContain(bloom_filter, descr, DoubleScalar(-0.0)));
+  // NaNs are never ruled out
+  ASSERT_TRUE(internal::BloomFilterMayContain(
+      bloom_filter, descr, DoubleScalar(std::numeric_limits<double>::quiet_NaN())));
+  // Nor are values of another physical type
+  ASSERT_TRUE(internal::BloomFilterMayContain(bloom_filter, descr, FloatScalar(2.5f)));
+}
+
 class TestParquetFileSystemDataset : public WriteFileSystemDatasetMixin,
                                      public testing::Test {
  public:
@@ -0,0 +1,233 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/manifest.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/buffer.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/key_value_metadata.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+
+using internal::checked_pointer_cast;
+
+namespace dataset {
+
+namespace {
+
+constexpr char kManifestVersionKey[] = "arrow.dataset.manifest.version";
+constexpr char kManifestVersion[] = "1";
+constexpr char kManifestSchemaKey[] = "arrow.dataset.manifest.schema";
+
+std::shared_ptr<Schema> ManifestSchema() {
+  return schema({field("path", utf8(), /*nullable=*/false), field("size", int64()),
+                 field("mtime", timestamp(TimeUnit::NANO)),
+                 field("partition_expression", binary()),
+                 field("statistics", binary())});
+}
+
+Status InvalidManifest(const std::string& reason) {
+  return Status::Invalid("Invalid dataset manifest: ", reason);
+}
+
+Status AppendExpression(const compute::Expression& expr, BinaryBuilder* builder) {
+  if (expr == compute::literal(true)) {
+    return builder->AppendNull();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto serialized, compute::Serialize(expr));
+  return builder->Append(serialized->data(), serialized->size());
+}
+
+Result<compute::Expression> GetExpression(const BinaryArray& array, int64_t i) {
+  if (array.IsNull(i)) {
+    return compute::literal(true);
+  }
+  return compute::Deserialize(std::make_shared<Buffer>(array.GetView(i)));
+}
+
+template <typename ArrayType>
+Result<std::shared_ptr<ArrayType>> GetColumn(const RecordBatch& batch,
+                                             const std::string& name) {
+  auto column = batch.GetColumnByName(name);
+  if (column == nullptr || column->type_id() != ArrayType::TypeClass::type_id) {
+    return InvalidManifest("missing or mistyped column '" + name + "'");
+  }
+  return checked_pointer_cast<ArrayType>(std::move(column));
+}
+
+}  // namespace
+
+Result<DatasetManifest> DatasetManifest::Make(
+    const std::shared_ptr<FileSystemDataset>& dataset) {
+  DatasetManifest manifest;
+  manifest.schema = dataset->schema();
+
+  std::vector<std::shared_ptr<FileFragment>> fragments;
+  ARROW_ASSIGN_OR_RAISE(auto fragment_it, dataset->GetFragments());
+  for (auto maybe_fragment : fragment_it) {
+    ARROW_ASSIGN_OR_RAISE(auto fragment, std::move(maybe_fragment));
+    fragments.push_back(checked_pointer_cast<FileFragment>(std::move(fragment)));
+  }
+  manifest.files.resize(fragments.size());
+  RETURN_NOT_OK(::arrow::internal::ParallelFor(
+      static_cast<int>(fragments.size()), [&](int i) -> Status {
+        const auto& fragment = fragments[i];
+        File& file = manifest.files[i];
+        if (fragment->source().buffer() != nullptr) {
+          return Status::NotImplemented(
+              "Dataset manifest of fragments which aren't files");
+        }
+        file.info = fragment->source().file_info();
+        file.partition_expression = fragment->partition_expression();
+        ARROW_ASSIGN_OR_RAISE(file.statistics, fragment->GetStatisticsExpression());
+        return Status::OK();
+      }));
+  return manifest;
+}
+
+Status DatasetManifest::Write(io::OutputStream* sink) const {
+  if (schema == nullptr) {
+    return InvalidManifest("no dataset schema");
+  }
+
+  StringBuilder paths;
+  Int64Builder sizes;
+  TimestampBuilder mtimes(timestamp(TimeUnit::NANO), default_memory_pool());
+  BinaryBuilder partition_expressions, statistics;
+  for (const auto& file : files) {
+    RETURN_NOT_OK(paths.Append(file.info.path()));
+    if (file.info.size() == fs::kNoSize) {
+      RETURN_NOT_OK(sizes.AppendNull());
+    } else {
+      RETURN_NOT_OK(sizes.Append(file.info.size()));
+    }
+    if (file.info.mtime() == fs::kNoTime) {
+      RETURN_NOT_OK(mtimes.AppendNull());
+    } else {
+      RETURN_NOT_OK(mtimes.Append(file.info.mtime().time_since_epoch().count()));
+    }
+    RETURN_NOT_OK(AppendExpression(file.partition_expression, &partition_expressions));
+    RETURN_NOT_OK(AppendExpression(file.statistics, &statistics));
+  }
+  ArrayVector columns(5);
+  RETURN_NOT_OK(paths.Finish(&columns[0]));
+  RETURN_NOT_OK(sizes.Finish(&columns[1]));
+  RETURN_NOT_OK(mtimes.Finish(&columns[2]));
+  RETURN_NOT_OK(partition_expressions.Finish(&columns[3]));
+  RETURN_NOT_OK(statistics.Finish(&columns[4]));
+  auto manifest_schema = ManifestSchema();
+  auto batch = RecordBatch::Make(manifest_schema, static_cast<int64_t>(files.size()),
+                                 std::move(columns));
+
+  ARROW_ASSIGN_OR_RAISE(auto serialized_schema, ipc::SerializeSchema(*schema));
+  auto metadata = key_value_metadata(
+      {kManifestVersionKey, kManifestSchemaKey},
+      {kManifestVersion, util::base64_encode(std::string_view(*serialized_schema))});
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        ipc::MakeFileWriter(sink, manifest_schema,
+                                            ipc::IpcWriteOptions::Defaults(), metadata));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  return writer->Close();
+}
+
+Result<DatasetManifest> DatasetManifest::Read(io::RandomAccessFile* file) {
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(file));
+  const auto& metadata = reader->metadata();
+  if (metadata == nullptr) {
+    return InvalidManifest("no metadata");
+  }
+  auto version = metadata->Get(kManifestVersionKey);
+  if (!version.ok() || *version != kManifestVersion) {
+    return InvalidManifest("unsupported version");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto encoded_schema, metadata->Get(kManifestSchemaKey));
+
+  DatasetManifest manifest;
+  io::BufferReader schema_reader(Buffer::FromString(util::base64_decode(encoded_schema)));
+  ipc::DictionaryMemo dictionary_memo;
+  ARROW_ASSIGN_OR_RAISE(manifest.schema,
+                        ipc::ReadSchema(&schema_reader, &dictionary_memo));
+
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+    ARROW_ASSIGN_OR_RAISE(auto paths, GetColumn<StringArray>(*batch, "path"));
+    ARROW_ASSIGN_OR_RAISE(auto sizes, GetColumn<Int64Array>(*batch, "size"));
+    ARROW_ASSIGN_OR_RAISE(auto mtimes, GetColumn<TimestampArray>(*batch, "mtime"));
+    ARROW_ASSIGN_OR_RAISE(auto partition_expressions,
+                          GetColumn<BinaryArray>(*batch, "partition_expression"));
+    ARROW_ASSIGN_OR_RAISE(auto statistics, GetColumn<BinaryArray>(*batch, "statistics"));
+    if (paths->null_count() != 0) {
+      return InvalidManifest("null path");
+    }
+
+    for (int64_t row = 0; row < batch->num_rows(); ++row) {
+      File file;
+      file.info.set_path(paths->GetString(row));
+      file.info.set_type(fs::FileType::File);
+      if (sizes->IsValid(row)) {
+        file.info.set_size(sizes->Value(row));
+      }
+      if (mtimes->IsValid(row)) {
+        file.info.set_mtime(fs::TimePoint(fs::TimePoint::duration(mtimes->Value(row))));
+      }
+      ARROW_ASSIGN_OR_RAISE(file.partition_expression,
+                            GetExpression(*partition_expressions, row));
+      ARROW_ASSIGN_OR_RAISE(file.statistics, GetExpression(*statistics, row));
+      manifest.files.push_back(std::move(file));
+    }
+  }
+  return manifest;
+}
+
+Result<std::vector<std::shared_ptr<FileFragment>>> DatasetManifest::MakeFragments(
+    const std::shared_ptr<fs::FileSystem>& filesystem,
+    const std::shared_ptr<FileFormat>& format) const {
+  std::vector<std::shared_ptr<FileFragment>> fragments;
+  fragments.reserve(files.size());
+  for (const auto& file : files) {
+    compute::Expression guarantee = file.partition_expression;
+    if (file.statistics != compute::literal(true)) {
+      guarantee = guarantee == compute::literal(true)
+                      ? file.statistics
+                      : compute::and_(std::move(guarantee), file.statistics);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto fragment,
+                          format->MakeFragment({file.info, filesystem}, guarantee));
+    fragments.push_back(std::move(fragment));
+  }
+  return fragments;
+}
+
+}  // namespace dataset
+}  // namespace arrow
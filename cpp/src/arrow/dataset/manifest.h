@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/expression.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/io/type_fwd.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A serializable listing of the files of a FileSystemDataset
+///
+/// A manifest records the schema of a dataset and, for each of its files, the path,
+/// size and modification time, the partition expression and the statistics of the
+/// file (see FileFragment::GetStatisticsExpression).  Opening a dataset from a
+/// manifest, with FileSystemDatasetFactory, neither lists the file system nor reads
+/// the metadata of the files, and the statistics of each file are added to the
+/// partition expression of its fragment so that scans skip files without IO.
+///
+/// Manifests are stored as Arrow IPC files with one row per file.  Each fragment is
+/// recorded as its whole file, so fragments selecting a part of a file, such as the
+/// row group subsets of ParquetFileFragment, are not supported.
+/// \ingroup dataset-filesystem
+struct ARROW_DS_EXPORT DatasetManifest {
+  struct File {
+    /// The path of the file, and its size and modification time if known
+    fs::FileInfo info;
+    /// The partition expression of the fragment
+    compute::Expression partition_expression = compute::literal(true);
+    /// An expression true for every row of the file, derived from its statistics
+    compute::Expression statistics = compute::literal(true);
+  };
+
+  /// The schema of the dataset
+  std::shared_ptr<Schema> schema;
+  std::vector<File> files;
+
+  /// \brief Record the files of a dataset
+  ///
+  /// The statistics of the files are read concurrently, which may read their
+  /// metadata.
+  static Result<DatasetManifest> Make(const std::shared_ptr<FileSystemDataset>& dataset);
+
+  /// \brief Read a manifest written by Write()
+  static Result<DatasetManifest> Read(io::RandomAccessFile* file);
+
+  /// \brief Write the manifest as an Arrow IPC file
+  Status Write(io::OutputStream* sink) const;
+
+  /// \brief Make the fragments of the files of the manifest
+  ///
+  /// The partition expression of each fragment is the conjunction of the partition
+  /// expression and the statistics recorded for its file.
+  Result<std::vector<std::shared_ptr<FileFragment>>> MakeFragments(
+      const std::shared_ptr<fs::FileSystem>& filesystem,
+      const std::shared_ptr<FileFormat>& format) const;
+};
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,159 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/manifest.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/test_util_internal.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+class TestDatasetManifest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    schema_ = schema({field("x", int32()), field("part", utf8())});
+    format_ = std::make_shared<DummyFileFormat>(schema_);
+    fs_ = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+
+    manifest_.schema = schema_;
+    fs::FileInfo a("data/part=a/0.dummy", fs::FileType::File);
+    a.set_size(100);
+    a.set_mtime(fs::TimePoint(std::chrono::seconds(12345)));
+    manifest_.files.push_back({a, equal(field_ref("part"), literal("a")),
+                               and_(greater(field_ref("x"), literal(0)),
+                                    less_equal(field_ref("x"), literal(10)))});
+    fs::FileInfo b("data/part=b/0.dummy", fs::FileType::File);
+    manifest_.files.push_back({b, equal(field_ref("part"), literal("b")),
+                               and_(greater(field_ref("x"), literal(10)),
+                                    less_equal(field_ref("x"), literal(20)))});
+    manifest_.files.push_back({fs::FileInfo("data/1.dummy", fs::FileType::File)});
+  }
+
+  Result<DatasetManifest> RoundTrip(const DatasetManifest& manifest) {
+    ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+    RETURN_NOT_OK(manifest.Write(sink.get()));
+    ARROW_ASSIGN_OR_RAISE(auto buffer, sink->Finish());
+    io::BufferReader source(std::move(buffer));
+    return DatasetManifest::Read(&source);
+  }
+
+  void AssertManifestEqual(const DatasetManifest& expected,
+                           const DatasetManifest& actual) {
+    AssertSchemaEqual(*expected.schema, *actual.schema);
+    ASSERT_EQ(expected.files.size(), actual.files.size());
+    for (size_t i = 0; i < expected.files.size(); ++i) {
+      ASSERT_EQ(expected.files[i].info, actual.files[i].info);
+      ASSERT_EQ(expected.files[i].partition_expression,
+                actual.files[i].partition_expression);
+      ASSERT_EQ(expected.files[i].statistics, actual.files[i].statistics);
+    }
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<FileFormat> format_;
+  std::shared_ptr<fs::FileSystem> fs_;
+  DatasetManifest manifest_;
+};
+
+TEST_F(TestDatasetManifest, RoundTrip) {
+  ASSERT_OK_AND_ASSIGN(auto manifest, RoundTrip(manifest_));
+  AssertManifestEqual(manifest_, manifest);
+
+  DatasetManifest empty;
+  empty.schema = schema_;
+  ASSERT_OK_AND_ASSIGN(manifest, RoundTrip(empty));
+  AssertManifestEqual(empty, manifest);
+
+  ASSERT_RAISES(Invalid, RoundTrip(DatasetManifest{}));
+}
+
+TEST_F(TestDatasetManifest, ReadInvalid) {
+  // An IPC file which isn't a manifest
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(sink, schema_));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  io::BufferReader source(std::move(buffer));
+  ASSERT_RAISES(Invalid, DatasetManifest::Read(&source));
+}
+
+TEST_F(TestDatasetManifest, MakeFromDataset) {
+  ASSERT_OK_AND_ASSIGN(auto fragments, manifest_.MakeFragments(fs_, format_));
+  ASSERT_OK_AND_ASSIGN(auto dataset,
+                       FileSystemDataset::Make(schema_, literal(true), format_, fs_,
+                                               std::move(fragments)));
+  ASSERT_OK_AND_ASSIGN(auto manifest, DatasetManifest::Make(dataset));
+
+  // DummyFileFormat doesn't have statistics, those of the manifest were folded in
+  // the partition expressions
+  ASSERT_EQ(manifest.files.size(), manifest_.files.size());
+  for (const auto& expected : manifest_.files) {
+    auto file = std::find_if(
+        manifest.files.begin(), manifest.files.end(),
+        [&](const DatasetManifest::File& file) { return file.info == expected.info; });
+    ASSERT_NE(file, manifest.files.end()) << expected.info.path();
+    ASSERT_EQ(file->statistics, literal(true));
+    if (expected.statistics == literal(true)) {
+      ASSERT_EQ(file->partition_expression, expected.partition_expression);
+    } else {
+      ASSERT_EQ(file->partition_expression,
+                and_(expected.partition_expression, expected.statistics));
+    }
+  }
+}
+
+TEST_F(TestDatasetManifest, DatasetFactory) {
+  ASSERT_OK_AND_ASSIGN(auto manifest, RoundTrip(manifest_));
+  ASSERT_OK_AND_ASSIGN(
+      auto factory,
+      FileSystemDatasetFactory::Make(fs_, std::move(manifest), format_, {}));
+  ASSERT_OK_AND_ASSIGN(auto inspected, factory->Inspect());
+  AssertSchemaEqual(*schema_, *inspected);
+
+  ASSERT_OK_AND_ASSIGN(auto dataset, factory->Finish());
+  AssertFilesAre(dataset, {"data/part=a/0.dummy", "data/part=b/0.dummy", "data/1.dummy"});
+
+  // The statistics prune fragments without reading the files
+  ASSERT_OK_AND_ASSIGN(auto predicate,
+                       greater(field_ref("x"), literal(15)).Bind(*schema_));
+  ASSERT_OK_AND_ASSIGN(auto fragment_it, dataset->GetFragments(predicate));
+  AssertFragmentsAreFromPath(std::move(fragment_it),
+                             {"data/part=b/0.dummy", "data/1.dummy"});
+  ASSERT_OK_AND_ASSIGN(predicate, equal(field_ref("part"), literal("a")).Bind(*schema_));
+  ASSERT_OK_AND_ASSIGN(fragment_it, dataset->GetFragments(predicate));
+  AssertFragmentsAreFromPath(std::move(fragment_it),
+                             {"data/part=a/0.dummy", "data/1.dummy"});
+}
+
+}  // namespace dataset
+}  // namespace arrow
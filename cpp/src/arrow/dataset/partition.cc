@@ -19,7 +19,9 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -201,6 +203,62 @@ std::ostream& operator<<(std::ostream& os, SegmentEncoding segment_encoding) {
   return os;
 }
 
+struct KeyValuePartitioning::ParseCache {
+  // Bounds the memory held by a long-lived partitioning parsing ever new paths
+  static constexpr size_t kMaxEntries = 1 << 16;
+
+  // Encodes keys unambiguously, as length-prefixed names and values
+  static void AppendKey(const Key& key, std::string* out) {
+    *out += std::to_string(key.name.size());
+    *out += ':';
+    *out += key.name;
+    if (key.value.has_value()) {
+      *out += std::to_string(key.value->size());
+      *out += ':';
+      *out += *key.value;
+    } else {
+      *out += '-';
+    }
+  }
+
+  std::optional<compute::Expression> Find(
+      const std::unordered_map<std::string, compute::Expression>& map,
+      const std::string& encoded) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = map.find(encoded);
+    if (it == map.end()) return std::nullopt;
+    return it->second;
+  }
+
+  compute::Expression Insert(std::unordered_map<std::string, compute::Expression>* map,
+                             std::string encoded, compute::Expression expr) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (map->size() >= kMaxEntries) {
+      map->clear();
+    }
+    // Another thread may have inserted the same keys first: keep its expression
+    return map->emplace(std::move(encoded), std::move(expr)).first->second;
+  }
+
+  std::mutex mutex;
+  // Conjunctions keyed by all the keys of a path
+  std::unordered_map<std::string, compute::Expression> paths;
+  // Equality (or is_null) expressions keyed by a single key
+  std::unordered_map<std::string, compute::Expression> keys;
+};
+
+KeyValuePartitioning::KeyValuePartitioning(std::shared_ptr<Schema> schema,
+                                           ArrayVector dictionaries,
+                                           KeyValuePartitioningOptions options)
+    : Partitioning(std::move(schema)),
+      dictionaries_(std::move(dictionaries)),
+      options_(options),
+      parse_cache_(std::make_shared<ParseCache>()) {
+  if (dictionaries_.empty()) {
+    dictionaries_.resize(schema_->num_fields());
+  }
+}
+
 Result<compute::Expression> KeyValuePartitioning::ConvertKey(const Key& key) const {
   ARROW_ASSIGN_OR_RAISE(auto match, FieldRef(key.name).FindOneOrNone(*schema_));
   if (match.empty()) {
@@ -250,16 +308,34 @@ Result<compute::Expression> KeyValuePartitioning::ConvertKey(const Key& key) con
 }
 
 Result<compute::Expression> KeyValuePartitioning::Parse(const std::string& path) const {
-  std::vector<compute::Expression> expressions;
-
   ARROW_ASSIGN_OR_RAISE(auto parsed, ParseKeys(path));
+
+  // Many files usually share the same partition keys: convert each distinct set of
+  // keys once, and hand out the same expression for all of them.
+  std::string encoded_path;
   for (const Key& key : parsed) {
-    ARROW_ASSIGN_OR_RAISE(auto expr, ConvertKey(key));
-    if (expr == compute::literal(true)) continue;
-    expressions.push_back(std::move(expr));
+    ParseCache::AppendKey(key, &encoded_path);
+  }
+  if (auto cached = parse_cache_->Find(parse_cache_->paths, encoded_path)) {
+    return std::move(*cached);
+  }
+
+  std::vector<compute::Expression> expressions;
+  for (const Key& key : parsed) {
+    std::string encoded_key;
+    ParseCache::AppendKey(key, &encoded_key);
+    auto expr = parse_cache_->Find(parse_cache_->keys, encoded_key);
+    if (!expr) {
+      ARROW_ASSIGN_OR_RAISE(auto converted, ConvertKey(key));
+      expr = parse_cache_->Insert(&parse_cache_->keys, std::move(encoded_key),
+                                  std::move(converted));
+    }
+    if (*expr == compute::literal(true)) continue;
+    expressions.push_back(std::move(*expr));
   }
 
-  return and_(std::move(expressions));
+  return parse_cache_->Insert(&parse_cache_->paths, std::move(encoded_path),
+                              and_(std::move(expressions)));
 }
 
 Result<PartitionPathFormat> KeyValuePartitioning::Format(
@@ -193,14 +193,7 @@ class ARROW_DS_EXPORT KeyValuePartitioning : public Partitioning {
 
  protected:
   KeyValuePartitioning(std::shared_ptr<Schema> schema, ArrayVector dictionaries,
-                       KeyValuePartitioningOptions options)
-      : Partitioning(std::move(schema)),
-        dictionaries_(std::move(dictionaries)),
-        options_(options) {
-    if (dictionaries_.empty()) {
-      dictionaries_.resize(schema_->num_fields());
-    }
-  }
+                       KeyValuePartitioningOptions options);
 
   virtual Result<std::vector<Key>> ParseKeys(const std::string& path) const = 0;
 
@@ -216,6 +209,12 @@ class ARROW_DS_EXPORT KeyValuePartitioning : public Partitioning {
 
   ArrayVector dictionaries_;
   KeyValuePartitioningOptions options_;
+
+ private:
+  /// Expressions already produced by Parse(), so that the many paths sharing the
+  /// same partition keys also share the same expression
+  struct ParseCache;
+  std::shared_ptr<ParseCache> parse_cache_;
 };
 
 /// \brief DirectoryPartitioning parses one segment of a path for each field in its
@@ -480,6 +480,34 @@ TEST_F(TestPartitioning, HivePartitioning) {
   AssertParseError("/alpha=0.0/beta=3.25/");  // conversion of "0.0" to int32 fails
 }
 
+TEST_F(TestPartitioning, PartitionExpressionsAreShared) {
+  for (auto partitioning : std::vector<std::shared_ptr<Partitioning>>{
+           std::make_shared<HivePartitioning>(
+               schema({field("alpha", int32()), field("beta", utf8())})),
+           std::make_shared<DirectoryPartitioning>(
+               schema({field("alpha", int32()), field("beta", utf8())}))}) {
+    ARROW_SCOPED_TRACE(partitioning->type_name());
+    const bool hive = partitioning->type_name() == "hive";
+    auto dir = [&](int alpha, const std::string& beta) {
+      return hive ? "/alpha=" + std::to_string(alpha) + "/beta=" + beta + "/"
+                  : "/" + std::to_string(alpha) + "/" + beta + "/";
+    };
+    ASSERT_OK_AND_ASSIGN(auto first, partitioning->Parse(dir(0, "x") + "part-0.parquet"));
+    ASSERT_OK_AND_ASSIGN(auto second,
+                         partitioning->Parse(dir(0, "x") + "part-1.parquet"));
+    ASSERT_TRUE(Identical(first, second));
+    ASSERT_EQ(first, and_(equal(field_ref("alpha"), literal(0)),
+                          equal(field_ref("beta"), literal("x"))));
+
+    ASSERT_OK_AND_ASSIGN(auto other, partitioning->Parse(dir(0, "y") + "part-0.parquet"));
+    ASSERT_FALSE(Identical(first, other));
+    ASSERT_EQ(other, and_(equal(field_ref("alpha"), literal(0)),
+                          equal(field_ref("beta"), literal("y"))));
+    // The conjunctions share their common key
+    ASSERT_TRUE(Identical(first.call()->arguments[0], other.call()->arguments[0]));
+  }
+}
+
 TEST_F(TestPartitioning, HivePartitioningEquals) {
   const auto& array_vector = ArrayVector();
   ArrayVector other_vector(2);
@@ -0,0 +1,878 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/dataset/plan_optimizer.h"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "arrow/acero/options.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/util.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+namespace {
+
+using acero::Declaration;
+using compute::Expression;
+
+// The only input of a declaration, if it is a declaration
+Declaration* SingleInput(Declaration* declaration) {
+  if (declaration->inputs.size() != 1) return nullptr;
+  return std::get_if<Declaration>(&declaration->inputs[0]);
+}
+
+Expression Conjunction(Expression lhs, Expression rhs) {
+  if (lhs == compute::literal(true)) return rhs;
+  if (rhs == compute::literal(true)) return lhs;
+  return compute::and_(std::move(lhs), std::move(rhs));
+}
+
+// Replace the calls whose arguments are all literals with their result
+Result<Expression> FoldConstantCalls(Expression expr) {
+  return compute::ModifyExpression(
+      std::move(expr), [](Expression expr) { return expr; },
+      [](Expression expr, ...) -> Result<Expression> {
+        const Expression::Call* call = expr.call();
+        if (!std::all_of(call->arguments.begin(), call->arguments.end(),
+                         [](const Expression& argument) {
+                           return argument.literal() != nullptr;
+                         })) {
+          return expr;
+        }
+        // Without field references the call binds to an empty schema.  Errors are
+        // left for the node evaluating the expression to report.
+        Result<Expression> bound = expr.Bind(Schema(FieldVector{}));
+        if (!bound.ok()) return expr;
+        Result<Expression> folded = compute::FoldConstants(bound.MoveValueUnsafe());
+        if (!folded.ok() || folded->literal() == nullptr) return expr;
+        return folded.MoveValueUnsafe();
+      });
+}
+
+// Mark the top-level columns of schema referenced by expr, fails if a reference is
+// missing or ambiguous
+Status MarkReferencedColumns(const Expression& expr, const Schema& schema,
+                             std::vector<bool>* used) {
+  for (const FieldRef& ref : compute::FieldsInExpression(expr)) {
+    ARROW_ASSIGN_OR_RAISE(FieldPath path, ref.FindOne(schema));
+    (*used)[path[0]] = true;
+  }
+  return Status::OK();
+}
+
+std::shared_ptr<Schema> DatasetSchema(const ScanNodeOptions& options) {
+  const auto& dataset_schema = options.scan_options->dataset_schema;
+  return dataset_schema != nullptr ? dataset_schema : options.dataset->schema();
+}
+
+Declaration WithScanOptions(Declaration scan, std::shared_ptr<ScanOptions> scan_options) {
+  auto scan_node_options = checked_cast<const ScanNodeOptions&>(*scan.options);
+  scan_node_options.scan_options = std::move(scan_options);
+  scan.options = std::make_shared<ScanNodeOptions>(std::move(scan_node_options));
+  return scan;
+}
+
+// The selectivity assumed for filters
+constexpr double kFilterSelectivity = 0.25;
+
+// The estimated size of the output of a declaration
+struct RelationStatistics {
+  double num_rows = 0;
+  // The number of distinct values of each column, if known
+  std::vector<std::optional<double>> distinct_counts;
+
+  void LimitRows(double max_rows) {
+    num_rows = std::min(num_rows, max_rows);
+    for (auto& distinct_count : distinct_counts) {
+      if (distinct_count) *distinct_count = std::min(*distinct_count, num_rows);
+    }
+  }
+};
+
+// The output schema of a declaration, or null if it isn't known before the plan is
+// made
+std::shared_ptr<Schema> OutputSchema(const Declaration& declaration) {
+  const std::string& name = declaration.factory_name;
+  if (name == "table_source") {
+    return checked_cast<const acero::TableSourceNodeOptions&>(*declaration.options)
+        .table->schema();
+  } else if (name == "scan") {
+    const auto& scan_node_options =
+        checked_cast<const ScanNodeOptions&>(*declaration.options);
+    if (scan_node_options.scan_options->add_augmented_fields) return nullptr;
+    return DatasetSchema(scan_node_options);
+  } else if (name == "scan2") {
+    const auto& scan_options = checked_cast<const ScanV2Options&>(*declaration.options);
+    auto output_schema =
+        FieldPath::GetAll(*scan_options.dataset->schema(), scan_options.columns);
+    return output_schema.ok() ? output_schema.MoveValueUnsafe() : nullptr;
+  }
+
+  if (declaration.inputs.size() != 1 ||
+      !std::holds_alternative<Declaration>(declaration.inputs[0])) {
+    return nullptr;
+  }
+  std::shared_ptr<Schema> input_schema =
+      OutputSchema(std::get<Declaration>(declaration.inputs[0]));
+  if (input_schema == nullptr) return nullptr;
+  if (name == "filter" || name == "fetch") {
+    return input_schema;
+  } else if (name == "project") {
+    const auto& project_options =
+        checked_cast<const acero::ProjectNodeOptions&>(*declaration.options);
+    FieldVector fields;
+    for (size_t i = 0; i < project_options.expressions.size(); ++i) {
+      const Expression& expr = project_options.expressions[i];
+      auto bound = expr.Bind(*input_schema);
+      if (!bound.ok()) return nullptr;
+      fields.push_back(field(
+          project_options.names.empty() ? expr.ToString() : project_options.names[i],
+          bound->type()->GetSharedPtr()));
+    }
+    return schema(std::move(fields));
+  }
+  return nullptr;
+}
+
+// Combine the cached statistics of the fragments of a dataset
+std::optional<RelationStatistics> ScanStatistics(const std::shared_ptr<Dataset>& dataset,
+                                                 const Schema& output_schema,
+                                                 const Expression& filter) {
+  auto fragments = dataset->GetFragments();
+  if (!fragments.ok()) return std::nullopt;
+
+  RelationStatistics statistics;
+  const int num_fields = output_schema.num_fields();
+  std::vector<double> distinct_counts(num_fields, 0);
+  std::vector<bool> known(num_fields, true);
+  for (const auto& maybe_fragment : *fragments) {
+    if (!maybe_fragment.ok()) return std::nullopt;
+    std::optional<FragmentStatistics> fragment_statistics =
+        (*maybe_fragment)->GetCachedStatistics();
+    if (!fragment_statistics) return std::nullopt;
+    statistics.num_rows += static_cast<double>(fragment_statistics->num_rows);
+    for (int i = 0; i < num_fields; ++i) {
+      auto it = fragment_statistics->distinct_counts.find(output_schema.field(i)->name());
+      if (it == fragment_statistics->distinct_counts.end()) {
+        known[i] = false;
+      } else {
+        // The values of different fragments may be the same
+        distinct_counts[i] =
+            std::max(distinct_counts[i], static_cast<double>(it->second));
+      }
+    }
+  }
+  for (int i = 0; i < num_fields; ++i) {
+    statistics.distinct_counts.push_back(known[i] ? std::make_optional(distinct_counts[i])
+                                                  : std::nullopt);
+  }
+  if (filter != compute::literal(true)) {
+    statistics.LimitRows(statistics.num_rows * kFilterSelectivity);
+  }
+  return statistics;
+}
+
+// Estimate the size of the output of a declaration from the statistics of its sources
+std::optional<RelationStatistics> EstimateStatistics(const Declaration& declaration) {
+  const std::string& name = declaration.factory_name;
+  if (name == "table_source") {
+    const Table& table =
+        *checked_cast<const acero::TableSourceNodeOptions&>(*declaration.options).table;
+    RelationStatistics statistics;
+    statistics.num_rows = static_cast<double>(table.num_rows());
+    for (const auto& column : table.columns()) {
+      std::optional<double> distinct_count;
+      const std::shared_ptr<ArrayStatistics>& array_statistics =
+          column->num_chunks() == 1 ? column->chunk(0)->statistics() : nullptr;
+      if (array_statistics != nullptr && array_statistics->distinct_count.has_value()) {
+        distinct_count = static_cast<double>(*array_statistics->distinct_count);
+      }
+      statistics.distinct_counts.push_back(distinct_count);
+    }
+    return statistics;
+  } else if (name == "scan" || name == "scan2") {
+    std::shared_ptr<Schema> output_schema = OutputSchema(declaration);
+    if (output_schema == nullptr) return std::nullopt;
+    if (name == "scan") {
+      const auto& scan_node_options =
+          checked_cast<const ScanNodeOptions&>(*declaration.options);
+      return ScanStatistics(scan_node_options.dataset, *output_schema,
+                            scan_node_options.scan_options->filter);
+    }
+    const auto& scan_options = checked_cast<const ScanV2Options&>(*declaration.options);
+    return ScanStatistics(scan_options.dataset, *output_schema, scan_options.filter);
+  }
+
+  if (declaration.inputs.size() != 1 ||
+      !std::holds_alternative<Declaration>(declaration.inputs[0])) {
+    return std::nullopt;
+  }
+  const auto& input = std::get<Declaration>(declaration.inputs[0]);
+  std::optional<RelationStatistics> statistics = EstimateStatistics(input);
+  if (!statistics) return std::nullopt;
+  if (name == "filter") {
+    statistics->LimitRows(statistics->num_rows * kFilterSelectivity);
+    return statistics;
+  } else if (name == "fetch") {
+    const auto& fetch_options =
+        checked_cast<const acero::FetchNodeOptions&>(*declaration.options);
+    statistics->LimitRows(static_cast<double>(fetch_options.count));
+    return statistics;
+  } else if (name == "project") {
+    const auto& project_options =
+        checked_cast<const acero::ProjectNodeOptions&>(*declaration.options);
+    std::shared_ptr<Schema> input_schema = OutputSchema(input);
+    RelationStatistics projected;
+    projected.num_rows = statistics->num_rows;
+    for (const Expression& expr : project_options.expressions) {
+      std::optional<double> distinct_count;
+      if (const FieldRef* ref = expr.field_ref(); ref && input_schema) {
+        auto path = ref->FindOne(*input_schema);
+        if (path.ok() && path->indices().size() == 1) {
+          distinct_count = statistics->distinct_counts[(*path)[0]];
+        }
+      }
+      projected.distinct_counts.push_back(distinct_count);
+    }
+    return projected;
+  }
+  return std::nullopt;
+}
+
+// An inner equi-join without residual filter, whose inputs can be reordered
+bool IsReorderableJoin(const Declaration& declaration) {
+  if (declaration.factory_name != "hashjoin" || declaration.inputs.size() != 2 ||
+      !std::holds_alternative<Declaration>(declaration.inputs[0]) ||
+      !std::holds_alternative<Declaration>(declaration.inputs[1])) {
+    return false;
+  }
+  const auto& join_options =
+      checked_cast<const acero::HashJoinNodeOptions&>(*declaration.options);
+  return join_options.join_type == acero::JoinType::INNER && join_options.output_all &&
+         !join_options.left_keys.empty() &&
+         join_options.left_keys.size() == join_options.right_keys.size() &&
+         std::all_of(join_options.key_cmp.begin(), join_options.key_cmp.end(),
+                     [](acero::JoinKeyCmp cmp) {
+                       return cmp == acero::JoinKeyCmp::EQ;
+                     }) &&
+         join_options.filter == compute::literal(true) &&
+         join_options.output_suffix_for_left.empty() &&
+         join_options.output_suffix_for_right.empty() &&
+         !join_options.disable_bloom_filter;
+}
+
+// The relations of a tree of reorderable joins, and the equalities joining them
+class JoinGraph {
+ public:
+  // A column of a leaf
+  struct Column {
+    int leaf;
+    int index;
+
+    bool operator==(const Column& other) const {
+      return leaf == other.leaf && index == other.index;
+    }
+  };
+
+  // A join of the original tree, or a leaf if leaf >= 0
+  struct Node {
+    int leaf = -1;
+    int left = -1;
+    int right = -1;
+    std::shared_ptr<acero::ExecNodeOptions> options;
+    std::string label;
+  };
+
+  // Add the join tree of a declaration, return the index of its node and append its
+  // output columns, or return -1 if the join keys or the schema of a leaf are unknown
+  int Add(const Declaration& declaration, std::vector<Column>* columns) {
+    if (!IsReorderableJoin(declaration)) {
+      std::shared_ptr<Schema> leaf_schema = OutputSchema(declaration);
+      if (leaf_schema == nullptr) return -1;
+      const int leaf = static_cast<int>(leaves.size());
+      leaves.push_back(declaration);
+      leaf_schemas.push_back(leaf_schema);
+      for (int i = 0; i < leaf_schema->num_fields(); ++i) {
+        columns->push_back({leaf, i});
+      }
+      nodes.push_back({leaf});
+      return static_cast<int>(nodes.size()) - 1;
+    }
+
+    std::vector<Column> left_columns, right_columns;
+    const int left = Add(std::get<Declaration>(declaration.inputs[0]), &left_columns);
+    if (left < 0) return -1;
+    const int right = Add(std::get<Declaration>(declaration.inputs[1]), &right_columns);
+    if (right < 0) return -1;
+
+    const auto& join_options =
+        checked_cast<const acero::HashJoinNodeOptions&>(*declaration.options);
+    for (size_t i = 0; i < join_options.left_keys.size(); ++i) {
+      std::optional<Column> left_key = Resolve(join_options.left_keys[i], left_columns);
+      std::optional<Column> right_key =
+          Resolve(join_options.right_keys[i], right_columns);
+      if (!left_key || !right_key) return -1;
+      equalities.emplace_back(*left_key, *right_key);
+    }
+
+    columns->insert(columns->end(), left_columns.begin(), left_columns.end());
+    columns->insert(columns->end(), right_columns.begin(), right_columns.end());
+    nodes.push_back({-1, left, right, declaration.options, declaration.label});
+    return static_cast<int>(nodes.size()) - 1;
+  }
+
+  std::shared_ptr<Field> GetField(const Column& column) const {
+    return leaf_schemas[column.leaf]->field(column.index);
+  }
+
+  std::vector<Declaration> leaves;
+  std::vector<std::shared_ptr<Schema>> leaf_schemas;
+  std::vector<Node> nodes;
+  std::vector<std::pair<Column, Column>> equalities;
+
+ private:
+  std::optional<Column> Resolve(const FieldRef& ref, const std::vector<Column>& columns) {
+    FieldVector fields;
+    for (const Column& column : columns) {
+      fields.push_back(GetField(column));
+    }
+    auto path = ref.FindOne(Schema(std::move(fields)));
+    if (!path.ok() || path->indices().size() != 1) return std::nullopt;
+    return columns[(*path)[0]];
+  }
+};
+
+// Choose the order and the build sides of the joins of a JoinGraph greedily: the
+// pair of relations with the smallest estimated join is joined first, with the
+// smaller relation as build side.  The cost of a plan is the sum of the estimated
+// rows of the joins and of their build sides.
+class JoinOrderer {
+ public:
+  using Column = JoinGraph::Column;
+
+  struct Relation {
+    Declaration declaration;
+    std::vector<Column> columns;
+    std::vector<bool> leaves;
+    double num_rows = 0;
+  };
+
+  JoinOrderer(JoinGraph* graph, std::vector<RelationStatistics> leaf_statistics)
+      : graph_(graph), leaf_statistics_(std::move(leaf_statistics)) {}
+
+  // The cost of the original order, and the declaration of the original tree
+  double OriginalCost() {
+    double cost = 0;
+    EstimateNode(static_cast<int>(graph_->nodes.size()) - 1, &cost);
+    return cost;
+  }
+
+  Declaration MakeOriginal() {
+    return MakeNode(static_cast<int>(graph_->nodes.size()) - 1);
+  }
+
+  // The cost of the greedy order, or std::nullopt if it needs a cross join
+  std::optional<double> Reorder() {
+    std::vector<Relation> relations;
+    for (size_t i = 0; i < graph_->leaves.size(); ++i) {
+      relations.push_back(LeafRelation(static_cast<int>(i)));
+      relations.back().declaration = graph_->leaves[i];
+    }
+
+    double cost = 0;
+    while (relations.size() > 1) {
+      size_t best_left = 0, best_right = 0;
+      std::optional<double> best_rows;
+      for (size_t i = 0; i < relations.size(); ++i) {
+        for (size_t j = i + 1; j < relations.size(); ++j) {
+          std::optional<double> rows = JoinRows(relations[i], relations[j]);
+          if (rows && (!best_rows || *rows < *best_rows)) {
+            best_rows = rows;
+            best_left = i;
+            best_right = j;
+          }
+        }
+      }
+      if (!best_rows) return std::nullopt;
+
+      if (relations[best_left].num_rows < relations[best_right].num_rows) {
+        std::swap(relations[best_left], relations[best_right]);
+      }
+      cost += *best_rows + relations[best_right].num_rows;
+      relations[best_left] = Join(std::move(relations[best_left]),
+                                  std::move(relations[best_right]), *best_rows);
+      relations.erase(relations.begin() + best_right);
+    }
+    reordered_ = std::move(relations[0]);
+    return cost;
+  }
+
+  // The declaration of the greedy order, with the columns in the original order
+  Declaration MakeReordered(const std::vector<Column>& output_columns) {
+    if (reordered_.columns == output_columns) {
+      return std::move(reordered_.declaration);
+    }
+    std::vector<Expression> expressions;
+    std::vector<std::string> names;
+    for (const Column& column : output_columns) {
+      auto position =
+          std::find(reordered_.columns.begin(), reordered_.columns.end(), column);
+      expressions.push_back(compute::field_ref(
+          FieldPath({static_cast<int>(position - reordered_.columns.begin())})));
+      names.push_back(graph_->GetField(column)->name());
+    }
+    return Declaration::Sequence(
+        {std::move(reordered_.declaration),
+         {"project",
+          acero::ProjectNodeOptions{std::move(expressions), std::move(names)}}});
+  }
+
+ private:
+  Relation LeafRelation(int leaf) {
+    Relation relation;
+    for (int i = 0; i < graph_->leaf_schemas[leaf]->num_fields(); ++i) {
+      relation.columns.push_back({leaf, i});
+    }
+    relation.leaves.resize(graph_->leaves.size(), false);
+    relation.leaves[leaf] = true;
+    relation.num_rows = leaf_statistics_[leaf].num_rows;
+    return relation;
+  }
+
+  std::optional<double> DistinctCount(const Relation& relation, const Column& column) {
+    const std::optional<double>& distinct_count =
+        leaf_statistics_[column.leaf].distinct_counts[column.index];
+    if (!distinct_count) return std::nullopt;
+    return std::min(*distinct_count, relation.num_rows);
+  }
+
+  // The equalities between the columns of left and right, oriented left to right
+  std::vector<std::pair<Column, Column>> Equalities(const Relation& left,
+                                                    const Relation& right) {
+    std::vector<std::pair<Column, Column>> equalities;
+    for (auto [a, b] : graph_->equalities) {
+      if (left.leaves[b.leaf] && right.leaves[a.leaf]) std::swap(a, b);
+      if (left.leaves[a.leaf] && right.leaves[b.leaf]) equalities.emplace_back(a, b);
+    }
+    return equalities;
+  }
+
+  // The estimated rows of the join of two relations: the product of their rows
+  // divided by the largest number of distinct values of a key.  When a key has no
+  // distinct count, the key of the smaller relation is assumed to be unique.
+  std::optional<double> JoinRows(const Relation& left, const Relation& right) {
+    auto equalities = Equalities(left, right);
+    if (equalities.empty()) return std::nullopt;
+    double divisor = 1;
+    for (const auto& [a, b] : equalities) {
+      std::optional<double> left_count = DistinctCount(left, a);
+      std::optional<double> right_count = DistinctCount(right, b);
+      double count;
+      if (left_count && right_count) {
+        count = std::max(*left_count, *right_count);
+      } else if (left_count || right_count) {
+        count = left_count ? *left_count : *right_count;
+      } else {
+        count = std::min(left.num_rows, right.num_rows);
+      }
+      divisor = std::max(divisor, count);
+    }
+    return left.num_rows * right.num_rows / divisor;
+  }
+
+  Relation Join(Relation left, Relation right, double num_rows) {
+    std::vector<FieldRef> left_keys, right_keys;
+    for (const auto& [a, b] : Equalities(left, right)) {
+      left_keys.emplace_back(Position(left, a));
+      right_keys.emplace_back(Position(right, b));
+    }
+    Relation joined;
+    joined.columns = left.columns;
+    joined.columns.insert(joined.columns.end(), right.columns.begin(),
+                          right.columns.end());
+    joined.leaves = left.leaves;
+    for (size_t i = 0; i < right.leaves.size(); ++i) {
+      if (right.leaves[i]) joined.leaves[i] = true;
+    }
+    joined.num_rows = num_rows;
+    joined.declaration = Declaration{
+        "hashjoin",
+        {std::move(left.declaration), std::move(right.declaration)},
+        acero::HashJoinNodeOptions{std::move(left_keys), std::move(right_keys)}};
+    return joined;
+  }
+
+  static int Position(const Relation& relation, const Column& column) {
+    auto it = std::find(relation.columns.begin(), relation.columns.end(), column);
+    return static_cast<int>(it - relation.columns.begin());
+  }
+
+  // Estimate a node of the original tree and add the cost of its joins
+  Relation EstimateNode(int index, double* cost) {
+    const JoinGraph::Node& node = graph_->nodes[index];
+    if (node.leaf >= 0) return LeafRelation(node.leaf);
+    Relation left = EstimateNode(node.left, cost);
+    Relation right = EstimateNode(node.right, cost);
+    // The original joins have keys, so JoinRows is set
+    double num_rows = JoinRows(left, right).value_or(left.num_rows * right.num_rows);
+    *cost += num_rows + right.num_rows;
+    Relation joined = std::move(left);
+    for (size_t i = 0; i < right.leaves.size(); ++i) {
+      if (right.leaves[i]) joined.leaves[i] = true;
+    }
+    joined.columns.insert(joined.columns.end(), right.columns.begin(),
+                          right.columns.end());
+    joined.num_rows = num_rows;
+    return joined;
+  }
+
+  Declaration MakeNode(int index) {
+    JoinGraph::Node& node = graph_->nodes[index];
+    if (node.leaf >= 0) {
+      return std::move(graph_->leaves[node.leaf]);
+    }
+    Declaration left = MakeNode(node.left);
+    Declaration right = MakeNode(node.right);
+    return Declaration{"hashjoin", {std::move(left), std::move(right)}, node.options,
+                       node.label};
+  }
+
+  JoinGraph* graph_;
+  std::vector<RelationStatistics> leaf_statistics_;
+  Relation reordered_;
+};
+
+class PlanOptimizer {
+ public:
+  explicit PlanOptimizer(const PlanOptimizerOptions& options) : options_(options) {}
+
+  Result<Declaration> Optimize(Declaration declaration) {
+    if (options_.reorder_joins && IsReorderableJoin(declaration)) {
+      JoinGraph graph;
+      std::vector<JoinGraph::Column> output_columns;
+      if (graph.Add(declaration, &output_columns) >= 0) {
+        return ReorderJoins(std::move(graph), output_columns);
+      }
+    }
+    for (Declaration::Input& input : declaration.inputs) {
+      if (auto* input_declaration = std::get_if<Declaration>(&input)) {
+        ARROW_ASSIGN_OR_RAISE(*input_declaration,
+                              Optimize(std::move(*input_declaration)));
+      }
+    }
+    if (declaration.factory_name == "filter") {
+      return OptimizeFilter(std::move(declaration));
+    } else if (declaration.factory_name == "project") {
+      return OptimizeProject(std::move(declaration));
+    } else if (declaration.factory_name == "fetch") {
+      return OptimizeFetch(std::move(declaration));
+    }
+    return declaration;
+  }
+
+ private:
+  Result<Declaration> ReorderJoins(JoinGraph graph,
+                                   const std::vector<JoinGraph::Column>& output_columns) {
+    std::vector<RelationStatistics> leaf_statistics;
+    for (Declaration& leaf : graph.leaves) {
+      ARROW_ASSIGN_OR_RAISE(leaf, Optimize(std::move(leaf)));
+      if (auto statistics = EstimateStatistics(leaf)) {
+        leaf_statistics.push_back(std::move(*statistics));
+      }
+    }
+    const bool has_statistics = leaf_statistics.size() == graph.leaves.size();
+
+    JoinOrderer orderer(&graph, std::move(leaf_statistics));
+    if (has_statistics) {
+      std::optional<double> cost = orderer.Reorder();
+      if (cost && *cost < orderer.OriginalCost()) {
+        return orderer.MakeReordered(output_columns);
+      }
+    }
+    return orderer.MakeOriginal();
+  }
+
+  Result<Declaration> OptimizeFilter(Declaration filter) {
+    Expression condition =
+        checked_cast<const acero::FilterNodeOptions&>(*filter.options).filter_expression;
+    if (options_.fold_constants) {
+      ARROW_ASSIGN_OR_RAISE(condition, FoldConstantCalls(std::move(condition)));
+    }
+
+    Declaration* input = SingleInput(&filter);
+    if (input != nullptr && options_.fold_constants &&
+        condition == compute::literal(true)) {
+      return std::move(*input);
+    }
+    if (input != nullptr && options_.push_down_filters) {
+      const bool input_is_filter = input->factory_name == "filter";
+      Declaration* scan = input_is_filter ? SingleInput(input) : input;
+      if (scan != nullptr) {
+        ARROW_RETURN_NOT_OK(PushFilterIntoScan(condition, scan));
+      }
+      if (input_is_filter) {
+        // filter(filter(x, a), b) is filter(x, a and b), a was already pushed down
+        const auto& input_options =
+            checked_cast<const acero::FilterNodeOptions&>(*input->options);
+        Declaration merged = std::move(*input);
+        merged.options = std::make_shared<acero::FilterNodeOptions>(
+            Conjunction(input_options.filter_expression, std::move(condition)));
+        return merged;
+      }
+    }
+    filter.options = std::make_shared<acero::FilterNodeOptions>(std::move(condition));
+    return filter;
+  }
+
+  // Add a condition to the pushdown filter of a scan, if the scan reads every column
+  // it references
+  Status PushFilterIntoScan(const Expression& condition, Declaration* scan) {
+    if (scan->factory_name == "scan") {
+      const auto& scan_node_options =
+          checked_cast<const ScanNodeOptions&>(*scan->options);
+      std::shared_ptr<Schema> dataset_schema = DatasetSchema(scan_node_options);
+      std::vector<bool> used_columns(dataset_schema->num_fields(), false);
+      if (!MarkReferencedColumns(condition, *dataset_schema, &used_columns).ok()) {
+        return Status::OK();
+      }
+      auto scan_options = std::make_shared<ScanOptions>(*scan_node_options.scan_options);
+      scan_options->filter = Conjunction(scan_options->filter, condition);
+      *scan = WithScanOptions(std::move(*scan), std::move(scan_options));
+    } else if (scan->factory_name == "scan2") {
+      const auto& scan_options = checked_cast<const ScanV2Options&>(*scan->options);
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<Schema> output_schema,
+          FieldPath::GetAll(*scan_options.dataset->schema(), scan_options.columns));
+      std::vector<bool> used_columns(output_schema->num_fields(), false);
+      if (!MarkReferencedColumns(condition, *output_schema, &used_columns).ok()) {
+        return Status::OK();
+      }
+      auto new_scan_options = std::make_shared<ScanV2Options>(scan_options);
+      new_scan_options->filter = Conjunction(scan_options.filter, condition);
+      scan->options = std::move(new_scan_options);
+    }
+    return Status::OK();
+  }
+
+  Result<Declaration> OptimizeProject(Declaration project) {
+    const auto& project_options =
+        checked_cast<const acero::ProjectNodeOptions&>(*project.options);
+    std::vector<Expression> expressions = project_options.expressions;
+    std::vector<std::string> names = project_options.names;
+    if (names.empty()) {
+      // Keep the names the project node derives from the original expressions
+      for (const Expression& expr : expressions) {
+        names.push_back(expr.ToString());
+      }
+    }
+
+    if (options_.fold_constants) {
+      for (Expression& expr : expressions) {
+        ARROW_ASSIGN_OR_RAISE(expr, FoldConstantCalls(std::move(expr)));
+      }
+    }
+    if (options_.push_down_projections) {
+      ARROW_RETURN_NOT_OK(PushProjectionIntoScan(&expressions, &project));
+    }
+    project.options = std::make_shared<acero::ProjectNodeOptions>(std::move(expressions),
+                                                                  std::move(names));
+    return project;
+  }
+
+  // Restrict the columns read by a scan below the project, or below a filter below
+  // the project, to those the expressions reference
+  Status PushProjectionIntoScan(std::vector<Expression>* expressions,
+                                Declaration* project) {
+    Declaration* scan = SingleInput(project);
+    Declaration* filter = nullptr;
+    if (scan != nullptr && scan->factory_name == "filter") {
+      filter = scan;
+      scan = SingleInput(filter);
+    }
+    if (scan == nullptr) return Status::OK();
+
+    if (scan->factory_name == "scan") {
+      std::vector<Expression> used = *expressions;
+      if (filter != nullptr) {
+        used.push_back(
+            checked_cast<const acero::FilterNodeOptions&>(*filter->options)
+                .filter_expression);
+      }
+      return ProjectScan(used, scan);
+    } else if (scan->factory_name == "scan2") {
+      return ProjectScanV2(expressions, filter, scan);
+    }
+    return Status::OK();
+  }
+
+  // The "scan" node keeps the dataset schema as output schema, the columns it does not
+  // read are null
+  Status ProjectScan(const std::vector<Expression>& used, Declaration* scan) {
+    const auto& scan_node_options = checked_cast<const ScanNodeOptions&>(*scan->options);
+    const ScanOptions& scan_options = *scan_node_options.scan_options;
+    // Only restrict scans which read every column
+    if (scan_options.projected_schema != nullptr ||
+        (scan_options.projection.is_valid() &&
+         scan_options.projection != compute::literal(true))) {
+      return Status::OK();
+    }
+
+    std::shared_ptr<Schema> dataset_schema = DatasetSchema(scan_node_options);
+    std::vector<bool> used_columns(dataset_schema->num_fields(), false);
+    for (const Expression& expr : used) {
+      if (!MarkReferencedColumns(expr, *dataset_schema, &used_columns).ok()) {
+        return Status::OK();
+      }
+    }
+    std::vector<std::string> names;
+    for (int i = 0; i < dataset_schema->num_fields(); ++i) {
+      if (used_columns[i]) names.push_back(dataset_schema->field(i)->name());
+    }
+    if (names.empty() || names.size() == used_columns.size()) {
+      return Status::OK();
+    }
+
+    Result<ProjectionDescr> projection = ProjectionDescr::FromNames(
+        std::move(names), *dataset_schema, scan_options.add_augmented_fields);
+    if (!projection.ok()) return Status::OK();
+    auto new_scan_options = std::make_shared<ScanOptions>(scan_options);
+    SetProjection(new_scan_options.get(), projection.MoveValueUnsafe());
+    *scan = WithScanOptions(std::move(*scan), std::move(new_scan_options));
+    return Status::OK();
+  }
+
+  // The "scan2" node only outputs its columns, so the references to the columns
+  // following a removed one are renumbered
+  Status ProjectScanV2(std::vector<Expression>* expressions, Declaration* filter,
+                       Declaration* scan) {
+    const auto& scan_options = checked_cast<const ScanV2Options&>(*scan->options);
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Schema> output_schema,
+        FieldPath::GetAll(*scan_options.dataset->schema(), scan_options.columns));
+
+    Expression condition = compute::literal(true);
+    if (filter != nullptr) {
+      condition = checked_cast<const acero::FilterNodeOptions&>(*filter->options)
+                      .filter_expression;
+    }
+    std::vector<Expression> used = *expressions;
+    used.push_back(condition);
+    used.push_back(scan_options.filter);
+    std::vector<bool> used_columns(output_schema->num_fields(), false);
+    for (const Expression& expr : used) {
+      if (!MarkReferencedColumns(expr, *output_schema, &used_columns).ok()) {
+        return Status::OK();
+      }
+    }
+
+    std::vector<FieldPath> columns;
+    std::vector<int> new_indices(used_columns.size(), -1);
+    for (size_t i = 0; i < used_columns.size(); ++i) {
+      if (used_columns[i]) {
+        new_indices[i] = static_cast<int>(columns.size());
+        columns.push_back(scan_options.columns[i]);
+      }
+    }
+    if (columns.empty() || columns.size() == used_columns.size()) {
+      return Status::OK();
+    }
+
+    auto renumber = [&](Expression expr) {
+      return compute::ModifyExpression(
+          std::move(expr),
+          [&](Expression expr) -> Result<Expression> {
+            const FieldRef* ref = expr.field_ref();
+            if (ref == nullptr) return expr;
+            ARROW_ASSIGN_OR_RAISE(FieldPath path, ref->FindOne(*output_schema));
+            std::vector<int> indices = path.indices();
+            indices[0] = new_indices[indices[0]];
+            return compute::field_ref(FieldPath(std::move(indices)));
+          },
+          [](Expression expr, ...) { return expr; });
+    };
+    for (Expression& expr : *expressions) {
+      ARROW_ASSIGN_OR_RAISE(expr, renumber(std::move(expr)));
+    }
+    if (filter != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(condition, renumber(std::move(condition)));
+      filter->options = std::make_shared<acero::FilterNodeOptions>(std::move(condition));
+    }
+    auto new_scan_options = std::make_shared<ScanV2Options>(scan_options);
+    ARROW_ASSIGN_OR_RAISE(new_scan_options->filter, renumber(scan_options.filter));
+    new_scan_options->columns = std::move(columns);
+    scan->options = std::move(new_scan_options);
+    return Status::OK();
+  }
+
+  Result<Declaration> OptimizeFetch(Declaration fetch) {
+    if (!options_.push_down_limits) return fetch;
+    const auto& fetch_options =
+        checked_cast<const acero::FetchNodeOptions&>(*fetch.options);
+
+    // Projections don't change the rows
+    Declaration* scan = SingleInput(&fetch);
+    while (scan != nullptr && scan->factory_name == "project") {
+      scan = SingleInput(scan);
+    }
+    if (scan == nullptr || scan->factory_name != "scan") return fetch;
+
+    const auto& scan_options =
+        *checked_cast<const ScanNodeOptions&>(*scan->options).scan_options;
+    // When the fetched rows fit in the first batch, read smaller batches and don't
+    // read several fragments ahead
+    if (fetch_options.count <= 0 || fetch_options.offset < 0 ||
+        fetch_options.count >= scan_options.batch_size ||
+        fetch_options.offset >= scan_options.batch_size - fetch_options.count) {
+      return fetch;
+    }
+    auto new_scan_options = std::make_shared<ScanOptions>(scan_options);
+    new_scan_options->batch_size = fetch_options.offset + fetch_options.count;
+    new_scan_options->fragment_readahead =
+        std::min(new_scan_options->fragment_readahead, 1);
+    *scan = WithScanOptions(std::move(*scan), std::move(new_scan_options));
+    return fetch;
+  }
+
+  const PlanOptimizerOptions& options_;
+};
+
+}  // namespace
+
+Result<Declaration> OptimizeDeclaration(Declaration declaration,
+                                        const PlanOptimizerOptions& options) {
+  return PlanOptimizer(options).Optimize(std::move(declaration));
+}
+
+}  // namespace dataset
+}  // namespace arrow
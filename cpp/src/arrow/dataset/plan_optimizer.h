@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/result.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief Options for OptimizeDeclaration
+struct ARROW_DS_EXPORT PlanOptimizerOptions {
+  /// Evaluate the calls of filter and project expressions whose arguments are all
+  /// literals, and remove filters which are always true
+  bool fold_constants = true;
+  /// Merge consecutive filters, and add their conditions to the filter of a "scan"
+  /// or "scan2" node below them
+  bool push_down_filters = true;
+  /// Only read the columns of a "scan" or "scan2" node which are used by the
+  /// projection above it
+  bool push_down_projections = true;
+  /// Shrink the batches and the fragment readahead of a "scan" node below a limit
+  /// smaller than a batch
+  bool push_down_limits = true;
+  /// Reorder the trees of inner equi-joins, and choose their build sides, to reduce
+  /// the estimated size of the intermediate results
+  bool reorder_joins = true;
+
+  static PlanOptimizerOptions Defaults() { return PlanOptimizerOptions(); }
+};
+
+/// \brief Rewrite a declaration tree with rule-based optimizations
+///
+/// The rules of PlanOptimizerOptions are applied bottom-up to the "filter",
+/// "project" and "fetch" declarations, and to the "scan" and "scan2" declarations
+/// directly below them.
+///
+/// Trees of "hashjoin" declarations which are inner joins on equal keys, outputting
+/// every column without suffix or residual filter, are reordered greedily: the pair
+/// of inputs with the smallest estimated join is joined first, and the smaller input
+/// of a join is its build (right) side.  The number of rows and of distinct values
+/// of the inputs are estimated from the tables of "table_source" declarations (see
+/// ArrayStatistics) and from the Fragment::GetCachedStatistics of the datasets of
+/// scans.  A project restores the original order of the columns.  The join order is
+/// kept when the statistics of an input are unknown or when it is estimated to be
+/// as cheap.  The output schema and the rows of the plan are unchanged:
+/// pushed down filters are only used by the scans to skip data, so the filter
+/// nodes are kept, and the columns a scan no longer reads are either null or
+/// removed with the references to the following ones renumbered.
+///
+/// The options of the declarations are not modified in place, rewritten
+/// declarations are given new options.  Inputs which are already ExecNodes are
+/// left as they are.  The same optimizer is used for hand-built plans and for
+/// plans deserialized from Substrait (see engine::ConversionOptions::optimize_plan).
+ARROW_DS_EXPORT Result<acero::Declaration> OptimizeDeclaration(
+    acero::Declaration declaration,
+    const PlanOptimizerOptions& options = PlanOptimizerOptions::Defaults());
+
+}  // namespace dataset
+}  // namespace arrow
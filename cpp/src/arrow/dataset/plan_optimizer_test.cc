@@ -0,0 +1,276 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/dataset/plan_optimizer.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/acero/options.h"
+#include "arrow/acero/test_util_internal.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/plan.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+using compute::field_ref;
+using compute::literal;
+
+namespace dataset {
+
+class TestPlanOptimizer : public ::testing::Test {
+ public:
+  void SetUp() override {
+    internal::Initialize();
+    schema_ = schema({field("a", int32()), field("b", int32()), field("c", utf8())});
+    dataset_ = std::make_shared<InMemoryDataset>(
+        schema_, RecordBatchVector{RecordBatchFromJSON(schema_, R"([
+          [1, 10, "x"], [2, 20, "y"], [3, 30, "z"], [4, 40, null]
+        ])")});
+  }
+
+  acero::Declaration Scan(bool implicit_ordering = false) {
+    auto scan_options = std::make_shared<ScanOptions>();
+    scan_options->add_augmented_fields = false;
+    return acero::Declaration{"scan", ScanNodeOptions{dataset_, scan_options,
+                                                      /*require_sequenced_output=*/false,
+                                                      implicit_ordering}};
+  }
+
+  acero::Declaration ScanV2() {
+    ScanV2Options scan_options(dataset_);
+    scan_options.columns = ScanV2Options::AllColumns(*schema_);
+    return acero::Declaration{"scan2", std::move(scan_options)};
+  }
+
+  // The optimized plan gives the same table as the original one
+  acero::Declaration CheckOptimize(acero::Declaration declaration,
+                                   const PlanOptimizerOptions& options =
+                                       PlanOptimizerOptions::Defaults()) {
+    // Optimize first, running the original plan normalizes its scan options
+    EXPECT_OK_AND_ASSIGN(auto optimized, OptimizeDeclaration(declaration, options));
+    EXPECT_OK_AND_ASSIGN(auto expected,
+                         acero::DeclarationToTable(declaration, /*use_threads=*/false));
+    EXPECT_OK_AND_ASSIGN(auto actual,
+                         acero::DeclarationToTable(optimized, /*use_threads=*/false));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+    return optimized;
+  }
+
+  static const ScanOptions& GetScanOptions(const acero::Declaration& scan) {
+    EXPECT_EQ(scan.factory_name, "scan");
+    return *checked_cast<const ScanNodeOptions&>(*scan.options).scan_options;
+  }
+
+  static const acero::Declaration& GetInput(const acero::Declaration& declaration) {
+    return std::get<acero::Declaration>(declaration.inputs[0]);
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<Dataset> dataset_;
+};
+
+TEST_F(TestPlanOptimizer, FoldConstants) {
+  auto plan = acero::Declaration::Sequence({
+      Scan(),
+      {"filter", acero::FilterNodeOptions{compute::greater(
+                     field_ref("a"), compute::call("add", {literal(1), literal(1)}))}},
+      {"project",
+       acero::ProjectNodeOptions{{compute::call(
+           "multiply",
+           {field_ref("b"), compute::call("add", {literal(2), literal(3)})})}}},
+  });
+  PlanOptimizerOptions options;
+  options.push_down_filters = options.push_down_projections = false;
+  ASSERT_OK_AND_ASSIGN(auto optimized, OptimizeDeclaration(plan, options));
+
+  const auto& project_options =
+      checked_cast<const acero::ProjectNodeOptions&>(*optimized.options);
+  ASSERT_EQ(project_options.expressions.size(), 1u);
+  ASSERT_EQ(project_options.expressions[0],
+            compute::call("multiply", {field_ref("b"), literal(5)}));
+  // The output keeps the name of the original expression
+  ASSERT_EQ(project_options.names,
+            std::vector<std::string>{"multiply(b, add(2, 3))"});
+
+  const auto& filter = GetInput(optimized);
+  ASSERT_EQ(checked_cast<const acero::FilterNodeOptions&>(*filter.options)
+                .filter_expression,
+            compute::greater(field_ref("a"), literal(2)));
+  CheckOptimize(plan, options);
+}
+
+TEST_F(TestPlanOptimizer, RemoveTrueFilter) {
+  auto plan = acero::Declaration::Sequence({
+      Scan(),
+      {"filter", acero::FilterNodeOptions{compute::less(literal(1), literal(2))}},
+  });
+  auto optimized = CheckOptimize(plan);
+  ASSERT_EQ(optimized.factory_name, "scan");
+}
+
+TEST_F(TestPlanOptimizer, PushDownFilters) {
+  auto a_greater = compute::greater(field_ref("a"), literal(1));
+  auto b_less = compute::less(field_ref("b"), literal(40));
+  auto plan = acero::Declaration::Sequence({
+      Scan(),
+      {"filter", acero::FilterNodeOptions{a_greater}},
+      {"filter", acero::FilterNodeOptions{b_less}},
+  });
+  auto optimized = CheckOptimize(plan);
+
+  // The filters are merged, and still applied after the scan
+  ASSERT_EQ(optimized.factory_name, "filter");
+  ASSERT_EQ(checked_cast<const acero::FilterNodeOptions&>(*optimized.options)
+                .filter_expression,
+            compute::and_(a_greater, b_less));
+  const auto& scan = GetInput(optimized);
+  ASSERT_EQ(GetScanOptions(scan).filter, compute::and_(a_greater, b_less));
+
+  // The options of the original plan are unchanged
+  ASSERT_EQ(GetScanOptions(GetInput(GetInput(plan))).filter, literal(true));
+}
+
+TEST_F(TestPlanOptimizer, PushDownProjection) {
+  auto plan = acero::Declaration::Sequence({
+      Scan(),
+      {"filter", acero::FilterNodeOptions{compute::greater(field_ref("a"), literal(1))}},
+      {"project", acero::ProjectNodeOptions{{field_ref("c")}, {"c"}}},
+  });
+  auto optimized = CheckOptimize(plan);
+
+  const auto& scan = GetInput(GetInput(optimized));
+  const ScanOptions& scan_options = GetScanOptions(scan);
+  ASSERT_NE(scan_options.projected_schema, nullptr);
+  ASSERT_EQ(scan_options.projected_schema->field_names(),
+            (std::vector<std::string>{"a", "c"}));
+}
+
+TEST_F(TestPlanOptimizer, PushDownProjectionScanV2) {
+  auto plan = acero::Declaration::Sequence({
+      ScanV2(),
+      {"filter", acero::FilterNodeOptions{compute::greater(field_ref("a"), literal(1))}},
+      {"project", acero::ProjectNodeOptions{{field_ref("c"), field_ref(FieldRef(2))}}},
+  });
+  auto optimized = CheckOptimize(plan);
+
+  // The references to "c" are renumbered, the output names are kept
+  const auto& project_options =
+      checked_cast<const acero::ProjectNodeOptions&>(*optimized.options);
+  ASSERT_EQ(project_options.expressions[1], field_ref(FieldRef(1)));
+  const auto& scan = GetInput(GetInput(optimized));
+  const auto& scan_options = checked_cast<const ScanV2Options&>(*scan.options);
+  std::vector<FieldPath> expected_columns = {FieldPath({0}), FieldPath({2})};
+  ASSERT_EQ(scan_options.columns, expected_columns);
+  ASSERT_EQ(scan_options.filter, compute::greater(field_ref(FieldRef(0)), literal(1)));
+}
+
+TEST_F(TestPlanOptimizer, PushDownLimit) {
+  auto plan = acero::Declaration::Sequence({
+      Scan(/*implicit_ordering=*/true),
+      {"project", acero::ProjectNodeOptions{{field_ref("a")}, {"a"}}},
+      {"fetch", acero::FetchNodeOptions{1, 2}},
+  });
+  PlanOptimizerOptions options;
+  options.push_down_projections = false;
+  auto optimized = CheckOptimize(plan, options);
+
+  const ScanOptions& scan_options = GetScanOptions(GetInput(GetInput(optimized)));
+  ASSERT_EQ(scan_options.batch_size, 3);
+  ASSERT_EQ(scan_options.fragment_readahead, 1);
+}
+
+TEST_F(TestPlanOptimizer, ReorderJoins) {
+  auto fact = TableFromJSON(
+      schema({field("id", int32()), field("d1", int32()), field("d2", int32())}),
+      {R"([[1, 1, 1], [2, 1, 2], [3, 2, 1], [4, 2, 3], [5, 1, 3], [6, 2, 2]])"});
+  auto dim1 = TableFromJSON(schema({field("k1", int32()), field("v1", utf8())}),
+                            {R"([[1, "a"], [2, "b"]])"});
+  auto dim2 = TableFromJSON(schema({field("k2", int32()), field("v2", utf8())}),
+                            {R"([[1, "x"], [2, "y"], [3, "z"]])"});
+  auto source = [](std::shared_ptr<Table> table) {
+    return acero::Declaration{"table_source",
+                              acero::TableSourceNodeOptions{std::move(table)}};
+  };
+
+  // The fact table is the build side of the first join
+  acero::Declaration plan{
+      "hashjoin",
+      {acero::Declaration{"hashjoin",
+                          {source(dim1), source(fact)},
+                          acero::HashJoinNodeOptions{{"k1"}, {"d1"}}},
+       source(dim2)},
+      acero::HashJoinNodeOptions{{"d2"}, {"k2"}}};
+  ASSERT_OK_AND_ASSIGN(auto expected, acero::DeclarationToTable(plan));
+  ASSERT_OK_AND_ASSIGN(auto optimized, OptimizeDeclaration(plan));
+  ASSERT_OK_AND_ASSIGN(auto actual, acero::DeclarationToTable(optimized));
+  acero::AssertTablesEqualIgnoringOrder(expected, actual);
+
+  // The dimension tables are the build sides, a project restores the column order
+  ASSERT_EQ(optimized.factory_name, "project");
+  const auto& top_join = GetInput(optimized);
+  ASSERT_EQ(top_join.factory_name, "hashjoin");
+  const auto& bottom_join = GetInput(top_join);
+  ASSERT_EQ(bottom_join.factory_name, "hashjoin");
+  auto source_table = [](const acero::Declaration::Input& input) {
+    const auto& declaration = std::get<acero::Declaration>(input);
+    return checked_cast<const acero::TableSourceNodeOptions&>(*declaration.options)
+        .table;
+  };
+  ASSERT_EQ(source_table(bottom_join.inputs[0]), fact);
+  ASSERT_EQ(source_table(bottom_join.inputs[1]), dim1);
+  ASSERT_EQ(source_table(top_join.inputs[1]), dim2);
+
+  // Without statistics for an input, the joins are kept
+  auto unknown = acero::Declaration::Sequence({
+      source(dim2),
+      {"aggregate", acero::AggregateNodeOptions{{}, {"k2", "v2"}}},
+  });
+  acero::Declaration unknown_plan{"hashjoin",
+                                  {source(fact), std::move(unknown)},
+                                  acero::HashJoinNodeOptions{{"d2"}, {"k2"}}};
+  ASSERT_OK_AND_ASSIGN(optimized, OptimizeDeclaration(unknown_plan));
+  ASSERT_EQ(optimized.factory_name, "hashjoin");
+  ASSERT_EQ(source_table(optimized.inputs[0]), fact);
+}
+
+TEST_F(TestPlanOptimizer, ExecNodeInputs) {
+  // Nothing is known about inputs which are already ExecNodes
+  acero::Declaration filter{
+      "filter",
+      {static_cast<acero::ExecNode*>(nullptr)},
+      acero::FilterNodeOptions{compute::equal(literal(1), literal(1))}};
+  ASSERT_OK_AND_ASSIGN(auto optimized, OptimizeDeclaration(filter));
+  ASSERT_EQ(optimized.factory_name, "filter");
+  ASSERT_EQ(checked_cast<const acero::FilterNodeOptions&>(*optimized.options)
+                .filter_expression,
+            literal(true));
+}
+
+}  // namespace dataset
+}  // namespace arrow
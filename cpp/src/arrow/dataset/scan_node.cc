@@ -20,6 +20,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -36,6 +37,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string.h"
+#include "arrow/util/trace_events.h"
 #include "arrow/util/tracing_internal.h"
 #include "arrow/util/unreachable.h"
 
@@ -120,13 +122,24 @@ Future<AsyncGenerator<std::shared_ptr<Fragment>>> GetFragments(
 /// fragments.  On destruction we continue consuming the fragments until they complete
 /// (which should be fairly quick since we cancelled the fragment).  This ensures the
 /// I/O work is completely finished before the node is destroyed.
-class ScanNode : public acero::ExecNode, public acero::TracedNode {
+///
+/// A downstream node (e.g. a hash join which has finished its build side) may hand the
+/// scan a runtime filter.  It is combined with the scan filter for every fragment that
+/// has not started scanning yet, and fragments whose partition guarantee contradicts it
+/// are skipped entirely.  Fragments already being scanned are not affected.
+class ScanNode : public acero::ExecNode,
+                 public acero::TracedNode,
+                 public acero::RuntimeFilterTarget {
  public:
   ScanNode(acero::ExecPlan* plan, ScanV2Options options,
            std::shared_ptr<Schema> output_schema)
       : acero::ExecNode(plan, {}, {}, std::move(output_schema)),
         acero::TracedNode(this),
-        options_(std::move(options)) {}
+        options_(std::move(options)),
+        filter_(options_.filter),
+        batcher_(plan->query_context()->options().morsel_size,
+                 plan->query_context()->options().adaptive_morsel_size,
+                 plan->query_context()->memory_pool()) {}
 
   static Result<ScanV2Options> NormalizeAndValidate(const ScanV2Options& options,
                                                     compute::ExecContext* ctx) {
@@ -195,6 +208,81 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
   Status Init() override { return Status::OK(); }
 
+  Status AddRuntimeFilter(compute::Expression filter) override {
+    // The filter refers to our output columns, rewrite it against the dataset schema
+    ARROW_ASSIGN_OR_RAISE(
+        filter,
+        compute::ModifyExpression(
+            std::move(filter),
+            [this](compute::Expression expr) -> Result<compute::Expression> {
+              const FieldRef* ref = expr.field_ref();
+              if (ref) {
+                ARROW_ASSIGN_OR_RAISE(FieldPath path, ref->FindOne(*output_schema_));
+                std::vector<int> dataset_indices(options_.columns[path[0]].indices());
+                dataset_indices.insert(dataset_indices.end(), path.indices().begin() + 1,
+                                       path.indices().end());
+                return compute::field_ref(FieldRef(std::move(dataset_indices)));
+              }
+              return expr;
+            },
+            [](compute::Expression expr, compute::Expression* old_expr) {
+              return expr;
+            }));
+    std::lock_guard<std::mutex> lk(filter_mutex_);
+    ARROW_ASSIGN_OR_RAISE(filter_, compute::and_(filter_, std::move(filter))
+                                       .Bind(*options_.dataset->schema(),
+                                             plan_->query_context()->exec_context()));
+    simplified_filters_.clear();
+    return Status::OK();
+  }
+
+  // The scan filter, combined with all runtime filters received so far, simplified
+  // against a fragment's partition expression.
+  //
+  // All the fragments of a partition usually share the same partition expression
+  // (partitionings intern them), so the simplification is memoized per partition
+  // expression until the next runtime filter arrives.
+  Result<compute::Expression> FilterForPartition(const compute::Expression& partition) {
+    compute::Expression filter;
+    {
+      std::lock_guard<std::mutex> lk(filter_mutex_);
+      auto it = simplified_filters_.find(partition);
+      if (it != simplified_filters_.end()) return it->second;
+      filter = filter_;
+    }
+    ARROW_ASSIGN_OR_RAISE(compute::Expression guarantee, PartitionGuarantee(partition));
+    ARROW_ASSIGN_OR_RAISE(compute::Expression simplified,
+                          compute::SimplifyWithGuarantee(std::move(filter), guarantee));
+    std::lock_guard<std::mutex> lk(filter_mutex_);
+    // Don't memoize against a filter that a runtime filter replaced meanwhile
+    if (Identical(filter, filter_)) {
+      simplified_filters_.emplace(partition, simplified);
+    }
+    return simplified;
+  }
+
+  // Simplification only matches field refs spelled the same way, and runtime filters
+  // refer to fields by path while partition expressions usually use names.  Add a copy
+  // of the partition expression that refers to the same fields by path.
+  Result<compute::Expression> PartitionGuarantee(const compute::Expression& partition) {
+    const Schema& dataset_schema = *options_.dataset->schema();
+    ARROW_ASSIGN_OR_RAISE(
+        compute::Expression by_path,
+        compute::ModifyExpression(
+            partition,
+            [&](compute::Expression expr) -> Result<compute::Expression> {
+              const FieldRef* ref = expr.field_ref();
+              if (ref && !ref->IsFieldPath()) {
+                Result<FieldPath> path = ref->FindOne(dataset_schema);
+                if (path.ok()) return compute::field_ref(std::move(*path));
+              }
+              return expr;
+            },
+            [](compute::Expression expr, compute::Expression*) { return expr; }));
+    if (by_path == partition) return partition;
+    return compute::and_(partition, std::move(by_path));
+  }
+
   struct KnownValue {
     std::size_t index;
     Datum value;
@@ -225,6 +313,7 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
     Result<Future<>> operator()() override {
       // Prevent concurrent calls to ScanBatch which might not be thread safe
       std::lock_guard<std::mutex> lk(scan_->mutex);
+      ARROW_TRACE_SCOPE("dataset", "ScanNode::ScanBatch");
       return scan_->fragment_scanner->ScanBatch(batch_index_)
           .Then([this](const std::shared_ptr<RecordBatch>& batch) {
             return HandleBatch(batch);
@@ -257,17 +346,14 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
     }
 
     Status HandleBatch(const std::shared_ptr<RecordBatch>& batch) {
+      util::tracing::ScopedTraceEvent trace_event("dataset", "ScanNode::HandleBatch");
+      trace_event.set_value(batch->num_rows());
       ARROW_ASSIGN_OR_RAISE(
           compute::ExecBatch evolved_batch,
           scan_->fragment_evolution->EvolveBatch(
               batch, node_->options_.columns, *scan_->scan_request.fragment_selection));
       compute::ExecBatch with_known_values = AddKnownValues(std::move(evolved_batch));
-      node_->plan_->query_context()->ScheduleTask(
-          [node = node_, output_batch = std::move(with_known_values)] {
-            return node->output_->InputReceived(node, output_batch);
-          },
-          "ScanNode::ProcessMorsel");
-      return Status::OK();
+      return node_->DeliverMorsels(std::move(with_known_values));
     }
 
     int cost() const override { return cost_; }
@@ -286,6 +372,8 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
     }
 
     Result<Future<>> operator()() override {
+      ARROW_ASSIGN_OR_RAISE(bool skip, CanSkipFragment());
+      if (skip) return Future<>::MakeFinished();
       return fragment
           ->InspectFragment(node->options_.format_options,
                             node->plan_->query_context()->exec_context())
@@ -296,6 +384,13 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
     std::string_view name() const override { return name_; }
 
+    // A runtime filter may have ruled out this fragment since it was listed
+    Result<bool> CanSkipFragment() {
+      ARROW_ASSIGN_OR_RAISE(compute::Expression filter_minus_part,
+                            node->FilterForPartition(fragment->partition_expression()));
+      return !filter_minus_part.IsSatisfiable();
+    }
+
     struct ExtractedKnownValues {
       // Columns that must be loaded from the fragment
       std::vector<FieldPath> remaining_columns;
@@ -339,11 +434,11 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
     Future<> BeginScan(const std::shared_ptr<InspectedFragment>& inspected_fragment) {
       // Based on the fragment's guarantee we may not need to retrieve all the columns
-      compute::Expression fragment_filter = node->options_.filter;
-      ARROW_ASSIGN_OR_RAISE(
-          compute::Expression filter_minus_part,
-          compute::SimplifyWithGuarantee(std::move(fragment_filter),
-                                         fragment->partition_expression()));
+      ARROW_ASSIGN_OR_RAISE(compute::Expression filter_minus_part,
+                            node->FilterForPartition(fragment->partition_expression()));
+      if (!filter_minus_part.IsSatisfiable()) {
+        return Future<>::MakeFinished();
+      }
 
       ARROW_ASSIGN_OR_RAISE(
           ExtractedKnownValues extracted,
@@ -420,12 +515,48 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
     std::string name_;
   };
 
+  // Slice or concatenate a scanned batch into morsels and process each in its own
+  // task.  The batch was counted in num_batches_ when its fragment was listed.
+  Status DeliverMorsels(compute::ExecBatch batch) {
+    std::vector<compute::ExecBatch> morsels;
+    {
+      std::lock_guard<std::mutex> lk(batcher_mutex_);
+      ARROW_ASSIGN_OR_RAISE(morsels, batcher_.Push(std::move(batch)));
+    }
+    num_batches_.fetch_add(static_cast<int>(morsels.size()) - 1);
+    ScheduleMorsels(std::move(morsels));
+    return Status::OK();
+  }
+
+  void ScheduleMorsels(std::vector<compute::ExecBatch> morsels) {
+    for (auto& morsel : morsels) {
+      plan_->query_context()->ScheduleTask(
+          [this, output_batch = std::move(morsel)]() mutable {
+            const int64_t num_rows = output_batch.length;
+            return batcher_.RunMorsel(num_rows, [&] {
+              return output_->InputReceived(this, std::move(output_batch));
+            });
+          },
+          "ScanNode::ProcessMorsel");
+    }
+  }
+
+  Status FinishScan() {
+    std::vector<compute::ExecBatch> morsels;
+    {
+      std::lock_guard<std::mutex> lk(batcher_mutex_);
+      ARROW_ASSIGN_OR_RAISE(morsels, batcher_.Finish());
+    }
+    num_batches_.fetch_add(static_cast<int>(morsels.size()));
+    ScheduleMorsels(std::move(morsels));
+    return output_->InputFinished(this, num_batches_.load());
+  }
+
   void ScanFragments(const AsyncGenerator<std::shared_ptr<Fragment>>& frag_gen) {
     std::shared_ptr<util::AsyncTaskScheduler> fragment_tasks =
         util::MakeThrottledAsyncTaskGroup(
             plan_->query_context()->async_scheduler(), options_.fragment_readahead + 1,
-            /*queue=*/nullptr,
-            [this]() { return output_->InputFinished(this, num_batches_.load()); });
+            /*queue=*/nullptr, [this]() { return FinishScan(); });
     fragment_tasks->AddAsyncGenerator<std::shared_ptr<Fragment>>(
         frag_gen,
         [this, fragment_tasks =
@@ -463,8 +594,15 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
  private:
   ScanV2Options options_;
+  std::mutex filter_mutex_;
+  compute::Expression filter_;
+  // Guarded by filter_mutex_, see FilterForPartition()
+  std::unordered_map<compute::Expression, compute::Expression, compute::Expression::Hash>
+      simplified_filters_;
   std::atomic<int> num_batches_{0};
   std::shared_ptr<util::ThrottledAsyncTaskScheduler> batches_throttle_;
+  std::mutex batcher_mutex_;
+  acero::MorselBatcher batcher_;
 };
 
 }  // namespace
@@ -40,6 +40,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/config.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
@@ -333,6 +334,17 @@ Result<EnumeratedRecordBatchGenerator> FragmentToBatches(
 
 Result<AsyncGenerator<EnumeratedRecordBatchGenerator>> FragmentsToBatches(
     FragmentGenerator fragment_gen, const std::shared_ptr<ScanOptions>& options) {
+  if (options->use_threads) {
+    // Split large fragments so that their parts are scanned in parallel; the
+    // enumeration below keeps the parts in order
+    fragment_gen = MakeFlatMappedGenerator(
+        std::move(fragment_gen),
+        [options](const std::shared_ptr<Fragment>& fragment)
+            -> Result<FragmentGenerator> {
+          ARROW_ASSIGN_OR_RAISE(auto parts, fragment->SplitForScan(options));
+          return MakeVectorGenerator(std::move(parts));
+        });
+  }
   auto enumerated_fragment_gen = MakeEnumeratedGenerator(std::move(fragment_gen));
   auto batch_gen_gen =
       MakeMappedGenerator(std::move(enumerated_fragment_gen),
@@ -1037,7 +1049,16 @@ Result<acero::ExecNode*> MakeScanNode(acero::ExecPlan* plan,
   }
 
   AsyncGenerator<EnumeratedRecordBatch> batch_gen;
-  if (scan_options->fragment_readahead > 1) {
+  if (scan_options->adaptive_readahead) {
+    const int max_readahead = std::max(scan_options->fragment_readahead, 1) *
+                              std::max(scan_options->batch_readahead, 1);
+    batch_gen = MakeAdaptiveReadaheadGenerator<EnumeratedRecordBatch>(
+        std::move(merged_batch_gen), scan_options->fragment_readahead, max_readahead,
+        [](const EnumeratedRecordBatch& batch) {
+          return util::TotalBufferSize(*batch.record_batch.value);
+        },
+        scan_options->target_bytes_readahead);
+  } else if (scan_options->fragment_readahead > 1) {
     batch_gen = MakeReadaheadGenerator(std::move(merged_batch_gen),
                                        scan_options->fragment_readahead);
   } else {
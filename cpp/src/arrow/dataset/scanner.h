@@ -96,6 +96,21 @@ struct ARROW_DS_EXPORT ScanOptions {
   /// Note: Will be ignored if use_threads is set to false
   int32_t fragment_readahead = kDefaultFragmentReadahead;
 
+  /// Whether to adapt the number of batches read ahead to the scan
+  ///
+  /// If true, the scanner reads ahead between 1 and
+  /// fragment_readahead * batch_readahead batches of the fragments being scanned:
+  /// more while the consumer waits for batches, fewer while the batches read ahead
+  /// are not consumed, and none while the batches read ahead but not consumed yet
+  /// total target_bytes_readahead or more.  fragment_readahead still bounds the
+  /// number of fragments scanned at once.
+  ///
+  /// Note: Will be ignored if use_threads is set to false
+  bool adaptive_readahead = false;
+
+  /// Memory budget of the batches read ahead, if adaptive_readahead is true
+  int64_t target_bytes_readahead = kDefaultBytesReadahead;
+
   /// A pool from which materialized and scanned arrays will be allocated.
   MemoryPool* pool = arrow::default_memory_pool();
 
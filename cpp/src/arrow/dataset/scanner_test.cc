@@ -25,6 +25,7 @@
 #include <gmock/gmock.h>
 
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/util.h"
 #include "arrow/compute/api.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
@@ -781,6 +782,56 @@ TEST(TestNewScanner, PartitionSkip) {
   }
 }
 
+TEST(TestNewScanner, RuntimeFilterSkipsFragments) {
+  internal::Initialize();
+  std::shared_ptr<MockDataset> test_dataset = MakePartitionSkipDataset();
+  test_dataset->DeliverBatchesInOrder(false);
+  ScanV2Options options(test_dataset);
+  options.columns = ScanV2Options::AllColumns(*test_dataset->schema());
+
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<acero::ExecPlan> plan, acero::ExecPlan::Make());
+  AsyncGenerator<std::optional<compute::ExecBatch>> sink_gen;
+  acero::Declaration scan_and_sink = acero::Declaration::Sequence(
+      {{"scan2", options}, {"sink", acero::SinkNodeOptions{&sink_gen}}});
+  ASSERT_OK_AND_ASSIGN(acero::ExecNode * sink, scan_and_sink.AddToPlan(plan.get()));
+  auto* scan = dynamic_cast<acero::RuntimeFilterTarget*>(sink->inputs()[0]);
+  ASSERT_NE(scan, nullptr);
+  ASSERT_OK(scan->AddRuntimeFilter(less(field_ref("filterable"), literal(75))));
+
+  plan->StartProducing();
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(sink_gen));
+  ASSERT_FINISHES_OK(plan->finished());
+  ASSERT_EQ(1, batches.size());
+  ASSERT_EQ(kRowsPerTestBatch, batches[0]->length);
+  ASSERT_FALSE(test_dataset->fragments_[0]->has_inspected());
+  ASSERT_TRUE(test_dataset->fragments_[1]->has_started());
+}
+
+TEST(TestNewScanner, RuntimeFilterFromHashJoin) {
+  internal::Initialize();
+  for (std::string build_keys : {"[50, 60, null]", "[null]", "[]"}) {
+    ARROW_SCOPED_TRACE("Build side keys: ", build_keys);
+    std::shared_ptr<MockDataset> test_dataset = MakePartitionSkipDataset();
+    test_dataset->DeliverBatchesInOrder(false);
+    ScanV2Options options(test_dataset);
+    options.columns = ScanV2Options::AllColumns(*test_dataset->schema());
+
+    auto build_table = TableFromJSON(schema({field("key", int16())}), {build_keys});
+    acero::Declaration join{
+        "hashjoin",
+        {acero::Declaration("scan2", options),
+         acero::Declaration("table_source", acero::TableSourceNodeOptions(build_table))},
+        acero::HashJoinNodeOptions{acero::JoinType::LEFT_SEMI, {"filterable"}, {"key"}}};
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> joined,
+                         acero::DeclarationToTable(std::move(join)));
+
+    // Whether the first fragment is skipped depends on when the build side finishes,
+    // but the result must not
+    int64_t expected_rows = build_keys == "[50, 60, null]" ? kRowsPerTestBatch : 0;
+    ASSERT_EQ(expected_rows, joined->num_rows());
+  }
+}
+
 TEST(TestNewScanner, NoFragments) {
   internal::Initialize();
   std::shared_ptr<Schema> test_schema = ScannerTestSchema();
@@ -1043,6 +1094,16 @@ TEST_P(TestScanner, ScanBatches) {
   AssertScanBatchesEqualRepetitionsOf(MakeScanner(batch), batch);
 }
 
+TEST_P(TestScanner, ScanBatchesAdaptiveReadahead) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  auto batch = ConstantArrayGenerator::Zeroes(GetParam().items_per_batch, schema_);
+  options_->adaptive_readahead = true;
+  AssertScanBatchesEqualRepetitionsOf(MakeScanner(batch), batch);
+  // A budget smaller than a batch still reads one batch at a time
+  options_->target_bytes_readahead = 1;
+  AssertScanBatchesEqualRepetitionsOf(MakeScanner(batch), batch);
+}
+
 TEST_P(TestScanner, ScanBatchesUnordered) {
   SetSchema({field("i32", int32()), field("f64", float64())});
   auto batch = ConstantArrayGenerator::Zeroes(GetParam().items_per_batch, schema_);
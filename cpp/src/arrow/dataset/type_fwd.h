@@ -50,6 +50,7 @@ class FileWriter;
 class FileWriteOptions;
 class FileSystemDataset;
 class FileSystemDatasetFactory;
+struct DatasetManifest;
 struct FileSystemDatasetWriteOptions;
 class WriteNodeOptions;
 
@@ -82,6 +83,10 @@ class IpcFileWriter;
 class IpcFileWriteOptions;
 class IpcFragmentScanOptions;
 
+class OrcFileFormat;
+class OrcFileWriter;
+class OrcFileWriteOptions;
+
 class ParquetFileFormat;
 class ParquetFileFragment;
 class ParquetFragmentScanOptions;
@@ -107,7 +107,8 @@ struct ARROW_ENGINE_EXPORT ConversionOptions {
         named_table_provider(kDefaultNamedTableProvider),
         named_tap_provider(default_named_tap_provider()),
         extension_provider(default_extension_provider()),
-        allow_arrow_extensions(false) {}
+        allow_arrow_extensions(false),
+        optimize_plan(false) {}
 
   /// \brief How strictly the converter should adhere to the structure of the input.
   ConversionStrictness strictness;
@@ -129,6 +130,12 @@ struct ARROW_ENGINE_EXPORT ConversionOptions {
   /// Set to false to create plans that are more likely to be compatible with non-Arrow
   /// engines
   bool allow_arrow_extensions;
+  /// \brief If true then the converted plans are rewritten with
+  /// dataset::OptimizeDeclaration
+  ///
+  /// Filters, projections and limits are pushed into the scans of read relations,
+  /// and constant expressions are folded.
+  bool optimize_plan;
 };
 
 }  // namespace engine
@@ -34,6 +34,7 @@
 #include "arrow/buffer.h"
 #include "arrow/compute/expression.h"
 #include "arrow/dataset/file_base.h"
+#include "arrow/dataset/plan_optimizer.h"
 #include "arrow/engine/substrait/expression_internal.h"
 #include "arrow/engine/substrait/extended_expression_internal.h"
 #include "arrow/engine/substrait/extension_set.h"
@@ -67,6 +68,22 @@ Result<Message> ParseFromBuffer(const Buffer& buf) {
   return message;
 }
 
+namespace {
+
+// Rewrite the declaration of a converted relation with the plan optimizer, if the
+// conversion options ask for it
+Status MaybeOptimize(DeclarationInfo* decl_info,
+                     const ConversionOptions& conversion_options) {
+  if (conversion_options.optimize_plan) {
+    ARROW_ASSIGN_OR_RAISE(
+        decl_info->declaration,
+        dataset::OptimizeDeclaration(std::move(decl_info->declaration)));
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
 Result<std::shared_ptr<Buffer>> SerializePlan(
     const acero::Declaration& declaration, ExtensionSet* ext_set,
     const ConversionOptions& conversion_options) {
@@ -103,6 +120,7 @@ Result<acero::Declaration> DeserializeRelation(
     const ConversionOptions& conversion_options) {
   ARROW_ASSIGN_OR_RAISE(auto rel, ParseFromBuffer<substrait::Rel>(buf));
   ARROW_ASSIGN_OR_RAISE(auto decl_info, FromProto(rel, ext_set, conversion_options));
+  RETURN_NOT_OK(MaybeOptimize(&decl_info, conversion_options));
   return std::move(decl_info.declaration);
 }
 
@@ -159,6 +177,7 @@ Result<std::vector<acero::Declaration>> DeserializePlans(
         auto decl_info,
         FromProto(plan_rel.has_root() ? plan_rel.root().input() : plan_rel.rel(), ext_set,
                   conversion_options));
+    RETURN_NOT_OK(MaybeOptimize(&decl_info, conversion_options));
     std::vector<std::string> names;
     if (plan_rel.has_root()) {
       names.assign(plan_rel.root().names().begin(), plan_rel.root().names().end());
@@ -224,6 +243,7 @@ ARROW_ENGINE_EXPORT Result<PlanInfo> DeserializePlan(
       auto decl_info,
       FromProto(root_rel.has_root() ? root_rel.root().input() : root_rel.rel(), ext_set,
                 conversion_options));
+  RETURN_NOT_OK(MaybeOptimize(&decl_info, conversion_options));
 
   std::vector<std::string> names;
   if (root_rel.has_root()) {
@@ -19,6 +19,7 @@
 
 #include "arrow/util/config.h"  // IWYU pragma: export
 
+#include "arrow/filesystem/cachingfs.h"   // IWYU pragma: export
 #include "arrow/filesystem/filesystem.h"  // IWYU pragma: export
 #ifdef ARROW_AZURE
 #  include "arrow/filesystem/azurefs.h"  // IWYU pragma: export
@@ -17,7 +17,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <optional>
 
 #include "arrow/filesystem/azurefs.h"
@@ -48,6 +50,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string.h"
+#include "arrow/util/value_parsing.h"
 
 namespace arrow::fs {
 
@@ -159,6 +162,14 @@ Status AzureOptions::ExtractFromUriQuery(const Uri& uri) {
     } else if (kv.first == "background_writes") {
       ARROW_ASSIGN_OR_RAISE(background_writes,
                             ::arrow::internal::ParseBoolean(kv.second));
+    } else if (kv.first == "max_background_write_bytes") {
+      if (!::arrow::internal::ParseValue<Int64Type>(kv.second.data(), kv.second.size(),
+                                                    &max_background_write_bytes) ||
+          max_background_write_bytes <= 0) {
+        return Status::Invalid(
+            "max_background_write_bytes must be a positive integer, got '", kv.second,
+            "'");
+      }
     } else if (sas_token_query_parameters.find(kv.first) !=
                sas_token_query_parameters.end()) {
       credential_kind = CredentialKind::kSASToken;
@@ -989,7 +1000,8 @@ class ObjectAppendStream final : public io::OutputStream {
       : block_blob_client_(std::move(block_blob_client)),
         io_context_(io_context),
         location_(location),
-        background_writes_(options.background_writes) {
+        background_writes_(options.background_writes),
+        max_background_write_bytes_(options.max_background_write_bytes) {
     if (metadata && metadata->size() != 0) {
       ArrowMetadataToCommitBlockListOptions(metadata, commit_block_list_options_);
     } else if (options.default_metadata && options.default_metadata->size() != 0) {
@@ -1224,8 +1236,17 @@ class ObjectAppendStream final : public io::OutputStream {
     return Status::OK();
   }
 
-  std::string CreateBlock() {
+  std::string CreateBlock(int64_t nbytes) {
     std::unique_lock<std::mutex> lock(upload_state_->mutex);
+    if (background_writes_) {
+      // Wait for enough blocks to be staged, unless none is
+      upload_state_->bytes_staged.wait(lock, [&] {
+        return upload_state_->bytes_in_progress == 0 ||
+               upload_state_->bytes_in_progress + nbytes <= max_background_write_bytes_;
+      });
+      upload_state_->bytes_in_progress += nbytes;
+    }
+
     const auto n_block_ids = upload_state_->block_ids.size();
 
     // New block ID must always be distinct from the existing block IDs. Otherwise we
@@ -1266,7 +1287,7 @@ class ObjectAppendStream final : public io::OutputStream {
       return Status::OK();
     }
 
-    const auto block_id = CreateBlock();
+    const auto block_id = CreateBlock(nbytes);
 
     if (background_writes_) {
       if (owned_buffer == nullptr) {
@@ -1284,7 +1305,7 @@ class ObjectAppendStream final : public io::OutputStream {
                                                  owned_buffer->size());
 
         auto status = StageBlock(block_blob_client.get(), block_id, block_content);
-        HandleUploadOutcome(state, status);
+        HandleUploadOutcome(state, owned_buffer->size(), status);
         return Status::OK();
       };
       RETURN_NOT_OK(io::internal::SubmitIO(io_context_, std::move(deferred)));
@@ -1303,11 +1324,13 @@ class ObjectAppendStream final : public io::OutputStream {
   }
 
   static void HandleUploadOutcome(const std::shared_ptr<UploadState>& state,
-                                  const Status& status) {
+                                  int64_t nbytes, const Status& status) {
     std::unique_lock<std::mutex> lock(state->mutex);
     if (!status.ok()) {
       state->status &= status;
     }
+    state->bytes_in_progress -= nbytes;
+    state->bytes_staged.notify_all();
     // Notify completion
     if (--state->blocks_in_progress == 0) {
       auto fut = state->pending_blocks_completed;
@@ -1320,6 +1343,7 @@ class ObjectAppendStream final : public io::OutputStream {
   const io::IOContext io_context_;
   const AzureLocation location_;
   const bool background_writes_;
+  const int64_t max_background_write_bytes_;
   int64_t content_length_ = kNoSize;
 
   std::shared_ptr<io::BufferOutputStream> current_block_;
@@ -1335,6 +1359,8 @@ class ObjectAppendStream final : public io::OutputStream {
     std::mutex mutex;
     std::vector<std::string> block_ids;
     int64_t blocks_in_progress = 0;
+    int64_t bytes_in_progress = 0;
+    std::condition_variable bytes_staged;
     Status status;
     Future<> pending_blocks_completed = Future<>::MakeFinished(Status::OK());
   };
@@ -111,6 +111,13 @@ struct ARROW_EXPORT AzureOptions {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// \brief The maximum number of bytes of blocks being staged in the background
+  /// by each OutputStream.
+  ///
+  /// Writes block when this limit is reached, until enough blocks are staged.
+  /// At least one block is always staged, however large.
+  int64_t max_background_write_bytes = 256 * 1024 * 1024;
+
  private:
   enum class CredentialKind {
     kDefault,
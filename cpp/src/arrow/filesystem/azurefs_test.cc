@@ -649,6 +649,20 @@ class TestAzureOptions : public ::testing::Test {
     ASSERT_EQ(options.background_writes, false);
   }
 
+  void TestFromUriMaxBackgroundWriteBytes() {
+    std::string path;
+    ASSERT_OK_AND_ASSIGN(
+        auto options,
+        AzureOptions::FromUri("abfs://account@127.0.0.1:10000/container/dir/blob?"
+                              "max_background_write_bytes=1048576",
+                              &path));
+    ASSERT_EQ(options.max_background_write_bytes, 1048576);
+    ASSERT_RAISES(Invalid,
+                  AzureOptions::FromUri("abfs://account@127.0.0.1:10000/container?"
+                                        "max_background_write_bytes=0",
+                                        &path));
+  }
+
   void TestFromUriCredentialDefault() {
     ASSERT_OK_AND_ASSIGN(
         auto options,
@@ -816,6 +830,9 @@ TEST_F(TestAzureOptions, FromUriEnableTls) { TestFromUriEnableTls(); }
 TEST_F(TestAzureOptions, FromUriDisableBackgroundWrites) {
   TestFromUriDisableBackgroundWrites();
 }
+TEST_F(TestAzureOptions, FromUriMaxBackgroundWriteBytes) {
+  TestFromUriMaxBackgroundWriteBytes();
+}
 TEST_F(TestAzureOptions, FromUriCredentialDefault) { TestFromUriCredentialDefault(); }
 TEST_F(TestAzureOptions, FromUriCredentialAnonymous) { TestFromUriCredentialAnonymous(); }
 TEST_F(TestAzureOptions, FromUriCredentialClientSecret) {
@@ -2983,6 +3000,12 @@ TEST_F(TestAzuriteFileSystem, OpenOutputStreamLargeNoBackgroundWrites) {
 
 TEST_F(TestAzuriteFileSystem, OpenOutputStreamLarge) { TestOpenOutputStreamLarge(); }
 
+TEST_F(TestAzuriteFileSystem, OpenOutputStreamLargeMaxBackgroundWriteBytes) {
+  // Only one block is staged at a time
+  options_.max_background_write_bytes = 1;
+  TestOpenOutputStreamLarge();
+}
+
 TEST_F(TestAzuriteFileSystem, OpenOutputStreamLargeSingleWriteNoBackgroundWrites) {
   options_.background_writes = false;
   TestOpenOutputStreamLargeSingleWrite();
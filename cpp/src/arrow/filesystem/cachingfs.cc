@@ -0,0 +1,511 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/cachingfs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <utility>
+
+#ifdef _WIN32
+#  include <sys/utime.h>
+#else
+#  include <utime.h>
+#endif
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/key_value_metadata.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/string.h"
+
+namespace arrow {
+
+using internal::ToChars;
+
+namespace fs {
+
+bool CachingFileSystemOptions::Equals(const CachingFileSystemOptions& other) const {
+  return cache_dir == other.cache_dir && block_size == other.block_size &&
+         max_size == other.max_size;
+}
+
+namespace internal {
+
+namespace {
+
+// Mark a cached block as recently used, so that the processes sharing the cache evict
+// the least recently used blocks
+void TouchFile(const std::string& path) {
+  auto maybe_filename = ::arrow::internal::PlatformFilename::FromString(path);
+  if (!maybe_filename.ok()) {
+    return;
+  }
+#ifdef _WIN32
+  ARROW_UNUSED(_wutime(maybe_filename->ToNative().c_str(), nullptr));
+#else
+  ARROW_UNUSED(utime(maybe_filename->ToNative().c_str(), nullptr));
+#endif
+}
+
+}  // namespace
+
+// The blocks of files cached in a local directory
+//
+// Each block is stored in its own file, whose name is derived from a hash of the key
+// of the file (its path and version) and the index of the block.  A cached block
+// starts with the length of the key and the key itself, so that a hash collision is
+// a cache miss rather than wrong data.  Blocks are written to a temporary file and
+// then renamed, so that the processes sharing the directory never see partial blocks.
+class BlockCache {
+ public:
+  BlockCache(std::string cache_dir, int64_t max_size)
+      : cache_dir_(std::move(cache_dir)),
+        max_size_(max_size),
+        temp_suffix_(".tmp-" + ToChars(::arrow::internal::GetRandomSeed()) + "-") {}
+
+  static Result<std::shared_ptr<BlockCache>> Make(
+      const CachingFileSystemOptions& options) {
+    auto cache = std::make_shared<BlockCache>(options.cache_dir, options.max_size);
+    RETURN_NOT_OK(cache->local_fs_.CreateDir(cache->cache_dir_, /*recursive=*/true));
+    std::lock_guard<std::mutex> lock(cache->trim_mutex_);
+    RETURN_NOT_OK(cache->Trim());
+    return cache;
+  }
+
+  // Return the cached block, or null if it isn't cached
+  std::shared_ptr<Buffer> Get(const std::string& key, int64_t index) {
+    const std::string path = BlockPath(key, index);
+    auto maybe_block = ReadBlock(path, key);
+    if (!maybe_block.ok() || *maybe_block == nullptr) {
+      ++misses_;
+      return nullptr;
+    }
+    TouchFile(path);
+    ++hits_;
+    return maybe_block.MoveValueUnsafe();
+  }
+
+  Status Put(const std::string& key, int64_t index, const Buffer& block) {
+    const std::string path = BlockPath(key, index);
+    const std::string temp_path = path + temp_suffix_ + ToChars(temp_counter_++);
+    RETURN_NOT_OK(local_fs_.CreateDir(
+        fs::internal::GetAbstractPathParent(path).first, /*recursive=*/true));
+    Status st = WriteBlock(temp_path, key, block);
+    if (st.ok()) {
+      st = local_fs_.Move(temp_path, path);
+    }
+    if (!st.ok()) {
+      ARROW_UNUSED(local_fs_.DeleteFile(temp_path));
+      return st;
+    }
+
+    const int64_t block_size = HeaderSize(key) + block.size();
+    if ((size_ += block_size) > max_size_) {
+      std::lock_guard<std::mutex> lock(trim_mutex_);
+      // Another thread may have trimmed the cache in the meantime
+      if (size_.load() > max_size_) {
+        RETURN_NOT_OK(Trim());
+      }
+    }
+    return Status::OK();
+  }
+
+  int64_t hits() const { return hits_.load(); }
+  int64_t misses() const { return misses_.load(); }
+
+ private:
+  static int64_t HeaderSize(const std::string& key) {
+    return static_cast<int64_t>(sizeof(uint64_t) + key.size());
+  }
+
+  std::string BlockPath(const std::string& key, int64_t index) const {
+    const uint64_t hash = bit_util::ToLittleEndian(
+        ::arrow::internal::ComputeStringHash<0>(key.data(), key.size()));
+    const std::string name =
+        HexEncode(reinterpret_cast<const uint8_t*>(&hash), sizeof(hash));
+    // Spread the blocks in subdirectories to keep directories small
+    return fs::internal::JoinAbstractPath(
+        std::vector<std::string>{cache_dir_, name.substr(0, 2),
+                                 name + "-" + ToChars(index)});
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadBlock(const std::string& path,
+                                            const std::string& key) {
+    ARROW_ASSIGN_OR_RAISE(auto file, local_fs_.OpenInputFile(path));
+    ARROW_ASSIGN_OR_RAISE(int64_t size, file->GetSize());
+    const int64_t header_size = HeaderSize(key);
+    if (size < header_size) {
+      return nullptr;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto contents, file->ReadAt(0, size));
+    RETURN_NOT_OK(file->Close());
+    uint64_t key_length;
+    std::memcpy(&key_length, contents->data(), sizeof(key_length));
+    if (contents->size() != size ||
+        bit_util::FromLittleEndian(key_length) != key.size() ||
+        std::memcmp(contents->data() + sizeof(key_length), key.data(), key.size()) != 0) {
+      return nullptr;
+    }
+    return SliceBuffer(std::move(contents), header_size);
+  }
+
+  Status WriteBlock(const std::string& path, const std::string& key,
+                    const Buffer& block) {
+    ARROW_ASSIGN_OR_RAISE(auto out, local_fs_.OpenOutputStream(path));
+    const uint64_t key_length =
+        bit_util::ToLittleEndian(static_cast<uint64_t>(key.size()));
+    RETURN_NOT_OK(out->Write(&key_length, sizeof(key_length)));
+    RETURN_NOT_OK(out->Write(key.data(), static_cast<int64_t>(key.size())));
+    RETURN_NOT_OK(out->Write(block.data(), block.size()));
+    return out->Close();
+  }
+
+  // Evict the least recently used blocks of the cache directory, including those of
+  // other processes, until the cache is below 90% of its maximum size
+  Status Trim() {
+    FileSelector selector;
+    selector.base_dir = cache_dir_;
+    selector.recursive = true;
+    ARROW_ASSIGN_OR_RAISE(auto infos, local_fs_.GetFileInfo(selector));
+    infos.erase(std::remove_if(infos.begin(), infos.end(),
+                               [](const FileInfo& info) { return !info.IsFile(); }),
+                infos.end());
+    std::sort(infos.begin(), infos.end(),
+              [](const FileInfo& left, const FileInfo& right) {
+                return left.mtime() < right.mtime();
+              });
+    int64_t size = 0;
+    for (const auto& info : infos) {
+      size += info.size();
+    }
+    const int64_t target_size = max_size_ - max_size_ / 10;
+    for (const auto& info : infos) {
+      if (size <= target_size) {
+        break;
+      }
+      // The block may be in use by another process or already deleted by it
+      if (local_fs_.DeleteFile(info.path()).ok()) {
+        size -= info.size();
+      }
+    }
+    size_ = size;
+    return Status::OK();
+  }
+
+  LocalFileSystem local_fs_;
+  const std::string cache_dir_;
+  const int64_t max_size_;
+  const std::string temp_suffix_;
+  std::atomic<uint64_t> temp_counter_{0};
+  // An estimate of the size of the cache, exact after each trim but which misses the
+  // blocks written by other processes since
+  std::atomic<int64_t> size_{0};
+  std::mutex trim_mutex_;
+  std::atomic<int64_t> hits_{0};
+  std::atomic<int64_t> misses_{0};
+};
+
+}  // namespace internal
+
+namespace {
+
+// A RandomAccessFile reading the blocks of a file from the cache, or from the file of
+// the base filesystem on a cache miss
+class CachedInputFile final : public io::RandomAccessFile {
+ public:
+  CachedInputFile(std::shared_ptr<io::RandomAccessFile> base_file,
+                  std::shared_ptr<internal::BlockCache> cache, std::string key,
+                  int64_t size, int64_t block_size)
+      : base_file_(std::move(base_file)),
+        cache_(std::move(cache)),
+        key_(std::move(key)),
+        size_(size),
+        block_size_(block_size) {}
+
+  Status Close() override { return base_file_->Close(); }
+
+  bool closed() const override { return base_file_->closed(); }
+
+  Result<int64_t> Tell() const override {
+    RETURN_NOT_OK(CheckClosed());
+    return pos_;
+  }
+
+  Result<int64_t> GetSize() override {
+    RETURN_NOT_OK(CheckClosed());
+    return size_;
+  }
+
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "seek"));
+    pos_ = position;
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<const KeyValueMetadata>> ReadMetadata() override {
+    return base_file_->ReadMetadata();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+    nbytes = std::min(nbytes, size_ - position);
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes) {
+      const int64_t index = (position + bytes_read) / block_size_;
+      ARROW_ASSIGN_OR_RAISE(auto block, GetBlock(index));
+      const int64_t block_offset = position + bytes_read - index * block_size_;
+      const int64_t length = std::min(nbytes - bytes_read, block->size() - block_offset);
+      if (length <= 0) {
+        break;
+      }
+      std::memcpy(static_cast<uint8_t*>(out) + bytes_read, block->data() + block_offset,
+                  length);
+      bytes_read += length;
+    }
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+    nbytes = std::min(nbytes, size_ - position);
+    const int64_t index = position / block_size_;
+    if (nbytes > 0 && (position + nbytes - 1) / block_size_ == index) {
+      // Reads within a block don't need copies
+      ARROW_ASSIGN_OR_RAISE(auto block, GetBlock(index));
+      const int64_t block_offset = position - index * block_size_;
+      const int64_t length = std::min(nbytes, block->size() - block_offset);
+      return SliceBuffer(std::move(block), block_offset, length);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          ReadAt(position, nbytes, buffer->mutable_data()));
+    RETURN_NOT_OK(buffer->Resize(bytes_read));
+    return std::shared_ptr<Buffer>(std::move(buffer));
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
+    pos_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(pos_, nbytes));
+    pos_ += buffer->size();
+    return buffer;
+  }
+
+ private:
+  Status CheckClosed() const {
+    if (closed()) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Status CheckPosition(int64_t position, const char* action) const {
+    if (position < 0) {
+      return Status::Invalid("Cannot ", action, " from negative position");
+    }
+    if (position > size_) {
+      return Status::IOError("Cannot ", action, " past end of file");
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Buffer>> GetBlock(int64_t index) {
+    const int64_t offset = index * block_size_;
+    const int64_t length = std::min(block_size_, size_ - offset);
+    auto block = cache_->Get(key_, index);
+    if (block != nullptr && block->size() == length) {
+      return block;
+    }
+    ARROW_ASSIGN_OR_RAISE(block, base_file_->ReadAt(offset, length));
+    if (block->size() == length) {
+      // Failing to cache a block doesn't fail the read
+      ARROW_UNUSED(cache_->Put(key_, index, *block));
+    }
+    return block;
+  }
+
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+  std::shared_ptr<internal::BlockCache> cache_;
+  const std::string key_;
+  const int64_t size_;
+  const int64_t block_size_;
+  int64_t pos_ = 0;
+};
+
+}  // namespace
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     CachingFileSystemOptions options,
+                                     std::shared_ptr<internal::BlockCache> cache)
+    : FileSystem(base_fs->io_context()),
+      base_fs_(std::move(base_fs)),
+      options_(std::move(options)),
+      cache_(std::move(cache)) {}
+
+CachingFileSystem::~CachingFileSystem() = default;
+
+Result<std::shared_ptr<CachingFileSystem>> CachingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, CachingFileSystemOptions options) {
+  if (options.cache_dir.empty()) {
+    return Status::Invalid("CachingFileSystem needs a cache directory");
+  }
+  if (options.block_size <= 0) {
+    return Status::Invalid("CachingFileSystem block size must be positive");
+  }
+  if (options.max_size < 0) {
+    return Status::Invalid("CachingFileSystem maximum size must not be negative");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto cache, internal::BlockCache::Make(options));
+  return std::shared_ptr<CachingFileSystem>(
+      new CachingFileSystem(std::move(base_fs), std::move(options), std::move(cache)));
+}
+
+bool CachingFileSystem::Equals(const FileSystem& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (other.type_name() != type_name()) {
+    return false;
+  }
+  const auto& caching = ::arrow::internal::checked_cast<const CachingFileSystem&>(other);
+  return base_fs_->Equals(caching.base_fs_) && options_.Equals(caching.options_);
+}
+
+Result<std::string> CachingFileSystem::PathFromUri(const std::string& uri_string) const {
+  return base_fs_->PathFromUri(uri_string);
+}
+
+int64_t CachingFileSystem::cache_hits() const { return cache_->hits(); }
+
+int64_t CachingFileSystem::cache_misses() const { return cache_->misses(); }
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::WrapInputFile(
+    std::shared_ptr<io::RandomAccessFile> file, FileInfo info) {
+  // The version of the file, so that the blocks of a modified file are not read
+  std::string version;
+  auto maybe_metadata = file->ReadMetadata();
+  if (maybe_metadata.ok() && *maybe_metadata != nullptr &&
+      (*maybe_metadata)->Contains("ETag")) {
+    ARROW_ASSIGN_OR_RAISE(auto etag, (*maybe_metadata)->Get("ETag"));
+    version = "etag " + etag;
+  } else {
+    if (info.mtime() == kNoTime) {
+      ARROW_ASSIGN_OR_RAISE(info, base_fs_->GetFileInfo(info.path()));
+    }
+    if (info.mtime() != kNoTime) {
+      version = "mtime " + ToChars(info.mtime().time_since_epoch().count());
+    }
+  }
+  if (version.empty()) {
+    return file;
+  }
+  ARROW_ASSIGN_OR_RAISE(int64_t size, file->GetSize());
+  std::string key = base_fs_->type_name() + "\n" + info.path() + "\n" + version +
+                    " size " + ToChars(size);
+  return std::make_shared<CachedInputFile>(std::move(file), cache_, std::move(key), size,
+                                           options_.block_size);
+}
+
+Result<FileInfo> CachingFileSystem::GetFileInfo(const std::string& path) {
+  return base_fs_->GetFileInfo(path);
+}
+
+Result<FileInfoVector> CachingFileSystem::GetFileInfo(const FileSelector& selector) {
+  return base_fs_->GetFileInfo(selector);
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  return base_fs_->DeleteDir(path);
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path,
+                                            bool missing_dir_ok) {
+  return base_fs_->DeleteDirContents(path, missing_dir_ok);
+}
+
+Status CachingFileSystem::DeleteRootDirContents() {
+  return base_fs_->DeleteRootDirContents();
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  return base_fs_->DeleteFile(path);
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  return base_fs_->Move(src, dest);
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const std::string& path) {
+  return OpenInputFile(path);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto file, base_fs_->OpenInputFile(path));
+  return WrapInputFile(std::move(file), FileInfo(path));
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  ARROW_ASSIGN_OR_RAISE(auto file, base_fs_->OpenInputFile(info));
+  return WrapInputFile(std::move(file), info);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenOutputStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  return base_fs_->OpenOutputStream(path, metadata);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenAppendStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  return base_fs_->OpenAppendStream(path, metadata);
+}
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+
+namespace arrow {
+namespace fs {
+
+namespace internal {
+class BlockCache;
+}  // namespace internal
+
+/// Options for the CachingFileSystem implementation.
+struct ARROW_EXPORT CachingFileSystemOptions {
+  /// \brief The local directory holding the cached blocks
+  ///
+  /// It is created if needed.  Several processes may use the same directory, and
+  /// then read the blocks cached by each other.
+  std::string cache_dir;
+
+  /// The size of the blocks in which files are cached.
+  int64_t block_size = 4 * 1024 * 1024;
+
+  /// The size of the cache above which the least recently used blocks are evicted.
+  int64_t max_size = int64_t{10} * 1024 * 1024 * 1024;
+
+  bool Equals(const CachingFileSystemOptions& other) const;
+};
+
+/// \brief A FileSystem implementation caching the files of another on local disk
+///
+/// Input files are read in blocks of `block_size` bytes which are stored in the
+/// cache directory, typically on a local SSD, so that reading them again doesn't
+/// reach the base filesystem.  The blocks of a file are identified by its path and
+/// its version: the ETag of its metadata if it has one, as objects of cloud stores
+/// do, else its modification time and size.  Files of unknown version are not cached.
+///
+/// Other operations are forwarded to the base filesystem.  Modified files get a new
+/// version, so their stale blocks are never read and are eventually evicted.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  ~CachingFileSystem() override;
+
+  /// \brief Create a CachingFileSystem caching the files of `base_fs`
+  static Result<std::shared_ptr<CachingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, CachingFileSystemOptions options);
+
+  std::string type_name() const override { return "caching"; }
+  bool Equals(const FileSystem& other) const override;
+  Result<std::string> PathFromUri(const std::string& uri_string) const override;
+
+  const std::shared_ptr<FileSystem>& base_fs() const { return base_fs_; }
+  const CachingFileSystemOptions& options() const { return options_; }
+
+  /// The number of blocks read from the cache
+  int64_t cache_hits() const;
+  /// The number of blocks read from the base filesystem
+  int64_t cache_misses() const;
+
+  /// \cond FALSE
+  using FileSystem::CreateDir;
+  using FileSystem::DeleteDirContents;
+  using FileSystem::GetFileInfo;
+  using FileSystem::OpenAppendStream;
+  using FileSystem::OpenOutputStream;
+  /// \endcond
+
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<FileInfoVector> GetFileInfo(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path, bool missing_dir_ok) override;
+  Status DeleteRootDirContents() override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override;
+
+ protected:
+  CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                    CachingFileSystemOptions options,
+                    std::shared_ptr<internal::BlockCache> cache);
+
+  // Wrap a file of the base filesystem so that it reads through the cache
+  Result<std::shared_ptr<io::RandomAccessFile>> WrapInputFile(
+      std::shared_ptr<io::RandomAccessFile> file, FileInfo info);
+
+  std::shared_ptr<FileSystem> base_fs_;
+  CachingFileSystemOptions options_;
+  std::shared_ptr<internal::BlockCache> cache_;
+};
+
+}  // namespace fs
+}  // namespace arrow
@@ -188,6 +188,48 @@ Status FileSystem::DeleteFiles(const std::vector<std::string>& paths) {
   return st;
 }
 
+Future<> FileSystem::CreateDirAsync(const std::string& path, bool recursive) {
+  return FileSystemDefer(this, default_async_is_sync_,
+                         [path, recursive](std::shared_ptr<FileSystem> self) {
+                           return self->CreateDir(path, recursive);
+                         });
+}
+
+Future<> FileSystem::CreateDirAsync(const std::string& path) {
+  return CreateDirAsync(path, true);
+}
+
+Future<> FileSystem::DeleteDirAsync(const std::string& path) {
+  return FileSystemDefer(
+      this, default_async_is_sync_,
+      [path](std::shared_ptr<FileSystem> self) { return self->DeleteDir(path); });
+}
+
+Future<> FileSystem::DeleteFileAsync(const std::string& path) {
+  return FileSystemDefer(
+      this, default_async_is_sync_,
+      [path](std::shared_ptr<FileSystem> self) { return self->DeleteFile(path); });
+}
+
+Future<> FileSystem::DeleteFilesAsync(const std::vector<std::string>& paths) {
+  return FileSystemDefer(
+      this, default_async_is_sync_,
+      [paths](std::shared_ptr<FileSystem> self) { return self->DeleteFiles(paths); });
+}
+
+Future<> FileSystem::MoveAsync(const std::string& src, const std::string& dest) {
+  return FileSystemDefer(
+      this, default_async_is_sync_,
+      [src, dest](std::shared_ptr<FileSystem> self) { return self->Move(src, dest); });
+}
+
+Future<> FileSystem::CopyFileAsync(const std::string& src, const std::string& dest) {
+  return FileSystemDefer(this, default_async_is_sync_,
+                         [src, dest](std::shared_ptr<FileSystem> self) {
+                           return self->CopyFile(src, dest);
+                         });
+}
+
 namespace {
 
 Status ValidateInputFileInfo(const FileInfo& info) {
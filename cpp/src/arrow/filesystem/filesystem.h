@@ -239,9 +239,20 @@ class ARROW_EXPORT FileSystem
   virtual Status CreateDir(const std::string& path, bool recursive) = 0;
   Status CreateDir(const std::string& path) { return CreateDir(path, true); }
 
+  /// Async version of CreateDir.
+  virtual Future<> CreateDirAsync(const std::string& path, bool recursive);
+
+  /// Async version of CreateDir.
+  ///
+  /// This overload creates parent directories as needed.
+  Future<> CreateDirAsync(const std::string& path);
+
   /// Delete a directory and its contents, recursively.
   virtual Status DeleteDir(const std::string& path) = 0;
 
+  /// Async version of DeleteDir.
+  virtual Future<> DeleteDirAsync(const std::string& path);
+
   /// Delete a directory's contents, recursively.
   ///
   /// Like DeleteDir, but doesn't delete the directory itself.
@@ -273,6 +284,13 @@ class ARROW_EXPORT FileSystem
   /// The default implementation issues individual delete operations in sequence.
   virtual Status DeleteFiles(const std::vector<std::string>& paths);
 
+  /// Async version of DeleteFile.
+  virtual Future<> DeleteFileAsync(const std::string& path);
+  /// Async version of DeleteFiles.
+  ///
+  /// The default implementation runs DeleteFiles on the IO executor.
+  virtual Future<> DeleteFilesAsync(const std::vector<std::string>& paths);
+
   /// Move / rename a file or directory.
   ///
   /// If the destination exists:
@@ -281,12 +299,18 @@ class ARROW_EXPORT FileSystem
   /// - otherwise, behavior is unspecified (implementation-dependent).
   virtual Status Move(const std::string& src, const std::string& dest) = 0;
 
+  /// Async version of Move.
+  virtual Future<> MoveAsync(const std::string& src, const std::string& dest);
+
   /// Copy a file.
   ///
   /// If the destination exists and is a directory, an error is returned.
   /// Otherwise, it is replaced.
   virtual Status CopyFile(const std::string& src, const std::string& dest) = 0;
 
+  /// Async version of CopyFile.
+  virtual Future<> CopyFileAsync(const std::string& src, const std::string& dest);
+
   /// Open an input stream for sequential reading.
   virtual Result<std::shared_ptr<io::InputStream>> OpenInputStream(
       const std::string& path) = 0;
@@ -23,13 +23,17 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "arrow/filesystem/cachingfs.h"
 #include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/localfs.h"
 #include "arrow/filesystem/mockfs.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
 #include "arrow/filesystem/util_internal.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
 
 namespace arrow {
@@ -513,6 +517,25 @@ TEST_F(TestMockFS, DeleteFile) {
   CheckFiles({});
 }
 
+TEST_F(TestMockFS, AsyncOperations) {
+  ASSERT_FINISHES_OK(fs_->CreateDirAsync("AB/CD"));
+  ASSERT_FINISHES_AND_RAISES(IOError,
+                             fs_->CreateDirAsync("EF/GH", /*recursive=*/false));
+  CreateFile("AB/cd", "data");
+  ASSERT_FINISHES_OK(fs_->CopyFileAsync("AB/cd", "AB/ef"));
+  ASSERT_FINISHES_OK(fs_->MoveAsync("AB/ef", "AB/CD/gh"));
+  CheckDirs({{"AB", time_}, {"AB/CD", time_}});
+  CheckFiles({{"AB/CD/gh", time_, "data"}, {"AB/cd", time_, "data"}});
+
+  ASSERT_FINISHES_OK(fs_->DeleteFileAsync("AB/CD/gh"));
+  ASSERT_FINISHES_AND_RAISES(IOError, fs_->DeleteFileAsync("AB/CD/gh"));
+  CreateFile("AB/ij", "data");
+  ASSERT_FINISHES_OK(fs_->DeleteFilesAsync({"AB/cd", "AB/ij"}));
+  CheckFiles({});
+  ASSERT_FINISHES_OK(fs_->DeleteDirAsync("AB"));
+  CheckDirs({});
+}
+
 TEST_F(TestMockFS, GetFileInfo) {
   ASSERT_OK(fs_->CreateDir("AB/CD"));
   CreateFile("AB/CD/ef", "some data");
@@ -927,6 +950,122 @@ TEST_F(TestSubTreeFileSystem, GetFileInfoSelector) {
 ////////////////////////////////////////////////////////////////////////////
 // Generic SlowFileSystem tests
 
+////////////////////////////////////////////////////////////////////////////
+// CachingFileSystem tests
+
+class TestCachingFileSystem : public TestMockFS {
+ public:
+  void SetUp() override {
+    TestMockFS::SetUp();
+    ASSERT_OK_AND_ASSIGN(temp_dir_,
+                         arrow::internal::TemporaryDir::Make("caching-fs-test-"));
+    options_.cache_dir = std::string(RemoveTrailingSlash(temp_dir_->path().ToString()));
+    options_.block_size = 10;
+    ::arrow::fs::CreateFile(fs_.get(), "AB/file", std::string(kData));
+  }
+
+  std::shared_ptr<CachingFileSystem> MakeCachingFileSystem() {
+    EXPECT_OK_AND_ASSIGN(auto caching_fs, CachingFileSystem::Make(fs_, options_));
+    return caching_fs;
+  }
+
+  int64_t CacheSize() {
+    LocalFileSystem local_fs;
+    FileSelector selector;
+    selector.base_dir = options_.cache_dir;
+    selector.recursive = true;
+    EXPECT_OK_AND_ASSIGN(auto infos, local_fs.GetFileInfo(selector));
+    int64_t size = 0;
+    for (const auto& info : infos) {
+      if (info.IsFile()) {
+        size += info.size();
+      }
+    }
+    return size;
+  }
+
+ protected:
+  static constexpr std::string_view kData = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+  std::unique_ptr<arrow::internal::TemporaryDir> temp_dir_;
+  CachingFileSystemOptions options_;
+};
+
+TEST_F(TestCachingFileSystem, ReadThroughCache) {
+  auto caching_fs = MakeCachingFileSystem();
+  ASSERT_OK_AND_ASSIGN(auto file, caching_fs->OpenInputFile("AB/file"));
+  ASSERT_OK_AND_EQ(36, file->GetSize());
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(5, 20));
+  AssertBufferEqual(*buf, "56789abcdefghijklmno");
+  ASSERT_EQ(0, caching_fs->cache_hits());
+  ASSERT_EQ(3, caching_fs->cache_misses());
+
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 100));
+  AssertBufferEqual(*buf, kData);
+  ASSERT_EQ(3, caching_fs->cache_hits());
+  ASSERT_EQ(4, caching_fs->cache_misses());
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(36, 10));
+  AssertBufferEqual(*buf, "");
+  ASSERT_RAISES(IOError, file->ReadAt(37, 10));
+
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(12));
+  AssertBufferEqual(*buf, "0123456789ab");
+  ASSERT_OK(file->Seek(30));
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(12));
+  AssertBufferEqual(*buf, "uvwxyz");
+  ASSERT_OK_AND_EQ(36, file->Tell());
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(Invalid, file->ReadAt(0, 1));
+
+  // The cache is shared with other instances, for example in other processes
+  auto other_caching_fs = MakeCachingFileSystem();
+  ASSERT_OK_AND_ASSIGN(auto stream, other_caching_fs->OpenInputStream("AB/file"));
+  ASSERT_OK_AND_ASSIGN(buf, stream->Read(100));
+  AssertBufferEqual(*buf, kData);
+  ASSERT_EQ(4, other_caching_fs->cache_hits());
+  ASSERT_EQ(0, other_caching_fs->cache_misses());
+}
+
+TEST_F(TestCachingFileSystem, ModifiedFile) {
+  auto caching_fs = MakeCachingFileSystem();
+  ASSERT_OK_AND_ASSIGN(auto file, caching_fs->OpenInputFile("AB/file"));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 100));
+  AssertBufferEqual(*buf, kData);
+
+  // The blocks of the previous version of the file are not read
+  ::arrow::fs::CreateFile(caching_fs.get(), "AB/file", "some other data");
+  ASSERT_OK_AND_ASSIGN(auto info, caching_fs->GetFileInfo("AB/file"));
+  ASSERT_OK_AND_ASSIGN(file, caching_fs->OpenInputFile(info));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 100));
+  AssertBufferEqual(*buf, "some other data");
+  ASSERT_EQ(0, caching_fs->cache_hits());
+  ASSERT_EQ(6, caching_fs->cache_misses());
+}
+
+TEST_F(TestCachingFileSystem, Eviction) {
+  options_.max_size = 150;
+  auto caching_fs = MakeCachingFileSystem();
+  ASSERT_OK_AND_ASSIGN(auto file, caching_fs->OpenInputFile("AB/file"));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 100));
+  AssertBufferEqual(*buf, kData);
+  ASSERT_GT(CacheSize(), 0);
+  ASSERT_LE(CacheSize(), options_.max_size);
+
+  // Evicted blocks are read again from the base filesystem
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 100));
+  AssertBufferEqual(*buf, kData);
+  ASSERT_EQ(8, caching_fs->cache_hits() + caching_fs->cache_misses());
+  ASSERT_GT(caching_fs->cache_misses(), 4);
+}
+
+TEST_F(TestCachingFileSystem, InvalidOptions) {
+  options_.block_size = 0;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(fs_, options_));
+  options_.block_size = 10;
+  options_.cache_dir = "";
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(fs_, options_));
+}
+
 class TestSlowFSGeneric : public ::testing::Test, public GenericFileSystemTest {
  public:
   void SetUp() override {
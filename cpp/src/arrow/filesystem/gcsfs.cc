@@ -20,14 +20,22 @@
 #include <google/cloud/storage/client.h>
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/filesystem/gcsfs_internal.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/util_internal.h"
+#include "arrow/io/memory.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/string.h"
 #include "arrow/util/thread_pool.h"
 
 #define ARROW_GCS_RETURN_NOT_OK(expr) \
@@ -237,6 +245,230 @@ class GcsOutputStream : public arrow::io::OutputStream {
   bool closed_ = false;
 };
 
+// The maximum number of source objects of a compose request
+constexpr size_t kMaxComposeSources = 32;
+
+// An output stream uploading parts of the data concurrently in the background, as
+// temporary objects which are composed into the destination object on Close().
+class GcsBackgroundOutputStream : public arrow::io::OutputStream {
+ public:
+  struct WriteOptions {
+    gcs::EncryptionKey encryption_key;
+    gcs::PredefinedAcl predefined_acl;
+    gcs::KmsKeyName kms_key_name;
+    gcs::WithObjectMetadata with_object_metadata;
+  };
+
+  GcsBackgroundOutputStream(gcs::Client client, GcsPath path,
+                            WriteOptions write_options, const GcsOptions& options,
+                            const io::IOContext& io_context)
+      : client_(std::move(client)),
+        path_(std::move(path)),
+        write_options_(std::move(write_options)),
+        part_size_(options.background_write_part_size),
+        max_bytes_in_progress_(options.max_background_write_bytes),
+        io_context_(io_context),
+        part_prefix_(path_.object + ".arrow-part-" +
+                     std::to_string(::arrow::internal::GetRandomSeed()) + "-"),
+        state_(std::make_shared<UploadState>()) {}
+
+  ~GcsBackgroundOutputStream() override {
+    if (!closed_) {
+      io::internal::CloseFromDestructor(this);
+    }
+  }
+
+  Status Close() override {
+    if (closed_) {
+      return Status::OK();
+    }
+    closed_ = true;
+    if (part_names_.empty()) {
+      // Small object: upload it directly
+      std::shared_ptr<Buffer> data = std::make_shared<Buffer>("");
+      if (current_part_) {
+        ARROW_ASSIGN_OR_RAISE(data, current_part_->Finish());
+      }
+      auto stream = client_.WriteObject(
+          path_.bucket, path_.object, write_options_.encryption_key,
+          write_options_.predefined_acl, write_options_.kms_key_name,
+          write_options_.with_object_metadata);
+      return WriteData(std::move(stream), *data);
+    }
+    Status st = UploadCurrentPart();
+    {
+      std::unique_lock<std::mutex> lock(state_->mutex);
+      state_->part_uploaded.wait(lock, [&] { return state_->parts_in_progress == 0; });
+      st &= state_->status;
+    }
+    if (st.ok()) {
+      st &= ComposeParts();
+    }
+    return st & DeleteParts();
+  }
+
+  Result<int64_t> Tell() const override {
+    if (closed_) return Status::Invalid("Cannot use Tell() on a closed stream");
+    return tell_;
+  }
+
+  bool closed() const override { return closed_; }
+
+  Status Write(const void* data, int64_t nbytes) override {
+    if (closed_) return Status::Invalid("Cannot write to a closed stream");
+    {
+      std::unique_lock<std::mutex> lock(state_->mutex);
+      RETURN_NOT_OK(state_->status);
+    }
+    const auto* data_ptr = reinterpret_cast<const uint8_t*>(data);
+    while (nbytes > 0) {
+      if (current_part_ == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(current_part_, io::BufferOutputStream::Create(
+                                                 part_size_, io_context_.pool()));
+        current_part_size_ = 0;
+      }
+      const int64_t to_copy = std::min(nbytes, part_size_ - current_part_size_);
+      RETURN_NOT_OK(current_part_->Write(data_ptr, to_copy));
+      current_part_size_ += to_copy;
+      tell_ += to_copy;
+      data_ptr += to_copy;
+      nbytes -= to_copy;
+      if (current_part_size_ == part_size_) {
+        RETURN_NOT_OK(UploadCurrentPart());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Flush() override {
+    if (closed_) return Status::Invalid("Cannot flush a closed stream");
+    // Parts are uploaded as soon as they are full
+    return Status::OK();
+  }
+
+ private:
+  // This struct is kept alive by the background uploads
+  struct UploadState {
+    std::mutex mutex;
+    std::condition_variable part_uploaded;
+    int64_t parts_in_progress = 0;
+    int64_t bytes_in_progress = 0;
+    Status status;
+  };
+
+  static Status WriteData(gcs::ObjectWriteStream stream, const Buffer& data) {
+    stream.write(reinterpret_cast<const char*>(data.data()), data.size());
+    stream.Close();
+    return internal::ToArrowStatus(stream.last_status());
+  }
+
+  Status UploadCurrentPart() {
+    if (current_part_ == nullptr || current_part_size_ == 0) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> data, current_part_->Finish());
+    current_part_.reset();
+    current_part_size_ = 0;
+
+    const int64_t nbytes = data->size();
+    {
+      // Wait for enough parts to be uploaded, unless none is
+      std::unique_lock<std::mutex> lock(state_->mutex);
+      state_->part_uploaded.wait(lock, [&] {
+        return state_->bytes_in_progress == 0 ||
+               state_->bytes_in_progress + nbytes <= max_bytes_in_progress_;
+      });
+      RETURN_NOT_OK(state_->status);
+      ++state_->parts_in_progress;
+      state_->bytes_in_progress += nbytes;
+    }
+    part_names_.push_back(part_prefix_ + std::to_string(part_names_.size()));
+
+    // The closure keeps the data and the upload state alive
+    auto upload = [client = client_, bucket = path_.bucket, name = part_names_.back(),
+                   write_options = write_options_, data = std::move(data),
+                   state = state_]() mutable {
+      auto stream = client.WriteObject(bucket, name, write_options.encryption_key,
+                                       write_options.kms_key_name);
+      auto st = WriteData(std::move(stream), *data);
+      std::unique_lock<std::mutex> lock(state->mutex);
+      state->status &= st;
+      --state->parts_in_progress;
+      state->bytes_in_progress -= data->size();
+      state->part_uploaded.notify_all();
+    };
+    auto st = io::internal::SubmitIO(io_context_, std::move(upload)).status();
+    if (!st.ok()) {
+      std::unique_lock<std::mutex> lock(state_->mutex);
+      --state_->parts_in_progress;
+      state_->bytes_in_progress -= nbytes;
+    }
+    return st;
+  }
+
+  // Compose the parts into the destination object, at most kMaxComposeSources at a
+  // time: the destination object is the first source of the subsequent requests.
+  Status ComposeParts() {
+    const auto predefined_acl =
+        write_options_.predefined_acl.has_value()
+            ? gcs::DestinationPredefinedAcl(write_options_.predefined_acl.value())
+            : gcs::DestinationPredefinedAcl();
+    auto make_source = [](const std::string& name) {
+      gcs::ComposeSourceObject source;
+      source.object_name = name;
+      return source;
+    };
+    size_t next_part = 0;
+    while (next_part < part_names_.size()) {
+      std::vector<gcs::ComposeSourceObject> sources;
+      if (next_part > 0) {
+        sources.push_back(make_source(path_.object));
+      }
+      while (sources.size() < kMaxComposeSources && next_part < part_names_.size()) {
+        sources.push_back(make_source(part_names_[next_part++]));
+      }
+      auto metadata = client_.ComposeObject(
+          path_.bucket, std::move(sources), path_.object, write_options_.encryption_key,
+          predefined_acl, write_options_.kms_key_name,
+          write_options_.with_object_metadata);
+      ARROW_GCS_RETURN_NOT_OK(metadata.status());
+    }
+    return Status::OK();
+  }
+
+  Status DeleteParts() {
+    std::vector<Future<>> deletes;
+    deletes.reserve(part_names_.size());
+    for (const auto& name : part_names_) {
+      auto delete_part = [client = client_, bucket = path_.bucket,
+                          name]() mutable -> Status {
+        return internal::ToArrowStatus(client.DeleteObject(bucket, name));
+      };
+      ARROW_ASSIGN_OR_RAISE(auto fut,
+                            io::internal::SubmitIO(io_context_, std::move(delete_part)));
+      deletes.push_back(std::move(fut));
+    }
+    part_names_.clear();
+    return AllFinished(deletes).status();
+  }
+
+  gcs::Client client_;
+  const GcsPath path_;
+  const WriteOptions write_options_;
+  const int64_t part_size_;
+  const int64_t max_bytes_in_progress_;
+  const io::IOContext io_context_;
+  const std::string part_prefix_;
+
+  std::shared_ptr<io::BufferOutputStream> current_part_;
+  int64_t current_part_size_ = 0;
+  std::vector<std::string> part_names_;
+  int64_t tell_ = 0;
+  bool closed_ = false;
+
+  std::shared_ptr<UploadState> state_;
+};
+
 using InputStreamFactory = std::function<Result<std::shared_ptr<GcsInputStream>>(
     gcs::Generation, gcs::ReadRange, gcs::ReadFromOffset)>;
 
@@ -609,8 +841,9 @@ class GcsFileSystem::Impl {
     return std::make_shared<GcsInputStream>(std::move(stream), path, generation, client_);
   }
 
-  Result<std::shared_ptr<GcsOutputStream>> OpenOutputStream(
-      const GcsPath& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const GcsPath& path, const std::shared_ptr<const KeyValueMetadata>& metadata,
+      const io::IOContext& io_context) {
     std::shared_ptr<const KeyValueMetadata> resolved_metadata = metadata;
     if (resolved_metadata == nullptr && options_.default_metadata != nullptr) {
       resolved_metadata = options_.default_metadata;
@@ -625,6 +858,13 @@ class GcsFileSystem::Impl {
     ARROW_ASSIGN_OR_RAISE(with_object_metadata,
                           internal::ToObjectMetadata(resolved_metadata));
 
+    if (options_.background_writes) {
+      return std::make_shared<GcsBackgroundOutputStream>(
+          client_, path,
+          GcsBackgroundOutputStream::WriteOptions{encryption_key, predefined_acl,
+                                                  kms_key_name, with_object_metadata},
+          options_, io_context);
+    }
     auto stream = client_.WriteObject(path.bucket, path.object, encryption_key,
                                       predefined_acl, kms_key_name, with_object_metadata);
     ARROW_GCS_RETURN_NOT_OK(stream.last_status());
@@ -708,7 +948,10 @@ bool GcsOptions::Equals(const GcsOptions& other) const {
          endpoint_override == other.endpoint_override && scheme == other.scheme &&
          default_bucket_location == other.default_bucket_location &&
          retry_limit_seconds == other.retry_limit_seconds &&
-         project_id == other.project_id;
+         project_id == other.project_id &&
+         background_writes == other.background_writes &&
+         background_write_part_size == other.background_write_part_size &&
+         max_background_write_bytes == other.max_background_write_bytes;
 }
 
 GcsOptions GcsOptions::Defaults() {
@@ -814,6 +1057,9 @@ Result<GcsOptions> GcsOptions::FromUri(const arrow::util::Uri& uri,
       options.retry_limit_seconds = parsed_seconds;
     } else if (kv.first == "project_id") {
       options.project_id = kv.second;
+    } else if (kv.first == "background_writes") {
+      ARROW_ASSIGN_OR_RAISE(options.background_writes,
+                            ::arrow::internal::ParseBoolean(kv.second));
     } else {
       return Status::Invalid("Unexpected query parameter in GCS URI: '", kv.first, "'");
     }
@@ -954,7 +1200,7 @@ Result<std::shared_ptr<io::OutputStream>> GcsFileSystem::OpenOutputStream(
     const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
   ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(path));
   ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
-  return impl_->OpenOutputStream(p, metadata);
+  return impl_->OpenOutputStream(p, metadata, io_context());
 }
 
 Result<std::shared_ptr<io::OutputStream>> GcsFileSystem::OpenAppendStream(
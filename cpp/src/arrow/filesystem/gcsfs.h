@@ -90,6 +90,24 @@ struct ARROW_EXPORT GcsOptions {
   /// that create new buckets need a project id.
   std::optional<std::string> project_id;
 
+  /// \brief Whether OutputStream writes will be uploaded in the background, in parts
+  /// written concurrently.
+  ///
+  /// The parts are written as temporary objects next to the destination object, then
+  /// composed into it and deleted when the stream is closed.  Objects smaller than
+  /// `background_write_part_size` are uploaded directly.  Composite objects don't
+  /// have an MD5 hash, which is why this is disabled by default.
+  bool background_writes = false;
+
+  /// \brief The size of the parts uploaded with background writes.
+  int64_t background_write_part_size = 16 * 1024 * 1024;
+
+  /// \brief The maximum number of bytes of parts being uploaded in the background
+  /// by each OutputStream.
+  ///
+  /// Writes block when this limit is reached, until enough parts are uploaded.
+  int64_t max_background_write_bytes = 256 * 1024 * 1024;
+
   bool Equals(const GcsOptions& other) const;
 
   /// \brief Initialize with Google Default Credentials
@@ -345,7 +345,7 @@ TEST(GcsFileSystem, OptionsFromUri) {
       GcsOptions::FromUri("gs://mybucket/foo/bar/"
                           "?endpoint_override=localhost&scheme=http&location=us-west2"
                           "&retry_limit_seconds=40.5"
-                          "&project_id=test-project-id",
+                          "&project_id=test-project-id&background_writes=true",
                           &path));
   EXPECT_EQ(options.default_bucket_location, "us-west2");
   EXPECT_EQ(options.scheme, "http");
@@ -355,6 +355,7 @@ TEST(GcsFileSystem, OptionsFromUri) {
   EXPECT_EQ(*options.retry_limit_seconds, 40.5);
   ASSERT_TRUE(options.project_id.has_value());
   EXPECT_EQ(*options.project_id, "test-project-id");
+  EXPECT_TRUE(options.background_writes);
 
   // Missing bucket name
   ASSERT_RAISES(Invalid, GcsOptions::FromUri("gs:///foo/bar/", &path));
@@ -1228,6 +1229,43 @@ TEST_F(GcsIntegrationTest, OpenOutputStreamLarge) {
   EXPECT_EQ(contents, buffers[0] + buffers[1] + buffers[2]);
 }
 
+TEST_F(GcsIntegrationTest, OpenOutputStreamBackgroundWrites) {
+  auto options = TestGcsOptions();
+  options.background_writes = true;
+  options.background_write_part_size = 256 * 1024;
+  options.max_background_write_bytes = 1024 * 1024;
+  ASSERT_OK_AND_ASSIGN(auto fs, GcsFileSystem::Make(options));
+
+  // More parts than a single compose request accepts
+  std::string expected;
+  for (char c = 'A'; c < 'A' + 40; ++c) {
+    expected += std::string(200 * 1024, c);
+  }
+  for (const int64_t size : {int64_t{1000}, static_cast<int64_t>(expected.size())}) {
+    ARROW_SCOPED_TRACE("size = ", size);
+    const auto path = PreexistingBucketPath() + "test-write-object-background";
+    ASSERT_OK_AND_ASSIGN(auto output, fs->OpenOutputStream(path, {}));
+    for (int64_t pos = 0; pos < size; pos += 100 * 1000) {
+      const auto nbytes = std::min<int64_t>(100 * 1000, size - pos);
+      ASSERT_OK(output->Write(expected.data() + pos, nbytes));
+    }
+    ASSERT_OK_AND_EQ(size, output->Tell());
+    ASSERT_OK(output->Close());
+
+    ASSERT_OK_AND_ASSIGN(auto input, fs->OpenInputFile(path));
+    ASSERT_OK_AND_ASSIGN(auto buffer, input->ReadAt(0, size + 1));
+    EXPECT_EQ(buffer->ToString(), expected.substr(0, size));
+
+    // The temporary parts were deleted
+    FileSelector select;
+    select.base_dir = PreexistingBucketName();
+    ASSERT_OK_AND_ASSIGN(auto infos, fs->GetFileInfo(select));
+    for (const auto& info : infos) {
+      EXPECT_EQ(info.path().find(".arrow-part-"), std::string::npos) << info.path();
+    }
+  }
+}
+
 TEST_F(GcsIntegrationTest, OpenOutputStreamClosed) {
   ASSERT_OK_AND_ASSIGN(auto fs, GcsFileSystem::Make(TestGcsOptions()));
 
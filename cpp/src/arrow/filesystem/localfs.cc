@@ -15,11 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <memory>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #ifdef _WIN32
 #  include "arrow/util/windows_compatibility.h"
@@ -35,9 +37,12 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/type_fwd.h"
 #include "arrow/filesystem/util_internal.h"
+#include "arrow/buffer.h"
 #include "arrow/io/file.h"
 #include "arrow/io/type_fwd.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/string.h"
 #include "arrow/util/uri.h"
@@ -221,7 +226,11 @@ LocalFileSystemOptions LocalFileSystemOptions::Defaults() { return {}; }
 
 bool LocalFileSystemOptions::Equals(const LocalFileSystemOptions& other) const {
   return use_mmap == other.use_mmap && directory_readahead == other.directory_readahead &&
-         file_info_batch_size == other.file_info_batch_size;
+         file_info_batch_size == other.file_info_batch_size &&
+         readahead_bytes == other.readahead_bytes &&
+         parallel_read_chunk_size == other.parallel_read_chunk_size &&
+         advise_access_pattern == other.advise_access_pattern &&
+         drop_page_cache == other.drop_page_cache;
 }
 
 Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
@@ -646,28 +655,304 @@ Status LocalFileSystem::CopyFile(const std::string& src, const std::string& dest
 
 namespace {
 
-template <typename InputStreamType>
-Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
+enum class AccessPattern { kSequential, kRandom, kDontNeed };
+
+// Advise the kernel about how a file range will be accessed.  This is only a hint,
+// so failures are ignored.  A zero length extends to the end of the file.
+void AdviseAccess(int fd, AccessPattern pattern, int64_t offset = 0,
+                  int64_t length = 0) {
+#if defined(POSIX_FADV_SEQUENTIAL)
+  int advice = POSIX_FADV_NORMAL;
+  switch (pattern) {
+    case AccessPattern::kSequential:
+      advice = POSIX_FADV_SEQUENTIAL;
+      break;
+    case AccessPattern::kRandom:
+      advice = POSIX_FADV_RANDOM;
+      break;
+    case AccessPattern::kDontNeed:
+      advice = POSIX_FADV_DONTNEED;
+      break;
+  }
+  ARROW_UNUSED(posix_fadvise(fd, offset, length, advice));
+#else
+  ARROW_UNUSED(fd);
+  ARROW_UNUSED(pattern);
+  ARROW_UNUSED(offset);
+  ARROW_UNUSED(length);
+#endif
+}
+
+// An input stream keeping the next chunk of a file being read on the IO thread
+// pool while the current one is consumed.
+class ReadaheadInputStream : public io::InputStream {
+ public:
+  ReadaheadInputStream(std::shared_ptr<io::ReadableFile> file, int64_t size,
+                       int64_t chunk_size, bool drop_page_cache,
+                       const io::IOContext& io_context)
+      : file_(std::move(file)),
+        size_(size),
+        chunk_size_(chunk_size),
+        drop_page_cache_(drop_page_cache),
+        io_context_(io_context) {}
+
+  ~ReadaheadInputStream() override { io::internal::CloseFromDestructor(this); }
+
+  Status Close() override {
+    if (file_->closed()) {
+      return Status::OK();
+    }
+    // Don't close the file under a pending read
+    WaitForNext();
+    DropCurrentChunk();
+    return file_->Close();
+  }
+
+  bool closed() const override { return file_->closed(); }
+
+  Result<int64_t> Tell() const override {
+    RETURN_NOT_OK(CheckClosed());
+    return position_;
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, Read(nbytes));
+    if (buffer->size() > 0) {
+      std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    }
+    return buffer->size();
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed());
+    if (nbytes < 0) {
+      return Status::Invalid("Cannot read a negative number of bytes");
+    }
+    BufferVector pieces;
+    while (nbytes > 0 && position_ < size_) {
+      if (current_ == nullptr || current_offset_ == current_->size()) {
+        RETURN_NOT_OK(NextChunk());
+        if (current_->size() == 0) {
+          // The file was truncated after being opened
+          break;
+        }
+      }
+      const int64_t piece_size = std::min(nbytes, current_->size() - current_offset_);
+      pieces.push_back(SliceBuffer(current_, current_offset_, piece_size));
+      current_offset_ += piece_size;
+      position_ += piece_size;
+      nbytes -= piece_size;
+    }
+    if (pieces.size() == 1) {
+      return std::move(pieces[0]);
+    }
+    return ConcatenateBuffers(pieces, io_context_.pool());
+  }
+
+  const io::IOContext& io_context() const override { return io_context_; }
+
+ private:
+  Status CheckClosed() const {
+    if (file_->closed()) {
+      return Status::Invalid("Operation on closed stream");
+    }
+    return Status::OK();
+  }
+
+  Future<std::shared_ptr<Buffer>> ReadChunkAsync() {
+    const int64_t offset = issued_end_;
+    const int64_t length = std::min(chunk_size_, size_ - offset);
+    issued_end_ += length;
+    return file_->ReadAsync(io_context_, offset, length);
+  }
+
+  void DropCurrentChunk() {
+    if (drop_page_cache_ && current_ != nullptr && current_->size() > 0) {
+      AdviseAccess(file_->file_descriptor(), AccessPattern::kDontNeed, current_start_,
+                   current_->size());
+    }
+    current_.reset();
+  }
+
+  // Make the next chunk current, and start reading the one after it
+  Status NextChunk() {
+    DropCurrentChunk();
+    current_start_ = position_;
+    current_offset_ = 0;
+    if (!next_.is_valid()) {
+      if (issued_end_ >= size_) {
+        // The file was truncated while being read
+        ARROW_ASSIGN_OR_RAISE(current_, AllocateBuffer(0, io_context_.pool()));
+        return Status::OK();
+      }
+      next_ = ReadChunkAsync();
+    }
+    auto current = std::move(next_);
+    next_ = Future<std::shared_ptr<Buffer>>();
+    if (issued_end_ < size_) {
+      next_ = ReadChunkAsync();
+    }
+    ARROW_ASSIGN_OR_RAISE(current_, current.result());
+    return Status::OK();
+  }
+
+  void WaitForNext() {
+    if (next_.is_valid()) {
+      next_.Wait();
+      next_ = Future<std::shared_ptr<Buffer>>();
+    }
+  }
+
+  const std::shared_ptr<io::ReadableFile> file_;
+  const int64_t size_;
+  const int64_t chunk_size_;
+  const bool drop_page_cache_;
+  const io::IOContext io_context_;
+
+  int64_t position_ = 0;
+  // End of the chunks whose reads have been issued
+  int64_t issued_end_ = 0;
+  // The chunk being consumed, and the position of its first byte in the file
+  std::shared_ptr<Buffer> current_;
+  int64_t current_start_ = 0;
+  int64_t current_offset_ = 0;
+  Future<std::shared_ptr<Buffer>> next_;
+};
+
+// A random access file splitting large asynchronous reads into chunks that are
+// read in parallel on the IO thread pool.
+class ParallelReadFile : public io::RandomAccessFile {
+ public:
+  ParallelReadFile(std::shared_ptr<io::ReadableFile> file, int64_t chunk_size)
+      : file_(std::move(file)), chunk_size_(chunk_size) {}
+
+  Status Close() override { return file_->Close(); }
+  bool closed() const override { return file_->closed(); }
+  Result<int64_t> Tell() const override { return file_->Tell(); }
+  Status Seek(int64_t position) override { return file_->Seek(position); }
+  Result<int64_t> GetSize() override { return file_->GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return file_->Read(nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return file_->Read(nbytes);
+  }
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    return file_->ReadAt(position, nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    return file_->ReadAt(position, nbytes);
+  }
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const io::IOContext& ctx, int64_t position,
+                                            int64_t nbytes) override {
+    if (nbytes < 2 * chunk_size_) {
+      return file_->ReadAsync(ctx, position, nbytes);
+    }
+    ARROW_ASSIGN_OR_RAISE(int64_t size, file_->GetSize());
+    RETURN_NOT_OK(io::internal::ValidateRange(position, nbytes));
+    nbytes = std::max<int64_t>(0, std::min(nbytes, size - position));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> buffer,
+                          AllocateResizableBuffer(nbytes, ctx.pool()));
+    const int64_t num_chunks = bit_util::CeilDiv(nbytes, chunk_size_);
+    // Bytes read by each chunk, short only at the end of a truncated file
+    auto bytes_read = std::make_shared<std::vector<int64_t>>(num_chunks);
+    std::vector<Future<>> chunks_read;
+    chunks_read.reserve(num_chunks);
+    for (int64_t i = 0; i < num_chunks; ++i) {
+      const int64_t offset = i * chunk_size_;
+      const int64_t length = std::min(chunk_size_, nbytes - offset);
+      chunks_read.push_back(DeferNotOk(io::internal::SubmitIO(
+          ctx, [file = file_, buffer, bytes_read, i, position, offset,
+                length]() -> Status {
+            ARROW_ASSIGN_OR_RAISE(
+                (*bytes_read)[i],
+                file->ReadAt(position + offset, length, buffer->mutable_data() + offset));
+            return Status::OK();
+          })));
+    }
+    const int64_t chunk_size = chunk_size_;
+    return AllComplete(chunks_read)
+        .Then([buffer, bytes_read, chunk_size]() -> Result<std::shared_ptr<Buffer>> {
+          // Keep the bytes up to the first short chunk
+          int64_t size = 0;
+          for (int64_t chunk_bytes_read : *bytes_read) {
+            size += chunk_bytes_read;
+            if (chunk_bytes_read < chunk_size) break;
+          }
+          if (size < buffer->size()) {
+            RETURN_NOT_OK(buffer->Resize(size));
+            buffer->ZeroPadding();
+          }
+          return buffer;
+        });
+  }
+
+  using RandomAccessFile::ReadAsync;
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const io::IOContext& ctx, const std::vector<io::ReadRange>& ranges) override {
+    return file_->ReadManyAsync(ctx, ranges);
+  }
+  using RandomAccessFile::ReadManyAsync;
+
+  Status WillNeed(const std::vector<io::ReadRange>& ranges) override {
+    return file_->WillNeed(ranges);
+  }
+
+  const io::IOContext& io_context() const override { return file_->io_context(); }
+
+ private:
+  const std::shared_ptr<io::ReadableFile> file_;
+  const int64_t chunk_size_;
+};
+
+Result<std::shared_ptr<io::ReadableFile>> OpenReadableFile(
     const std::string& path, const LocalFileSystemOptions& options,
-    const io::IOContext& io_context) {
-  RETURN_NOT_OK(ValidatePath(path));
-  if (options.use_mmap) {
-    return io::MemoryMappedFile::Open(path, io::FileMode::READ);
-  } else {
-    return io::ReadableFile::Open(path, io_context.pool());
+    const io::IOContext& io_context, AccessPattern pattern) {
+  ARROW_ASSIGN_OR_RAISE(auto file, io::ReadableFile::Open(path, io_context.pool()));
+  if (options.advise_access_pattern) {
+    AdviseAccess(file->file_descriptor(), pattern);
   }
+  return file;
 }
 
 }  // namespace
 
 Result<std::shared_ptr<io::InputStream>> LocalFileSystem::OpenInputStream(
     const std::string& path) {
-  return OpenInputStreamGeneric<io::InputStream>(path, options_, io_context());
+  RETURN_NOT_OK(ValidatePath(path));
+  if (options_.use_mmap) {
+    return io::MemoryMappedFile::Open(path, io::FileMode::READ);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto file, OpenReadableFile(path, options_, io_context(),
+                                                    AccessPattern::kSequential));
+  if (options_.readahead_bytes <= 0 && !options_.drop_page_cache) {
+    return file;
+  }
+  ARROW_ASSIGN_OR_RAISE(int64_t size, file->GetSize());
+  // Without readahead, evict data by chunks of a reasonable size
+  static constexpr int64_t kDefaultChunkSize = 1 << 20;
+  const int64_t chunk_size =
+      options_.readahead_bytes > 0 ? options_.readahead_bytes : kDefaultChunkSize;
+  return std::make_shared<ReadaheadInputStream>(std::move(file), size, chunk_size,
+                                                options_.drop_page_cache, io_context());
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> LocalFileSystem::OpenInputFile(
     const std::string& path) {
-  return OpenInputStreamGeneric<io::RandomAccessFile>(path, options_, io_context());
+  RETURN_NOT_OK(ValidatePath(path));
+  if (options_.use_mmap) {
+    return io::MemoryMappedFile::Open(path, io::FileMode::READ);
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      auto file, OpenReadableFile(path, options_, io_context(), AccessPattern::kRandom));
+  if (options_.parallel_read_chunk_size <= 0) {
+    return file;
+  }
+  return std::make_shared<ParallelReadFile>(std::move(file),
+                                            options_.parallel_read_chunk_size);
 }
 
 namespace {
@@ -57,6 +57,29 @@ struct ARROW_EXPORT LocalFileSystemOptions {
   /// from the FileInfoGenerator with less initial latency.
   int32_t file_info_batch_size = kDefaultFileInfoBatchSize;
 
+  /// Options related to reading files, ignored if `use_mmap` is true.
+
+  /// EXPERIMENTAL: The number of bytes that streams returned by `OpenInputStream`
+  /// read ahead of the consumer on the IO thread pool.  0 disables readahead.
+  int64_t readahead_bytes = 0;
+
+  /// EXPERIMENTAL: The size of the chunks that large `ReadAsync` calls on files
+  /// returned by `OpenInputFile` are split into, and read in parallel on the IO
+  /// thread pool.  0 disables splitting.
+  int64_t parallel_read_chunk_size = 0;
+
+  /// EXPERIMENTAL: Whether to tell the kernel how opened files are accessed
+  /// (sequentially for `OpenInputStream`, randomly for `OpenInputFile`) so that
+  /// it can tune its own readahead.  Only supported with posix_fadvise.
+  bool advise_access_pattern = false;
+
+  /// EXPERIMENTAL: Whether streams returned by `OpenInputStream` evict the data
+  /// they have read from the page cache, so that one-shot scans don't evict
+  /// hotter data.  Only supported with posix_fadvise.
+  ///
+  /// This is used instead of O_DIRECT, which requires block-aligned reads.
+  bool drop_page_cache = false;
+
   /// \brief Initialize with defaults
   static LocalFileSystemOptions Defaults();
 
@@ -20,6 +20,8 @@
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/array/array_base.h"
+#include "arrow/buffer.h"
 #include "arrow/filesystem/localfs.h"
 #include "arrow/io/file.h"
 #include "arrow/status.h"
@@ -131,6 +133,77 @@ BENCHMARK_REGISTER_F(LocalFSFixture, AsyncFileDiscovery)
     ->UseRealTime()
     ->Unit(benchmark::kMillisecond);
 
+/// Fixture writing a single large file, to benchmark file reads.
+class LocalFSReadFixture : public benchmark::Fixture {
+ public:
+  static constexpr int64_t kFileSize = 64 << 20;
+
+  void SetUp(const benchmark::State& state) override {
+    ASSERT_OK_AND_ASSIGN(tmp_dir_, TemporaryDir::Make("localfs-read-"));
+    ASSERT_OK_AND_ASSIGN(auto path, tmp_dir_->path().Join("data"));
+    path_ = path.ToString();
+    auto data = random::RandomArrayGenerator(42).Int64(kFileSize / 8, 0, 1000,
+                                                       /*null_probability=*/0);
+    ASSERT_OK_AND_ASSIGN(auto out, io::FileOutputStream::Open(path_));
+    ASSERT_OK(out->Write(data->data()->buffers[1]));
+    ASSERT_OK(out->Close());
+  }
+
+  void TearDown(const benchmark::State& state) override { tmp_dir_.reset(); }
+
+ protected:
+  std::unique_ptr<TemporaryDir> tmp_dir_;
+  std::string path_;
+};
+
+/// Benchmark for sequential reads of `OpenInputStream()` by small chunks,
+/// depending on the readahead window.
+BENCHMARK_DEFINE_F(LocalFSReadFixture, StreamRead)
+(benchmark::State& st) {
+  auto options = LocalFileSystemOptions::Defaults();
+  options.readahead_bytes = st.range(0);
+  options.advise_access_pattern = true;
+  LocalFileSystem fs(options);
+  for (auto _ : st) {
+    ASSERT_OK_AND_ASSIGN(auto stream, fs.OpenInputStream(path_));
+    while (true) {
+      ASSERT_OK_AND_ASSIGN(auto buffer, stream->Read(64 << 10));
+      benchmark::DoNotOptimize(buffer->data());
+      if (buffer->size() == 0) break;
+    }
+    ASSERT_OK(stream->Close());
+  }
+  st.SetBytesProcessed(st.iterations() * kFileSize);
+}
+BENCHMARK_REGISTER_F(LocalFSReadFixture, StreamRead)
+    ->ArgNames({"readahead_bytes"})
+    ->Args({0})
+    ->Args({1 << 20})
+    ->Args({8 << 20})
+    ->UseRealTime();
+
+/// Benchmark for a whole-file `ReadAsync()` of `OpenInputFile()`, depending on
+/// the size of the chunks read in parallel.
+BENCHMARK_DEFINE_F(LocalFSReadFixture, ParallelRead)
+(benchmark::State& st) {
+  auto options = LocalFileSystemOptions::Defaults();
+  options.parallel_read_chunk_size = st.range(0);
+  LocalFileSystem fs(options);
+  for (auto _ : st) {
+    ASSERT_OK_AND_ASSIGN(auto file, fs.OpenInputFile(path_));
+    ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAsync(0, kFileSize).result());
+    benchmark::DoNotOptimize(buffer->data());
+    ASSERT_OK(file->Close());
+  }
+  st.SetBytesProcessed(st.iterations() * kFileSize);
+}
+BENCHMARK_REGISTER_F(LocalFSReadFixture, ParallelRead)
+    ->ArgNames({"parallel_read_chunk_size"})
+    ->Args({0})
+    ->Args({1 << 20})
+    ->Args({4 << 20})
+    ->UseRealTime();
+
 }  // namespace fs
 
 }  // namespace arrow
@@ -259,6 +259,21 @@ class TestLocalFSGenericMMap : public TestLocalFSGeneric<CommonPathFormatter> {
 
 GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericMMap);
 
+class TestLocalFSGenericReadahead : public TestLocalFSGeneric<CommonPathFormatter> {
+ protected:
+  LocalFileSystemOptions options() override {
+    auto options = LocalFileSystemOptions::Defaults();
+    // Tiny sizes so that the small test files span several chunks
+    options.readahead_bytes = 3;
+    options.parallel_read_chunk_size = 2;
+    options.advise_access_pattern = true;
+    options.drop_page_cache = true;
+    return options;
+  }
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericReadahead);
+
 ////////////////////////////////////////////////////////////////////////////
 // Concrete LocalFileSystem tests
 
@@ -533,6 +548,42 @@ TYPED_TEST(TestLocalFS, FileMTime) {
   AssertDurationBetween(t2 - infos[1].mtime(), -kTimeSlack, kTimeSlack);
 }
 
+TYPED_TEST(TestLocalFS, ReadaheadAndParallelReads) {
+  std::string data;
+  for (int i = 0; i < 1000; ++i) {
+    data += static_cast<char>('a' + i % 26);
+  }
+  CreateFile(this->fs_.get(), "ab", data);
+
+  this->options_.readahead_bytes = 7;
+  this->options_.parallel_read_chunk_size = 10;
+  this->options_.advise_access_pattern = true;
+  this->options_.drop_page_cache = true;
+  this->MakeFileSystem();
+
+  ASSERT_OK_AND_ASSIGN(auto stream, this->fs_->OpenInputStream("ab"));
+  std::string read;
+  while (true) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, stream->Read(13));
+    if (buffer->size() == 0) break;
+    read += buffer->ToString();
+    ASSERT_OK_AND_EQ(static_cast<int64_t>(read.size()), stream->Tell());
+  }
+  ASSERT_EQ(read, data);
+  ASSERT_OK(stream->Close());
+  ASSERT_RAISES(Invalid, stream->Read(1));
+
+  ASSERT_OK_AND_ASSIGN(auto file, this->fs_->OpenInputFile("ab"));
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAsync(5, 990).result());
+  ASSERT_EQ(buffer->ToString(), data.substr(5, 990));
+  // Reads past the end are truncated
+  ASSERT_OK_AND_ASSIGN(buffer, file->ReadAsync(15, 2000).result());
+  ASSERT_EQ(buffer->ToString(), data.substr(15));
+  ASSERT_OK_AND_ASSIGN(buffer, file->ReadAsync(1, 3).result());
+  ASSERT_EQ(buffer->ToString(), data.substr(1, 3));
+  ASSERT_OK(file->Close());
+}
+
 struct DirTreeCreator {
   static constexpr int kFilesPerDir = 50;
   static constexpr int kDirLevels = 2;
@@ -22,9 +22,11 @@
 #include <chrono>
 #include <condition_variable>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <set>
 #include <shared_mutex>
 #include <sstream>
 #include <thread>
@@ -445,6 +447,8 @@ bool S3Options::Equals(const S3Options& other) const {
           proxy_options.Equals(other.proxy_options) &&
           credentials_kind == other.credentials_kind &&
           background_writes == other.background_writes &&
+          read_part_size == other.read_part_size &&
+          max_concurrent_part_reads == other.max_concurrent_part_reads &&
           allow_bucket_creation == other.allow_bucket_creation &&
           allow_bucket_deletion == other.allow_bucket_deletion &&
           tls_ca_file_path == other.tls_ca_file_path &&
@@ -1453,13 +1457,14 @@ bool IsDirectory(std::string_view key, const S3Model::HeadObjectResult& result)
 class ObjectInputFile final : public io::RandomAccessFile {
  public:
   ObjectInputFile(std::shared_ptr<S3ClientHolder> holder, const io::IOContext& io_context,
-                  const S3Path& path, int64_t size = kNoSize,
-                  const std::string& sse_customer_key = "")
+                  const S3Path& path, const S3Options& options, int64_t size = kNoSize)
       : holder_(std::move(holder)),
         io_context_(io_context),
         path_(path),
         content_length_(size),
-        sse_customer_key_(sse_customer_key) {}
+        sse_customer_key_(options.sse_customer_key),
+        read_part_size_(options.read_part_size),
+        max_concurrent_part_reads_(options.max_concurrent_part_reads) {}
 
   Status Init() {
     // Issue a HEAD Object to get the content-length and ensure any
@@ -1554,6 +1559,15 @@ class ObjectInputFile final : public io::RandomAccessFile {
     if (nbytes == 0) {
       return 0;
     }
+    static const io::internal::ReadMetrics metrics("s3");
+    const auto start = io::internal::ReadMetrics::Clock::now();
+    if (read_part_size_ > 0 && max_concurrent_part_reads_ > 1 &&
+        nbytes >= 2 * read_part_size_) {
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                            ReadParts(position, nbytes, static_cast<uint8_t*>(out)));
+      metrics.Record(bytes_read, start);
+      return bytes_read;
+    }
 
     // Read the desired range of bytes
     ARROW_ASSIGN_OR_RAISE(auto client_lock, holder_->Lock());
@@ -1565,6 +1579,7 @@ class ObjectInputFile final : public io::RandomAccessFile {
     stream.ignore(nbytes);
     // NOTE: the stream is a stringstream by default, there is no actual error
     // to check for.  However, stream.fail() may return true if EOF is reached.
+    metrics.Record(stream.gcount(), start);
     return stream.gcount();
   }
 
@@ -1599,6 +1614,91 @@ class ObjectInputFile final : public io::RandomAccessFile {
   }
 
  protected:
+  // The progress of a read split in parts
+  struct PartReads {
+    int64_t num_parts;
+    std::atomic<int64_t> next_part{0};
+    std::atomic<bool> failed{false};
+    std::mutex mutex;
+    std::condition_variable parts_done_cv;
+    int64_t parts_done = 0;
+    Status status;
+  };
+
+  // Read parts of [position, position + nbytes) until none is left to read
+  static void ReadNextParts(const std::shared_ptr<S3ClientHolder>& holder,
+                            const S3Path& path, const std::string& sse_customer_key,
+                            int64_t position, int64_t nbytes, int64_t part_size,
+                            uint8_t* out, PartReads* state) {
+    int64_t part;
+    while ((part = state->next_part.fetch_add(1)) < state->num_parts) {
+      Status st;
+      // Once a part failed the other parts are only accounted for
+      if (!state->failed.load()) {
+        const int64_t offset = part * part_size;
+        const int64_t length = std::min(part_size, nbytes - offset);
+        st = [&]() -> Status {
+          ARROW_ASSIGN_OR_RAISE(auto client_lock, holder->Lock());
+          ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
+                                GetObjectRange(client_lock.get(), path, sse_customer_key,
+                                               position + offset, length, out + offset));
+          auto& stream = result.GetBody();
+          stream.ignore(length);
+          if (stream.gcount() != length) {
+            return Status::IOError("Read ", stream.gcount(), " bytes instead of ", length,
+                                   " at offset ", position + offset, " of key '",
+                                   path.key, "' in bucket '", path.bucket, "'");
+          }
+          return Status::OK();
+        }();
+        if (!st.ok()) {
+          state->failed.store(true);
+        }
+      }
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->status &= st;
+      if (++state->parts_done == state->num_parts) {
+        state->parts_done_cv.notify_all();
+      }
+    }
+  }
+
+  // Read a large range with concurrent ranged GET requests of read_part_size_ bytes,
+  // each written to its place in `out`.  The calling thread reads parts as well and
+  // only waits for the parts being read by other threads, so this can't deadlock
+  // even if the IO executor is busy, for example with the caller itself.
+  Result<int64_t> ReadParts(int64_t position, int64_t nbytes, uint8_t* out) {
+    auto state = std::make_shared<PartReads>();
+    state->num_parts = bit_util::CeilDiv(nbytes, read_part_size_);
+    const int num_helpers = static_cast<int>(
+        std::min<int64_t>(max_concurrent_part_reads_, state->num_parts) - 1);
+    for (int i = 0; i < num_helpers; ++i) {
+      // Helpers which start after all parts were read return without touching `out`
+      Status st = io_context_.executor()->Spawn(
+          [holder = holder_, path = path_, sse_customer_key = sse_customer_key_,
+           position, nbytes, part_size = read_part_size_, out, state]() {
+            ReadNextParts(holder, path, sse_customer_key, position, nbytes, part_size,
+                          out, state.get());
+          });
+      if (!st.ok()) {
+        // The helpers already spawned may be writing to `out`.  Skip the parts they
+        // haven't started and wait for the others below before returning the error.
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->status &= st;
+        state->failed.store(true);
+        break;
+      }
+    }
+    ReadNextParts(holder_, path_, sse_customer_key_, position, nbytes, read_part_size_,
+                  out, state.get());
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->parts_done_cv.wait(lock,
+                              [&] { return state->parts_done == state->num_parts; });
+    RETURN_NOT_OK(state->status);
+    return nbytes;
+  }
+
   std::shared_ptr<S3ClientHolder> holder_;
   const io::IOContext io_context_;
   S3Path path_;
@@ -1608,6 +1708,8 @@ class ObjectInputFile final : public io::RandomAccessFile {
   int64_t content_length_ = kNoSize;
   std::shared_ptr<const KeyValueMetadata> metadata_;
   std::string sse_customer_key_;
+  const int64_t read_part_size_;
+  const int max_concurrent_part_reads_;
 };
 
 // Upload size per part. While AWS and Minio support different sizes for each
@@ -2026,7 +2128,9 @@ class ObjectOutputStream final : public io::OutputStream {
 
         return async_result_callback(req, state, part_number, outcome);
       };
-      RETURN_NOT_OK(SubmitIO(io_context_, std::move(deferred)));
+      // Nobody waits for a background upload until Flush or Close, let reads go first
+      RETURN_NOT_OK(SubmitIO(io_context_.WithPriority(io::IOPriority::kBackground),
+                             std::move(deferred)));
     }
 
     ++part_number_;
@@ -2833,6 +2937,74 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     return DeleteObjectsAsync(bucket, keys).status();
   }
 
+  // Delete files, like DeleteFile but with batched requests.  As in
+  // FileSystem::DeleteFiles, an error on a file doesn't prevent deleting the others.
+  Future<> DeleteFilesAsync(std::vector<S3Path> paths) {
+    auto self = shared_from_this();
+    std::vector<Future<>> head_futures;
+    head_futures.reserve(paths.size());
+    for (const auto& path : paths) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto fut, SubmitIO(io_context_, [self, path]() -> Status {
+            S3Model::HeadObjectRequest req;
+            req.SetBucket(ToAwsString(path.bucket));
+            req.SetKey(ToAwsString(path.key));
+
+            ARROW_ASSIGN_OR_RAISE(auto client_lock, self->holder_->Lock());
+            auto outcome = client_lock.Move()->HeadObject(req);
+            if (outcome.IsSuccess()) {
+              return Status::OK();
+            }
+            if (IsNotFound(outcome.GetError())) {
+              return PathNotFound(path);
+            }
+            return ErrorToStatus(
+                std::forward_as_tuple("When getting information for key '", path.key,
+                                      "' in bucket '", path.bucket, "': "),
+                "HeadObject", outcome.GetError());
+          }));
+      head_futures.push_back(std::move(fut));
+    }
+
+    auto delete_existing =
+        [self, paths](const std::vector<Result<::arrow::internal::Empty>>& head_results)
+        -> Future<> {
+      Status head_status;
+      std::map<std::string, std::vector<std::string>> keys_by_bucket;
+      std::map<std::string, S3Path> parents;
+      for (size_t i = 0; i < paths.size(); ++i) {
+        if (!head_results[i].ok()) {
+          head_status &= head_results[i].status();
+          continue;
+        }
+        keys_by_bucket[paths[i].bucket].push_back(paths[i].key);
+        if (paths[i].has_parent()) {
+          auto parent = paths[i].parent();
+          parents.emplace(parent.full_path, std::move(parent));
+        }
+      }
+      std::vector<Future<>> delete_futures;
+      for (const auto& [bucket, keys] : keys_by_bucket) {
+        delete_futures.push_back(self->DeleteObjectsAsync(bucket, keys));
+      }
+      return AllFinished(delete_futures)
+          .Then([self, parents = std::move(parents)]() -> Future<> {
+            // Parents may be implicitly deleted if they became empty, recreate them
+            std::vector<Future<>> futures;
+            for (const auto& entry : parents) {
+              ARROW_ASSIGN_OR_RAISE(
+                  auto fut, SubmitIO(self->io_context_, [self, parent = entry.second] {
+                    return self->EnsureDirectoryExists(parent);
+                  }));
+              futures.push_back(std::move(fut));
+            }
+            return AllFinished(futures);
+          })
+          .Then([head_status]() { return head_status; });
+    };
+    return All(std::move(head_futures)).Then(std::move(delete_existing));
+  }
+
   // Check to make sure the given path is not a file
   //
   // Returns true if the path seems to be a directory, false if it is a file
@@ -3027,8 +3199,8 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
 
     RETURN_NOT_OK(CheckS3Initialized());
 
-    auto ptr = std::make_shared<ObjectInputFile>(holder_, fs->io_context(), path, kNoSize,
-                                                 fs->options().sse_customer_key);
+    auto ptr =
+        std::make_shared<ObjectInputFile>(holder_, fs->io_context(), path, fs->options());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -3048,8 +3220,8 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
 
     RETURN_NOT_OK(CheckS3Initialized());
 
-    auto ptr = std::make_shared<ObjectInputFile>(
-        holder_, fs->io_context(), path, info.size(), fs->options().sse_customer_key);
+    auto ptr = std::make_shared<ObjectInputFile>(holder_, fs->io_context(), path,
+                                                 fs->options(), info.size());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -3344,6 +3516,21 @@ Status S3FileSystem::DeleteFile(const std::string& s) {
   return impl_->EnsureParentExists(path);
 }
 
+Status S3FileSystem::DeleteFiles(const std::vector<std::string>& paths) {
+  return DeleteFilesAsync(paths).status();
+}
+
+Future<> S3FileSystem::DeleteFilesAsync(const std::vector<std::string>& paths) {
+  std::vector<S3Path> s3_paths;
+  s3_paths.reserve(paths.size());
+  for (const auto& s : paths) {
+    ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
+    RETURN_NOT_OK(ValidateFilePath(path));
+    s3_paths.push_back(std::move(path));
+  }
+  return impl_->DeleteFilesAsync(std::move(s3_paths));
+}
+
 Status S3FileSystem::Move(const std::string& src, const std::string& dest) {
   // XXX We don't implement moving directories as it would be too expensive:
   // one must copy all directory contents one by one (including object data),
@@ -155,6 +155,17 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// The size of the parts in which large reads from input files are split.
+  ///
+  /// A read of at least twice this size is split in ranged GET requests of this size,
+  /// up to `max_concurrent_part_reads` of which are issued concurrently on the IO
+  /// executor, and reassembled in the read buffer.  This lets a single stream use more
+  /// bandwidth than a single connection provides.  If 0, reads are never split.
+  int64_t read_part_size = 16 * 1024 * 1024;
+
+  /// The maximum number of concurrent requests for a single read from an input file.
+  int max_concurrent_part_reads = 8;
+
   /// Whether to allow creation of buckets
   ///
   /// When S3FileSystem creates new buckets, it does not pass any non-default settings.
@@ -331,6 +342,12 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   Status DeleteRootDirContents() override;
 
   Status DeleteFile(const std::string& path) override;
+  /// Delete many files.
+  ///
+  /// The files are checked for existence in parallel, then deleted with batched
+  /// DeleteObjects requests, also issued in parallel.
+  Status DeleteFiles(const std::vector<std::string>& paths) override;
+  Future<> DeleteFilesAsync(const std::vector<std::string>& paths) override;
 
   Status Move(const std::string& src, const std::string& dest) override;
 
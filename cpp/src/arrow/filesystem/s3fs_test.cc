@@ -1128,6 +1128,27 @@ TEST_F(TestS3FS, DeleteFile) {
   ASSERT_RAISES(Invalid, fs_->DeleteFile("s3:bucket/somefile"));
 }
 
+TEST_F(TestS3FS, DeleteFilesAsync) {
+  ASSERT_FINISHES_OK(fs_->DeleteFilesAsync({}));
+  ASSERT_FINISHES_OK(
+      fs_->DeleteFilesAsync({"bucket/somefile", "bucket/somedir/subdir/subfile"}));
+  AssertFileInfo(fs_.get(), "bucket/somefile", FileType::NotFound);
+  AssertFileInfo(fs_.get(), "bucket/somedir/subdir/subfile", FileType::NotFound);
+  // The parent directory was recreated
+  AssertFileInfo(fs_.get(), "bucket/somedir/subdir", FileType::Directory);
+
+  // Existing files are deleted even if others don't exist
+  ASSERT_FINISHES_AND_RAISES(
+      IOError,
+      fs_->DeleteFilesAsync({"bucket/nonexistent", "bucket/otherdir/1/2/3/otherfile"}));
+  AssertFileInfo(fs_.get(), "bucket/otherdir/1/2/3/otherfile", FileType::NotFound);
+  AssertFileInfo(fs_.get(), "bucket/otherdir/1/2/3", FileType::Directory);
+
+  // Not a file
+  ASSERT_RAISES(IOError, fs_->DeleteFiles({"bucket/emptydir"}));
+  ASSERT_RAISES(IOError, fs_->DeleteFiles({"bucket"}));
+}
+
 TEST_F(TestS3FS, DeleteDir) {
   FileSelector select;
   select.base_dir = "bucket";
@@ -1356,6 +1377,35 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+TEST_F(TestS3FS, OpenInputFileReadParts) {
+  // Large reads are split in concurrent ranged requests
+  options_.read_part_size = 1000;
+  options_.max_concurrent_part_reads = 4;
+  MakeFileSystem();
+  std::string data = random_string(10500, /*seed=*/42);
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenOutputStream("bucket/newfile"));
+  ASSERT_OK(stream->Write(data));
+  ASSERT_OK(stream->Close());
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("bucket/newfile"));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 20000));
+  AssertBufferEqual(*buf, data);
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(1234, 5678));
+  AssertBufferEqual(*buf, data.substr(1234, 5678));
+  // Too short to be split
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(100, 1999));
+  AssertBufferEqual(*buf, data.substr(100, 1999));
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(7777));
+  AssertBufferEqual(*buf, data.substr(0, 7777));
+  ASSERT_OK_AND_EQ(7777, file->Tell());
+
+  options_.max_concurrent_part_reads = 1;
+  MakeFileSystem();
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/newfile"));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 20000));
+  AssertBufferEqual(*buf, data);
+}
+
 // Minio only allows Server Side Encryption on HTTPS client connections.
 #ifdef ENABLE_TLS_TESTS
 class TestS3FSHTTPS : public TestS3FS {
@@ -22,6 +22,7 @@
 #include "arrow/flight/client_middleware.h"
 #include "arrow/flight/client_tracing_middleware.h"
 #include "arrow/flight/middleware.h"
+#include "arrow/flight/multi_endpoint_reader.h"
 #include "arrow/flight/server.h"
 #include "arrow/flight/server_auth.h"
 #include "arrow/flight/server_middleware.h"
@@ -20,10 +20,13 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/ipc/options.h"
@@ -319,6 +322,30 @@ class ServerErrorTagStatusDetail : public arrow::StatusDetail {
   }
 };
 
+namespace {
+/// \brief Check the size of a payload against the user-configured
+///   soft limit, if any.
+Status CheckPayloadSize(const FlightPayload& payload, int64_t write_size_limit_bytes) {
+  if (write_size_limit_bytes <= 0) return Status::OK();
+  int64_t size = payload.ipc_message.body_length;
+  if (payload.ipc_message.metadata) {
+    size += payload.ipc_message.metadata->size();
+  }
+  if (payload.descriptor) {
+    size += payload.descriptor->size();
+  }
+  if (payload.app_metadata) {
+    size += payload.app_metadata->size();
+  }
+  if (size > write_size_limit_bytes) {
+    return arrow::Status(
+        arrow::StatusCode::Invalid, "IPC payload size exceeded soft limit",
+        std::make_shared<FlightWriteSizeStatusDetail>(write_size_limit_bytes, size));
+  }
+  return Status::OK();
+}
+}  // namespace
+
 /// \brief An IpcPayloadWriter for any ClientDataStream.
 ///
 /// To support app_metadata and reuse the existing IPC infrastructure,
@@ -352,22 +379,7 @@ class ClientPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
       payload.app_metadata = std::move(*app_metadata_);
     }
 
-    if (write_size_limit_bytes_ > 0) {
-      // Check if the total size is greater than the user-configured
-      // soft-limit.
-      int64_t size = ipc_payload.body_length + ipc_payload.metadata->size();
-      if (payload.descriptor) {
-        size += payload.descriptor->size();
-      }
-      if (payload.app_metadata) {
-        size += payload.app_metadata->size();
-      }
-      if (size > write_size_limit_bytes_) {
-        return arrow::Status(
-            arrow::StatusCode::Invalid, "IPC payload size exceeded soft limit",
-            std::make_shared<FlightWriteSizeStatusDetail>(write_size_limit_bytes_, size));
-      }
-    }
+    RETURN_NOT_OK(CheckPayloadSize(payload, write_size_limit_bytes_));
     ARROW_ASSIGN_OR_RAISE(auto success, stream_->WriteData(payload));
     if (!success) {
       return Status::FromDetailAndArgs(
@@ -537,6 +549,398 @@ class ClientStreamWriter : public FlightStreamWriter {
   FlightDescriptor descriptor_;
 };
 
+namespace {
+
+/// \brief An ipc::MessageReader over the messages an async stream
+///   has received so far.
+class QueuedMessageReader : public ipc::MessageReader {
+ public:
+  explicit QueuedMessageReader(std::deque<std::unique_ptr<ipc::Message>>* messages)
+      : messages_(messages) {}
+
+  ::arrow::Result<std::unique_ptr<ipc::Message>> ReadNextMessage() override {
+    if (messages_->empty()) return nullptr;
+    auto message = std::move(messages_->front());
+    messages_->pop_front();
+    return message;
+  }
+
+ private:
+  std::deque<std::unique_ptr<ipc::Message>>* messages_;
+};
+
+/// \brief An IpcPayloadWriter collecting the payloads of an async stream.
+class StagedPayloadWriter : public ipc::internal::IpcPayloadWriter {
+ public:
+  StagedPayloadWriter(std::vector<FlightPayload>* staged, FlightDescriptor descriptor,
+                      int64_t write_size_limit_bytes,
+                      std::shared_ptr<Buffer>* app_metadata)
+      : staged_(staged),
+        descriptor_(std::move(descriptor)),
+        write_size_limit_bytes_(write_size_limit_bytes),
+        app_metadata_(app_metadata) {}
+
+  Status Start() override { return Status::OK(); }
+  Status WritePayload(const ipc::IpcPayload& ipc_payload) override {
+    FlightPayload payload;
+    payload.ipc_message = ipc_payload;
+    if (first_payload_) {
+      if (ipc_payload.type != ipc::MessageType::SCHEMA) {
+        return Status::Invalid("First IPC message should be schema");
+      }
+      RETURN_NOT_OK(internal::ToPayload(descriptor_, &payload.descriptor));
+      first_payload_ = false;
+    } else if (ipc_payload.type == ipc::MessageType::RECORD_BATCH && *app_metadata_) {
+      payload.app_metadata = std::move(*app_metadata_);
+    }
+    RETURN_NOT_OK(CheckPayloadSize(payload, write_size_limit_bytes_));
+    staged_->push_back(std::move(payload));
+    return Status::OK();
+  }
+  Status Close() override { return Status::OK(); }
+
+ private:
+  std::vector<FlightPayload>* staged_;
+  const FlightDescriptor descriptor_;
+  const int64_t write_size_limit_bytes_;
+  std::shared_ptr<Buffer>* app_metadata_;
+  bool first_payload_ = true;
+};
+
+/// \brief The client side of an async DoGet, DoPut or DoExchange.
+///
+/// Decodes the data read by the transport into the callbacks of the
+/// AsyncStreamListener, and encodes the chunks the application writes
+/// into a queue of payloads that are written one at a time.
+class ClientAsyncStream : public internal::AsyncDataListener {
+ public:
+  ClientAsyncStream(std::shared_ptr<AsyncStreamListener> listener,
+                    const FlightCallOptions& options, int64_t write_size_limit_bytes,
+                    bool writable)
+      : listener_(std::move(listener)),
+        read_options_(options.read_options),
+        write_options_(options.write_options),
+        memory_manager_(options.memory_manager),
+        write_size_limit_bytes_(write_size_limit_bytes),
+        writable_(writable) {}
+
+  void OnStart(internal::AsyncDataStream* stream) override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    stream_ = stream;
+  }
+
+  void OnData(internal::FlightData data) override {
+    if (!read_status_.ok()) return;
+    read_status_ = Decode(std::move(data));
+    if (!read_status_.ok()) TryCancel();
+  }
+
+  void OnPutMetadata(std::shared_ptr<Buffer> app_metadata) override {
+    FlightStreamChunk chunk;
+    chunk.app_metadata = std::move(app_metadata);
+    listener_->OnNext(std::move(chunk));
+  }
+
+  void OnWriteDone(bool ok) override {
+    std::shared_ptr<AsyncStreamListener> listener;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      writing_ = false;
+      if (ok && current_.ends_chunk) listener = listener_;
+      current_ = QueuedPayload();
+      if (!ok) {
+        // The transport reports the reason in OnFinish
+        write_failed_ = true;
+        pending_.clear();
+      }
+      StartNextWrite();
+    }
+    if (listener) listener->OnWriteDone();
+  }
+
+  void OnFinish(Status status) override {
+    std::shared_ptr<AsyncStreamListener> listener;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      stream_ = nullptr;
+      finished_ = true;
+      pending_.clear();
+      batch_writer_.reset();
+      // Breaks the cycle through the listener's RPC state
+      listener = std::move(listener_);
+    }
+    // A client-side error is what cancelled the call
+    if (!read_status_.ok()) status = std::move(read_status_);
+    listener->OnFinish(std::move(status));
+  }
+
+  void TryCancel() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (stream_) stream_->TryCancel();
+  }
+
+  Status Begin(const FlightDescriptor& descriptor, std::shared_ptr<Schema> schema) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    RETURN_NOT_OK(CheckWritable());
+    if (began_) {
+      return Status::Invalid("This writer has already been started.");
+    }
+    began_ = true;
+    if (schema) {
+      // Like the blocking writer, the schema is sent along with the
+      // first batch, or when writing is done
+      auto payload_writer = std::make_unique<StagedPayloadWriter>(
+          &staged_, descriptor, write_size_limit_bytes_, &app_metadata_);
+      ARROW_ASSIGN_OR_RAISE(batch_writer_,
+                            ipc::internal::OpenRecordBatchWriter(
+                                std::move(payload_writer), schema, write_options_));
+      return Status::OK();
+    }
+    FlightPayload payload;
+    RETURN_NOT_OK(internal::ToPayload(descriptor, &payload.descriptor));
+    staged_.push_back(std::move(payload));
+    Enqueue(/*ends_chunk=*/false);
+    return Status::OK();
+  }
+
+  Status Write(FlightStreamChunk chunk) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    RETURN_NOT_OK(CheckWritable());
+    if (chunk.data) {
+      if (!batch_writer_) {
+        return Status::Invalid("Writer not initialized. Call Begin() with a schema.");
+      }
+      app_metadata_ = std::move(chunk.app_metadata);
+      auto status = batch_writer_->WriteRecordBatch(*chunk.data);
+      if (!status.ok()) {
+        staged_.clear();
+        return status;
+      }
+    } else if (chunk.app_metadata) {
+      FlightPayload payload;
+      payload.app_metadata = std::move(chunk.app_metadata);
+      staged_.push_back(std::move(payload));
+    } else {
+      return Status::Invalid("Cannot write an empty chunk");
+    }
+    Enqueue(/*ends_chunk=*/true);
+    return Status::OK();
+  }
+
+  Status DoneWriting() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    RETURN_NOT_OK(CheckWritable());
+    done_writing_ = true;
+    if (batch_writer_) {
+      // Flushes the schema if no batch was written
+      RETURN_NOT_OK(batch_writer_->Close());
+      Enqueue(/*ends_chunk=*/false);
+    }
+    StartNextWrite();
+    return Status::OK();
+  }
+
+ private:
+  struct QueuedPayload {
+    FlightPayload payload;
+    /// Whether this is the last payload of a chunk passed to Write()
+    bool ends_chunk = false;
+  };
+
+  Status Decode(internal::FlightData data) {
+    if (!data.metadata) {
+      // Metadata-only (data.metadata is the IPC header)
+      if (data.app_metadata) {
+        FlightStreamChunk chunk;
+        chunk.app_metadata = std::move(data.app_metadata);
+        listener_->OnNext(std::move(chunk));
+      }
+      return Status::OK();
+    }
+    if (data.body && memory_manager_) {
+      ARROW_ASSIGN_OR_RAISE(data.body, Buffer::ViewOrCopy(data.body, memory_manager_));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto message, data.OpenMessage());
+    const ipc::MessageType type = message->type();
+    messages_.push_back(std::move(message));
+    if (!batch_reader_) {
+      ARROW_ASSIGN_OR_RAISE(
+          batch_reader_,
+          ipc::RecordBatchStreamReader::Open(
+              std::make_unique<QueuedMessageReader>(&messages_), read_options_));
+      listener_->OnSchema(batch_reader_->schema());
+      return Status::OK();
+    }
+    // Dictionary batches are read along with the record batch that
+    // follows them
+    if (type != ipc::MessageType::RECORD_BATCH) return Status::OK();
+    FlightStreamChunk chunk;
+    RETURN_NOT_OK(batch_reader_->ReadNext(&chunk.data));
+    if (!chunk.data) {
+      return Status::Invalid("Record batch message was not decoded");
+    }
+    chunk.app_metadata = std::move(data.app_metadata);
+    listener_->OnNext(std::move(chunk));
+    return Status::OK();
+  }
+
+  Status CheckWritable() const {
+    if (!writable_) return Status::NotImplemented("Writing to a DoGet");
+    if (finished_) return Status::Invalid("The call is finished");
+    if (done_writing_) return Status::Invalid("DoneWriting() was already called");
+    if (write_failed_) {
+      return Status::IOError("Could not write to stream (server disconnect?)");
+    }
+    return Status::OK();
+  }
+
+  /// Move the staged payloads to the write queue. mutex_ must be held.
+  void Enqueue(bool ends_chunk) {
+    for (size_t i = 0; i < staged_.size(); ++i) {
+      pending_.push_back(
+          QueuedPayload{std::move(staged_[i]), ends_chunk && i + 1 == staged_.size()});
+    }
+    staged_.clear();
+    StartNextWrite();
+  }
+
+  /// Start the next write if none is outstanding. mutex_ must be held,
+  /// so that the transport stream is not used after OnFinish().
+  void StartNextWrite() {
+    if (stream_ == nullptr || writing_ || write_failed_) return;
+    if (!pending_.empty()) {
+      current_ = std::move(pending_.front());
+      pending_.pop_front();
+      writing_ = true;
+      stream_->StartWrite(&current_.payload);
+    } else if (done_writing_ && !writes_done_sent_) {
+      writes_done_sent_ = true;
+      stream_->WritesDone();
+    }
+  }
+
+  std::shared_ptr<AsyncStreamListener> listener_;
+  const ipc::IpcReadOptions read_options_;
+  const ipc::IpcWriteOptions write_options_;
+  const std::shared_ptr<MemoryManager> memory_manager_;
+  const int64_t write_size_limit_bytes_;
+  const bool writable_;
+
+  // Read side, only used from the read callbacks
+  Status read_status_;
+  std::deque<std::unique_ptr<ipc::Message>> messages_;
+  std::shared_ptr<ipc::RecordBatchReader> batch_reader_;
+
+  // Write side, protected by mutex_
+  std::mutex mutex_;
+  internal::AsyncDataStream* stream_ = nullptr;
+  std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
+  std::shared_ptr<Buffer> app_metadata_;
+  std::vector<FlightPayload> staged_;
+  std::deque<QueuedPayload> pending_;
+  QueuedPayload current_;
+  bool began_ = false;
+  bool writing_ = false;
+  bool write_failed_ = false;
+  bool done_writing_ = false;
+  bool writes_done_sent_ = false;
+  bool finished_ = false;
+};
+
+/// \brief The RPC state of an async stream in its listener.
+class ClientAsyncStreamRpc : public internal::AsyncRpc {
+ public:
+  explicit ClientAsyncStreamRpc(std::shared_ptr<ClientAsyncStream> stream)
+      : stream_(std::move(stream)) {}
+
+  void TryCancel() override { stream_->TryCancel(); }
+  Status Begin(const FlightDescriptor& descriptor,
+               std::shared_ptr<Schema> schema) override {
+    return stream_->Begin(descriptor, std::move(schema));
+  }
+  Status Write(FlightStreamChunk chunk) override {
+    return stream_->Write(std::move(chunk));
+  }
+  Status DoneWriting() override { return stream_->DoneWriting(); }
+
+ private:
+  std::shared_ptr<ClientAsyncStream> stream_;
+};
+
+/// \brief Collect the results of an async DoGet into a Table.
+class TableAsyncListener : public AsyncStreamListener {
+ public:
+  void OnSchema(std::shared_ptr<Schema> schema) override { schema_ = std::move(schema); }
+  void OnNext(FlightStreamChunk chunk) override {
+    if (chunk.data) batches_.push_back(std::move(chunk.data));
+  }
+  void OnFinish(Status status) override {
+    if (!status.ok()) {
+      future_.MarkFinished(std::move(status));
+    } else if (!schema_) {
+      future_.MarkFinished(MakeFlightError(FlightStatusCode::Internal,
+                                           "Server never sent a data message"));
+    } else {
+      future_.MarkFinished(Table::FromRecordBatches(schema_, std::move(batches_)));
+    }
+  }
+
+  arrow::Future<std::shared_ptr<Table>> future_ =
+      arrow::Future<std::shared_ptr<Table>>::Make();
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+};
+
+/// \brief Write record batches through an async DoPut, one at a time.
+class BatchesAsyncListener : public AsyncStreamListener {
+ public:
+  explicit BatchesAsyncListener(RecordBatchVector batches)
+      : batches_(std::move(batches)) {}
+
+  void OnNext(FlightStreamChunk chunk) override {}
+  void OnWriteDone() override { WriteNext(); }
+  void OnFinish(Status status) override {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      // The error that made us cancel the call
+      if (!write_status_.ok()) status = write_status_;
+    }
+    future_.MarkFinished(std::move(status));
+  }
+
+  void WriteNext() {
+    Status status;
+    if (next_ < batches_.size()) {
+      FlightStreamChunk chunk;
+      chunk.data = std::move(batches_[next_++]);
+      status = Write(std::move(chunk));
+    } else {
+      status = DoneWriting();
+    }
+    if (!status.ok()) Fail(std::move(status));
+  }
+
+  void Fail(Status status) {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      write_status_ = std::move(status);
+    }
+    TryCancel();
+  }
+
+  arrow::Future<> future_ = arrow::Future<>::Make();
+
+ private:
+  RecordBatchVector batches_;
+  size_t next_ = 0;
+  std::mutex mutex_;
+  Status write_status_;
+};
+
+}  // namespace
+
 FlightClient::FlightClient() : closed_(false), write_size_limit_bytes_(0) {}
 
 FlightClient::~FlightClient() {
@@ -713,6 +1117,72 @@ arrow::Result<FlightClient::DoExchangeResult> FlightClient::DoExchange(
   return result;
 }
 
+std::shared_ptr<internal::AsyncDataListener> FlightClient::MakeAsyncStream(
+    const FlightCallOptions& options, std::shared_ptr<AsyncStreamListener> listener,
+    bool writable) {
+  auto* listener_ptr = listener.get();
+  auto stream = std::make_shared<ClientAsyncStream>(std::move(listener), options,
+                                                    write_size_limit_bytes_, writable);
+  internal::ClientTransport::SetAsyncRpc(
+      listener_ptr, std::make_unique<ClientAsyncStreamRpc>(stream));
+  return stream;
+}
+
+void FlightClient::DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                              std::shared_ptr<AsyncStreamListener> listener) {
+  if (auto status = CheckOpen(); !status.ok()) {
+    listener->OnFinish(std::move(status));
+    return;
+  }
+  transport_->DoGetAsync(options, ticket,
+                         MakeAsyncStream(options, std::move(listener), false));
+}
+
+arrow::Future<std::shared_ptr<Table>> FlightClient::DoGetAsync(
+    const FlightCallOptions& options, const Ticket& ticket) {
+  RETURN_NOT_OK(CheckOpen());
+  auto listener = std::make_shared<TableAsyncListener>();
+  auto future = listener->future_;
+  transport_->DoGetAsync(options, ticket,
+                         MakeAsyncStream(options, std::move(listener), false));
+  return future;
+}
+
+void FlightClient::DoPutAsync(const FlightCallOptions& options,
+                              std::shared_ptr<AsyncStreamListener> listener) {
+  if (auto status = CheckOpen(); !status.ok()) {
+    listener->OnFinish(std::move(status));
+    return;
+  }
+  transport_->DoPutAsync(options, MakeAsyncStream(options, std::move(listener), true));
+}
+
+arrow::Future<> FlightClient::DoPutAsync(const FlightCallOptions& options,
+                                         const FlightDescriptor& descriptor,
+                                         const std::shared_ptr<Schema>& schema,
+                                         RecordBatchVector batches) {
+  RETURN_NOT_OK(CheckOpen());
+  auto listener = std::make_shared<BatchesAsyncListener>(std::move(batches));
+  auto future = listener->future_;
+  transport_->DoPutAsync(options, MakeAsyncStream(options, listener, true));
+  if (auto status = listener->Begin(descriptor, schema); !status.ok()) {
+    listener->Fail(std::move(status));
+    return future;
+  }
+  listener->WriteNext();
+  return future;
+}
+
+void FlightClient::DoExchangeAsync(const FlightCallOptions& options,
+                                   std::shared_ptr<AsyncStreamListener> listener) {
+  if (auto status = CheckOpen(); !status.ok()) {
+    listener->OnFinish(std::move(status));
+    return;
+  }
+  transport_->DoExchangeAsync(options,
+                              MakeAsyncStream(options, std::move(listener), true));
+}
+
 ::arrow::Result<SetSessionOptionsResult> FlightClient::SetSessionOptions(
     const FlightCallOptions& options, const SetSessionOptionsRequest& request) {
   RETURN_NOT_OK(CheckOpen());
@@ -339,6 +339,25 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket);
   }
 
+  /// \brief Asynchronous DoGet.
+  ///
+  /// The listener is given the schema of the stream, then a chunk for
+  /// each record batch or metadata-only message.
+  /// \param[in] options Per-RPC options
+  /// \param[in] ticket The flight ticket to use
+  /// \param[in] listener Callbacks for the stream and RPC completion
+  void DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                  std::shared_ptr<AsyncStreamListener> listener);
+
+  /// \brief Asynchronous DoGet collecting the stream into a Table.
+  /// \param[in] options Per-RPC options
+  /// \param[in] ticket The flight ticket to use
+  arrow::Future<std::shared_ptr<Table>> DoGetAsync(const FlightCallOptions& options,
+                                                   const Ticket& ticket);
+  arrow::Future<std::shared_ptr<Table>> DoGetAsync(const Ticket& ticket) {
+    return DoGetAsync({}, ticket);
+  }
+
   /// \brief DoPut return value
   struct DoPutResult {
     /// \brief a writer to write record batches to
@@ -367,6 +386,29 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoPut({}, descriptor, schema);
   }
 
+  /// \brief Asynchronous DoPut.
+  ///
+  /// Once the call is started, the listener writes with Begin(),
+  /// Write() and DoneWriting(). Metadata sent by the server is given
+  /// to OnNext().
+  /// \param[in] options Per-RPC options
+  /// \param[in] listener Callbacks for the stream and RPC completion
+  void DoPutAsync(const FlightCallOptions& options,
+                  std::shared_ptr<AsyncStreamListener> listener);
+
+  /// \brief Asynchronous DoPut of a sequence of record batches.
+  ///
+  /// A batch is written once the previous one was handed to the
+  /// transport, so memory use is bounded by the batches themselves.
+  /// \param[in] options Per-RPC options
+  /// \param[in] descriptor the descriptor of the stream
+  /// \param[in] schema the schema for the data to upload
+  /// \param[in] batches the data to upload
+  arrow::Future<> DoPutAsync(const FlightCallOptions& options,
+                             const FlightDescriptor& descriptor,
+                             const std::shared_ptr<Schema>& schema,
+                             RecordBatchVector batches);
+
   struct DoExchangeResult {
     std::unique_ptr<FlightStreamWriter> writer;
     std::unique_ptr<FlightStreamReader> reader;
@@ -377,6 +419,15 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoExchange({}, descriptor);
   }
 
+  /// \brief Asynchronous DoExchange.
+  ///
+  /// The listener writes as with DoPutAsync() and reads as with
+  /// DoGetAsync().
+  /// \param[in] options Per-RPC options
+  /// \param[in] listener Callbacks for the stream and RPC completion
+  void DoExchangeAsync(const FlightCallOptions& options,
+                       std::shared_ptr<AsyncStreamListener> listener);
+
   /// \brief Set server session option(s) by name/value. Sessions are generally
   /// persisted via HTTP cookies.
   /// \param[in] options Per-RPC options
@@ -421,6 +472,9 @@ class ARROW_FLIGHT_EXPORT FlightClient {
  private:
   FlightClient();
   Status CheckOpen() const;
+  std::shared_ptr<internal::AsyncDataListener> MakeAsyncStream(
+      const FlightCallOptions& options, std::shared_ptr<AsyncStreamListener> listener,
+      bool writable);
   std::unique_ptr<internal::ClientTransport> transport_;
   bool closed_;
   int64_t write_size_limit_bytes_;
@@ -15,7 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
+#include <fstream>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -23,12 +25,18 @@
 
 #include <gflags/gflags.h>
 
+#include "arrow/json/rapidjson_defs.h"  // IWYU pragma: keep
+
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
 #include "arrow/array.h"
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/config.h"
 #include "arrow/util/stopwatch.h"
@@ -38,7 +46,11 @@
 #include "arrow/flight/api.h"
 #include "arrow/flight/perf.pb.h"
 #include "arrow/flight/test_util.h"
+#include "arrow/flight/transport/grpc/serialization_internal.h"
 
+#ifdef ARROW_FLIGHT_SQL
+#  include "arrow/flight/sql/client.h"
+#endif
 #ifdef ARROW_CUDA
 #  include <cuda.h>
 #  include "arrow/gpu/cuda_api.h"
@@ -46,6 +58,9 @@
 #ifdef ARROW_WITH_UCX
 #  include "arrow/flight/transport/ucx/ucx.h"
 #endif
+#ifdef ARROW_FLIGHT_SHM
+#  include "arrow/flight/transport/shm/shm.h"
+#endif
 
 DEFINE_bool(cuda, false, "Allocate results in CUDA memory");
 DEFINE_string(transport, "grpc",
@@ -53,6 +68,9 @@ DEFINE_string(transport, "grpc",
 #ifdef ARROW_WITH_UCX
               ", \"ucx\""
 #endif  // ARROW_WITH_UCX
+#ifdef ARROW_FLIGHT_SHM
+              ", \"shm\""
+#endif  // ARROW_FLIGHT_SHM
               ".");
 DEFINE_string(server_host, "",
               "An existing performance server to benchmark against (leave blank to spawn "
@@ -70,7 +88,19 @@ DEFINE_int32(num_streams, 4, "Number of streams for each server");
 DEFINE_int32(num_threads, 4, "Number of concurrent gets");
 DEFINE_int64(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
-DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_int32(num_columns, 4, "Number of int64 columns in each batch");
+DEFINE_string(test_method, "get",
+              "The method to test: \"get\" (DoGet, default), \"put\" (DoPut), "
+              "\"exchange\" (DoExchange round trips)"
+#ifdef ARROW_FLIGHT_SQL
+              ", \"sql\" (a Flight SQL query against -server_host)"
+#endif
+              ".");
+DEFINE_bool(test_put, false, "Test DoPut instead of DoGet (same as -test_method=put)");
+#ifdef ARROW_FLIGHT_SQL
+DEFINE_string(sql_query, "", "The query to run with -test_method=sql");
+#endif
+DEFINE_string(json_output, "", "Also write the results as JSON to this file");
 DEFINE_string(compression, "",
               "Select compression method (\"zstd\", \"lz4\"). "
               "Leave blank to disable compression.\n"
@@ -78,7 +108,8 @@ DEFINE_string(compression, "",
               "      \"zstd:7\": zstd with compression leve = 7.\n");
 DEFINE_string(
     data_file, "",
-    "Instead of random data, use data from the given IPC file. Only affects -test_put.");
+    "Instead of random data, use data from the given IPC file. Only affects DoPut and "
+    "DoExchange.");
 DEFINE_string(cert_file, "", "Path to TLS certificate");
 DEFINE_string(key_file, "", "Path to TLS private key (used when spawning a server)");
 
@@ -91,6 +122,32 @@ using internal::ThreadPool;
 
 namespace flight {
 
+enum class TestMethod { kDoGet, kDoPut, kDoExchange, kSql };
+
+const char* TestMethodName(TestMethod method) {
+  switch (method) {
+    case TestMethod::kDoGet:
+      return "DoGet";
+    case TestMethod::kDoPut:
+      return "DoPut";
+    case TestMethod::kDoExchange:
+      return "DoExchange";
+    case TestMethod::kSql:
+      return "FlightSql";
+  }
+  return "";
+}
+
+arrow::Result<TestMethod> GetTestMethod() {
+  if (FLAGS_test_put || FLAGS_test_method == "put") return TestMethod::kDoPut;
+  if (FLAGS_test_method == "get") return TestMethod::kDoGet;
+  if (FLAGS_test_method == "exchange") return TestMethod::kDoExchange;
+#ifdef ARROW_FLIGHT_SQL
+  if (FLAGS_test_method == "sql") return TestMethod::kSql;
+#endif
+  return Status::Invalid("Unknown test method: ", FLAGS_test_method);
+}
+
 struct PerformanceResult {
   int64_t num_batches;
   int64_t num_records;
@@ -150,8 +207,9 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
 
   FlightStreamChunk batch;
 
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
+  // All columns are int64
+  ARROW_ASSIGN_OR_RAISE(auto schema, reader->GetSchema());
+  const int64_t bytes_per_record = 8 * schema->num_fields();
 
   // This must also be set in perf_server.cc
   const bool verify = false;
@@ -205,19 +263,25 @@ arrow::Result<std::vector<SizedBatch>> GetPutData(const perf::Token& token) {
     return batches;
   }
 
-  std::shared_ptr<Schema> schema =
-      arrow::schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                     field("d", int64())});
+  // Like the schema of perf_server.cc
+  const int32_t ncolumns =
+      token.definition().num_columns() > 0 ? token.definition().num_columns() : 4;
+  FieldVector fields;
+  for (int32_t i = 0; i < ncolumns; ++i) {
+    std::string name = i < 26 ? std::string(1, static_cast<char>('a' + i))
+                              : "f" + std::to_string(i);
+    fields.push_back(field(std::move(name), int64()));
+  }
+  std::shared_ptr<Schema> schema = arrow::schema(std::move(fields));
 
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
+  // All columns are int64
+  const int64_t bytes_per_record = 8 * ncolumns;
 
   std::shared_ptr<ResizableBuffer> buffer;
   std::vector<std::shared_ptr<Array>> arrays;
 
   const int64_t total_records = token.definition().records_per_stream();
   const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
   for (int i = 0; i < ncolumns; ++i) {
     RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
                                        &buffer, static_cast<int32_t>(i) /* seed */));
@@ -277,14 +341,98 @@ arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
   return PerformanceResult{static_cast<int64_t>(batches.size()), num_records, num_bytes};
 }
 
+// Send each batch and wait for the server to echo it back
+arrow::Result<PerformanceResult> RunDoExchangeTest(FlightClient* client,
+                                                   const FlightCallOptions& call_options,
+                                                   const perf::Token& token,
+                                                   const FlightEndpoint& endpoint,
+                                                   PerformanceStats* stats) {
+  ARROW_ASSIGN_OR_RAISE(const auto batches, GetPutData(token));
+  ARROW_ASSIGN_OR_RAISE(auto exchange,
+                        client->DoExchange(call_options, FlightDescriptor{}));
+  RETURN_NOT_OK(exchange.writer->Begin(batches[0].batch->schema()));
+  StopWatch timer;
+  int64_t num_records = 0;
+  int64_t num_bytes = 0;
+  FlightStreamChunk chunk;
+  for (const auto& batch : batches) {
+    timer.Start();
+    RETURN_NOT_OK(exchange.writer->WriteRecordBatch(*batch.batch));
+    ARROW_ASSIGN_OR_RAISE(chunk, exchange.reader->Next());
+    stats->AddLatency(timer.Stop());
+    if (!chunk.data || chunk.data->num_rows() != batch.batch->num_rows()) {
+      return Status::Invalid("Batch was not echoed back");
+    }
+    num_records += batch.batch->num_rows();
+    num_bytes += batch.bytes;
+  }
+  RETURN_NOT_OK(exchange.writer->DoneWriting());
+  ARROW_ASSIGN_OR_RAISE(chunk, exchange.reader->Next());
+  if (chunk.data) {
+    return Status::Invalid("Too many batches echoed back");
+  }
+  RETURN_NOT_OK(exchange.writer->Close());
+  return PerformanceResult{static_cast<int64_t>(batches.size()), num_records, num_bytes};
+}
+
+#ifdef ARROW_FLIGHT_SQL
+// Run the query and read all of its endpoints; the latency is that of
+// the whole query
+arrow::Result<PerformanceResult> RunSqlQuery(sql::FlightSqlClient* sql_client,
+                                             const FlightCallOptions& call_options,
+                                             PerformanceStats* stats) {
+  StopWatch timer;
+  timer.Start();
+  ARROW_ASSIGN_OR_RAISE(auto info, sql_client->Execute(call_options, FLAGS_sql_query));
+  PerformanceResult result{0, 0, 0};
+  for (const auto& endpoint : info->endpoints()) {
+    ARROW_ASSIGN_OR_RAISE(auto reader, sql_client->DoGet(call_options, endpoint.ticket));
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto chunk, reader->Next());
+      if (!chunk.data) break;
+      ++result.num_batches;
+      result.num_records += chunk.data->num_rows();
+      for (const auto& column : chunk.data->columns()) {
+        result.num_bytes += util::TotalBufferSize(*column);
+      }
+    }
+  }
+  stats->AddLatency(timer.Stop());
+  return result;
+}
+
+// Run -num_streams queries concurrently
+Status DoSingleSqlRun(FlightClient* client, const FlightCallOptions& call_options,
+                      PerformanceStats* stats) {
+  // The client stays owned by the caller
+  sql::FlightSqlClient sql_client(
+      std::shared_ptr<FlightClient>(client, [](FlightClient*) {}));
+  ARROW_ASSIGN_OR_RAISE(auto pool, ThreadPool::Make(FLAGS_num_threads));
+  std::vector<Future<>> tasks;
+  for (int i = 0; i < FLAGS_num_streams; ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto task, pool->Submit([&]() -> Status {
+      ARROW_ASSIGN_OR_RAISE(auto perf, RunSqlQuery(&sql_client, call_options, stats));
+      stats->Update(perf.num_batches, perf.num_records, perf.num_bytes);
+      return Status::OK();
+    }));
+    tasks.push_back(std::move(task));
+  }
+  for (auto&& task : tasks) {
+    RETURN_NOT_OK(task.status());
+  }
+  return Status::OK();
+}
+#endif
+
 Status DoSinglePerfRun(FlightClient* client, const FlightClientOptions client_options,
-                       const FlightCallOptions& call_options, bool test_put,
+                       const FlightCallOptions& call_options, TestMethod method,
                        PerformanceStats* stats) {
   // schema not needed
   perf::Perf perf;
   perf.set_stream_count(FLAGS_num_streams);
   perf.set_records_per_stream(FLAGS_records_per_stream);
   perf.set_records_per_batch(FLAGS_records_per_batch);
+  perf.set_num_columns(FLAGS_num_columns);
 
   // Plan the query
   FlightDescriptor descriptor;
@@ -299,7 +447,9 @@ Status DoSinglePerfRun(FlightClient* client, const FlightClientOptions client_op
 
   int64_t start_total_records = stats->total_records;
 
-  auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
+  auto test_loop = method == TestMethod::kDoPut        ? &RunDoPutTest
+                   : method == TestMethod::kDoExchange ? &RunDoExchangeTest
+                                                       : &RunDoGetTest;
   auto ConsumeStream = [&client, &stats, &test_loop, &client_options,
                         &call_options](const FlightEndpoint& endpoint) {
     std::unique_ptr<FlightClient> local_client;
@@ -352,15 +502,92 @@ Status DoSinglePerfRun(FlightClient* client, const FlightClientOptions client_op
   return Status::OK();
 }
 
+Status WriteJsonResults(TestMethod method, const PerformanceStats& stats,
+                        uint64_t elapsed_nanos) {
+  const double time_elapsed =
+      static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
+  constexpr double kMegabyte = static_cast<double>(1 << 20);
+
+  rapidjson::StringBuffer buffer;
+  rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+  writer.StartObject();
+  writer.Key("method");
+  writer.String(TestMethodName(method));
+  writer.Key("transport");
+  writer.String(FLAGS_transport.c_str());
+  writer.Key("compression");
+  writer.String(FLAGS_compression.c_str());
+  writer.Key("num_perf_runs");
+  writer.Int(FLAGS_num_perf_runs);
+  writer.Key("num_streams");
+  writer.Int(FLAGS_num_streams);
+  writer.Key("num_threads");
+  writer.Int(FLAGS_num_threads);
+  if (method == TestMethod::kSql) {
+#ifdef ARROW_FLIGHT_SQL
+    writer.Key("sql_query");
+    writer.String(FLAGS_sql_query.c_str());
+#endif
+  } else {
+    writer.Key("records_per_stream");
+    writer.Int64(FLAGS_records_per_stream);
+    writer.Key("records_per_batch");
+    writer.Int(FLAGS_records_per_batch);
+    writer.Key("num_columns");
+    writer.Int(FLAGS_num_columns);
+  }
+  writer.Key("batches");
+  writer.Int64(stats.total_batches);
+  writer.Key("records");
+  writer.Int64(stats.total_records);
+  writer.Key("bytes");
+  writer.Int64(stats.total_bytes);
+  writer.Key("nanos");
+  writer.Uint64(elapsed_nanos);
+  writer.Key("mb_per_second");
+  writer.Double(static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed);
+  writer.Key("batches_per_second");
+  writer.Double(static_cast<double>(stats.total_batches) / time_elapsed);
+  writer.Key("latency_us");
+  writer.StartObject();
+  if (!stats.latencies.is_empty()) {
+    writer.Key("mean");
+    writer.Uint64(stats.mean_latency());
+    for (auto q : stats.quantiles) {
+      writer.Key(("p" + std::to_string(static_cast<int>(q * 100))).c_str());
+      writer.Uint64(stats.quantile_latency(q));
+    }
+    writer.Key("max");
+    writer.Uint64(stats.max_latency());
+  }
+  writer.EndObject();
+  writer.EndObject();
+
+  std::ofstream out(FLAGS_json_output);
+  out << buffer.GetString() << std::endl;
+  if (!out) {
+    return Status::IOError("Could not write results to ", FLAGS_json_output);
+  }
+  return Status::OK();
+}
+
 Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& client_options,
-                          const FlightCallOptions& call_options, bool test_put) {
+                          const FlightCallOptions& call_options, TestMethod method) {
   StopWatch timer;
   timer.Start();
+  const auto start_serialization_stats = transport::grpc::GetSerializationStats();
+  const bool test_put = method == TestMethod::kDoPut;
 
   PerformanceStats stats;
   for (int i = 0; i < FLAGS_num_perf_runs; ++i) {
-    RETURN_NOT_OK(
-        DoSinglePerfRun(client, client_options, call_options, test_put, &stats));
+    if (method == TestMethod::kSql) {
+#ifdef ARROW_FLIGHT_SQL
+      RETURN_NOT_OK(DoSingleSqlRun(client, call_options, &stats));
+#endif
+    } else {
+      RETURN_NOT_OK(
+          DoSinglePerfRun(client, client_options, call_options, method, &stats));
+    }
   }
 
   // Elapsed time in seconds
@@ -372,8 +599,9 @@ Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& clien
 
   std::cout << "Number of perf runs: " << FLAGS_num_perf_runs << std::endl;
   std::cout << "Number of concurrent gets/puts: " << FLAGS_num_threads << std::endl;
-  std::cout << "Batch size: " << stats.total_bytes / stats.total_batches << std::endl;
-  if (FLAGS_test_put) {
+  std::cout << "Batch size: "
+            << stats.total_bytes / std::max<int64_t>(stats.total_batches, 1) << std::endl;
+  if (test_put) {
     std::cout << "Batches written: " << stats.total_batches << std::endl;
     std::cout << "Bytes written: " << stats.total_bytes << std::endl;
   } else {
@@ -396,6 +624,34 @@ Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& clien
   }
   std::cout << "Latency max: " << stats.max_latency() << " us" << std::endl;
 
+  // Only counted by the gRPC transport, on the client side
+  const auto serialization_stats = transport::grpc::GetSerializationStats();
+  const int64_t num_messages =
+      test_put ? serialization_stats.num_messages_sent -
+                           start_serialization_stats.num_messages_sent
+                     : serialization_stats.num_messages_received -
+                           start_serialization_stats.num_messages_received;
+  const int64_t num_copies =
+      test_put ? serialization_stats.num_body_copies_sent -
+                           start_serialization_stats.num_body_copies_sent
+                     : serialization_stats.num_body_copies_received -
+                           start_serialization_stats.num_body_copies_received;
+  const int64_t bytes_copied =
+      test_put ? serialization_stats.body_bytes_copied_sent -
+                           start_serialization_stats.body_bytes_copied_sent
+                     : serialization_stats.body_bytes_copied_received -
+                           start_serialization_stats.body_bytes_copied_received;
+  if (num_messages > 0) {
+    const double copies_per_batch =
+        static_cast<double>(num_copies) / static_cast<double>(stats.total_batches);
+    std::cout << "Body copies per batch: " << copies_per_batch << " ("
+              << bytes_copied / std::max<int64_t>(num_copies, 1) << " bytes per copy)"
+              << std::endl;
+  }
+
+  if (!FLAGS_json_output.empty()) {
+    RETURN_NOT_OK(WriteJsonResults(method, stats, elapsed_nanos));
+  }
   return Status::OK();
 }
 
@@ -405,23 +661,28 @@ Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& clien
 int main(int argc, char** argv) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
 
-  std::cout << "Testing method: ";
-  if (FLAGS_test_put) {
-    std::cout << "DoPut";
-  } else {
-    std::cout << "DoGet";
+  const auto maybe_method = arrow::flight::GetTestMethod();
+  if (!maybe_method.ok()) {
+    std::cerr << maybe_method.status().ToString() << std::endl;
+    return EXIT_FAILURE;
   }
-  std::cout << std::endl;
-
-  arrow::flight::FlightCallOptions call_options;
-  if (!FLAGS_compression.empty()) {
-    if (!FLAGS_test_put) {
-      std::cerr << "Compression is only useful for Put test now, "
-                   "please append \"-test_put\" to command line"
+  const arrow::flight::TestMethod method = *maybe_method;
+  const bool test_put = method == arrow::flight::TestMethod::kDoPut;
+  const bool test_sql = method == arrow::flight::TestMethod::kSql;
+  std::cout << "Testing method: " << arrow::flight::TestMethodName(method) << std::endl;
+  if (test_sql) {
+#ifdef ARROW_FLIGHT_SQL
+    if (FLAGS_sql_query.empty() || FLAGS_server_host.empty()) {
+      std::cerr << "-test_method=sql requires -sql_query and the -server_host of a "
+                   "Flight SQL server"
                 << std::endl;
-      std::abort();
+      return EXIT_FAILURE;
     }
+#endif
+  }
 
+  arrow::flight::FlightCallOptions call_options;
+  if (!FLAGS_compression.empty()) {
     // "zstd"   -> name = "zstd", level = default
     // "zstd:7" -> name = "zstd", level = 7
     const size_t delim = FLAGS_compression.find(":");
@@ -440,10 +701,19 @@ int main(int argc, char** argv) {
     }
     std::cout << std::endl;
 
-    call_options.write_options.codec = std::move(codec);
+    if (method != arrow::flight::TestMethod::kDoGet && !test_sql) {
+      call_options.write_options.codec = std::move(codec);
+    }
+    if (!test_put) {
+      // Ask the server to compress the streams it sends
+      call_options.headers.emplace_back(arrow::flight::kCompressionHeader,
+                                        FLAGS_compression);
+    }
   }
-  if (!FLAGS_data_file.empty() && !FLAGS_test_put) {
-    std::cerr << "A data file can only be specified with \"-test_put\"" << std::endl;
+  if (!FLAGS_data_file.empty() && method != arrow::flight::TestMethod::kDoPut &&
+      method != arrow::flight::TestMethod::kDoExchange) {
+    std::cerr << "A data file can only be specified with DoPut or DoExchange"
+              << std::endl;
     return 1;
   }
 
@@ -488,7 +758,7 @@ int main(int argc, char** argv) {
         std::cout << "Using standalone TCP server" << std::endl;
       }
       if (server) {
-        if (FLAGS_cuda && FLAGS_test_put) {
+        if (FLAGS_cuda && test_put) {
           server_args.push_back("-cuda");
         }
         ABORT_NOT_OK(server->Start(server_args));
@@ -520,6 +790,21 @@ int main(int argc, char** argv) {
 #else
     std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
     return EXIT_FAILURE;
+#endif
+  } else if (FLAGS_transport == "shm") {
+#ifdef ARROW_FLIGHT_SHM
+    arrow::flight::transport::shm::InitializeFlightShm();
+    if (FLAGS_test_unix || !FLAGS_server_unix.empty()) {
+      std::cerr << "Transport does not support domain sockets: " << FLAGS_transport
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    ARROW_CHECK_OK(arrow::flight::Location::Parse("shm://" + FLAGS_server_host + ":" +
+                                                  std::to_string(FLAGS_server_port))
+                       .Value(&location));
+#else
+    std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
+    return EXIT_FAILURE;
 #endif
   } else {
     std::cerr << "Unknown transport: " << FLAGS_transport << std::endl;
@@ -528,7 +813,7 @@ int main(int argc, char** argv) {
 
   if (FLAGS_cuda) {
 #ifdef ARROW_CUDA
-    if (FLAGS_test_put && !server) {
+    if (test_put && !server) {
       std::cerr << "Warning: -cuda has no effect with -test_put" << std::endl;
       std::cerr << "Warning: (enable it on the server instead)" << std::endl;
     }
@@ -555,10 +840,13 @@ int main(int argc, char** argv) {
   }
 
   auto client = arrow::flight::FlightClient::Connect(location, options).ValueOrDie();
-  ABORT_NOT_OK(arrow::flight::WaitForReady(client.get(), call_options));
+  if (!test_sql) {
+    // Flight SQL servers do not answer the ping of the perf server
+    ABORT_NOT_OK(arrow::flight::WaitForReady(client.get(), call_options));
+  }
 
   arrow::Status s = arrow::flight::RunPerformanceTest(client.get(), options, call_options,
-                                                      FLAGS_test_put);
+                                                      method);
 
   if (server) {
     server->Stop();
@@ -26,12 +26,15 @@
 #include "arrow/flight/client_cookie_middleware.h"
 #include "arrow/flight/client_middleware.h"
 #include "arrow/flight/cookie_internal.h"
+#include "arrow/flight/server.h"
 #include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/test_util.h"
+#include "arrow/flight/transport/grpc/serialization_internal.h"
 #include "arrow/flight/transport/grpc/util_internal.h"
 #include "arrow/flight/types.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/string.h"
 
 // Include after Flight headers
@@ -727,6 +730,67 @@ TEST(GrpcTransport, FlightDataDeserialize) {
 #endif
 }
 
+TEST(GrpcTransport, FlightDataDeserializeSlices) {
+#ifndef _WIN32
+  pb::FlightData raw;
+  raw.set_data_header(std::string(100, 'h'));
+  raw.set_app_metadata("app");
+  raw.GetReflection()->MutableUnknownFields(&raw)->AddLengthDelimited(903, "foobar");
+  raw.set_data_body(std::string(1000, 'b'));
+  const auto serialized = raw.SerializeAsString();
+  // Unknown fields are serialized last
+  const auto body_offset = serialized.find(std::string(1000, 'b'));
+
+  // The body either lies within the last slice or spans the last two
+  for (size_t split : {body_offset, body_offset + 500}) {
+    ARROW_SCOPED_TRACE("split = ", split);
+    std::vector<grpc_slice> slices;
+    // Also split the header fields over single bytes
+    for (size_t i = 0; i < 20; ++i) {
+      slices.push_back(grpc_slice_from_copied_buffer(serialized.data() + i, 1));
+    }
+    slices.push_back(
+        grpc_slice_from_copied_buffer(serialized.data() + 20, split - 20));
+    slices.push_back(grpc_slice_from_copied_buffer(serialized.data() + split,
+                                                   serialized.size() - split));
+    grpc::ByteBuffer buffer(reinterpret_cast<const grpc::Slice*>(slices.data()),
+                            slices.size());
+    const auto last_slice_start = GRPC_SLICE_START_PTR(slices.back());
+    for (auto& slice : slices) {
+      grpc_slice_unref(slice);
+    }
+
+    const auto stats_before = flight::transport::grpc::GetSerializationStats();
+    flight::internal::FlightData out;
+    ASSERT_TRUE(flight::transport::grpc::FlightDataDeserialize(&buffer, &out).ok());
+    const auto stats_after = flight::transport::grpc::GetSerializationStats();
+    ASSERT_EQ(std::string(100, 'h'), out.metadata->ToString());
+    ASSERT_EQ("app", out.app_metadata->ToString());
+    ASSERT_EQ(std::string(1000, 'b'), out.body->ToString());
+
+    const int64_t num_copies =
+        stats_after.num_body_copies_received - stats_before.num_body_copies_received;
+    if (split == body_offset) {
+      // Referenced in place
+      ASSERT_EQ(last_slice_start, out.body->data());
+      ASSERT_EQ(0, num_copies);
+    } else {
+      ASSERT_EQ(1, num_copies);
+    }
+  }
+
+  // Truncated body
+  grpc_slice slice =
+      grpc_slice_from_copied_buffer(serialized.data(), serialized.size() - 1);
+  grpc::ByteBuffer buffer(reinterpret_cast<const grpc::Slice*>(&slice), /*nslices=*/1);
+  grpc_slice_unref(slice);
+  flight::internal::FlightData out;
+  ASSERT_FALSE(flight::transport::grpc::FlightDataDeserialize(&buffer, &out).ok());
+#else
+  GTEST_SKIP() << "Can't use Protobuf symbols on Windows";
+#endif
+}
+
 // ----------------------------------------------------------------------
 // Transport abstraction tests
 
@@ -785,5 +849,86 @@ TEST(TransportErrorHandling, ReconstructStatus) {
 
 // TODO: test TransportStatusDetail
 
+// ----------------------------------------------------------------------
+// Compression negotiation tests
+
+class HeadersCallContext : public ServerCallContext {
+ public:
+  explicit HeadersCallContext(std::string compression) : compression_(compression) {
+    headers_.emplace(kCompressionHeader, compression_);
+  }
+  HeadersCallContext() = default;
+
+  const std::string& peer_identity() const override { return peer_; }
+  const std::string& peer() const override { return peer_; }
+  void AddHeader(const std::string& key, const std::string& value) const override {}
+  void AddTrailer(const std::string& key, const std::string& value) const override {}
+  ServerMiddleware* GetMiddleware(const std::string& key) const override {
+    return nullptr;
+  }
+  bool is_cancelled() const override { return false; }
+  const CallHeaders& incoming_headers() const override { return headers_; }
+
+ private:
+  std::string peer_;
+  std::string compression_;
+  CallHeaders headers_;
+};
+
+TEST(CompressionNegotiation, NoHeader) {
+  auto options = ipc::IpcWriteOptions::Defaults();
+  options.use_threads = false;
+  ASSERT_OK_AND_ASSIGN(auto negotiated,
+                       NegotiateIpcWriteOptions(HeadersCallContext(), options));
+  ASSERT_EQ(negotiated.codec, nullptr);
+  ASSERT_FALSE(negotiated.use_threads);
+  ASSERT_FALSE(negotiated.min_space_savings.has_value());
+}
+
+TEST(CompressionNegotiation, None) {
+  if (!util::Codec::IsAvailable(Compression::LZ4_FRAME)) {
+    GTEST_SKIP() << "Test requires LZ4 support";
+  }
+  auto options = ipc::IpcWriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(options.codec, util::Codec::Create(Compression::LZ4_FRAME));
+  ASSERT_OK_AND_ASSIGN(auto negotiated,
+                       NegotiateIpcWriteOptions(HeadersCallContext("none"), options));
+  ASSERT_EQ(negotiated.codec, nullptr);
+  // Unknown codecs are skipped
+  ASSERT_OK_AND_ASSIGN(negotiated, NegotiateIpcWriteOptions(
+                                       HeadersCallContext("snappy, foo, none"), options));
+  ASSERT_EQ(negotiated.codec, nullptr);
+  // No acceptable codec: keep the server's choice
+  ASSERT_OK_AND_ASSIGN(negotiated,
+                       NegotiateIpcWriteOptions(HeadersCallContext("gzip"), options));
+  ASSERT_EQ(negotiated.codec, options.codec);
+}
+
+TEST(CompressionNegotiation, Codecs) {
+  if (!util::Codec::IsAvailable(Compression::ZSTD)) {
+    GTEST_SKIP() << "Test requires ZSTD support";
+  }
+  auto options = ipc::IpcWriteOptions::Defaults();
+  options.use_threads = false;
+  ASSERT_OK_AND_ASSIGN(
+      auto negotiated,
+      NegotiateIpcWriteOptions(HeadersCallContext("brotli,zstd:7,lz4"), options));
+  ASSERT_NE(negotiated.codec, nullptr);
+  ASSERT_EQ(negotiated.codec->compression_type(), Compression::ZSTD);
+  ASSERT_EQ(negotiated.codec->compression_level(), 7);
+  ASSERT_TRUE(negotiated.use_threads);
+  ASSERT_EQ(negotiated.min_space_savings, kDefaultMinSpaceSavings);
+
+  // The server's space savings threshold prevails
+  options.min_space_savings = 0.5;
+  ASSERT_OK_AND_ASSIGN(negotiated,
+                       NegotiateIpcWriteOptions(HeadersCallContext("zstd"), options));
+  ASSERT_EQ(negotiated.min_space_savings, 0.5);
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Invalid compression level"),
+      NegotiateIpcWriteOptions(HeadersCallContext("zstd:high"), options));
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -1137,6 +1137,118 @@ TEST_F(TestFlightClient, Close) {
                                   client_->ListFlights());
 }
 
+TEST_F(TestFlightClient, MultiEndpointReader) {
+  ASSERT_OK_AND_ASSIGN(auto location, Location::ForGrpcTcp("localhost", server_->port()));
+  const Ticket ticket{"ticket-ints-1"};
+  std::vector<FlightEndpoint> endpoints = {
+      {ticket, {}, std::nullopt, ""},
+      {ticket, {location}, std::nullopt, ""},
+      {ticket, {Location::ReuseConnection()}, std::nullopt, ""},
+      {ticket, {location}, std::nullopt, ""},
+      {ticket, {location}, std::nullopt, ""},
+  };
+  auto schema = ExampleIntSchema();
+  auto info = MakeFlightInfo(*schema, FlightDescriptor::Command(""), endpoints, -1, -1,
+                             false, "");
+
+  RecordBatchVector endpoint_batches;
+  ASSERT_OK(ExampleIntBatches(&endpoint_batches));
+  RecordBatchVector expected_batches;
+  for (size_t i = 0; i < endpoints.size(); ++i) {
+    expected_batches.insert(expected_batches.end(), endpoint_batches.begin(),
+                            endpoint_batches.end());
+  }
+
+  for (bool ordered : {false, true}) {
+    // A budget of a single byte lets one batch through at a time
+    for (int64_t max_buffered_bytes : {int64_t{0}, int64_t{1}}) {
+      ARROW_SCOPED_TRACE("ordered = ", ordered,
+                         ", max_buffered_bytes = ", max_buffered_bytes);
+      auto options = MultiEndpointReadOptions::Defaults();
+      options.max_concurrent_streams = 2;
+      options.max_buffered_bytes = max_buffered_bytes;
+      options.ordered = ordered;
+      ASSERT_OK_AND_ASSIGN(auto reader,
+                           MakeMultiEndpointReader(client_.get(), info, options));
+      AssertSchemaEqual(*schema, *reader->schema());
+      ASSERT_OK_AND_ASSIGN(auto batches, reader->ToRecordBatches());
+      ASSERT_EQ(expected_batches.size(), batches.size());
+      if (ordered) {
+        for (size_t i = 0; i < batches.size(); ++i) {
+          AssertBatchesEqual(*expected_batches[i], *batches[i]);
+        }
+      } else {
+        // The example batches all have different lengths
+        std::vector<int> num_seen(endpoint_batches.size(), 0);
+        for (const auto& batch : batches) {
+          const int64_t j = batch->num_rows() - endpoint_batches[0]->num_rows();
+          ASSERT_GE(j, 0);
+          ASSERT_LT(j, static_cast<int64_t>(endpoint_batches.size()));
+          AssertBatchesEqual(*endpoint_batches[j], *batch);
+          ++num_seen[j];
+        }
+        for (int count : num_seen) {
+          ASSERT_EQ(static_cast<int>(endpoints.size()), count);
+        }
+      }
+      ASSERT_OK(reader->Close());
+    }
+  }
+}
+
+TEST_F(TestFlightClient, MultiEndpointReaderError) {
+  auto schema = ExampleIntSchema();
+  std::vector<FlightEndpoint> endpoints = {
+      {Ticket{"ticket-ints-1"}, {}, std::nullopt, ""},
+      {Ticket{"ARROW-5095-fail"}, {}, std::nullopt, ""},
+      {Ticket{"ticket-ints-1"}, {}, std::nullopt, ""},
+  };
+  auto info = MakeFlightInfo(*schema, FlightDescriptor::Command(""), endpoints, -1, -1,
+                             false, "");
+  for (bool ordered : {false, true}) {
+    ARROW_SCOPED_TRACE("ordered = ", ordered);
+    auto options = MultiEndpointReadOptions::Defaults();
+    options.ordered = ordered;
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         MakeMultiEndpointReader(client_.get(), info, options));
+    EXPECT_RAISES_WITH_MESSAGE_THAT(UnknownError,
+                                    ::testing::HasSubstr("Server-side error"),
+                                    reader->ToRecordBatches());
+    ASSERT_OK(reader->Close());
+  }
+
+  // No location can be connected to
+  endpoints = {{Ticket{"ticket-ints-1"},
+                {*Location::Parse("unknown-scheme://localhost:1")},
+                std::nullopt,
+                ""}};
+  info = MakeFlightInfo(*schema, FlightDescriptor::Command(""), endpoints, -1, -1, false,
+                        "");
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeMultiEndpointReader(client_.get(), info));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      KeyError, ::testing::HasSubstr("Could not connect to any location"),
+      reader->ToRecordBatches());
+}
+
+TEST_F(TestFlightClient, MultiEndpointReaderClose) {
+  auto schema = ExampleIntSchema();
+  const FlightEndpoint endpoint{Ticket{"ticket-ints-1"}, {}, std::nullopt, ""};
+  std::vector<FlightEndpoint> endpoints(8, endpoint);
+  auto info = MakeFlightInfo(*schema, FlightDescriptor::Command(""), endpoints, -1, -1,
+                             false, "");
+  auto options = MultiEndpointReadOptions::Defaults();
+  options.max_buffered_bytes = 1;
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       MakeMultiEndpointReader(client_.get(), info, options));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_NE(nullptr, batch);
+  // Closing stops the streams still waiting for the budget
+  ASSERT_OK(reader->Close());
+  ASSERT_OK(reader->Close());
+  ASSERT_RAISES(Invalid, reader->ReadNext(&batch));
+}
+
 TEST_F(TestAuthHandler, PassAuthenticatedCalls) {
   ASSERT_OK(client_->Authenticate(
       {}, std::make_unique<TestClientAuthHandler>("user", "p4ssw0rd")));
@@ -0,0 +1,313 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/multi_endpoint_reader.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/ipc/dictionary.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/macros.h"
+
+#include "arrow/flight/types.h"
+
+namespace arrow {
+namespace flight {
+
+namespace {
+
+// A client borrowed from the pool for reading one endpoint
+struct ClientLease {
+  FlightClient* client = nullptr;
+  // Set if the client came from the pool and must go back to it
+  std::unique_ptr<FlightClient> owned;
+  std::string location;
+};
+
+class MultiEndpointReader : public RecordBatchReader {
+ public:
+  MultiEndpointReader(FlightClient* client, std::vector<FlightEndpoint> endpoints,
+                      std::shared_ptr<Schema> schema, MultiEndpointReadOptions options)
+      : client_(client),
+        endpoints_(std::move(endpoints)),
+        schema_(std::move(schema)),
+        options_(std::move(options)),
+        endpoint_batches_(options_.ordered ? endpoints_.size() : 0),
+        endpoint_done_(endpoints_.size(), false),
+        active_streams_(endpoints_.size(), nullptr) {}
+
+  ~MultiEndpointReader() override { ARROW_UNUSED(Close()); }
+
+  void Start() {
+    const int num_workers = static_cast<int>(std::min<size_t>(
+        std::max(options_.max_concurrent_streams, 1), endpoints_.size()));
+    for (int i = 0; i < num_workers; ++i) {
+      workers_.emplace_back([this] { WorkerLoop(); });
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      if (!status_.ok()) {
+        return status_;
+      }
+      if (closed_) {
+        return Status::Invalid("Reader is closed");
+      }
+      std::deque<std::shared_ptr<RecordBatch>>* batches = &unordered_batches_;
+      bool exhausted = num_done_ == endpoints_.size();
+      if (options_.ordered) {
+        while (next_to_yield_ < endpoints_.size() &&
+               endpoint_done_[next_to_yield_] &&
+               endpoint_batches_[next_to_yield_].empty()) {
+          // The stream next in line may be waiting for the budget
+          ++next_to_yield_;
+          cv_.notify_all();
+        }
+        exhausted = next_to_yield_ == endpoints_.size();
+        if (!exhausted) {
+          batches = &endpoint_batches_[next_to_yield_];
+        }
+      }
+      if (!batches->empty()) {
+        *out = std::move(batches->front());
+        batches->pop_front();
+        buffered_bytes_ -= util::TotalBufferSize(**out);
+        cv_.notify_all();
+        return Status::OK();
+      }
+      if (exhausted) {
+        *out = nullptr;
+        return Status::OK();
+      }
+      cv_.wait(lock);
+    }
+  }
+
+  Status Close() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      for (FlightStreamReader* stream : active_streams_) {
+        if (stream != nullptr) {
+          stream->Cancel();
+        }
+      }
+      cv_.notify_all();
+    }
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+    workers_.clear();
+
+    Status st;
+    for (auto& entry : idle_clients_) {
+      for (auto& client : entry.second) {
+        st &= client->Close();
+      }
+    }
+    idle_clients_.clear();
+    return st;
+  }
+
+ private:
+  void WorkerLoop() {
+    while (true) {
+      size_t index;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_ || !status_.ok() || next_to_start_ == endpoints_.size()) {
+          return;
+        }
+        index = next_to_start_++;
+      }
+      Status st = ReadEndpoint(index);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!st.ok() && status_.ok() && !closed_) {
+        status_ = std::move(st);
+      }
+      endpoint_done_[index] = true;
+      ++num_done_;
+      cv_.notify_all();
+    }
+  }
+
+  Status ReadEndpoint(size_t index) {
+    const FlightEndpoint& endpoint = endpoints_[index];
+    ARROW_ASSIGN_OR_RAISE(ClientLease lease, AcquireClient(endpoint));
+    auto maybe_stream = lease.client->DoGet(options_.call_options, endpoint.ticket);
+    Status st = maybe_stream.status();
+    if (st.ok()) {
+      std::unique_ptr<FlightStreamReader> stream = maybe_stream.MoveValueUnsafe();
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_) {
+          stream->Cancel();
+        }
+        active_streams_[index] = stream.get();
+      }
+      st = ConsumeStream(index, stream.get());
+      std::lock_guard<std::mutex> lock(mutex_);
+      active_streams_[index] = nullptr;
+    }
+    ReleaseClient(std::move(lease));
+    return st;
+  }
+
+  Status ConsumeStream(size_t index, FlightStreamReader* stream) {
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(FlightStreamChunk chunk, stream->Next());
+      if (chunk.data == nullptr) {
+        return Status::OK();
+      }
+      const int64_t size = util::TotalBufferSize(*chunk.data);
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [&] { return closed_ || !status_.ok() || CanBuffer(index, size); });
+      if (closed_ || !status_.ok()) {
+        // Let the reader report the first error, or nothing if it was closed
+        return Status::OK();
+      }
+      buffered_bytes_ += size;
+      if (options_.ordered) {
+        endpoint_batches_[index].push_back(std::move(chunk.data));
+      } else {
+        unordered_batches_.push_back(std::move(chunk.data));
+      }
+      cv_.notify_all();
+    }
+  }
+
+  // Whether a batch of `size` bytes from endpoint `index` fits in the budget
+  bool CanBuffer(size_t index, int64_t size) const {
+    if (options_.max_buffered_bytes <= 0 || buffered_bytes_ == 0 ||
+        buffered_bytes_ + size <= options_.max_buffered_bytes) {
+      return true;
+    }
+    // The consumer waits on the endpoint next in line, which must not wait in turn
+    return options_.ordered && index == next_to_yield_;
+  }
+
+  arrow::Result<ClientLease> AcquireClient(const FlightEndpoint& endpoint) {
+    ClientLease lease;
+    if (endpoint.locations.empty()) {
+      lease.client = client_;
+      return lease;
+    }
+    for (const Location& location : endpoint.locations) {
+      if (location.Equals(Location::ReuseConnection())) {
+        lease.client = client_;
+        return lease;
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const Location& location : endpoint.locations) {
+        auto it = idle_clients_.find(location.ToString());
+        if (it != idle_clients_.end() && !it->second.empty()) {
+          lease.owned = std::move(it->second.back());
+          it->second.pop_back();
+          lease.client = lease.owned.get();
+          lease.location = it->first;
+          return lease;
+        }
+      }
+    }
+
+    // Connect to the first location that accepts
+    Status st;
+    for (const Location& location : endpoint.locations) {
+      auto maybe_client = FlightClient::Connect(location, options_.client_options);
+      if (maybe_client.ok()) {
+        lease.owned = maybe_client.MoveValueUnsafe();
+        lease.client = lease.owned.get();
+        lease.location = location.ToString();
+        return lease;
+      }
+      st = maybe_client.status();
+    }
+    return st.WithMessage("Could not connect to any location of endpoint ",
+                          endpoint.ToString(), ": ", st.message());
+  }
+
+  void ReleaseClient(ClientLease lease) {
+    if (lease.owned != nullptr) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      idle_clients_[lease.location].push_back(std::move(lease.owned));
+    }
+  }
+
+  FlightClient* client_;
+  const std::vector<FlightEndpoint> endpoints_;
+  const std::shared_ptr<Schema> schema_;
+  const MultiEndpointReadOptions options_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<std::thread> workers_;
+  // Idle connections by location
+  std::unordered_map<std::string, std::vector<std::unique_ptr<FlightClient>>>
+      idle_clients_;
+
+  // The batches waiting to be yielded, by endpoint if ordered
+  std::vector<std::deque<std::shared_ptr<RecordBatch>>> endpoint_batches_;
+  std::deque<std::shared_ptr<RecordBatch>> unordered_batches_;
+  int64_t buffered_bytes_ = 0;
+
+  std::vector<bool> endpoint_done_;
+  std::vector<FlightStreamReader*> active_streams_;
+  size_t next_to_start_ = 0;
+  size_t next_to_yield_ = 0;
+  size_t num_done_ = 0;
+  Status status_;
+  bool closed_ = false;
+};
+
+}  // namespace
+
+MultiEndpointReadOptions MultiEndpointReadOptions::Defaults() {
+  return MultiEndpointReadOptions();
+}
+
+arrow::Result<std::shared_ptr<RecordBatchReader>> MakeMultiEndpointReader(
+    FlightClient* client, const FlightInfo& info,
+    const MultiEndpointReadOptions& options) {
+  ipc::DictionaryMemo dictionary_memo;
+  ARROW_ASSIGN_OR_RAISE(auto schema, info.GetSchema(&dictionary_memo));
+  auto reader = std::make_shared<MultiEndpointReader>(client, info.endpoints(),
+                                                      std::move(schema), options);
+  reader->Start();
+  return reader;
+}
+
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Reading all the endpoints of a flight concurrently
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/flight/client.h"
+#include "arrow/flight/type_fwd.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/result.h"
+
+namespace arrow {
+
+class RecordBatchReader;
+
+namespace flight {
+
+/// \brief Options for reading the endpoints of a FlightInfo concurrently.
+struct ARROW_FLIGHT_EXPORT MultiEndpointReadOptions {
+  /// \brief The options passed to each DoGet call.
+  FlightCallOptions call_options;
+
+  /// \brief The options used to connect to the endpoint locations.
+  FlightClientOptions client_options = FlightClientOptions::Defaults();
+
+  /// \brief The maximum number of endpoints read at the same time.
+  ///
+  /// This is also the maximum number of connections opened to each location.
+  int max_concurrent_streams = 4;
+
+  /// \brief The number of bytes of decoded batches that may be buffered
+  ///     before the streams stop reading.
+  ///
+  /// Each stream may go over the budget by a single batch, and the stream
+  /// that is next in line is never blocked. Disabled if not positive.
+  int64_t max_buffered_bytes = 64 << 20;
+
+  /// \brief Whether to yield the batches in endpoint order.
+  ///
+  /// Otherwise the batches are yielded as soon as they arrive; the batches
+  /// of each endpoint are still yielded in order.
+  bool ordered = false;
+
+  /// \brief Get default options.
+  static MultiEndpointReadOptions Defaults();
+};
+
+/// \brief Read all the endpoints of a flight concurrently.
+///
+/// The endpoints are fetched with DoGet in the order of the FlightInfo, at
+/// most max_concurrent_streams at a time. Endpoints without a location, or
+/// with the ReuseConnection() location, are read with `client`; for the
+/// others, one of the given locations is connected to and the connection
+/// is kept in a pool for the following endpoints of the same location.
+///
+/// The returned reader can be used as an Acero source. Closing it cancels
+/// the streams still in progress. The first error met by any stream is
+/// returned by the reader, after which the remaining streams are abandoned.
+///
+/// \param[in] client The client used for endpoints without a location; it
+///     must outlive the reader
+/// \param[in] info The flight to read
+/// \param[in] options Per-call and concurrency options
+/// \return Arrow result with a reader over the batches of all the endpoints
+ARROW_FLIGHT_EXPORT
+arrow::Result<std::shared_ptr<RecordBatchReader>> MakeMultiEndpointReader(
+    FlightClient* client, const FlightInfo& info,
+    const MultiEndpointReadOptions& options = MultiEndpointReadOptions::Defaults());
+
+}  // namespace flight
+}  // namespace arrow
@@ -47,6 +47,9 @@
 #ifdef ARROW_WITH_UCX
 #  include "arrow/flight/transport/ucx/ucx.h"
 #endif
+#ifdef ARROW_FLIGHT_SHM
+#  include "arrow/flight/transport/shm/shm.h"
+#endif
 
 DEFINE_bool(cuda, false, "Allocate results in CUDA memory");
 DEFINE_string(transport, "grpc",
@@ -54,6 +57,9 @@ DEFINE_string(transport, "grpc",
 #ifdef ARROW_WITH_UCX
               ", \"ucx\""
 #endif  // ARROW_WITH_UCX
+#ifdef ARROW_FLIGHT_SHM
+              ", \"shm\""
+#endif  // ARROW_FLIGHT_SHM
               ".");
 DEFINE_string(server_host, "localhost", "Host where the server is running on");
 DEFINE_int32(port, 31337, "Server port to listen on");
@@ -79,7 +85,8 @@ namespace flight {
 class PerfDataStream : public FlightDataStream {
  public:
   PerfDataStream(bool verify, const int64_t start, const int64_t total_records,
-                 const std::shared_ptr<Schema>& schema, const ArrayVector& arrays)
+                 const std::shared_ptr<Schema>& schema, const ArrayVector& arrays,
+                 const ipc::IpcWriteOptions& ipc_options)
       : start_(start),
         verify_(verify),
         batch_length_(arrays[0]->length()),
@@ -87,6 +94,7 @@ class PerfDataStream : public FlightDataStream {
         records_sent_(0),
         schema_(schema),
         mapper_(*schema),
+        ipc_options_(ipc_options),
         arrays_(arrays) {
     batch_ = RecordBatch::Make(schema, batch_length_, arrays_);
   }
@@ -143,13 +151,26 @@ class PerfDataStream : public FlightDataStream {
   ArrayVector arrays_;
 };
 
+// The int64 columns "a", "b", ... of a perf stream
+std::shared_ptr<Schema> GetPerfSchema(const perf::Perf& perf) {
+  const int32_t ncolumns = perf.num_columns() > 0 ? perf.num_columns() : 4;
+  FieldVector fields;
+  for (int32_t i = 0; i < ncolumns; ++i) {
+    std::string name = i < 26 ? std::string(1, static_cast<char>('a' + i))
+                              : "f" + std::to_string(i);
+    fields.push_back(field(std::move(name), int64()));
+  }
+  return schema(std::move(fields));
+}
+
 Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& schema,
-                      bool use_verifier, std::unique_ptr<FlightDataStream>* data_stream) {
+                      bool use_verifier, const ipc::IpcWriteOptions& ipc_options,
+                      std::unique_ptr<FlightDataStream>* data_stream) {
   std::shared_ptr<ResizableBuffer> buffer;
   std::vector<std::shared_ptr<Array>> arrays;
 
   const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
+  const int32_t ncolumns = schema->num_fields();
   for (int i = 0; i < ncolumns; ++i) {
     RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
                                        &buffer, static_cast<int32_t>(i) /* seed */));
@@ -159,16 +180,14 @@ Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& s
 
   *data_stream = std::unique_ptr<FlightDataStream>(
       new PerfDataStream(use_verifier, token.start(),
-                         token.definition().records_per_stream(), schema, arrays));
+                         token.definition().records_per_stream(), schema, arrays,
+                         ipc_options));
   return Status::OK();
 }
 
 class FlightPerfServer : public FlightServerBase {
  public:
-  FlightPerfServer() : location_() {
-    perf_schema_ = schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                           field("d", int64())});
-  }
+  FlightPerfServer() : location_() {}
 
   void SetLocation(Location location) { location_ = location; }
 
@@ -195,8 +214,8 @@ class FlightPerfServer : public FlightServerBase {
     uint64_t total_records =
         perf_request.stream_count() * perf_request.records_per_stream();
 
-    *info = std::make_unique<FlightInfo>(
-        MakeFlightInfo(*perf_schema_, request, endpoints, total_records, -1, false, ""));
+    *info = std::make_unique<FlightInfo>(MakeFlightInfo(
+        *GetPerfSchema(perf_request), request, endpoints, total_records, -1, false, ""));
     return Status::OK();
   }
 
@@ -204,8 +223,13 @@ class FlightPerfServer : public FlightServerBase {
                std::unique_ptr<FlightDataStream>* data_stream) override {
     perf::Token token;
     CHECK_PARSE(token.ParseFromString(request.ticket));
+    // Compress if the client asked for it
+    ARROW_ASSIGN_OR_RAISE(
+        auto ipc_options,
+        NegotiateIpcWriteOptions(context, ipc::IpcWriteOptions::Defaults()));
     // This must also be set in flight_benchmark.cc
-    return GetPerfBatches(token, perf_schema_, /*verify=*/false, data_stream);
+    return GetPerfBatches(token, GetPerfSchema(token.definition()), /*verify=*/false,
+                          ipc_options, data_stream);
   }
 
   Status DoPut(const ServerCallContext& context,
@@ -222,6 +246,27 @@ class FlightPerfServer : public FlightServerBase {
     return Status::OK();
   }
 
+  // Echo the batches back, to measure round trips
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    ARROW_ASSIGN_OR_RAISE(
+        auto ipc_options,
+        NegotiateIpcWriteOptions(context, ipc::IpcWriteOptions::Defaults()));
+    FlightStreamChunk chunk;
+    bool started = false;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(chunk, reader->Next());
+      if (!chunk.data) break;
+      if (!started) {
+        RETURN_NOT_OK(writer->Begin(chunk.data->schema(), ipc_options));
+        started = true;
+      }
+      RETURN_NOT_OK(writer->WriteRecordBatch(*chunk.data));
+    }
+    return Status::OK();
+  }
+
   Status DoAction(const ServerCallContext& context, const Action& action,
                   std::unique_ptr<ResultStream>* result) override {
     if (action.type == "ping") {
@@ -234,7 +279,6 @@ class FlightPerfServer : public FlightServerBase {
 
  private:
   Location location_;
-  std::shared_ptr<Schema> perf_schema_;
 };
 
 }  // namespace flight
@@ -302,6 +346,26 @@ int main(int argc, char** argv) {
 #else
     std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
     return EXIT_FAILURE;
+#endif
+  } else if (FLAGS_transport == "shm") {
+#ifdef ARROW_FLIGHT_SHM
+    arrow::flight::transport::shm::InitializeFlightShm();
+    if (!FLAGS_cert_file.empty() || !FLAGS_key_file.empty()) {
+      std::cerr << "Transport does not support TLS: " << FLAGS_transport << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (!FLAGS_server_unix.empty()) {
+      std::cerr << "Transport does not support domain sockets: " << FLAGS_transport
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    ARROW_CHECK_OK(arrow::flight::Location::Parse("shm://" + FLAGS_server_host + ":" +
+                                                  std::to_string(FLAGS_port))
+                       .Value(&bind_location));
+    connect_location = bind_location;
+#else
+    std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
+    return EXIT_FAILURE;
 #endif
   } else {
     std::cerr << "Unknown transport: " << FLAGS_transport << std::endl;
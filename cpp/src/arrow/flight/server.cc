@@ -39,8 +39,11 @@
 #include "arrow/flight/types.h"
 #include "arrow/status.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/string.h"
 #include "arrow/util/uri.h"
+#include "arrow/util/value_parsing.h"
 
 namespace arrow {
 namespace flight {
@@ -270,6 +273,50 @@ Status FlightServerBase::GetSchema(const ServerCallContext& context,
   return Status::NotImplemented("NYI");
 }
 
+// ----------------------------------------------------------------------
+// Compression negotiation
+
+arrow::Result<ipc::IpcWriteOptions> NegotiateIpcWriteOptions(
+    const ServerCallContext& context, const ipc::IpcWriteOptions& options) {
+  const auto& headers = context.incoming_headers();
+  auto it = headers.find(kCompressionHeader);
+  if (it == headers.end()) return options;
+
+  for (auto accepted : ::arrow::internal::SplitString(it->second, ',')) {
+    const std::string entry = ::arrow::internal::TrimString(std::string(accepted));
+    const auto colon = entry.find(':');
+    const std::string name = entry.substr(0, colon);
+    int32_t level = util::kUseDefaultCompressionLevel;
+    if (colon != std::string::npos &&
+        !::arrow::internal::ParseValue<Int32Type>(entry.data() + colon + 1,
+                                                  entry.size() - colon - 1, &level)) {
+      return Status::Invalid("Invalid compression level in ", kCompressionHeader,
+                             " header: ", entry);
+    }
+
+    ipc::IpcWriteOptions negotiated = options;
+    if (name == "none") {
+      negotiated.codec = nullptr;
+      return negotiated;
+    }
+    auto maybe_type = util::Codec::GetCompressionType(name);
+    // Skip the codecs that IPC or this build do not support
+    if (!maybe_type.ok() ||
+        (*maybe_type != Compression::LZ4_FRAME && *maybe_type != Compression::ZSTD) ||
+        !util::Codec::IsAvailable(*maybe_type)) {
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(negotiated.codec, util::Codec::Create(*maybe_type, level));
+    // Compress the buffers of a batch in parallel
+    negotiated.use_threads = true;
+    if (!negotiated.min_space_savings.has_value()) {
+      negotiated.min_space_savings = kDefaultMinSpaceSavings;
+    }
+    return negotiated;
+  }
+  return options;
+}
+
 // ----------------------------------------------------------------------
 // Implement RecordBatchStream
 
@@ -141,6 +141,31 @@ class ARROW_FLIGHT_EXPORT ServerCallContext {
   virtual const CallHeaders& incoming_headers() const = 0;
 };
 
+/// \brief Adjust the IPC options of a stream sent to a client to the
+///   compression it asked for through kCompressionHeader.
+///
+/// The first codec of the client's list that is available in this
+/// build is used; "none" disables compression. If the client did not
+/// send the header, or accepts none of the available codecs, the
+/// server's options are returned unchanged.
+///
+/// When a codec is picked, the body buffers of each batch are
+/// compressed in parallel, and buffers that shrink by less than
+/// kDefaultMinSpaceSavings are sent uncompressed unless the server
+/// options set min_space_savings.
+///
+/// \param[in] context The call context
+/// \param[in] options The server's IPC options for the stream
+/// \return The options to pass to RecordBatchStream, or Invalid if
+///   the header is malformed
+ARROW_FLIGHT_EXPORT
+arrow::Result<ipc::IpcWriteOptions> NegotiateIpcWriteOptions(
+    const ServerCallContext& context, const ipc::IpcWriteOptions& options);
+
+/// \brief The space savings below which NegotiateIpcWriteOptions()
+///   sends buffers uncompressed.
+static constexpr double kDefaultMinSpaceSavings = 0.1;
+
 class ARROW_FLIGHT_EXPORT FlightServerOptions {
  public:
   explicit FlightServerOptions(const Location& location_);
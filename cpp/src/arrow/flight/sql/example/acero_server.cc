@@ -73,17 +73,31 @@ class AceroFlightSqlServer : public FlightSqlServerBase {
   arrow::Result<std::unique_ptr<FlightInfo>> GetFlightInfoPreparedStatement(
       const ServerCallContext& context, const PreparedStatementQuery& command,
       const FlightDescriptor& descriptor) override {
-    std::shared_ptr<arrow::Buffer> plan;
-    {
-      std::lock_guard<std::mutex> guard(mutex_);
-      auto it = prepared_.find(command.prepared_statement_handle);
-      if (it == prepared_.end()) {
-        return Status::KeyError("Prepared statement not found");
-      }
-      plan = it->second;
-    }
+    ARROW_ASSIGN_OR_RAISE(auto prepared,
+                          GetPreparedStatement(command.prepared_statement_handle));
+    // The command doubles as the ticket, so that DoGetPreparedStatement
+    // runs the plan compiled when the statement was prepared
+    std::vector<FlightEndpoint> endpoints{
+        FlightEndpoint{Ticket{descriptor.cmd}, /*locations=*/{},
+                       /*expiration_time=*/std::nullopt, ""}};
+    ARROW_ASSIGN_OR_RAISE(
+        auto info,
+        FlightInfo::Make(*prepared->schema, descriptor, std::move(endpoints),
+                         /*total_records=*/-1, /*total_bytes=*/-1, /*ordered=*/false));
+    return std::make_unique<FlightInfo>(std::move(info));
+  }
+
+  arrow::Result<std::unique_ptr<FlightDataStream>> DoGetPreparedStatement(
+      const ServerCallContext& context, const PreparedStatementQuery& command) override {
+    ARROW_ASSIGN_OR_RAISE(auto prepared,
+                          GetPreparedStatement(command.prepared_statement_handle));
+
+    ARROW_LOG(INFO) << "DoGetPreparedStatement: executing plan "
+                    << acero::DeclarationToString(prepared->declaration)
+                           .ValueOr("Invalid plan");
 
-    return MakeFlightInfo(plan->ToString(), descriptor, Schema({}));
+    ARROW_ASSIGN_OR_RAISE(auto reader, acero::DeclarationToReader(prepared->declaration));
+    return std::make_unique<RecordBatchStream>(std::move(reader));
   }
 
   arrow::Result<std::unique_ptr<FlightDataStream>> DoGetStatement(
@@ -126,21 +140,24 @@ class AceroFlightSqlServer : public FlightSqlServerBase {
     if (!request.transaction_id.empty()) {
       return Status::NotImplemented("Transactions are unsupported");
     }
-    // There's not any real point to precompiling the plan, since the
-    // consumer has to be provided here. So this is effectively the
-    // same as a non-prepared plan.
-    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<arrow::Schema> schema,
-                          GetPlanSchema(request.plan.plan));
+    // Deserialize the plan once: each execution only builds an ExecPlan
+    // from the declaration.
+    auto prepared = std::make_shared<PreparedPlan>();
+    std::shared_ptr<Buffer> plan_buf = Buffer::FromString(request.plan.plan);
+    ARROW_ASSIGN_OR_RAISE(engine::PlanInfo plan, engine::DeserializePlan(*plan_buf));
+    prepared->declaration = std::move(plan.root.declaration);
+    ARROW_ASSIGN_OR_RAISE(prepared->schema,
+                          acero::DeclarationToSchema(prepared->declaration));
 
     std::string handle;
     {
       std::lock_guard<std::mutex> guard(mutex_);
       handle = std::to_string(counter_++);
-      prepared_[handle] = Buffer::FromString(request.plan.plan);
+      prepared_[handle] = prepared;
     }
 
     return ActionCreatePreparedStatementResult{
-        /*dataset_schema=*/std::move(schema),
+        /*dataset_schema=*/prepared->schema,
         /*parameter_schema=*/nullptr,
         handle,
     };
@@ -155,6 +172,22 @@ class AceroFlightSqlServer : public FlightSqlServerBase {
   }
 
  private:
+  /// \brief A prepared Substrait plan, deserialized once.
+  struct PreparedPlan {
+    acero::Declaration declaration;
+    std::shared_ptr<arrow::Schema> schema;
+  };
+
+  arrow::Result<std::shared_ptr<PreparedPlan>> GetPreparedStatement(
+      const std::string& handle) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = prepared_.find(handle);
+    if (it == prepared_.end()) {
+      return Status::KeyError("Prepared statement not found");
+    }
+    return it->second;
+  }
+
   arrow::Result<std::shared_ptr<arrow::Schema>> GetPlanSchema(
       const std::string& serialized_plan) {
     std::shared_ptr<Buffer> plan_buf = Buffer::FromString(serialized_plan);
@@ -176,8 +209,8 @@ class AceroFlightSqlServer : public FlightSqlServerBase {
   }
 
   std::mutex mutex_;
-  std::unordered_map<std::string, std::shared_ptr<arrow::Buffer>> prepared_;
-  int64_t counter_;
+  std::unordered_map<std::string, std::shared_ptr<PreparedPlan>> prepared_;
+  int64_t counter_ = 0;
 };
 
 }  // namespace
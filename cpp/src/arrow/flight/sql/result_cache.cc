@@ -0,0 +1,343 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/sql/result_cache.h"
+
+#include <cctype>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+
+namespace arrow {
+namespace flight {
+namespace sql {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct CachedResults {
+  std::shared_ptr<Schema> schema;
+  FlightPayload schema_payload;
+  std::vector<FlightPayload> payloads;
+};
+
+int64_t PayloadSize(const FlightPayload& payload) {
+  int64_t size = payload.ipc_message.body_length;
+  if (payload.ipc_message.metadata) size += payload.ipc_message.metadata->size();
+  if (payload.app_metadata) size += payload.app_metadata->size();
+  if (payload.descriptor) size += payload.descriptor->size();
+  return size;
+}
+
+/// \brief Replay cached payloads.
+class CachedResultStream : public FlightDataStream {
+ public:
+  explicit CachedResultStream(std::shared_ptr<const CachedResults> results)
+      : results_(std::move(results)) {}
+
+  std::shared_ptr<Schema> schema() override { return results_->schema; }
+
+  arrow::Result<FlightPayload> GetSchemaPayload() override {
+    return results_->schema_payload;
+  }
+
+  arrow::Result<FlightPayload> Next() override {
+    if (position_ >= results_->payloads.size()) return FlightPayload();
+    return results_->payloads[position_++];
+  }
+
+ private:
+  std::shared_ptr<const CachedResults> results_;
+  size_t position_ = 0;
+};
+
+}  // namespace
+
+class ResultCache::Impl : public std::enable_shared_from_this<ResultCache::Impl> {
+ public:
+  class RecordingStream;
+
+  explicit Impl(ResultCacheOptions options) : options_(std::move(options)) {}
+
+  std::unique_ptr<FlightInfo> GetFlightInfo(const std::string& key) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    Entry* entry = Find(key);
+    if (entry == nullptr || entry->info == nullptr) return nullptr;
+    return std::make_unique<FlightInfo>(*entry->info);
+  }
+
+  void PutFlightInfo(const std::string& key, const FlightInfo& info) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    Entry* entry = FindOrCreate(key);
+    size_ -= entry->size;
+    entry->info = std::make_unique<FlightInfo>(info);
+    entry->size = EntrySize(key, *entry);
+    size_ += entry->size;
+    Evict();
+  }
+
+  std::unique_ptr<FlightDataStream> GetResults(const std::string& key) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    Entry* entry = Find(key);
+    if (entry == nullptr || entry->results == nullptr) return nullptr;
+    return std::make_unique<CachedResultStream>(entry->results);
+  }
+
+  uint64_t generation() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return generation_;
+  }
+
+  void PutResults(const std::string& key, uint64_t generation,
+                  std::shared_ptr<const CachedResults> results) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    // Results computed before an invalidation may be stale
+    if (generation != generation_) return;
+    Entry* entry = FindOrCreate(key);
+    size_ -= entry->size;
+    entry->results = std::move(results);
+    entry->expires = Clock::now() + options_.ttl;
+    entry->size = EntrySize(key, *entry);
+    size_ += entry->size;
+    Evict();
+  }
+
+  void InvalidateIf(const std::function<bool(const std::string&)>& predicate) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    ++generation_;
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (predicate(it->first)) {
+        it = Erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  void Invalidate(const std::string& key) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    ++generation_;
+    auto it = entries_.find(key);
+    if (it != entries_.end()) Erase(it);
+  }
+
+  int64_t num_entries() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return static_cast<int64_t>(entries_.size());
+  }
+
+  int64_t size() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return size_;
+  }
+
+  const ResultCacheOptions& options() const { return options_; }
+
+ private:
+  struct Entry {
+    std::unique_ptr<FlightInfo> info;
+    std::shared_ptr<const CachedResults> results;
+    int64_t size = 0;
+    Clock::time_point expires;
+    std::list<std::string>::iterator lru_position;
+  };
+  using EntryMap = std::unordered_map<std::string, Entry>;
+
+  static int64_t EntrySize(const std::string& key, const Entry& entry) {
+    int64_t size = static_cast<int64_t>(key.size());
+    if (entry.info) {
+      size += static_cast<int64_t>(entry.info->serialized_schema().size() +
+                                   entry.info->descriptor().cmd.size());
+    }
+    if (entry.results) {
+      size += PayloadSize(entry.results->schema_payload);
+      for (const auto& payload : entry.results->payloads) size += PayloadSize(payload);
+    }
+    return size;
+  }
+
+  Entry* Find(const std::string& key) {
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return nullptr;
+    if (Clock::now() >= it->second.expires) {
+      Erase(it);
+      return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    return &it->second;
+  }
+
+  Entry* FindOrCreate(const std::string& key) {
+    Entry* entry = Find(key);
+    if (entry != nullptr) return entry;
+    entry = &entries_[key];
+    entry->expires = Clock::now() + options_.ttl;
+    lru_.push_front(key);
+    entry->lru_position = lru_.begin();
+    return entry;
+  }
+
+  EntryMap::iterator Erase(EntryMap::iterator it) {
+    size_ -= it->second.size;
+    lru_.erase(it->second.lru_position);
+    return entries_.erase(it);
+  }
+
+  void Evict() {
+    while (size_ > options_.capacity && !lru_.empty()) {
+      Erase(entries_.find(lru_.back()));
+    }
+  }
+
+  const ResultCacheOptions options_;
+  std::mutex mutex_;
+  EntryMap entries_;
+  /// The keys, most recently used first.
+  std::list<std::string> lru_;
+  int64_t size_ = 0;
+  uint64_t generation_ = 0;
+};
+
+/// \brief Pass a stream through, keeping a copy of its payloads to
+///   store in the cache once the stream ends.
+class ResultCache::Impl::RecordingStream : public FlightDataStream {
+ public:
+  RecordingStream(std::shared_ptr<Impl> cache, std::string key,
+                  std::unique_ptr<FlightDataStream> stream)
+      : cache_(std::move(cache)),
+        key_(std::move(key)),
+        generation_(cache_->generation()),
+        stream_(std::move(stream)),
+        results_(std::make_shared<CachedResults>()) {
+    results_->schema = stream_->schema();
+  }
+
+  std::shared_ptr<Schema> schema() override { return stream_->schema(); }
+
+  arrow::Result<FlightPayload> GetSchemaPayload() override {
+    ARROW_ASSIGN_OR_RAISE(auto payload, stream_->GetSchemaPayload());
+    if (results_) {
+      results_->schema_payload = payload;
+      Account(payload);
+    }
+    return payload;
+  }
+
+  arrow::Result<FlightPayload> Next() override {
+    ARROW_ASSIGN_OR_RAISE(auto payload, stream_->Next());
+    if (!results_) return payload;
+    if (!payload.ipc_message.metadata) {
+      cache_->PutResults(key_, generation_, std::move(results_));
+      results_.reset();
+      return payload;
+    }
+    results_->payloads.push_back(payload);
+    Account(payload);
+    return payload;
+  }
+
+  Status Close() override { return stream_->Close(); }
+
+ private:
+  void Account(const FlightPayload& payload) {
+    size_ += PayloadSize(payload);
+    // Too large to cache: stop keeping the payloads alive
+    if (size_ > cache_->options().max_result_size) results_.reset();
+  }
+
+  std::shared_ptr<Impl> cache_;
+  std::string key_;
+  uint64_t generation_;
+  std::unique_ptr<FlightDataStream> stream_;
+  std::shared_ptr<CachedResults> results_;
+  int64_t size_ = 0;
+};
+
+ResultCache::ResultCache(ResultCacheOptions options)
+    : impl_(std::make_shared<Impl>(std::move(options))) {}
+
+ResultCache::~ResultCache() = default;
+
+std::string ResultCache::NormalizeQuery(std::string_view query) {
+  std::string normalized;
+  normalized.reserve(query.size());
+  char quote = 0;
+  bool pending_space = false;
+  for (char c : query) {
+    if (quote == 0 && std::isspace(static_cast<unsigned char>(c))) {
+      pending_space = !normalized.empty();
+      continue;
+    }
+    if (pending_space) {
+      normalized.push_back(' ');
+      pending_space = false;
+    }
+    if (quote == 0 && (c == '\'' || c == '"')) {
+      quote = c;
+    } else if (c == quote) {
+      quote = 0;
+    }
+    normalized.push_back(c);
+  }
+  while (!normalized.empty() &&
+         (normalized.back() == ';' ||
+          std::isspace(static_cast<unsigned char>(normalized.back())))) {
+    normalized.pop_back();
+  }
+  return normalized;
+}
+
+std::unique_ptr<FlightInfo> ResultCache::GetFlightInfo(const std::string& key) {
+  return impl_->GetFlightInfo(key);
+}
+
+void ResultCache::PutFlightInfo(const std::string& key, const FlightInfo& info) {
+  impl_->PutFlightInfo(key, info);
+}
+
+std::unique_ptr<FlightDataStream> ResultCache::GetResults(const std::string& key) {
+  return impl_->GetResults(key);
+}
+
+std::unique_ptr<FlightDataStream> ResultCache::RecordResults(
+    const std::string& key, std::unique_ptr<FlightDataStream> stream) {
+  return std::make_unique<Impl::RecordingStream>(impl_, key, std::move(stream));
+}
+
+void ResultCache::Invalidate(const std::string& key) { impl_->Invalidate(key); }
+
+void ResultCache::InvalidateIf(
+    const std::function<bool(const std::string&)>& predicate) {
+  impl_->InvalidateIf(predicate);
+}
+
+void ResultCache::Clear() {
+  impl_->InvalidateIf([](const std::string&) { return true; });
+}
+
+int64_t ResultCache::num_entries() const { return impl_->num_entries(); }
+
+int64_t ResultCache::size() const { return impl_->size(); }
+
+}  // namespace sql
+}  // namespace flight
+}  // namespace arrow
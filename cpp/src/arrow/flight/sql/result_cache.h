@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "arrow/flight/server.h"
+#include "arrow/flight/sql/visibility.h"
+#include "arrow/flight/types.h"
+
+namespace arrow {
+namespace flight {
+namespace sql {
+
+/// \brief Options for a ResultCache.
+struct ARROW_FLIGHT_SQL_EXPORT ResultCacheOptions {
+  /// \brief How long an entry stays valid after it was stored.
+  std::chrono::steady_clock::duration ttl = std::chrono::seconds(60);
+  /// \brief The maximum total size in bytes of the cached results.
+  ///
+  /// The least recently used entries are evicted beyond it.
+  int64_t capacity = int64_t(256) << 20;
+  /// \brief Results larger than this many bytes are not cached.
+  int64_t max_result_size = int64_t(32) << 20;
+
+  static ResultCacheOptions Defaults() { return ResultCacheOptions(); }
+};
+
+/// \brief A cache of query results, kept as the IPC payloads that
+///   were sent to the first client.
+///
+/// An entry holds the FlightInfo returned for a query and, once a
+/// DoGet of it ran to completion, the payloads of its results, which
+/// later DoGet calls replay without executing the query again.
+///
+/// FlightSqlServerBase uses a cache set with SetResultCache() for the
+/// statements run outside of a transaction, keyed by the normalized
+/// SQL query or the Substrait plan. Applications that know which
+/// entries a change of the data affects can drop them with
+/// Invalidate() or InvalidateIf().
+///
+/// This class is thread-safe.
+class ARROW_FLIGHT_SQL_EXPORT ResultCache {
+ public:
+  explicit ResultCache(ResultCacheOptions options = ResultCacheOptions::Defaults());
+  ~ResultCache();
+
+  /// \brief Normalize a SQL query for use in a key: collapse runs of
+  ///   whitespace outside of quotes, and strip leading and trailing
+  ///   whitespace and semicolons.
+  static std::string NormalizeQuery(std::string_view query);
+
+  /// \brief Get a copy of the FlightInfo stored under a key, or null.
+  std::unique_ptr<FlightInfo> GetFlightInfo(const std::string& key);
+
+  /// \brief Store the FlightInfo of a key, creating its entry.
+  void PutFlightInfo(const std::string& key, const FlightInfo& info);
+
+  /// \brief Get a stream replaying the results stored under a key, or
+  ///   null if there are none.
+  std::unique_ptr<FlightDataStream> GetResults(const std::string& key);
+
+  /// \brief Wrap a stream so its results are stored under a key once
+  ///   they have all been read.
+  std::unique_ptr<FlightDataStream> RecordResults(
+      const std::string& key, std::unique_ptr<FlightDataStream> stream);
+
+  /// \brief Drop the entry of a key.
+  void Invalidate(const std::string& key);
+
+  /// \brief Drop the entries whose key matches a predicate.
+  void InvalidateIf(const std::function<bool(const std::string&)>& predicate);
+
+  /// \brief Drop all entries.
+  void Clear();
+
+  /// \brief The number of entries.
+  int64_t num_entries() const;
+
+  /// \brief The total size in bytes of the cached results.
+  int64_t size() const;
+
+ private:
+  class Impl;
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace sql
+}  // namespace flight
+}  // namespace arrow
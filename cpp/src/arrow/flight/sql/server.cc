@@ -22,6 +22,8 @@
 
 #include "arrow/flight/sql/server.h"
 
+#include <functional>
+
 #include <google/protobuf/any.pb.h>
 
 #include "arrow/buffer.h"
@@ -514,6 +516,72 @@ arrow::Result<Result> PackActionResult(ActionCreatePreparedStatementResult resul
   return PackActionResult(pb_result);
 }
 
+/// The prefix of the statement handles of the tickets handed out for
+/// the statements in the result cache.
+constexpr std::string_view kCachedHandlePrefix = "arrow.flight.sql.cached:";
+
+/// \brief Get the statement handle of the single endpoint of a FlightInfo
+///   that can be cached.
+std::optional<std::string> GetCacheableHandle(const FlightInfo& info) {
+  if (info.endpoints().size() != 1 || !info.endpoints()[0].locations.empty()) {
+    return std::nullopt;
+  }
+  auto ticket = StatementQueryTicket::Deserialize(info.endpoints()[0].ticket.ticket);
+  if (!ticket.ok()) return std::nullopt;
+  return std::move(ticket->statement_handle);
+}
+
+/// \brief Get the FlightInfo of a statement through the result cache.
+///
+/// The returned ticket carries both the cache key and the statement
+/// handle returned by the application, which DoGet falls back to if
+/// the results are not cached.
+arrow::Result<std::unique_ptr<FlightInfo>> GetFlightInfoCached(
+    ResultCache* cache, const std::string& key, const FlightDescriptor& descriptor,
+    const std::function<arrow::Result<std::unique_ptr<FlightInfo>>()>& get_info) {
+  std::unique_ptr<FlightInfo> info = cache->GetFlightInfo(key);
+  if (info == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(info, get_info());
+    if (!GetCacheableHandle(*info)) return info;
+    cache->PutFlightInfo(key, *info);
+  }
+  std::optional<std::string> handle = GetCacheableHandle(*info);
+  FlightInfo::Data data;
+  data.schema = info->serialized_schema();
+  data.descriptor = descriptor;
+  data.endpoints = info->endpoints();
+  data.total_records = info->total_records();
+  data.total_bytes = info->total_bytes();
+  data.ordered = info->ordered();
+  data.app_metadata = info->app_metadata();
+  std::string cached_handle(kCachedHandlePrefix);
+  cached_handle += std::to_string(key.size()) + ":" + key + *handle;
+  ARROW_ASSIGN_OR_RAISE(data.endpoints[0].ticket.ticket,
+                        CreateStatementQueryTicket(cached_handle));
+  return std::make_unique<FlightInfo>(std::move(data));
+}
+
+/// \brief Split a statement handle made by GetFlightInfoCached into the
+///   cache key and the handle of the application.
+bool ParseCachedHandle(std::string* handle, std::string* key) {
+  std::string_view view(*handle);
+  if (view.substr(0, kCachedHandlePrefix.size()) != kCachedHandlePrefix) return false;
+  view.remove_prefix(kCachedHandlePrefix.size());
+  size_t colon = view.find(':');
+  if (colon == std::string_view::npos) return false;
+  uint64_t key_size = 0;
+  for (char c : view.substr(0, colon)) {
+    if (c < '0' || c > '9') return false;
+    key_size = key_size * 10 + static_cast<uint64_t>(c - '0');
+    if (key_size > view.size()) return false;
+  }
+  view.remove_prefix(colon + 1);
+  if (key_size > view.size()) return false;
+  *key = std::string(view.substr(0, key_size));
+  *handle = std::string(view.substr(key_size));
+  return true;
+}
+
 }  // namespace
 
 arrow::Result<StatementQueryTicket> StatementQueryTicket::Deserialize(
@@ -558,12 +626,34 @@ Status FlightSqlServerBase::GetFlightInfo(const ServerCallContext& context,
   if (any.Is<pb::sql::CommandStatementQuery>()) {
     ARROW_ASSIGN_OR_RAISE(StatementQuery internal_command,
                           ParseCommandStatementQuery(any));
+    if (result_cache_ && internal_command.transaction_id.empty()) {
+      ARROW_ASSIGN_OR_RAISE(
+          *info, GetFlightInfoCached(
+                     result_cache_.get(),
+                     "sql:" + ResultCache::NormalizeQuery(internal_command.query),
+                     request, [&]() {
+                       return GetFlightInfoStatement(context, internal_command, request);
+                     }));
+      return Status::OK();
+    }
     ARROW_ASSIGN_OR_RAISE(*info,
                           GetFlightInfoStatement(context, internal_command, request));
     return Status::OK();
   } else if (any.Is<pb::sql::CommandStatementSubstraitPlan>()) {
     ARROW_ASSIGN_OR_RAISE(StatementSubstraitPlan internal_command,
                           ParseCommandStatementSubstraitPlan(any));
+    if (result_cache_ && internal_command.transaction_id.empty()) {
+      ARROW_ASSIGN_OR_RAISE(
+          *info, GetFlightInfoCached(
+                     result_cache_.get(),
+                     "substrait:" + internal_command.plan.version + ":" +
+                         internal_command.plan.plan,
+                     request, [&]() {
+                       return GetFlightInfoSubstraitPlan(context, internal_command,
+                                                         request);
+                     }));
+      return Status::OK();
+    }
     ARROW_ASSIGN_OR_RAISE(*info,
                           GetFlightInfoSubstraitPlan(context, internal_command, request));
     return Status::OK();
@@ -716,6 +806,17 @@ Status FlightSqlServerBase::DoGet(const ServerCallContext& context, const Ticket
     }
     StatementQueryTicket result;
     result.statement_handle = command.statement_handle();
+    std::string key;
+    if (result_cache_ && ParseCachedHandle(&result.statement_handle, &key)) {
+      if ((*stream = result_cache_->GetResults(key)) != nullptr) return Status::OK();
+      ARROW_ASSIGN_OR_RAISE(*stream, DoGetStatement(context, result));
+      // Only record results under the key they were planned for
+      std::unique_ptr<FlightInfo> info = result_cache_->GetFlightInfo(key);
+      if (info != nullptr && GetCacheableHandle(*info) == result.statement_handle) {
+        *stream = result_cache_->RecordResults(key, std::move(*stream));
+      }
+      return Status::OK();
+    }
     ARROW_ASSIGN_OR_RAISE(*stream, DoGetStatement(context, result));
     return Status::OK();
   } else if (any.Is<pb::sql::CommandPreparedStatementQuery>()) {
@@ -786,6 +887,7 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
                           ParseCommandStatementUpdate(any));
     ARROW_ASSIGN_OR_RAISE(auto record_count,
                           DoPutCommandStatementUpdate(context, internal_command))
+    if (result_cache_) result_cache_->Clear();
 
     pb::sql::DoPutUpdateResult result;
     result.set_record_count(record_count);
@@ -799,6 +901,7 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
                           ParseCommandStatementSubstraitPlan(any));
     ARROW_ASSIGN_OR_RAISE(auto record_count,
                           DoPutCommandSubstraitPlan(context, internal_command));
+    if (result_cache_) result_cache_->Clear();
 
     pb::sql::DoPutUpdateResult result;
     result.set_record_count(record_count);
@@ -817,6 +920,7 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
     ARROW_ASSIGN_OR_RAISE(
         auto record_count,
         DoPutPreparedStatementUpdate(context, internal_command, reader.get()));
+    if (result_cache_) result_cache_->Clear();
 
     pb::sql::DoPutUpdateResult result;
     result.set_record_count(record_count);
@@ -830,6 +934,7 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
     ARROW_ASSIGN_OR_RAISE(
         auto record_count,
         DoPutCommandStatementIngest(context, internal_command, reader.get()));
+    if (result_cache_) result_cache_->Clear();
 
     pb::sql::DoPutUpdateResult result;
     result.set_record_count(record_count);
@@ -956,6 +1061,7 @@ Status FlightSqlServerBase::DoAction(const ServerCallContext& context,
       ARROW_ASSIGN_OR_RAISE(ActionEndTransactionRequest internal_command,
                             ParseActionEndTransactionRequest(action));
       ARROW_RETURN_NOT_OK(EndTransaction(context, internal_command));
+      if (result_cache_) result_cache_->Clear();
     } else {
       return Status::NotImplemented("Action not implemented: ", action.type);
     }
@@ -1055,6 +1161,10 @@ void FlightSqlServerBase::RegisterSqlInfo(int32_t id, const SqlInfoResult& resul
   sql_info_id_to_result_[id] = result;
 }
 
+void FlightSqlServerBase::SetResultCache(std::shared_ptr<ResultCache> cache) {
+  result_cache_ = std::move(cache);
+}
+
 arrow::Result<std::unique_ptr<FlightDataStream>> FlightSqlServerBase::DoGetSqlInfo(
     const ServerCallContext& context, const GetSqlInfo& command) {
   MemoryPool* memory_pool = default_memory_pool();
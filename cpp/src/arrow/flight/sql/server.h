@@ -27,6 +27,7 @@
 #include <unordered_map>
 
 #include "arrow/flight/server.h"
+#include "arrow/flight/sql/result_cache.h"
 #include "arrow/flight/sql/server.h"
 #include "arrow/flight/sql/types.h"
 #include "arrow/flight/sql/visibility.h"
@@ -262,6 +263,7 @@ arrow::Result<std::string> CreateStatementQueryTicket(
 class ARROW_FLIGHT_SQL_EXPORT FlightSqlServerBase : public FlightServerBase {
  private:
   SqlInfoResultMap sql_info_id_to_result_;
+  std::shared_ptr<ResultCache> result_cache_;
 
  public:
   /// \name Flight SQL methods
@@ -676,6 +678,23 @@ class ARROW_FLIGHT_SQL_EXPORT FlightSqlServerBase : public FlightServerBase {
   /// \param[in] result the result.
   void RegisterSqlInfo(int32_t id, const SqlInfoResult& result);
 
+  /// \brief Cache the results of the statements run outside of a
+  /// transaction, or stop caching them if null.
+  ///
+  /// Statements are keyed by their normalized SQL query or their
+  /// Substrait plan, and repeating one serves the FlightInfo and the
+  /// results of its first execution until the cache entry expires or
+  /// is invalidated. Only statements whose FlightInfo has a single
+  /// endpoint without locations are cached. The cache is shared by
+  /// all clients, and is cleared after each update or ingestion that
+  /// succeeds through this server. Must be called before the server
+  /// handles requests.
+  /// \param[in] cache the cache.
+  void SetResultCache(std::shared_ptr<ResultCache> cache);
+
+  /// \brief The cache set by SetResultCache(), if any.
+  const std::shared_ptr<ResultCache>& result_cache() const { return result_cache_; }
+
   /// @}
 
   /// \name Flight RPC handlers
@@ -29,6 +29,7 @@
 #include "arrow/flight/sql/example/sqlite_server.h"
 #include "arrow/flight/sql/example/sqlite_sql_info.h"
 #include "arrow/flight/sql/example/sqlite_type_info.h"
+#include "arrow/flight/sql/result_cache.h"
 #include "arrow/flight/sql/server.h"
 #include "arrow/flight/test_util.h"
 #include "arrow/flight/types.h"
@@ -166,7 +167,6 @@ class TestFlightSqlServer : public ::testing::Test {
     ASSERT_OK(server->Shutdown());
   }
 
- private:
   std::shared_ptr<arrow::flight::sql::example::SQLiteFlightSqlServer> server;
 };
 
@@ -445,6 +445,43 @@ TEST_F(TestFlightSqlServer, TestCommandStatementUpdate) {
   ASSERT_EQ(3, result);
 }
 
+TEST_F(TestFlightSqlServer, ResultCache) {
+  auto cache = std::make_shared<ResultCache>();
+  server->SetResultCache(cache);
+
+  ASSERT_OK_AND_EQ(5, ExecuteCountQuery("SELECT COUNT(*) FROM intTable"));
+  ASSERT_EQ(1, cache->num_entries());
+  const int64_t size = cache->size();
+  ASSERT_GT(size, 0);
+
+  // The same query up to whitespace is served from the cache
+  ASSERT_OK_AND_ASSIGN(auto flight_info,
+                       sql_client->Execute({}, "  SELECT COUNT(*)\n  FROM intTable;"));
+  ASSERT_OK_AND_ASSIGN(auto stream,
+                       sql_client->DoGet({}, flight_info->endpoints()[0].ticket));
+  ASSERT_OK_AND_ASSIGN(auto table, stream->ToTable());
+  ASSERT_EQ(1, table->num_rows());
+  ASSERT_EQ(1, cache->num_entries());
+  ASSERT_EQ(size, cache->size());
+
+  // Updates invalidate the cached results
+  ASSERT_OK_AND_EQ(1, sql_client->ExecuteUpdate(
+                          {}, "INSERT INTO intTable (keyName, value) VALUES ('k', 1)"));
+  ASSERT_EQ(0, cache->num_entries());
+  ASSERT_OK_AND_EQ(6, ExecuteCountQuery("SELECT COUNT(*) FROM intTable"));
+
+  cache->Invalidate("sql:SELECT COUNT(*) FROM intTable");
+  ASSERT_EQ(0, cache->num_entries());
+  ASSERT_EQ(0, cache->size());
+}
+
+TEST(TestResultCache, NormalizeQuery) {
+  ASSERT_EQ("SELECT 1", ResultCache::NormalizeQuery("SELECT 1"));
+  ASSERT_EQ("SELECT 1", ResultCache::NormalizeQuery("\tSELECT\n  1 ;\n"));
+  ASSERT_EQ("SELECT 'a  b', \"c\td\" FROM t",
+            ResultCache::NormalizeQuery("SELECT  'a  b',  \"c\td\"\nFROM t;"));
+}
+
 TEST_F(TestFlightSqlServer, TestCommandPreparedStatementQuery) {
   ASSERT_OK_AND_ASSIGN(auto prepared_statement,
                        sql_client->Prepare({}, "SELECT * FROM intTable"));
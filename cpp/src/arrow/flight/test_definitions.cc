@@ -1922,5 +1922,104 @@ void AsyncClientTest::TestListenerLifetime() {
   ASSERT_FINISHES_OK(future);
 }
 
+namespace {
+/// \brief Collect everything an async stream reads.
+class CollectingStreamListener : public AsyncStreamListener {
+ public:
+  void OnSchema(std::shared_ptr<Schema> schema) override { schema_ = std::move(schema); }
+
+  void OnNext(FlightStreamChunk chunk) override {
+    if (chunk.data) batches_.push_back(std::move(chunk.data));
+    if (chunk.app_metadata) metadata_.push_back(chunk.app_metadata->ToString());
+  }
+
+  void OnFinish(Status status) override {
+    ASSERT_FALSE(future_.is_finished());
+    future_.MarkFinished(std::move(status));
+  }
+
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+  std::vector<std::string> metadata_;
+  arrow::Future<> future_ = arrow::Future<>::Make();
+};
+}  // namespace
+
+void AsyncClientTest::TestDoGet() {
+  RecordBatchVector expected;
+  ASSERT_OK(ExampleDictBatches(&expected));
+
+  auto listener = std::make_shared<CollectingStreamListener>();
+  client_->DoGetAsync({}, Ticket{"ticket-dicts-1"}, listener);
+  ASSERT_FINISHES_OK(listener->future_);
+  AssertSchemaEqual(*expected[0]->schema(), *listener->schema_);
+  ASSERT_EQ(expected.size(), listener->batches_.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    AssertBatchesEqual(*expected[i], *listener->batches_[i]);
+  }
+  ASSERT_EQ(0, listener->metadata_.size());
+
+  // A DoGet cannot be written to
+  ASSERT_RAISES(NotImplemented, listener->DoneWriting());
+
+  listener = std::make_shared<CollectingStreamListener>();
+  client_->DoGetAsync({}, Ticket{"unknown"}, listener);
+  ASSERT_FINISHES_AND_RAISES(NotImplemented, listener->future_);
+}
+
+void AsyncClientTest::TestDoGetFuture() {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  ASSERT_OK_AND_ASSIGN(auto expected, Table::FromRecordBatches(batches));
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto table,
+                                client_->DoGetAsync(Ticket{"ticket-ints-1"}));
+  AssertTablesEqual(*expected, *table);
+
+  ASSERT_FINISHES_AND_RAISES(NotImplemented, client_->DoGetAsync(Ticket{"unknown"}));
+}
+
+void AsyncClientTest::TestDoPutFuture() {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  auto descr = FlightDescriptor::Path({"ints"});
+
+  ASSERT_FINISHES_OK(client_->DoPutAsync({}, descr, ExampleIntSchema(), batches));
+  // Only the schema is sent
+  ASSERT_FINISHES_OK(client_->DoPutAsync({}, descr, ExampleIntSchema(), {}));
+}
+
+void AsyncClientTest::TestDoExchange() {
+  RecordBatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+
+  // The server reports the number of batches, then echoes them back
+  auto listener = std::make_shared<CollectingStreamListener>();
+  client_->DoExchangeAsync({}, listener);
+  ASSERT_OK(listener->Begin(FlightDescriptor::Command("counter"), ExampleIntSchema()));
+  for (const auto& batch : batches) {
+    FlightStreamChunk chunk;
+    chunk.data = batch;
+    ASSERT_OK(listener->Write(std::move(chunk)));
+  }
+  ASSERT_OK(listener->DoneWriting());
+  ASSERT_FINISHES_OK(listener->future_);
+
+  ASSERT_THAT(listener->metadata_,
+              ::testing::ElementsAre(std::to_string(batches.size())));
+  AssertSchemaEqual(*ExampleIntSchema(), *listener->schema_);
+  ASSERT_EQ(batches.size(), listener->batches_.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    AssertBatchesEqual(*batches[i], *listener->batches_[i]);
+  }
+  ASSERT_RAISES(Invalid, listener->DoneWriting());
+
+  listener = std::make_shared<CollectingStreamListener>();
+  client_->DoExchangeAsync({}, listener);
+  // The server fails the call after reading the descriptor
+  ASSERT_OK(listener->Begin(FlightDescriptor::Command("error"), nullptr));
+  ASSERT_FINISHES_AND_RAISES(NotImplemented, listener->future_);
+}
+
 }  // namespace flight
 }  // namespace arrow
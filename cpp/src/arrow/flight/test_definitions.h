@@ -300,6 +300,10 @@ class ARROW_FLIGHT_EXPORT AsyncClientTest : public FlightTest {
   void TestGetFlightInfo();
   void TestGetFlightInfoFuture();
   void TestListenerLifetime();
+  void TestDoGet();
+  void TestDoGetFuture();
+  void TestDoPutFuture();
+  void TestDoExchange();
 
  private:
   std::unique_ptr<FlightClient> client_;
@@ -312,7 +316,11 @@ class ARROW_FLIGHT_EXPORT AsyncClientTest : public FlightTest {
                 ARROW_STRINGIFY(FIXTURE) " must inherit from AsyncClientTest"); \
   TEST_F(FIXTURE, TestGetFlightInfo) { TestGetFlightInfo(); }                   \
   TEST_F(FIXTURE, TestGetFlightInfoFuture) { TestGetFlightInfoFuture(); }       \
-  TEST_F(FIXTURE, DISABLED_TestListenerLifetime) { TestListenerLifetime(); }
+  TEST_F(FIXTURE, DISABLED_TestListenerLifetime) { TestListenerLifetime(); }    \
+  TEST_F(FIXTURE, TestDoGet) { TestDoGet(); }                                   \
+  TEST_F(FIXTURE, TestDoGetFuture) { TestDoGetFuture(); }                       \
+  TEST_F(FIXTURE, TestDoPutFuture) { TestDoPutFuture(); }                       \
+  TEST_F(FIXTURE, TestDoExchange) { TestDoExchange(); }
 
 }  // namespace flight
 }  // namespace arrow
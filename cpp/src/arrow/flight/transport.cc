@@ -106,6 +106,18 @@ Status ClientTransport::DoExchange(const FlightCallOptions& options,
                                    std::unique_ptr<ClientDataStream>* stream) {
   return Status::NotImplemented("DoExchange for this transport");
 }
+void ClientTransport::DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                                 std::shared_ptr<AsyncDataListener> listener) {
+  listener->OnFinish(Status::NotImplemented("Async DoGet for this transport"));
+}
+void ClientTransport::DoPutAsync(const FlightCallOptions& options,
+                                 std::shared_ptr<AsyncDataListener> listener) {
+  listener->OnFinish(Status::NotImplemented("Async DoPut for this transport"));
+}
+void ClientTransport::DoExchangeAsync(const FlightCallOptions& options,
+                                      std::shared_ptr<AsyncDataListener> listener) {
+  listener->OnFinish(Status::NotImplemented("Async DoExchange for this transport"));
+}
 void ClientTransport::SetAsyncRpc(AsyncListenerBase* listener,
                                   std::unique_ptr<AsyncRpc>&& rpc) {
   listener->rpc_state_ = std::move(rpc);
@@ -198,6 +198,12 @@ class ARROW_FLIGHT_EXPORT ClientTransport {
                        std::unique_ptr<ClientDataStream>* stream);
   virtual Status DoExchange(const FlightCallOptions& options,
                             std::unique_ptr<ClientDataStream>* stream);
+  virtual void DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                          std::shared_ptr<AsyncDataListener> listener);
+  virtual void DoPutAsync(const FlightCallOptions& options,
+                          std::shared_ptr<AsyncDataListener> listener);
+  virtual void DoExchangeAsync(const FlightCallOptions& options,
+                               std::shared_ptr<AsyncDataListener> listener);
 
   bool supports_async() const { return CheckAsyncSupport().ok(); }
   virtual Status CheckAsyncSupport() const {
@@ -253,12 +259,57 @@ class ARROW_FLIGHT_EXPORT AsyncRpc {
   virtual void TryCancel() {}
 
   /// Only needed for DoPut/DoExchange
-  virtual void Begin(const FlightDescriptor& descriptor, std::shared_ptr<Schema> schema) {
+  virtual Status Begin(const FlightDescriptor& descriptor,
+                       std::shared_ptr<Schema> schema) {
+    return Status::NotImplemented("Writing to this RPC");
   }
   /// Only needed for DoPut/DoExchange
-  virtual void Write(arrow::flight::FlightStreamChunk chunk) {}
+  virtual Status Write(arrow::flight::FlightStreamChunk chunk) {
+    return Status::NotImplemented("Writing to this RPC");
+  }
   /// Only needed for DoPut/DoExchange
-  virtual void DoneWriting() {}
+  virtual Status DoneWriting() { return Status::NotImplemented("Writing to this RPC"); }
+};
+
+/// \brief The transport side of an async DoGet, DoPut or DoExchange.
+///
+/// The stream reads and writes raw Flight data; FlightClient encodes
+/// and decodes the IPC messages on top of it.
+class ARROW_FLIGHT_EXPORT AsyncDataStream {
+ public:
+  virtual ~AsyncDataStream() = default;
+  /// \brief Start writing a payload.
+  ///
+  /// Only one write may be outstanding: the next one can start after
+  /// AsyncDataListener::OnWriteDone(). The payload must stay alive
+  /// until then.
+  virtual void StartWrite(const FlightPayload* payload) = 0;
+  /// \brief Signal that no more payloads will be written, once the
+  ///   last write is done.
+  virtual void WritesDone() = 0;
+  /// \brief Request cancellation of the RPC.
+  virtual void TryCancel() = 0;
+};
+
+/// \brief The callbacks of an async data stream.
+///
+/// Read callbacks and OnFinish() are never called concurrently with
+/// each other, but OnWriteDone() may be called concurrently with the
+/// read callbacks.
+class ARROW_FLIGHT_EXPORT AsyncDataListener {
+ public:
+  virtual ~AsyncDataListener() = default;
+  /// \brief Called before the RPC starts, with the stream to write
+  ///   to. The stream must not be used once OnFinish() was called.
+  virtual void OnStart(AsyncDataStream* stream) = 0;
+  /// \brief Data read by a DoGet or DoExchange.
+  virtual void OnData(FlightData data) {}
+  /// \brief Application metadata read by a DoPut.
+  virtual void OnPutMetadata(std::shared_ptr<Buffer> app_metadata) {}
+  /// \brief The last write completed, or failed if not ok.
+  virtual void OnWriteDone(bool ok) {}
+  /// \brief The RPC is over.
+  virtual void OnFinish(Status status) = 0;
 };
 
 //------------------------------------------------------------
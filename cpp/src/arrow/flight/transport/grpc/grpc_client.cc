@@ -670,6 +670,169 @@ class UnaryUnaryAsyncCall : public ::grpc::ClientUnaryReactor, public internal::
   }
 };
 
+/// \brief How an async data call reads its responses.
+template <typename Response>
+struct AsyncReadTraits;
+
+template <>
+struct AsyncReadTraits<pb::FlightData> {
+  using Message = internal::FlightData;
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  static pb::FlightData* Cast(Message* message) {
+    return reinterpret_cast<pb::FlightData*>(message);
+  }
+  static void Deliver(Message* message, internal::AsyncDataListener* listener) {
+    listener->OnData(std::move(*message));
+    *message = Message();
+  }
+};
+
+template <>
+struct AsyncReadTraits<pb::PutResult> {
+  using Message = pb::PutResult;
+  static pb::PutResult* Cast(Message* message) { return message; }
+  static void Deliver(Message* message, internal::AsyncDataListener* listener) {
+    listener->OnPutMetadata(
+        Buffer::FromString(std::move(*message->mutable_app_metadata())));
+  }
+};
+
+/// \brief The reactor of an async DoGet, DoPut or DoExchange.
+///
+/// The reactor owns itself once started, and hands itself to the
+/// garbage bin when done.
+template <typename Reactor, typename Response>
+class AsyncDataCall : public Reactor,
+                      public internal::AsyncRpc,
+                      public internal::AsyncDataStream {
+ public:
+  using Traits = AsyncReadTraits<Response>;
+
+  ClientRpc rpc;
+
+  AsyncDataCall(const FlightCallOptions& options,
+                std::shared_ptr<internal::AsyncDataListener> listener,
+                std::shared_ptr<GrpcGarbageBin> garbage_bin)
+      : rpc(options),
+        listener_(std::move(listener)),
+        garbage_bin_(std::move(garbage_bin)) {}
+
+  void TryCancel() override { rpc.context.TryCancel(); }
+
+  /// \brief Start the call, once the stub method was given this reactor.
+  void Start() {
+    listener_->OnStart(this);
+    this->StartRead(Traits::Cast(&message_));
+    this->StartCall();
+  }
+
+  void OnReadDone(bool ok) override {
+    if (!ok) {
+      OnReadsDone();
+      return;
+    }
+    Traits::Deliver(&message_, listener_.get());
+    this->StartRead(Traits::Cast(&message_));
+  }
+
+  void OnDone(const ::grpc::Status& status) override {
+    auto listener = std::move(listener_);
+    listener->OnFinish(
+        CombinedTransportStatus(status, std::move(client_status_), &rpc.context));
+    // Instead of potentially destructing gRPC resources here,
+    // transfer it to a dedicated background thread
+    garbage_bin_->Dispose(std::unique_ptr<internal::AsyncRpc>(this));
+  }
+
+ protected:
+  virtual void OnReadsDone() {}
+
+  std::shared_ptr<internal::AsyncDataListener> listener_;
+  std::shared_ptr<GrpcGarbageBin> garbage_bin_;
+  typename Traits::Message message_;
+  Status client_status_;
+};
+
+class AsyncGetCall
+    : public AsyncDataCall<::grpc::ClientReadReactor<pb::FlightData>, pb::FlightData> {
+ public:
+  using AsyncDataCall::AsyncDataCall;
+
+  pb::Ticket pb_ticket;
+
+  // FlightClient does not write to a DoGet
+  void StartWrite(const FlightPayload* payload) override { DCHECK(false); }
+  void WritesDone() override {}
+};
+
+/// \brief The reactor of an async DoPut or DoExchange.
+///
+/// A hold keeps the call open for writes until the application is
+/// done writing, the server is done, or the call is cancelled; writes
+/// started after that are dropped.
+template <typename Response>
+class AsyncWritableCall
+    : public AsyncDataCall<::grpc::ClientBidiReactor<pb::FlightData, Response>,
+                           Response> {
+ public:
+  using Reactor = ::grpc::ClientBidiReactor<pb::FlightData, Response>;
+  using Base = AsyncDataCall<Reactor, Response>;
+  using Base::Base;
+
+  void Start() {
+    this->AddHold();
+    Base::Start();
+  }
+
+  void TryCancel() override {
+    Base::TryCancel();
+    ReleaseHold();
+  }
+
+  void StartWrite(const FlightPayload* payload) override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (hold_released_) return;
+    // Returning an error from SerializationTraits would fail an assertion
+    if (auto status = payload->Validate(); !status.ok()) {
+      this->client_status_ = std::move(status);
+      this->rpc.context.TryCancel();
+      ReleaseHoldUnlocked();
+      return;
+    }
+    // Pretend to be pb::FlightData and intercept in SerializationTraits
+    Reactor::StartWrite(reinterpret_cast<const pb::FlightData*>(payload));
+  }
+
+  void WritesDone() override {
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (hold_released_) return;
+    this->StartWritesDone();
+    ReleaseHoldUnlocked();
+  }
+
+  void OnWriteDone(bool ok) override { this->listener_->OnWriteDone(ok); }
+
+ protected:
+  void OnReadsDone() override { ReleaseHold(); }
+
+ private:
+  void ReleaseHold() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    ReleaseHoldUnlocked();
+  }
+
+  void ReleaseHoldUnlocked() {
+    if (hold_released_) return;
+    hold_released_ = true;
+    // Outside of a reaction, this schedules OnDone() rather than
+    // running it inline
+    this->RemoveHold();
+  }
+
+  std::mutex mutex_;
+  bool hold_released_ = false;
+};
+
 #  define LISTENER_NOT_OK(LISTENER, EXPR)                 \
     if (auto arrow_status = (EXPR); !arrow_status.ok()) { \
       (LISTENER)->OnFinish(std::move(arrow_status));      \
@@ -1036,6 +1199,36 @@ class GrpcClientImpl : public internal::ClientTransport {
         ->StartCall();
   }
 
+  void DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                  std::shared_ptr<internal::AsyncDataListener> listener) override {
+    auto call = std::make_unique<AsyncGetCall>(options, listener, garbage_bin_);
+    LISTENER_NOT_OK(listener, internal::ToProto(ticket, &call->pb_ticket));
+    LISTENER_NOT_OK(listener, call->rpc.SetToken(auth_handler_.get()));
+
+    stub_->experimental_async()->DoGet(&call->rpc.context, &call->pb_ticket, call.get());
+    call.release()->Start();
+  }
+
+  void DoPutAsync(const FlightCallOptions& options,
+                  std::shared_ptr<internal::AsyncDataListener> listener) override {
+    auto call = std::make_unique<AsyncWritableCall<pb::PutResult>>(options, listener,
+                                                                    garbage_bin_);
+    LISTENER_NOT_OK(listener, call->rpc.SetToken(auth_handler_.get()));
+
+    stub_->experimental_async()->DoPut(&call->rpc.context, call.get());
+    call.release()->Start();
+  }
+
+  void DoExchangeAsync(const FlightCallOptions& options,
+                       std::shared_ptr<internal::AsyncDataListener> listener) override {
+    auto call = std::make_unique<AsyncWritableCall<pb::FlightData>>(options, listener,
+                                                                     garbage_bin_);
+    LISTENER_NOT_OK(listener, call->rpc.SetToken(auth_handler_.get()));
+
+    stub_->experimental_async()->DoExchange(&call->rpc.context, call.get());
+    call.release()->Start();
+  }
+
   Status CheckAsyncSupport() const override { return Status::OK(); }
 #else
   void GetFlightInfoAsync(const FlightCallOptions& options,
@@ -1044,6 +1237,21 @@ class GrpcClientImpl : public internal::ClientTransport {
     listener->OnFinish(CheckAsyncSupport());
   }
 
+  void DoGetAsync(const FlightCallOptions& options, const Ticket& ticket,
+                  std::shared_ptr<internal::AsyncDataListener> listener) override {
+    listener->OnFinish(CheckAsyncSupport());
+  }
+
+  void DoPutAsync(const FlightCallOptions& options,
+                  std::shared_ptr<internal::AsyncDataListener> listener) override {
+    listener->OnFinish(CheckAsyncSupport());
+  }
+
+  void DoExchangeAsync(const FlightCallOptions& options,
+                       std::shared_ptr<internal::AsyncDataListener> listener) override {
+    listener->OnFinish(CheckAsyncSupport());
+  }
+
   Status CheckAsyncSupport() const override {
     return Status::NotImplemented("gRPC 1.40 or newer is required to use async");
   }
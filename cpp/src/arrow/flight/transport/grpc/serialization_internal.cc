@@ -19,7 +19,10 @@
 
 // todo cleanup includes
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -64,21 +67,33 @@ namespace pb = arrow::flight::protocol;
 static constexpr int64_t kInt32Max = std::numeric_limits<int32_t>::max();
 using google::protobuf::internal::WireFormatLite;
 using google::protobuf::io::ArrayOutputStream;
-using google::protobuf::io::CodedInputStream;
 using google::protobuf::io::CodedOutputStream;
 
 using ::grpc::ByteBuffer;
 
-bool ReadBytesZeroCopy(const std::shared_ptr<Buffer>& source_data,
-                       CodedInputStream* input, std::shared_ptr<Buffer>* out) {
-  uint32_t length;
-  if (!input->ReadVarint32(&length)) {
-    return false;
-  }
-  auto buf =
-      SliceBuffer(source_data, input->CurrentPosition(), static_cast<int64_t>(length));
-  *out = buf;
-  return input->Skip(static_cast<int>(length));
+namespace {
+
+// Process-wide counters behind GetSerializationStats()
+std::atomic<int64_t> num_messages_sent{0};
+std::atomic<int64_t> num_body_copies_sent{0};
+std::atomic<int64_t> body_bytes_copied_sent{0};
+std::atomic<int64_t> num_messages_received{0};
+std::atomic<int64_t> num_body_copies_received{0};
+std::atomic<int64_t> body_bytes_copied_received{0};
+
+}  // namespace
+
+SerializationStats GetSerializationStats() {
+  SerializationStats stats;
+  stats.num_messages_sent = num_messages_sent.load(std::memory_order_relaxed);
+  stats.num_body_copies_sent = num_body_copies_sent.load(std::memory_order_relaxed);
+  stats.body_bytes_copied_sent = body_bytes_copied_sent.load(std::memory_order_relaxed);
+  stats.num_messages_received = num_messages_received.load(std::memory_order_relaxed);
+  stats.num_body_copies_received =
+      num_body_copies_received.load(std::memory_order_relaxed);
+  stats.body_bytes_copied_received =
+      body_bytes_copied_received.load(std::memory_order_relaxed);
+  return stats;
 }
 
 // Internal wrapper for gRPC ByteBuffer so its memory can be exposed to Arrow
@@ -95,61 +110,134 @@ class GrpcBuffer : public MutableBuffer {
     grpc_slice_unref(slice_);
   }
 
-  static Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<Buffer>* out) {
-    // These types are guaranteed by static assertions in gRPC to have the same
-    // in-memory representation
-
-    auto buffer = *reinterpret_cast<grpc_byte_buffer**>(cpp_buf);
+ private:
+  grpc_slice slice_;
+};
 
-    // This part below is based on the Flatbuffers gRPC SerializationTraits in
-    // flatbuffers/grpc.h
+// Reader of a protobuf message spread over the slices of a gRPC ByteBuffer.
+//
+// The message is not flattened: the fields that lie within a single slice are
+// exposed as Arrow buffers referencing it, and only the fields that span several
+// slices (or small inlined slices) are copied.
+class SliceReader {
+ public:
+  SliceReader(const grpc_slice* slices, size_t num_slices)
+      : slices_(slices), num_slices_(num_slices), wrapped_slices_(num_slices) {}
 
-    // Check if this is a single uncompressed slice.
-    if ((buffer->type == GRPC_BB_RAW) &&
-        (buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
-        (buffer->data.raw.slice_buffer.count == 1)) {
-      // If it is, then we can reference the `grpc_slice` directly.
-      grpc_slice slice = buffer->data.raw.slice_buffer.slices[0];
+  bool AtEnd() { return !Advance(); }
 
-      if (slice.refcount) {
-        // Increment reference count so this memory remains valid
-        *out = std::make_shared<GrpcBuffer>(slice, true);
-      } else {
-        // Small slices (less than GRPC_SLICE_INLINED_SIZE bytes) are
-        // inlined into the structure and must be copied.
-        const uint8_t length = slice.data.inlined.length;
-        ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(length));
-        std::memcpy((*out)->mutable_data(), slice.data.inlined.bytes, length);
+  bool ReadVarint(uint64_t* out) {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (!Advance()) {
+        return false;
       }
-    } else {
-      // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
-      // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
-      // us back a new slice with the refcount already incremented.
-      grpc_byte_buffer_reader reader;
-      if (!grpc_byte_buffer_reader_init(&reader, buffer)) {
-        return Status::IOError("Internal gRPC error reading from ByteBuffer");
+      const uint8_t byte = GRPC_SLICE_START_PTR(slices_[index_])[offset_++];
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        *out = value;
+        return true;
       }
-      grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
-      if (slice.refcount) {
-        // Steal the slice reference
-        *out = std::make_shared<GrpcBuffer>(slice, false);
-      } else {
-        // grpc_byte_buffer_reader_readall can give us an inlined slice,
-        // copy the data as above
-        const uint8_t length = slice.data.inlined.length;
-        ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(length));
-        std::memcpy((*out)->mutable_data(), slice.data.inlined.bytes, length);
+    }
+    return false;
+  }
+
+  bool Skip(uint64_t length) {
+    while (length > 0) {
+      if (!Advance()) {
+        return false;
+      }
+      const size_t chunk = std::min<uint64_t>(length, SliceRemaining());
+      offset_ += chunk;
+      length -= chunk;
+    }
+    return true;
+  }
+
+  // Read a length-delimited field, set `copied` if it spans several slices
+  bool ReadBytes(std::shared_ptr<Buffer>* out, bool* copied) {
+    uint64_t length;
+    if (!ReadVarint(&length) || length > static_cast<uint64_t>(kInt32Max)) {
+      return false;
+    }
+    *copied = false;
+    if (!Advance() || length == 0) {
+      // Empty trailing field
+      *out = std::make_shared<Buffer>(nullptr, 0);
+      return length == 0;
+    }
+    const grpc_slice& slice = slices_[index_];
+    if (slice.refcount != nullptr && SliceRemaining() >= length) {
+      auto& wrapped = wrapped_slices_[index_];
+      if (wrapped == nullptr) {
+        // Increment reference count so this memory remains valid
+        wrapped = std::make_shared<GrpcBuffer>(slice, true);
       }
-      grpc_byte_buffer_reader_destroy(&reader);
+      *out = SliceBuffer(wrapped, static_cast<int64_t>(offset_),
+                         static_cast<int64_t>(length));
+      offset_ += length;
+      return true;
     }
 
-    return Status::OK();
+    // Small slices (less than GRPC_SLICE_INLINED_SIZE bytes) are inlined into
+    // the structure, and the others can't be referenced as a single buffer
+    auto maybe_buffer = AllocateBuffer(static_cast<int64_t>(length));
+    if (!maybe_buffer.ok()) {
+      return false;
+    }
+    std::shared_ptr<Buffer> buffer = *std::move(maybe_buffer);
+    uint8_t* dest = buffer->mutable_data();
+    for (uint64_t remaining = length; remaining > 0;) {
+      if (!Advance()) {
+        return false;
+      }
+      const size_t chunk = std::min<uint64_t>(remaining, SliceRemaining());
+      std::memcpy(dest, GRPC_SLICE_START_PTR(slices_[index_]) + offset_, chunk);
+      dest += chunk;
+      offset_ += chunk;
+      remaining -= chunk;
+    }
+    *out = std::move(buffer);
+    *copied = true;
+    return true;
   }
 
  private:
-  grpc_slice slice_;
+  size_t SliceRemaining() const { return GRPC_SLICE_LENGTH(slices_[index_]) - offset_; }
+
+  // Move past the exhausted slices, return false at the end of the message
+  bool Advance() {
+    while (index_ < num_slices_ && offset_ == GRPC_SLICE_LENGTH(slices_[index_])) {
+      ++index_;
+      offset_ = 0;
+    }
+    return index_ < num_slices_;
+  }
+
+  const grpc_slice* slices_;
+  const size_t num_slices_;
+  size_t index_ = 0;
+  size_t offset_ = 0;
+  std::vector<std::shared_ptr<Buffer>> wrapped_slices_;
 };
 
+static bool SkipField(SliceReader* reader, uint32_t tag) {
+  uint64_t value;
+  switch (WireFormatLite::GetTagWireType(tag)) {
+    case WireFormatLite::WIRETYPE_VARINT:
+      return reader->ReadVarint(&value);
+    case WireFormatLite::WIRETYPE_FIXED64:
+      return reader->Skip(8);
+    case WireFormatLite::WIRETYPE_LENGTH_DELIMITED:
+      return reader->ReadVarint(&value) && reader->Skip(value);
+    case WireFormatLite::WIRETYPE_FIXED32:
+      return reader->Skip(4);
+    default:
+      // Groups are deprecated and not used by Flight
+      return false;
+  }
+}
+
 // Destructor callback for grpc::Slice
 static void ReleaseBuffer(void* buf_ptr) {
   delete reinterpret_cast<std::shared_ptr<Buffer>*>(buf_ptr);
@@ -165,6 +253,10 @@ arrow::Result<::grpc::Slice> SliceFromBuffer(const std::shared_ptr<Buffer>& buf)
     // Non-CPU buffer, must copy to CPU-accessible buffer first
     ARROW_ASSIGN_OR_RAISE(auto cpu_buf,
                           Buffer::ViewOrCopy(buf, default_cpu_memory_manager()));
+    if (cpu_buf->address() != buf->address()) {
+      num_body_copies_sent.fetch_add(1, std::memory_order_relaxed);
+      body_bytes_copied_sent.fetch_add(cpu_buf->size(), std::memory_order_relaxed);
+    }
     ptr = new std::shared_ptr<Buffer>(cpu_buf);
   }
   ::grpc::Slice slice(const_cast<uint8_t*>((*ptr)->data()),
@@ -238,6 +330,9 @@ static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
 
   // Allocate and initialize slices
   std::vector<::grpc::Slice> slices;
+  // The header stream writes into the first slice, which must not move: small
+  // slices are inlined into the structure. Each body buffer may need padding.
+  slices.reserve(1 + 2 * ipc_msg.body_buffers.size());
   slices.emplace_back(header_size);
 
   // Force the header_stream to be destructed, which actually flushes
@@ -298,7 +393,8 @@ static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
         const auto remainder = static_cast<int>(
             bit_util::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
         if (remainder) {
-          slices.emplace_back(kPaddingBytes, remainder);
+          // Reference the static padding instead of copying it
+          slices.emplace_back(kPaddingBytes, remainder, ::grpc::Slice::STATIC_SLICE);
         }
       }
     }
@@ -309,48 +405,30 @@ static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
   // Hand off the slices to the returned ByteBuffer
   *out = ::grpc::ByteBuffer(slices.data(), slices.size());
   *own_buffer = true;
+  num_messages_sent.fetch_add(1, std::memory_order_relaxed);
   return ::grpc::Status::OK;
 }
 
-// Read internal::FlightData from grpc::ByteBuffer containing FlightData
-// protobuf without copying
-::grpc::Status FlightDataDeserialize(ByteBuffer* buffer,
-                                     arrow::flight::internal::FlightData* out) {
-  if (!buffer) {
-    return {::grpc::StatusCode::INTERNAL, "No payload"};
-  }
-
-  // Reset fields in case the caller reuses a single allocation
-  out->descriptor = nullptr;
-  out->app_metadata = nullptr;
-  out->metadata = nullptr;
-  out->body = nullptr;
-
-  std::shared_ptr<arrow::Buffer> wrapped_buffer;
-  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
-
-  auto buffer_length = static_cast<int>(wrapped_buffer->size());
-  CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
-
-  pb_stream.SetTotalBytesLimit(buffer_length);
-
-  // This is the bytes remaining when using CodedInputStream like this
-  while (pb_stream.BytesUntilTotalBytesLimit()) {
-    const uint32_t tag = pb_stream.ReadTag();
-    const int field_number = WireFormatLite::GetTagFieldNumber(tag);
+static ::grpc::Status FlightDataParse(SliceReader* reader,
+                                      arrow::flight::internal::FlightData* out) {
+  while (!reader->AtEnd()) {
+    uint64_t tag;
+    if (!reader->ReadVarint(&tag) || tag > std::numeric_limits<uint32_t>::max()) {
+      return {::grpc::StatusCode::INTERNAL, "Unable to parse FlightData field tag"};
+    }
+    bool copied = false;
+    const int field_number =
+        WireFormatLite::GetTagFieldNumber(static_cast<uint32_t>(tag));
     switch (field_number) {
       case pb::FlightData::kFlightDescriptorFieldNumber: {
         pb::FlightDescriptor pb_descriptor;
-        uint32_t length;
-        if (!pb_stream.ReadVarint32(&length)) {
+        std::shared_ptr<Buffer> buffer;
+        if (!reader->ReadBytes(&buffer, &copied)) {
           return {::grpc::StatusCode::INTERNAL,
                   "Unable to parse length of FlightDescriptor"};
         }
-        // Can't use ParseFromCodedStream as this reads the entire
-        // rest of the stream into the descriptor command field.
-        std::string buffer;
-        pb_stream.ReadString(&buffer, length);
-        if (!pb_descriptor.ParseFromString(buffer)) {
+        if (!pb_descriptor.ParseFromArray(buffer->data(),
+                                          static_cast<int>(buffer->size()))) {
           return {::grpc::StatusCode::INTERNAL, "Unable to parse FlightDescriptor"};
         }
         arrow::flight::FlightDescriptor descriptor;
@@ -359,24 +437,29 @@ static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
         out->descriptor = std::make_unique<arrow::flight::FlightDescriptor>(descriptor);
       } break;
       case pb::FlightData::kDataHeaderFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
+        if (!reader->ReadBytes(&out->metadata, &copied)) {
           return {::grpc::StatusCode::INTERNAL, "Unable to read FlightData metadata"};
         }
       } break;
       case pb::FlightData::kAppMetadataFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->app_metadata)) {
+        if (!reader->ReadBytes(&out->app_metadata, &copied)) {
           return {::grpc::StatusCode::INTERNAL,
                   "Unable to read FlightData application metadata"};
         }
       } break;
       case pb::FlightData::kDataBodyFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
+        if (!reader->ReadBytes(&out->body, &copied)) {
           return {::grpc::StatusCode::INTERNAL, "Unable to read FlightData body"};
         }
+        if (copied) {
+          num_body_copies_received.fetch_add(1, std::memory_order_relaxed);
+          body_bytes_copied_received.fetch_add(out->body->size(),
+                                               std::memory_order_relaxed);
+        }
       } break;
       default: {
         // Unknown field. We should skip it for compatibility.
-        if (!WireFormatLite::SkipField(&pb_stream, tag)) {
+        if (!SkipField(reader, static_cast<uint32_t>(tag))) {
           return {::grpc::StatusCode::INTERNAL,
                   "Could not skip unknown field tag in FlightData"};
         }
@@ -384,6 +467,55 @@ static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
       }
     }
   }
+  num_messages_received.fetch_add(1, std::memory_order_relaxed);
+  return ::grpc::Status::OK;
+}
+
+// Read internal::FlightData from grpc::ByteBuffer containing FlightData
+// protobuf without copying
+::grpc::Status FlightDataDeserialize(ByteBuffer* buffer,
+                                     arrow::flight::internal::FlightData* out) {
+  if (!buffer) {
+    return {::grpc::StatusCode::INTERNAL, "No payload"};
+  }
+
+  // Reset fields in case the caller reuses a single allocation
+  out->descriptor = nullptr;
+  out->app_metadata = nullptr;
+  out->metadata = nullptr;
+  out->body = nullptr;
+
+  // These types are guaranteed by static assertions in gRPC to have the same
+  // in-memory representation
+  auto raw_buffer = *reinterpret_cast<grpc_byte_buffer**>(buffer);
+
+  const grpc_slice* slices;
+  size_t num_slices;
+  // Only set if the buffer had to be read into a single slice
+  grpc_slice flattened = grpc_empty_slice();
+  if (raw_buffer->type == GRPC_BB_RAW &&
+      raw_buffer->data.raw.compression == GRPC_COMPRESS_NONE) {
+    slices = raw_buffer->data.raw.slice_buffer.slices;
+    num_slices = raw_buffer->data.raw.slice_buffer.count;
+  } else {
+    // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
+    // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
+    // us back a new slice with the refcount already incremented.
+    grpc_byte_buffer_reader reader;
+    if (!grpc_byte_buffer_reader_init(&reader, raw_buffer)) {
+      return {::grpc::StatusCode::INTERNAL,
+              "Internal gRPC error reading from ByteBuffer"};
+    }
+    flattened = grpc_byte_buffer_reader_readall(&reader);
+    grpc_byte_buffer_reader_destroy(&reader);
+    slices = &flattened;
+    num_slices = 1;
+  }
+  SliceReader reader(slices, num_slices);
+  auto status = FlightDataParse(&reader, out);
+  grpc_slice_unref(flattened);
+  GRPC_RETURN_NOT_GRPC_OK(status);
+
   buffer->Clear();
 
   // TODO(wesm): Where and when should we verify that the FlightData is not
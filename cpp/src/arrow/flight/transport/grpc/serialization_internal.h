@@ -20,11 +20,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "arrow/flight/protocol_internal.h"
 #include "arrow/flight/transport/grpc/protocol_grpc_internal.h"
 #include "arrow/flight/type_fwd.h"
+#include "arrow/flight/visibility.h"
 #include "arrow/result.h"
 
 namespace arrow {
@@ -34,6 +36,24 @@ namespace grpc {
 
 namespace pb = arrow::flight::protocol;
 
+/// Counters of the IPC body data copied while (de)serializing FlightData.
+///
+/// Body buffers are normally sent as references to the Arrow buffers, and
+/// received as references to the gRPC slices. They are only copied when they
+/// are not in CPU memory (sending) or span several slices (receiving).
+struct ARROW_FLIGHT_EXPORT SerializationStats {
+  int64_t num_messages_sent = 0;
+  int64_t num_body_copies_sent = 0;
+  int64_t body_bytes_copied_sent = 0;
+  int64_t num_messages_received = 0;
+  int64_t num_body_copies_received = 0;
+  int64_t body_bytes_copied_received = 0;
+};
+
+/// Get the counters accumulated by this process so far, for benchmarking.
+ARROW_FLIGHT_EXPORT
+SerializationStats GetSerializationStats();
+
 /// Write Flight message on gRPC stream with zero-copy optimizations.
 // Returns Invalid if the payload is ill-formed
 // Returns true if the payload was written, false if it was not
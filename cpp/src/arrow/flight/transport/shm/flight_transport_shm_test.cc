@@ -0,0 +1,379 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "arrow/array/array_base.h"
+#include "arrow/flight/test_definitions.h"
+#include "arrow/flight/test_util.h"
+#include "arrow/flight/transport/shm/shm.h"
+#include "arrow/flight/transport/shm/shm_internal.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace flight {
+
+class ShmEnvironment : public ::testing::Environment {
+ public:
+  void SetUp() override { transport::shm::InitializeFlightShm(); }
+};
+
+testing::Environment* const kShmEnvironment =
+    testing::AddGlobalTestEnvironment(new ShmEnvironment());
+
+//------------------------------------------------------------
+// Common transport tests
+
+class ShmConnectivityTest : public ConnectivityTest, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  void SetUp() override { SetUpTest(); }
+  void TearDown() override { TearDownTest(); }
+};
+ARROW_FLIGHT_TEST_CONNECTIVITY(ShmConnectivityTest);
+
+class ShmDataTest : public DataTest, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  void SetUp() override { SetUpTest(); }
+  void TearDown() override { TearDownTest(); }
+};
+ARROW_FLIGHT_TEST_DATA(ShmDataTest);
+
+class ShmDoPutTest : public DoPutTest, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  void SetUp() override { SetUpTest(); }
+  void TearDown() override { TearDownTest(); }
+};
+ARROW_FLIGHT_TEST_DO_PUT(ShmDoPutTest);
+
+class ShmAppMetadataTest : public AppMetadataTest, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  void SetUp() override { SetUpTest(); }
+  void TearDown() override { TearDownTest(); }
+};
+ARROW_FLIGHT_TEST_APP_METADATA(ShmAppMetadataTest);
+
+class ShmIpcOptionsTest : public IpcOptionsTest, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  void SetUp() override { SetUpTest(); }
+  void TearDown() override { TearDownTest(); }
+};
+ARROW_FLIGHT_TEST_IPC_OPTIONS(ShmIpcOptionsTest);
+
+class ShmErrorHandlingTest : public ErrorHandlingTest, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  void SetUp() override { SetUpTest(); }
+  void TearDown() override { TearDownTest(); }
+
+  void TestGetFlightInfoMetadata() { GTEST_SKIP() << "Middleware not implemented"; }
+};
+ARROW_FLIGHT_TEST_ERROR_HANDLING(ShmErrorHandlingTest);
+
+//------------------------------------------------------------
+// Shared-memory internals tests
+
+namespace transport {
+namespace shm {
+
+TEST(SharedRegion, AcquireRelease) {
+  ASSERT_OK_AND_ASSIGN(auto region, SharedRegion::Create(/*num_slots=*/2, 100));
+  // Slot sizes are padded for alignment
+  ASSERT_EQ(region->slot_size(), 128);
+
+  const int32_t slot0 = region->AcquireSlot(PoolId::kClientToServer, 0);
+  const int32_t slot1 = region->AcquireSlot(PoolId::kClientToServer, 0);
+  ASSERT_GE(slot0, 0);
+  ASSERT_GE(slot1, 0);
+  ASSERT_NE(slot0, slot1);
+  ASSERT_EQ(region->AcquireSlot(PoolId::kClientToServer, /*timeout_us=*/1000), -1);
+  // The pools are independent
+  const int32_t other = region->AcquireSlot(PoolId::kServerToClient, 0);
+  ASSERT_GE(other, 0);
+  region->ReleaseSlot(PoolId::kServerToClient, other);
+
+  region->ReleaseSlot(PoolId::kClientToServer, slot1);
+  ASSERT_EQ(region->AcquireSlot(PoolId::kClientToServer, 0), slot1);
+  region->ReleaseSlot(PoolId::kClientToServer, slot0);
+  region->ReleaseSlot(PoolId::kClientToServer, slot1);
+}
+
+TEST(SharedRegion, WrapSlot) {
+  ASSERT_OK_AND_ASSIGN(auto region, SharedRegion::Create(/*num_slots=*/1, 64));
+  const int32_t slot = region->AcquireSlot(PoolId::kServerToClient, 0);
+  ASSERT_EQ(slot, 0);
+  std::memcpy(region->slot_data(PoolId::kServerToClient, slot), "hello", 5);
+
+  // Map the region a second time, as the peer does
+  const int fd = dup(region->fd());
+  ASSERT_GE(fd, 0);
+  ASSERT_OK_AND_ASSIGN(auto peer_region, SharedRegion::Open(fd));
+  auto buffer = peer_region->WrapSlot(PoolId::kServerToClient, slot, 5);
+  ASSERT_EQ(buffer->ToString(), "hello");
+  ASSERT_EQ(peer_region->num_held_slots(PoolId::kServerToClient), 1);
+  // The slot goes back to the writer once the reader is done with it
+  ASSERT_EQ(region->AcquireSlot(PoolId::kServerToClient, 0), -1);
+  buffer.reset();
+  ASSERT_EQ(peer_region->num_held_slots(PoolId::kServerToClient), 0);
+  ASSERT_EQ(region->AcquireSlot(PoolId::kServerToClient, 0), slot);
+}
+
+TEST(SharedRegion, InvalidLayout) {
+  ASSERT_RAISES(Invalid, SharedRegion::Create(/*num_slots=*/0, 64));
+  ASSERT_RAISES(Invalid, SharedRegion::Create(kMaxNumSlots + 1, 64));
+  ASSERT_RAISES(Invalid, SharedRegion::Create(/*num_slots=*/1, 0));
+}
+
+TEST(UriToSockaddr, Basics) {
+  struct sockaddr_un addr;
+  socklen_t addrlen;
+  ASSERT_OK_AND_ASSIGN(auto uri, arrow::util::Uri::FromString("shm://localhost:1234"));
+  ASSERT_OK(UriToSockaddr(uri, &addr, &addrlen));
+  // An abstract socket
+  ASSERT_EQ(addr.sun_path[0], '\0');
+  ASSERT_EQ(std::string(addr.sun_path + 1, addrlen - offsetof(sockaddr_un, sun_path) - 1),
+            "arrow-flight-shm:1234");
+
+  ASSERT_OK_AND_ASSIGN(uri, arrow::util::Uri::FromString("shm:///tmp/flight.sock"));
+  ASSERT_OK(UriToSockaddr(uri, &addr, &addrlen));
+  ASSERT_STREQ(addr.sun_path, "/tmp/flight.sock");
+
+  ASSERT_OK_AND_ASSIGN(uri, arrow::util::Uri::FromString("shm://localhost"));
+  ASSERT_RAISES(Invalid, UriToSockaddr(uri, &addr, &addrlen));
+}
+
+class TestConnection : public ::testing::Test {
+ public:
+  void SetUp() override {
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds), 0);
+    ASSERT_OK_AND_ASSIGN(auto region, SharedRegion::Create(/*num_slots=*/2, 4096));
+    const int region_fd = dup(region->fd());
+    ASSERT_GE(region_fd, 0);
+    ASSERT_OK_AND_ASSIGN(auto peer_region, SharedRegion::Open(region_fd));
+    client_ = std::make_unique<Connection>(::arrow::internal::FileDescriptor(fds[0]),
+                                           std::move(region), /*is_client=*/true);
+    server_ = std::make_unique<Connection>(::arrow::internal::FileDescriptor(fds[1]),
+                                           std::move(peer_region), /*is_client=*/false);
+  }
+
+  void CheckPayloadRoundTrip(int64_t body_size, FrameType expected_type) {
+    std::string body(static_cast<size_t>(body_size), 'x');
+    FlightPayload payload;
+    payload.app_metadata = Buffer::FromString("metadata");
+    payload.ipc_message.metadata = Buffer::FromString("header");
+    payload.ipc_message.body_buffers.push_back(Buffer::FromString(body));
+    payload.ipc_message.body_length = body_size;
+    ASSERT_OK(client_->SendPayload(payload));
+
+    ASSERT_OK_AND_ASSIGN(auto frame, server_->ReadFrame());
+    ASSERT_EQ(frame.type, expected_type);
+    internal::FlightData data;
+    ASSERT_OK(server_->ReadPayload(&frame, &data));
+    ASSERT_EQ(data.descriptor, nullptr);
+    ASSERT_EQ(data.app_metadata->ToString(), "metadata");
+    ASSERT_EQ(data.metadata->ToString(), "header");
+    ASSERT_EQ(data.body->ToString(), body);
+  }
+
+ protected:
+  std::unique_ptr<Connection> client_;
+  std::unique_ptr<Connection> server_;
+};
+
+TEST_F(TestConnection, Call) {
+  std::vector<std::pair<std::string, std::string>> headers = {{"x-foo", "bar"},
+                                                              {"x-bin", "\x01"}};
+  ASSERT_OK(client_->SendCall(kMethodGetFlightInfo, headers));
+  ASSERT_OK_AND_ASSIGN(auto frame, server_->ReadFrame());
+  ASSERT_EQ(frame.type, FrameType::kCall);
+  std::string method;
+  std::vector<std::pair<std::string, std::string>> actual_headers;
+  ASSERT_OK(Connection::ParseCall(frame, &method, &actual_headers));
+  ASSERT_EQ(method, kMethodGetFlightInfo);
+  ASSERT_EQ(actual_headers, headers);
+}
+
+TEST_F(TestConnection, Status) {
+  for (const auto& expected :
+       {Status::OK(), Status::Invalid("foo"),
+        Status::IOError("bar", std::make_shared<FlightStatusDetail>(
+                                   FlightStatusCode::Unavailable, "extra"))}) {
+    ASSERT_OK(server_->SendStatus(expected));
+    ASSERT_OK_AND_ASSIGN(auto frame, client_->ReadFrame());
+    ASSERT_EQ(frame.type, FrameType::kStatus);
+    Status actual;
+    ASSERT_OK(Connection::ParseStatus(frame, &actual));
+    ASSERT_EQ(actual.code(), expected.code()) << actual.ToString();
+    ASSERT_THAT(actual.message(), ::testing::HasSubstr(expected.message()));
+    auto detail = FlightStatusDetail::UnwrapStatus(expected);
+    if (detail) {
+      auto actual_detail = FlightStatusDetail::UnwrapStatus(actual);
+      ASSERT_NE(actual_detail, nullptr) << actual.ToString();
+      ASSERT_EQ(actual_detail->code(), detail->code());
+      ASSERT_EQ(actual_detail->extra_info(), detail->extra_info());
+    }
+  }
+}
+
+TEST_F(TestConnection, SlotPayload) {
+  CheckPayloadRoundTrip(/*body_size=*/96, FrameType::kSlotData);
+}
+
+TEST_F(TestConnection, MemfdPayload) {
+  // Larger than a slot
+  CheckPayloadRoundTrip(/*body_size=*/10000, FrameType::kFdData);
+}
+
+TEST_F(TestConnection, SlotsExhausted) {
+  // Payloads that nobody reads must not block the writer
+  for (int i = 0; i < 3; i++) {
+    CheckPayloadRoundTrip(/*body_size=*/96, FrameType::kSlotData);
+  }
+  FlightPayload payload;
+  payload.ipc_message.metadata = Buffer::FromString("header");
+  for (int i = 0; i < 3; i++) {
+    ASSERT_OK(client_->SendPayload(payload));
+  }
+  for (int i = 0; i < 3; i++) {
+    ASSERT_OK_AND_ASSIGN(auto frame, server_->ReadFrame());
+    ASSERT_THAT(frame.type, ::testing::AnyOf(FrameType::kSlotData, FrameType::kFdData));
+  }
+}
+
+TEST_F(TestConnection, Timeout) {
+  ASSERT_OK(client_->SetTimeout(0.01));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, ::testing::HasSubstr("Deadline"),
+                                  client_->ReadFrame());
+  ASSERT_TRUE(client_->broken());
+}
+
+}  // namespace shm
+}  // namespace transport
+
+//------------------------------------------------------------
+// Ad-hoc shared-memory tests
+
+class SimpleTestServer : public FlightServerBase {
+ public:
+  Status GetFlightInfo(const ServerCallContext& context, const FlightDescriptor& request,
+                       std::unique_ptr<FlightInfo>* info) override {
+    auto examples = ExampleFlightInfo();
+    info->reset(new FlightInfo(examples[0]));
+    return Status::OK();
+  }
+
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    RecordBatchVector batches;
+    RETURN_NOT_OK(ExampleIntBatches(&batches));
+    auto batch_reader = std::make_shared<BatchIterator>(batches[0]->schema(), batches);
+    *data_stream = std::make_unique<RecordBatchStream>(batch_reader);
+    return Status::OK();
+  }
+};
+
+class TestShm : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme("shm", "localhost", 0));
+    ASSERT_OK(MakeServer<SimpleTestServer>(
+        location, &server_, &client_,
+        [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+  }
+
+  void TearDown() {
+    ASSERT_OK(client_->Close());
+    ASSERT_OK(server_->Shutdown());
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+TEST_F(TestShm, GetFlightInfo) {
+  auto descriptor = FlightDescriptor::Path({"foo", "bar"});
+  std::unique_ptr<FlightInfo> info;
+  ASSERT_OK_AND_ASSIGN(info, client_->GetFlightInfo(descriptor));
+  // Test that we can reuse the connection
+  ASSERT_OK_AND_ASSIGN(info, client_->GetFlightInfo(descriptor));
+}
+
+TEST_F(TestShm, ConcurrentStreams) {
+  Ticket ticket{"a"};
+
+  ASSERT_OK_AND_ASSIGN(auto stream1, client_->DoGet(ticket));
+  ASSERT_OK_AND_ASSIGN(auto stream2, client_->DoGet(ticket));
+
+  ASSERT_OK_AND_ASSIGN(auto table1, stream1->ToTable());
+  ASSERT_OK_AND_ASSIGN(auto table2, stream2->ToTable());
+
+  AssertTablesEqual(*table1, *table2);
+}
+
+TEST_F(TestShm, SmallSlots) {
+  // Every payload goes through its own memfd
+  auto options = FlightClientOptions::Defaults();
+  options.generic_options.emplace_back(transport::shm::kOptionNumSlots, 1);
+  options.generic_options.emplace_back(transport::shm::kOptionSlotSize, 64);
+  ASSERT_OK_AND_ASSIGN(auto client, FlightClient::Connect(server_->location(), options));
+
+  Ticket ticket{"a"};
+  ASSERT_OK_AND_ASSIGN(auto stream1, client_->DoGet(ticket));
+  ASSERT_OK_AND_ASSIGN(auto table1, stream1->ToTable());
+  ASSERT_OK_AND_ASSIGN(auto stream2, client->DoGet(ticket));
+  ASSERT_OK_AND_ASSIGN(auto table2, stream2->ToTable());
+  AssertTablesEqual(*table1, *table2);
+  ASSERT_OK(client->Close());
+}
+
+TEST_F(TestShm, InvalidOptions) {
+  auto options = FlightClientOptions::Defaults();
+  options.generic_options.emplace_back(transport::shm::kOptionNumSlots, "many");
+  ASSERT_RAISES(Invalid, FlightClient::Connect(server_->location(), options));
+}
+
+TEST(TestShmSocketFile, GetFlightInfo) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       ::arrow::internal::TemporaryDir::Make("flight-shm-test-"));
+  ASSERT_OK_AND_ASSIGN(auto path, temp_dir->path().Join("flight.sock"));
+  ASSERT_OK_AND_ASSIGN(auto location, Location::Parse("shm://" + path.ToString()));
+
+  std::unique_ptr<FlightServerBase> server(new SimpleTestServer());
+  ASSERT_OK(server->Init(FlightServerOptions(location)));
+  ASSERT_EQ(server->location(), location);
+
+  ASSERT_OK_AND_ASSIGN(auto client, FlightClient::Connect(location));
+  auto descriptor = FlightDescriptor::Path({"foo", "bar"});
+  ASSERT_OK_AND_ASSIGN(auto info, client->GetFlightInfo(descriptor));
+  ASSERT_OK(client->Close());
+  ASSERT_OK(server->Shutdown());
+}
+
+}  // namespace flight
+}  // namespace arrow
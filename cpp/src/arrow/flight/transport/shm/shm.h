@@ -0,0 +1,41 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// Experimental shared-memory transport for Flight (Linux only).
+
+#pragma once
+
+#include "arrow/flight/visibility.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+/// \brief Register the "shm" transport for clients and servers.
+///
+/// The transport serves clients on the same host: calls are framed
+/// over a Unix socket and IPC payloads are handed over in shared
+/// memory, so that readers do not copy them. Servers listen on
+/// `shm://localhost:<port>` (an abstract socket) or `shm:///<path>`
+/// (a socket file).
+ARROW_FLIGHT_EXPORT
+void InitializeFlightShm();
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
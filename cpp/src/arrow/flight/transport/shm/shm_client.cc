@@ -0,0 +1,424 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+/// The client-side implementation of the shared-memory transport.
+///
+/// Like the UCX transport, each connection carries one call at a time,
+/// so the client keeps a small pool of idle connections and opens a new
+/// one when a call starts while all the others are busy.
+
+#include "arrow/flight/transport/shm/shm_internal.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/client.h"
+#include "arrow/flight/transport.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/uri.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+namespace {
+class ShmClientImpl;
+
+Status MergeStatuses(Status server_status, Status transport_status) {
+  if (server_status.ok()) {
+    if (transport_status.ok()) return server_status;
+    return transport_status;
+  } else if (transport_status.ok()) {
+    return server_status;
+  }
+  return Status::FromDetailAndArgs(server_status.code(), server_status.detail(),
+                                   server_status.message(),
+                                   ". Transport context: ", transport_status.ToString());
+}
+
+class ShmClientStream : public internal::ClientDataStream {
+ public:
+  ShmClientStream(ShmClientImpl* impl, std::unique_ptr<Connection> conn,
+                  bool can_write)
+      : impl_(impl), conn_(std::move(conn)), writes_done_(!can_write) {}
+
+  ~ShmClientStream() override {
+    if (conn_) {
+      ARROW_WARN_NOT_OK(Finish(Status::OK()), "Shared-memory stream was not finished");
+    }
+  }
+
+  bool ReadData(internal::FlightData* data) override {
+    std::lock_guard<std::mutex> guard(read_mutex_);
+    auto frame = ReadNextFrame();
+    if (!frame) return false;
+    if (frame->type != FrameType::kSlotData && frame->type != FrameType::kFdData) {
+      SetIoError(Status::IOError("Unexpected frame type ",
+                                 static_cast<int>(frame->type), " in data stream"));
+      return false;
+    }
+    Status status = conn_->ReadPayload(&*frame, data);
+    if (!status.ok()) {
+      SetIoError(std::move(status));
+      return false;
+    }
+    return true;
+  }
+
+  bool ReadPutMetadata(std::shared_ptr<Buffer>* out) override {
+    std::lock_guard<std::mutex> guard(read_mutex_);
+    auto frame = ReadNextFrame();
+    if (!frame) {
+      *out = nullptr;
+      return false;
+    }
+    if (frame->type != FrameType::kBuffer) {
+      SetIoError(Status::IOError("Unexpected frame type ",
+                                 static_cast<int>(frame->type), " in DoPut"));
+      *out = nullptr;
+      return false;
+    }
+    *out = std::move(frame->buffer);
+    return true;
+  }
+
+  arrow::Result<bool> WriteData(const FlightPayload& payload) override {
+    std::lock_guard<std::mutex> guard(write_mutex_);
+    if (writes_done_ || conn_->broken()) return false;
+    Status status = conn_->SendPayload(payload);
+    if (!status.ok()) {
+      if (conn_->broken()) {
+        // The server went away; Finish() reports why
+        return false;
+      }
+      return status;
+    }
+    return true;
+  }
+
+  Status WritesDone() override {
+    std::lock_guard<std::mutex> guard(write_mutex_);
+    if (writes_done_) return Status::OK();
+    writes_done_ = true;
+    if (conn_->broken()) return Status::OK();
+    return conn_->SendFrame(FrameType::kWritesDone, nullptr, 0);
+  }
+
+  void TryCancel() override {
+    std::lock_guard<std::mutex> guard(cancel_mutex_);
+    cancelled_.store(true);
+    if (conn_) conn_->Shutdown();
+  }
+
+ protected:
+  Status DoFinish() override;
+
+ private:
+  // Read the next frame, or record the end of the call
+  std::optional<Frame> ReadNextFrame() {
+    if (finished_) return std::nullopt;
+    auto maybe_frame = conn_->ReadFrame();
+    if (!maybe_frame.ok()) {
+      SetIoError(maybe_frame.status());
+      return std::nullopt;
+    }
+    if (maybe_frame->type == FrameType::kStatus) {
+      finished_ = true;
+      io_status_ &= Connection::ParseStatus(*maybe_frame, &server_status_);
+      return std::nullopt;
+    }
+    return maybe_frame.MoveValueUnsafe();
+  }
+
+  void SetIoError(Status status) {
+    finished_ = true;
+    if (cancelled_.load()) {
+      status = Status::Cancelled("Call was cancelled");
+    }
+    if (io_status_.ok()) io_status_ = std::move(status);
+    // The frames left of this call can't be told from the next call's
+    conn_->Shutdown();
+  }
+
+  ShmClientImpl* impl_;
+  std::unique_ptr<Connection> conn_;
+  std::mutex read_mutex_;
+  std::mutex write_mutex_;
+  std::mutex finish_mutex_;
+  std::mutex cancel_mutex_;
+  bool writes_done_;
+  bool finished_ = false;
+  std::atomic<bool> cancelled_{false};
+  Status io_status_;
+  Status server_status_;
+};
+
+class ShmClientImpl : public arrow::flight::internal::ClientTransport {
+ public:
+  ShmClientImpl() = default;
+
+  ~ShmClientImpl() override {
+    ARROW_WARN_NOT_OK(Close(), "ShmClientImpl errored in Close() in destructor");
+  }
+
+  Status Init(const FlightClientOptions& options, const Location& location,
+              const arrow::util::Uri& uri) override {
+    RETURN_NOT_OK(UriToSockaddr(uri, &addr_, &addrlen_));
+    for (const auto& option : options.generic_options) {
+      if (option.first == kOptionNumSlots || option.first == kOptionSlotSize) {
+        const int* value = std::get_if<int>(&option.second);
+        if (value == nullptr) {
+          return Status::Invalid("Option ", option.first, " must be an integer");
+        }
+        if (option.first == kOptionNumSlots) {
+          num_slots_ = *value;
+        } else {
+          slot_size_ = *value;
+        }
+      }
+    }
+    // Connect eagerly so that a wrong location fails here
+    ARROW_ASSIGN_OR_RAISE(auto conn,
+                          Connection::Connect(addr_, addrlen_, num_slots_, slot_size_));
+    std::lock_guard<std::mutex> guard(connections_mutex_);
+    connections_.push_back(std::move(conn));
+    return Status::OK();
+  }
+
+  Status Close() override {
+    std::lock_guard<std::mutex> guard(connections_mutex_);
+    connections_.clear();
+    return Status::OK();
+  }
+
+  Status GetFlightInfo(const FlightCallOptions& options,
+                       const FlightDescriptor& descriptor,
+                       std::unique_ptr<FlightInfo>* info) override {
+    ARROW_ASSIGN_OR_RAISE(std::string request, descriptor.SerializeToString());
+    return UnaryCall(options, kMethodGetFlightInfo, request,
+                     [&](std::string_view response) {
+                       return FlightInfo::Deserialize(response).Value(info);
+                     });
+  }
+
+  Status PollFlightInfo(const FlightCallOptions& options,
+                        const FlightDescriptor& descriptor,
+                        std::unique_ptr<PollInfo>* info) override {
+    ARROW_ASSIGN_OR_RAISE(std::string request, descriptor.SerializeToString());
+    return UnaryCall(options, kMethodPollFlightInfo, request,
+                     [&](std::string_view response) {
+                       return PollInfo::Deserialize(response).Value(info);
+                     });
+  }
+
+  arrow::Result<std::unique_ptr<SchemaResult>> GetSchema(
+      const FlightCallOptions& options, const FlightDescriptor& descriptor) override {
+    ARROW_ASSIGN_OR_RAISE(std::string request, descriptor.SerializeToString());
+    std::unique_ptr<SchemaResult> result;
+    RETURN_NOT_OK(UnaryCall(options, kMethodGetSchema, request,
+                            [&](std::string_view response) {
+                              ARROW_ASSIGN_OR_RAISE(auto schema_result,
+                                                    SchemaResult::Deserialize(response));
+                              result = std::make_unique<SchemaResult>(
+                                  std::move(schema_result));
+                              return Status::OK();
+                            }));
+    if (!result) {
+      return Status::IOError("Server did not send a schema");
+    }
+    return result;
+  }
+
+  Status ListFlights(const FlightCallOptions& options, const Criteria& criteria,
+                     std::unique_ptr<FlightListing>* listing) override {
+    ARROW_ASSIGN_OR_RAISE(std::string request, criteria.SerializeToString());
+    std::vector<FlightInfo> flights;
+    RETURN_NOT_OK(UnaryCall(options, kMethodListFlights, request,
+                            [&](std::string_view response) {
+                              ARROW_ASSIGN_OR_RAISE(auto info,
+                                                    FlightInfo::Deserialize(response));
+                              flights.push_back(std::move(*info));
+                              return Status::OK();
+                            }));
+    *listing = std::make_unique<SimpleFlightListing>(std::move(flights));
+    return Status::OK();
+  }
+
+  Status ListActions(const FlightCallOptions& options,
+                     std::vector<ActionType>* actions) override {
+    return UnaryCall(options, kMethodListActions, "", [&](std::string_view response) {
+      ARROW_ASSIGN_OR_RAISE(auto action_type, ActionType::Deserialize(response));
+      actions->push_back(std::move(action_type));
+      return Status::OK();
+    });
+  }
+
+  Status DoAction(const FlightCallOptions& options, const Action& action,
+                  std::unique_ptr<ResultStream>* results) override {
+    ARROW_ASSIGN_OR_RAISE(std::string request, action.SerializeToString());
+    std::vector<Result> received;
+    RETURN_NOT_OK(UnaryCall(options, kMethodDoAction, request,
+                            [&](std::string_view response) {
+                              ARROW_ASSIGN_OR_RAISE(auto result,
+                                                    Result::Deserialize(response));
+                              received.push_back(std::move(result));
+                              return Status::OK();
+                            }));
+    *results = std::make_unique<SimpleResultStream>(std::move(received));
+    return Status::OK();
+  }
+
+  Status DoGet(const FlightCallOptions& options, const Ticket& ticket,
+               std::unique_ptr<internal::ClientDataStream>* stream) override {
+    ARROW_ASSIGN_OR_RAISE(std::string request, ticket.SerializeToString());
+    ARROW_ASSIGN_OR_RAISE(auto conn, CheckoutConnection(options));
+    RETURN_NOT_OK(conn->SendCall(kMethodDoGet, options.headers));
+    RETURN_NOT_OK(conn->SendFrame(FrameType::kBuffer, request));
+    *stream = std::make_unique<ShmClientStream>(this, std::move(conn),
+                                                /*can_write=*/false);
+    return Status::OK();
+  }
+
+  Status DoPut(const FlightCallOptions& options,
+               std::unique_ptr<internal::ClientDataStream>* stream) override {
+    ARROW_ASSIGN_OR_RAISE(auto conn, CheckoutConnection(options));
+    RETURN_NOT_OK(conn->SendCall(kMethodDoPut, options.headers));
+    *stream = std::make_unique<ShmClientStream>(this, std::move(conn),
+                                                /*can_write=*/true);
+    return Status::OK();
+  }
+
+  Status DoExchange(const FlightCallOptions& options,
+                    std::unique_ptr<internal::ClientDataStream>* stream) override {
+    ARROW_ASSIGN_OR_RAISE(auto conn, CheckoutConnection(options));
+    RETURN_NOT_OK(conn->SendCall(kMethodDoExchange, options.headers));
+    *stream = std::make_unique<ShmClientStream>(this, std::move(conn),
+                                                /*can_write=*/true);
+    return Status::OK();
+  }
+
+  arrow::Result<std::unique_ptr<Connection>> CheckoutConnection(
+      const FlightCallOptions& options) {
+    std::unique_ptr<Connection> conn;
+    {
+      std::lock_guard<std::mutex> guard(connections_mutex_);
+      if (!connections_.empty()) {
+        conn = std::move(connections_.front());
+        connections_.pop_front();
+      }
+    }
+    if (!conn) {
+      ARROW_ASSIGN_OR_RAISE(conn,
+                            Connection::Connect(addr_, addrlen_, num_slots_, slot_size_));
+    }
+    RETURN_NOT_OK(conn->SetTimeout(options.timeout.count()));
+    conn->set_read_memory_pool(options.read_options.memory_pool);
+    return conn;
+  }
+
+  void ReturnConnection(std::unique_ptr<Connection> conn) {
+    if (conn->broken()) return;
+    std::lock_guard<std::mutex> guard(connections_mutex_);
+    if (connections_.size() < kMaxIdleConnections) {
+      connections_.push_back(std::move(conn));
+    }
+  }
+
+ private:
+  // A call sending one request and receiving any number of responses
+  template <typename OnResponse>
+  Status UnaryCall(const FlightCallOptions& options, const char* method,
+                   std::string_view request, OnResponse&& on_response) {
+    ARROW_ASSIGN_OR_RAISE(auto conn, CheckoutConnection(options));
+    RETURN_NOT_OK(conn->SendCall(method, options.headers));
+    RETURN_NOT_OK(conn->SendFrame(FrameType::kBuffer, request));
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto frame, conn->ReadFrame());
+      if (frame.type == FrameType::kStatus) {
+        Status server_status;
+        RETURN_NOT_OK(Connection::ParseStatus(frame, &server_status));
+        ReturnConnection(std::move(conn));
+        return server_status;
+      }
+      if (frame.type != FrameType::kBuffer) {
+        return Status::IOError("Unexpected frame type ", static_cast<int>(frame.type),
+                               " in response to ", method);
+      }
+      Status status = on_response(frame.view());
+      if (!status.ok()) {
+        // Leave the connection, whose remaining frames we won't read
+        return status;
+      }
+    }
+  }
+
+  static constexpr size_t kMaxIdleConnections = 3;
+
+  struct sockaddr_un addr_;
+  socklen_t addrlen_ = 0;
+  int32_t num_slots_ = kDefaultNumSlots;
+  int64_t slot_size_ = kDefaultSlotSize;
+  std::mutex connections_mutex_;
+  std::deque<std::unique_ptr<Connection>> connections_;
+};
+
+Status ShmClientStream::DoFinish() {
+  Status status = WritesDone();
+  // Both reader and writer may be used concurrently, and both may
+  // call Finish() - prevent concurrent state mutation
+  std::lock_guard<std::mutex> guard(finish_mutex_);
+  if (!conn_) {
+    return MergeStatuses(server_status_, io_status_);
+  }
+  {
+    // Skip what the application did not read, up to the final status
+    std::lock_guard<std::mutex> read_guard(read_mutex_);
+    while (ReadNextFrame()) {
+    }
+  }
+  if (!status.ok() && io_status_.ok()) {
+    io_status_ = std::move(status);
+  }
+  std::unique_ptr<Connection> conn;
+  {
+    std::lock_guard<std::mutex> cancel_guard(cancel_mutex_);
+    conn = std::move(conn_);
+  }
+  impl_->ReturnConnection(std::move(conn));
+  return MergeStatuses(server_status_, io_status_);
+}
+}  // namespace
+
+std::unique_ptr<arrow::flight::internal::ClientTransport> MakeShmClientImpl() {
+  return std::make_unique<ShmClientImpl>();
+}
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,919 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/transport/shm/shm_internal.h"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <optional>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "arrow/flight/types.h"
+#include "arrow/ipc/message.h"
+#include "arrow/memory_pool.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+
+#ifndef MFD_CLOEXEC
+#  define MFD_CLOEXEC 0x0001U
+#endif
+#ifndef MFD_ALLOW_SEALING
+#  define MFD_ALLOW_SEALING 0x0002U
+#endif
+#ifndef F_ADD_SEALS
+#  define F_ADD_SEALS 1033
+#  define F_GET_SEALS 1034
+#  define F_SEAL_SEAL 0x0001
+#  define F_SEAL_SHRINK 0x0002
+#  define F_SEAL_GROW 0x0004
+#  define F_SEAL_WRITE 0x0008
+#endif
+
+namespace arrow {
+
+using internal::FileDescriptor;
+using internal::IOErrorFromErrno;
+using internal::ToChars;
+
+namespace flight {
+namespace transport {
+namespace shm {
+
+namespace {
+
+constexpr uint64_t kRegionMagic = 0x4d48532d54484746;  // "FGHT-SHM"
+constexpr uint32_t kProtocolVersion = 1;
+// Region header, then one pool header per direction, then the slots
+constexpr int64_t kPoolHeaderOffset = 64;
+constexpr int64_t kSlotsOffset = 4096;
+constexpr int64_t kSlotAlignment = 64;
+// Frames bigger than this are rejected as corrupt
+constexpr int64_t kMaxFrameSize = int64_t(1) << 31;
+// How long a writer waits for the reader to give a slot back, before
+// sending the payload in its own memfd instead
+constexpr int64_t kSlotWaitMicros = 2000;
+// Small payloads are copied out of their slot, so that the slot can be
+// reused at once
+constexpr int64_t kCopyThreshold = 64 * 1024;
+
+struct RegionHeader {
+  uint64_t magic;
+  uint32_t version;
+  int32_t num_slots;
+  int64_t slot_size;
+};
+
+struct FrameHeader {
+  uint32_t type;
+  uint32_t reserved;
+  int64_t size;
+};
+
+// The body of a kSlotData or kFdData frame. The payload fields are laid
+// out one after the other in the slot or memfd; sizes are -1 for a
+// missing field.
+struct DataHeader {
+  int32_t slot;
+  int32_t reserved;
+  int64_t descriptor_size;
+  int64_t app_metadata_size;
+  int64_t metadata_size;
+  int64_t body_size;
+};
+
+struct PayloadLayout {
+  int64_t descriptor_offset;
+  int64_t app_metadata_offset;
+  int64_t metadata_offset;
+  int64_t body_offset;
+  int64_t total_size;
+};
+
+PayloadLayout ComputeLayout(const DataHeader& header) {
+  PayloadLayout layout;
+  int64_t offset = 0;
+  auto place = [&](int64_t size, int64_t alignment) {
+    offset = bit_util::RoundUpToPowerOf2(offset, alignment);
+    const int64_t field_offset = offset;
+    offset += std::max<int64_t>(size, 0);
+    return field_offset;
+  };
+  layout.descriptor_offset = place(header.descriptor_size, 8);
+  layout.app_metadata_offset = place(header.app_metadata_size, 8);
+  layout.metadata_offset = place(header.metadata_size, 8);
+  layout.body_offset = place(header.body_size, kSlotAlignment);
+  layout.total_size = offset;
+  return layout;
+}
+
+int64_t FieldSize(const std::shared_ptr<Buffer>& buffer) {
+  return buffer ? buffer->size() : -1;
+}
+
+Status CopyPayload(const FlightPayload& payload, const PayloadLayout& layout,
+                   uint8_t* out) {
+  auto copy_field = [&](const std::shared_ptr<Buffer>& buffer, int64_t offset) {
+    if (buffer && buffer->size() > 0) {
+      std::memcpy(out + offset, buffer->data(), static_cast<size_t>(buffer->size()));
+    }
+  };
+  copy_field(payload.descriptor, layout.descriptor_offset);
+  copy_field(payload.app_metadata, layout.app_metadata_offset);
+  copy_field(payload.ipc_message.metadata, layout.metadata_offset);
+  if (!payload.ipc_message.metadata) {
+    // No IPC message, hence no body
+    return Status::OK();
+  }
+
+  uint8_t* body = out + layout.body_offset;
+  int64_t offset = 0;
+  for (const auto& buffer : payload.ipc_message.body_buffers) {
+    if (!buffer || buffer->size() == 0) continue;
+    std::shared_ptr<Buffer> cpu_buffer = buffer;
+    if (!buffer->is_cpu()) {
+      ARROW_ASSIGN_OR_RAISE(cpu_buffer,
+                            Buffer::ViewOrCopy(buffer, default_cpu_memory_manager()));
+    }
+    const int64_t size = cpu_buffer->size();
+    const int64_t padded_size = bit_util::RoundUpToMultipleOf8(size);
+    if (offset + padded_size > payload.ipc_message.body_length) {
+      return Status::Invalid("IPC body buffers exceed the body length");
+    }
+    std::memcpy(body + offset, cpu_buffer->data(), static_cast<size_t>(size));
+    std::memset(body + offset + size, 0, static_cast<size_t>(padded_size - size));
+    offset += padded_size;
+  }
+  std::memset(body + offset, 0,
+              static_cast<size_t>(payload.ipc_message.body_length - offset));
+  return Status::OK();
+}
+
+arrow::Result<FileDescriptor> CreateMemfd(int64_t size) {
+  const int fd = static_cast<int>(
+      syscall(SYS_memfd_create, "arrow-flight-shm", MFD_CLOEXEC | MFD_ALLOW_SEALING));
+  if (fd < 0) {
+    return IOErrorFromErrno(errno, "Could not create memfd");
+  }
+  FileDescriptor memfd(fd);
+  if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    return IOErrorFromErrno(errno, "Could not resize memfd to ", size, " bytes");
+  }
+  return memfd;
+}
+
+// The memfd of a payload too large for a slot, unmapped when the
+// payload is destroyed
+class MemfdBuffer : public Buffer {
+ public:
+  MemfdBuffer(uint8_t* data, int64_t size) : Buffer(data, size) {}
+  ~MemfdBuffer() override { munmap(const_cast<uint8_t*>(data_), size_); }
+};
+
+// A slot of the region, given back when the payload is destroyed
+class SlotBuffer : public Buffer {
+ public:
+  SlotBuffer(std::shared_ptr<SharedRegion> region, PoolId pool, int32_t slot,
+             int64_t size)
+      : Buffer(region->slot_data(pool, slot), size),
+        region_(std::move(region)),
+        pool_(pool),
+        slot_(slot) {}
+  ~SlotBuffer() override;
+
+ private:
+  std::shared_ptr<SharedRegion> region_;
+  PoolId pool_;
+  int32_t slot_;
+};
+
+long FutexWait(std::atomic<uint32_t>* word, uint32_t expected, int64_t timeout_us) {
+  struct timespec timeout;
+  timeout.tv_sec = static_cast<time_t>(timeout_us / 1000000);
+  timeout.tv_nsec = static_cast<long>(timeout_us % 1000000) * 1000;
+  // Not FUTEX_PRIVATE_FLAG: the word is shared with the peer process
+  return syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected,
+                 &timeout, nullptr, 0);
+}
+
+void FutexWake(std::atomic<uint32_t>* word) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, INT_MAX, nullptr,
+          nullptr, 0);
+}
+
+void AppendInt32(std::string* out, int32_t value) {
+  out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void AppendString(std::string* out, std::optional<std::string_view> value) {
+  if (!value) {
+    AppendInt32(out, -1);
+    return;
+  }
+  AppendInt32(out, static_cast<int32_t>(value->size()));
+  out->append(value->data(), value->size());
+}
+
+// Reads back what AppendInt32 and AppendString wrote
+class FieldReader {
+ public:
+  explicit FieldReader(std::string_view data) : data_(data) {}
+
+  Status ReadInt32(int32_t* out) {
+    if (data_.size() < sizeof(int32_t)) {
+      return Status::IOError("Truncated shared-memory transport frame");
+    }
+    std::memcpy(out, data_.data(), sizeof(int32_t));
+    data_.remove_prefix(sizeof(int32_t));
+    return Status::OK();
+  }
+
+  Status ReadString(std::optional<std::string>* out) {
+    int32_t size;
+    RETURN_NOT_OK(ReadInt32(&size));
+    if (size < 0) {
+      out->reset();
+      return Status::OK();
+    }
+    if (data_.size() < static_cast<size_t>(size)) {
+      return Status::IOError("Truncated shared-memory transport frame");
+    }
+    *out = std::string(data_.substr(0, size));
+    data_.remove_prefix(size);
+    return Status::OK();
+  }
+
+  Status ReadString(std::string* out) {
+    std::optional<std::string> value;
+    RETURN_NOT_OK(ReadString(&value));
+    *out = value.value_or("");
+    return Status::OK();
+  }
+
+ private:
+  std::string_view data_;
+};
+
+}  // namespace
+
+//------------------------------------------------------------
+// SharedRegion
+
+struct SharedRegion::PoolHeader {
+  // One bit per slot, set while the slot is written or read
+  std::atomic<uint64_t> in_use;
+  // Bumped on each release; writers waiting for a slot sleep on it
+  std::atomic<uint32_t> releases;
+  std::atomic<uint32_t> waiters;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+                  std::atomic<uint32_t>::is_always_lock_free,
+              "Shared-memory atomics must be lock-free");
+static_assert(sizeof(RegionHeader) <= kPoolHeaderOffset, "Region header too large");
+
+SlotBuffer::~SlotBuffer() { region_->ReleaseSlot(pool_, slot_); }
+
+SharedRegion::~SharedRegion() {
+  if (data_ != nullptr) {
+    munmap(data_, static_cast<size_t>(size_));
+  }
+}
+
+Status SharedRegion::Map(int64_t size) {
+  void* data =
+      mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED,
+           fd_.fd(), 0);
+  if (data == MAP_FAILED) {
+    return IOErrorFromErrno(errno, "Could not map shared memory region");
+  }
+  data_ = reinterpret_cast<uint8_t*>(data);
+  size_ = size;
+  return Status::OK();
+}
+
+arrow::Result<std::shared_ptr<SharedRegion>> SharedRegion::Create(int32_t num_slots,
+                                                                  int64_t slot_size) {
+  if (num_slots < 1 || num_slots > kMaxNumSlots) {
+    return Status::Invalid("Number of shared-memory slots must be between 1 and ",
+                           kMaxNumSlots, ", got ", num_slots);
+  }
+  if (slot_size <= 0) {
+    return Status::Invalid("Shared-memory slot size must be positive, got ", slot_size);
+  }
+  slot_size = bit_util::RoundUpToPowerOf2(slot_size, kSlotAlignment);
+  const int64_t size = kSlotsOffset + 2 * num_slots * slot_size;
+
+  std::shared_ptr<SharedRegion> region(new SharedRegion());
+  ARROW_ASSIGN_OR_RAISE(region->fd_, CreateMemfd(size));
+  // The peer must not be able to truncate the region under our feet
+  if (fcntl(region->fd(), F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0) {
+    return IOErrorFromErrno(errno, "Could not seal memfd");
+  }
+  RETURN_NOT_OK(region->Map(size));
+  region->num_slots_ = num_slots;
+  region->slot_size_ = slot_size;
+
+  auto* header = reinterpret_cast<RegionHeader*>(region->data_);
+  header->magic = kRegionMagic;
+  header->version = kProtocolVersion;
+  header->num_slots = num_slots;
+  header->slot_size = slot_size;
+  for (PoolId pool : {PoolId::kClientToServer, PoolId::kServerToClient}) {
+    // The memfd is zero-filled, so construct the atomics in place
+    new (region->pool_header(pool)) PoolHeader{{0}, {0}, {0}};
+  }
+  return region;
+}
+
+arrow::Result<std::shared_ptr<SharedRegion>> SharedRegion::Open(int fd) {
+  std::shared_ptr<SharedRegion> region(new SharedRegion());
+  region->fd_ = FileDescriptor(fd);
+
+  const int seals = fcntl(fd, F_GET_SEALS);
+  if (seals < 0 || (seals & F_SEAL_SHRINK) == 0) {
+    return Status::IOError("Shared memory region is not a sealed memfd");
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    return IOErrorFromErrno(errno, "Could not stat shared memory region");
+  }
+  if (st.st_size < kSlotsOffset) {
+    return Status::IOError("Shared memory region is too small: ", st.st_size,
+                           " bytes");
+  }
+  RETURN_NOT_OK(region->Map(st.st_size));
+
+  const auto* header = reinterpret_cast<const RegionHeader*>(region->data_);
+  if (header->magic != kRegionMagic || header->version != kProtocolVersion) {
+    return Status::IOError("Unexpected shared memory region version");
+  }
+  if (header->num_slots < 1 || header->num_slots > kMaxNumSlots ||
+      header->slot_size <= 0 || header->slot_size % kSlotAlignment != 0 ||
+      kSlotsOffset + 2 * header->num_slots * header->slot_size > region->size_) {
+    return Status::IOError("Invalid shared memory region layout");
+  }
+  region->num_slots_ = header->num_slots;
+  region->slot_size_ = header->slot_size;
+  return region;
+}
+
+SharedRegion::PoolHeader* SharedRegion::pool_header(PoolId pool) const {
+  return reinterpret_cast<PoolHeader*>(data_ + kPoolHeaderOffset +
+                                       static_cast<int>(pool) * kSlotAlignment);
+}
+
+uint8_t* SharedRegion::slot_data(PoolId pool, int32_t slot) const {
+  return data_ + kSlotsOffset +
+         (static_cast<int64_t>(pool) * num_slots_ + slot) * slot_size_;
+}
+
+int32_t SharedRegion::AcquireSlot(PoolId pool, int64_t timeout_us) {
+  PoolHeader* header = pool_header(pool);
+  const uint64_t all_slots =
+      num_slots_ == 64 ? ~uint64_t(0) : (uint64_t(1) << num_slots_) - 1;
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::microseconds(timeout_us);
+  bool waiting = false;
+  int32_t slot = -1;
+  while (true) {
+    const uint32_t releases = header->releases.load();
+    uint64_t in_use = header->in_use.load();
+    while ((in_use & all_slots) != all_slots) {
+      const int32_t candidate = bit_util::CountTrailingZeros(~in_use);
+      if (header->in_use.compare_exchange_weak(in_use,
+                                               in_use | (uint64_t(1) << candidate))) {
+        slot = candidate;
+        break;
+      }
+    }
+    if (slot >= 0) break;
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= deadline) break;
+    if (!waiting) {
+      // Announce ourselves before sleeping, then look again: a release
+      // that missed the announcement has bumped `releases` already
+      header->waiters.fetch_add(1);
+      waiting = true;
+      continue;
+    }
+    FutexWait(&header->releases, releases,
+              std::chrono::duration_cast<std::chrono::microseconds>(deadline - now)
+                  .count());
+  }
+  if (waiting) {
+    header->waiters.fetch_sub(1);
+  }
+  return slot;
+}
+
+void SharedRegion::ReleaseSlot(PoolId pool, int32_t slot) {
+  PoolHeader* header = pool_header(pool);
+  header->in_use.fetch_and(~(uint64_t(1) << slot));
+  header->releases.fetch_add(1);
+  if (header->waiters.load() > 0) {
+    FutexWake(&header->releases);
+  }
+}
+
+std::shared_ptr<Buffer> SharedRegion::WrapSlot(PoolId pool, int32_t slot,
+                                               int64_t size) {
+  held_slots_[static_cast<int>(pool)].fetch_add(1);
+  return std::make_shared<SlotBuffer>(shared_from_this(), pool, slot, size);
+}
+
+int32_t SharedRegion::num_held_slots(PoolId pool) const {
+  return held_slots_[static_cast<int>(pool)].load();
+}
+
+//------------------------------------------------------------
+// Connection
+
+void PortToSockaddr(int port, struct sockaddr_un* addr, socklen_t* addrlen) {
+  std::memset(addr, 0, sizeof(*addr));
+  addr->sun_family = AF_UNIX;
+  // Abstract socket: the name starts with a NUL byte and is not a file
+  const std::string name = "arrow-flight-shm:" + ToChars(port);
+  std::memcpy(addr->sun_path + 1, name.data(), name.size());
+  *addrlen = static_cast<socklen_t>(offsetof(struct sockaddr_un, sun_path) + 1 +
+                                    name.size());
+}
+
+Status UriToSockaddr(const arrow::util::Uri& uri, struct sockaddr_un* addr,
+                     socklen_t* addrlen) {
+  if (uri.port() >= 0) {
+    PortToSockaddr(uri.port(), addr, addrlen);
+    return Status::OK();
+  }
+  const std::string path = uri.path();
+  if (path.empty()) {
+    return Status::Invalid("Shared-memory location must have a port or a path: ",
+                           uri.ToString());
+  }
+  if (path.size() >= sizeof(addr->sun_path)) {
+    return Status::Invalid("Socket path is too long: ", path);
+  }
+  std::memset(addr, 0, sizeof(*addr));
+  addr->sun_family = AF_UNIX;
+  std::memcpy(addr->sun_path, path.data(), path.size());
+  *addrlen =
+      static_cast<socklen_t>(offsetof(struct sockaddr_un, sun_path) + path.size() + 1);
+  return Status::OK();
+}
+
+Connection::Connection(FileDescriptor socket, std::shared_ptr<SharedRegion> region,
+                       bool is_client)
+    : socket_(std::move(socket)),
+      region_(std::move(region)),
+      write_pool_(is_client ? PoolId::kClientToServer : PoolId::kServerToClient),
+      read_pool_(is_client ? PoolId::kServerToClient : PoolId::kClientToServer),
+      read_memory_pool_(default_memory_pool()) {
+  struct ucred credentials;
+  socklen_t size = sizeof(credentials);
+  if (getsockopt(socket_.fd(), SOL_SOCKET, SO_PEERCRED, &credentials, &size) == 0) {
+    peer_ = "shm:pid=" + ToChars(credentials.pid);
+  } else {
+    peer_ = "shm:unknown";
+  }
+}
+
+Connection::~Connection() = default;
+
+arrow::Result<std::unique_ptr<Connection>> Connection::Connect(
+    const struct sockaddr_un& addr, socklen_t addrlen, int32_t num_slots,
+    int64_t slot_size) {
+  const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return IOErrorFromErrno(errno, "Could not create socket");
+  }
+  FileDescriptor socket(fd);
+  if (connect(fd, reinterpret_cast<const struct sockaddr*>(&addr), addrlen) != 0) {
+    return IOErrorFromErrno(errno, "Could not connect to shared-memory server");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto region, SharedRegion::Create(num_slots, slot_size));
+  const int region_fd = region->fd();
+  auto conn = std::make_unique<Connection>(std::move(socket), std::move(region),
+                                           /*is_client=*/true);
+
+  std::string hello;
+  AppendInt32(&hello, static_cast<int32_t>(kProtocolVersion));
+  RETURN_NOT_OK(conn->SendFrame(FrameType::kHello,
+                                reinterpret_cast<const uint8_t*>(hello.data()),
+                                static_cast<int64_t>(hello.size()), region_fd));
+  ARROW_ASSIGN_OR_RAISE(auto reply, conn->ReadFrame());
+  if (reply.type != FrameType::kStatus) {
+    return Status::IOError("Unexpected handshake reply from shared-memory server");
+  }
+  Status status;
+  RETURN_NOT_OK(ParseStatus(reply, &status));
+  RETURN_NOT_OK(status);
+  return conn;
+}
+
+arrow::Result<std::unique_ptr<Connection>> Connection::Accept(FileDescriptor socket) {
+  auto conn = std::make_unique<Connection>(std::move(socket), nullptr,
+                                           /*is_client=*/false);
+  ARROW_ASSIGN_OR_RAISE(auto hello, conn->ReadFrame());
+  auto handshake = [&]() -> Status {
+    if (hello.type != FrameType::kHello || hello.fd.closed()) {
+      return Status::IOError("Expected handshake from shared-memory client");
+    }
+    int32_t version;
+    RETURN_NOT_OK(FieldReader(hello.view()).ReadInt32(&version));
+    if (version != static_cast<int32_t>(kProtocolVersion)) {
+      return Status::IOError("Unsupported shared-memory protocol version ", version);
+    }
+    ARROW_ASSIGN_OR_RAISE(conn->region_, SharedRegion::Open(hello.fd.Detach()));
+    return Status::OK();
+  };
+  Status status = handshake();
+  RETURN_NOT_OK(conn->SendStatus(status));
+  RETURN_NOT_OK(status);
+  return conn;
+}
+
+Status Connection::SendFrame(FrameType type, const uint8_t* data, int64_t size,
+                             int fd) {
+  FrameHeader header{static_cast<uint32_t>(type), 0, size};
+  struct iovec iov[2];
+  iov[0].iov_base = &header;
+  iov[0].iov_len = sizeof(header);
+  iov[1].iov_base = const_cast<uint8_t*>(data);
+  iov[1].iov_len = static_cast<size_t>(size);
+
+  union {
+    char buf[CMSG_SPACE(sizeof(int))];
+    struct cmsghdr align;
+  } control;
+  struct msghdr msg;
+  std::memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = iov;
+  msg.msg_iovlen = size > 0 ? 2 : 1;
+  if (fd >= 0) {
+    std::memset(&control, 0, sizeof(control));
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+    struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    std::memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+  }
+
+  std::lock_guard<std::mutex> guard(send_mutex_);
+  while (msg.msg_iovlen > 0) {
+    const ssize_t sent = sendmsg(socket_.fd(), &msg, MSG_NOSIGNAL);
+    if (sent < 0) {
+      if (errno == EINTR) continue;
+      return SocketError(errno, "send to");
+    }
+    // The descriptor went with the first bytes
+    msg.msg_control = nullptr;
+    msg.msg_controllen = 0;
+    size_t remaining = static_cast<size_t>(sent);
+    while (msg.msg_iovlen > 0 && remaining >= msg.msg_iov->iov_len) {
+      remaining -= msg.msg_iov->iov_len;
+      ++msg.msg_iov;
+      --msg.msg_iovlen;
+    }
+    if (msg.msg_iovlen > 0) {
+      msg.msg_iov->iov_base = static_cast<uint8_t*>(msg.msg_iov->iov_base) + remaining;
+      msg.msg_iov->iov_len -= remaining;
+    }
+  }
+  return Status::OK();
+}
+
+Status Connection::SocketError(int errnum, const char* operation) {
+  broken_.store(true);
+  if (errnum == EAGAIN || errnum == EWOULDBLOCK) {
+    return MakeFlightError(FlightStatusCode::TimedOut,
+                           std::string("Deadline exceeded: could not ") + operation +
+                               " " + peer_);
+  }
+  return IOErrorFromErrno(errnum, "Could not ", operation, " ", peer_);
+}
+
+Status Connection::SetTimeout(double seconds) {
+  struct timeval timeout = {0, 0};
+  if (seconds > 0) {
+    timeout.tv_sec = static_cast<time_t>(seconds);
+    timeout.tv_usec = static_cast<suseconds_t>((seconds - timeout.tv_sec) * 1e6);
+    if (timeout.tv_sec == 0 && timeout.tv_usec == 0) {
+      // Zero would disable the timeout
+      timeout.tv_usec = 1;
+    }
+  }
+  if (setsockopt(socket_.fd(), SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) != 0 ||
+      setsockopt(socket_.fd(), SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout)) != 0) {
+    return IOErrorFromErrno(errno, "Could not set socket timeout");
+  }
+  return Status::OK();
+}
+
+Status Connection::RecvExactly(uint8_t* data, int64_t size, FileDescriptor* fd) {
+  while (size > 0) {
+    struct iovec iov;
+    iov.iov_base = data;
+    iov.iov_len = static_cast<size_t>(size);
+    union {
+      char buf[CMSG_SPACE(sizeof(int))];
+      struct cmsghdr align;
+    } control;
+    struct msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+
+    const ssize_t received = recvmsg(socket_.fd(), &msg, MSG_CMSG_CLOEXEC);
+    if (received < 0) {
+      if (errno == EINTR) continue;
+      return SocketError(errno, "receive from");
+    }
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+      if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) continue;
+      const size_t num_fds = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+      for (size_t i = 0; i < num_fds; ++i) {
+        int received_fd;
+        std::memcpy(&received_fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+        FileDescriptor owned(received_fd);
+        if (fd != nullptr && fd->closed()) {
+          *fd = std::move(owned);
+        }
+      }
+    }
+    if (received == 0) {
+      broken_.store(true);
+      return Status::IOError("Connection closed by ", peer_);
+    }
+    data += received;
+    size -= received;
+  }
+  return Status::OK();
+}
+
+arrow::Result<Frame> Connection::ReadFrame() {
+  Frame frame;
+  FrameHeader header;
+  RETURN_NOT_OK(
+      RecvExactly(reinterpret_cast<uint8_t*>(&header), sizeof(header), &frame.fd));
+  if (header.type > static_cast<uint32_t>(FrameType::kStatus) || header.size < 0 ||
+      header.size > kMaxFrameSize) {
+    broken_.store(true);
+    return Status::IOError("Invalid shared-memory transport frame from ", peer_);
+  }
+  frame.type = static_cast<FrameType>(header.type);
+  ARROW_ASSIGN_OR_RAISE(frame.buffer, AllocateBuffer(header.size, read_memory_pool_));
+  RETURN_NOT_OK(RecvExactly(frame.buffer->mutable_data(), header.size));
+  return frame;
+}
+
+Status Connection::SendCall(
+    const std::string& method,
+    const std::vector<std::pair<std::string, std::string>>& headers) {
+  std::string body;
+  AppendString(&body, method);
+  AppendInt32(&body, static_cast<int32_t>(headers.size()));
+  for (const auto& header : headers) {
+    AppendString(&body, header.first);
+    AppendString(&body, header.second);
+  }
+  return SendFrame(FrameType::kCall, body);
+}
+
+Status Connection::ParseCall(const Frame& frame, std::string* method,
+                             std::vector<std::pair<std::string, std::string>>* headers) {
+  if (frame.type != FrameType::kCall) {
+    return Status::IOError("Expected a call, got frame type ",
+                           static_cast<int>(frame.type));
+  }
+  FieldReader reader(frame.view());
+  RETURN_NOT_OK(reader.ReadString(method));
+  int32_t num_headers;
+  RETURN_NOT_OK(reader.ReadInt32(&num_headers));
+  for (int32_t i = 0; i < num_headers; ++i) {
+    std::string key, value;
+    RETURN_NOT_OK(reader.ReadString(&key));
+    RETURN_NOT_OK(reader.ReadString(&value));
+    headers->emplace_back(std::move(key), std::move(value));
+  }
+  return Status::OK();
+}
+
+Status Connection::SendPayload(const FlightPayload& payload) {
+  DataHeader header;
+  header.slot = -1;
+  header.reserved = 0;
+  header.descriptor_size = FieldSize(payload.descriptor);
+  header.app_metadata_size = FieldSize(payload.app_metadata);
+  header.metadata_size = FieldSize(payload.ipc_message.metadata);
+  header.body_size = payload.ipc_message.metadata ? payload.ipc_message.body_length : -1;
+  const PayloadLayout layout = ComputeLayout(header);
+
+  if (layout.total_size <= region_->slot_size()) {
+    header.slot = region_->AcquireSlot(write_pool_, kSlotWaitMicros);
+    if (header.slot >= 0) {
+      Status status = CopyPayload(payload, layout,
+                                  region_->slot_data(write_pool_, header.slot));
+      if (status.ok()) {
+        status = SendFrame(FrameType::kSlotData,
+                           reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+      }
+      if (!status.ok()) {
+        region_->ReleaseSlot(write_pool_, header.slot);
+      }
+      return status;
+    }
+    // The reader holds on to all the slots; don't wait for it
+  }
+
+  // Too large for a slot: hand over a memfd of its own
+  ARROW_ASSIGN_OR_RAISE(auto memfd, CreateMemfd(layout.total_size));
+  void* data = mmap(nullptr, static_cast<size_t>(layout.total_size),
+                    PROT_READ | PROT_WRITE, MAP_SHARED, memfd.fd(), 0);
+  if (data == MAP_FAILED) {
+    return IOErrorFromErrno(errno, "Could not map memfd");
+  }
+  Status status = CopyPayload(payload, layout, reinterpret_cast<uint8_t*>(data));
+  munmap(data, static_cast<size_t>(layout.total_size));
+  RETURN_NOT_OK(status);
+  if (fcntl(memfd.fd(), F_ADD_SEALS,
+            F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0) {
+    return IOErrorFromErrno(errno, "Could not seal memfd");
+  }
+  return SendFrame(FrameType::kFdData, reinterpret_cast<const uint8_t*>(&header),
+                   sizeof(header), memfd.fd());
+}
+
+Status Connection::ReadPayload(Frame* frame, internal::FlightData* data) {
+  DataHeader header;
+  if (frame->buffer->size() != static_cast<int64_t>(sizeof(header))) {
+    return Status::IOError("Invalid data frame size ", frame->buffer->size());
+  }
+  std::memcpy(&header, frame->buffer->data(), sizeof(header));
+  if (header.descriptor_size < -1 || header.app_metadata_size < -1 ||
+      header.metadata_size < -1 || header.body_size < -1 ||
+      header.descriptor_size > kMaxFrameSize ||
+      header.app_metadata_size > kMaxFrameSize ||
+      header.metadata_size > kMaxFrameSize || header.body_size > kMaxFrameSize) {
+    return Status::IOError("Invalid data frame field sizes");
+  }
+  const PayloadLayout layout = ComputeLayout(header);
+
+  std::shared_ptr<Buffer> payload;
+  if (frame->type == FrameType::kSlotData) {
+    if (header.slot < 0 || header.slot >= region_->num_slots() ||
+        layout.total_size > region_->slot_size()) {
+      return Status::IOError("Invalid shared memory slot ", header.slot);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (layout.total_size < kCopyThreshold ||
+        region_->num_held_slots(read_pool_) >= region_->num_slots() / 2) {
+      // Not worth pinning the slot, or the application holds on to the
+      // payloads: copy so that the writer doesn't run out of slots
+      ARROW_ASSIGN_OR_RAISE(auto copy,
+                            AllocateBuffer(layout.total_size, read_memory_pool_));
+      std::memcpy(copy->mutable_data(), region_->slot_data(read_pool_, header.slot),
+                  static_cast<size_t>(layout.total_size));
+      region_->ReleaseSlot(read_pool_, header.slot);
+      payload = std::move(copy);
+    } else {
+      payload = region_->WrapSlot(read_pool_, header.slot, layout.total_size);
+    }
+  } else if (frame->type == FrameType::kFdData) {
+    if (frame->fd.closed()) {
+      return Status::IOError("Data frame is missing its memfd");
+    }
+    struct stat st;
+    const int seals = fcntl(frame->fd.fd(), F_GET_SEALS);
+    if (seals < 0 || (seals & F_SEAL_SHRINK) == 0 || fstat(frame->fd.fd(), &st) != 0 ||
+        st.st_size < layout.total_size || layout.total_size == 0) {
+      return Status::IOError("Invalid memfd in data frame");
+    }
+    void* mapped = mmap(nullptr, static_cast<size_t>(layout.total_size), PROT_READ,
+                        MAP_SHARED, frame->fd.fd(), 0);
+    if (mapped == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "Could not map memfd");
+    }
+    payload =
+        std::make_shared<MemfdBuffer>(reinterpret_cast<uint8_t*>(mapped),
+                                      layout.total_size);
+    RETURN_NOT_OK(frame->fd.Close());
+  } else {
+    return Status::IOError("Expected a data frame, got frame type ",
+                           static_cast<int>(frame->type));
+  }
+
+  if (header.descriptor_size >= 0) {
+    std::string_view serialized(
+        reinterpret_cast<const char*>(payload->data() + layout.descriptor_offset),
+        static_cast<size_t>(header.descriptor_size));
+    data->descriptor = std::make_unique<FlightDescriptor>();
+    ARROW_ASSIGN_OR_RAISE(*data->descriptor, FlightDescriptor::Deserialize(serialized));
+  } else {
+    data->descriptor = nullptr;
+  }
+  data->app_metadata =
+      header.app_metadata_size >= 0
+          ? SliceBuffer(payload, layout.app_metadata_offset, header.app_metadata_size)
+          : nullptr;
+  data->metadata =
+      header.metadata_size >= 0
+          ? SliceBuffer(payload, layout.metadata_offset, header.metadata_size)
+          : nullptr;
+  data->body = header.body_size >= 0
+                   ? SliceBuffer(payload, layout.body_offset, header.body_size)
+                   : nullptr;
+  return Status::OK();
+}
+
+Status Connection::SendStatus(const Status& status) {
+  internal::TransportStatus transport_status =
+      internal::TransportStatus::FromStatus(status);
+  std::string body;
+  AppendInt32(&body, static_cast<int32_t>(transport_status.code));
+  AppendInt32(&body, static_cast<int32_t>(status.code()));
+  AppendString(&body, transport_status.message);
+  AppendString(&body, status.message());
+  std::optional<std::string> detail, detail_bin;
+  if (status.detail()) {
+    detail = status.detail()->ToString();
+    auto fsd = FlightStatusDetail::UnwrapStatus(status);
+    if (fsd && !fsd->extra_info().empty()) {
+      detail_bin = fsd->extra_info();
+    }
+  }
+  AppendString(&body, detail);
+  AppendString(&body, detail_bin);
+  return SendFrame(FrameType::kStatus, body);
+}
+
+Status Connection::ParseStatus(const Frame& frame, Status* out) {
+  if (frame.type != FrameType::kStatus) {
+    return Status::IOError("Expected a status, got frame type ",
+                           static_cast<int>(frame.type));
+  }
+  FieldReader reader(frame.view());
+  int32_t transport_code, code;
+  std::string transport_message;
+  std::optional<std::string> message, detail, detail_bin;
+  RETURN_NOT_OK(reader.ReadInt32(&transport_code));
+  RETURN_NOT_OK(reader.ReadInt32(&code));
+  RETURN_NOT_OK(reader.ReadString(&transport_message));
+  RETURN_NOT_OK(reader.ReadString(&message));
+  RETURN_NOT_OK(reader.ReadString(&detail));
+  RETURN_NOT_OK(reader.ReadString(&detail_bin));
+
+  internal::TransportStatus transport_status{
+      static_cast<TransportStatusCode>(transport_code), std::move(transport_message)};
+  if (transport_status.code == TransportStatusCode::kOk) {
+    *out = Status::OK();
+    return Status::OK();
+  }
+  *out = transport_status.ToStatus();
+  *out = internal::ReconstructStatus(ToChars(code), *out, std::move(message),
+                                     std::move(detail), std::move(detail_bin),
+                                     FlightStatusDetail::UnwrapStatus(*out));
+  return Status::OK();
+}
+
+void Connection::Shutdown() {
+  broken_.store(true);
+  shutdown(socket_.fd(), SHUT_RDWR);
+}
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,268 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Common implementation of the shared-memory transport primitives.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/transport.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/uri.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+//------------------------------------------------------------
+// Protocol Constants
+
+static constexpr char kMethodDoAction[] = "DoAction";
+static constexpr char kMethodDoExchange[] = "DoExchange";
+static constexpr char kMethodDoGet[] = "DoGet";
+static constexpr char kMethodDoPut[] = "DoPut";
+static constexpr char kMethodGetFlightInfo[] = "GetFlightInfo";
+static constexpr char kMethodGetSchema[] = "GetSchema";
+static constexpr char kMethodListActions[] = "ListActions";
+static constexpr char kMethodListFlights[] = "ListFlights";
+static constexpr char kMethodPollFlightInfo[] = "PollFlightInfo";
+
+/// The client option setting the number of slots in each direction.
+static constexpr char kOptionNumSlots[] = "arrow.flight.shm.num_slots";
+/// The client option setting the size of a slot in bytes.
+static constexpr char kOptionSlotSize[] = "arrow.flight.shm.slot_size";
+
+static constexpr int32_t kDefaultNumSlots = 16;
+static constexpr int64_t kDefaultSlotSize = 4 << 20;
+/// The slots in use are tracked in a 64-bit mask.
+static constexpr int32_t kMaxNumSlots = 64;
+
+//------------------------------------------------------------
+// Shared memory
+
+/// \brief The direction of the data written to a pool of slots.
+enum class PoolId : int32_t {
+  kClientToServer = 0,
+  kServerToClient = 1,
+};
+
+/// \brief A memfd shared by the client and server of a connection.
+///
+/// The client creates the region and passes its file descriptor to
+/// the server when connecting. The region holds one pool of
+/// fixed-size slots per direction. The writer of a pool copies each
+/// IPC payload into a free slot and sends the slot index over the
+/// socket; the reader wraps the slot in a Buffer without copying and
+/// gives the slot back when the Buffer is destroyed.
+///
+/// Each pool has an atomic bitmask of the slots in use, and a futex
+/// word bumped on each release that a writer waiting for a free slot
+/// sleeps on.
+class SharedRegion : public std::enable_shared_from_this<SharedRegion> {
+ public:
+  ~SharedRegion();
+
+  /// \brief Create a region backed by a new memfd.
+  static arrow::Result<std::shared_ptr<SharedRegion>> Create(int32_t num_slots,
+                                                             int64_t slot_size);
+  /// \brief Map a region created by the peer, taking ownership of the fd.
+  static arrow::Result<std::shared_ptr<SharedRegion>> Open(int fd);
+
+  int fd() const { return fd_.fd(); }
+  int32_t num_slots() const { return num_slots_; }
+  int64_t slot_size() const { return slot_size_; }
+
+  /// \brief Take a free slot of the pool, waiting for up to
+  ///   `timeout_us` microseconds for one to be released.
+  ///
+  /// \return The slot index, or -1 if all slots stayed in use.
+  int32_t AcquireSlot(PoolId pool, int64_t timeout_us);
+  /// \brief Give a slot back to the writer of the pool.
+  void ReleaseSlot(PoolId pool, int32_t slot);
+
+  uint8_t* slot_data(PoolId pool, int32_t slot) const;
+
+  /// \brief Wrap a slot written by the peer; the slot is released
+  ///   when the buffer is destroyed.
+  std::shared_ptr<Buffer> WrapSlot(PoolId pool, int32_t slot, int64_t size);
+
+  /// \brief The number of slots of the pool that are wrapped in live
+  ///   buffers on this side.
+  int32_t num_held_slots(PoolId pool) const;
+
+ private:
+  struct PoolHeader;
+
+  SharedRegion() = default;
+  Status Map(int64_t size);
+  PoolHeader* pool_header(PoolId pool) const;
+
+  ::arrow::internal::FileDescriptor fd_;
+  uint8_t* data_ = nullptr;
+  int64_t size_ = 0;
+  int32_t num_slots_ = 0;
+  int64_t slot_size_ = 0;
+  std::atomic<int32_t> held_slots_[2] = {{0}, {0}};
+};
+
+//------------------------------------------------------------
+// Framing
+
+/// \brief The type of a frame sent over the control socket.
+enum class FrameType : uint32_t {
+  /// Connection handshake. The client sends the region fd alongside.
+  kHello = 0,
+  /// Start of a call: the method name and the call headers.
+  kCall,
+  /// An opaque message: a request, a response or DoPut metadata.
+  kBuffer,
+  /// An IPC payload written to a slot of the shared region.
+  kSlotData,
+  /// An IPC payload written to its own memfd, sent alongside.
+  kFdData,
+  /// The client is done writing.
+  kWritesDone,
+  /// End of a call, with the final status.
+  kStatus,
+};
+
+/// \brief A frame received over the control socket.
+struct Frame {
+  FrameType type;
+  /// \brief The frame body.
+  std::shared_ptr<Buffer> buffer;
+  /// \brief The file descriptor sent alongside the frame, if any.
+  ::arrow::internal::FileDescriptor fd;
+
+  std::string_view view() const {
+    return std::string_view(reinterpret_cast<const char*>(buffer->data()),
+                            static_cast<size_t>(buffer->size()));
+  }
+};
+
+/// \brief Convert a shm:// URI to the address of the server socket.
+///
+/// `shm://host:port` designates an abstract socket named after the
+/// port (the host is ignored, since the peer must run on the same
+/// machine), and `shm:///path` a socket file.
+ARROW_FLIGHT_EXPORT
+Status UriToSockaddr(const arrow::util::Uri& uri, struct sockaddr_un* addr,
+                     socklen_t* addrlen);
+
+/// \brief Name the abstract socket of a port.
+ARROW_FLIGHT_EXPORT
+void PortToSockaddr(int port, struct sockaddr_un* addr, socklen_t* addrlen);
+
+/// \brief One end of a connection: the control socket and the region.
+///
+/// A connection carries one call at a time. Frames may be sent and
+/// received concurrently from two threads.
+class ARROW_FLIGHT_EXPORT Connection {
+ public:
+  Connection(::arrow::internal::FileDescriptor socket,
+             std::shared_ptr<SharedRegion> region, bool is_client);
+  ~Connection();
+
+  /// \brief Connect to a server, creating the shared region.
+  static arrow::Result<std::unique_ptr<Connection>> Connect(
+      const struct sockaddr_un& addr, socklen_t addrlen, int32_t num_slots,
+      int64_t slot_size);
+  /// \brief Complete the handshake of an accepted socket.
+  static arrow::Result<std::unique_ptr<Connection>> Accept(
+      ::arrow::internal::FileDescriptor socket);
+
+  Status SendFrame(FrameType type, const uint8_t* data, int64_t size, int fd = -1);
+  Status SendFrame(FrameType type, std::string_view data) {
+    return SendFrame(type, reinterpret_cast<const uint8_t*>(data.data()),
+                     static_cast<int64_t>(data.size()));
+  }
+  arrow::Result<Frame> ReadFrame();
+
+  /// \brief Start a call.
+  Status SendCall(const std::string& method,
+                  const std::vector<std::pair<std::string, std::string>>& headers);
+  /// \brief Parse the method and headers of a kCall frame.
+  static Status ParseCall(const Frame& frame, std::string* method,
+                          std::vector<std::pair<std::string, std::string>>* headers);
+
+  /// \brief Send an IPC payload through the shared region.
+  Status SendPayload(const FlightPayload& payload);
+  /// \brief Unpack a kSlotData or kFdData frame.
+  Status ReadPayload(Frame* frame, internal::FlightData* data);
+
+  /// \brief End a call.
+  Status SendStatus(const Status& status);
+  /// \brief Unpack a kStatus frame into the status sent by the peer.
+  static Status ParseStatus(const Frame& frame, Status* out);
+
+  /// \brief Fail the reads and writes that block for longer than the
+  ///   given number of seconds (no limit if not positive).
+  Status SetTimeout(double seconds);
+
+  /// \brief Interrupt any blocking read or write.
+  void Shutdown();
+  /// \brief Whether an I/O error left the stream of frames in an
+  ///   unknown state.
+  bool broken() const { return broken_.load(); }
+
+  int fd() const { return socket_.fd(); }
+  const std::string& peer() const { return peer_; }
+
+  void set_read_memory_pool(MemoryPool* pool) { read_memory_pool_ = pool; }
+
+ private:
+  Status SocketError(int errnum, const char* operation);
+  Status RecvExactly(uint8_t* data, int64_t size,
+                     ::arrow::internal::FileDescriptor* fd = nullptr);
+
+  ::arrow::internal::FileDescriptor socket_;
+  std::shared_ptr<SharedRegion> region_;
+  PoolId write_pool_;
+  PoolId read_pool_;
+  std::string peer_;
+  MemoryPool* read_memory_pool_;
+  std::mutex send_mutex_;
+  std::atomic<bool> broken_{false};
+};
+
+std::unique_ptr<arrow::flight::internal::ClientTransport> MakeShmClientImpl();
+
+std::unique_ptr<arrow::flight::internal::ServerTransport> MakeShmServerImpl(
+    FlightServerBase* base, std::shared_ptr<MemoryManager> memory_manager);
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
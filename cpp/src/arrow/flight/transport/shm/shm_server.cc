@@ -0,0 +1,496 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/transport/shm/shm_internal.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/transport.h"
+#include "arrow/flight/transport_server.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+#include "arrow/util/uri.h"
+
+namespace arrow {
+
+using internal::FileDescriptor;
+using internal::IOErrorFromErrno;
+using internal::ToChars;
+
+namespace flight {
+namespace transport {
+namespace shm {
+
+#define FLIGHT_LOG(LEVEL) (ARROW_LOG(LEVEL) << "[server] ")
+#define FLIGHT_LOG_PEER(LEVEL, PEER) \
+  (ARROW_LOG(LEVEL) << "[server]"    \
+                    << "[peer=" << (PEER) << "] ")
+
+namespace {
+class ShmServerCallContext : public flight::ServerCallContext {
+ public:
+  ShmServerCallContext(std::string peer,
+                       std::vector<std::pair<std::string, std::string>> headers)
+      : peer_(std::move(peer)), headers_(std::move(headers)) {
+    for (const auto& header : headers_) {
+      incoming_headers_.emplace(header.first, header.second);
+    }
+  }
+
+  const std::string& peer_identity() const override { return peer_; }
+  const std::string& peer() const override { return peer_; }
+  // Not supported
+  void AddHeader(const std::string& key, const std::string& value) const override {}
+  void AddTrailer(const std::string& key, const std::string& value) const override {}
+  ServerMiddleware* GetMiddleware(const std::string& key) const override {
+    return nullptr;
+  }
+  bool is_cancelled() const override { return false; }
+  const CallHeaders& incoming_headers() const override { return incoming_headers_; }
+
+ private:
+  std::string peer_;
+  std::vector<std::pair<std::string, std::string>> headers_;
+  CallHeaders incoming_headers_;
+};
+
+class ShmServerStream : public internal::ServerDataStream {
+ public:
+  explicit ShmServerStream(Connection* conn) : conn_(conn) {}
+
+  bool ReadData(internal::FlightData* data) override {
+    if (finished_) return false;
+    auto status = ReadImpl(data);
+    if (!status.ok()) {
+      finished_ = true;
+      FLIGHT_LOG_PEER(WARNING, conn_->peer())
+          << "I/O error reading client data: " << status.ToString();
+      return false;
+    }
+    return !finished_;
+  }
+
+  arrow::Result<bool> WriteData(const FlightPayload& payload) override {
+    Status status = conn_->SendPayload(payload);
+    if (!status.ok()) {
+      if (conn_->broken()) return false;
+      return status;
+    }
+    return true;
+  }
+
+  Status WritePutMetadata(const Buffer& payload) override {
+    return conn_->SendFrame(FrameType::kBuffer, payload.data(), payload.size());
+  }
+
+  // Must drain any unread messages, or the next call will get confused
+  void Drain() {
+    internal::FlightData ignored;
+    while (ReadData(&ignored)) {
+    }
+  }
+
+ private:
+  Status ReadImpl(internal::FlightData* data) {
+    ARROW_ASSIGN_OR_RAISE(auto frame, conn_->ReadFrame());
+    if (frame.type == FrameType::kWritesDone) {
+      finished_ = true;
+      return Status::OK();
+    }
+    return conn_->ReadPayload(&frame, data);
+  }
+
+  Connection* conn_;
+  bool finished_ = false;
+};
+
+class ShmServerImpl : public arrow::flight::internal::ServerTransport {
+ public:
+  using arrow::flight::internal::ServerTransport::ServerTransport;
+
+  ~ShmServerImpl() override {
+    if (listening_.load()) {
+      ARROW_WARN_NOT_OK(Shutdown(), "Server did not shut down properly");
+    }
+  }
+
+  Status Init(const FlightServerOptions& options, const arrow::util::Uri& uri) override {
+    struct sockaddr_un listen_addr;
+    socklen_t addrlen;
+    const bool pick_port = uri.port() == 0;
+    if (!pick_port) {
+      RETURN_NOT_OK(UriToSockaddr(uri, &listen_addr, &addrlen));
+    }
+    // Allow application to override the socket address
+    if (options.builder_hook) options.builder_hook(&listen_addr);
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+      return IOErrorFromErrno(errno, "Could not create socket");
+    }
+    listen_socket_ = FileDescriptor(fd);
+
+    int port = uri.port();
+    if (pick_port) {
+      // Abstract sockets have no ephemeral ports, so probe for a free one
+      std::mt19937 rng(std::random_device{}());
+      std::uniform_int_distribution<int> distribution(kMinPort, kMaxPort);
+      int attempts = 0;
+      while (true) {
+        port = distribution(rng);
+        PortToSockaddr(port, &listen_addr, &addrlen);
+        if (bind(fd, reinterpret_cast<struct sockaddr*>(&listen_addr), addrlen) == 0) {
+          break;
+        }
+        if (errno != EADDRINUSE || ++attempts == kMaxBindAttempts) {
+          return IOErrorFromErrno(errno, "Could not bind shared-memory server socket");
+        }
+      }
+    } else if (bind(fd, reinterpret_cast<struct sockaddr*>(&listen_addr), addrlen) != 0) {
+      return IOErrorFromErrno(errno, "Could not bind shared-memory server socket");
+    }
+    if (listen(fd, SOMAXCONN) != 0) {
+      return IOErrorFromErrno(errno, "Could not listen on shared-memory server socket");
+    }
+
+    std::string raw_uri = "shm://";
+    if (port >= 0) {
+      raw_uri += uri.host().empty() ? "localhost" : uri.host();
+      raw_uri += ":";
+      raw_uri += ToChars(port);
+    } else {
+      socket_path_ = uri.path();
+      raw_uri += socket_path_;
+    }
+    ARROW_ASSIGN_OR_RAISE(location_, Location::Parse(raw_uri));
+    FLIGHT_LOG(DEBUG) << "Listening on " << raw_uri;
+
+    const int wakeup_fd = eventfd(0, EFD_CLOEXEC);
+    if (wakeup_fd < 0) {
+      return IOErrorFromErrno(errno, "Could not create eventfd");
+    }
+    wakeup_fd_ = FileDescriptor(wakeup_fd);
+
+    listening_.store(true);
+    std::thread listener_thread(&ShmServerImpl::AcceptConnections, this);
+    listener_thread_.swap(listener_thread);
+    return Status::OK();
+  }
+
+  Status Shutdown() override { return ShutdownImpl(nullptr); }
+
+  Status Shutdown(const std::chrono::system_clock::time_point& deadline) override {
+    return ShutdownImpl(&deadline);
+  }
+
+  Status Wait() override {
+    std::lock_guard<std::mutex> guard(join_mutex_);
+    try {
+      listener_thread_.join();
+    } catch (const std::system_error& e) {
+      if (e.code() != std::errc::invalid_argument) {
+        return Status::UnknownError("Could not Wait(): ", e.what());
+      }
+      // Else, server wasn't running anyways
+    }
+    return Status::OK();
+  }
+
+  Location location() const override { return location_; }
+
+ private:
+  struct Worker {
+    std::thread thread;
+    // Set while the connection is open, so that it can be interrupted
+    Connection* conn = nullptr;
+    bool done = false;
+  };
+
+  Status ShutdownImpl(const std::chrono::system_clock::time_point* deadline) {
+    if (!listening_.exchange(false)) return Status::OK();
+    Status status;
+
+    // Wake up the listener and the idle connections
+    const uint64_t one = 1;
+    if (write(wakeup_fd_.fd(), &one, sizeof(one)) != sizeof(one)) {
+      status &= IOErrorFromErrno(errno, "Could not wake up server threads");
+    }
+    status &= Wait();
+
+    std::unique_lock<std::mutex> guard(workers_mutex_);
+    // Wait for current RPCs to finish
+    auto all_done = [this] {
+      for (const auto& worker : workers_) {
+        if (!worker.done) return false;
+      }
+      return true;
+    };
+    if (deadline) {
+      if (!workers_cv_.wait_until(guard, *deadline, all_done)) {
+        for (auto& worker : workers_) {
+          if (worker.conn) worker.conn->Shutdown();
+        }
+      }
+    }
+    workers_cv_.wait(guard, all_done);
+    for (auto& worker : workers_) {
+      worker.thread.join();
+    }
+    workers_.clear();
+    guard.unlock();
+
+    status &= listen_socket_.Close();
+    if (!socket_path_.empty()) {
+      unlink(socket_path_.c_str());
+    }
+    return status;
+  }
+
+  template <typename Handler>
+  Status HandleUnary(Connection* conn, Handler&& handler) {
+    ARROW_ASSIGN_OR_RAISE(auto request, conn->ReadFrame());
+    if (request.type != FrameType::kBuffer) {
+      return Status::IOError("Expected a request, got frame type ",
+                             static_cast<int>(request.type));
+    }
+    return conn->SendStatus(handler(request.view()));
+  }
+
+  Status SendResponse(Connection* conn, const std::string& response) {
+    return conn->SendFrame(FrameType::kBuffer, response);
+  }
+
+  Status HandleOneCall(Connection* conn, const Frame& frame) {
+    std::string method;
+    std::vector<std::pair<std::string, std::string>> headers;
+    RETURN_NOT_OK(Connection::ParseCall(frame, &method, &headers));
+    ShmServerCallContext context(conn->peer(), std::move(headers));
+
+    if (method == kMethodGetFlightInfo) {
+      return HandleUnary(conn, [&](std::string_view request) -> Status {
+        ARROW_ASSIGN_OR_RAISE(auto descriptor, FlightDescriptor::Deserialize(request));
+        std::unique_ptr<FlightInfo> info;
+        RETURN_NOT_OK(base_->GetFlightInfo(context, descriptor, &info));
+        ARROW_ASSIGN_OR_RAISE(auto response, info->SerializeToString());
+        return SendResponse(conn, response);
+      });
+    } else if (method == kMethodPollFlightInfo) {
+      return HandleUnary(conn, [&](std::string_view request) -> Status {
+        ARROW_ASSIGN_OR_RAISE(auto descriptor, FlightDescriptor::Deserialize(request));
+        std::unique_ptr<PollInfo> info;
+        RETURN_NOT_OK(base_->PollFlightInfo(context, descriptor, &info));
+        ARROW_ASSIGN_OR_RAISE(auto response, info->SerializeToString());
+        return SendResponse(conn, response);
+      });
+    } else if (method == kMethodGetSchema) {
+      return HandleUnary(conn, [&](std::string_view request) -> Status {
+        ARROW_ASSIGN_OR_RAISE(auto descriptor, FlightDescriptor::Deserialize(request));
+        std::unique_ptr<SchemaResult> result;
+        RETURN_NOT_OK(base_->GetSchema(context, descriptor, &result));
+        ARROW_ASSIGN_OR_RAISE(auto response, result->SerializeToString());
+        return SendResponse(conn, response);
+      });
+    } else if (method == kMethodListFlights) {
+      return HandleUnary(conn, [&](std::string_view request) -> Status {
+        ARROW_ASSIGN_OR_RAISE(auto criteria, Criteria::Deserialize(request));
+        std::unique_ptr<FlightListing> listing;
+        RETURN_NOT_OK(base_->ListFlights(context, &criteria, &listing));
+        if (!listing) return Status::OK();
+        while (true) {
+          ARROW_ASSIGN_OR_RAISE(auto info, listing->Next());
+          if (!info) return Status::OK();
+          ARROW_ASSIGN_OR_RAISE(auto response, info->SerializeToString());
+          RETURN_NOT_OK(SendResponse(conn, response));
+        }
+      });
+    } else if (method == kMethodListActions) {
+      return HandleUnary(conn, [&](std::string_view) -> Status {
+        std::vector<ActionType> actions;
+        RETURN_NOT_OK(base_->ListActions(context, &actions));
+        for (const auto& action : actions) {
+          ARROW_ASSIGN_OR_RAISE(auto response, action.SerializeToString());
+          RETURN_NOT_OK(SendResponse(conn, response));
+        }
+        return Status::OK();
+      });
+    } else if (method == kMethodDoAction) {
+      return HandleUnary(conn, [&](std::string_view request) -> Status {
+        ARROW_ASSIGN_OR_RAISE(auto action, Action::Deserialize(request));
+        std::unique_ptr<ResultStream> results;
+        RETURN_NOT_OK(base_->DoAction(context, action, &results));
+        if (!results) return Status::OK();
+        while (true) {
+          ARROW_ASSIGN_OR_RAISE(auto result, results->Next());
+          if (!result) return Status::OK();
+          ARROW_ASSIGN_OR_RAISE(auto response, result->SerializeToString());
+          RETURN_NOT_OK(SendResponse(conn, response));
+        }
+      });
+    } else if (method == kMethodDoGet) {
+      return HandleUnary(conn, [&](std::string_view request) -> Status {
+        ARROW_ASSIGN_OR_RAISE(auto ticket, Ticket::Deserialize(request));
+        ShmServerStream stream(conn);
+        return DoGet(context, std::move(ticket), &stream);
+      });
+    } else if (method == kMethodDoPut || method == kMethodDoExchange) {
+      ShmServerStream stream(conn);
+      auto status = method == kMethodDoPut ? DoPut(context, &stream)
+                                           : DoExchange(context, &stream);
+      RETURN_NOT_OK(conn->SendStatus(status));
+      stream.Drain();
+      return Status::OK();
+    }
+    // We can't tell where the frames of an unknown call end
+    RETURN_NOT_OK(conn->SendStatus(Status::NotImplemented(method)));
+    return Status::IOError("Unknown method ", method);
+  }
+
+  void ServeConnection(Worker* worker, FileDescriptor socket) {
+    auto maybe_conn = Connection::Accept(std::move(socket));
+    if (!maybe_conn.ok()) {
+      FLIGHT_LOG(WARNING) << "Failed to accept connection: "
+                          << maybe_conn.status().ToString();
+    } else {
+      std::unique_ptr<Connection> conn = maybe_conn.MoveValueUnsafe();
+      FLIGHT_LOG_PEER(DEBUG, conn->peer()) << "Connected";
+      {
+        std::lock_guard<std::mutex> guard(workers_mutex_);
+        worker->conn = conn.get();
+      }
+      while (WaitForCall(conn->fd())) {
+        auto maybe_frame = conn->ReadFrame();
+        if (!maybe_frame.ok()) {
+          // The client hung up
+          break;
+        }
+        auto status = HandleOneCall(conn.get(), *maybe_frame);
+        if (!status.ok()) {
+          FLIGHT_LOG_PEER(WARNING, conn->peer()) << "Call failed: " << status.ToString();
+          break;
+        }
+      }
+      FLIGHT_LOG_PEER(DEBUG, conn->peer()) << "Disconnected";
+      std::lock_guard<std::mutex> guard(workers_mutex_);
+      worker->conn = nullptr;
+    }
+    std::lock_guard<std::mutex> guard(workers_mutex_);
+    worker->done = true;
+    workers_cv_.notify_all();
+  }
+
+  // Wait for the next call on an idle connection, or for shutdown
+  bool WaitForCall(int fd) {
+    struct pollfd fds[2];
+    fds[0].fd = fd;
+    fds[0].events = POLLIN;
+    fds[1].fd = wakeup_fd_.fd();
+    fds[1].events = POLLIN;
+    while (true) {
+      const int ready = poll(fds, 2, -1);
+      if (ready < 0) {
+        if (errno == EINTR) continue;
+        return false;
+      }
+      return fds[1].revents == 0;
+    }
+  }
+
+  void AcceptConnections() {
+    while (WaitForCall(listen_socket_.fd())) {
+      const int fd = accept4(listen_socket_.fd(), nullptr, nullptr, SOCK_CLOEXEC);
+      if (fd < 0) {
+        if (errno != EINTR && errno != EAGAIN && errno != ECONNABORTED) {
+          FLIGHT_LOG(WARNING) << IOErrorFromErrno(errno, "accept() failed").ToString();
+        }
+        continue;
+      }
+      FileDescriptor socket(fd);
+
+      std::lock_guard<std::mutex> guard(workers_mutex_);
+      // Reap the connections that have closed
+      for (auto it = workers_.begin(); it != workers_.end();) {
+        if (it->done) {
+          it->thread.join();
+          it = workers_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      // One thread per connection, which carries one call at a time
+      workers_.emplace_back();
+      Worker* worker = &workers_.back();
+      worker->thread = std::thread(
+          [this, worker, socket = std::move(socket)]() mutable {
+            ServeConnection(worker, std::move(socket));
+          });
+    }
+  }
+
+  static constexpr int kMinPort = 1024;
+  static constexpr int kMaxPort = 65535;
+  static constexpr int kMaxBindAttempts = 1000;
+
+  Location location_;
+  std::string socket_path_;
+  FileDescriptor listen_socket_;
+  // Readable once the server shuts down
+  FileDescriptor wakeup_fd_;
+
+  std::atomic<bool> listening_{false};
+  std::thread listener_thread_;
+  // std::thread::join cannot be called concurrently
+  std::mutex join_mutex_;
+
+  std::mutex workers_mutex_;
+  std::condition_variable workers_cv_;
+  std::list<Worker> workers_;
+};
+}  // namespace
+
+std::unique_ptr<arrow::flight::internal::ServerTransport> MakeShmServerImpl(
+    FlightServerBase* base, std::shared_ptr<MemoryManager> memory_manager) {
+  return std::make_unique<ShmServerImpl>(base, memory_manager);
+}
+
+#undef FLIGHT_LOG
+#undef FLIGHT_LOG_PEER
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
@@ -225,6 +225,67 @@ TEST(HeadersFrame, Parse) {
         HeadersFrame::Parse(std::move(buffer)));
   }
 }
+
+class TestUcpRegistrationCache : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ucp_config_t* ucp_config;
+    ASSERT_OK(FromUcsStatus("ucp_config_read",
+                            ucp_config_read(nullptr, nullptr, &ucp_config)));
+    ucp_params_t ucp_params;
+    std::memset(&ucp_params, 0, sizeof(ucp_params));
+    ucp_params.field_mask = UCP_PARAM_FIELD_FEATURES;
+    ucp_params.features = UCP_FEATURE_AM;
+    ucp_context_h ucp_context;
+    auto status = ucp_init(&ucp_params, ucp_config, &ucp_context);
+    ucp_config_release(ucp_config);
+    ASSERT_OK(FromUcsStatus("ucp_init", status));
+    auto context = std::make_shared<UcpContext>(ucp_context);
+
+    ucp_worker_params_t worker_params;
+    std::memset(&worker_params, 0, sizeof(worker_params));
+    ucp_worker_h ucp_worker;
+    ASSERT_OK(FromUcsStatus("ucp_worker_create",
+                            ucp_worker_create(context->get(), &worker_params,
+                                              &ucp_worker)));
+    worker_ = std::make_shared<UcpWorker>(std::move(context), ucp_worker);
+  }
+
+ protected:
+  std::shared_ptr<UcpWorker> worker_;
+};
+
+TEST_F(TestUcpRegistrationCache, Reuse) {
+  constexpr int64_t kBlockSize = UcpRegistrationCache::kMinBlockSize;
+  auto cache = std::make_shared<UcpRegistrationCache>(worker_, 4 * kBlockSize);
+  auto memory_manager = default_cpu_memory_manager();
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, cache->Allocate(memory_manager, 100));
+  ASSERT_EQ(buffer->size(), 100);
+  ASSERT_TRUE(buffer->is_mutable());
+  ASSERT_EQ(cache->registered_bytes(), kBlockSize);
+  ASSERT_NE(cache->Lookup(buffer->address(), buffer->size()), nullptr);
+  // Outside of any block
+  ASSERT_EQ(cache->Lookup(buffer->address() + kBlockSize, 1), nullptr);
+
+  // A released block is handed out again
+  const uintptr_t address = buffer->address();
+  buffer.reset();
+  ASSERT_OK_AND_ASSIGN(buffer, cache->Allocate(memory_manager, kBlockSize));
+  ASSERT_EQ(buffer->address(), address);
+  ASSERT_EQ(cache->registered_bytes(), kBlockSize);
+
+  // Blocks beyond the capacity are unregistered once released
+  ASSERT_OK_AND_ASSIGN(auto large, cache->Allocate(memory_manager, 8 * kBlockSize));
+  ASSERT_EQ(cache->registered_bytes(), 9 * kBlockSize);
+  large.reset();
+  ASSERT_EQ(cache->registered_bytes(), kBlockSize);
+
+  // Buffers keep the cache alive
+  cache.reset();
+  std::memset(buffer->mutable_data(), 0xff, buffer->size());
+}
+
 }  // namespace ucx
 }  // namespace transport
 
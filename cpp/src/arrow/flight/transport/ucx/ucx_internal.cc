@@ -18,6 +18,7 @@
 #include "arrow/flight/transport/ucx/ucx_internal.h"
 
 #include <array>
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -119,6 +120,134 @@ class UcxDataBuffer : public Buffer {
 };
 };  // namespace
 
+//------------------------------------------------------------
+// UcpRegistrationCache
+
+constexpr int64_t UcpRegistrationCache::kMinBlockSize;
+constexpr int64_t UcpRegistrationCache::kDefaultCapacity;
+
+/// \brief A buffer carved out of a registered block, which goes back
+///   to the cache on destruction.
+class UcpRegistrationCache::CachedBuffer : public Buffer {
+ public:
+  CachedBuffer(std::shared_ptr<UcpRegistrationCache> cache, BlockKey key, Block block,
+               int64_t size)
+      : Buffer(block.memory->data(), size, block.memory->memory_manager()),
+        cache_(std::move(cache)),
+        key_(key),
+        block_(std::move(block)) {
+    is_mutable_ = true;
+  }
+
+  ~CachedBuffer() override { cache_->Release(key_, std::move(block_)); }
+
+ private:
+  std::shared_ptr<UcpRegistrationCache> cache_;
+  BlockKey key_;
+  Block block_;
+};
+
+UcpRegistrationCache::UcpRegistrationCache(std::shared_ptr<UcpWorker> worker,
+                                           int64_t capacity)
+    : worker_(std::move(worker)), capacity_(capacity) {}
+
+UcpRegistrationCache::~UcpRegistrationCache() {
+  // Blocks in use hold a reference to the cache, so all are free here
+  for (auto& item : free_blocks_) {
+    for (auto& block : item.second) Unregister(&block);
+  }
+}
+
+arrow::Result<std::unique_ptr<Buffer>> UcpRegistrationCache::Allocate(
+    const std::shared_ptr<MemoryManager>& memory_manager, int64_t size) {
+  // Device buffers can be unwrapped to the underlying allocation (see
+  // CudaBuffer::FromBuffer), which would escape the lifetime tracking
+  DCHECK(memory_manager->is_cpu());
+  const int64_t block_size =
+      std::max(kMinBlockSize, bit_util::NextPower2(std::max<int64_t>(size, 1)));
+  const BlockKey key(memory_manager.get(), block_size);
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = free_blocks_.find(key);
+    if (it != free_blocks_.end() && !it->second.empty()) {
+      Block block = std::move(it->second.back());
+      it->second.pop_back();
+      return std::make_unique<CachedBuffer>(shared_from_this(), key, std::move(block),
+                                            size);
+    }
+    // Make room for the new block
+    EvictLocked(block_size);
+  }
+
+  Block block;
+  ARROW_ASSIGN_OR_RAISE(block.memory, memory_manager->AllocateBuffer(block_size));
+  TryMapBuffer(worker_->context().get(), *block.memory, &block.memh);
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    registered_bytes_ += block_size;
+    if (block.memh) {
+      registrations_[block.memory->address()] = {block.memory->address() + block_size,
+                                                 block.memh};
+    }
+  }
+  return std::make_unique<CachedBuffer>(shared_from_this(), key, std::move(block), size);
+}
+
+ucp_mem_h UcpRegistrationCache::Lookup(uintptr_t address, int64_t size) const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  // The last block starting at or before the address
+  auto it = registrations_.upper_bound(address);
+  if (it == registrations_.begin()) return nullptr;
+  --it;
+  if (address + static_cast<uintptr_t>(size) > it->second.first) return nullptr;
+  return it->second.second;
+}
+
+int64_t UcpRegistrationCache::registered_bytes() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return registered_bytes_;
+}
+
+void UcpRegistrationCache::Release(BlockKey key, Block block) {
+  std::unique_lock<std::mutex> guard(mutex_);
+  if (registered_bytes_ <= capacity_) {
+    free_blocks_[key].push_back(std::move(block));
+    return;
+  }
+  registered_bytes_ -= key.second;
+  guard.unlock();
+  Unregister(&block);
+}
+
+void UcpRegistrationCache::Unregister(Block* block) {
+  if (block->memh) {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      registrations_.erase(block->memory->address());
+    }
+    TryUnmapBuffer(worker_->context().get(), block->memh);
+    block->memh = nullptr;
+  }
+  block->memory.reset();
+}
+
+void UcpRegistrationCache::EvictLocked(int64_t needed) {
+  for (auto it = free_blocks_.begin();
+       it != free_blocks_.end() && registered_bytes_ + needed > capacity_;) {
+    auto& blocks = it->second;
+    while (!blocks.empty() && registered_bytes_ + needed > capacity_) {
+      Block& block = blocks.back();
+      if (block.memh) {
+        registrations_.erase(block.memory->address());
+        TryUnmapBuffer(worker_->context().get(), block.memh);
+      }
+      registered_bytes_ -= it->first.second;
+      blocks.pop_back();
+    }
+    it = blocks.empty() ? free_blocks_.erase(it) : std::next(it);
+  }
+}
+
 constexpr size_t FrameHeader::kFrameHeaderBytes;
 constexpr uint8_t FrameHeader::kFrameVersion;
 
@@ -422,6 +551,9 @@ class UcpCallDriver::Impl {
         read_memory_pool_(default_memory_pool()),
         write_memory_pool_(default_memory_pool()),
         memory_manager_(CPUDevice::Instance()->default_memory_manager()),
+        write_memory_manager_(CPUDevice::memory_manager(write_memory_pool_)),
+        registration_cache_(std::make_shared<UcpRegistrationCache>(
+            worker_, UcpRegistrationCache::kDefaultCapacity)),
         name_("(unknown remote)"),
         counter_(0) {
 #if defined(ARROW_FLIGHT_UCX_SEND_IOV_MAP)
@@ -615,6 +747,12 @@ class UcpCallDriver::Impl {
       // XXX: UCX doesn't appear to autodetect this correctly if we
       // use UNKNOWN
       request_param.memory_type = UCS_MEMORY_TYPE_CUDA;
+#if UCP_API_VERSION >= UCP_VERSION(1, 12)
+      // Let the receiver fetch device memory directly (RDMA GET into
+      // its own device buffer) rather than having UCX stage an eager
+      // message through host memory
+      request_param.flags |= UCP_AM_SEND_FLAG_RNDV;
+#endif
     }
 
     if (kEnableContigSend && all_cpu) {
@@ -628,10 +766,17 @@ class UcpCallDriver::Impl {
       auto* pending_contig = reinterpret_cast<PendingContigSend*>(pending_send.get());
 
       const int64_t body_length = std::max<int64_t>(payload.ipc_message.body_length, 1);
-      ARROW_ASSIGN_OR_RAISE(pending_contig->ipc_message,
-                            AllocateBuffer(body_length, write_memory_pool_));
-      TryMapBuffer(worker_->context().get(), *pending_contig->ipc_message,
-                   &pending_contig->memh_p);
+      if (body_length >= UcpRegistrationCache::kMinBlockSize) {
+        // Reuse memory registered by previous sends
+        ARROW_ASSIGN_OR_RAISE(
+            pending_contig->ipc_message,
+            registration_cache_->Allocate(write_memory_manager_, body_length));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(pending_contig->ipc_message,
+                              AllocateBuffer(body_length, write_memory_pool_));
+        TryMapBuffer(worker_->context().get(), *pending_contig->ipc_message,
+                     &pending_contig->memh_p);
+      }
 
       uint8_t* ipc_message = pending_contig->ipc_message->mutable_data();
       if (payload.ipc_message.body_length == 0) {
@@ -676,7 +821,11 @@ class UcpCallDriver::Impl {
         ++iov;
 
 #if defined(ARROW_FLIGHT_UCX_SEND_IOV_MAP)
-        TryMapBuffer(worker_->context().get(), *buffer, memh_p);
+        // Buffers received into the cache (e.g. when forwarding data)
+        // are already registered
+        if (!registration_cache_->Lookup(buffer->address(), buffer->size())) {
+          TryMapBuffer(worker_->context().get(), *buffer, memh_p);
+        }
         memh_p++;
 #endif
 
@@ -814,6 +963,7 @@ class UcpCallDriver::Impl {
   }
   void set_write_memory_pool(MemoryPool* pool) {
     write_memory_pool_ = pool ? pool : default_memory_pool();
+    write_memory_manager_ = CPUDevice::memory_manager(write_memory_pool_);
   }
   const std::string& peer() const { return name_; }
 
@@ -829,7 +979,7 @@ class UcpCallDriver::Impl {
   class PendingContigSend : public PendingAmSend {
    public:
     std::unique_ptr<Buffer> ipc_message;
-    ucp_mem_h memh_p;
+    ucp_mem_h memh_p = nullptr;
 
     virtual ~PendingContigSend() {
       TryUnmapBuffer(driver->worker_->context().get(), memh_p);
@@ -854,7 +1004,7 @@ class UcpCallDriver::Impl {
   struct PendingAmRecv {
     UcpCallDriver::Impl* driver;
     std::shared_ptr<Frame> frame;
-    ucp_mem_h memh_p;
+    ucp_mem_h memh_p = nullptr;
 
     PendingAmRecv(UcpCallDriver::Impl* driver_, std::shared_ptr<Frame> frame_)
         : driver(driver_), frame(std::move(frame_)) {}
@@ -933,16 +1083,28 @@ class UcpCallDriver::Impl {
       // and recv the data later (is it allowed to call
       // ucp_am_recv_data_nbx asynchronously?).
       if (frame->type == FrameType::kPayloadBody) {
-        ARROW_ASSIGN_OR_RAISE(frame->buffer,
-                              memory_manager_->AllocateBuffer(data_length));
+        if (memory_manager_->is_cpu() &&
+            static_cast<int64_t>(data_length) >= UcpRegistrationCache::kMinBlockSize) {
+          // Receive into memory that stays registered across payloads
+          ARROW_ASSIGN_OR_RAISE(frame->buffer, registration_cache_->Allocate(
+                                                   memory_manager_, data_length));
+        } else {
+          ARROW_ASSIGN_OR_RAISE(frame->buffer,
+                                memory_manager_->AllocateBuffer(data_length));
+        }
       } else {
         ARROW_ASSIGN_OR_RAISE(frame->buffer,
                               AllocateBuffer(data_length, read_memory_pool_));
       }
 
       PendingAmRecv* pending_recv = new PendingAmRecv(this, std::move(frame));
-      TryMapBuffer(worker_->context().get(), *pending_recv->frame->buffer,
-                   &pending_recv->memh_p);
+      const Buffer& dest_buffer = *pending_recv->frame->buffer;
+      ucp_mem_h memh =
+          registration_cache_->Lookup(dest_buffer.address(), dest_buffer.size());
+      if (!memh) {
+        TryMapBuffer(worker_->context().get(), dest_buffer, &pending_recv->memh_p);
+        memh = pending_recv->memh_p;
+      }
 
       ucp_request_param_t recv_param;
       recv_param.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK |
@@ -951,6 +1113,14 @@ class UcpCallDriver::Impl {
       recv_param.cb.recv_am = AmRecvCallback;
       recv_param.user_data = pending_recv;
       recv_param.memory_type = InferMemoryType(*pending_recv->frame->buffer);
+#if UCP_API_VERSION >= UCP_VERSION(1, 14)
+      if (memh) {
+        recv_param.op_attr_mask |= UCP_OP_ATTR_FIELD_MEMH;
+        recv_param.memh = memh;
+      }
+#else
+      ARROW_UNUSED(memh);
+#endif
 
       void* dest =
           reinterpret_cast<void*>(pending_recv->frame->buffer->mutable_address());
@@ -1022,6 +1192,9 @@ class UcpCallDriver::Impl {
   MemoryPool* read_memory_pool_;
   MemoryPool* write_memory_pool_;
   std::shared_ptr<MemoryManager> memory_manager_;
+  // Allocates from write_memory_pool_ (a stable key for the cache)
+  std::shared_ptr<MemoryManager> write_memory_manager_;
+  std::shared_ptr<UcpRegistrationCache> registration_cache_;
 
   // Internal name for logging/tracing
   std::string name_;
@@ -20,6 +20,9 @@
 #pragma once
 
 #include <array>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -112,6 +115,62 @@ class UcpWorker final {
   ucp_worker_h ucp_worker_;
 };
 
+/// \brief A cache of memory registered with a UCP context.
+///
+/// Registering (pinning) memory with ucp_mem_map costs about as much
+/// as transferring it, so instead of registering each buffer that a
+/// payload is received into or sent from, buffers are carved out of
+/// registered blocks that go back to the cache when the buffer is
+/// destroyed. Blocks are kept per memory manager (host or device
+/// memory) and power-of-two size class; once more than `capacity`
+/// bytes are registered, released blocks are unregistered and freed.
+///
+/// Buffers may outlive the cache's owner: they keep the cache (and
+/// hence the UCP context) alive.
+class UcpRegistrationCache
+    : public std::enable_shared_from_this<UcpRegistrationCache> {
+ public:
+  /// \brief Buffers smaller than this are not worth caching.
+  static constexpr int64_t kMinBlockSize = 64 * 1024;
+  static constexpr int64_t kDefaultCapacity = 64 * 1024 * 1024;
+
+  UcpRegistrationCache(std::shared_ptr<UcpWorker> worker, int64_t capacity);
+  ~UcpRegistrationCache();
+
+  /// \brief Allocate a registered, mutable buffer of `size` bytes
+  ///   from the given memory manager.
+  arrow::Result<std::unique_ptr<Buffer>> Allocate(
+      const std::shared_ptr<MemoryManager>& memory_manager, int64_t size);
+
+  /// \brief Get the registration covering the given address range,
+  ///   or nullptr if it doesn't lie within a block of the cache.
+  ucp_mem_h Lookup(uintptr_t address, int64_t size) const;
+
+  /// \brief The number of bytes registered, in use or not.
+  int64_t registered_bytes() const;
+
+ private:
+  class CachedBuffer;
+  struct Block {
+    std::shared_ptr<Buffer> memory;
+    ucp_mem_h memh = nullptr;
+  };
+  using BlockKey = std::pair<const MemoryManager*, int64_t>;
+
+  void Release(BlockKey key, Block block);
+  void Unregister(Block* block);
+  void EvictLocked(int64_t needed);
+
+  std::shared_ptr<UcpWorker> worker_;
+  const int64_t capacity_;
+  mutable std::mutex mutex_;
+  int64_t registered_bytes_ = 0;
+  /// The blocks not in use, by memory manager and size class.
+  std::map<BlockKey, std::vector<Block>> free_blocks_;
+  /// All registered blocks, by address: (end address, registration).
+  std::map<uintptr_t, std::pair<uintptr_t, ucp_mem_h>> registrations_;
+};
+
 //------------------------------------------------------------
 // Message Framing
 
@@ -28,6 +28,7 @@ template <typename T>
 class AsyncListener;
 class AsyncListenerBase;
 class AsyncRpc;
+class AsyncStreamListener;
 struct BasicAuth;
 class ClientAuthHandler;
 class ClientMiddleware;
@@ -56,6 +57,7 @@ class ServerMiddleware;
 class ServerMiddlewareFactory;
 struct Ticket;
 namespace internal {
+class AsyncDataListener;
 class AsyncRpc;
 class ClientTransport;
 struct FlightData;
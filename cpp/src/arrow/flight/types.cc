@@ -1176,5 +1176,28 @@ void AsyncListenerBase::TryCancel() {
   }
 }
 
+namespace {
+constexpr char kNotStarted[] = "The async call was not started";
+}  // namespace
+
+Status AsyncStreamListener::Begin(const FlightDescriptor& descriptor,
+                                  std::shared_ptr<Schema> schema) {
+  auto* rpc = internal::ClientTransport::GetAsyncRpc(this);
+  if (!rpc) return Status::Invalid(kNotStarted);
+  return rpc->Begin(descriptor, std::move(schema));
+}
+
+Status AsyncStreamListener::Write(FlightStreamChunk chunk) {
+  auto* rpc = internal::ClientTransport::GetAsyncRpc(this);
+  if (!rpc) return Status::Invalid(kNotStarted);
+  return rpc->Write(std::move(chunk));
+}
+
+Status AsyncStreamListener::DoneWriting() {
+  auto* rpc = internal::ClientTransport::GetAsyncRpc(this);
+  if (!rpc) return Status::Invalid(kNotStarted);
+  return rpc->DoneWriting();
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -158,6 +158,15 @@ Status MakeFlightError(FlightStatusCode code, std::string message,
 /// Header values are ordered.
 using CallHeaders = std::multimap<std::string_view, std::string_view>;
 
+/// \brief The call header through which a client negotiates the
+///   compression of the record batches that the server sends it.
+///
+/// The value lists the codecs the client accepts, by order of
+/// preference, separated by commas: "none", "lz4" or "zstd",
+/// optionally followed by ":<level>". For example, "zstd:3,lz4,none".
+/// See NegotiateIpcWriteOptions().
+static constexpr char kCompressionHeader[] = "x-arrow-flight-compression";
+
 /// \brief A TLS certificate plus key.
 struct ARROW_FLIGHT_EXPORT CertKeyPair {
   /// \brief The certificate in PEM format.
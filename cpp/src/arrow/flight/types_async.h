@@ -71,6 +71,51 @@ class ARROW_FLIGHT_EXPORT AsyncListener : public AsyncListenerBase {
   virtual void OnFinish(Status status) = 0;
 };
 
+/// \brief Callbacks for the data of an async DoGet, DoPut or DoExchange.
+///
+/// OnNext() gets each chunk read from the server: the record batches
+/// and application metadata of a DoGet or DoExchange, or the
+/// application metadata of a DoPut (with a null batch).
+///
+/// The callbacks for the reads are never called concurrently with
+/// each other, but OnWriteDone() may be called concurrently with
+/// them. Callbacks should not block, since they run on the threads
+/// of the transport that drive every other call of the client.
+class ARROW_FLIGHT_EXPORT AsyncStreamListener : public AsyncListener<FlightStreamChunk> {
+ public:
+  /// \brief Get the schema of the data read from the server.
+  ///
+  /// This is called once, before OnNext() gets the first record batch.
+  virtual void OnSchema(std::shared_ptr<Schema> schema) {}
+
+  /// \brief A chunk passed to Write() has been sent.
+  ///
+  /// Writes are queued until the transport can send them, so
+  /// applications writing more than they can hold in memory should
+  /// wait for this before writing the next chunk.
+  virtual void OnWriteDone() {}
+
+  /// \name Writing (DoPut and DoExchange only)
+  /// These may be called once the call was started, until
+  /// DoneWriting(), and not concurrently with each other. Errors from
+  /// the transport are reported to OnFinish().
+  /// @{
+
+  /// \brief Send the descriptor and the schema of the data to write.
+  ///
+  /// The schema may be null for a DoExchange that only writes
+  /// application metadata.
+  Status Begin(const FlightDescriptor& descriptor, std::shared_ptr<Schema> schema);
+
+  /// \brief Write a record batch, application metadata, or both.
+  Status Write(FlightStreamChunk chunk);
+
+  /// \brief Finish writing, once all chunks have been sent.
+  Status DoneWriting();
+
+  /// @}
+};
+
 /// @}
 
 }  // namespace arrow::flight
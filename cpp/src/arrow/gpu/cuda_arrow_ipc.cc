@@ -17,11 +17,16 @@
 
 #include "arrow/gpu/cuda_arrow_ipc.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <limits>
+#include <map>
 #include <memory>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
+#include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
@@ -29,17 +34,22 @@
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/visibility.h"
 
 #include "generated/Message_generated.h"
 
 #include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_internal.h"
 #include "arrow/gpu/cuda_memory.h"
 
 namespace arrow {
 
 namespace flatbuf = org::apache::arrow::flatbuf;
 
+using internal::checked_cast;
+
 namespace cuda {
 
 Result<std::shared_ptr<CudaBuffer>> SerializeRecordBatch(const RecordBatch& batch,
@@ -65,5 +75,161 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
                               ipc::IpcReadOptions::Defaults());
 }
 
+namespace {
+
+// A group of buffers is copied in a single transfer if the memory between them
+// is no larger than their own size plus this
+constexpr int64_t kMaxTransferSlack = 4096;
+
+// The device buffers of a batch that lie in the same device allocation
+struct TransferGroup {
+  uintptr_t begin = std::numeric_limits<uintptr_t>::max();
+  uintptr_t end = 0;
+  int64_t nbytes = 0;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  // Position of the group in the host buffer
+  int64_t host_offset = 0;
+  bool copy_whole_range = true;
+};
+
+void CollectBuffers(const ArrayData& data, std::vector<std::shared_ptr<Buffer>>* out) {
+  for (const auto& buffer : data.buffers) {
+    if (buffer && buffer->size() > 0) {
+      out->push_back(buffer);
+    }
+  }
+  for (const auto& child : data.child_data) {
+    CollectBuffers(*child, out);
+  }
+  if (data.dictionary) {
+    CollectBuffers(*data.dictionary, out);
+  }
+}
+
+std::shared_ptr<ArrayData> ReplaceBuffers(
+    const ArrayData& data,
+    const std::unordered_map<const Buffer*, std::shared_ptr<Buffer>>& host_buffers) {
+  auto out = data.Copy();
+  for (auto& buffer : out->buffers) {
+    if (buffer) {
+      auto it = host_buffers.find(buffer.get());
+      // Empty buffers aren't copied
+      buffer = it != host_buffers.end() ? it->second
+                                        : std::make_shared<Buffer>(nullptr, 0);
+    }
+  }
+  for (auto& child : out->child_data) {
+    child = ReplaceBuffers(*child, host_buffers);
+  }
+  if (out->dictionary) {
+    out->dictionary = ReplaceBuffers(*out->dictionary, host_buffers);
+  }
+  return out;
+}
+
+}  // namespace
+
+Result<std::shared_ptr<RecordBatch>> CopyRecordBatchToHostAsync(
+    const RecordBatch& batch, const Device::Stream& stream, CudaHostBufferPool* pool) {
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  for (const auto& column : batch.column_data()) {
+    CollectBuffers(*column, &buffers);
+  }
+
+  for (const auto& buffer : buffers) {
+    if (!IsCudaDevice(*buffer->device())) {
+      return Status::Invalid("Record batch buffers must be on a CUDA device, got ",
+                             buffer->device()->ToString());
+    }
+  }
+  std::shared_ptr<CudaContext> context;
+  if (!buffers.empty()) {
+    ARROW_ASSIGN_OR_RAISE(auto first, CudaBuffer::FromBuffer(buffers[0]));
+    context = first->context();
+  }
+
+  // Group the buffers by device allocation, so that each group can be copied
+  // in one transfer
+  std::map<uintptr_t, TransferGroup> groups;
+  for (const auto& buffer : buffers) {
+    if (checked_cast<const CudaDevice&>(*buffer->device()).device_number() !=
+        context->device_number()) {
+      return Status::Invalid("Record batch buffers must all be on the same CUDA device");
+    }
+    CUdeviceptr base;
+    size_t allocation_size;
+    {
+      internal::ContextSaver set_temporary(*context);
+      CU_RETURN_NOT_OK("cuMemGetAddressRange",
+                       cuMemGetAddressRange(&base, &allocation_size,
+                                            static_cast<CUdeviceptr>(buffer->address())));
+    }
+    auto& group = groups[static_cast<uintptr_t>(base)];
+    group.begin = std::min(group.begin, buffer->address());
+    group.end = std::max(group.end, buffer->address() + buffer->size());
+    group.nbytes += buffer->size();
+    group.buffers.push_back(buffer);
+  }
+
+  // Lay out the groups in the host buffer.  A group whose buffers are far
+  // apart is copied buffer by buffer instead, rather than copying the memory
+  // between them.
+  int64_t host_size = 0;
+  for (auto& [base, group] : groups) {
+    const auto range_size = static_cast<int64_t>(group.end - group.begin);
+    group.copy_whole_range = range_size <= 2 * group.nbytes + kMaxTransferSlack;
+    group.host_offset = host_size;
+    if (group.copy_whole_range) {
+      host_size += bit_util::RoundUpToMultipleOf64(range_size);
+    } else {
+      for (const auto& buffer : group.buffers) {
+        host_size += bit_util::RoundUpToMultipleOf64(buffer->size());
+      }
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto host_buffer, pool->Allocate(host_size));
+
+  std::unordered_map<const Buffer*, std::shared_ptr<Buffer>> host_buffers;
+  for (const auto& [base, group] : groups) {
+    if (group.copy_whole_range) {
+      const auto range_size = static_cast<int64_t>(group.end - group.begin);
+      ARROW_ASSIGN_OR_RAISE(
+          auto range, context->View(reinterpret_cast<uint8_t*>(group.begin), range_size));
+      RETURN_NOT_OK(range->CopyToHostAsync(
+          0, range_size, host_buffer->mutable_data() + group.host_offset, stream));
+      for (const auto& buffer : group.buffers) {
+        host_buffers[buffer.get()] = SliceMutableBuffer(
+            host_buffer,
+            group.host_offset + static_cast<int64_t>(buffer->address() - group.begin),
+            buffer->size());
+      }
+    } else {
+      int64_t host_offset = group.host_offset;
+      for (const auto& buffer : group.buffers) {
+        ARROW_ASSIGN_OR_RAISE(auto cuda_buffer, CudaBuffer::FromBuffer(buffer));
+        RETURN_NOT_OK(cuda_buffer->CopyToHostAsync(
+            0, buffer->size(), host_buffer->mutable_data() + host_offset, stream));
+        host_buffers[buffer.get()] =
+            SliceMutableBuffer(host_buffer, host_offset, buffer->size());
+        host_offset += bit_util::RoundUpToMultipleOf64(buffer->size());
+      }
+    }
+  }
+
+  std::shared_ptr<Device::SyncEvent> sync_event;
+  if (context) {
+    ARROW_ASSIGN_OR_RAISE(sync_event, context->memory_manager()->MakeDeviceSyncEvent());
+    RETURN_NOT_OK(sync_event->Record(stream));
+  }
+
+  std::vector<std::shared_ptr<ArrayData>> columns;
+  columns.reserve(batch.num_columns());
+  for (const auto& column : batch.column_data()) {
+    columns.push_back(ReplaceBuffers(*column, host_buffers));
+  }
+  return RecordBatch::Make(batch.schema(), batch.num_rows(), std::move(columns),
+                           DeviceAllocationType::kCPU, std::move(sync_event));
+}
+
 }  // namespace cuda
 }  // namespace arrow
@@ -66,6 +66,25 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
     const std::shared_ptr<Schema>& schema, const ipc::DictionaryMemo* dictionary_memo,
     const std::shared_ptr<CudaBuffer>& buffer, MemoryPool* pool = default_memory_pool());
 
+/// \brief Copy a record batch on a CUDA device to pinned host memory,
+/// asynchronously
+///
+/// The copies of all the buffers are enqueued on the stream, to a single host
+/// buffer from the pool.  Buffers that lie in the same device allocation, such
+/// as those of a batch read with ReadRecordBatch, are copied in a single
+/// transfer.
+///
+/// The returned batch is on the CPU, but its data is only valid once its
+/// sync_event(), recorded on the stream after the copies, is waited on.
+/// Computation enqueued on other streams meanwhile overlaps with the copies.
+/// \param[in] batch the record batch, with all its buffers on the same device
+/// \param[in] stream the CudaDevice::Stream to enqueue the copies on
+/// \param[in] pool the pool to allocate pinned host memory from
+/// \return RecordBatch or Status
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatch>> CopyRecordBatchToHostAsync(
+    const RecordBatch& batch, const Device::Stream& stream, CudaHostBufferPool* pool);
+
 /// @}
 
 }  // namespace cuda
@@ -0,0 +1,977 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_compute.h"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cuda.h>
+#include <nvrtc.h>
+
+#include "arrow/array/data.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/registry.h"
+#include "arrow/datum.h"
+#include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_internal.h"
+#include "arrow/gpu/cuda_memory.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace cuda {
+
+using internal::ContextSaver;
+
+namespace {
+
+// Kernels for the elementwise functions compute 8 rows per thread, so that each
+// thread owns a byte of the output bitmaps.  Kernel names are the operation and
+// the C types of their arguments, e.g. "Add_int32_t" or "Take_double_int64_t".
+constexpr char kKernelSource[] = R"(
+typedef signed char int8_t;
+typedef unsigned char uint8_t;
+typedef short int16_t;
+typedef unsigned short uint16_t;
+typedef int int32_t;
+typedef unsigned int uint32_t;
+typedef long long int64_t;
+typedef unsigned long long uint64_t;
+
+#define BLOCK_SIZE 256
+
+__device__ __forceinline__ int64_t ThreadIndex() {
+  return static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+}
+
+__device__ __forceinline__ bool GetBit(const uint8_t* bits, int64_t i) {
+  return (bits[i >> 3] >> (i & 7)) & 1;
+}
+
+__device__ __forceinline__ bool IsValid(const uint8_t* validity, int64_t i) {
+  return validity == nullptr || GetBit(validity, i);
+}
+
+struct Add {
+  template <typename T>
+  __device__ static T Call(T l, T r) {
+    return static_cast<T>(l + r);
+  }
+};
+struct Subtract {
+  template <typename T>
+  __device__ static T Call(T l, T r) {
+    return static_cast<T>(l - r);
+  }
+};
+struct Multiply {
+  template <typename T>
+  __device__ static T Call(T l, T r) {
+    return static_cast<T>(l * r);
+  }
+};
+struct Equal {
+  template <typename T> __device__ static bool Call(T l, T r) { return l == r; }
+};
+struct NotEqual {
+  template <typename T> __device__ static bool Call(T l, T r) { return l != r; }
+};
+struct Less {
+  template <typename T> __device__ static bool Call(T l, T r) { return l < r; }
+};
+struct LessEqual {
+  template <typename T> __device__ static bool Call(T l, T r) { return l <= r; }
+};
+struct Greater {
+  template <typename T> __device__ static bool Call(T l, T r) { return l > r; }
+};
+struct GreaterEqual {
+  template <typename T> __device__ static bool Call(T l, T r) { return l >= r; }
+};
+
+// An argument is a scalar if its values are null
+#define BINARY_PARAMS(T)                                                           \
+  const T *left, const uint8_t *left_validity, int64_t left_offset, T left_scalar, \
+      const T *right, const uint8_t *right_validity, int64_t right_offset,         \
+      T right_scalar, int64_t length
+#define BINARY_ARGS                                                            \
+  left, left_validity, left_offset, left_scalar, right, right_validity,        \
+      right_offset, right_scalar, length
+
+template <typename Op, typename T>
+__device__ void Arithmetic(BINARY_PARAMS(T), T* out, uint8_t* out_validity) {
+  const int64_t begin = ThreadIndex() * 8;
+  if (begin >= length) return;
+  const int64_t end = begin + 8 < length ? begin + 8 : length;
+  uint8_t valid_bits = 0;
+  for (int64_t i = begin; i < end; ++i) {
+    const T l = left ? left[left_offset + i] : left_scalar;
+    const T r = right ? right[right_offset + i] : right_scalar;
+    out[i] = Op::Call(l, r);
+    const bool valid = (left == nullptr || IsValid(left_validity, left_offset + i)) &&
+                       (right == nullptr || IsValid(right_validity, right_offset + i));
+    valid_bits |= static_cast<uint8_t>(valid) << (i - begin);
+  }
+  out_validity[begin >> 3] = valid_bits;
+}
+
+template <typename Op, typename T>
+__device__ void Compare(BINARY_PARAMS(T), uint8_t* out, uint8_t* out_validity) {
+  const int64_t begin = ThreadIndex() * 8;
+  if (begin >= length) return;
+  const int64_t end = begin + 8 < length ? begin + 8 : length;
+  uint8_t bits = 0;
+  uint8_t valid_bits = 0;
+  for (int64_t i = begin; i < end; ++i) {
+    const T l = left ? left[left_offset + i] : left_scalar;
+    const T r = right ? right[right_offset + i] : right_scalar;
+    bits |= static_cast<uint8_t>(Op::Call(l, r)) << (i - begin);
+    const bool valid = (left == nullptr || IsValid(left_validity, left_offset + i)) &&
+                       (right == nullptr || IsValid(right_validity, right_offset + i));
+    valid_bits |= static_cast<uint8_t>(valid) << (i - begin);
+  }
+  out[begin >> 3] = bits;
+  out_validity[begin >> 3] = valid_bits;
+}
+
+template <typename T, typename I>
+__device__ void Take(const T* values, const uint8_t* values_validity,
+                     int64_t values_offset, int64_t values_length, const I* indices,
+                     const uint8_t* indices_validity, int64_t indices_offset,
+                     int64_t length, T* out, uint8_t* out_validity,
+                     int32_t* out_of_bounds) {
+  const int64_t begin = ThreadIndex() * 8;
+  if (begin >= length) return;
+  const int64_t end = begin + 8 < length ? begin + 8 : length;
+  uint8_t valid_bits = 0;
+  for (int64_t i = begin; i < end; ++i) {
+    bool valid = IsValid(indices_validity, indices_offset + i);
+    if (valid) {
+      const int64_t index = static_cast<int64_t>(indices[indices_offset + i]);
+      if (index < 0 || index >= values_length) {
+        *out_of_bounds = 1;
+        valid = false;
+      } else {
+        out[i] = values[values_offset + index];
+        valid = IsValid(values_validity, values_offset + index);
+      }
+    }
+    valid_bits |= static_cast<uint8_t>(valid) << (i - begin);
+  }
+  out_validity[begin >> 3] = valid_bits;
+}
+
+__device__ __forceinline__ bool IsSelected(const uint8_t* mask,
+                                           const uint8_t* mask_validity,
+                                           int64_t mask_offset, int64_t i) {
+  return IsValid(mask_validity, mask_offset + i) && GetBit(mask, mask_offset + i);
+}
+
+// The number of selected rows in each run of 64 rows
+extern "C" __global__ void FilterCount(const uint8_t* mask, const uint8_t* mask_validity,
+                                       int64_t mask_offset, int64_t length,
+                                       int64_t* counts) {
+  const int64_t begin = ThreadIndex() * 64;
+  if (begin >= length) return;
+  const int64_t end = begin + 64 < length ? begin + 64 : length;
+  int64_t count = 0;
+  for (int64_t i = begin; i < end; ++i) {
+    count += IsSelected(mask, mask_validity, mask_offset, i);
+  }
+  counts[ThreadIndex()] = count;
+}
+
+// Copy the selected rows of each run of 64 rows, starting at the position of the
+// run in the output.  The output validity must be zeroed.
+template <typename T>
+__device__ void Filter(const T* values, const uint8_t* values_validity,
+                       int64_t values_offset, const uint8_t* mask,
+                       const uint8_t* mask_validity, int64_t mask_offset,
+                       int64_t length, const int64_t* positions, T* out,
+                       uint32_t* out_validity) {
+  const int64_t begin = ThreadIndex() * 64;
+  if (begin >= length) return;
+  const int64_t end = begin + 64 < length ? begin + 64 : length;
+  int64_t position = positions[ThreadIndex()];
+  for (int64_t i = begin; i < end; ++i) {
+    if (!IsSelected(mask, mask_validity, mask_offset, i)) continue;
+    out[position] = values[values_offset + i];
+    if (IsValid(values_validity, values_offset + i)) {
+      // Runs of rows don't map to whole words of the output
+      atomicOr(out_validity + (position >> 5), 1u << (position & 31));
+    }
+    ++position;
+  }
+}
+
+struct Sum {
+  template <typename A> __device__ static A Combine(A a, A b) { return a + b; }
+};
+struct Min {
+  template <typename A> __device__ static A Combine(A a, A b) { return b < a ? b : a; }
+  // Ignore NaNs
+  __device__ static float Combine(float a, float b) { return fminf(a, b); }
+  __device__ static double Combine(double a, double b) { return fmin(a, b); }
+};
+struct Max {
+  template <typename A> __device__ static A Combine(A a, A b) { return a < b ? b : a; }
+  __device__ static float Combine(float a, float b) { return fmaxf(a, b); }
+  __device__ static double Combine(double a, double b) { return fmax(a, b); }
+};
+
+// Reduce the valid values to a partial result and count per block
+template <typename Op, typename T, typename A>
+__device__ void Reduce(const T* values, const uint8_t* validity, int64_t offset,
+                       int64_t length, A* partials, int64_t* counts) {
+  __shared__ A shared_values[BLOCK_SIZE];
+  __shared__ int64_t shared_counts[BLOCK_SIZE];
+  A acc = A();
+  int64_t count = 0;
+  for (int64_t i = ThreadIndex(); i < length;
+       i += static_cast<int64_t>(blockDim.x) * gridDim.x) {
+    if (IsValid(validity, offset + i)) {
+      const A value = static_cast<A>(values[offset + i]);
+      acc = count == 0 ? value : Op::Combine(acc, value);
+      ++count;
+    }
+  }
+  shared_values[threadIdx.x] = acc;
+  shared_counts[threadIdx.x] = count;
+  __syncthreads();
+  for (unsigned int stride = blockDim.x / 2; stride > 0; stride /= 2) {
+    if (threadIdx.x < stride && shared_counts[threadIdx.x + stride] > 0) {
+      const A other = shared_values[threadIdx.x + stride];
+      shared_values[threadIdx.x] = shared_counts[threadIdx.x] == 0
+                                       ? other
+                                       : Op::Combine(shared_values[threadIdx.x], other);
+      shared_counts[threadIdx.x] += shared_counts[threadIdx.x + stride];
+    }
+    __syncthreads();
+  }
+  if (threadIdx.x == 0) {
+    partials[blockIdx.x] = shared_values[0];
+    counts[blockIdx.x] = shared_counts[0];
+  }
+}
+
+// The number of set bits of a bitmap padded to whole words with zeros
+extern "C" __global__ void CountSetBits(const uint64_t* bitmap, int64_t num_words,
+                                        uint64_t* count) {
+  const int64_t i = ThreadIndex();
+  if (i < num_words) {
+    atomicAdd(count, static_cast<uint64_t>(__popcll(bitmap[i])));
+  }
+}
+
+#define ARITHMETIC_KERNEL(OP, T)                                              \
+  extern "C" __global__ void OP##_##T(BINARY_PARAMS(T), T* out,               \
+                                      uint8_t* out_validity) {                \
+    Arithmetic<OP, T>(BINARY_ARGS, out, out_validity);                        \
+  }
+#define COMPARE_KERNEL(OP, T)                                                 \
+  extern "C" __global__ void OP##_##T(BINARY_PARAMS(T), uint8_t* out,         \
+                                      uint8_t* out_validity) {                \
+    Compare<OP, T>(BINARY_ARGS, out, out_validity);                           \
+  }
+#define TAKE_KERNEL(I, T)                                                     \
+  extern "C" __global__ void Take_##T##_##I(                                  \
+      const T* values, const uint8_t* values_validity, int64_t values_offset, \
+      int64_t values_length, const I* indices, const uint8_t* indices_validity, \
+      int64_t indices_offset, int64_t length, T* out, uint8_t* out_validity,  \
+      int32_t* out_of_bounds) {                                               \
+    Take<T, I>(values, values_validity, values_offset, values_length, indices, \
+               indices_validity, indices_offset, length, out, out_validity,   \
+               out_of_bounds);                                                \
+  }
+#define FILTER_KERNEL(UNUSED, T)                                              \
+  extern "C" __global__ void Filter_##T(                                      \
+      const T* values, const uint8_t* values_validity, int64_t values_offset, \
+      const uint8_t* mask, const uint8_t* mask_validity, int64_t mask_offset, \
+      int64_t length, const int64_t* positions, T* out,                       \
+      uint32_t* out_validity) {                                               \
+    Filter<T>(values, values_validity, values_offset, mask, mask_validity,    \
+              mask_offset, length, positions, out, out_validity);             \
+  }
+#define REDUCE_KERNEL(OP, T, A)                                               \
+  extern "C" __global__ void OP##_##T(const T* values, const uint8_t* validity, \
+                                      int64_t offset, int64_t length,         \
+                                      A* partials, int64_t* counts) {         \
+    Reduce<OP, T, A>(values, validity, offset, length, partials, counts);     \
+  }
+#define MIN_MAX_KERNEL(OP, T) REDUCE_KERNEL(OP, T, T)
+
+#define FOR_EACH_NUMERIC_TYPE(M, ARG)                                         \
+  M(ARG, int8_t) M(ARG, int16_t) M(ARG, int32_t) M(ARG, int64_t)              \
+  M(ARG, uint8_t) M(ARG, uint16_t) M(ARG, uint32_t) M(ARG, uint64_t)          \
+  M(ARG, float) M(ARG, double)
+
+FOR_EACH_NUMERIC_TYPE(ARITHMETIC_KERNEL, Add)
+FOR_EACH_NUMERIC_TYPE(ARITHMETIC_KERNEL, Subtract)
+FOR_EACH_NUMERIC_TYPE(ARITHMETIC_KERNEL, Multiply)
+FOR_EACH_NUMERIC_TYPE(COMPARE_KERNEL, Equal)
+FOR_EACH_NUMERIC_TYPE(COMPARE_KERNEL, NotEqual)
+FOR_EACH_NUMERIC_TYPE(COMPARE_KERNEL, Less)
+FOR_EACH_NUMERIC_TYPE(COMPARE_KERNEL, LessEqual)
+FOR_EACH_NUMERIC_TYPE(COMPARE_KERNEL, Greater)
+FOR_EACH_NUMERIC_TYPE(COMPARE_KERNEL, GreaterEqual)
+FOR_EACH_NUMERIC_TYPE(TAKE_KERNEL, int32_t)
+FOR_EACH_NUMERIC_TYPE(TAKE_KERNEL, int64_t)
+FOR_EACH_NUMERIC_TYPE(FILTER_KERNEL, _)
+FOR_EACH_NUMERIC_TYPE(MIN_MAX_KERNEL, Min)
+FOR_EACH_NUMERIC_TYPE(MIN_MAX_KERNEL, Max)
+
+REDUCE_KERNEL(Sum, int8_t, int64_t)
+REDUCE_KERNEL(Sum, int16_t, int64_t)
+REDUCE_KERNEL(Sum, int32_t, int64_t)
+REDUCE_KERNEL(Sum, int64_t, int64_t)
+REDUCE_KERNEL(Sum, uint8_t, uint64_t)
+REDUCE_KERNEL(Sum, uint16_t, uint64_t)
+REDUCE_KERNEL(Sum, uint32_t, uint64_t)
+REDUCE_KERNEL(Sum, uint64_t, uint64_t)
+REDUCE_KERNEL(Sum, float, double)
+REDUCE_KERNEL(Sum, double, double)
+)";
+
+// Must match BLOCK_SIZE in the kernel source
+constexpr int kBlockSize = 256;
+// Number of blocks of the reduction kernels
+constexpr int64_t kMaxReduceBlocks = 1024;
+
+#define NVRTC_RETURN_NOT_OK(FUNC_NAME, STMT)                                    \
+  do {                                                                          \
+    nvrtcResult __res = (STMT);                                                 \
+    if (__res != NVRTC_SUCCESS) {                                               \
+      return Status::IOError("NVRTC error ", static_cast<int>(__res),           \
+                             " in function '", FUNC_NAME,                       \
+                             "': ", nvrtcGetErrorString(__res));                \
+    }                                                                           \
+  } while (0)
+
+Result<std::string> CompileKernels() {
+  nvrtcProgram program;
+  NVRTC_RETURN_NOT_OK("nvrtcCreateProgram",
+                      nvrtcCreateProgram(&program, kKernelSource, "arrow_compute.cu",
+                                         0, nullptr, nullptr));
+  std::unique_ptr<nvrtcProgram, void (*)(nvrtcProgram*)> program_guard(
+      &program, [](nvrtcProgram* p) { nvrtcDestroyProgram(p); });
+
+  const char* options[] = {"--std=c++14"};
+  nvrtcResult res = nvrtcCompileProgram(program, 1, options);
+  if (res != NVRTC_SUCCESS) {
+    size_t log_size = 0;
+    std::string log;
+    if (nvrtcGetProgramLogSize(program, &log_size) == NVRTC_SUCCESS) {
+      log.resize(log_size);
+      nvrtcGetProgramLog(program, log.data());
+    }
+    return Status::IOError("Failed to compile the CUDA compute kernels: ",
+                           nvrtcGetErrorString(res), "\n", log);
+  }
+
+  size_t ptx_size = 0;
+  NVRTC_RETURN_NOT_OK("nvrtcGetPTXSize", nvrtcGetPTXSize(program, &ptx_size));
+  std::string ptx(ptx_size, '\0');
+  NVRTC_RETURN_NOT_OK("nvrtcGetPTX", nvrtcGetPTX(program, ptx.data()));
+  return ptx;
+}
+
+// The kernels, compiled once and loaded in each context they are used in.
+// The modules stay loaded until the contexts are destroyed.
+class KernelCache {
+ public:
+  static KernelCache* Instance() {
+    static KernelCache instance;
+    return &instance;
+  }
+
+  Result<CUfunction> GetKernel(const CudaContext& context, const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto cu_context = reinterpret_cast<CUcontext>(context.handle());
+    auto key = std::make_pair(cu_context, name);
+    auto it = kernels_.find(key);
+    if (it != kernels_.end()) {
+      return it->second;
+    }
+
+    if (!ptx_.has_value()) {
+      ptx_ = CompileKernels();
+    }
+    RETURN_NOT_OK(ptx_->status());
+    const std::string& ptx = ptx_->ValueUnsafe();
+
+    ContextSaver set_temporary(cu_context);
+    auto module_it = modules_.find(cu_context);
+    if (module_it == modules_.end()) {
+      CUmodule module;
+      CU_RETURN_NOT_OK("cuModuleLoadData", cuModuleLoadData(&module, ptx.data()));
+      module_it = modules_.emplace(cu_context, module).first;
+    }
+    CUfunction kernel;
+    CU_RETURN_NOT_OK("cuModuleGetFunction",
+                     cuModuleGetFunction(&kernel, module_it->second, name.c_str()));
+    kernels_.emplace(std::move(key), kernel);
+    return kernel;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::optional<Result<std::string>> ptx_;
+  std::unordered_map<CUcontext, CUmodule> modules_;
+  std::map<std::pair<CUcontext, std::string>, CUfunction> kernels_;
+};
+
+// The parameters of a kernel launch, stored in words since the driver reads
+// each one from its own address
+class KernelArgs {
+ public:
+  template <typename T>
+  KernelArgs& Add(T value) {
+    static_assert(sizeof(T) <= sizeof(uint64_t), "kernel parameter too large");
+    return AddBytes(std::string_view(reinterpret_cast<const char*>(&value), sizeof(T)));
+  }
+
+  KernelArgs& AddBytes(std::string_view bytes) {
+    DCHECK_LE(bytes.size(), sizeof(uint64_t));
+    storage_.push_back(0);
+    std::memcpy(&storage_.back(), bytes.data(), bytes.size());
+    pointers_.push_back(&storage_.back());
+    return *this;
+  }
+
+  void** data() { return pointers_.data(); }
+
+ private:
+  // A deque doesn't move its elements as it grows
+  std::deque<uint64_t> storage_;
+  std::vector<void*> pointers_;
+};
+
+// Launch a kernel with one thread per unit of work, and wait for it
+Status Launch(const CudaContext& context, const std::string& name, int64_t num_threads,
+              KernelArgs* args) {
+  if (num_threads == 0) {
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(CUfunction kernel,
+                        KernelCache::Instance()->GetKernel(context, name));
+  const auto num_blocks =
+      static_cast<unsigned int>(bit_util::CeilDiv(num_threads, kBlockSize));
+  ContextSaver set_temporary(context);
+  CU_RETURN_NOT_OK("cuLaunchKernel",
+                   cuLaunchKernel(kernel, num_blocks, 1, 1, kBlockSize, 1, 1,
+                                  /*sharedMemBytes=*/0, /*hStream=*/nullptr,
+                                  args->data(), /*extra=*/nullptr));
+  CU_RETURN_NOT_OK("cuCtxSynchronize", cuCtxSynchronize());
+  return Status::OK();
+}
+
+CUdeviceptr DevicePointer(const std::shared_ptr<Buffer>& buffer) {
+  return buffer ? static_cast<CUdeviceptr>(buffer->address()) : 0;
+}
+
+CUdeviceptr ValuesPointer(const ArrayData& data) {
+  return DevicePointer(data.buffers[1]);
+}
+
+CUdeviceptr ValidityPointer(const ArrayData& data) {
+  return data.MayHaveNulls() ? DevicePointer(data.buffers[0]) : 0;
+}
+
+Result<std::string> CTypeName(const DataType& type) {
+  switch (type.id()) {
+    case Type::INT8:
+      return "int8_t";
+    case Type::INT16:
+      return "int16_t";
+    case Type::INT32:
+      return "int32_t";
+    case Type::INT64:
+      return "int64_t";
+    case Type::UINT8:
+      return "uint8_t";
+    case Type::UINT16:
+      return "uint16_t";
+    case Type::UINT32:
+      return "uint32_t";
+    case Type::UINT64:
+      return "uint64_t";
+    case Type::FLOAT:
+      return "float";
+    case Type::DOUBLE:
+      return "double";
+    default:
+      return Status::NotImplemented("CUDA compute functions don't support type ",
+                                    type.ToString());
+  }
+}
+
+Result<std::shared_ptr<CudaContext>> GetContext(const ArrayData& data) {
+  ARROW_ASSIGN_OR_RAISE(auto buffer, CudaBuffer::FromBuffer(data.buffers[1]));
+  return buffer->context();
+}
+
+Result<std::shared_ptr<Buffer>> Allocate(CudaContext* context, int64_t nbytes) {
+  // Padded to whole words, for CountSetBits and the atomic bit updates of Filter
+  ARROW_ASSIGN_OR_RAISE(auto buffer,
+                        context->Allocate(bit_util::RoundUpToMultipleOf64(
+                            std::max<int64_t>(nbytes, 1))));
+  return std::shared_ptr<Buffer>(std::move(buffer));
+}
+
+Result<std::shared_ptr<Buffer>> AllocateZeroedBitmap(CudaContext* context,
+                                                     int64_t length) {
+  ARROW_ASSIGN_OR_RAISE(auto bitmap, Allocate(context, bit_util::BytesForBits(length)));
+  ContextSaver set_temporary(*context);
+  CU_RETURN_NOT_OK("cuMemsetD8", cuMemsetD8(DevicePointer(bitmap), 0,
+                                            static_cast<size_t>(bitmap->size())));
+  return bitmap;
+}
+
+template <typename T>
+Result<std::vector<T>> CopyToHost(const std::shared_ptr<Buffer>& buffer, int64_t length) {
+  ARROW_ASSIGN_OR_RAISE(auto cuda_buffer, CudaBuffer::FromBuffer(buffer));
+  std::vector<T> values(length);
+  RETURN_NOT_OK(cuda_buffer->CopyToHost(0, length * sizeof(T), values.data()));
+  return values;
+}
+
+// Make an output array, counting the nulls of its validity bitmap, which is
+// padded with zeros
+Result<Datum> MakeOutput(CudaContext* context, std::shared_ptr<DataType> type,
+                         int64_t length, std::shared_ptr<Buffer> validity,
+                         std::shared_ptr<Buffer> values) {
+  ARROW_ASSIGN_OR_RAISE(auto count, Allocate(context, sizeof(uint64_t)));
+  {
+    ContextSaver set_temporary(*context);
+    CU_RETURN_NOT_OK("cuMemsetD8", cuMemsetD8(DevicePointer(count), 0, sizeof(uint64_t)));
+  }
+  const int64_t num_words = validity->size() / static_cast<int64_t>(sizeof(uint64_t));
+  KernelArgs args;
+  args.Add(DevicePointer(validity)).Add(num_words).Add(DevicePointer(count));
+  RETURN_NOT_OK(Launch(*context, "CountSetBits", num_words, &args));
+  ARROW_ASSIGN_OR_RAISE(auto valid_count, CopyToHost<uint64_t>(count, 1));
+
+  const int64_t null_count = length - static_cast<int64_t>(valid_count[0]);
+  return ArrayData::Make(std::move(type), length,
+                         {std::move(validity), std::move(values)}, null_count);
+}
+
+// An argument of an elementwise function: a device array or a host scalar
+struct BinaryArg {
+  const ArrayData* array = nullptr;
+  const Scalar* scalar = nullptr;
+
+  const DataType& type() const { return array ? *array->type : *scalar->type; }
+
+  void AddTo(KernelArgs* args) const {
+    if (array) {
+      args->Add(ValuesPointer(*array))
+          .Add(ValidityPointer(*array))
+          .Add(array->offset)
+          .Add(uint64_t(0));
+    } else {
+      args->Add(CUdeviceptr(0)).Add(CUdeviceptr(0)).Add(int64_t(0));
+      args->AddBytes(
+          checked_cast<const ::arrow::internal::PrimitiveScalarBase&>(*scalar).view());
+    }
+  }
+};
+
+Result<BinaryArg> GetBinaryArg(const Datum& datum) {
+  BinaryArg arg;
+  if (datum.is_array()) {
+    arg.array = datum.array().get();
+  } else if (datum.is_scalar()) {
+    arg.scalar = datum.scalar().get();
+  } else {
+    return Status::NotImplemented("CUDA compute functions don't support ",
+                                  datum.ToString());
+  }
+  return arg;
+}
+
+Result<const ArrayData*> GetArray(const Datum& datum) {
+  if (!datum.is_array()) {
+    return Status::NotImplemented("CUDA compute functions don't support ",
+                                  datum.ToString());
+  }
+  return datum.array().get();
+}
+
+// "add", "equal" and the like: kernel_name is the operation, e.g. "Add"
+Result<Datum> ExecuteBinary(const std::string& kernel_name, bool is_comparison,
+                            const std::vector<Datum>& args) {
+  ARROW_ASSIGN_OR_RAISE(auto left, GetBinaryArg(args[0]));
+  ARROW_ASSIGN_OR_RAISE(auto right, GetBinaryArg(args[1]));
+  if (!left.type().Equals(right.type())) {
+    return Status::NotImplemented("CUDA compute functions need arguments of the ",
+                                  "same type, got ", left.type().ToString(), " and ",
+                                  right.type().ToString());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto c_type, CTypeName(left.type()));
+  const ArrayData& array = left.array ? *left.array : *right.array;
+  if (left.array && right.array && left.array->length != right.array->length) {
+    return Status::Invalid("Array arguments must all be the same length");
+  }
+  const int64_t length = array.length;
+  auto out_type = is_comparison ? boolean() : array.type;
+
+  ARROW_ASSIGN_OR_RAISE(auto context, GetContext(array));
+  ARROW_ASSIGN_OR_RAISE(auto validity, AllocateZeroedBitmap(context.get(), length));
+  ARROW_ASSIGN_OR_RAISE(
+      auto values,
+      Allocate(context.get(),
+               is_comparison ? bit_util::BytesForBits(length)
+                             : length * left.type().byte_width()));
+  if ((left.scalar && !left.scalar->is_valid) ||
+      (right.scalar && !right.scalar->is_valid)) {
+    // All null
+    return ArrayData::Make(std::move(out_type), length,
+                           {std::move(validity), std::move(values)}, length);
+  }
+
+  KernelArgs kernel_args;
+  left.AddTo(&kernel_args);
+  right.AddTo(&kernel_args);
+  kernel_args.Add(length).Add(DevicePointer(values)).Add(DevicePointer(validity));
+  RETURN_NOT_OK(Launch(*context, kernel_name + "_" + c_type,
+                       bit_util::CeilDiv(length, 8), &kernel_args));
+  return MakeOutput(context.get(), std::move(out_type), length, std::move(validity),
+                    std::move(values));
+}
+
+Result<Datum> ExecuteTake(const std::vector<Datum>& args) {
+  ARROW_ASSIGN_OR_RAISE(auto values, GetArray(args[0]));
+  ARROW_ASSIGN_OR_RAISE(auto indices, GetArray(args[1]));
+  ARROW_ASSIGN_OR_RAISE(auto c_type, CTypeName(*values->type));
+  if (indices->type->id() != Type::INT32 && indices->type->id() != Type::INT64) {
+    return Status::NotImplemented("CUDA take doesn't support indices of type ",
+                                  indices->type->ToString());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto index_c_type, CTypeName(*indices->type));
+  const int64_t length = indices->length;
+
+  ARROW_ASSIGN_OR_RAISE(auto context, GetContext(*values));
+  ARROW_ASSIGN_OR_RAISE(auto validity, AllocateZeroedBitmap(context.get(), length));
+  ARROW_ASSIGN_OR_RAISE(auto out_values,
+                        Allocate(context.get(), length * values->type->byte_width()));
+  ARROW_ASSIGN_OR_RAISE(auto out_of_bounds, AllocateZeroedBitmap(context.get(), 32));
+
+  KernelArgs kernel_args;
+  kernel_args.Add(ValuesPointer(*values))
+      .Add(ValidityPointer(*values))
+      .Add(values->offset)
+      .Add(values->length)
+      .Add(ValuesPointer(*indices))
+      .Add(ValidityPointer(*indices))
+      .Add(indices->offset)
+      .Add(length)
+      .Add(DevicePointer(out_values))
+      .Add(DevicePointer(validity))
+      .Add(DevicePointer(out_of_bounds));
+  RETURN_NOT_OK(Launch(*context, "Take_" + c_type + "_" + index_c_type,
+                       bit_util::CeilDiv(length, 8), &kernel_args));
+  ARROW_ASSIGN_OR_RAISE(auto out_of_bounds_flag, CopyToHost<int32_t>(out_of_bounds, 1));
+  if (out_of_bounds_flag[0] != 0) {
+    return Status::IndexError("Index out of bounds");
+  }
+  return MakeOutput(context.get(), values->type, length, std::move(validity),
+                    std::move(out_values));
+}
+
+Result<Datum> ExecuteFilter(const std::vector<Datum>& args,
+                            const compute::FilterOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto values, GetArray(args[0]));
+  ARROW_ASSIGN_OR_RAISE(auto mask, GetArray(args[1]));
+  ARROW_ASSIGN_OR_RAISE(auto c_type, CTypeName(*values->type));
+  if (mask->type->id() != Type::BOOL) {
+    return Status::NotImplemented("CUDA filter doesn't support masks of type ",
+                                  mask->type->ToString());
+  }
+  if (options.null_selection_behavior != compute::FilterOptions::DROP) {
+    return Status::NotImplemented("CUDA filter only drops null selections");
+  }
+  if (mask->length != values->length) {
+    return Status::Invalid("Filter inputs must all be the same length");
+  }
+  const int64_t length = values->length;
+  const int64_t num_runs = bit_util::CeilDiv(length, 64);
+  ARROW_ASSIGN_OR_RAISE(auto context, GetContext(*values));
+
+  // Count the selected rows of each run of 64 rows, and turn the counts into
+  // the output positions of the runs
+  ARROW_ASSIGN_OR_RAISE(auto positions,
+                        Allocate(context.get(), num_runs * sizeof(int64_t)));
+  KernelArgs count_args;
+  count_args.Add(ValuesPointer(*mask))
+      .Add(ValidityPointer(*mask))
+      .Add(mask->offset)
+      .Add(length)
+      .Add(DevicePointer(positions));
+  RETURN_NOT_OK(Launch(*context, "FilterCount", num_runs, &count_args));
+  ARROW_ASSIGN_OR_RAISE(auto run_positions, CopyToHost<int64_t>(positions, num_runs));
+  int64_t out_length = 0;
+  for (auto& position : run_positions) {
+    const int64_t count = position;
+    position = out_length;
+    out_length += count;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto cuda_positions, CudaBuffer::FromBuffer(positions));
+  RETURN_NOT_OK(cuda_positions->CopyFromHost(0, run_positions.data(),
+                                             num_runs * sizeof(int64_t)));
+
+  ARROW_ASSIGN_OR_RAISE(auto validity, AllocateZeroedBitmap(context.get(), out_length));
+  ARROW_ASSIGN_OR_RAISE(auto out_values,
+                        Allocate(context.get(), out_length * values->type->byte_width()));
+  KernelArgs filter_args;
+  filter_args.Add(ValuesPointer(*values))
+      .Add(ValidityPointer(*values))
+      .Add(values->offset)
+      .Add(ValuesPointer(*mask))
+      .Add(ValidityPointer(*mask))
+      .Add(mask->offset)
+      .Add(length)
+      .Add(DevicePointer(positions))
+      .Add(DevicePointer(out_values))
+      .Add(DevicePointer(validity));
+  RETURN_NOT_OK(Launch(*context, "Filter_" + c_type, num_runs, &filter_args));
+  return MakeOutput(context.get(), values->type, out_length, std::move(validity),
+                    std::move(out_values));
+}
+
+// "sum", "min" and "max": kernel_name is "Sum", "Min" or "Max"
+Result<Datum> ExecuteReduce(const std::string& kernel_name,
+                            const std::vector<Datum>& args,
+                            const compute::ScalarAggregateOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto values, GetArray(args[0]));
+  ARROW_ASSIGN_OR_RAISE(auto c_type, CTypeName(*values->type));
+  const bool is_sum = kernel_name == "Sum";
+  std::shared_ptr<DataType> out_type = values->type;
+  if (is_sum) {
+    out_type = is_floating(values->type->id())        ? float64()
+               : is_signed_integer(values->type->id()) ? int64()
+                                                       : uint64();
+  }
+  const int64_t length = values->length;
+  ARROW_ASSIGN_OR_RAISE(auto context, GetContext(*values));
+
+  const int64_t num_blocks =
+      std::min(std::max<int64_t>(bit_util::CeilDiv(length, kBlockSize), 1),
+               kMaxReduceBlocks);
+  ARROW_ASSIGN_OR_RAISE(auto partials, Allocate(context.get(), num_blocks * 8));
+  ARROW_ASSIGN_OR_RAISE(auto counts,
+                        Allocate(context.get(), num_blocks * sizeof(int64_t)));
+  KernelArgs kernel_args;
+  kernel_args.Add(ValuesPointer(*values))
+      .Add(ValidityPointer(*values))
+      .Add(values->offset)
+      .Add(length)
+      .Add(DevicePointer(partials))
+      .Add(DevicePointer(counts));
+  RETURN_NOT_OK(Launch(*context, kernel_name + "_" + c_type, num_blocks * kBlockSize,
+                       &kernel_args));
+
+  ARROW_ASSIGN_OR_RAISE(auto block_counts, CopyToHost<int64_t>(counts, num_blocks));
+  const int out_width = out_type->byte_width();
+  ARROW_ASSIGN_OR_RAISE(auto block_partials,
+                        CopyToHost<uint8_t>(partials, num_blocks * out_width));
+
+  int64_t count = 0;
+  for (auto block_count : block_counts) {
+    count += block_count;
+  }
+  if (count < options.min_count || (!options.skip_nulls && count < length)) {
+    return MakeNullScalar(std::move(out_type));
+  }
+  // Combine the partial results of the blocks on the host
+  auto combine = [&](auto zero) -> Datum {
+    using CType = decltype(zero);
+    std::optional<CType> result;
+    for (int64_t i = 0; i < num_blocks; ++i) {
+      if (block_counts[i] == 0) continue;
+      CType partial;
+      std::memcpy(&partial, block_partials.data() + i * out_width, sizeof(CType));
+      if (!result.has_value()) {
+        result = partial;
+      } else if (is_sum) {
+        result = static_cast<CType>(*result + partial);
+      } else if (kernel_name == "Min") {
+        result = (partial < *result || *result != *result) ? partial : *result;
+      } else {
+        result = (*result < partial || *result != *result) ? partial : *result;
+      }
+    }
+    auto scalar = MakeScalar(out_type, result.value_or(CType{}));
+    DCHECK_OK(scalar.status());
+    return Datum(scalar.MoveValueUnsafe());
+  };
+  switch (out_type->id()) {
+    case Type::INT8:
+      return combine(int8_t{});
+    case Type::INT16:
+      return combine(int16_t{});
+    case Type::INT32:
+      return combine(int32_t{});
+    case Type::INT64:
+      return combine(int64_t{});
+    case Type::UINT8:
+      return combine(uint8_t{});
+    case Type::UINT16:
+      return combine(uint16_t{});
+    case Type::UINT32:
+      return combine(uint32_t{});
+    case Type::UINT64:
+      return combine(uint64_t{});
+    case Type::FLOAT:
+      return combine(float{});
+    default:
+      return combine(double{});
+  }
+}
+
+using DeviceExec = std::function<Result<Datum>(const std::vector<Datum>&,
+                                               const compute::FunctionOptions*)>;
+
+class CudaFunction : public compute::MetaFunction {
+ public:
+  CudaFunction(std::string name, const compute::Arity& arity, compute::FunctionDoc doc,
+               DeviceExec exec, const compute::FunctionOptions* default_options = NULLPTR)
+      : MetaFunction(std::move(name), arity, std::move(doc), default_options),
+        exec_(std::move(exec)) {}
+
+ protected:
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const compute::FunctionOptions* options,
+                            compute::ExecContext* ctx) const override {
+    return exec_(args, options);
+  }
+
+ private:
+  DeviceExec exec_;
+};
+
+const compute::FilterOptions* GetDefaultFilterOptions() {
+  static const auto kDefaultFilterOptions = compute::FilterOptions::Defaults();
+  return &kDefaultFilterOptions;
+}
+
+const compute::TakeOptions* GetDefaultTakeOptions() {
+  static const auto kDefaultTakeOptions = compute::TakeOptions::Defaults();
+  return &kDefaultTakeOptions;
+}
+
+const compute::ScalarAggregateOptions* GetDefaultScalarAggregateOptions() {
+  static const auto kDefaultOptions = compute::ScalarAggregateOptions::Defaults();
+  return &kDefaultOptions;
+}
+
+}  // namespace
+
+Status RegisterComputeFunctions(compute::FunctionRegistry* registry) {
+  if (registry == nullptr) {
+    registry = compute::GetFunctionRegistry();
+  }
+  auto add = [&](std::string name, const compute::Arity& arity, std::string summary,
+                 std::vector<std::string> arg_names, DeviceExec exec,
+                 const compute::FunctionOptions* default_options = nullptr,
+                 std::string options_class = "") {
+    compute::FunctionDoc doc(std::move(summary), "", std::move(arg_names),
+                             std::move(options_class));
+    return registry->AddDeviceFunction(
+        DeviceAllocationType::kCUDA,
+        std::make_shared<CudaFunction>(std::move(name), arity, std::move(doc),
+                                       std::move(exec), default_options),
+        /*allow_overwrite=*/true);
+  };
+
+  const std::vector<std::pair<std::string, std::string>> arithmetic = {
+      {"add", "Add"}, {"subtract", "Subtract"}, {"multiply", "Multiply"}};
+  for (const auto& [name, kernel_name] : arithmetic) {
+    RETURN_NOT_OK(add(name, compute::Arity::Binary(), "Arithmetic on CUDA devices",
+                      {"x", "y"},
+                      [kernel_name = kernel_name](const std::vector<Datum>& args,
+                                                  const compute::FunctionOptions*) {
+                        return ExecuteBinary(kernel_name, /*is_comparison=*/false, args);
+                      }));
+  }
+
+  const std::vector<std::pair<std::string, std::string>> comparisons = {
+      {"equal", "Equal"}, {"not_equal", "NotEqual"},   {"less", "Less"},
+      {"less_equal", "LessEqual"}, {"greater", "Greater"},
+      {"greater_equal", "GreaterEqual"}};
+  for (const auto& [name, kernel_name] : comparisons) {
+    RETURN_NOT_OK(add(name, compute::Arity::Binary(), "Comparison on CUDA devices",
+                      {"x", "y"},
+                      [kernel_name = kernel_name](const std::vector<Datum>& args,
+                                                  const compute::FunctionOptions*) {
+                        return ExecuteBinary(kernel_name, /*is_comparison=*/true, args);
+                      }));
+  }
+
+  RETURN_NOT_OK(add(
+      "filter", compute::Arity::Binary(), "Filter on CUDA devices",
+      {"input", "selection_filter"},
+      [](const std::vector<Datum>& args, const compute::FunctionOptions* options) {
+        return ExecuteFilter(args,
+                             checked_cast<const compute::FilterOptions&>(*options));
+      },
+      GetDefaultFilterOptions(), "FilterOptions"));
+  RETURN_NOT_OK(add(
+      "take", compute::Arity::Binary(), "Take on CUDA devices", {"input", "indices"},
+      [](const std::vector<Datum>& args, const compute::FunctionOptions*) {
+        return ExecuteTake(args);
+      },
+      GetDefaultTakeOptions(), "TakeOptions"));
+
+  const std::vector<std::pair<std::string, std::string>> aggregates = {
+      {"sum", "Sum"}, {"min", "Min"}, {"max", "Max"}};
+  for (const auto& [name, kernel_name] : aggregates) {
+    RETURN_NOT_OK(add(
+        name, compute::Arity::Unary(), "Aggregate on CUDA devices", {"array"},
+        [kernel_name = kernel_name](const std::vector<Datum>& args,
+                                    const compute::FunctionOptions* options) {
+          return ExecuteReduce(
+              kernel_name, args,
+              checked_cast<const compute::ScalarAggregateOptions&>(*options));
+        },
+        GetDefaultScalarAggregateOptions(), "ScalarAggregateOptions"));
+  }
+  return Status::OK();
+}
+
+}  // namespace cuda
+}  // namespace arrow
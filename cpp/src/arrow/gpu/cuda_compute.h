@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/compute/type_fwd.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace cuda {
+
+/// \brief Register compute functions for arrays resident on CUDA devices
+///
+/// The functions are registered with FunctionRegistry::AddDeviceFunction, so
+/// that compute::CallFunction() executes them on the device, without copying
+/// the data to the host, when an argument is an array with CUDA buffers:
+///
+/// - "add", "subtract" and "multiply" of two numeric arguments of the same type,
+///   where one may be a scalar
+/// - "equal", "not_equal", "less", "less_equal", "greater" and "greater_equal",
+///   with the same kind of arguments
+/// - "filter" of a numeric array with a boolean mask, dropping null selections
+/// - "take" of a numeric array with int32 or int64 indices
+/// - "sum", "min" and "max" of a numeric array, which return a CPU scalar
+///
+/// The arguments must be arrays, not chunked arrays, and the resulting arrays
+/// are allocated on the device of the first array argument.  Other functions,
+/// types and options fail with Status::NotImplemented.
+///
+/// The kernels are compiled with NVRTC the first time one is used.
+///
+/// \param[in] registry the registry to add the functions to, the global
+/// registry if null
+ARROW_EXPORT
+Status RegisterComputeFunctions(compute::FunctionRegistry* registry = NULLPTR);
+
+}  // namespace cuda
+}  // namespace arrow
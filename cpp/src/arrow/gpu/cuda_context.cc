@@ -132,6 +132,22 @@ class CudaContext::Impl {
     return Status::OK();
   }
 
+  Status CopyHostToDeviceAsync(uintptr_t dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK("cuMemcpyHtoDAsync",
+                     cuMemcpyHtoDAsync(dst, src, static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
+  Status CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK("cuMemcpyDtoHAsync",
+                     cuMemcpyDtoHAsync(dst, src, static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
   Status CopyDeviceToDevice(uintptr_t dst, uintptr_t src, int64_t nbytes) {
     ContextSaver set_temporary(context_);
     CU_RETURN_NOT_OK("cuMemcpyDtoD", cuMemcpyDtoD(dst, src, static_cast<size_t>(nbytes)));
@@ -676,6 +692,16 @@ Status CudaContext::CopyDeviceToHost(void* dst, const void* src, int64_t nbytes)
   return impl_->CopyDeviceToHost(dst, reinterpret_cast<uintptr_t>(src), nbytes);
 }
 
+Status CudaContext::CopyHostToDeviceAsync(uintptr_t dst, const void* src, int64_t nbytes,
+                                          CUstream stream) {
+  return impl_->CopyHostToDeviceAsync(dst, src, nbytes, stream);
+}
+
+Status CudaContext::CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes,
+                                          CUstream stream) {
+  return impl_->CopyDeviceToHostAsync(dst, src, nbytes, stream);
+}
+
 Status CudaContext::CopyDeviceToDevice(uintptr_t dst, uintptr_t src, int64_t nbytes) {
   return impl_->CopyDeviceToDevice(dst, src, nbytes);
 }
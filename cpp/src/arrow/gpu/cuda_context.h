@@ -393,6 +393,10 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   Status CopyHostToDevice(uintptr_t dst, const void* src, int64_t nbytes);
   Status CopyDeviceToHost(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToHost(void* dst, uintptr_t src, int64_t nbytes);
+  Status CopyHostToDeviceAsync(uintptr_t dst, const void* src, int64_t nbytes,
+                               CUstream stream);
+  Status CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes,
+                               CUstream stream);
   Status CopyDeviceToDevice(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToDevice(uintptr_t dst, uintptr_t src, int64_t nbytes);
   Status CopyDeviceToAnotherDevice(const std::shared_ptr<CudaContext>& dst_ctx, void* dst,
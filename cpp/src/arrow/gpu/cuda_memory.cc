@@ -22,7 +22,9 @@
 #include <cstdlib>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <cuda.h>
 
@@ -31,12 +33,17 @@
 #include "arrow/io/memory.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
 #include "arrow/gpu/cuda_context.h"
 #include "arrow/gpu/cuda_internal.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace cuda {
 
 using internal::ContextSaver;
@@ -171,6 +178,23 @@ Status CudaBuffer::CopyFromHost(const int64_t position, const void* data,
   return context_->CopyHostToDevice(const_cast<uint8_t*>(data_) + position, data, nbytes);
 }
 
+Status CudaBuffer::CopyToHostAsync(const int64_t position, const int64_t nbytes,
+                                   void* out, const Device::Stream& stream) const {
+  const auto& cuda_stream = checked_cast<const CudaDevice::Stream&>(stream);
+  return context_->CopyDeviceToHostAsync(out, address() + position, nbytes,
+                                         cuda_stream.value());
+}
+
+Status CudaBuffer::CopyFromHostAsync(const int64_t position, const void* data,
+                                     int64_t nbytes, const Device::Stream& stream) {
+  if (nbytes > size_ - position) {
+    return Status::Invalid("Copy would overflow buffer");
+  }
+  const auto& cuda_stream = checked_cast<const CudaDevice::Stream&>(stream);
+  return context_->CopyHostToDeviceAsync(address() + position, data, nbytes,
+                                         cuda_stream.value());
+}
+
 Status CudaBuffer::CopyFromDevice(const int64_t position, const void* data,
                                   int64_t nbytes) {
   if (nbytes > size_ - position) {
@@ -215,6 +239,86 @@ Result<uintptr_t> CudaHostBuffer::GetDeviceAddress(
   return ::arrow::cuda::GetDeviceAddress(data(), ctx);
 }
 
+// ----------------------------------------------------------------------
+// CudaHostBufferPool
+
+namespace {
+
+constexpr int64_t kMinPooledHostBufferSize = 4096;
+
+}  // namespace
+
+struct CudaHostBufferPool::Impl : public std::enable_shared_from_this<Impl> {
+  Impl(int device_number, int64_t max_cached_bytes)
+      : device_number(device_number), max_cached_bytes(max_cached_bytes) {}
+
+  Result<std::shared_ptr<CudaHostBuffer>> Acquire(int64_t capacity) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = free_buffers.find(capacity);
+      if (it != free_buffers.end() && !it->second.empty()) {
+        auto buffer = std::move(it->second.back());
+        it->second.pop_back();
+        bytes_cached -= capacity;
+        return buffer;
+      }
+    }
+    return AllocateCudaHostBuffer(device_number, capacity);
+  }
+
+  void Release(std::shared_ptr<CudaHostBuffer> buffer) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (bytes_cached + buffer->size() <= max_cached_bytes) {
+      bytes_cached += buffer->size();
+      free_buffers[buffer->size()].push_back(std::move(buffer));
+    }
+  }
+
+  const int device_number;
+  const int64_t max_cached_bytes;
+  std::mutex mutex;
+  int64_t bytes_cached = 0;
+  // Unused buffers by size
+  std::unordered_map<int64_t, std::vector<std::shared_ptr<CudaHostBuffer>>> free_buffers;
+};
+
+CudaHostBufferPool::CudaHostBufferPool(int device_number, int64_t max_cached_bytes)
+    : impl_(std::make_shared<Impl>(device_number, max_cached_bytes)) {}
+
+CudaHostBufferPool::~CudaHostBufferPool() {}
+
+Result<std::shared_ptr<CudaHostBufferPool>> CudaHostBufferPool::Make(
+    int device_number, int64_t max_cached_bytes) {
+  ARROW_ASSIGN_OR_RAISE(auto manager, CudaDeviceManager::Instance());
+  if (device_number < 0 || device_number >= manager->num_devices()) {
+    return Status::Invalid("Invalid CUDA device number: ", device_number);
+  }
+  return std::shared_ptr<CudaHostBufferPool>(
+      new CudaHostBufferPool(device_number, max_cached_bytes));
+}
+
+Result<std::shared_ptr<Buffer>> CudaHostBufferPool::Allocate(int64_t size) {
+  const int64_t capacity =
+      bit_util::NextPower2(std::max(size, kMinPooledHostBufferSize));
+  ARROW_ASSIGN_OR_RAISE(auto pinned, impl_->Acquire(capacity));
+  // The buffer handed out holds a lease that puts the pinned buffer back in
+  // the pool when the last slice of it is destroyed, if the pool still exists
+  std::weak_ptr<Impl> weak_impl = impl_;
+  auto raw = pinned.get();
+  std::shared_ptr<CudaHostBuffer> lease(
+      raw, [weak_impl, pinned = std::move(pinned)](CudaHostBuffer*) mutable {
+        if (auto impl = weak_impl.lock()) {
+          impl->Release(std::move(pinned));
+        }
+      });
+  return SliceMutableBuffer(std::move(lease), 0, size);
+}
+
+int64_t CudaHostBufferPool::bytes_cached() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  return impl_->bytes_cached;
+}
+
 // ----------------------------------------------------------------------
 // CudaBufferReader
 
@@ -71,6 +71,29 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   /// \return Status
   Status CopyFromHost(const int64_t position, const void* data, int64_t nbytes);
 
+  /// \brief Enqueue a copy of memory from GPU device to CPU host on a stream
+  /// \param[in] position start position inside buffer to copy bytes from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[out] out start address of the host memory area to copy to
+  /// \param[in] stream the CudaDevice::Stream to enqueue the copy on
+  /// \return Status
+  ///
+  /// The copy is only complete once the stream is synchronized, or an event
+  /// recorded on it afterwards is waited on.  It only overlaps with the
+  /// caller's work if out is pinned memory, e.g. from a CudaHostBuffer.
+  Status CopyToHostAsync(const int64_t position, const int64_t nbytes, void* out,
+                         const Device::Stream& stream) const;
+
+  /// \brief Enqueue a copy of memory to device at position on a stream
+  /// \param[in] position start position to copy bytes to
+  /// \param[in] data the host data to copy, which must stay alive until the
+  /// copy is complete
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream the CudaDevice::Stream to enqueue the copy on
+  /// \return Status
+  Status CopyFromHostAsync(const int64_t position, const void* data, int64_t nbytes,
+                           const Device::Stream& stream);
+
   /// \brief Copy memory from device to device at position
   /// \param[in] position start position inside buffer to copy bytes to
   /// \param[in] data start address of the device memory area to copy from
@@ -119,6 +142,40 @@ class ARROW_EXPORT CudaHostBuffer : public MutableBuffer {
   Result<uintptr_t> GetDeviceAddress(const std::shared_ptr<CudaContext>& ctx);
 };
 
+/// \class CudaHostBufferPool
+/// \brief A cache of pinned host buffers
+///
+/// Pinning host memory is much more expensive than allocating it, so
+/// asynchronous transfers that need a new host buffer each time should take it
+/// from a pool.  Buffers go back to the pool once all the buffers allocated
+/// from them are destroyed.
+class ARROW_EXPORT CudaHostBufferPool {
+ public:
+  ~CudaHostBufferPool();
+
+  /// \brief Create a pool of host memory with fast access to given GPU device
+  /// \param[in] device_number the CUDA device number
+  /// \param[in] max_cached_bytes the maximum size of the unused buffers kept
+  /// in the pool, larger buffers are freed
+  static Result<std::shared_ptr<CudaHostBufferPool>> Make(
+      int device_number, int64_t max_cached_bytes = int64_t(256) << 20);
+
+  /// \brief Allocate a pinned host buffer of at least the given size
+  ///
+  /// Sizes are rounded up to a power of two, so that buffers can be reused
+  /// for allocations of similar sizes.
+  Result<std::shared_ptr<Buffer>> Allocate(int64_t size);
+
+  /// \brief The size of the unused buffers currently kept in the pool
+  int64_t bytes_cached() const;
+
+ private:
+  CudaHostBufferPool(int device_number, int64_t max_cached_bytes);
+
+  struct Impl;
+  std::shared_ptr<Impl> impl_;
+};
+
 /// \class CudaIpcHandle
 /// \brief A container for a CUDA IPC handle
 class ARROW_EXPORT CudaIpcMemHandle {
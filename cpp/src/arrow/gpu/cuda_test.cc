@@ -25,6 +25,9 @@
 
 #include "arrow/c/bridge.h"
 #include "arrow/c/util_internal.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
 #include "arrow/ipc/dictionary.h"
@@ -34,6 +37,7 @@
 #include "arrow/testing/util.h"
 
 #include "arrow/gpu/cuda_api.h"
+#include "arrow/gpu/cuda_compute.h"
 #include "arrow/gpu/cuda_internal.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/macros.h"
@@ -333,6 +337,23 @@ TEST_F(TestCudaBuffer, CopyFromHost) {
   AssertCudaBufferEquals(*device_buffer, *host_buffer);
 }
 
+TEST_F(TestCudaBuffer, CopyAsync) {
+  const int64_t kSize = 1000;
+  ASSERT_OK_AND_ASSIGN(auto device_buffer, context_->Allocate(kSize));
+  ASSERT_OK_AND_ASSIGN(auto stream, device_->MakeStream());
+  ASSERT_OK_AND_ASSIGN(auto src, device_->AllocateHostBuffer(kSize));
+  ASSERT_OK_AND_ASSIGN(auto dest, device_->AllocateHostBuffer(kSize));
+  random_bytes(kSize, 0, src->mutable_data());
+
+  ASSERT_OK(device_buffer->CopyFromHostAsync(0, src->data(), kSize, *stream));
+  ASSERT_OK(device_buffer->CopyToHostAsync(0, kSize, dest->mutable_data(), *stream));
+  ASSERT_OK(stream->Synchronize());
+  AssertBufferEqual(*dest, *src);
+
+  ASSERT_RAISES(Invalid,
+                device_buffer->CopyFromHostAsync(500, src->data(), kSize, *stream));
+}
+
 TEST_F(TestCudaBuffer, FromBuffer) {
   const int64_t kSize = 1000;
   // Initialize device buffer with random data
@@ -463,6 +484,39 @@ TEST_F(TestCudaHostBuffer, ViewOnDevice) {
   ASSERT_EQ(buffer->device_type(), DeviceAllocationType::kCUDA_HOST);
 }
 
+TEST_F(TestCudaHostBuffer, Pool) {
+  ASSERT_OK_AND_ASSIGN(auto pool, CudaHostBufferPool::Make(kGpuNumber));
+  ASSERT_OK_AND_ASSIGN(auto buffer, pool->Allocate(1000));
+  ASSERT_EQ(buffer->size(), 1000);
+  ASSERT_TRUE(buffer->is_mutable());
+  ASSERT_OK_AND_ASSIGN(auto device_address, GetDeviceAddress(buffer->data(), context_));
+  ASSERT_NE(device_address, 0);
+  const uint8_t* data = buffer->data();
+  ASSERT_EQ(pool->bytes_cached(), 0);
+
+  // The pinned memory is reused once the buffer is released
+  buffer.reset();
+  ASSERT_EQ(pool->bytes_cached(), 4096);
+  ASSERT_OK_AND_ASSIGN(buffer, pool->Allocate(3000));
+  ASSERT_EQ(buffer->data(), data);
+  ASSERT_EQ(pool->bytes_cached(), 0);
+  ASSERT_OK_AND_ASSIGN(auto other, pool->Allocate(3000));
+  ASSERT_NE(other->data(), data);
+
+  // Buffers can outlive the pool
+  pool.reset();
+  buffer.reset();
+
+  // Buffers beyond the cache size are freed
+  ASSERT_OK_AND_ASSIGN(pool, CudaHostBufferPool::Make(kGpuNumber,
+                                                      /*max_cached_bytes=*/4096));
+  ASSERT_OK_AND_ASSIGN(buffer, pool->Allocate(10000));
+  buffer.reset();
+  ASSERT_EQ(pool->bytes_cached(), 0);
+
+  ASSERT_RAISES(Invalid, CudaHostBufferPool::Make(-1));
+}
+
 // ------------------------------------------------------------------------
 // Test CudaBufferWriter
 
@@ -679,6 +733,37 @@ TEST_F(TestCudaArrowIpc, BasicWriteRead) {
   CompareBatch(*batch, *cpu_batch);
 }
 
+TEST_F(TestCudaArrowIpc, CopyRecordBatchToHostAsync) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::test::MakeListRecordBatch(&batch));
+  ASSERT_OK_AND_ASSIGN(auto pool, CudaHostBufferPool::Make(kGpuNumber));
+  ASSERT_OK_AND_ASSIGN(auto stream, device_->MakeStream());
+
+  auto check_copy = [&](const RecordBatch& device_batch) {
+    ASSERT_OK_AND_ASSIGN(auto host_batch,
+                         CopyRecordBatchToHostAsync(device_batch, *stream, pool.get()));
+    ASSERT_EQ(host_batch->device_type(), DeviceAllocationType::kCPU);
+    ASSERT_NE(host_batch->GetSyncEvent(), nullptr);
+    ASSERT_OK(host_batch->GetSyncEvent()->Wait());
+    ASSERT_OK(host_batch->ValidateFull());
+    CompareBatch(*batch, *host_batch);
+  };
+
+  // The buffers of a batch read from IPC are in a single allocation
+  ASSERT_OK_AND_ASSIGN(auto device_serialized,
+                       SerializeRecordBatch(*batch, context_.get()));
+  ipc::DictionaryMemo unused_memo;
+  ASSERT_OK_AND_ASSIGN(auto device_batch,
+                       ReadRecordBatch(batch->schema(), &unused_memo, device_serialized));
+  check_copy(*device_batch);
+
+  // Each buffer is in its own allocation
+  ASSERT_OK_AND_ASSIGN(device_batch, batch->CopyTo(mm_));
+  check_copy(*device_batch);
+
+  ASSERT_RAISES(Invalid, CopyRecordBatchToHostAsync(*batch, *stream, pool.get()));
+}
+
 TEST_F(TestCudaArrowIpc, WriteIpcString) {
   auto values = ArrayFromJSON(utf8(), R"(["foo", null, "quux"])");
   ASSERT_OK_AND_ASSIGN(auto values_device, values->CopyTo(mm_));
@@ -853,5 +938,128 @@ TEST_F(TestCudaDeviceArrayRoundtrip, Dictionary) {
   TestWithArrayFactory(factory);
 }
 
+
+// ------------------------------------------------------------------------
+// Compute functions
+
+class TestCudaCompute : public TestCudaBase {
+ public:
+  void SetUp() {
+    TestCudaBase::SetUp();
+    ASSERT_OK(RegisterComputeFunctions());
+  }
+
+  std::shared_ptr<Array> ToDevice(const std::shared_ptr<DataType>& type,
+                                  const std::string& json) {
+    auto array = ArrayFromJSON(type, json);
+    EXPECT_OK_AND_ASSIGN(auto device_array, array->CopyTo(mm_));
+    return device_array;
+  }
+
+  void AssertDeviceResult(const std::string& func_name, const std::vector<Datum>& args,
+                          const std::shared_ptr<DataType>& type, const std::string& json,
+                          const compute::FunctionOptions* options = NULLPTR) {
+    ASSERT_OK_AND_ASSIGN(auto result, compute::CallFunction(func_name, args, options));
+    ASSERT_TRUE(result.is_array());
+    auto device_result = result.make_array();
+    ASSERT_TRUE(IsCudaDevice(*device_result->data()->buffers[1]->device()));
+    ASSERT_OK_AND_ASSIGN(auto host_result, device_result->CopyTo(cpu_mm_));
+    ASSERT_OK(host_result->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(type, json), *host_result, /*verbose=*/true);
+  }
+};
+
+TEST_F(TestCudaCompute, Arithmetic) {
+  auto left = ToDevice(int32(), "[1, 2, null, 4, 5, 6, 7, 8, 9, 10]");
+  auto right = ToDevice(int32(), "[10, 20, 30, null, 50, 60, 70, 80, 90, 100]");
+  AssertDeviceResult("add", {left, right}, int32(),
+                     "[11, 22, null, null, 55, 66, 77, 88, 99, 110]");
+  AssertDeviceResult("subtract", {right, left}, int32(),
+                     "[9, 18, null, null, 45, 54, 63, 72, 81, 90]");
+  AssertDeviceResult("multiply", {left, ScalarFromJSON(int32(), "3")}, int32(),
+                     "[3, 6, null, 12, 15, 18, 21, 24, 27, 30]");
+  AssertDeviceResult("add", {left, ScalarFromJSON(int32(), "null")}, int32(),
+                     "[null, null, null, null, null, null, null, null, null, null]");
+  // Slices
+  AssertDeviceResult("add", {left->Slice(3), right->Slice(1, 7)}, int32(),
+                     "[24, 35, null, 57, 68, 79, 90]");
+
+  AssertDeviceResult("add",
+                     {ToDevice(float64(), "[1.5, null]"), ScalarFromJSON(float64(), "1")},
+                     float64(), "[2.5, null]");
+}
+
+TEST_F(TestCudaCompute, Comparison) {
+  auto left = ToDevice(int64(), "[1, 2, null, 4, 5, 6, 7, 8, 9]");
+  AssertDeviceResult("greater", {left, ScalarFromJSON(int64(), "4")}, boolean(),
+                     "[false, false, null, false, true, true, true, true, true]");
+  AssertDeviceResult("equal", {left, left}, boolean(),
+                     "[true, true, null, true, true, true, true, true, true]");
+  AssertDeviceResult("less_equal", {ScalarFromJSON(int64(), "8"), left}, boolean(),
+                     "[false, false, null, false, false, false, false, true, true]");
+}
+
+TEST_F(TestCudaCompute, Take) {
+  auto values = ToDevice(uint16(), "[10, 20, null, 40]");
+  AssertDeviceResult("take", {values, ToDevice(int32(), "[3, 0, null, 2, 1, 1]")},
+                     uint16(), "[40, 10, null, null, 20, 20]");
+  AssertDeviceResult("take", {values, ToDevice(int64(), "[]")}, uint16(), "[]");
+  ASSERT_RAISES(IndexError, compute::CallFunction(
+                                "take", {values, ToDevice(int64(), "[0, 4]")}));
+}
+
+TEST_F(TestCudaCompute, Filter) {
+  std::string values_json = "[";
+  std::string mask_json = "[";
+  std::string expected_json = "[";
+  for (int i = 0; i < 200; ++i) {
+    const bool selected = i % 3 == 0;
+    const bool valid = i % 7 != 0;
+    values_json += (i > 0 ? ", " : "") + (valid ? std::to_string(i) : "null");
+    mask_json += (i > 0 ? ", " : "") + std::string(i % 11 == 1 ? "null"
+                                                     : selected ? "true"
+                                                                : "false");
+    if (selected && i % 11 != 1) {
+      expected_json += (expected_json.size() > 1 ? ", " : "") +
+                       (valid ? std::to_string(i) : "null");
+    }
+  }
+  values_json += "]";
+  mask_json += "]";
+  expected_json += "]";
+  AssertDeviceResult("filter",
+                     {ToDevice(float32(), values_json), ToDevice(boolean(), mask_json)},
+                     float32(), expected_json);
+
+  compute::FilterOptions emit_null(compute::FilterOptions::EMIT_NULL);
+  ASSERT_RAISES(NotImplemented,
+                compute::CallFunction("filter",
+                                      {ToDevice(float32(), "[1]"),
+                                       ToDevice(boolean(), "[null]")},
+                                      &emit_null));
+}
+
+TEST_F(TestCudaCompute, Aggregate) {
+  std::string json = "[";
+  for (int i = 0; i < 1000; ++i) {
+    json += (i > 0 ? ", " : "") + (i % 10 == 0 ? std::string("null") : std::to_string(i));
+  }
+  json += "]";
+  auto values = ToDevice(int32(), json);
+  auto host_values = ArrayFromJSON(int32(), json);
+  for (const std::string func_name : {"sum", "min", "max"}) {
+    ARROW_SCOPED_TRACE(func_name);
+    ASSERT_OK_AND_ASSIGN(auto expected, compute::CallFunction(func_name, {host_values}));
+    ASSERT_OK_AND_ASSIGN(auto actual, compute::CallFunction(func_name, {values}));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+
+  compute::ScalarAggregateOptions no_skip(/*skip_nulls=*/false);
+  ASSERT_OK_AND_ASSIGN(auto sum, compute::CallFunction("sum", {values}, &no_skip));
+  AssertDatumsEqual(ScalarFromJSON(int64(), "null"), sum);
+  ASSERT_OK_AND_ASSIGN(sum, compute::CallFunction("sum", {ToDevice(uint8(), "[]")}));
+  AssertDatumsEqual(ScalarFromJSON(uint64(), "null"), sum);
+}
+
 }  // namespace cuda
 }  // namespace arrow
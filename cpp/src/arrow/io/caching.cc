@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cmath>
 #include <mutex>
 #include <utility>
@@ -28,10 +29,32 @@
 #include "arrow/result.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/metrics.h"
 
 namespace arrow {
 namespace io {
 
+namespace {
+
+// See CacheOptions::MakeFromNetworkMetrics
+void ComputeCoalescingLimits(double time_to_first_byte_sec,
+                             double transfer_bandwidth_bytes_per_sec,
+                             double ideal_bandwidth_utilization_frac,
+                             int64_t max_ideal_request_size_bytes,
+                             int64_t* hole_size_limit, int64_t* range_size_limit) {
+  // hole_size_limit = TTFB * BW
+  *hole_size_limit = static_cast<int64_t>(
+      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
+  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
+  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
+  *range_size_limit = std::min(
+      max_ideal_request_size_bytes,
+      static_cast<int64_t>(std::round(*hole_size_limit * ideal_bandwidth_utilization_frac /
+                                      (1 - ideal_bandwidth_utilization_frac))));
+}
+
+}  // namespace
+
 CacheOptions CacheOptions::Defaults() {
   return CacheOptions{internal::ReadRangeCache::kDefaultHoleSizeLimit,
                       internal::ReadRangeCache::kDefaultRangeSizeLimit,
@@ -114,17 +137,12 @@ CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_mil
       transfer_bandwidth_mib_per_sec * 1024 * 1024;
   const int64_t max_ideal_request_size_bytes = max_ideal_request_size_mib * 1024 * 1024;
 
-  // hole_size_limit = TTFB * BW
-  const auto hole_size_limit = static_cast<int64_t>(
-      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
+  int64_t hole_size_limit, range_size_limit;
+  ComputeCoalescingLimits(time_to_first_byte_sec,
+                          static_cast<double>(transfer_bandwidth_bytes_per_sec),
+                          ideal_bandwidth_utilization_frac, max_ideal_request_size_bytes,
+                          &hole_size_limit, &range_size_limit);
   DCHECK_GT(hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
-
-  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
-  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
-  const int64_t range_size_limit = std::min(
-      max_ideal_request_size_bytes,
-      static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
-                                      (1 - ideal_bandwidth_utilization_frac))));
   DCHECK_GT(range_size_limit, 0) << "Computed range_size_limit must be > 0";
 
   return {hole_size_limit, range_size_limit, /*lazy=*/false, /*prefetch_limit=*/0};
@@ -135,6 +153,9 @@ namespace internal {
 struct RangeCacheEntry {
   ReadRange range;
   Future<std::shared_ptr<Buffer>> future;
+  // Bytes of the ranges given to Cache() that have not been read yet
+  // (only tracked by BudgetedImpl)
+  int64_t unread_bytes = 0;
 
   RangeCacheEntry() = default;
   RangeCacheEntry(const ReadRange& range_, Future<std::shared_ptr<Buffer>> future_)
@@ -145,38 +166,200 @@ struct RangeCacheEntry {
   }
 };
 
+// Estimate the Time-To-First-Byte and the transfer bandwidth of a file from the
+// duration of its read requests, by a least squares fit of
+//   duration = TTFB + nbytes / BW
+// over the measurements, weighted to favour the recent ones.
+class ReadRequestMetrics {
+ public:
+  // Number of requests measured before adapting the coalescing limits
+  static constexpr int64_t kMinRequests = 8;
+  // Weight decay of a measurement per later measurement
+  static constexpr double kDecay = 0.95;
+
+  ReadRequestMetrics(int64_t hole_size_limit, int64_t range_size_limit)
+      : hole_size_limit_(hole_size_limit), range_size_limit_(range_size_limit) {}
+
+  void Record(int64_t nbytes, double duration_sec) {
+    const auto x = static_cast<double>(nbytes);
+    const double y = duration_sec;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    weight_ = weight_ * kDecay + 1;
+    sum_x_ = sum_x_ * kDecay + x;
+    sum_y_ = sum_y_ * kDecay + y;
+    sum_xx_ = sum_xx_ * kDecay + x * x;
+    sum_xy_ = sum_xy_ * kDecay + x * y;
+    if (++num_requests_ < kMinRequests) {
+      return;
+    }
+    // Requests of (nearly) the same size don't tell latency and bandwidth apart
+    const double denominator = weight_ * sum_xx_ - sum_x_ * sum_x_;
+    if (denominator <= 1e-6 * weight_ * sum_xx_) {
+      return;
+    }
+    const double sec_per_byte = (weight_ * sum_xy_ - sum_x_ * sum_y_) / denominator;
+    const double time_to_first_byte_sec = (sum_y_ - sec_per_byte * sum_x_) / weight_;
+    if (sec_per_byte <= 0 || time_to_first_byte_sec <= 0) {
+      return;
+    }
+
+    const int64_t max_request_size =
+        CacheOptions::kDefaultMaxIdealRequestSizeMib * 1024 * 1024;
+    int64_t hole_size_limit, range_size_limit;
+    ComputeCoalescingLimits(time_to_first_byte_sec, 1 / sec_per_byte,
+                            CacheOptions::kDefaultIdealBandwidthUtilizationFrac,
+                            max_request_size, &hole_size_limit, &range_size_limit);
+    // CoalesceReadRanges requires range_size_limit > hole_size_limit
+    hole_size_limit_ = std::clamp<int64_t>(hole_size_limit, 1, max_request_size - 1);
+    range_size_limit_ = std::max(range_size_limit, hole_size_limit_ + 1);
+  }
+
+  void GetLimits(int64_t* hole_size_limit, int64_t* range_size_limit) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    *hole_size_limit = hole_size_limit_;
+    *range_size_limit = range_size_limit_;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  int64_t num_requests_ = 0;
+  double weight_ = 0, sum_x_ = 0, sum_y_ = 0, sum_xx_ = 0, sum_xy_ = 0;
+  int64_t hole_size_limit_;
+  int64_t range_size_limit_;
+};
+
+namespace {
+
+struct CacheMetrics {
+  std::shared_ptr<util::metrics::Counter> hits;
+  std::shared_ptr<util::metrics::Counter> misses;
+
+  static const CacheMetrics& Get() {
+    static const CacheMetrics metrics = [] {
+      auto* registry = util::metrics::MetricsRegistry::Default();
+      const char* kName = "arrow_read_range_cache_reads_total";
+      const char* kHelp = "Reads from a ReadRangeCache, by whether the data was ready";
+      return CacheMetrics{registry->GetCounter(kName, kHelp, {{"result", "hit"}})
+                              .ValueOrDie(),
+                          registry->GetCounter(kName, kHelp, {{"result", "miss"}})
+                              .ValueOrDie()};
+    }();
+    return metrics;
+  }
+};
+
+}  // namespace
+
 struct ReadRangeCache::Impl {
   std::shared_ptr<RandomAccessFile> owned_file;
   RandomAccessFile* file;
   IOContext ctx;
   CacheOptions options;
+  // Only if options.adaptive, shared with the pending requests
+  std::shared_ptr<ReadRequestMetrics> metrics;
 
   // Ordered by offset (so as to find a matching region by binary search)
   std::vector<RangeCacheEntry> entries;
 
   virtual ~Impl() = default;
 
+  // Return the options with the adapted coalescing limits
+  CacheOptions current_options() const {
+    CacheOptions current = options;
+    if (metrics) {
+      metrics->GetLimits(&current.hole_size_limit, &current.range_size_limit);
+    }
+    return current;
+  }
+
+  // Measure the duration of a read request issued at `start`.  Each request
+  // captures its own start time, so concurrent requests don't share any timing state.
+  Future<std::shared_ptr<Buffer>> Measure(Future<std::shared_ptr<Buffer>> future,
+                                          int64_t nbytes,
+                                          std::chrono::steady_clock::time_point start) {
+    if (metrics) {
+      future.AddCallback([metrics = metrics, nbytes,
+                          start](const Result<std::shared_ptr<Buffer>>& result) {
+        if (result.ok()) {
+          const std::chrono::duration<double> duration =
+              std::chrono::steady_clock::now() - start;
+          metrics->Record(nbytes, duration.count());
+        }
+      });
+    }
+    return future;
+  }
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const ReadRange& range) {
+    return ReadAsync(ctx, range);
+  }
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext& read_ctx,
+                                            const ReadRange& range) {
+    const auto start = std::chrono::steady_clock::now();
+    return Measure(file->ReadAsync(read_ctx, range.offset, range.length), range.length,
+                   start);
+  }
+
+  // The context of reads issued ahead of their request, so that the executor
+  // serves requested reads first
+  IOContext prefetch_ctx() const {
+    return ctx.WithPriority(std::max(ctx.priority(), IOPriority::kPrefetch));
+  }
+
   // Get the future corresponding to a range
   virtual Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) {
     return entry->future;
   }
 
+  // Start reading an entry ahead of its request, if it is not read yet.
+  // Return false to stop prefetching further entries.
+  virtual bool TryPrefetch(RangeCacheEntry* entry) {
+    if (!entry->future.is_valid()) {
+      entry->future = ReadAsync(prefetch_ctx(), entry->range);
+    }
+    return true;
+  }
+
+  // Called when the given range of the entry has been read
+  virtual void Consume(RangeCacheEntry* entry, const ReadRange& range) {}
+
+  // Find the entry containing the given range, or return entries.end()
+  std::vector<RangeCacheEntry>::iterator FindEntry(const ReadRange& range) {
+    const auto it = std::lower_bound(
+        entries.begin(), entries.end(), range,
+        [](const RangeCacheEntry& entry, const ReadRange& range) {
+          return entry.range.offset + entry.range.length < range.offset + range.length;
+        });
+    if (it != entries.end() && it->range.Contains(range)) {
+      return it;
+    }
+    return entries.end();
+  }
+
   // Make cache entries for ranges
   virtual std::vector<RangeCacheEntry> MakeCacheEntries(
       const std::vector<ReadRange>& ranges) {
+    // Let the file issue the reads together
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<Future<std::shared_ptr<Buffer>>> futures =
+        file->ReadManyAsync(prefetch_ctx(), ranges);
     std::vector<RangeCacheEntry> new_entries;
     new_entries.reserve(ranges.size());
-    for (const auto& range : ranges) {
-      new_entries.emplace_back(range, file->ReadAsync(ctx, range.offset, range.length));
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      new_entries.emplace_back(ranges[i],
+                               Measure(std::move(futures[i]), ranges[i].length, start));
     }
     return new_entries;
   }
 
   // Add the given ranges to the cache, coalescing them where possible
   virtual Status Cache(std::vector<ReadRange> ranges) {
+    const CacheOptions current = current_options();
     ARROW_ASSIGN_OR_RAISE(
-        ranges, internal::CoalesceReadRanges(std::move(ranges), options.hole_size_limit,
-                                             options.range_size_limit));
+        ranges, internal::CoalesceReadRanges(std::move(ranges), current.hole_size_limit,
+                                             current.range_size_limit));
     std::vector<RangeCacheEntry> new_entries = MakeCacheEntries(ranges);
     // Add new entries, themselves ordered by offset
     if (entries.size() > 0) {
@@ -199,24 +382,30 @@ struct ReadRangeCache::Impl {
       return std::make_shared<Buffer>(&byte, 0);
     }
 
-    const auto it = std::lower_bound(
-        entries.begin(), entries.end(), range,
-        [](const RangeCacheEntry& entry, const ReadRange& range) {
-          return entry.range.offset + entry.range.length < range.offset + range.length;
-        });
-    if (it != entries.end() && it->range.Contains(range)) {
+    const auto it = FindEntry(range);
+    if (it != entries.end()) {
+      // A hit if the data was already read, or prefetched, by the time it is needed
+      const bool hit = it->future.is_valid() && it->future.is_finished();
+      (hit ? CacheMetrics::Get().hits : CacheMetrics::Get().misses)->Increment();
       auto fut = MaybeRead(&*it);
       ARROW_ASSIGN_OR_RAISE(auto buf, fut.result());
-      if (options.lazy && options.prefetch_limit > 0) {
+      Consume(&*it, range);
+      if (options.lazy && (options.prefetch_limit > 0 || options.adaptive)) {
+        // Keep a bandwidth-delay product in flight to hide the latency of the
+        // next requests
+        const int64_t prefetch_bytes =
+            options.adaptive ? current_options().hole_size_limit : 0;
         int64_t num_prefetched = 0;
+        int64_t bytes_prefetched = 0;
         for (auto next_it = it + 1;
-             next_it != entries.end() && num_prefetched < options.prefetch_limit;
+             next_it != entries.end() && (num_prefetched < options.prefetch_limit ||
+                                          bytes_prefetched < prefetch_bytes);
              ++next_it) {
-          if (!next_it->future.is_valid()) {
-            next_it->future =
-                file->ReadAsync(ctx, next_it->range.offset, next_it->range.length);
+          if (!TryPrefetch(&*next_it)) {
+            break;
           }
           ++num_prefetched;
+          bytes_prefetched += next_it->range.length;
         }
       }
       return SliceBuffer(std::move(buf), range.offset - it->range.offset, range.length);
@@ -240,12 +429,8 @@ struct ReadRangeCache::Impl {
     std::vector<Future<>> futures;
     futures.reserve(ranges.size());
     for (auto& range : ranges) {
-      const auto it = std::lower_bound(
-          entries.begin(), entries.end(), range,
-          [](const RangeCacheEntry& entry, const ReadRange& range) {
-            return entry.range.offset + entry.range.length < range.offset + range.length;
-          });
-      if (it != entries.end() && it->range.Contains(range)) {
+      const auto it = FindEntry(range);
+      if (it != entries.end()) {
         futures.push_back(Future<>(MaybeRead(&*it)));
       } else {
         return Status::Invalid("Range was not requested for caching: offset=",
@@ -267,7 +452,7 @@ struct ReadRangeCache::LazyImpl : public ReadRangeCache::Impl {
   Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) override {
     // Called by superclass Read()/WaitFor() so we have the lock
     if (!entry->future.is_valid()) {
-      entry->future = file->ReadAsync(ctx, entry->range.offset, entry->range.length);
+      entry->future = ReadAsync(entry->range);
     }
     return entry->future;
   }
@@ -305,14 +490,112 @@ struct ReadRangeCache::LazyImpl : public ReadRangeCache::Impl {
   }
 };
 
+// Release the data of the cached ranges once they have been read, and read ahead
+// (eagerly, or lazily through prefetching) only as long as the data being read or
+// held by the cache fits in the prefetch memory limit.  Ranges are always read when
+// requested, even beyond the limit or after their release.
+struct ReadRangeCache::BudgetedImpl : public ReadRangeCache::LazyImpl {
+  // Size of the entries being read or held by the cache
+  int64_t buffered_bytes = 0;
+
+  virtual ~BudgetedImpl() = default;
+
+  bool Fits(const RangeCacheEntry& entry) const {
+    return options.prefetch_memory_limit <= 0 ||
+           buffered_bytes + entry.range.length <= options.prefetch_memory_limit;
+  }
+
+  Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) override {
+    if (!entry->future.is_valid()) {
+      entry->future = ReadAsync(entry->range);
+      buffered_bytes += entry->range.length;
+    }
+    return entry->future;
+  }
+
+  bool TryPrefetch(RangeCacheEntry* entry) override {
+    if (entry->future.is_valid() || entry->unread_bytes <= 0) {
+      // Already read, or released
+      return true;
+    }
+    if (!Fits(*entry)) {
+      return false;
+    }
+    entry->future = ReadAsync(prefetch_ctx(), entry->range);
+    buffered_bytes += entry->range.length;
+    return true;
+  }
+
+  void Consume(RangeCacheEntry* entry, const ReadRange& range) override {
+    if (!options.release_consumed) {
+      return;
+    }
+    entry->unread_bytes -= range.length;
+    if (entry->unread_bytes <= 0 && entry->future.is_valid()) {
+      entry->future = Future<std::shared_ptr<Buffer>>();
+      buffered_bytes -= entry->range.length;
+      if (!options.lazy) {
+        ReadAhead();
+      }
+    }
+  }
+
+  // Read the entries not read yet in order, as far as the limit allows
+  void ReadAhead() {
+    for (auto& entry : entries) {
+      if (!TryPrefetch(&entry)) {
+        break;
+      }
+    }
+  }
+
+  Status Cache(std::vector<ReadRange> ranges) override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    RETURN_NOT_OK(ReadRangeCache::Impl::Cache(ranges));
+    for (const auto& range : ranges) {
+      if (range.length == 0) {
+        continue;
+      }
+      const auto it = FindEntry(range);
+      DCHECK(it != entries.end());
+      if (it != entries.end()) {
+        it->unread_bytes += range.length;
+      }
+    }
+    if (!options.lazy) {
+      ReadAhead();
+    }
+    return Status::OK();
+  }
+
+  Future<> Wait() override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    std::vector<Future<>> futures;
+    for (auto& entry : entries) {
+      // Don't fetch the released entries again
+      if (entry.future.is_valid() || entry.unread_bytes > 0) {
+        futures.emplace_back(MaybeRead(&entry));
+      }
+    }
+    return AllComplete(futures);
+  }
+};
+
 ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> owned_file,
                                RandomAccessFile* file, IOContext ctx,
                                CacheOptions options)
-    : impl_(options.lazy ? new LazyImpl() : new Impl()) {
+    : impl_(options.release_consumed || options.prefetch_memory_limit > 0
+                ? new BudgetedImpl()
+                : options.lazy ? new LazyImpl()
+                               : new Impl()) {
   impl_->owned_file = std::move(owned_file);
   impl_->file = file;
   impl_->ctx = std::move(ctx);
   impl_->options = options;
+  if (options.adaptive) {
+    impl_->metrics = std::make_shared<ReadRequestMetrics>(options.hole_size_limit,
+                                                          options.range_size_limit);
+  }
 }
 
 ReadRangeCache::~ReadRangeCache() = default;
@@ -331,6 +614,8 @@ Future<> ReadRangeCache::WaitFor(std::vector<ReadRange> ranges) {
   return impl_->WaitFor(std::move(ranges));
 }
 
+CacheOptions ReadRangeCache::options() const { return impl_->current_options(); }
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
@@ -51,11 +51,33 @@ struct ARROW_EXPORT CacheOptions {
   /// \brief The maximum number of ranges to be prefetched. This is only used
   ///   for lazy cache to asynchronously read some ranges after reading the target range.
   int64_t prefetch_limit = 0;
+  /// \brief Whether to adapt the coalescing to the measured storage performance.
+  ///   If true, the cache measures the duration of its read requests and estimates
+  ///   the Time-To-First-Byte and the transfer bandwidth of the file from them, then
+  ///   derives hole_size_limit and range_size_limit as MakeFromNetworkMetrics does for
+  ///   the ranges cached afterwards.  The given limits are used until enough requests
+  ///   have been measured.  A lazy cache then also prefetches at least
+  ///   hole_size_limit bytes (the bandwidth-delay product) ahead of the range that is
+  ///   currently being read, besides the prefetch_limit ranges.
+  bool adaptive = false;
+  /// \brief Whether to release the cached data of a merged byte range once all the
+  ///   ranges cached in it have been read.  Reading a range again after that
+  ///   fetches it again.
+  bool release_consumed = false;
+  /// \brief The maximum size in bytes of the merged byte ranges being read or held
+  ///   by the cache for prefetching to go on; 0 for no limit.
+  ///   With lazy = false, the ranges are then read in order as the limit allows
+  ///   instead of all at once; with lazy = true, this limits the prefetch_limit
+  ///   ranges.  A range is always read when requested.  This is mostly useful
+  ///   together with release_consumed.
+  int64_t prefetch_memory_limit = 0;
 
   bool operator==(const CacheOptions& other) const {
     return hole_size_limit == other.hole_size_limit &&
            range_size_limit == other.range_size_limit && lazy == other.lazy &&
-           prefetch_limit == other.prefetch_limit;
+           prefetch_limit == other.prefetch_limit && adaptive == other.adaptive &&
+           release_consumed == other.release_consumed &&
+           prefetch_memory_limit == other.prefetch_memory_limit;
   }
 
   /// \brief Construct CacheOptions from network storage metrics (e.g. S3).
@@ -142,9 +164,16 @@ class ARROW_EXPORT ReadRangeCache {
   /// \brief Wait until all given ranges have been cached.
   Future<> WaitFor(std::vector<ReadRange> ranges);
 
+  /// \brief Return the options in effect.
+  ///
+  /// If CacheOptions::adaptive is set, the coalescing limits are those adapted to
+  /// the read requests measured so far.
+  CacheOptions options() const;
+
  protected:
   struct Impl;
   struct LazyImpl;
+  struct BudgetedImpl;
 
   ReadRangeCache(std::shared_ptr<RandomAccessFile> owned_file, RandomAccessFile* file,
                  IOContext ctx, CacheOptions options);
@@ -25,6 +25,7 @@
 #include <utility>
 
 #include "arrow/buffer.h"
+#include "arrow/io/memory.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
@@ -45,11 +46,19 @@ namespace io {
 class CompressedOutputStream::Impl {
  public:
   Impl(MemoryPool* pool, const std::shared_ptr<OutputStream>& raw)
-      : pool_(pool), raw_(raw), is_open_(false), compressed_pos_(0), total_pos_(0) {}
+      : pool_(pool),
+        raw_(raw),
+        raw_buffer_(dynamic_cast<BufferOutputStream*>(raw.get())),
+        is_open_(false),
+        compressed_pos_(0),
+        total_pos_(0) {}
 
   Status Init(Codec* codec) {
     ARROW_ASSIGN_OR_RAISE(compressor_, codec->MakeCompressor());
-    ARROW_ASSIGN_OR_RAISE(compressed_, AllocateResizableBuffer(kChunkSize, pool_));
+    if (raw_buffer_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(compressed_, AllocateResizableBuffer(kChunkSize, pool_));
+    }
+    output_size_ = kChunkSize;
     compressed_pos_ = 0;
     is_open_ = true;
     return Status::OK();
@@ -70,39 +79,69 @@ class CompressedOutputStream::Impl {
     return Status::OK();
   }
 
+  // Return the memory to compress into: the raw stream's own buffer if it is a
+  // BufferOutputStream, otherwise the rest of the compressed_ buffer
+  Result<uint8_t*> GetOutput(int64_t* output_len) {
+    if (raw_buffer_ != nullptr) {
+      *output_len = output_size_;
+      return raw_buffer_->ReserveForWrite(output_size_);
+    }
+    *output_len = compressed_->size() - compressed_pos_;
+    return compressed_->mutable_data() + compressed_pos_;
+  }
+
+  Status CommitOutput(int64_t nbytes) {
+    if (raw_buffer_ != nullptr) {
+      return raw_buffer_->Advance(nbytes);
+    }
+    compressed_pos_ += nbytes;
+    return Status::OK();
+  }
+
+  Status EnlargeOutput() {
+    output_size_ *= 2;
+    if (raw_buffer_ != nullptr) {
+      return Status::OK();
+    }
+    return compressed_->Resize(output_size_);
+  }
+
+  bool OutputFull() const {
+    return raw_buffer_ == nullptr && compressed_pos_ == compressed_->size();
+  }
+
   Status Write(const void* data, int64_t nbytes) {
     std::lock_guard<std::mutex> guard(lock_);
 
     auto input = reinterpret_cast<const uint8_t*>(data);
     while (nbytes > 0) {
       int64_t input_len = nbytes;
-      int64_t output_len = compressed_->size() - compressed_pos_;
-      uint8_t* output = compressed_->mutable_data() + compressed_pos_;
+      int64_t output_len;
+      ARROW_ASSIGN_OR_RAISE(uint8_t* output, GetOutput(&output_len));
       ARROW_ASSIGN_OR_RAISE(auto result,
                             compressor_->Compress(input_len, input, output_len, output));
-      compressed_pos_ += result.bytes_written;
+      RETURN_NOT_OK(CommitOutput(result.bytes_written));
 
       if (result.bytes_read == 0) {
         // Not enough output, try to flush it and retry
         if (compressed_pos_ > 0) {
           RETURN_NOT_OK(FlushCompressed());
-          output_len = compressed_->size() - compressed_pos_;
-          output = compressed_->mutable_data() + compressed_pos_;
+          ARROW_ASSIGN_OR_RAISE(output, GetOutput(&output_len));
           ARROW_ASSIGN_OR_RAISE(
               result, compressor_->Compress(input_len, input, output_len, output));
-          compressed_pos_ += result.bytes_written;
+          RETURN_NOT_OK(CommitOutput(result.bytes_written));
         }
       }
       input += result.bytes_read;
       nbytes -= result.bytes_read;
       total_pos_ += result.bytes_read;
-      if (compressed_pos_ == compressed_->size()) {
+      if (OutputFull()) {
         // Output buffer full, flush it
         RETURN_NOT_OK(FlushCompressed());
       }
       if (result.bytes_read == 0) {
         // Need to enlarge output buffer
-        RETURN_NOT_OK(compressed_->Resize(compressed_->size() * 2));
+        RETURN_NOT_OK(EnlargeOutput());
       }
     }
     return Status::OK();
@@ -113,17 +152,17 @@ class CompressedOutputStream::Impl {
 
     while (true) {
       // Flush compressor
-      int64_t output_len = compressed_->size() - compressed_pos_;
-      uint8_t* output = compressed_->mutable_data() + compressed_pos_;
+      int64_t output_len;
+      ARROW_ASSIGN_OR_RAISE(uint8_t* output, GetOutput(&output_len));
       ARROW_ASSIGN_OR_RAISE(auto result, compressor_->Flush(output_len, output));
-      compressed_pos_ += result.bytes_written;
+      RETURN_NOT_OK(CommitOutput(result.bytes_written));
 
       // Flush compressed output
       RETURN_NOT_OK(FlushCompressed());
 
       if (result.should_retry) {
         // Need to enlarge output buffer
-        RETURN_NOT_OK(compressed_->Resize(compressed_->size() * 2));
+        RETURN_NOT_OK(EnlargeOutput());
       } else {
         break;
       }
@@ -134,17 +173,17 @@ class CompressedOutputStream::Impl {
   Status FinalizeCompression() {
     while (true) {
       // Try to end compressor
-      int64_t output_len = compressed_->size() - compressed_pos_;
-      uint8_t* output = compressed_->mutable_data() + compressed_pos_;
+      int64_t output_len;
+      ARROW_ASSIGN_OR_RAISE(uint8_t* output, GetOutput(&output_len));
       ARROW_ASSIGN_OR_RAISE(auto result, compressor_->End(output_len, output));
-      compressed_pos_ += result.bytes_written;
+      RETURN_NOT_OK(CommitOutput(result.bytes_written));
 
       // Flush compressed output
       RETURN_NOT_OK(FlushCompressed());
 
       if (result.should_retry) {
         // Need to enlarge output buffer
-        RETURN_NOT_OK(compressed_->Resize(compressed_->size() * 2));
+        RETURN_NOT_OK(EnlargeOutput());
       } else {
         // Done
         break;
@@ -187,10 +226,14 @@ class CompressedOutputStream::Impl {
 
   MemoryPool* pool_;
   std::shared_ptr<OutputStream> raw_;
+  // If non-null, data is compressed in place into raw_ and compressed_ is unused
+  BufferOutputStream* raw_buffer_;
   bool is_open_;
   std::shared_ptr<Compressor> compressor_;
   std::shared_ptr<ResizableBuffer> compressed_;
   int64_t compressed_pos_;
+  // Size of the output given to the compressor
+  int64_t output_size_;
   // Total number of bytes compressed
   int64_t total_pos_;
 
@@ -342,6 +385,45 @@ class CompressedInputStream::Impl {
     return Status::OK();
   }
 
+  // Decompress some data from the compressed_ buffer directly into the caller's
+  // memory, bypassing the decompressed_ buffer.
+  Result<int64_t> DecompressDataInto(int64_t nbytes, uint8_t* out) {
+    if (decompressor_->IsFinished()) {
+      // We just went over the end of a previous compressed stream.
+      RETURN_NOT_OK(decompressor_->Reset());
+      fresh_decompressor_ = true;
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto result,
+        decompressor_->Decompress(compressed_buffer_available(),
+                                  compressed_->data() + compressed_pos_, nbytes, out));
+    compressed_pos_ += result.bytes_read;
+    if (result.bytes_read > 0) {
+      fresh_decompressor_ = false;
+    }
+    return result.bytes_written;
+  }
+
+  // Like RefillDecompressed(), but decompress directly into the caller's memory.
+  // Returns the number of bytes written; if 0, RefillDecompressed() should be
+  // called to make progress or detect the end of the stream.
+  // Call this function only if the decompressed_ buffer is fully consumed.
+  Result<int64_t> DecompressInto(int64_t nbytes, uint8_t* out) {
+    DCHECK_EQ(0, decompressed_buffer_available());
+    if (compressed_ && compressed_->size() != 0) {
+      // The decompressor may still hold data from the current compressed_ buffer
+      ARROW_ASSIGN_OR_RAISE(int64_t bytes_written, DecompressDataInto(nbytes, out));
+      if (bytes_written > 0 || compressed_buffer_available() > 0) {
+        return bytes_written;
+      }
+    }
+    RETURN_NOT_OK(EnsureCompressedData());
+    if (compressed_buffer_available() == 0) {
+      return 0;
+    }
+    return DecompressDataInto(nbytes, out);
+  }
+
   // Copying a given number of bytes from the decompressed_ buffer.
   int64_t ReadFromDecompressed(int64_t nbytes, uint8_t* out) {
     int64_t readable = decompressed_ ? (decompressed_->size() - decompressed_pos_) : 0;
@@ -399,7 +481,15 @@ class CompressedInputStream::Impl {
       }
 
       // At this point, no more decompressed data remains, so we need to
-      // decompress more
+      // decompress more.  Large reads are decompressed in place.
+      if (nbytes - total_read >= kDecompressIntoMinSize) {
+        ARROW_ASSIGN_OR_RAISE(int64_t bytes_written,
+                              DecompressInto(nbytes - total_read, out_data + total_read));
+        if (bytes_written > 0) {
+          total_read += bytes_written;
+          continue;
+        }
+      }
       ARROW_ASSIGN_OR_RAISE(decompressor_has_data, RefillDecompressed());
     }
 
@@ -431,6 +521,8 @@ class CompressedInputStream::Impl {
   static const int64_t kChunkSize = 64 * 1024;
   // Decompress 1 MB at a time
   static const int64_t kDecompressSize = 1024 * 1024;
+  // Decompress reads of at least 64 KB directly into the caller's memory
+  static const int64_t kDecompressIntoMinSize = 64 * 1024;
 
   MemoryPool* pool_;
   std::shared_ptr<InputStream> raw_;
@@ -81,14 +81,14 @@ std::shared_ptr<Buffer> CompressDataOneShot(Codec* codec,
 }
 
 Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
-                                int64_t* stream_pos, std::vector<uint8_t>* out) {
+                                int64_t* stream_pos, std::vector<uint8_t>* out,
+                                int64_t chunk_size = 1111) {
   // Create compressed input stream
   auto buffer_reader = std::make_shared<BufferReader>(compressed);
   ARROW_ASSIGN_OR_RAISE(auto stream, CompressedInputStream::Make(codec, buffer_reader));
 
   std::vector<uint8_t> decompressed;
   int64_t decompressed_size = 0;
-  const int64_t chunk_size = 1111;
   while (true) {
     ARROW_ASSIGN_OR_RAISE(auto buf, stream->Read(chunk_size));
     if (buf->size() == 0) {
@@ -111,24 +111,49 @@ Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed
   return RunCompressedInputStream(codec, compressed, nullptr, out);
 }
 
-void CheckCompressedInputStream(Codec* codec, const std::vector<uint8_t>& data) {
+void CheckCompressedInputStream(Codec* codec, const std::vector<uint8_t>& data,
+                                int64_t chunk_size = 1111) {
   // Create compressed data
   auto compressed = CompressDataOneShot(codec, data);
 
   std::vector<uint8_t> decompressed;
   int64_t stream_pos = -1;
-  ASSERT_OK(RunCompressedInputStream(codec, compressed, &stream_pos, &decompressed));
+  ASSERT_OK(RunCompressedInputStream(codec, compressed, &stream_pos, &decompressed,
+                                     chunk_size));
 
   ASSERT_EQ(decompressed.size(), data.size());
   ASSERT_EQ(decompressed, data);
   ASSERT_EQ(stream_pos, static_cast<int64_t>(decompressed.size()));
 }
 
+// An OutputStream that is not a BufferOutputStream, so that CompressedOutputStream
+// doesn't compress in place
+class ForwardingOutputStream : public OutputStream {
+ public:
+  explicit ForwardingOutputStream(std::shared_ptr<OutputStream> target)
+      : target_(std::move(target)) {}
+
+  Status Close() override { return target_->Close(); }
+  bool closed() const override { return target_->closed(); }
+  Result<int64_t> Tell() const override { return target_->Tell(); }
+  Status Write(const void* data, int64_t nbytes) override {
+    return target_->Write(data, nbytes);
+  }
+  using OutputStream::Write;
+
+ private:
+  std::shared_ptr<OutputStream> target_;
+};
+
 void CheckCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
-                                 bool do_flush) {
+                                 bool do_flush, bool in_place = true) {
   // Create compressed output stream
   ASSERT_OK_AND_ASSIGN(auto buffer_writer, BufferOutputStream::Create());
-  ASSERT_OK_AND_ASSIGN(auto stream, CompressedOutputStream::Make(codec, buffer_writer));
+  std::shared_ptr<OutputStream> raw = buffer_writer;
+  if (!in_place) {
+    raw = std::make_shared<ForwardingOutputStream>(buffer_writer);
+  }
+  ASSERT_OK_AND_ASSIGN(auto stream, CompressedOutputStream::Make(codec, raw));
   ASSERT_OK_AND_EQ(0, stream->Tell());
 
   const uint8_t* input = data.data();
@@ -182,6 +207,29 @@ TEST_P(CompressedInputStreamTest, RandomData) {
   CheckCompressedInputStream(codec.get(), data);
 }
 
+TEST_P(CompressedInputStreamTest, LargeReads) {
+  // Large reads are decompressed directly into the caller's memory
+  const int64_t chunk_size = 1024 * 1024;
+  auto codec = MakeCodec();
+  CheckCompressedInputStream(codec.get(), MakeCompressibleData(COMPRESSIBLE_DATA_SIZE),
+                             chunk_size);
+  CheckCompressedInputStream(codec.get(), MakeRandomData(RANDOM_DATA_SIZE), chunk_size);
+
+  auto data = MakeRandomData(200000);
+  auto compressed = CompressDataOneShot(codec.get(), data);
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK_AND_ASSIGN(auto concatenated, ConcatenateBuffers({compressed, compressed}));
+  ASSERT_OK(RunCompressedInputStream(codec.get(), concatenated, nullptr, &decompressed,
+                                     chunk_size));
+  std::vector<uint8_t> expected(data);
+  expected.insert(expected.end(), data.begin(), data.end());
+  ASSERT_EQ(decompressed, expected);
+
+  auto truncated = SliceBuffer(compressed, 0, compressed->size() - 3);
+  ASSERT_RAISES(IOError, RunCompressedInputStream(codec.get(), truncated, nullptr,
+                                                  &decompressed, chunk_size));
+}
+
 TEST_P(CompressedInputStreamTest, TruncatedData) {
   auto codec = MakeCodec();
   auto data = MakeRandomData(10000);
@@ -253,6 +301,17 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+TEST_P(CompressedOutputStreamTest, NotInPlace) {
+  auto codec = MakeCodec();
+  for (const auto& data : {MakeCompressibleData(COMPRESSIBLE_DATA_SIZE),
+                           MakeRandomData(RANDOM_DATA_SIZE)}) {
+    CheckCompressedOutputStream(codec.get(), data, false /* do_flush */,
+                                false /* in_place */);
+    CheckCompressedOutputStream(codec.get(), data, true /* do_flush */,
+                                false /* in_place */);
+  }
+}
+
 // NOTES:
 // - Snappy doesn't support streaming decompression
 // - BZ2 doesn't support one-shot compression
@@ -48,17 +48,22 @@
 
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/io/util_internal.h"
 
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/metrics.h"
+#include "arrow/util/trace_events.h"
 
 namespace arrow {
 
+using internal::checked_pointer_cast;
 using internal::FileDescriptor;
 using internal::IOErrorFromErrno;
 
@@ -247,6 +252,49 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return std::shared_ptr<Buffer>(std::move(buffer));
   }
 
+  Result<std::vector<std::shared_ptr<Buffer>>> ReadBuffersAt(
+      const std::vector<ReadRange>& ranges) {
+    // Number of reads in flight per ring
+    static constexpr uint32_t kRingEntries = 64;
+    // Each thread of the IO pool reuses its own ring
+    static thread_local std::unique_ptr<internal::IoUring> ring;
+
+    RETURN_NOT_OK(CheckClosed());
+    std::vector<std::shared_ptr<ResizableBuffer>> buffers;
+    std::vector<uint8_t*> out;
+    buffers.reserve(ranges.size());
+    out.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      RETURN_NOT_OK(internal::ValidateRange(range.offset, range.length));
+      ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(range.length, pool_));
+      out.push_back(buffer->mutable_data());
+      buffers.push_back(std::move(buffer));
+    }
+    if (ring == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(ring, internal::IoUring::Make(kRingEntries));
+    }
+    // Like ReadAt(), require that we seek before calling Read() or Write()
+    need_seeking_.store(true);
+    auto maybe_bytes_read = ring->ReadRanges(fd_.fd(), ranges, out);
+    if (!maybe_bytes_read.ok()) {
+      // Don't reuse a ring which may still hold completions of this call
+      ring.reset();
+      return maybe_bytes_read.status();
+    }
+    auto bytes_read = *std::move(maybe_bytes_read);
+
+    std::vector<std::shared_ptr<Buffer>> results;
+    results.reserve(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      if (bytes_read[i] < ranges[i].length) {
+        RETURN_NOT_OK(buffers[i]->Resize(bytes_read[i]));
+        buffers[i]->ZeroPadding();
+      }
+      results.push_back(std::move(buffers[i]));
+    }
+    return results;
+  }
+
   Status WillNeed(const std::vector<ReadRange>& ranges) {
     auto report_error = [](int errnum, const char* msg) -> Status {
       if (errnum == EBADF || errnum == EINVAL) {
@@ -316,6 +364,24 @@ Status ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
   return impl_->WillNeed(ranges);
 }
 
+std::vector<Future<std::shared_ptr<Buffer>>> ReadableFile::ReadManyAsync(
+    const IOContext& ctx, const std::vector<ReadRange>& ranges) {
+  if (ranges.size() < 2 || !internal::IoUring::IsSupported()) {
+    return RandomAccessFile::ReadManyAsync(ctx, ranges);
+  }
+  // Issue all the reads from a single IO task and a single ring submission
+  auto self = checked_pointer_cast<ReadableFile>(shared_from_this());
+  auto all_read = DeferNotOk(internal::SubmitIO(
+      ctx, [self, ranges] { return self->impl_->ReadBuffersAt(ranges); }));
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  futures.reserve(ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    futures.push_back(all_read.Then(
+        [i](const std::vector<std::shared_ptr<Buffer>>& buffers) { return buffers[i]; }));
+  }
+  return futures;
+}
+
 Result<int64_t> ReadableFile::DoTell() const { return impl_->Tell(); }
 
 Result<int64_t> ReadableFile::DoRead(int64_t nbytes, void* out) {
@@ -323,11 +389,23 @@ Result<int64_t> ReadableFile::DoRead(int64_t nbytes, void* out) {
 }
 
 Result<int64_t> ReadableFile::DoReadAt(int64_t position, int64_t nbytes, void* out) {
-  return impl_->ReadAt(position, nbytes, out);
+  util::tracing::ScopedTraceEvent trace_event("io", "ReadableFile::ReadAt");
+  trace_event.set_value(nbytes);
+  static const internal::ReadMetrics metrics("local");
+  const auto start = internal::ReadMetrics::Clock::now();
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, impl_->ReadAt(position, nbytes, out));
+  metrics.Record(bytes_read, start);
+  return bytes_read;
 }
 
 Result<std::shared_ptr<Buffer>> ReadableFile::DoReadAt(int64_t position, int64_t nbytes) {
-  return impl_->ReadBufferAt(position, nbytes);
+  util::tracing::ScopedTraceEvent trace_event("io", "ReadableFile::ReadAt");
+  trace_event.set_value(nbytes);
+  static const internal::ReadMetrics metrics("local");
+  const auto start = internal::ReadMetrics::Clock::now();
+  ARROW_ASSIGN_OR_RAISE(auto buffer, impl_->ReadBufferAt(position, nbytes));
+  metrics.Record(buffer->size(), start);
+  return buffer;
 }
 
 Result<std::shared_ptr<Buffer>> ReadableFile::DoRead(int64_t nbytes) {
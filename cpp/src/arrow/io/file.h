@@ -113,6 +113,15 @@ class ARROW_EXPORT ReadableFile
 
   Status WillNeed(const std::vector<ReadRange>& ranges) override;
 
+  /// \brief Read several ranges at once
+  ///
+  /// On Linux, if the kernel supports io_uring, the ranges are read by a single
+  /// task of the IO executor that submits them together to the kernel, which
+  /// serves them concurrently.  Otherwise each range is read by a separate task.
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const IOContext&, const std::vector<ReadRange>& ranges) override;
+  using RandomAccessFile::ReadManyAsync;
+
  private:
   friend RandomAccessFileConcurrencyWrapper<ReadableFile>;
 
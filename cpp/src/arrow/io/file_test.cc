@@ -405,6 +405,37 @@ TEST_F(TestReadableFile, ReadManyAsync) {
   AssertBufferEqual(*buf3, "da");
 }
 
+TEST_F(TestReadableFile, ReadManyAsyncLarge) {
+  std::string data;
+  for (int i = 0; i < 100000; ++i) {
+    data.push_back(static_cast<char>('a' + i % 26));
+  }
+  {
+    ASSERT_OK_AND_ASSIGN(auto stream, FileOutputStream::Open(path_));
+    ASSERT_OK(stream->Write(data));
+    ASSERT_OK(stream->Close());
+  }
+  OpenFile();
+
+  // More ranges than fit in a single ring submission, some of them empty or past EOF
+  std::vector<ReadRange> ranges;
+  for (int64_t i = 0; i < 200; ++i) {
+    ranges.push_back({i * 499, i % 7});
+  }
+  ranges.push_back({99990, 100});
+  ranges.push_back({200000, 10});
+  auto futs = file_->ReadManyAsync(ranges);
+  ASSERT_EQ(futs.size(), ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buf, futs[i].result());
+    const auto offset = static_cast<size_t>(ranges[i].offset);
+    const auto length = static_cast<size_t>(ranges[i].length);
+    AssertBufferEqual(*buf, offset < data.size() ? data.substr(offset, length) : "");
+  }
+
+  ASSERT_RAISES(Invalid, file_->ReadManyAsync({{0, 1}, {-1, 1}})[1].result());
+}
+
 TEST_F(TestReadableFile, SeekingRequired) {
   MakeTestFile();
   OpenFile();
@@ -26,6 +26,7 @@
 #include <sstream>
 #include <string_view>
 #include <typeinfo>
+#include <unordered_map>
 #include <utility>
 
 #include "arrow/buffer.h"
@@ -59,6 +60,26 @@ const IOContext& default_io_context() {
   return g_default_io_context;
 }
 
+Result<IOContext> GetDedicatedIOContext(const std::string& name, int threads,
+                                        MemoryPool* pool) {
+  if (threads <= 0) {
+    return Status::Invalid("Dedicated IO thread pool needs at least one thread");
+  }
+  // Leaked on purpose, like the global IO thread pool
+  static auto* mutex = new std::mutex;
+  static auto* pools = new std::unordered_map<std::string, std::shared_ptr<ThreadPool>>;
+  std::lock_guard<std::mutex> lock(*mutex);
+  auto it = pools->find(name);
+  if (it == pools->end()) {
+    ARROW_ASSIGN_OR_RAISE(auto thread_pool, ThreadPool::MakeEternal(threads));
+    thread_pool->ExportMetrics("io_" + name);
+    it = pools->emplace(name, std::move(thread_pool)).first;
+  } else {
+    RETURN_NOT_OK(it->second->SetCapacity(threads));
+  }
+  return IOContext(pool, it->second.get());
+}
+
 int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
 
 Status SetIOThreadPoolCapacity(int threads) {
@@ -409,6 +430,7 @@ std::shared_ptr<ThreadPool> MakeIOThreadPool() {
   if (!maybe_pool.ok()) {
     maybe_pool.status().Abort("Failed to create global IO thread pool");
   }
+  (*maybe_pool)->ExportMetrics("io");
   return *std::move(maybe_pool);
 }
 
@@ -419,6 +441,22 @@ ThreadPool* GetIOThreadPool() {
   return pool.get();
 }
 
+ReadMetrics::ReadMetrics(const std::string& filesystem) {
+  using ::arrow::util::metrics::Histogram;
+  using ::arrow::util::metrics::MetricsRegistry;
+  auto* registry = MetricsRegistry::Default();
+  const ::arrow::util::metrics::MetricLabels labels = {{"filesystem", filesystem}};
+  // The metric names are fixed and valid, registration can't fail
+  reads_ = registry->GetCounter("arrow_io_reads_total", "Read calls", labels)
+               .ValueOrDie();
+  bytes_ = registry->GetCounter("arrow_io_read_bytes_total", "Bytes read", labels)
+               .ValueOrDie();
+  latency_ = registry
+                 ->GetHistogram("arrow_io_read_latency_seconds", "Latency of read calls",
+                                Histogram::LatencyBounds(), labels)
+                 .ValueOrDie();
+}
+
 // -----------------------------------------------------------------------
 // CoalesceReadRanges
 
@@ -49,12 +49,26 @@ struct ReadRange {
   }
 };
 
+/// EXPERIMENTAL: scheduling class of IO tasks
+///
+/// Executors which honour task priorities (such as Arrow's ThreadPool) run queued
+/// tasks of a more urgent class first.
+enum class IOPriority : int8_t {
+  /// Reads whose data is being waited for
+  kDemand = 0,
+  /// Speculative reads of data expected to be needed later
+  kPrefetch = 1,
+  /// Writes and other tasks nobody is directly waiting for
+  kBackground = 2,
+};
+
 /// EXPERIMENTAL: options provider for IO tasks
 ///
 /// Includes an Executor (which will be used to execute asynchronous reads),
 /// a MemoryPool (which will be used to allocate buffers when zero copy reads
-/// are not possible), and an external id (in case the executor receives tasks from
-/// multiple sources and must distinguish tasks associated with this IOContext).
+/// are not possible), an external id (in case the executor receives tasks from
+/// multiple sources and must distinguish tasks associated with this IOContext)
+/// and the priority of the submitted tasks.
 struct ARROW_EXPORT IOContext {
   // No specified executor: will use a global IO thread pool
   IOContext() : IOContext(default_memory_pool(), StopToken::Unstoppable()) {}
@@ -89,13 +103,36 @@ struct ARROW_EXPORT IOContext {
 
   StopToken stop_token() const { return stop_token_; }
 
+  // The priority of tasks submitted to the executor
+  IOPriority priority() const { return priority_; }
+
+  // Return a copy of this IOContext submitting tasks with the given priority
+  IOContext WithPriority(IOPriority priority) const {
+    IOContext copy = *this;
+    copy.priority_ = priority;
+    return copy;
+  }
+
  private:
   MemoryPool* pool_;
   ::arrow::internal::Executor* executor_;
   int64_t external_id_;
   StopToken stop_token_;
+  IOPriority priority_ = IOPriority::kDemand;
 };
 
+/// EXPERIMENTAL: get an IOContext executing tasks on a thread pool of its own
+///
+/// IO tasks of all filesystems run on the global IO thread pool by default, so
+/// that a slow filesystem can occupy all its threads.  Passing a dedicated
+/// IOContext to a filesystem isolates it instead.
+///
+/// Thread pools are keyed by `name` (for example a filesystem or bucket name),
+/// created on first use and kept until the end of the process; getting an existing
+/// pool resizes it to `threads`.
+ARROW_EXPORT Result<IOContext> GetDedicatedIOContext(
+    const std::string& name, int threads, MemoryPool* pool = default_memory_pool());
+
 class ARROW_EXPORT FileInterface : public std::enable_shared_from_this<FileInterface> {
  public:
   virtual ~FileInterface() = 0;
@@ -110,6 +110,26 @@ Status BufferOutputStream::Write(const void* data, int64_t nbytes) {
   return Status::OK();
 }
 
+Result<uint8_t*> BufferOutputStream::ReserveForWrite(int64_t nbytes) {
+  if (ARROW_PREDICT_FALSE(!is_open_)) {
+    return Status::IOError("OutputStream is closed");
+  }
+  DCHECK(buffer_);
+  if (position_ + nbytes >= capacity_) {
+    RETURN_NOT_OK(Reserve(nbytes));
+  }
+  return mutable_data_ + position_;
+}
+
+Status BufferOutputStream::Advance(int64_t nbytes) {
+  if (ARROW_PREDICT_FALSE(!is_open_)) {
+    return Status::IOError("OutputStream is closed");
+  }
+  DCHECK_LE(position_ + nbytes, capacity_);
+  position_ += nbytes;
+  return Status::OK();
+}
+
 Status BufferOutputStream::Reserve(int64_t nbytes) {
   // Always overallocate by doubling.  It seems that it is a better growth
   // strategy, at least for memory_benchmark.cc.
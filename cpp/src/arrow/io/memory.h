@@ -75,6 +75,19 @@ class ARROW_EXPORT BufferOutputStream : public OutputStream {
 
   int64_t capacity() const { return capacity_; }
 
+  /// \brief Make room to write up to nbytes in place at the current position
+  ///
+  /// The returned memory is valid until the next call on this stream.  The bytes
+  /// written there are appended to the stream by a subsequent call to Advance().
+  /// This lets producers such as compressors write to the buffer without copying
+  /// through an intermediate buffer.
+  Result<uint8_t*> ReserveForWrite(int64_t nbytes);
+
+  /// \brief Append the given number of bytes written in place
+  ///
+  /// nbytes must not exceed the size given to the last ReserveForWrite() call.
+  Status Advance(int64_t nbytes);
+
  private:
   BufferOutputStream();
 
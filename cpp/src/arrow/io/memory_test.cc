@@ -22,6 +22,7 @@
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <random>
 #include <string>
@@ -919,6 +920,184 @@ TEST(RangeReadCache, LazyWithPrefetching) {
   ASSERT_RAISES(Invalid, cache.Read({25, 2}));
 }
 
+class PriorityRecordingBufferReader : public BufferReader {
+ public:
+  using BufferReader::BufferReader;
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext& context, int64_t position,
+                                            int64_t nbytes) override {
+    priorities_.push_back(context.priority());
+    return BufferReader::ReadAsync(context, position, nbytes);
+  }
+  const std::vector<IOPriority>& priorities() const { return priorities_; }
+
+ private:
+  std::vector<IOPriority> priorities_;
+};
+
+TEST(RangeReadCache, Priorities) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  // Eager reads are prefetches
+  auto file =
+      std::make_shared<PriorityRecordingBufferReader>(std::make_shared<Buffer>(data));
+  internal::ReadRangeCache eager_cache(file, {}, CacheOptions::Defaults());
+  ASSERT_OK(eager_cache.Cache({{1, 1}, {20, 2}}));
+  ASSERT_EQ(file->priorities(),
+            std::vector<IOPriority>({IOPriority::kPrefetch, IOPriority::kPrefetch}));
+
+  // Requested reads are demand reads, reads ahead of them are prefetches
+  file = std::make_shared<PriorityRecordingBufferReader>(std::make_shared<Buffer>(data));
+  CacheOptions options = CacheOptions::LazyDefaults();
+  options.prefetch_limit = 1;
+  internal::ReadRangeCache lazy_cache(file, {}, options);
+  ASSERT_OK(lazy_cache.Cache({{1, 1}, {20, 2}}));
+  ASSERT_OK(lazy_cache.Read({1, 1}));
+  ASSERT_EQ(file->priorities(),
+            std::vector<IOPriority>({IOPriority::kDemand, IOPriority::kPrefetch}));
+
+  // Prefetches don't raise the priority of a less urgent context
+  file = std::make_shared<PriorityRecordingBufferReader>(std::make_shared<Buffer>(data));
+  internal::ReadRangeCache background_cache(
+      file, IOContext().WithPriority(IOPriority::kBackground), CacheOptions::Defaults());
+  ASSERT_OK(background_cache.Cache({{1, 1}}));
+  ASSERT_EQ(file->priorities(), std::vector<IOPriority>({IOPriority::kBackground}));
+}
+
+TEST(RangeReadCache, ReleaseConsumed) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<CountingBufferReader>(std::make_shared<Buffer>(data));
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  options.release_consumed = true;
+  options.prefetch_memory_limit = 6;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  // Cached as {1, 4}, {8, 2} and {20, 2}
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {20, 2}}));
+  // {20, 2} doesn't fit in the memory limit
+  ASSERT_EQ(2, file->read_count());
+
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({1, 2}));
+  AssertBufferEqual(*buf, "bc");
+  ASSERT_EQ(2, file->read_count());
+  // Releasing {1, 4} makes room for {20, 2}
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({3, 2}));
+  AssertBufferEqual(*buf, "de");
+  ASSERT_EQ(3, file->read_count());
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({20, 2}));
+  AssertBufferEqual(*buf, "uv");
+  ASSERT_EQ(3, file->read_count());
+
+  // Released ranges are fetched again
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({1, 2}));
+  AssertBufferEqual(*buf, "bc");
+  ASSERT_EQ(4, file->read_count());
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({8, 2}));
+  AssertBufferEqual(*buf, "ij");
+  ASSERT_EQ(4, file->read_count());
+
+  // Released ranges aren't fetched again to wait for them
+  ASSERT_FINISHES_OK(cache.Wait());
+  ASSERT_EQ(4, file->read_count());
+}
+
+TEST(RangeReadCache, LazyWithPrefetchMemoryLimit) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<CountingBufferReader>(std::make_shared<Buffer>(data));
+  CacheOptions options = CacheOptions::LazyDefaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  options.prefetch_limit = 2;
+  options.release_consumed = true;
+  options.prefetch_memory_limit = 4;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  // Cached as {1, 4}, {8, 2} and {20, 2}
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {20, 2}}));
+  ASSERT_EQ(0, file->read_count());
+
+  // Holding {1, 4} leaves no room to prefetch {8, 2}
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({1, 2}));
+  AssertBufferEqual(*buf, "bc");
+  ASSERT_EQ(1, file->read_count());
+  // Releasing {1, 4} makes room to prefetch {8, 2} and {20, 2}
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({3, 2}));
+  AssertBufferEqual(*buf, "de");
+  ASSERT_EQ(3, file->read_count());
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({8, 2}));
+  AssertBufferEqual(*buf, "ij");
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({20, 2}));
+  AssertBufferEqual(*buf, "uv");
+  ASSERT_EQ(3, file->read_count());
+
+  // Released ranges are fetched again
+  ASSERT_OK_AND_ASSIGN(buf, cache.Read({3, 2}));
+  AssertBufferEqual(*buf, "de");
+  ASSERT_EQ(4, file->read_count());
+}
+
+// A BufferReader with the latency and bandwidth of a remote file
+class SlowBufferReader : public CountingBufferReader {
+ public:
+  SlowBufferReader(std::shared_ptr<Buffer> buffer, double time_to_first_byte_sec,
+                   double bandwidth_bytes_per_sec)
+      : CountingBufferReader(std::move(buffer)),
+        time_to_first_byte_sec_(time_to_first_byte_sec),
+        bandwidth_bytes_per_sec_(bandwidth_bytes_per_sec) {}
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext& context, int64_t position,
+                                            int64_t nbytes) override {
+    SleepFor(time_to_first_byte_sec_ + nbytes / bandwidth_bytes_per_sec_);
+    return CountingBufferReader::ReadAsync(context, position, nbytes);
+  }
+
+ private:
+  double time_to_first_byte_sec_;
+  double bandwidth_bytes_per_sec_;
+};
+
+TEST(RangeReadCache, Adaptive) {
+  constexpr int64_t kMiB = 1024 * 1024;
+  ASSERT_OK_AND_ASSIGN(auto buffer, AllocateBuffer(16 * kMiB));
+  std::memset(buffer->mutable_data(), 0, buffer->size());
+  // TTFB = 10 ms, BW = 100 MiB/s
+  auto file = std::make_shared<SlowBufferReader>(std::move(buffer), 0.01, 100.0 * kMiB);
+
+  CacheOptions options = CacheOptions::LazyDefaults();
+  options.adaptive = true;
+  internal::ReadRangeCache cache(file, {}, options);
+  ASSERT_EQ(cache.options(), options);
+
+  // Ranges of various sizes, too far apart to be coalesced at first
+  std::vector<ReadRange> ranges;
+  int64_t offset = 0;
+  for (int64_t i = 1; i <= 10; ++i) {
+    ranges.push_back({offset, i * 128 * 1024});
+    offset += ranges.back().length + 64 * 1024;
+  }
+  ASSERT_OK(cache.Cache(ranges));
+  for (const auto& range : ranges) {
+    ASSERT_OK(cache.Read(range));
+  }
+  ASSERT_EQ(file->read_count(), static_cast<int64_t>(ranges.size()));
+
+  // Expect about hole_size_limit = 1 MiB and range_size_limit = 9 MiB
+  const CacheOptions adapted = cache.options();
+  ASSERT_GT(adapted.hole_size_limit, kMiB / 2);
+  ASSERT_LT(adapted.hole_size_limit, 2 * kMiB);
+  ASSERT_GT(adapted.range_size_limit, 4 * kMiB);
+  ASSERT_LE(adapted.range_size_limit, 64 * kMiB);
+
+  // Ranges cached afterwards are coalesced with the adapted limits
+  ASSERT_OK(cache.Cache({{offset, 1024}, {offset + 256 * 1024, 1024}}));
+  ASSERT_OK(cache.Read({offset, 1024}));
+  ASSERT_OK(cache.Read({offset + 256 * 1024, 1024}));
+  ASSERT_EQ(file->read_count(), static_cast<int64_t>(ranges.size()) + 1);
+}
+
 TEST(CacheOptions, Basics) {
   auto check = [](const CacheOptions actual, const double expected_hole_size_limit_MiB,
                   const double expected_range_size_limit_MiB) -> void {
@@ -956,5 +1135,52 @@ TEST(IOThreadPool, Capacity) {
   ASSERT_EQ(GetIOThreadPoolCapacity(), capacity + 1);
 }
 
+TEST(IOThreadPool, Dedicated) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading enabled";
+#endif
+  ASSERT_OK_AND_ASSIGN(auto a, GetDedicatedIOContext("dedicated_a", 2));
+  ASSERT_OK_AND_ASSIGN(auto b, GetDedicatedIOContext("dedicated_b", 1));
+  ASSERT_NE(a.executor(), default_io_context().executor());
+  ASSERT_NE(a.executor(), b.executor());
+  ASSERT_EQ(a.executor()->GetCapacity(), 2);
+
+  ASSERT_OK_AND_ASSIGN(auto again, GetDedicatedIOContext("dedicated_a", 3));
+  ASSERT_EQ(again.executor(), a.executor());
+  ASSERT_EQ(a.executor()->GetCapacity(), 3);
+
+  ASSERT_RAISES(Invalid, GetDedicatedIOContext("dedicated_c", 0));
+}
+
+TEST(IOThreadPool, Priorities) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading enabled";
+#endif
+  ASSERT_OK_AND_ASSIGN(auto ctx, GetDedicatedIOContext("priorities", 1));
+  ASSERT_EQ(ctx.priority(), IOPriority::kDemand);
+
+  // Occupy the only thread while queueing tasks of each priority
+  auto gate = Future<>::Make();
+  ASSERT_OK_AND_ASSIGN(auto blocker, internal::SubmitIO(ctx, [gate] { gate.Wait(); }));
+
+  std::mutex mutex;
+  std::vector<IOPriority> order;
+  std::vector<Future<>> futures;
+  for (auto priority :
+       {IOPriority::kBackground, IOPriority::kPrefetch, IOPriority::kDemand}) {
+    ASSERT_OK_AND_ASSIGN(auto fut,
+                         internal::SubmitIO(ctx.WithPriority(priority), [&, priority] {
+                           std::lock_guard<std::mutex> lock(mutex);
+                           order.push_back(priority);
+                         }));
+    futures.push_back(std::move(fut));
+  }
+  gate.MarkFinished();
+  ASSERT_FINISHES_OK(blocker);
+  ASSERT_FINISHES_OK(AllComplete(futures));
+  ASSERT_EQ(order, std::vector<IOPriority>({IOPriority::kDemand, IOPriority::kPrefetch,
+                                            IOPriority::kBackground}));
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -0,0 +1,305 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring_internal.h"
+
+#if defined(__linux__) && defined(__has_include)
+#  if __has_include(<linux/io_uring.h>)
+#    define ARROW_HAVE_IO_URING
+#  endif
+#endif
+
+#ifdef ARROW_HAVE_IO_URING
+#  include <linux/io_uring.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::IOErrorFromErrno;
+
+namespace io {
+namespace internal {
+
+#ifdef ARROW_HAVE_IO_URING
+
+namespace {
+
+// io_uring lengths are 32-bit, larger reads are finished with pread()
+constexpr int64_t kMaxSubmittedLength = int64_t{1} << 30;
+
+int IoUringSetup(uint32_t entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, uint32_t to_submit, uint32_t min_complete, uint32_t flags) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+}  // namespace
+
+struct IoUring::Impl {
+  ~Impl() {
+    if (sqes != MAP_FAILED) {
+      munmap(sqes, sqes_size);
+    }
+    if (cq_ring != MAP_FAILED && cq_ring != sq_ring) {
+      munmap(cq_ring, cq_ring_size);
+    }
+    if (sq_ring != MAP_FAILED) {
+      munmap(sq_ring, sq_ring_size);
+    }
+    if (ring_fd >= 0) {
+      close(ring_fd);
+    }
+  }
+
+  Status Init(uint32_t entries) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd = IoUringSetup(entries, &params);
+    if (ring_fd < 0) {
+      return IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+
+    sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_ring_size = cq_ring_size = std::max(sq_ring_size, cq_ring_size);
+    }
+    sq_ring = mmap(nullptr, sq_ring_size, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_SQ_RING);
+    if (sq_ring == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "Failed to map io_uring submission queue");
+    }
+    if (single_mmap) {
+      cq_ring = sq_ring;
+    } else {
+      cq_ring = mmap(nullptr, cq_ring_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ring_fd, IORING_OFF_CQ_RING);
+      if (cq_ring == MAP_FAILED) {
+        return IOErrorFromErrno(errno, "Failed to map io_uring completion queue");
+      }
+    }
+    sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    sqes = mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                ring_fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "Failed to map io_uring submission entries");
+    }
+
+    auto sq_base = static_cast<uint8_t*>(sq_ring);
+    sq_head = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.head);
+    sq_tail = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.tail);
+    sq_mask = *reinterpret_cast<uint32_t*>(sq_base + params.sq_off.ring_mask);
+    sq_array = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.array);
+    auto cq_base = static_cast<uint8_t*>(cq_ring);
+    cq_head = reinterpret_cast<uint32_t*>(cq_base + params.cq_off.head);
+    cq_tail = reinterpret_cast<uint32_t*>(cq_base + params.cq_off.tail);
+    cq_mask = *reinterpret_cast<uint32_t*>(cq_base + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe*>(cq_base + params.cq_off.cqes);
+    num_entries = params.sq_entries;
+    features = params.features;
+    return Status::OK();
+  }
+
+  // Queue a read, it is submitted by the next call to SubmitAndWait()
+  void PrepareRead(int fd, uint8_t* out, int64_t offset, int64_t length,
+                   uint64_t user_data) {
+    // Only this thread writes the tail
+    const uint32_t tail = *sq_tail;
+    const uint32_t index = tail & sq_mask;
+    io_uring_sqe* sqe = static_cast<io_uring_sqe*>(sqes) + index;
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = fd;
+    sqe->addr = reinterpret_cast<uint64_t>(out);
+    sqe->len = static_cast<uint32_t>(std::min(length, kMaxSubmittedLength));
+    sqe->off = static_cast<uint64_t>(offset);
+    sqe->user_data = user_data;
+    sq_array[index] = index;
+    // Publish the entry to the kernel
+    __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+  }
+
+  // Submit the queued reads and wait for all of them to complete
+  Status SubmitAndWait(uint32_t num_reads, std::vector<int64_t>* bytes_read) {
+    uint32_t num_unsubmitted = num_reads;
+    uint32_t num_completed = 0;
+    while (num_completed < num_reads) {
+      int ret = IoUringEnter(ring_fd, num_unsubmitted, 1, IORING_ENTER_GETEVENTS);
+      if (ret < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        auto st = IOErrorFromErrno(errno, "io_uring_enter failed");
+        // The submitted reads write into the caller's buffers, they must be
+        // finished before returning.  The others are dropped from the queue.
+        DiscardUnsubmitted();
+        RETURN_NOT_OK(Drain(num_reads - num_unsubmitted - num_completed, bytes_read));
+        return st;
+      }
+      num_unsubmitted -= std::min(num_unsubmitted, static_cast<uint32_t>(ret));
+      num_completed += ReapCompletions(bytes_read);
+    }
+    return Status::OK();
+  }
+
+  // Remove the queued reads which the kernel hasn't consumed yet
+  void DiscardUnsubmitted() {
+    // Without SQ polling, the kernel only consumes entries in io_uring_enter()
+    __atomic_store_n(sq_tail, __atomic_load_n(sq_head, __ATOMIC_ACQUIRE),
+                     __ATOMIC_RELEASE);
+  }
+
+  // Wait for `num_in_flight` submitted reads to complete
+  Status Drain(uint32_t num_in_flight, std::vector<int64_t>* bytes_read) {
+    uint32_t num_completed = ReapCompletions(bytes_read);
+    while (num_completed < num_in_flight) {
+      int ret = IoUringEnter(ring_fd, 0, 1, IORING_ENTER_GETEVENTS);
+      if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+        return IOErrorFromErrno(errno, "Failed waiting for io_uring reads to complete");
+      }
+      num_completed += ReapCompletions(bytes_read);
+    }
+    return Status::OK();
+  }
+
+  uint32_t ReapCompletions(std::vector<int64_t>* bytes_read) {
+    // Only this thread writes the head
+    uint32_t head = *cq_head;
+    const uint32_t tail = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+    uint32_t num_reaped = 0;
+    for (; head != tail; ++head, ++num_reaped) {
+      const io_uring_cqe& cqe = cqes[head & cq_mask];
+      // A failed read is retried with pread(), which reports the error if it persists
+      (*bytes_read)[cqe.user_data] = std::max<int64_t>(cqe.res, 0);
+    }
+    __atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+    return num_reaped;
+  }
+
+  int ring_fd = -1;
+  void* sq_ring = MAP_FAILED;
+  void* cq_ring = MAP_FAILED;
+  void* sqes = MAP_FAILED;
+  size_t sq_ring_size = 0;
+  size_t cq_ring_size = 0;
+  size_t sqes_size = 0;
+  uint32_t* sq_head = nullptr;
+  uint32_t* sq_tail = nullptr;
+  uint32_t* sq_array = nullptr;
+  uint32_t sq_mask = 0;
+  uint32_t* cq_head = nullptr;
+  uint32_t* cq_tail = nullptr;
+  uint32_t cq_mask = 0;
+  io_uring_cqe* cqes = nullptr;
+  uint32_t num_entries = 0;
+  uint32_t features = 0;
+};
+
+bool IoUring::IsSupported() {
+  static const bool supported = [] {
+    auto maybe_ring = Make(1);
+    if (!maybe_ring.ok()) {
+      ARROW_LOG(DEBUG) << "io_uring is not available: " << maybe_ring.status().ToString();
+      return false;
+    }
+    // IORING_OP_READ appeared in Linux 5.6 together with this feature flag
+    return ((*maybe_ring)->impl_->features & IORING_FEAT_RW_CUR_POS) != 0;
+  }();
+  return supported;
+}
+
+Result<std::unique_ptr<IoUring>> IoUring::Make(uint32_t entries) {
+  std::unique_ptr<IoUring> ring(new IoUring());
+  RETURN_NOT_OK(ring->impl_->Init(entries));
+  return ring;
+}
+
+Result<std::vector<int64_t>> IoUring::ReadRanges(int fd,
+                                                 const std::vector<ReadRange>& ranges,
+                                                 const std::vector<uint8_t*>& out) {
+  DCHECK_EQ(ranges.size(), out.size());
+  std::vector<int64_t> bytes_read(ranges.size(), 0);
+  size_t begin = 0;
+  while (begin < ranges.size()) {
+    const size_t end = std::min(ranges.size(), begin + impl_->num_entries);
+    uint32_t to_submit = 0;
+    for (size_t i = begin; i < end; ++i) {
+      if (ranges[i].length > 0) {
+        impl_->PrepareRead(fd, out[i], ranges[i].offset, ranges[i].length, i);
+        ++to_submit;
+      }
+    }
+    RETURN_NOT_OK(impl_->SubmitAndWait(to_submit, &bytes_read));
+    begin = end;
+  }
+
+  // Finish short reads
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    while (bytes_read[i] < ranges[i].length) {
+      ARROW_ASSIGN_OR_RAISE(
+          int64_t n, ::arrow::internal::FileReadAt(fd, out[i] + bytes_read[i],
+                                                   ranges[i].offset + bytes_read[i],
+                                                   ranges[i].length - bytes_read[i]));
+      if (n == 0) {
+        break;  // EOF
+      }
+      bytes_read[i] += n;
+    }
+  }
+  return bytes_read;
+}
+
+#else  // !ARROW_HAVE_IO_URING
+
+struct IoUring::Impl {};
+
+bool IoUring::IsSupported() { return false; }
+
+Result<std::unique_ptr<IoUring>> IoUring::Make(uint32_t entries) {
+  return Status::NotImplemented("io_uring is only available on Linux");
+}
+
+Result<std::vector<int64_t>> IoUring::ReadRanges(int fd,
+                                                 const std::vector<ReadRange>& ranges,
+                                                 const std::vector<uint8_t*>& out) {
+  return Status::NotImplemented("io_uring is only available on Linux");
+}
+
+#endif  // ARROW_HAVE_IO_URING
+
+IoUring::IoUring() : impl_(new Impl()) {}
+
+IoUring::~IoUring() = default;
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
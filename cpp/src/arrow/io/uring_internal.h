@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/result.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+/// \brief A Linux io_uring instance issuing positional reads
+///
+/// The ring is driven through the raw system calls, so that no liburing
+/// dependency is needed.  An instance must not be used from several threads
+/// at once.
+class ARROW_EXPORT IoUring {
+ public:
+  ~IoUring();
+
+  /// \brief Whether the platform and the running kernel support io_uring
+  ///
+  /// This is false on other platforms than Linux, on kernels older than 5.1
+  /// and when the system calls are forbidden, e.g. by a seccomp profile.
+  static bool IsSupported();
+
+  /// \brief Create a ring with room for `entries` reads in flight
+  static Result<std::unique_ptr<IoUring>> Make(uint32_t entries);
+
+  /// \brief Read ranges of a file
+  ///
+  /// The ranges are submitted together, up to the ring size at a time, and
+  /// read concurrently by the kernel.  Short reads are completed with
+  /// pread() until EOF.  The ranges must already be validated.
+  ///
+  /// \param[in] fd the file descriptor to read from
+  /// \param[in] ranges the ranges to read
+  /// \param[in] out one output buffer of at least `ranges[i].length` bytes
+  ///            for each range
+  /// \return the number of bytes read for each range
+  ///
+  /// On error, the ring should not be used anymore: reads which could not be
+  /// waited for may still complete into it.
+  Result<std::vector<int64_t>> ReadRanges(int fd, const std::vector<ReadRange>& ranges,
+                                          const std::vector<uint8_t*>& out);
+
+ private:
+  IoUring();
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -17,11 +17,14 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/io/interfaces.h"
+#include "arrow/util/metrics.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
@@ -52,10 +55,31 @@ Result<std::vector<ReadRange>> CoalesceReadRanges(std::vector<ReadRange> ranges,
 ARROW_EXPORT
 ::arrow::internal::ThreadPool* GetIOThreadPool();
 
+// Read metrics of a filesystem, exported to the default metrics registry
+class ARROW_EXPORT ReadMetrics {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit ReadMetrics(const std::string& filesystem);
+
+  // Record a read of `nbytes` that started at `start`
+  void Record(int64_t nbytes, Clock::time_point start) const {
+    reads_->Increment();
+    bytes_->Increment(nbytes);
+    latency_->Observe(std::chrono::duration<double>(Clock::now() - start).count());
+  }
+
+ private:
+  std::shared_ptr<::arrow::util::metrics::Counter> reads_;
+  std::shared_ptr<::arrow::util::metrics::Counter> bytes_;
+  std::shared_ptr<::arrow::util::metrics::Histogram> latency_;
+};
+
 template <typename... SubmitArgs>
 auto SubmitIO(IOContext io_context, SubmitArgs&&... submit_args)
     -> decltype(std::declval<::arrow::internal::Executor*>()->Submit(submit_args...)) {
   ::arrow::internal::TaskHints hints;
+  hints.priority = static_cast<int32_t>(io_context.priority());
   hints.external_id = io_context.external_id();
   return io_context.executor()->Submit(hints, io_context.stop_token(),
                                        std::forward<SubmitArgs>(submit_args)...);
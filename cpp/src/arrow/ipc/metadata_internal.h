@@ -59,6 +59,10 @@ using KVVector = flatbuffers::Vector<KeyValueOffset>;
 // This 0xFFFFFFFF value is the first 4 bytes of a valid IPC message
 constexpr int32_t kIpcContinuationToken = -1;
 
+// Key of the message custom metadata holding the comma-separated CRC32 of each body
+// buffer, in hexadecimal
+constexpr char kBufferChecksumsKey[] = "ARROW:buffer_crc32";
+
 static constexpr flatbuf::MetadataVersion kCurrentMetadataVersion =
     flatbuf::MetadataVersion::V5;
 
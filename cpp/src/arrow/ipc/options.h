@@ -87,6 +87,17 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// like compression
   bool use_threads = true;
 
+  /// \brief Maximum number of record batches serialized ahead of the writes
+  ///
+  /// If positive and use_threads is true, RecordBatchWriter serializes and
+  /// compresses each record batch on the CPU thread pool and returns, while
+  /// the batches written before are written out in order.  At most this many
+  /// batches are kept in flight, which bounds the memory used.  Errors
+  /// serializing a batch are then reported by a later write or by Close().
+  ///
+  /// If zero (the default), each record batch is written before returning.
+  int max_batches_in_flight = 0;
+
   /// \brief Whether to emit dictionary deltas
   ///
   /// If false, a changed dictionary for a given field will emit a full
@@ -119,6 +130,27 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// and deltas.
   bool unify_dictionaries = false;
 
+  /// \brief Whether to write a row index for the IPC file format
+  ///
+  /// If true, the row offset of each record batch and, for integer and
+  /// floating-point fields, the minimum and maximum values in each record
+  /// batch are added to the custom metadata of the file footer.  This lets
+  /// RecordBatchFileReader locate rows and skip record batches without
+  /// reading them (see RecordBatchFileReader::ReadRowRange and
+  /// RecordBatchFileReader::SelectRecordBatches).
+  ///
+  /// This option is ignored for IPC streams.
+  bool write_row_index = false;
+
+  /// \brief Whether to write a checksum of each body buffer
+  ///
+  /// If true, the CRC32 of each body buffer, as written (i.e. after compression),
+  /// is added to the custom metadata of record batch and dictionary messages.
+  /// Readers then detect corrupted buffers (see
+  /// IpcReadOptions::verify_buffer_checksums).  Checksums run at memory speed on
+  /// CPUs with carry-less multiplication or CRC32 instructions.
+  bool write_buffer_checksums = false;
+
   /// \brief Format version to use for IPC messages and their metadata.
   ///
   /// Presently using V5 version (readable by 1.0.0 and later).
@@ -149,6 +181,18 @@ struct ARROW_EXPORT IpcReadOptions {
   /// like decompression
   bool use_threads = true;
 
+  /// \brief Number of record batches that RecordBatchStreamReader reads ahead
+  ///
+  /// If positive and use_threads is true, the stream reader reads the next
+  /// messages on the IO thread pool and decodes up to this many record batches
+  /// concurrently on the CPU thread pool, which is mostly useful for compressed
+  /// streams.  Batches are still returned in stream order.  Note that the reader
+  /// may then consume messages from the underlying stream before they are
+  /// requested.
+  ///
+  /// If zero (the default), each record batch is read when requested.
+  int stream_batch_readahead = 0;
+
   /// \brief Whether to convert incoming data to platform-native endianness
   ///
   /// If the endianness of the received schema is not equal to platform-native
@@ -161,6 +205,15 @@ struct ARROW_EXPORT IpcReadOptions {
   /// RecordBatchStreamReader and StreamDecoder classes.
   bool ensure_native_endian = true;
 
+  /// \brief Whether to verify the checksums of body buffers, if present
+  ///
+  /// Messages written with IpcWriteOptions::write_buffer_checksums carry the
+  /// CRC32 of each body buffer, which is then checked as the buffer is loaded,
+  /// before decoding; a mismatch is reported as an IOError.  Record batches read
+  /// with a subset of fields (see included_fields) only have the buffers of these
+  /// fields verified, since the buffers of the other fields are not read.
+  bool verify_buffer_checksums = true;
+
   /// \brief Options to control caching behavior when pre-buffering is requested
   ///
   /// The lazy property will always be reset to true to deliver the expected behavior
@@ -21,6 +21,8 @@
 #include <sstream>
 #include <string>
 
+#include "arrow/array.h"
+#include "arrow/array/builder_dict.h"
 #include "arrow/buffer.h"
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
@@ -30,6 +32,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
 #include "arrow/util/io_util.h"
 
@@ -184,6 +187,60 @@ static void DecodeStream(benchmark::State& state) {  // NOLINT non-const referen
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+static void WriteDictionaryDeltas(benchmark::State& state) {  // NOLINT non-const reference
+  // Each batch extends the dictionary of the previous one, either as a longer
+  // slice of the same values (state.range(0) == 1) or as the new dictionary of a
+  // DictionaryBuilder, which is a copy of all the values seen so far
+  constexpr int64_t kDictionaryLength = 1 << 16;
+  constexpr int64_t kBatches = 16;
+  constexpr int64_t kBatchLength = 1024;
+  const bool shared_values = state.range(0) != 0;
+
+  random::RandomArrayGenerator rand(0x4f32a908);
+  auto values = std::static_pointer_cast<StringArray>(
+      rand.String(kDictionaryLength, 8, 32, /*null_probability=*/0));
+  auto type = dictionary(int32(), utf8());
+  auto schema = ::arrow::schema({field("f0", type)});
+
+  StringDictionary32Builder builder;
+  RecordBatchVector batches;
+  for (int64_t i = 1; i <= kBatches; ++i) {
+    const int64_t dictionary_length = i * kDictionaryLength / kBatches;
+    std::shared_ptr<Array> array;
+    if (shared_values) {
+      auto indices =
+          rand.Int32(kBatchLength, 0, static_cast<int32_t>(dictionary_length - 1), 0);
+      array = std::make_shared<DictionaryArray>(type, indices,
+                                                values->Slice(0, dictionary_length));
+    } else {
+      // Append the new values, then random ones
+      for (int64_t j = (i - 1) * kDictionaryLength / kBatches; j < dictionary_length;
+           ++j) {
+        ABORT_NOT_OK(builder.Append(values->GetView(j)));
+      }
+      auto indices = internal::checked_pointer_cast<Int32Array>(
+          rand.Int32(kBatchLength, 0, static_cast<int32_t>(dictionary_length - 1), 0));
+      for (int64_t j = 0; j < kBatchLength; ++j) {
+        ABORT_NOT_OK(builder.Append(values->GetView(indices->Value(j))));
+      }
+      ABORT_NOT_OK(builder.Finish(&array));
+    }
+    batches.push_back(RecordBatch::Make(schema, array->length(), {array}));
+  }
+
+  auto options = ipc::IpcWriteOptions::Defaults();
+  options.emit_dictionary_deltas = true;
+  for (auto _ : state) {
+    io::MockOutputStream stream;
+    ASSIGN_OR_ABORT(auto writer, ipc::MakeStreamWriter(&stream, schema, options));
+    for (const auto& batch : batches) {
+      ABORT_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ABORT_NOT_OK(writer->Close());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * kBatches);
+}
+
 #ifdef ARROW_WITH_ZSTD
 #  define GENERATE_COMPRESSED_DATA_IN_MEMORY()                                      \
     constexpr int64_t kBatchSize = 1 << 20; /* 1 MB */                              \
@@ -371,5 +428,6 @@ BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime(
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(DecodeStream)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(WriteDictionaryDeltas)->ArgNames({"shared_values"})->Arg(0)->Arg(1);
 
 }  // namespace arrow
@@ -38,9 +38,11 @@
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/reader_internal.h"
+#include "arrow/ipc/row_index_internal.h"
 #include "arrow/ipc/test_common.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/testing/extension_type.h"
@@ -1337,6 +1339,25 @@ struct StreamWriterHelper {
   std::shared_ptr<RecordBatchWriter> writer_;
 };
 
+struct StreamPipelinedWriterHelper : public StreamWriterHelper {
+  Status Init(const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options) {
+    IpcWriteOptions pipelined_options = options;
+    pipelined_options.max_batches_in_flight = 3;
+    return StreamWriterHelper::Init(schema, pipelined_options);
+  }
+};
+
+struct StreamReadaheadWriterHelper : public StreamWriterHelper {
+  Status ReadBatches(const IpcReadOptions& options, RecordBatchVector* out_batches,
+                     ReadStats* out_stats = nullptr,
+                     MetadataVector* out_metadata_list = nullptr) override {
+    IpcReadOptions readahead_options = options;
+    readahead_options.stream_batch_readahead = 3;
+    return StreamWriterHelper::ReadBatches(readahead_options, out_batches, out_stats,
+                                           out_metadata_list);
+  }
+};
+
 class CopyCollectListener : public CollectListener {
  public:
   CopyCollectListener() : CollectListener() {}
@@ -1719,6 +1740,9 @@ class TestFileFormatGeneratorCoalesced
 class TestStreamFormat : public ReaderWriterMixin<StreamWriterHelper>,
                          public ::testing::TestWithParam<MakeRecordBatch*> {};
 
+class TestStreamFormatReadahead : public ReaderWriterMixin<StreamReadaheadWriterHelper>,
+                                  public ::testing::TestWithParam<MakeRecordBatch*> {};
+
 class TestStreamDecoderData : public ReaderWriterMixin<StreamDecoderDataWriterHelper>,
                               public ::testing::TestWithParam<MakeRecordBatch*> {};
 class TestStreamDecoderBuffer : public ReaderWriterMixin<StreamDecoderBufferWriterHelper>,
@@ -1891,6 +1915,8 @@ TEST_P(TestFileFormatGeneratorCoalesced, RoundTrip) {
 
 TEST_P(TestStreamFormat, RoundTrip) { TestRoundTripWithOptions(*GetParam()); }
 
+TEST_P(TestStreamFormatReadahead, RoundTrip) { TestRoundTripWithOptions(*GetParam()); }
+
 TEST_P(TestStreamDecoderData, RoundTrip) { TestRoundTripWithOptions(*GetParam()); }
 
 TEST_P(TestStreamDecoderBuffer, RoundTrip) { TestRoundTripWithOptions(*GetParam()); }
@@ -1909,6 +1935,8 @@ INSTANTIATE_TEST_SUITE_P(FileRoundTripTests, TestFileFormatGeneratorCoalesced,
                          ::testing::ValuesIn(kBatchCases));
 INSTANTIATE_TEST_SUITE_P(StreamRoundTripTests, TestStreamFormat,
                          ::testing::ValuesIn(kBatchCases));
+INSTANTIATE_TEST_SUITE_P(StreamReadaheadRoundTripTests, TestStreamFormatReadahead,
+                         ::testing::ValuesIn(kBatchCases));
 INSTANTIATE_TEST_SUITE_P(StreamDecoderDataRoundTripTests, TestStreamDecoderData,
                          ::testing::ValuesIn(kBatchCases));
 INSTANTIATE_TEST_SUITE_P(StreamDecoderBufferRoundTripTests, TestStreamDecoderBuffer,
@@ -2039,6 +2067,70 @@ TEST_F(TestIpcRoundTrip, LargeRecordBatch) {
 #endif
 
 TEST_F(TestStreamFormat, DictionaryRoundTrip) { TestDictionaryRoundtrip(); }
+
+TEST(TestStreamPipelining, CompressedBatches) {
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  auto schema = ::arrow::schema({field("f0", utf8()), field("f1", int64())});
+  RecordBatchVector batches;
+  for (int i = 0; i < 20; ++i) {
+    batches.push_back(RecordBatch::Make(
+        schema, 100, {rg.String(100, 0, 10, 0.1), rg.Int64(100, 0, 1000, 0.1)}));
+  }
+
+  for (auto codec : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+    IpcWriteOptions write_options = IpcWriteOptions::Defaults();
+    ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(codec));
+    StreamWriterHelper writer_helper;
+    ASSERT_OK(writer_helper.Init(schema, write_options));
+    for (const auto& batch : batches) {
+      ASSERT_OK(writer_helper.WriteBatch(batch));
+    }
+    ASSERT_OK(writer_helper.Finish());
+
+    for (int readahead : {1, 4, 32}) {
+      ARROW_SCOPED_TRACE("readahead = ", readahead);
+      IpcReadOptions read_options = IpcReadOptions::Defaults();
+      read_options.stream_batch_readahead = readahead;
+      RecordBatchVector out_batches;
+      ReadStats read_stats;
+      ASSERT_OK(writer_helper.ReadBatches(read_options, &out_batches, &read_stats));
+      ASSERT_EQ(out_batches.size(), batches.size());
+      for (size_t i = 0; i < batches.size(); ++i) {
+        AssertBatchesEqual(*batches[i], *out_batches[i]);
+      }
+      ASSERT_EQ(read_stats.num_record_batches, 20);
+      ASSERT_EQ(read_stats.num_messages, 21);
+    }
+
+    // Pipelined writes produce the same stream
+    for (int max_batches_in_flight : {1, 4, 32}) {
+      ARROW_SCOPED_TRACE("max_batches_in_flight = ", max_batches_in_flight);
+      write_options.max_batches_in_flight = max_batches_in_flight;
+      StreamWriterHelper pipelined_helper;
+      ASSERT_OK(pipelined_helper.Init(schema, write_options));
+      for (const auto& batch : batches) {
+        ASSERT_OK(pipelined_helper.WriteBatch(batch));
+      }
+      WriteStats write_stats;
+      ASSERT_OK(pipelined_helper.Finish(&write_stats));
+      ASSERT_EQ(write_stats.num_record_batches, 20);
+      ASSERT_EQ(write_stats.num_messages, 21);
+      AssertBufferEqual(*writer_helper.buffer_, *pipelined_helper.buffer_);
+    }
+
+    // Stop reading early
+    IpcReadOptions read_options = IpcReadOptions::Defaults();
+    read_options.stream_batch_readahead = 4;
+    auto buf_reader = std::make_shared<io::BufferReader>(writer_helper.buffer_);
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         RecordBatchStreamReader::Open(buf_reader, read_options));
+    ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+    AssertBatchesEqual(*batches[0], *batch);
+  }
+}
 TEST_F(TestFileFormat, DictionaryRoundTrip) { TestDictionaryRoundtrip(); }
 TEST_F(TestFileFormatGenerator, DictionaryRoundTrip) { TestDictionaryRoundtrip(); }
 TEST_F(TestFileFormatGeneratorCoalesced, DictionaryRoundTrip) {
@@ -2198,6 +2290,83 @@ TEST(TestRecordBatchStreamReader, MalformedInput) {
   ASSERT_RAISES(Invalid, RecordBatchStreamReader::Open(&garbage_reader));
 }
 
+TEST(TestRecordBatchStreamReader, BufferChecksums) {
+  auto batch = RecordBatchFromJSON(::arrow::schema({field("i", int32())}), "[[1], [2]]");
+  auto write_options = IpcWriteOptions::Defaults();
+  write_options.write_buffer_checksums = true;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       MakeStreamWriter(sink, batch->schema(), write_options));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto stream, sink->Finish());
+
+  auto read_all = [](const std::shared_ptr<Buffer>& stream,
+                     const IpcReadOptions& options) -> Result<RecordBatchVector> {
+    io::BufferReader buffer_reader(stream);
+    ARROW_ASSIGN_OR_RAISE(auto reader,
+                          RecordBatchStreamReader::Open(&buffer_reader, options));
+    return reader->ToRecordBatches();
+  };
+  auto read_options = IpcReadOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(auto batches, read_all(stream, read_options));
+  ASSERT_EQ(batches.size(), 1);
+  AssertBatchesEqual(*batch, *batches[0]);
+  ASSERT_OK_AND_ASSIGN(auto message_reader_input, Buffer::GetReader(stream));
+  auto message_reader = MessageReader::Open(message_reader_input.get());
+  ASSERT_OK_AND_ASSIGN(auto schema_message, message_reader->ReadNextMessage());
+  ASSERT_OK_AND_ASSIGN(auto batch_message, message_reader->ReadNextMessage());
+  ASSERT_NE(batch_message->custom_metadata(), nullptr);
+  ASSERT_TRUE(batch_message->custom_metadata()->Contains(internal::kBufferChecksumsKey));
+
+  // Corrupt the int32 values, which end the body before the end-of-stream marker
+  ASSERT_OK_AND_ASSIGN(auto corrupted, stream->CopySlice(0, stream->size()));
+  corrupted->mutable_data()[stream->size() - 16] ^= 1;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      IOError, ::testing::HasSubstr("Checksum mismatch in body buffer 1"),
+      read_all(corrupted, read_options));
+
+  // The loaded buffers are verified when reading a subset of the fields as well
+  read_options.included_fields = {0};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      IOError, ::testing::HasSubstr("Checksum mismatch in body buffer 1"),
+      read_all(corrupted, read_options));
+
+  read_options.included_fields = {};
+  read_options.verify_buffer_checksums = false;
+  ASSERT_OK_AND_ASSIGN(batches, read_all(corrupted, read_options));
+  ASSERT_EQ(batches.size(), 1);
+  ASSERT_FALSE(batch->Equals(*batches[0]));
+}
+
+TEST(TestRecordBatchFileReader, BufferChecksumsWithPreBuffering) {
+  auto batch = RecordBatchFromJSON(::arrow::schema({field("i", int32())}),
+                                   "[[123456789], [987654321]]");
+  auto write_options = IpcWriteOptions::Defaults();
+  write_options.write_buffer_checksums = true;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, batch->schema(), write_options));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto file, sink->Finish());
+
+  // Corrupt the int32 values of the body
+  const int32_t values[] = {123456789, 987654321};
+  const std::string file_str = file->ToString();
+  const size_t position = file_str.find(
+      std::string_view(reinterpret_cast<const char*>(values), sizeof(values)));
+  ASSERT_NE(position, std::string::npos);
+  ASSERT_OK_AND_ASSIGN(auto corrupted, file->CopySlice(0, file->size()));
+  corrupted->mutable_data()[position] ^= 1;
+
+  auto reader_input = std::make_shared<io::BufferReader>(corrupted);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(reader_input));
+  ASSERT_OK(reader->PreBufferMetadata({}));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      IOError, ::testing::HasSubstr("Checksum mismatch in body buffer 1"),
+      reader->ReadRecordBatch(0));
+}
+
 class EndlessCollectListener : public CollectListener {
  public:
   EndlessCollectListener() : CollectListener(), decoder_(nullptr) {}
@@ -2343,6 +2512,59 @@ class TestDictionaryReplacement : public ::testing::Test {
     }
   }
 
+  void TestDeltaDictsBetweenBatches() {
+    // With read-ahead, several batches may still be decoding when a delta
+    // dictionary is read
+    constexpr int kNumDeltas = 10;
+    constexpr int kBatchesPerDictionary = 5;
+    constexpr int kNumBatches = (kNumDeltas + 1) * kBatchesPerDictionary;
+    auto type = dictionary(int8(), utf8());
+    RecordBatchVector batches;
+    std::string values_json;
+    for (int i = 0; i <= kNumDeltas; ++i) {
+      values_json += (i == 0 ? "\"value" : ", \"value") + std::to_string(i) + "\"";
+      auto values = ArrayFromJSON(utf8(), "[" + values_json + "]");
+      for (int j = 0; j < kBatchesPerDictionary; ++j) {
+        auto indices = ArrayFromJSON(
+            int8(), "[" + std::to_string(i) + ", " + std::to_string(j % (i + 1)) + "]");
+        batches.push_back(MakeBatch(type, indices, values));
+      }
+    }
+
+    write_options_.emit_dictionary_deltas = true;
+    CheckRoundtrip(batches, /*expect_expanded_dictionary=*/WriterHelper::kIsFileFormat);
+    EXPECT_EQ(read_stats_.num_record_batches, kNumBatches);
+    EXPECT_EQ(read_stats_.num_dictionary_deltas, kNumDeltas);
+  }
+
+  void TestDeltaDictSlices() {
+    // Growing slices of a single dictionary share their leading values
+    auto type = dictionary(int8(), utf8());
+    auto values = ArrayFromJSON(utf8(), R"(["foo", "bar", "quux", "zzz"])");
+    auto batch1 =
+        MakeBatch(type, ArrayFromJSON(int8(), "[0, 1, null, 1]"), values->Slice(0, 2));
+    auto batch2 = MakeBatch(type, ArrayFromJSON(int8(), "[2, 0]"), values->Slice(0, 3));
+    auto batch3 = MakeBatch(type, ArrayFromJSON(int8(), "[3, 2, 1]"), values);
+    // Same leading buffers, but at another offset: not a delta
+    auto batch4 = MakeBatch(type, ArrayFromJSON(int8(), "[0, 1]"), values->Slice(1, 3));
+
+    write_options_.emit_dictionary_deltas = true;
+    CheckRoundtrip({batch1, batch2, batch3},
+                   /*expect_expanded_dictionary=*/WriterHelper::kIsFileFormat);
+    EXPECT_EQ(read_stats_.num_dictionary_batches, 3);
+    EXPECT_EQ(read_stats_.num_replaced_dictionaries, 0);
+    EXPECT_EQ(read_stats_.num_dictionary_deltas, 2);
+
+    if (WriterHelper::kIsFileFormat) {
+      CheckWritingFails({batch1, batch2, batch3, batch4}, 3);
+    } else {
+      CheckRoundtrip({batch1, batch2, batch3, batch4});
+      EXPECT_EQ(read_stats_.num_dictionary_batches, 4);
+      EXPECT_EQ(read_stats_.num_replaced_dictionaries, 1);
+      EXPECT_EQ(read_stats_.num_dictionary_deltas, 2);
+    }
+  }
+
   void TestSameDictValuesNested() {
     auto batches = SameValuesNestedDictBatches();
     CheckRoundtrip(batches);
@@ -2735,7 +2957,8 @@ class TestDictionaryReplacement : public ::testing::Test {
 };
 
 using DictionaryReplacementTestTypes =
-    ::testing::Types<StreamWriterHelper, StreamDecoderBufferWriterHelper,
+    ::testing::Types<StreamWriterHelper, StreamPipelinedWriterHelper,
+                     StreamReadaheadWriterHelper, StreamDecoderBufferWriterHelper,
                      FileWriterHelper>;
 
 TYPED_TEST_SUITE(TestDictionaryReplacement, DictionaryReplacementTestTypes);
@@ -2746,6 +2969,12 @@ TYPED_TEST(TestDictionaryReplacement, SameDictValues) { this->TestSameDictValues
 
 TYPED_TEST(TestDictionaryReplacement, DeltaDict) { this->TestDeltaDict(); }
 
+TYPED_TEST(TestDictionaryReplacement, DeltaDictSlices) { this->TestDeltaDictSlices(); }
+
+TYPED_TEST(TestDictionaryReplacement, DeltaDictsBetweenBatches) {
+  this->TestDeltaDictsBetweenBatches();
+}
+
 TYPED_TEST(TestDictionaryReplacement, SameDictValuesNested) {
   this->TestSameDictValuesNested();
 }
@@ -3060,6 +3289,184 @@ TEST(TestRecordBatchFileReaderIo, ReadTwoContinuousFieldsWithIoMerged) {
   GetReadRecordBatchReadRanges(64, {0, 1}, {8 + 64 * 4});
 }
 
+TEST(TestRecordBatchFileReaderIo, ReadFieldsSubsetZeroCopy) {
+  auto buffer = MakeBooleanInt32Int64File(/*num_rows=*/100, /*num_batches=*/2);
+  io::BufferReader buffer_reader(buffer);
+  ASSERT_OK_AND_ASSIGN(auto full_reader, RecordBatchFileReader::Open(&buffer_reader));
+
+  auto read_options = IpcReadOptions::Defaults();
+  read_options.included_fields = {0, 2};
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       RecordBatchFileReader::Open(&buffer_reader, read_options));
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto expected, full_reader->ReadRecordBatch(i));
+    ASSERT_OK_AND_ASSIGN(auto batch, reader->ReadRecordBatch(i));
+    ASSERT_OK(batch->ValidateFull());
+    ASSERT_EQ(batch->num_columns(), 2);
+    AssertArraysEqual(*expected->column(0), *batch->column(0));
+    AssertArraysEqual(*expected->column(2), *batch->column(1));
+    // The values are sliced out of the file buffer, not copied
+    for (const auto& column : batch->columns()) {
+      const auto& values = column->data()->buffers[1];
+      ASSERT_GE(values->address(), buffer->address());
+      ASSERT_LE(values->address() + values->size(), buffer->address() + buffer->size());
+    }
+  }
+  EXPECT_EQ(reader->stats().num_record_batches, 2);
+  EXPECT_GE(reader->stats().num_minor_page_faults, 0);
+}
+
+class TestRecordBatchFileReaderRowIndex : public ::testing::Test {
+ public:
+  void SetUp() override {
+    schema_ = ::arrow::schema({field("i", int32()), field("s", utf8()),
+                               field("d", float64())});
+    batches_ = {
+        RecordBatchFromJSON(schema_, R"([[1, "a", 0.5], [5, "b", null], [3, null, 2]])"),
+        RecordBatchFromJSON(schema_, R"([[10, "c", NaN], [null, "d", -1.25]])"),
+        RecordBatchFromJSON(schema_, R"([])"),
+        RecordBatchFromJSON(schema_, R"([[null, "e", null], [7, "f", 1e300]])"),
+    };
+  }
+
+  std::shared_ptr<Buffer> WriteFile(bool write_row_index) {
+    auto options = IpcWriteOptions::Defaults();
+    options.write_row_index = write_row_index;
+    EXPECT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+    EXPECT_OK_AND_ASSIGN(
+        auto writer, MakeFileWriter(sink, schema_, options,
+                                    key_value_metadata({"key"}, {"value"})));
+    for (const auto& batch : batches_) {
+      ARROW_EXPECT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ARROW_EXPECT_OK(writer->Close());
+    EXPECT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+    return buffer;
+  }
+
+  void CheckRowRanges(RecordBatchFileReader* reader) {
+    ASSERT_OK_AND_ASSIGN(auto row_offsets, reader->GetRowOffsets());
+    ASSERT_EQ(row_offsets, std::vector<int64_t>({0, 3, 5, 5, 7}));
+    ASSERT_OK_AND_EQ(7, reader->CountRows());
+
+    ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(schema_, batches_));
+    for (int64_t offset = 0; offset <= 7; ++offset) {
+      for (int64_t length = 0; length <= 8 - offset; ++length) {
+        ASSERT_OK_AND_ASSIGN(auto batches, reader->ReadRowRange(offset, length));
+        ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(schema_, batches));
+        AssertTablesEqual(*table->Slice(offset, length), *actual,
+                          /*same_chunk_layout=*/false);
+      }
+    }
+    ASSERT_RAISES(IndexError, reader->ReadRowRange(8, 1));
+    ASSERT_RAISES(IndexError, reader->ReadRowRange(-1, 1));
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+  RecordBatchVector batches_;
+};
+
+TEST_F(TestRecordBatchFileReaderRowIndex, Basics) {
+  io::BufferReader buffer_reader(WriteFile(/*write_row_index=*/true));
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(&buffer_reader));
+
+  auto metadata = reader->metadata();
+  ASSERT_OK_AND_EQ("value", metadata->Get("key"));
+  ASSERT_OK_AND_EQ("0,3,5,5,7", metadata->Get(internal::kRowIndexOffsetsKey));
+  ASSERT_OK_AND_EQ("1,10,,7",
+                   metadata->Get(std::string(internal::kRowIndexMinPrefix) + "0"));
+  ASSERT_OK_AND_EQ("5,10,,7",
+                   metadata->Get(std::string(internal::kRowIndexMaxPrefix) + "0"));
+  ASSERT_FALSE(metadata->Contains(std::string(internal::kRowIndexMinPrefix) + "1"));
+
+  // The row offsets are not read from the batches
+  ASSERT_OK_AND_EQ(7, reader->CountRows());
+  ASSERT_EQ(reader->stats().num_messages, 0);
+  ASSERT_NO_FATAL_FAILURE(CheckRowRanges(reader.get()));
+
+  auto greater_than = [](int64_t value) {
+    return [value](const Scalar& min, const Scalar& max) {
+      return checked_cast<const Int32Scalar&>(max).value > value;
+    };
+  };
+  ASSERT_OK_AND_ASSIGN(auto selected, reader->SelectRecordBatches(0, greater_than(5)));
+  // The empty batch has no statistics
+  ASSERT_EQ(selected, std::vector<int>({1, 2, 3}));
+  ASSERT_OK_AND_ASSIGN(selected, reader->SelectRecordBatches(0, greater_than(10)));
+  ASSERT_EQ(selected, std::vector<int>({2}));
+
+  // NaNs are ignored
+  ASSERT_OK_AND_ASSIGN(
+      selected,
+      reader->SelectRecordBatches(2, [](const Scalar& min, const Scalar& max) {
+        return checked_cast<const DoubleScalar&>(min).value < 0 &&
+               checked_cast<const DoubleScalar&>(max).value < 0;
+      }));
+  ASSERT_EQ(selected, std::vector<int>({1, 2}));
+  ASSERT_OK_AND_ASSIGN(
+      selected,
+      reader->SelectRecordBatches(2, [](const Scalar& min, const Scalar& max) {
+        return checked_cast<const DoubleScalar&>(max).value == 1e300;
+      }));
+  ASSERT_EQ(selected, std::vector<int>({2, 3}));
+
+  // No statistics for strings
+  ASSERT_OK_AND_ASSIGN(selected,
+                       reader->SelectRecordBatches(
+                           1, [](const Scalar& min, const Scalar& max) { return false; }));
+  ASSERT_EQ(selected, std::vector<int>({0, 1, 2, 3}));
+  ASSERT_RAISES(Invalid, reader->SelectRecordBatches(
+                             3, [](const Scalar& min, const Scalar& max) { return true; }));
+}
+
+TEST_F(TestRecordBatchFileReaderRowIndex, RecordBatchStatistics) {
+  io::BufferReader buffer_reader(WriteFile(/*write_row_index=*/true));
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(&buffer_reader));
+
+  ASSERT_OK_AND_ASSIGN(auto statistics, reader->GetRecordBatchStatistics(0));
+  ASSERT_EQ(statistics.size(), 4);
+  ArrayStatistics expected;
+  expected.min = int64_t{1};
+  expected.is_min_exact = true;
+  expected.max = int64_t{5};
+  expected.is_max_exact = true;
+  ASSERT_NE(statistics[0], nullptr);
+  ASSERT_EQ(*statistics[0], expected);
+  // The empty batch has no statistics
+  ASSERT_EQ(statistics[2], nullptr);
+  expected.min = expected.max = int64_t{7};
+  ASSERT_NE(statistics[3], nullptr);
+  ASSERT_EQ(*statistics[3], expected);
+
+  ASSERT_OK_AND_ASSIGN(statistics, reader->GetRecordBatchStatistics(2));
+  ASSERT_NE(statistics[1], nullptr);
+  ASSERT_EQ(statistics[1]->min, ArrayStatistics::ValueType{-1.25});
+  ASSERT_EQ(statistics[1]->max, ArrayStatistics::ValueType{-1.25});
+
+  // No statistics for strings
+  ASSERT_OK_AND_ASSIGN(statistics, reader->GetRecordBatchStatistics(1));
+  ASSERT_EQ(statistics, std::vector<std::shared_ptr<ArrayStatistics>>(4));
+  ASSERT_RAISES(Invalid, reader->GetRecordBatchStatistics(3));
+
+  io::BufferReader without_row_index(WriteFile(/*write_row_index=*/false));
+  ASSERT_OK_AND_ASSIGN(reader, RecordBatchFileReader::Open(&without_row_index));
+  ASSERT_OK_AND_ASSIGN(statistics, reader->GetRecordBatchStatistics(0));
+  ASSERT_EQ(statistics, std::vector<std::shared_ptr<ArrayStatistics>>(4));
+}
+
+TEST_F(TestRecordBatchFileReaderRowIndex, WithoutRowIndex) {
+  io::BufferReader buffer_reader(WriteFile(/*write_row_index=*/false));
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(&buffer_reader));
+  ASSERT_FALSE(reader->metadata()->Contains(internal::kRowIndexOffsetsKey));
+
+  ASSERT_NO_FATAL_FAILURE(CheckRowRanges(reader.get()));
+  ASSERT_OK_AND_ASSIGN(auto selected,
+                       reader->SelectRecordBatches(
+                           0, [](const Scalar& min, const Scalar& max) { return false; }));
+  ASSERT_EQ(selected, std::vector<int>({0, 1, 2, 3}));
+}
+
 constexpr static int kNumBatches = 10;
 // It can be difficult to know the exact size of the schema.  Instead we just make the
 // row data big enough that we can easily identify if a read is for a schema or for
@@ -3230,6 +3637,98 @@ TEST(PreBuffering, MixedAccess) {
   ASSERT_EQ(2, stats.num_record_batches);
 }
 
+TEST_F(TestRecordBatchFileReaderRowIndex, Append) {
+  ASSERT_OK_AND_ASSIGN(auto tempdir, TemporaryDir::Make("arrow-ipc-read-write-test-"));
+  ASSERT_OK_AND_ASSIGN(auto path, tempdir->path().Join("appended"));
+  auto options = IpcWriteOptions::Defaults();
+  options.write_row_index = true;
+  {
+    ASSERT_OK_AND_ASSIGN(auto sink, io::FileOutputStream::Open(path.ToString()));
+    ASSERT_OK_AND_ASSIGN(auto writer,
+                         MakeFileWriter(sink, schema_, options,
+                                        key_value_metadata({"key"}, {"value"})));
+    ASSERT_OK(writer->WriteRecordBatch(*batches_[0]));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK(sink->Close());
+  }
+  // Append to the file twice
+  for (size_t i = 1; i < batches_.size(); i += 2) {
+    ASSERT_OK_AND_ASSIGN(auto writer, MakeFileAppender(path.ToString(), options));
+    for (size_t j = i; j < std::min(i + 2, batches_.size()); ++j) {
+      ASSERT_OK(writer->WriteRecordBatch(*batches_[j]));
+    }
+    ASSERT_OK(writer->Close());
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto file, io::ReadableFile::Open(path.ToString()));
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(file));
+  ASSERT_EQ(reader->num_record_batches(), 4);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto batch, reader->ReadRecordBatch(i));
+    AssertBatchesEqual(*batches_[i], *batch);
+  }
+  // The footer metadata and row index are the same as if written at once
+  io::BufferReader buffer_reader(WriteFile(/*write_row_index=*/true));
+  ASSERT_OK_AND_ASSIGN(auto expected_reader, RecordBatchFileReader::Open(&buffer_reader));
+  ASSERT_TRUE(expected_reader->metadata()->Equals(*reader->metadata()));
+  CheckRowRanges(reader.get());
+
+  // The appended file is readable as a stream, with a single schema message
+  ASSERT_OK(file->Seek(8));
+  ASSERT_OK_AND_ASSIGN(auto stream_reader, RecordBatchStreamReader::Open(file.get()));
+  ASSERT_OK_AND_ASSIGN(auto batches, stream_reader->ToRecordBatches());
+  ASSERT_EQ(batches.size(), 4);
+}
+
+TEST(AppendFile, Errors) {
+  ASSERT_OK_AND_ASSIGN(auto tempdir, TemporaryDir::Make("arrow-ipc-read-write-test-"));
+  ASSERT_OK_AND_ASSIGN(auto readable_file, MakeFileWithDictionaries(tempdir, 5, 1));
+  ASSERT_OK_AND_ASSIGN(auto path, tempdir->path().Join("testfile"));
+  ASSERT_RAISES(NotImplemented, MakeFileAppender(path.ToString()));
+
+  ASSERT_OK_AND_ASSIGN(path, tempdir->path().Join("missing"));
+  ASSERT_RAISES(IOError, MakeFileAppender(path.ToString()));
+}
+
+TEST(FileInProgress, ReadCompleteMessages) {
+  auto schema = ::arrow::schema({field("i", int32()), field("s", utf8())});
+  RecordBatchVector batches = {
+      RecordBatchFromJSON(schema, R"([[1, "a"], [2, null]])"),
+      RecordBatchFromJSON(schema, R"([[3, "bc"]])"),
+      RecordBatchFromJSON(schema, R"([[null, "d"], [5, "e"], [6, "f"]])")};
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  // Write the batches one at a time to know where they end
+  auto options = IpcWriteOptions::Defaults();
+  options.use_threads = false;
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, schema, options));
+  std::vector<int64_t> batch_ends;
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    ASSERT_OK_AND_ASSIGN(int64_t position, sink->Tell());
+    batch_ends.push_back(position);
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // Read the file as if it was being written, up to each size
+  ASSERT_RAISES(Invalid,
+                RecordBatchStreamReader::OpenFileInProgress(
+                    std::make_shared<io::BufferReader>(SliceBuffer(buffer, 0, 12))));
+  for (int64_t size = batch_ends[0] - 1; size <= buffer->size(); ++size) {
+    auto file = std::make_shared<io::BufferReader>(SliceBuffer(buffer, 0, size));
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchStreamReader::OpenFileInProgress(file));
+    AssertSchemaEqual(*schema, *reader->schema());
+    ASSERT_OK_AND_ASSIGN(auto read_batches, reader->ToRecordBatches());
+    const auto num_complete = static_cast<size_t>(
+        std::upper_bound(batch_ends.begin(), batch_ends.end(), size) -
+        batch_ends.begin());
+    ASSERT_EQ(read_batches.size(), num_complete) << "size " << size;
+    for (size_t i = 0; i < read_batches.size(); ++i) {
+      AssertBatchesEqual(*batches[i], *read_batches[i]);
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace ipc
 }  // namespace arrow
@@ -19,10 +19,17 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <condition_variable>
+#include <cstdlib>
 #include <cstring>
+#include <deque>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -37,11 +44,14 @@
 #include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/reader_internal.h"
+#include "arrow/ipc/row_index_internal.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
@@ -51,7 +61,9 @@
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/crc32.h"
 #include "arrow/util/endian.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/parallel.h"
@@ -82,6 +94,11 @@ namespace {
 
 enum class DictionaryKind { New, Delta, Replacement };
 
+// Ranges of a zero-copy file hinted with WillNeed() are merged across holes up
+// to this size, so that the kernel reads ahead in large extents
+constexpr int64_t kWillNeedHoleSizeLimit = 64 * 1024;
+constexpr int64_t kWillNeedRangeSizeLimit = 64 * 1024 * 1024;
+
 Status InvalidMessageType(MessageType expected, MessageType actual) {
   return Status::IOError("Expected IPC message of type ", FormatMessageType(expected),
                          " but got ", FormatMessageType(actual));
@@ -144,11 +161,16 @@ class BatchDataReadRequest {
  public:
   const std::vector<io::ReadRange>& ranges_to_read() const { return ranges_to_read_; }
 
-  void RequestRange(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
+  void RequestRange(int64_t offset, int64_t length, int buffer_index,
+                    std::shared_ptr<Buffer>* out) {
     ranges_to_read_.push_back({offset, length});
+    buffer_indices_.push_back(buffer_index);
     destinations_.push_back(out);
   }
 
+  /// The index in the batch of the buffer read from each range
+  const std::vector<int>& buffer_indices() const { return buffer_indices_; }
+
   void FulfillRequest(const std::vector<std::shared_ptr<Buffer>>& buffers) {
     for (std::size_t i = 0; i < buffers.size(); i++) {
       *destinations_[i] = buffers[i];
@@ -157,6 +179,7 @@ class BatchDataReadRequest {
 
  private:
   std::vector<io::ReadRange> ranges_to_read_;
+  std::vector<int> buffer_indices_;
   std::vector<std::shared_ptr<Buffer>*> destinations_;
 };
 
@@ -182,7 +205,8 @@ class ArrayLoader {
         file_offset_(file_offset),
         max_recursion_depth_(options.max_recursion_depth) {}
 
-  Status ReadBuffer(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
+  Status ReadBuffer(int64_t offset, int64_t length, int buffer_index,
+                    std::shared_ptr<Buffer>* out) {
     if (skip_io_) {
       return Status::OK();
     }
@@ -200,7 +224,7 @@ class ArrayLoader {
     if (file_) {
       return file_->ReadAt(offset, length).Value(out);
     } else {
-      read_request_.RequestRange(offset + file_offset_, length, out);
+      read_request_.RequestRange(offset + file_offset_, length, buffer_index, out);
       return Status::OK();
     }
   }
@@ -242,10 +266,21 @@ class ArrayLoader {
     if (buffer->length() == 0) {
       // Should never return a null buffer here.
       // (zero-sized buffer allocations are cheap)
-      return AllocateBuffer(0).Value(out);
+      RETURN_NOT_OK(AllocateBuffer(0).Value(out));
     } else {
-      return ReadBuffer(buffer->offset(), buffer->length(), out);
+      RETURN_NOT_OK(ReadBuffer(buffer->offset(), buffer->length(), buffer_index, out));
+    }
+    // Buffers requested for a ReadRangeCache are verified in FulfillReadRequest()
+    if (file_ != nullptr && *out != nullptr) {
+      return VerifyBufferChecksum(buffer_index, **out);
     }
+    return Status::OK();
+  }
+
+  // Verify the buffers read from the file against these checksums, indexed like the
+  // buffers of the batch, as they are loaded
+  void set_buffer_checksums(std::vector<uint32_t> checksums) {
+    buffer_checksums_ = std::move(checksums);
   }
 
   Result<size_t> GetVariadicCount(int i) {
@@ -490,7 +525,35 @@ class ArrayLoader {
 
   BatchDataReadRequest& read_request() { return read_request_; }
 
+  // Set the requested buffers to the ones read for read_request().ranges_to_read()
+  Status FulfillReadRequest(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+    read_request_.FulfillRequest(buffers);
+    const std::vector<int>& buffer_indices = read_request_.buffer_indices();
+    for (size_t i = 0; i < buffers.size(); ++i) {
+      RETURN_NOT_OK(VerifyBufferChecksum(buffer_indices[i], *buffers[i]));
+    }
+    return Status::OK();
+  }
+
  private:
+  Status VerifyBufferChecksum(int buffer_index, const Buffer& buffer) const {
+    // Device buffers are not verified
+    if (buffer_checksums_.empty() || !buffer.is_cpu()) {
+      return Status::OK();
+    }
+    uint32_t actual = 0;
+    if (buffer.size() > 0) {
+      actual =
+          ::arrow::internal::crc32(0, buffer.data(), static_cast<size_t>(buffer.size()));
+    }
+    const uint32_t expected = buffer_checksums_[buffer_index];
+    if (expected != actual) {
+      return Status::IOError("Checksum mismatch in body buffer ", buffer_index,
+                             ": expected ", std::hex, expected, ", got ", actual);
+    }
+    return Status::OK();
+  }
+
   const flatbuf::RecordBatch* metadata_;
   const MetadataVersion metadata_version_;
   io::RandomAccessFile* file_;
@@ -500,6 +563,7 @@ class ArrayLoader {
   int field_index_ = 0;
   bool skip_io_ = false;
   int variadic_count_index_ = 0;
+  std::vector<uint32_t> buffer_checksums_;
 
   BatchDataReadRequest read_request_;
   const Field* field_ = nullptr;
@@ -583,8 +647,9 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
 Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>* inclusion_mask, const IpcReadContext& context,
-    io::RandomAccessFile* file) {
+    io::RandomAccessFile* file, std::vector<uint32_t> buffer_checksums) {
   ArrayLoader loader(metadata, context.metadata_version, context.options, file);
+  loader.set_buffer_checksums(std::move(buffer_checksums));
 
   ArrayDataVector columns(schema->num_fields());
   ArrayDataVector filtered_columns;
@@ -643,12 +708,13 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
 Result<std::shared_ptr<RecordBatch>> LoadRecordBatch(
     const flatbuf::RecordBatch* metadata, const std::shared_ptr<Schema>& schema,
     const std::vector<bool>& inclusion_mask, const IpcReadContext& context,
-    io::RandomAccessFile* file) {
+    io::RandomAccessFile* file, std::vector<uint32_t> buffer_checksums) {
   if (inclusion_mask.empty()) {
     return LoadRecordBatchSubset(metadata, schema, /*inclusion_mask=*/nullptr, context,
-                                 file);
+                                 file, std::move(buffer_checksums));
   } else {
-    return LoadRecordBatchSubset(metadata, schema, &inclusion_mask, context, file);
+    return LoadRecordBatchSubset(metadata, schema, &inclusion_mask, context, file,
+                                 std::move(buffer_checksums));
   }
 }
 
@@ -694,6 +760,57 @@ Status GetCompressionExperimental(const flatbuf::Message* message,
   return Status::OK();
 }
 
+// Parse the checksums of the body buffers of a message written with
+// IpcWriteOptions::write_buffer_checksums.  The result is empty if there are none or
+// they are not to be verified.  The buffers are verified by the ArrayLoader as they
+// are read, so that verifying doesn't read the body twice.
+Result<std::vector<uint32_t>> GetBufferChecksums(const flatbuf::RecordBatch* batch,
+                                                 const KeyValueMetadata* custom_metadata,
+                                                 const IpcReadOptions& options) {
+  std::vector<uint32_t> checksums;
+  if (!options.verify_buffer_checksums || custom_metadata == nullptr) {
+    return checksums;
+  }
+  const int index = custom_metadata->FindKey(internal::kBufferChecksumsKey);
+  if (index == -1) {
+    return checksums;
+  }
+  const std::string& value = custom_metadata->value(index);
+  std::vector<std::string_view> checksum_strs;
+  if (!value.empty()) {
+    checksum_strs = ::arrow::internal::SplitString(value, ',');
+  }
+  const auto* buffers = batch->buffers();
+  const size_t num_buffers = buffers == nullptr ? 0 : buffers->size();
+  if (checksum_strs.size() != num_buffers) {
+    return Status::IOError("Message has ", num_buffers, " body buffers but ",
+                           checksum_strs.size(), " buffer checksums");
+  }
+  checksums.reserve(num_buffers);
+  for (std::string_view checksum_str : checksum_strs) {
+    const std::string expected_str(checksum_str);
+    char* end = nullptr;
+    const auto expected = std::strtoul(expected_str.c_str(), &end, 16);
+    if (expected_str.empty() || *end != '\0') {
+      return Status::IOError("Invalid buffer checksum '", expected_str, "'");
+    }
+    checksums.push_back(static_cast<uint32_t>(expected));
+  }
+  return checksums;
+}
+
+Result<std::vector<uint32_t>> GetBufferChecksums(const flatbuf::Message* message,
+                                                 const flatbuf::RecordBatch* batch,
+                                                 const IpcReadOptions& options) {
+  if (message->custom_metadata() == nullptr) {
+    return std::vector<uint32_t>{};
+  }
+  std::shared_ptr<KeyValueMetadata> custom_metadata;
+  RETURN_NOT_OK(
+      internal::GetKeyValueMetadata(message->custom_metadata(), &custom_metadata));
+  return GetBufferChecksums(batch, custom_metadata.get(), options);
+}
+
 Status ReadContiguousPayload(io::InputStream* file, std::unique_ptr<Message>* message) {
   ARROW_ASSIGN_OR_RAISE(*message, ReadMessage(file));
   if (*message == nullptr) {
@@ -730,8 +847,12 @@ Result<RecordBatchWithMetadata> ReadRecordBatchInternal(
     RETURN_NOT_OK(
         internal::GetKeyValueMetadata(message->custom_metadata(), &custom_metadata));
   }
+  ARROW_ASSIGN_OR_RAISE(
+      std::vector<uint32_t> buffer_checksums,
+      GetBufferChecksums(batch, custom_metadata.get(), context.options));
   ARROW_ASSIGN_OR_RAISE(auto record_batch,
-                        LoadRecordBatch(batch, schema, inclusion_mask, context, file));
+                        LoadRecordBatch(batch, schema, inclusion_mask, context, file,
+                                        std::move(buffer_checksums)));
   return RecordBatchWithMetadata{record_batch, custom_metadata};
 }
 
@@ -826,6 +947,16 @@ Status ReadDictionary(const Buffer& metadata, const IpcReadContext& context,
     RETURN_NOT_OK(GetCompressionExperimental(message, &compression));
   }
 
+  std::vector<uint32_t> buffer_checksums;
+  if (message->custom_metadata() != nullptr) {
+    std::shared_ptr<KeyValueMetadata> custom_metadata;
+    RETURN_NOT_OK(
+        internal::GetKeyValueMetadata(message->custom_metadata(), &custom_metadata));
+    ARROW_ASSIGN_OR_RAISE(
+        buffer_checksums,
+        GetBufferChecksums(batch_meta, custom_metadata.get(), context.options));
+  }
+
   const int64_t id = dictionary_batch->id();
 
   // Look up the dictionary value type, which must have been added to the
@@ -835,6 +966,7 @@ Status ReadDictionary(const Buffer& metadata, const IpcReadContext& context,
   // Load the dictionary data from the dictionary batch
   ArrayLoader loader(batch_meta, internal::GetMetadataVersion(message->version()),
                      context.options, file);
+  loader.set_buffer_checksums(std::move(buffer_checksums));
   auto dict_data = std::make_shared<ArrayData>();
   const Field dummy_field("", value_type);
   RETURN_NOT_OK(loader.Load(&dummy_field, dict_data.get()));
@@ -873,6 +1005,33 @@ Status ReadDictionary(const Message& message, const IpcReadContext& context,
   return ReadDictionary(*message.metadata(), context, kind, reader.get());
 }
 
+// Convert a minimum or maximum value of the row index, which is indexed for integer
+// and floating-point fields
+ArrayStatistics::ValueType StatisticsValue(const Scalar& scalar) {
+  switch (scalar.type->id()) {
+#define STATISTICS_VALUE_CASE(TYPE_CLASS, VALUE_TYPE) \
+  case TYPE_CLASS##Type::type_id:                     \
+    return static_cast<VALUE_TYPE>(checked_cast<const TYPE_CLASS##Scalar&>(scalar).value);
+
+    STATISTICS_VALUE_CASE(Int8, int64_t)
+    STATISTICS_VALUE_CASE(Int16, int64_t)
+    STATISTICS_VALUE_CASE(Int32, int64_t)
+    STATISTICS_VALUE_CASE(Int64, int64_t)
+    STATISTICS_VALUE_CASE(UInt8, uint64_t)
+    STATISTICS_VALUE_CASE(UInt16, uint64_t)
+    STATISTICS_VALUE_CASE(UInt32, uint64_t)
+    STATISTICS_VALUE_CASE(UInt64, uint64_t)
+    STATISTICS_VALUE_CASE(Float, double)
+    STATISTICS_VALUE_CASE(Double, double)
+
+#undef STATISTICS_VALUE_CASE
+    default:
+      break;
+  }
+  DCHECK(false) << "Unexpected row index type " << *scalar.type;
+  return ArrayStatistics::ValueType{};
+}
+
 }  // namespace
 
 Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(
@@ -977,6 +1136,25 @@ class StreamDecoderInternal : public MessageDecoderListener {
 
   int num_read_initial_dictionaries() const { return num_read_initial_dictionaries_; }
 
+ protected:
+  // Decode a record batch message without counting it.  This only reads the decoder
+  // state, so several record batches may be decoded concurrently, but not while
+  // another message is being decoded.
+  Result<RecordBatchWithMetadata> DecodeRecordBatch(const Message& message,
+                                                    const IpcReadOptions& options) {
+    CHECK_HAS_BODY(message);
+    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+    IpcReadContext context(&dictionary_memo_, options, swap_endian_);
+    return ReadRecordBatchInternal(*message.metadata(), schema_, field_inclusion_mask_,
+                                   context, reader.get());
+  }
+
+  // Count a record batch message decoded without OnMessageDecoded()
+  void CountRecordBatchMessage() {
+    ++stats_.num_messages;
+    ++stats_.num_record_batches;
+  }
+
  private:
   Status OnSchemaMessageDecoded(std::unique_ptr<Message> message) {
     RETURN_NOT_OK(UnpackSchemaMessage(*message, options_, &dictionary_memo_, &schema_,
@@ -1013,13 +1191,8 @@ class StreamDecoderInternal : public MessageDecoderListener {
     if (message->type() == MessageType::DICTIONARY_BATCH) {
       return ReadDictionary(*message);
     } else {
-      CHECK_HAS_BODY(*message);
-      ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
-      IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
-      ARROW_ASSIGN_OR_RAISE(
-          auto batch_with_metadata,
-          ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
-                                  context, reader.get()));
+      ARROW_ASSIGN_OR_RAISE(auto batch_with_metadata,
+                            DecodeRecordBatch(*message, options_));
       ++stats_.num_record_batches;
       return listener_->OnRecordBatchWithMetadataDecoded(batch_with_metadata);
     }
@@ -1067,7 +1240,19 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader,
                               const IpcReadOptions& options)
       : RecordBatchStreamReader(),
         StreamDecoderInternal(std::make_shared<CollectListener>(), options),
-        message_reader_(std::move(message_reader)) {}
+        message_reader_(std::move(message_reader)),
+        readahead_(options.use_threads ? options.stream_batch_readahead : 0) {
+    // The CPU thread pool decodes several batches at once, don't make each of
+    // them wait for the buffers decompressed on the same thread pool.
+    readahead_options_.use_threads = false;
+  }
+
+  ~RecordBatchStreamReaderImpl() override {
+    // The read-ahead tasks use this reader, wait for them
+    std::unique_lock<std::mutex> lock(mutex_);
+    stopped_ = true;
+    cv_.wait(lock, [&] { return !reading_ && num_decoding_ == 0; });
+  }
 
   Status Init() {
     // Read schema
@@ -1085,31 +1270,16 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader,
   }
 
   Result<RecordBatchWithMetadata> ReadNext() override {
+    if (readahead_ > 0) {
+      return ReadNextReadahead();
+    }
     auto collect_listener = checked_cast<CollectListener*>(raw_listener());
     while (collect_listener->num_record_batches() == 0 &&
            state() != StreamDecoderInternal::State::EOS) {
       ARROW_ASSIGN_OR_RAISE(auto message, message_reader_->ReadNextMessage());
       if (!message) {  // End of stream
-        if (state() == StreamDecoderInternal::State::INITIAL_DICTIONARIES) {
-          if (num_read_initial_dictionaries() == 0) {
-            // ARROW-6006: If we fail to find any dictionaries in the
-            // stream, then it may be that the stream has a schema
-            // but no actual data. In such case we communicate that
-            // we were unable to find the dictionaries (but there was
-            // no failure otherwise), so the caller can decide what
-            // to do
-            return RecordBatchWithMetadata{nullptr, nullptr};
-          } else {
-            // ARROW-6126, the stream terminated before receiving the
-            // expected number of dictionaries
-            return Status::Invalid(
-                "IPC stream ended without reading the "
-                "expected number (",
-                num_required_initial_dictionaries(), ") of dictionaries");
-          }
-        } else {
-          return RecordBatchWithMetadata{nullptr, nullptr};
-        }
+        RETURN_NOT_OK(CheckEndOfStream());
+        return RecordBatchWithMetadata{nullptr, nullptr};
       }
       ARROW_RETURN_NOT_OK(OnMessageDecoded(std::move(message)));
     }
@@ -1120,10 +1290,164 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader,
     return StreamDecoderInternal::schema();
   }
 
-  ReadStats stats() const override { return StreamDecoderInternal::stats(); }
+  ReadStats stats() const override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return StreamDecoderInternal::stats();
+  }
 
  private:
+  Status CheckEndOfStream() const {
+    if (state() == StreamDecoderInternal::State::INITIAL_DICTIONARIES &&
+        num_read_initial_dictionaries() > 0) {
+      // ARROW-6126, the stream terminated before receiving the
+      // expected number of dictionaries
+      return Status::Invalid(
+          "IPC stream ended without reading the "
+          "expected number (",
+          num_required_initial_dictionaries(), ") of dictionaries");
+    }
+    // ARROW-6006: If we fail to find any dictionaries in the
+    // stream, then it may be that the stream has a schema
+    // but no actual data. In such case we communicate that
+    // we were unable to find the dictionaries (but there was
+    // no failure otherwise), so the caller can decide what
+    // to do
+    return Status::OK();
+  }
+
+  Result<RecordBatchWithMetadata> ReadNextReadahead() {
+    Future<RecordBatchWithMetadata> next;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      MaybeStartReading();
+      cv_.wait(lock, [&] { return !readahead_batches_.empty() || !reading_; });
+      if (readahead_batches_.empty()) {
+        RETURN_NOT_OK(read_status_);
+        return RecordBatchWithMetadata{nullptr, nullptr};
+      }
+      next = std::move(readahead_batches_.front());
+      readahead_batches_.pop_front();
+      MaybeStartReading();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto batch_with_metadata, next.result());
+    std::lock_guard<std::mutex> lock(mutex_);
+    CountRecordBatchMessage();
+    return batch_with_metadata;
+  }
+
+  // Read messages on the IO thread pool until `readahead_` batches are pending.
+  // Must be called with the mutex held.
+  void MaybeStartReading() {
+    if (reading_ || read_finished_ ||
+        static_cast<int>(readahead_batches_.size()) >= readahead_) {
+      return;
+    }
+    reading_ = true;
+    Status st = io::default_io_context().executor()->Spawn([this] { ReadMessages(); });
+    if (!st.ok()) {
+      reading_ = false;
+      read_finished_ = true;
+      read_status_ = std::move(st);
+    }
+  }
+
+  void ReadMessages() {
+    Status st = ReadMessagesUntilFull();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!st.ok()) {
+      read_finished_ = true;
+      read_status_ = std::move(st);
+    }
+    reading_ = false;
+    cv_.notify_all();
+  }
+
+  Status ReadMessagesUntilFull() {
+    while (true) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopped_ || static_cast<int>(readahead_batches_.size()) >= readahead_) {
+          return Status::OK();
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Message> message,
+                            message_reader_->ReadNextMessage());
+      if (!message) {
+        RETURN_NOT_OK(CheckEndOfStream());
+        std::lock_guard<std::mutex> lock(mutex_);
+        read_finished_ = true;
+        return Status::OK();
+      }
+      if (state() != StreamDecoderInternal::State::RECORD_BATCHES ||
+          message->type() != MessageType::RECORD_BATCH) {
+        // Dictionaries change the state used to decode record batches, so let
+        // the batches being decoded finish first.
+        WaitForDecodingBatches();
+        std::lock_guard<std::mutex> lock(mutex_);
+        RETURN_NOT_OK(OnMessageDecoded(std::move(message)));
+        dictionaries_changed_ = true;
+        continue;
+      }
+
+      Future<RecordBatchWithMetadata> batch;
+      if (dictionaries_changed_) {
+        // Concatenating delta dictionaries updates the dictionary memo, so the first
+        // batch after a dictionary message is decoded alone
+        batch = Future<RecordBatchWithMetadata>::MakeFinished(
+            DecodeRecordBatch(*message, options()));
+        dictionaries_changed_ = false;
+      } else {
+        std::shared_ptr<Message> shared_message = std::move(message);
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          ++num_decoding_;
+        }
+        auto maybe_batch = ::arrow::internal::GetCpuThreadPool()->Submit(
+            [this, shared_message] {
+              auto result = DecodeRecordBatch(*shared_message, readahead_options_);
+              std::lock_guard<std::mutex> lock(mutex_);
+              --num_decoding_;
+              cv_.notify_all();
+              return result;
+            });
+        if (!maybe_batch.ok()) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          --num_decoding_;
+          return maybe_batch.status();
+        }
+        batch = *std::move(maybe_batch);
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      readahead_batches_.push_back(std::move(batch));
+      cv_.notify_all();
+    }
+  }
+
+  // Wait for all decoding tasks, including those of batches already handed to
+  // the consumer, which may still be running
+  void WaitForDecodingBatches() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] { return num_decoding_ == 0; });
+  }
+
   std::unique_ptr<MessageReader> message_reader_;
+
+  // Read-ahead state, only used if readahead_ > 0
+  const int readahead_;
+  IpcReadOptions readahead_options_ = options();
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  // Decoded batches, in stream order
+  std::deque<Future<RecordBatchWithMetadata>> readahead_batches_;
+  // Number of batches being decoded on the CPU thread pool
+  int num_decoding_ = 0;
+  // Whether messages are being read on the IO thread pool
+  bool reading_ = false;
+  bool read_finished_ = false;
+  bool stopped_ = false;
+  Status read_status_;
+  // Only accessed by the reading task
+  bool dictionaries_changed_ = true;
 };
 
 // ----------------------------------------------------------------------
@@ -1148,6 +1472,28 @@ Result<std::shared_ptr<RecordBatchStreamReader>> RecordBatchStreamReader::Open(
   return Open(MessageReader::Open(stream), options);
 }
 
+Result<std::shared_ptr<RecordBatchStreamReader>>
+RecordBatchStreamReader::OpenFileInProgress(
+    const std::shared_ptr<io::RandomAccessFile>& file, const IpcReadOptions& options) {
+  const int64_t magic_size = static_cast<int64_t>(strlen(kArrowMagicBytes));
+  ARROW_ASSIGN_OR_RAISE(int64_t size, file->GetSize());
+  ARROW_ASSIGN_OR_RAISE(auto magic, file->ReadAt(0, magic_size));
+  if (magic->size() < magic_size ||
+      memcmp(magic->data(), kArrowMagicBytes, magic_size) != 0) {
+    return Status::Invalid("Not an Arrow file");
+  }
+  // The messages follow the magic bytes, padded to 8 bytes
+  const int64_t start = bit_util::RoundUpToMultipleOf8(magic_size);
+  ARROW_ASSIGN_OR_RAISE(int64_t end,
+                        internal::ScanCompleteMessages(file.get(), start, size));
+  if (end == start) {
+    return Status::Invalid("IPC file has no complete schema message yet");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto stream,
+                        io::RandomAccessFile::GetStream(file, start, end - start));
+  return Open(std::move(stream), options);
+}
+
 // ----------------------------------------------------------------------
 // Reader implementation
 
@@ -1310,6 +1656,20 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
 
+    const auto faults_before = ::arrow::internal::GetThreadPageFaults();
+    auto result = DoReadRecordBatch(i);
+    const auto faults_after = ::arrow::internal::GetThreadPageFaults();
+    stats_.num_minor_page_faults.fetch_add(faults_after.minor - faults_before.minor,
+                                           std::memory_order_relaxed);
+    stats_.num_major_page_faults.fetch_add(faults_after.major - faults_before.major,
+                                           std::memory_order_relaxed);
+    if (result.ok()) {
+      RETURN_NOT_OK(AttachRowIndexStatistics(i, *result->batch));
+    }
+    return result;
+  }
+
+  Result<RecordBatchWithMetadata> DoReadRecordBatch(int i) {
     auto cached_metadata = cached_metadata_.find(i);
     if (cached_metadata != cached_metadata_.end()) {
       auto result = ReadCachedRecordBatch(i, cached_metadata->second).result();
@@ -1326,6 +1686,10 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
 
     RETURN_NOT_OK(WaitForDictionaryReadFinished());
 
+    if (!field_inclusion_mask_.empty() && file_->supports_zero_copy()) {
+      return ReadRecordBatchSubsetZeroCopy(i);
+    }
+
     FieldsLoaderFunction fields_loader = {};
     if (!field_inclusion_mask_.empty()) {
       auto& schema = schema_;
@@ -1351,23 +1715,180 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return batch_with_metadata;
   }
 
+  // Slice the buffers of the included fields out of a zero-copy file, rather than
+  // copying them into a body buffer.  Only the pages holding these fields are
+  // paged in (e.g. for a memory-mapped file), with a hint ahead of time.
+  Result<RecordBatchWithMetadata> ReadRecordBatchSubsetZeroCopy(int i) {
+    FileBlock block = GetRecordBatchBlock(i);
+    ARROW_ASSIGN_OR_RAISE(auto message_obj, ReadMessageMetadataFromBlock(block));
+    ARROW_ASSIGN_OR_RAISE(auto message, GetFlatbufMessage(message_obj));
+    ARROW_ASSIGN_OR_RAISE(auto batch, GetBatchFromMessage(message));
+    ARROW_ASSIGN_OR_RAISE(auto context, GetIpcReadContext(message, batch));
+
+    // Like the copying path, only merge adjacent buffers into one read
+    io::CacheOptions cache_options = io::CacheOptions::LazyDefaults();
+    cache_options.hole_size_limit = 0;
+    cache_options.range_size_limit = std::numeric_limits<int64_t>::max();
+    CachedRecordBatchReadContext read_context(
+        schema_, batch, std::move(context), file_, owned_file_,
+        block.offset + static_cast<int64_t>(block.metadata_length), cache_options);
+    ARROW_ASSIGN_OR_RAISE(auto buffer_checksums,
+                          GetBufferChecksums(message, batch, options_));
+    read_context.loader.set_buffer_checksums(std::move(buffer_checksums));
+    RETURN_NOT_OK(read_context.CalculateLoadRequest());
+
+    // Page in the fields in large extents, rather than one page per fault
+    ARROW_ASSIGN_OR_RAISE(
+        auto extents, io::internal::CoalesceReadRanges(
+                          read_context.loader.read_request().ranges_to_read(),
+                          kWillNeedHoleSizeLimit, kWillNeedRangeSizeLimit));
+    RETURN_NOT_OK(file_->WillNeed(extents));
+
+    RETURN_NOT_OK(read_context.ReadAsync().status());
+    ARROW_ASSIGN_OR_RAISE(auto record_batch, read_context.CreateRecordBatch());
+    stats_.num_record_batches.fetch_add(1, std::memory_order_relaxed);
+
+    std::shared_ptr<KeyValueMetadata> custom_metadata;
+    if (message->custom_metadata() != nullptr) {
+      RETURN_NOT_OK(
+          internal::GetKeyValueMetadata(message->custom_metadata(), &custom_metadata));
+    }
+    return RecordBatchWithMetadata{std::move(record_batch), std::move(custom_metadata)};
+  }
+
   Result<int64_t> CountRows() override {
-    int64_t total = 0;
+    ARROW_ASSIGN_OR_RAISE(auto row_offsets, GetRowOffsets());
+    return row_offsets.back();
+  }
+
+  Result<std::vector<int64_t>> GetRowOffsets() override {
+    ARROW_ASSIGN_OR_RAISE(const internal::RowIndex* row_index, GetRowIndex());
+    if (row_index != nullptr) {
+      return row_index->row_offsets;
+    }
+    std::vector<int64_t> row_offsets{0};
     for (int i = 0; i < num_record_batches(); i++) {
-      ARROW_ASSIGN_OR_RAISE(auto outer_message,
-                            ReadMessageFromBlock(GetRecordBatchBlock(i)));
-      auto metadata = outer_message->metadata();
-      const flatbuf::Message* message = nullptr;
-      RETURN_NOT_OK(
-          internal::VerifyMessage(metadata->data(), metadata->size(), &message));
-      auto batch = message->header_as_RecordBatch();
-      if (batch == nullptr) {
-        return Status::IOError(
-            "Header-type of flatbuffer-encoded Message is not RecordBatch.");
+      ARROW_ASSIGN_OR_RAISE(auto message_obj,
+                            ReadMessageMetadataFromBlock(GetRecordBatchBlock(i)));
+      ARROW_ASSIGN_OR_RAISE(auto message, GetFlatbufMessage(message_obj));
+      ARROW_ASSIGN_OR_RAISE(auto batch, GetBatchFromMessage(message));
+      row_offsets.push_back(row_offsets.back() + batch->length());
+    }
+    return row_offsets;
+  }
+
+  Result<std::vector<int>> SelectRecordBatches(
+      int field_index,
+      const std::function<bool(const Scalar& min, const Scalar& max)>& predicate)
+      override {
+    if (field_index < 0 || field_index >= schema_->num_fields()) {
+      return Status::Invalid("Field index ", field_index, " out of bounds");
+    }
+    ARROW_ASSIGN_OR_RAISE(const internal::RowIndex* row_index, GetRowIndex());
+    const bool has_statistics =
+        row_index != nullptr && !row_index->min_values[field_index].empty();
+
+    std::vector<int> selected;
+    for (int i = 0; i < num_record_batches(); ++i) {
+      if (has_statistics) {
+        const auto& min = row_index->min_values[field_index][i];
+        const auto& max = row_index->max_values[field_index][i];
+        if (min != nullptr && max != nullptr && !predicate(*min, *max)) {
+          continue;
+        }
       }
-      total += batch->length();
+      selected.push_back(i);
     }
-    return total;
+    return selected;
+  }
+
+  Result<std::vector<std::shared_ptr<ArrayStatistics>>> GetRecordBatchStatistics(
+      int field_index) override {
+    if (field_index < 0 || field_index >= schema_->num_fields()) {
+      return Status::Invalid("Field index ", field_index, " out of bounds");
+    }
+    ARROW_ASSIGN_OR_RAISE(const internal::RowIndex* row_index, GetRowIndex());
+    std::vector<std::shared_ptr<ArrayStatistics>> statistics(num_record_batches());
+    if (row_index == nullptr || row_index->min_values[field_index].empty()) {
+      return statistics;
+    }
+    for (int i = 0; i < num_record_batches(); ++i) {
+      statistics[i] = RowIndexStatistics(*row_index, field_index, i);
+    }
+    return statistics;
+  }
+
+  // The layout of the file, for internal::ReadIpcFileLayout()
+  Result<internal::IpcFileLayout> GetLayout() {
+    internal::IpcFileLayout layout;
+    layout.schema = schema_;
+    layout.metadata = metadata_;
+    layout.messages_end = 0;
+    auto add_block = [&](const FileBlock& block, std::vector<FileBlock>* blocks) {
+      blocks->push_back(block);
+      layout.messages_end = std::max(
+          layout.messages_end, block.offset + block.metadata_length + block.body_length);
+    };
+    for (int i = 0; i < num_dictionaries(); ++i) {
+      add_block(GetDictionaryBlock(i), &layout.dictionaries);
+    }
+    for (int i = 0; i < num_record_batches(); ++i) {
+      add_block(GetRecordBatchBlock(i), &layout.record_batches);
+    }
+    if (layout.messages_end == 0) {
+      // Only the schema message follows the padded magic bytes
+      const int64_t start = bit_util::RoundUpToMultipleOf8(strlen(kArrowMagicBytes));
+      ARROW_ASSIGN_OR_RAISE(layout.messages_end,
+                            internal::ScanCompleteMessages(file_, start, footer_offset_));
+    }
+    return layout;
+  }
+
+  // The statistics of a field in a record batch from the row index, or null
+  static std::shared_ptr<ArrayStatistics> RowIndexStatistics(
+      const internal::RowIndex& row_index, int field_index, int i) {
+    if (row_index.min_values[field_index].empty()) {
+      return nullptr;
+    }
+    const auto& min = row_index.min_values[field_index][i];
+    const auto& max = row_index.max_values[field_index][i];
+    if (min == nullptr || max == nullptr) {
+      return nullptr;
+    }
+    auto statistics = std::make_shared<ArrayStatistics>();
+    statistics->min = StatisticsValue(*min);
+    statistics->is_min_exact = true;
+    statistics->max = StatisticsValue(*max);
+    statistics->is_max_exact = true;
+    return statistics;
+  }
+
+  // Attach the statistics of the row index, if any, to the columns of the i-th
+  // record batch which have none, along with their null counts
+  Status AttachRowIndexStatistics(int i, const RecordBatch& batch) {
+    ARROW_ASSIGN_OR_RAISE(const internal::RowIndex* row_index, GetRowIndex());
+    if (row_index == nullptr) {
+      return Status::OK();
+    }
+    int column_index = 0;
+    for (int field_index = 0; field_index < schema_->num_fields(); ++field_index) {
+      if (!field_inclusion_mask_.empty() && !field_inclusion_mask_[field_index]) {
+        continue;
+      }
+      if (column_index >= batch.num_columns()) {
+        break;
+      }
+      const auto& data = batch.column_data(column_index++);
+      if (data->statistics) {
+        continue;
+      }
+      auto statistics = RowIndexStatistics(*row_index, field_index, i);
+      if (statistics && data->null_count != kUnknownNullCount) {
+        statistics->null_count = data->null_count.load();
+      }
+      data->statistics = std::move(statistics);
+    }
+    return Status::OK();
   }
 
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
@@ -1509,6 +2030,8 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     std::atomic<int64_t> num_dictionary_batches{0};
     std::atomic<int64_t> num_dictionary_deltas{0};
     std::atomic<int64_t> num_replaced_dictionaries{0};
+    std::atomic<int64_t> num_minor_page_faults{0};
+    std::atomic<int64_t> num_major_page_faults{0};
 
     /// \brief Capture a copy of the current counters
     ReadStats poll() const {
@@ -1520,6 +2043,8 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       stats.num_dictionary_deltas = num_dictionary_deltas.load(std::memory_order_relaxed);
       stats.num_replaced_dictionaries =
           num_replaced_dictionaries.load(std::memory_order_relaxed);
+      stats.num_minor_page_faults = num_minor_page_faults.load(std::memory_order_relaxed);
+      stats.num_major_page_faults = num_major_page_faults.load(std::memory_order_relaxed);
       return stats;
     }
   };
@@ -1532,6 +2057,29 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return FileBlockFromFlatbuffer(footer_->dictionaries()->Get(i));
   }
 
+  // Read a message without its body
+  Result<std::shared_ptr<Message>> ReadMessageMetadataFromBlock(const FileBlock& block) {
+    RETURN_NOT_OK(CheckAligned(block));
+    ARROW_ASSIGN_OR_RAISE(auto metadata,
+                          file_->ReadAt(block.offset, block.metadata_length));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Message> message,
+                          ReadMessage(std::move(metadata), /*body=*/nullptr));
+    stats_.num_messages.fetch_add(1, std::memory_order_relaxed);
+    return message;
+  }
+
+  // The row index from the footer metadata, or null if the file has none
+  Result<const internal::RowIndex*> GetRowIndex() {
+    if (!row_index_read_) {
+      if (metadata_ != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(row_index_, internal::RowIndex::Read(
+                                              *metadata_, *schema_, num_record_batches()));
+      }
+      row_index_read_ = true;
+    }
+    return row_index_.has_value() ? &*row_index_ : nullptr;
+  }
+
   Result<std::unique_ptr<Message>> ReadMessageFromBlock(
       const FileBlock& block, const FieldsLoaderFunction& fields_loader = {}) {
     ARROW_ASSIGN_OR_RAISE(auto message,
@@ -1660,14 +2208,16 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
                                  const flatbuf::RecordBatch* batch,
                                  IpcReadContext context, io::RandomAccessFile* file,
                                  std::shared_ptr<io::RandomAccessFile> owned_file,
-                                 int64_t block_data_offset)
+                                 int64_t block_data_offset,
+                                 io::CacheOptions cache_options =
+                                     io::CacheOptions::LazyDefaults())
         : schema(std::move(sch)),
           context(std::move(context)),
           file(file),
           owned_file(std::move(owned_file)),
           loader(batch, context.metadata_version, context.options, block_data_offset),
           columns(schema->num_fields()),
-          cache(file, file->io_context(), io::CacheOptions::LazyDefaults()),
+          cache(file, file->io_context(), cache_options),
           length(batch->length()) {}
 
     Status CalculateLoadRequest() {
@@ -1714,7 +2264,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
         ARROW_ASSIGN_OR_RAISE(auto buffer, cache.Read(range_to_read));
         buffers.push_back(std::move(buffer));
       }
-      loader.read_request().FulfillRequest(buffers);
+      RETURN_NOT_OK(loader.FulfillReadRequest(buffers));
 
       // Dictionary resolution needs to happen on the unfiltered columns,
       // because fields are mapped structurally (by path in the original schema).
@@ -1772,6 +2322,9 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
           auto read_context = std::make_shared<CachedRecordBatchReadContext>(
               schema_, batch, std::move(context), file_, owned_file_,
               block.offset + static_cast<int64_t>(block.metadata_length));
+          ARROW_ASSIGN_OR_RAISE(auto buffer_checksums,
+                                GetBufferChecksums(message, batch, options_));
+          read_context->loader.set_buffer_checksums(std::move(buffer_checksums));
           RETURN_NOT_OK(read_context->CalculateLoadRequest());
           return read_context->ReadAsync().Then(
               [read_context] { return read_context->CreateRecordBatch(); });
@@ -1862,6 +2415,9 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   bool read_dictionaries_ = false;
   DictionaryMemo dictionary_memo_;
 
+  bool row_index_read_ = false;
+  std::optional<internal::RowIndex> row_index_;
+
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
   // Schema with deselected fields dropped
@@ -1941,6 +2497,51 @@ Result<RecordBatchVector> RecordBatchFileReader::ToRecordBatches() {
   return batches;
 }
 
+Result<std::vector<int64_t>> RecordBatchFileReader::GetRowOffsets() {
+  return Status::NotImplemented("GetRowOffsets is not supported by this reader");
+}
+
+Result<std::vector<int>> RecordBatchFileReader::SelectRecordBatches(
+    int field_index,
+    const std::function<bool(const Scalar& min, const Scalar& max)>& predicate) {
+  return Status::NotImplemented("SelectRecordBatches is not supported by this reader");
+}
+
+Result<std::vector<std::shared_ptr<ArrayStatistics>>>
+RecordBatchFileReader::GetRecordBatchStatistics(int field_index) {
+  return Status::NotImplemented(
+      "GetRecordBatchStatistics is not supported by this reader");
+}
+
+Result<RecordBatchVector> RecordBatchFileReader::ReadRowRange(int64_t offset,
+                                                             int64_t length) {
+  ARROW_ASSIGN_OR_RAISE(auto row_offsets, GetRowOffsets());
+  const int64_t num_rows = row_offsets.back();
+  if (offset < 0 || length < 0 || offset > num_rows) {
+    return Status::IndexError("Row range (offset=", offset, ", length=", length,
+                              ") out of bounds for file with ", num_rows, " rows");
+  }
+  const int64_t end = offset + std::min(length, num_rows - offset);
+
+  RecordBatchVector batches;
+  // The last record batch starting at or before the offset
+  int i = static_cast<int>(
+      std::upper_bound(row_offsets.begin(), row_offsets.end(), offset) -
+      row_offsets.begin() - 1);
+  for (; i < num_record_batches() && row_offsets[i] < end; ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto batch, ReadRecordBatch(i));
+    if (batch->num_rows() != row_offsets[i + 1] - row_offsets[i]) {
+      return Status::Invalid("Record batch ", i, " has ", batch->num_rows(),
+                             " rows, but the row index has ",
+                             row_offsets[i + 1] - row_offsets[i]);
+    }
+    const int64_t batch_offset = std::max(offset, row_offsets[i]) - row_offsets[i];
+    const int64_t batch_end = std::min(end, row_offsets[i + 1]) - row_offsets[i];
+    batches.push_back(batch->Slice(batch_offset, batch_end - batch_offset));
+  }
+  return batches;
+}
+
 Result<std::shared_ptr<Table>> RecordBatchFileReader::ToTable() {
   ARROW_ASSIGN_OR_RAISE(auto batches, ToRecordBatches());
   return Table::FromRecordBatches(schema(), std::move(batches));
@@ -2716,6 +3317,49 @@ const std::vector<io::ReadRange>& IoRecordedRandomAccessFile::GetReadRanges() co
   return read_ranges_;
 }
 
+Result<IpcFileLayout> ReadIpcFileLayout(io::RandomAccessFile* file) {
+  ARROW_ASSIGN_OR_RAISE(int64_t footer_offset, file->GetSize());
+  auto reader = std::make_shared<RecordBatchFileReaderImpl>();
+  RETURN_NOT_OK(reader->Open(file, footer_offset, IpcReadOptions::Defaults()));
+  return reader->GetLayout();
+}
+
+Result<int64_t> ScanCompleteMessages(io::RandomAccessFile* file, int64_t offset,
+                                     int64_t size) {
+  while (offset + static_cast<int64_t>(sizeof(int32_t)) <= size) {
+    int32_t prefix[2] = {0, 0};
+    ARROW_ASSIGN_OR_RAISE(
+        int64_t bytes_read,
+        file->ReadAt(offset, std::min<int64_t>(sizeof(prefix), size - offset), prefix));
+    // Messages are prefixed with a continuation token, except in the legacy format
+    int64_t prefix_length = sizeof(int32_t);
+    int32_t metadata_length = bit_util::FromLittleEndian(prefix[0]);
+    if (metadata_length == kIpcContinuationToken) {
+      if (bytes_read < static_cast<int64_t>(sizeof(prefix))) break;
+      prefix_length = sizeof(prefix);
+      metadata_length = bit_util::FromLittleEndian(prefix[1]);
+    }
+    if (metadata_length == 0) break;  // End-of-stream marker
+    if (metadata_length < 0) {
+      return Status::Invalid("Invalid IPC message metadata length: ", metadata_length);
+    }
+    if (offset + prefix_length + metadata_length > size) break;
+
+    ARROW_ASSIGN_OR_RAISE(auto metadata,
+                          file->ReadAt(offset + prefix_length, metadata_length));
+    const flatbuf::Message* message = nullptr;
+    RETURN_NOT_OK(VerifyMessage(metadata->data(), metadata->size(), &message));
+    if (message->bodyLength() < 0) {
+      return Status::Invalid("Invalid IPC message body length: ", message->bodyLength());
+    }
+    const int64_t message_end =
+        offset + prefix_length + metadata_length + message->bodyLength();
+    if (message_end > size) break;
+    offset = message_end;
+  }
+  return offset;
+}
+
 }  // namespace internal
 }  // namespace ipc
 }  // namespace arrow
@@ -21,10 +21,12 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/statistics.h"
 #include "arrow/io/caching.h"
 #include "arrow/io/type_fwd.h"
 #include "arrow/ipc/message.h"
@@ -59,6 +61,15 @@ struct ReadStats {
   /// Number of replaced dictionaries (i.e. where a dictionary batch replaces
   /// an existing dictionary with an unrelated new dictionary).
   int64_t num_replaced_dictionaries = 0;
+
+  /// Number of page faults taken while reading record batches.
+  ///
+  /// Only collected by RecordBatchFileReader::ReadRecordBatch on Linux, for
+  /// the calling thread.  Major faults needed disk IO, e.g. to read a memory-mapped
+  /// file that wasn't in the page cache.  Note that with zero-copy reads, most
+  /// of the data is only faulted in later, when the batches are accessed.
+  int64_t num_minor_page_faults = 0;
+  int64_t num_major_page_faults = 0;
 };
 
 /// \brief Synchronous batch stream reader that reads from io::InputStream
@@ -96,6 +107,20 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
       const std::shared_ptr<io::InputStream>& stream,
       const IpcReadOptions& options = IpcReadOptions::Defaults());
 
+  /// \brief Read an IPC file which may still be being written
+  ///
+  /// The footer of the file isn't needed: the message headers are scanned
+  /// forward from the start of the file, and the complete messages are read as
+  /// an IPC stream. Reading stops before the footer, the end of the file or an
+  /// incomplete message, whichever comes first.
+  ///
+  /// \param[in] file the IPC file, whose current size is read once
+  /// \param[in] options any IPC reading options (optional)
+  /// \return the created batch reader
+  static Result<std::shared_ptr<RecordBatchStreamReader>> OpenFileInProgress(
+      const std::shared_ptr<io::RandomAccessFile>& file,
+      const IpcReadOptions& options = IpcReadOptions::Defaults());
+
   /// \brief Return current read statistics
   virtual ReadStats stats() const = 0;
 };
@@ -203,6 +228,59 @@ class ARROW_EXPORT RecordBatchFileReader
   /// \brief Computes the total number of rows in the file.
   virtual Result<int64_t> CountRows() = 0;
 
+  /// \brief Return the row offset of each record batch, followed by the total
+  /// number of rows in the file
+  ///
+  /// The offsets are taken from the row index if the file has one (see
+  /// IpcWriteOptions::write_row_index), otherwise they are computed from the
+  /// metadata of each record batch.  The default implementation returns
+  /// NotImplemented.
+  virtual Result<std::vector<int64_t>> GetRowOffsets();
+
+  /// \brief Select the record batches which may hold values of a field matching
+  /// a predicate
+  ///
+  /// The predicate is called with the minimum and maximum non-null values of the
+  /// field in each record batch, as stored in the row index, and should return
+  /// false if no value in that range can match.  Record batches without
+  /// statistics for the field are always selected, which includes all record
+  /// batches of files without a row index.
+  ///
+  /// \param[in] field_index the index of the field in the schema of the file,
+  ///            before any projection by IpcReadOptions::included_fields
+  /// \param[in] predicate the predicate on the minimum and maximum values
+  /// \return the indices of the selected record batches
+  ///
+  /// The default implementation returns NotImplemented.
+  virtual Result<std::vector<int>> SelectRecordBatches(
+      int field_index,
+      const std::function<bool(const Scalar& min, const Scalar& max)>& predicate);
+
+  /// \brief Return the statistics of a field in each record batch
+  ///
+  /// The minimum and maximum non-null values are taken from the row index (see
+  /// IpcWriteOptions::write_row_index), which doesn't record null counts.  Null
+  /// pointers are returned for record batches without statistics for the field,
+  /// which includes all record batches of files without a row index.
+  ///
+  /// \param[in] field_index the index of the field in the schema of the file,
+  ///            before any projection by IpcReadOptions::included_fields
+  /// \return the statistics of each record batch
+  ///
+  /// The default implementation returns NotImplemented.
+  virtual Result<std::vector<std::shared_ptr<ArrayStatistics>>> GetRecordBatchStatistics(
+      int field_index);
+
+  /// \brief Read a range of rows from the file
+  ///
+  /// Only the record batches holding the rows are read, and are sliced to the
+  /// range.
+  ///
+  /// \param[in] offset the index of the first row to read
+  /// \param[in] length the number of rows to read, truncated to the end of the file
+  /// \return the sliced record batches
+  Result<RecordBatchVector> ReadRowRange(int64_t offset, int64_t length);
+
   /// \brief Begin loading metadata for the desired batches into memory.
   ///
   /// This method will also begin loading all dictionaries messages into memory.
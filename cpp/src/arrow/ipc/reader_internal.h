@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "arrow/io/type_fwd.h"
+#include "arrow/ipc/metadata_internal.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
 
@@ -79,6 +80,29 @@ class ARROW_EXPORT IoRecordedRandomAccessFile : public io::RandomAccessFile {
   io::IOContext io_context_;
 };
 
+/// \brief The layout of an IPC file, as listed in its footer
+struct IpcFileLayout {
+  std::shared_ptr<Schema> schema;
+  std::shared_ptr<const KeyValueMetadata> metadata;
+  std::vector<FileBlock> dictionaries;
+  std::vector<FileBlock> record_batches;
+  /// The offset after the last message, where the end-of-stream marker and the
+  /// footer start
+  int64_t messages_end;
+};
+
+/// \brief Read the layout of a complete IPC file from its footer
+ARROW_EXPORT
+Result<IpcFileLayout> ReadIpcFileLayout(io::RandomAccessFile* file);
+
+/// \brief Return the offset after the last complete message starting at `offset`
+///
+/// Message headers are scanned forward, stopping at an end-of-stream marker or at
+/// a message which doesn't fit before `size` (e.g. being written).
+ARROW_EXPORT
+Result<int64_t> ScanCompleteMessages(io::RandomAccessFile* file, int64_t offset,
+                                     int64_t size);
+
 }  // namespace internal
 }  // namespace ipc
 }  // namespace arrow
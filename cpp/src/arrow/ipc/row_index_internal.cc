@@ -0,0 +1,276 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/row_index_internal.h"
+
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "arrow/array/data.h"
+#include "arrow/array/statistics.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/key_value_metadata.h"
+#include "arrow/util/string.h"
+#include "arrow/util/value_parsing.h"
+
+namespace arrow {
+
+using internal::JoinStrings;
+using internal::SplitString;
+
+namespace ipc {
+namespace internal {
+
+namespace {
+
+bool IsIndexedType(const DataType& type) {
+  return is_integer(type.id()) || type.id() == Type::FLOAT || type.id() == Type::DOUBLE;
+}
+
+template <typename ArrowType>
+std::string FormatValue(typename ArrowType::c_type value) {
+  ::arrow::internal::StringFormatter<ArrowType> formatter;
+  return formatter(value, [](std::string_view v) { return std::string(v); });
+}
+
+template <typename ArrowType>
+void FormatMinMax(const ArrayStatistics& statistics, std::string* min, std::string* max) {
+  using CType = typename ArrowType::c_type;
+  using ValueType =
+      std::conditional_t<std::is_floating_point_v<CType>, double,
+                         std::conditional_t<std::is_signed_v<CType>, int64_t, uint64_t>>;
+  if (statistics.min.has_value() && statistics.max.has_value() &&
+      std::holds_alternative<ValueType>(*statistics.min) &&
+      std::holds_alternative<ValueType>(*statistics.max)) {
+    *min = FormatValue<ArrowType>(
+        static_cast<CType>(std::get<ValueType>(*statistics.min)));
+    *max = FormatValue<ArrowType>(
+        static_cast<CType>(std::get<ValueType>(*statistics.max)));
+  }
+}
+
+bool HasExactMinMax(const ArrayStatistics* statistics) {
+  return statistics != nullptr && statistics->is_min_exact && statistics->is_max_exact;
+}
+
+// Use the exact statistics attached to the data if any, rather than scanning it
+void ComputeMinMax(const ArrayData& data, std::string* min, std::string* max) {
+  std::shared_ptr<ArrayStatistics> statistics = data.statistics;
+  if (!HasExactMinMax(statistics.get())) {
+    statistics = ComputeArrayStatistics(data);
+  }
+  switch (data.type->id()) {
+#define MIN_MAX_CASE(TYPE_CLASS)  \
+  case TYPE_CLASS##Type::type_id: \
+    return FormatMinMax<TYPE_CLASS##Type>(*statistics, min, max);
+
+    MIN_MAX_CASE(Int8)
+    MIN_MAX_CASE(Int16)
+    MIN_MAX_CASE(Int32)
+    MIN_MAX_CASE(Int64)
+    MIN_MAX_CASE(UInt8)
+    MIN_MAX_CASE(UInt16)
+    MIN_MAX_CASE(UInt32)
+    MIN_MAX_CASE(UInt64)
+    MIN_MAX_CASE(Float)
+    MIN_MAX_CASE(Double)
+
+#undef MIN_MAX_CASE
+    default:
+      break;
+  }
+}
+
+Status InvalidRowIndex(const std::string& key) {
+  return Status::Invalid("Invalid row index in IPC file footer: '", key, "'");
+}
+
+Result<std::vector<std::shared_ptr<Scalar>>> ReadFieldValues(
+    const KeyValueMetadata& metadata, const std::string& key,
+    const std::shared_ptr<DataType>& type, int num_record_batches) {
+  std::vector<std::shared_ptr<Scalar>> scalars;
+  const int index = metadata.FindKey(key);
+  if (index < 0 || num_record_batches == 0) {
+    return scalars;
+  }
+  const auto values = SplitString(metadata.value(index), ',');
+  if (static_cast<int64_t>(values.size()) != num_record_batches) {
+    return InvalidRowIndex(key);
+  }
+  scalars.resize(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (!values[i].empty()) {
+      ARROW_ASSIGN_OR_RAISE(scalars[i], Scalar::Parse(type, values[i]));
+    }
+  }
+  return scalars;
+}
+
+// The comma-separated values of a key as formatted, or empty values if it's missing
+std::vector<std::string> ReadFormattedValues(const KeyValueMetadata& metadata,
+                                             const std::string& key,
+                                             int num_record_batches) {
+  const int index = metadata.FindKey(key);
+  if (index < 0) {
+    return std::vector<std::string>(num_record_batches);
+  }
+  std::vector<std::string> values;
+  for (const auto& value : SplitString(metadata.value(index), ',')) {
+    values.emplace_back(value);
+  }
+  return values;
+}
+
+}  // namespace
+
+RowIndexBuilder::RowIndexBuilder(const Schema& schema) : row_offsets_{0} {
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    if (IsIndexedType(*schema.field(i)->type())) {
+      indexed_fields_.push_back(i);
+    }
+  }
+  min_values_.resize(indexed_fields_.size());
+  max_values_.resize(indexed_fields_.size());
+}
+
+Result<std::shared_ptr<RowIndexBuilder>> RowIndexBuilder::Resume(
+    const Schema& schema, const KeyValueMetadata& metadata, int num_record_batches) {
+  auto builder = std::make_shared<RowIndexBuilder>(schema);
+  if (num_record_batches == 0) {
+    return builder;
+  }
+  // Validate the existing row index
+  ARROW_ASSIGN_OR_RAISE(auto row_index,
+                        RowIndex::Read(metadata, schema, num_record_batches));
+  if (!row_index.has_value()) {
+    return nullptr;
+  }
+  builder->row_offsets_ = std::move(row_index->row_offsets);
+  for (size_t i = 0; i < builder->indexed_fields_.size(); ++i) {
+    const std::string field_index = std::to_string(builder->indexed_fields_[i]);
+    builder->min_values_[i] = ReadFormattedValues(
+        metadata, kRowIndexMinPrefix + field_index, num_record_batches);
+    builder->max_values_[i] = ReadFormattedValues(
+        metadata, kRowIndexMaxPrefix + field_index, num_record_batches);
+  }
+  return builder;
+}
+
+Status RowIndexBuilder::Append(const RecordBatch& batch) {
+  row_offsets_.push_back(row_offsets_.back() + batch.num_rows());
+  for (size_t i = 0; i < indexed_fields_.size(); ++i) {
+    std::string min, max;
+    ComputeMinMax(*batch.column_data(indexed_fields_[i]), &min, &max);
+    min_values_[i].push_back(std::move(min));
+    max_values_[i].push_back(std::move(max));
+  }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<const KeyValueMetadata>> RowIndexBuilder::Finish(
+    const std::shared_ptr<const KeyValueMetadata>& metadata) const {
+  auto out = metadata ? metadata->Copy() : std::make_shared<KeyValueMetadata>();
+
+  std::vector<std::string> row_offsets;
+  row_offsets.reserve(row_offsets_.size());
+  for (int64_t offset : row_offsets_) {
+    row_offsets.push_back(std::to_string(offset));
+  }
+  RETURN_NOT_OK(out->Set(kRowIndexOffsetsKey, JoinStrings(row_offsets, ",")));
+  for (size_t i = 0; i < indexed_fields_.size(); ++i) {
+    const std::string field_index = std::to_string(indexed_fields_[i]);
+    RETURN_NOT_OK(
+        out->Set(kRowIndexMinPrefix + field_index, JoinStrings(min_values_[i], ",")));
+    RETURN_NOT_OK(
+        out->Set(kRowIndexMaxPrefix + field_index, JoinStrings(max_values_[i], ",")));
+  }
+  return std::shared_ptr<const KeyValueMetadata>(std::move(out));
+}
+
+std::shared_ptr<const KeyValueMetadata> RemoveRowIndex(
+    const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  if (metadata == nullptr) {
+    return nullptr;
+  }
+  std::vector<std::string> keys, values;
+  for (int64_t i = 0; i < metadata->size(); ++i) {
+    const std::string& key = metadata->key(i);
+    if (key == kRowIndexOffsetsKey || key.rfind(kRowIndexMinPrefix, 0) == 0 ||
+        key.rfind(kRowIndexMaxPrefix, 0) == 0) {
+      continue;
+    }
+    keys.push_back(key);
+    values.push_back(metadata->value(i));
+  }
+  return key_value_metadata(std::move(keys), std::move(values));
+}
+
+Result<std::optional<RowIndex>> RowIndex::Read(const KeyValueMetadata& metadata,
+                                               const Schema& schema,
+                                               int num_record_batches) {
+  const int offsets_index = metadata.FindKey(kRowIndexOffsetsKey);
+  if (offsets_index < 0) {
+    return std::nullopt;
+  }
+
+  RowIndex row_index;
+  const auto row_offsets = SplitString(metadata.value(offsets_index), ',');
+  if (static_cast<int64_t>(row_offsets.size()) != num_record_batches + 1) {
+    return InvalidRowIndex(kRowIndexOffsetsKey);
+  }
+  for (const auto& value : row_offsets) {
+    int64_t offset;
+    if (!::arrow::internal::ParseValue<Int64Type>(value.data(), value.size(), &offset) ||
+        offset < (row_index.row_offsets.empty() ? 0 : row_index.row_offsets.back())) {
+      return InvalidRowIndex(kRowIndexOffsetsKey);
+    }
+    row_index.row_offsets.push_back(offset);
+  }
+  if (row_index.row_offsets.front() != 0) {
+    return InvalidRowIndex(kRowIndexOffsetsKey);
+  }
+
+  row_index.min_values.resize(schema.num_fields());
+  row_index.max_values.resize(schema.num_fields());
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    const auto& type = schema.field(i)->type();
+    if (!IsIndexedType(*type)) {
+      continue;
+    }
+    const std::string field_index = std::to_string(i);
+    ARROW_ASSIGN_OR_RAISE(row_index.min_values[i],
+                          ReadFieldValues(metadata, kRowIndexMinPrefix + field_index,
+                                          type, num_record_batches));
+    ARROW_ASSIGN_OR_RAISE(row_index.max_values[i],
+                          ReadFieldValues(metadata, kRowIndexMaxPrefix + field_index,
+                                          type, num_record_batches));
+    if (row_index.min_values[i].size() != row_index.max_values[i].size()) {
+      return InvalidRowIndex(kRowIndexMinPrefix + field_index);
+    }
+  }
+  return row_index;
+}
+
+}  // namespace internal
+}  // namespace ipc
+}  // namespace arrow
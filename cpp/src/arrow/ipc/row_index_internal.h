@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Row index of the IPC file format, stored in the custom metadata of the
+// file footer
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace ipc {
+namespace internal {
+
+/// Comma-separated row offset of each record batch, followed by the number of rows
+constexpr char kRowIndexOffsetsKey[] = "ARROW:row_index:offsets";
+/// Prefixes of the keys, followed by a top-level field index, of the comma-separated
+/// minimum and maximum values of the field in each record batch.  The values are
+/// empty for record batches without non-null values.
+constexpr char kRowIndexMinPrefix[] = "ARROW:row_index:min:";
+constexpr char kRowIndexMaxPrefix[] = "ARROW:row_index:max:";
+
+/// \brief Accumulate the row index of an IPC file as its record batches are written
+///
+/// Statistics are collected for integer and floating-point fields, from the exact
+/// ArrayStatistics attached to the columns if any.
+class ARROW_EXPORT RowIndexBuilder {
+ public:
+  explicit RowIndexBuilder(const Schema& schema);
+
+  /// \brief Continue the row index of an existing file, read from its footer metadata
+  ///
+  /// Return null if the file has record batches but no row index.
+  static Result<std::shared_ptr<RowIndexBuilder>> Resume(const Schema& schema,
+                                                         const KeyValueMetadata& metadata,
+                                                         int num_record_batches);
+
+  Status Append(const RecordBatch& batch);
+
+  /// \brief Return the given footer metadata with the row index added
+  Result<std::shared_ptr<const KeyValueMetadata>> Finish(
+      const std::shared_ptr<const KeyValueMetadata>& metadata) const;
+
+ private:
+  std::vector<int64_t> row_offsets_;
+  std::vector<int> indexed_fields_;
+  std::vector<std::vector<std::string>> min_values_;
+  std::vector<std::vector<std::string>> max_values_;
+};
+
+/// \brief Return the given footer metadata without its row index
+ARROW_EXPORT
+std::shared_ptr<const KeyValueMetadata> RemoveRowIndex(
+    const std::shared_ptr<const KeyValueMetadata>& metadata);
+
+/// \brief A row index read from the footer metadata of an IPC file
+struct ARROW_EXPORT RowIndex {
+  /// Row offset of each record batch, followed by the number of rows
+  std::vector<int64_t> row_offsets;
+
+  /// Minimum and maximum values of each record batch by top-level field index,
+  /// with null pointers for batches or fields without statistics
+  std::vector<std::vector<std::shared_ptr<Scalar>>> min_values;
+  std::vector<std::vector<std::shared_ptr<Scalar>>> max_values;
+
+  /// \brief Read the row index, or return nullopt if the file has none
+  static Result<std::optional<RowIndex>> Read(const KeyValueMetadata& metadata,
+                                              const Schema& schema,
+                                              int num_record_batches);
+};
+
+}  // namespace internal
+}  // namespace ipc
+}  // namespace arrow
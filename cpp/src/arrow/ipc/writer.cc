@@ -20,9 +20,11 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <iomanip>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -34,11 +36,14 @@
 #include "arrow/buffer.h"
 #include "arrow/device.h"
 #include "arrow/extension_type.h"
+#include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
+#include "arrow/ipc/reader_internal.h"
+#include "arrow/ipc/row_index_internal.h"
 #include "arrow/ipc/util.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
@@ -51,11 +56,14 @@
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/crc32.h"
 #include "arrow/util/endian.h"
 #include "arrow/util/int_util_overflow.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_array_inline.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
@@ -85,6 +93,107 @@ bool HasNestedDict(const ArrayData& data) {
   return false;
 }
 
+// Whether the values of `last` are physically the leading values of `next`, i.e.
+// `next` uses the same memory at the same offset, only possibly for more values.
+bool SharesLeadingValues(const ArrayData& last, const ArrayData& next) {
+  if (last.offset != next.offset || last.buffers.size() > next.buffers.size() ||
+      last.child_data.size() != next.child_data.size() ||
+      last.dictionary != next.dictionary) {
+    return false;
+  }
+  for (size_t i = 0; i < last.buffers.size(); ++i) {
+    const auto& last_buffer = last.buffers[i];
+    const auto& next_buffer = next.buffers[i];
+    if (last_buffer == next_buffer) {
+      continue;
+    }
+    if (last_buffer == nullptr || next_buffer == nullptr ||
+        last_buffer->address() != next_buffer->address() ||
+        last_buffer->size() > next_buffer->size()) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < last.child_data.size(); ++i) {
+    if (!SharesLeadingValues(*last.child_data[i], *next.child_data[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Whether the first `length` values of `last` and `next` are equal, comparing their
+// memory directly, or std::nullopt if this doesn't tell.
+std::optional<bool> LeadingValuesEqual(const ArrayData& last, const ArrayData& next,
+                                       int64_t length) {
+  if (length == 0 || SharesLeadingValues(last, next)) {
+    return true;
+  }
+  const Type::type type_id = last.type->id();
+  // Values under nulls may differ
+  if (last.GetNullCount() != 0 || next.GetNullCount() != 0 ||
+      next.type->id() != type_id) {
+    return std::nullopt;
+  }
+  // Signed zeros are equal but differ bitwise
+  const std::optional<bool> if_bytes_differ =
+      is_floating(type_id) ? std::nullopt : std::optional<bool>(false);
+
+  auto bytes_equal = [](const uint8_t* a, const uint8_t* b, int64_t size) {
+    return std::memcmp(a, b, static_cast<size_t>(size)) == 0;
+  };
+  auto leading_binary_equal = [&](auto offset_type) -> bool {
+    using offset_type_t = decltype(offset_type);
+    const auto* last_offsets = last.GetValues<offset_type_t>(1);
+    const auto* next_offsets = next.GetValues<offset_type_t>(1);
+    if (last_offsets[0] == next_offsets[0]) {
+      if (!bytes_equal(reinterpret_cast<const uint8_t*>(last_offsets),
+                       reinterpret_cast<const uint8_t*>(next_offsets),
+                       (length + 1) * sizeof(offset_type_t))) {
+        return false;
+      }
+    } else {
+      for (int64_t i = 1; i <= length; ++i) {
+        if (last_offsets[i] - last_offsets[0] != next_offsets[i] - next_offsets[0]) {
+          return false;
+        }
+      }
+    }
+    const int64_t data_size = last_offsets[length] - last_offsets[0];
+    return data_size == 0 || bytes_equal(last.buffers[2]->data() + last_offsets[0],
+                                         next.buffers[2]->data() + next_offsets[0],
+                                         data_size);
+  };
+
+  switch (type_id) {
+    case Type::STRING:
+    case Type::BINARY:
+      return leading_binary_equal(int32_t{}) ? std::optional<bool>(true)
+                                             : if_bytes_differ;
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
+      return leading_binary_equal(int64_t{}) ? std::optional<bool>(true)
+                                             : if_bytes_differ;
+    case Type::BOOL:
+    case Type::DICTIONARY:
+      return std::nullopt;
+    default:
+      break;
+  }
+  if (!is_fixed_width(type_id) || last.buffers.size() != 2) {
+    return std::nullopt;
+  }
+  const int64_t byte_width = last.type->byte_width();
+  if (byte_width <= 0) {
+    return std::nullopt;
+  }
+  if (bytes_equal(last.buffers[1]->data() + last.offset * byte_width,
+                  next.buffers[1]->data() + next.offset * byte_width,
+                  length * byte_width)) {
+    return true;
+  }
+  return if_bytes_differ;
+}
+
 Status GetTruncatedBitmap(int64_t offset, int64_t length,
                           const std::shared_ptr<Buffer>& input, MemoryPool* pool,
                           std::shared_ptr<Buffer>* buffer) {
@@ -310,6 +419,10 @@ class RecordBatchSerializer {
     out_->body_length = offset - buffer_start_offset_;
     DCHECK(bit_util::IsMultipleOf8(out_->body_length));
 
+    if (options_.write_buffer_checksums) {
+      RETURN_NOT_OK(AddBufferChecksums());
+    }
+
     // Now that we have computed the locations of all of the buffers in shared
     // memory, the data header can be converted to a flatbuffer and written out
     //
@@ -709,6 +822,29 @@ class RecordBatchSerializer {
   Status VisitType(const Array& values) { return VisitArrayInline(values, this); }
 
  protected:
+  // Add the CRC32 of each body buffer to the custom metadata of the message
+  Status AddBufferChecksums() {
+    std::stringstream checksums;
+    checksums << std::hex;
+    for (size_t i = 0; i < out_->body_buffers.size(); ++i) {
+      const auto& buffer = out_->body_buffers[i];
+      uint32_t checksum = 0;
+      if (buffer && buffer->size() > 0) {
+        if (!buffer->is_cpu()) {
+          return Status::NotImplemented("Buffer checksums of non-CPU buffers");
+        }
+        checksum = ::arrow::internal::crc32(0, buffer->data(),
+                                            static_cast<size_t>(buffer->size()));
+      }
+      checksums << (i > 0 ? "," : "") << checksum;
+    }
+    auto metadata = custom_metadata_ ? custom_metadata_->Copy()
+                                     : std::make_shared<KeyValueMetadata>();
+    RETURN_NOT_OK(metadata->Set(internal::kBufferChecksumsKey, checksums.str()));
+    custom_metadata_ = std::move(metadata);
+    return Status::OK();
+  }
+
   // Destination for output buffers
   IpcPayload* out_;
 
@@ -1175,18 +1311,28 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   // A RecordBatchWriter implementation that writes to a IpcPayloadWriter.
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const Schema& schema, const IpcWriteOptions& options,
-                  bool is_file_format)
+                  bool is_file_format,
+                  std::shared_ptr<RowIndexBuilder> row_index = NULLPTR)
       : payload_writer_(std::move(payload_writer)),
+        row_index_(std::move(row_index)),
         schema_(schema),
         mapper_(schema),
         is_file_format_(is_file_format),
-        options_(options) {}
+        options_(options),
+        max_batches_in_flight_(options.use_threads ? options.max_batches_in_flight
+                                                   : 0) {
+    // Several batches are serialized at once on the CPU thread pool, don't make
+    // each of them wait for the buffers compressed on the same thread pool.
+    in_flight_options_.use_threads = false;
+  }
 
   // A Schema-owning constructor variant
   IpcFormatWriter(std::unique_ptr<internal::IpcPayloadWriter> payload_writer,
                   const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options,
-                  bool is_file_format)
-      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format) {
+                  bool is_file_format,
+                  std::shared_ptr<RowIndexBuilder> row_index = NULLPTR)
+      : IpcFormatWriter(std::move(payload_writer), *schema, options, is_file_format,
+                        std::move(row_index)) {
     shared_schema_ = schema;
   }
 
@@ -1208,15 +1354,15 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
 
     RETURN_NOT_OK(WriteDictionaries(batch));
 
+    if (row_index_) {
+      RETURN_NOT_OK(row_index_->Append(batch));
+    }
+    if (max_batches_in_flight_ > 0) {
+      return SubmitRecordBatch(batch, custom_metadata);
+    }
     IpcPayload payload;
     RETURN_NOT_OK(GetRecordBatchPayload(batch, custom_metadata, options_, &payload));
-    RETURN_NOT_OK(WritePayload(payload));
-    ++stats_.num_record_batches;
-
-    stats_.total_raw_body_size += payload.raw_body_length;
-    stats_.total_serialized_body_size += payload.body_length;
-
-    return Status::OK();
+    return WriteRecordBatchPayload(payload);
   }
 
   Status WriteTable(const Table& table, int64_t max_chunksize) override {
@@ -1231,6 +1377,7 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
 
   Status Close() override {
     RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(FlushBatchesInFlight(0));
     RETURN_NOT_OK(payload_writer_->Close());
     closed_ = true;
     return Status::OK();
@@ -1275,8 +1422,17 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
         }
         const int64_t last_length = (*last_dictionary)->length();
         const int64_t new_length = dictionary->length();
-        if (new_length == last_length &&
-            ((*last_dictionary)->Equals(dictionary, equal_options))) {
+        // Compare the memory of flat dictionaries, rather than the values one by one
+        auto starts_with_last_dictionary = [&]() {
+          const auto memory_equal = LeadingValuesEqual(*(*last_dictionary)->data(),
+                                                       *dictionary->data(), last_length);
+          if (memory_equal.has_value()) {
+            return *memory_equal;
+          }
+          return (*last_dictionary)
+              ->RangeEquals(dictionary, 0, last_length, 0, equal_options);
+        };
+        if (new_length == last_length && starts_with_last_dictionary()) {
           // Same dictionary by value => no need to emit it again
           // (while this can have a CPU cost, this code path is required
           //  for the IPC file format)
@@ -1285,9 +1441,7 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
 
         // (the read path doesn't support outer dictionary deltas, don't emit them)
         if (new_length > last_length && options_.emit_dictionary_deltas &&
-            !HasNestedDict(*dictionary->data()) &&
-            ((*last_dictionary)
-                 ->RangeEquals(dictionary, 0, last_length, 0, equal_options))) {
+            !HasNestedDict(*dictionary->data()) && starts_with_last_dictionary()) {
           // New dictionary starts with the current dictionary
           delta_start = last_length;
         }
@@ -1326,12 +1480,63 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   }
 
   Status WritePayload(const IpcPayload& payload) {
+    // Keep the messages in order
+    RETURN_NOT_OK(FlushBatchesInFlight(0));
+    return DoWritePayload(payload);
+  }
+
+  Status DoWritePayload(const IpcPayload& payload) {
     RETURN_NOT_OK(payload_writer_->WritePayload(payload));
     ++stats_.num_messages;
     return Status::OK();
   }
 
+  // Write a record batch payload, the batches in flight must have been written
+  Status WriteRecordBatchPayload(const IpcPayload& payload) {
+    RETURN_NOT_OK(DoWritePayload(payload));
+    ++stats_.num_record_batches;
+
+    stats_.total_raw_body_size += payload.raw_body_length;
+    stats_.total_serialized_body_size += payload.body_length;
+    return Status::OK();
+  }
+
+  // Serialize and compress the batch on the CPU thread pool, while the batches
+  // submitted before are written
+  Status SubmitRecordBatch(const RecordBatch& batch,
+                           const std::shared_ptr<const KeyValueMetadata>& custom_metadata) {
+    // The caller may release the batch once we return, keep its data alive
+    auto owned_batch =
+        RecordBatch::Make(batch.schema(), batch.num_rows(), batch.column_data());
+    ARROW_ASSIGN_OR_RAISE(
+        auto payload,
+        ::arrow::internal::GetCpuThreadPool()->Submit(
+            [owned_batch, custom_metadata,
+             options = in_flight_options_]() -> Result<std::shared_ptr<IpcPayload>> {
+              auto payload = std::make_shared<IpcPayload>();
+              RETURN_NOT_OK(
+                  GetRecordBatchPayload(*owned_batch, custom_metadata, options,
+                                        payload.get()));
+              return payload;
+            }));
+    batches_in_flight_.push_back(std::move(payload));
+    return FlushBatchesInFlight(max_batches_in_flight_ - 1);
+  }
+
+  // Write the oldest batches in flight until at most `max_remaining` are left
+  Status FlushBatchesInFlight(int max_remaining) {
+    while (static_cast<int>(batches_in_flight_.size()) > max_remaining) {
+      auto payload = std::move(batches_in_flight_.front());
+      batches_in_flight_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto ready_payload, payload.result());
+      RETURN_NOT_OK(WriteRecordBatchPayload(*ready_payload));
+    }
+    return Status::OK();
+  }
+
   std::unique_ptr<IpcPayloadWriter> payload_writer_;
+  // Shared with the PayloadFileWriter, which writes it in the footer
+  std::shared_ptr<RowIndexBuilder> row_index_;
   std::shared_ptr<Schema> shared_schema_;
   const Schema& schema_;
   const DictionaryFieldMapper mapper_;
@@ -1348,6 +1553,12 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   bool closed_ = false;
   IpcWriteOptions options_;
   WriteStats stats_;
+
+  // Pipelined serialization, only used if max_batches_in_flight_ > 0
+  const int max_batches_in_flight_;
+  IpcWriteOptions in_flight_options_ = options_;
+  // Record batch payloads not written yet, in order
+  std::deque<Future<std::shared_ptr<IpcPayload>>> batches_in_flight_;
 };
 
 class StreamBookKeeper {
@@ -1435,18 +1646,24 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  public:
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    io::OutputStream* sink)
-      : StreamBookKeeper(options, sink), schema_(schema), metadata_(metadata) {}
+                    io::OutputStream* sink,
+                    std::shared_ptr<RowIndexBuilder> row_index = NULLPTR)
+      : StreamBookKeeper(options, sink),
+        schema_(schema),
+        metadata_(metadata),
+        row_index_(std::move(row_index)) {}
   PayloadFileWriter(const IpcWriteOptions& options, const std::shared_ptr<Schema>& schema,
                     const std::shared_ptr<const KeyValueMetadata>& metadata,
-                    std::shared_ptr<io::OutputStream> sink)
+                    std::shared_ptr<io::OutputStream> sink,
+                    std::shared_ptr<RowIndexBuilder> row_index = NULLPTR)
       : StreamBookKeeper(options, std::move(sink)),
         schema_(schema),
-        metadata_(metadata) {}
+        metadata_(metadata),
+        row_index_(std::move(row_index)) {}
 
   ~PayloadFileWriter() override = default;
 
-  Status WritePayload(const IpcPayload& payload) override {
+  Status DoWritePayload(const IpcPayload& payload) {
 #ifndef NDEBUG
     // Catch bug fixed in ARROW-3236
     RETURN_NOT_OK(UpdatePositionCheckAligned());
@@ -1472,11 +1689,30 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     return Status::OK();
   }
 
+  // Continue a file whose messages end at the current position of the sink, and
+  // which already has the magic bytes, the schema message and the given blocks
+  void Resume(std::vector<FileBlock> dictionaries,
+              std::vector<FileBlock> record_batches) {
+    resumed_ = true;
+    dictionaries_ = std::move(dictionaries);
+    record_batches_ = std::move(record_batches);
+  }
+
+  Status WritePayload(const IpcPayload& payload) override {
+    if (resumed_ && payload.type == MessageType::SCHEMA) {
+      return Status::OK();
+    }
+    return DoWritePayload(payload);
+  }
+
   Status Start() override {
     // ARROW-3236: The initial position -1 needs to be updated to the stream's
     // current position otherwise an incorrect amount of padding will be
     // written to new files.
     RETURN_NOT_OK(UpdatePosition());
+    if (resumed_) {
+      return Status::OK();
+    }
 
     // It is only necessary to align to 8-byte boundary at the start of the file
     RETURN_NOT_OK(Write(kArrowMagicBytes, strlen(kArrowMagicBytes)));
@@ -1492,8 +1728,12 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     // Write file footer
     RETURN_NOT_OK(UpdatePosition());
     int64_t initial_position = position_;
+    auto metadata = metadata_;
+    if (row_index_) {
+      ARROW_ASSIGN_OR_RAISE(metadata, row_index_->Finish(metadata_));
+    }
     RETURN_NOT_OK(
-        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata_, sink_));
+        WriteFileFooter(*schema_, dictionaries_, record_batches_, metadata, sink_));
 
     // Write footer length
     RETURN_NOT_OK(UpdatePosition());
@@ -1513,10 +1753,20 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
  protected:
   std::shared_ptr<Schema> schema_;
   std::shared_ptr<const KeyValueMetadata> metadata_;
+  std::shared_ptr<RowIndexBuilder> row_index_;
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
+  bool resumed_ = false;
 };
 
+std::shared_ptr<RowIndexBuilder> MakeRowIndexBuilder(const Schema& schema,
+                                                     const IpcWriteOptions& options) {
+  if (!options.write_row_index) {
+    return nullptr;
+  }
+  return std::make_shared<RowIndexBuilder>(schema);
+}
+
 }  // namespace internal
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
@@ -1545,19 +1795,65 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto row_index = internal::MakeRowIndexBuilder(*schema, options);
   return std::make_shared<internal::IpcFormatWriter>(
-      std::make_unique<internal::PayloadFileWriter>(options, schema, metadata, sink),
-      schema, options, /*is_file_format=*/true);
+      std::make_unique<internal::PayloadFileWriter>(options, schema, metadata, sink,
+                                                    row_index),
+      schema, options, /*is_file_format=*/true, row_index);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
     const IpcWriteOptions& options,
     const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  auto row_index = internal::MakeRowIndexBuilder(*schema, options);
   return std::make_shared<internal::IpcFormatWriter>(
       std::make_unique<internal::PayloadFileWriter>(options, schema, metadata,
-                                                    std::move(sink)),
-      schema, options, /*is_file_format=*/true);
+                                                    std::move(sink), row_index),
+      schema, options, /*is_file_format=*/true, row_index);
+}
+
+Result<std::shared_ptr<RecordBatchWriter>> MakeFileAppender(
+    const std::string& path, const IpcWriteOptions& options) {
+  internal::IpcFileLayout layout;
+  {
+    ARROW_ASSIGN_OR_RAISE(auto file, io::ReadableFile::Open(path));
+    ARROW_ASSIGN_OR_RAISE(layout, internal::ReadIpcFileLayout(file.get()));
+    RETURN_NOT_OK(file->Close());
+  }
+  if (DictionaryFieldMapper(*layout.schema).num_fields() > 0) {
+    return Status::NotImplemented(
+        "Appending to an IPC file with dictionary-encoded fields");
+  }
+  // Keep extending the row index of the file, if it has one
+  std::shared_ptr<internal::RowIndexBuilder> row_index;
+  const int num_record_batches = static_cast<int>(layout.record_batches.size());
+  if (options.write_row_index && num_record_batches == 0) {
+    row_index = internal::MakeRowIndexBuilder(*layout.schema, options);
+  } else if (options.write_row_index && layout.metadata) {
+    ARROW_ASSIGN_OR_RAISE(row_index,
+                          internal::RowIndexBuilder::Resume(
+                              *layout.schema, *layout.metadata, num_record_batches));
+  }
+  auto metadata = internal::RemoveRowIndex(layout.metadata);
+
+  // Truncate the end-of-stream marker and the footer, and write after the messages
+  ARROW_ASSIGN_OR_RAISE(auto file_name,
+                        ::arrow::internal::PlatformFilename::FromString(path));
+  ARROW_ASSIGN_OR_RAISE(auto fd, ::arrow::internal::FileOpenWritable(
+                                     file_name, /*write_only=*/true,
+                                     /*truncate=*/false, /*append=*/false));
+  RETURN_NOT_OK(::arrow::internal::FileTruncate(fd.fd(), layout.messages_end));
+  RETURN_NOT_OK(::arrow::internal::FileSeek(fd.fd(), layout.messages_end));
+  ARROW_ASSIGN_OR_RAISE(auto sink, io::FileOutputStream::Open(fd.Detach()));
+
+  auto payload_writer = std::make_unique<internal::PayloadFileWriter>(
+      options, layout.schema, metadata, std::move(sink), row_index);
+  payload_writer->Resume(std::move(layout.dictionaries),
+                         std::move(layout.record_batches));
+  return std::make_shared<internal::IpcFormatWriter>(
+      std::move(payload_writer), layout.schema, options, /*is_file_format=*/true,
+      row_index);
 }
 
 Result<std::shared_ptr<RecordBatchWriter>> NewFileWriter(
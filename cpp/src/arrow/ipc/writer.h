@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/ipc/dictionary.h"  // IWYU pragma: export
@@ -182,6 +183,24 @@ Result<std::shared_ptr<RecordBatchWriter>> MakeFileWriter(
     const IpcWriteOptions& options = IpcWriteOptions::Defaults(),
     const std::shared_ptr<const KeyValueMetadata>& metadata = NULLPTR);
 
+/// Open an IPC file writer appending record batches to an existing IPC file
+///
+/// The end-of-stream marker and the footer of the file are truncated, and record
+/// batches are written after the existing ones, which aren't rewritten. Closing
+/// the writer writes a footer listing all record batches. The schema and footer
+/// metadata of the file are kept, as well as its row index if
+/// `options.write_row_index` is true and the file has one.
+///
+/// Files with dictionary-encoded fields aren't supported.
+///
+/// \param[in] path the path of the IPC file on the local filesystem
+/// \param[in] options options for serialization, optional
+/// \return Result<std::shared_ptr<RecordBatchWriter>>
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatchWriter>> MakeFileAppender(
+    const std::string& path,
+    const IpcWriteOptions& options = IpcWriteOptions::Defaults());
+
 /// @}
 
 /// \brief Low-level API for writing a record batch (without schema)
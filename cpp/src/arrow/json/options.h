@@ -20,7 +20,9 @@
 #include <cstdint>
 #include <memory>
 
+#include "arrow/io/interfaces.h"
 #include "arrow/json/type_fwd.h"
+#include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -53,6 +55,18 @@ struct ARROW_EXPORT ParseOptions {
   /// How JSON fields outside of explicit_schema (if given) are treated
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// \brief Whether to parse blocks with a SIMD structural index instead of RapidJSON
+  ///
+  /// Each block is first scanned 64 bytes at a time for the positions of its
+  /// brackets, separators, strings and scalars, then values are read by jumping from
+  /// one position to the next.  Malformed JSON is rejected with the same error
+  /// messages, although a few of them may name a different error than RapidJSON.
+  ///
+  /// With UnexpectedFieldBehavior::Ignore, the values of unexpected fields are
+  /// skipped by matching their brackets and quotes, without being tokenized.  Their
+  /// scalars and escape sequences are then not validated.
+  bool use_structural_index = false;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
@@ -66,9 +80,40 @@ struct ARROW_EXPORT ReadOptions {
   /// chunks when use_threads is true
   int32_t block_size = 1 << 20;  // 1 MB
 
+  /// \brief Number of leading blocks a StreamingReader determines its schema from
+  ///
+  /// These blocks are decoded concurrently if use_threads is true.  With
+  /// UnexpectedFieldBehavior::InferType, the types inferred from each of them are
+  /// unified, promoting them as the TableReader does across a whole file.  If they
+  /// are all empty, the following non-empty block is also used.
+  int32_t num_inference_blocks = 1;
+
   /// Create read options with default values
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  /// \brief Whether to use the global CPU thread pool
+  ///
+  /// If true, several batches of rows are converted in parallel while previously
+  /// converted ones are written to the output stream.  The output is identical.
+  bool use_threads = true;
+
+  /// \brief Maximum number of rows processed at a time
+  ///
+  /// The JSON writer converts and writes data in batches of N rows.
+  /// This number can impact performance.
+  int32_t batch_size = 1024;
+
+  /// \brief IO context for writing.
+  io::IOContext io_context;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+
+  /// \brief Test that all set options are valid
+  Status Validate() const;
+};
+
 }  // namespace json
 }  // namespace arrow
@@ -31,6 +31,8 @@
 #include "rapidjson/error/en.h"
 #include "rapidjson/reader.h"
 
+#include "arrow/json/structural_index_internal.h"
+
 #include "arrow/array.h"
 #include "arrow/array/builder_binary.h"
 #include "arrow/buffer_builder.h"
@@ -727,11 +729,12 @@ class HandlerBase : public BlockParser,
   }
   /// @}
 
-  /// \brief Set up builders using an expected Schema
-  Status Initialize(const std::shared_ptr<Schema>& s) {
+  /// \brief Set up builders using the expected Schema, if any
+  Status Initialize(const ParseOptions& options) {
+    use_structural_index_ = options.use_structural_index;
     auto type = struct_({});
-    if (s) {
-      type = struct_(s->fields());
+    if (options.explicit_schema) {
+      type = struct_(options.explicit_schema->fields());
     }
     return builder_set_.MakeBuilder(*type, 0, &builder_);
   }
@@ -793,9 +796,43 @@ class HandlerBase : public BlockParser,
     return Status::Invalid("Row count overflowed int32_t");
   }
 
+  template <typename Handler>
+  Status DoParseIndexed(Handler& handler, const char* json, int64_t json_size) {
+    indexer_.Index(json, json_size, &structural_positions_);
+    internal::StructuralReader reader(json, json_size, &structural_positions_,
+                                      &unescaped_);
+    // ensure that the loop can exit when the block too large.
+    for (; num_rows_ < std::numeric_limits<int32_t>::max(); ++num_rows_) {
+      auto code = reader.Parse(handler);
+      switch (code) {
+        case rj::kParseErrorNone:
+          // parse the next object
+          continue;
+        case rj::kParseErrorDocumentEmpty:
+          if (!reader.AtEnd()) {
+            return ParseError(rj::GetParseError_En(code));
+          }
+          // parsed all objects, finish
+          return Status::OK();
+        case rj::kParseErrorTermination:
+          // handler emitted an error
+          return handler.Error();
+        default:
+          return ParseError(rj::GetParseError_En(code), " in row ", num_rows_);
+      }
+    }
+    return Status::Invalid("Row count overflowed int32_t");
+  }
+
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
+    // Structural positions are 32-bit
+    if (use_structural_index_ &&
+        json->size() < std::numeric_limits<uint32_t>::max()) {
+      return DoParseIndexed(handler, reinterpret_cast<const char*>(json->data()),
+                            json->size());
+    }
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
     return DoParse(handler, InputStream(ms), static_cast<size_t>(json->size()));
@@ -929,6 +966,10 @@ class HandlerBase : public BlockParser,
   }
 
   Status status_;
+  bool use_structural_index_ = false;
+  internal::StructuralIndexer indexer_;
+  std::vector<uint32_t> structural_positions_;
+  std::string unescaped_;
   RawBuilderSet builder_set_;
   BuilderPtr builder_;
   // top of this stack is the parent of builder_
@@ -1059,9 +1100,14 @@ class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
     return HandlerBase::EndArray(size);
   }
 
- private:
+  /// \brief Whether the current value is skipped
+  ///
+  /// The structural reader checks this after each key to jump over the values of
+  /// unexpected fields without emitting their events.
   bool Skipping() { return depth_ >= skip_depth_; }
 
+ private:
+
   void MaybeStopSkipping() {
     if (skip_depth_ == depth_) {
       skip_depth_ = std::numeric_limits<int>::max();
@@ -1187,7 +1233,7 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
       *out = std::make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
       break;
   }
-  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
+  return static_cast<HandlerBase&>(**out).Initialize(options);
 }
 
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
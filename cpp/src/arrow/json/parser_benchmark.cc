@@ -143,6 +143,7 @@ static void ParseJSONBlockWithSchema(
   auto options = ParseOptions::Defaults();
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
   options.explicit_schema = schema(TestFields());
+  options.use_structural_index = state.range(0);
 
   auto json = GenerateTestData(options.explicit_schema, num_rows);
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), options);
@@ -220,7 +221,7 @@ static void ParseJSONFields(benchmark::State& state) {  // NOLINT non-const refe
 
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
-BENCHMARK(ParseJSONBlockWithSchema);
+BENCHMARK(ParseJSONBlockWithSchema)->ArgName("structural_index")->DenseRange(0, 1);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
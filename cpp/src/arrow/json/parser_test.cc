@@ -321,5 +321,68 @@ TEST(BlockParser, AdHoc) {
        R"([{"c":true, "d": "1991-02-03"}, {"c":false, "d":"2019-04-01"}])"});
 }
 
+TEST(BlockParser, StructuralIndex) {
+  std::string escapes_src = R"({"a\u00e9": "\"q\\\/\b\f\n\r\t", "b": "\ud83d\ude00"}
+{"a\u00e9": ")" + std::string(200, 'x') + R"(\\", "c": [-1.5e3, NaN, -Infinity]}
+)";
+  for (const auto& src : {scalars_only_src(), nested_src(), null_src(),
+                          mixed_decimal_src(), PrettyPrint(nested_src()), escapes_src}) {
+    for (const auto& explicit_schema :
+         {std::shared_ptr<Schema>(nullptr),
+          schema({field("hello", float64()), field("arr", list(int64()))})}) {
+      auto options = ParseOptions::Defaults();
+      options.explicit_schema = explicit_schema;
+      options.unexpected_field_behavior = explicit_schema
+                                              ? UnexpectedFieldBehavior::Ignore
+                                              : UnexpectedFieldBehavior::InferType;
+      std::shared_ptr<Array> expected, actual;
+      ASSERT_OK(ParseFromString(options, src, &expected));
+      options.use_structural_index = true;
+      ASSERT_OK(ParseFromString(options, src, &actual));
+      AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+    }
+  }
+
+  auto options = ParseOptions::Defaults();
+  options.use_structural_index = true;
+  for (const std::string invalid :
+       {"}", "{\"a\":1,}", "{\"a\" 1}", "{\"a\":1 \"b\":2}", "{\"a\":[1 2]}",
+        "{\"a\":\"b", "{\"a\":\"b\tc\"}", "{\"a\":\"\\x\"}", "{\"a\":\"\\ud800\"}",
+        "{\"a\":1.}", "{\"a\":nul}", "{1:2}", "{\"a\":[1,]}"}) {
+    ARROW_SCOPED_TRACE("invalid = ", invalid);
+    std::shared_ptr<Array> parsed;
+    ASSERT_RAISES(Invalid, ParseFromString(options, invalid, &parsed));
+  }
+  std::shared_ptr<Array> parsed;
+  auto status = ParseFromString(options, "{\"a\": 1}\n{\"a\": [}", &parsed);
+  EXPECT_THAT(status.message(),
+              ::testing::StartsWith("JSON parse error: Invalid value. in row 1"));
+}
+
+TEST(BlockParser, StructuralIndexSkipsUnexpectedFields) {
+  std::string src = R"(
+    {"a": 1, "skipped": {"b": [1, {"c": "]}"}], "d": "\"{"}, "e": [[true]]}
+    {"skipped": [], "a": 2, "also skipped": "x", "e": []}
+    {"skipped": [{}, [], null, 1e5, "\\"], "a": 3}
+  )";
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("a", int64()), field("e", list(list(boolean())))});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  std::shared_ptr<Array> expected, actual;
+  ASSERT_OK(ParseFromString(options, src, &expected));
+  options.use_structural_index = true;
+  ASSERT_OK(ParseFromString(options, src, &actual));
+  AssertArraysEqual(*expected, *actual, /*verbose=*/true);
+
+  for (const std::string invalid :
+       {R"({"skipped": [}]})", R"({"skipped": {"b": [})", R"({"skipped": "x)",
+        R"({"skipped": })", "{\"skipped\": \"a\tb\"}"}) {
+    ARROW_SCOPED_TRACE("invalid = ", invalid);
+    std::shared_ptr<Array> parsed;
+    ASSERT_RAISES(Invalid, ParseFromString(options, invalid, &parsed));
+  }
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <algorithm>
+#include <deque>
 #include <string_view>
 #include <utility>
 #include <vector>
@@ -59,6 +61,8 @@ struct ChunkedBlock {
 
 struct DecodedBlock {
   std::shared_ptr<RecordBatch> record_batch;
+  // The parsed block, if its conversion is deferred
+  std::shared_ptr<Array> unconverted;
   int64_t num_bytes = 0;
 };
 
@@ -74,7 +78,9 @@ struct IterationTraits<json::ChunkedBlock> {
 template <>
 struct IterationTraits<json::DecodedBlock> {
   static json::DecodedBlock End() { return json::DecodedBlock{}; }
-  static bool IsEnd(const json::DecodedBlock& val) { return !val.record_batch; }
+  static bool IsEnd(const json::DecodedBlock& val) {
+    return !val.record_batch && !val.unconverted;
+  }
 };
 
 namespace json {
@@ -93,6 +99,7 @@ class DecodeContext {
 
   void SetParseOptions(ParseOptions options) {
     parse_options_ = std::move(options);
+    defer_conversion_ = false;
     if (parse_options_.explicit_schema) {
       conversion_type_ = struct_(parse_options_.explicit_schema->fields());
     } else {
@@ -123,7 +130,12 @@ class DecodeContext {
     SetSchema(std::move(explicit_schema), unexpected_field_behavior);
   }
 
+  // Parse blocks without converting them, so that their inferred types can be unified
+  // before conversion
+  void DeferConversion() { defer_conversion_ = promotion_graph_ != nullptr; }
+
   [[nodiscard]] MemoryPool* pool() const { return pool_; }
+  [[nodiscard]] bool defer_conversion() const { return defer_conversion_; }
   [[nodiscard]] const ParseOptions& parse_options() const { return parse_options_; }
   [[nodiscard]] const PromotionGraph* promotion_graph() const { return promotion_graph_; }
   [[nodiscard]] const std::shared_ptr<DataType>& conversion_type() const {
@@ -134,6 +146,7 @@ class DecodeContext {
   ParseOptions parse_options_;
   std::shared_ptr<DataType> conversion_type_;
   const PromotionGraph* promotion_graph_;
+  bool defer_conversion_ = false;
   MemoryPool* pool_;
 };
 
@@ -308,6 +321,9 @@ class DecodingOperator {
     int64_t num_bytes;
     ARROW_ASSIGN_OR_RAISE(auto unconverted, ParseBlock(block, context_->parse_options(),
                                                        context_->pool(), &num_bytes));
+    if (context_->defer_conversion()) {
+      return DecodedBlock{nullptr, std::move(unconverted), num_bytes};
+    }
 
     std::shared_ptr<ChunkedArrayBuilder> builder;
     RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), context_->pool(),
@@ -320,7 +336,7 @@ class DecodingOperator {
     ARROW_ASSIGN_OR_RAISE(
         auto batch, RecordBatch::FromStructArray(chunked->chunk(0), context_->pool()));
 
-    return DecodedBlock{std::move(batch), num_bytes};
+    return DecodedBlock{std::move(batch), nullptr, num_bytes};
   }
 
  private:
@@ -350,12 +366,25 @@ AsyncGenerator<DecodedBlock> MakeDecodingGenerator(
   };
 }
 
+// The leading blocks of a stream, from which its schema is determined
+struct InitialBlocks {
+  std::vector<DecodedBlock> blocks;
+  // The error following `blocks`, if any
+  Status status;
+  // Whether no block follows `blocks` (or `status`)
+  bool finished = false;
+};
+
 class StreamingReaderImpl : public StreamingReader {
  public:
-  StreamingReaderImpl(DecodedBlock first_block, AsyncGenerator<DecodedBlock> source,
+  // `initial` must start with a non-empty block, with converted record batches
+  StreamingReaderImpl(InitialBlocks initial, AsyncGenerator<DecodedBlock> source,
                       const std::shared_ptr<DecodeContext>& context, int max_readahead)
-      : first_block_(std::move(first_block)),
-        schema_(first_block_->record_batch->schema()),
+      : initial_blocks_(std::make_move_iterator(initial.blocks.begin()),
+                        std::make_move_iterator(initial.blocks.end())),
+        initial_status_(std::move(initial.status)),
+        finished_(initial.finished),
+        schema_(initial_blocks_.front().record_batch->schema()),
         bytes_processed_(std::make_shared<std::atomic<int64_t>>(0)) {
     // Set the final schema for future invocations of the source generator
     context->SetStrictSchema(schema_);
@@ -437,10 +466,30 @@ class StreamingReaderImpl : public StreamingReader {
           MakeDecodingGenerator(std::move(chunking_it), DecodingOperator(context));
     }
 
-    return FirstBlock(decoding_gen)
+    const int num_inference_blocks = std::max(1, read_options.num_inference_blocks);
+    if (num_inference_blocks > 1) {
+      context->DeferConversion();
+    }
+    return ReadInitialBlocks(decoding_gen, num_inference_blocks)
         .Then([source = std::move(decoding_gen), context = std::move(context),
-               max_readahead](const DecodedBlock& block) {
-          return std::make_shared<StreamingReaderImpl>(block, std::move(source), context,
+               max_readahead](const InitialBlocks& blocks)
+                  -> Result<std::shared_ptr<StreamingReaderImpl>> {
+          InitialBlocks initial = blocks;
+          if (context->defer_conversion()) {
+            RETURN_NOT_OK(ConvertUnified(*context, &initial.blocks));
+          }
+          // Leading empty blocks are not yielded, but their bytes are still counted
+          auto first = std::find_if(initial.blocks.begin(), initial.blocks.end(),
+                                    [](const DecodedBlock& block) {
+                                      return block.record_batch->num_rows() > 0;
+                                    });
+          DCHECK(first != initial.blocks.end());
+          for (auto it = initial.blocks.begin(); it != first; ++it) {
+            first->num_bytes += it->num_bytes;
+          }
+          initial.blocks.erase(initial.blocks.begin(), first);
+          return std::make_shared<StreamingReaderImpl>(std::move(initial),
+                                                       std::move(source), context,
                                                        max_readahead);
         });
   }
@@ -453,12 +502,20 @@ class StreamingReaderImpl : public StreamingReader {
   }
 
   Future<std::shared_ptr<RecordBatch>> ReadNextAsync() override {
-    // On the first call, return the batch we used for initialization
-    if (ARROW_PREDICT_FALSE(first_block_)) {
-      bytes_processed_->fetch_add(first_block_->num_bytes);
-      auto batch = std::exchange(first_block_, std::nullopt)->record_batch;
+    // Return the batches we used for initialization first
+    if (ARROW_PREDICT_FALSE(!initial_blocks_.empty())) {
+      bytes_processed_->fetch_add(initial_blocks_.front().num_bytes);
+      auto batch = std::move(initial_blocks_.front().record_batch);
+      initial_blocks_.pop_front();
       return ToFuture(std::move(batch));
     }
+    if (ARROW_PREDICT_FALSE(finished_)) {
+      auto status = std::exchange(initial_status_, Status::OK());
+      if (!status.ok()) {
+        return Future<std::shared_ptr<RecordBatch>>::MakeFinished(std::move(status));
+      }
+      return ToFuture(IterationEnd<std::shared_ptr<RecordBatch>>());
+    }
     return generator_();
   }
 
@@ -467,30 +524,80 @@ class StreamingReaderImpl : public StreamingReader {
   }
 
  private:
-  static Future<DecodedBlock> FirstBlock(AsyncGenerator<DecodedBlock> gen) {
-    // Read from the stream until we get a non-empty record batch that we can use to
-    // declare the schema. Along the way, accumulate the bytes read so they can be
-    // recorded on the first `ReadNextAsync`
-    auto loop_body =
-        [gen = std::move(gen),
-         out = std::make_shared<DecodedBlock>()]() -> Future<ControlFlow<DecodedBlock>> {
-      return gen().Then(
-          [out](const DecodedBlock& block) -> Result<ControlFlow<DecodedBlock>> {
-            if (IsIterationEnd(block)) {
-              return Status::Invalid("Empty JSON stream");
+  static int64_t NumRows(const DecodedBlock& block) {
+    return block.record_batch ? block.record_batch->num_rows()
+                              : block.unconverted->length();
+  }
+
+  static Future<InitialBlocks> ReadInitialBlocks(AsyncGenerator<DecodedBlock> gen,
+                                                 int num_blocks) {
+    // Read `num_blocks` blocks at a time from the stream until we get a non-empty one
+    // that we can use to declare the schema.  An error following a non-empty block is
+    // only returned when the reader reaches it.
+    using Control = ControlFlow<InitialBlocks>;
+    auto loop_body = [gen = std::move(gen), num_blocks,
+                      out = std::make_shared<InitialBlocks>()]() -> Future<Control> {
+      std::vector<Future<DecodedBlock>> futures;
+      for (int i = 0; i < num_blocks; ++i) {
+        futures.push_back(gen());
+      }
+      return All(std::move(futures))
+          .Then([out](const std::vector<Result<DecodedBlock>>& results)
+                    -> Result<Control> {
+            auto has_rows = [&] {
+              return std::any_of(out->blocks.begin(), out->blocks.end(),
+                                 [](const DecodedBlock& b) { return NumRows(b) > 0; });
+            };
+            for (const auto& result : results) {
+              if (!result.ok() || IsIterationEnd(*result)) {
+                if (!has_rows()) {
+                  RETURN_NOT_OK(result.status());
+                  return Status::Invalid("Empty JSON stream");
+                }
+                out->status = result.status();
+                out->finished = true;
+                return Break(std::move(*out));
+              }
+              out->blocks.push_back(*result);
             }
-            out->num_bytes += block.num_bytes;
-            if (block.record_batch->num_rows() == 0) {
-              return Continue();
+            if (has_rows()) {
+              return Break(std::move(*out));
             }
-            out->record_batch = block.record_batch;
-            return Break(*out);
+            return Continue();
           });
     };
     return Loop(std::move(loop_body));
   }
 
-  std::optional<DecodedBlock> first_block_;
+  // Convert the blocks with unified types
+  static Status ConvertUnified(const DecodeContext& context,
+                               std::vector<DecodedBlock>* blocks) {
+    std::shared_ptr<ChunkedArrayBuilder> builder;
+    RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), context.pool(),
+                                          context.promotion_graph(),
+                                          context.conversion_type(), &builder));
+    for (size_t i = 0; i < blocks->size(); ++i) {
+      const auto& unconverted = (*blocks)[i].unconverted;
+      builder->Insert(static_cast<int64_t>(i), field("", unconverted->type()),
+                      unconverted);
+    }
+    std::shared_ptr<ChunkedArray> chunked;
+    RETURN_NOT_OK(builder->Finish(&chunked));
+    DCHECK_EQ(chunked->num_chunks(), static_cast<int>(blocks->size()));
+    for (size_t i = 0; i < blocks->size(); ++i) {
+      auto& block = (*blocks)[i];
+      ARROW_ASSIGN_OR_RAISE(block.record_batch,
+                            RecordBatch::FromStructArray(
+                                chunked->chunk(static_cast<int>(i)), context.pool()));
+      block.unconverted.reset();
+    }
+    return Status::OK();
+  }
+
+  std::deque<DecodedBlock> initial_blocks_;
+  // Returned after the initial blocks, if the stream ended or failed among them
+  Status initial_status_;
+  bool finished_;
   std::shared_ptr<Schema> schema_;
   std::shared_ptr<std::atomic<int64_t>> bytes_processed_;
   AsyncGenerator<std::shared_ptr<RecordBatch>> generator_;
@@ -58,10 +58,11 @@ ARROW_EXPORT Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
 /// batches have a consistent schema but may differ in row count.
 ///
 /// The supplied `ParseOptions` are used to determine a schema, based either on a
-/// provided explicit schema or inferred from the first non-empty block.
-/// Afterwards, the target schema is frozen. If `UnexpectedFieldBehavior::InferType` is
-/// specified, unexpected fields will only be inferred for the first block. Afterwards
-/// they'll be treated as errors.
+/// provided explicit schema or inferred from the leading blocks (the first non-empty
+/// block by default, see `ReadOptions::num_inference_blocks`). Afterwards, the target
+/// schema is frozen. If `UnexpectedFieldBehavior::InferType` is specified, unexpected
+/// fields will only be inferred for those leading blocks. Afterwards they'll be treated
+/// as errors.
 ///
 /// If `ReadOptions::use_threads` is `true`, each block's parsing/decoding task will be
 /// parallelized on the given `cpu_executor` (with readahead corresponding to the
@@ -925,6 +925,43 @@ TEST_P(StreamingReaderTest, InferredSchema) {
   AssertReadEnd(reader);
 }
 
+TEST_P(StreamingReaderTest, InferredSchemaFromSeveralBlocks) {
+  auto test_json = Join(
+      {
+          R"({"a": 0, "b": "foo"       })",
+          R"({"a": 1, "c": true        })",
+          R"({"a": 2, "d": "2022-01-01"})",
+      },
+      "\n", true);
+
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  parse_options_.explicit_schema = nullptr;
+  // One line per block, with the schema unified across all of them
+  read_options_.block_size = 32;
+  read_options_.num_inference_blocks = 3;
+
+  auto expected_schema =
+      schema({field("a", int64()), field("b", utf8()), field("c", boolean()),
+              field("d", timestamp(TimeUnit::SECOND))});
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(test_json));
+  AssertSchemaEqual(reader->schema(), expected_schema);
+
+  std::shared_ptr<RecordBatch> actual_batch;
+  const std::vector<std::string> expected_rows = {
+      R"([{"a": 0, "b": "foo", "c": null, "d": null}])",
+      R"([{"a": 1, "b": null, "c": true, "d": null}])",
+      R"([{"a": 2, "b": null, "c": null, "d": "2022-01-01"}])",
+  };
+  for (size_t i = 0; i < expected_rows.size(); ++i) {
+    ARROW_SCOPED_TRACE("batch ", i);
+    AssertReadNext(reader, &actual_batch);
+    EXPECT_EQ(reader->bytes_processed(), static_cast<int64_t>(28 * (i + 1)));
+    ASSERT_BATCHES_EQUAL(*RecordBatchFromJSON(expected_schema, expected_rows[i]),
+                         *actual_batch);
+  }
+  AssertReadEnd(reader);
+}
+
 TEST_F(AsyncStreamingReaderTest, AsyncReentrancy) {
   constexpr int kNumRows = 16;
   constexpr double kIoLatency = 1e-2;
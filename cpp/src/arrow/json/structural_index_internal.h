@@ -0,0 +1,634 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/json/rapidjson_defs.h"  // IWYU pragma: keep
+#include "rapidjson/error/error.h"
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace json {
+namespace internal {
+
+namespace rj = arrow::rapidjson;
+
+//
+// Two-stage JSON parsing, after simdjson.  Stage 1 (StructuralIndexer) classifies
+// 64-byte blocks of the input into bitmasks and extracts the positions of the
+// structural characters: brackets, colons, commas, quotes and the first byte of
+// each scalar.  String contents are found by quote parity, after discarding escaped
+// quotes.  Stage 2 (StructuralReader) walks the positions and emits RapidJSON-style
+// handler events, so that scalars are sliced straight out of the input instead of
+// being tokenized one byte at a time.
+//
+
+// Bitmasks of the character classes among 64 bytes, bit i standing for byte i
+struct CharacterMasks {
+  uint64_t backslash = 0;
+  uint64_t quote = 0;
+  // {}[]:,
+  uint64_t op = 0;
+  // space, \t, \n, \r
+  uint64_t whitespace = 0;
+  // bytes below 0x20, which are not allowed in strings
+  uint64_t control = 0;
+};
+
+inline bool IsJsonWhitespace(uint8_t c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+inline bool IsJsonOperator(uint8_t c) {
+  return c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',';
+}
+
+inline CharacterMasks ClassifyBlock(const uint8_t* data) {
+  CharacterMasks masks;
+#if defined(ARROW_HAVE_SSE4_2)
+  for (int i = 0; i < 4; ++i) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i));
+    auto eq = [&](char c) { return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); };
+    auto bits = [&](__m128i matches) {
+      return static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(matches)))
+             << (16 * i);
+    };
+    masks.backslash |= bits(eq('\\'));
+    masks.quote |= bits(eq('"'));
+    masks.op |= bits(_mm_or_si128(
+        _mm_or_si128(_mm_or_si128(eq('{'), eq('}')), _mm_or_si128(eq('['), eq(']'))),
+        _mm_or_si128(eq(':'), eq(','))));
+    masks.whitespace |= bits(
+        _mm_or_si128(_mm_or_si128(eq(' '), eq('\t')), _mm_or_si128(eq('\n'), eq('\r'))));
+    // v <= 0x1F, as unsigned bytes
+    masks.control |= bits(_mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(0x1F)), v));
+  }
+#elif defined(ARROW_HAVE_NEON)
+  // Weights of the bytes in their group of 8, to gather the matches into bits
+  static const uint8_t kWeights[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                       1, 2, 4, 8, 16, 32, 64, 128};
+  const uint8x16_t weights = vld1q_u8(kWeights);
+  auto bits = [&](const uint8x16_t (&matches)[4]) {
+    uint8x16_t sum = vpaddq_u8(vpaddq_u8(vandq_u8(matches[0], weights),
+                                         vandq_u8(matches[1], weights)),
+                               vpaddq_u8(vandq_u8(matches[2], weights),
+                                         vandq_u8(matches[3], weights)));
+    sum = vpaddq_u8(sum, sum);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum), 0);
+  };
+  uint8x16_t backslash[4], quote[4], op[4], whitespace[4], control[4];
+  for (int i = 0; i < 4; ++i) {
+    const uint8x16_t v = vld1q_u8(data + 16 * i);
+    auto eq = [&](uint8_t c) { return vceqq_u8(v, vdupq_n_u8(c)); };
+    backslash[i] = eq('\\');
+    quote[i] = eq('"');
+    op[i] = vorrq_u8(vorrq_u8(vorrq_u8(eq('{'), eq('}')), vorrq_u8(eq('['), eq(']'))),
+                     vorrq_u8(eq(':'), eq(',')));
+    whitespace[i] =
+        vorrq_u8(vorrq_u8(eq(' '), eq('\t')), vorrq_u8(eq('\n'), eq('\r')));
+    control[i] = vcleq_u8(v, vdupq_n_u8(0x1F));
+  }
+  masks.backslash = bits(backslash);
+  masks.quote = bits(quote);
+  masks.op = bits(op);
+  masks.whitespace = bits(whitespace);
+  masks.control = bits(control);
+#else
+  for (int i = 0; i < 64; ++i) {
+    const uint8_t c = data[i];
+    const uint64_t bit = uint64_t{1} << i;
+    masks.backslash |= c == '\\' ? bit : 0;
+    masks.quote |= c == '"' ? bit : 0;
+    masks.op |= IsJsonOperator(c) ? bit : 0;
+    masks.whitespace |= IsJsonWhitespace(c) ? bit : 0;
+    masks.control |= c <= 0x1F ? bit : 0;
+  }
+#endif
+  return masks;
+}
+
+// Bit i of the result is the XOR of bits 0 to i of `bits`
+inline uint64_t PrefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+class StructuralIndexer {
+ public:
+  static constexpr int64_t kBlockSize = 64;
+
+  /// \brief Replace `positions` with the structural positions of data[0, size)
+  ///
+  /// Besides the positions described above, control characters inside strings are
+  /// indexed so that the reader can reject them.  `size` must be below 2^32.
+  void Index(const char* data, int64_t size, std::vector<uint32_t>* positions) {
+    positions->clear();
+    prev_escaped_ = 0;
+    prev_in_string_ = 0;
+    prev_scalar_ = 0;
+    int64_t offset = 0;
+    for (; offset + kBlockSize <= size; offset += kBlockSize) {
+      IndexBlock(reinterpret_cast<const uint8_t*>(data + offset), offset, positions);
+    }
+    if (offset < size) {
+      // Pad the last block with whitespace
+      uint8_t block[kBlockSize];
+      std::memset(block, ' ', kBlockSize);
+      std::memcpy(block, data + offset, static_cast<size_t>(size - offset));
+      IndexBlock(block, offset, positions);
+    }
+  }
+
+ private:
+  // The escaped characters, i.e. those following an odd-length run of backslashes
+  uint64_t FindEscaped(uint64_t backslash) {
+    constexpr uint64_t kEvenBits = 0x5555555555555555ULL;
+    backslash &= ~prev_escaped_;
+    const uint64_t follows_escape = backslash << 1 | prev_escaped_;
+    const uint64_t odd_sequence_starts = backslash & ~kEvenBits & ~follows_escape;
+    // Adding the runs starting on odd bits carries them past their last backslash
+    uint64_t sequences_starting_on_even_bits = odd_sequence_starts + backslash;
+    prev_escaped_ = sequences_starting_on_even_bits < odd_sequence_starts ? 1 : 0;
+    const uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+    return (kEvenBits ^ invert_mask) & follows_escape;
+  }
+
+  void IndexBlock(const uint8_t* block, int64_t offset,
+                  std::vector<uint32_t>* positions) {
+    const CharacterMasks masks = ClassifyBlock(block);
+    const uint64_t quote = masks.quote & ~FindEscaped(masks.backslash);
+    // Set from each opening quote up to (excluding) the closing quote
+    const uint64_t in_string = PrefixXor(quote) ^ prev_in_string_;
+    prev_in_string_ = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+
+    const uint64_t scalar = ~(masks.op | masks.whitespace | quote | in_string);
+    const uint64_t scalar_start = scalar & ~(scalar << 1 | prev_scalar_);
+    prev_scalar_ = scalar >> 63;
+
+    uint64_t structural = (masks.op & ~in_string) | quote | scalar_start |
+                          (masks.control & in_string & ~quote);
+    size_t index = positions->size();
+    positions->resize(index + bit_util::PopCount(structural));
+    while (structural != 0) {
+      (*positions)[index++] =
+          static_cast<uint32_t>(offset + bit_util::CountTrailingZeros(structural));
+      structural &= structural - 1;
+    }
+  }
+
+  uint64_t prev_escaped_ = 0;
+  uint64_t prev_in_string_ = 0;
+  uint64_t prev_scalar_ = 0;
+};
+
+// Whether a handler may ask to skip the value of the last key, by returning true
+// from Skipping()
+template <typename Handler, typename = void>
+struct HasSkipping : std::false_type {};
+
+template <typename Handler>
+struct HasSkipping<Handler, std::void_t<decltype(std::declval<Handler&>().Skipping())>>
+    : std::true_type {};
+
+#define RETURN_PARSE_ERROR(expr)                           \
+  do {                                                     \
+    const rj::ParseErrorCode _code = (expr);               \
+    if (ARROW_PREDICT_FALSE(_code != rj::kParseErrorNone)) { \
+      return _code;                                        \
+    }                                                      \
+  } while (false)
+
+/// \brief Emit handler events for the JSON values of an indexed buffer
+///
+/// The handler receives the same calls as from a rj::Reader parsing with
+/// kParseNumbersAsStringsFlag and kParseNanAndInfFlag.
+class StructuralReader {
+ public:
+  StructuralReader(const char* data, int64_t size, const std::vector<uint32_t>* positions,
+                   std::string* unescaped)
+      : data_(data), size_(size), positions_(positions), unescaped_(unescaped) {}
+
+  /// Whether all values were consumed
+  bool AtEnd() const { return cursor_ == positions_->size(); }
+
+  /// \brief Parse the next top-level value
+  ///
+  /// Returns kParseErrorDocumentEmpty if no value is left, as rj::Reader does with
+  /// kParseStopWhenDoneFlag, and kParseErrorTermination if the handler failed.
+  template <typename Handler>
+  rj::ParseErrorCode Parse(Handler& handler) {
+    containers_.clear();
+    // Whether a value is expected at the cursor, rather than after a skipped one
+    bool value_pending = true;
+    while (true) {
+      if (value_pending) {
+        switch (Current()) {
+          case '{':
+            ++cursor_;
+            if (ARROW_PREDICT_FALSE(!handler.StartObject())) {
+              return rj::kParseErrorTermination;
+            }
+            if (Current() == '}') {
+              ++cursor_;
+              if (ARROW_PREDICT_FALSE(!handler.EndObject(0))) {
+                return rj::kParseErrorTermination;
+              }
+              break;
+            }
+            containers_.push_back({/*is_object=*/true, 0});
+            RETURN_PARSE_ERROR(ParseKey(handler, &value_pending));
+            continue;
+          case '[':
+            ++cursor_;
+            if (ARROW_PREDICT_FALSE(!handler.StartArray())) {
+              return rj::kParseErrorTermination;
+            }
+            if (Current() == ']') {
+              ++cursor_;
+              if (ARROW_PREDICT_FALSE(!handler.EndArray(0))) {
+                return rj::kParseErrorTermination;
+              }
+              break;
+            }
+            containers_.push_back({/*is_object=*/false, 0});
+            continue;
+          case '"':
+            RETURN_PARSE_ERROR(ParseString(handler, /*is_key=*/false));
+            break;
+          case '}':
+          case ']':
+          case ',':
+          case ':':
+          case '\0':
+            return containers_.empty() ? rj::kParseErrorDocumentEmpty
+                                       : rj::kParseErrorValueInvalid;
+          default:
+            RETURN_PARSE_ERROR(ParseScalar(handler));
+            break;
+        }
+      }
+      // A value was completed, close the containers it completes
+      while (true) {
+        if (containers_.empty()) {
+          return rj::kParseErrorNone;
+        }
+        Container& container = containers_.back();
+        ++container.size;
+        const char c = Current();
+        if (c == ',') {
+          ++cursor_;
+          if (container.is_object) {
+            RETURN_PARSE_ERROR(ParseKey(handler, &value_pending));
+          } else {
+            value_pending = true;
+          }
+          break;
+        }
+        const auto size = static_cast<uint32_t>(container.size);
+        if (container.is_object) {
+          if (ARROW_PREDICT_FALSE(c != '}')) {
+            return rj::kParseErrorObjectMissCommaOrCurlyBracket;
+          }
+          ++cursor_;
+          containers_.pop_back();
+          if (ARROW_PREDICT_FALSE(!handler.EndObject(size))) {
+            return rj::kParseErrorTermination;
+          }
+        } else {
+          if (ARROW_PREDICT_FALSE(c != ']')) {
+            return rj::kParseErrorArrayMissCommaOrSquareBracket;
+          }
+          ++cursor_;
+          containers_.pop_back();
+          if (ARROW_PREDICT_FALSE(!handler.EndArray(size))) {
+            return rj::kParseErrorTermination;
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  struct Container {
+    bool is_object;
+    int64_t size;
+  };
+
+  // The character at the cursor, or NUL past the last position
+  char Current() const { return AtEnd() ? '\0' : data_[(*positions_)[cursor_]]; }
+
+  // Parse a key and its colon.  If the handler skips the key's value, skip it too and
+  // set *value_pending to false.
+  template <typename Handler>
+  rj::ParseErrorCode ParseKey(Handler& handler, bool* value_pending) {
+    if (ARROW_PREDICT_FALSE(Current() != '"')) {
+      return rj::kParseErrorObjectMissName;
+    }
+    RETURN_PARSE_ERROR(ParseString(handler, /*is_key=*/true));
+    if (ARROW_PREDICT_FALSE(Current() != ':')) {
+      return rj::kParseErrorObjectMissColon;
+    }
+    ++cursor_;
+    *value_pending = true;
+    if constexpr (HasSkipping<Handler>::value) {
+      if (handler.Skipping()) {
+        RETURN_PARSE_ERROR(SkipValue());
+        *value_pending = false;
+      }
+    }
+    return rj::kParseErrorNone;
+  }
+
+  // Move the cursor past a value by matching its brackets and quotes, without
+  // emitting events.  Scalars and escape sequences are not validated.
+  rj::ParseErrorCode SkipValue() {
+    skipped_closers_.clear();
+    do {
+      const char c = Current();
+      switch (c) {
+        case '{':
+          skipped_closers_.push_back('}');
+          break;
+        case '[':
+          skipped_closers_.push_back(']');
+          break;
+        case '}':
+        case ']':
+          if (ARROW_PREDICT_FALSE(skipped_closers_.empty())) {
+            return rj::kParseErrorValueInvalid;
+          }
+          if (ARROW_PREDICT_FALSE(skipped_closers_.back() != c)) {
+            return MissingCloser();
+          }
+          skipped_closers_.pop_back();
+          break;
+        case '"':
+          ++cursor_;
+          // Only control characters are indexed between the quotes
+          if (ARROW_PREDICT_FALSE(Current() != '"')) {
+            return Current() == '\0' ? rj::kParseErrorStringMissQuotationMark
+                                     : rj::kParseErrorStringInvalidEncoding;
+          }
+          break;
+        case ',':
+        case ':':
+        case '\0':
+          if (ARROW_PREDICT_FALSE(skipped_closers_.empty())) {
+            return rj::kParseErrorValueInvalid;
+          }
+          if (ARROW_PREDICT_FALSE(AtEnd())) {
+            return MissingCloser();
+          }
+          break;
+        default:
+          break;
+      }
+      ++cursor_;
+    } while (!skipped_closers_.empty());
+    return rj::kParseErrorNone;
+  }
+
+  rj::ParseErrorCode MissingCloser() const {
+    return skipped_closers_.back() == '}'
+               ? rj::kParseErrorObjectMissCommaOrCurlyBracket
+               : rj::kParseErrorArrayMissCommaOrSquareBracket;
+  }
+
+  template <typename Handler>
+  rj::ParseErrorCode ParseString(Handler& handler, bool is_key) {
+    const uint32_t begin = (*positions_)[cursor_++] + 1;
+    // Only control characters are indexed between the quotes
+    if (ARROW_PREDICT_FALSE(Current() != '"')) {
+      return Current() == '\0' ? rj::kParseErrorStringMissQuotationMark
+                               : rj::kParseErrorStringInvalidEncoding;
+    }
+    const uint32_t end = (*positions_)[cursor_++];
+    std::string_view value(data_ + begin, end - begin);
+    if (std::memchr(value.data(), '\\', value.size()) != nullptr) {
+      RETURN_PARSE_ERROR(Unescape(value));
+      value = *unescaped_;
+    }
+    const auto length = static_cast<rj::SizeType>(value.size());
+    const bool ok = is_key ? handler.Key(value.data(), length, true)
+                           : handler.String(value.data(), length, true);
+    return ARROW_PREDICT_TRUE(ok) ? rj::kParseErrorNone : rj::kParseErrorTermination;
+  }
+
+  template <typename Handler>
+  rj::ParseErrorCode ParseScalar(Handler& handler) {
+    const uint32_t begin = (*positions_)[cursor_++];
+    int64_t end = AtEnd() ? size_ : (*positions_)[cursor_];
+    while (IsJsonWhitespace(static_cast<uint8_t>(data_[end - 1]))) {
+      --end;
+    }
+    const std::string_view token(data_ + begin, end - begin);
+    bool ok;
+    if (token == "null") {
+      ok = handler.Null();
+    } else if (token == "true") {
+      ok = handler.Bool(true);
+    } else if (token == "false") {
+      ok = handler.Bool(false);
+    } else {
+      RETURN_PARSE_ERROR(ValidateNumber(token));
+      ok = handler.RawNumber(token.data(), static_cast<rj::SizeType>(token.size()), true);
+    }
+    return ARROW_PREDICT_TRUE(ok) ? rj::kParseErrorNone : rj::kParseErrorTermination;
+  }
+
+  static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+  // Check the number grammar, including NaN and (-)Inf(inity)
+  static rj::ParseErrorCode ValidateNumber(std::string_view token) {
+    size_t i = 0;
+    const size_t n = token.size();
+    if (i < n && token[i] == '-') {
+      ++i;
+    }
+    const std::string_view rest = token.substr(i);
+    if (rest == "NaN" || rest == "Inf" || rest == "Infinity") {
+      return rj::kParseErrorNone;
+    }
+    if (i < n && token[i] == '0') {
+      ++i;
+    } else if (i < n && IsDigit(token[i])) {
+      while (i < n && IsDigit(token[i])) ++i;
+    } else {
+      return rj::kParseErrorValueInvalid;
+    }
+    if (i < n && token[i] == '.') {
+      ++i;
+      if (i == n || !IsDigit(token[i])) {
+        return rj::kParseErrorNumberMissFraction;
+      }
+      while (i < n && IsDigit(token[i])) ++i;
+    }
+    if (i < n && (token[i] == 'e' || token[i] == 'E')) {
+      ++i;
+      if (i < n && (token[i] == '+' || token[i] == '-')) {
+        ++i;
+      }
+      if (i == n || !IsDigit(token[i])) {
+        return rj::kParseErrorNumberMissExponent;
+      }
+      while (i < n && IsDigit(token[i])) ++i;
+    }
+    return i == n ? rj::kParseErrorNone : rj::kParseErrorValueInvalid;
+  }
+
+  static int ParseHex4(const char* data) {
+    int value = 0;
+    for (int i = 0; i < 4; ++i) {
+      const char c = data[i];
+      int digit;
+      if (IsDigit(c)) {
+        digit = c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        digit = c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        digit = c - 'A' + 10;
+      } else {
+        return -1;
+      }
+      value = value * 16 + digit;
+    }
+    return value;
+  }
+
+  void AppendUtf8(uint32_t codepoint) {
+    if (codepoint < 0x80) {
+      unescaped_->push_back(static_cast<char>(codepoint));
+    } else if (codepoint < 0x800) {
+      unescaped_->push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+      unescaped_->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else if (codepoint < 0x10000) {
+      unescaped_->push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+      unescaped_->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+      unescaped_->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else {
+      unescaped_->push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+      unescaped_->push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+      unescaped_->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+      unescaped_->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    }
+  }
+
+  // Decode the escape sequences of `value` into unescaped_.  The quote before the
+  // string's end guarantees that a backslash is never its last character.
+  rj::ParseErrorCode Unescape(std::string_view value) {
+    unescaped_->clear();
+    const char* p = value.data();
+    const char* const end = p + value.size();
+    while (p < end) {
+      const char* backslash =
+          static_cast<const char*>(std::memchr(p, '\\', static_cast<size_t>(end - p)));
+      if (backslash == nullptr) {
+        unescaped_->append(p, end);
+        break;
+      }
+      unescaped_->append(p, backslash);
+      p = backslash + 1;
+      switch (*p++) {
+        case '"':
+          unescaped_->push_back('"');
+          break;
+        case '\\':
+          unescaped_->push_back('\\');
+          break;
+        case '/':
+          unescaped_->push_back('/');
+          break;
+        case 'b':
+          unescaped_->push_back('\b');
+          break;
+        case 'f':
+          unescaped_->push_back('\f');
+          break;
+        case 'n':
+          unescaped_->push_back('\n');
+          break;
+        case 'r':
+          unescaped_->push_back('\r');
+          break;
+        case 't':
+          unescaped_->push_back('\t');
+          break;
+        case 'u': {
+          const int codepoint = end - p >= 4 ? ParseHex4(p) : -1;
+          if (codepoint < 0) {
+            return rj::kParseErrorStringUnicodeEscapeInvalidHex;
+          }
+          p += 4;
+          if (codepoint < 0xD800 || codepoint > 0xDFFF) {
+            AppendUtf8(static_cast<uint32_t>(codepoint));
+            break;
+          }
+          // A high surrogate must be followed by an escaped low surrogate
+          if (codepoint > 0xDBFF || end - p < 2 || p[0] != '\\' || p[1] != 'u') {
+            return rj::kParseErrorStringUnicodeSurrogateInvalid;
+          }
+          p += 2;
+          const int low = end - p >= 4 ? ParseHex4(p) : -1;
+          if (low < 0) {
+            return rj::kParseErrorStringUnicodeEscapeInvalidHex;
+          }
+          if (low < 0xDC00 || low > 0xDFFF) {
+            return rj::kParseErrorStringUnicodeSurrogateInvalid;
+          }
+          p += 4;
+          AppendUtf8(
+              static_cast<uint32_t>(((codepoint - 0xD800) << 10) + (low - 0xDC00)) +
+              0x10000);
+          break;
+        }
+        default:
+          return rj::kParseErrorStringEscapeInvalid;
+      }
+    }
+    return rj::kParseErrorNone;
+  }
+
+#undef RETURN_PARSE_ERROR
+
+  const char* data_;
+  const int64_t size_;
+  const std::vector<uint32_t>* positions_;
+  std::string* unescaped_;
+  size_t cursor_ = 0;
+  std::vector<Container> containers_;
+  std::string skipped_closers_;
+};
+
+}  // namespace internal
+}  // namespace json
+}  // namespace arrow
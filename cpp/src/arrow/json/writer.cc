@@ -0,0 +1,561 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/writer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/stl_allocator.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/slice_writer_internal.h"
+#include "arrow/visit_data_inline.h"
+#include "arrow/visit_type_inline.h"
+
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+#  include <xsimd/xsimd.hpp>
+#endif
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::SliceWriter;
+
+namespace json {
+// As in the CSV writer, RecordBatches/Tables are broken into slices of rows which are
+// converted independently, see slice_writer_internal.h.  A slice is converted column
+// by column: a first pass over each column adds the length of its rendered values to
+// the length of each row, which gives the start of each row in a single buffer for the
+// whole slice, then a second pass copies the rendered values of each column, with
+// their keys, into the rows.  Values which are not strings are rendered by casting
+// them to strings with the compute module.
+
+namespace {
+
+constexpr std::string_view kNull = "null";
+// Matching quote pair character length.
+constexpr int64_t kQuoteCount = 2;
+
+// Number of characters added to c by escaping it in a JSON string
+inline int64_t EscapedExtraLength(uint8_t c) {
+  if (c == '"' || c == '\\') {
+    return 1;
+  }
+  if (c >= 0x20) {
+    return 0;
+  }
+  switch (c) {
+    case '\b':
+    case '\f':
+    case '\n':
+    case '\r':
+    case '\t':
+      return 1;
+    default:
+      // \u00XX
+      return 5;
+  }
+}
+
+int64_t EscapedExtraLength(std::string_view s) {
+  int64_t length = 0;
+  for (const char c : s) {
+    length += EscapedExtraLength(static_cast<uint8_t>(c));
+  }
+  return length;
+}
+
+// Copies the contents of s to out escaping the characters which can't appear as
+// such in JSON strings.  Returns the position next to last copied character.
+char* Escape(std::string_view s, char* out) {
+  static constexpr char kHexDigits[] = "0123456789abcdef";
+  for (const char ch : s) {
+    const auto c = static_cast<uint8_t>(ch);
+    if (EscapedExtraLength(c) == 0) {
+      *out++ = ch;
+      continue;
+    }
+    *out++ = '\\';
+    switch (c) {
+      case '"':
+        *out++ = '"';
+        break;
+      case '\\':
+        *out++ = '\\';
+        break;
+      case '\b':
+        *out++ = 'b';
+        break;
+      case '\f':
+        *out++ = 'f';
+        break;
+      case '\n':
+        *out++ = 'n';
+        break;
+      case '\r':
+        *out++ = 'r';
+        break;
+      case '\t':
+        *out++ = 't';
+        break;
+      default:
+        *out++ = 'u';
+        *out++ = '0';
+        *out++ = '0';
+        *out++ = kHexDigits[c >> 4];
+        *out++ = kHexDigits[c & 0xf];
+    }
+  }
+  return out;
+}
+
+// Returns true if any character of data must be escaped in a JSON string
+bool NeedsEscaping(const uint8_t* data, int64_t size) {
+  int64_t offset = 0;
+#if defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
+  using simd_batch = xsimd::make_sized_batch_t<uint8_t, 16>;
+  const simd_batch control_chars_end(static_cast<uint8_t>(0x20));
+  while ((offset + 16) <= size) {
+    const auto v = simd_batch::load_unaligned(data + offset);
+    if (xsimd::any((v < control_chars_end) | (v == '"') | (v == '\\'))) {
+      return true;
+    }
+    offset += 16;
+  }
+#endif
+  for (; offset < size; ++offset) {
+    if (EscapedExtraLength(data[offset]) != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Interface for generating the JSON members of a column.
+// The intended usage is to iteratively call UpdateRowLengths for a column and
+// then PopulateRows.
+class ColumnPopulator {
+ public:
+  // key: the rendered key of the column's members, with the separator before it
+  ColumnPopulator(MemoryPool* pool, std::string key)
+      : key_(std::move(key)), pool_(pool) {}
+
+  virtual ~ColumnPopulator() = default;
+
+  // Adds the number of characters each value in data will add to the elements of
+  // row_lengths.  The lengths of the keys are not included.
+  Status UpdateRowLengths(const Array& data, int64_t* row_lengths) {
+    ARROW_ASSIGN_OR_RAISE(array_, internal::CastToStringArray(data, pool_));
+    UpdateRowLengths(row_lengths);
+    return Status::OK();
+  }
+
+  // Places the member of each row, key and value, onto the row in output and
+  // updates the corresponding row offsets in preparation for calls to other (next)
+  // ColumnPopulators.
+  // Args:
+  //   output: character buffer to write to.
+  //   offsets: an array of start of row member within the output buffer.
+  virtual void PopulateRows(char* output, int64_t* offsets) const = 0;
+
+  int64_t key_length() const { return static_cast<int64_t>(key_.size()); }
+
+ protected:
+  virtual void UpdateRowLengths(int64_t* row_lengths) = 0;
+
+  // Visit the values cast to strings, calling valid_func(std::string_view) for
+  // valid values and null_func() for nulls
+  template <typename ValidFunc, typename NullFunc>
+  void VisitStrings(ValidFunc&& valid_func, NullFunc&& null_func) const {
+    if (array_->type_id() == Type::STRING) {
+      VisitArraySpanInline<StringType>(*array_->data(), valid_func, null_func);
+    } else {
+      DCHECK_EQ(array_->type_id(), Type::LARGE_STRING);
+      VisitArraySpanInline<LargeStringType>(*array_->data(), valid_func, null_func);
+    }
+  }
+
+  char* WriteKey(char* row) const {
+    memcpy(row, key_.data(), key_.size());
+    return row + key_.size();
+  }
+
+  static char* WriteNull(char* row) {
+    memcpy(row, kNull.data(), kNull.size());
+    return row + kNull.size();
+  }
+
+  // It must be a `StringArray` or `LargeStringArray`.
+  std::shared_ptr<Array> array_;
+
+ private:
+  const std::string key_;
+  MemoryPool* const pool_;
+};
+
+// Populator for numbers, booleans and nulls, whose values cast to strings are
+// written as such.  Non-finite floating-point numbers have no JSON representation
+// and are written as nulls.
+class UnquotedColumnPopulator : public ColumnPopulator {
+ public:
+  UnquotedColumnPopulator(MemoryPool* pool, std::string key, bool is_floating)
+      : ColumnPopulator(pool, std::move(key)), is_floating_(is_floating) {}
+
+  void PopulateRows(char* output, int64_t* offsets) const override {
+    VisitStrings(
+        [&](std::string_view s) {
+          char* row = WriteKey(output + *offsets);
+          if (is_floating_ && IsNonFinite(s)) {
+            row = WriteNull(row);
+          } else {
+            memcpy(row, s.data(), s.length());
+            row += s.length();
+          }
+          *offsets++ = static_cast<int64_t>(row - output);
+        },
+        [&]() {
+          char* row = WriteNull(WriteKey(output + *offsets));
+          *offsets++ = static_cast<int64_t>(row - output);
+        });
+  }
+
+ protected:
+  void UpdateRowLengths(int64_t* row_lengths) override {
+    VisitStrings(
+        [&](std::string_view s) {
+          *row_lengths++ += is_floating_ && IsNonFinite(s)
+                                ? static_cast<int64_t>(kNull.size())
+                                : static_cast<int64_t>(s.length());
+        },
+        [&]() { *row_lengths++ += static_cast<int64_t>(kNull.size()); });
+  }
+
+ private:
+  // Whether s is the rendering of a NaN or an infinity
+  static bool IsNonFinite(std::string_view s) {
+    return s == "nan" || s == "inf" || s == "-inf";
+  }
+
+  const bool is_floating_;
+};
+
+// Populator for strings, binary data and temporal values, which are quoted and
+// escaped.  As in most data no character needs escaping, the whole character data of
+// the column is first checked at once; escaped lengths are only computed otherwise.
+// JSON strings are Unicode text: binary data is written as its bytes, which must be
+// valid UTF-8, as the cast to strings checks.
+class QuotedColumnPopulator : public ColumnPopulator {
+ public:
+  QuotedColumnPopulator(MemoryPool* pool, std::string key)
+      : ColumnPopulator(pool, std::move(key)) {}
+
+  void PopulateRows(char* output, int64_t* offsets) const override {
+    int64_t row_number = 0;
+    VisitStrings(
+        [&](std::string_view s) {
+          char* row = WriteKey(output + *offsets);
+          *row++ = '"';
+          if (!any_needs_escaping_ || !row_needs_escaping_[row_number]) {
+            memcpy(row, s.data(), s.length());
+            row += s.length();
+          } else {
+            row = Escape(s, row);
+          }
+          *row++ = '"';
+          *offsets++ = static_cast<int64_t>(row - output);
+          ++row_number;
+        },
+        [&]() {
+          char* row = WriteNull(WriteKey(output + *offsets));
+          *offsets++ = static_cast<int64_t>(row - output);
+          ++row_number;
+        });
+  }
+
+ protected:
+  void UpdateRowLengths(int64_t* row_lengths) override {
+    any_needs_escaping_ = ArrayNeedsEscaping();
+    if (!any_needs_escaping_) {
+      // fast path if nothing to escape
+      VisitStrings(
+          [&](std::string_view s) {
+            *row_lengths++ += static_cast<int64_t>(s.length()) + kQuoteCount;
+          },
+          [&]() { *row_lengths++ += static_cast<int64_t>(kNull.size()); });
+      return;
+    }
+    row_needs_escaping_.assign(array_->length(), false);
+    int64_t row_number = 0;
+    VisitStrings(
+        [&](std::string_view s) {
+          const int64_t escaped_count = EscapedExtraLength(s);
+          row_needs_escaping_[row_number++] = escaped_count > 0;
+          *row_lengths++ +=
+              static_cast<int64_t>(s.length()) + escaped_count + kQuoteCount;
+        },
+        [&]() {
+          ++row_number;
+          *row_lengths++ += static_cast<int64_t>(kNull.size());
+        });
+  }
+
+ private:
+  // Returns true if any character of the string array must be escaped
+  bool ArrayNeedsEscaping() const {
+    if (array_->type_id() == Type::STRING) {
+      const auto& strings = checked_cast<const StringArray&>(*array_);
+      return NeedsEscaping(strings.raw_data() + strings.value_offset(0),
+                           strings.total_values_length());
+    }
+    const auto& strings = checked_cast<const LargeStringArray&>(*array_);
+    return NeedsEscaping(strings.raw_data() + strings.value_offset(0),
+                         strings.total_values_length());
+  }
+
+  bool any_needs_escaping_ = false;
+  std::vector<bool> row_needs_escaping_;
+};
+
+Result<std::unique_ptr<ColumnPopulator>> MakePopulator(const DataType& type,
+                                                       const std::string& key,
+                                                       MemoryPool* pool) {
+  auto make_populator =
+      [&](const auto& type) -> Result<std::unique_ptr<ColumnPopulator>> {
+    using Type = std::decay_t<decltype(type)>;
+
+    if constexpr (is_floating_type<Type>::value) {
+      return std::make_unique<UnquotedColumnPopulator>(pool, key,
+                                                       /*is_floating=*/true);
+    }
+    if constexpr (is_integer_type<Type>::value || is_boolean_type<Type>::value ||
+                  is_decimal_type<Type>::value || is_null_type<Type>::value) {
+      return std::make_unique<UnquotedColumnPopulator>(pool, key,
+                                                       /*is_floating=*/false);
+    }
+    if constexpr (is_base_binary_type<Type>::value ||
+                  is_binary_view_like_type<Type>::value ||
+                  std::is_same<Type, FixedSizeBinaryType>::value ||
+                  is_temporal_type<Type>::value) {
+      return std::make_unique<QuotedColumnPopulator>(pool, key);
+    }
+    if constexpr (std::is_same<Type, DictionaryType>::value) {
+      return MakePopulator(*type.value_type(), key, pool);
+    }
+
+    return Status::NotImplemented("Writing JSON values of type ", type.ToString());
+  };
+  return VisitType(type, make_populator);
+}
+
+Result<std::vector<std::unique_ptr<ColumnPopulator>>> MakePopulators(
+    const Schema& schema, const WriteOptions& options) {
+  std::vector<std::unique_ptr<ColumnPopulator>> populators(schema.num_fields());
+  for (int col = 0; col < schema.num_fields(); col++) {
+    const std::string& name = schema.field(col)->name();
+    // The key of each member, preceded by the separator from the previous member
+    std::string key(name.size() + EscapedExtraLength(name) + kQuoteCount + 2, '\0');
+    char* next = key.data();
+    if (col > 0) {
+      *next++ = ',';
+    }
+    *next++ = '"';
+    next = Escape(name, next);
+    *next++ = '"';
+    *next++ = ':';
+    key.resize(next - key.data());
+    ARROW_ASSIGN_OR_RAISE(
+        populators[col],
+        MakePopulator(*schema.field(col)->type(), key, options.io_context.pool()));
+  }
+  return populators;
+}
+
+// Converts slices of rows to JSON data.  Each formatter has its own populators and
+// data buffer, so that several of them can convert different slices concurrently.
+class JSONSliceFormatter : public internal::SliceFormatter {
+ public:
+  static Result<std::unique_ptr<internal::SliceFormatter>> Make(
+      const Schema& schema, const WriteOptions& options) {
+    ARROW_ASSIGN_OR_RAISE(auto populators, MakePopulators(schema, options));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> data_buffer,
+                          AllocateResizableBuffer(0, options.io_context.pool()));
+    return std::make_unique<JSONSliceFormatter>(std::move(populators),
+                                                std::move(data_buffer), options);
+  }
+
+  JSONSliceFormatter(std::vector<std::unique_ptr<ColumnPopulator>> populators,
+                     std::shared_ptr<ResizableBuffer> data_buffer,
+                     const WriteOptions& options)
+      : internal::SliceFormatter(std::move(data_buffer)),
+        column_populators_(std::move(populators)),
+        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())) {}
+
+  Status Format(const RecordBatch& batch) override {
+    if (batch.num_rows() == 0) {
+      return data_buffer_->Resize(0, /*shrink_to_fit=*/false);
+    }
+    offsets_.resize(batch.num_rows());
+    std::fill(offsets_.begin(), offsets_.end(), 0);
+
+    // Calculate the length of the values of each row
+    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
+      RETURN_NOT_OK(
+          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
+    }
+    // Calculate cumulative offsets for each row (including keys and braces).
+    // - before conversion: offsets_[i] = length of the values of i-th row
+    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
+    // Each row is '{' + (key + value) * num_columns + '}' + '\n'
+    int64_t structure_length = 3;
+    for (const auto& populator : column_populators_) {
+      structure_length += populator->key_length();
+    }
+    int64_t last_row_length = offsets_[0] + structure_length;
+    offsets_[0] = 0;
+    for (size_t row = 1; row < offsets_.size(); ++row) {
+      const int64_t this_row_length = offsets_[row] + structure_length;
+      offsets_[row] = offsets_[row - 1] + last_row_length;
+      last_row_length = this_row_length;
+    }
+    // Resize the target buffer to required size. We assume batch to batch sizes
+    // should be pretty close so don't shrink the buffer to avoid allocation churn.
+    RETURN_NOT_OK(
+        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
+
+    // Use the offsets to populate contents.
+    char* output = reinterpret_cast<char*>(data_buffer_->mutable_data());
+    for (int64_t& offset : offsets_) {
+      output[offset++] = '{';
+    }
+    for (const auto& populator : column_populators_) {
+      populator->PopulateRows(output, offsets_.data());
+    }
+    for (int64_t& offset : offsets_) {
+      output[offset++] = '}';
+      output[offset++] = '\n';
+    }
+    DCHECK_EQ(data_buffer_->size(), offsets_.back());
+    return Status::OK();
+  }
+
+ private:
+  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
+  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
+};
+
+class JSONWriterImpl : public ipc::RecordBatchWriter {
+ public:
+  static Result<std::shared_ptr<JSONWriterImpl>> Make(
+      io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
+      std::shared_ptr<Schema> schema, const WriteOptions& options) {
+    RETURN_NOT_OK(options.Validate());
+    ARROW_ASSIGN_OR_RAISE(
+        auto slice_writer,
+        SliceWriter::Make(sink, options.use_threads, [&] {
+          return JSONSliceFormatter::Make(*schema, options);
+        }));
+    return std::make_shared<JSONWriterImpl>(std::move(owned_sink), std::move(schema),
+                                            std::move(slice_writer), options);
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    return slice_writer_->WriteRecordBatch(batch, options_.batch_size);
+  }
+
+  Status WriteTable(const Table& table, int64_t max_chunksize) override {
+    return slice_writer_->WriteTable(
+        table, max_chunksize > 0 ? max_chunksize : options_.batch_size);
+  }
+
+  Status Close() override { return Status::OK(); }
+
+  ipc::WriteStats stats() const override {
+    ipc::WriteStats stats;
+    stats.num_record_batches = slice_writer_->num_slices_written();
+    return stats;
+  }
+
+  JSONWriterImpl(std::shared_ptr<io::OutputStream> owned_sink,
+                 std::shared_ptr<Schema> schema,
+                 std::unique_ptr<SliceWriter> slice_writer, const WriteOptions& options)
+      : owned_sink_(std::move(owned_sink)),
+        slice_writer_(std::move(slice_writer)),
+        schema_(std::move(schema)),
+        options_(options) {}
+
+ private:
+  std::shared_ptr<io::OutputStream> owned_sink_;
+  std::unique_ptr<SliceWriter> slice_writer_;
+  const std::shared_ptr<Schema> schema_;
+  const WriteOptions options_;
+};
+
+}  // namespace
+
+Status WriteJSON(const Table& table, const WriteOptions& options,
+                 arrow::io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeJSONWriter(output, table.schema(), options));
+  RETURN_NOT_OK(writer->WriteTable(table));
+  return writer->Close();
+}
+
+Status WriteJSON(const RecordBatch& batch, const WriteOptions& options,
+                 arrow::io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeJSONWriter(output, batch.schema(), options));
+  RETURN_NOT_OK(writer->WriteRecordBatch(batch));
+  return writer->Close();
+}
+
+Status WriteJSON(const std::shared_ptr<RecordBatchReader>& reader,
+                 const WriteOptions& options, arrow::io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeJSONWriter(output, reader->schema(), options));
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(batch, reader->Next());
+    if (batch == nullptr) break;
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  return writer->Close();
+}
+
+ARROW_EXPORT
+Result<std::shared_ptr<ipc::RecordBatchWriter>> MakeJSONWriter(
+    std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
+    const WriteOptions& options) {
+  return JSONWriterImpl::Make(sink.get(), sink, schema, options);
+}
+
+ARROW_EXPORT
+Result<std::shared_ptr<ipc::RecordBatchWriter>> MakeJSONWriter(
+    io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+    const WriteOptions& options) {
+  return JSONWriterImpl::Make(sink, nullptr, schema, options);
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,204 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "arrow/array/builder_binary.h"
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/json/reader.h"
+#include "arrow/json/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace json {
+
+namespace {
+
+WriteOptions TestOptions(bool use_threads = false, int32_t batch_size = 5) {
+  auto options = WriteOptions::Defaults();
+  options.use_threads = use_threads;
+  options.batch_size = batch_size;
+  return options;
+}
+
+Result<std::string> WriteToString(const RecordBatch& batch,
+                                  const WriteOptions& options = TestOptions()) {
+  ARROW_ASSIGN_OR_RAISE(auto out, io::BufferOutputStream::Create());
+  RETURN_NOT_OK(WriteJSON(batch, options, out.get()));
+  ARROW_ASSIGN_OR_RAISE(auto buffer, out->Finish());
+  return buffer->ToString();
+}
+
+Result<std::string> WriteToString(const Table& table,
+                                  const WriteOptions& options = TestOptions()) {
+  ARROW_ASSIGN_OR_RAISE(auto out, io::BufferOutputStream::Create());
+  RETURN_NOT_OK(WriteJSON(table, options, out.get()));
+  ARROW_ASSIGN_OR_RAISE(auto buffer, out->Finish());
+  return buffer->ToString();
+}
+
+}  // namespace
+
+TEST(WriteJSON, Basics) {
+  auto schema = ::arrow::schema({field("int", int32()), field("double", float64()),
+                                 field("bool", boolean()), field("str", utf8()),
+                                 field("null", null()), field("date", date32()),
+                                 field("dict", dictionary(int8(), utf8()))});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [1, 1.5, true, "a", null, 1, "x"],
+    [null, null, false, null, null, null, null],
+    [-3, 2, null, "", null, 0, "y"]
+  ])");
+  ASSERT_OK_AND_ASSIGN(auto actual, WriteToString(*batch));
+  ASSERT_EQ(actual,
+            R"({"int":1,"double":1.5,"bool":true,"str":"a","null":null,)"
+            R"("date":"1970-01-02","dict":"x"})"
+            "\n"
+            R"({"int":null,"double":null,"bool":false,"str":null,"null":null,)"
+            R"("date":null,"dict":null})"
+            "\n"
+            R"({"int":-3,"double":2,"bool":null,"str":"","null":null,)"
+            R"("date":"1970-01-01","dict":"y"})"
+            "\n");
+}
+
+TEST(WriteJSON, Escaping) {
+  // Both keys and string values are escaped
+  auto schema = ::arrow::schema({field("a\"b", utf8()), field("c", large_binary())});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    ["quote \" backslash \\ slash /", "tab \t newline \n control \u0001"],
+    ["plain", "été"]
+  ])");
+  ASSERT_OK_AND_ASSIGN(auto actual, WriteToString(*batch));
+  ASSERT_EQ(actual,
+            R"({"a\"b":"quote \" backslash \\ slash /",)"
+            R"("c":"tab \t newline \n control \u0001"})"
+            "\n"
+            R"({"a\"b":"plain","c":"été"})"
+            "\n");
+}
+
+TEST(WriteJSON, InvalidUtf8Binary) {
+  // JSON strings can't hold arbitrary bytes: binary data which isn't valid UTF-8 is
+  // rejected rather than written as invalid JSON
+  BinaryBuilder binary_builder;
+  LargeBinaryBuilder large_binary_builder;
+  ASSERT_OK(binary_builder.Append("ok"));
+  ASSERT_OK(binary_builder.Append("\xff\xfe"));
+  ASSERT_OK(large_binary_builder.Append("ok"));
+  ASSERT_OK(large_binary_builder.Append("\xff\xfe"));
+  ASSERT_OK_AND_ASSIGN(auto binary_array, binary_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto large_binary_array, large_binary_builder.Finish());
+  for (const auto& array : {binary_array, large_binary_array}) {
+    ARROW_SCOPED_TRACE("type = ", array->type()->ToString());
+    auto batch = RecordBatch::Make(::arrow::schema({field("b", array->type())}),
+                                   array->length(), {array});
+    for (bool use_threads : {false, true}) {
+      EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("Invalid UTF8"),
+                                      WriteToString(*batch, TestOptions(use_threads)));
+    }
+  }
+}
+
+TEST(WriteJSON, NonFiniteFloats) {
+  auto batch = RecordBatch::Make(
+      ::arrow::schema({field("f", float32())}), 4,
+      {ArrayFromJSON(float32(), "[1.5, NaN, Inf, -Inf]")});
+  ASSERT_OK_AND_ASSIGN(auto actual, WriteToString(*batch));
+  ASSERT_EQ(actual, "{\"f\":1.5}\n{\"f\":null}\n{\"f\":null}\n{\"f\":null}\n");
+}
+
+TEST(WriteJSON, EmptyInputs) {
+  auto schema = ::arrow::schema({field("a", int32())});
+  ASSERT_OK_AND_ASSIGN(auto actual, WriteToString(*RecordBatchFromJSON(schema, "[]")));
+  ASSERT_EQ(actual, "");
+
+  // Rows without columns are empty objects
+  auto no_columns = RecordBatch::Make(::arrow::schema({}), 2, ArrayVector{});
+  ASSERT_OK_AND_ASSIGN(actual, WriteToString(*no_columns));
+  ASSERT_EQ(actual, "{}\n{}\n");
+}
+
+TEST(WriteJSON, UnsupportedType) {
+  auto schema = ::arrow::schema({field("a", list(int32()))});
+  ASSERT_RAISES(NotImplemented, WriteToString(*RecordBatchFromJSON(schema, "[[[1]]]")));
+  ASSERT_RAISES(Invalid,
+                WriteToString(*RecordBatchFromJSON(schema, "[]"), TestOptions(false, 0)));
+}
+
+TEST(WriteJSON, ThreadedMatchesSerial) {
+  auto schema = ::arrow::schema(
+      {field("i", int64()), field("d", float64()), field("s", utf8()),
+       field("b", boolean())});
+  auto batch = random::GenerateBatch(schema->fields(), /*size=*/10000, /*seed=*/42);
+  ASSERT_OK_AND_ASSIGN(auto expected, WriteToString(*batch, TestOptions(false, 1 << 20)));
+  for (int32_t batch_size : {1, 7, 1000}) {
+    ARROW_SCOPED_TRACE("batch_size = ", batch_size);
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         WriteToString(*batch, TestOptions(true, batch_size)));
+    ASSERT_EQ(actual, expected);
+  }
+}
+
+TEST(WriteJSON, RoundTrip) {
+  auto schema =
+      ::arrow::schema({field("i", int64()), field("d", float64()), field("s", utf8()),
+                       field("b", boolean())});
+  auto table = TableFromJSON(schema, {R"([
+    [1, 0.25, "a\nb", true],
+    [null, -1e10, null, false]
+  ])",
+                                      R"([
+    [3, null, "\"quoted\" \\ \u0002", null]
+  ])"});
+  ASSERT_OK_AND_ASSIGN(auto json, WriteToString(*table, TestOptions(true, 1)));
+
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.explicit_schema = schema;
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      TableReader::Make(default_memory_pool(),
+                        std::make_shared<io::BufferReader>(Buffer::FromString(json)),
+                        ReadOptions::Defaults(), parse_options));
+  ASSERT_OK_AND_ASSIGN(auto actual, reader->Read());
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(MakeJSONWriter, Batches) {
+  auto schema = ::arrow::schema({field("a", int32())});
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeJSONWriter(out, schema, TestOptions()));
+  ASSERT_OK(writer->WriteRecordBatch(*RecordBatchFromJSON(schema, "[[1], [2]]")));
+  ASSERT_OK(writer->WriteRecordBatch(*RecordBatchFromJSON(schema, "[[null]]")));
+  ASSERT_OK(writer->Close());
+  ASSERT_EQ(writer->stats().num_record_batches, 2);
+  ASSERT_OK_AND_ASSIGN(auto buffer, out->Finish());
+  ASSERT_EQ(buffer->ToString(), "{\"a\":1}\n{\"a\":2}\n{\"a\":null}\n");
+}
+
+}  // namespace json
+}  // namespace arrow
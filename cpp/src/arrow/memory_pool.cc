@@ -18,14 +18,25 @@
 #include "arrow/memory_pool_internal.h"
 
 #include <algorithm>  // IWYU pragma: keep
+#include <array>
 #include <atomic>
 #include <cstdlib>   // IWYU pragma: keep
 #include <cstring>   // IWYU pragma: keep
 #include <iostream>  // IWYU pragma: keep
 #include <limits>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+
+#ifdef __linux__
+#  include <sys/mman.h>
+#endif
 
 #if defined(sun) || defined(__sun)
 #  include <stdlib.h>
@@ -37,10 +48,15 @@
 #include "arrow/status.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/config.h"
+
+#ifdef ARROW_WITH_BACKTRACE
+#  include <execinfo.h>
+#endif
 #include "arrow/util/debug.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
+#include "arrow/util/numa_internal.h"
 #include "arrow/util/string.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/ubsan.h"
@@ -849,6 +865,1340 @@ int64_t ProxyMemoryPool::num_allocations() const { return impl_->num_allocations
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// ProfilingMemoryPool implementation
+
+namespace {
+
+thread_local const std::string* t_allocation_tag = nullptr;
+
+// The sampling state of a thread, shared by the profiling pools
+struct ThreadSamplingState {
+  int64_t bytes_until_sample = -1;
+  std::mt19937_64 rng{static_cast<uint64_t>(internal::GetRandomSeed())};
+};
+
+thread_local ThreadSamplingState t_sampling_state;
+
+// A minimal encoder of protocol buffers, enough for the pprof profile.proto
+class ProtoWriter {
+ public:
+  void Varint(uint64_t value) {
+    while (value >= 0x80) {
+      out_.push_back(static_cast<char>(value | 0x80));
+      value >>= 7;
+    }
+    out_.push_back(static_cast<char>(value));
+  }
+
+  void Int(int field, int64_t value) {
+    Varint(static_cast<uint64_t>(field) << 3);
+    Varint(static_cast<uint64_t>(value));
+  }
+
+  void Bytes(int field, std::string_view bytes) {
+    Varint(static_cast<uint64_t>(field) << 3 | 2);
+    Varint(bytes.size());
+    out_.append(bytes);
+  }
+
+  void Message(int field, const ProtoWriter& message) { Bytes(field, message.out_); }
+
+  void Packed(int field, const std::vector<int64_t>& values) {
+    ProtoWriter packed;
+    for (int64_t value : values) {
+      packed.Varint(static_cast<uint64_t>(value));
+    }
+    Message(field, packed);
+  }
+
+  std::string Finish() { return std::move(out_); }
+
+ private:
+  std::string out_;
+};
+
+// The interned strings of a pprof profile
+class StringTable {
+ public:
+  StringTable() { Intern(""); }
+
+  int64_t Intern(const std::string& string) {
+    auto [it, inserted] = indices_.emplace(string, static_cast<int64_t>(strings_.size()));
+    if (inserted) {
+      strings_.push_back(string);
+    }
+    return it->second;
+  }
+
+  const std::vector<std::string>& strings() const { return strings_; }
+
+ private:
+  std::unordered_map<std::string, int64_t> indices_;
+  std::vector<std::string> strings_;
+};
+
+// The name of the function at `address` as found by backtrace_symbols(), of the
+// form "binary(symbol+offset) [address]"
+std::string FrameName(void* address) {
+#ifdef ARROW_WITH_BACKTRACE
+  char** symbols = backtrace_symbols(&address, 1);
+  if (symbols != nullptr) {
+    std::string_view symbol(symbols[0]);
+    const auto open = symbol.find('(');
+    const auto close = symbol.find_first_of("+)", open);
+    std::string name;
+    if (open != std::string_view::npos && close != std::string_view::npos &&
+        close > open + 1) {
+      name = std::string(symbol.substr(open + 1, close - open - 1));
+    }
+    std::free(symbols);
+    if (!name.empty()) {
+      return name;
+    }
+  }
+#endif
+  std::stringstream ss;
+  ss << address;
+  return ss.str();
+}
+
+}  // namespace
+
+ScopedAllocationTag::ScopedAllocationTag(std::string tag)
+    : tag_(std::move(tag)), previous_(t_allocation_tag) {
+  t_allocation_tag = &tag_;
+}
+
+ScopedAllocationTag::~ScopedAllocationTag() { t_allocation_tag = previous_; }
+
+const std::string& ScopedAllocationTag::current() {
+  static const std::string kNoTag;
+  return t_allocation_tag != nullptr ? *t_allocation_tag : kNoTag;
+}
+
+class ProfilingMemoryPool::ProfilingMemoryPoolImpl {
+ public:
+  ProfilingMemoryPoolImpl(MemoryPool* pool, ProfilingOptions options)
+      : pool_(pool), options_(options) {}
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+    RETURN_NOT_OK(pool_->Allocate(size, alignment, out));
+    stats_.DidAllocateBytes(size);
+    MaybeSample(*out, size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) {
+    uint8_t* old_ptr = *ptr;
+    // Once reallocated, another thread may get old_ptr back and sample it, so its
+    // sample must be taken out before
+    std::optional<Sample> old_sample = Take(old_ptr);
+    Status st = pool_->Reallocate(old_size, new_size, alignment, ptr);
+    if (!st.ok()) {
+      if (old_sample) {
+        Record(old_ptr, std::move(*old_sample));
+      }
+      return st;
+    }
+    stats_.DidReallocateBytes(old_size, new_size);
+    MaybeSample(*ptr, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+    Take(buffer);
+    pool_->Free(buffer, size, alignment);
+    stats_.DidFreeBytes(size);
+  }
+
+  std::unordered_map<std::string, int64_t> LiveBytesByTag() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unordered_map<std::string, int64_t> live_bytes;
+    for (const auto& [address, sample] : samples_) {
+      live_bytes[sample.tag] += sample.weight;
+    }
+    return live_bytes;
+  }
+
+  std::string HeapProfile() const {
+    // Aggregate the live samples by stack and tag.  The keys point into samples_,
+    // which stays locked while they are used, but compare the stacks and tags
+    // themselves so that allocations made at the same place are merged.
+    struct Aggregate {
+      const std::vector<void*>* stack;
+      const std::string* tag;
+      int64_t objects = 0;
+      int64_t bytes = 0;
+    };
+    using AggregateKey = std::pair<const std::vector<void*>*, const std::string*>;
+    struct AggregateKeyLess {
+      bool operator()(const AggregateKey& left, const AggregateKey& right) const {
+        return std::tie(*left.first, *left.second) <
+               std::tie(*right.first, *right.second);
+      }
+    };
+    std::map<AggregateKey, Aggregate, AggregateKeyLess> aggregates;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (const auto& [address, sample] : samples_) {
+      auto& aggregate = aggregates[{&sample.stack, &sample.tag}];
+      aggregate.stack = &sample.stack;
+      aggregate.tag = &sample.tag;
+      // Sampled allocations stand for weight / size allocations of their size
+      aggregate.objects += std::max<int64_t>(1, sample.weight / std::max<int64_t>(
+                                                    sample.size, 1));
+      aggregate.bytes += sample.weight;
+    }
+
+    StringTable strings;
+    ProtoWriter profile;
+    auto value_type = [&](int field, const char* type, const char* unit) {
+      ProtoWriter message;
+      message.Int(1, strings.Intern(type));
+      message.Int(2, strings.Intern(unit));
+      profile.Message(field, message);
+    };
+    value_type(/*sample_type=*/1, "inuse_objects", "count");
+    value_type(/*sample_type=*/1, "inuse_space", "bytes");
+
+    // Locations and functions are numbered from 1, one per distinct frame
+    std::unordered_map<void*, int64_t> location_ids;
+    std::unordered_map<std::string, int64_t> function_ids;
+    std::vector<std::pair<void*, int64_t>> locations;  // address, function id
+    std::vector<std::string> functions;
+    auto function_id = [&](const std::string& name) {
+      auto [it, inserted] =
+          function_ids.emplace(name, static_cast<int64_t>(functions.size()) + 1);
+      if (inserted) {
+        functions.push_back(name);
+      }
+      return it->second;
+    };
+    auto location_id = [&](void* address, const std::string& name) {
+      auto it = location_ids.find(address);
+      if (it == location_ids.end()) {
+        it = location_ids
+                 .emplace(address, static_cast<int64_t>(locations.size()) + 1)
+                 .first;
+        locations.emplace_back(address, function_id(name));
+      }
+      return it->second;
+    };
+
+    const int64_t tag_key = strings.Intern("tag");
+    for (const auto& [key, aggregate] : aggregates) {
+      std::vector<int64_t> sample_locations;
+      for (void* frame : *aggregate.stack) {
+        sample_locations.push_back(location_id(frame, FrameName(frame)));
+      }
+      if (sample_locations.empty()) {
+        // Without stacks, a synthetic frame per tag still tells them apart
+        const std::string& name =
+            aggregate.tag->empty() ? std::string("<untagged>") : *aggregate.tag;
+        sample_locations.push_back(location_id(
+            reinterpret_cast<void*>(static_cast<uintptr_t>(function_id(name))), name));
+      }
+      ProtoWriter sample;
+      sample.Packed(1, sample_locations);
+      sample.Packed(2, {aggregate.objects, aggregate.bytes});
+      if (!aggregate.tag->empty()) {
+        ProtoWriter label;
+        label.Int(1, tag_key);
+        label.Int(2, strings.Intern(*aggregate.tag));
+        sample.Message(3, label);
+      }
+      profile.Message(/*sample=*/2, sample);
+    }
+    lock.unlock();
+
+    for (size_t i = 0; i < locations.size(); ++i) {
+      ProtoWriter line;
+      line.Int(1, locations[i].second);
+      ProtoWriter location;
+      location.Int(1, static_cast<int64_t>(i) + 1);
+      location.Int(3, static_cast<int64_t>(
+                          reinterpret_cast<uintptr_t>(locations[i].first)));
+      location.Message(4, line);
+      profile.Message(/*location=*/4, location);
+    }
+    for (size_t i = 0; i < functions.size(); ++i) {
+      ProtoWriter function;
+      function.Int(1, static_cast<int64_t>(i) + 1);
+      function.Int(2, strings.Intern(functions[i]));
+      function.Int(3, strings.Intern(functions[i]));
+      profile.Message(/*function=*/5, function);
+    }
+    for (const auto& string : strings.strings()) {
+      profile.Bytes(/*string_table=*/6, string);
+    }
+    value_type(/*period_type=*/11, "space", "bytes");
+    profile.Int(/*period=*/12, std::max<int64_t>(options_.sampling_interval, 1));
+    return profile.Finish();
+  }
+
+  MemoryPool* pool() const { return pool_; }
+  const internal::MemoryPoolStats& stats() const { return stats_; }
+
+ private:
+  struct Sample {
+    int64_t size;
+    // The estimated bytes allocated by the allocations this one stands for
+    int64_t weight;
+    std::vector<void*> stack;
+    std::string tag;
+  };
+
+  // Whether to sample an allocation of `size` bytes, and its weight if so
+  bool ShouldSample(int64_t size, int64_t* weight) {
+    const int64_t interval = options_.sampling_interval;
+    if (interval <= 1) {
+      *weight = size;
+      return true;
+    }
+    auto& state = t_sampling_state;
+    if (state.bytes_until_sample < 0) {
+      state.bytes_until_sample = NextSampleDistance(interval);
+    }
+    state.bytes_until_sample -= size;
+    if (state.bytes_until_sample >= 0) {
+      return false;
+    }
+    state.bytes_until_sample = NextSampleDistance(interval);
+    // An allocation of `size` bytes is sampled with probability 1 - exp(-size / interval)
+    const double probability =
+        -std::expm1(-static_cast<double>(size) / static_cast<double>(interval));
+    *weight = static_cast<int64_t>(static_cast<double>(size) / probability);
+    return true;
+  }
+
+  static int64_t NextSampleDistance(int64_t interval) {
+    std::exponential_distribution<double> distribution(1.0 /
+                                                       static_cast<double>(interval));
+    return static_cast<int64_t>(distribution(t_sampling_state.rng));
+  }
+
+  void MaybeSample(uint8_t* address, int64_t size) {
+    int64_t weight;
+    if (size <= 0 || !ShouldSample(size, &weight)) {
+      return;
+    }
+    Record(address,
+           Sample{size, weight, CaptureStack(), ScopedAllocationTag::current()});
+  }
+
+  // The number of live samples whose address hashes to each slot.  Most freed
+  // blocks were not sampled, and finding a zero here tells so without locking.
+  static constexpr int kSampledSlotBits = 12;
+
+  static size_t SampledSlot(const uint8_t* address) {
+    // Blocks are at least 16-byte aligned by the allocators
+    const uint64_t bits = reinterpret_cast<uintptr_t>(address) >> 4;
+    return static_cast<size_t>((bits * 0x9E3779B97F4A7C15ULL) >>
+                               (64 - kSampledSlotBits));
+  }
+
+  void Record(uint8_t* address, Sample sample) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto [it, inserted] = samples_.insert_or_assign(address, std::move(sample));
+    if (inserted) {
+      sampled_slots_[SampledSlot(address)].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  // Remove the sample of the block at `address`, if it was sampled
+  std::optional<Sample> Take(uint8_t* address) {
+    // The block was allocated, and so sampled, before the caller got it, which
+    // orders the increment of its slot before this load
+    auto& slot = sampled_slots_[SampledSlot(address)];
+    if (slot.load(std::memory_order_relaxed) == 0) {
+      return std::nullopt;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = samples_.find(address);
+    if (it == samples_.end()) {
+      return std::nullopt;
+    }
+    std::optional<Sample> sample = std::move(it->second);
+    samples_.erase(it);
+    slot.fetch_sub(1, std::memory_order_relaxed);
+    return sample;
+  }
+
+  std::vector<void*> CaptureStack() const {
+    std::vector<void*> stack;
+#ifdef ARROW_WITH_BACKTRACE
+    if (options_.max_stack_depth > 0) {
+      // Skip the frames of the pool itself
+      constexpr int kSkippedFrames = 3;
+      stack.resize(options_.max_stack_depth + kSkippedFrames);
+      const int depth = backtrace(stack.data(), static_cast<int>(stack.size()));
+      stack.resize(std::max(depth, kSkippedFrames));
+      stack.erase(stack.begin(), stack.begin() + kSkippedFrames);
+    }
+#endif
+    return stack;
+  }
+
+  MemoryPool* pool_;
+  const ProfilingOptions options_;
+  internal::MemoryPoolStats stats_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<uint8_t*, Sample> samples_;
+  std::array<std::atomic<int32_t>, 1 << kSampledSlotBits> sampled_slots_{};
+};
+
+ProfilingMemoryPool::ProfilingMemoryPool(MemoryPool* pool, ProfilingOptions options)
+    : impl_(new ProfilingMemoryPoolImpl(pool, options)) {}
+
+ProfilingMemoryPool::~ProfilingMemoryPool() {}
+
+Status ProfilingMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  return impl_->Allocate(size, alignment, out);
+}
+
+Status ProfilingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       int64_t alignment, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, alignment, ptr);
+}
+
+void ProfilingMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  impl_->Free(buffer, size, alignment);
+}
+
+void ProfilingMemoryPool::ReleaseUnused() { impl_->pool()->ReleaseUnused(); }
+
+void ProfilingMemoryPool::PrintStats() { impl_->pool()->PrintStats(); }
+
+int64_t ProfilingMemoryPool::bytes_allocated() const {
+  return impl_->stats().bytes_allocated();
+}
+
+int64_t ProfilingMemoryPool::max_memory() const { return impl_->stats().max_memory(); }
+
+int64_t ProfilingMemoryPool::total_bytes_allocated() const {
+  return impl_->stats().total_bytes_allocated();
+}
+
+int64_t ProfilingMemoryPool::num_allocations() const {
+  return impl_->stats().num_allocations();
+}
+
+std::string ProfilingMemoryPool::backend_name() const {
+  return impl_->pool()->backend_name();
+}
+
+std::unordered_map<std::string, int64_t> ProfilingMemoryPool::LiveBytesByTag() const {
+  return impl_->LiveBytesByTag();
+}
+
+std::string ProfilingMemoryPool::HeapProfile() const { return impl_->HeapProfile(); }
+
+///////////////////////////////////////////////////////////////////////
+// HierarchicalMemoryPool implementation
+
+namespace {
+
+// Set while spill callbacks run on this thread, so that their own allocations don't
+// spill again
+thread_local bool t_spilling = false;
+
+}  // namespace
+
+class HierarchicalMemoryPool::Impl {
+ public:
+  Impl(MemoryPool* allocator, std::shared_ptr<Impl> parent, std::string name,
+       MemoryBudget budget)
+      : allocator_(allocator),
+        parent_(std::move(parent)),
+        name_(std::move(name)),
+        budget_(budget) {}
+
+  MemoryPool* allocator() const { return allocator_; }
+  const std::string& name() const { return name_; }
+  const MemoryBudget& budget() const { return budget_; }
+  internal::MemoryPoolStats& stats() { return stats_; }
+
+  int64_t bytes_used() const { return used_.load(std::memory_order_acquire); }
+  int64_t bytes_reserved() const { return reserved_.load(std::memory_order_acquire); }
+
+  void AddChild(const std::shared_ptr<Impl>& child) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    children_.push_back(child);
+  }
+
+  // Add `size` bytes to the usage of this pool and its ancestors, or return the pool
+  // whose hard limit this would exceed and leave the usages unchanged
+  Impl* TryCharge(int64_t size) {
+    for (Impl* pool = this; pool != nullptr; pool = pool->parent_.get()) {
+      const int64_t used = pool->used_.fetch_add(size, std::memory_order_acq_rel) + size;
+      if (used > pool->budget_.hard_limit) {
+        for (Impl* charged = this;; charged = charged->parent_.get()) {
+          charged->used_.fetch_sub(size, std::memory_order_acq_rel);
+          if (charged == pool) {
+            break;
+          }
+        }
+        return pool;
+      }
+    }
+    return nullptr;
+  }
+
+  void Uncharge(int64_t size) {
+    for (Impl* pool = this; pool != nullptr; pool = pool->parent_.get()) {
+      pool->used_.fetch_sub(size, std::memory_order_acq_rel);
+    }
+  }
+
+  Status Charge(int64_t size, bool may_spill) {
+    may_spill = may_spill && !t_spilling;
+    Impl* exceeded = TryCharge(size);
+    if (exceeded != nullptr && may_spill) {
+      exceeded->Spill(exceeded->bytes_used() + size - exceeded->budget_.hard_limit);
+      exceeded = TryCharge(size);
+    }
+    if (exceeded != nullptr) {
+      return Status::OutOfMemory("Memory pool '", exceeded->name_, "' has ",
+                                 exceeded->bytes_used(), " bytes in use, ", size,
+                                 " more would exceed its hard limit of ",
+                                 exceeded->budget_.hard_limit, " bytes");
+    }
+    if (may_spill) {
+      for (Impl* pool = this; pool != nullptr; pool = pool->parent_.get()) {
+        const int64_t used = pool->bytes_used();
+        const int64_t soft_limit = pool->budget_.soft_limit;
+        if (used > soft_limit && used - size <= soft_limit) {
+          pool->Spill(used - soft_limit);
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Reserve(int64_t size) {
+    RETURN_NOT_OK(Charge(size, /*may_spill=*/false));
+    reserved_.fetch_add(size, std::memory_order_acq_rel);
+    return Status::OK();
+  }
+
+  void ReleaseReservation(int64_t size) {
+    reserved_.fetch_sub(size, std::memory_order_acq_rel);
+    Uncharge(size);
+  }
+
+  int64_t AddSpillCallback(SpillCallback callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int64_t id = next_callback_id_++;
+    callbacks_.emplace(id, std::move(callback));
+    return id;
+  }
+
+  void RemoveSpillCallback(int64_t id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    callbacks_.erase(id);
+  }
+
+  int64_t Spill(int64_t bytes_to_free) {
+    // The callbacks are called without holding any lock, as they free memory
+    std::vector<SpillCallback> callbacks;
+    CollectSpillCallbacks(&callbacks);
+    const bool was_spilling = t_spilling;
+    t_spilling = true;
+    int64_t freed = 0;
+    for (const auto& callback : callbacks) {
+      if (freed >= bytes_to_free) {
+        break;
+      }
+      freed += callback(bytes_to_free - freed);
+    }
+    t_spilling = was_spilling;
+    return freed;
+  }
+
+ private:
+  void CollectSpillCallbacks(std::vector<SpillCallback>* out) {
+    std::vector<std::shared_ptr<Impl>> children;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& [id, callback] : callbacks_) {
+        out->push_back(callback);
+      }
+      auto it = children_.begin();
+      while (it != children_.end()) {
+        if (auto child = it->lock()) {
+          children.push_back(std::move(child));
+          ++it;
+        } else {
+          it = children_.erase(it);
+        }
+      }
+    }
+    for (const auto& child : children) {
+      child->CollectSpillCallbacks(out);
+    }
+  }
+
+  MemoryPool* allocator_;
+  std::shared_ptr<Impl> parent_;
+  std::string name_;
+  MemoryBudget budget_;
+  internal::MemoryPoolStats stats_;
+  std::atomic<int64_t> used_{0};
+  std::atomic<int64_t> reserved_{0};
+
+  std::mutex mutex_;
+  std::vector<std::weak_ptr<Impl>> children_;
+  std::map<int64_t, SpillCallback> callbacks_;
+  int64_t next_callback_id_ = 0;
+};
+
+HierarchicalMemoryPool::HierarchicalMemoryPool(std::shared_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+HierarchicalMemoryPool::~HierarchicalMemoryPool() = default;
+
+std::shared_ptr<HierarchicalMemoryPool> HierarchicalMemoryPool::MakeRoot(
+    MemoryPool* pool, std::string name, MemoryBudget budget) {
+  return std::shared_ptr<HierarchicalMemoryPool>(new HierarchicalMemoryPool(
+      std::make_shared<Impl>(pool, nullptr, std::move(name), budget)));
+}
+
+std::shared_ptr<HierarchicalMemoryPool> HierarchicalMemoryPool::MakeChild(
+    std::string name, MemoryBudget budget) {
+  auto child =
+      std::make_shared<Impl>(impl_->allocator(), impl_, std::move(name), budget);
+  impl_->AddChild(child);
+  return std::shared_ptr<HierarchicalMemoryPool>(
+      new HierarchicalMemoryPool(std::move(child)));
+}
+
+const std::string& HierarchicalMemoryPool::name() const { return impl_->name(); }
+
+const MemoryBudget& HierarchicalMemoryPool::budget() const { return impl_->budget(); }
+
+Status HierarchicalMemoryPool::TryReserve(int64_t size) { return impl_->Reserve(size); }
+
+void HierarchicalMemoryPool::ReleaseReservation(int64_t size) {
+  impl_->ReleaseReservation(size);
+}
+
+int64_t HierarchicalMemoryPool::bytes_reserved() const {
+  return impl_->bytes_reserved();
+}
+
+int64_t HierarchicalMemoryPool::bytes_used() const { return impl_->bytes_used(); }
+
+int64_t HierarchicalMemoryPool::AddSpillCallback(SpillCallback callback) {
+  return impl_->AddSpillCallback(std::move(callback));
+}
+
+void HierarchicalMemoryPool::RemoveSpillCallback(int64_t id) {
+  impl_->RemoveSpillCallback(id);
+}
+
+int64_t HierarchicalMemoryPool::Spill(int64_t bytes_to_free) {
+  return impl_->Spill(bytes_to_free);
+}
+
+Status HierarchicalMemoryPool::Allocate(int64_t size, int64_t alignment,
+                                        uint8_t** out) {
+  RETURN_NOT_OK(impl_->Charge(size, /*may_spill=*/true));
+  Status st = impl_->allocator()->Allocate(size, alignment, out);
+  if (!st.ok()) {
+    impl_->Uncharge(size);
+    return st;
+  }
+  impl_->stats().DidAllocateBytes(size);
+  return Status::OK();
+}
+
+Status HierarchicalMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                          int64_t alignment, uint8_t** ptr) {
+  if (new_size > old_size) {
+    RETURN_NOT_OK(impl_->Charge(new_size - old_size, /*may_spill=*/true));
+  }
+  Status st = impl_->allocator()->Reallocate(old_size, new_size, alignment, ptr);
+  if (!st.ok()) {
+    if (new_size > old_size) {
+      impl_->Uncharge(new_size - old_size);
+    }
+    return st;
+  }
+  if (new_size < old_size) {
+    impl_->Uncharge(old_size - new_size);
+  }
+  impl_->stats().DidReallocateBytes(old_size, new_size);
+  return Status::OK();
+}
+
+void HierarchicalMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  impl_->allocator()->Free(buffer, size, alignment);
+  impl_->Uncharge(size);
+  impl_->stats().DidFreeBytes(size);
+}
+
+void HierarchicalMemoryPool::ReleaseUnused() { impl_->allocator()->ReleaseUnused(); }
+
+void HierarchicalMemoryPool::PrintStats() { impl_->allocator()->PrintStats(); }
+
+int64_t HierarchicalMemoryPool::bytes_allocated() const {
+  return impl_->stats().bytes_allocated();
+}
+
+int64_t HierarchicalMemoryPool::max_memory() const { return impl_->stats().max_memory(); }
+
+int64_t HierarchicalMemoryPool::total_bytes_allocated() const {
+  return impl_->stats().total_bytes_allocated();
+}
+
+int64_t HierarchicalMemoryPool::num_allocations() const {
+  return impl_->stats().num_allocations();
+}
+
+std::string HierarchicalMemoryPool::backend_name() const {
+  return impl_->allocator()->backend_name();
+}
+
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+namespace {
+
+// Unique ids of the arenas and recycling pools, so that a thread's cached state is
+// never mistaken for one of another pool reusing the same address
+std::atomic<uint64_t> g_next_arena_id{1};
+
+// The last slab a thread allocated from
+struct ThreadArenaCache {
+  uint64_t arena_id = 0;
+  void* slab = nullptr;
+};
+
+thread_local ThreadArenaCache t_arena_cache;
+
+}  // namespace
+
+class ArenaMemoryPool::ArenaMemoryPoolImpl {
+ public:
+  ArenaMemoryPoolImpl(MemoryPool* pool, int64_t slab_size)
+      : pool_(pool), slab_size_(slab_size), id_(g_next_arena_id.fetch_add(1)) {}
+
+  ~ArenaMemoryPoolImpl() { Reset(); }
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size + alignment > slab_size_ || alignment > kDefaultBufferAlignment) {
+      // Give large or overaligned allocations a slab of their own
+      RETURN_NOT_OK(NewSlab(size, alignment, out));
+    } else {
+      ThreadSlab* slab = GetThreadSlab();
+      auto position = reinterpret_cast<uintptr_t>(slab->position);
+      position = (position + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+      if (slab->position == nullptr ||
+          static_cast<int64_t>(reinterpret_cast<uintptr_t>(slab->end) - position) <
+              size) {
+        RETURN_NOT_OK(NewSlab(slab_size_, kDefaultBufferAlignment, &slab->position));
+        slab->end = slab->position + slab_size_;
+        position = reinterpret_cast<uintptr_t>(slab->position);
+      }
+      *out = reinterpret_cast<uint8_t*>(position);
+      slab->position = *out + size;
+    }
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) {
+    if (new_size <= old_size) {
+      stats_.DidReallocateBytes(old_size, new_size);
+      return Status::OK();
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(Allocate(new_size, alignment, &out));
+    if (old_size > 0) {
+      std::memcpy(out, *ptr, static_cast<size_t>(old_size));
+    }
+    // The old allocation stays in its slab until Reset()
+    stats_.DidFreeBytes(old_size);
+    *ptr = out;
+    return Status::OK();
+  }
+
+  void Free(uint8_t*, int64_t size, int64_t) { stats_.DidFreeBytes(size); }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& slab : slabs_) {
+      pool_->Free(slab.data, slab.size, slab.alignment);
+    }
+    slabs_.clear();
+    slab_bytes_ = 0;
+    for (auto& [thread_id, thread_slab] : thread_slabs_) {
+      thread_slab->position = thread_slab->end = nullptr;
+    }
+  }
+
+  int64_t slab_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return slab_bytes_;
+  }
+
+  MemoryPool* pool() const { return pool_; }
+  const internal::MemoryPoolStats& stats() const { return stats_; }
+
+ private:
+  struct ThreadSlab {
+    uint8_t* position = nullptr;
+    uint8_t* end = nullptr;
+  };
+
+  struct Slab {
+    uint8_t* data;
+    int64_t size;
+    int64_t alignment;
+  };
+
+  ThreadSlab* GetThreadSlab() {
+    if (t_arena_cache.arena_id == id_) {
+      return static_cast<ThreadSlab*>(t_arena_cache.slab);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& slab = thread_slabs_[std::this_thread::get_id()];
+    if (slab == nullptr) {
+      slab = std::make_unique<ThreadSlab>();
+    }
+    t_arena_cache = {id_, slab.get()};
+    return slab.get();
+  }
+
+  Status NewSlab(int64_t size, int64_t alignment, uint8_t** out) {
+    RETURN_NOT_OK(pool_->Allocate(size, alignment, out));
+    std::lock_guard<std::mutex> lock(mutex_);
+    slabs_.push_back({*out, size, alignment});
+    slab_bytes_ += size;
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  const int64_t slab_size_;
+  const uint64_t id_;
+  internal::MemoryPoolStats stats_;
+
+  mutable std::mutex mutex_;
+  std::vector<Slab> slabs_;
+  int64_t slab_bytes_ = 0;
+  std::unordered_map<std::thread::id, std::unique_ptr<ThreadSlab>> thread_slabs_;
+};
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* pool, int64_t slab_size)
+    : impl_(new ArenaMemoryPoolImpl(pool, slab_size)) {}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+void ArenaMemoryPool::Reset() { impl_->Reset(); }
+
+int64_t ArenaMemoryPool::slab_bytes() const { return impl_->slab_bytes(); }
+
+Status ArenaMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  return impl_->Allocate(size, alignment, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                                   uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, alignment, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  impl_->Free(buffer, size, alignment);
+}
+
+void ArenaMemoryPool::ReleaseUnused() { impl_->pool()->ReleaseUnused(); }
+
+int64_t ArenaMemoryPool::bytes_allocated() const {
+  return impl_->stats().bytes_allocated();
+}
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->stats().max_memory(); }
+
+int64_t ArenaMemoryPool::total_bytes_allocated() const {
+  return impl_->stats().total_bytes_allocated();
+}
+
+int64_t ArenaMemoryPool::num_allocations() const {
+  return impl_->stats().num_allocations();
+}
+
+std::string ArenaMemoryPool::backend_name() const {
+  return impl_->pool()->backend_name();
+}
+
+///////////////////////////////////////////////////////////////////////
+// RecyclingMemoryPool implementation
+
+namespace {
+
+// The free lists of the last recycling pool a thread used
+struct ThreadRecyclingCache {
+  uint64_t pool_id = 0;
+  void* free_lists = nullptr;
+};
+
+thread_local ThreadRecyclingCache t_recycling_cache;
+
+constexpr int64_t kMinSizeClass = 64;
+
+// Round `size` up to its size class: kMinSizeClass, then four classes per power of two
+int64_t SizeClass(int64_t size) {
+  if (size <= kMinSizeClass) {
+    return kMinSizeClass;
+  }
+  const int log2 = 63 - bit_util::CountLeadingZeros(static_cast<uint64_t>(size - 1));
+  return bit_util::RoundUp(size, int64_t{1} << (log2 - 2));
+}
+
+int SizeClassIndex(int64_t size_class) {
+  if (size_class <= kMinSizeClass) {
+    return 0;
+  }
+  const int log2 =
+      63 - bit_util::CountLeadingZeros(static_cast<uint64_t>(size_class - 1));
+  const int64_t step = int64_t{1} << (log2 - 2);
+  const int64_t kMinLog2 = 6;  // log2(kMinSizeClass)
+  return static_cast<int>(4 * (log2 - kMinLog2) +
+                          (size_class - (int64_t{1} << log2)) / step);
+}
+
+}  // namespace
+
+class RecyclingMemoryPool::RecyclingMemoryPoolImpl {
+ public:
+  RecyclingMemoryPoolImpl(MemoryPool* pool, int64_t max_cached_size,
+                          int64_t max_retained_bytes)
+      : pool_(pool),
+        max_cached_size_(max_cached_size),
+        max_retained_bytes_(max_retained_bytes),
+        num_size_classes_(SizeClassIndex(SizeClass(std::max<int64_t>(
+                              max_cached_size, kMinSizeClass))) +
+                          1),
+        id_(g_next_arena_id.fetch_add(1)) {}
+
+  ~RecyclingMemoryPoolImpl() { ReleaseRetained(); }
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+    if (!IsRecycled(size, alignment)) {
+      RETURN_NOT_OK(pool_->Allocate(size, alignment, out));
+    } else {
+      const int64_t size_class = SizeClass(size);
+      if (!TakeRetained(size_class, out)) {
+        RETURN_NOT_OK(pool_->Allocate(size_class, kDefaultBufferAlignment, out));
+      }
+    }
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) {
+    const bool old_recycled = IsRecycled(old_size, alignment);
+    const bool new_recycled = IsRecycled(new_size, alignment);
+    if (!old_recycled && !new_recycled) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, alignment, ptr));
+    } else if (!(old_recycled && new_recycled &&
+                 SizeClass(old_size) == SizeClass(new_size))) {
+      uint8_t* out;
+      RETURN_NOT_OK(Allocate(new_size, alignment, &out));
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      Free(*ptr, old_size, alignment);
+      // Allocate() and Free() updated the statistics
+      *ptr = out;
+      return Status::OK();
+    }
+    stats_.DidReallocateBytes(old_size, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+    if (!IsRecycled(size, alignment)) {
+      pool_->Free(buffer, size, alignment);
+    } else {
+      const int64_t size_class = SizeClass(size);
+      if (!Retain(size_class, buffer)) {
+        pool_->Free(buffer, size_class, kDefaultBufferAlignment);
+      }
+    }
+    stats_.DidFreeBytes(size);
+  }
+
+  void ReleaseRetained() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [thread_id, free_lists] : thread_free_lists_) {
+      std::lock_guard<std::mutex> lists_lock(free_lists->mutex);
+      for (int index = 0; index < num_size_classes_; ++index) {
+        for (uint8_t* buffer : free_lists->lists[index]) {
+          const int64_t size_class = free_lists->size_classes[index];
+          pool_->Free(buffer, size_class, kDefaultBufferAlignment);
+          retained_bytes_.fetch_sub(size_class, std::memory_order_acq_rel);
+        }
+        free_lists->lists[index].clear();
+      }
+    }
+  }
+
+  int64_t bytes_retained() const {
+    return retained_bytes_.load(std::memory_order_acquire);
+  }
+
+  MemoryPool* pool() const { return pool_; }
+  const internal::MemoryPoolStats& stats() const { return stats_; }
+
+ private:
+  struct FreeLists {
+    // Only contended by ReleaseRetained()
+    std::mutex mutex;
+    std::vector<std::vector<uint8_t*>> lists;
+    std::vector<int64_t> size_classes;
+  };
+
+  bool IsRecycled(int64_t size, int64_t alignment) const {
+    return size > 0 && size <= max_cached_size_ && alignment <= kDefaultBufferAlignment;
+  }
+
+  FreeLists* GetThreadFreeLists() {
+    if (t_recycling_cache.pool_id == id_) {
+      return static_cast<FreeLists*>(t_recycling_cache.free_lists);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& free_lists = thread_free_lists_[std::this_thread::get_id()];
+    if (free_lists == nullptr) {
+      free_lists = std::make_unique<FreeLists>();
+      free_lists->lists.resize(num_size_classes_);
+      free_lists->size_classes.resize(num_size_classes_);
+    }
+    t_recycling_cache = {id_, free_lists.get()};
+    return free_lists.get();
+  }
+
+  bool TakeRetained(int64_t size_class, uint8_t** out) {
+    FreeLists* free_lists = GetThreadFreeLists();
+    std::lock_guard<std::mutex> lock(free_lists->mutex);
+    auto& list = free_lists->lists[SizeClassIndex(size_class)];
+    if (list.empty()) {
+      return false;
+    }
+    *out = list.back();
+    list.pop_back();
+    retained_bytes_.fetch_sub(size_class, std::memory_order_acq_rel);
+    return true;
+  }
+
+  bool Retain(int64_t size_class, uint8_t* buffer) {
+    if (retained_bytes_.fetch_add(size_class, std::memory_order_acq_rel) + size_class >
+        max_retained_bytes_) {
+      retained_bytes_.fetch_sub(size_class, std::memory_order_acq_rel);
+      return false;
+    }
+    FreeLists* free_lists = GetThreadFreeLists();
+    std::lock_guard<std::mutex> lock(free_lists->mutex);
+    const int index = SizeClassIndex(size_class);
+    free_lists->lists[index].push_back(buffer);
+    free_lists->size_classes[index] = size_class;
+    return true;
+  }
+
+  MemoryPool* pool_;
+  const int64_t max_cached_size_;
+  const int64_t max_retained_bytes_;
+  const int num_size_classes_;
+  const uint64_t id_;
+  internal::MemoryPoolStats stats_;
+  std::atomic<int64_t> retained_bytes_{0};
+
+  std::mutex mutex_;
+  std::unordered_map<std::thread::id, std::unique_ptr<FreeLists>> thread_free_lists_;
+};
+
+RecyclingMemoryPool::RecyclingMemoryPool(MemoryPool* pool, int64_t max_cached_size,
+                                         int64_t max_retained_bytes)
+    : impl_(new RecyclingMemoryPoolImpl(pool, max_cached_size, max_retained_bytes)) {}
+
+RecyclingMemoryPool::~RecyclingMemoryPool() {}
+
+Status RecyclingMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  return impl_->Allocate(size, alignment, out);
+}
+
+Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       int64_t alignment, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, alignment, ptr);
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  impl_->Free(buffer, size, alignment);
+}
+
+void RecyclingMemoryPool::ReleaseUnused() {
+  impl_->ReleaseRetained();
+  impl_->pool()->ReleaseUnused();
+}
+
+void RecyclingMemoryPool::PrintStats() { impl_->pool()->PrintStats(); }
+
+int64_t RecyclingMemoryPool::bytes_allocated() const {
+  return impl_->stats().bytes_allocated();
+}
+
+int64_t RecyclingMemoryPool::max_memory() const { return impl_->stats().max_memory(); }
+
+int64_t RecyclingMemoryPool::total_bytes_allocated() const {
+  return impl_->stats().total_bytes_allocated();
+}
+
+int64_t RecyclingMemoryPool::num_allocations() const {
+  return impl_->stats().num_allocations();
+}
+
+std::string RecyclingMemoryPool::backend_name() const {
+  return impl_->pool()->backend_name();
+}
+
+int64_t RecyclingMemoryPool::bytes_retained() const { return impl_->bytes_retained(); }
+
+///////////////////////////////////////////////////////////////////////
+// NumaMemoryPool implementation
+
+NumaMemoryPool::NumaMemoryPool(MemoryPool* pool, int64_t min_size)
+    : pool_(pool), min_size_(min_size) {}
+
+void NumaMemoryPool::PreferCurrentNode(uint8_t* data, int64_t size) {
+  if (size >= min_size_ && ::arrow::internal::GetNumaNodeCount() > 1) {
+    // Best effort: the allocation is usable wherever its pages end up
+    ARROW_UNUSED(::arrow::internal::PreferNumaNode(
+        data, size, ::arrow::internal::GetCurrentNumaNode()));
+  }
+}
+
+Status NumaMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  RETURN_NOT_OK(pool_->Allocate(size, alignment, out));
+  PreferCurrentNode(*out, size);
+  return Status::OK();
+}
+
+Status NumaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                                  uint8_t** ptr) {
+  RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, alignment, ptr));
+  PreferCurrentNode(*ptr, new_size);
+  return Status::OK();
+}
+
+void NumaMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  pool_->Free(buffer, size, alignment);
+}
+
+void NumaMemoryPool::ReleaseUnused() { pool_->ReleaseUnused(); }
+
+void NumaMemoryPool::PrintStats() { pool_->PrintStats(); }
+
+int64_t NumaMemoryPool::bytes_allocated() const { return pool_->bytes_allocated(); }
+
+int64_t NumaMemoryPool::max_memory() const { return pool_->max_memory(); }
+
+int64_t NumaMemoryPool::total_bytes_allocated() const {
+  return pool_->total_bytes_allocated();
+}
+
+int64_t NumaMemoryPool::num_allocations() const { return pool_->num_allocations(); }
+
+std::string NumaMemoryPool::backend_name() const { return pool_->backend_name(); }
+
+///////////////////////////////////////////////////////////////////////
+// LargePageMemoryPool implementation
+
+class LargePageMemoryPool::LargePageMemoryPoolImpl {
+ public:
+  LargePageMemoryPoolImpl(MemoryPool* pool, LargePageOptions options)
+      : pool_(pool), options_(options) {}
+
+  ~LargePageMemoryPoolImpl() {
+    DCHECK(mappings_.empty()) << "LargePageMemoryPool destroyed with live allocations";
+  }
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+    if (IsMapped(size, alignment)) {
+      RETURN_NOT_OK(Map(size, out));
+    } else {
+      RETURN_NOT_OK(pool_->Allocate(size, alignment, out));
+    }
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) {
+    const bool old_mapped = IsMapped(old_size, alignment);
+    const bool new_mapped = IsMapped(new_size, alignment);
+    if (!old_mapped && !new_mapped) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, alignment, ptr));
+    } else {
+      uint8_t* out;
+      if (new_mapped) {
+        RETURN_NOT_OK(Map(new_size, &out));
+      } else {
+        RETURN_NOT_OK(pool_->Allocate(new_size, alignment, &out));
+      }
+      std::memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      if (old_mapped) {
+        Unmap(*ptr);
+      } else {
+        pool_->Free(*ptr, old_size, alignment);
+      }
+      *ptr = out;
+    }
+    stats_.DidReallocateBytes(old_size, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+    if (IsMapped(size, alignment)) {
+      Unmap(buffer);
+    } else {
+      pool_->Free(buffer, size, alignment);
+    }
+    stats_.DidFreeBytes(size);
+  }
+
+  int64_t bytes_mapped() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_mapped_;
+  }
+
+  MemoryPool* pool() const { return pool_; }
+  const internal::MemoryPoolStats& stats() const { return stats_; }
+
+ private:
+  bool IsMapped(int64_t size, int64_t alignment) const {
+#ifdef __linux__
+    return size >= options_.min_size && size > 0 && alignment <= 4096;
+#else
+    return false;
+#endif
+  }
+
+  Status Map(int64_t size, uint8_t** out) {
+#ifdef __linux__
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    if (size >= options_.prefault_min_size) {
+      flags |= MAP_POPULATE;
+    }
+    void* data = MAP_FAILED;
+    int64_t length = 0;
+#  if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    if (options_.huge_page_size > 0) {
+      // The huge page size is encoded in the flags as its log2
+      const int huge_page_shift =
+          bit_util::Log2(static_cast<uint64_t>(options_.huge_page_size));
+      length = bit_util::RoundUp(size, options_.huge_page_size);
+      data = mmap(nullptr, static_cast<size_t>(length), PROT_READ | PROT_WRITE,
+                  flags | MAP_HUGETLB | (huge_page_shift << MAP_HUGE_SHIFT), -1, 0);
+    }
+#  endif
+    if (data == MAP_FAILED) {
+      // No explicit huge pages, map normal pages
+      length = bit_util::RoundUp(size, internal::GetPageSize());
+      data = mmap(nullptr, static_cast<size_t>(length), PROT_READ | PROT_WRITE, flags,
+                  -1, 0);
+      if (data == MAP_FAILED) {
+        return Status::OutOfMemory("mmap of size ", size, " failed");
+      }
+#  ifdef MADV_HUGEPAGE
+      if (options_.transparent_huge_pages) {
+        // Best effort, the kernel may not support transparent huge pages
+        ARROW_UNUSED(madvise(data, static_cast<size_t>(length), MADV_HUGEPAGE));
+      }
+#  endif
+    }
+    *out = static_cast<uint8_t*>(data);
+    std::lock_guard<std::mutex> lock(mutex_);
+    mappings_.emplace(*out, length);
+    bytes_mapped_ += length;
+    return Status::OK();
+#else
+    return Status::NotImplemented("Mapping memory on this platform");
+#endif
+  }
+
+  void Unmap(uint8_t* data) {
+#ifdef __linux__
+    int64_t length;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = mappings_.find(data);
+      DCHECK(it != mappings_.end());
+      length = it->second;
+      mappings_.erase(it);
+      bytes_mapped_ -= length;
+    }
+    ARROW_UNUSED(munmap(data, static_cast<size_t>(length)));
+#endif
+  }
+
+  MemoryPool* pool_;
+  const LargePageOptions options_;
+  internal::MemoryPoolStats stats_;
+
+  // The mapped allocations and the lengths of their mappings, which depend on whether
+  // huge pages were available
+  mutable std::mutex mutex_;
+  std::unordered_map<uint8_t*, int64_t> mappings_;
+  int64_t bytes_mapped_ = 0;
+};
+
+LargePageMemoryPool::LargePageMemoryPool(MemoryPool* pool, LargePageOptions options)
+    : impl_(new LargePageMemoryPoolImpl(pool, options)) {}
+
+LargePageMemoryPool::~LargePageMemoryPool() {}
+
+Status LargePageMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  return impl_->Allocate(size, alignment, out);
+}
+
+Status LargePageMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       int64_t alignment, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, alignment, ptr);
+}
+
+void LargePageMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  impl_->Free(buffer, size, alignment);
+}
+
+void LargePageMemoryPool::ReleaseUnused() { impl_->pool()->ReleaseUnused(); }
+
+void LargePageMemoryPool::PrintStats() { impl_->pool()->PrintStats(); }
+
+int64_t LargePageMemoryPool::bytes_allocated() const {
+  return impl_->stats().bytes_allocated();
+}
+
+int64_t LargePageMemoryPool::max_memory() const { return impl_->stats().max_memory(); }
+
+int64_t LargePageMemoryPool::total_bytes_allocated() const {
+  return impl_->stats().total_bytes_allocated();
+}
+
+int64_t LargePageMemoryPool::num_allocations() const {
+  return impl_->stats().num_allocations();
+}
+
+std::string LargePageMemoryPool::backend_name() const {
+  return impl_->pool()->backend_name();
+}
+
+int64_t LargePageMemoryPool::bytes_mapped() const { return impl_->bytes_mapped(); }
+
 std::vector<std::string> SupportedMemoryBackendNames() {
   std::vector<std::string> supported;
   for (const auto backend : SupportedBackends()) {
@@ -20,12 +20,15 @@
 #include <atomic>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -245,6 +248,379 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief Options of a ProfilingMemoryPool
+struct ARROW_EXPORT ProfilingOptions {
+  /// \brief The mean number of bytes allocated between two sampled allocations
+  ///
+  /// An allocation of `size` bytes is sampled with probability about
+  /// `size / sampling_interval`, and sampled allocations are weighted so that the
+  /// profile estimates the live bytes.  A value of 1 or less samples all allocations.
+  int64_t sampling_interval = 512 * 1024;
+
+  /// The maximum number of stack frames recorded for a sampled allocation, 0 to
+  /// record none and attribute allocations by their tag only
+  int max_stack_depth = 32;
+};
+
+/// \brief Attribute the allocations of the current thread to a tag
+///
+/// Allocations sampled by a ProfilingMemoryPool while the object lives are labelled
+/// with `tag`, e.g. "parquet::decode" or "acero::hash_join".  Tags nest, the
+/// innermost one wins, and they don't follow tasks submitted to other threads.
+class ARROW_EXPORT ScopedAllocationTag {
+ public:
+  explicit ScopedAllocationTag(std::string tag);
+  ~ScopedAllocationTag();
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ScopedAllocationTag);
+
+  /// The tag of the current thread, empty if none
+  static const std::string& current();
+
+ private:
+  std::string tag_;
+  const std::string* previous_;
+};
+
+/// \brief A memory pool sampling its allocations to profile the live memory
+///
+/// Sampled allocations record the call stack and the ScopedAllocationTag they were
+/// made in, and are forgotten when freed.  HeapProfile() exports the live sampled
+/// allocations in the pprof format, which e.g. `pprof -top -tagfocus=...` or
+/// `pprof -http` read, to find out which operator holds the memory of a running
+/// process at little cost.
+class ARROW_EXPORT ProfilingMemoryPool : public MemoryPool {
+ public:
+  explicit ProfilingMemoryPool(MemoryPool* pool,
+                               ProfilingOptions options = ProfilingOptions());
+  ~ProfilingMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+  void ReleaseUnused() override;
+  void PrintStats() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+  /// \brief The estimated live bytes per allocation tag
+  ///
+  /// Allocations made outside of any tag are reported under an empty tag.
+  std::unordered_map<std::string, int64_t> LiveBytesByTag() const;
+
+  /// \brief A profile of the live allocations, as an uncompressed pprof protobuf
+  ///
+  /// Samples have the "inuse_objects" and "inuse_space" values and a "tag" label.
+  /// Frames are named from the dynamic symbol table when available.
+  std::string HeapProfile() const;
+
+ private:
+  class ProfilingMemoryPoolImpl;
+  std::unique_ptr<ProfilingMemoryPoolImpl> impl_;
+};
+
+/// \brief The limits of a HierarchicalMemoryPool
+struct ARROW_EXPORT MemoryBudget {
+  /// \brief Usage above which the spill callbacks are asked to free memory
+  ///
+  /// Allocations crossing this limit still succeed.
+  int64_t soft_limit = std::numeric_limits<int64_t>::max();
+  /// \brief Usage above which allocations and reservations fail
+  int64_t hard_limit = std::numeric_limits<int64_t>::max();
+};
+
+/// \brief A memory pool enforcing budgets over a tree of pools
+///
+/// Pools form a tree, for example process, tenant, query, then operator.  The usage
+/// of a pool is the bytes allocated or reserved through it and its descendants, and
+/// it counts against the budgets of all its ancestors.  The memory itself is
+/// allocated from the pool at the root of the tree.
+///
+/// When an allocation would exceed the hard limit of a pool, the spill callbacks of
+/// that pool and its descendants are asked to free memory, and the allocation is
+/// retried once before failing with OutOfMemory.  Reservations fail fast instead.
+/// Crossing a soft limit asks the spill callbacks to free memory without failing.
+class ARROW_EXPORT HierarchicalMemoryPool : public MemoryPool {
+ public:
+  /// \brief A callback asked to free about `bytes_to_free` bytes
+  ///
+  /// It returns the number of bytes actually freed.  It is called from the thread
+  /// of the allocation that needs the memory, and the allocations it makes can't
+  /// themselves spill.
+  using SpillCallback = std::function<int64_t(int64_t bytes_to_free)>;
+
+  ~HierarchicalMemoryPool() override;
+
+  /// \brief Create the root pool of a tree, allocating from `pool`
+  static std::shared_ptr<HierarchicalMemoryPool> MakeRoot(MemoryPool* pool,
+                                                          std::string name,
+                                                          MemoryBudget budget = {});
+
+  /// \brief Create a child pool whose usage counts against this pool's budget
+  ///
+  /// The child keeps this pool alive.
+  std::shared_ptr<HierarchicalMemoryPool> MakeChild(std::string name,
+                                                    MemoryBudget budget = {});
+
+  const std::string& name() const;
+  const MemoryBudget& budget() const;
+
+  /// \brief Reserve `size` bytes of the budget without allocating them
+  ///
+  /// Fails with OutOfMemory, without spilling, if this would exceed the hard limit
+  /// of this pool or of an ancestor.
+  Status TryReserve(int64_t size);
+  /// \brief Give back `size` bytes reserved by TryReserve
+  void ReleaseReservation(int64_t size);
+
+  /// The bytes reserved through this pool and not yet released
+  int64_t bytes_reserved() const;
+  /// The bytes allocated or reserved through this pool and its descendants
+  int64_t bytes_used() const;
+
+  /// \brief Register a callback able to free memory, return its id
+  int64_t AddSpillCallback(SpillCallback callback);
+  void RemoveSpillCallback(int64_t id);
+
+  /// \brief Ask the spill callbacks of this pool and its descendants to free
+  /// `bytes_to_free` bytes, return the number of bytes they freed
+  int64_t Spill(int64_t bytes_to_free);
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+  void ReleaseUnused() override;
+  void PrintStats() override;
+
+  /// The bytes allocated through this pool itself, not its descendants
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  class Impl;
+  explicit HierarchicalMemoryPool(std::shared_ptr<Impl> impl);
+
+  std::shared_ptr<Impl> impl_;
+};
+
+/// \brief A bump allocator for batch-scoped allocations
+///
+/// Allocations are carved out of large slabs obtained from another pool, one slab per
+/// allocating thread so that threads don't contend, and are only given back all at
+/// once by Reset() or when the arena is destroyed: Free() only updates statistics.
+/// Allocations larger than the slab size get a slab of their own, as in Gandiva's
+/// SimpleArena.
+///
+/// Pass an arena as the pool of an ExecContext to make the buffers of a batch or
+/// morsel cheap to allocate; all of them must be released before Reset().
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultSlabSize = 64 * 1024;
+
+  explicit ArenaMemoryPool(MemoryPool* pool, int64_t slab_size = kDefaultSlabSize);
+  ~ArenaMemoryPool() override;
+
+  /// \brief Give all the slabs back to the underlying pool
+  ///
+  /// No buffer allocated from the arena may be in use or being allocated.
+  void Reset();
+
+  /// The bytes of slabs obtained from the underlying pool
+  int64_t slab_bytes() const;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+  void ReleaseUnused() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  class ArenaMemoryPoolImpl;
+  std::unique_ptr<ArenaMemoryPoolImpl> impl_;
+};
+
+/// \brief A memory pool placing large allocations on the NUMA node of the caller
+///
+/// The pages of allocations of at least `min_size` bytes prefer the NUMA node of the
+/// CPU the allocating thread runs on, as far as they aren't backed by memory yet.
+/// With workers pinned to NUMA nodes (see ThreadPool::SetPinWorkersToNumaNodes),
+/// the buffers a worker builds then stay local to the CPUs processing them.
+class ARROW_EXPORT NumaMemoryPool : public MemoryPool {
+ public:
+  explicit NumaMemoryPool(MemoryPool* pool, int64_t min_size = 1 << 20);
+  ~NumaMemoryPool() override = default;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+  void ReleaseUnused() override;
+  void PrintStats() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  void PreferCurrentNode(uint8_t* data, int64_t size);
+
+  MemoryPool* pool_;
+  int64_t min_size_;
+};
+
+/// \brief A memory pool recycling freed allocations of common sizes
+///
+/// Allocations of up to `max_cached_size` bytes are rounded up to size classes (four
+/// per power of two) and, once freed, are kept in per-thread free lists to serve
+/// later allocations of the same class, until `max_retained_bytes` are retained.
+/// The buffers of a steady-state pipeline, allocated again and again at the same
+/// sizes, then don't reach the underlying allocator.  Recycled memory isn't zeroed.
+///
+/// Builders and buffers draw from the pool they are given, so passing this pool to
+/// them (or to an ExecContext) is enough to recycle their buffers.
+class ARROW_EXPORT RecyclingMemoryPool : public MemoryPool {
+ public:
+  explicit RecyclingMemoryPool(MemoryPool* pool, int64_t max_cached_size = 4 << 20,
+                               int64_t max_retained_bytes = 256 << 20);
+  ~RecyclingMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+  /// Give the retained allocations back to the underlying pool, then release its
+  /// unused memory.  No allocation may be in progress.
+  void ReleaseUnused() override;
+  void PrintStats() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+  /// The bytes of freed allocations kept for recycling
+  int64_t bytes_retained() const;
+
+ private:
+  class RecyclingMemoryPoolImpl;
+  std::unique_ptr<RecyclingMemoryPoolImpl> impl_;
+};
+
+/// \brief Options of a LargePageMemoryPool
+struct ARROW_EXPORT LargePageOptions {
+  /// \brief Allocations of at least this many bytes are mapped directly
+  int64_t min_size = 2 * 1024 * 1024;
+  /// \brief Whether to ask for transparent huge pages with madvise(MADV_HUGEPAGE)
+  bool transparent_huge_pages = true;
+  /// \brief The size of explicit huge pages to map (MAP_HUGETLB), 2 MiB or 1 GiB
+  ///
+  /// 0 disables them.  When no huge page of this size is available, normal pages
+  /// are mapped instead.
+  int64_t huge_page_size = 0;
+  /// \brief Mapped allocations of at least this many bytes are pre-faulted
+  /// (MAP_POPULATE), so that they don't fault when first written
+  int64_t prefault_min_size = std::numeric_limits<int64_t>::max();
+};
+
+/// \brief A memory pool mapping large allocations with huge pages
+///
+/// Allocations of at least LargePageOptions::min_size bytes are mapped directly
+/// from the operating system, backed by huge pages where possible and optionally
+/// pre-faulted, so that multi-gigabyte buffers incur fewer page faults and TLB
+/// misses.  Smaller allocations are forwarded to another pool.  Large allocations
+/// are only mapped on Linux.
+class ARROW_EXPORT LargePageMemoryPool : public MemoryPool {
+ public:
+  explicit LargePageMemoryPool(MemoryPool* pool, LargePageOptions options = {});
+  ~LargePageMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+  void ReleaseUnused() override;
+  void PrintStats() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+  /// The bytes currently mapped for large allocations
+  int64_t bytes_mapped() const;
+
+ private:
+  class LargePageMemoryPoolImpl;
+  std::unique_ptr<LargePageMemoryPoolImpl> impl_;
+};
+
 /// \brief Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
@@ -49,6 +49,34 @@ struct Mimalloc {
 };
 #endif
 
+// Large allocations mapped with transparent huge pages
+struct LargePages {
+  static Result<MemoryPool*> GetAllocator() {
+    static LargePageMemoryPool pool(system_memory_pool());
+    return &pool;
+  }
+};
+
+// Large allocations mapped with transparent huge pages and pre-faulted
+struct PrefaultedLargePages {
+  static Result<MemoryPool*> GetAllocator() {
+    static LargePageMemoryPool pool(system_memory_pool(), [] {
+      LargePageOptions options;
+      options.prefault_min_size = options.min_size;
+      return options;
+    }());
+    return &pool;
+  }
+};
+
+// Sampling allocations as in production, with the default sampling interval
+struct Profiling {
+  static Result<MemoryPool*> GetAllocator() {
+    static ProfilingMemoryPool pool(system_memory_pool());
+    return &pool;
+  }
+};
+
 static void TouchCacheLines(uint8_t* data, int64_t nbytes) {
   uint8_t total = 0;
   while (nbytes > 0) {
@@ -129,6 +157,14 @@ BENCHMARK(TouchArea) BENCHMARK_ALLOCATE_ARGS;
 BENCHMARK_ALLOCATE(AllocateDeallocate, SystemAlloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, SystemAlloc);
 
+BENCHMARK_ALLOCATE(AllocateDeallocate, LargePages);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, LargePages);
+BENCHMARK_ALLOCATE(AllocateTouchDeallocate, PrefaultedLargePages);
+
+// Compared to SystemAlloc over the thread counts, shows whether the frees of
+// unsampled blocks contend on the profiler
+BENCHMARK_ALLOCATE(AllocateDeallocate, Profiling);
+
 #ifdef ARROW_JEMALLOC
 BENCHMARK_ALLOCATE(AllocateDeallocate, Jemalloc);
 BENCHMARK_ALLOCATE(AllocateTouchDeallocate, Jemalloc);
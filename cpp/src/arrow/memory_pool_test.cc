@@ -16,10 +16,18 @@
 // under the License.
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/array/builder_primitive.h"
 #include "arrow/memory_pool.h"
 #include "arrow/memory_pool_test.h"
 #include "arrow/status.h"
@@ -181,6 +189,513 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+TEST(HierarchicalMemoryPool, HardLimits) {
+  auto pool = MemoryPool::CreateDefault();
+  auto process = HierarchicalMemoryPool::MakeRoot(pool.get(), "process",
+                                                  MemoryBudget{/*soft_limit=*/1000,
+                                                               /*hard_limit=*/1000});
+  auto query = process->MakeChild("query", MemoryBudget{600, 600});
+  auto op = query->MakeChild("operator");
+
+  uint8_t* data;
+  ASSERT_OK(op->Allocate(500, &data));
+  ASSERT_EQ(500, op->bytes_allocated());
+  ASSERT_EQ(0, query->bytes_allocated());
+  ASSERT_EQ(500, query->bytes_used());
+  ASSERT_EQ(500, process->bytes_used());
+  ASSERT_EQ(500, pool->bytes_allocated());
+
+  // Over the query's limit
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, op->Allocate(200, &data2));
+  ASSERT_RAISES(OutOfMemory, query->Allocate(200, &data2));
+  ASSERT_RAISES(OutOfMemory, op->Reallocate(500, 700, &data));
+  ASSERT_EQ(500, process->bytes_used());
+
+  // Over the process's limit
+  ASSERT_OK(process->Allocate(400, &data2));
+  ASSERT_EQ(900, process->bytes_used());
+  ASSERT_RAISES(OutOfMemory, op->TryReserve(100 + 1));
+  ASSERT_OK(op->TryReserve(100));
+  ASSERT_EQ(100, op->bytes_reserved());
+  ASSERT_EQ(600, query->bytes_used());
+  ASSERT_EQ(1000, process->bytes_used());
+  op->ReleaseReservation(100);
+  ASSERT_EQ(0, op->bytes_reserved());
+
+  ASSERT_OK(op->Reallocate(500, 300, &data));
+  ASSERT_EQ(300, query->bytes_used());
+  op->Free(data, 300);
+  process->Free(data2, 400);
+  ASSERT_EQ(0, process->bytes_used());
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+// An operator holding a buffer it can spill
+class SpillingOperator {
+ public:
+  explicit SpillingOperator(std::shared_ptr<HierarchicalMemoryPool> pool)
+      : pool_(std::move(pool)) {
+    pool_->AddSpillCallback([this](int64_t bytes_to_free) -> int64_t {
+      requests_.push_back(bytes_to_free);
+      if (buffer_ == nullptr) {
+        return 0;
+      }
+      pool_->Free(buffer_, kBufferSize);
+      buffer_ = nullptr;
+      return kBufferSize;
+    });
+  }
+
+  Status Fill() { return pool_->Allocate(kBufferSize, &buffer_); }
+
+  bool spilled() const { return buffer_ == nullptr; }
+  const std::vector<int64_t>& requests() const { return requests_; }
+
+  static constexpr int64_t kBufferSize = 400;
+
+ private:
+  std::shared_ptr<HierarchicalMemoryPool> pool_;
+  uint8_t* buffer_ = nullptr;
+  std::vector<int64_t> requests_;
+};
+
+TEST(HierarchicalMemoryPool, SpillOnSoftLimit) {
+  auto pool = MemoryPool::CreateDefault();
+  auto process = HierarchicalMemoryPool::MakeRoot(pool.get(), "process",
+                                                  MemoryBudget{/*soft_limit=*/500,
+                                                               /*hard_limit=*/1000});
+  SpillingOperator op(process->MakeChild("operator"));
+  ASSERT_OK(op.Fill());
+  ASSERT_TRUE(op.requests().empty());
+
+  // Crossing the soft limit asks to spill, but doesn't fail
+  uint8_t* data;
+  ASSERT_OK(process->Allocate(300, &data));
+  ASSERT_EQ(std::vector<int64_t>{200}, op.requests());
+  ASSERT_TRUE(op.spilled());
+  ASSERT_EQ(300, process->bytes_used());
+
+  // Nothing left to spill
+  uint8_t* data2;
+  ASSERT_OK(process->Allocate(300, &data2));
+  ASSERT_EQ(2, op.requests().size());
+  ASSERT_EQ(100, op.requests()[1]);
+
+  // Already over the soft limit
+  uint8_t* data3;
+  ASSERT_OK(process->Allocate(100, &data3));
+  ASSERT_EQ(2, op.requests().size());
+
+  process->Free(data, 300);
+  process->Free(data2, 300);
+  process->Free(data3, 100);
+  ASSERT_EQ(0, process->bytes_used());
+}
+
+TEST(HierarchicalMemoryPool, SpillOnHardLimit) {
+  auto pool = MemoryPool::CreateDefault();
+  auto process = HierarchicalMemoryPool::MakeRoot(pool.get(), "process",
+                                                  MemoryBudget{/*soft_limit=*/1000,
+                                                               /*hard_limit=*/1000});
+  auto query = process->MakeChild("query");
+  SpillingOperator op(query->MakeChild("operator"));
+  ASSERT_OK(op.Fill());
+
+  // Exceeding the hard limit spills, then retries
+  uint8_t* data;
+  ASSERT_OK(query->Allocate(300, &data));
+  uint8_t* data2;
+  ASSERT_OK(process->Allocate(600, &data2));
+  ASSERT_EQ(std::vector<int64_t>{300}, op.requests());
+  ASSERT_TRUE(op.spilled());
+  ASSERT_EQ(900, process->bytes_used());
+
+  // Nothing left to spill
+  uint8_t* data3;
+  ASSERT_RAISES(OutOfMemory, process->Allocate(200, &data3));
+  ASSERT_EQ(2, op.requests().size());
+  // Reservations fail fast
+  ASSERT_RAISES(OutOfMemory, query->TryReserve(200));
+  ASSERT_EQ(2, op.requests().size());
+
+  query->Free(data, 300);
+  process->Free(data2, 600);
+  ASSERT_EQ(0, process->bytes_used());
+}
+
+TEST(ArenaMemoryPool, Basics) {
+  auto pool = MemoryPool::CreateDefault();
+  ArenaMemoryPool arena(pool.get(), /*slab_size=*/1024);
+
+  std::vector<uint8_t*> allocations;
+  for (int i = 0; i < 20; ++i) {
+    uint8_t* data;
+    ASSERT_OK(arena.Allocate(100, &data));
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % kDefaultBufferAlignment);
+    std::memset(data, i, 100);
+    allocations.push_back(data);
+  }
+  ASSERT_EQ(2000, arena.bytes_allocated());
+  ASSERT_EQ(20, arena.num_allocations());
+  // 8 allocations of 100 aligned bytes fit in each slab
+  ASSERT_EQ(3 * 1024, arena.slab_bytes());
+  ASSERT_EQ(3 * 1024, pool->bytes_allocated());
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_EQ(i, allocations[i][99]);
+  }
+
+  // Large allocations get their own slab
+  uint8_t* large;
+  ASSERT_OK(arena.Allocate(5000, &large));
+  ASSERT_EQ(3 * 1024 + 5000, arena.slab_bytes());
+
+  // Reallocations keep the contents
+  ASSERT_OK(arena.Reallocate(100, 300, &allocations[0]));
+  ASSERT_EQ(0, allocations[0][99]);
+  ASSERT_OK(arena.Reallocate(300, 50, &allocations[0]));
+  ASSERT_EQ(0, allocations[0][49]);
+
+  for (int i = 1; i < 20; ++i) {
+    arena.Free(allocations[i], 100);
+  }
+  arena.Free(allocations[0], 50);
+  arena.Free(large, 5000);
+  ASSERT_EQ(0, arena.bytes_allocated());
+  // Freeing doesn't give the slabs back, resetting does
+  ASSERT_LT(0, pool->bytes_allocated());
+  arena.Reset();
+  ASSERT_EQ(0, arena.slab_bytes());
+  ASSERT_EQ(0, pool->bytes_allocated());
+
+  uint8_t* data;
+  ASSERT_OK(arena.Allocate(100, &data));
+  ASSERT_EQ(1024, arena.slab_bytes());
+  arena.Free(data, 100);
+}
+
+TEST(ArenaMemoryPool, Threads) {
+  constexpr int kNumThreads = 4;
+  auto pool = MemoryPool::CreateDefault();
+  ArenaMemoryPool arena(pool.get(), /*slab_size=*/1024);
+
+  // Each thread allocates from a slab of its own (the threads wait for each other,
+  // so that none of them reuses the id of a finished one)
+  std::vector<std::thread> threads;
+  std::vector<Status> statuses(kNumThreads);
+  std::atomic<int> num_allocated{0};
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&, i] {
+      uint8_t* data;
+      statuses[i] = arena.Allocate(64, &data);
+      ++num_allocated;
+      while (num_allocated.load() < kNumThreads) {
+        std::this_thread::yield();
+      }
+      if (statuses[i].ok()) {
+        arena.Free(data, 64);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& status : statuses) {
+    ASSERT_OK(status);
+  }
+  ASSERT_EQ(kNumThreads * 1024, arena.slab_bytes());
+  arena.Reset();
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(NumaMemoryPool, Allocations) {
+  auto pool = MemoryPool::CreateDefault();
+  NumaMemoryPool numa_pool(pool.get(), /*min_size=*/4096);
+
+  uint8_t* small;
+  uint8_t* large;
+  ASSERT_OK(numa_pool.Allocate(100, &small));
+  ASSERT_OK(numa_pool.Allocate(1 << 20, &large));
+  std::memset(large, 1, 1 << 20);
+  ASSERT_OK(numa_pool.Reallocate(100, 10000, &small));
+  ASSERT_EQ((1 << 20) + 10000, numa_pool.bytes_allocated());
+  ASSERT_EQ((1 << 20) + 10000, pool->bytes_allocated());
+  ASSERT_EQ(pool->backend_name(), numa_pool.backend_name());
+
+  numa_pool.Free(small, 10000);
+  numa_pool.Free(large, 1 << 20);
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(LargePageMemoryPool, Allocations) {
+  auto pool = MemoryPool::CreateDefault();
+  LargePageOptions options;
+  options.min_size = 1 << 20;
+  options.prefault_min_size = 4 << 20;
+  for (int64_t huge_page_size : {int64_t{0}, int64_t{2} << 20}) {
+    ARROW_SCOPED_TRACE("huge_page_size = ", huge_page_size);
+    options.huge_page_size = huge_page_size;
+    LargePageMemoryPool large_pool(pool.get(), options);
+#ifdef __linux__
+    const bool maps = true;
+#else
+    const bool maps = false;
+#endif
+
+    uint8_t* small;
+    ASSERT_OK(large_pool.Allocate(1000, &small));
+    ASSERT_EQ(1000, pool->bytes_allocated());
+    ASSERT_EQ(0, large_pool.bytes_mapped());
+
+    uint8_t* large;
+    ASSERT_OK(large_pool.Allocate(5 << 20, &large));
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(large) % kDefaultBufferAlignment);
+    std::memset(large, 7, 5 << 20);
+    ASSERT_EQ(maps ? 1000 : 1000 + (5 << 20), pool->bytes_allocated());
+    if (maps) {
+      ASSERT_GE(large_pool.bytes_mapped(), 5 << 20);
+    }
+    ASSERT_EQ(1000 + (5 << 20), large_pool.bytes_allocated());
+
+    // Reallocations across the size threshold keep the contents
+    std::memset(small, 3, 1000);
+    ASSERT_OK(large_pool.Reallocate(1000, 2 << 20, &small));
+    ASSERT_EQ(3, small[999]);
+    ASSERT_OK(large_pool.Reallocate(2 << 20, 3 << 20, &small));
+    ASSERT_EQ(3, small[999]);
+    ASSERT_OK(large_pool.Reallocate(5 << 20, 100, &large));
+    ASSERT_EQ(7, large[99]);
+    ASSERT_EQ(100 + (3 << 20), large_pool.bytes_allocated());
+
+    large_pool.Free(small, 3 << 20);
+    large_pool.Free(large, 100);
+    ASSERT_EQ(0, large_pool.bytes_allocated());
+    ASSERT_EQ(0, large_pool.bytes_mapped());
+    ASSERT_EQ(0, pool->bytes_allocated());
+  }
+}
+
+TEST(RecyclingMemoryPool, Recycling) {
+  auto pool = MemoryPool::CreateDefault();
+  RecyclingMemoryPool recycling_pool(pool.get(), /*max_cached_size=*/1 << 20,
+                                     /*max_retained_bytes=*/1 << 16);
+
+  uint8_t* data;
+  ASSERT_OK(recycling_pool.Allocate(1000, &data));
+  ASSERT_EQ(1000, recycling_pool.bytes_allocated());
+  // Rounded up to the size class
+  ASSERT_EQ(1024, pool->bytes_allocated());
+  recycling_pool.Free(data, 1000);
+  ASSERT_EQ(0, recycling_pool.bytes_allocated());
+  ASSERT_EQ(1024, recycling_pool.bytes_retained());
+
+  // Allocations of the same size class reuse the freed one
+  uint8_t* other;
+  ASSERT_OK(recycling_pool.Allocate(900, &other));
+  ASSERT_EQ(data, other);
+  ASSERT_EQ(0, recycling_pool.bytes_retained());
+  ASSERT_EQ(1, pool->num_allocations());
+
+  // Reallocations within the size class stay in place
+  std::memset(other, 5, 900);
+  ASSERT_OK(recycling_pool.Reallocate(900, 1020, &other));
+  ASSERT_EQ(data, other);
+  ASSERT_OK(recycling_pool.Reallocate(1020, 3000, &other));
+  ASSERT_EQ(5, other[899]);
+  ASSERT_EQ(1024, recycling_pool.bytes_retained());
+  ASSERT_EQ(3000, recycling_pool.bytes_allocated());
+
+  // Large allocations are not recycled
+  uint8_t* large;
+  ASSERT_OK(recycling_pool.Allocate(2 << 20, &large));
+  recycling_pool.Free(large, 2 << 20);
+  ASSERT_EQ(1024, recycling_pool.bytes_retained());
+
+  // Nor are allocations beyond the retained bytes cap
+  std::vector<uint8_t*> buffers(20);
+  for (auto& buffer : buffers) {
+    ASSERT_OK(recycling_pool.Allocate(4096, &buffer));
+  }
+  for (auto& buffer : buffers) {
+    recycling_pool.Free(buffer, 4096);
+  }
+  ASSERT_LE(recycling_pool.bytes_retained(), 1 << 16);
+  ASSERT_EQ(1024 + 15 * 4096, recycling_pool.bytes_retained());
+
+  recycling_pool.Free(other, 3000);
+  ASSERT_EQ(0, recycling_pool.bytes_allocated());
+  recycling_pool.ReleaseUnused();
+  ASSERT_EQ(0, recycling_pool.bytes_retained());
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, Builders) {
+  auto pool = MemoryPool::CreateDefault();
+  RecyclingMemoryPool recycling_pool(pool.get());
+
+  auto build = [&]() {
+    Int32Builder builder(&recycling_pool);
+    for (int32_t i = 0; i < 10000; ++i) {
+      ASSERT_OK(i % 7 == 0 ? builder.AppendNull() : builder.Append(i));
+    }
+    ASSERT_OK_AND_ASSIGN(auto array, builder.Finish());
+    ASSERT_OK(array->ValidateFull());
+  };
+  build();
+  const int64_t num_allocations = pool->num_allocations();
+  ASSERT_GT(recycling_pool.bytes_retained(), 0);
+
+  // The buffers of the first batch are recycled for the second one
+  build();
+  ASSERT_EQ(num_allocations, pool->num_allocations());
+  ASSERT_EQ(0, recycling_pool.bytes_allocated());
+}
+
+TEST(ProfilingMemoryPool, Tags) {
+  auto pool = MemoryPool::CreateDefault();
+  ProfilingOptions options;
+  options.sampling_interval = 1;
+  ProfilingMemoryPool profiling_pool(pool.get(), options);
+
+  uint8_t *untagged, *decode, *join;
+  ASSERT_OK(profiling_pool.Allocate(100, &untagged));
+  {
+    ScopedAllocationTag tag("parquet::decode");
+    ASSERT_OK(profiling_pool.Allocate(1000, &decode));
+    {
+      ScopedAllocationTag inner_tag("acero::hash_join");
+      ASSERT_EQ("acero::hash_join", ScopedAllocationTag::current());
+      ASSERT_OK(profiling_pool.Allocate(3000, &join));
+    }
+    ASSERT_EQ("parquet::decode", ScopedAllocationTag::current());
+    ASSERT_OK(profiling_pool.Reallocate(1000, 2000, &decode));
+  }
+  ASSERT_EQ("", ScopedAllocationTag::current());
+  ASSERT_EQ(6100, profiling_pool.bytes_allocated());
+
+  using LiveBytes = std::unordered_map<std::string, int64_t>;
+  ASSERT_EQ((LiveBytes{{"", 100}, {"parquet::decode", 2000}, {"acero::hash_join", 3000}}),
+            profiling_pool.LiveBytesByTag());
+
+  const std::string profile = profiling_pool.HeapProfile();
+  ASSERT_NE(std::string::npos, profile.find("inuse_space"));
+  ASSERT_NE(std::string::npos, profile.find("parquet::decode"));
+  ASSERT_NE(std::string::npos, profile.find("acero::hash_join"));
+
+  profiling_pool.Free(join, 3000);
+  profiling_pool.Free(decode, 2000);
+  ASSERT_EQ((LiveBytes{{"", 100}}), profiling_pool.LiveBytesByTag());
+  profiling_pool.Free(untagged, 100);
+  ASSERT_EQ(LiveBytes{}, profiling_pool.LiveBytesByTag());
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(ProfilingMemoryPool, HeapProfileAggregatesIdenticalAllocations) {
+  auto pool = MemoryPool::CreateDefault();
+  ProfilingOptions options;
+  options.sampling_interval = 1;
+  options.max_stack_depth = 0;
+  ProfilingMemoryPool profiling_pool(pool.get(), options);
+
+  uint8_t *first, *second;
+  {
+    ScopedAllocationTag tag("twins");
+    ASSERT_OK(profiling_pool.Allocate(1000, &first));
+    ASSERT_OK(profiling_pool.Allocate(1000, &second));
+  }
+  // The two allocations have the same (empty) stack and tag, so they form a
+  // single sample whose packed values are {inuse_objects=2, inuse_space=2000}
+  // rather than two samples of {1, 1000}
+  const std::string profile = profiling_pool.HeapProfile();
+  const std::string aggregated("\x12\x03\x02\xd0\x0f");
+  const std::string single("\x12\x03\x01\xe8\x07");
+  ASSERT_NE(std::string::npos, profile.find(aggregated));
+  ASSERT_EQ(std::string::npos, profile.find(single));
+
+  profiling_pool.Free(first, 1000);
+  profiling_pool.Free(second, 1000);
+}
+
+TEST(ProfilingMemoryPool, FailedReallocateKeepsSample) {
+  auto pool = MemoryPool::CreateDefault();
+  auto limited = HierarchicalMemoryPool::MakeRoot(
+      pool.get(), "limited", MemoryBudget{/*soft_limit=*/1000, /*hard_limit=*/1000});
+  ProfilingOptions options;
+  options.sampling_interval = 1;
+  ProfilingMemoryPool profiling_pool(limited.get(), options);
+
+  using LiveBytes = std::unordered_map<std::string, int64_t>;
+  uint8_t* data;
+  {
+    ScopedAllocationTag tag("kept");
+    ASSERT_OK(profiling_pool.Allocate(500, &data));
+  }
+  ASSERT_RAISES(OutOfMemory, profiling_pool.Reallocate(500, 2000, &data));
+  ASSERT_EQ((LiveBytes{{"kept", 500}}), profiling_pool.LiveBytesByTag());
+
+  ASSERT_OK(profiling_pool.Reallocate(500, 800, &data));
+  ASSERT_EQ((LiveBytes{{"", 800}}), profiling_pool.LiveBytesByTag());
+  profiling_pool.Free(data, 800);
+  ASSERT_EQ(LiveBytes{}, profiling_pool.LiveBytesByTag());
+}
+
+TEST(ProfilingMemoryPool, Concurrent) {
+  auto pool = MemoryPool::CreateDefault();
+  ProfilingOptions options;
+  options.sampling_interval = 4096;
+  options.max_stack_depth = 0;
+  ProfilingMemoryPool profiling_pool(pool.get(), options);
+
+  constexpr int kThreads = 8;
+  constexpr int kIterations = 10000;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&] {
+      ScopedAllocationTag tag("concurrent");
+      for (int j = 0; j < kIterations; ++j) {
+        uint8_t* data;
+        ASSERT_OK(profiling_pool.Allocate(64, &data));
+        ASSERT_OK(profiling_pool.Reallocate(64, 256, &data));
+        profiling_pool.Free(data, 256);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // Every sample was forgotten, none was dropped while live or left behind
+  ASSERT_EQ(0, profiling_pool.LiveBytesByTag()["concurrent"]);
+  ASSERT_EQ(0, profiling_pool.bytes_allocated());
+}
+
+TEST(ProfilingMemoryPool, Sampling) {
+  auto pool = MemoryPool::CreateDefault();
+  ProfilingOptions options;
+  options.sampling_interval = 4096;
+  options.max_stack_depth = 0;
+  ProfilingMemoryPool profiling_pool(pool.get(), options);
+
+  constexpr int kAllocations = 10000;
+  constexpr int64_t kSize = 1000;
+  std::vector<uint8_t*> buffers(kAllocations);
+  {
+    ScopedAllocationTag tag("sampled");
+    for (auto& buffer : buffers) {
+      ASSERT_OK(profiling_pool.Allocate(kSize, &buffer));
+    }
+  }
+  // The sampled allocations estimate the live bytes
+  const int64_t estimate = profiling_pool.LiveBytesByTag()["sampled"];
+  ASSERT_NEAR(static_cast<double>(estimate), kAllocations * kSize,
+              0.2 * kAllocations * kSize);
+  ASSERT_NE(std::string::npos, profiling_pool.HeapProfile().find("sampled"));
+
+  for (auto& buffer : buffers) {
+    profiling_pool.Free(buffer, kSize);
+  }
+  ASSERT_EQ(0, profiling_pool.LiveBytesByTag()["sampled"]);
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
@@ -1322,10 +1322,10 @@ typename std::enable_if_t<std::is_same<To, StringType>::value,
 CastImpl(const BaseListScalar& from, std::shared_ptr<DataType> to_type) {
   std::stringstream ss;
   ss << from.type->ToString() << "[";
-  for (int64_t i = 0; i < from.value->length(); i++) {
+  ARROW_ASSIGN_OR_RAISE(auto values, from.value->GetScalars());
+  for (size_t i = 0; i < values.size(); i++) {
     if (i > 0) ss << ", ";
-    ARROW_ASSIGN_OR_RAISE(auto value, from.value->GetScalar(i));
-    ss << value->ToString();
+    ss << values[i]->ToString();
   }
   ss << ']';
   return std::make_shared<StringScalar>(Buffer::FromString(ss.str()), std::move(to_type));
@@ -18,6 +18,7 @@
 #include "arrow/table.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <limits>
 #include <memory>
@@ -40,6 +41,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -97,15 +99,7 @@ class SimpleTable : public Table {
     return columns_;
   }
 
-  std::shared_ptr<Table> Slice(int64_t offset, int64_t length) const override {
-    auto sliced = columns_;
-    int64_t num_rows = length;
-    for (auto& column : sliced) {
-      column = column->Slice(offset, length);
-      num_rows = column->length();
-    }
-    return Table::Make(schema_, std::move(sliced), num_rows);
-  }
+  std::shared_ptr<Table> Slice(int64_t offset, int64_t length) const override;
 
   Result<std::shared_ptr<Table>> RemoveColumn(int i) const override {
     ARROW_ASSIGN_OR_RAISE(auto new_schema, schema_->RemoveField(i));
@@ -193,9 +187,26 @@ class SimpleTable : public Table {
 
   Status ValidateFull() const override {
     RETURN_NOT_OK(ValidateMeta());
+    // Columns are validated in parallel if worthwhile, otherwise the chunks of
+    // each column may be
+    std::vector<Status> statuses(num_columns());
+    if (auto* executor = internal::GetParallelChunksExecutor(
+            num_rows_ * num_columns(), num_columns())) {
+      DCHECK_OK(internal::ParallelFor(
+          num_columns(),
+          [&](int i) {
+            statuses[i] = columns_[i]->ValidateFull();
+            return Status::OK();
+          },
+          executor));
+    } else {
+      for (int i = 0; i < num_columns(); ++i) {
+        statuses[i] = columns_[i]->ValidateFull();
+        if (!statuses[i].ok()) break;
+      }
+    }
     for (int i = 0; i < num_columns(); ++i) {
-      const ChunkedArray* col = columns_[i].get();
-      Status st = col->ValidateFull();
+      const Status& st = statuses[i];
       if (!st.ok()) {
         std::stringstream ss;
         ss << "Column " << i << ": " << st.message();
@@ -245,6 +256,113 @@ class SimpleTable : public Table {
   std::vector<std::shared_ptr<ChunkedArray>> columns_;
 };
 
+/// \class SlicedTable
+/// \brief A row range of other table columns, only sliced when accessed
+///
+/// Slicing a wide table is then O(1) per column, and windowing over a table
+/// only pays for the columns actually read.
+class SlicedTable : public Table {
+ public:
+  SlicedTable(std::shared_ptr<Schema> schema,
+              std::vector<std::shared_ptr<ChunkedArray>> unsliced_columns,
+              int64_t offset, int64_t num_rows)
+      : unsliced_columns_(std::move(unsliced_columns)),
+        offset_(offset),
+        columns_(unsliced_columns_.size()) {
+    schema_ = std::move(schema);
+    num_rows_ = num_rows;
+  }
+
+  /// Slice rows [offset, offset + length) of a table of `num_rows` rows whose
+  /// first row is at `base_offset` in `unsliced_columns`
+  static std::shared_ptr<Table> Make(
+      std::shared_ptr<Schema> schema,
+      std::vector<std::shared_ptr<ChunkedArray>> unsliced_columns, int64_t base_offset,
+      int64_t num_rows, int64_t offset, int64_t length) {
+    ARROW_CHECK_LE(offset, num_rows) << "Slice offset greater than table length";
+    return std::make_shared<SlicedTable>(std::move(schema), std::move(unsliced_columns),
+                                         base_offset + offset,
+                                         std::min(length, num_rows - offset));
+  }
+
+  std::shared_ptr<ChunkedArray> column(int i) const override {
+    std::shared_ptr<ChunkedArray> result = std::atomic_load(&columns_[i]);
+    if (!result) {
+      auto new_column = unsliced_columns_[i]->Slice(offset_, num_rows_);
+      // Don't overwrite an entry another thread stored in the meantime, as the
+      // `columns_` contents are exposed by `columns()`
+      if (std::atomic_compare_exchange_strong(&columns_[i], &result, new_column)) {
+        return new_column;
+      }
+    }
+    return result;
+  }
+
+  const std::vector<std::shared_ptr<ChunkedArray>>& columns() const override {
+    for (int i = 0; i < num_columns(); ++i) {
+      // Force all columns to be sliced
+      column(i);
+    }
+    return columns_;
+  }
+
+  std::shared_ptr<Table> Slice(int64_t offset, int64_t length) const override {
+    return Make(schema_, unsliced_columns_, offset_, num_rows_, offset, length);
+  }
+
+  Result<std::shared_ptr<Table>> RemoveColumn(int i) const override {
+    ARROW_ASSIGN_OR_RAISE(auto new_schema, schema_->RemoveField(i));
+    return std::make_shared<SlicedTable>(
+        std::move(new_schema), internal::DeleteVectorElement(unsliced_columns_, i),
+        offset_, num_rows_);
+  }
+
+  Result<std::shared_ptr<Table>> AddColumn(
+      int i, std::shared_ptr<Field> field_arg,
+      std::shared_ptr<ChunkedArray> col) const override {
+    return Materialize()->AddColumn(i, std::move(field_arg), std::move(col));
+  }
+
+  Result<std::shared_ptr<Table>> SetColumn(
+      int i, std::shared_ptr<Field> field_arg,
+      std::shared_ptr<ChunkedArray> col) const override {
+    return Materialize()->SetColumn(i, std::move(field_arg), std::move(col));
+  }
+
+  std::shared_ptr<Table> ReplaceSchemaMetadata(
+      const std::shared_ptr<const KeyValueMetadata>& metadata) const override {
+    return std::make_shared<SlicedTable>(schema_->WithMetadata(metadata),
+                                         unsliced_columns_, offset_, num_rows_);
+  }
+
+  Result<std::shared_ptr<Table>> Flatten(MemoryPool* pool) const override {
+    return Materialize()->Flatten(pool);
+  }
+
+  Status Validate() const override { return Materialize()->Validate(); }
+
+  Status ValidateFull() const override { return Materialize()->ValidateFull(); }
+
+ private:
+  std::shared_ptr<Table> Materialize() const {
+    return Table::Make(schema_, columns(), num_rows_);
+  }
+
+  // The columns of the table this one was sliced from
+  const std::vector<std::shared_ptr<ChunkedArray>> unsliced_columns_;
+  const int64_t offset_;
+  // Lazily sliced from `unsliced_columns_`
+  mutable std::vector<std::shared_ptr<ChunkedArray>> columns_;
+};
+
+std::shared_ptr<Table> SimpleTable::Slice(int64_t offset, int64_t length) const {
+  if (columns_.empty()) {
+    return Table::Make(schema_, columns_, length);
+  }
+  return SlicedTable::Make(schema_, columns_, /*base_offset=*/0, num_rows_, offset,
+                           length);
+}
+
 Table::Table() : num_rows_(0) {}
 
 std::vector<std::shared_ptr<Field>> Table::fields() const {
@@ -544,6 +662,23 @@ bool Table::Equals(const Table& other, bool check_metadata) const {
     return false;
   }
 
+  // Columns are compared in parallel if worthwhile, otherwise the chunks of
+  // each column may be
+  if (auto* executor = internal::GetParallelChunksExecutor(
+          num_rows_ * num_columns(), num_columns())) {
+    std::atomic<bool> unequal{false};
+    DCHECK_OK(internal::ParallelFor(
+        num_columns(),
+        [&](int i) {
+          if (!unequal.load(std::memory_order_relaxed) &&
+              !this->column(i)->Equals(other.column(i))) {
+            unequal.store(true, std::memory_order_relaxed);
+          }
+          return Status::OK();
+        },
+        executor));
+    return !unequal.load();
+  }
   for (int i = 0; i < this->num_columns(); i++) {
     if (!this->column(i)->Equals(other.column(i))) {
       return false;
@@ -562,6 +697,20 @@ Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
       continue;
     }
 
+    // Adopt the only non-empty chunk, if any, rather than copying it
+    int num_non_empty_chunks = 0;
+    std::shared_ptr<Array> non_empty_chunk;
+    for (const auto& chunk : col->chunks()) {
+      if (chunk->length() > 0) {
+        ++num_non_empty_chunks;
+        non_empty_chunk = chunk;
+      }
+    }
+    if (num_non_empty_chunks == 1) {
+      compacted_columns[i] = std::make_shared<ChunkedArray>(std::move(non_empty_chunk));
+      continue;
+    }
+
     if (is_binary_like(col->type()->id())) {
       // ARROW-5744 Allow binary columns to be combined into multiple chunks to avoid
       // buffer overflow
@@ -212,7 +212,8 @@ class ARROW_EXPORT Table {
   /// \brief Make a new table by combining the chunks this table has.
   ///
   /// All the underlying chunks in the ChunkedArray of each column are
-  /// concatenated into zero or one chunk.
+  /// concatenated into zero or one chunk.  A column with a single non-empty
+  /// chunk keeps it without copying.
   ///
   /// \param[in] pool The pool for buffer allocations
   Result<std::shared_ptr<Table>> CombineChunks(
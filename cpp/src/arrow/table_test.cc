@@ -186,6 +186,39 @@ TEST_F(TestTable, Equals) {
   ASSERT_FALSE(table_->Equals(*other, /*check_metadata=*/true));
 }
 
+TEST_F(TestTable, EqualsAndValidateLargeColumns) {
+  // Large enough to compare and validate columns in parallel
+  const int length = 100000;
+  MakeExample1(length);
+  table_ = Table::Make(schema_, columns_);
+  ASSERT_OK(table_->ValidateFull());
+
+  std::vector<std::shared_ptr<ChunkedArray>> other_columns;
+  for (const auto& array : arrays_) {
+    other_columns.push_back(
+        std::make_shared<ChunkedArray>(ArrayVector{array->Slice(0, length / 3),
+                                                   array->Slice(length / 3)}));
+  }
+  auto other = Table::Make(schema_, other_columns);
+  ASSERT_TRUE(table_->Equals(*other));
+
+  other_columns[1] = std::make_shared<ChunkedArray>(gen_.ArrayOf(uint8(), length));
+  other = Table::Make(schema_, other_columns);
+  ASSERT_FALSE(table_->Equals(*other));
+
+  // The first invalid column is reported
+  for (int i : {2, 1}) {
+    auto data =
+        gen_.ArrayOf(schema_->field(i)->type(), length, /*null_probability=*/0.1)->data();
+    data->null_count = 0;
+    columns_[i] = std::make_shared<ChunkedArray>(MakeArray(data));
+  }
+  table_ = Table::Make(schema_, columns_);
+  ASSERT_OK(table_->Validate());
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("Column 1: "),
+                                  table_->ValidateFull());
+}
+
 TEST_F(TestTable, MakeEmpty) {
   auto f0 = field("f0", int32());
   auto f1 = field("f1", uint8());
@@ -292,6 +325,24 @@ TEST_F(TestTable, CombineChunks) {
   }
 }
 
+TEST_F(TestTable, CombineChunksAdoptsSingleNonEmptyChunk) {
+  MakeExample1(10);
+  auto batch = RecordBatch::Make(schema_, 10, arrays_);
+  MakeExample1(0);
+  auto empty_batch = RecordBatch::Make(schema_, 0, arrays_);
+
+  ASSERT_OK_AND_ASSIGN(auto table,
+                       Table::FromRecordBatches({empty_batch, batch, empty_batch}));
+  ASSERT_OK_AND_ASSIGN(auto compacted, table->CombineChunks());
+
+  EXPECT_TRUE(compacted->Equals(*table));
+  for (int i = 0; i < compacted->num_columns(); ++i) {
+    ASSERT_EQ(1, compacted->column(i)->num_chunks());
+    // The chunk is not copied
+    ASSERT_EQ(batch->column_data(i).get(), compacted->column(i)->chunk(0)->data().get());
+  }
+}
+
 TEST_F(TestTable, LARGE_MEMORY_TEST(CombineChunksStringColumn)) {
   schema_ = schema({field("str", utf8())});
   arrays_ = {nullptr};
@@ -568,6 +619,41 @@ TEST_F(TestTable, Slice) {
                     *three->Slice(length + length / 3, 2 * (length - length / 3)));
 }
 
+TEST_F(TestTable, SliceOfSlice) {
+  const int64_t length = 10;
+
+  MakeExample1(length);
+  auto batch = RecordBatch::Make(schema_, length, arrays_);
+  ASSERT_OK_AND_ASSIGN(auto three, Table::FromRecordBatches({batch, batch, batch}));
+
+  auto sliced = three->Slice(5, 20);
+  ASSERT_EQ(sliced->num_rows(), 20);
+  // Columns are sliced once, then reused
+  ASSERT_EQ(sliced->column(1), sliced->column(1));
+  ASSERT_EQ(sliced->columns()[1], sliced->column(1));
+  AssertChunkedEqual(*three->column(2)->Slice(5, 20), *sliced->column(2));
+  ASSERT_OK(sliced->ValidateFull());
+
+  auto nested = sliced->Slice(3, 100);
+  ASSERT_EQ(nested->num_rows(), 17);
+  AssertTablesEqual(*three->Slice(8), *nested);
+  AssertTablesEqual(*three->Slice(8, 0), *nested->Slice(17));
+
+  ASSERT_OK_AND_ASSIGN(auto removed, nested->RemoveColumn(0));
+  ASSERT_OK_AND_ASSIGN(auto expected, three->Slice(8)->RemoveColumn(0));
+  AssertTablesEqual(*expected, *removed);
+
+  auto metadata = key_value_metadata({"key"}, {"value"});
+  auto with_metadata = nested->ReplaceSchemaMetadata(metadata);
+  ASSERT_TRUE(with_metadata->schema()->metadata()->Equals(*metadata));
+  AssertTablesEqual(*nested, *with_metadata);
+
+  ASSERT_OK_AND_ASSIGN(
+      auto replaced, nested->SetColumn(1, schema_->field(1),
+                                       three->column(1)->Slice(8)));
+  AssertTablesEqual(*nested, *replaced);
+}
+
 TEST_F(TestTable, RemoveColumn) {
   const int64_t length = 10;
   MakeExample1(length);
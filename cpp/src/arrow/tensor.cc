@@ -28,13 +28,16 @@
 #include <type_traits>
 #include <vector>
 
+#include "arrow/chunked_array.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/unreachable.h"
 #include "arrow/visit_type_inline.h"
 
@@ -223,30 +226,42 @@ Status ValidateTensorParameters(const std::shared_ptr<DataType>& type,
   return Status::OK();
 }
 
+// Convert rows [row_begin, row_end) of a column, writing consecutive rows
+// `out_stride` values apart
 template <typename Out>
-struct ConvertColumnsToTensorVisitor {
-  Out*& out_values;
+struct ConvertColumnToTensorVisitor {
+  Out* out_values;
+  int64_t out_stride;
   const ArrayData& in_data;
+  int64_t row_begin;
+  int64_t row_end;
 
   template <typename T>
   Status Visit(const T&) {
     if constexpr (is_numeric(T::type_id)) {
       using In = typename T::c_type;
-      auto in_values = ArraySpan(in_data).GetSpan<In>(1, in_data.length);
-
-      if (in_data.null_count == 0) {
-        if constexpr (std::is_same_v<In, Out>) {
-          memcpy(out_values, in_values.data(), in_values.size_bytes());
-          out_values += in_values.size();
+      const In* in_values = in_data.GetValues<In>(1);
+      const int64_t length = row_end - row_begin;
+
+      if (in_data.GetNullCount() == 0) {
+        if (out_stride == 1) {
+          if constexpr (std::is_same_v<In, Out>) {
+            memcpy(out_values, in_values + row_begin, length * sizeof(Out));
+          } else {
+            for (int64_t i = 0; i < length; ++i) {
+              out_values[i] = static_cast<Out>(in_values[row_begin + i]);
+            }
+          }
         } else {
-          for (In in_value : in_values) {
-            *out_values++ = static_cast<Out>(in_value);
+          for (int64_t i = 0; i < length; ++i) {
+            out_values[i * out_stride] = static_cast<Out>(in_values[row_begin + i]);
           }
         }
       } else {
-        for (int64_t i = 0; i < in_data.length; ++i) {
-          *out_values++ =
-              in_data.IsNull(i) ? static_cast<Out>(NAN) : static_cast<Out>(in_values[i]);
+        for (int64_t i = 0; i < length; ++i) {
+          out_values[i * out_stride] = in_data.IsNull(row_begin + i)
+                                           ? static_cast<Out>(NAN)
+                                           : static_cast<Out>(in_values[row_begin + i]);
         }
       }
       return Status::OK();
@@ -255,52 +270,65 @@ struct ConvertColumnsToTensorVisitor {
   }
 };
 
-template <typename Out>
-struct ConvertColumnsToTensorRowMajorVisitor {
-  Out*& out_values;
-  const ArrayData& in_data;
-  int num_cols;
-  int col_idx;
-
-  template <typename T>
-  Status Visit(const T&) {
-    if constexpr (is_numeric(T::type_id)) {
-      using In = typename T::c_type;
-      auto in_values = ArraySpan(in_data).GetSpan<In>(1, in_data.length);
-
-      if (in_data.null_count == 0) {
-        for (int64_t i = 0; i < in_data.length; ++i) {
-          out_values[i * num_cols + col_idx] = static_cast<Out>(in_values[i]);
-        }
-      } else {
-        for (int64_t i = 0; i < in_data.length; ++i) {
-          out_values[i * num_cols + col_idx] =
-              in_data.IsNull(i) ? static_cast<Out>(NAN) : static_cast<Out>(in_values[i]);
-        }
-      }
-      return Status::OK();
-    }
-    Unreachable();
-  }
-};
+// Row-major conversion writes this many output bytes at a time, so that the strided
+// writes of all the columns stay in cache
+constexpr int64_t kRowMajorBlockBytes = 64 * 1024;
+// Row-major conversion tasks take consecutive blocks
+constexpr int kMaxRowMajorTasks = 256;
 
 template <typename DataType>
 inline void ConvertColumnsToTensor(const RecordBatch& batch, uint8_t* out,
                                    bool row_major) {
   using CType = typename arrow::TypeTraits<DataType>::CType;
   auto* out_values = reinterpret_cast<CType*>(out);
-
-  int i = 0;
-  for (const auto& column : batch.columns()) {
-    if (row_major) {
-      ConvertColumnsToTensorRowMajorVisitor<CType> visitor{out_values, *column->data(),
-                                                           batch.num_columns(), i++};
-      DCHECK_OK(VisitTypeInline(*column->type(), &visitor));
-    } else {
-      ConvertColumnsToTensorVisitor<CType> visitor{out_values, *column->data()};
-      DCHECK_OK(VisitTypeInline(*column->type(), &visitor));
-    }
-  }
+  const ArrayDataVector& columns = batch.column_data();
+  const int num_cols = batch.num_columns();
+  const int64_t num_rows = batch.num_rows();
+
+  auto convert_rows = [&](int col, int64_t row_begin, int64_t row_end) {
+    CType* col_out = row_major ? out_values + row_begin * num_cols + col
+                               : out_values + col * num_rows + row_begin;
+    ConvertColumnToTensorVisitor<CType> visitor{
+        col_out, row_major ? num_cols : 1, *columns[col], row_begin, row_end};
+    DCHECK_OK(VisitTypeInline(*columns[col]->type, &visitor));
+  };
+
+  if (!row_major) {
+    // Each column is contiguous in the output
+    auto* executor = GetParallelChunksExecutor(num_rows * num_cols, num_cols);
+    DCHECK_OK(OptionalParallelFor(
+        executor != nullptr, num_cols,
+        [&](int col) {
+          convert_rows(col, 0, num_rows);
+          return Status::OK();
+        },
+        executor));
+    return;
+  }
+
+  const int64_t block_rows = std::max<int64_t>(
+      16, kRowMajorBlockBytes / (static_cast<int64_t>(sizeof(CType)) * num_cols));
+  const int64_t num_blocks = bit_util::CeilDiv(num_rows, block_rows);
+  const int num_tasks =
+      static_cast<int>(std::min<int64_t>(num_blocks, kMaxRowMajorTasks));
+  const int64_t blocks_per_task =
+      num_tasks > 0 ? bit_util::CeilDiv(num_blocks, num_tasks) : 0;
+  auto* executor = GetParallelChunksExecutor(num_rows * num_cols, num_tasks);
+  DCHECK_OK(OptionalParallelFor(
+      executor != nullptr, num_tasks,
+      [&](int task) {
+        const int64_t task_end =
+            std::min(num_rows, (task + 1) * blocks_per_task * block_rows);
+        for (int64_t row_begin = task * blocks_per_task * block_rows;
+             row_begin < task_end; row_begin += block_rows) {
+          const int64_t row_end = std::min(task_end, row_begin + block_rows);
+          for (int col = 0; col < num_cols; ++col) {
+            convert_rows(col, row_begin, row_end);
+          }
+        }
+        return Status::OK();
+      },
+      executor));
 }
 
 Status RecordBatchToTensor(const RecordBatch& batch, bool null_to_nan, bool row_major,
@@ -369,7 +397,7 @@ Status RecordBatchToTensor(const RecordBatch& batch, bool null_to_nan, bool row_
   // Allocate memory
   ARROW_ASSIGN_OR_RAISE(
       std::shared_ptr<Buffer> result,
-      AllocateBuffer(result_type->bit_width() * batch.num_columns() * batch.num_rows(),
+      AllocateBuffer(result_type->byte_width() * batch.num_columns() * batch.num_rows(),
                      pool));
   // Copy data
   switch (result_type->id()) {
@@ -26,6 +26,7 @@
 #include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/macros.h"
 #include "arrow/visit_type_inline.h"
@@ -52,26 +53,49 @@ inline void IncrementRowMajorIndex(std::vector<c_index_type>& coord,
   }
 }
 
+// Bitmask of the nonzeros among `values[0:n]`, written so that it vectorizes
+template <typename c_value_type>
+inline uint64_t NonZeroMask(const c_value_type* values, int64_t n) {
+  uint64_t mask = 0;
+  for (int64_t i = 0; i < n; ++i) {
+    mask |= static_cast<uint64_t>(values[i] != 0) << i;
+  }
+  return mask;
+}
+
 template <typename c_index_type, typename c_value_type>
 void ConvertRowMajorTensor(const Tensor& tensor, c_index_type* indices,
                            c_value_type* values, const int64_t size) {
+  // Scan the innermost dimension 64 values at a time, and only visit the nonzeros
+  // found in each block
+  constexpr int64_t kBlockSize = 64;
   const auto ndim = tensor.ndim();
   const auto& shape = tensor.shape();
   const c_value_type* tensor_data =
       reinterpret_cast<const c_value_type*>(tensor.raw_data());
+  const int64_t row_length = shape[ndim - 1];
 
-  constexpr c_value_type zero = 0;
   std::vector<c_index_type> coord(ndim, 0);
-  for (int64_t n = tensor.size(); n > 0; --n) {
-    const c_value_type x = *tensor_data;
-    if (ARROW_PREDICT_FALSE(x != zero)) {
-      std::copy(coord.begin(), coord.end(), indices);
-      *values++ = x;
-      indices += ndim;
+  for (int64_t n = tensor.size(); n > 0; n -= row_length) {
+    for (int64_t j = 0; j < row_length; j += kBlockSize) {
+      uint64_t mask =
+          NonZeroMask(tensor_data + j, std::min(kBlockSize, row_length - j));
+      while (mask != 0) {
+        const int64_t k = j + bit_util::CountTrailingZeros(mask);
+        mask &= mask - 1;
+        coord[ndim - 1] = static_cast<c_index_type>(k);
+        std::copy(coord.begin(), coord.end(), indices);
+        *values++ = tensor_data[k];
+        indices += ndim;
+      }
     }
+    tensor_data += row_length;
 
-    IncrementRowMajorIndex(coord, shape);
-    ++tensor_data;
+    // Advance to the next row
+    for (int d = ndim - 2; d >= 0; --d) {
+      if (++coord[d] < shape[d]) break;
+      coord[d] = 0;
+    }
   }
 }
 
@@ -25,7 +25,7 @@
 
 namespace arrow {
 
-template <typename ValueType>
+template <typename ValueType, bool RowMajor = true>
 static void BatchToTensorSimple(benchmark::State& state) {
   using CType = typename ValueType::c_type;
   std::shared_ptr<DataType> ty = TypeTraits<ValueType>::type_singleton();
@@ -45,14 +45,15 @@ static void BatchToTensorSimple(benchmark::State& state) {
   auto batch = RecordBatch::Make(schema, num_rows, columns);
 
   for (auto _ : state) {
-    ASSERT_OK_AND_ASSIGN(auto tensor, batch->ToTensor());
+    ASSERT_OK_AND_ASSIGN(auto tensor,
+                         batch->ToTensor(/*null_to_nan=*/false, RowMajor));
   }
   state.SetItemsProcessed(state.iterations() * num_rows * num_cols);
   state.SetBytesProcessed(state.iterations() * ty->byte_width() * num_rows * num_cols);
 }
 
 void SetArgs(benchmark::internal::Benchmark* bench) {
-  for (int64_t size : {kL1Size, kL2Size}) {
+  for (int64_t size : {kL1Size, kL2Size, kL3Size}) {
     for (int64_t num_columns : {3, 30, 300}) {
       bench->Args({size, num_columns});
       bench->ArgNames({"size", "num_columns"});
@@ -64,5 +65,9 @@ BENCHMARK_TEMPLATE(BatchToTensorSimple, Int8Type)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BatchToTensorSimple, Int16Type)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BatchToTensorSimple, Int32Type)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BatchToTensorSimple, Int64Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BatchToTensorSimple, DoubleType)->Apply(SetArgs);
+
+BENCHMARK_TEMPLATE(BatchToTensorSimple, Int32Type, false)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BatchToTensorSimple, DoubleType, false)->Apply(SetArgs);
 
 }  // namespace arrow
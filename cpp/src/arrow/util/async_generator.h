@@ -17,10 +17,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <cstring>
 #include <deque>
+#include <functional>
 #include <limits>
 #include <optional>
 #include <queue>
@@ -145,9 +147,20 @@ Future<std::vector<T>> CollectAsyncGenerator(AsyncGenerator<T> generator) {
 template <typename T, typename V>
 class MappingGenerator {
  public:
+  /// \brief A synchronous map function
+  ///
+  /// Its results finish the futures returned by the generator directly, rather
+  /// than through an intermediate future per item.
+  struct SyncMap {
+    std::function<Result<V>(const T&)> fn;
+  };
+
   MappingGenerator(AsyncGenerator<T> source, std::function<Future<V>(const T&)> map)
       : state_(std::make_shared<State>(std::move(source), std::move(map))) {}
 
+  MappingGenerator(AsyncGenerator<T> source, SyncMap map)
+      : state_(std::make_shared<State>(std::move(source), std::move(map.fn))) {}
+
   Future<V> operator()() {
     auto future = Future<V>::Make();
     bool should_trigger;
@@ -174,6 +187,13 @@ class MappingGenerator {
           mutex(),
           finished(false) {}
 
+    State(AsyncGenerator<T> source, std::function<Result<V>(const T&)> sync_map)
+        : source(std::move(source)),
+          sync_map(std::move(sync_map)),
+          waiting_jobs(),
+          mutex(),
+          finished(false) {}
+
     void Purge() {
       // This might be called by an original callback (if the source iterator fails or
       // ends) or by a mapped callback (if the map function fails or ends prematurely).
@@ -186,7 +206,9 @@ class MappingGenerator {
     }
 
     AsyncGenerator<T> source;
+    // Exactly one of these is set
     std::function<Future<V>(const T&)> map;
+    std::function<Result<V>(const T&)> sync_map;
     std::deque<Future<V>> waiting_jobs;
     util::Mutex mutex;
     bool finished;
@@ -243,6 +265,9 @@ class MappingGenerator {
         const T& val = maybe_next.ValueUnsafe();
         if (IsIterationEnd(val)) {
           sink.MarkFinished(IterationTraits<V>::End());
+        } else if (state->sync_map) {
+          Result<V> mapped = state->sync_map(val);
+          MappedCallback{std::move(state), std::move(sink)}(mapped);
         } else {
           Future<V> mapped_fut = state->map(val);
           mapped_fut.AddCallback(MappedCallback{std::move(state), std::move(sink)});
@@ -264,15 +289,28 @@ class MappingGenerator {
 /// Note: This function makes a copy of `map` for each item
 /// Note: Errors returned from the `map` function will be propagated
 ///
+/// A `map` function returning a value or a Result (rather than a Future) is
+/// applied without allocating an intermediate future per item.
+///
 /// If the source generator is async-reentrant then this generator will be also
 template <typename T, typename MapFn,
           typename Mapped = detail::result_of_t<MapFn(const T&)>,
           typename V = typename EnsureFuture<Mapped>::type::ValueType>
 AsyncGenerator<V> MakeMappedGenerator(AsyncGenerator<T> source_generator, MapFn map) {
-  auto map_callback = [map = std::move(map)](const T& val) mutable -> Future<V> {
-    return ToFuture(map(val));
-  };
-  return MappingGenerator<T, V>(std::move(source_generator), std::move(map_callback));
+  if constexpr (std::is_same<Mapped, V>::value ||
+                std::is_same<Mapped, Result<V>>::value) {
+    auto map_callback = [map = std::move(map)](const T& val) mutable -> Result<V> {
+      return map(val);
+    };
+    return MappingGenerator<T, V>(
+        std::move(source_generator),
+        typename MappingGenerator<T, V>::SyncMap{std::move(map_callback)});
+  } else {
+    auto map_callback = [map = std::move(map)](const T& val) mutable -> Future<V> {
+      return ToFuture(map(val));
+    };
+    return MappingGenerator<T, V>(std::move(source_generator), std::move(map_callback));
+  }
 }
 
 /// \brief Create a generator that will apply the map function to
@@ -816,6 +854,114 @@ class ReadaheadGenerator {
   std::shared_ptr<State> state_;
 };
 
+/// \see MakeAdaptiveReadaheadGenerator
+template <typename T>
+class AdaptiveReadaheadGenerator {
+ public:
+  AdaptiveReadaheadGenerator(AsyncGenerator<T> source_generator, int initial_readahead,
+                             int max_readahead, std::function<int64_t(const T&)> size_of,
+                             int64_t max_bytes)
+      : state_(std::make_shared<State>(std::move(source_generator), initial_readahead,
+                                       max_readahead, std::move(size_of), max_bytes)) {}
+
+  Future<T> operator()() {
+    auto state = state_;
+    if (state->readahead_queue.empty()) {
+      // This is the first request, let's pump the underlying queue
+      state->Refill();
+    }
+    auto next = std::move(state->readahead_queue.front());
+    state->readahead_queue.pop();
+    if (!next.is_finished()) {
+      // The consumer waits for the producer: read further ahead
+      state->readahead = std::min(state->readahead + 1, state->max_readahead);
+    } else if (!state->readahead_queue.empty() &&
+               state->readahead_queue.back().is_finished()) {
+      // The producer waits for the consumer: read less ahead
+      state->readahead = std::max(state->readahead - 1, 1);
+    }
+    auto result = next.Then([state](const T& value) -> T {
+      if (!IsIterationEnd(value)) {
+        state->buffered_bytes.fetch_sub(state->size_of(value));
+      }
+      return value;
+    });
+    state->Refill();
+    return result;
+  }
+
+  /// \brief The current number of items read ahead
+  int readahead() const { return state_->readahead; }
+
+ private:
+  struct State : public std::enable_shared_from_this<State> {
+    State(AsyncGenerator<T> source_generator, int initial_readahead, int max_readahead,
+          std::function<int64_t(const T&)> size_of, int64_t max_bytes)
+        : source_generator(std::move(source_generator)),
+          max_readahead(std::max(max_readahead, 1)),
+          readahead(std::min(std::max(initial_readahead, 1), this->max_readahead)),
+          size_of(std::move(size_of)),
+          max_bytes(max_bytes) {}
+
+    Future<T> AddMarkFinishedContinuation(Future<T> fut) {
+      auto state = this->shared_from_this();
+      return fut.Then(
+          [state](const T& result) -> Future<T> {
+            if (IsIterationEnd(result)) {
+              state->finished.store(true);
+            } else {
+              state->buffered_bytes.fetch_add(state->size_of(result));
+            }
+            if (state->finished.load()) {
+              if (state->num_running.fetch_sub(1) == 1) {
+                state->final_future.MarkFinished();
+              }
+            } else {
+              state->num_running.fetch_sub(1);
+            }
+            return result;
+          },
+          [state](const Status& err) -> Future<T> {
+            // If there is an error we need to make sure all running
+            // tasks finish before we return the error.
+            state->finished.store(true);
+            if (state->num_running.fetch_sub(1) == 1) {
+              state->final_future.MarkFinished();
+            }
+            return state->final_future.Then([err]() -> Result<T> { return err; });
+          });
+    }
+
+    // Read ahead up to the current readahead, unless the items not consumed yet
+    // exceed the memory budget
+    void Refill() {
+      while (!finished.load() &&
+             static_cast<int>(readahead_queue.size()) < readahead &&
+             (readahead_queue.empty() || buffered_bytes.load() < max_bytes)) {
+        num_running.fetch_add(1);
+        readahead_queue.push(AddMarkFinishedContinuation(source_generator()));
+      }
+      if (readahead_queue.empty()) {
+        readahead_queue.push(AsyncGeneratorEnd<T>());
+      }
+    }
+
+    AsyncGenerator<T> source_generator;
+    const int max_readahead;
+    int readahead;
+    std::function<int64_t(const T&)> size_of;
+    const int64_t max_bytes;
+    Future<> final_future = Future<>::Make();
+    std::atomic<int> num_running{0};
+    std::atomic<bool> finished{false};
+    // Size of the items produced but not consumed yet
+    std::atomic<int64_t> buffered_bytes{0};
+    std::queue<Future<T>> readahead_queue;
+  };
+
+  std::shared_ptr<State> state_;
+};
+
 /// \brief A generator where the producer pushes items on a queue.
 ///
 /// No back-pressure is applied, so this generator is mostly useful when
@@ -955,6 +1101,26 @@ AsyncGenerator<T> MakeReadaheadGenerator(AsyncGenerator<T> source_generator,
   return ReadaheadGenerator<T>(std::move(source_generator), max_readahead);
 }
 
+/// \brief Create a generator that pulls reentrantly from a source, adapting the
+/// number of active requests to the consumer
+///
+/// Like MakeReadaheadGenerator, but the readahead starts at initial_readahead and
+/// varies between 1 and max_readahead: it grows when the consumer has to wait for an
+/// item and shrinks when all the items read ahead are ready before being consumed.
+/// Moreover, no more items are requested while the items produced but not consumed
+/// yet total max_bytes or more, as measured by size_of.
+///
+/// The source generator must be async-reentrant
+///
+/// This generator is not async-reentrant
+template <typename T>
+AsyncGenerator<T> MakeAdaptiveReadaheadGenerator(
+    AsyncGenerator<T> source_generator, int initial_readahead, int max_readahead,
+    std::function<int64_t(const T&)> size_of, int64_t max_bytes) {
+  return AdaptiveReadaheadGenerator<T>(std::move(source_generator), initial_readahead,
+                                       max_readahead, std::move(size_of), max_bytes);
+}
+
 /// \brief Creates a generator that will yield finished futures from a vector
 ///
 /// This generator is async-reentrant
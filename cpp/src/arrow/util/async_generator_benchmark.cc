@@ -0,0 +1,128 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/future.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+// Per-item overhead of futures and async generator stages, on trivial items.  Scans
+// of many small batches pay it for every batch.
+
+using Item = std::optional<int64_t>;
+
+constexpr int64_t kNumItems = 1 << 14;
+
+static std::vector<Item> MakeItems() {
+  std::vector<Item> items;
+  items.reserve(kNumItems);
+  for (int64_t i = 0; i < kNumItems; ++i) {
+    items.emplace_back(i);
+  }
+  return items;
+}
+
+static void Consume(AsyncGenerator<Item> gen) {
+  int64_t sum = 0;
+  auto visited = VisitAsyncGenerator(std::move(gen), [&](const Item& item) {
+    sum += *item;
+    return Status::OK();
+  });
+  ABORT_NOT_OK(visited.status());
+  benchmark::DoNotOptimize(sum);
+}
+
+static void FutureMakeAndFinish(benchmark::State& state) {  // NOLINT non-const reference
+  for (auto _ : state) {
+    for (int64_t i = 0; i < kNumItems; ++i) {
+      auto fut = Future<int64_t>::Make();
+      fut.MarkFinished(i);
+      benchmark::DoNotOptimize(fut.result());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kNumItems);
+}
+
+static void IterateVector(benchmark::State& state) {  // NOLINT non-const reference
+  const auto items = MakeItems();
+  for (auto _ : state) {
+    Consume(MakeVectorGenerator(items));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumItems);
+}
+
+// state.range(0) chained map stages, with synchronous or asynchronous map functions
+template <bool kAsyncMap>
+static void MapItems(benchmark::State& state) {  // NOLINT non-const reference
+  const auto items = MakeItems();
+  for (auto _ : state) {
+    AsyncGenerator<Item> gen = MakeVectorGenerator(items);
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      if constexpr (kAsyncMap) {
+        gen = MakeMappedGenerator(std::move(gen), [](const Item& item) {
+          return Future<Item>::MakeFinished(Item(*item + 1));
+        });
+      } else {
+        gen = MakeMappedGenerator(std::move(gen),
+                                  [](const Item& item) { return Item(*item + 1); });
+      }
+    }
+    Consume(std::move(gen));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumItems);
+}
+
+static void ReadAhead(benchmark::State& state) {  // NOLINT non-const reference
+  const auto items = MakeItems();
+  for (auto _ : state) {
+    Consume(MakeReadaheadGenerator(MakeVectorGenerator(items),
+                                   static_cast<int>(state.range(0))));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumItems);
+}
+
+static void TransferToExecutor(benchmark::State& state) {  // NOLINT non-const ref
+  const auto items = MakeItems();
+  ASSIGN_OR_ABORT(auto pool, internal::ThreadPool::Make(/*threads=*/1));
+  for (auto _ : state) {
+    Consume(MakeTransferredGenerator(MakeVectorGenerator(items), pool.get()));
+  }
+  state.SetItemsProcessed(state.iterations() * kNumItems);
+}
+
+BENCHMARK(FutureMakeAndFinish);
+BENCHMARK(IterateVector);
+BENCHMARK_TEMPLATE(MapItems, /*kAsyncMap=*/false)
+    ->ArgName("stages")
+    ->Arg(1)
+    ->Arg(4);
+BENCHMARK_TEMPLATE(MapItems, /*kAsyncMap=*/true)
+    ->ArgName("stages")
+    ->Arg(1)
+    ->Arg(4);
+BENCHMARK(ReadAhead)->ArgName("readahead")->Arg(1)->Arg(16);
+BENCHMARK(TransferToExecutor)->UseRealTime();
+
+}  // namespace arrow
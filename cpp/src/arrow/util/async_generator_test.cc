@@ -1485,6 +1485,72 @@ TEST(TestAsyncUtil, ReadaheadMove) {
   AssertGeneratorExhausted(gen_copy);
 }
 
+TEST(TestAsyncUtil, AdaptiveReadahead) {
+  std::vector<Future<TestInt>> futures;
+  auto source = [&]() {
+    if (futures.size() < 6) {
+      futures.push_back(Future<TestInt>::Make());
+      return futures.back();
+    }
+    return Future<TestInt>::MakeFinished(IterationTraits<TestInt>::End());
+  };
+  auto size_of = [](const TestInt&) -> int64_t { return 1; };
+  AdaptiveReadaheadGenerator<TestInt> readahead(source, /*initial_readahead=*/1,
+                                                /*max_readahead=*/4, size_of,
+                                                /*max_bytes=*/100);
+
+  // The consumer waits for the first item: read further ahead
+  auto next = readahead();
+  ASSERT_EQ(3, futures.size());
+  ASSERT_EQ(2, readahead.readahead());
+  for (int i = 0; i < 3; ++i) {
+    futures[i].MarkFinished(TestInt(i));
+  }
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(0), next);
+
+  // The items read ahead are ready: read less ahead
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(1), readahead());
+  ASSERT_EQ(1, readahead.readahead());
+  ASSERT_EQ(3, futures.size());
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(2), readahead());
+  ASSERT_EQ(1, readahead.readahead());
+  ASSERT_EQ(4, futures.size());
+
+  next = readahead();
+  ASSERT_EQ(2, readahead.readahead());
+  ASSERT_EQ(6, futures.size());
+  for (int i = 3; i < 6; ++i) {
+    futures[i].MarkFinished(TestInt(i));
+  }
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(3), next);
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(4), readahead());
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(5), readahead());
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto last, readahead());
+  ASSERT_TRUE(IsIterationEnd(last));
+  ASSERT_FINISHES_OK_AND_ASSIGN(last, readahead());
+  ASSERT_TRUE(IsIterationEnd(last));
+}
+
+TEST(TestAsyncUtil, AdaptiveReadaheadMaxBytes) {
+  int num_delivered = 0;
+  auto source = [&]() { return Future<TestInt>::MakeFinished(num_delivered++); };
+  auto size_of = [](const TestInt&) -> int64_t { return 10; };
+  AdaptiveReadaheadGenerator<TestInt> readahead(source, /*initial_readahead=*/4,
+                                                /*max_readahead=*/4, size_of,
+                                                /*max_bytes=*/25);
+
+  // Reading ahead stops once 30 bytes are buffered
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(0), readahead());
+  ASSERT_EQ(3, readahead.readahead());
+  ASSERT_EQ(4, num_delivered);
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(1), readahead());
+  ASSERT_EQ(2, readahead.readahead());
+  ASSERT_EQ(4, num_delivered);
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(2), readahead());
+  ASSERT_EQ(1, readahead.readahead());
+  ASSERT_EQ(4, num_delivered);
+}
+
 TEST(TestAsyncUtil, ReadaheadFailed) {
 #ifndef ARROW_ENABLE_THREADING
   GTEST_SKIP() << "Test requires threading support";
@@ -1265,9 +1265,20 @@ BasicDecimal256& BasicDecimal256::operator*=(const BasicDecimal256& right) {
   BasicDecimal256 x = BasicDecimal256::Abs(*this);
   BasicDecimal256 y = BasicDecimal256::Abs(right);
 
-  std::array<uint64_t, 4> res{0, 0, 0, 0};
-  MultiplyUnsignedArray<4>(x.array_, y.array_, &res);
-  array_ = res;
+  const auto x_le = bit_util::little_endian::Make(x.array_);
+  const auto y_le = bit_util::little_endian::Make(y.array_);
+  if (x_le[1] == 0 && x_le[2] == 0 && x_le[3] == 0 && y_le[1] == 0 && y_le[2] == 0 &&
+      y_le[3] == 0) {
+    // Both operands fit in 64 bits (as do all values of precision <= 18): a single
+    // 64x64 -> 128 bit multiplication is enough
+    uint128_t r(x_le[0]);
+    r *= uint128_t(y_le[0]);
+    array_ = bit_util::little_endian::ToNative<uint64_t, 4>({r.lo(), r.hi(), 0, 0});
+  } else {
+    std::array<uint64_t, 4> res{0, 0, 0, 0};
+    MultiplyUnsignedArray<4>(x.array_, y.array_, &res);
+    array_ = res;
+  }
   if (negate) {
     Negate();
   }
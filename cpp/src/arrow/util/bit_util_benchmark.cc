@@ -162,6 +162,15 @@ static void BenchmarkBitmapAnd(benchmark::State& state) {
   });
 }
 
+// Trigger the path where the output is not byte aligned.
+static void BenchmarkBitmapAndUnalignedOutput(benchmark::State& state) {
+  BenchmarkAndImpl(state, [](const internal::Bitmap(&bitmaps)[2], internal::Bitmap* out) {
+    internal::BitmapAnd(bitmaps[0].data(), bitmaps[0].offset(), bitmaps[1].data(),
+                        bitmaps[1].offset(), bitmaps[0].length() - 1, /*out_offset=*/1,
+                        out->mutable_data());
+  });
+}
+
 static void BenchmarkBitmapVisitBitsetAnd(benchmark::State& state) {
   BenchmarkAndImpl(state, [](const internal::Bitmap(&bitmaps)[2], internal::Bitmap* out) {
     int64_t i = 0;
@@ -471,6 +480,21 @@ static void CopyBitmapWithOffset(benchmark::State& state) {  // NOLINT non-const
 // Trigger the slow path where both source and dest buffer are not byte aligned.
 static void CopyBitmapWithOffsetBoth(benchmark::State& state) { CopyBitmap<3, 7>(state); }
 
+// Trigger the slow path where the source buffer is not byte aligned.
+static void InvertBitmapWithOffset(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t buffer_size = state.range(0);
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(buffer_size);
+  const int64_t length = buffer_size * 8 - 4;
+  auto inverted = *AllocateEmptyBitmap(length);
+
+  for (auto _ : state) {
+    internal::InvertBitmap(buffer->data(), 4, length, inverted->mutable_data(), 0);
+  }
+
+  state.SetBytesProcessed(state.iterations() * buffer_size);
+}
+
 // Benchmark the worst case of comparing two identical bitmap
 template <int64_t Offset = 0>
 static void BitmapEquals(benchmark::State& state) {
@@ -538,6 +562,7 @@ BENCHMARK(GenerateBitsUnrolled)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithoutOffset)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithOffset)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithOffsetBoth)->Arg(kBufferSize);
+BENCHMARK(InvertBitmapWithOffset)->Arg(kBufferSize);
 
 BENCHMARK(BitmapEqualsWithoutOffset)->Arg(kBufferSize);
 BENCHMARK(BitmapEqualsWithOffset)->Arg(kBufferSize);
@@ -547,6 +572,7 @@ BENCHMARK(BitmapEqualsWithOffset)->Arg(kBufferSize);
     {kBufferSize * 4, kBufferSize * 16}, { 0, 2 } \
   }
 BENCHMARK(BenchmarkBitmapAnd)->Ranges(AND_BENCHMARK_RANGES);
+BENCHMARK(BenchmarkBitmapAndUnalignedOutput)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitBitsetAnd)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitUInt8And)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitUInt64And)->Ranges(AND_BENCHMARK_RANGES);
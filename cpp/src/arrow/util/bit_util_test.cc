@@ -1465,6 +1465,35 @@ TEST_F(BitmapOp, RandomXor) {
   }
 }
 
+TEST_F(BitmapOp, RandomLarge) {
+  // Long enough for the SIMD kernels to process several blocks
+  const int kBitCount = 4000;
+  uint8_t buffer[kBitCount * 2] = {0};
+
+  random_bytes(kBitCount * 2, 0, buffer);
+
+  std::vector<int> left(kBitCount);
+  std::vector<int> right(kBitCount);
+  std::vector<int> and_result(kBitCount);
+  std::vector<int> or_result(kBitCount);
+  std::vector<int> and_not_result(kBitCount);
+
+  for (int i = 0; i < kBitCount; ++i) {
+    left[i] = buffer[i] & 1;
+    right[i] = buffer[i + kBitCount] & 1;
+    and_result[i] = left[i] & right[i];
+    or_result[i] = left[i] | right[i];
+    and_not_result[i] = left[i] & ~right[i] & 1;
+  }
+
+  TestAligned(BitmapAndOp(), left, right, and_result);
+  TestUnaligned(BitmapAndOp(), left, right, and_result);
+  TestAligned(BitmapOrOp(), left, right, or_result);
+  TestUnaligned(BitmapOrOp(), left, right, or_result);
+  TestAligned(BitmapAndNotOp(), left, right, and_not_result);
+  TestUnaligned(BitmapAndNotOp(), left, right, and_not_result);
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
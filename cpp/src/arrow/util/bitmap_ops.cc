@@ -17,23 +17,71 @@
 
 #include "arrow/util/bitmap_ops.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/util/align_util.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops_internal.h"
 #include "arrow/util/bitmap_reader.h"
 #include "arrow/util/bitmap_writer.h"
+#include "arrow/util/dispatch.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
 namespace internal {
 
+namespace {
+
+// Below this many bits, splitting an unaligned operation around a SIMD kernel
+// costs more than it saves.
+constexpr int64_t kMinSimdBitmapLength = 512;
+
+const BitmapOpsKernels* GetBitmapOpsKernelsDefault() { return nullptr; }
+
+struct BitmapOpsKernelsDynamicFunction {
+  using FunctionType = decltype(&GetBitmapOpsKernelsDefault);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, GetBitmapOpsKernelsDefault}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, GetBitmapOpsKernelsAvx2}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+            ,
+            {DispatchLevel::AVX512, GetBitmapOpsKernelsAvx512}
+#endif
+    };
+  }
+};
+
+// The SIMD kernels, or null if none is available for the running CPU
+const BitmapOpsKernels* GetBitmapOpsKernels() {
+#if !ARROW_LITTLE_ENDIAN
+  // The kernels shift bytes within little-endian words
+  return nullptr;
+#elif defined(ARROW_HAVE_NEON)
+  return GetBitmapOpsKernelsNeon();
+#else
+  static const BitmapOpsKernels* kernels =
+      DynamicDispatch<BitmapOpsKernelsDynamicFunction>().func();
+  return kernels;
+#endif
+}
+
+}  // namespace
+
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   constexpr int64_t pop_len = sizeof(uint64_t) * 8;
   DCHECK_GE(bit_offset, 0);
@@ -118,6 +166,25 @@ uint8_t GetReversedBlock(uint8_t block_left, uint8_t block_right, uint8_t length
   return ReverseUint8(((block_right << 8) + block_left) >> length);
 }
 
+template <TransferMode mode>
+void UnalignedTransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
+                             int64_t dest_offset, uint8_t* dest) {
+  auto reader = internal::BitmapWordReader<uint64_t>(data, offset, length);
+  auto writer = internal::BitmapWordWriter<uint64_t>(dest, dest_offset, length);
+
+  auto nwords = reader.words();
+  while (nwords--) {
+    auto word = reader.NextWord();
+    writer.PutNextWord(mode == TransferMode::Invert ? ~word : word);
+  }
+  auto nbytes = reader.trailing_bytes();
+  while (nbytes--) {
+    int valid_bits;
+    auto byte = reader.NextTrailingByte(valid_bits);
+    writer.PutNextTrailingByte(mode == TransferMode::Invert ? ~byte : byte, valid_bits);
+  }
+}
+
 template <TransferMode mode>
 void TransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
                     int64_t dest_offset, uint8_t* dest) {
@@ -125,20 +192,26 @@ void TransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
   int64_t dest_bit_offset = dest_offset % 8;
 
   if (bit_offset || dest_bit_offset) {
-    auto reader = internal::BitmapWordReader<uint64_t>(data, offset, length);
-    auto writer = internal::BitmapWordWriter<uint64_t>(dest, dest_offset, length);
-
-    auto nwords = reader.words();
-    while (nwords--) {
-      auto word = reader.NextWord();
-      writer.PutNextWord(mode == TransferMode::Invert ? ~word : word);
-    }
-    auto nbytes = reader.trailing_bytes();
-    while (nbytes--) {
-      int valid_bits;
-      auto byte = reader.NextTrailingByte(valid_bits);
-      writer.PutNextTrailingByte(mode == TransferMode::Invert ? ~byte : byte, valid_bits);
+    const BitmapOpsKernels* kernels = GetBitmapOpsKernels();
+    if (kernels != nullptr && length >= kMinSimdBitmapLength) {
+      // Bring the destination to a byte boundary, then transfer whole bytes
+      const int64_t head = (8 - dest_bit_offset) % 8;
+      if (head > 0) {
+        UnalignedTransferBitmap<mode>(data, offset, head, dest_offset, dest);
+        offset += head;
+        dest_offset += head;
+        length -= head;
+      }
+      const auto kernel =
+          mode == TransferMode::Invert ? kernels->invert : kernels->copy;
+      const int64_t nbytes = kernel(data + offset / 8, static_cast<int>(offset % 8),
+                                    dest + dest_offset / 8, length / 8);
+      offset += nbytes * 8;
+      dest_offset += nbytes * 8;
+      length -= nbytes * 8;
+      if (length == 0) return;
     }
+    UnalignedTransferBitmap<mode>(data, offset, length, dest_offset, dest);
   } else if (length) {
     int64_t num_bytes = bit_util::BytesForBits(length);
 
@@ -328,10 +401,31 @@ bool OptionalBitmapEquals(const std::shared_ptr<Buffer>& left, int64_t left_offs
 
 namespace {
 
+template <template <typename> class BitOp>
+BitmapBinaryBlocksFunc GetBitmapOpKernel() {
+  const BitmapOpsKernels* kernels = GetBitmapOpsKernels();
+  if (kernels == nullptr) {
+    return nullptr;
+  }
+  using Op = BitOp<uint8_t>;
+  if constexpr (std::is_same_v<Op, std::bit_and<uint8_t>>) {
+    return kernels->bitmap_and;
+  } else if constexpr (std::is_same_v<Op, std::bit_or<uint8_t>>) {
+    return kernels->bitmap_or;
+  } else if constexpr (std::is_same_v<Op, std::bit_xor<uint8_t>>) {
+    return kernels->bitmap_xor;
+  } else if constexpr (std::is_same_v<Op, AndNotOp<uint8_t>>) {
+    return kernels->bitmap_and_not;
+  } else {
+    static_assert(std::is_same_v<Op, OrNotOp<uint8_t>>);
+    return kernels->bitmap_or_not;
+  }
+}
+
 template <template <typename> class BitOp>
 void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                      int64_t right_offset, uint8_t* out, int64_t out_offset,
-                     int64_t length) {
+                     int64_t length, BitmapBinaryBlocksFunc kernel) {
   BitOp<uint8_t> op;
   DCHECK_EQ(left_offset % 8, right_offset % 8);
   DCHECK_EQ(left_offset % 8, out_offset % 8);
@@ -340,15 +434,19 @@ void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* ri
   left += left_offset / 8;
   right += right_offset / 8;
   out += out_offset / 8;
-  for (int64_t i = 0; i < nbytes; ++i) {
+  int64_t i = 0;
+  if (kernel != nullptr) {
+    i = kernel(left, /*left_shift=*/0, right, /*right_shift=*/0, out, nbytes);
+  }
+  for (; i < nbytes; ++i) {
     out[i] = op(left[i], right[i]);
   }
 }
 
 template <template <typename> class BitOp>
-void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
-                       int64_t right_offset, uint8_t* out, int64_t out_offset,
-                       int64_t length) {
+void UnalignedBitmapOpScalar(const uint8_t* left, int64_t left_offset,
+                             const uint8_t* right, int64_t right_offset, uint8_t* out,
+                             int64_t out_offset, int64_t length) {
   BitOp<uint64_t> op_word;
   BitOp<uint8_t> op_byte;
 
@@ -370,17 +468,47 @@ void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t*
   }
 }
 
+template <template <typename> class BitOp>
+void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                       int64_t right_offset, uint8_t* out, int64_t out_offset,
+                       int64_t length, BitmapBinaryBlocksFunc kernel) {
+  if (kernel != nullptr && length >= kMinSimdBitmapLength) {
+    // Bring the output to a byte boundary, then combine whole bytes
+    const int64_t head = (8 - out_offset % 8) % 8;
+    if (head > 0) {
+      UnalignedBitmapOpScalar<BitOp>(left, left_offset, right, right_offset, out,
+                                     out_offset, head);
+      left_offset += head;
+      right_offset += head;
+      out_offset += head;
+      length -= head;
+    }
+    const int64_t nbytes =
+        kernel(left + left_offset / 8, static_cast<int>(left_offset % 8),
+               right + right_offset / 8, static_cast<int>(right_offset % 8),
+               out + out_offset / 8, length / 8);
+    left_offset += nbytes * 8;
+    right_offset += nbytes * 8;
+    out_offset += nbytes * 8;
+    length -= nbytes * 8;
+    if (length == 0) return;
+  }
+  UnalignedBitmapOpScalar<BitOp>(left, left_offset, right, right_offset, out, out_offset,
+                                 length);
+}
+
 template <template <typename> class BitOp>
 void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* dest) {
+  const BitmapBinaryBlocksFunc kernel = GetBitmapOpKernel<BitOp>();
   if ((out_offset % 8 == left_offset % 8) && (out_offset % 8 == right_offset % 8)) {
     // Fast case: can use bytewise AND
     AlignedBitmapOp<BitOp>(left, left_offset, right, right_offset, dest, out_offset,
-                           length);
+                           length, kernel);
   } else {
     // Unaligned
     UnalignedBitmapOp<BitOp>(left, left_offset, right, right_offset, dest, out_offset,
-                             length);
+                             length, kernel);
   }
 }
 
@@ -437,11 +565,6 @@ void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
   BitmapOp<std::bit_xor>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
-template <typename T>
-struct AndNotOp {
-  constexpr T operator()(const T& l, const T& r) const { return l & ~r; }
-};
-
 Result<std::shared_ptr<Buffer>> BitmapAndNot(MemoryPool* pool, const uint8_t* left,
                                              int64_t left_offset, const uint8_t* right,
                                              int64_t right_offset, int64_t length,
@@ -456,11 +579,6 @@ void BitmapAndNot(const uint8_t* left, int64_t left_offset, const uint8_t* right
   BitmapOp<AndNotOp>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
-template <typename T>
-struct OrNotOp {
-  constexpr T operator()(const T& l, const T& r) const { return l | ~r; }
-};
-
 Result<std::shared_ptr<Buffer>> BitmapOrNot(MemoryPool* pool, const uint8_t* left,
                                             int64_t left_offset, const uint8_t* right,
                                             int64_t right_offset, int64_t length,
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace arrow {
+namespace internal {
+
+// SIMD kernels for the whole bytes of bitmap operations.
+//
+// The output is byte-aligned while each input starts `shift` bits (0 to 7) into
+// its first byte.  A kernel processes at most `nbytes` output bytes and returns the
+// number it wrote, a multiple of its SIMD width; the rest is left to the caller.
+// Shifted inputs must have one more readable byte than the output bytes processed,
+// which the kernels guarantee by stopping one block early.
+using BitmapBinaryBlocksFunc = int64_t (*)(const uint8_t* left, int left_shift,
+                                           const uint8_t* right, int right_shift,
+                                           uint8_t* out, int64_t nbytes);
+using BitmapUnaryBlocksFunc = int64_t (*)(const uint8_t* in, int shift, uint8_t* out,
+                                          int64_t nbytes);
+
+struct BitmapOpsKernels {
+  BitmapBinaryBlocksFunc bitmap_and;
+  BitmapBinaryBlocksFunc bitmap_or;
+  BitmapBinaryBlocksFunc bitmap_xor;
+  BitmapBinaryBlocksFunc bitmap_and_not;
+  BitmapBinaryBlocksFunc bitmap_or_not;
+  BitmapUnaryBlocksFunc copy;
+  BitmapUnaryBlocksFunc invert;
+};
+
+template <typename T>
+struct AndNotOp {
+  constexpr T operator()(const T& l, const T& r) const { return l & ~r; }
+};
+
+template <typename T>
+struct OrNotOp {
+  constexpr T operator()(const T& l, const T& r) const { return l | ~r; }
+};
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+const BitmapOpsKernels* GetBitmapOpsKernelsAvx2();
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+const BitmapOpsKernels* GetBitmapOpsKernelsAvx512();
+#endif
+#if defined(ARROW_HAVE_NEON)
+const BitmapOpsKernels* GetBitmapOpsKernelsNeon();
+#endif
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+#include <xsimd/xsimd.hpp>
+
+#include "arrow/util/bitmap_ops_internal.h"
+
+namespace arrow {
+namespace internal {
+namespace {
+
+template <int kBatchBytes>
+struct BitmapOpsSimd {
+  using simd_batch = xsimd::make_sized_batch_t<uint64_t, kBatchBytes / 8>;
+
+  static simd_batch Load(const uint8_t* data) {
+    return simd_batch::load_unaligned(reinterpret_cast<const uint64_t*>(data));
+  }
+
+  // Bits [shift, shift + 64) of each 8-byte lane, for a shift between 0 and 7.
+  // The second load brings in the byte following each lane; the bits it shares
+  // with the first load are identical, so OR-ing them needs no masking.
+  static simd_batch LoadShifted(const uint8_t* data, int shift) {
+    return (Load(data) >> shift) | (Load(data + 1) << (8 - shift));
+  }
+
+  static void Store(const simd_batch& batch, uint8_t* out) {
+    batch.store_unaligned(reinterpret_cast<uint64_t*>(out));
+  }
+
+  template <template <typename> class BitOp>
+  static int64_t Binary(const uint8_t* left, int left_shift, const uint8_t* right,
+                        int right_shift, uint8_t* out, int64_t nbytes) {
+    BitOp<simd_batch> op;
+    int64_t i = 0;
+    if (left_shift == 0 && right_shift == 0) {
+      for (; i + kBatchBytes <= nbytes; i += kBatchBytes) {
+        Store(op(Load(left + i), Load(right + i)), out + i);
+      }
+    } else {
+      for (; i + kBatchBytes < nbytes; i += kBatchBytes) {
+        Store(op(LoadShifted(left + i, left_shift), LoadShifted(right + i, right_shift)),
+              out + i);
+      }
+    }
+    return i;
+  }
+
+  template <bool kInvert>
+  static int64_t Unary(const uint8_t* in, int shift, uint8_t* out, int64_t nbytes) {
+    int64_t i = 0;
+    for (; i + kBatchBytes < nbytes; i += kBatchBytes) {
+      const simd_batch batch = LoadShifted(in + i, shift);
+      Store(kInvert ? ~batch : batch, out + i);
+    }
+    return i;
+  }
+
+  static const BitmapOpsKernels* Kernels() {
+    static const BitmapOpsKernels kernels = {
+        Binary<std::bit_and>,
+        Binary<std::bit_or>,
+        Binary<std::bit_xor>,
+        Binary<AndNotOp>,
+        Binary<OrNotOp>,
+        Unary</*kInvert=*/false>,
+        Unary</*kInvert=*/true>,
+    };
+    return &kernels;
+  }
+};
+
+}  // namespace
+}  // namespace internal
+}  // namespace arrow
@@ -17,9 +17,12 @@
 
 #include "arrow/util/compression.h"
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -40,8 +43,74 @@ Status CheckSupportsCompressionLevel(Compression::type type) {
   return Status::OK();
 }
 
+class CodecFactoryRegistry {
+ public:
+  static CodecFactoryRegistry* GetInstance() {
+    static CodecFactoryRegistry registry;
+    return &registry;
+  }
+
+  Status Register(std::string name, CodecFactory factory) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (Find(name) != factories_.end()) {
+      return Status::KeyError("A codec factory is already registered as '", name, "'");
+    }
+    factories_.emplace_back(std::move(name), std::move(factory));
+    return Status::OK();
+  }
+
+  Status Unregister(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = Find(name);
+    if (it == factories_.end()) {
+      return Status::KeyError("No codec factory registered as '", name, "'");
+    }
+    factories_.erase(it);
+    return Status::OK();
+  }
+
+  // Return the codec made by the most recently registered factory that accepts
+  // the request, or nullptr
+  Result<std::unique_ptr<Codec>> MakeCodec(Compression::type codec_type,
+                                           const CodecOptions& codec_options) {
+    std::vector<CodecFactory> factories;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto it = factories_.rbegin(); it != factories_.rend(); ++it) {
+        factories.push_back(it->second);
+      }
+    }
+    for (const auto& factory : factories) {
+      ARROW_ASSIGN_OR_RAISE(auto codec, factory(codec_type, codec_options));
+      if (codec != nullptr) {
+        return codec;
+      }
+    }
+    return nullptr;
+  }
+
+ private:
+  std::vector<std::pair<std::string, CodecFactory>>::iterator Find(
+      const std::string& name) {
+    return std::find_if(factories_.begin(), factories_.end(),
+                        [&](const auto& entry) { return entry.first == name; });
+  }
+
+  std::mutex mutex_;
+  std::vector<std::pair<std::string, CodecFactory>> factories_;
+};
+
 }  // namespace
 
+Status RegisterCodecFactory(std::string name, CodecFactory factory) {
+  return CodecFactoryRegistry::GetInstance()->Register(std::move(name),
+                                                       std::move(factory));
+}
+
+Status UnregisterCodecFactory(const std::string& name) {
+  return CodecFactoryRegistry::GetInstance()->Unregister(name);
+}
+
 int Codec::UseDefaultCompressionLevel() { return kUseDefaultCompressionLevel; }
 
 Status Codec::Init() { return Status::OK(); }
@@ -138,6 +207,14 @@ Result<int> Codec::DefaultCompressionLevel(Compression::type codec_type) {
 
 Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
                                              const CodecOptions& codec_options) {
+  if (codec_type != Compression::UNCOMPRESSED) {
+    ARROW_ASSIGN_OR_RAISE(auto codec, CodecFactoryRegistry::GetInstance()->MakeCodec(
+                                          codec_type, codec_options));
+    if (codec != nullptr) {
+      return codec;
+    }
+  }
+
   if (!IsAvailable(codec_type)) {
     if (codec_type == Compression::LZO) {
       return Status::NotImplemented("LZO codec not implemented");
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -237,5 +238,25 @@ class ARROW_EXPORT Codec {
   virtual Status Init();
 };
 
+/// \brief A factory of codecs from an alternative implementation
+///
+/// Codec::Create() tries the registered factories before the built-in codecs,
+/// which lets e.g. hardware-accelerated implementations be used transparently by
+/// the IPC format, Parquet and the compressed streams.  A factory returns nullptr
+/// to decline (for instance for an unsupported compression type or options, or if
+/// its device is unavailable), in which case the next factory or the built-in
+/// software codec is used.  The codecs returned must be initialized and produce
+/// data compatible with the built-in codecs.
+using CodecFactory = std::function<Result<std::unique_ptr<Codec>>(
+    Compression::type, const CodecOptions&)>;
+
+/// \brief Register a codec factory under a unique name
+///
+/// Factories are tried in reverse order of registration.
+ARROW_EXPORT Status RegisterCodecFactory(std::string name, CodecFactory factory);
+
+/// \brief Unregister a codec factory registered under the given name
+ARROW_EXPORT Status UnregisterCodecFactory(const std::string& name);
+
 }  // namespace util
 }  // namespace arrow
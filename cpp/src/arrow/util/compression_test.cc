@@ -347,6 +347,87 @@ TEST(TestCodecMisc, GetCompressionType) {
   ASSERT_RAISES(Invalid, Codec::GetCompressionType("SNAPPY"));
 }
 
+// A codec that stores the data uncompressed, standing in for e.g. a hardware codec
+class CopyCodec : public Codec {
+ public:
+  explicit CopyCodec(Compression::type type) : type_(type) {}
+
+  int minimum_compression_level() const override { return kUseDefaultCompressionLevel; }
+  int maximum_compression_level() const override { return kUseDefaultCompressionLevel; }
+  int default_compression_level() const override { return kUseDefaultCompressionLevel; }
+
+  Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
+                             int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return Compress(input_len, input, output_buffer_len, output_buffer);
+  }
+
+  Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
+                           int64_t output_buffer_len, uint8_t* output_buffer) override {
+    if (output_buffer_len < input_len) {
+      return Status::Invalid("Output buffer too small");
+    }
+    std::memcpy(output_buffer, input, input_len);
+    return input_len;
+  }
+
+  int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) override {
+    return input_len;
+  }
+
+  Result<std::shared_ptr<Compressor>> MakeCompressor() override {
+    return Status::NotImplemented("Streaming compression");
+  }
+
+  Result<std::shared_ptr<Decompressor>> MakeDecompressor() override {
+    return Status::NotImplemented("Streaming decompression");
+  }
+
+  Compression::type compression_type() const override { return type_; }
+
+ private:
+  Compression::type type_;
+};
+
+TEST(TestCodecMisc, CodecFactory) {
+  // LZO has no built-in codec
+  ASSERT_RAISES(NotImplemented, Codec::Create(Compression::LZO));
+
+  int num_calls = 0;
+  ASSERT_OK(RegisterCodecFactory(
+      "copy", [&](Compression::type type,
+                  const CodecOptions& options) -> Result<std::unique_ptr<Codec>> {
+        ++num_calls;
+        if (type != Compression::LZO) {
+          return nullptr;
+        }
+        return std::make_unique<CopyCodec>(type);
+      }));
+  ASSERT_RAISES(KeyError, RegisterCodecFactory("copy", {}));
+
+  ASSERT_OK_AND_ASSIGN(auto codec, Codec::Create(Compression::LZO));
+  ASSERT_EQ(codec->compression_type(), Compression::LZO);
+  ASSERT_EQ(num_calls, 1);
+  auto data = MakeRandomData(100);
+  std::vector<uint8_t> compressed(data.size()), decompressed(data.size());
+  ASSERT_OK_AND_EQ(100, codec->Compress(data.size(), data.data(), compressed.size(),
+                                        compressed.data()));
+  ASSERT_OK_AND_EQ(100, codec->Decompress(compressed.size(), compressed.data(),
+                                          decompressed.size(), decompressed.data()));
+  ASSERT_EQ(data, decompressed);
+
+  // Declined requests fall back to the built-in codecs
+  for (auto type : {Compression::GZIP, Compression::ZSTD, Compression::LZ4_FRAME}) {
+    if (Codec::IsAvailable(type)) {
+      ASSERT_OK_AND_ASSIGN(codec, Codec::Create(type));
+      ASSERT_EQ(dynamic_cast<CopyCodec*>(codec.get()), nullptr);
+    }
+  }
+
+  ASSERT_OK(UnregisterCodecFactory("copy"));
+  ASSERT_RAISES(KeyError, UnregisterCodecFactory("copy"));
+  ASSERT_RAISES(NotImplemented, Codec::Create(Compression::LZO));
+}
+
 TEST_P(CodecTest, CodecRoundtrip) {
   const auto compression = GetCompression();
   if (compression == Compression::BZ2) {
@@ -89,8 +89,17 @@
 #include "arrow/util/crc32.h"
 
 #include <cstdint>
+#include <utility>
+#include <vector>
 
+#if defined(__ARM_FEATURE_CRC32)
+#  include <arm_acle.h>
+#endif
+
+#include "arrow/util/crc32_internal.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/endian.h"
+#include "arrow/util/ubsan.h"
 
 namespace arrow {
 namespace internal {
@@ -856,9 +865,8 @@ static const uint32_t crc32_lookup[16][256] = {
         0x24B98D25, 0x8AD11CB4, 0xA319A846, 0x0D7139D7,
     }};
 
-/* compute CRC32 */
-uint32_t crc32(uint32_t prev, const void* data, size_t length) {
-  uint32_t crc = ~prev;
+/* update the CRC32 register */
+uint32_t Crc32Slicing(uint32_t crc, const uint8_t* data, size_t length) {
   unsigned unaligned;
   const uint8_t* current_char;
   const uint32_t* current;
@@ -959,7 +967,48 @@ uint32_t crc32(uint32_t prev, const void* data, size_t length) {
   while (length-- != 0)
     crc = (crc >> 8) ^ crc32_lookup[0][(crc & 0xFF) ^ *current_char++];
 
-  return ~crc;
+  return crc;
+}
+
+namespace {
+
+#if defined(__ARM_FEATURE_CRC32)
+// ARMv8 has CRC32 instructions for this very polynomial
+uint32_t Crc32Armv8(uint32_t crc, const uint8_t* data, size_t length) {
+  for (; length >= 8; data += 8, length -= 8) {
+    crc = __crc32d(crc, util::SafeLoadAs<uint64_t>(data));
+  }
+  for (; length > 0; ++data, --length) {
+    crc = __crc32b(crc, *data);
+  }
+  return crc;
+}
+#endif
+
+struct Crc32DynamicFunction {
+  using FunctionType = decltype(&Crc32Slicing);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, Crc32Slicing}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, Crc32Avx2}
+#endif
+    };
+  }
+};
+
+}  // namespace
+
+/* compute CRC32 */
+uint32_t crc32(uint32_t prev, const void* data, size_t length) {
+  const auto* bytes = static_cast<const uint8_t*>(data);
+#if defined(__ARM_FEATURE_CRC32)
+  return ~Crc32Armv8(~prev, bytes, length);
+#else
+  static DynamicDispatch<Crc32DynamicFunction> dispatch;
+  return ~dispatch.func(~prev, bytes, length);
+#endif
 }
 
 }  // namespace internal
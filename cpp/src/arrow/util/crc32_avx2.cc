@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Carry-less multiplication folding of CRC32, after "Fast CRC Computation for
+// Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009).  The constants
+// are powers of x modulo the bit-reflected polynomial 0x04C11DB7.
+
+#include <immintrin.h>
+
+#include "arrow/util/crc32_internal.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Below this many bytes the table-based implementation is faster
+constexpr size_t kMinFoldLength = 64;
+
+uint32_t FoldBlocks(uint32_t crc, const uint8_t* data, size_t length) {
+  // x^(4*128+32) and x^(4*128-32): fold 4 x 128 bits by 512 bits
+  const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+  // x^(128+32) and x^(128-32): fold 128 bits by 128 bits
+  const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+  // x^64: fold 96 bits into 64 bits
+  const __m128i k5 = _mm_set_epi64x(0, 0x0163cd6124);
+  // The polynomial and its Barrett constant
+  const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+  const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+  auto load = [](const uint8_t* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  };
+  auto fold = [](__m128i acc, __m128i k, __m128i next) {
+    const __m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+    const __m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(hi, lo), next);
+  };
+
+  __m128i x1 = _mm_xor_si128(load(data), _mm_cvtsi32_si128(static_cast<int>(crc)));
+  __m128i x2 = load(data + 16);
+  __m128i x3 = load(data + 32);
+  __m128i x4 = load(data + 48);
+  data += 64;
+  length -= 64;
+
+  // Four independent folds per 64 bytes keep the multiplier busy
+  while (length >= 64) {
+    x1 = fold(x1, k1k2, load(data));
+    x2 = fold(x2, k1k2, load(data + 16));
+    x3 = fold(x3, k1k2, load(data + 32));
+    x4 = fold(x4, k1k2, load(data + 48));
+    data += 64;
+    length -= 64;
+  }
+
+  x1 = fold(x1, k3k4, x2);
+  x1 = fold(x1, k3k4, x3);
+  x1 = fold(x1, k3k4, x4);
+  while (length >= 16) {
+    x1 = fold(x1, k3k4, load(data));
+    data += 16;
+    length -= 16;
+  }
+
+  // Reduce 128 bits to 64 bits
+  __m128i x2r = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+  x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2r);
+  x2r = _mm_srli_si128(x1, 4);
+  x1 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5, 0x00);
+  x1 = _mm_xor_si128(x1, x2r);
+
+  // Barrett reduction to 32 bits
+  x2r = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+  x2r = _mm_clmulepi64_si128(_mm_and_si128(x2r, mask32), poly, 0x00);
+  x1 = _mm_xor_si128(x1, x2r);
+  return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+}  // namespace
+
+uint32_t Crc32Avx2(uint32_t crc, const uint8_t* data, size_t length) {
+  if (length >= kMinFoldLength) {
+    const size_t folded = length & ~static_cast<size_t>(15);
+    crc = FoldBlocks(crc, data, folded);
+    data += folded;
+    length -= folded;
+  }
+  return Crc32Slicing(crc, data, length);
+}
+
+}  // namespace internal
+}  // namespace arrow
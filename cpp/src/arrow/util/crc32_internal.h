@@ -0,0 +1,39 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace arrow {
+namespace internal {
+
+// CRC32 (polynomial 0x04C11DB7) implementations.  They update the raw CRC register,
+// i.e. without the initial and final inversions done by crc32().
+
+/// Table-based implementation (slicing-by-16), available on all platforms
+uint32_t Crc32Slicing(uint32_t crc, const uint8_t* data, size_t length);
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+/// Folds 64-byte blocks with carry-less multiplication (PCLMULQDQ), which every
+/// AVX2-capable CPU has, and hands short inputs and tails to Crc32Slicing
+uint32_t Crc32Avx2(uint32_t crc, const uint8_t* data, size_t length);
+#endif
+
+}  // namespace internal
+}  // namespace arrow
@@ -20,6 +20,7 @@
 #include <limits>
 #include <memory>
 #include <random>
+#include <vector>
 
 #include <gtest/gtest.h>
 #include <boost/crc.hpp>
@@ -107,4 +108,29 @@ TEST(Crc32Test, matchesBoost32Type) {
   }
 }
 
+TEST(Crc32Test, AllLengthsAndOffsets) {
+  // Covers the head, folded blocks and tail of the SIMD implementations
+  std::vector<uint8_t> buffer(1024);
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<uint32_t> dist;
+  for (auto& byte : buffer) {
+    byte = static_cast<uint8_t>(dist(gen));
+  }
+
+  for (size_t offset = 0; offset < 16; ++offset) {
+    for (size_t length = 0; length <= 300; ++length) {
+      boost::crc_32_type boost_crc;
+      boost_crc.process_bytes(&buffer[offset], length);
+      ASSERT_EQ(boost_crc.checksum(), internal::crc32(0, &buffer[offset], length))
+          << "offset " << offset << " length " << length;
+
+      // Running CRC32 split at an arbitrary point
+      const size_t split = length / 3;
+      uint32_t crc = internal::crc32(0, &buffer[offset], split);
+      crc = internal::crc32(crc, &buffer[offset + split], length - split);
+      ASSERT_EQ(boost_crc.checksum(), crc);
+    }
+  }
+}
+
 }  // namespace arrow
@@ -884,11 +884,20 @@ Status DecimalFromString(const char* type_name, std::string_view s, Decimal* out
 
   if (out != nullptr) {
     static_assert(Decimal::kBitWidth % 64 == 0, "decimal bit-width not a multiple of 64");
-    std::array<uint64_t, Decimal::kBitWidth / 64> little_endian_array{};
-    ShiftAndAdd(dec.whole_digits, little_endian_array.data(), little_endian_array.size());
-    ShiftAndAdd(dec.fractional_digits, little_endian_array.data(),
-                little_endian_array.size());
-    *out = Decimal(bit_util::little_endian::ToNative(little_endian_array));
+    if (dec.whole_digits.size() + dec.fractional_digits.size() <= kInt64DecimalDigits) {
+      // The digits fit in an int64, no need for multiword arithmetic
+      uint64_t value = 0;
+      ShiftAndAdd(dec.whole_digits, &value, 1);
+      ShiftAndAdd(dec.fractional_digits, &value, 1);
+      *out = Decimal(static_cast<int64_t>(value));
+    } else {
+      std::array<uint64_t, Decimal::kBitWidth / 64> little_endian_array{};
+      ShiftAndAdd(dec.whole_digits, little_endian_array.data(),
+                  little_endian_array.size());
+      ShiftAndAdd(dec.fractional_digits, little_endian_array.data(),
+                  little_endian_array.size());
+      *out = Decimal(bit_util::little_endian::ToNative(little_endian_array));
+    }
     if (dec.sign == '-') {
       out->Negate();
     }
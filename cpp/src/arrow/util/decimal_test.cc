@@ -2107,6 +2107,13 @@ TEST(Decimal256Test, Multiply) {
 
   ASSERT_EQ(Decimal256(60501), Decimal256(-301) * Decimal256(-201));
 
+  // Operands that fit in 64 bits
+  const int64_t max_int64 = std::numeric_limits<int64_t>::max();
+  Decimal256 product = Decimal256(max_int64) * Decimal256(-max_int64);
+  ASSERT_EQ((int256_t(max_int64) * -max_int64).str(), product.ToIntegerString());
+  product = Decimal256(-max_int64) * Decimal256(-max_int64);
+  ASSERT_EQ((int256_t(max_int64) * max_int64).str(), product.ToIntegerString());
+
   // Test some random numbers.
   std::vector<int128_t> left;
   std::vector<int128_t> right;
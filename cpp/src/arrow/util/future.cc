@@ -21,6 +21,8 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <memory>
 #include <mutex>
 #include <numeric>
 
@@ -49,7 +51,6 @@ class ConcreteFutureImpl : public FutureImpl {
 
   void AddCallback(Callback callback, CallbackOptions opts) {
     CheckOptions(opts);
-    std::unique_lock<std::mutex> lock(mutex_);
 #ifdef ARROW_WITH_OPENTELEMETRY
     callback = [func = std::move(callback),
                 active_span = ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()](
@@ -59,6 +60,15 @@ class ConcreteFutureImpl : public FutureImpl {
     };
 #endif
     CallbackRecord callback_record{std::move(callback), opts};
+    // A finished future never changes state nor looks at its callbacks again, so
+    // continuations of finished futures (common with async generators) don't need
+    // to lock
+    if (IsFutureFinished(state_)) {
+      RunOrScheduleCallback(shared_from_this(), std::move(callback_record),
+                            /*in_add_callback=*/true);
+      return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
     if (IsFutureFinished(state_)) {
       lock.unlock();
       RunOrScheduleCallback(shared_from_this(), std::move(callback_record),
@@ -71,6 +81,9 @@ class ConcreteFutureImpl : public FutureImpl {
   bool TryAddCallback(const std::function<Callback()>& callback_factory,
                       CallbackOptions opts) {
     CheckOptions(opts);
+    if (IsFutureFinished(state_)) {
+      return false;
+    }
     std::unique_lock<std::mutex> lock(mutex_);
     if (IsFutureFinished(state_)) {
       return false;
@@ -203,14 +216,101 @@ ConcreteFutureImpl* GetConcreteFuture(FutureImpl* future) {
   return checked_cast<ConcreteFutureImpl*>(future);
 }
 
+// A per-thread cache of freed future blocks (the implementation and its shared_ptr
+// control block, allocated together).  Async generators create and drop a future
+// per item, mostly on the same threads, so most futures reuse a cached block rather
+// than going through the allocator.
+class FutureBlockCache {
+ public:
+#if defined(ADDRESS_SANITIZER) || defined(ARROW_VALGRIND)
+  // Let memory checkers see use-after-free of futures
+  static constexpr int kCapacity = 0;
+#else
+  static constexpr int kCapacity = 64;
+#endif
+
+  explicit FutureBlockCache(bool* destroyed) : destroyed_(destroyed) {}
+
+  ~FutureBlockCache() {
+    for (int i = 0; i < size_; ++i) {
+      ::operator delete(blocks_[i]);
+    }
+    *destroyed_ = true;
+  }
+
+  // Return null if the cache of the current thread is gone (at thread exit)
+  static FutureBlockCache* Get() {
+    // Trivially destructible, hence valid during the destruction of thread locals
+    static thread_local bool destroyed = false;
+    if (ARROW_PREDICT_FALSE(destroyed)) {
+      return nullptr;
+    }
+    static thread_local FutureBlockCache cache(&destroyed);
+    return &cache;
+  }
+
+  void* Pop() { return size_ > 0 ? blocks_[--size_] : nullptr; }
+
+  bool Push(void* block) {
+    if (size_ == kCapacity) {
+      return false;
+    }
+    blocks_[size_++] = block;
+    return true;
+  }
+
+ private:
+  void* blocks_[kCapacity > 0 ? kCapacity : 1];
+  int size_ = 0;
+  bool* destroyed_;
+};
+
+template <typename T>
+struct FutureBlockAllocator {
+  using value_type = T;
+
+  FutureBlockAllocator() = default;
+  template <typename U>
+  FutureBlockAllocator(const FutureBlockAllocator<U>&) {}  // NOLINT runtime/explicit
+
+  T* allocate(std::size_t n) {
+    // allocate_shared only allocates single blocks of the same type
+    DCHECK_EQ(n, 1);
+    if (auto* cache = FutureBlockCache::Get()) {
+      if (void* block = cache->Pop()) {
+        return static_cast<T*>(block);
+      }
+    }
+    return static_cast<T*>(::operator new(sizeof(T)));
+  }
+
+  void deallocate(T* block, std::size_t) {
+    auto* cache = FutureBlockCache::Get();
+    if (cache == nullptr || !cache->Push(block)) {
+      ::operator delete(block);
+    }
+  }
+
+  template <typename U>
+  bool operator==(const FutureBlockAllocator<U>&) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const FutureBlockAllocator<U>&) const {
+    return false;
+  }
+};
+
 }  // namespace
 
-std::unique_ptr<FutureImpl> FutureImpl::Make() {
-  return std::make_unique<ConcreteFutureImpl>();
+std::shared_ptr<FutureImpl> FutureImpl::Make() {
+  return std::allocate_shared<ConcreteFutureImpl>(
+      FutureBlockAllocator<ConcreteFutureImpl>());
 }
 
-std::unique_ptr<FutureImpl> FutureImpl::MakeFinished(FutureState state) {
-  std::unique_ptr<ConcreteFutureImpl> ptr(new ConcreteFutureImpl());
+std::shared_ptr<FutureImpl> FutureImpl::MakeFinished(FutureState state) {
+  auto ptr = std::allocate_shared<ConcreteFutureImpl>(
+      FutureBlockAllocator<ConcreteFutureImpl>());
   ptr->state_ = state;
   return ptr;
 }
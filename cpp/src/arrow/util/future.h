@@ -262,8 +262,8 @@ class ARROW_EXPORT FutureImpl : public std::enable_shared_from_this<FutureImpl>
 
   FutureState state() { return state_.load(); }
 
-  static std::unique_ptr<FutureImpl> Make();
-  static std::unique_ptr<FutureImpl> MakeFinished(FutureState state);
+  static std::shared_ptr<FutureImpl> Make();
+  static std::shared_ptr<FutureImpl> MakeFinished(FutureState state);
 
 #ifdef ARROW_WITH_OPENTELEMETRY
   void SetSpan(util::tracing::Span* span) { span_ = span; }
@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// C++20 coroutine support for arrow::Future.
+//
+// With this header, a Future can be awaited with co_await, and a
+// coroutine can return a Future:
+//
+//   arrow::Future<int64_t> CountRows(FlightClient* client, Ticket ticket) {
+//     arrow::Result<std::shared_ptr<Table>> table = co_await client->DoGetAsync(ticket);
+//     if (!table.ok()) co_return table.status();
+//     co_return (*table)->num_rows();
+//   }
+//
+// Awaiting a Future<T> gives a Result<T>, and awaiting a Future<> gives
+// a Status. A coroutine returning Future<T> finishes it with the
+// Result<T> of co_return; one returning Future<> with a Status.
+//
+// A suspended coroutine is resumed by the callback of the awaited
+// Future, i.e. on the thread that marks it finished, as with
+// Future::AddCallback. The header is empty before C++20.
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#  include <coroutine>
+#  include <type_traits>
+#  include <utility>
+
+#  include "arrow/result.h"
+#  include "arrow/status.h"
+#  include "arrow/util/future.h"
+
+#  define ARROW_HAVE_FUTURE_COROUTINES
+
+namespace arrow {
+namespace detail {
+
+template <typename T>
+struct FutureAwaiter {
+  Future<T> future;
+
+  bool await_ready() const { return future.is_finished(); }
+
+  bool await_suspend(std::coroutine_handle<> handle) const {
+    // If the future finished in the meantime, resume right away
+    return future.TryAddCallback(
+        [handle]() { return [handle](const Result<T>&) { handle.resume(); }; });
+  }
+
+  auto await_resume() const {
+    if constexpr (std::is_same_v<T, internal::Empty>) {
+      return future.status();
+    } else {
+      return future.result();
+    }
+  }
+};
+
+template <typename T>
+struct FuturePromise {
+  Future<T> future = Future<T>::Make();
+
+  Future<T> get_return_object() { return future; }
+  std::suspend_never initial_suspend() noexcept { return {}; }
+  std::suspend_never final_suspend() noexcept { return {}; }
+  void unhandled_exception() {
+    future.MarkFinished(Status::UnknownError("Unhandled exception in coroutine"));
+  }
+};
+
+template <typename T>
+struct ValueFuturePromise : FuturePromise<T> {
+  void return_value(Result<T> result) { this->future.MarkFinished(std::move(result)); }
+};
+
+struct StatusFuturePromise : FuturePromise<internal::Empty> {
+  void return_value(Status status) { this->future.MarkFinished(std::move(status)); }
+};
+
+}  // namespace detail
+
+/// \brief Await a Future, giving its Result (or Status for Future<>).
+template <typename T>
+detail::FutureAwaiter<T> operator co_await(Future<T> future) {
+  return detail::FutureAwaiter<T>{std::move(future)};
+}
+
+}  // namespace arrow
+
+template <typename T, typename... Args>
+struct std::coroutine_traits<arrow::Future<T>, Args...> {
+  using promise_type =
+      std::conditional_t<std::is_same_v<T, arrow::internal::Empty>,
+                         arrow::detail::StatusFuturePromise,
+                         arrow::detail::ValueFuturePromise<T>>;
+};
+
+#endif
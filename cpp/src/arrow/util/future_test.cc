@@ -37,6 +37,7 @@
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
+#include "arrow/util/future_coroutine.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/thread_pool.h"
 
@@ -1531,6 +1532,46 @@ TYPED_TEST(FutureWaitTest, TimedWait) { this->TestTimedWait(); }
 
 TYPED_TEST(FutureWaitTest, StressWait) { this->TestStressWait(); }
 
+#ifdef ARROW_HAVE_FUTURE_COROUTINES
+Future<int> AddCoroutine(Future<int> left, Future<int> right) {
+  Result<int> left_value = co_await left;
+  if (!left_value.ok()) co_return left_value.status();
+  Result<int> right_value = co_await right;
+  if (!right_value.ok()) co_return right_value.status();
+  co_return *left_value + *right_value;
+}
+
+Future<> ForwardCoroutine(Future<> future) { co_return co_await future; }
+
+TEST(FutureCoroutineTest, Await) {
+  auto left = Future<int>::Make();
+  auto right = Future<int>::Make();
+  auto sum = AddCoroutine(left, right);
+  AssertNotFinished(sum);
+  left.MarkFinished(1);
+  AssertNotFinished(sum);
+  right.MarkFinished(2);
+  ASSERT_FINISHES_OK_AND_EQ(3, sum);
+
+  // Already finished futures do not suspend
+  ASSERT_FINISHES_OK_AND_EQ(
+      5, AddCoroutine(Future<int>::MakeFinished(2), Future<int>::MakeFinished(3)));
+}
+
+TEST(FutureCoroutineTest, Errors) {
+  ASSERT_FINISHES_AND_RAISES(
+      Invalid, AddCoroutine(Future<int>::MakeFinished(1),
+                            Future<int>::MakeFinished(Status::Invalid("XYZ"))));
+
+  auto future = Future<>::Make();
+  auto forwarded = ForwardCoroutine(future);
+  AssertNotFinished(forwarded);
+  future.MarkFinished(Status::IOError("XYZ"));
+  ASSERT_FINISHES_AND_RAISES(IOError, forwarded);
+  ASSERT_FINISHES_OK(ForwardCoroutine(Future<>::MakeFinished()));
+}
+#endif
+
 namespace internal {
 TEST(FnOnceTest, MoveOnlyDataType) {
   // ensuring this is valid guarantees we are making no unnecessary copies
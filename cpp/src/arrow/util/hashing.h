@@ -80,6 +80,20 @@ inline hash_t ComputeStringHash(const void* data, int64_t length);
 ARROW_EXPORT hash_t ComputeBitmapHash(const uint8_t* bitmap, hash_t seed,
                                       int64_t bits_offset, int64_t num_bits);
 
+/// \brief Mix the bits of a hash so that each of them depends on all input bits
+///
+/// This is MurmurHash3's 64-bit finalizer.  Use it where only some bits of a hash
+/// are used, e.g. the top bits to pick a partition, since those of the hashes
+/// computed above are poorly distributed for small values.
+inline hash_t MixHash(hash_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
 template <typename Scalar, uint64_t AlgNum>
 struct ScalarHelperBase {
   static bool CompareScalars(Scalar u, Scalar v) { return u == v; }
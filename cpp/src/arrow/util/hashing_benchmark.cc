@@ -20,10 +20,12 @@
 #include <limits>
 #include <random>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/compute/key_hash_internal.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/hashing.h"
 
@@ -111,6 +113,104 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+// ----------------------------------------------------------------------
+// Collision rates on patterned integer keys
+//
+// Hash tables index their slots with some bits of the hash: memo tables use the low
+// bits, Swiss tables and partitioners the high bits.  Keys are sequential integers
+// shifted left by state.range(0) bits, which is what e.g. timestamps truncated to a
+// coarser unit look like.  The counters report the fraction of keys whose slot among
+// 2^kSlotBits collides with an earlier key's; for a good hash it is about 1.5%.
+
+constexpr int kNumPatternedKeys = 1 << 15;
+constexpr int kSlotBits = 20;
+
+static std::vector<uint64_t> MakePatternedKeys(int shift) {
+  std::vector<uint64_t> keys(kNumPatternedKeys);
+  for (int i = 0; i < kNumPatternedKeys; ++i) {
+    keys[i] = static_cast<uint64_t>(i) << shift;
+  }
+  return keys;
+}
+
+static void SetCollisionCounters(benchmark::State& state,  // NOLINT non-const reference
+                                 const std::vector<uint64_t>& hashes, int hash_bits) {
+  std::unordered_set<uint64_t> low_slots, high_slots;
+  for (uint64_t h : hashes) {
+    low_slots.insert(h & ((1ULL << kSlotBits) - 1));
+    high_slots.insert(h >> (hash_bits - kSlotBits));
+  }
+  const auto n = static_cast<double>(hashes.size());
+  state.counters["low_bits_collisions"] = (n - low_slots.size()) / n;
+  state.counters["high_bits_collisions"] = (n - high_slots.size()) / n;
+  state.SetItemsProcessed(state.iterations() * hashes.size());
+}
+
+static void ScalarHelperCollisions(benchmark::State& state) {  // NOLINT non-const ref
+  const auto keys = MakePatternedKeys(static_cast<int>(state.range(0)));
+  std::vector<uint64_t> hashes(keys.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < keys.size(); ++i) {
+      hashes[i] = ScalarHelper<uint64_t, 0>::ComputeHash(keys[i]);
+    }
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  SetCollisionCounters(state, hashes, /*hash_bits=*/64);
+}
+
+static void Hashing32Collisions(benchmark::State& state) {  // NOLINT non-const ref
+  const auto keys = MakePatternedKeys(static_cast<int>(state.range(0)));
+  std::vector<uint32_t> hashes32(keys.size());
+  for (auto _ : state) {
+    compute::Hashing32::HashFixed(/*hardware_flags=*/0, /*combine_hashes=*/false,
+                                  kNumPatternedKeys, sizeof(uint64_t),
+                                  reinterpret_cast<const uint8_t*>(keys.data()),
+                                  hashes32.data(), /*temp_hashes_for_combine=*/nullptr);
+    benchmark::DoNotOptimize(hashes32.data());
+  }
+  SetCollisionCounters(state, std::vector<uint64_t>(hashes32.begin(), hashes32.end()),
+                       /*hash_bits=*/32);
+}
+
+static void Hashing64Collisions(benchmark::State& state) {  // NOLINT non-const ref
+  const auto keys = MakePatternedKeys(static_cast<int>(state.range(0)));
+  std::vector<uint64_t> hashes(keys.size());
+  for (auto _ : state) {
+    compute::Hashing64::HashFixed(/*combine_hashes=*/false, kNumPatternedKeys,
+                                  sizeof(uint64_t),
+                                  reinterpret_cast<const uint8_t*>(keys.data()),
+                                  hashes.data());
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  SetCollisionCounters(state, hashes, /*hash_bits=*/64);
+}
+
+static void StringHashCollisions(benchmark::State& state) {  // NOLINT non-const ref
+  // Decimal renderings of the patterned keys, as found in CSV or JSON inputs
+  const auto keys = MakePatternedKeys(static_cast<int>(state.range(0)));
+  std::vector<std::string> strings;
+  strings.reserve(keys.size());
+  for (uint64_t key : keys) {
+    strings.push_back(std::to_string(key));
+  }
+  std::vector<uint64_t> hashes(keys.size());
+  for (auto _ : state) {
+    for (size_t i = 0; i < strings.size(); ++i) {
+      hashes[i] = ComputeStringHash<0>(strings[i].data(),
+                                       static_cast<int64_t>(strings[i].size()));
+    }
+    benchmark::DoNotOptimize(hashes.data());
+  }
+  SetCollisionCounters(state, hashes, /*hash_bits=*/64);
+}
+
+static void KeyShifts(benchmark::internal::Benchmark* bench) {
+  bench->ArgName("shift");
+  for (int shift : {0, 8, 20, 32, 44}) {
+    bench->Arg(shift);
+  }
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -118,6 +218,10 @@ BENCHMARK(HashIntegers);
 BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
+BENCHMARK(ScalarHelperCollisions)->Apply(KeyShifts);
+BENCHMARK(Hashing32Collisions)->Apply(KeyShifts);
+BENCHMARK(Hashing64Collisions)->Apply(KeyShifts);
+BENCHMARK(StringHashCollisions)->Apply(KeyShifts);
 
 }  // namespace internal
 }  // namespace arrow
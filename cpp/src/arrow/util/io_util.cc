@@ -113,6 +113,7 @@
 #  include <sys/sysctl.h>
 
 #elif __linux__
+#  include <sys/resource.h>
 #  include <sys/sysinfo.h>
 #  include <fstream>
 #endif
@@ -2195,6 +2196,18 @@ int64_t GetCurrentRSS() {
 #endif
 }
 
+PageFaultCounts GetThreadPageFaults() {
+  PageFaultCounts counts;
+#if defined(__linux__) && defined(RUSAGE_THREAD)
+  struct rusage usage;
+  if (getrusage(RUSAGE_THREAD, &usage) == 0) {
+    counts.minor = static_cast<int64_t>(usage.ru_minflt);
+    counts.major = static_cast<int64_t>(usage.ru_majflt);
+  }
+#endif
+  return counts;
+}
+
 int64_t GetTotalMemoryBytes() {
 #if defined(_WIN32)
   ULONGLONG result_kb;
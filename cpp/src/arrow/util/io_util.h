@@ -413,6 +413,20 @@ uint64_t GetThreadId();
 ARROW_EXPORT
 int64_t GetCurrentRSS();
 
+/// \brief Page faults taken by a thread
+struct PageFaultCounts {
+  /// Faults resolved without IO, e.g. from the page cache
+  int64_t minor = 0;
+  /// Faults that required IO
+  int64_t major = 0;
+};
+
+/// \brief Get the number of page faults taken by the current thread so far
+///
+/// This function supports Linux and will return zeros otherwise
+ARROW_EXPORT
+PageFaultCounts GetThreadPageFaults();
+
 /// \brief Get the total memory available to the system in bytes
 ///
 /// This function supports Windows, Linux, and Mac and will return 0 otherwise
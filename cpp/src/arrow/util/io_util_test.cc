@@ -1085,6 +1085,19 @@ TEST(Memory, GetRSS) {
 #endif
 }
 
+TEST(Memory, GetThreadPageFaults) {
+  const auto before = GetThreadPageFaults();
+  // Large enough to be freshly mapped by the allocator, so that writing it faults
+  std::vector<uint8_t> data(64 << 20, 1);
+  const auto after = GetThreadPageFaults();
+#if defined(__linux__)
+  ASSERT_GT(after.minor, before.minor);
+#else
+  ASSERT_EQ(after.minor, 0);
+#endif
+  ASSERT_GE(after.major, before.major);
+}
+
 // Some loose tests to check if the cpuinfo makes sense
 TEST(CpuInfo, Basic) {
   const CpuInfo* ci = CpuInfo::GetInstance();
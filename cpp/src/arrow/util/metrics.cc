@@ -0,0 +1,387 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/metrics.h"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#include "arrow/memory_pool.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace util {
+namespace metrics {
+
+// ----------------------------------------------------------------------
+// Histogram
+
+Histogram::Histogram(std::vector<double> bounds)
+    : bounds_(std::move(bounds)),
+      counts_(new std::atomic<int64_t>[bounds_.size() + 1]) {
+  DCHECK(std::is_sorted(bounds_.begin(), bounds_.end()));
+  for (size_t i = 0; i <= bounds_.size(); ++i) {
+    counts_[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+void Histogram::Observe(double value) {
+  // Buckets are inclusive of their upper bound
+  const auto bucket = std::lower_bound(bounds_.begin(), bounds_.end(), value);
+  counts_[bucket - bounds_.begin()].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  double sum = sum_.load(std::memory_order_relaxed);
+  while (!sum_.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {
+  }
+}
+
+std::vector<int64_t> Histogram::bucket_counts() const {
+  std::vector<int64_t> counts(bounds_.size() + 1);
+  for (size_t i = 0; i < counts.size(); ++i) {
+    counts[i] = counts_[i].load(std::memory_order_relaxed);
+  }
+  return counts;
+}
+
+double Histogram::sum() const { return sum_.load(std::memory_order_relaxed); }
+
+int64_t Histogram::count() const { return count_.load(std::memory_order_relaxed); }
+
+std::vector<double> Histogram::ExponentialBounds(double start, double factor,
+                                                 int count) {
+  std::vector<double> bounds(count);
+  double bound = start;
+  for (auto& b : bounds) {
+    b = bound;
+    bound *= factor;
+  }
+  return bounds;
+}
+
+const std::vector<double>& Histogram::LatencyBounds() {
+  static const std::vector<double> bounds = ExponentialBounds(1e-6, 4, 13);
+  return bounds;
+}
+
+// ----------------------------------------------------------------------
+// MetricsRegistry
+
+namespace {
+
+bool IsValidName(const std::string& name, bool allow_colon) {
+  if (name.empty() || (name[0] >= '0' && name[0] <= '9')) {
+    return false;
+  }
+  return std::all_of(name.begin(), name.end(), [&](char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+           c == '_' || (allow_colon && c == ':');
+  });
+}
+
+const char* TypeName(MetricType type) {
+  switch (type) {
+    case MetricType::COUNTER:
+      return "counter";
+    case MetricType::GAUGE:
+      return "gauge";
+    case MetricType::HISTOGRAM:
+      return "histogram";
+  }
+  return "untyped";
+}
+
+void WriteEscaped(const std::string& str, bool escape_quotes, std::ostream* out) {
+  for (char c : str) {
+    if (c == '\\') {
+      *out << "\\\\";
+    } else if (c == '\n') {
+      *out << "\\n";
+    } else if (c == '"' && escape_quotes) {
+      *out << "\\\"";
+    } else {
+      *out << c;
+    }
+  }
+}
+
+// Write `name{labels}`, with an optional extra label (the bucket bound of histograms)
+void WriteSeries(const std::string& name, const MetricLabels& labels,
+                 const char* extra_label, const std::string& extra_value,
+                 std::ostream* out) {
+  *out << name;
+  if (labels.empty() && extra_label == nullptr) {
+    return;
+  }
+  *out << '{';
+  bool first = true;
+  auto write_label = [&](const std::string& key, const std::string& value) {
+    if (!first) *out << ',';
+    first = false;
+    *out << key << "=\"";
+    WriteEscaped(value, /*escape_quotes=*/true, out);
+    *out << '"';
+  };
+  for (const auto& label : labels) {
+    write_label(label.first, label.second);
+  }
+  if (extra_label != nullptr) {
+    write_label(extra_label, extra_value);
+  }
+  *out << '}';
+}
+
+std::string FormatDouble(double value) {
+  std::stringstream ss;
+  ss.precision(17);
+  ss << value;
+  return ss.str();
+}
+
+}  // namespace
+
+struct MetricsRegistry::Impl {
+  struct Entry {
+    MetricLabels labels;
+    std::shared_ptr<Counter> counter;
+    std::shared_ptr<Gauge> gauge;
+    std::shared_ptr<Histogram> histogram;
+    Callback callback;
+  };
+
+  struct Family {
+    MetricType type;
+    std::string help;
+    std::vector<Entry> entries;
+  };
+
+  Result<Entry*> FindOrAddEntry(MetricType type, const std::string& name,
+                                const std::string& help, MetricLabels labels) {
+    if (!IsValidName(name, /*allow_colon=*/true)) {
+      return Status::Invalid("Invalid metric name: '", name, "'");
+    }
+    for (const auto& label : labels) {
+      if (!IsValidName(label.first, /*allow_colon=*/false) ||
+          label.first.compare(0, 2, "__") == 0 || label.first == "le") {
+        return Status::Invalid("Invalid label name for metric ", name, ": '",
+                               label.first, "'");
+      }
+    }
+    std::sort(labels.begin(), labels.end());
+
+    auto it = families.find(name);
+    if (it == families.end()) {
+      it = families.emplace(name, Family{type, help, {}}).first;
+    } else if (it->second.type != type) {
+      return Status::TypeError("Metric ", name, " was registered as a ",
+                               TypeName(it->second.type), ", not a ", TypeName(type));
+    }
+    auto& entries = it->second.entries;
+    for (auto& entry : entries) {
+      if (entry.labels == labels) {
+        return &entry;
+      }
+    }
+    entries.push_back(Entry{std::move(labels), nullptr, nullptr, nullptr, nullptr});
+    return &entries.back();
+  }
+
+  std::mutex mutex;
+  std::map<std::string, Family> families;
+};
+
+MetricsRegistry::MetricsRegistry() : impl_(new Impl()) {}
+
+MetricsRegistry::~MetricsRegistry() = default;
+
+namespace {
+
+void RegisterMemoryPoolMetrics(MetricsRegistry* registry) {
+  MemoryPool* pool = default_memory_pool();
+  MetricLabels labels = {{"backend", pool->backend_name()}};
+  auto add = [&](MetricType type, const std::string& name, const std::string& help,
+                 int64_t (MemoryPool::*getter)() const) {
+    DCHECK_OK(registry->RegisterCallback(
+        type, name, help, labels,
+        [pool, getter]() -> std::optional<int64_t> { return (pool->*getter)(); }));
+  };
+  add(MetricType::GAUGE, "arrow_memory_pool_bytes_allocated",
+      "Bytes currently allocated by the default memory pool",
+      &MemoryPool::bytes_allocated);
+  add(MetricType::GAUGE, "arrow_memory_pool_max_bytes_allocated",
+      "Peak bytes allocated by the default memory pool", &MemoryPool::max_memory);
+  add(MetricType::COUNTER, "arrow_memory_pool_allocated_bytes_total",
+      "Bytes ever allocated by the default memory pool",
+      &MemoryPool::total_bytes_allocated);
+  add(MetricType::COUNTER, "arrow_memory_pool_allocations_total",
+      "Allocations made by the default memory pool", &MemoryPool::num_allocations);
+}
+
+}  // namespace
+
+MetricsRegistry* MetricsRegistry::Default() {
+  // Leaked so that metrics can still be updated during static destruction
+  static MetricsRegistry* registry = [] {
+    auto* registry = new MetricsRegistry();
+    RegisterMemoryPoolMetrics(registry);
+    return registry;
+  }();
+  return registry;
+}
+
+Result<std::shared_ptr<Counter>> MetricsRegistry::GetCounter(const std::string& name,
+                                                             const std::string& help,
+                                                             MetricLabels labels) {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  ARROW_ASSIGN_OR_RAISE(auto entry, impl_->FindOrAddEntry(MetricType::COUNTER, name,
+                                                          help, std::move(labels)));
+  if (entry->callback) {
+    return Status::Invalid("Metric ", name, " is computed by a callback");
+  }
+  if (!entry->counter) {
+    entry->counter = std::make_shared<Counter>();
+  }
+  return entry->counter;
+}
+
+Result<std::shared_ptr<Gauge>> MetricsRegistry::GetGauge(const std::string& name,
+                                                         const std::string& help,
+                                                         MetricLabels labels) {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  ARROW_ASSIGN_OR_RAISE(auto entry, impl_->FindOrAddEntry(MetricType::GAUGE, name,
+                                                          help, std::move(labels)));
+  if (entry->callback) {
+    return Status::Invalid("Metric ", name, " is computed by a callback");
+  }
+  if (!entry->gauge) {
+    entry->gauge = std::make_shared<Gauge>();
+  }
+  return entry->gauge;
+}
+
+Result<std::shared_ptr<Histogram>> MetricsRegistry::GetHistogram(
+    const std::string& name, const std::string& help, std::vector<double> bounds,
+    MetricLabels labels) {
+  if (!std::is_sorted(bounds.begin(), bounds.end())) {
+    return Status::Invalid("Bounds of histogram ", name, " must be ascending");
+  }
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  ARROW_ASSIGN_OR_RAISE(auto entry, impl_->FindOrAddEntry(MetricType::HISTOGRAM, name,
+                                                          help, std::move(labels)));
+  if (!entry->histogram) {
+    entry->histogram = std::make_shared<Histogram>(std::move(bounds));
+  }
+  return entry->histogram;
+}
+
+Status MetricsRegistry::RegisterCallback(MetricType type, const std::string& name,
+                                         const std::string& help, MetricLabels labels,
+                                         Callback callback) {
+  if (type == MetricType::HISTOGRAM) {
+    return Status::NotImplemented("Histograms cannot be computed by a callback");
+  }
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  ARROW_ASSIGN_OR_RAISE(auto entry,
+                        impl_->FindOrAddEntry(type, name, help, std::move(labels)));
+  if (entry->counter || entry->gauge) {
+    return Status::Invalid("Metric ", name, " is not computed by a callback");
+  }
+  entry->callback = std::move(callback);
+  return Status::OK();
+}
+
+std::vector<MetricSample> MetricsRegistry::Collect() {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  std::vector<MetricSample> samples;
+  for (auto& [name, family] : impl_->families) {
+    auto& entries = family.entries;
+    for (auto it = entries.begin(); it != entries.end();) {
+      MetricSample sample;
+      sample.name = name;
+      sample.help = family.help;
+      sample.type = family.type;
+      sample.labels = it->labels;
+      if (it->callback) {
+        const std::optional<int64_t> value = it->callback();
+        if (!value.has_value()) {
+          it = entries.erase(it);
+          continue;
+        }
+        sample.value = *value;
+      } else if (it->counter) {
+        sample.value = it->counter->value();
+      } else if (it->gauge) {
+        sample.value = it->gauge->value();
+      } else if (it->histogram) {
+        sample.bucket_bounds = it->histogram->bounds();
+        sample.bucket_counts = it->histogram->bucket_counts();
+        sample.sum = it->histogram->sum();
+        sample.count = it->histogram->count();
+      }
+      samples.push_back(std::move(sample));
+      ++it;
+    }
+  }
+  return samples;
+}
+
+Status MetricsRegistry::WritePrometheus(std::ostream* out) {
+  const std::vector<MetricSample> samples = Collect();
+  const std::string* last_name = nullptr;
+  for (const auto& sample : samples) {
+    if (last_name == nullptr || *last_name != sample.name) {
+      *out << "# HELP " << sample.name << ' ';
+      WriteEscaped(sample.help, /*escape_quotes=*/false, out);
+      *out << "\n# TYPE " << sample.name << ' ' << TypeName(sample.type) << '\n';
+      last_name = &sample.name;
+    }
+    if (sample.type != MetricType::HISTOGRAM) {
+      WriteSeries(sample.name, sample.labels, nullptr, "", out);
+      *out << ' ' << sample.value << '\n';
+      continue;
+    }
+    // Prometheus buckets are cumulative
+    int64_t cumulative_count = 0;
+    for (size_t i = 0; i < sample.bucket_counts.size(); ++i) {
+      cumulative_count += sample.bucket_counts[i];
+      const std::string bound = i < sample.bucket_bounds.size()
+                                    ? FormatDouble(sample.bucket_bounds[i])
+                                    : "+Inf";
+      WriteSeries(sample.name + "_bucket", sample.labels, "le", bound, out);
+      *out << ' ' << cumulative_count << '\n';
+    }
+    WriteSeries(sample.name + "_sum", sample.labels, nullptr, "", out);
+    *out << ' ' << FormatDouble(sample.sum) << '\n';
+    WriteSeries(sample.name + "_count", sample.labels, nullptr, "", out);
+    *out << ' ' << sample.count << '\n';
+  }
+  if (!*out) {
+    return Status::IOError("Failed to write metrics");
+  }
+  return Status::OK();
+}
+
+Result<std::string> MetricsRegistry::ToPrometheus() {
+  std::stringstream ss;
+  RETURN_NOT_OK(WritePrometheus(&ss));
+  return ss.str();
+}
+
+}  // namespace metrics
+}  // namespace util
+}  // namespace arrow
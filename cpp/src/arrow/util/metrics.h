@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+/// \file metrics.h
+/// \brief Named runtime metrics of Arrow components
+///
+/// Arrow components register counters, gauges and histograms in the default
+/// MetricsRegistry, identified by a name and a set of labels as in Prometheus.
+/// Updating a metric only touches atomics; the registry is only locked to
+/// register metrics and to collect them.
+
+namespace arrow {
+namespace util {
+namespace metrics {
+
+enum class MetricType : int8_t { COUNTER, GAUGE, HISTOGRAM };
+
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+/// \brief A monotonically increasing count
+class ARROW_EXPORT Counter {
+ public:
+  void Increment(int64_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+  int64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<int64_t> value_{0};
+};
+
+/// \brief A value that can go up and down
+class ARROW_EXPORT Gauge {
+ public:
+  void Set(int64_t value) { value_.store(value, std::memory_order_relaxed); }
+  void Add(int64_t n) { value_.fetch_add(n, std::memory_order_relaxed); }
+  int64_t value() const { return value_.load(std::memory_order_relaxed); }
+
+ private:
+  std::atomic<int64_t> value_{0};
+};
+
+/// \brief A distribution of observed values over fixed buckets
+class ARROW_EXPORT Histogram {
+ public:
+  /// \brief Make a histogram with the given ascending bucket upper bounds
+  ///
+  /// Values above the last bound fall in an implicit overflow bucket.
+  explicit Histogram(std::vector<double> bounds);
+
+  void Observe(double value);
+
+  const std::vector<double>& bounds() const { return bounds_; }
+  /// \brief The number of values observed in each bucket, overflow bucket last
+  std::vector<int64_t> bucket_counts() const;
+  double sum() const;
+  int64_t count() const;
+
+  /// \brief `count` bounds starting at `start`, each `factor` times the previous one
+  static std::vector<double> ExponentialBounds(double start, double factor, int count);
+
+  /// \brief Bounds suitable for latencies in seconds, from 1 microsecond to ~30 seconds
+  static const std::vector<double>& LatencyBounds();
+
+ private:
+  const std::vector<double> bounds_;
+  std::unique_ptr<std::atomic<int64_t>[]> counts_;
+  std::atomic<int64_t> count_{0};
+  std::atomic<double> sum_{0};
+};
+
+/// \brief The state of a metric at collection time
+struct ARROW_EXPORT MetricSample {
+  std::string name;
+  std::string help;
+  MetricType type;
+  MetricLabels labels;
+
+  /// The value of a counter or a gauge
+  int64_t value = 0;
+
+  /// The buckets of a histogram, as in Histogram
+  std::vector<double> bucket_bounds;
+  std::vector<int64_t> bucket_counts;
+  double sum = 0;
+  int64_t count = 0;
+};
+
+/// \brief A set of named metrics
+///
+/// A metric is identified by its name and its labels: getting a metric that
+/// was already registered returns the existing instance.  All metrics of a
+/// given name must have the same type.
+class ARROW_EXPORT MetricsRegistry {
+ public:
+  /// \brief A value computed on collection; returning nullopt unregisters it
+  using Callback = std::function<std::optional<int64_t>()>;
+
+  MetricsRegistry();
+  ~MetricsRegistry();
+
+  /// \brief The registry Arrow components register their metrics in
+  ///
+  /// It comes with gauges of the default memory pool.
+  static MetricsRegistry* Default();
+
+  Result<std::shared_ptr<Counter>> GetCounter(const std::string& name,
+                                              const std::string& help,
+                                              MetricLabels labels = {});
+  Result<std::shared_ptr<Gauge>> GetGauge(const std::string& name,
+                                          const std::string& help,
+                                          MetricLabels labels = {});
+  Result<std::shared_ptr<Histogram>> GetHistogram(const std::string& name,
+                                                  const std::string& help,
+                                                  std::vector<double> bounds,
+                                                  MetricLabels labels = {});
+
+  /// \brief Register a counter or gauge whose value is pulled on collection
+  ///
+  /// A callback registered under existing labels replaces the previous one.
+  Status RegisterCallback(MetricType type, const std::string& name,
+                          const std::string& help, MetricLabels labels,
+                          Callback callback);
+
+  /// \brief Return the current state of all metrics, ordered by name
+  std::vector<MetricSample> Collect();
+
+  /// \brief Write all metrics in the Prometheus text exposition format
+  Status WritePrometheus(std::ostream* out);
+  Result<std::string> ToPrometheus();
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace metrics
+}  // namespace util
+}  // namespace arrow
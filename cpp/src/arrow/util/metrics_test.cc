@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/metrics.h"
+
+namespace arrow {
+namespace util {
+namespace metrics {
+
+using ::testing::HasSubstr;
+
+TEST(Metrics, Histogram) {
+  Histogram histogram({1, 10, 100});
+  for (double value : {0.5, 1.0, 5.0, 50.0, 500.0, 1000.0}) {
+    histogram.Observe(value);
+  }
+  ASSERT_EQ(histogram.bucket_counts(), std::vector<int64_t>({2, 1, 1, 2}));
+  ASSERT_EQ(histogram.count(), 6);
+  ASSERT_DOUBLE_EQ(histogram.sum(), 1556.5);
+
+  ASSERT_EQ(Histogram::ExponentialBounds(1, 2, 4), std::vector<double>({1, 2, 4, 8}));
+}
+
+TEST(Metrics, GetReturnsSameInstance) {
+  MetricsRegistry registry;
+  ASSERT_OK_AND_ASSIGN(auto a, registry.GetCounter("reads", "", {{"fs", "local"}}));
+  ASSERT_OK_AND_ASSIGN(auto b, registry.GetCounter("reads", "", {{"fs", "local"}}));
+  ASSERT_OK_AND_ASSIGN(auto c, registry.GetCounter("reads", "", {{"fs", "s3"}}));
+  ASSERT_EQ(a, b);
+  ASSERT_NE(a, c);
+
+  // Label order doesn't matter
+  ASSERT_OK_AND_ASSIGN(auto d, registry.GetGauge("depth", "", {{"a", "1"}, {"b", "2"}}));
+  ASSERT_OK_AND_ASSIGN(auto e, registry.GetGauge("depth", "", {{"b", "2"}, {"a", "1"}}));
+  ASSERT_EQ(d, e);
+}
+
+TEST(Metrics, Errors) {
+  MetricsRegistry registry;
+  ASSERT_RAISES(Invalid, registry.GetCounter("", ""));
+  ASSERT_RAISES(Invalid, registry.GetCounter("1reads", ""));
+  ASSERT_RAISES(Invalid, registry.GetCounter("reads-total", ""));
+  ASSERT_RAISES(Invalid, registry.GetCounter("reads", "", {{"le", "1"}}));
+  ASSERT_RAISES(Invalid, registry.GetHistogram("latency", "", {2, 1}));
+
+  ASSERT_OK(registry.GetCounter("reads", ""));
+  ASSERT_RAISES(TypeError, registry.GetGauge("reads", ""));
+  ASSERT_RAISES(Invalid, registry.RegisterCallback(MetricType::COUNTER, "reads", "", {},
+                                                   [] { return 1; }));
+}
+
+TEST(Metrics, Collect) {
+  MetricsRegistry registry;
+  ASSERT_OK_AND_ASSIGN(auto counter, registry.GetCounter("b_counter", "A counter"));
+  ASSERT_OK_AND_ASSIGN(auto gauge, registry.GetGauge("a_gauge", "A gauge"));
+  counter->Increment(3);
+  gauge->Set(5);
+  gauge->Add(-2);
+
+  auto samples = registry.Collect();
+  ASSERT_EQ(samples.size(), 2);
+  ASSERT_EQ(samples[0].name, "a_gauge");
+  ASSERT_EQ(samples[0].type, MetricType::GAUGE);
+  ASSERT_EQ(samples[0].value, 3);
+  ASSERT_EQ(samples[1].name, "b_counter");
+  ASSERT_EQ(samples[1].help, "A counter");
+  ASSERT_EQ(samples[1].value, 3);
+}
+
+TEST(Metrics, Callback) {
+  MetricsRegistry registry;
+  std::optional<int64_t> value = 7;
+  ASSERT_OK(registry.RegisterCallback(MetricType::GAUGE, "pulled", "", {},
+                                      [&] { return value; }));
+  auto samples = registry.Collect();
+  ASSERT_EQ(samples.size(), 1);
+  ASSERT_EQ(samples[0].value, 7);
+
+  value = 8;
+  ASSERT_EQ(registry.Collect()[0].value, 8);
+
+  // Returning nullopt unregisters the callback
+  value = std::nullopt;
+  ASSERT_EQ(registry.Collect().size(), 0);
+  value = 9;
+  ASSERT_EQ(registry.Collect().size(), 0);
+}
+
+TEST(Metrics, Prometheus) {
+  MetricsRegistry registry;
+  ASSERT_OK_AND_ASSIGN(auto counter,
+                       registry.GetCounter("arrow_reads_total", "Number of \\ reads",
+                                           {{"fs", "lo\"cal"}}));
+  counter->Increment(2);
+  ASSERT_OK_AND_ASSIGN(
+      auto histogram, registry.GetHistogram("arrow_latency_seconds", "Latency", {0.5, 1}));
+  histogram->Observe(0.25);
+  histogram->Observe(0.75);
+  histogram->Observe(2);
+
+  ASSERT_OK_AND_ASSIGN(auto text, registry.ToPrometheus());
+  ASSERT_EQ(text,
+            "# HELP arrow_latency_seconds Latency\n"
+            "# TYPE arrow_latency_seconds histogram\n"
+            "arrow_latency_seconds_bucket{le=\"0.5\"} 1\n"
+            "arrow_latency_seconds_bucket{le=\"1\"} 2\n"
+            "arrow_latency_seconds_bucket{le=\"+Inf\"} 3\n"
+            "arrow_latency_seconds_sum 3\n"
+            "arrow_latency_seconds_count 3\n"
+            "# HELP arrow_reads_total Number of \\\\ reads\n"
+            "# TYPE arrow_reads_total counter\n"
+            "arrow_reads_total{fs=\"lo\\\"cal\"} 2\n");
+}
+
+TEST(Metrics, ConcurrentUpdates) {
+  MetricsRegistry registry;
+  ASSERT_OK_AND_ASSIGN(auto counter, registry.GetCounter("concurrent", ""));
+  ASSERT_OK_AND_ASSIGN(auto histogram, registry.GetHistogram("latency", "", {1}));
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < 1000; ++j) {
+        counter->Increment();
+        histogram->Observe(1);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(counter->value(), 4000);
+  ASSERT_EQ(histogram->count(), 4000);
+  ASSERT_DOUBLE_EQ(histogram->sum(), 4000);
+}
+
+TEST(Metrics, DefaultRegistry) {
+  ASSERT_OK_AND_ASSIGN(auto text, MetricsRegistry::Default()->ToPrometheus());
+  ASSERT_THAT(text, HasSubstr("# TYPE arrow_memory_pool_bytes_allocated gauge\n"));
+}
+
+}  // namespace metrics
+}  // namespace util
+}  // namespace arrow
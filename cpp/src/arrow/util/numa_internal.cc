@@ -0,0 +1,164 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/numa_internal.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#  include <sched.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+#include "arrow/util/io_util.h"
+#include "arrow/util/string.h"
+#include "arrow/util/value_parsing.h"
+
+namespace arrow::internal {
+
+namespace {
+
+#ifdef __linux__
+// From <linux/mempolicy.h>
+constexpr int kMpolPreferred = 1;
+
+// Parse a sysfs CPU or node list such as "0-3,8-11"
+Result<std::vector<int>> ParseSysfsList(const std::string& path) {
+  std::ifstream file(path);
+  std::string line;
+  if (!file || !std::getline(file, line)) {
+    return Status::IOError("Could not read ", path);
+  }
+  line = TrimString(std::move(line));
+  std::vector<int> values;
+  for (std::string_view range : SplitString(line, ',')) {
+    if (range.empty()) {
+      continue;
+    }
+    const auto dash = range.find('-');
+    int first, last;
+    if (!ParseValue<Int32Type>(range.data(), range.substr(0, dash).size(), &first) ||
+        (dash != std::string_view::npos &&
+         !ParseValue<Int32Type>(range.data() + dash + 1, range.size() - dash - 1,
+                                &last))) {
+      return Status::IOError("Invalid list in ", path, ": ", line);
+    }
+    if (dash == std::string_view::npos) {
+      last = first;
+    }
+    for (int value = first; value <= last; ++value) {
+      values.push_back(value);
+    }
+  }
+  return values;
+}
+#endif
+
+}  // namespace
+
+int GetNumaNodeCount() {
+#ifdef __linux__
+  static const int count = [] {
+    auto nodes = ParseSysfsList("/sys/devices/system/node/online");
+    return nodes.ok() && !nodes->empty() ? nodes->back() + 1 : 1;
+  }();
+  return count;
+#else
+  return 1;
+#endif
+}
+
+int GetCurrentNumaNode() {
+#if defined(__linux__) && defined(SYS_getcpu)
+  unsigned cpu, node;
+  if (GetNumaNodeCount() > 1 && syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return 0;
+}
+
+Result<std::vector<int>> GetNumaNodeCpus(int node) {
+  if (node < 0 || node >= GetNumaNodeCount()) {
+    return Status::Invalid("Invalid NUMA node ", node);
+  }
+#ifdef __linux__
+  if (GetNumaNodeCount() > 1) {
+    return ParseSysfsList("/sys/devices/system/node/node" + std::to_string(node) +
+                          "/cpulist");
+  }
+#endif
+  std::vector<int> cpus(std::max(1U, std::thread::hardware_concurrency()));
+  for (int cpu = 0; cpu < static_cast<int>(cpus.size()); ++cpu) {
+    cpus[cpu] = cpu;
+  }
+  return cpus;
+}
+
+Status PinCurrentThreadToNumaNode(int node) {
+  ARROW_ASSIGN_OR_RAISE(auto cpus, GetNumaNodeCpus(node));
+#ifdef __linux__
+  if (GetNumaNodeCount() > 1) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus) {
+      if (cpu < CPU_SETSIZE) {
+        CPU_SET(cpu, &set);
+      }
+    }
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+      return IOErrorFromErrno(errno, "Could not pin thread to NUMA node ", node);
+    }
+  }
+#endif
+  return Status::OK();
+}
+
+Status PreferNumaNode(void* data, int64_t size, int node) {
+  if (node < 0 || node >= GetNumaNodeCount()) {
+    return Status::Invalid("Invalid NUMA node ", node);
+  }
+#if defined(__linux__) && defined(SYS_mbind)
+  if (GetNumaNodeCount() > 1) {
+    const auto page_size = static_cast<uintptr_t>(GetPageSize());
+    const auto start = reinterpret_cast<uintptr_t>(data);
+    const uintptr_t first_page = (start + page_size - 1) & ~(page_size - 1);
+    const uintptr_t end_page = (start + static_cast<uintptr_t>(size)) & ~(page_size - 1);
+    if (end_page <= first_page) {
+      return Status::OK();
+    }
+    // mbind() takes a mask of unsigned longs and the number of its bits plus one
+    using MaskWord = unsigned long;  // NOLINT(runtime/int)
+    constexpr int kWordBits = 8 * sizeof(MaskWord);
+    std::vector<MaskWord> node_mask(node / kWordBits + 1, 0);
+    node_mask[node / kWordBits] |= MaskWord{1} << (node % kWordBits);
+    if (syscall(SYS_mbind, first_page, end_page - first_page, kMpolPreferred,
+                node_mask.data(), node_mask.size() * kWordBits + 1, 0) != 0) {
+      return IOErrorFromErrno(errno, "Could not bind memory to NUMA node ", node);
+    }
+  }
+#endif
+  return Status::OK();
+}
+
+}  // namespace arrow::internal
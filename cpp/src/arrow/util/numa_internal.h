@@ -0,0 +1,51 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow::internal {
+
+// NUMA helpers, implemented with Linux system calls and sysfs so as not to depend on
+// libnuma.  On other platforms, and on Linux hosts without NUMA information, there
+// is a single node 0 holding all the CPUs, and binding or pinning does nothing.
+
+/// \brief Return the number of NUMA nodes of the host (at least 1)
+ARROW_EXPORT int GetNumaNodeCount();
+
+/// \brief Return the NUMA node of the CPU the calling thread runs on
+ARROW_EXPORT int GetCurrentNumaNode();
+
+/// \brief Return the CPUs of a NUMA node
+ARROW_EXPORT Result<std::vector<int>> GetNumaNodeCpus(int node);
+
+/// \brief Restrict the calling thread to the CPUs of a NUMA node
+ARROW_EXPORT Status PinCurrentThreadToNumaNode(int node);
+
+/// \brief Make the pages of a memory range prefer a NUMA node
+///
+/// Only the pages entirely within the range are affected, and only when they
+/// are first touched: pages already backed by memory aren't moved.
+ARROW_EXPORT Status PreferNumaNode(void* data, int64_t size, int node);
+
+}  // namespace arrow::internal
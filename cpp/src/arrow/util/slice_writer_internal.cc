@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/slice_writer_internal.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "arrow/array/array_base.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/cast.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/table.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+struct SliceIteratorFunctor {
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    if (current_offset < batch->num_rows()) {
+      std::shared_ptr<RecordBatch> next = batch->Slice(current_offset, slice_size);
+      current_offset += slice_size;
+      return next;
+    }
+    return IterationTraits<std::shared_ptr<RecordBatch>>::End();
+  }
+  const RecordBatch* const batch;
+  const int64_t slice_size;
+  int64_t current_offset;
+};
+
+}  // namespace
+
+RecordBatchIterator RecordBatchSliceIterator(const RecordBatch& batch,
+                                             int64_t slice_size) {
+  SliceIteratorFunctor functor = {&batch, slice_size, /*offset=*/static_cast<int64_t>(0)};
+  return RecordBatchIterator(std::move(functor));
+}
+
+Result<std::shared_ptr<Array>> CastToStringArray(const Array& data, MemoryPool* pool) {
+  compute::ExecContext ctx(pool);
+  ctx.set_use_threads(false);
+  if (data.type() && is_large_binary_like(data.type()->id())) {
+    return compute::Cast(data, /*to_type=*/large_utf8(), compute::CastOptions(), &ctx);
+  }
+  auto casted = compute::Cast(data, /*to_type=*/utf8(), compute::CastOptions(), &ctx);
+  if (casted.status().IsCapacityError()) {
+    return compute::Cast(data, /*to_type=*/large_utf8(), compute::CastOptions(), &ctx);
+  }
+  return casted;
+}
+
+Result<std::unique_ptr<SliceWriter>> SliceWriter::Make(
+    io::OutputStream* sink, bool use_threads, const FormatterFactory& make_formatter) {
+  Executor* executor = use_threads ? GetCpuThreadPool() : nullptr;
+  const int num_formatters =
+      executor != nullptr ? std::max(2, 2 * executor->GetCapacity()) : 1;
+  std::vector<std::unique_ptr<SliceFormatter>> formatters(num_formatters);
+  for (auto& formatter : formatters) {
+    ARROW_ASSIGN_OR_RAISE(formatter, make_formatter());
+  }
+  return std::make_unique<SliceWriter>(sink, executor, std::move(formatters));
+}
+
+SliceWriter::SliceWriter(io::OutputStream* sink, Executor* executor,
+                         std::vector<std::unique_ptr<SliceFormatter>> formatters)
+    : sink_(sink), executor_(executor), formatters_(std::move(formatters)) {}
+
+Status SliceWriter::WriteRecordBatch(const RecordBatch& batch, int64_t slice_size) {
+  return WriteSlices(RecordBatchSliceIterator(batch, slice_size));
+}
+
+Status SliceWriter::WriteTable(const Table& table, int64_t slice_size) {
+  TableBatchReader reader(table);
+  reader.set_chunksize(slice_size);
+  return WriteSlices(MakeFunctionIterator([&reader] { return reader.Next(); }));
+}
+
+Status SliceWriter::WriteFormatted(const SliceFormatter& formatter) {
+  if (formatter.data_buffer()->size() > 0) {
+    RETURN_NOT_OK(sink_->Write(formatter.data_buffer()));
+  }
+  ++num_slices_written_;
+  return Status::OK();
+}
+
+Status SliceWriter::WriteSlices(RecordBatchIterator slices) {
+  // Waiting on the thread pool from one of its own threads could deadlock
+  if (executor_ == nullptr || executor_->OwnsThisThread()) {
+    for (auto maybe_slice : slices) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, maybe_slice);
+      RETURN_NOT_OK(formatters_[0]->Format(*slice));
+      RETURN_NOT_OK(WriteFormatted(*formatters_[0]));
+    }
+    return Status::OK();
+  }
+  std::deque<Future<>> pending;
+  Status st = WriteSlicesPipelined(&slices, &pending);
+  // On error, don't return while tasks still use the formatters
+  for (const auto& fut : pending) {
+    fut.Wait();
+  }
+  return st;
+}
+
+// Slices are assigned to the formatters in round-robin order, so that the formatter
+// of the next slice is free once fewer than formatters_.size() slices are pending.
+Status SliceWriter::WriteSlicesPipelined(RecordBatchIterator* slices,
+                                         std::deque<Future<>>* pending) {
+  const size_t num_formatters = formatters_.size();
+  size_t next_formatter = 0;
+  bool exhausted = false;
+  while (true) {
+    while (!exhausted && pending->size() < num_formatters) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, slices->Next());
+      if (IsIterationEnd(slice)) {
+        exhausted = true;
+        break;
+      }
+      SliceFormatter* formatter = formatters_[next_formatter].get();
+      next_formatter = (next_formatter + 1) % num_formatters;
+      ARROW_ASSIGN_OR_RAISE(auto fut,
+                            executor_->Submit([formatter, slice = std::move(slice)] {
+                              return formatter->Format(*slice);
+                            }));
+      pending->push_back(std::move(fut));
+    }
+    if (pending->empty()) {
+      return Status::OK();
+    }
+    const size_t oldest =
+        (next_formatter + num_formatters - pending->size()) % num_formatters;
+    RETURN_NOT_OK(pending->front().status());
+    pending->pop_front();
+    RETURN_NOT_OK(WriteFormatted(*formatters_[oldest]));
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/type_fwd.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
+#include "arrow/util/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+// Helpers shared by the writers which render record batches as text (CSV, JSON).
+// Batches and tables are broken into slices of rows, each converted independently to
+// a single buffer by a SliceFormatter, and the buffers are written in order.
+
+/// \brief Return an iterator over the slices of at most slice_size rows of batch
+///
+/// The batch must outlive the iterator.
+ARROW_EXPORT
+RecordBatchIterator RecordBatchSliceIterator(const RecordBatch& batch,
+                                             int64_t slice_size);
+
+/// \brief Cast the values of an array to strings, to be rendered as text
+///
+/// The result is a StringArray, or a LargeStringArray if the values are large
+/// binary-like or too long in total for a StringArray.  Binary values must be valid
+/// UTF-8.  The cast doesn't use threads, as slices are expected to be reasonably small.
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> CastToStringArray(const Array& data, MemoryPool* pool);
+
+/// \brief Converts slices of rows to text, in its own data buffer
+class ARROW_EXPORT SliceFormatter {
+ public:
+  virtual ~SliceFormatter() = default;
+
+  /// \brief Replace the contents of data_buffer() with the rendering of slice
+  virtual Status Format(const RecordBatch& slice) = 0;
+
+  const std::shared_ptr<ResizableBuffer>& data_buffer() const { return data_buffer_; }
+
+ protected:
+  explicit SliceFormatter(std::shared_ptr<ResizableBuffer> data_buffer)
+      : data_buffer_(std::move(data_buffer)) {}
+
+  std::shared_ptr<ResizableBuffer> data_buffer_;
+};
+
+/// \brief Writes batches and tables to a sink, slice by slice, in order
+///
+/// With threads, slices are converted on the CPU thread pool while the calling thread
+/// writes the oldest converted one.  Twice as many slices as the pool has threads are
+/// in flight, each with its own formatter, so that the threads still have work while
+/// the calling thread writes.
+class ARROW_EXPORT SliceWriter {
+ public:
+  using FormatterFactory = std::function<Result<std::unique_ptr<SliceFormatter>>()>;
+
+  static Result<std::unique_ptr<SliceWriter>> Make(io::OutputStream* sink,
+                                                   bool use_threads,
+                                                   const FormatterFactory& make_formatter);
+
+  SliceWriter(io::OutputStream* sink, Executor* executor,
+              std::vector<std::unique_ptr<SliceFormatter>> formatters);
+
+  /// \brief Write batch in slices of at most slice_size rows
+  Status WriteRecordBatch(const RecordBatch& batch, int64_t slice_size);
+
+  /// \brief Write table in slices of at most slice_size rows
+  Status WriteTable(const Table& table, int64_t slice_size);
+
+  /// \brief A formatter which is free between writes, e.g. to render a header
+  SliceFormatter* formatter() const { return formatters_[0].get(); }
+
+  /// \brief The number of slices written so far
+  int64_t num_slices_written() const { return num_slices_written_; }
+
+ private:
+  Status WriteSlices(RecordBatchIterator slices);
+  Status WriteSlicesPipelined(RecordBatchIterator* slices, std::deque<Future<>>* pending);
+  Status WriteFormatted(const SliceFormatter& formatter);
+
+  io::OutputStream* sink_;
+  Executor* executor_;
+  std::vector<std::unique_ptr<SliceFormatter>> formatters_;
+  int64_t num_slices_written_ = 0;
+};
+
+}  // namespace internal
+}  // namespace arrow
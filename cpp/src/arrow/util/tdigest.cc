@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <queue>
@@ -26,6 +27,7 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/math_constants.h"
 
 namespace arrow {
@@ -127,6 +129,26 @@ class TDigestMerger : private T {
   std::vector<Centroid>* tdigest_;
 };
 
+// serialized sketch layout, all little-endian: format version (uint8), delta (uint32),
+// min and max (double), number of centroids (uint32), then the mean and weight (double)
+// of each centroid
+constexpr uint8_t kSketchVersion = 1;
+constexpr size_t kSketchHeaderSize = 1 + 4 + 8 + 8 + 4;
+
+template <typename T>
+void AppendLittleEndian(T value, std::string* out) {
+  value = bit_util::ToLittleEndian(value);
+  out->append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T ReadLittleEndian(const char** data) {
+  T value;
+  std::memcpy(&value, *data, sizeof(T));
+  *data += sizeof(T);
+  return bit_util::FromLittleEndian(value);
+}
+
 }  // namespace
 
 class TDigest::TDigestImpl {
@@ -340,6 +362,41 @@ class TDigest::TDigestImpl {
 
   double total_weight() const { return total_weight_; }
 
+  void Serialize(std::string* out) const {
+    const auto& td = tdigests_[current_];
+    out->reserve(kSketchHeaderSize + td.size() * 2 * sizeof(double));
+    AppendLittleEndian(kSketchVersion, out);
+    AppendLittleEndian(delta_, out);
+    AppendLittleEndian(min_, out);
+    AppendLittleEndian(max_, out);
+    AppendLittleEndian(static_cast<uint32_t>(td.size()), out);
+    for (const auto& centroid : td) {
+      AppendLittleEndian(centroid.mean, out);
+      AppendLittleEndian(centroid.weight, out);
+    }
+  }
+
+  // load the centroids of a serialized sketch into this reset tdigest
+  Status Deserialize(const char* data, uint32_t num_centroids, double min, double max) {
+    if (num_centroids > delta_) {
+      return Status::Invalid("Invalid tdigest sketch: ", num_centroids,
+                             " centroids for delta ", delta_);
+    }
+    auto& td = tdigests_[current_];
+    for (uint32_t i = 0; i < num_centroids; ++i) {
+      Centroid centroid;
+      centroid.mean = ReadLittleEndian<double>(&data);
+      centroid.weight = ReadLittleEndian<double>(&data);
+      td.push_back(centroid);
+      total_weight_ += centroid.weight;
+    }
+    if (num_centroids > 0) {
+      min_ = min;
+      max_ = max;
+    }
+    return Validate();
+  }
+
  private:
   // must be declared before merger_, see constructor initialization list
   const uint32_t delta_;
@@ -410,6 +467,39 @@ bool TDigest::is_empty() const {
   return input_.size() == 0 && impl_->total_weight() == 0;
 }
 
+double TDigest::total_weight() const {
+  return static_cast<double>(input_.size()) + impl_->total_weight();
+}
+
+std::string TDigest::Serialize() const {
+  MergeInput();
+  std::string sketch;
+  impl_->Serialize(&sketch);
+  return sketch;
+}
+
+Result<TDigest> TDigest::Deserialize(std::string_view sketch, uint32_t buffer_size) {
+  if (sketch.size() < kSketchHeaderSize) {
+    return Status::Invalid("Invalid tdigest sketch: too short");
+  }
+  const char* data = sketch.data();
+  const auto version = ReadLittleEndian<uint8_t>(&data);
+  if (version != kSketchVersion) {
+    return Status::Invalid("Unsupported tdigest sketch version: ",
+                           static_cast<int>(version));
+  }
+  const auto delta = ReadLittleEndian<uint32_t>(&data);
+  const auto min = ReadLittleEndian<double>(&data);
+  const auto max = ReadLittleEndian<double>(&data);
+  const auto num_centroids = ReadLittleEndian<uint32_t>(&data);
+  if (sketch.size() != kSketchHeaderSize + num_centroids * 2 * sizeof(double)) {
+    return Status::Invalid("Invalid tdigest sketch: size mismatch");
+  }
+  TDigest tdigest(delta, buffer_size);
+  RETURN_NOT_OK(tdigest.impl_->Deserialize(data, num_centroids, min, max));
+  return tdigest;
+}
+
 void TDigest::MergeInput() const {
   if (input_.size() > 0) {
     impl_->MergeInput(input_);  // will mutate input_
@@ -24,16 +24,16 @@
 
 #include <cmath>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
+#include "arrow/result.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
-
-class Status;
-
 namespace internal {
 
 class ARROW_EXPORT TDigest {
@@ -88,6 +88,16 @@ class ARROW_EXPORT TDigest {
   // check if this tdigest contains no valid data points
   bool is_empty() const;
 
+  // number of data points added, including the merged tdigests
+  double total_weight() const;
+
+  // serialize to a portable binary sketch, which can be stored or shipped to
+  // another process and merged there
+  std::string Serialize() const;
+
+  // load a sketch produced by Serialize()
+  static Result<TDigest> Deserialize(std::string_view sketch, uint32_t buffer_size = 500);
+
  private:
   // merge input data with current tdigest
   void MergeInput() const;
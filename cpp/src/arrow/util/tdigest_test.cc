@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -287,5 +288,48 @@ TEST(TDigestTest, Misc) {
   }
 }
 
+TEST(TDigestTest, Serialize) {
+  std::vector<double> values;
+  random_real(10000, 0x11223344, -1000.0, 1000.0, &values);
+  const std::vector<double> quantiles = {0, 0.01, 0.1, 0.5, 0.9, 0.99, 1};
+
+  TDigest td(200);
+  for (double value : values) {
+    td.Add(value);
+  }
+  ASSERT_OK_AND_ASSIGN(auto copy, TDigest::Deserialize(td.Serialize()));
+  ASSERT_OK(copy.Validate());
+  ASSERT_EQ(copy.total_weight(), td.total_weight());
+  for (double q : quantiles) {
+    EXPECT_EQ(copy.Quantile(q), td.Quantile(q)) << q;
+  }
+  // The sketch doesn't change through a round trip
+  ASSERT_EQ(copy.Serialize(), td.Serialize());
+
+  // Merging deserialized tdigests is the same as merging the original ones
+  TDigest other(200);
+  for (double value : values) {
+    other.Add(value / 2);
+  }
+  ASSERT_OK_AND_ASSIGN(auto other_copy, TDigest::Deserialize(other.Serialize()));
+  td.Merge(other);
+  copy.Merge(other_copy);
+  for (double q : quantiles) {
+    EXPECT_EQ(copy.Quantile(q), td.Quantile(q)) << q;
+  }
+
+  // Empty tdigest
+  ASSERT_OK_AND_ASSIGN(auto empty, TDigest::Deserialize(TDigest().Serialize()));
+  ASSERT_TRUE(empty.is_empty());
+
+  // Invalid sketches
+  const std::string sketch = td.Serialize();
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(""));
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(sketch.substr(0, sketch.size() - 1)));
+  std::string bad_version = sketch;
+  bad_version[0] = 42;
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(bad_version));
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -18,10 +18,12 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <list>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <vector>
@@ -30,7 +32,9 @@
 #include "arrow/util/config.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/metrics.h"
 #include "arrow/util/mutex.h"
+#include "arrow/util/numa_internal.h"
 
 #include "arrow/util/tracing_internal.h"
 
@@ -392,6 +396,43 @@ void SerialExecutor::RunLoop() {
 
 #ifdef ARROW_ENABLE_THREADING
 
+namespace {
+
+// Wrap a task to propagate the current tracing span to it
+//
+// This task-wrapping needs to be done before grabbing a pool's mutex because the first
+// call to OT (whatever that happens to be) will attempt to grab this mutex when calling
+// KeepAlive to keep the OT infrastructure alive.
+FnOnce<void()> PropagateTracingSpan(FnOnce<void()> task) {
+#  ifdef ARROW_WITH_OPENTELEMETRY
+  struct {
+    void operator()() {
+      auto scope = ::arrow::internal::tracing::GetTracer()->WithActiveSpan(activeSpan);
+      std::move(func)();
+    }
+    FnOnce<void()> func;
+    opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> activeSpan;
+  } wrapper{std::move(task), ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()};
+  return wrapper;
+#  else
+  return task;
+#  endif
+}
+
+// Run a task, or its stop callback if it was cancelled
+void RunTask(Task* task) {
+  StopToken* stop_token = &task->stop_token;
+  if (!stop_token->IsStopRequested()) {
+    std::move(task->callable)();
+  } else {
+    if (task->stop_callback) {
+      std::move(task->stop_callback)(stop_token->Poll());
+    }
+  }
+}
+
+}  // namespace
+
 struct ThreadPool::State {
   State() = default;
 
@@ -415,12 +456,23 @@ struct ThreadPool::State {
   // Total number of tasks that are either queued or running
   int tasks_queued_or_running_ = 0;
 
+  // Number of workers waiting on cv_, and of those notified but not awake yet
+  int waiting_workers_ = 0;
+  int wakeups_pending_ = 0;
+
   // Are we shutting down?
   bool please_shutdown_ = false;
   bool quick_shutdown_ = false;
 
+  // Should new workers be pinned to NUMA nodes, and to which one next?
+  bool pin_workers_to_numa_nodes_ = false;
+  int next_worker_numa_node_ = 0;
+
   std::vector<std::shared_ptr<Resource>> kept_alive_resources_;
 
+  // Set if the pool exports its metrics
+  std::shared_ptr<util::metrics::Histogram> task_duration_;
+
   // At-fork machinery
 
   void BeforeFork() { mutex_.lock(); }
@@ -431,10 +483,14 @@ struct ThreadPool::State {
     int desired_capacity = desired_capacity_;
     bool please_shutdown = please_shutdown_;
     bool quick_shutdown = quick_shutdown_;
+    bool pin_workers_to_numa_nodes = pin_workers_to_numa_nodes_;
+    auto task_duration = std::move(task_duration_);
     new (this) State;  // force-reinitialize, including synchronization primitives
     desired_capacity_ = desired_capacity;
     please_shutdown_ = please_shutdown;
     quick_shutdown_ = quick_shutdown;
+    pin_workers_to_numa_nodes_ = pin_workers_to_numa_nodes;
+    task_duration_ = std::move(task_duration);
   }
 
   std::shared_ptr<AtForkHandler> atfork_handler_;
@@ -472,14 +528,16 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
       {
         Task task = std::move(const_cast<Task&>(state->pending_tasks_.top().task));
         state->pending_tasks_.pop();
-        StopToken* stop_token = &task.stop_token;
+        util::metrics::Histogram* task_duration = state->task_duration_.get();
         lock.unlock();
-        if (!stop_token->IsStopRequested()) {
-          std::move(task.callable)();
+        if (task_duration != nullptr) {
+          const auto start = std::chrono::steady_clock::now();
+          RunTask(&task);
+          task_duration->Observe(
+              std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+                  .count());
         } else {
-          if (task.stop_callback) {
-            std::move(task.stop_callback)(stop_token->Poll());
-          }
+          RunTask(&task);
         }
         {
           auto tmp_task = std::move(task);  // release resources before waiting for lock
@@ -496,7 +554,12 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
       break;
     }
     // Wait for next wakeup
+    ++state->waiting_workers_;
     state->cv_.wait(lock);
+    --state->waiting_workers_;
+    if (state->wakeups_pending_ > 0) {
+      --state->wakeups_pending_;
+    }
   }
   DCHECK_GE(state->tasks_queued_or_running_, 0);
 
@@ -638,32 +701,71 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
   for (int i = 0; i < threads; i++) {
     state_->workers_.emplace_back();
     auto it = --(state_->workers_.end());
-    *it = std::thread([this, state, it] {
+    const int numa_node =
+        state_->pin_workers_to_numa_nodes_
+            ? state_->next_worker_numa_node_++ % GetNumaNodeCount()
+            : -1;
+    *it = std::thread([this, state, it, numa_node] {
       current_thread_pool_ = this;
+      if (numa_node >= 0) {
+        Status st = PinCurrentThreadToNumaNode(numa_node);
+        if (!st.ok()) {
+          ARROW_LOG(WARNING) << st.ToString();
+        }
+      }
       WorkerLoop(state, it);
     });
   }
 }
 
+void ThreadPool::ExportMetrics(const std::string& pool_name) {
+  using util::metrics::MetricType;
+  auto* registry = util::metrics::MetricsRegistry::Default();
+  const util::metrics::MetricLabels labels = {{"pool", pool_name}};
+  // The callbacks unregister themselves once the pool is destroyed
+  auto register_gauge = [&](const std::string& name, const std::string& help,
+                            int64_t (*get)(const State&)) {
+    std::weak_ptr<State> weak_state = sp_state_;
+    DCHECK_OK(registry->RegisterCallback(
+        MetricType::GAUGE, name, help, labels,
+        [weak_state, get]() -> std::optional<int64_t> {
+          auto state = weak_state.lock();
+          if (!state) return std::nullopt;
+          std::lock_guard<std::mutex> lock(state->mutex_);
+          return get(*state);
+        }));
+  };
+  register_gauge("arrow_thread_pool_tasks_queued",
+                 "Tasks waiting in the queue of a thread pool", [](const State& state) {
+                   return static_cast<int64_t>(state.pending_tasks_.size());
+                 });
+  register_gauge("arrow_thread_pool_tasks_running", "Tasks run by a thread pool",
+                 [](const State& state) {
+                   return static_cast<int64_t>(state.tasks_queued_or_running_) -
+                          static_cast<int64_t>(state.pending_tasks_.size());
+                 });
+  register_gauge(
+      "arrow_thread_pool_capacity", "Desired number of workers of a thread pool",
+      [](const State& state) { return static_cast<int64_t>(state.desired_capacity_); });
+
+  auto maybe_task_duration = registry->GetHistogram(
+      "arrow_thread_pool_task_duration_seconds", "Run time of thread pool tasks",
+      util::metrics::Histogram::LatencyBounds(), labels);
+  DCHECK_OK(maybe_task_duration.status());
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  state_->task_duration_ = std::move(maybe_task_duration).ValueOr(nullptr);
+}
+
+void ThreadPool::SetPinWorkersToNumaNodes(bool pin) {
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  state_->pin_workers_to_numa_nodes_ = pin && GetNumaNodeCount() > 1;
+}
+
 Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken stop_token,
                              StopCallback&& stop_callback) {
+  bool should_notify;
   {
-#  ifdef ARROW_WITH_OPENTELEMETRY
-    // Wrap the task to propagate a parent tracing span to it
-    // This task-wrapping needs to be done before we grab the mutex because the
-    // first call to OT (whatever that happens to be) will attempt to grab this mutex
-    // when calling KeepAlive to keep the OT infrastructure alive.
-    struct {
-      void operator()() {
-        auto scope = ::arrow::internal::tracing::GetTracer()->WithActiveSpan(activeSpan);
-        std::move(func)();
-      }
-      FnOnce<void()> func;
-      opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> activeSpan;
-    } wrapper{std::forward<FnOnce<void()>>(task),
-              ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()};
-    task = std::move(wrapper);
-#  endif
+    task = PropagateTracingSpan(std::move(task));
     std::lock_guard<std::mutex> lock(state_->mutex_);
     if (state_->please_shutdown_) {
       return Status::Invalid("operation forbidden during or after shutdown");
@@ -679,8 +781,19 @@ Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken sto
         QueuedTask{{std::move(task), std::move(stop_token), std::move(stop_callback)},
                    hints.priority,
                    state_->spawned_tasks_count_++});
+    // Only wake up a worker if the queued tasks outnumber the workers already being
+    // woken up: a burst of small tasks would otherwise wake up every waiting worker,
+    // most of them finding the queue empty already.
+    should_notify =
+        state_->waiting_workers_ > state_->wakeups_pending_ &&
+        static_cast<int>(state_->pending_tasks_.size()) > state_->wakeups_pending_;
+    if (should_notify) {
+      ++state_->wakeups_pending_;
+    }
+  }
+  if (should_notify) {
+    state_->cv_.notify_one();
   }
-  state_->cv_.notify_one();
   return Status::OK();
 }
 
@@ -707,6 +820,236 @@ Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads) {
   return pool;
 }
 
+// ----------------------------------------------------------------------
+// WorkStealingThreadPool
+
+struct WorkStealingThreadPool::State {
+  // Padded to a cache line so that workers don't contend on each other's queues
+  struct alignas(64) TaskQueue {
+    std::mutex mutex_;
+    std::deque<Task> tasks_;
+  };
+
+  explicit State(int threads) : worker_queues_(threads) {}
+
+  std::vector<TaskQueue> worker_queues_;
+  // Tasks spawned from outside the pool
+  TaskQueue shared_queue_;
+
+  // Number of tasks in any of the queues.  This may briefly be off by the tasks which
+  // are being pushed or popped.
+  std::atomic<int64_t> tasks_queued_{0};
+  // Total number of tasks that are either queued or running
+  std::atomic<int64_t> tasks_queued_or_running_{0};
+  // Number of workers waiting on cv_
+  std::atomic<int> workers_sleeping_{0};
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::condition_variable cv_idle_;
+
+  std::vector<std::thread> workers_;
+
+  // Are we shutting down?
+  bool please_shutdown_ = false;
+  std::atomic<bool> quick_shutdown_{false};
+
+  std::vector<std::shared_ptr<Resource>> kept_alive_resources_;
+};
+
+namespace {
+
+// The pool and queue index of the worker running on this thread, if any
+thread_local WorkStealingThreadPool::State* current_work_stealing_state_ = nullptr;
+thread_local int current_worker_index_ = -1;
+
+bool PopTask(WorkStealingThreadPool::State* state, int worker_index, Task* out) {
+  auto pop_front = [&](WorkStealingThreadPool::State::TaskQueue* queue) {
+    std::lock_guard<std::mutex> lock(queue->mutex_);
+    if (queue->tasks_.empty()) return false;
+    *out = std::move(queue->tasks_.front());
+    queue->tasks_.pop_front();
+    return true;
+  };
+
+  // Our own newest task first, it is the most likely to find its data in cache
+  {
+    auto* queue = &state->worker_queues_[worker_index];
+    std::lock_guard<std::mutex> lock(queue->mutex_);
+    if (!queue->tasks_.empty()) {
+      *out = std::move(queue->tasks_.back());
+      queue->tasks_.pop_back();
+      return true;
+    }
+  }
+  if (pop_front(&state->shared_queue_)) return true;
+  // Steal the oldest task of another worker, as it is the least likely to be in the
+  // cache of its owner
+  const int num_workers = static_cast<int>(state->worker_queues_.size());
+  for (int i = 1; i < num_workers; ++i) {
+    if (pop_front(&state->worker_queues_[(worker_index + i) % num_workers])) return true;
+  }
+  return false;
+}
+
+void WorkStealingWorkerLoop(std::shared_ptr<WorkStealingThreadPool::State> state,
+                            int worker_index) {
+  current_work_stealing_state_ = state.get();
+  current_worker_index_ = worker_index;
+  while (true) {
+    Task task;
+    if (!state->quick_shutdown_.load() && PopTask(state.get(), worker_index, &task)) {
+      state->tasks_queued_.fetch_sub(1);
+      RunTask(&task);
+      {
+        auto tmp_task = std::move(task);  // release resources before waiting for lock
+        ARROW_UNUSED(tmp_task);
+      }
+      if (ARROW_PREDICT_FALSE(state->tasks_queued_or_running_.fetch_sub(1) == 1)) {
+        std::lock_guard<std::mutex> lock(state->mutex_);
+        state->cv_idle_.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(state->mutex_);
+    if (state->please_shutdown_ &&
+        (state->quick_shutdown_.load() || state->tasks_queued_.load() <= 0)) {
+      break;
+    }
+    // A spawner increments tasks_queued_ before reading workers_sleeping_, and we
+    // increment workers_sleeping_ before reading tasks_queued_, so either we see the
+    // new task or the spawner sees us sleeping and notifies us.
+    state->workers_sleeping_.fetch_add(1);
+    state->cv_.wait(lock, [&] {
+      return state->tasks_queued_.load() > 0 || state->please_shutdown_;
+    });
+    state->workers_sleeping_.fetch_sub(1);
+  }
+  current_work_stealing_state_ = nullptr;
+  current_worker_index_ = -1;
+}
+
+}  // namespace
+
+WorkStealingThreadPool::WorkStealingThreadPool(int threads)
+    : sp_state_(std::make_shared<State>(threads)), state_(sp_state_.get()) {
+  for (int i = 0; i < threads; ++i) {
+    state_->workers_.emplace_back(
+        [state = sp_state_, i] { WorkStealingWorkerLoop(std::move(state), i); });
+  }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  ARROW_UNUSED(Shutdown(false /* wait */));
+}
+
+Result<std::shared_ptr<WorkStealingThreadPool>> WorkStealingThreadPool::Make(
+    int threads) {
+  if (threads <= 0) {
+    return Status::Invalid("WorkStealingThreadPool capacity must be > 0");
+  }
+  return std::shared_ptr<WorkStealingThreadPool>(new WorkStealingThreadPool(threads));
+}
+
+int WorkStealingThreadPool::GetCapacity() {
+  return static_cast<int>(state_->worker_queues_.size());
+}
+
+int WorkStealingThreadPool::GetNumTasks() {
+  return static_cast<int>(state_->tasks_queued_or_running_.load());
+}
+
+bool WorkStealingThreadPool::OwnsThisThread() {
+  return current_work_stealing_state_ == state_;
+}
+
+Status WorkStealingThreadPool::Shutdown(bool wait) {
+  std::vector<std::thread> workers;
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    if (state_->please_shutdown_) {
+      return Status::Invalid("Shutdown() already called");
+    }
+    state_->please_shutdown_ = true;
+    state_->quick_shutdown_ = !wait;
+    workers = std::move(state_->workers_);
+  }
+  state_->cv_.notify_all();
+  for (auto& worker : workers) {
+    if (worker.get_id() == std::this_thread::get_id()) {
+      // Shut down from one of our own tasks, the worker exits once the task returns
+      worker.detach();
+    } else {
+      worker.join();
+    }
+  }
+  if (!wait) {
+    int64_t num_dropped = 0;
+    auto clear_queue = [&](State::TaskQueue* queue) {
+      std::lock_guard<std::mutex> lock(queue->mutex_);
+      num_dropped += static_cast<int64_t>(queue->tasks_.size());
+      queue->tasks_.clear();
+    };
+    clear_queue(&state_->shared_queue_);
+    for (auto& queue : state_->worker_queues_) clear_queue(&queue);
+    state_->tasks_queued_.fetch_sub(num_dropped);
+    if (state_->tasks_queued_or_running_.fetch_sub(num_dropped) == num_dropped) {
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      state_->cv_idle_.notify_all();
+    }
+  }
+  return Status::OK();
+}
+
+void WorkStealingThreadPool::WaitForIdle() {
+  std::unique_lock<std::mutex> lock(state_->mutex_);
+  state_->cv_idle_.wait(lock,
+                        [this] { return state_->tasks_queued_or_running_.load() == 0; });
+}
+
+void WorkStealingThreadPool::KeepAlive(std::shared_ptr<Executor::Resource> resource) {
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  state_->kept_alive_resources_.push_back(std::move(resource));
+}
+
+Status WorkStealingThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task,
+                                         StopToken stop_token,
+                                         StopCallback&& stop_callback) {
+  Task queued{PropagateTracingSpan(std::move(task)), std::move(stop_token),
+              std::move(stop_callback)};
+  if (current_work_stealing_state_ == state_) {
+    // The worker is busy running us, so it cannot have exited on shutdown
+    state_->tasks_queued_or_running_.fetch_add(1);
+    auto* queue = &state_->worker_queues_[current_worker_index_];
+    {
+      std::lock_guard<std::mutex> lock(queue->mutex_);
+      queue->tasks_.push_back(std::move(queued));
+    }
+    state_->tasks_queued_.fetch_add(1);
+    if (state_->workers_sleeping_.load() == 0) {
+      return Status::OK();
+    }
+    // Synchronize with a worker which may be about to sleep
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+  } else {
+    // Checking for shutdown and queueing under the pool mutex ensures workers don't
+    // exit while this task is pending
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    if (state_->please_shutdown_) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    state_->tasks_queued_or_running_.fetch_add(1);
+    {
+      std::lock_guard<std::mutex> queue_lock(state_->shared_queue_.mutex_);
+      state_->shared_queue_.tasks_.push_back(std::move(queued));
+    }
+    state_->tasks_queued_.fetch_add(1);
+  }
+  state_->cv_.notify_one();
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Global thread pool
 
@@ -814,6 +1157,7 @@ std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
   if (!maybe_pool.ok()) {
     maybe_pool.status().Abort("Failed to create global CPU thread pool");
   }
+  (*maybe_pool)->ExportMetrics("cpu");
   return *std::move(maybe_pool);
 }
 
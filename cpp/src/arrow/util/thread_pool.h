@@ -61,7 +61,7 @@ ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 namespace internal {
 
 // Hints about a task that may be used by an Executor.
-// They are ignored by the provided ThreadPool implementation.
+// The provided ThreadPool implementation only honours the priority.
 struct TaskHints {
   // The lower, the more urgent
   int32_t priority = 0;
@@ -473,10 +473,19 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // as soon as possible.
   Status SetCapacity(int threads);
 
+  // Pin the worker threads launched from now on to NUMA nodes, spreading them
+  // round-robin over the nodes of the host.  This does nothing on hosts with a
+  // single NUMA node.
+  void SetPinWorkersToNumaNodes(bool pin);
+
   // Heuristic for the default capacity of a thread pool for CPU-bound tasks.
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
 
+  // Export the queue depth, capacity and task durations of this pool to the
+  // default metrics registry, labelled with the given pool name.
+  void ExportMetrics(const std::string& pool_name);
+
   // Shutdown the pool.  Once the pool starts shutting down, new tasks
   // cannot be submitted anymore.
   // If "wait" is true, shutdown waits for all pending tasks to be finished.
@@ -516,6 +525,61 @@ class ARROW_EXPORT ThreadPool : public Executor {
   State* state_;
   bool shutdown_on_destroy_;
 };
+
+/// An Executor implementation running tasks on a fixed-size pool of worker threads,
+/// each of which has its own task queue.
+///
+/// Tasks spawned from a worker thread go to that worker's queue, which the worker
+/// drains newest first so that continuations tend to run on the core whose cache
+/// still holds their inputs.  Tasks spawned from other threads go to a shared queue.
+/// A worker whose queue is empty takes from the shared queue and, failing that,
+/// steals the oldest task queued by another worker.  Unlike ThreadPool, spawning from a
+/// worker thread only contends with workers stealing from the same queue.
+///
+/// Task priorities are ignored.  The pool is not restarted in a forked child process.
+///
+/// To run an Acero plan on this executor, pass it as QueryOptions::custom_cpu_executor.
+class ARROW_EXPORT WorkStealingThreadPool : public Executor {
+ public:
+  // Construct a thread pool with the given number of worker threads
+  static Result<std::shared_ptr<WorkStealingThreadPool>> Make(int threads);
+
+  // Destroy thread pool; the pool will first be shut down
+  ~WorkStealingThreadPool() override;
+
+  // Return the number of worker threads
+  int GetCapacity() override;
+
+  // Return the number of tasks either running or in a queue.
+  int GetNumTasks();
+
+  bool OwnsThisThread() override;
+
+  // Shutdown the pool.  Once the pool starts shutting down, new tasks
+  // cannot be submitted anymore, except from tasks already running.
+  // If "wait" is true, shutdown waits for all pending tasks to be finished.
+  // If "wait" is false, workers are stopped as soon as currently executing
+  // tasks are finished.
+  Status Shutdown(bool wait = true);
+
+  // Wait for the thread pool to become idle
+  //
+  // This is useful for sequencing tests
+  void WaitForIdle();
+
+  void KeepAlive(std::shared_ptr<Executor::Resource> resource) override;
+
+  struct State;
+
+ protected:
+  explicit WorkStealingThreadPool(int threads);
+
+  Status SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken,
+                   StopCallback&&) override;
+
+  std::shared_ptr<State> sp_state_;
+  State* state_;
+};
 #else  // ARROW_ENABLE_THREADING
 // an executor implementation which pretends to be a thread pool but runs everything
 // on the main thread using a static queue (shared between all thread pools, otherwise
@@ -550,6 +614,9 @@ class ARROW_EXPORT ThreadPool : public SerialExecutor {
 
   static int DefaultCapacity() { return 8; }
 
+  // Metrics are not exported without threading
+  void ExportMetrics(const std::string& pool_name) {}
+
   // Shutdown the pool.  Once the pool starts shutting down, new tasks
   // cannot be submitted anymore.
   // If "wait" is true, shutdown waits for all pending tasks to be finished.
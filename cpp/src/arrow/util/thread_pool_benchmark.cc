@@ -18,6 +18,7 @@
 #include "benchmark/benchmark.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
@@ -73,8 +74,9 @@ struct Task {
   Workload workload_;
 };
 
-// Benchmark ThreadPool::Spawn
-static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const reference
+// Benchmark spawning tasks from outside the pool
+template <typename PoolType>
+static void SpawnFromOutside(benchmark::State& state) {  // NOLINT non-const reference
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
 
@@ -85,8 +87,8 @@ static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const refe
 
   for (auto _ : state) {
     state.PauseTiming();
-    std::shared_ptr<ThreadPool> pool;
-    pool = *ThreadPool::Make(nthreads);
+    std::shared_ptr<PoolType> pool;
+    pool = *PoolType::Make(nthreads);
     state.ResumeTiming();
 
     for (int32_t i = 0; i < nspawns; ++i) {
@@ -103,6 +105,66 @@ static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const refe
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// Benchmark tasks spawning their successors from worker threads, as happens when
+// continuations of asynchronous work are scheduled (e.g. in Acero)
+template <typename PoolType>
+static void SpawnFromTasks(benchmark::State& state) {  // NOLINT non-const reference
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+
+  Workload workload(workload_size);
+
+  const int32_t nspawns = 10000000 / workload_size + 1;
+  // Several chains of tasks per thread so that workers have something to steal
+  const int nchains = 4 * nthreads;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::shared_ptr<PoolType> pool;
+    pool = *PoolType::Make(nthreads);
+    std::atomic<int32_t> remaining{nspawns};
+    std::function<void()> chain_link = [&]() {
+      workload();
+      if (remaining.fetch_sub(1) > nchains) {
+        ABORT_NOT_OK(pool->Spawn(chain_link));
+      }
+    };
+    state.ResumeTiming();
+
+    for (int i = 0; i < nchains; ++i) {
+      ABORT_NOT_OK(pool->Spawn(chain_link));
+    }
+
+    // Wait for all chains to end, tasks cannot be spawned once shutdown started
+    pool->WaitForIdle();
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nspawns);
+}
+
+// Benchmark ThreadPool::Spawn
+static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const reference
+  SpawnFromOutside<ThreadPool>(state);
+}
+
+static void ThreadPoolSpawnFromTasks(benchmark::State& state) {  // NOLINT
+  SpawnFromTasks<ThreadPool>(state);
+}
+
+#ifdef ARROW_ENABLE_THREADING
+// Benchmark WorkStealingThreadPool::Spawn
+static void WorkStealingThreadPoolSpawn(benchmark::State& state) {  // NOLINT
+  SpawnFromOutside<WorkStealingThreadPool>(state);
+}
+
+static void WorkStealingThreadPoolSpawnFromTasks(benchmark::State& state) {  // NOLINT
+  SpawnFromTasks<WorkStealingThreadPool>(state);
+}
+#endif
+
 // Benchmark SerialExecutor::RunInSerialExecutor
 static void RunInSerialExecutor(benchmark::State& state) {  // NOLINT non-const reference
   const auto workload_size = static_cast<int32_t>(state.range(0));
@@ -243,6 +305,11 @@ BENCHMARK(RunInSerialExecutor)->Apply(WorkloadCost_Customize);
 BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadPoolSubmit)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(ThreadPoolSpawnFromTasks)->Apply(ThreadPoolSpawn_Customize);
+#ifdef ARROW_ENABLE_THREADING
+BENCHMARK(WorkStealingThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(WorkStealingThreadPoolSpawnFromTasks)->Apply(ThreadPoolSpawn_Customize);
+#endif
 
 }  // namespace internal
 }  // namespace arrow
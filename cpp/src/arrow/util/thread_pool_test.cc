@@ -42,6 +42,7 @@
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/numa_internal.h"
 #include "arrow/util/test_common.h"
 #include "arrow/util/thread_pool.h"
 
@@ -100,7 +101,7 @@ class AddTester {
 
   AddTester(AddTester&&) = default;
 
-  void SpawnTasks(ThreadPool* pool, AddTaskFunc add_func) {
+  void SpawnTasks(Executor* pool, AddTaskFunc add_func) {
     for (int i = 0; i < nadds_; ++i) {
       ASSERT_OK(pool->Spawn([this, add_func, i] { add_func(xs_[i], ys_[i], &outs_[i]); },
                             stop_token_));
@@ -579,6 +580,49 @@ TEST_F(TestThreadPool, Spawn) {
   SpawnAdds(pool.get(), 7, task_add<int>);
 }
 
+TEST_F(TestThreadPool, PinWorkersToNumaNodes) {
+  auto pool = this->MakeThreadPool(4);
+  pool->SetPinWorkersToNumaNodes(true);
+  SpawnAdds(pool.get(), 7, task_add<int>);
+
+  // Pinned workers keep running on a node holding their CPUs
+  std::mutex mutex;
+  std::vector<int> nodes;
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      std::lock_guard<std::mutex> lock(mutex);
+      nodes.push_back(GetCurrentNumaNode());
+    }));
+  }
+  pool->WaitForIdle();
+  ASSERT_EQ(8, nodes.size());
+  for (int node : nodes) {
+    ASSERT_GE(node, 0);
+    ASSERT_LT(node, GetNumaNodeCount());
+  }
+}
+
+TEST(Numa, Nodes) {
+  const int num_nodes = GetNumaNodeCount();
+  ASSERT_GE(num_nodes, 1);
+  for (int node = 0; node < num_nodes; ++node) {
+    ASSERT_OK_AND_ASSIGN(auto cpus, GetNumaNodeCpus(node));
+    if (num_nodes == 1) {
+      ASSERT_FALSE(cpus.empty());
+    }
+  }
+  ASSERT_RAISES(Invalid, GetNumaNodeCpus(num_nodes));
+  ASSERT_RAISES(Invalid, PinCurrentThreadToNumaNode(-1));
+
+  const int current_node = GetCurrentNumaNode();
+  ASSERT_GE(current_node, 0);
+  ASSERT_LT(current_node, num_nodes);
+
+  std::vector<uint8_t> data(1 << 20);
+  ASSERT_OK(PreferNumaNode(data.data(), static_cast<int64_t>(data.size()), 0));
+  ASSERT_RAISES(Invalid, PreferNumaNode(data.data(), 0, num_nodes));
+}
+
 TEST_F(TestThreadPool, TasksRunInPriorityOrder) {
   auto pool = this->MakeThreadPool(1);
   constexpr int kNumTasks = 10;
@@ -669,6 +713,37 @@ TEST_F(TestThreadPool, StressSpawnThreaded) {
   SpawnAddsThreaded(pool.get(), 20, 100, task_add<int>);
 }
 
+TEST_F(TestThreadPool, BurstsWakeUpEnoughWorkers) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading support";
+#endif
+  constexpr int kThreads = 4;
+  auto pool = this->MakeThreadPool(kThreads);
+  for (int round = 0; round < 5; ++round) {
+    // Let the workers go to sleep
+    pool->WaitForIdle();
+    SleepABit();
+
+    // The tasks of the burst only finish if they all run at once, so every worker
+    // must be woken up
+    std::mutex mutex;
+    std::condition_variable cv;
+    int arrived = 0;
+    for (int i = 0; i < kThreads; ++i) {
+      ASSERT_OK(pool->Spawn([&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (++arrived == kThreads) {
+          cv.notify_all();
+        }
+        cv.wait(lock, [&] { return arrived == kThreads; });
+      }));
+    }
+    pool->WaitForIdle();
+    ASSERT_EQ(kThreads, arrived);
+  }
+  ASSERT_OK(pool->Shutdown());
+}
+
 TEST_F(TestThreadPool, SpawnSlow) {
   // This checks that Shutdown() waits for all tasks to finish
   auto pool = this->MakeThreadPool(2);
@@ -1022,6 +1097,77 @@ TEST_F(TestThreadPoolForkSafety, NestedChild) {
 
 #endif
 
+#ifdef ARROW_ENABLE_THREADING
+TEST(TestWorkStealingThreadPool, Spawn) {
+  for (int threads : {1, 3, 8}) {
+    ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(threads));
+    ASSERT_EQ(pool->GetCapacity(), threads);
+    AddTester add_tester(1000);
+    add_tester.SpawnTasks(pool.get(), task_add<int>);
+    ASSERT_OK(pool->Shutdown());
+    add_tester.CheckResults();
+  }
+  ASSERT_RAISES(Invalid, WorkStealingThreadPool::Make(0));
+}
+
+TEST(TestWorkStealingThreadPool, SpawnFromWorkers) {
+  // Tasks spawned by tasks are queued on their worker and may be stolen by others
+  ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(4));
+  constexpr int kFanOut = 8;
+  std::atomic<int> num_run{0};
+  std::atomic<bool> one_failed{false};
+  std::function<void(int)> spawn_tree = [&](int depth) {
+    num_run.fetch_add(1);
+    if (!pool->OwnsThisThread()) one_failed = true;
+    if (depth == 0) return;
+    for (int i = 0; i < kFanOut; ++i) {
+      ASSERT_OK(pool->Spawn([&spawn_tree, depth] { spawn_tree(depth - 1); }));
+    }
+  };
+  ASSERT_OK(pool->Spawn([&] { spawn_tree(3); }));
+  pool->WaitForIdle();
+  constexpr int kNumTasks = 1 + kFanOut + kFanOut * kFanOut + kFanOut * kFanOut * kFanOut;
+  ASSERT_EQ(num_run.load(), kNumTasks);
+  ASSERT_EQ(pool->GetNumTasks(), 0);
+  ASSERT_FALSE(one_failed);
+  ASSERT_FALSE(pool->OwnsThisThread());
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST(TestWorkStealingThreadPool, Submit) {
+  ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(3));
+  ASSERT_OK_AND_ASSIGN(Future<int> fut, pool->Submit(add<int>, 4, 5));
+  ASSERT_OK_AND_EQ(9, fut.result());
+  ASSERT_OK_AND_ASSIGN(fut, pool->Submit(slow_add<int>, /*seconds=*/0.01, 4, 5));
+  ASSERT_OK_AND_EQ(9, fut.result());
+}
+
+TEST(TestWorkStealingThreadPool, SpawnWithStopTokenCancelled) {
+  StopSource stop_source;
+  AddTester add_tester(100, stop_source.token());
+  ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(3));
+  add_tester.SpawnTasks(pool.get(), task_slow_add<int>{/*seconds=*/0.02});
+  stop_source.RequestStop();
+  ASSERT_OK(pool->Shutdown());
+  add_tester.CheckNotAllComputed();
+}
+
+TEST(TestWorkStealingThreadPool, Shutdown) {
+  AddTester add_tester(100);
+  {
+    ASSERT_OK_AND_ASSIGN(auto pool, WorkStealingThreadPool::Make(3));
+    add_tester.SpawnTasks(pool.get(), task_slow_add<int>{/*seconds=*/0.02});
+    ASSERT_OK(pool->Shutdown(false /* wait */));
+    add_tester.CheckNotAllComputed();
+    ASSERT_EQ(pool->GetNumTasks(), 0);
+
+    ASSERT_RAISES(Invalid, pool->Spawn([] {}));
+    ASSERT_RAISES(Invalid, pool->Shutdown());
+  }
+  add_tester.CheckNotAllComputed();
+}
+#endif
+
 TEST(TestGlobalThreadPool, Capacity) {
 #ifndef ARROW_ENABLE_THREADING
   GTEST_SKIP() << "Test requires threading support";
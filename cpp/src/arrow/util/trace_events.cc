@@ -0,0 +1,244 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/trace_events.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace arrow {
+namespace util {
+namespace tracing {
+
+namespace internal {
+
+std::atomic<uint32_t> g_trace_sampling_period{0};
+
+}  // namespace internal
+
+namespace {
+
+struct TraceEvent {
+  const char* category;
+  const char* name;
+  int64_t start_ns;
+  int64_t end_ns;
+  int64_t value;
+};
+
+// Events of a single thread.  Only the owning thread writes to the buffer; readers
+// look at the first `min(size, capacity)` events once `size` is published.
+struct ThreadTraceBuffer {
+  explicit ThreadTraceBuffer(int64_t thread_id) : thread_id(thread_id) {}
+
+  const int64_t thread_id;
+  // The trace generation the events belong to, see TraceEventRegistry
+  std::atomic<uint64_t> generation{0};
+  std::atomic<int64_t> size{0};
+  std::vector<TraceEvent> events;
+  uint32_t sampling_counter = 0;
+};
+
+int64_t SteadyNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+class TraceEventRegistry {
+ public:
+  static TraceEventRegistry* Instance() {
+    // Leaked so that threads outliving static destruction can still record events
+    static auto* registry = new TraceEventRegistry();
+    return registry;
+  }
+
+  void Start(const TraceEventOptions& options, uint32_t period) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    epoch_ns_.store(SteadyNanos(), std::memory_order_relaxed);
+    capacity_.store(options.events_per_thread, std::memory_order_relaxed);
+    generation_.fetch_add(1, std::memory_order_release);
+    internal::g_trace_sampling_period.store(period, std::memory_order_relaxed);
+  }
+
+  int64_t Now() const {
+    return SteadyNanos() - epoch_ns_.load(std::memory_order_relaxed);
+  }
+
+  ThreadTraceBuffer* CurrentThreadBuffer() {
+    thread_local std::shared_ptr<ThreadTraceBuffer> buffer = Register();
+    const uint64_t generation = generation_.load(std::memory_order_acquire);
+    if (ARROW_PREDICT_FALSE(buffer->generation.load(std::memory_order_relaxed) !=
+                            generation)) {
+      // First event of this thread since StartTraceEvents: recycle the buffer
+      buffer->size.store(0, std::memory_order_relaxed);
+      buffer->events.resize(
+          static_cast<size_t>(capacity_.load(std::memory_order_relaxed)));
+      buffer->sampling_counter = 0;
+      buffer->generation.store(generation, std::memory_order_release);
+    }
+    return buffer.get();
+  }
+
+  template <typename Visitor>
+  void VisitEvents(Visitor&& visit) {
+    std::vector<std::shared_ptr<ThreadTraceBuffer>> buffers;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      buffers = buffers_;
+    }
+    const uint64_t generation = generation_.load(std::memory_order_acquire);
+    for (const auto& buffer : buffers) {
+      if (buffer->generation.load(std::memory_order_acquire) != generation) {
+        continue;
+      }
+      const int64_t size = buffer->size.load(std::memory_order_acquire);
+      const int64_t capacity = static_cast<int64_t>(buffer->events.size());
+      // Oldest first: once the ring has wrapped around, it starts at `size`
+      for (int64_t i = std::max<int64_t>(0, size - capacity); i < size; ++i) {
+        visit(buffer->thread_id, buffer->events[i % capacity]);
+      }
+    }
+  }
+
+ private:
+  std::shared_ptr<ThreadTraceBuffer> Register() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto buffer = std::make_shared<ThreadTraceBuffer>(next_thread_id_++);
+    // Buffers of exited threads are kept so that their events can be dumped
+    buffers_.push_back(buffer);
+    return buffer;
+  }
+
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<ThreadTraceBuffer>> buffers_;
+  int64_t next_thread_id_ = 1;
+  std::atomic<uint64_t> generation_{0};
+  std::atomic<int64_t> capacity_{0};
+  std::atomic<int64_t> epoch_ns_{SteadyNanos()};
+};
+
+void WriteJsonString(const char* str, std::ostream* out) {
+  *out << '"';
+  for (const char* p = str; *p != '\0'; ++p) {
+    const char c = *p;
+    if (c == '"' || c == '\\') {
+      *out << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      *out << ' ';
+    } else {
+      *out << c;
+    }
+  }
+  *out << '"';
+}
+
+void WriteMicros(int64_t nanos, std::ostream* out) {
+  *out << nanos / 1000 << '.';
+  const int64_t fraction = nanos % 1000;
+  if (fraction < 100) *out << '0';
+  if (fraction < 10) *out << '0';
+  *out << fraction;
+}
+
+}  // namespace
+
+Status StartTraceEvents(const TraceEventOptions& options) {
+  if (!(options.sampling_rate > 0 && options.sampling_rate <= 1)) {
+    return Status::Invalid("Trace event sampling rate must be in (0, 1], got ",
+                           options.sampling_rate);
+  }
+  if (options.events_per_thread <= 0) {
+    return Status::Invalid("Trace events per thread must be positive, got ",
+                           options.events_per_thread);
+  }
+  const double period = std::round(1.0 / options.sampling_rate);
+  TraceEventRegistry::Instance()->Start(
+      options, static_cast<uint32_t>(std::min<double>(period, UINT32_MAX)));
+  return Status::OK();
+}
+
+void StopTraceEvents() {
+  internal::g_trace_sampling_period.store(0, std::memory_order_relaxed);
+}
+
+Status WriteChromeTrace(std::ostream* out) {
+  *out << "{\"traceEvents\":[";
+  bool first = true;
+  TraceEventRegistry::Instance()->VisitEvents(
+      [&](int64_t thread_id, const TraceEvent& event) {
+        if (!first) *out << ',';
+        first = false;
+        *out << "\n{\"ph\":\"X\",\"pid\":1,\"tid\":" << thread_id << ",\"cat\":";
+        WriteJsonString(event.category, out);
+        *out << ",\"name\":";
+        WriteJsonString(event.name, out);
+        *out << ",\"ts\":";
+        WriteMicros(event.start_ns, out);
+        *out << ",\"dur\":";
+        WriteMicros(std::max<int64_t>(0, event.end_ns - event.start_ns), out);
+        if (event.value >= 0) {
+          *out << ",\"args\":{\"value\":" << event.value << '}';
+        }
+        *out << '}';
+      });
+  *out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+  if (!*out) {
+    return Status::IOError("Failed to write Chrome trace");
+  }
+  return Status::OK();
+}
+
+Result<std::string> ChromeTraceToString() {
+  std::stringstream ss;
+  RETURN_NOT_OK(WriteChromeTrace(&ss));
+  return ss.str();
+}
+
+namespace internal {
+
+bool ShouldSampleTraceEvent(uint32_t period) {
+  if (period == 1) return true;
+  ThreadTraceBuffer* buffer = TraceEventRegistry::Instance()->CurrentThreadBuffer();
+  if (++buffer->sampling_counter < period) return false;
+  buffer->sampling_counter = 0;
+  return true;
+}
+
+int64_t TraceEventNow() { return TraceEventRegistry::Instance()->Now(); }
+
+void RecordTraceEvent(const char* category, const char* name, int64_t start_ns,
+                      int64_t end_ns, int64_t value) {
+  // The scope started before tracing was (re)started
+  if (start_ns < 0) return;
+  ThreadTraceBuffer* buffer = TraceEventRegistry::Instance()->CurrentThreadBuffer();
+  const int64_t size = buffer->size.load(std::memory_order_relaxed);
+  const int64_t capacity = static_cast<int64_t>(buffer->events.size());
+  buffer->events[size % capacity] = {category, name, start_ns, end_ns, value};
+  buffer->size.store(size + 1, std::memory_order_release);
+}
+
+}  // namespace internal
+
+}  // namespace tracing
+}  // namespace util
+}  // namespace arrow
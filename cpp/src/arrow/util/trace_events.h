@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+/// \file trace_events.h
+/// \brief Lightweight native tracing of timed scopes
+///
+/// Unlike the OpenTelemetry integration (see tracing_internal.h), trace events
+/// never allocate nor lock on the hot path: every thread records completed
+/// scopes into its own fixed-size ring buffer, and only the latest events are
+/// kept.  When tracing is stopped the cost of a scope is a single relaxed
+/// atomic load, so instrumentation can stay compiled in for production builds.
+///
+/// Recorded events can be dumped in the Chrome trace event format, which is
+/// understood by chrome://tracing and https://ui.perfetto.dev.
+
+namespace arrow {
+namespace util {
+namespace tracing {
+
+struct ARROW_EXPORT TraceEventOptions {
+  /// \brief Fraction of scopes to record, in (0, 1]
+  ///
+  /// Sampling is done per thread by recording every N-th scope, where N is
+  /// the rounded inverse of the rate.
+  double sampling_rate = 1.0;
+
+  /// \brief Number of events kept per thread; older events are overwritten
+  int64_t events_per_thread = 1 << 16;
+
+  static TraceEventOptions Defaults() { return TraceEventOptions{}; }
+};
+
+/// \brief Start recording trace events, discarding previously recorded ones
+ARROW_EXPORT Status StartTraceEvents(
+    const TraceEventOptions& options = TraceEventOptions::Defaults());
+
+/// \brief Stop recording trace events
+///
+/// Recorded events are kept until the next call to StartTraceEvents.
+ARROW_EXPORT void StopTraceEvents();
+
+/// \brief Write the recorded events as Chrome trace event JSON
+///
+/// Events recorded concurrently with this call may be missing or garbled;
+/// call StopTraceEvents() first for a consistent trace.
+ARROW_EXPORT Status WriteChromeTrace(std::ostream* out);
+
+/// \brief Return the recorded events as Chrome trace event JSON
+ARROW_EXPORT Result<std::string> ChromeTraceToString();
+
+namespace internal {
+
+/// \brief Every how many scopes a thread records one, or 0 if tracing is stopped
+ARROW_EXPORT extern std::atomic<uint32_t> g_trace_sampling_period;
+
+ARROW_EXPORT bool ShouldSampleTraceEvent(uint32_t period);
+ARROW_EXPORT int64_t TraceEventNow();
+ARROW_EXPORT void RecordTraceEvent(const char* category, const char* name,
+                                   int64_t start_ns, int64_t end_ns, int64_t value);
+
+}  // namespace internal
+
+/// \brief Record the duration of the enclosing scope as a trace event
+///
+/// `category` and `name` must outlive the trace, typically string literals.
+class ScopedTraceEvent {
+ public:
+  ScopedTraceEvent(const char* category, const char* name) {
+    const uint32_t period =
+        internal::g_trace_sampling_period.load(std::memory_order_relaxed);
+    if (ARROW_PREDICT_FALSE(period != 0) && internal::ShouldSampleTraceEvent(period)) {
+      category_ = category;
+      name_ = name;
+      start_ns_ = internal::TraceEventNow();
+    }
+  }
+
+  ~ScopedTraceEvent() {
+    if (ARROW_PREDICT_FALSE(name_ != NULLPTR)) {
+      internal::RecordTraceEvent(category_, name_, start_ns_, internal::TraceEventNow(),
+                                 value_);
+    }
+  }
+
+  /// \brief Attach a value (e.g. a number of rows or bytes) to the event
+  void set_value(int64_t value) { value_ = value; }
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ScopedTraceEvent);
+
+  const char* category_ = NULLPTR;
+  const char* name_ = NULLPTR;
+  int64_t start_ns_ = 0;
+  int64_t value_ = -1;
+};
+
+}  // namespace tracing
+}  // namespace util
+}  // namespace arrow
+
+#define ARROW_TRACE_EVENT_CONCAT_INNER(x, y) x##y
+#define ARROW_TRACE_EVENT_CONCAT(x, y) ARROW_TRACE_EVENT_CONCAT_INNER(x, y)
+
+/// \brief Record the duration of the enclosing scope as a trace event
+#define ARROW_TRACE_SCOPE(category, name)                            \
+  ::arrow::util::tracing::ScopedTraceEvent ARROW_TRACE_EVENT_CONCAT( \
+      arrow_trace_event_, __LINE__)(category, name)
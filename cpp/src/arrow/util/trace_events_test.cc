@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/trace_events.h"
+
+namespace arrow {
+namespace util {
+namespace tracing {
+
+namespace {
+
+int CountOccurrences(const std::string& haystack, const std::string& needle) {
+  int count = 0;
+  for (size_t pos = haystack.find(needle); pos != std::string::npos;
+       pos = haystack.find(needle, pos + needle.size())) {
+    ++count;
+  }
+  return count;
+}
+
+}  // namespace
+
+TEST(TraceEvents, Disabled) {
+  ASSERT_OK(StartTraceEvents());
+  StopTraceEvents();
+  { ARROW_TRACE_SCOPE("test", "Disabled"); }
+  ASSERT_OK_AND_ASSIGN(auto trace, ChromeTraceToString());
+  ASSERT_EQ(CountOccurrences(trace, "\"Disabled\""), 0);
+}
+
+TEST(TraceEvents, ChromeTrace) {
+  ASSERT_OK(StartTraceEvents());
+  {
+    ScopedTraceEvent event("test", "Outer");
+    event.set_value(42);
+    { ARROW_TRACE_SCOPE("test", "Inner \"quoted\""); }
+  }
+  StopTraceEvents();
+
+  ASSERT_OK_AND_ASSIGN(auto trace, ChromeTraceToString());
+  ASSERT_EQ(trace.substr(0, 16), "{\"traceEvents\":[");
+  ASSERT_EQ(CountOccurrences(trace, "\"ph\":\"X\""), 2);
+  ASSERT_EQ(CountOccurrences(trace, "\"name\":\"Outer\""), 1);
+  ASSERT_EQ(CountOccurrences(trace, "\"name\":\"Inner \\\"quoted\\\"\""), 1);
+  ASSERT_EQ(CountOccurrences(trace, "\"args\":{\"value\":42}"), 1);
+
+  // Restarting discards previous events
+  ASSERT_OK(StartTraceEvents());
+  StopTraceEvents();
+  ASSERT_OK_AND_ASSIGN(trace, ChromeTraceToString());
+  ASSERT_EQ(CountOccurrences(trace, "\"ph\":\"X\""), 0);
+}
+
+TEST(TraceEvents, RingBufferKeepsLatest) {
+  TraceEventOptions options;
+  options.events_per_thread = 4;
+  ASSERT_OK(StartTraceEvents(options));
+  for (int i = 0; i < 10; ++i) {
+    ScopedTraceEvent event("test", "Loop");
+    event.set_value(i);
+  }
+  StopTraceEvents();
+
+  ASSERT_OK_AND_ASSIGN(auto trace, ChromeTraceToString());
+  ASSERT_EQ(CountOccurrences(trace, "\"name\":\"Loop\""), 4);
+  for (int i = 6; i < 10; ++i) {
+    ASSERT_EQ(CountOccurrences(trace, "{\"value\":" + std::to_string(i) + "}"), 1);
+  }
+}
+
+TEST(TraceEvents, Sampling) {
+  TraceEventOptions options;
+  options.sampling_rate = 0.25;
+  ASSERT_OK(StartTraceEvents(options));
+  for (int i = 0; i < 100; ++i) {
+    ARROW_TRACE_SCOPE("test", "Sampled");
+  }
+  StopTraceEvents();
+
+  ASSERT_OK_AND_ASSIGN(auto trace, ChromeTraceToString());
+  ASSERT_EQ(CountOccurrences(trace, "\"name\":\"Sampled\""), 25);
+}
+
+TEST(TraceEvents, MultipleThreads) {
+  ASSERT_OK(StartTraceEvents());
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([] {
+      for (int j = 0; j < 10; ++j) {
+        ARROW_TRACE_SCOPE("test", "Threaded");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  StopTraceEvents();
+
+  // Events of exited threads are kept
+  ASSERT_OK_AND_ASSIGN(auto trace, ChromeTraceToString());
+  ASSERT_EQ(CountOccurrences(trace, "\"name\":\"Threaded\""), 40);
+}
+
+TEST(TraceEvents, InvalidOptions) {
+  TraceEventOptions options;
+  options.sampling_rate = 0;
+  ASSERT_RAISES(Invalid, StartTraceEvents(options));
+  options.sampling_rate = 1.5;
+  ASSERT_RAISES(Invalid, StartTraceEvents(options));
+  options = TraceEventOptions::Defaults();
+  options.events_per_thread = 0;
+  ASSERT_RAISES(Invalid, StartTraceEvents(options));
+}
+
+}  // namespace tracing
+}  // namespace util
+}  // namespace arrow
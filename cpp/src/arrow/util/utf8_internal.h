@@ -29,6 +29,7 @@
 #endif
 
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
@@ -81,6 +82,28 @@ static inline uint16_t ValidateOneUTF8Byte(uint8_t byte, uint16_t state) {
 
 ARROW_EXPORT void CheckUTF8Initialized();
 
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+// Return the length of the longest prefix of `data` made of whole 32-byte blocks
+// of pure ASCII
+static inline int64_t AsciiBlocksLength(const uint8_t* data, int64_t len) {
+  using simd_batch = xsimd::make_sized_batch_t<int8_t, 16>;
+
+  const simd_batch zero(static_cast<int8_t>(0));
+  int64_t ascii_length = 0;
+  while (len - ascii_length >= 32) {
+    const auto* block = reinterpret_cast<const int8_t*>(data + ascii_length);
+    const simd_batch or1 = simd_batch::load_unaligned(block) |
+                           simd_batch::load_unaligned(block + 16);
+    // To test for upper bit in all bytes, test whether any of them is negative
+    if (xsimd::any(or1 < zero)) {
+      break;
+    }
+    ascii_length += 32;
+  }
+  return ascii_length;
+}
+#endif  // ARROW_HAVE_NEON || ARROW_HAVE_SSE4_2
+
 }  // namespace internal
 
 static inline bool ValidateUTF8Inline(const uint8_t* data, int64_t size) {
@@ -102,6 +125,12 @@ static inline bool ValidateUTF8Inline(const uint8_t* data, int64_t size) {
       // 8 bytes of pure ASCII, move forward
       size -= 8;
       data += 8;
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+      // ASCII text tends to come in long runs, skip them in bulk
+      const int64_t ascii_length = internal::AsciiBlocksLength(data, size);
+      size -= ascii_length;
+      data += ascii_length;
+#endif
       continue;
     }
     // Non-ASCII run detected.
@@ -280,6 +309,22 @@ static inline bool ValidateAscii(std::string_view str) {
   return ValidateAscii(data, length);
 }
 
+/// \brief Return the number of leading ASCII bytes of `data`
+static inline int64_t AsciiPrefixLength(const uint8_t* data, int64_t len) {
+  int64_t ascii_length = 0;
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+  ascii_length = internal::AsciiBlocksLength(data, len);
+#endif
+  while (len - ascii_length >= 8 &&
+         (SafeLoadAs<uint64_t>(data + ascii_length) & 0x8080808080808080ULL) == 0) {
+    ascii_length += 8;
+  }
+  while (ascii_length < len && data[ascii_length] < 0x80U) {
+    ++ascii_length;
+  }
+  return ascii_length;
+}
+
 // size of a valid UTF8 can be determined by looking at leading 4 bits of BYTE1
 // utf8_byte_size_table[0..7] --> pure ascii chars --> 1B length
 // utf8_byte_size_table[8..11] --> internal bytes --> 1B length
@@ -557,6 +602,16 @@ static inline bool UTF8AllOf(const uint8_t* first, const uint8_t* last, bool* re
 /// Count the number of codepoints in the given string (assuming it is valid UTF8).
 static inline int64_t UTF8Length(const uint8_t* first, const uint8_t* last) {
   int64_t length = 0;
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+  using simd_batch = xsimd::make_sized_batch_t<int8_t, 16>;
+
+  // Continuation bytes are 0b10xxxxxx, i.e. at most -65 as signed bytes
+  const simd_batch max_continuation(static_cast<int8_t>(-65));
+  for (; last - first >= 16; first += 16) {
+    const auto block = simd_batch::load_unaligned(reinterpret_cast<const int8_t*>(first));
+    length += bit_util::PopCount((block > max_continuation).mask());
+  }
+#endif
   while (first != last) {
     length += ((*first++ & 0xc0) != 0x80);
   }
@@ -153,9 +153,15 @@ void ValidateWithPrefixes(ValidationFunc&& validate, const std::string& s) {
   }
 }
 
-void AssertValidUTF8(const std::string& s) { ASSERT_TRUE(IsValidUTF8(s)); }
+void AssertValidUTF8(const std::string& s) {
+  ASSERT_TRUE(IsValidUTF8(s));
+  ValidateWithPrefixes(IsValidUTF8, s);
+}
 
-void AssertInvalidUTF8(const std::string& s) { ASSERT_TRUE(IsInvalidUTF8(s)); }
+void AssertInvalidUTF8(const std::string& s) {
+  ASSERT_TRUE(IsInvalidUTF8(s));
+  ValidateWithPrefixes(IsInvalidUTF8, s);
+}
 
 void AssertValidASCII(const std::string& s) {
   ASSERT_TRUE(IsValidASCII(s));
@@ -562,5 +568,35 @@ TEST(UTF8Length, Basics) {
   ASSERT_EQ(length("\xf0\x9f\x99\x8c"), 1);
 }
 
+TEST(UTF8Length, LongStrings) {
+  auto length = [](const std::string& s) {
+    const auto* p = reinterpret_cast<const uint8_t*>(s.data());
+    return UTF8Length(p, p + s.length());
+  };
+  // Exercise SIMD optimizations
+  for (int prefix_size = 0; prefix_size < 64; ++prefix_size) {
+    std::string s(prefix_size, 'x');
+    s.append("\xc3\x81\xe3\x81\x81\xf0\x9f\x99\x8c");
+    s.append(prefix_size, 'y');
+    ASSERT_EQ(length(s), 2 * prefix_size + 3);
+  }
+}
+
+TEST(AsciiPrefixLength, Basics) {
+  auto prefix_length = [](const std::string& s) {
+    return AsciiPrefixLength(reinterpret_cast<const uint8_t*>(s.data()), s.length());
+  };
+  ASSERT_EQ(prefix_length(""), 0);
+  ASSERT_EQ(prefix_length("abc"), 3);
+  ASSERT_EQ(prefix_length("\xc3\x81"), 0);
+  for (int prefix_size = 0; prefix_size < 100; ++prefix_size) {
+    std::string s(prefix_size, 'x');
+    ASSERT_EQ(prefix_length(s), prefix_size);
+    s.append("\xc3\x81");
+    s.append(prefix_size, 'y');
+    ASSERT_EQ(prefix_length(s), prefix_size);
+  }
+}
+
 }  // namespace util
 }  // namespace arrow
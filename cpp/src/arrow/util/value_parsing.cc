@@ -19,8 +19,10 @@
 
 #include "arrow/util/value_parsing.h"
 
+#include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/util/float16.h"
 #include "arrow/vendored/fast_float/fast_float.h"
@@ -65,10 +67,139 @@ bool StringToFloat(const char* s, size_t length, char decimal_point, uint16_t* o
 
 namespace {
 
+// A strptime() format made only of the numeric fields %Y, %m, %d, %H, %M and %S (or
+// %T for "%H:%M:%S"), literal characters and whitespace.  Values having the canonical
+// field widths (4 digits for %Y, 2 for the others) are matched without calling
+// strptime(); as the C libraries all read those the same way, the outcome is also
+// strptime()'s.  Other values are left to strptime(), since e.g. glibc reads "25" for
+// %m as month 2.
+class FastStrptimeFormat {
+ public:
+  enum class Outcome { kMatch, kNoMatch, kUnknown };
+
+  static std::optional<FastStrptimeFormat> Make(const std::string& format) {
+    FastStrptimeFormat out;
+    for (size_t i = 0; i < format.size(); ++i) {
+      const char c = format[i];
+      if (IsSpace(c)) {
+        out.items_.push_back({Item::kSpace, c, 0, 0});
+      } else if (c != '%') {
+        out.items_.push_back({Item::kLiteral, c, 0, 0});
+      } else if (++i == format.size()) {
+        return std::nullopt;
+      } else {
+        switch (format[i]) {
+          case 'Y':
+            out.items_.push_back({Item::kYear, 0, 0, 9999});
+            break;
+          case 'm':
+            out.items_.push_back({Item::kMonth, 0, 1, 12});
+            break;
+          case 'd':
+            out.items_.push_back({Item::kDay, 0, 1, 31});
+            break;
+          case 'H':
+            out.items_.push_back({Item::kHour, 0, 0, 23});
+            break;
+          case 'M':
+            out.items_.push_back({Item::kMinute, 0, 0, 59});
+            break;
+          case 'S':
+            out.items_.push_back({Item::kSecond, 0, 0, 59});
+            break;
+          case 'T':
+            out.items_.push_back({Item::kHour, 0, 0, 23});
+            out.items_.push_back({Item::kLiteral, ':', 0, 0});
+            out.items_.push_back({Item::kMinute, 0, 0, 59});
+            out.items_.push_back({Item::kLiteral, ':', 0, 0});
+            out.items_.push_back({Item::kSecond, 0, 0, 59});
+            break;
+          case '%':
+            out.items_.push_back({Item::kLiteral, '%', 0, 0});
+            break;
+          default:
+            return std::nullopt;
+        }
+      }
+    }
+    return out;
+  }
+
+  Outcome Match(const char* s, size_t length, int64_t* seconds_since_epoch) const {
+    // Same defaults as a zeroed `struct tm`
+    int fields[Item::kNumFields] = {1900, 1, 1, 0, 0, 0};
+    const char* const end = s + length;
+    for (const auto& item : items_) {
+      if (item.kind == Item::kSpace) {
+        while (s < end && IsSpace(*s)) ++s;
+      } else if (item.kind == Item::kLiteral) {
+        if (s == end || *s != item.literal) return Outcome::kNoMatch;
+        ++s;
+      } else {
+        if (s == end) return Outcome::kNoMatch;
+        if (!IsDigit(*s)) {
+          // Some C libraries skip leading whitespace or accept a sign
+          return (IsSpace(*s) || *s == '+' || *s == '-') ? Outcome::kUnknown
+                                                         : Outcome::kNoMatch;
+        }
+        const int width = item.kind == Item::kYear ? 4 : 2;
+        if (end - s < width) return Outcome::kUnknown;
+        int value = 0;
+        for (int i = 0; i < width; ++i) {
+          if (!IsDigit(s[i])) return Outcome::kUnknown;
+          value = value * 10 + (s[i] - '0');
+        }
+        if (value < item.min || value > item.max) return Outcome::kUnknown;
+        fields[item.kind] = value;
+        s += width;
+      }
+    }
+    if (s != end) return Outcome::kNoMatch;
+
+    arrow_vendored::date::sys_seconds secs =
+        arrow_vendored::date::sys_days(arrow_vendored::date::year(fields[Item::kYear]) /
+                                       fields[Item::kMonth] / fields[Item::kDay]);
+    secs += std::chrono::hours(fields[Item::kHour]) +
+            std::chrono::minutes(fields[Item::kMinute]) +
+            std::chrono::seconds(fields[Item::kSecond]);
+    *seconds_since_epoch = secs.time_since_epoch().count();
+    return Outcome::kMatch;
+  }
+
+ private:
+  struct Item {
+    // The numeric fields come first, to index the parsed values
+    enum Kind {
+      kYear,
+      kMonth,
+      kDay,
+      kHour,
+      kMinute,
+      kSecond,
+      kNumFields,
+      kLiteral,
+      kSpace
+    };
+
+    Kind kind;
+    char literal;
+    int min;
+    int max;
+  };
+
+  // The "C" locale's isspace() and isdigit()
+  static bool IsSpace(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+  static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+  std::vector<Item> items_;
+};
+
 class StrptimeTimestampParser : public TimestampParser {
  public:
   explicit StrptimeTimestampParser(std::string format)
-      : format_(std::move(format)), have_zone_offset_(false) {
+      : format_(std::move(format)),
+        fast_format_(FastStrptimeFormat::Make(format_)),
+        have_zone_offset_(false) {
     // Check for use of %z
     size_t cur = 0;
     while (cur < format_.size()) {
@@ -88,6 +219,18 @@ class StrptimeTimestampParser : public TimestampParser {
     if (out_zone_offset_present) {
       *out_zone_offset_present = have_zone_offset_;
     }
+    if (fast_format_) {
+      int64_t seconds = 0;
+      switch (fast_format_->Match(s, length, &seconds)) {
+        case FastStrptimeFormat::Outcome::kMatch:
+          *out = util::CastSecondsToUnit(out_unit, seconds);
+          return true;
+        case FastStrptimeFormat::Outcome::kNoMatch:
+          return false;
+        case FastStrptimeFormat::Outcome::kUnknown:
+          break;
+      }
+    }
     return ParseTimestampStrptime(s, length, format_.c_str(),
                                   /*ignore_time_in_day=*/false,
                                   /*allow_trailing_chars=*/false, out_unit, out);
@@ -99,6 +242,7 @@ class StrptimeTimestampParser : public TimestampParser {
 
  private:
   std::string format_;
+  std::optional<FastStrptimeFormat> fast_format_;
   bool have_zone_offset_;
 };
 
@@ -32,8 +32,11 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/time.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/util/visibility.h"
 #include "arrow/vendored/datetime.h"
 #include "arrow/vendored/strptime.h"
@@ -222,6 +225,47 @@ inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0');
     result = new_result;                                                          \
   }
 
+// Parse 8 decimal digits at once using SWAR arithmetic
+inline bool ParseEightDigits(const char* s, uint32_t* out) {
+  uint64_t v = bit_util::FromLittleEndian(util::SafeLoadAs<uint64_t>(
+      reinterpret_cast<const uint8_t*>(s)));
+  // All high nibbles must be 3, and adding 6 must not carry out of any low nibble
+  if (ARROW_PREDICT_FALSE(((v & 0xF0F0F0F0F0F0F0F0ULL) |
+                           (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >>
+                            4)) != 0x3333333333333333ULL)) {
+    return false;
+  }
+  // Combine adjacent digits, then pairs of 2 digits, then pairs of 4 digits
+  v = ((v & 0x0F0F0F0F0F0F0F0FULL) * (10 * 256 + 1)) >> 8;
+  v = ((v & 0x00FF00FF00FF00FFULL) * (100 * 65536 + 1)) >> 16;
+  v = ((v & 0x0000FFFF0000FFFFULL) * (10000 * 4294967296ULL + 1)) >> 32;
+  *out = static_cast<uint32_t>(v);
+  return true;
+}
+
+// Parse between 8 and 19 decimal digits, which cannot overflow a uint64_t,
+// 8 digits at a time after the leading remainder
+inline bool ParseLongUnsigned(const char* s, size_t length, uint64_t* out) {
+  DCHECK(length >= 8 && length <= 19);
+  uint64_t result = 0;
+  for (size_t i = length % 8; i > 0; --i) {
+    const uint8_t digit = ParseDecimalDigit(*s++);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = result * 10U + digit;
+  }
+  for (length -= length % 8; length > 0; length -= 8, s += 8) {
+    uint32_t chunk;
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &chunk))) {
+      return false;
+    }
+    result = result * 100000000U + chunk;
+  }
+  *out = result;
+  return true;
+}
+
 inline bool ParseUnsigned(const char* s, size_t length, uint8_t* out) {
   uint8_t result = 0;
 
@@ -248,6 +292,14 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  if (length == 8 || length == 9) {
+    uint64_t result;
+    if (ARROW_PREDICT_FALSE(!ParseLongUnsigned(s, length, &result))) {
+      return false;
+    }
+    *out = static_cast<uint32_t>(result);
+    return true;
+  }
   uint32_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -268,6 +320,9 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  if (length >= 8 && length <= 19) {
+    return ParseLongUnsigned(s, length, out);
+  }
   uint64_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -518,21 +573,39 @@ static inline bool ParseHHMM(const char* s, Duration* out) {
   return true;
 }
 
+// Parse the three 2-digit fields of "nn?nn?nn" (such as "hh:mm:ss"), where `?` is
+// `separator`, at once using SWAR arithmetic
+static inline bool ParseTwoDigitTriple(const char* s, char separator, uint8_t* first,
+                                       uint8_t* second, uint8_t* third) {
+  constexpr uint64_t kDigits = 0xFFFF00FFFF00FFFFULL;
+  const uint64_t v = bit_util::FromLittleEndian(
+      util::SafeLoadAs<uint64_t>(reinterpret_cast<const uint8_t*>(s)));
+  const uint64_t separators = static_cast<uint64_t>(static_cast<uint8_t>(separator));
+  if (ARROW_PREDICT_FALSE((v & ~kDigits) != ((separators << 16) | (separators << 40)))) {
+    return false;
+  }
+  // Same digit check as in ParseEightDigits, restricted to the digit bytes
+  const uint64_t digits = v & kDigits;
+  if (ARROW_PREDICT_FALSE(
+          ((digits & (0xF0F0F0F0F0F0F0F0ULL & kDigits)) |
+           (((digits + (0x0606060606060606ULL & kDigits)) & 0xF0F0F0F0F0F0F0F0ULL) >>
+            4)) != (0x3333333333333333ULL & kDigits))) {
+    return false;
+  }
+  // Each byte becomes 10 times its digit plus the next one
+  const uint64_t pairs = ((digits & 0x0F0F000F0F000F0FULL) * (10 * 256 + 1)) >> 8;
+  *first = static_cast<uint8_t>(pairs);
+  *second = static_cast<uint8_t>(pairs >> 24);
+  *third = static_cast<uint8_t>(pairs >> 48);
+  return true;
+}
+
 template <typename Duration>
 static inline bool ParseHH_MM_SS(const char* s, Duration* out) {
   uint8_t hours = 0;
   uint8_t minutes = 0;
   uint8_t seconds = 0;
-  if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 3, 2, &minutes))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 6, 2, &seconds))) {
+  if (ARROW_PREDICT_FALSE(!ParseTwoDigitTriple(s, ':', &hours, &minutes, &seconds))) {
     return false;
   }
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
@@ -633,21 +706,19 @@ static inline bool ParseSubSeconds(const char* s, size_t length, TimeUnit::type
 
 template <typename Duration>
 static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
-  uint16_t year = 0;
+  uint8_t century = 0;
+  uint8_t year_of_century = 0;
   uint8_t month = 0;
   uint8_t day = 0;
-  if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
+  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &century))) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 4, &year))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 5, 2, &month))) {
-    return false;
-  }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 8, 2, &day))) {
+  // "YY-MM-DD"
+  if (ARROW_PREDICT_FALSE(
+          !detail::ParseTwoDigitTriple(s + 2, '-', &year_of_century, &month, &day))) {
     return false;
   }
+  const int year = century * 100 + year_of_century;
   arrow_vendored::date::year_month_day ymd{arrow_vendored::date::year{year},
                                            arrow_vendored::date::month{month},
                                            arrow_vendored::date::day{day}};
@@ -217,6 +217,86 @@ static void TimestampParsingStrptime(
   BenchTimestampParsing(state, UNIT, *parser);
 }
 
+// strptime() itself, which the strptime parser avoids calling for common formats
+template <TimeUnit::type UNIT>
+static void TimestampParsingLibcStrptime(
+    benchmark::State& state) {  // NOLINT non-const reference
+  using c_type = TimestampType::c_type;
+
+  auto strings = MakeTimestampStrings(1000);
+
+  for (auto _ : state) {
+    c_type total = 0;
+    for (const auto& s : strings) {
+      c_type value;
+      if (!ParseTimestampStrptime(s.data(), s.length(), "%Y-%m-%d %H:%M:%S",
+                                  /*ignore_time_in_day=*/false,
+                                  /*allow_trailing_chars=*/false, UNIT, &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total += value;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+// Several candidate parsers tried in order, as with CSV `timestamp_parsers`,
+// where only the last one matches
+static void TimestampParsingMultipleParsers(
+    benchmark::State& state) {  // NOLINT non-const reference
+  using c_type = TimestampType::c_type;
+
+  std::vector<std::shared_ptr<TimestampParser>> parsers = {
+      TimestampParser::MakeStrptime("%d/%m/%Y %H:%M:%S"),
+      TimestampParser::MakeStrptime("%m/%d/%Y"),
+      TimestampParser::MakeStrptime("%Y-%m-%d %H:%M:%S")};
+  auto strings = MakeTimestampStrings(1000);
+
+  for (auto _ : state) {
+    c_type total = 0;
+    for (const auto& s : strings) {
+      c_type value;
+      bool parsed = false;
+      for (const auto& parser : parsers) {
+        if ((*parser)(s.data(), s.length(), TimeUnit::MILLI, &value)) {
+          parsed = true;
+          break;
+        }
+      }
+      if (!parsed) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total += value;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+static void DateParsing(benchmark::State& state) {  // NOLINT non-const reference
+  auto strings = MakeTimestampStrings(1000);
+  for (auto& s : strings) {
+    s.resize(10);
+  }
+
+  for (auto _ : state) {
+    int32_t total = 0;
+    for (const auto& s : strings) {
+      int32_t value;
+      if (!ParseValue<Date32Type>(s.data(), s.length(), &value)) {
+        std::cerr << "Conversion failed for '" << s << "'";
+        std::abort();
+      }
+      total += value;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
 struct DummyAppender {
   Status operator()(std::string_view v) {
     if (pos_ >= static_cast<int32_t>(v.size())) {
@@ -286,6 +366,9 @@ BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::MILLI);
 BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::MICRO);
 BENCHMARK_TEMPLATE(TimestampParsingISO8601, TimeUnit::NANO);
 BENCHMARK_TEMPLATE(TimestampParsingStrptime, TimeUnit::MILLI);
+BENCHMARK_TEMPLATE(TimestampParsingLibcStrptime, TimeUnit::MILLI);
+BENCHMARK(TimestampParsingMultipleParsers);
+BENCHMARK(DateParsing);
 
 BENCHMARK_TEMPLATE(IntegerFormatting, Int8Type);
 BENCHMARK_TEMPLATE(IntegerFormatting, Int16Type);
@@ -416,11 +416,19 @@ TEST(StringConversion, ToInt64) {
 TEST(StringConversion, ToUInt64) {
   AssertConversion<UInt64Type>("0", 0);
   AssertConversion<UInt64Type>("18446744073709551615", 18446744073709551615ULL);
+  AssertConversion<UInt64Type>("12345678", 12345678ULL);
+  AssertConversion<UInt64Type>("1234567890123456789", 1234567890123456789ULL);
+  AssertConversion<UInt64Type>("0000000000000000042", 42ULL);
 
   // Non-representable values
   AssertConversionFails<UInt64Type>("-1");
   AssertConversionFails<UInt64Type>("18446744073709551616");
 
+  // Non-digits among long digit sequences
+  AssertConversionFails<UInt64Type>("1234567/");
+  AssertConversionFails<UInt64Type>("12345678:");
+  AssertConversionFails<UInt64Type>("123456789012345 78");
+
   AssertConversionFails<UInt64Type>("");
   AssertConversionFails<UInt64Type>("-");
   AssertConversionFails<UInt64Type>("0.0");
@@ -826,6 +834,37 @@ TEST(TimestampParser, StrptimeParser) {
   }
 }
 
+TEST(TimestampParser, StrptimeMatchesLibc) {
+  // Common formats are matched without calling strptime(), which must not change
+  // the outcome
+  std::vector<std::string> formats = {"%Y-%m-%d %H:%M:%S", "%d/%m/%Y", "%Y%m%d%H%M",
+                                      "%Y-%m-%d%%", " %H:%M", "%Y-%m-%dT%T"};
+  std::vector<std::string> values = {
+      "2018-11-13 17:11:10", "2018-11-13  17:11:10", "2018-11-13 17:11:10 ",
+      "2018-1-13 17:11:10",  "2018-11-13T17:11:10",  "2016-02-31 24:00:00",
+      "13/11/2018",          "13/11/18",             "1/2/2018",
+      "201811131711",        "2018-11-13%",          "2018-11-13",
+      "  17:11",             "17:11",                "+17:11",
+      "",                    "foo",                  "2018-25-13 17:11:10"};
+  for (const auto& format : formats) {
+    auto parser = TimestampParser::MakeStrptime(format);
+    for (const auto& value : values) {
+      ARROW_SCOPED_TRACE("format '", format, "', value '", value, "'");
+      int64_t converted = 0, expected = 0;
+      const bool parsed =
+          (*parser)(value.data(), value.size(), TimeUnit::MILLI, &converted);
+      ASSERT_EQ(ParseTimestampStrptime(value.data(), value.size(), format.c_str(),
+                                       /*ignore_time_in_day=*/false,
+                                       /*allow_trailing_chars=*/false,
+                                       TimeUnit::MILLI, &expected),
+                parsed);
+      if (parsed) {
+        ASSERT_EQ(expected, converted);
+      }
+    }
+  }
+}
+
 TEST(TimestampParser, StrptimeZoneOffset) {
   if (!kStrptimeSupportsZone) {
     GTEST_SKIP() << "strptime does not support %z on this platform";
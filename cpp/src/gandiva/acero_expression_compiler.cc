@@ -0,0 +1,205 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/acero_expression_compiler.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "gandiva/projector.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+namespace {
+
+using arrow::internal::checked_cast;
+
+// Compute functions with the same semantics as the Gandiva function of the
+// same signature
+const std::unordered_map<std::string, std::string>& FunctionNames() {
+  static const std::unordered_map<std::string, std::string> names = {
+      {"add", "add"},
+      {"subtract", "subtract"},
+      {"multiply", "multiply"},
+      {"divide", "divide"},
+      {"equal", "equal"},
+      {"not_equal", "not_equal"},
+      {"less", "less_than"},
+      {"less_equal", "less_than_or_equal_to"},
+      {"greater", "greater_than"},
+      {"greater_equal", "greater_than_or_equal_to"},
+      {"invert", "not"},
+      {"is_null", "isnull"},
+      {"is_valid", "isnotnull"},
+  };
+  return names;
+}
+
+Result<NodePtr> MakeLiteralNode(const arrow::Scalar& scalar) {
+  if (!scalar.is_valid) {
+    return TreeExprBuilder::MakeNull(scalar.type);
+  }
+  switch (scalar.type->id()) {
+#define LITERAL_CASE(TYPE_ID, SCALAR_TYPE) \
+  case arrow::Type::TYPE_ID:               \
+    return TreeExprBuilder::MakeLiteral(checked_cast<const SCALAR_TYPE&>(scalar).value);
+
+    LITERAL_CASE(BOOL, arrow::BooleanScalar)
+    LITERAL_CASE(INT8, arrow::Int8Scalar)
+    LITERAL_CASE(INT16, arrow::Int16Scalar)
+    LITERAL_CASE(INT32, arrow::Int32Scalar)
+    LITERAL_CASE(INT64, arrow::Int64Scalar)
+    LITERAL_CASE(UINT8, arrow::UInt8Scalar)
+    LITERAL_CASE(UINT16, arrow::UInt16Scalar)
+    LITERAL_CASE(UINT32, arrow::UInt32Scalar)
+    LITERAL_CASE(UINT64, arrow::UInt64Scalar)
+    LITERAL_CASE(FLOAT, arrow::FloatScalar)
+    LITERAL_CASE(DOUBLE, arrow::DoubleScalar)
+#undef LITERAL_CASE
+
+    case arrow::Type::STRING:
+      return TreeExprBuilder::MakeStringLiteral(
+          std::string(checked_cast<const arrow::StringScalar&>(scalar).view()));
+    case arrow::Type::BINARY:
+      return TreeExprBuilder::MakeBinaryLiteral(
+          std::string(checked_cast<const arrow::BinaryScalar&>(scalar).view()));
+    default:
+      return Status::NotImplemented("Literal of type ", scalar.type->ToString());
+  }
+}
+
+// Translate a bound expression to a Gandiva tree, or fail with NotImplemented
+Result<NodePtr> MakeNode(const arrow::compute::Expression& expr,
+                         const arrow::Schema& schema) {
+  if (auto parameter = expr.parameter()) {
+    if (parameter->indices.size() != 1) {
+      return Status::NotImplemented("Reference to a nested field");
+    }
+    return TreeExprBuilder::MakeField(schema.field(parameter->indices[0]));
+  }
+
+  if (auto literal = expr.literal()) {
+    if (!literal->is_scalar()) {
+      return Status::NotImplemented("Literal of kind ", literal->ToString());
+    }
+    return MakeLiteralNode(*literal->scalar());
+  }
+
+  auto call = expr.call();
+  DCHECK_NE(call, nullptr);
+  NodeVector children;
+  for (const auto& argument : call->arguments) {
+    ARROW_ASSIGN_OR_RAISE(auto child, MakeNode(argument, schema));
+    children.push_back(std::move(child));
+  }
+
+  const auto& name = call->function_name;
+  if (name == "and_kleene") {
+    return TreeExprBuilder::MakeAnd(children);
+  }
+  if (name == "or_kleene") {
+    return TreeExprBuilder::MakeOr(children);
+  }
+  // Floating point divisions by zero are errors in Gandiva
+  if (name == "divide" && !arrow::is_integer(expr.type()->id())) {
+    return Status::NotImplemented("Floating point division");
+  }
+  if (name == "is_null" && call->options &&
+      checked_cast<const arrow::compute::NullOptions&>(*call->options).nan_is_null) {
+    return Status::NotImplemented("is_null with nan_is_null");
+  }
+  auto found = FunctionNames().find(name);
+  if (found == FunctionNames().end()) {
+    return Status::NotImplemented("Function ", name);
+  }
+  return TreeExprBuilder::MakeFunction(found->second, children,
+                                       expr.type()->GetSharedPtr());
+}
+
+class GandivaCompiledExpression : public arrow::acero::CompiledExpression {
+ public:
+  GandivaCompiledExpression(SchemaPtr schema, std::shared_ptr<Projector> projector)
+      : schema_(std::move(schema)), projector_(std::move(projector)) {}
+
+  Result<arrow::Datum> Execute(const arrow::compute::ExecBatch& batch,
+                               arrow::compute::ExecContext* exec_context) const override {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch,
+                          batch.ToRecordBatch(schema_, exec_context->memory_pool()));
+    arrow::ArrayVector outputs;
+    ARROW_RETURN_NOT_OK(
+        projector_->Evaluate(*record_batch, exec_context->memory_pool(), &outputs));
+    return arrow::Datum(std::move(outputs[0]));
+  }
+
+ private:
+  SchemaPtr schema_;
+  std::shared_ptr<Projector> projector_;
+};
+
+class GandivaExpressionCompiler : public arrow::acero::ExpressionCompiler {
+ public:
+  explicit GandivaExpressionCompiler(std::shared_ptr<Configuration> configuration)
+      : configuration_(std::move(configuration)) {}
+
+  Result<std::shared_ptr<arrow::acero::CompiledExpression>> Compile(
+      const arrow::compute::Expression& expr,
+      const std::shared_ptr<arrow::Schema>& schema) override {
+    // Field references and literals are cheaper to interpret
+    if (expr.call() == nullptr) {
+      return nullptr;
+    }
+    auto maybe_node = MakeNode(expr, *schema);
+    if (!maybe_node.ok()) {
+      ARROW_LOG(DEBUG) << "Interpreting " << expr.ToString() << ": "
+                       << maybe_node.status();
+      return nullptr;
+    }
+
+    auto result = arrow::field("result", expr.type()->GetSharedPtr());
+    std::shared_ptr<Projector> projector;
+    auto status =
+        Projector::Make(schema, {TreeExprBuilder::MakeExpression(*maybe_node, result)},
+                        configuration_, &projector);
+    if (!status.ok()) {
+      // e.g. Gandiva has no function for the argument types
+      ARROW_LOG(DEBUG) << "Interpreting " << expr.ToString() << ": " << status;
+      return nullptr;
+    }
+    return std::make_shared<GandivaCompiledExpression>(schema, std::move(projector));
+  }
+
+ private:
+  std::shared_ptr<Configuration> configuration_;
+};
+
+}  // namespace
+
+std::shared_ptr<arrow::acero::ExpressionCompiler> MakeAceroExpressionCompiler(
+    std::shared_ptr<Configuration> configuration) {
+  return std::make_shared<GandivaExpressionCompiler>(std::move(configuration));
+}
+
+}  // namespace gandiva
@@ -0,0 +1,45 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/acero/expression_compiler.h"
+#include "gandiva/configuration.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Make an Acero expression compiler generating code with Gandiva.
+///
+/// Set it as arrow::acero::QueryOptions::expression_compiler for project and
+/// filter nodes to evaluate their expressions with Gandiva projectors. Only
+/// calls of the compute functions whose Gandiva counterparts have the same
+/// semantics are translated: arithmetic ("add", "subtract", "multiply", and
+/// "divide" of integers), comparisons, "and_kleene", "or_kleene", "invert",
+/// "is_null" and "is_valid", on top-level fields and literals. The other
+/// expressions are interpreted by Acero.
+///
+/// The projectors are cached by Gandiva, so nodes with the same input schema
+/// and expression share their code.
+GANDIVA_EXPORT
+std::shared_ptr<arrow::acero::ExpressionCompiler> MakeAceroExpressionCompiler(
+    std::shared_ptr<Configuration> configuration =
+        ConfigurationBuilder::DefaultConfiguration());
+
+}  // namespace gandiva
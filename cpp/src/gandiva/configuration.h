@@ -53,6 +53,7 @@ class GANDIVA_EXPORT Configuration {
   bool optimize() const { return optimize_; }
   bool target_host_cpu() const { return target_host_cpu_; }
   bool dump_ir() const { return dump_ir_; }
+  bool tiered_compilation() const { return tiered_compilation_; }
   std::shared_ptr<FunctionRegistry> function_registry() const {
     return function_registry_;
   }
@@ -60,6 +61,9 @@ class GANDIVA_EXPORT Configuration {
   void set_optimize(bool optimize) { optimize_ = optimize; }
   void set_dump_ir(bool dump_ir) { dump_ir_ = dump_ir; }
   void target_host_cpu(bool target_host_cpu) { target_host_cpu_ = target_host_cpu; }
+  void set_tiered_compilation(bool tiered_compilation) {
+    tiered_compilation_ = tiered_compilation;
+  }
   void set_function_registry(std::shared_ptr<FunctionRegistry> function_registry) {
     function_registry_ = std::move(function_registry);
   }
@@ -72,6 +76,10 @@ class GANDIVA_EXPORT Configuration {
   // flag indicating if IR dumping is needed, defaults to false, and turning it on will
   // negatively affect performance
   bool dump_ir_ = false;
+  // flag indicating if projectors and filters should start evaluating with
+  // unoptimized code while the optimized code is built in the background.
+  // Only has an effect if optimize_ is set.
+  bool tiered_compilation_ = false;
 };
 
 /// \brief configuration builder for gandiva
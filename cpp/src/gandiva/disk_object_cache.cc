@@ -0,0 +1,266 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/disk_object_cache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "arrow/util/hashing.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/value_parsing.h"
+
+namespace gandiva {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr auto kDiskCacheDirEnvVar = "GANDIVA_DISK_CACHE_DIR";
+constexpr auto kDiskCacheSizeEnvVar = "GANDIVA_DISK_CACHE_SIZE";
+
+constexpr char kMagic[8] = {'G', 'D', 'V', 'O', 'B', 'J', '0', '1'};
+constexpr auto kEntrySuffix = ".obj";
+constexpr auto kTempSuffix = ".tmp";
+// Temporary files older than this were left behind by a crashed writer
+constexpr auto kStaleTempAge = std::chrono::hours(1);
+
+void AppendUInt64(std::string* out, uint64_t value) {
+  for (int i = 0; i < 8; ++i) {
+    out->push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+  }
+}
+
+bool ReadUInt64(std::string_view* data, uint64_t* value) {
+  if (data->size() < 8) return false;
+  *value = 0;
+  for (int i = 0; i < 8; ++i) {
+    *value |= static_cast<uint64_t>(static_cast<uint8_t>((*data)[i])) << (8 * i);
+  }
+  data->remove_prefix(8);
+  return true;
+}
+
+// The file holds the magic, the key and the object code, the latter two
+// prefixed with their little-endian length
+std::string EncodeEntry(std::string_view key, std::string_view object_code) {
+  std::string entry;
+  entry.reserve(sizeof(kMagic) + 16 + key.size() + object_code.size());
+  entry.append(kMagic, sizeof(kMagic));
+  AppendUInt64(&entry, key.size());
+  entry.append(key);
+  AppendUInt64(&entry, object_code.size());
+  entry.append(object_code);
+  return entry;
+}
+
+std::optional<std::string> DecodeEntry(std::string_view entry, std::string_view key) {
+  if (entry.size() < sizeof(kMagic) ||
+      std::memcmp(entry.data(), kMagic, sizeof(kMagic)) != 0) {
+    return std::nullopt;
+  }
+  entry.remove_prefix(sizeof(kMagic));
+  uint64_t length;
+  if (!ReadUInt64(&entry, &length) || length != key.size() ||
+      entry.substr(0, key.size()) != key) {
+    return std::nullopt;
+  }
+  entry.remove_prefix(key.size());
+  if (!ReadUInt64(&entry, &length) || length != entry.size()) {
+    return std::nullopt;
+  }
+  return std::string(entry);
+}
+
+std::string TempSuffix() {
+  thread_local std::mt19937_64 rng(::arrow::internal::GetRandomSeed());
+  return "." + std::to_string(rng()) + kTempSuffix;
+}
+
+}  // namespace
+
+namespace internal {
+std::optional<DiskObjectCacheOptions> GetDiskCacheOptionsFromEnvVar() {
+  auto maybe_dir = ::arrow::internal::GetEnvVar(kDiskCacheDirEnvVar);
+  if (!maybe_dir.ok() || maybe_dir->empty()) {
+    return std::nullopt;
+  }
+  DiskObjectCacheOptions options;
+  options.directory = *std::move(maybe_dir);
+
+  auto maybe_size = ::arrow::internal::GetEnvVar(kDiskCacheSizeEnvVar);
+  if (maybe_size.ok() && !maybe_size->empty()) {
+    const auto env_value = *std::move(maybe_size);
+    int64_t capacity = 0;
+    bool ok = ::arrow::internal::ParseValue<::arrow::Int64Type>(
+        env_value.c_str(), env_value.size(), &capacity);
+    if (!ok || capacity <= 0) {
+      ARROW_LOG(WARNING) << "Invalid disk cache size provided in " << kDiskCacheSizeEnvVar
+                         << ". Using default disk cache size: " << options.capacity;
+    } else {
+      options.capacity = capacity;
+    }
+  }
+  return options;
+}
+}  // namespace internal
+
+DiskObjectCache::DiskObjectCache(DiskObjectCacheOptions options)
+    : options_(std::move(options)) {}
+
+arrow::Result<std::shared_ptr<DiskObjectCache>> DiskObjectCache::Make(
+    DiskObjectCacheOptions options) {
+  ARROW_RETURN_IF(options.directory.empty(),
+                  arrow::Status::Invalid("Disk cache directory cannot be empty"));
+  ARROW_RETURN_IF(options.capacity <= 0,
+                  arrow::Status::Invalid("Disk cache capacity must be positive"));
+  std::error_code ec;
+  fs::create_directories(options.directory, ec);
+  if (ec) {
+    return arrow::Status::IOError("Cannot create disk cache directory '",
+                                  options.directory, "': ", ec.message());
+  }
+  return std::shared_ptr<DiskObjectCache>(new DiskObjectCache(std::move(options)));
+}
+
+std::string DiskObjectCache::EntryPath(std::string_view key) const {
+  uint64_t hash = ::arrow::internal::ComputeStringHash<0>(
+      key.data(), static_cast<int64_t>(key.size()));
+  std::string name(16, '0');
+  for (int i = 15; i >= 0; --i, hash >>= 4) {
+    name[i] = "0123456789abcdef"[hash & 0xf];
+  }
+  return (fs::path(options_.directory) / (name + kEntrySuffix)).string();
+}
+
+std::optional<std::string> DiskObjectCache::Get(std::string_view key) {
+  const std::string path = EntryPath(key);
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return std::nullopt;
+  }
+  std::string entry((std::istreambuf_iterator<char>(file)),
+                    std::istreambuf_iterator<char>());
+  if (file.bad()) {
+    return std::nullopt;
+  }
+  auto object_code = DecodeEntry(entry, key);
+  if (!object_code) {
+    ARROW_LOG(DEBUG) << "Ignoring invalid gandiva disk cache entry " << path;
+    return std::nullopt;
+  }
+  // Mark the entry as recently used
+  std::error_code ec;
+  fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+  return object_code;
+}
+
+void DiskObjectCache::Put(std::string_view key, std::string_view object_code) {
+  const std::string path = EntryPath(key);
+  const std::string temp_path = path + TempSuffix();
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    const std::string entry = EncodeEntry(key, object_code);
+    file.write(entry.data(), static_cast<std::streamsize>(entry.size()));
+    file.close();
+    if (!file) {
+      ARROW_LOG(DEBUG) << "Cannot write gandiva disk cache entry " << temp_path;
+      std::error_code ec;
+      fs::remove(temp_path, ec);
+      return;
+    }
+  }
+  // Readers see either the previous entry or the complete new one
+  std::error_code ec;
+  fs::rename(temp_path, path, ec);
+  if (ec) {
+    ARROW_LOG(DEBUG) << "Cannot write gandiva disk cache entry " << path << ": "
+                     << ec.message();
+    fs::remove(temp_path, ec);
+    return;
+  }
+  Evict();
+}
+
+void DiskObjectCache::Evict() {
+  struct File {
+    fs::path path;
+    fs::file_time_type last_used;
+    uintmax_t size;
+  };
+  std::vector<File> files;
+  uintmax_t total_size = 0;
+  const auto now = fs::file_time_type::clock::now();
+
+  std::error_code ec;
+  for (fs::directory_iterator it(options_.directory, ec), end; !ec && it != end;
+       it.increment(ec)) {
+    // Other processes may delete the files we list at any time
+    std::error_code file_ec;
+    const fs::path& path = it->path();
+    const auto extension = path.extension();
+    if (extension != kEntrySuffix && extension != kTempSuffix) continue;
+    auto size = it->file_size(file_ec);
+    auto last_used = it->last_write_time(file_ec);
+    if (file_ec) continue;
+    if (extension == kTempSuffix) {
+      if (now - last_used > kStaleTempAge) fs::remove(path, file_ec);
+      continue;
+    }
+    files.push_back({path, last_used, size});
+    total_size += size;
+  }
+
+  const auto capacity = static_cast<uintmax_t>(options_.capacity);
+  if (total_size <= capacity) return;
+  std::sort(files.begin(), files.end(), [](const File& left, const File& right) {
+    return left.last_used < right.last_used;
+  });
+  for (const auto& file : files) {
+    if (total_size <= capacity) break;
+    std::error_code file_ec;
+    fs::remove(file.path, file_ec);
+    total_size -= file.size;
+  }
+}
+
+std::shared_ptr<DiskObjectCache> GetDiskObjectCache() {
+  static const std::shared_ptr<DiskObjectCache> cache =
+      []() -> std::shared_ptr<DiskObjectCache> {
+    auto options = internal::GetDiskCacheOptionsFromEnvVar();
+    if (!options) return nullptr;
+    auto maybe_cache = DiskObjectCache::Make(*std::move(options));
+    if (!maybe_cache.ok()) {
+      ARROW_LOG(WARNING) << "Disabling gandiva disk cache: " << maybe_cache.status();
+      return nullptr;
+    }
+    const auto& cache_options = (*maybe_cache)->options();
+    ARROW_LOG(INFO) << "Using gandiva disk cache in " << cache_options.directory
+                    << " with capacity of " << cache_options.capacity;
+    return *std::move(maybe_cache);
+  }();
+  return cache;
+}
+
+}  // namespace gandiva
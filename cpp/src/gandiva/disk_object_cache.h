@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "arrow/result.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+struct GANDIVA_EXPORT DiskObjectCacheOptions {
+  /// The directory holding the cached object code. It is created if needed.
+  std::string directory;
+  /// The maximum total size in bytes of the cached object code. The least
+  /// recently used entries are deleted beyond it.
+  int64_t capacity = int64_t(1) << 30;
+};
+
+namespace internal {
+/// \brief Get the options of the default disk cache from the GANDIVA_DISK_CACHE_DIR
+/// and GANDIVA_DISK_CACHE_SIZE environment variables, or nullopt if it is disabled.
+GANDIVA_EXPORT
+std::optional<DiskObjectCacheOptions> GetDiskCacheOptionsFromEnvVar();
+}  // namespace internal
+
+/// \brief A cache of compiled object code, persisted in a directory so it
+/// outlives the process.
+///
+/// Each entry is a file named after the hash of its key, which also stores
+/// the key itself so a hash collision reads as a miss. Files are written
+/// under a temporary name and renamed into place, and reading one refreshes
+/// its modification time, which orders the eviction. This makes the cache
+/// safe to share between threads and between processes; since any of them
+/// may delete an entry at any time, a failure to read or write the cache is
+/// never an error, only a miss.
+///
+/// The keys must identify everything the object code depends on, including
+/// the compiler and the target CPU.
+class GANDIVA_EXPORT DiskObjectCache {
+ public:
+  static arrow::Result<std::shared_ptr<DiskObjectCache>> Make(
+      DiskObjectCacheOptions options);
+
+  /// \brief Get the object code stored under a key, or nullopt.
+  std::optional<std::string> Get(std::string_view key);
+
+  /// \brief Store the object code of a key, then evict entries if the cache
+  /// exceeds its capacity.
+  void Put(std::string_view key, std::string_view object_code);
+
+  const DiskObjectCacheOptions& options() const { return options_; }
+
+ private:
+  explicit DiskObjectCache(DiskObjectCacheOptions options);
+
+  std::string EntryPath(std::string_view key) const;
+  void Evict();
+
+  const DiskObjectCacheOptions options_;
+};
+
+/// \brief Get the cache configured by the GANDIVA_DISK_CACHE_DIR and
+/// GANDIVA_DISK_CACHE_SIZE environment variables, or null if
+/// GANDIVA_DISK_CACHE_DIR is not set.
+GANDIVA_EXPORT
+std::shared_ptr<DiskObjectCache> GetDiskObjectCache();
+
+}  // namespace gandiva
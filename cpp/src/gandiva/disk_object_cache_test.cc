@@ -0,0 +1,161 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/disk_object_cache.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace gandiva {
+
+namespace fs = std::filesystem;
+
+class TestDiskObjectCache : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_,
+                         ::arrow::internal::TemporaryDir::Make("gandiva-disk-cache-"));
+    directory_ = temp_dir_->path().ToString();
+  }
+
+  std::shared_ptr<DiskObjectCache> MakeCache(int64_t capacity = int64_t(1) << 20) {
+    DiskObjectCacheOptions options;
+    options.directory = directory_;
+    options.capacity = capacity;
+    EXPECT_OK_AND_ASSIGN(auto cache, DiskObjectCache::Make(options));
+    return cache;
+  }
+
+  std::vector<fs::path> Files() {
+    std::vector<fs::path> files;
+    for (const auto& entry : fs::directory_iterator(directory_)) {
+      files.push_back(entry.path());
+    }
+    return files;
+  }
+
+ protected:
+  std::unique_ptr<::arrow::internal::TemporaryDir> temp_dir_;
+  std::string directory_;
+};
+
+TEST_F(TestDiskObjectCache, GetPut) {
+  auto cache = MakeCache();
+  ASSERT_EQ(cache->Get("key"), std::nullopt);
+  cache->Put("key", std::string("object\0code", 11));
+  ASSERT_EQ(cache->Get("key"), std::string("object\0code", 11));
+  ASSERT_EQ(cache->Get("other key"), std::nullopt);
+
+  // Overwrite
+  cache->Put("key", "new object code");
+  ASSERT_EQ(cache->Get("key"), "new object code");
+
+  // Entries outlive the cache instance
+  cache = MakeCache();
+  ASSERT_EQ(cache->Get("key"), "new object code");
+  ASSERT_EQ(Files().size(), 1U);
+}
+
+TEST_F(TestDiskObjectCache, IgnoresInvalidEntries) {
+  auto cache = MakeCache();
+  cache->Put("key", "object code");
+  auto files = Files();
+  ASSERT_EQ(files.size(), 1U);
+
+  // Truncated
+  fs::resize_file(files[0], fs::file_size(files[0]) - 1);
+  ASSERT_EQ(cache->Get("key"), std::nullopt);
+
+  // Garbage
+  {
+    std::ofstream file(files[0], std::ios::binary | std::ios::trunc);
+    file << "not an entry";
+  }
+  ASSERT_EQ(cache->Get("key"), std::nullopt);
+
+  // Replaced by a valid entry
+  cache->Put("key", "object code");
+  ASSERT_EQ(cache->Get("key"), "object code");
+}
+
+TEST_F(TestDiskObjectCache, EvictsLeastRecentlyUsed) {
+  const std::string object_code(1000, 'x');
+  // Room for two entries
+  auto cache = MakeCache(2500);
+
+  cache->Put("a", object_code);
+  cache->Put("b", object_code);
+  // Make "a" the most recently used
+  const auto past = fs::file_time_type::clock::now() - std::chrono::minutes(1);
+  for (const auto& file : Files()) {
+    fs::last_write_time(file, past);
+  }
+  ASSERT_EQ(cache->Get("a"), object_code);
+
+  cache->Put("c", object_code);
+  ASSERT_EQ(Files().size(), 2U);
+  ASSERT_EQ(cache->Get("a"), object_code);
+  ASSERT_EQ(cache->Get("b"), std::nullopt);
+  ASSERT_EQ(cache->Get("c"), object_code);
+}
+
+TEST_F(TestDiskObjectCache, Make) {
+  DiskObjectCacheOptions options;
+  ASSERT_RAISES(Invalid, DiskObjectCache::Make(options));
+
+  options.directory = (fs::path(directory_) / "nested" / "dir").string();
+  options.capacity = 0;
+  ASSERT_RAISES(Invalid, DiskObjectCache::Make(options));
+
+  options.capacity = 100;
+  ASSERT_OK(DiskObjectCache::Make(options));
+  ASSERT_TRUE(fs::is_directory(options.directory));
+}
+
+TEST(TestDiskObjectCacheOptions, FromEnvVar) {
+  using ::arrow::EnvVarGuard;
+  {
+    EnvVarGuard dir_guard("GANDIVA_DISK_CACHE_DIR", "");
+    ASSERT_EQ(internal::GetDiskCacheOptionsFromEnvVar(), std::nullopt);
+  }
+  {
+    EnvVarGuard dir_guard("GANDIVA_DISK_CACHE_DIR", "/some/dir");
+    EnvVarGuard size_guard("GANDIVA_DISK_CACHE_SIZE", "invalid");
+    auto options = internal::GetDiskCacheOptionsFromEnvVar();
+    ASSERT_NE(options, std::nullopt);
+    ASSERT_EQ(options->directory, "/some/dir");
+    ASSERT_EQ(options->capacity, DiskObjectCacheOptions().capacity);
+  }
+  {
+    EnvVarGuard dir_guard("GANDIVA_DISK_CACHE_DIR", "/some/dir");
+    EnvVarGuard size_guard("GANDIVA_DISK_CACHE_SIZE", "4096");
+    auto options = internal::GetDiskCacheOptionsFromEnvVar();
+    ASSERT_NE(options, std::nullopt);
+    ASSERT_EQ(options->capacity, 4096);
+  }
+}
+
+}  // namespace gandiva
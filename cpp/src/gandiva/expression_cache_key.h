@@ -19,6 +19,7 @@
 
 #include <stddef.h>
 
+#include <string>
 #include <thread>
 
 #include "arrow/util/hash_util.h"
@@ -79,6 +80,27 @@ class ExpressionCacheKey {
 
   size_t Hash() const { return hash_code_; }
 
+  /// \brief A description of the key that is the same in every process, for
+  /// persistent caches. Empty if the object code of the key cannot be shared
+  /// between processes: it may call functions of a custom registry, or embed
+  /// the address of an IN holder.
+  std::string ToPersistentString() const {
+    if (configuration_->function_registry() != default_function_registry()) {
+      return "";
+    }
+    std::string result = "mode=" + std::to_string(static_cast<int>(mode_));
+    result += ";optimize=" + std::to_string(configuration_->optimize());
+    result += ";target_host_cpu=" + std::to_string(configuration_->target_host_cpu());
+    result += "\n" + schema_->ToString(/*show_metadata=*/true);
+    for (const auto& expr : expressions_as_strings_) {
+      if (expr.find(" IN (") != std::string::npos) {
+        return "";
+      }
+      result += "\n" + expr;
+    }
+    return result;
+  }
+
   bool operator==(const ExpressionCacheKey& other) const {
     if (hash_code_ != other.hash_code_) {
       return false;
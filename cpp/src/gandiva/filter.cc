@@ -17,7 +17,9 @@
 
 #include "gandiva/filter.h"
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "gandiva/bitmap_accumulator.h"
@@ -26,11 +28,53 @@
 #include "gandiva/expr_validator.h"
 #include "gandiva/llvm_generator.h"
 #include "gandiva/selection_vector_impl.h"
+#include "gandiva/tiered_generator.h"
 
 namespace gandiva {
 
+namespace {
+
+// Build the code of the condition. If an object cache is given, its object
+// code is used if cached, or else the new object code is stored in it.
+Result<std::unique_ptr<LLVMGenerator>> BuildGenerator(
+    const SchemaPtr& schema, const ConditionPtr& condition,
+    const std::shared_ptr<Configuration>& configuration, GandivaObjectCache* obj_cache,
+    bool is_cached) {
+  std::optional<std::reference_wrapper<GandivaObjectCache>> object_cache;
+  if (obj_cache != nullptr) {
+    object_cache = *obj_cache;
+  }
+
+  // Build LLVM generator, and generate code for the specified expression
+  ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
+                        LLVMGenerator::Make(configuration, is_cached, object_cache));
+
+  if (!is_cached) {
+    // Run the validation on the expression.
+    // Return if the expression is invalid since we will not be able to process further.
+    ExprValidator expr_validator(llvm_gen->types(), schema,
+                                 configuration->function_registry());
+    ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
+  }
+
+  // Set the object cache for LLVM
+  if (obj_cache != nullptr) {
+    ARROW_RETURN_NOT_OK(llvm_gen->SetLLVMObjectCache(*obj_cache));
+  }
+
+  ARROW_RETURN_NOT_OK(llvm_gen->Build({condition}, SelectionVector::Mode::MODE_NONE));
+  return llvm_gen;
+}
+
+}  // namespace
+
 Filter::Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
                std::shared_ptr<Configuration> configuration)
+    : Filter(std::make_shared<TieredGenerator>(std::move(llvm_generator)),
+             std::move(schema), std::move(configuration)) {}
+
+Filter::Filter(std::shared_ptr<TieredGenerator> llvm_generator, SchemaPtr schema,
+               std::shared_ptr<Configuration> configuration)
     : llvm_generator_(std::move(llvm_generator)),
       schema_(schema),
       configuration_(configuration) {}
@@ -54,35 +98,42 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
 
   bool is_cached = false;
 
+  GandivaObjectCache obj_cache(cache, cache_key);
+
   std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
-  prev_cached_obj = cache->GetObjectCode(cache_key);
+  prev_cached_obj = obj_cache.GetCachedObjectCode();
 
   // Verify if previous filter obj code was cached
   if (prev_cached_obj != nullptr) {
     is_cached = true;
   }
 
-  GandivaObjectCache obj_cache(cache, cache_key);
-
-  // Build LLVM generator, and generate code for the specified expression
-  ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
-                        LLVMGenerator::Make(configuration, is_cached, obj_cache));
-
-  if (!is_cached) {
-    // Run the validation on the expression.
-    // Return if the expression is invalid since we will not be able to process further.
-    ExprValidator expr_validator(llvm_gen->types(), schema,
-                                 configuration->function_registry());
-    ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
+  std::shared_ptr<TieredGenerator> generator;
+  if (!is_cached && configuration->optimize() && configuration->tiered_compilation()) {
+    // Start with unoptimized code, which is much faster to build, and build
+    // the optimized code, which gets cached as usual, in the background.
+    auto unoptimized_configuration = std::make_shared<Configuration>(*configuration);
+    unoptimized_configuration->set_optimize(false);
+    ARROW_ASSIGN_OR_RAISE(
+        auto llvm_gen,
+        BuildGenerator(schema, condition, unoptimized_configuration, nullptr, false));
+    generator = TieredGenerator::MakeTiered(
+        std::move(llvm_gen),
+        [=]() mutable -> Result<std::unique_ptr<LLVMGenerator>> {
+          GandivaObjectCache optimized_obj_cache(cache, cache_key);
+          return BuildGenerator(schema, condition, configuration, &optimized_obj_cache,
+                                false);
+        });
+  } else {
+    ARROW_ASSIGN_OR_RAISE(
+        auto llvm_gen,
+        BuildGenerator(schema, condition, configuration, &obj_cache, is_cached));
+    generator = std::make_shared<TieredGenerator>(std::move(llvm_gen));
   }
 
-  // Set the object cache for LLVM
-  ARROW_RETURN_NOT_OK(llvm_gen->SetLLVMObjectCache(obj_cache));
-
-  ARROW_RETURN_NOT_OK(llvm_gen->Build({condition}, SelectionVector::Mode::MODE_NONE));
-
   // Instantiate the filter with the completely built llvm generator
-  *filter = std::make_shared<Filter>(std::move(llvm_gen), schema, configuration);
+  *filter =
+      std::shared_ptr<Filter>(new Filter(std::move(generator), schema, configuration));
   filter->get()->SetBuiltFromCache(is_cached);
 
   return Status::OK();
@@ -90,6 +141,18 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
 
 Status Filter::Evaluate(const arrow::RecordBatch& batch,
                         std::shared_ptr<SelectionVector> out_selection) {
+  return Evaluate(batch, std::move(out_selection), nullptr);
+}
+
+Status Filter::EvaluateParallel(const arrow::RecordBatch& batch,
+                                std::shared_ptr<SelectionVector> out_selection,
+                                const ParallelEvaluateOptions& options) {
+  return Evaluate(batch, std::move(out_selection), &options);
+}
+
+Status Filter::Evaluate(const arrow::RecordBatch& batch,
+                        std::shared_ptr<SelectionVector> out_selection,
+                        const ParallelEvaluateOptions* parallel_options) {
   const auto num_rows = batch.num_rows();
   ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
                   Status::Invalid("RecordBatch schema must expected filter schema"));
@@ -109,7 +172,16 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   auto array_data = arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value});
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, {array_data}));
+  LLVMGenerator* generator = llvm_generator_->get();
+  if (parallel_options == nullptr) {
+    ARROW_RETURN_NOT_OK(generator->Execute(batch, {array_data}));
+  } else {
+    ARROW_RETURN_NOT_OK(internal::ParallelForRowRanges(
+        num_rows, *parallel_options, [&](int64_t offset, int64_t length) {
+          auto range_data = internal::SliceOutputForRange(array_data, offset, length);
+          return generator->Execute(*batch.Slice(offset, length), {range_data});
+        }));
+  }
 
   // Compute the intersection of the value and validity.
   auto result = bitmaps.GetLocalBitMap(2);
@@ -119,7 +191,11 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   return out_selection->PopulateFromBitMap(result, bitmap_size, num_rows - 1);
 }
 
-const std::string& Filter::DumpIR() { return llvm_generator_->ir(); }
+const std::string& Filter::DumpIR() { return llvm_generator_->get()->ir(); }
+
+arrow::Future<> Filter::OptimizedCodeReady() const {
+  return llvm_generator_->optimized();
+}
 
 void Filter::SetBuiltFromCache(bool flag) { built_from_cache_ = flag; }
 
@@ -23,16 +23,19 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 
 #include "gandiva/arrow.h"
 #include "gandiva/condition.h"
 #include "gandiva/configuration.h"
+#include "gandiva/parallel_evaluate.h"
 #include "gandiva/selection_vector.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
 
 class LLVMGenerator;
+class TieredGenerator;
 
 /// \brief filter records based on a condition.
 ///
@@ -76,14 +79,40 @@ class GANDIVA_EXPORT Filter {
   Status Evaluate(const arrow::RecordBatch& batch,
                   std::shared_ptr<SelectionVector> out_selection);
 
+  /// Evaluate the specified record batch like Evaluate(), but split its rows in
+  /// ranges that are evaluated in parallel on an executor.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in,out] out_selection the selection array with indices of rows that match
+  ///                the condition.
+  /// \param[in] options the executor and the size of the ranges.
+  Status EvaluateParallel(
+      const arrow::RecordBatch& batch, std::shared_ptr<SelectionVector> out_selection,
+      const ParallelEvaluateOptions& options = ParallelEvaluateOptions::Defaults());
+
   const std::string& DumpIR();
 
+  /// \brief Get a future that finishes once the filter evaluates with optimized
+  /// code.
+  ///
+  /// With Configuration::tiered_compilation(), the filter is made with
+  /// unoptimized code and the optimized code is built in the background.
+  /// Otherwise, the future is already finished.
+  arrow::Future<> OptimizedCodeReady() const;
+
   void SetBuiltFromCache(bool flag);
 
   bool GetBuiltFromCache();
 
  private:
-  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  Filter(std::shared_ptr<TieredGenerator> llvm_generator, SchemaPtr schema,
+         std::shared_ptr<Configuration> config);
+
+  Status Evaluate(const arrow::RecordBatch& batch,
+                  std::shared_ptr<SelectionVector> out_selection,
+                  const ParallelEvaluateOptions* parallel_options);
+
+  std::shared_ptr<TieredGenerator> llvm_generator_;
   SchemaPtr schema_;
   std::shared_ptr<Configuration> configuration_;
   bool built_from_cache_;
@@ -17,16 +17,91 @@
 
 #include "gandiva/gandiva_object_cache.h"
 
+#include <algorithm>
 #include <utility>
+#include <vector>
+
+#include <llvm/Config/llvm-config.h>
+#if LLVM_VERSION_MAJOR >= 17
+#  include <llvm/TargetParser/Host.h>
+#else
+#  include <llvm/Support/Host.h>
+#endif
+
+#include "arrow/util/config.h"
 
 namespace gandiva {
 
+namespace {
+
+// Bumped when the generated code changes how it uses its arguments, e.g. the
+// layout of the buffers it writes, so that older cached entries aren't loaded
+constexpr char kCodegenVersion[] = "2";
+
+// Everything besides the expressions that the object code depends on: the
+// versions of the compiler, of the code generator and of the precompiled
+// functions, and the target
+std::string GetObjectCodeFingerprint() {
+  static const std::string fingerprint = []() {
+    std::string result = "llvm=" LLVM_VERSION_STRING ";arrow=" ARROW_VERSION_STRING;
+    result += std::string(";codegen=") + kCodegenVersion;
+    result += ";triple=" + llvm::sys::getDefaultTargetTriple();
+    result += ";cpu=" + llvm::sys::getHostCPUName().str();
+#if LLVM_VERSION_MAJOR >= 19
+    auto host_features = llvm::sys::getHostCPUFeatures();
+#else
+    llvm::StringMap<bool> host_features;
+    llvm::sys::getHostCPUFeatures(host_features);
+#endif
+    std::vector<std::string> features;
+    for (auto& f : host_features) {
+      features.push_back((f.second ? "+" : "-") + f.first().str());
+    }
+    std::sort(features.begin(), features.end());
+    result += ";features=";
+    for (const auto& feature : features) {
+      result += feature;
+    }
+    return result;
+  }();
+  return fingerprint;
+}
+
+}  // namespace
+
 GandivaObjectCache::GandivaObjectCache(
     std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>>&
         cache,
     ExpressionCacheKey key)
+    : GandivaObjectCache(cache, std::move(key), GetDiskObjectCache()) {}
+
+GandivaObjectCache::GandivaObjectCache(
+    std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>>&
+        cache,
+    ExpressionCacheKey key, std::shared_ptr<DiskObjectCache> disk_cache)
     : cache_key_(std::move(key)) {
   cache_ = cache;
+  if (disk_cache != nullptr) {
+    std::string persistent_key = cache_key_.ToPersistentString();
+    if (!persistent_key.empty()) {
+      disk_cache_ = std::move(disk_cache);
+      disk_cache_key_ = GetObjectCodeFingerprint() + "\n" + persistent_key;
+    }
+  }
+}
+
+std::shared_ptr<llvm::MemoryBuffer> GandivaObjectCache::GetCachedObjectCode() {
+  std::shared_ptr<llvm::MemoryBuffer> obj_code = cache_->GetObjectCode(cache_key_);
+  if (obj_code != nullptr || disk_cache_ == nullptr) {
+    return obj_code;
+  }
+  auto disk_obj_code = disk_cache_->Get(disk_cache_key_);
+  if (!disk_obj_code) {
+    return nullptr;
+  }
+  obj_code = llvm::MemoryBuffer::getMemBufferCopy(*disk_obj_code);
+  cache_->PutObjectCode(cache_key_, obj_code);
+  return obj_code;
 }
 
 void GandivaObjectCache::notifyObjectCompiled(const llvm::Module* M,
@@ -36,6 +111,10 @@ void GandivaObjectCache::notifyObjectCompiled(const llvm::Module* M,
   std::shared_ptr<llvm::MemoryBuffer> obj_code = std::move(obj_buffer);
 
   cache_->PutObjectCode(cache_key_, obj_code);
+  if (disk_cache_ != nullptr) {
+    const auto buffer = Obj.getBuffer();
+    disk_cache_->Put(disk_cache_key_, std::string_view(buffer.data(), buffer.size()));
+  }
 }
 
 std::unique_ptr<llvm::MemoryBuffer> GandivaObjectCache::getObject(const llvm::Module* M) {
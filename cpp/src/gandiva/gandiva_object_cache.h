@@ -26,10 +26,14 @@
 #  pragma warning(disable : 4624)
 #endif
 
+#include <memory>
+#include <string>
+
 #include <llvm/ExecutionEngine/ObjectCache.h>
 #include <llvm/Support/MemoryBuffer.h>
 
 #include "gandiva/cache.h"
+#include "gandiva/disk_object_cache.h"
 #include "gandiva/expression_cache_key.h"
 
 namespace gandiva {
@@ -41,8 +45,18 @@ class GandivaObjectCache : public llvm::ObjectCache {
           cache,
       ExpressionCacheKey key);
 
+  /// \brief Also persist the object code in a disk cache, if not null.
+  GandivaObjectCache(
+      std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>>&
+          cache,
+      ExpressionCacheKey key, std::shared_ptr<DiskObjectCache> disk_cache);
+
   ~GandivaObjectCache() {}
 
+  /// \brief Get the object code of the key from the memory cache, or else from
+  /// the disk cache, in which case it is added to the memory cache.
+  std::shared_ptr<llvm::MemoryBuffer> GetCachedObjectCode();
+
   void notifyObjectCompiled(const llvm::Module* M, llvm::MemoryBufferRef Obj);
 
   std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* M);
@@ -50,5 +64,8 @@ class GandivaObjectCache : public llvm::ObjectCache {
  private:
   ExpressionCacheKey cache_key_;
   std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>> cache_;
+  std::shared_ptr<DiskObjectCache> disk_cache_;
+  // The key in the disk cache, empty if the object code is not persisted
+  std::string disk_cache_key_;
 };
 }  // namespace gandiva
@@ -21,6 +21,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/util/bitmap_generate.h"
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/decimal_ir.h"
 #include "gandiva/dex.h"
@@ -142,6 +143,8 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                            selection_vector_mode_, " received vector with mode ", mode);
   }
 
+  // The generated code writes boolean outputs one byte per row
+  std::vector<uint8_t> bool_bytes;
   for (auto& compiled_expr : compiled_exprs_) {
     // generate data/offset vectors.
     const uint8_t* selection_buffer = nullptr;
@@ -151,17 +154,37 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
       num_output_rows = selection_vector->GetNumSlots();
     }
 
+    const int data_idx = compiled_expr->output()->data_idx();
+    uint8_t* bool_bitmap = nullptr;
+    if (compiled_expr->output()->Type()->id() == arrow::Type::BOOL) {
+      bool_bitmap = eval_batch->GetBuffer(data_idx);
+      bool_bytes.resize(num_output_rows);
+      eval_batch->SetBuffer(data_idx, bool_bytes.data(),
+                            eval_batch->GetBufferOffset(data_idx));
+    }
+
     EvalFunc jit_function = compiled_expr->GetJITFunction(mode);
     jit_function(eval_batch->GetBufferArray(), eval_batch->GetBufferOffsetArray(),
                  eval_batch->GetLocalBitMapArray(), annotator_.GetHolderPointersArray(),
                  selection_buffer, (int64_t)eval_batch->GetExecutionContext(),
                  num_output_rows);
 
+    if (bool_bitmap != nullptr) {
+      eval_batch->SetBuffer(data_idx, bool_bitmap, eval_batch->GetBufferOffset(data_idx));
+    }
+
     // check for execution errors
     ARROW_RETURN_IF(
         eval_batch->GetExecutionContext()->has_error(),
         Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
 
+    if (bool_bitmap != nullptr) {
+      // pack the bytes to bits, a word at a time.
+      const uint8_t* bool_byte = bool_bytes.data();
+      arrow::internal::GenerateBitsUnrolled(bool_bitmap, 0, num_output_rows,
+                                            [&bool_byte] { return *bool_byte++ != 0; });
+    }
+
     // generate validity vectors.
     ComputeBitMapsForExpr(*compiled_expr, selection_vector, eval_batch.get());
   }
@@ -390,7 +413,13 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
 
   auto output_type_id = output->Type()->id();
   if (output_type_id == arrow::Type::BOOL) {
-    SetPackedBitValue(output_ref, loop_var, output_value->data());
+    // One byte per row, packed to bits by Execute(). Unlike setting single bits
+    // of a shared byte, this doesn't chain the iterations, so the loop can be
+    // vectorized.
+    auto output_bytes = builder->CreateBitCast(output_ref, types()->i8_ptr_type());
+    auto slot_offset = builder->CreateGEP(types()->i8_type(), output_bytes, loop_var);
+    builder->CreateStore(builder->CreateZExt(output_value->data(), types()->i8_type()),
+                         slot_offset);
   } else if (arrow::is_primitive(output_type_id) ||
              output_type_id == arrow::Type::DECIMAL) {
     auto slot_offset =
@@ -444,17 +473,6 @@ llvm::Value* LLVMGenerator::GetPackedBitValue(llvm::Value* bitmap,
   return AddFunctionCall("bitMapGetBit", types()->i1_type(), {bitmap8, position});
 }
 
-/// Set the value of a bit in bitMap.
-void LLVMGenerator::SetPackedBitValue(llvm::Value* bitmap, llvm::Value* position,
-                                      llvm::Value* value) {
-  ADD_TRACE("set bit at position %T", position);
-  ADD_TRACE("  to value %T ", value);
-
-  llvm::Value* bitmap8 = ir_builder()->CreateBitCast(
-      bitmap, types()->ptr_type(types()->i8_type()), "bitMapCast");
-  AddFunctionCall("bitMapSetBit", types()->void_type(), {bitmap8, position, value});
-}
-
 /// Return value of a bit in validity bitMap (handles null bitmaps too).
 llvm::Value* LLVMGenerator::GetPackedValidityBitValue(llvm::Value* bitmap,
                                                       llvm::Value* position) {
@@ -218,9 +218,6 @@ class GANDIVA_EXPORT LLVMGenerator {
   /// Generate code to get the bit value at 'position' in the validity bitmap.
   llvm::Value* GetPackedValidityBitValue(llvm::Value* bitmap, llvm::Value* position);
 
-  /// Generate code to set the bit value at 'position' in the bitmap to 'value'.
-  void SetPackedBitValue(llvm::Value* bitmap, llvm::Value* position, llvm::Value* value);
-
   /// Generate code to clear the bit value at 'position' in the bitmap if 'value'
   /// is false.
   void ClearPackedBitValueIfFalse(llvm::Value* bitmap, llvm::Value* position,
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/parallel_evaluate.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+
+namespace gandiva {
+namespace internal {
+
+namespace {
+
+// Ranges start at a multiple of this many rows
+constexpr int64_t kRowAlignment = 64;
+
+}  // namespace
+
+Status ParallelForRowRanges(int64_t num_rows, const ParallelEvaluateOptions& options,
+                            const std::function<Status(int64_t, int64_t)>& func) {
+  auto executor = options.executor != nullptr ? options.executor
+                                              : ::arrow::internal::GetCpuThreadPool();
+  const int64_t min_rows = std::max<int64_t>(options.min_rows_per_task, kRowAlignment);
+  const int64_t num_ranges =
+      std::min<int64_t>(num_rows / min_rows, std::max(executor->GetCapacity(), 1));
+  if (num_ranges <= 1) {
+    return func(0, num_rows);
+  }
+
+  const int64_t rows_per_range =
+      ::arrow::bit_util::RoundUp(::arrow::bit_util::CeilDiv(num_rows, num_ranges),
+                                 kRowAlignment);
+  const auto num_tasks =
+      static_cast<int>(::arrow::bit_util::CeilDiv(num_rows, rows_per_range));
+  return ::arrow::internal::ParallelFor(
+      num_tasks,
+      [&](int i) {
+        const int64_t offset = i * rows_per_range;
+        return func(offset, std::min(rows_per_range, num_rows - offset));
+      },
+      executor);
+}
+
+bool CanSliceOutput(const arrow::ArrayData& array_data) {
+  const auto type_id = array_data.type->id();
+  return array_data.offset == 0 && array_data.buffers.size() == 2 &&
+         array_data.buffers[0] != nullptr && array_data.buffers[1] != nullptr &&
+         (arrow::is_primitive(type_id) || type_id == arrow::Type::DECIMAL);
+}
+
+ArrayDataPtr SliceOutputForRange(const ArrayDataPtr& array_data, int64_t offset,
+                                 int64_t length) {
+  DCHECK(CanSliceOutput(*array_data));
+  DCHECK_EQ(offset % 8, 0);
+  const auto bit_width =
+      static_cast<const arrow::FixedWidthType&>(*array_data->type).bit_width();
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers = {
+      arrow::SliceBuffer(array_data->buffers[0], offset / 8),
+      arrow::SliceBuffer(array_data->buffers[1], offset * bit_width / 8)};
+  return arrow::ArrayData::Make(array_data->type, length, std::move(buffers));
+}
+
+}  // namespace internal
+}  // namespace gandiva
@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
+#include "gandiva/arrow.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Options for evaluating a record batch on several threads.
+struct GANDIVA_EXPORT ParallelEvaluateOptions {
+  /// \brief The executor evaluating the row ranges, the CPU thread pool if null.
+  ///
+  /// The calling thread blocks until all ranges are evaluated, so it must not
+  /// be one of the executor's threads.
+  ::arrow::internal::Executor* executor = NULLPTR;
+  /// \brief The minimum number of rows of a range. Batches with fewer rows
+  /// than twice this are evaluated on the calling thread.
+  int64_t min_rows_per_task = 16 * 1024;
+
+  static ParallelEvaluateOptions Defaults() { return ParallelEvaluateOptions(); }
+};
+
+namespace internal {
+
+/// \brief Split the rows of a batch in ranges, and call func(offset, length)
+/// for each range, in parallel.
+///
+/// The offsets are multiples of 64, so the bitmaps of different ranges don't
+/// share any word.
+GANDIVA_EXPORT
+Status ParallelForRowRanges(int64_t num_rows, const ParallelEvaluateOptions& options,
+                            const std::function<Status(int64_t, int64_t)>& func);
+
+/// \brief Whether the rows of an output array can be written in parallel: it
+/// has a fixed-width type, a validity bitmap and no offset.
+GANDIVA_EXPORT
+bool CanSliceOutput(const arrow::ArrayData& array_data);
+
+/// \brief Get a view of the rows [offset, offset + length) of an output array
+/// for which CanSliceOutput() is true, with an offset of 0.
+///
+/// offset must be a multiple of 8.
+GANDIVA_EXPORT
+ArrayDataPtr SliceOutputForRange(const ArrayDataPtr& array_data, int64_t offset,
+                                 int64_t length);
+
+}  // namespace internal
+}  // namespace gandiva
@@ -17,7 +17,9 @@
 
 #include "gandiva/projector.h"
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -26,10 +28,51 @@
 #include "gandiva/cache.h"
 #include "gandiva/expr_validator.h"
 #include "gandiva/llvm_generator.h"
+#include "gandiva/tiered_generator.h"
 
 namespace gandiva {
 
-Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+namespace {
+
+// Build the code of the expressions. If an object cache is given, its object
+// code is used if cached, or else the new object code is stored in it.
+Result<std::unique_ptr<LLVMGenerator>> BuildGenerator(
+    const SchemaPtr& schema, const ExpressionVector& exprs,
+    SelectionVector::Mode selection_vector_mode,
+    const std::shared_ptr<Configuration>& configuration, GandivaObjectCache* obj_cache,
+    bool is_cached) {
+  std::optional<std::reference_wrapper<GandivaObjectCache>> object_cache;
+  if (obj_cache != nullptr) {
+    object_cache = *obj_cache;
+  }
+
+  // Build LLVM generator, and generate code for the specified expressions
+  ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
+                        LLVMGenerator::Make(configuration, is_cached, object_cache));
+
+  // Run the validation on the expressions.
+  // Return if any of the expression is invalid since
+  // we will not be able to process further.
+  if (!is_cached) {
+    ExprValidator expr_validator(llvm_gen->types(), schema,
+                                 configuration->function_registry());
+    for (auto& expr : exprs) {
+      ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
+    }
+  }
+
+  // Set the object cache for LLVM
+  if (obj_cache != nullptr) {
+    ARROW_RETURN_NOT_OK(llvm_gen->SetLLVMObjectCache(*obj_cache));
+  }
+
+  ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs, selection_vector_mode));
+  return llvm_gen;
+}
+
+}  // namespace
+
+Projector::Projector(std::shared_ptr<TieredGenerator> llvm_generator, SchemaPtr schema,
                      const FieldVector& output_fields,
                      std::shared_ptr<Configuration> configuration)
     : llvm_generator_(std::move(llvm_generator)),
@@ -69,36 +112,39 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 
   bool is_cached = false;
 
+  GandivaObjectCache obj_cache(cache, cache_key);
+
   std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
-  prev_cached_obj = cache->GetObjectCode(cache_key);
+  prev_cached_obj = obj_cache.GetCachedObjectCode();
 
   // Verify if previous projector obj code was cached
   if (prev_cached_obj != nullptr) {
     is_cached = true;
   }
 
-  GandivaObjectCache obj_cache(cache, cache_key);
-
-  // Build LLVM generator, and generate code for the specified expressions
-  ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
-                        LLVMGenerator::Make(configuration, is_cached, obj_cache));
-
-  // Run the validation on the expressions.
-  // Return if any of the expression is invalid since
-  // we will not be able to process further.
-  if (!is_cached) {
-    ExprValidator expr_validator(llvm_gen->types(), schema,
-                                 configuration->function_registry());
-    for (auto& expr : exprs) {
-      ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
-    }
+  std::shared_ptr<TieredGenerator> generator;
+  if (!is_cached && configuration->optimize() && configuration->tiered_compilation()) {
+    // Start with unoptimized code, which is much faster to build, and build
+    // the optimized code, which gets cached as usual, in the background.
+    auto unoptimized_configuration = std::make_shared<Configuration>(*configuration);
+    unoptimized_configuration->set_optimize(false);
+    ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
+                          BuildGenerator(schema, exprs, selection_vector_mode,
+                                         unoptimized_configuration, nullptr, false));
+    generator = TieredGenerator::MakeTiered(
+        std::move(llvm_gen),
+        [=]() mutable -> Result<std::unique_ptr<LLVMGenerator>> {
+          GandivaObjectCache optimized_obj_cache(cache, cache_key);
+          return BuildGenerator(schema, exprs, selection_vector_mode, configuration,
+                                &optimized_obj_cache, false);
+        });
+  } else {
+    ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
+                          BuildGenerator(schema, exprs, selection_vector_mode,
+                                         configuration, &obj_cache, is_cached));
+    generator = std::make_shared<TieredGenerator>(std::move(llvm_gen));
   }
 
-  // Set the object cache for LLVM
-  ARROW_RETURN_NOT_OK(llvm_gen->SetLLVMObjectCache(obj_cache));
-
-  ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs, selection_vector_mode));
-
   // save the output field types. Used for validation at Evaluate() time.
   std::vector<FieldPtr> output_fields;
   output_fields.reserve(exprs.size());
@@ -108,7 +154,7 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 
   // Instantiate the projector with the completely built llvm generator
   *projector = std::shared_ptr<Projector>(
-      new Projector(std::move(llvm_gen), schema, output_fields, configuration));
+      new Projector(std::move(generator), schema, output_fields, configuration));
   projector->get()->SetBuiltFromCache(is_cached);
 
   return Status::OK();
@@ -146,7 +192,7 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
         ValidateArrayDataCapacity(*array_data, *(output_fields_[idx]), num_rows));
     ++idx;
   }
-  return llvm_generator_->Execute(batch, selection_vector, output_data_vecs);
+  return llvm_generator_->get()->Execute(batch, selection_vector, output_data_vecs);
 }
 
 Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
@@ -174,7 +220,34 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
 
   // Execute the expression(s).
   ARROW_RETURN_NOT_OK(
-      llvm_generator_->Execute(batch, selection_vector, output_data_vecs));
+      llvm_generator_->get()->Execute(batch, selection_vector, output_data_vecs));
+
+  // Create and return array arrays.
+  output->clear();
+  for (auto& array_data : output_data_vecs) {
+    output->push_back(arrow::MakeArray(array_data));
+  }
+  return Status::OK();
+}
+
+Status Projector::EvaluateParallel(const arrow::RecordBatch& batch,
+                                   arrow::MemoryPool* pool, arrow::ArrayVector* output,
+                                   const ParallelEvaluateOptions& options) const {
+  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch));
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+
+  // Allocate the output data vecs.
+  ArrayDataVector output_data_vecs;
+  for (auto& field : output_fields_) {
+    ArrayDataPtr output_data;
+
+    ARROW_RETURN_NOT_OK(
+        AllocArrayData(field->type(), batch.num_rows(), pool, &output_data));
+    output_data_vecs.push_back(output_data);
+  }
+
+  ARROW_RETURN_NOT_OK(EvaluateParallel(batch, output_data_vecs, options));
 
   // Create and return array arrays.
   output->clear();
@@ -184,6 +257,38 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   return Status::OK();
 }
 
+Status Projector::EvaluateParallel(const arrow::RecordBatch& batch,
+                                   const ArrayDataVector& output_data_vecs,
+                                   const ParallelEvaluateOptions& options) const {
+  bool can_slice = output_data_vecs.size() == output_fields_.size();
+  for (auto& array_data : output_data_vecs) {
+    can_slice =
+        can_slice && array_data != nullptr && internal::CanSliceOutput(*array_data);
+  }
+  if (!can_slice) {
+    return Evaluate(batch, output_data_vecs);
+  }
+
+  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch));
+  for (size_t i = 0; i < output_data_vecs.size(); ++i) {
+    ARROW_RETURN_NOT_OK(ValidateArrayDataCapacity(
+        *output_data_vecs[i], *output_fields_[i], batch.num_rows()));
+  }
+
+  // All the ranges are evaluated with the same code
+  LLVMGenerator* generator = llvm_generator_->get();
+  return internal::ParallelForRowRanges(
+      batch.num_rows(), options, [&](int64_t offset, int64_t length) {
+        ArrayDataVector range_output_data_vecs;
+        range_output_data_vecs.reserve(output_data_vecs.size());
+        for (auto& array_data : output_data_vecs) {
+          range_output_data_vecs.push_back(
+              internal::SliceOutputForRange(array_data, offset, length));
+        }
+        return generator->Execute(*batch.Slice(offset, length), range_output_data_vecs);
+      });
+}
+
 // TODO : handle complex vectors (list/map/..)
 Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
                                  arrow::MemoryPool* pool,
@@ -281,7 +386,11 @@ Status Projector::ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
   return Status::OK();
 }
 
-const std::string& Projector::DumpIR() { return llvm_generator_->ir(); }
+const std::string& Projector::DumpIR() { return llvm_generator_->get()->ir(); }
+
+arrow::Future<> Projector::OptimizedCodeReady() const {
+  return llvm_generator_->optimized();
+}
 
 void Projector::SetBuiltFromCache(bool flag) { built_from_cache_ = flag; }
 
@@ -23,16 +23,19 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 
 #include "gandiva/arrow.h"
 #include "gandiva/configuration.h"
 #include "gandiva/expression.h"
+#include "gandiva/parallel_evaluate.h"
 #include "gandiva/selection_vector.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
 
 class LLVMGenerator;
+class TieredGenerator;
 
 /// \brief projection using expressions.
 ///
@@ -118,14 +121,51 @@ class GANDIVA_EXPORT Projector {
                   const SelectionVector* selection_vector,
                   const ArrayDataVector& output) const;
 
+  /// Evaluate the specified record batch like Evaluate(), but split its rows in
+  /// ranges that are evaluated in parallel on an executor, into the same output
+  /// arrays.
+  ///
+  /// Projections with variable-width outputs are evaluated on the calling thread.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate output arrays (if required).
+  /// \param[out] output the vector of allocated/populated arrays.
+  /// \param[in] options the executor and the size of the ranges.
+  Status EvaluateParallel(
+      const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+      arrow::ArrayVector* output,
+      const ParallelEvaluateOptions& options = ParallelEvaluateOptions::Defaults()) const;
+
+  /// Evaluate the specified record batch like Evaluate(), but split its rows in
+  /// ranges that are evaluated in parallel on an executor.
+  ///
+  /// The output arrays are evaluated on the calling thread unless they all have
+  /// a fixed-width type, a validity bitmap and no offset.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in,out] output vector of arrays, the arrays are allocated by the caller and
+  ///                populated by EvaluateParallel.
+  /// \param[in] options the executor and the size of the ranges.
+  Status EvaluateParallel(
+      const arrow::RecordBatch& batch, const ArrayDataVector& output,
+      const ParallelEvaluateOptions& options = ParallelEvaluateOptions::Defaults()) const;
+
   const std::string& DumpIR();
 
+  /// \brief Get a future that finishes once the projector evaluates with optimized
+  /// code.
+  ///
+  /// With Configuration::tiered_compilation(), the projector is made with
+  /// unoptimized code and the optimized code is built in the background.
+  /// Otherwise, the future is already finished.
+  arrow::Future<> OptimizedCodeReady() const;
+
   void SetBuiltFromCache(bool flag);
 
   bool GetBuiltFromCache();
 
  private:
-  Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+  Projector(std::shared_ptr<TieredGenerator> llvm_generator, SchemaPtr schema,
             const FieldVector& output_fields, std::shared_ptr<Configuration>);
 
   /// Allocate an ArrowData of length 'length'.
@@ -139,7 +179,7 @@ class GANDIVA_EXPORT Projector {
   /// Validate the common args for Evaluate() APIs.
   Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch) const;
 
-  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  std::shared_ptr<TieredGenerator> llvm_generator_;
   SchemaPtr schema_;
   FieldVector output_fields_;
   std::shared_ptr<Configuration> configuration_;
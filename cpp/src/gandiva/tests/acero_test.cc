@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/expression.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+#include "gandiva/acero_expression_compiler.h"
+
+namespace gandiva {
+
+namespace ac = arrow::acero;
+namespace cp = arrow::compute;
+
+using arrow::float64;
+using arrow::int32;
+using arrow::utf8;
+
+class TestAceroExpressionCompiler : public ::testing::Test {
+ public:
+  void SetUp() {
+    schema_ = arrow::schema({arrow::field("a", int32()), arrow::field("b", int32()),
+                             arrow::field("d", float64()), arrow::field("s", utf8())});
+    table_ = arrow::TableFromJSON(schema_, {R"([
+      [1, 10, 1.5, "x"],
+      [2, null, 0.0, "yy"],
+      [3, 30, -2.5, null]
+    ])",
+                                            R"([
+      [4, 0, 4.0, "zzz"],
+      [null, 50, 5.0, ""]
+    ])"});
+  }
+
+  std::shared_ptr<arrow::Table> Run(const cp::Expression& filter,
+                                    const std::vector<cp::Expression>& exprs,
+                                    bool compile) {
+    auto plan = ac::Declaration::Sequence({
+        {"table_source", ac::TableSourceNodeOptions{table_}},
+        {"filter", ac::FilterNodeOptions{filter}},
+        {"project", ac::ProjectNodeOptions{exprs}},
+    });
+    ac::QueryOptions query_options;
+    query_options.use_threads = false;
+    if (compile) {
+      query_options.expression_compiler = MakeAceroExpressionCompiler();
+    }
+    EXPECT_OK_AND_ASSIGN(auto table,
+                         ac::DeclarationToTable(std::move(plan), query_options));
+    return table;
+  }
+
+  cp::Expression Bind(const cp::Expression& expr) {
+    EXPECT_OK_AND_ASSIGN(auto bound, expr.Bind(*schema_));
+    return bound;
+  }
+
+ protected:
+  std::shared_ptr<arrow::Schema> schema_;
+  std::shared_ptr<arrow::Table> table_;
+};
+
+TEST_F(TestAceroExpressionCompiler, Compile) {
+  auto compiler = MakeAceroExpressionCompiler();
+
+  // Supported
+  for (const auto& expr :
+       {cp::call("add", {cp::field_ref("a"), cp::field_ref("b")}),
+        cp::call("and_kleene", {cp::greater(cp::field_ref("a"), cp::literal(1)),
+                                cp::is_valid(cp::field_ref("s"))}),
+        cp::call("divide", {cp::field_ref("a"), cp::literal(2)}),
+        cp::equal(cp::field_ref("s"), cp::literal("yy"))}) {
+    ASSERT_OK_AND_ASSIGN(auto compiled, compiler->Compile(Bind(expr), schema_));
+    ASSERT_NE(compiled, nullptr) << expr.ToString();
+  }
+
+  // Interpreted
+  for (const auto& expr :
+       {cp::field_ref("a"), cp::literal(1),
+        cp::call("divide", {cp::field_ref("d"), cp::literal(2.0)}),
+        cp::call("utf8_length", {cp::field_ref("s")}),
+        cp::call("add", {cp::field_ref("a"), cp::call("utf8_length",
+                                                      {cp::field_ref("s")})})}) {
+    ASSERT_OK_AND_ASSIGN(auto compiled, compiler->Compile(Bind(expr), schema_));
+    ASSERT_EQ(compiled, nullptr) << expr.ToString();
+  }
+}
+
+TEST_F(TestAceroExpressionCompiler, FilterAndProject) {
+  auto filter = cp::or_(cp::greater(cp::field_ref("a"), cp::literal(1)),
+                        cp::is_null(cp::field_ref("a")));
+  std::vector<cp::Expression> exprs = {
+      cp::call("add", {cp::field_ref("a"), cp::field_ref("b")}),
+      cp::call("multiply", {cp::field_ref("d"), cp::literal(2.0)}),
+      cp::less_equal(cp::field_ref("b"), cp::literal(30)),
+      // Interpreted
+      cp::call("utf8_length", {cp::field_ref("s")}),
+  };
+
+  auto expected = Run(filter, exprs, /*compile=*/false);
+  auto actual = Run(filter, exprs, /*compile=*/true);
+  ASSERT_EQ(actual->num_rows(), 4);
+  arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestAceroExpressionCompiler, ExecutionError) {
+  auto plan = ac::Declaration::Sequence({
+      {"table_source", ac::TableSourceNodeOptions{table_}},
+      {"project", ac::ProjectNodeOptions{{cp::call(
+                      "divide", {cp::field_ref("a"), cp::field_ref("b")})}}},
+  });
+  ac::QueryOptions query_options;
+  query_options.expression_compiler = MakeAceroExpressionCompiler();
+  ASSERT_RAISES(ExecutionError, ac::DeclarationToTable(std::move(plan), query_options));
+}
+
+}  // namespace gandiva
@@ -18,6 +18,8 @@
 #include "gandiva/filter.h"
 #include <gtest/gtest.h>
 #include "arrow/memory_pool.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/util/thread_pool.h"
 #include "gandiva/tests/test_util.h"
 #include "gandiva/tree_expr_builder.h"
 
@@ -201,6 +203,83 @@ TEST_F(TestFilter, TestSimpleCustomConfig) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
 }
 
+TEST_F(TestFilter, TestTieredCompilation) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // Build condition f0 > f1
+  auto condition = TreeExprBuilder::MakeCondition("greater_than", {field0, field1});
+
+  auto config = ConfigurationBuilder().build();
+  config->set_tiered_compilation(true);
+
+  std::shared_ptr<Filter> filter;
+  ASSERT_OK(Filter::Make(schema, condition, config, &filter));
+  EXPECT_FALSE(filter->GetBuiltFromCache());
+
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 20, 3, 40}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 2, 3, 17}, {true, true, false, true});
+  auto exp = MakeArrowArrayUint16({1});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  ASSERT_OK(SelectionVector::MakeInt16(num_records, pool_, &selection_vector));
+
+  // Evaluates the same before and after the optimized code is in use
+  ASSERT_OK(filter->Evaluate(*in_batch, selection_vector));
+  EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
+
+  ASSERT_FINISHES_OK(filter->OptimizedCodeReady());
+  ASSERT_OK(filter->Evaluate(*in_batch, selection_vector));
+  EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
+
+  // The optimized code was cached
+  std::shared_ptr<Filter> cached_filter;
+  ASSERT_OK(Filter::Make(schema, condition, config, &cached_filter));
+  EXPECT_TRUE(cached_filter->GetBuiltFromCache());
+}
+
+TEST_F(TestFilter, TestEvaluateParallel) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // Build condition f0 < f1
+  auto condition = TreeExprBuilder::MakeCondition("less_than", {field0, field1});
+
+  std::shared_ptr<Filter> filter;
+  ASSERT_OK(Filter::Make(schema, condition, TestConfiguration(), &filter));
+
+  // An odd number of rows, so the last range is shorter
+  int num_records = 10001;
+  std::vector<int32_t> values0(num_records), values1(num_records);
+  std::vector<bool> validity0(num_records), validity1(num_records);
+  for (int i = 0; i < num_records; ++i) {
+    values0[i] = i % 97;
+    values1[i] = i % 89;
+    validity0[i] = i % 7 != 0;
+    validity1[i] = i % 11 != 0;
+  }
+  auto in_batch = arrow::RecordBatch::Make(
+      schema, num_records,
+      {MakeArrowArrayInt32(values0, validity0), MakeArrowArrayInt32(values1, validity1)});
+
+  std::shared_ptr<SelectionVector> expected;
+  ASSERT_OK(SelectionVector::MakeInt32(num_records, pool_, &expected));
+  ASSERT_OK(filter->Evaluate(*in_batch, expected));
+
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, arrow::internal::ThreadPool::Make(4));
+  ParallelEvaluateOptions options;
+  options.executor = thread_pool.get();
+  options.min_rows_per_task = 1000;
+  std::shared_ptr<SelectionVector> selection_vector;
+  ASSERT_OK(SelectionVector::MakeInt32(num_records, pool_, &selection_vector));
+  ASSERT_OK(filter->EvaluateParallel(*in_batch, selection_vector, options));
+  EXPECT_ARROW_ARRAY_EQUALS(expected->ToArray(), selection_vector->ToArray());
+}
+
 TEST_F(TestFilter, TestZeroCopy) {
   // schema for input fields
   auto field0 = field("f0", int32());
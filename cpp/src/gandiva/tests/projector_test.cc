@@ -26,6 +26,8 @@
 #include <cmath>
 
 #include "arrow/memory_pool.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/util/thread_pool.h"
 #include "gandiva/function_registry.h"
 #include "gandiva/literal_holder.h"
 #include "gandiva/node.h"
@@ -295,6 +297,97 @@ TEST_F(TestProjector, TestIntSumSub) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
 }
 
+TEST_F(TestProjector, TestTieredCompilation) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto field_sum = field("add", int32());
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  auto configuration = ConfigurationBuilder().build();
+  configuration->set_tiered_compilation(true);
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, configuration, &projector));
+  EXPECT_FALSE(projector->GetBuiltFromCache());
+
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  auto exp_sum = MakeArrowArrayInt32({12, 15, 0, 0}, {true, true, false, false});
+  auto in_batch = arrow::RecordBatch::Make(schema, 4, {array0, array1});
+
+  // Evaluates the same before and after the optimized code is in use
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+
+  ASSERT_FINISHES_OK(projector->OptimizedCodeReady());
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+
+  // The optimized code was cached
+  std::shared_ptr<Projector> cached_projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, configuration, &cached_projector));
+  EXPECT_TRUE(cached_projector->GetBuiltFromCache());
+  EXPECT_TRUE(cached_projector->OptimizedCodeReady().is_finished());
+}
+
+TEST_F(TestProjector, TestEvaluateParallel) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1},
+                                                  field("add", int32()));
+  auto less_expr = TreeExprBuilder::MakeExpression("less_than", {field0, field1},
+                                                   field("less", boolean()));
+  auto str_node = TreeExprBuilder::MakeFunction(
+      "castVARCHAR",
+      {TreeExprBuilder::MakeField(field0), TreeExprBuilder::MakeLiteral(int64_t(10))},
+      arrow::utf8());
+  auto str_expr = TreeExprBuilder::MakeExpression(str_node, field("str", arrow::utf8()));
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr, less_expr}, TestConfiguration(),
+                            &projector));
+
+  // An odd number of rows, so the last range is shorter
+  int num_records = 10001;
+  std::vector<int32_t> values0(num_records), values1(num_records);
+  std::vector<bool> validity0(num_records), validity1(num_records);
+  for (int i = 0; i < num_records; ++i) {
+    values0[i] = i % 97;
+    values1[i] = i % 89;
+    validity0[i] = i % 7 != 0;
+    validity1[i] = i % 11 != 0;
+  }
+  auto in_batch = arrow::RecordBatch::Make(
+      schema, num_records,
+      {MakeArrowArrayInt32(values0, validity0), MakeArrowArrayInt32(values1, validity1)});
+
+  arrow::ArrayVector expected;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &expected));
+
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, arrow::internal::ThreadPool::Make(4));
+  ParallelEvaluateOptions options;
+  options.executor = thread_pool.get();
+  options.min_rows_per_task = 1000;
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->EvaluateParallel(*in_batch, pool_, &outputs, options));
+  ASSERT_EQ(outputs.size(), expected.size());
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    EXPECT_ARROW_ARRAY_EQUALS(expected[i], outputs[i]);
+  }
+
+  // Variable-width outputs are evaluated on the calling thread
+  std::shared_ptr<Projector> str_projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr, str_expr}, TestConfiguration(),
+                            &str_projector));
+  ASSERT_OK(str_projector->Evaluate(*in_batch, pool_, &expected));
+  ASSERT_OK(str_projector->EvaluateParallel(*in_batch, pool_, &outputs, options));
+  EXPECT_ARROW_ARRAY_EQUALS(expected[0], outputs[0]);
+  EXPECT_ARROW_ARRAY_EQUALS(expected[1], outputs[1]);
+}
+
 template <typename TYPE, typename C_TYPE>
 static void TestArithmeticOpsForType(arrow::MemoryPool* pool) {
   auto atype = arrow::TypeTraits<TYPE>::type_singleton();
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/tiered_generator.h"
+
+#include <utility>
+
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+#include "gandiva/llvm_generator.h"
+
+namespace gandiva {
+
+TieredGenerator::TieredGenerator(std::unique_ptr<LLVMGenerator> generator)
+    : optimized_(std::move(generator)),
+      current_(optimized_.get()),
+      optimized_future_(arrow::Future<>::MakeFinished()) {}
+
+TieredGenerator::TieredGenerator(std::unique_ptr<LLVMGenerator> unoptimized,
+                                 arrow::Future<> optimized)
+    : unoptimized_(std::move(unoptimized)),
+      current_(unoptimized_.get()),
+      optimized_future_(std::move(optimized)) {}
+
+TieredGenerator::~TieredGenerator() {}
+
+std::shared_ptr<TieredGenerator> TieredGenerator::MakeTiered(
+    std::unique_ptr<LLVMGenerator> unoptimized, BuildFunction build_optimized) {
+  auto future = arrow::Future<>::Make();
+  std::shared_ptr<TieredGenerator> generator(
+      new TieredGenerator(std::move(unoptimized), future));
+
+  std::weak_ptr<TieredGenerator> weak_generator = generator;
+  auto status = arrow::internal::GetCpuThreadPool()->Spawn(
+      [weak_generator, build_optimized = std::move(build_optimized), future]() mutable {
+        // Don't bother if the projector or filter is already gone
+        if (weak_generator.expired()) {
+          future.MarkFinished(arrow::Status::Cancelled("Generator was destroyed"));
+          return;
+        }
+        auto maybe_optimized = build_optimized();
+        if (!maybe_optimized.ok()) {
+          ARROW_LOG(WARNING) << "Failed to build optimized code, keeping the "
+                                "unoptimized code: "
+                             << maybe_optimized.status();
+          future.MarkFinished(maybe_optimized.status());
+          return;
+        }
+        if (auto generator = weak_generator.lock()) {
+          generator->Optimize(*std::move(maybe_optimized));
+        }
+        future.MarkFinished();
+      });
+  if (!status.ok()) {
+    future.MarkFinished(status);
+  }
+  return generator;
+}
+
+void TieredGenerator::Optimize(std::unique_ptr<LLVMGenerator> optimized) {
+  optimized_ = std::move(optimized);
+  current_.store(optimized_.get(), std::memory_order_release);
+}
+
+}  // namespace gandiva
@@ -0,0 +1,74 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#include "arrow/result.h"
+#include "arrow/util/future.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+class LLVMGenerator;
+
+/// \brief The generated code of a projector or a filter.
+///
+/// With tiered compilation, the code is first built without optimizations,
+/// which is much faster, and evaluation starts with it while the optimized
+/// code is built on the CPU thread pool. The optimized code replaces it as
+/// soon as it is ready, for the batches evaluated from then on.
+class GANDIVA_EXPORT TieredGenerator {
+ public:
+  using BuildFunction = std::function<arrow::Result<std::unique_ptr<LLVMGenerator>>()>;
+
+  /// \brief Use code that is already optimized.
+  explicit TieredGenerator(std::unique_ptr<LLVMGenerator> generator);
+
+  ~TieredGenerator();
+
+  /// \brief Use unoptimized code until build_optimized, run in the background,
+  /// returns the optimized code.
+  static std::shared_ptr<TieredGenerator> MakeTiered(
+      std::unique_ptr<LLVMGenerator> unoptimized, BuildFunction build_optimized);
+
+  /// \brief The generator to evaluate with.
+  LLVMGenerator* get() const { return current_.load(std::memory_order_acquire); }
+  LLVMGenerator* operator->() const { return get(); }
+
+  /// \brief A future finished once the optimized code is in use.
+  ///
+  /// If building it fails, the future fails and the unoptimized code stays
+  /// in use.
+  arrow::Future<> optimized() const { return optimized_future_; }
+
+ private:
+  TieredGenerator(std::unique_ptr<LLVMGenerator> unoptimized, arrow::Future<> optimized);
+
+  void Optimize(std::unique_ptr<LLVMGenerator> optimized);
+
+  // Kept alive since batches may still be evaluated with it
+  std::unique_ptr<LLVMGenerator> unoptimized_;
+  std::unique_ptr<LLVMGenerator> optimized_;
+  std::atomic<LLVMGenerator*> current_;
+  arrow::Future<> optimized_future_;
+};
+
+}  // namespace gandiva
@@ -28,6 +28,7 @@
 #include <functional>
 #include <set>
 #include <sstream>
+#include <unordered_set>
 #include <vector>
 
 #include "arrow/array/builder_binary.h"
@@ -43,6 +44,7 @@
 #include "arrow/scalar.h"
 #include "arrow/table.h"
 #include "arrow/testing/builder.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
@@ -54,6 +56,7 @@
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 
 #ifdef ARROW_CSV
 #  include "arrow/csv/api.h"
@@ -4831,6 +4834,74 @@ INSTANTIATE_TEST_SUITE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+TEST(TestArrowReadDictionary, FixedWidthTypes) {
+  auto schema = ::arrow::schema({
+      ::arrow::field("i8", ::arrow::int8()),
+      ::arrow::field("u32", ::arrow::uint32()),
+      ::arrow::field("i64", ::arrow::int64()),
+      ::arrow::field("f64", ::arrow::float64()),
+      ::arrow::field("date", ::arrow::date32()),
+      ::arrow::field("ts", ::arrow::timestamp(::arrow::TimeUnit::MILLI)),
+      ::arrow::field("fsb", ::arrow::fixed_size_binary(3)),
+      ::arrow::field("dec_int", ::arrow::decimal128(5, 2)),
+      ::arrow::field("dec_flba", ::arrow::decimal128(20, 2)),
+  });
+  auto check_roundtrip = [&](const std::string& json, int64_t row_group_size,
+                             int expected_num_chunks) {
+    auto table = ::arrow::TableFromJSON(schema, {json});
+    auto sink = CreateOutputStream();
+    // Store "dec_int" as INT32, "dec_flba" does not fit in an INT64
+    auto writer_properties =
+        WriterProperties::Builder().enable_store_decimal_as_integer()->build();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  row_group_size, writer_properties));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      properties.set_read_dictionary(i, true);
+    }
+    FileReaderBuilder builder;
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(properties)->Build(&reader));
+    std::shared_ptr<Table> actual;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+
+    ASSERT_EQ(schema->num_fields(), actual->num_columns());
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      ARROW_SCOPED_TRACE("field = ", schema->field(i)->ToString());
+      const auto& type = actual->schema()->field(i)->type();
+      ASSERT_EQ(::arrow::Type::DICTIONARY, type->id());
+      AssertTypeEqual(*schema->field(i)->type(),
+                      *checked_cast<const ::arrow::DictionaryType&>(*type).value_type());
+      ASSERT_EQ(expected_num_chunks, actual->column(i)->num_chunks());
+      ASSERT_OK_AND_ASSIGN(Datum dense, ::arrow::compute::Cast(actual->column(i),
+                                                               schema->field(i)->type()));
+      AssertChunkedEqual(*table->column(i), *dense.chunked_array());
+    }
+  };
+
+  // Every row group has the same dictionary, which is only inserted once
+  check_roundtrip(R"([
+      [1, 7, 100, 1.5, 10, 1000, "abc", "1.23", "100000000000000000.01"],
+      [null, null, null, null, null, null, null, null, null],
+      [-2, 4000000000, -100, -0.5, 20, 2000, "def", "-4.56", "-0.01"],
+      [1, 7, 100, 1.5, 10, 1000, "abc", "1.23", "100000000000000000.01"],
+      [null, null, null, null, null, null, null, null, null],
+      [-2, 4000000000, -100, -0.5, 20, 2000, "def", "-4.56", "-0.01"]
+    ])",
+                  /*row_group_size=*/3, /*expected_num_chunks=*/1);
+  // A different dictionary starts a new chunk
+  check_roundtrip(R"([
+      [1, 7, 100, 1.5, 10, 1000, "abc", "1.23", "100000000000000000.01"],
+      [-2, 4000000000, -100, -0.5, 20, 2000, "def", "-4.56", "-0.01"],
+      [-2, 4000000000, -100, -0.5, 20, 2000, "def", "-4.56", "-0.01"],
+      [1, 7, 100, 1.5, 10, 1000, "abc", "1.23", "100000000000000000.01"]
+    ])",
+                  /*row_group_size=*/2, /*expected_num_chunks=*/2);
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
@@ -5543,6 +5614,267 @@ TEST(TestArrowReadWrite, MultithreadedWrite) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWriteTable) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  // Row groups of WriteTable are encoded in parallel, then written in column order
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder()
+                         .write_batch_size(100)
+                         ->build();
+  auto pool = ::arrow::default_memory_pool();
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  PARQUET_ASSIGN_OR_THROW(
+      auto writer, FileWriter::Open(*table->schema(), pool, sink, std::move(write_props),
+                                    std::move(arrow_properties)));
+  ASSERT_OK_NO_THROW(writer->WriteTable(*table, /*chunk_size=*/300));
+  // Record batches are not appended to the last row group of the table
+  PARQUET_ASSIGN_OR_THROW(auto batch, table->Slice(0, 100)->CombineChunksToBatch(pool));
+  ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+  ASSERT_OK_NO_THROW(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       OpenFile(std::make_shared<BufferReader>(buffer), pool));
+  ASSERT_EQ(5, reader->num_row_groups());
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(std::min(300, num_rows - 300 * i),
+              reader->parquet_reader()->metadata()->RowGroup(i)->num_rows());
+  }
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       ::arrow::ConcatenateTables({table, table->Slice(0, 100)}));
+  ASSERT_NO_FATAL_FAILURE(
+      ::arrow::AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false));
+}
+
+TEST(TestArrowReadWrite, PrefetchPages) {
+  const int num_columns = 5;
+  const int num_rows = 1000;
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder()
+                         .data_pagesize(100) /* write multiple pages */
+                         ->write_batch_size(10)
+                         ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                /*chunk_size=*/400, write_props));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  for (int32_t depth : {1, 3, 1000}) {
+    ARROW_SCOPED_TRACE("page_prefetch_depth = ", depth);
+    ReaderProperties reader_props;
+    reader_props.set_page_prefetch_depth(depth);
+    FileReaderBuilder builder;
+    ASSERT_OK_NO_THROW(
+        builder.Open(std::make_shared<BufferReader>(buffer), reader_props));
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(builder.Build(&reader));
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(
+        ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false));
+  }
+
+  // Reading from the only IO thread must not wait for pages read on the IO pool
+  const int io_capacity = ::arrow::io::GetIOThreadPoolCapacity();
+  ASSERT_OK(::arrow::io::SetIOThreadPoolCapacity(1));
+  ReaderProperties reader_props;
+  reader_props.set_page_prefetch_depth(3);
+  auto read_on_io_thread = [&]() -> ::arrow::Result<std::shared_ptr<Table>> {
+    FileReaderBuilder builder;
+    RETURN_NOT_OK(builder.Open(std::make_shared<BufferReader>(buffer), reader_props));
+    std::unique_ptr<FileReader> reader;
+    RETURN_NOT_OK(builder.Build(&reader));
+    std::shared_ptr<Table> result;
+    RETURN_NOT_OK(reader->ReadTable(&result));
+    return result;
+  };
+  auto result_fut =
+      ::arrow::DeferNotOk(::arrow::io::default_io_context().executor()->Submit(
+          std::move(read_on_io_thread)));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto result, result_fut);
+  ASSERT_OK(::arrow::io::SetIOThreadPoolCapacity(io_capacity));
+  ASSERT_NO_FATAL_FAILURE(
+      ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false));
+}
+
+TEST(TestArrowReadWrite, ReadBinaryView) {
+  // Short values are inlined in views, long values reference the pages or are copied
+  ::arrow::StringBuilder string_builder;
+  ::arrow::StringViewBuilder string_view_builder;
+  ::arrow::BinaryBuilder binary_builder;
+  ::arrow::BinaryViewBuilder binary_view_builder;
+  for (int i = 0; i < 2000; ++i) {
+    if (i % 7 == 0) {
+      ASSERT_OK(string_builder.AppendNull());
+      ASSERT_OK(string_view_builder.AppendNull());
+    } else {
+      const std::string value = std::string(i % 31, 'a') + std::to_string(i % 50);
+      ASSERT_OK(string_builder.Append(value));
+      ASSERT_OK(string_view_builder.Append(value));
+    }
+    const std::string value = "binary value " + std::to_string(i);
+    ASSERT_OK(binary_builder.Append(value));
+    ASSERT_OK(binary_view_builder.Append(value));
+  }
+  ASSERT_OK_AND_ASSIGN(auto string_array, string_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto string_view_array, string_view_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto binary_array, binary_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto binary_view_array, binary_view_builder.Finish());
+  auto table = Table::Make(::arrow::schema({::arrow::field("s", ::arrow::utf8()),
+                                            ::arrow::field("b", ::arrow::binary(),
+                                                           /*nullable=*/false)}),
+                           {string_array, binary_array});
+  auto expected =
+      Table::Make(::arrow::schema({::arrow::field("s", ::arrow::utf8_view()),
+                                   ::arrow::field("b", ::arrow::binary_view(),
+                                                  /*nullable=*/false)}),
+                  {string_view_array, binary_view_array});
+
+  for (auto encoding : {Encoding::RLE_DICTIONARY, Encoding::PLAIN,
+                        Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    ARROW_SCOPED_TRACE("encoding = ", EncodingToString(encoding));
+    WriterProperties::Builder write_props_builder;
+    write_props_builder.data_pagesize(1000)->write_batch_size(100);
+    if (encoding == Encoding::RLE_DICTIONARY) {
+      write_props_builder.enable_dictionary();
+    } else {
+      write_props_builder.disable_dictionary()->encoding(encoding);
+    }
+    auto sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  /*chunk_size=*/800, write_props_builder.build()));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    for (bool buffered_stream : {false, true}) {
+      ARROW_SCOPED_TRACE("buffered_stream = ", buffered_stream);
+      ReaderProperties reader_props;
+      if (buffered_stream) {
+        reader_props.enable_buffered_stream();
+      }
+      ArrowReaderProperties arrow_reader_props;
+      arrow_reader_props.set_binary_type(::arrow::Type::BINARY_VIEW);
+      arrow_reader_props.set_batch_size(300);
+      FileReaderBuilder builder;
+      ASSERT_OK_NO_THROW(
+          builder.Open(std::make_shared<BufferReader>(buffer), reader_props));
+      std::unique_ptr<FileReader> reader;
+      ASSERT_OK_NO_THROW(builder.properties(arrow_reader_props)->Build(&reader));
+
+      std::shared_ptr<Table> result;
+      ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+      ASSERT_OK(result->ValidateFull());
+      ASSERT_NO_FATAL_FAILURE(
+          ::arrow::AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false));
+
+      ASSERT_OK_AND_ASSIGN(auto batch_reader, reader->GetRecordBatchReader());
+      ASSERT_OK_AND_ASSIGN(result, batch_reader->ToTable());
+      ASSERT_OK(result->ValidateFull());
+      ASSERT_NO_FATAL_FAILURE(
+          ::arrow::AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false));
+    }
+  }
+}
+
+TEST(TestArrowReadWrite, ReadBinaryViewWithStoredSchema) {
+  // The stored Arrow schema takes precedence over the binary type
+  auto table = ::arrow::TableFromJSON(
+      ::arrow::schema({::arrow::field("s", ::arrow::utf8())}),
+      {R"([["short"], [null], ["a value longer than twelve bytes"]])"});
+  auto sink = CreateOutputStream();
+  auto arrow_writer_props = ArrowWriterProperties::Builder().store_schema()->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                /*chunk_size=*/10, default_writer_properties(),
+                                arrow_writer_props));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  ArrowReaderProperties arrow_reader_props;
+  arrow_reader_props.set_binary_type(::arrow::Type::BINARY_VIEW);
+  FileReaderBuilder builder;
+  ASSERT_OK_NO_THROW(builder.Open(std::make_shared<BufferReader>(buffer)));
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(builder.properties(arrow_reader_props)->Build(&reader));
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
+}
+
+TEST(TestArrowReadWrite, ContentDefinedChunking) {
+  auto gen = ::arrow::random::RandomArrayGenerator(/*seed=*/42);
+  auto list_type = ::arrow::list(::arrow::int32());
+  auto schema = ::arrow::schema({::arrow::field("i64", ::arrow::int64()),
+                                 ::arrow::field("str", ::arrow::utf8()),
+                                 ::arrow::field("list", list_type)});
+  auto make_table = [&](int64_t num_rows) {
+    return Table::Make(schema, {gen.Int64(num_rows, 0, 1000000, 0.1),
+                                gen.String(num_rows, 0, 20, 0.1),
+                                gen.ArrayOf(list_type, num_rows, 0.1)});
+  };
+  std::shared_ptr<Table> table = make_table(20000);
+  // The same rows after a few new ones
+  ASSERT_OK_AND_ASSIGN(auto modified,
+                       ::arrow::ConcatenateTables({make_table(10), table}));
+
+  CdcOptions options;
+  options.min_chunk_size = 4 * 1024;
+  options.max_chunk_size = 16 * 1024;
+  auto write_props = WriterProperties::Builder()
+                         .disable_dictionary()
+                         ->enable_content_defined_chunking()
+                         ->content_defined_chunking_options(options)
+                         ->build();
+  auto write = [&](const Table& input) {
+    auto sink = CreateOutputStream();
+    PARQUET_THROW_NOT_OK(WriteTable(input, ::arrow::default_memory_pool(), sink,
+                                    /*chunk_size=*/input.num_rows(), write_props));
+    PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+    return buffer;
+  };
+  // Return the contents of the data pages of each column
+  auto read_pages = [&](const std::shared_ptr<Buffer>& buffer) {
+    auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+    std::vector<std::vector<std::string>> pages(reader->metadata()->num_columns());
+    for (int i = 0; i < reader->metadata()->num_columns(); ++i) {
+      auto page_reader = reader->RowGroup(0)->GetColumnPageReader(i);
+      while (auto page = page_reader->NextPage()) {
+        pages[i].push_back(page->buffer()->ToString());
+      }
+    }
+    return pages;
+  };
+
+  std::shared_ptr<Buffer> buffer = write(*table);
+  std::shared_ptr<Table> result;
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(
+      ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false));
+
+  // Only the first pages of each column differ
+  auto original_pages = read_pages(buffer);
+  auto modified_pages = read_pages(write(*modified));
+  for (size_t i = 0; i < original_pages.size(); ++i) {
+    ARROW_SCOPED_TRACE("column = ", i);
+    ASSERT_GT(original_pages[i].size(), 10);
+    std::unordered_set<std::string> modified_set(modified_pages[i].begin(),
+                                                 modified_pages[i].end());
+    size_t num_shared = 0;
+    for (const auto& page : original_pages[i]) {
+      num_shared += modified_set.count(page);
+    }
+    ASSERT_GE(num_shared, original_pages[i].size() - 3);
+  }
+}
+
 TEST(TestArrowReadWrite, FuzzReader) {
   constexpr size_t kMaxFileSize = 1024 * 1024 * 1;
   auto check_bad_file = [&](const std::string& file_name) {
@@ -5786,6 +6118,60 @@ TEST_F(ParquetPageIndexRoundTripTest, SimpleRoundTrip) {
                             /*null_counts=*/{1}}));
 }
 
+TEST_F(ParquetPageIndexRoundTripTest, WritePerRowGroup) {
+  auto writer_properties = WriterProperties::Builder()
+                               .enable_write_page_index()
+                               ->enable_write_page_index_per_row_group()
+                               ->max_row_group_length(2)
+                               ->build();
+  auto schema = ::arrow::schema({::arrow::field("c0", ::arrow::int64()),
+                                 ::arrow::field("c1", ::arrow::utf8())});
+  WriteFile(writer_properties, ::arrow::TableFromJSON(schema, {R"([
+      [1,     "a"],
+      [2,     "b"],
+      [null,  "c"],
+      [4,     null],
+      [5,     "e"]
+    ])"}));
+
+  ReadPageIndexes(/*expect_num_row_groups=*/3, /*expect_num_pages=*/1);
+
+  EXPECT_THAT(
+      column_indexes_,
+      ::testing::ElementsAre(
+          ColumnIndexObject{/*null_pages=*/{false}, /*min_values=*/{encode_int64(1)},
+                            /*max_values=*/{encode_int64(2)}, BoundaryOrder::Ascending,
+                            /*null_counts=*/{0}},
+          ColumnIndexObject{/*null_pages=*/{false}, /*min_values=*/{"a"},
+                            /*max_values=*/{"b"}, BoundaryOrder::Ascending,
+                            /*null_counts=*/{0}},
+          ColumnIndexObject{/*null_pages=*/{false}, /*min_values=*/{encode_int64(4)},
+                            /*max_values=*/{encode_int64(4)}, BoundaryOrder::Ascending,
+                            /*null_counts=*/{1}},
+          ColumnIndexObject{/*null_pages=*/{false}, /*min_values=*/{"c"},
+                            /*max_values=*/{"c"}, BoundaryOrder::Ascending,
+                            /*null_counts=*/{1}},
+          ColumnIndexObject{/*null_pages=*/{false}, /*min_values=*/{encode_int64(5)},
+                            /*max_values=*/{encode_int64(5)}, BoundaryOrder::Ascending,
+                            /*null_counts=*/{0}},
+          ColumnIndexObject{/*null_pages=*/{false}, /*min_values=*/{"e"},
+                            /*max_values=*/{"e"}, BoundaryOrder::Ascending,
+                            /*null_counts=*/{0}}));
+
+  // The page index of every row group is written before the next row group.
+  auto metadata = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer_))
+                      ->metadata();
+  for (int rg = 0; rg + 1 < metadata->num_row_groups(); ++rg) {
+    const int64_t next_row_group_offset =
+        metadata->RowGroup(rg + 1)->ColumnChunk(0)->data_page_offset();
+    for (int col = 0; col < metadata->num_columns(); ++col) {
+      auto column_chunk = metadata->RowGroup(rg)->ColumnChunk(col);
+      ASSERT_LT(column_chunk->GetColumnIndexLocation()->offset, next_row_group_offset);
+      ASSERT_LT(column_chunk->GetOffsetIndexLocation()->offset, next_row_group_offset);
+    }
+  }
+}
+
 TEST_F(ParquetPageIndexRoundTripTest, SimpleRoundTripWithStatsDisabled) {
   auto writer_properties = WriterProperties::Builder()
                                .enable_write_page_index()
@@ -5976,5 +6362,106 @@ TEST_F(ParquetPageIndexRoundTripTest, EnablePerColumn) {
                             /*null_counts=*/{0}}));
 }
 
+TEST_F(ParquetPageIndexRoundTripTest, ReadRowRanges) {
+  auto schema = ::arrow::schema(
+      {::arrow::field("c0", ::arrow::int64()), ::arrow::field("c1", ::arrow::utf8())});
+  auto table = ::arrow::TableFromJSON(
+      schema, {R"([[1, "a"], [2, "b"]])", R"([[3, "c"], [4, "d"]])",
+               R"([[null, null], [6, "f"]])", R"([[7, "g"], [null, null]])"});
+  auto expected = [&](const RowRanges& row_ranges) {
+    std::vector<std::shared_ptr<::arrow::Table>> slices;
+    for (const RowRanges::Range& range : row_ranges.ranges()) {
+      slices.push_back(table->Slice(range.begin, range.end - range.begin));
+    }
+    EXPECT_OK_AND_ASSIGN(auto concatenated, ::arrow::ConcatenateTables(slices));
+    return concatenated;
+  };
+
+  for (bool page_index : {true, false}) {
+    ARROW_SCOPED_TRACE("page_index=", page_index);
+    WriterProperties::Builder builder;
+    builder.data_pagesize(1); /* write multiple pages */
+    if (page_index) {
+      builder.enable_write_page_index();
+    }
+    WriteFile(builder.build(), table);
+
+    for (const RowRanges& row_ranges :
+         {RowRanges({{1, 2}, {4, 7}}), RowRanges({{0, 8}}), RowRanges({{6, 8}}),
+          RowRanges({{2, 4}}), RowRanges()}) {
+      ARROW_SCOPED_TRACE("row_ranges=", row_ranges.ToString());
+      ASSERT_OK_AND_ASSIGN(auto reader,
+                           OpenFile(std::make_shared<BufferReader>(buffer_),
+                                    ::arrow::default_memory_pool()));
+      ASSERT_OK(reader->SetRowRanges(0, row_ranges));
+      std::shared_ptr<::arrow::Table> actual;
+      ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+      ASSERT_OK(actual->ValidateFull());
+      if (row_ranges.empty()) {
+        ASSERT_EQ(0, actual->num_rows());
+      } else {
+        ::arrow::AssertTablesEqual(*expected(row_ranges), *actual,
+                                   /*same_chunk_layout=*/false);
+      }
+    }
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto reader, OpenFile(std::make_shared<BufferReader>(buffer_),
+                                             ::arrow::default_memory_pool()));
+  ASSERT_RAISES(IndexError, reader->SetRowRanges(0, RowRanges({{4, 9}})));
+  ASSERT_RAISES(Invalid, reader->SetRowRanges(1, RowRanges({{0, 1}})));
+}
+
+TEST_F(ParquetPageIndexRoundTripTest, FilterRowGroup) {
+  auto schema = ::arrow::schema(
+      {::arrow::field("c0", ::arrow::int64()), ::arrow::field("c1", ::arrow::utf8())});
+  auto table = ::arrow::TableFromJSON(
+      schema, {R"([[1, "a"], [2, "b"]])", R"([[3, "c"], [4, "d"]])",
+               R"([[null, null], [6, "f"]])", R"([[7, "g"], [null, null]])"});
+  WriteFile(
+      WriterProperties::Builder().enable_write_page_index()->data_pagesize(1)->build(),
+      table);
+
+  // Keep the rows where c0 > 3
+  auto predicate = [](const ::arrow::RecordBatch& batch)
+      -> ::arrow::Result<std::shared_ptr<::arrow::BooleanArray>> {
+    EXPECT_EQ(1, batch.num_columns());
+    ARROW_ASSIGN_OR_RAISE(auto mask,
+                          ::arrow::compute::CallFunction(
+                              "greater", {batch.column(0), ::arrow::MakeScalar(3)}));
+    return checked_pointer_cast<::arrow::BooleanArray>(mask.make_array());
+  };
+  auto check = [&](const std::optional<RowRanges>& row_ranges,
+                   const std::string& expected_indices) {
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         OpenFile(std::make_shared<BufferReader>(buffer_),
+                                  ::arrow::default_memory_pool()));
+    if (row_ranges) {
+      ASSERT_OK(reader->SetRowRanges(0, *row_ranges));
+    }
+    ASSERT_OK(reader->FilterRowGroup(0, {0}, predicate));
+    std::shared_ptr<::arrow::Table> actual;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+    ASSERT_OK(actual->ValidateFull());
+    ASSERT_OK_AND_ASSIGN(
+        auto expected,
+        ::arrow::compute::Take(table, ArrayFromJSON(::arrow::int32(), expected_indices)));
+    ::arrow::AssertTablesEqual(*expected.table(), *actual, /*same_chunk_layout=*/false);
+  };
+  check(std::nullopt, "[3, 5, 6]");
+  check(RowRanges({{0, 4}}), "[3]");
+  check(RowRanges({{4, 8}}), "[5, 6]");
+  check(RowRanges({{0, 3}}), "[]");
+
+  ASSERT_OK_AND_ASSIGN(auto reader, OpenFile(std::make_shared<BufferReader>(buffer_),
+                                             ::arrow::default_memory_pool()));
+  auto short_mask = [](const ::arrow::RecordBatch& batch)
+      -> ::arrow::Result<std::shared_ptr<::arrow::BooleanArray>> {
+    return checked_pointer_cast<::arrow::BooleanArray>(
+        ArrayFromJSON(::arrow::boolean(), "[true]"));
+  };
+  ASSERT_RAISES(Invalid, reader->FilterRowGroup(0, {0}, short_mask));
+}
+
 }  // namespace arrow
 }  // namespace parquet
@@ -0,0 +1,377 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Decoding throughput of each encoding, codec and physical type on data
+// distributions found in real files, rather than on uniform random data.
+//
+// BM_DecodeDistribution generates the data.  BM_DecodeCorpus reads the
+// top-level columns of the Parquet files listed, comma-separated, in the
+// PARQUET_BENCHMARK_CORPUS environment variable, and rewrites each of them with
+// every applicable encoding and codec.  Both report the Arrow size of the
+// decoded data per second, so the results of different encodings compare.
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/io/file.h"
+#include "arrow/io/memory.h"
+#include "arrow/table.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/string.h"
+
+#include "parquet/arrow/reader.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/file_reader.h"
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+
+namespace parquet::benchmark {
+
+namespace {
+
+using ::arrow::Array;
+using ::arrow::Table;
+
+constexpr int64_t kNumValues = 1 << 20;
+
+enum class Distribution : int {
+  kUniform,
+  kSorted,
+  kZipf,
+  kLowCardinality,
+  kRuns,
+  kClusteredNulls,
+};
+
+constexpr const char* kDistributionNames[] = {
+    "uniform", "sorted", "zipf", "low_cardinality", "runs", "clustered_nulls"};
+
+const std::vector<std::shared_ptr<::arrow::DataType>>& ValueTypes() {
+  static const std::vector<std::shared_ptr<::arrow::DataType>> types = {
+      ::arrow::int32(), ::arrow::int64(), ::arrow::float64(), ::arrow::utf8()};
+  return types;
+}
+
+const std::vector<Encoding::type>& Encodings() {
+  static const std::vector<Encoding::type> encodings = {
+      Encoding::PLAIN,
+      Encoding::RLE_DICTIONARY,
+      Encoding::DELTA_BINARY_PACKED,
+      Encoding::BYTE_STREAM_SPLIT,
+      Encoding::DELTA_LENGTH_BYTE_ARRAY,
+      Encoding::DELTA_BYTE_ARRAY};
+  return encodings;
+}
+
+const std::vector<Compression::type>& Codecs() {
+  static const std::vector<Compression::type> codecs = {
+      Compression::UNCOMPRESSED, Compression::SNAPPY, Compression::LZ4,
+      Compression::ZSTD};
+  return codecs;
+}
+
+bool IsEncodingSupported(Type::type physical_type, Encoding::type encoding) {
+  switch (encoding) {
+    case Encoding::PLAIN:
+      return true;
+    case Encoding::RLE_DICTIONARY:
+      return physical_type != Type::BOOLEAN;
+    case Encoding::DELTA_BINARY_PACKED:
+      return physical_type == Type::INT32 || physical_type == Type::INT64;
+    case Encoding::BYTE_STREAM_SPLIT:
+      return physical_type == Type::INT32 || physical_type == Type::INT64 ||
+             physical_type == Type::FLOAT || physical_type == Type::DOUBLE ||
+             physical_type == Type::FIXED_LEN_BYTE_ARRAY;
+    case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+      return physical_type == Type::BYTE_ARRAY;
+    case Encoding::DELTA_BYTE_ARRAY:
+      return physical_type == Type::BYTE_ARRAY ||
+             physical_type == Type::FIXED_LEN_BYTE_ARRAY;
+    default:
+      return false;
+  }
+}
+
+Type::type PhysicalType(const ::arrow::DataType& type) {
+  switch (type.id()) {
+    case ::arrow::Type::INT32:
+      return Type::INT32;
+    case ::arrow::Type::INT64:
+      return Type::INT64;
+    case ::arrow::Type::DOUBLE:
+      return Type::DOUBLE;
+    default:
+      return Type::BYTE_ARRAY;
+  }
+}
+
+// Draw the rank of each value according to the distribution, -1 for a null
+std::vector<int64_t> GenerateRanks(Distribution distribution, int64_t num_values,
+                                   uint32_t seed) {
+  std::default_random_engine rng(seed);
+  std::vector<int64_t> ranks(num_values);
+  switch (distribution) {
+    case Distribution::kUniform: {
+      std::uniform_int_distribution<int64_t> dist(0, (int64_t{1} << 31) - 1);
+      for (auto& rank : ranks) rank = dist(rng);
+      break;
+    }
+    case Distribution::kSorted: {
+      // Ascending, with small and irregular deltas like timestamps or ids
+      std::geometric_distribution<int64_t> delta(0.1);
+      int64_t rank = 1000000;
+      for (auto& r : ranks) r = rank += delta(rng);
+      break;
+    }
+    case Distribution::kZipf: {
+      // Zipf with exponent 1.1 over 100000 distinct values, by inverting the CDF
+      constexpr int kNumDistinct = 100000;
+      std::vector<double> cdf(kNumDistinct);
+      double total = 0;
+      for (int i = 0; i < kNumDistinct; ++i) {
+        total += 1.0 / std::pow(i + 1, 1.1);
+        cdf[i] = total;
+      }
+      std::uniform_real_distribution<double> dist(0, total);
+      for (auto& rank : ranks) {
+        rank = std::lower_bound(cdf.begin(), cdf.end(), dist(rng)) - cdf.begin();
+      }
+      break;
+    }
+    case Distribution::kLowCardinality: {
+      std::uniform_int_distribution<int64_t> dist(0, 15);
+      for (auto& rank : ranks) rank = dist(rng);
+      break;
+    }
+    case Distribution::kRuns: {
+      // Runs of equal values, 64 values long on average
+      std::geometric_distribution<int64_t> run_length(1.0 / 64);
+      std::uniform_int_distribution<int64_t> dist(0, 1000);
+      for (int64_t i = 0; i < num_values;) {
+        const int64_t end = std::min(num_values, i + 1 + run_length(rng));
+        std::fill(ranks.begin() + i, ranks.begin() + end, dist(rng));
+        i = end;
+      }
+      break;
+    }
+    case Distribution::kClusteredNulls: {
+      // Half of the values are null, in runs of up to 256 nulls
+      std::uniform_int_distribution<int64_t> run_length(1, 256);
+      std::uniform_int_distribution<int64_t> dist(0, (int64_t{1} << 31) - 1);
+      bool is_null = false;
+      for (int64_t i = 0; i < num_values; is_null = !is_null) {
+        const int64_t end = std::min(num_values, i + run_length(rng));
+        for (; i < end; ++i) ranks[i] = is_null ? -1 : dist(rng);
+      }
+      break;
+    }
+  }
+  return ranks;
+}
+
+template <typename BuilderType, typename MakeValue>
+std::shared_ptr<Array> BuildArray(const std::vector<int64_t>& ranks,
+                                  MakeValue&& make_value) {
+  BuilderType builder;
+  PARQUET_THROW_NOT_OK(builder.Reserve(static_cast<int64_t>(ranks.size())));
+  for (int64_t rank : ranks) {
+    if (rank < 0) {
+      PARQUET_THROW_NOT_OK(builder.AppendNull());
+    } else {
+      PARQUET_THROW_NOT_OK(builder.Append(make_value(rank)));
+    }
+  }
+  std::shared_ptr<Array> array;
+  PARQUET_THROW_NOT_OK(builder.Finish(&array));
+  return array;
+}
+
+std::shared_ptr<Array> GenerateArray(Distribution distribution,
+                                     const ::arrow::DataType& type) {
+  const auto ranks = GenerateRanks(distribution, kNumValues, /*seed=*/42);
+  switch (type.id()) {
+    case ::arrow::Type::INT32:
+      return BuildArray<::arrow::Int32Builder>(
+          ranks, [](int64_t rank) { return static_cast<int32_t>(rank); });
+    case ::arrow::Type::INT64:
+      // Spread over the whole range, but keep the order of the ranks
+      return BuildArray<::arrow::Int64Builder>(ranks,
+                                               [](int64_t rank) { return rank << 24; });
+    case ::arrow::Type::DOUBLE:
+      return BuildArray<::arrow::DoubleBuilder>(
+          ranks, [](int64_t rank) { return static_cast<double>(rank) * 0.01; });
+    default:
+      return BuildArray<::arrow::StringBuilder>(
+          ranks, [](int64_t rank) { return "value-" + std::to_string(rank); });
+  }
+}
+
+std::shared_ptr<WriterProperties> MakeWriterProperties(Encoding::type encoding,
+                                                       Compression::type codec) {
+  WriterProperties::Builder builder;
+  builder.compression(codec);
+  if (encoding == Encoding::RLE_DICTIONARY) {
+    builder.enable_dictionary();
+  } else {
+    builder.disable_dictionary()->encoding(encoding);
+  }
+  return builder.build();
+}
+
+// Write the table with the encoding and codec, then time reading it back
+void BenchmarkDecode(::benchmark::State& state, const Table& table,
+                     Encoding::type encoding, Compression::type codec) {
+  auto output = CreateOutputStream();
+  auto status = ::parquet::arrow::WriteTable(table, ::arrow::default_memory_pool(),
+                                             output, /*chunk_size=*/table.num_rows(),
+                                             MakeWriterProperties(encoding, codec));
+  if (!status.ok()) {
+    state.SkipWithError(status.ToString().c_str());
+    return;
+  }
+  PARQUET_ASSIGN_OR_THROW(auto buffer, output->Finish());
+  PARQUET_ASSIGN_OR_THROW(auto decoded_size, ::arrow::util::ReferencedBufferSize(table));
+
+  for (auto _ : state) {
+    std::unique_ptr<::parquet::arrow::FileReader> reader;
+    PARQUET_ASSIGN_OR_THROW(
+        reader, ::parquet::arrow::OpenFile(
+                    std::make_shared<::arrow::io::BufferReader>(buffer),
+                    ::arrow::default_memory_pool()));
+    std::shared_ptr<Table> result;
+    PARQUET_THROW_NOT_OK(reader->ReadTable(&result));
+    ::benchmark::DoNotOptimize(result);
+  }
+
+  state.SetItemsProcessed(table.num_rows() * state.iterations());
+  state.SetBytesProcessed(decoded_size * state.iterations());
+  state.counters["file_size"] = static_cast<double>(buffer->size());
+  state.counters["compression_ratio"] =
+      static_cast<double>(decoded_size) / static_cast<double>(buffer->size());
+}
+
+void BM_DecodeDistribution(::benchmark::State& state) {
+  const auto distribution = static_cast<Distribution>(state.range(0));
+  const auto& type = ValueTypes()[state.range(1)];
+  const auto encoding = Encodings()[state.range(2)];
+  const auto codec = Codecs()[state.range(3)];
+  state.SetLabel(std::string(kDistributionNames[state.range(0)]) + "/" +
+                 type->ToString() + "/" + EncodingToString(encoding) + "/" +
+                 ::arrow::util::Codec::GetCodecAsString(codec));
+
+  auto array = GenerateArray(distribution, *type);
+  auto table = Table::Make(::arrow::schema({::arrow::field("value", type)}), {array});
+  BenchmarkDecode(state, *table, encoding, codec);
+}
+
+void DistributionArgs(::benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"distribution", "type", "encoding", "codec"});
+  constexpr int kNumDistributions = static_cast<int>(std::size(kDistributionNames));
+  for (int distribution = 0; distribution < kNumDistributions; ++distribution) {
+    for (size_t type = 0; type < ValueTypes().size(); ++type) {
+      for (size_t encoding = 0; encoding < Encodings().size(); ++encoding) {
+        if (!IsEncodingSupported(PhysicalType(*ValueTypes()[type]),
+                                 Encodings()[encoding])) {
+          continue;
+        }
+        for (size_t codec = 0; codec < Codecs().size(); ++codec) {
+          if (!IsCodecSupported(Codecs()[codec])) continue;
+          bench->Args({distribution, static_cast<int64_t>(type),
+                       static_cast<int64_t>(encoding), static_cast<int64_t>(codec)});
+        }
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_DecodeDistribution)->Apply(DistributionArgs);
+
+// A leaf column of a corpus file
+std::shared_ptr<Table> ReadCorpusColumn(const std::string& path, int column) {
+  PARQUET_ASSIGN_OR_THROW(auto file, ::arrow::io::ReadableFile::Open(path));
+  std::unique_ptr<::parquet::arrow::FileReader> reader;
+  PARQUET_ASSIGN_OR_THROW(reader, ::parquet::arrow::OpenFile(
+                                      file, ::arrow::default_memory_pool()));
+  std::shared_ptr<Table> table;
+  PARQUET_THROW_NOT_OK(reader->ReadTable({column}, &table));
+  return table;
+}
+
+void BM_DecodeCorpus(::benchmark::State& state, const std::string& path) {
+  const auto encoding = Encodings()[state.range(1)];
+  const auto codec = Codecs()[state.range(2)];
+  auto table = ReadCorpusColumn(path, static_cast<int>(state.range(0)));
+  state.SetLabel(table->field(0)->name() + "/" + EncodingToString(encoding) + "/" +
+                 ::arrow::util::Codec::GetCodecAsString(codec));
+  BenchmarkDecode(state, *table, encoding, codec);
+}
+
+// Register the benchmarks of each top-level primitive column of the corpus files
+bool RegisterCorpusBenchmarks() {
+  auto corpus = ::arrow::internal::GetEnvVar("PARQUET_BENCHMARK_CORPUS");
+  if (!corpus.ok()) return false;
+  for (std::string_view path_view : ::arrow::internal::SplitString(*corpus, ',')) {
+    std::string path(path_view);
+    std::shared_ptr<FileMetaData> metadata;
+    try {
+      metadata = ParquetFileReader::OpenFile(path)->metadata();
+    } catch (const ParquetException& e) {
+      std::cerr << "Skipping " << path << ": " << e.what() << std::endl;
+      continue;
+    }
+    const SchemaDescriptor* schema = metadata->schema();
+    const schema::GroupNode* root = schema->group_node();
+    for (int column = 0; column < root->field_count(); ++column) {
+      const auto& node = root->field(column);
+      if (!node->is_primitive()) continue;
+      const auto physical_type =
+          static_cast<const schema::PrimitiveNode&>(*node).physical_type();
+      const int64_t leaf = schema->ColumnIndex(*node);
+      auto* bench = ::benchmark::RegisterBenchmark(
+          ("BM_DecodeCorpus/" + path + ":" + node->name()).c_str(), BM_DecodeCorpus,
+          path);
+      bench->ArgNames({"column", "encoding", "codec"});
+      for (size_t encoding = 0; encoding < Encodings().size(); ++encoding) {
+        if (!IsEncodingSupported(physical_type, Encodings()[encoding])) continue;
+        for (size_t codec = 0; codec < Codecs().size(); ++codec) {
+          if (!IsCodecSupported(Codecs()[codec])) continue;
+          bench->Args({leaf, static_cast<int64_t>(encoding),
+                       static_cast<int64_t>(codec)});
+        }
+      }
+    }
+  }
+  return true;
+}
+
+[[maybe_unused]] const bool kCorpusRegistered = RegisterCorpusBenchmarks();
+
+}  // namespace
+
+}  // namespace parquet::benchmark
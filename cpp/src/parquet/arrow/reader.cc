@@ -19,7 +19,9 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -32,24 +34,29 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
+#include "arrow/util/trace_events.h"
 #include "arrow/util/tracing_internal.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/column_reader.h"
 #include "parquet/exception.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
 
 using arrow::Array;
 using arrow::ArrayData;
 using arrow::BooleanArray;
+using arrow::Buffer;
 using arrow::ChunkedArray;
 using arrow::DataType;
 using arrow::ExtensionType;
@@ -96,6 +103,31 @@ namespace {
   }
 }
 
+// Translate ranges of positions among the rows of `rows` into the rows at those
+// positions.  `positions` must be sorted, not overlapping and within num_rows().
+RowRanges SelectPositions(const RowRanges& rows,
+                          const std::vector<RowRanges::Range>& positions) {
+  std::vector<RowRanges::Range> selected;
+  auto range = rows.ranges().begin();
+  // The position of the first row of `range`
+  int64_t range_position = 0;
+  for (RowRanges::Range position : positions) {
+    while (position.begin < position.end) {
+      while (range_position + (range->end - range->begin) <= position.begin) {
+        range_position += range->end - range->begin;
+        ++range;
+      }
+      int64_t row = range->begin + (position.begin - range_position);
+      int64_t count =
+          std::min(position.end, range_position + (range->end - range->begin)) -
+          position.begin;
+      selected.push_back({row, row + count});
+      position.begin += count;
+    }
+  }
+  return RowRanges(std::move(selected));
+}
+
 }  // namespace
 
 class ColumnReaderImpl : public ColumnReader {
@@ -194,6 +226,41 @@ class FileReaderImpl : public FileReader {
 
   std::shared_ptr<RowGroupReader> RowGroup(int row_group_index) override;
 
+  Status SetRowRanges(int row_group, RowRanges row_ranges) override {
+    RETURN_NOT_OK(BoundsCheckRowGroup(row_group));
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    int64_t num_rows = reader_->metadata()->RowGroup(row_group)->num_rows();
+    if (!row_ranges.empty() && (row_ranges.ranges().front().begin < 0 ||
+                                row_ranges.ranges().back().end > num_rows)) {
+      return Status::IndexError("Row ranges ", row_ranges.ToString(),
+                                " are out of bounds for row group ", row_group,
+                                " with ", num_rows, " rows");
+    }
+    END_PARQUET_CATCH_EXCEPTIONS
+    // Readers which were already created keep the selection they were created with
+    auto selection = std::make_shared<RowRangesSelection>();
+    if (row_ranges_) {
+      selection->row_ranges = row_ranges_->row_ranges;
+      selection->page_index_mutex = row_ranges_->page_index_mutex;
+    }
+    selection->row_ranges[row_group] = std::move(row_ranges);
+    row_ranges_ = std::move(selection);
+    return Status::OK();
+  }
+
+  Status FilterRowGroup(int row_group, const std::vector<int>& column_indices,
+                        const RowPredicate& predicate) override;
+
+  // The number of rows that will be read from a row group
+  int64_t NumRowsToRead(int row_group) const {
+    if (row_ranges_) {
+      if (const RowRanges* row_ranges = row_ranges_->Find(row_group)) {
+        return row_ranges->num_rows();
+      }
+    }
+    return reader_->metadata()->RowGroup(row_group)->num_rows();
+  }
+
   Status ReadTable(const std::vector<int>& indices,
                    std::shared_ptr<Table>* out) override {
     return ReadRowGroups(Iota(reader_->metadata()->num_row_groups()), indices, out);
@@ -219,6 +286,7 @@ class FileReaderImpl : public FileReader {
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
     ctx->reader_properties = &reader_properties_;
+    ctx->row_ranges = row_ranges_;
     return GetReader(manifest_.schema_fields[i], ctx, out);
   }
 
@@ -379,6 +447,9 @@ class FileReaderImpl : public FileReader {
   ArrowReaderProperties reader_properties_;
 
   SchemaManifest manifest_;
+
+  // Rows selected with SetRowRanges(), null if all rows are read
+  std::shared_ptr<RowRangesSelection> row_ranges_;
 };
 
 class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
@@ -452,7 +523,8 @@ class LeafReader : public ColumnReaderImpl {
         input_(std::move(input)),
         descr_(input_->descr()) {
     record_reader_ = RecordReader::Make(
-        descr_, leaf_info, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY);
+        descr_, leaf_info, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY,
+        /*read_dense_for_nullable=*/false, field_->type());
     NextRowGroup();
   }
 
@@ -471,6 +543,9 @@ class LeafReader : public ColumnReaderImpl {
   bool IsOrHasRepeatedChild() const final { return false; }
 
   Status LoadBatch(int64_t records_to_read) final {
+    ::arrow::util::tracing::ScopedTraceEvent trace_event("parquet",
+                                                         "LeafReader::LoadBatch");
+    trace_event.set_value(records_to_read);
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     out_ = nullptr;
     record_reader_->Reset();
@@ -482,7 +557,7 @@ class LeafReader : public ColumnReaderImpl {
       if (!record_reader_->HasMoreData()) {
         break;
       }
-      int64_t records_read = record_reader_->ReadRecords(records_to_read);
+      int64_t records_read = ReadRecords(records_to_read);
       records_to_read -= records_read;
       if (records_read == 0) {
         NextRowGroup();
@@ -515,16 +590,141 @@ class LeafReader : public ColumnReaderImpl {
 
  private:
   std::shared_ptr<ChunkedArray> out_;
+  // A run of rows which are either all read or all skipped
+  struct Step {
+    bool read;
+    int64_t num_rows;
+  };
+
   void NextRowGroup() {
     std::unique_ptr<PageReader> page_reader = input_->NextChunk();
+    steps_.clear();
+    selective_ = false;
+    if (page_reader && ctx_->row_ranges) {
+      const RowRanges* row_ranges = ctx_->row_ranges->Find(input_->row_group_index());
+      if (row_ranges) {
+        PlanRowGroup(*row_ranges, page_reader.get());
+      }
+    }
     record_reader_->SetPageReader(std::move(page_reader));
   }
 
+  // Skip the data pages which hold no selected row and compute the steps needed to
+  // extract the selected rows from the remaining ones.
+  void PlanRowGroup(const RowRanges& row_ranges, PageReader* page_reader) {
+    const int64_t num_rows = input_->row_group_metadata()->num_rows();
+    std::shared_ptr<OffsetIndex> offset_index;
+    {
+      std::lock_guard<std::mutex> lock(*ctx_->row_ranges->page_index_mutex);
+      std::shared_ptr<PageIndexReader> page_index_reader =
+          ctx_->reader->GetPageIndexReader();
+      std::shared_ptr<RowGroupPageIndexReader> row_group_index_reader =
+          page_index_reader ? page_index_reader->RowGroup(input_->row_group_index())
+                            : nullptr;
+      if (row_group_index_reader) {
+        offset_index = row_group_index_reader->GetOffsetIndex(input_->column_index());
+      }
+    }
+
+    // The rows stored in the pages which will be decoded
+    std::vector<RowRanges::Range> stored;
+    if (offset_index && !offset_index->page_locations().empty()) {
+      const std::vector<PageLocation>& pages = offset_index->page_locations();
+      auto skip_page = std::make_shared<std::vector<bool>>(pages.size());
+      for (size_t i = 0; i < pages.size(); ++i) {
+        int64_t begin = pages[i].first_row_index;
+        int64_t end = i + 1 < pages.size() ? pages[i + 1].first_row_index : num_rows;
+        (*skip_page)[i] = !row_ranges.Overlaps(begin, end);
+        if (!(*skip_page)[i]) {
+          stored.push_back({begin, end});
+        }
+      }
+      page_reader->set_data_page_filter(
+          [skip_page, page = size_t{0}](const DataPageStats&) mutable {
+            bool skip = page < skip_page->size() && (*skip_page)[page];
+            ++page;
+            return skip;
+          });
+    } else {
+      stored.push_back({0, num_rows});
+    }
+
+    // Walk the stored rows, reading the selected ones and skipping the others
+    auto add_step = [&](bool read, int64_t count) {
+      if (count == 0) return;
+      if (!steps_.empty() && steps_.back().read == read) {
+        steps_.back().num_rows += count;
+      } else {
+        steps_.push_back({read, count});
+      }
+    };
+    auto selected = row_ranges.ranges().begin();
+    for (const RowRanges::Range& range : stored) {
+      int64_t position = range.begin;
+      while (position < range.end) {
+        while (selected != row_ranges.ranges().end() && selected->end <= position) {
+          ++selected;
+        }
+        if (selected == row_ranges.ranges().end()) {
+          add_step(false, range.end - position);
+          break;
+        }
+        if (selected->begin > position) {
+          int64_t skip_end = std::min(selected->begin, range.end);
+          add_step(false, skip_end - position);
+          position = skip_end;
+        } else {
+          int64_t read_end = std::min(selected->end, range.end);
+          add_step(true, read_end - position);
+          position = read_end;
+        }
+      }
+    }
+    // Nothing needs to be decoded after the last selected row
+    while (!steps_.empty() && !steps_.back().read) {
+      steps_.pop_back();
+    }
+    selective_ = true;
+  }
+
+  // Read up to records_to_read selected records, returns 0 at the end of the row group
+  int64_t ReadRecords(int64_t records_to_read) {
+    if (!selective_) {
+      return record_reader_->ReadRecords(records_to_read);
+    }
+    while (!steps_.empty() && !steps_.front().read) {
+      int64_t skipped = record_reader_->SkipRecords(steps_.front().num_rows);
+      if (skipped == 0) {
+        throw ParquetException("Column chunk ended before the selected rows of column ",
+                               input_->column_index(), " in row group ",
+                               input_->row_group_index());
+      }
+      steps_.front().num_rows -= skipped;
+      if (steps_.front().num_rows == 0) steps_.pop_front();
+    }
+    if (steps_.empty()) {
+      return 0;
+    }
+    int64_t records_read = record_reader_->ReadRecords(
+        std::min(records_to_read, steps_.front().num_rows));
+    if (records_read == 0) {
+      throw ParquetException("Column chunk ended before the selected rows of column ",
+                             input_->column_index(), " in row group ",
+                             input_->row_group_index());
+    }
+    steps_.front().num_rows -= records_read;
+    if (steps_.front().num_rows == 0) steps_.pop_front();
+    return records_read;
+  }
+
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
   const ColumnDescriptor* descr_;
   std::shared_ptr<RecordReader> record_reader_;
+  // Whether the current row group only reads the rows described by steps_
+  bool selective_ = false;
+  std::deque<Step> steps_;
 };
 
 // Column reader for extension arrays
@@ -1010,7 +1210,7 @@ Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
     ::arrow::RecordBatchVector batches;
 
     for (int row_group : row_groups) {
-      int64_t num_rows = parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+      int64_t num_rows = NumRowsToRead(row_group);
 
       batches.insert(batches.end(), static_cast<size_t>(num_rows / batch_size),
                      max_sized_batch);
@@ -1026,7 +1226,7 @@ Result<std::unique_ptr<RecordBatchReader>> FileReaderImpl::GetRecordBatchReader(
 
   int64_t num_rows = 0;
   for (int row_group : row_groups) {
-    num_rows += parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    num_rows += NumRowsToRead(row_group);
   }
 
   using ::arrow::RecordBatchIterator;
@@ -1219,6 +1419,57 @@ FileReaderImpl::GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
   return concatenated;
 }
 
+Status FileReaderImpl::FilterRowGroup(int row_group,
+                                      const std::vector<int>& column_indices,
+                                      const RowPredicate& predicate) {
+  RETURN_NOT_OK(BoundsCheckRowGroup(row_group));
+  RowRanges rows;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  const RowRanges* row_ranges = row_ranges_ ? row_ranges_->Find(row_group) : nullptr;
+  rows = row_ranges
+             ? *row_ranges
+             : RowRanges::All(reader_->metadata()->RowGroup(row_group)->num_rows());
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  ARROW_ASSIGN_OR_RAISE(std::unique_ptr<RecordBatchReader> batch_reader,
+                        GetRecordBatchReader({row_group}, column_indices));
+  // Positions among `rows` of the rows to keep
+  std::vector<RowRanges::Range> positions;
+  int64_t position = 0;
+  while (true) {
+    std::shared_ptr<::arrow::RecordBatch> batch;
+    RETURN_NOT_OK(batch_reader->ReadNext(&batch));
+    if (batch == nullptr) break;
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<BooleanArray> mask, predicate(*batch));
+    if (mask == nullptr || mask->length() != batch->num_rows()) {
+      return Status::Invalid("Row predicate must return a boolean array of length ",
+                             batch->num_rows());
+    }
+    if (batch->num_rows() == 0) continue;
+    std::shared_ptr<Buffer> selected = mask->values();
+    int64_t offset = mask->offset();
+    if (mask->null_count() > 0) {
+      ARROW_ASSIGN_OR_RAISE(
+          selected, ::arrow::internal::BitmapAnd(pool_, mask->values()->data(), offset,
+                                                 mask->null_bitmap_data(), offset,
+                                                 mask->length(), /*out_offset=*/0));
+      offset = 0;
+    }
+    ::arrow::internal::SetBitRunReader run_reader(selected->data(), offset,
+                                                  mask->length());
+    for (auto run = run_reader.NextRun(); run.length > 0; run = run_reader.NextRun()) {
+      int64_t begin = position + run.position;
+      positions.push_back({begin, begin + run.length});
+    }
+    position += batch->num_rows();
+  }
+  if (position != rows.num_rows()) {
+    return Status::Invalid("Expected ", rows.num_rows(), " rows in row group ",
+                           row_group, " but read ", position);
+  }
+  return SetRowRanges(row_group, SelectPositions(rows, positions));
+}
+
 Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_factory,
                                  std::unique_ptr<ColumnReader>* out) {
   RETURN_NOT_OK(BoundsCheckColumn(i));
@@ -1228,6 +1479,7 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
   ctx->iterator_factory = iterator_factory;
   ctx->filter_leaves = false;
   ctx->reader_properties = &reader_properties_;
+  ctx->row_ranges = row_ranges_;
   std::unique_ptr<ColumnReaderImpl> result;
   RETURN_NOT_OK(GetReader(manifest_.schema_fields[i], ctx, &result));
   *out = std::move(result);
@@ -1280,7 +1532,7 @@ Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
       num_rows = columns[0]->length();
     } else {
       for (int i : row_groups) {
-        num_rows += parquet_reader()->metadata()->RowGroup(i)->num_rows();
+        num_rows += NumRowsToRead(i);
       }
     }
     auto table = Table::Make(std::move(result_schema), columns, num_rows);
@@ -1300,6 +1552,15 @@ std::shared_ptr<RowGroupReader> FileReaderImpl::RowGroup(int row_group_index) {
 // ----------------------------------------------------------------------
 // Public factory functions
 
+Status FileReader::SetRowRanges(int row_group, RowRanges row_ranges) {
+  return Status::NotImplemented("SetRowRanges is not supported by this FileReader");
+}
+
+Status FileReader::FilterRowGroup(int row_group, const std::vector<int>& column_indices,
+                                  const RowPredicate& predicate) {
+  return Status::NotImplemented("FilterRowGroup is not supported by this FileReader");
+}
+
 Status FileReader::GetRecordBatchReader(std::unique_ptr<RecordBatchReader>* out) {
   ARROW_ASSIGN_OR_RAISE(*out, GetRecordBatchReader());
   return Status::OK();
@@ -24,11 +24,13 @@
 #include <vector>
 
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
 namespace arrow {
 
+class BooleanArray;
 class ChunkedArray;
 class KeyValueMetadata;
 class RecordBatchReader;
@@ -282,6 +284,41 @@ class PARQUET_EXPORT FileReader {
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Only read the given rows of a row group
+  ///
+  /// Later reads which include the row group return the given rows only, in order.
+  /// If the file has an offset index, data pages that hold none of the rows are
+  /// skipped without being decompressed or decoded.  Readers which were created
+  /// before this call are not affected.
+  ///
+  /// Calling this again for the same row group replaces its rows.  The default
+  /// implementation returns NotImplemented.
+  ///
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Status SetRowRanges(int row_group, RowRanges row_ranges);
+
+  /// \brief Compute which rows of a batch to keep
+  ///
+  /// Returns a boolean array with the length of the batch.  Null entries are
+  /// treated as false.
+  using RowPredicate =
+      std::function<::arrow::Result<std::shared_ptr<::arrow::BooleanArray>>(
+          const ::arrow::RecordBatch&)>;
+
+  /// \brief Only read the rows of a row group which satisfy a predicate
+  ///
+  /// The given columns of the rows currently selected in the row group are read in
+  /// batches and passed to `predicate`.  The rows it keeps become the row ranges of
+  /// the row group, as with SetRowRanges(), so that later reads only decode those
+  /// rows of the other columns.  This pays off when the predicate columns are cheap
+  /// to decode compared to the rest of the projection and the predicate is selective.
+  /// The default implementation returns NotImplemented.
+  ///
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Status FilterRowGroup(int row_group,
+                                         const std::vector<int>& column_indices,
+                                         const RowPredicate& predicate);
+
   /// \brief Scan file contents with one thread, return number of rows
   virtual ::arrow::Status ScanContents(std::vector<int> columns,
                                        const int32_t column_batch_size,
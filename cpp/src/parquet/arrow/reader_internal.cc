@@ -523,16 +523,58 @@ Status TransferDate64(RecordReader* reader, MemoryPool* pool,
 }
 
 // ----------------------------------------------------------------------
-// Binary, direct to dictionary-encoded
+// Direct to dictionary-encoded
+
+Result<std::shared_ptr<Array>> ConvertDictionaryValues(
+    const std::shared_ptr<Array>& values, const std::shared_ptr<DataType>& value_type,
+    MemoryPool* pool);
+
+// Whether dictionary values of the physical type must be converted to be read as the
+// logical value type, rather than viewed
+bool NeedsDictionaryValueConversion(const DataType& value_type) {
+  switch (value_type.id()) {
+    case ::arrow::Type::INT8:
+    case ::arrow::Type::INT16:
+    case ::arrow::Type::UINT8:
+    case ::arrow::Type::UINT16:
+    case ::arrow::Type::DECIMAL128:
+    case ::arrow::Type::DECIMAL256:
+      return true;
+    default:
+      return false;
+  }
+}
 
-Status TransferDictionary(RecordReader* reader,
+Status TransferDictionary(RecordReader* reader, MemoryPool* pool,
                           const std::shared_ptr<DataType>& logical_value_type,
                           bool nullable, std::shared_ptr<ChunkedArray>* out) {
   auto dict_reader = dynamic_cast<DictionaryRecordReader*>(reader);
   DCHECK(dict_reader);
   *out = dict_reader->GetResult();
   if (!logical_value_type->Equals(*(*out)->type())) {
-    ARROW_ASSIGN_OR_RAISE(*out, (*out)->View(logical_value_type));
+    const auto& value_type =
+        checked_cast<const ::arrow::DictionaryType&>(*logical_value_type).value_type();
+    if (NeedsDictionaryValueConversion(*value_type)) {
+      // Only the dictionaries need converting, chunks read from the same dictionary
+      // page share them
+      ::arrow::ArrayVector chunks = (*out)->chunks();
+      std::shared_ptr<Array> last_values, last_converted;
+      for (auto& chunk : chunks) {
+        auto data = chunk->data()->Copy();
+        std::shared_ptr<Array> values = ::arrow::MakeArray(data->dictionary);
+        if (last_values == nullptr || !last_values->Equals(*values)) {
+          ARROW_ASSIGN_OR_RAISE(last_converted,
+                                ConvertDictionaryValues(values, value_type, pool));
+          last_values = std::move(values);
+        }
+        data->type = logical_value_type;
+        data->dictionary = last_converted->data();
+        chunk = ::arrow::MakeArray(std::move(data));
+      }
+      *out = std::make_shared<ChunkedArray>(std::move(chunks), logical_value_type);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(*out, (*out)->View(logical_value_type));
+    }
   }
   if (!nullable) {
     ::arrow::ArrayVector chunks = (*out)->chunks();
@@ -547,7 +589,7 @@ Status TransferBinary(RecordReader* reader, MemoryPool* pool,
                       std::shared_ptr<ChunkedArray>* out) {
   if (reader->read_dictionary()) {
     return TransferDictionary(
-        reader, ::arrow::dictionary(::arrow::int32(), logical_type_field->type()),
+        reader, pool, ::arrow::dictionary(::arrow::int32(), logical_type_field->type()),
         logical_type_field->nullable(), out);
   }
   ::arrow::compute::ExecContext ctx(pool);
@@ -705,6 +747,32 @@ struct DecimalConverter<DecimalArrayType, ByteArrayType> {
   }
 };
 
+template <typename DecimalArrayType, typename ElementType>
+Result<std::shared_ptr<::arrow::Buffer>> IntegersToDecimalData(const ElementType* values,
+                                                               int64_t length,
+                                                               const DataType& type,
+                                                               MemoryPool* pool) {
+  const auto& decimal_type = checked_cast<const ::arrow::DecimalType&>(type);
+  const int64_t type_length = decimal_type.byte_width();
+
+  ARROW_ASSIGN_OR_RAISE(auto data, ::arrow::AllocateBuffer(length * type_length, pool));
+  uint8_t* out_ptr = data->mutable_data();
+
+  for (int64_t i = 0; i < length; ++i, out_ptr += type_length) {
+    // sign/zero extend int32_t values, otherwise a no-op
+    const auto value = static_cast<int64_t>(values[i]);
+
+    if constexpr (std::is_same_v<DecimalArrayType, Decimal128Array>) {
+      ::arrow::Decimal128 decimal(value);
+      decimal.ToBytes(out_ptr);
+    } else {
+      ::arrow::Decimal256 decimal(value);
+      decimal.ToBytes(out_ptr);
+    }
+  }
+  return std::shared_ptr<::arrow::Buffer>(std::move(data));
+}
+
 /// \brief Convert an Int32 or Int64 array into a Decimal128Array
 /// The parquet spec allows systems to write decimals in int32, int64 if the values are
 /// small enough to fit in less 4 bytes or less than 8 bytes, respectively.
@@ -729,26 +797,9 @@ static Status DecimalIntegerTransfer(RecordReader* reader, MemoryPool* pool,
 
   const auto values = reinterpret_cast<const ElementType*>(reader->values());
 
-  const auto& decimal_type = checked_cast<const ::arrow::DecimalType&>(*field->type());
-  const int64_t type_length = decimal_type.byte_width();
-
-  ARROW_ASSIGN_OR_RAISE(auto data, ::arrow::AllocateBuffer(length * type_length, pool));
-  uint8_t* out_ptr = data->mutable_data();
-
-  using ::arrow::bit_util::FromLittleEndian;
-
-  for (int64_t i = 0; i < length; ++i, out_ptr += type_length) {
-    // sign/zero extend int32_t values, otherwise a no-op
-    const auto value = static_cast<int64_t>(values[i]);
-
-    if constexpr (std::is_same_v<DecimalArrayType, Decimal128Array>) {
-      ::arrow::Decimal128 decimal(value);
-      decimal.ToBytes(out_ptr);
-    } else {
-      ::arrow::Decimal256 decimal(value);
-      decimal.ToBytes(out_ptr);
-    }
-  }
+  ARROW_ASSIGN_OR_RAISE(
+      auto data, IntegersToDecimalData<DecimalArrayType>(values, length, *field->type(),
+                                                          pool));
 
   if (reader->nullable_values() && field->nullable()) {
     std::shared_ptr<ResizableBuffer> is_valid = reader->ReleaseIsValid();
@@ -760,6 +811,55 @@ static Status DecimalIntegerTransfer(RecordReader* reader, MemoryPool* pool,
   return Status::OK();
 }
 
+template <typename DecimalArrayType>
+Result<std::shared_ptr<Array>> ConvertDictionaryToDecimal(
+    const std::shared_ptr<Array>& values, const std::shared_ptr<DataType>& type,
+    MemoryPool* pool) {
+  std::shared_ptr<Array> out;
+  switch (values->type_id()) {
+    case ::arrow::Type::FIXED_SIZE_BINARY:
+      RETURN_NOT_OK((DecimalConverter<DecimalArrayType, FLBAType>::ConvertToDecimal(
+          *values, type, pool, &out)));
+      return out;
+    case ::arrow::Type::INT32: {
+      ARROW_ASSIGN_OR_RAISE(auto data, IntegersToDecimalData<DecimalArrayType>(
+                                           checked_cast<const Int32Array&>(*values)
+                                               .raw_values(),
+                                           values->length(), *type, pool));
+      return std::make_shared<DecimalArrayType>(type, values->length(), std::move(data));
+    }
+    case ::arrow::Type::INT64: {
+      ARROW_ASSIGN_OR_RAISE(auto data,
+                            IntegersToDecimalData<DecimalArrayType>(
+                                checked_cast<const ::arrow::Int64Array&>(*values)
+                                    .raw_values(),
+                                values->length(), *type, pool));
+      return std::make_shared<DecimalArrayType>(type, values->length(), std::move(data));
+    }
+    default:
+      return Status::NotImplemented("Reading ", values->type()->ToString(),
+                                    " dictionary values as ", type->ToString());
+  }
+}
+
+// Convert dictionary values of the physical type to the logical value type
+Result<std::shared_ptr<Array>> ConvertDictionaryValues(
+    const std::shared_ptr<Array>& values, const std::shared_ptr<DataType>& value_type,
+    MemoryPool* pool) {
+  switch (value_type->id()) {
+    case ::arrow::Type::DECIMAL128:
+      return ConvertDictionaryToDecimal<Decimal128Array>(values, value_type, pool);
+    case ::arrow::Type::DECIMAL256:
+      return ConvertDictionaryToDecimal<Decimal256Array>(values, value_type, pool);
+    default: {
+      // Narrower integers, which Parquet stores as INT32
+      ::arrow::compute::ExecContext ctx(pool);
+      return ::arrow::compute::Cast(*values, value_type,
+                                    ::arrow::compute::CastOptions::Unsafe(), &ctx);
+    }
+  }
+}
+
 /// \brief Convert an arrow::BinaryArray to an arrow::Decimal{128,256}Array
 /// We do this by:
 /// 1. Creating an arrow::BinaryArray from the RecordReader's builder
@@ -823,7 +923,7 @@ Status TransferColumnData(RecordReader* reader,
   std::shared_ptr<ChunkedArray> chunked_result;
   switch (value_field->type()->id()) {
     case ::arrow::Type::DICTIONARY: {
-      RETURN_NOT_OK(TransferDictionary(reader, value_field->type(),
+      RETURN_NOT_OK(TransferDictionary(reader, pool, value_field->type(),
                                        value_field->nullable(), &chunked_result));
       result = chunked_result;
     } break;
@@ -868,7 +968,9 @@ Status TransferColumnData(RecordReader* reader,
     case ::arrow::Type::BINARY:
     case ::arrow::Type::STRING:
     case ::arrow::Type::LARGE_BINARY:
-    case ::arrow::Type::LARGE_STRING: {
+    case ::arrow::Type::LARGE_STRING:
+    case ::arrow::Type::BINARY_VIEW:
+    case ::arrow::Type::STRING_VIEW: {
       RETURN_NOT_OK(TransferBinary(reader, pool, value_field, &chunked_result));
       result = chunked_result;
     } break;
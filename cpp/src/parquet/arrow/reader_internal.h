@@ -22,6 +22,8 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -30,6 +32,7 @@
 #include "parquet/column_reader.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 
@@ -111,6 +114,19 @@ class FileColumnIterator {
 using FileColumnIteratorFactory =
     std::function<FileColumnIterator*(int, ParquetFileReader*)>;
 
+/// Rows selected from some row groups, see FileReader::SetRowRanges
+struct RowRangesSelection {
+  std::unordered_map<int, RowRanges> row_ranges;
+  // The page index reader of the file is not thread-safe.  Shared by all
+  // selections of the same file.
+  std::shared_ptr<std::mutex> page_index_mutex = std::make_shared<std::mutex>();
+
+  const RowRanges* Find(int row_group) const {
+    auto it = row_ranges.find(row_group);
+    return it == row_ranges.end() ? NULLPTR : &it->second;
+  }
+};
+
 struct ReaderContext {
   ParquetFileReader* reader;
   ::arrow::MemoryPool* pool;
@@ -118,6 +134,8 @@ struct ReaderContext {
   bool filter_leaves;
   std::shared_ptr<std::unordered_set<int>> included_leaves;
   ArrowReaderProperties* reader_properties;
+  // Null if all rows of every row group are read
+  std::shared_ptr<RowRangesSelection> row_ranges;
 
   bool IncludesLeaf(int leaf_index) const {
     if (this->filter_leaves) {
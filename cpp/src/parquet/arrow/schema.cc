@@ -478,6 +478,48 @@ bool IsDictionaryReadSupported(const ArrowType& type) {
   return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
 }
 
+// Whether a column of the given physical type can be read directly into a dictionary
+// array with the given value type.  The record reader produces dictionaries of the
+// physical type, which TransferDictionary converts to the value type.
+bool IsDictionaryReadSupported(ParquetType::type physical_type, const ArrowType& type) {
+  switch (physical_type) {
+    case ParquetType::BYTE_ARRAY:
+      return IsDictionaryReadSupported(type);
+    case ParquetType::INT32:
+    case ParquetType::INT64:
+      switch (type.id()) {
+        case ::arrow::Type::INT8:
+        case ::arrow::Type::INT16:
+        case ::arrow::Type::INT32:
+        case ::arrow::Type::INT64:
+        case ::arrow::Type::UINT8:
+        case ::arrow::Type::UINT16:
+        case ::arrow::Type::UINT32:
+        case ::arrow::Type::UINT64:
+        case ::arrow::Type::DATE32:
+        case ::arrow::Type::TIME32:
+        case ::arrow::Type::TIME64:
+        case ::arrow::Type::TIMESTAMP:
+        case ::arrow::Type::DURATION:
+        case ::arrow::Type::DECIMAL128:
+        case ::arrow::Type::DECIMAL256:
+          return true;
+        default:
+          return false;
+      }
+    case ParquetType::FLOAT:
+      return type.id() == ::arrow::Type::FLOAT;
+    case ParquetType::DOUBLE:
+      return type.id() == ::arrow::Type::DOUBLE;
+    case ParquetType::FIXED_LEN_BYTE_ARRAY:
+      return type.id() == ::arrow::Type::FIXED_SIZE_BINARY ||
+             type.id() == ::arrow::Type::DECIMAL128 ||
+             type.id() == ::arrow::Type::DECIMAL256;
+    default:
+      return false;
+  }
+}
+
 // ----------------------------------------------------------------------
 // Schema logic
 
@@ -487,7 +529,7 @@ bool IsDictionaryReadSupported(const ArrowType& type) {
   ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ArrowType> storage_type,
                         GetArrowType(primitive_node, ctx->properties));
   if (ctx->properties.read_dictionary(column_index) &&
-      IsDictionaryReadSupported(*storage_type)) {
+      IsDictionaryReadSupported(primitive_node.physical_type(), *storage_type)) {
     return ::arrow::dictionary(::arrow::int32(), storage_type);
   }
   return storage_type;
@@ -884,6 +926,20 @@ Status GetOriginSchema(const std::shared_ptr<const KeyValueMetadata>& metadata,
 
 Result<bool> ApplyOriginalMetadata(const Field& origin_field, SchemaField* inferred);
 
+// Whether both types are binary types or both are string types, whatever their
+// offset width or whether they are views
+bool IsSameBinaryKind(::arrow::Type::type left, ::arrow::Type::type right) {
+  auto is_binary = [](::arrow::Type::type id) {
+    return id == ::arrow::Type::BINARY || id == ::arrow::Type::LARGE_BINARY ||
+           id == ::arrow::Type::BINARY_VIEW;
+  };
+  auto is_string = [](::arrow::Type::type id) {
+    return id == ::arrow::Type::STRING || id == ::arrow::Type::LARGE_STRING ||
+           id == ::arrow::Type::STRING_VIEW;
+  };
+  return (is_binary(left) && is_binary(right)) || (is_string(left) && is_string(right));
+}
+
 std::function<std::shared_ptr<::arrow::DataType>(FieldVector)> GetNestedFactory(
     const ArrowType& origin_type, const ArrowType& inferred_type) {
   switch (inferred_type.id()) {
@@ -927,6 +983,21 @@ Result<bool> ApplyOriginalStorageMetadata(const Field& origin_field,
   auto& origin_type = origin_field.type();
   auto& inferred_type = inferred->field->type();
 
+  if (inferred_type->id() == ::arrow::Type::DICTIONARY &&
+      origin_type->id() != ::arrow::Type::DICTIONARY) {
+    const auto& dict_type = checked_cast<const ::arrow::DictionaryType&>(*inferred_type);
+    if (!IsDictionaryReadSupported(*dict_type.value_type())) {
+      // A fixed-width column read directly as dictionary, restore its value type
+      SchemaField value_inferred;
+      value_inferred.field = inferred->field->WithType(dict_type.value_type());
+      ARROW_ASSIGN_OR_RAISE(modified,
+                            ApplyOriginalStorageMetadata(origin_field, &value_inferred));
+      inferred->field = value_inferred.field->WithType(
+          ::arrow::dictionary(dict_type.index_type(), value_inferred.field->type()));
+      return modified;
+    }
+  }
+
   const int num_children = inferred_type->num_fields();
 
   if (num_children > 0 && origin_type->num_fields() == num_children) {
@@ -994,11 +1065,10 @@ Result<bool> ApplyOriginalStorageMetadata(const Field& origin_field,
     modified = true;
   }
 
-  if ((origin_type->id() == ::arrow::Type::LARGE_BINARY &&
-       inferred_type->id() == ::arrow::Type::BINARY) ||
-      (origin_type->id() == ::arrow::Type::LARGE_STRING &&
-       inferred_type->id() == ::arrow::Type::STRING)) {
-    // Read back binary-like arrays with the intended offset width.
+  if (origin_type->id() != inferred_type->id() &&
+      IsSameBinaryKind(origin_type->id(), inferred_type->id())) {
+    // Read back binary-like arrays with the intended offset width or as views,
+    // whatever ArrowReaderProperties::binary_type() is.
     inferred->field = inferred->field->WithType(origin_type);
     modified = true;
   }
@@ -112,22 +112,41 @@ Result<std::shared_ptr<ArrowType>> MakeArrowTimestamp(const LogicalType& logical
 
 Result<std::shared_ptr<ArrowType>> FromByteArray(
     const LogicalType& logical_type, const ArrowReaderProperties& reader_properties) {
+  std::shared_ptr<ArrowType> binary_type;
+  std::shared_ptr<ArrowType> string_type;
+  switch (reader_properties.binary_type()) {
+    case ::arrow::Type::BINARY:
+      binary_type = ::arrow::binary();
+      string_type = ::arrow::utf8();
+      break;
+    case ::arrow::Type::LARGE_BINARY:
+      binary_type = ::arrow::large_binary();
+      string_type = ::arrow::large_utf8();
+      break;
+    case ::arrow::Type::BINARY_VIEW:
+      binary_type = ::arrow::binary_view();
+      string_type = ::arrow::utf8_view();
+      break;
+    default:
+      return Status::Invalid("Cannot read BYTE_ARRAY columns as binary type ",
+                             reader_properties.binary_type());
+  }
   switch (logical_type.type()) {
     case LogicalType::Type::STRING:
-      return ::arrow::utf8();
+      return string_type;
     case LogicalType::Type::DECIMAL:
       return MakeArrowDecimal(logical_type);
     case LogicalType::Type::NONE:
     case LogicalType::Type::ENUM:
     case LogicalType::Type::BSON:
-      return ::arrow::binary();
+      return binary_type;
     case LogicalType::Type::JSON:
       if (reader_properties.get_arrow_extensions_enabled()) {
-        return ::arrow::extension::json(::arrow::utf8());
+        return ::arrow::extension::json(string_type);
       }
       // When the original Arrow schema isn't stored and Arrow extensions are disabled,
-      // LogicalType::JSON is read as utf8().
-      return ::arrow::utf8();
+      // LogicalType::JSON is read as a string type.
+      return string_type;
     default:
       return Status::NotImplemented("Unhandled logical logical_type ",
                                     logical_type.ToString(), " for binary array");
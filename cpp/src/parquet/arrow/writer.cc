@@ -307,9 +307,7 @@ class FileWriterImpl : public FileWriter {
 
   Status NewRowGroup() override {
     RETURN_NOT_OK(CheckClosed());
-    if (row_group_writer_ != nullptr) {
-      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
-    }
+    RETURN_NOT_OK(CloseRowGroup());
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendRowGroup());
     return Status::OK();
   }
@@ -318,9 +316,7 @@ class FileWriterImpl : public FileWriter {
     if (!closed_) {
       // Make idempotent
       closed_ = true;
-      if (row_group_writer_ != nullptr) {
-        PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
-      }
+      RETURN_NOT_OK(CloseRowGroup());
       PARQUET_CATCH_NOT_OK(writer_->Close());
     }
     return Status::OK();
@@ -343,6 +339,9 @@ class FileWriterImpl : public FileWriter {
   Status WriteColumnChunk(const std::shared_ptr<ChunkedArray>& data, int64_t offset,
                           int64_t size) override {
     RETURN_NOT_OK(CheckClosed());
+    if (row_group_writer_ == nullptr) {
+      return Status::Invalid("Cannot write column chunk without a row group.");
+    }
     if (arrow_properties_->engine_version() == ArrowWriterProperties::V2 ||
         arrow_properties_->engine_version() == ArrowWriterProperties::V1) {
       if (row_group_writer_->buffered()) {
@@ -379,6 +378,27 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (arrow_properties_->use_threads()) {
+        // Encode the columns in parallel into a buffered row group, which is then
+        // written to the file in column order
+        RETURN_NOT_OK(NewBufferedRowGroup());
+        std::vector<std::unique_ptr<ArrowColumnWriterV2>> writers;
+        int column_index_start = 0;
+        for (int i = 0; i < table.num_columns(); i++) {
+          ARROW_ASSIGN_OR_RAISE(
+              std::unique_ptr<ArrowColumnWriterV2> writer,
+              ArrowColumnWriterV2::Make(*table.column(i), offset, size, schema_manifest_,
+                                        row_group_writer_, column_index_start));
+          column_index_start += writer->leaf_count();
+          writers.emplace_back(std::move(writer));
+        }
+        RETURN_NOT_OK(WriteInParallel(writers));
+        // Like row groups written column by column, don't append later record
+        // batches to it
+        RETURN_NOT_OK(CloseRowGroup());
+        row_group_writer_ = nullptr;
+        return Status::OK();
+      }
       RETURN_NOT_OK(NewRowGroup());
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -403,9 +423,7 @@ class FileWriterImpl : public FileWriter {
 
   Status NewBufferedRowGroup() override {
     RETURN_NOT_OK(CheckClosed());
-    if (row_group_writer_ != nullptr) {
-      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
-    }
+    RETURN_NOT_OK(CloseRowGroup());
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
     return Status::OK();
   }
@@ -444,11 +462,7 @@ class FileWriterImpl : public FileWriter {
       }
 
       if (arrow_properties_->use_threads()) {
-        DCHECK_EQ(parallel_column_write_contexts_.size(), writers.size());
-        RETURN_NOT_OK(::arrow::internal::ParallelFor(
-            static_cast<int>(writers.size()),
-            [&](int i) { return writers[i]->Write(&parallel_column_write_contexts_[i]); },
-            arrow_properties_->executor()));
+        RETURN_NOT_OK(WriteInParallel(writers));
       }
 
       return Status::OK();
@@ -493,6 +507,38 @@ class FileWriterImpl : public FileWriter {
  private:
   friend class FileWriter;
 
+  // Write one column writer per field of the schema, in parallel
+  Status WriteInParallel(
+      const std::vector<std::unique_ptr<ArrowColumnWriterV2>>& writers) {
+    DCHECK_EQ(parallel_column_write_contexts_.size(), writers.size());
+    return ::arrow::internal::ParallelFor(
+        static_cast<int>(writers.size()),
+        [&](int i) { return writers[i]->Write(&parallel_column_write_contexts_[i]); },
+        arrow_properties_->executor());
+  }
+
+  Status CloseRowGroup() {
+    if (row_group_writer_ == nullptr) {
+      return Status::OK();
+    }
+    if (arrow_properties_->use_threads() && row_group_writer_->buffered()) {
+      // Closing a buffered row group encodes and compresses the pending pages of each
+      // column before copying them into the file.  Do the former in parallel.
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(
+          row_group_writer_->num_columns(),
+          [&](int i) {
+            ColumnWriter* column_writer = row_group_writer_->column(i);
+            if (column_writer != nullptr) {
+              PARQUET_CATCH_NOT_OK(column_writer->FlushPages());
+            }
+            return Status::OK();
+          },
+          arrow_properties_->executor()));
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    return Status::OK();
+  }
+
   std::shared_ptr<::arrow::Schema> schema_;
 
   SchemaManifest schema_manifest_;
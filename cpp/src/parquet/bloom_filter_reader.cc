@@ -16,6 +16,8 @@
 // under the License.
 
 #include "parquet/bloom_filter_reader.h"
+
+#include "arrow/io/memory.h"
 #include "parquet/bloom_filter.h"
 #include "parquet/exception.h"
 #include "parquet/metadata.h"
@@ -24,12 +26,15 @@ namespace parquet {
 
 class RowGroupBloomFilterReaderImpl final : public RowGroupBloomFilterReader {
  public:
-  RowGroupBloomFilterReaderImpl(std::shared_ptr<::arrow::io::RandomAccessFile> input,
-                                std::shared_ptr<RowGroupMetaData> row_group_metadata,
-                                const ReaderProperties& properties)
+  RowGroupBloomFilterReaderImpl(
+      std::shared_ptr<::arrow::io::RandomAccessFile> input,
+      std::shared_ptr<RowGroupMetaData> row_group_metadata,
+      const ReaderProperties& properties,
+      std::shared_ptr<::arrow::io::internal::ReadRangeCache> cache)
       : input_(std::move(input)),
         row_group_metadata_(std::move(row_group_metadata)),
-        properties_(properties) {}
+        properties_(properties),
+        cache_(std::move(cache)) {}
 
   std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override;
 
@@ -42,6 +47,9 @@ class RowGroupBloomFilterReaderImpl final : public RowGroupBloomFilterReader {
 
   /// Reader properties used to deserialize thrift object.
   const ReaderProperties& properties_;
+
+  /// The cache of prefetched bloom filters, may be nullptr.
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cache_;
 };
 
 std::unique_ptr<BloomFilter> RowGroupBloomFilterReaderImpl::GetColumnBloomFilter(int i) {
@@ -72,6 +80,16 @@ std::unique_ptr<BloomFilter> RowGroupBloomFilterReaderImpl::GetColumnBloomFilter
       throw ParquetException(
           "bloom filter length + bloom filter offset greater than file size");
     }
+    if (cache_ != nullptr) {
+      // Only bloom filters requested by WillNeed() are in the cache
+      auto buffer = cache_->Read({*bloom_filter_offset, *bloom_filter_length});
+      if (buffer.ok()) {
+        ::arrow::io::BufferReader reader(*std::move(buffer));
+        auto bloom_filter =
+            BlockSplitBloomFilter::Deserialize(properties_, &reader, bloom_filter_length);
+        return std::make_unique<BlockSplitBloomFilter>(std::move(bloom_filter));
+      }
+    }
   }
   auto stream = ::arrow::io::RandomAccessFile::GetStream(
       input_, *bloom_filter_offset, file_size - *bloom_filter_offset);
@@ -101,7 +119,49 @@ class BloomFilterReaderImpl final : public BloomFilterReader {
 
     auto row_group_metadata = file_metadata_->RowGroup(i);
     return std::make_shared<RowGroupBloomFilterReaderImpl>(
-        input_, std::move(row_group_metadata), properties_);
+        input_, std::move(row_group_metadata), properties_, cache_);
+  }
+
+  void WillNeed(const std::vector<int32_t>& row_group_indices,
+                const std::vector<int32_t>& column_indices,
+                const ::arrow::io::IOContext& io_context,
+                const ::arrow::io::CacheOptions& cache_options) override {
+    std::vector<::arrow::io::ReadRange> ranges;
+    for (int32_t row_group_ordinal : row_group_indices) {
+      if (row_group_ordinal < 0 ||
+          row_group_ordinal >= file_metadata_->num_row_groups()) {
+        throw ParquetException("Invalid row group ordinal: ", row_group_ordinal);
+      }
+      auto row_group_metadata = file_metadata_->RowGroup(row_group_ordinal);
+      auto add_column = [&](int32_t column_ordinal) {
+        if (column_ordinal < 0 || column_ordinal >= row_group_metadata->num_columns()) {
+          throw ParquetException("Invalid column ordinal: ", column_ordinal);
+        }
+        auto col_chunk = row_group_metadata->ColumnChunk(column_ordinal);
+        auto offset = col_chunk->bloom_filter_offset();
+        auto length = col_chunk->bloom_filter_length();
+        if (offset.has_value() && length.has_value() && *offset >= 0 && *length > 0) {
+          ranges.push_back({*offset, *length});
+        }
+      };
+      if (column_indices.empty()) {
+        for (int32_t j = 0; j < row_group_metadata->num_columns(); ++j) {
+          add_column(j);
+        }
+      } else {
+        for (int32_t column_ordinal : column_indices) {
+          add_column(column_ordinal);
+        }
+      }
+    }
+
+    if (ranges.empty()) {
+      cache_ = nullptr;
+      return;
+    }
+    cache_ = std::make_shared<::arrow::io::internal::ReadRangeCache>(input_, io_context,
+                                                                     cache_options);
+    PARQUET_THROW_NOT_OK(cache_->Cache(std::move(ranges)));
   }
 
  private:
@@ -113,8 +173,16 @@ class BloomFilterReaderImpl final : public BloomFilterReader {
 
   /// Reader properties used to deserialize thrift object.
   const ReaderProperties& properties_;
+
+  /// The cache of bloom filters requested by WillNeed(), may be nullptr.
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cache_;
 };
 
+void BloomFilterReader::WillNeed(const std::vector<int32_t>& row_group_indices,
+                                 const std::vector<int32_t>& column_indices,
+                                 const ::arrow::io::IOContext& io_context,
+                                 const ::arrow::io::CacheOptions& cache_options) {}
+
 std::unique_ptr<BloomFilterReader> BloomFilterReader::Make(
     std::shared_ptr<::arrow::io::RandomAccessFile> input,
     std::shared_ptr<FileMetaData> file_metadata, const ReaderProperties& properties,
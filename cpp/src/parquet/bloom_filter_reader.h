@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <vector>
+
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "parquet/properties.h"
 #include "parquet/type_fwd.h"
@@ -63,6 +66,27 @@ class PARQUET_EXPORT BloomFilterReader {
   ///          to the RowGroupBloomFilterReader.
   /// \throws ParquetException if the index is out of bound.
   virtual std::shared_ptr<RowGroupBloomFilterReader> RowGroup(int i) = 0;
+
+  /// \brief Advise the reader which bloom filters will be read later.
+  ///
+  /// The bloom filters of the given column chunks are read with coalesced reads
+  /// and cached, so that follow-up calls to
+  /// RowGroupBloomFilterReader::GetColumnBloomFilter() do not issue one small read
+  /// per column chunk. Only bloom filters whose length is recorded in the column
+  /// chunk metadata can be prefetched; other bloom filters, and bloom filters that
+  /// were not requested here, are still read on demand. Later calls to WillNeed()
+  /// replace the previous prefetch.  The default implementation does nothing.
+  ///
+  /// \param[in] row_group_indices list of row group ordinal to read bloom filter later.
+  /// \param[in] column_indices list of column ordinal to read bloom filter later. If it
+  ///            is empty, it means all columns in the row group will be read.
+  /// \param[in] io_context the IO context to issue the reads with.
+  /// \param[in] cache_options options to coalesce the reads.
+  /// \throws ParquetException if any of the indices is out of bound.
+  virtual void WillNeed(const std::vector<int32_t>& row_group_indices,
+                        const std::vector<int32_t>& column_indices,
+                        const ::arrow::io::IOContext& io_context,
+                        const ::arrow::io::CacheOptions& cache_options);
 };
 
 }  // namespace parquet
@@ -64,6 +64,37 @@ TEST(BloomFilterReader, ReadBloomFilter) {
   }
 }
 
+TEST(BloomFilterReader, WillNeed) {
+  // Only the second file records the bloom filter length, but both files must
+  // return the same bloom filters whether or not they were prefetched.
+  std::vector<std::string> files = {"data_index_bloom_encoding_stats.parquet",
+                                    "data_index_bloom_encoding_with_length.parquet"};
+  for (const auto& test_file : files) {
+    std::string dir_string(parquet::test::get_data_dir());
+    std::string path = dir_string + "/" + test_file;
+    auto reader = ParquetFileReader::OpenFile(path, /*memory_map=*/false);
+    auto& bloom_filter_reader = reader->GetBloomFilterReader();
+    bloom_filter_reader.WillNeed({0}, {0}, ::arrow::io::default_io_context(),
+                                 ::arrow::io::CacheOptions::LazyDefaults());
+    auto bloom_filter = bloom_filter_reader.RowGroup(0)->GetColumnBloomFilter(0);
+    ASSERT_NE(nullptr, bloom_filter);
+
+    std::string_view exists = "Hello";
+    ByteArray exists_ba{exists};
+    EXPECT_TRUE(bloom_filter->FindHash(bloom_filter->Hash(&exists_ba)));
+    std::string_view not_exists = "NOT_EXISTS";
+    ByteArray not_exists_ba{not_exists};
+    EXPECT_FALSE(bloom_filter->FindHash(bloom_filter->Hash(&not_exists_ba)));
+
+    EXPECT_THROW(bloom_filter_reader.WillNeed({1}, {}, ::arrow::io::default_io_context(),
+                                              ::arrow::io::CacheOptions::Defaults()),
+                 ParquetException);
+    EXPECT_THROW(bloom_filter_reader.WillNeed({0}, {1}, ::arrow::io::default_io_context(),
+                                              ::arrow::io::CacheOptions::Defaults()),
+                 ParquetException);
+  }
+}
+
 TEST(BloomFilterReader, FileNotHaveBloomFilter) {
   // Can still get a BloomFilterReader and a RowGroupBloomFilter
   // reader, but cannot get a non-null BloomFilter.
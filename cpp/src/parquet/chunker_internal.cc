@@ -0,0 +1,188 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/chunker_internal.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "parquet/exception.h"
+
+namespace parquet::internal {
+
+using ::arrow::internal::checked_cast;
+
+namespace {
+
+// Fill the gear table with splitmix64.  The table must never change, since that would
+// move all the chunk boundaries and defeat the deduplication of existing files.
+constexpr std::array<uint64_t, 256> MakeGearTable() {
+  std::array<uint64_t, 256> table{};
+  uint64_t state = 0x9E3779B97F4A7C15ULL;
+  for (uint64_t& entry : table) {
+    state += 0x9E3779B97F4A7C15ULL;
+    uint64_t z = state;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    entry = z ^ (z >> 31);
+  }
+  return table;
+}
+
+constexpr std::array<uint64_t, 256> kGearTable = MakeGearTable();
+
+// Select the high bits of the hash.  With hash = (hash << 1) + GEAR[byte], bit i only
+// mixes in the last i + 1 bytes: the newest byte feeds the low bits and older bytes
+// are shifted towards the high bits.  Testing the high bits therefore makes a boundary
+// depend on the whole 64-byte window rather than on the last few bytes.  A boundary is
+// then expected about every 2**bits bytes after min_chunk_size.
+uint64_t CalculateMask(const CdcOptions& options) {
+  const int64_t target =
+      std::max<int64_t>((options.max_chunk_size - options.min_chunk_size) / 2, 1);
+  const int floor_log2 =
+      63 - ::arrow::bit_util::CountLeadingZeros(static_cast<uint64_t>(target));
+  const int bits = std::clamp(floor_log2 - options.norm_level, 1, 63);
+  return ~uint64_t{0} << (64 - bits);
+}
+
+using ValueView = std::function<std::string_view(int64_t)>;
+
+// Return the bytes of a value as they are hashed
+ValueView MakeValueView(const ::arrow::Array& values) {
+  const ::arrow::DataType& type = *values.type();
+  switch (type.id()) {
+    case ::arrow::Type::BOOL:
+      return [array = std::make_shared<::arrow::BooleanArray>(values.data())](int64_t i) {
+        static constexpr char kBytes[] = {0, 1};
+        return std::string_view(kBytes + (array->Value(i) ? 1 : 0), 1);
+      };
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+      return [array = std::make_shared<::arrow::BinaryArray>(values.data())](int64_t i) {
+        return array->GetView(i);
+      };
+    case ::arrow::Type::LARGE_BINARY:
+    case ::arrow::Type::LARGE_STRING:
+      return [array = std::make_shared<::arrow::LargeBinaryArray>(values.data())](int64_t i) {
+        return array->GetView(i);
+      };
+    case ::arrow::Type::BINARY_VIEW:
+    case ::arrow::Type::STRING_VIEW:
+      return [array = std::make_shared<::arrow::BinaryViewArray>(values.data())](int64_t i) {
+        return array->GetView(i);
+      };
+    case ::arrow::Type::DICTIONARY: {
+      auto dict_array = std::make_shared<::arrow::DictionaryArray>(values.data());
+      return [dict_array, dictionary = MakeValueView(*dict_array->dictionary())](
+                 int64_t i) { return dictionary(dict_array->GetValueIndex(i)); };
+    }
+    default:
+      break;
+  }
+  if (::arrow::is_fixed_width(type.id()) && type.id() != ::arrow::Type::NA) {
+    const int byte_width = checked_cast<const ::arrow::FixedWidthType&>(type).byte_width();
+    const char* data = values.data()->GetValues<char>(1, 0) + values.offset() * byte_width;
+    return [data, byte_width](int64_t i) {
+      return std::string_view(data + i * byte_width, byte_width);
+    };
+  }
+  return [](int64_t) { return std::string_view(); };
+}
+
+}  // namespace
+
+ContentDefinedChunker::ContentDefinedChunker(const LevelInfo& level_info,
+                                             const CdcOptions& options)
+    : level_info_(level_info),
+      min_chunk_size_(options.min_chunk_size),
+      max_chunk_size_(options.max_chunk_size),
+      mask_(CalculateMask(options)) {
+  if (min_chunk_size_ <= 0 || max_chunk_size_ < min_chunk_size_) {
+    throw ParquetException(
+        "Content-defined chunking requires 0 < min_chunk_size <= max_chunk_size");
+  }
+}
+
+void ContentDefinedChunker::Roll(const uint8_t* data, int64_t length) {
+  for (int64_t i = 0; i < length; ++i) {
+    rolling_hash_ = (rolling_hash_ << 1) + kGearTable[data[i]];
+    if ((rolling_hash_ & mask_) == 0 && chunk_size_ + i + 1 >= min_chunk_size_) {
+      boundary_pending_ = true;
+    }
+  }
+  chunk_size_ += length;
+}
+
+std::vector<Chunk> ContentDefinedChunker::GetChunks(const int16_t* def_levels,
+                                                    const int16_t* rep_levels,
+                                                    int64_t num_levels,
+                                                    const ::arrow::Array& values) {
+  const ValueView value_view = MakeValueView(values);
+  std::vector<Chunk> chunks;
+  int64_t chunk_level_offset = 0;
+  int64_t chunk_value_offset = 0;
+  int64_t value_offset = 0;
+  for (int64_t level = 0; level < num_levels; ++level) {
+    const int16_t def_level = def_levels ? def_levels[level] : level_info_.def_level;
+    const int16_t rep_level = rep_levels ? rep_levels[level] : 0;
+    if (boundary_pending_ && rep_level == 0) {
+      chunks.push_back({chunk_level_offset, chunk_value_offset,
+                        level - chunk_level_offset, value_offset - chunk_value_offset});
+      chunk_level_offset = level;
+      chunk_value_offset = value_offset;
+      boundary_pending_ = false;
+      chunk_size_ = 0;
+    }
+
+    // Levels are hashed as little-endian 16-bit integers
+    if (level_info_.def_level > 0) {
+      const uint8_t bytes[] = {static_cast<uint8_t>(def_level),
+                               static_cast<uint8_t>(def_level >> 8)};
+      Roll(bytes, sizeof(bytes));
+    }
+    if (level_info_.rep_level > 0) {
+      const uint8_t bytes[] = {static_cast<uint8_t>(rep_level),
+                               static_cast<uint8_t>(rep_level >> 8)};
+      Roll(bytes, sizeof(bytes));
+    }
+    if (def_level == level_info_.def_level) {
+      std::string_view value = value_view(value_offset);
+      Roll(reinterpret_cast<const uint8_t*>(value.data()),
+           static_cast<int64_t>(value.size()));
+    }
+    if (def_level >= level_info_.repeated_ancestor_def_level) {
+      ++value_offset;
+    }
+    if (chunk_size_ >= max_chunk_size_) {
+      boundary_pending_ = true;
+    }
+  }
+  DCHECK_EQ(value_offset, values.length());
+  chunks.push_back({chunk_level_offset, chunk_value_offset,
+                    num_levels - chunk_level_offset, value_offset - chunk_value_offset});
+  return chunks;
+}
+
+}  // namespace parquet::internal
@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/type_fwd.h"
+#include "parquet/level_conversion.h"
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+
+namespace parquet::internal {
+
+/// \brief A run of levels of a column and the leaf values they cover
+struct Chunk {
+  int64_t level_offset;
+  int64_t value_offset;
+  int64_t levels_to_write;
+  int64_t values_to_write;
+};
+
+/// \brief Split the levels and values written to a column at content-defined
+/// boundaries
+///
+/// A gear hash rolls over the bytes of the levels and of the non-null values.  A
+/// chunk ends where the high bits of the hash are all zero once the chunk holds at
+/// least CdcOptions::min_chunk_size bytes, or where it reaches
+/// CdcOptions::max_chunk_size bytes.  Chunks of repeated columns end at record
+/// boundaries.  Since the hash only depends on the last 64 bytes, the boundaries of
+/// unchanged data are found again after an insertion or a removal.
+///
+/// The state carries over calls of GetChunks(), so the boundaries don't depend on how
+/// the column is split into batches.
+class PARQUET_EXPORT ContentDefinedChunker {
+ public:
+  ContentDefinedChunker(const LevelInfo& level_info, const CdcOptions& options);
+
+  /// \brief Return the chunks of a batch of levels and values
+  ///
+  /// The chunks cover the whole batch, in order, and a chunk boundary falls between
+  /// each of them.  The first chunk continues the last chunk of the previous batch,
+  /// unless it is empty, in which case the boundary falls right before the batch.
+  ///
+  /// \param[in] def_levels definition levels, may be null if the column is required
+  /// \param[in] rep_levels repetition levels, may be null if the column isn't repeated
+  /// \param[in] num_levels number of levels
+  /// \param[in] values the leaf values, one for each level whose definition level is
+  ///            at least LevelInfo::repeated_ancestor_def_level.  Values of types
+  ///            other than boolean, fixed-width, binary-like and dictionaries of
+  ///            those don't contribute to the hash.
+  std::vector<Chunk> GetChunks(const int16_t* def_levels, const int16_t* rep_levels,
+                               int64_t num_levels, const ::arrow::Array& values);
+
+ private:
+  void Roll(const uint8_t* data, int64_t length);
+
+  const LevelInfo level_info_;
+  const int64_t min_chunk_size_;
+  const int64_t max_chunk_size_;
+  const uint64_t mask_;
+
+  uint64_t rolling_hash_ = 0;
+  // Number of bytes rolled since the last boundary
+  int64_t chunk_size_ = 0;
+  // Whether the hash matched and the chunk ends at the next record boundary
+  bool boundary_pending_ = false;
+};
+
+}  // namespace parquet::internal
@@ -0,0 +1,174 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+#include "parquet/chunker_internal.h"
+#include "parquet/exception.h"
+#include "parquet/level_conversion.h"
+#include "parquet/properties.h"
+
+namespace parquet::internal {
+
+namespace {
+
+constexpr int64_t kMinChunkSize = 4 * 1024;
+constexpr int64_t kMaxChunkSize = 16 * 1024;
+
+CdcOptions TestOptions() {
+  CdcOptions options;
+  options.min_chunk_size = kMinChunkSize;
+  options.max_chunk_size = kMaxChunkSize;
+  return options;
+}
+
+LevelInfo RequiredLevelInfo() {
+  LevelInfo level_info;
+  level_info.def_level = 0;
+  level_info.rep_level = 0;
+  level_info.repeated_ancestor_def_level = 0;
+  return level_info;
+}
+
+// Return the level offsets of the chunk boundaries of a required column written in
+// batches of `batch_size` values
+std::vector<int64_t> Boundaries(const ::arrow::Array& values, int64_t batch_size) {
+  ContentDefinedChunker chunker(RequiredLevelInfo(), TestOptions());
+  std::vector<int64_t> boundaries;
+  for (int64_t offset = 0; offset < values.length(); offset += batch_size) {
+    auto batch = values.Slice(offset, batch_size);
+    std::vector<Chunk> chunks =
+        chunker.GetChunks(nullptr, nullptr, batch->length(), *batch);
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      EXPECT_EQ(chunks[i].levels_to_write, chunks[i].values_to_write);
+      // An empty first chunk puts a boundary before the batch
+      if (i > 0 && chunks[i - 1].levels_to_write > 0) {
+        boundaries.push_back(offset + chunks[i].level_offset);
+      } else if (i == 0 && chunks[i].levels_to_write == 0) {
+        boundaries.push_back(offset);
+      }
+    }
+  }
+  return boundaries;
+}
+
+}  // namespace
+
+TEST(ContentDefinedChunker, ChunkSizes) {
+  auto values = ::arrow::random::RandomArrayGenerator(42).Int64(100000, 0, 1000, 0);
+  std::vector<int64_t> boundaries = Boundaries(*values, values->length());
+  ASSERT_GT(boundaries.size(), 10);
+  int64_t previous = 0;
+  for (int64_t boundary : boundaries) {
+    const int64_t chunk_size = (boundary - previous) * sizeof(int64_t);
+    ASSERT_GE(chunk_size, kMinChunkSize);
+    ASSERT_LE(chunk_size, kMaxChunkSize + static_cast<int64_t>(sizeof(int64_t)));
+    previous = boundary;
+  }
+}
+
+TEST(ContentDefinedChunker, IndependentOfBatches) {
+  auto values = ::arrow::random::RandomArrayGenerator(42).Int64(100000, 0, 1000, 0);
+  std::vector<int64_t> expected = Boundaries(*values, values->length());
+  for (int64_t batch_size : {1, 1000, 1024, 33333}) {
+    ARROW_SCOPED_TRACE("batch_size = ", batch_size);
+    ASSERT_EQ(expected, Boundaries(*values, batch_size));
+  }
+}
+
+TEST(ContentDefinedChunker, StableAfterInsertion) {
+  constexpr int64_t kInsertAt = 30000;
+  constexpr int64_t kInserted = 100;
+  ::arrow::random::RandomArrayGenerator rng(42);
+  auto values = rng.Int64(100000, 0, 1000, 0);
+  ASSERT_OK_AND_ASSIGN(
+      auto modified,
+      ::arrow::Concatenate({values->Slice(0, kInsertAt), rng.Int64(kInserted, 0, 1000, 0),
+                            values->Slice(kInsertAt)}));
+  std::vector<int64_t> original = Boundaries(*values, 1024);
+  std::set<int64_t> shifted;
+  for (int64_t boundary : Boundaries(*modified, 1024)) {
+    shifted.insert(boundary < kInsertAt ? boundary : boundary - kInserted);
+  }
+
+  // The boundaries before the insertion are unchanged, and those after it are found
+  // again once the chunker resynchronizes with the original data
+  ASSERT_GT(original.size(), 20);
+  for (size_t i = 0; i < original.size(); ++i) {
+    if (original[i] < kInsertAt || i + 10 >= original.size()) {
+      ASSERT_EQ(1, shifted.count(original[i])) << "boundary " << original[i];
+    }
+  }
+}
+
+TEST(ContentDefinedChunker, RecordBoundaries) {
+  // A required list of required int64
+  LevelInfo level_info;
+  level_info.def_level = 1;
+  level_info.rep_level = 1;
+  level_info.repeated_ancestor_def_level = 1;
+  std::default_random_engine engine(42);
+  std::uniform_int_distribution<int> list_length(1, 50);
+  std::vector<int16_t> def_levels;
+  std::vector<int16_t> rep_levels;
+  while (def_levels.size() < 100000) {
+    const int length = list_length(engine);
+    for (int i = 0; i < length; ++i) {
+      def_levels.push_back(1);
+      rep_levels.push_back(i == 0 ? 0 : 1);
+    }
+  }
+  const int64_t num_levels = static_cast<int64_t>(def_levels.size());
+  auto values = ::arrow::random::RandomArrayGenerator(42).Int64(num_levels, 0, 1000, 0);
+
+  ContentDefinedChunker chunker(level_info, TestOptions());
+  std::vector<Chunk> chunks =
+      chunker.GetChunks(def_levels.data(), rep_levels.data(), num_levels, *values);
+  ASSERT_GT(chunks.size(), 10);
+  int64_t level_offset = 0;
+  for (const Chunk& chunk : chunks) {
+    ASSERT_EQ(level_offset, chunk.level_offset);
+    ASSERT_EQ(chunk.level_offset, chunk.value_offset);
+    ASSERT_EQ(0, rep_levels[chunk.level_offset]);
+    level_offset += chunk.levels_to_write;
+  }
+  ASSERT_EQ(num_levels, level_offset);
+}
+
+TEST(ContentDefinedChunker, InvalidOptions) {
+  CdcOptions options;
+  options.min_chunk_size = 0;
+  ASSERT_THROW(ContentDefinedChunker(RequiredLevelInfo(), options), ParquetException);
+  options.min_chunk_size = 1024;
+  options.max_chunk_size = 512;
+  ASSERT_THROW(ContentDefinedChunker(RequiredLevelInfo(), options), ParquetException);
+  ASSERT_THROW(WriterProperties::Builder().content_defined_chunking_options(options),
+               ParquetException);
+}
+
+}  // namespace parquet::internal
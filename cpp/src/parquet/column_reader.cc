@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <exception>
 #include <iostream>
 #include <memory>
@@ -35,15 +36,19 @@
 #include "arrow/array/builder_dict.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/chunked_array.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils_internal.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/crc32.h"
+#include "arrow/util/future.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding_internal.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/unreachable.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
@@ -252,14 +257,26 @@ class SerializedPageReader : public PageReader {
         page_ordinal_(0),
         seen_num_values_(0),
         total_num_values_(total_num_values),
-        decryption_buffer_(AllocateBuffer(properties_.memory_pool(), 0)) {
+        decryption_buffer_(AllocateBuffer(properties_.memory_pool(), 0)),
+        prefetch_depth_(std::max(properties_.page_prefetch_depth(), 0)) {
     if (crypto_ctx != nullptr) {
       crypto_ctx_ = *crypto_ctx;
       InitDecryption();
     }
     max_page_header_size_ = kDefaultMaxPageHeaderSize;
+    codec_ = codec;
     decompressor_ = GetCodec(codec);
     always_compressed_ = always_compressed;
+    if (prefetch_depth_ > 0) {
+      page_slots_.resize(static_cast<size_t>(prefetch_depth_) + 1);
+    }
+  }
+
+  ~SerializedPageReader() override {
+    // Prefetched pages are read on other threads and refer to this object
+    for (auto& prefetched : prefetched_pages_) {
+      prefetched.page.Wait();
+    }
   }
 
   // Implement the PageReader interface
@@ -268,17 +285,65 @@ class SerializedPageReader : public PageReader {
   // beyond the next call to NextPage(). SerializedPageReader reuses the
   // decryption and decompression buffers internally, so if NextPage() is
   // called then the content of previous page might be invalidated.
+  //
+  // If pages are prefetched, the page filter and the maximum page header size
+  // must be set before the first call.  Pages are only prefetched when this is
+  // called off the IO thread pool.
   std::shared_ptr<Page> NextPage() override;
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
  private:
+  // A page read from the stream, still to be decrypted and decompressed
+  struct RawPage {
+    format::PageHeader header;
+    std::shared_ptr<Buffer> buffer;
+    EncodedStatistics statistics;
+    // Null if the page isn't encrypted or compressed
+    Decryptor* decryptor = NULLPTR;
+    ::arrow::util::Codec* decompressor = NULLPTR;
+  };
+
+  // The decryptor and decompressor of a prefetched page
+  struct PageSlot {
+    std::shared_ptr<Decryptor> decryptor;
+    std::unique_ptr<::arrow::util::Codec> decompressor;
+  };
+
+  struct PrefetchedPage {
+    ::arrow::Future<std::shared_ptr<RawPage>> raw_page;
+    ::arrow::Future<std::shared_ptr<Page>> page;
+  };
+
+  std::shared_ptr<Page> ReadNextPage();
+
+  // Read the next page header and the page data, or return null at the end of the
+  // column chunk.  This updates the decryption state, so pages are read in order.
+  std::shared_ptr<RawPage> ReadRawPage();
+
+  // Decrypt and decompress a page.  Prefetched pages are decoded concurrently.
+  std::shared_ptr<Page> DecodePage(const RawPage& raw_page);
+
+  // Read the page after the last prefetched one, then decode it, on the IO thread pool
+  PrefetchedPage PrefetchNextPage();
+
+  // The buffer to decrypt or decompress a page into.  Prefetched and retained pages
+  // outlive the next call to NextPage(), so they don't reuse one.
+  std::shared_ptr<ResizableBuffer> PageBuffer(
+      const std::shared_ptr<ResizableBuffer>& reused_buffer) const {
+    if (prefetch_depth_ > 0 || retain_page_buffers_) {
+      return AllocateBuffer(properties_.memory_pool(), 0);
+    }
+    return reused_buffer;
+  }
+
   void UpdateDecryption(const std::shared_ptr<Decryptor>& decryptor, int8_t module_type,
                         std::string* page_aad);
 
   void InitDecryption();
 
-  std::shared_ptr<Buffer> DecompressIfNeeded(std::shared_ptr<Buffer> page_buffer,
+  std::shared_ptr<Buffer> DecompressIfNeeded(::arrow::util::Codec* decompressor,
+                                             std::shared_ptr<Buffer> page_buffer,
                                              int compressed_len, int uncompressed_len,
                                              int levels_byte_len = 0);
 
@@ -293,6 +358,7 @@ class SerializedPageReader : public PageReader {
   format::PageHeader current_page_header_;
 
   // Compression codec to use.
+  Compression::type codec_;
   std::unique_ptr<::arrow::util::Codec> decompressor_;
   std::shared_ptr<ResizableBuffer> decompression_buffer_;
 
@@ -327,6 +393,16 @@ class SerializedPageReader : public PageReader {
   std::string data_page_header_aad_;
   // Encryption
   std::shared_ptr<ResizableBuffer> decryption_buffer_;
+
+  // Number of pages read ahead of the current one, and the pages being read, in order
+  const int32_t prefetch_depth_;
+  std::deque<PrefetchedPage> prefetched_pages_;
+
+  // Cipher contexts and codecs aren't thread-safe, so each of the prefetch_depth_ + 1
+  // pages in flight is decoded with its own, reused round-robin.  A slot is reused
+  // once the page that had it was returned by NextPage().
+  std::vector<PageSlot> page_slots_;
+  size_t num_raw_pages_ = 0;
 };
 
 void SerializedPageReader::InitDecryption() {
@@ -407,6 +483,78 @@ bool SerializedPageReader::ShouldSkipPage(EncodedStatistics* data_page_statistic
 }
 
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
+  if (prefetch_depth_ == 0) {
+    return ReadNextPage();
+  }
+  if (::arrow::io::default_io_context().executor()->OwnsThisThread()) {
+    // Blocking an IO thread on pages read by other IO threads could deadlock once
+    // all of them wait, and would take a thread from the prefetching anyway.  Read
+    // synchronously instead, after any page which is already in flight.
+    if (prefetched_pages_.empty()) {
+      return ReadNextPage();
+    }
+  } else {
+    while (static_cast<int32_t>(prefetched_pages_.size()) <= prefetch_depth_) {
+      prefetched_pages_.push_back(PrefetchNextPage());
+    }
+  }
+  auto next_page = std::move(prefetched_pages_.front().page);
+  prefetched_pages_.pop_front();
+  PARQUET_ASSIGN_OR_THROW(auto page, next_page.result());
+  return page;
+}
+
+SerializedPageReader::PrefetchedPage SerializedPageReader::PrefetchNextPage() {
+  auto read_page = [this]() -> ::arrow::Result<std::shared_ptr<RawPage>> {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    return ReadRawPage();
+    END_PARQUET_CATCH_EXCEPTIONS
+  };
+  // Decoding is CPU-bound, but the reader may itself be waiting on a CPU thread, so
+  // it stays on the IO thread pool to avoid nested waits on the CPU thread pool.
+  auto* executor = ::arrow::io::default_io_context().executor();
+  const ::arrow::CallbackOptions options{::arrow::ShouldSchedule::Always, executor};
+
+  PrefetchedPage prefetched;
+  if (prefetched_pages_.empty()) {
+    prefetched.raw_page = ::arrow::DeferNotOk(executor->Submit(std::move(read_page)));
+  } else {
+    // Pages are read one after the other from the stream
+    auto read_next_page = [read_page = std::move(read_page)](
+                              const std::shared_ptr<RawPage>& previous) {
+      if (previous == nullptr) {
+        // The column chunk is exhausted
+        return ::arrow::Result<std::shared_ptr<RawPage>>(previous);
+      }
+      return read_page();
+    };
+    prefetched.raw_page =
+        prefetched_pages_.back().raw_page.Then(std::move(read_next_page), {}, options);
+  }
+  // ... but decoded as soon as they are read, in parallel with the following ones
+  auto decode_page =
+      [this](const std::shared_ptr<RawPage>& raw_page)
+      -> ::arrow::Result<std::shared_ptr<Page>> {
+    if (raw_page == nullptr) {
+      return std::shared_ptr<Page>(nullptr);
+    }
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    return DecodePage(*raw_page);
+    END_PARQUET_CATCH_EXCEPTIONS
+  };
+  prefetched.page = prefetched.raw_page.Then(std::move(decode_page), {}, options);
+  return prefetched;
+}
+
+std::shared_ptr<Page> SerializedPageReader::ReadNextPage() {
+  std::shared_ptr<RawPage> raw_page = ReadRawPage();
+  if (raw_page == nullptr) {
+    return nullptr;
+  }
+  return DecodePage(*raw_page);
+}
+
+std::shared_ptr<SerializedPageReader::RawPage> SerializedPageReader::ReadRawPage() {
   ThriftDeserializer deserializer(properties_);
 
   // Loop here because there may be unhandled page types that we skip until
@@ -490,93 +638,132 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       }
     }
 
-    // Decrypt it if we need to
-    if (crypto_ctx_.data_decryptor != nullptr) {
-      PARQUET_THROW_NOT_OK(decryption_buffer_->Resize(
-          crypto_ctx_.data_decryptor->PlaintextLength(compressed_len),
-          /*shrink_to_fit=*/false));
-      compressed_len = crypto_ctx_.data_decryptor->Decrypt(
-          page_buffer->span_as<uint8_t>(),
-          decryption_buffer_->mutable_span_as<uint8_t>());
-
-      page_buffer = decryption_buffer_;
+    auto raw_page = std::make_shared<RawPage>();
+    raw_page->buffer = std::move(page_buffer);
+    raw_page->statistics = std::move(data_page_statistics);
+    raw_page->decryptor = crypto_ctx_.data_decryptor.get();
+    raw_page->decompressor = decompressor_.get();
+    if (prefetch_depth_ > 0) {
+      PageSlot& slot = page_slots_[num_raw_pages_++ % page_slots_.size()];
+      if (raw_page->decryptor != nullptr) {
+        if (slot.decryptor == nullptr) {
+          slot.decryptor = crypto_ctx_.data_decryptor->Clone();
+        }
+        slot.decryptor->UpdateAad(crypto_ctx_.data_decryptor->aad());
+        raw_page->decryptor = slot.decryptor.get();
+      }
+      if (raw_page->decompressor != nullptr) {
+        if (slot.decompressor == nullptr) {
+          slot.decompressor = GetCodec(codec_);
+        }
+        raw_page->decompressor = slot.decompressor.get();
+      }
     }
 
+    // Other page types were skipped by ShouldSkipPage()
     if (page_type == PageType::DICTIONARY_PAGE) {
       crypto_ctx_.start_decrypt_with_dictionary_page = false;
-      const format::DictionaryPageHeader& dict_header =
-          current_page_header_.dictionary_page_header;
-      bool is_sorted = dict_header.__isset.is_sorted ? dict_header.is_sorted : false;
-
-      page_buffer =
-          DecompressIfNeeded(std::move(page_buffer), compressed_len, uncompressed_len);
-
-      return std::make_shared<DictionaryPage>(page_buffer, dict_header.num_values,
-                                              LoadEnumSafe(&dict_header.encoding),
-                                              is_sorted);
-    } else if (page_type == PageType::DATA_PAGE) {
-      ++page_ordinal_;
-      const format::DataPageHeader& header = current_page_header_.data_page_header;
-      page_buffer =
-          DecompressIfNeeded(std::move(page_buffer), compressed_len, uncompressed_len);
-
-      return std::make_shared<DataPageV1>(
-          page_buffer, header.num_values, LoadEnumSafe(&header.encoding),
-          LoadEnumSafe(&header.definition_level_encoding),
-          LoadEnumSafe(&header.repetition_level_encoding), uncompressed_len,
-          std::move(data_page_statistics));
-    } else if (page_type == PageType::DATA_PAGE_V2) {
+    } else {
       ++page_ordinal_;
-      const format::DataPageHeaderV2& header = current_page_header_.data_page_header_v2;
-
-      // Arrow prior to 3.0.0 set is_compressed to false but still compressed.
-      bool is_compressed =
-          (header.__isset.is_compressed ? header.is_compressed : false) ||
-          always_compressed_;
-
-      // Uncompress if needed
-      int levels_byte_len;
-      if (AddWithOverflow(header.definition_levels_byte_length,
-                          header.repetition_levels_byte_length, &levels_byte_len)) {
-        throw ParquetException("Levels size too large (corrupt file?)");
-      }
-      // DecompressIfNeeded doesn't take `is_compressed` into account as
-      // it's page type-agnostic.
-      if (is_compressed) {
-        page_buffer = DecompressIfNeeded(std::move(page_buffer), compressed_len,
-                                         uncompressed_len, levels_byte_len);
-      }
+    }
+    raw_page->header = std::move(current_page_header_);
+    return raw_page;
+  }
+  return nullptr;
+}
 
-      return std::make_shared<DataPageV2>(
-          page_buffer, header.num_values, header.num_nulls, header.num_rows,
-          LoadEnumSafe(&header.encoding), header.definition_levels_byte_length,
-          header.repetition_levels_byte_length, uncompressed_len, is_compressed,
-          std::move(data_page_statistics));
-    } else {
-      throw ParquetException(
-          "Internal error, we have already skipped non-data pages in ShouldSkipPage()");
+std::shared_ptr<Page> SerializedPageReader::DecodePage(const RawPage& raw_page) {
+  const format::PageHeader& page_header = raw_page.header;
+  std::shared_ptr<Buffer> page_buffer = raw_page.buffer;
+  int32_t compressed_len = page_header.compressed_page_size;
+  const int32_t uncompressed_len = page_header.uncompressed_page_size;
+
+  // Decrypt it if we need to
+  if (raw_page.decryptor != nullptr) {
+    std::shared_ptr<ResizableBuffer> decryption_buffer = PageBuffer(decryption_buffer_);
+    PARQUET_THROW_NOT_OK(
+        decryption_buffer->Resize(raw_page.decryptor->PlaintextLength(compressed_len),
+                                  /*shrink_to_fit=*/false));
+    compressed_len = raw_page.decryptor->Decrypt(
+        page_buffer->span_as<uint8_t>(), decryption_buffer->mutable_span_as<uint8_t>());
+
+    page_buffer = std::move(decryption_buffer);
+  }
+
+  const PageType::type page_type = LoadEnumSafe(&page_header.type);
+  if (page_type == PageType::DICTIONARY_PAGE) {
+    const format::DictionaryPageHeader& dict_header = page_header.dictionary_page_header;
+    bool is_sorted = dict_header.__isset.is_sorted ? dict_header.is_sorted : false;
+
+    page_buffer = DecompressIfNeeded(raw_page.decompressor, std::move(page_buffer),
+                                     compressed_len, uncompressed_len);
+
+    return std::make_shared<DictionaryPage>(page_buffer, dict_header.num_values,
+                                            LoadEnumSafe(&dict_header.encoding),
+                                            is_sorted);
+  } else if (page_type == PageType::DATA_PAGE) {
+    const format::DataPageHeader& header = page_header.data_page_header;
+    page_buffer = DecompressIfNeeded(raw_page.decompressor, std::move(page_buffer),
+                                     compressed_len, uncompressed_len);
+
+    return std::make_shared<DataPageV1>(
+        page_buffer, header.num_values, LoadEnumSafe(&header.encoding),
+        LoadEnumSafe(&header.definition_level_encoding),
+        LoadEnumSafe(&header.repetition_level_encoding), uncompressed_len,
+        raw_page.statistics);
+  } else if (page_type == PageType::DATA_PAGE_V2) {
+    const format::DataPageHeaderV2& header = page_header.data_page_header_v2;
+
+    // Arrow prior to 3.0.0 set is_compressed to false but still compressed.
+    bool is_compressed =
+        (header.__isset.is_compressed ? header.is_compressed : false) ||
+        always_compressed_;
+
+    // Uncompress if needed
+    int levels_byte_len;
+    if (AddWithOverflow(header.definition_levels_byte_length,
+                        header.repetition_levels_byte_length, &levels_byte_len)) {
+      throw ParquetException("Levels size too large (corrupt file?)");
+    }
+    // DecompressIfNeeded doesn't take `is_compressed` into account as
+    // it's page type-agnostic.
+    if (is_compressed) {
+      page_buffer =
+          DecompressIfNeeded(raw_page.decompressor, std::move(page_buffer),
+                             compressed_len, uncompressed_len, levels_byte_len);
     }
+
+    return std::make_shared<DataPageV2>(
+        page_buffer, header.num_values, header.num_nulls, header.num_rows,
+        LoadEnumSafe(&header.encoding), header.definition_levels_byte_length,
+        header.repetition_levels_byte_length, uncompressed_len, is_compressed,
+        raw_page.statistics);
+  } else {
+    throw ParquetException(
+        "Internal error, we have already skipped non-data pages in ShouldSkipPage()");
   }
-  return std::shared_ptr<Page>(nullptr);
 }
 
 std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
-    std::shared_ptr<Buffer> page_buffer, int compressed_len, int uncompressed_len,
-    int levels_byte_len) {
-  if (decompressor_ == nullptr) {
+    ::arrow::util::Codec* decompressor, std::shared_ptr<Buffer> page_buffer,
+    int compressed_len, int uncompressed_len, int levels_byte_len) {
+  if (decompressor == nullptr) {
     return page_buffer;
   }
   if (compressed_len < levels_byte_len || uncompressed_len < levels_byte_len) {
     throw ParquetException("Invalid page header");
   }
 
+  std::shared_ptr<ResizableBuffer> decompression_buffer =
+      PageBuffer(decompression_buffer_);
+
   // Grow the uncompressed buffer if we need to.
   PARQUET_THROW_NOT_OK(
-      decompression_buffer_->Resize(uncompressed_len, /*shrink_to_fit=*/false));
+      decompression_buffer->Resize(uncompressed_len, /*shrink_to_fit=*/false));
 
   if (levels_byte_len > 0) {
     // First copy the levels as-is
-    uint8_t* decompressed = decompression_buffer_->mutable_data();
+    uint8_t* decompressed = decompression_buffer->mutable_data();
     memcpy(decompressed, page_buffer->data(), levels_byte_len);
   }
 
@@ -589,10 +776,10 @@ std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
     // Decompress the values
     PARQUET_ASSIGN_OR_THROW(
         decompressed_len,
-        decompressor_->Decompress(
+        decompressor->Decompress(
             compressed_len - levels_byte_len, page_buffer->data() + levels_byte_len,
             uncompressed_len - levels_byte_len,
-            decompression_buffer_->mutable_data() + levels_byte_len));
+            decompression_buffer->mutable_data() + levels_byte_len));
   }
 
   if (decompressed_len != uncompressed_len - levels_byte_len) {
@@ -601,7 +788,7 @@ std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
                            ", but got:" + std::to_string(decompressed_len));
   }
 
-  return decompression_buffer_;
+  return decompression_buffer;
 }
 
 }  // namespace
@@ -2092,6 +2279,211 @@ class ByteArrayChunkedRecordReader final : public TypedRecordReader<ByteArrayTyp
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
+/// ByteArrayViewRecordReader reads BYTE_ARRAY values into BinaryView or StringView
+/// arrays.
+///
+/// Values of up to 12 bytes are inlined in their views.  Longer values that the
+/// decoder points to in the data page, as with the PLAIN and DELTA_LENGTH_BYTE_ARRAY
+/// encodings, are not copied: the views reference the page buffer, which the page
+/// reader is told not to reuse, as a data buffer of the array.  Other values, such
+/// as dictionary entries, are copied into data buffers of the reader.  There is no
+/// limit on the total size of the values, so the reader produces a single chunk.
+///
+/// The `values_` buffer is never used, the values are decoded into `decoded_` and
+/// appended to `view_builder_` and `null_bitmap_builder_`.
+class ByteArrayViewRecordReader final : public TypedRecordReader<ByteArrayType>,
+                                        virtual public BinaryRecordReader {
+ public:
+  ByteArrayViewRecordReader(const ColumnDescriptor* descr, LevelInfo leaf_info,
+                            ::arrow::MemoryPool* pool, bool read_dense_for_nullable,
+                            std::shared_ptr<::arrow::DataType> type)
+      : TypedRecordReader<ByteArrayType>(descr, leaf_info, pool,
+                                         read_dense_for_nullable),
+        type_(std::move(type)),
+        null_bitmap_builder_(pool),
+        view_builder_(pool) {
+    ARROW_DCHECK_EQ(descr_->physical_type(), Type::BYTE_ARRAY);
+  }
+
+  void SetPageReader(std::unique_ptr<PageReader> reader) override {
+    if (reader != nullptr) {
+      reader->set_retain_page_buffers(true);
+    }
+    TypedRecordReader<ByteArrayType>::SetPageReader(std::move(reader));
+  }
+
+  ::arrow::ArrayVector GetBuilderChunks() override {
+    FinishCopyBuffer();
+    const int64_t null_count = null_bitmap_builder_.false_count();
+    const int64_t length = null_bitmap_builder_.length();
+    ARROW_DCHECK_EQ(length, view_builder_.length());
+    PARQUET_ASSIGN_OR_THROW(auto views, view_builder_.Finish());
+    PARQUET_ASSIGN_OR_THROW(auto null_bitmap, null_bitmap_builder_.Finish());
+    std::vector<std::shared_ptr<Buffer>> buffers = {std::move(null_bitmap),
+                                                    std::move(views)};
+    buffers.insert(buffers.end(), std::make_move_iterator(data_buffers_.begin()),
+                   std::make_move_iterator(data_buffers_.end()));
+    data_buffers_.clear();
+    page_buffer_ = nullptr;
+    auto chunk = ::arrow::MakeArray(
+        ::arrow::ArrayData::Make(type_, length, std::move(buffers), null_count));
+    return ::arrow::ArrayVector({std::move(chunk)});
+  }
+
+  void ReadValuesDense(int64_t values_to_read) override {
+    decoded_.resize(static_cast<size_t>(values_to_read));
+    int64_t num_decoded = this->current_decoder_->Decode(
+        decoded_.data(), static_cast<int>(values_to_read));
+    CheckNumberDecoded(num_decoded, values_to_read);
+
+    PARQUET_THROW_NOT_OK(null_bitmap_builder_.Reserve(num_decoded));
+    PARQUET_THROW_NOT_OK(view_builder_.Reserve(num_decoded));
+    null_bitmap_builder_.UnsafeAppend(num_decoded, /*value=*/true);
+    for (int64_t i = 0; i < num_decoded; i++) {
+      view_builder_.UnsafeAppend(MakeView(decoded_[i]));
+    }
+    ResetValues();
+  }
+
+  void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
+    uint8_t* valid_bits = valid_bits_->mutable_data();
+    const int64_t valid_bits_offset = values_written_;
+    decoded_.resize(static_cast<size_t>(values_to_read));
+
+    int64_t num_decoded = this->current_decoder_->DecodeSpaced(
+        decoded_.data(), static_cast<int>(values_to_read), static_cast<int>(null_count),
+        valid_bits, valid_bits_offset);
+    CheckNumberDecoded(num_decoded, values_to_read);
+
+    PARQUET_THROW_NOT_OK(null_bitmap_builder_.Reserve(num_decoded));
+    PARQUET_THROW_NOT_OK(view_builder_.Reserve(num_decoded));
+    null_bitmap_builder_.UnsafeAppend(valid_bits, valid_bits_offset, num_decoded);
+    for (int64_t i = 0; i < num_decoded; i++) {
+      if (::arrow::bit_util::GetBit(valid_bits, valid_bits_offset + i)) {
+        view_builder_.UnsafeAppend(MakeView(decoded_[i]));
+      } else {
+        view_builder_.UnsafeAppend(::arrow::BinaryViewType::c_type{});
+      }
+    }
+    ResetValues();
+  }
+
+ private:
+  using View = ::arrow::BinaryViewType::c_type;
+
+  // The size of the buffers values are copied into, as in BinaryViewBuilder
+  static constexpr int64_t kCopyBufferSize = 32 * 1024;
+
+  View MakeView(const ByteArray& value) {
+    const auto size = static_cast<int32_t>(value.len);
+    if (size <= ::arrow::BinaryViewType::kInlineSize) {
+      return ::arrow::util::ToInlineBinaryView(value.ptr, size);
+    }
+    const std::shared_ptr<Buffer>& page_buffer = this->current_page_->buffer();
+    if (value.ptr >= page_buffer->data() &&
+        value.ptr + size <= page_buffer->data() + page_buffer->size()) {
+      if (page_buffer.get() != page_buffer_) {
+        page_buffer_ = page_buffer.get();
+        page_buffer_index_ = static_cast<int32_t>(data_buffers_.size());
+        data_buffers_.push_back(page_buffer);
+      }
+      return ::arrow::util::ToNonInlineBinaryView(
+          value.ptr, size, page_buffer_index_,
+          static_cast<int32_t>(value.ptr - page_buffer->data()));
+    }
+    return CopyValue(value.ptr, size);
+  }
+
+  View CopyValue(const uint8_t* data, int32_t size) {
+    if (copy_buffer_ == nullptr || copy_buffer_->size() - copy_buffer_used_ < size) {
+      FinishCopyBuffer();
+      PARQUET_ASSIGN_OR_THROW(
+          copy_buffer_, ::arrow::AllocateResizableBuffer(
+                            std::max<int64_t>(size, kCopyBufferSize), this->pool_));
+      copy_buffer_index_ = static_cast<int32_t>(data_buffers_.size());
+      data_buffers_.push_back(copy_buffer_);
+      copy_buffer_used_ = 0;
+    }
+    uint8_t* out = copy_buffer_->mutable_data() + copy_buffer_used_;
+    std::memcpy(out, data, size);
+    copy_buffer_used_ += size;
+    return ::arrow::util::ToNonInlineBinaryView(
+        out, size, copy_buffer_index_, static_cast<int32_t>(out - copy_buffer_->data()));
+  }
+
+  void FinishCopyBuffer() {
+    if (copy_buffer_ != nullptr) {
+      PARQUET_THROW_NOT_OK(
+          copy_buffer_->Resize(copy_buffer_used_, /*shrink_to_fit=*/false));
+      copy_buffer_.reset();
+    }
+  }
+
+  std::shared_ptr<::arrow::DataType> type_;
+  ::arrow::TypedBufferBuilder<bool> null_bitmap_builder_;
+  ::arrow::TypedBufferBuilder<View> view_builder_;
+  std::vector<ByteArray> decoded_;
+  // The data buffers of the views of the current chunk
+  std::vector<std::shared_ptr<Buffer>> data_buffers_;
+  // The last page buffer referenced, at page_buffer_index_ in data_buffers_
+  const Buffer* page_buffer_ = nullptr;
+  int32_t page_buffer_index_ = 0;
+  // The buffer values are currently copied into, at copy_buffer_index_
+  std::shared_ptr<ResizableBuffer> copy_buffer_;
+  int32_t copy_buffer_index_ = 0;
+  int64_t copy_buffer_used_ = 0;
+};
+
+// Copy the dictionary of a decoder, which the decoder owns and overwrites when it
+// receives a new dictionary page, into an Arrow array of the given type.
+template <typename DType>
+std::shared_ptr<::arrow::Array> CopyDictionary(
+    DictDecoder<DType>* decoder, const std::shared_ptr<::arrow::DataType>& type,
+    ::arrow::MemoryPool* pool) {
+  const typename DType::c_type* values = nullptr;
+  int32_t length = 0;
+  decoder->GetDictionary(&values, &length);
+  std::shared_ptr<::arrow::Array> dictionary;
+  if constexpr (std::is_same_v<DType, ByteArrayType>) {
+    ::arrow::BinaryBuilder builder(type, pool);
+    PARQUET_THROW_NOT_OK(builder.Reserve(length));
+    for (int32_t i = 0; i < length; ++i) {
+      PARQUET_THROW_NOT_OK(builder.Append(values[i].ptr, values[i].len));
+    }
+    PARQUET_THROW_NOT_OK(builder.Finish(&dictionary));
+  } else if constexpr (std::is_same_v<DType, FLBAType>) {
+    ::arrow::FixedSizeBinaryBuilder builder(type, pool);
+    PARQUET_THROW_NOT_OK(builder.Reserve(length));
+    for (int32_t i = 0; i < length; ++i) {
+      builder.UnsafeAppend(values[i].ptr);
+    }
+    PARQUET_THROW_NOT_OK(builder.Finish(&dictionary));
+  } else {
+    PARQUET_ASSIGN_OR_THROW(
+        std::shared_ptr<Buffer> data,
+        ::arrow::AllocateBuffer(length * static_cast<int64_t>(sizeof(*values)), pool));
+    if (length > 0) {
+      std::memcpy(data->mutable_data(), values, data->size());
+    }
+    dictionary = ::arrow::MakeArray(
+        ::arrow::ArrayData::Make(type, length, {nullptr, std::move(data)}));
+  }
+  return dictionary;
+}
+
+// Start a new dictionary in `builder`, using the dictionary indices of the decoder.
+template <typename BuilderType>
+void ResetDictionary(const std::shared_ptr<::arrow::Array>& dictionary,
+                     BuilderType* builder) {
+  builder->ResetFull();
+  PARQUET_THROW_NOT_OK(builder->InsertMemoValues(*dictionary));
+  // The indices of the data pages are only valid if the memo keeps every entry
+  if (builder->dictionary_length() != dictionary->length()) {
+    throw ParquetException(
+        "Cannot read a dictionary page with duplicate values as an Arrow dictionary");
+  }
+}
+
 /// ByteArrayDictionaryRecordReader reads into ::arrow::dictionary(index: int32,
 /// values: binary).
 ///
@@ -2128,11 +2520,15 @@ class ByteArrayDictionaryRecordReader final : public TypedRecordReader<ByteArray
   void MaybeWriteNewDictionary() {
     if (this->new_dictionary_) {
       /// If there is a new dictionary, we may need to flush the builder, then
-      /// insert the new dictionary values
-      FlushBuilder();
-      builder_.ResetFull();
+      /// insert the new dictionary values.  Consecutive column chunks often share
+      /// the same dictionary, in which case the current one is kept.
       auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
-      decoder->InsertDictionary(&builder_);
+      auto dictionary = CopyDictionary(decoder, ::arrow::binary(), this->pool_);
+      if (dictionary_ == nullptr || !dictionary_->Equals(*dictionary)) {
+        FlushBuilder();
+        ResetDictionary(dictionary, &builder_);
+        dictionary_ = std::move(dictionary);
+      }
       this->new_dictionary_ = false;
     }
   }
@@ -2174,6 +2570,202 @@ class ByteArrayDictionaryRecordReader final : public TypedRecordReader<ByteArray
   using BinaryDictDecoder = DictDecoder<ByteArrayType>;
 
   ::arrow::BinaryDictionary32Builder builder_;
+  // The dictionary page the indices decoded into builder_ refer to
+  std::shared_ptr<::arrow::Array> dictionary_;
+  std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
+};
+
+template <typename DType>
+struct DictionaryRecordReaderTraits;
+
+template <>
+struct DictionaryRecordReaderTraits<Int32Type> {
+  using ArrowType = ::arrow::Int32Type;
+};
+
+template <>
+struct DictionaryRecordReaderTraits<Int64Type> {
+  using ArrowType = ::arrow::Int64Type;
+};
+
+template <>
+struct DictionaryRecordReaderTraits<FloatType> {
+  using ArrowType = ::arrow::FloatType;
+};
+
+template <>
+struct DictionaryRecordReaderTraits<DoubleType> {
+  using ArrowType = ::arrow::DoubleType;
+};
+
+template <>
+struct DictionaryRecordReaderTraits<FLBAType> {
+  using ArrowType = ::arrow::FixedSizeBinaryType;
+};
+
+/// FixedWidthDictionaryRecordReader reads INT32, INT64, FLOAT, DOUBLE and
+/// FIXED_LEN_BYTE_ARRAY columns into ::arrow::dictionary(index: int32, values: the
+/// physical type).  Conversion to the logical type is left to the caller, and only
+/// touches the dictionary.
+///
+/// Indices of dictionary encoded pages are decoded directly, values of other pages
+/// are looked up in the dictionary memo.  The `values_` buffer is only used to
+/// decode the latter.
+template <typename DType>
+class FixedWidthDictionaryRecordReader final : public TypedRecordReader<DType>,
+                                               virtual public DictionaryRecordReader {
+ public:
+  using T = typename DType::c_type;
+  using ArrowType = typename DictionaryRecordReaderTraits<DType>::ArrowType;
+
+  FixedWidthDictionaryRecordReader(const ColumnDescriptor* descr, LevelInfo leaf_info,
+                                   ::arrow::MemoryPool* pool,
+                                   bool read_dense_for_nullable)
+      : TypedRecordReader<DType>(descr, leaf_info, pool, read_dense_for_nullable),
+        value_type_(MakeValueType(descr)),
+        builder_(value_type_, pool) {
+    this->read_dictionary_ = true;
+  }
+
+  std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
+    FlushBuilder();
+    std::vector<std::shared_ptr<::arrow::Array>> result;
+    std::swap(result, result_chunks_);
+    return std::make_shared<::arrow::ChunkedArray>(std::move(result), builder_.type());
+  }
+
+  void ReadValuesDense(int64_t values_to_read) override {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
+      MaybeWriteNewDictionary();
+      int32_t* indices = ReserveIndices(values_to_read);
+      CheckNumberDecoded(
+          Decoder()->DecodeIndices(static_cast<int>(values_to_read), indices),
+          values_to_read);
+      CheckIndices(indices, values_to_read);
+      PARQUET_THROW_NOT_OK(builder_.AppendIndices(indices, values_to_read));
+    } else {
+      T* values = this->template ValuesHead<T>();
+      CheckNumberDecoded(
+          this->current_decoder_->Decode(values, static_cast<int>(values_to_read)),
+          values_to_read);
+      PARQUET_THROW_NOT_OK(builder_.Reserve(values_to_read));
+      for (int64_t i = 0; i < values_to_read; ++i) {
+        PARQUET_THROW_NOT_OK(AppendValue(values[i]));
+      }
+    }
+    this->ResetValues();
+  }
+
+  void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
+    const uint8_t* valid_bits = this->valid_bits_->data();
+    const int64_t valid_bits_offset = this->values_written_;
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
+      MaybeWriteNewDictionary();
+      const int64_t num_indices = values_to_read - null_count;
+      int32_t* indices = ReserveIndices(values_to_read);
+      CheckNumberDecoded(
+          Decoder()->DecodeIndices(static_cast<int>(num_indices), indices),
+          num_indices);
+      CheckIndices(indices, num_indices);
+      // Spread the indices to the positions of the non-null values, back to front
+      valid_bytes_.resize(values_to_read);
+      int64_t next_index = num_indices;
+      for (int64_t i = values_to_read - 1; i >= 0; --i) {
+        if (bit_util::GetBit(valid_bits, valid_bits_offset + i)) {
+          indices[i] = indices[--next_index];
+          valid_bytes_[i] = 1;
+        } else {
+          indices[i] = 0;
+          valid_bytes_[i] = 0;
+        }
+      }
+      PARQUET_THROW_NOT_OK(
+          builder_.AppendIndices(indices, values_to_read, valid_bytes_.data()));
+    } else {
+      T* values = this->template ValuesHead<T>();
+      int64_t num_decoded = this->current_decoder_->DecodeSpaced(
+          values, static_cast<int>(values_to_read), static_cast<int>(null_count),
+          valid_bits, valid_bits_offset);
+      ARROW_DCHECK_EQ(num_decoded, values_to_read);
+      PARQUET_THROW_NOT_OK(builder_.Reserve(values_to_read));
+      for (int64_t i = 0; i < values_to_read; ++i) {
+        if (bit_util::GetBit(valid_bits, valid_bits_offset + i)) {
+          PARQUET_THROW_NOT_OK(AppendValue(values[i]));
+        } else {
+          PARQUET_THROW_NOT_OK(builder_.AppendNull());
+        }
+      }
+    }
+    this->ResetValues();
+  }
+
+ private:
+  static std::shared_ptr<::arrow::DataType> MakeValueType(
+      const ColumnDescriptor* descr) {
+    if constexpr (std::is_same_v<DType, FLBAType>) {
+      return ::arrow::fixed_size_binary(descr->type_length());
+    } else {
+      return ::arrow::TypeTraits<ArrowType>::type_singleton();
+    }
+  }
+
+  DictDecoder<DType>* Decoder() {
+    return dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
+  }
+
+  ::arrow::Status AppendValue(const T& value) {
+    if constexpr (std::is_same_v<DType, FLBAType>) {
+      return builder_.Append(value.ptr);
+    } else {
+      return builder_.Append(value);
+    }
+  }
+
+  int32_t* ReserveIndices(int64_t length) {
+    PARQUET_THROW_NOT_OK(indices_->Resize(length * static_cast<int64_t>(sizeof(int32_t)),
+                                          /*shrink_to_fit=*/false));
+    return indices_->mutable_data_as<int32_t>();
+  }
+
+  void CheckIndices(const int32_t* indices, int64_t length) const {
+    const int64_t dictionary_length = dictionary_->length();
+    for (int64_t i = 0; i < length; ++i) {
+      if (ARROW_PREDICT_FALSE(indices[i] < 0 || indices[i] >= dictionary_length)) {
+        throw ParquetException("Index not in dictionary bounds");
+      }
+    }
+  }
+
+  void FlushBuilder() {
+    if (builder_.length() > 0) {
+      std::shared_ptr<::arrow::Array> chunk;
+      PARQUET_THROW_NOT_OK(builder_.Finish(&chunk));
+      result_chunks_.emplace_back(std::move(chunk));
+      // Keeps the dictionary memo table
+      builder_.Reset();
+    }
+  }
+
+  void MaybeWriteNewDictionary() {
+    if (this->new_dictionary_) {
+      // Consecutive column chunks often share the same dictionary, keep appending
+      // to the current one then
+      auto dictionary = CopyDictionary(Decoder(), value_type_, this->pool_);
+      if (dictionary_ == nullptr || !dictionary_->Equals(*dictionary)) {
+        FlushBuilder();
+        ResetDictionary(dictionary, &builder_);
+        dictionary_ = std::move(dictionary);
+      }
+      this->new_dictionary_ = false;
+    }
+  }
+
+  std::shared_ptr<::arrow::DataType> value_type_;
+  ::arrow::Dictionary32Builder<ArrowType> builder_;
+  // The dictionary page the indices decoded into builder_ refer to
+  std::shared_ptr<::arrow::Array> dictionary_;
+  std::shared_ptr<ResizableBuffer> indices_ = AllocateBuffer(this->pool_);
+  std::vector<uint8_t> valid_bytes_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
 };
 
@@ -2187,50 +2779,77 @@ void TypedRecordReader<ByteArrayType>::DebugPrintState() {}
 template <>
 void TypedRecordReader<FLBAType>::DebugPrintState() {}
 
-std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor* descr,
-                                                        LevelInfo leaf_info,
-                                                        ::arrow::MemoryPool* pool,
-                                                        bool read_dictionary,
-                                                        bool read_dense_for_nullable) {
+std::shared_ptr<RecordReader> MakeByteArrayRecordReader(
+    const ColumnDescriptor* descr, LevelInfo leaf_info, ::arrow::MemoryPool* pool,
+    bool read_dictionary, bool read_dense_for_nullable,
+    const std::shared_ptr<::arrow::DataType>& arrow_type) {
   if (read_dictionary) {
     return std::make_shared<ByteArrayDictionaryRecordReader>(descr, leaf_info, pool,
                                                              read_dense_for_nullable);
+  } else if (arrow_type != nullptr &&
+             (arrow_type->id() == ::arrow::Type::BINARY_VIEW ||
+              arrow_type->id() == ::arrow::Type::STRING_VIEW)) {
+    return std::make_shared<ByteArrayViewRecordReader>(descr, leaf_info, pool,
+                                                       read_dense_for_nullable,
+                                                       arrow_type);
   } else {
     return std::make_shared<ByteArrayChunkedRecordReader>(descr, leaf_info, pool,
                                                           read_dense_for_nullable);
   }
 }
 
+template <typename DType>
+std::shared_ptr<RecordReader> MakeFixedWidthRecordReader(const ColumnDescriptor* descr,
+                                                         LevelInfo leaf_info,
+                                                         ::arrow::MemoryPool* pool,
+                                                         bool read_dictionary,
+                                                         bool read_dense_for_nullable) {
+  if (read_dictionary) {
+    return std::make_shared<FixedWidthDictionaryRecordReader<DType>>(
+        descr, leaf_info, pool, read_dense_for_nullable);
+  }
+  return std::make_shared<TypedRecordReader<DType>>(descr, leaf_info, pool,
+                                                    read_dense_for_nullable);
+}
+
 }  // namespace
 
-std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
-                                                 LevelInfo leaf_info, MemoryPool* pool,
-                                                 bool read_dictionary,
-                                                 bool read_dense_for_nullable) {
+std::shared_ptr<RecordReader> RecordReader::Make(
+    const ColumnDescriptor* descr, LevelInfo leaf_info, MemoryPool* pool,
+    bool read_dictionary, bool read_dense_for_nullable,
+    const std::shared_ptr<::arrow::DataType>& arrow_type) {
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, leaf_info, pool,
                                                               read_dense_for_nullable);
     case Type::INT32:
-      return std::make_shared<TypedRecordReader<Int32Type>>(descr, leaf_info, pool,
-                                                            read_dense_for_nullable);
+      return MakeFixedWidthRecordReader<Int32Type>(descr, leaf_info, pool,
+                                                   read_dictionary,
+                                                   read_dense_for_nullable);
     case Type::INT64:
-      return std::make_shared<TypedRecordReader<Int64Type>>(descr, leaf_info, pool,
-                                                            read_dense_for_nullable);
+      return MakeFixedWidthRecordReader<Int64Type>(descr, leaf_info, pool,
+                                                   read_dictionary,
+                                                   read_dense_for_nullable);
     case Type::INT96:
       return std::make_shared<TypedRecordReader<Int96Type>>(descr, leaf_info, pool,
                                                             read_dense_for_nullable);
     case Type::FLOAT:
-      return std::make_shared<TypedRecordReader<FloatType>>(descr, leaf_info, pool,
-                                                            read_dense_for_nullable);
+      return MakeFixedWidthRecordReader<FloatType>(descr, leaf_info, pool,
+                                                   read_dictionary,
+                                                   read_dense_for_nullable);
     case Type::DOUBLE:
-      return std::make_shared<TypedRecordReader<DoubleType>>(descr, leaf_info, pool,
-                                                             read_dense_for_nullable);
+      return MakeFixedWidthRecordReader<DoubleType>(descr, leaf_info, pool,
+                                                    read_dictionary,
+                                                    read_dense_for_nullable);
     case Type::BYTE_ARRAY: {
       return MakeByteArrayRecordReader(descr, leaf_info, pool, read_dictionary,
-                                       read_dense_for_nullable);
+                                       read_dense_for_nullable, arrow_type);
     }
     case Type::FIXED_LEN_BYTE_ARRAY:
+      if (read_dictionary) {
+        return std::make_shared<FixedWidthDictionaryRecordReader<FLBAType>>(
+            descr, leaf_info, pool, read_dense_for_nullable);
+      }
       return std::make_shared<FLBARecordReader>(descr, leaf_info, pool,
                                                 read_dense_for_nullable);
     default: {
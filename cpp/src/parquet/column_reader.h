@@ -34,6 +34,7 @@ namespace arrow {
 
 class Array;
 class ChunkedArray;
+class DataType;
 
 namespace bit_util {
 class BitReader;
@@ -150,6 +151,15 @@ class PARQUET_EXPORT PageReader {
     data_page_filter_ = std::move(data_page_filter);
   }
 
+  // If true, the buffers of the pages returned by NextPage() are never reused for
+  // later pages, so that they remain valid for as long as they are referenced, e.g.
+  // by arrays that point into them.  Otherwise a buffer may be overwritten by the
+  // next call to NextPage().
+  // \note API EXPERIMENTAL
+  void set_retain_page_buffers(bool retain_page_buffers) {
+    retain_page_buffers_ = retain_page_buffers;
+  }
+
   // @returns: shared_ptr<Page>(nullptr) on EOS, std::shared_ptr<Page>
   // containing new Page otherwise
   //
@@ -162,6 +172,7 @@ class PARQUET_EXPORT PageReader {
  protected:
   // Callback that decides if we should skip a page or not.
   DataPageFilter data_page_filter_;
+  bool retain_page_buffers_ = false;
 };
 
 class PARQUET_EXPORT ColumnReader {
@@ -276,10 +287,14 @@ class PARQUET_EXPORT RecordReader {
   /// @param read_dictionary True if reading directly as Arrow dictionary-encoded
   /// @param read_dense_for_nullable True if reading dense and not leaving space for null
   /// values
+  /// @param arrow_type The Arrow type to read into, if it changes the record reader.
+  /// Only binary_view and utf8_view do, for BYTE_ARRAY columns, which are then read
+  /// into BinaryRecordReader chunks of that type.
   static std::shared_ptr<RecordReader> Make(
       const ColumnDescriptor* descr, LevelInfo leaf_info,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
-      bool read_dictionary = false, bool read_dense_for_nullable = false);
+      bool read_dictionary = false, bool read_dense_for_nullable = false,
+      const std::shared_ptr<::arrow::DataType>& arrow_type = NULLPTR);
 
   virtual ~RecordReader() = default;
 
@@ -444,7 +459,8 @@ class BinaryRecordReader : virtual public RecordReader {
 };
 
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
-/// indices). Only valid for BYTE_ARRAY columns
+/// indices). Only valid for BYTE_ARRAY, INT32, INT64, FLOAT, DOUBLE and
+/// FIXED_LEN_BYTE_ARRAY columns, the dictionary values have the physical type
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
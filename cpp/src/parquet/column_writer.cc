@@ -22,6 +22,7 @@
 #include <cstring>
 #include <map>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -45,6 +46,7 @@
 #include "arrow/util/rle_encoding_internal.h"
 #include "arrow/util/type_traits.h"
 #include "arrow/visit_array_inline.h"
+#include "parquet/chunker_internal.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption/encryption_internal.h"
@@ -770,6 +772,8 @@ class ColumnWriterImpl {
 
   int64_t Close();
 
+  void FlushPages();
+
  protected:
   virtual std::shared_ptr<Buffer> GetValuesBuffer() = 0;
 
@@ -809,14 +813,14 @@ class ColumnWriterImpl {
 
   // Write multiple definition levels
   void WriteDefinitionLevels(int64_t num_levels, const int16_t* levels) {
-    DCHECK(!closed_);
+    DCHECK(!pages_flushed_);
     PARQUET_THROW_NOT_OK(
         definition_levels_sink_.Append(levels, sizeof(int16_t) * num_levels));
   }
 
   // Write multiple repetition levels
   void WriteRepetitionLevels(int64_t num_levels, const int16_t* levels) {
-    DCHECK(!closed_);
+    DCHECK(!pages_flushed_);
     PARQUET_THROW_NOT_OK(
         repetition_levels_sink_.Append(levels, sizeof(int16_t) * num_levels));
   }
@@ -878,6 +882,9 @@ class ColumnWriterImpl {
   // Flag to check if the Writer has been closed
   bool closed_;
 
+  // Flag to check if all pages have been committed
+  bool pages_flushed_ = false;
+
   // Flag to infer if dictionary encoding has fallen back to PLAIN
   bool fallback_;
 
@@ -1086,14 +1093,21 @@ void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
   }
 }
 
-int64_t ColumnWriterImpl::Close() {
-  if (!closed_) {
-    closed_ = true;
+void ColumnWriterImpl::FlushPages() {
+  if (!pages_flushed_) {
+    pages_flushed_ = true;
     if (has_dictionary_ && !fallback_) {
       WriteDictionaryPage();
     }
 
     FlushBufferedDataPages();
+  }
+}
+
+int64_t ColumnWriterImpl::Close() {
+  if (!closed_) {
+    closed_ = true;
+    FlushPages();
 
     auto [chunk_statistics, chunk_size_statistics] = GetChunkStatistics();
     chunk_statistics.ApplyStatSizeLimits(
@@ -1240,10 +1254,18 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     pages_change_on_record_boundaries_ =
         properties->data_page_version() == ParquetDataPageVersion::V2 ||
         properties->page_index_enabled(descr_->path());
+    if (properties->content_defined_chunking_enabled()) {
+      content_defined_chunker_.emplace(level_info_,
+                                       properties->content_defined_chunking_options());
+    }
+    adaptive_encoding_ = properties->adaptive_encoding_enabled(descr_->path());
+    sampling_dictionary_ = adaptive_encoding_ && use_dictionary;
   }
 
   int64_t Close() override { return ColumnWriterImpl::Close(); }
 
+  void FlushPages() override { ColumnWriterImpl::FlushPages(); }
+
   int64_t WriteBatch(int64_t num_values, const int16_t* def_levels,
                      const int16_t* rep_levels, const T* values) override {
     // We check for DataPage limits only after we have inserted the values. If a user
@@ -1334,13 +1356,12 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       bits_buffer_->ZeroPadding();
     }
 
-    if (leaf_array.type()->id() == ::arrow::Type::DICTIONARY) {
-      return WriteArrowDictionary(def_levels, rep_levels, num_levels, leaf_array, ctx,
-                                  maybe_parent_nulls);
-    } else {
-      return WriteArrowDense(def_levels, rep_levels, num_levels, leaf_array, ctx,
-                             maybe_parent_nulls);
+    if (content_defined_chunker_.has_value()) {
+      return WriteArrowChunked(def_levels, rep_levels, num_levels, leaf_array, ctx,
+                               maybe_parent_nulls);
     }
+    return WriteArrowLeaf(def_levels, rep_levels, num_levels, leaf_array, ctx,
+                          maybe_parent_nulls);
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
@@ -1353,6 +1374,42 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     return current_encoder_->FlushValues();
   }
 
+  Status WriteArrowLeaf(const int16_t* def_levels, const int16_t* rep_levels,
+                        int64_t num_levels, const ::arrow::Array& leaf_array,
+                        ArrowWriteContext* ctx, bool maybe_parent_nulls) {
+    if (leaf_array.type()->id() == ::arrow::Type::DICTIONARY) {
+      return WriteArrowDictionary(def_levels, rep_levels, num_levels, leaf_array, ctx,
+                                  maybe_parent_nulls);
+    } else {
+      return WriteArrowDense(def_levels, rep_levels, num_levels, leaf_array, ctx,
+                             maybe_parent_nulls);
+    }
+  }
+
+  // End a data page at each boundary found by the content-defined chunker
+  Status WriteArrowChunked(const int16_t* def_levels, const int16_t* rep_levels,
+                           int64_t num_levels, const ::arrow::Array& leaf_array,
+                           ArrowWriteContext* ctx, bool maybe_parent_nulls) {
+    std::vector<internal::Chunk> chunks =
+        content_defined_chunker_->GetChunks(def_levels, rep_levels, num_levels,
+                                            leaf_array);
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      const internal::Chunk& chunk = chunks[i];
+      if (chunk.levels_to_write > 0) {
+        std::shared_ptr<::arrow::Array> chunk_array =
+            leaf_array.Slice(chunk.value_offset, chunk.values_to_write);
+        RETURN_NOT_OK(WriteArrowLeaf(AddIfNotNull(def_levels, chunk.level_offset),
+                                     AddIfNotNull(rep_levels, chunk.level_offset),
+                                     chunk.levels_to_write, *chunk_array, ctx,
+                                     maybe_parent_nulls));
+      }
+      if (i + 1 < chunks.size() && num_buffered_values_ > 0) {
+        AddDataPage();
+      }
+    }
+    return Status::OK();
+  }
+
   // Internal function to handle direct writing of ::arrow::DictionaryArray,
   // since the standard logic concerning dictionary size limits and fallback to
   // plain encoding is circumvented
@@ -1463,6 +1520,7 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   std::unique_ptr<SizeStatistics> page_size_statistics_;
   std::shared_ptr<SizeStatistics> chunk_size_statistics_;
   bool pages_change_on_record_boundaries_;
+  std::optional<internal::ContentDefinedChunker> content_defined_chunker_;
 
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
@@ -1470,6 +1528,16 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   // which case we call back to the dense write path)
   std::shared_ptr<::arrow::Array> preserved_dictionary_;
 
+  // Number of values a dictionary encoded column chunk sees before adaptive encoding
+  // decides whether to keep the dictionary
+  static constexpr int64_t kAdaptiveEncodingSampleSize = 4096;
+
+  bool adaptive_encoding_;
+  // Whether adaptive encoding is still counting the values encoded with the
+  // dictionary before deciding whether to keep it
+  bool sampling_dictionary_;
+  int64_t num_sampled_values_ = 0;
+
   int64_t WriteLevels(int64_t num_levels, const int16_t* def_levels,
                       const int16_t* rep_levels) {
     // Update histograms now, to maximize cache efficiency.
@@ -1641,6 +1709,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     num_buffered_values_ += num_levels;
     num_buffered_encoded_values_ += num_values;
     num_buffered_nulls_ += num_nulls;
+    if (sampling_dictionary_) {
+      num_sampled_values_ += num_values;
+    }
 
     if (check_page_size &&
         current_encoder_->EstimatedDataEncodedSize() >= properties_->data_pagesize()) {
@@ -1648,27 +1719,93 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     }
   }
 
-  void FallbackToPlainEncoding() {
+  void FallbackToValueEncoding() {
     if (IsDictionaryIndexEncoding(current_encoder_->encoding())) {
+      // Chosen from the statistics of the current page, before it is flushed
+      const Encoding::type encoding = FallbackEncoding();
       WriteDictionaryPage();
       // Serialize the buffered Dictionary Indices
       FlushBufferedDataPages();
       fallback_ = true;
-      // Only PLAIN encoding is supported for fallback in V1
-      current_encoder_ = MakeEncoder(DType::type_num, Encoding::PLAIN, false, descr_,
+      sampling_dictionary_ = false;
+      current_encoder_ = MakeEncoder(DType::type_num, encoding, false, descr_,
                                      properties_->memory_pool());
       current_value_encoder_ = dynamic_cast<ValueEncoderType*>(current_encoder_.get());
       current_dict_encoder_ = nullptr;  // not using dict
-      encoding_ = Encoding::PLAIN;
+      encoding_ = encoding;
+    }
+  }
+
+  // The encoding of the values after falling back from dictionary encoding
+  Encoding::type FallbackEncoding() const {
+    // Only PLAIN encoding is supported for fallback in V1
+    if (!adaptive_encoding_ || properties_->version() == ParquetVersion::PARQUET_1_0) {
+      return Encoding::PLAIN;
     }
+    const Encoding::type column_encoding = properties_->encoding(descr_->path());
+    if (column_encoding != Encoding::UNKNOWN) {
+      return column_encoding;
+    }
+
+    if constexpr (std::is_same_v<DType, Int32Type> || std::is_same_v<DType, Int64Type>) {
+      // Deltas take up to one more bit than the range of the values.  Without
+      // statistics, PLAIN is the safe choice.
+      if (page_statistics_ != nullptr && page_statistics_->HasMinMax()) {
+        using U = std::make_unsigned_t<T>;
+        const auto range =
+            static_cast<U>(static_cast<U>(page_statistics_->max()) -
+                           static_cast<U>(page_statistics_->min()));
+        const int delta_bits = bit_util::NumRequiredBits(range) + 1;
+        if (delta_bits * 4 <= static_cast<int>(sizeof(T) * 8) * 3) {
+          return Encoding::DELTA_BINARY_PACKED;
+        }
+      }
+    } else if constexpr (std::is_same_v<DType, FloatType> ||
+                         std::is_same_v<DType, DoubleType>) {
+      // BYTE_STREAM_SPLIT is as large as PLAIN, but compresses better
+      if (properties_->compression(descr_->path()) != Compression::UNCOMPRESSED) {
+        return Encoding::BYTE_STREAM_SPLIT;
+      }
+    } else if constexpr (std::is_same_v<DType, ByteArrayType>) {
+      // Delta encoding the lengths saves most of the 4 bytes of length prefix of
+      // every PLAIN value, which only matters for short values
+      const int num_entries = current_dict_encoder_->num_entries();
+      if (num_entries > 0 && current_dict_encoder_->dict_encoded_size() <
+                                 num_entries * (kShortByteArrayLength + 4)) {
+        return Encoding::DELTA_LENGTH_BYTE_ARRAY;
+      }
+    }
+    return Encoding::PLAIN;
+  }
+
+  // The average length of byte arrays below which adaptive encoding delta encodes
+  // their lengths
+  static constexpr int kShortByteArrayLength = 32;
+
+  // Whether dictionary encoding is estimated to be substantially smaller than the
+  // values themselves, from the values encoded so far.  The distinct ratio of these
+  // values is assumed to hold for the whole column chunk, which is pessimistic as
+  // values usually repeat more over longer spans.
+  bool DictionaryPaysOff() const {
+    const int num_entries = current_dict_encoder_->num_entries();
+    if (num_entries == 0 || num_sampled_values_ == 0) {
+      return true;
+    }
+    // Including the length prefix of byte arrays
+    const double value_size =
+        static_cast<double>(current_dict_encoder_->dict_encoded_size()) / num_entries;
+    const double distinct_ratio = static_cast<double>(num_entries) / num_sampled_values_;
+    const double index_size = bit_util::NumRequiredBits(num_entries) / 8.0;
+    return distinct_ratio * value_size + index_size < 0.8 * value_size;
   }
 
   // Checks if the Dictionary Page size limit is reached
   // If the limit is reached, the Dictionary and Data Pages are serialized
-  // The encoding is switched to PLAIN
+  // The encoding is switched to PLAIN, or to the encoding chosen by adaptive encoding
   //
   // Only one Dictionary Page is written.
-  // Fallback to PLAIN if dictionary page limit is reached.
+  // Fallback if dictionary page limit is reached, or with adaptive encoding as soon
+  // as the dictionary isn't estimated to pay off.
   void CheckDictionarySizeLimit() {
     if (!has_dictionary_ || fallback_) {
       // Either not using dictionary encoding, or we have already fallen back
@@ -1678,7 +1815,13 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
     if (current_dict_encoder_->dict_encoded_size() >=
         properties_->dictionary_pagesize_limit()) {
-      FallbackToPlainEncoding();
+      FallbackToValueEncoding();
+    } else if (sampling_dictionary_ &&
+               num_sampled_values_ >= kAdaptiveEncodingSampleSize) {
+      sampling_dictionary_ = false;
+      if (!DictionaryPaysOff()) {
+        FallbackToValueEncoding();
+      }
     }
   }
 
@@ -1832,14 +1975,14 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
     // will be out of sync with the indices in the Arrow array.
     // The easiest solution for this uncommon case is to fallback to plain encoding.
     if (dict_encoder->num_entries() != dictionary->length()) {
-      PARQUET_CATCH_NOT_OK(FallbackToPlainEncoding());
+      PARQUET_CATCH_NOT_OK(FallbackToValueEncoding());
       return WriteDense();
     }
 
     preserved_dictionary_ = dictionary;
   } else if (!dictionary->Equals(*preserved_dictionary_)) {
     // Dictionary has changed
-    PARQUET_CATCH_NOT_OK(FallbackToPlainEncoding());
+    PARQUET_CATCH_NOT_OK(FallbackToValueEncoding());
     return WriteDense();
   }
 
@@ -2455,6 +2598,8 @@ Status TypedColumnWriterImpl<FLBAType>::WriteArrowDense(
 // ----------------------------------------------------------------------
 // Dynamic column writer constructor
 
+void ColumnWriter::FlushPages() {}
+
 std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* metadata,
                                                  std::unique_ptr<PageWriter> pager,
                                                  const WriterProperties* properties) {
@@ -135,6 +135,14 @@ class PARQUET_EXPORT ColumnWriter {
   /// \return Total size of the column in bytes
   virtual int64_t Close() = 0;
 
+  /// \brief Commits any buffered values and pages, without closing the ColumnWriter.
+  /// No values may be written afterwards.
+  ///
+  /// Close() does this as well.  In a buffered row group only Close() writes to the
+  /// file, so this part of the work can run concurrently for all columns.  The
+  /// default implementation does nothing, leaving this work to Close().
+  virtual void FlushPages();
+
   /// \brief The physical Parquet type of the column
   virtual Type::type type() const = 0;
 
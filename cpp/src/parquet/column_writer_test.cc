@@ -16,6 +16,7 @@
 // under the License.
 
 #include <memory>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -1486,6 +1487,84 @@ TEST(TestColumnWriter, WriteDataPagesChangeOnRecordBoundariesWithSmallBatches) {
   }
 }
 
+// Writes a required INT64 column with dictionary encoding, reads it back and returns
+// the metadata of the column chunk
+std::unique_ptr<ColumnChunkMetaData> WriteReadDictionaryInt64Column(
+    const std::vector<int64_t>& values, bool adaptive_encoding) {
+  auto sink = CreateOutputStream();
+  auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED, {schema::Int64("col", Repetition::REQUIRED)}));
+  WriterProperties::Builder builder;
+  builder.enable_dictionary()->version(ParquetVersion::PARQUET_2_6);
+  if (adaptive_encoding) {
+    builder.enable_adaptive_encoding();
+  }
+  auto file_writer = ParquetFileWriter::Open(sink, schema, builder.build());
+  auto column_writer =
+      static_cast<Int64Writer*>(file_writer->AppendRowGroup()->NextColumn());
+  column_writer->WriteBatch(static_cast<int64_t>(values.size()), nullptr, nullptr,
+                            values.data());
+  file_writer->Close();
+
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto row_group_reader = file_reader->RowGroup(0);
+  auto column_reader =
+      std::static_pointer_cast<Int64Reader>(row_group_reader->Column(0));
+  std::vector<int64_t> values_out(values.size());
+  int64_t values_read = 0;
+  int64_t levels_read =
+      column_reader->ReadBatch(static_cast<int64_t>(values.size()), nullptr, nullptr,
+                               values_out.data(), &values_read);
+  EXPECT_EQ(static_cast<int64_t>(values.size()), levels_read);
+  EXPECT_EQ(values, values_out);
+  return row_group_reader->metadata()->ColumnChunk(0);
+}
+
+std::set<Encoding::type> DataPageEncodings(const ColumnChunkMetaData& metadata) {
+  std::set<Encoding::type> encodings;
+  for (const auto& stats : metadata.encoding_stats()) {
+    if (stats.page_type == PageType::DATA_PAGE) {
+      encodings.insert(stats.encoding);
+    }
+  }
+  return encodings;
+}
+
+TEST(TestColumnWriter, AdaptiveEncodingFallsBackEarly) {
+  // Distinct values of a narrow range, which would all fit in the dictionary
+  std::vector<int64_t> values(100000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<int64_t>(i) * 3;
+  }
+
+  auto dictionary_metadata =
+      WriteReadDictionaryInt64Column(values, /*adaptive_encoding=*/false);
+  ASSERT_EQ(DataPageEncodings(*dictionary_metadata),
+            std::set<Encoding::type>({Encoding::RLE_DICTIONARY}));
+
+  // The pages written before the sample was taken remain dictionary encoded
+  auto adaptive_metadata =
+      WriteReadDictionaryInt64Column(values, /*adaptive_encoding=*/true);
+  ASSERT_EQ(DataPageEncodings(*adaptive_metadata),
+            std::set<Encoding::type>(
+                {Encoding::RLE_DICTIONARY, Encoding::DELTA_BINARY_PACKED}));
+  ASSERT_LT(adaptive_metadata->total_compressed_size() * 10,
+            dictionary_metadata->total_compressed_size());
+}
+
+TEST(TestColumnWriter, AdaptiveEncodingKeepsDictionary) {
+  std::vector<int64_t> values(100000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<int64_t>(i % 100) << 40;
+  }
+
+  auto metadata = WriteReadDictionaryInt64Column(values, /*adaptive_encoding=*/true);
+  ASSERT_EQ(DataPageEncodings(*metadata),
+            std::set<Encoding::type>({Encoding::RLE_DICTIONARY}));
+}
+
 class ColumnWriterTestSizeEstimated : public ::testing::Test {
  public:
   void SetUp() {
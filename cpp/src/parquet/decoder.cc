@@ -41,6 +41,7 @@
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding_internal.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/spaced.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visit_data_inline.h"
@@ -1344,11 +1345,60 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
 // ----------------------------------------------------------------------
 // DELTA_BINARY_PACKED decoder
 
+// Turn `num_values` unpacked deltas into values, in place.  Each value is the previous
+// value plus `min_delta` plus its delta, using wrapping unsigned arithmetic.  Returns
+// the last value.
+//
+// 32-bit values are summed four at a time where SIMD is available, so that the
+// running value is only carried once per vector rather than once per value.
+template <typename T>
+T DeltaDecodeInPlace(T* values, int num_values, T min_delta, T last_value) {
+  using UT = std::make_unsigned_t<T>;
+  int i = 0;
+  if constexpr (sizeof(T) == 4) {
+#if defined(ARROW_HAVE_SSE4_2)
+    const __m128i min_delta_v = _mm_set1_epi32(static_cast<int32_t>(min_delta));
+    __m128i carry = _mm_set1_epi32(static_cast<int32_t>(last_value));
+    for (; i + 4 <= num_values; i += 4) {
+      auto ptr = reinterpret_cast<__m128i*>(values + i);
+      __m128i x = _mm_add_epi32(_mm_loadu_si128(ptr), min_delta_v);
+      x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+      x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+      x = _mm_add_epi32(x, carry);
+      _mm_storeu_si128(ptr, x);
+      carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+    last_value = static_cast<T>(_mm_cvtsi128_si32(carry));
+#elif defined(ARROW_HAVE_NEON)
+    const uint32x4_t zero = vdupq_n_u32(0);
+    const uint32x4_t min_delta_v = vdupq_n_u32(static_cast<uint32_t>(min_delta));
+    uint32x4_t carry = vdupq_n_u32(static_cast<uint32_t>(last_value));
+    for (; i + 4 <= num_values; i += 4) {
+      auto ptr = reinterpret_cast<uint32_t*>(values + i);
+      uint32x4_t x = vaddq_u32(vld1q_u32(ptr), min_delta_v);
+      x = vaddq_u32(x, vextq_u32(zero, x, 3));
+      x = vaddq_u32(x, vextq_u32(zero, x, 2));
+      x = vaddq_u32(x, carry);
+      vst1q_u32(ptr, x);
+      carry = vdupq_laneq_u32(x, 3);
+    }
+    last_value = static_cast<T>(vgetq_lane_u32(carry, 0));
+#endif
+  }
+  for (; i < num_values; ++i) {
+    // Addition between min_delta, packed int and last_value should be treated as
+    // unsigned addition. Overflow is as expected.
+    last_value = static_cast<T>(static_cast<UT>(min_delta) + static_cast<UT>(values[i]) +
+                                static_cast<UT>(last_value));
+    values[i] = last_value;
+  }
+  return last_value;
+}
+
 template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, public TypedDecoderImpl<DType> {
  public:
   typedef typename DType::c_type T;
-  using UT = std::make_unsigned_t<T>;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = ::arrow::default_memory_pool())
@@ -1535,13 +1585,7 @@ class DeltaBitPackDecoder : public DecoderImpl, public TypedDecoderImpl<DType> {
           values_decode) {
         ParquetException::EofException();
       }
-      for (int j = 0; j < values_decode; ++j) {
-        // Addition between min_delta, packed int and last_value should be treated as
-        // unsigned addition. Overflow is as expected.
-        buffer[i + j] = static_cast<UT>(min_delta_) + static_cast<UT>(buffer[i + j]) +
-                        static_cast<UT>(last_value_);
-        last_value_ = buffer[i + j];
-      }
+      last_value_ = DeltaDecodeInPlace(buffer + i, values_decode, min_delta_, last_value_);
       values_remaining_current_mini_block_ -= values_decode;
       i += values_decode;
     }
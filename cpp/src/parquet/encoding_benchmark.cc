@@ -483,6 +483,18 @@ static void BM_ByteStreamSplitEncode_Double_Scalar(benchmark::State& state) {
       state, ::arrow::util::internal::ByteStreamSplitEncodeScalar<sizeof(double)>);
 }
 
+template <int N>
+static void BM_ByteStreamSplitDecode_FLBA_Scalar(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<std::array<int8_t, N>>(
+      state, ::arrow::util::internal::ByteStreamSplitDecodeScalar<N>);
+}
+
+template <int N>
+static void BM_ByteStreamSplitEncode_FLBA_Scalar(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<std::array<int8_t, N>>(
+      state, ::arrow::util::internal::ByteStreamSplitEncodeScalar<N>);
+}
+
 static void ByteStreamSplitApply(::benchmark::internal::Benchmark* bench) {
   // Reduce the number of variations by only testing the two range ends.
   bench->Arg(MIN_RANGE)->Arg(MAX_RANGE);
@@ -506,6 +518,10 @@ BENCHMARK(BM_ByteStreamSplitDecode_Float_Scalar)->Apply(ByteStreamSplitApply);
 BENCHMARK(BM_ByteStreamSplitDecode_Double_Scalar)->Apply(ByteStreamSplitApply);
 BENCHMARK(BM_ByteStreamSplitEncode_Float_Scalar)->Apply(ByteStreamSplitApply);
 BENCHMARK(BM_ByteStreamSplitEncode_Double_Scalar)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Scalar, 2)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Scalar, 16)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Scalar, 2)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Scalar, 16)->Apply(ByteStreamSplitApply);
 
 #if defined(ARROW_HAVE_SSE4_2)
 static void BM_ByteStreamSplitDecode_Float_Sse2(benchmark::State& state) {
@@ -528,10 +544,26 @@ static void BM_ByteStreamSplitEncode_Double_Sse2(benchmark::State& state) {
       state, ::arrow::util::internal::ByteStreamSplitEncodeSimd128<sizeof(double)>);
 }
 
+template <int N>
+static void BM_ByteStreamSplitDecode_FLBA_Sse2(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<std::array<int8_t, N>>(
+      state, ::arrow::util::internal::ByteStreamSplitDecodeSimd128<N>);
+}
+
+template <int N>
+static void BM_ByteStreamSplitEncode_FLBA_Sse2(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<std::array<int8_t, N>>(
+      state, ::arrow::util::internal::ByteStreamSplitEncodeSimd128<N>);
+}
+
 BENCHMARK(BM_ByteStreamSplitDecode_Float_Sse2)->Apply(ByteStreamSplitApply);
 BENCHMARK(BM_ByteStreamSplitDecode_Double_Sse2)->Apply(ByteStreamSplitApply);
 BENCHMARK(BM_ByteStreamSplitEncode_Float_Sse2)->Apply(ByteStreamSplitApply);
 BENCHMARK(BM_ByteStreamSplitEncode_Double_Sse2)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Sse2, 2)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Sse2, 16)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Sse2, 2)->Apply(ByteStreamSplitApply);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Sse2, 16)->Apply(ByteStreamSplitApply);
 #endif
 
 #if defined(ARROW_HAVE_AVX2)
@@ -582,10 +614,26 @@ static void BM_ByteStreamSplitEncode_Double_Neon(benchmark::State& state) {
       state, ::arrow::util::internal::ByteStreamSplitEncodeSimd128<sizeof(double)>);
 }
 
+template <int N>
+static void BM_ByteStreamSplitDecode_FLBA_Neon(benchmark::State& state) {
+  BM_ByteStreamSplitDecode<std::array<int8_t, N>>(
+      state, ::arrow::util::internal::ByteStreamSplitDecodeSimd128<N>);
+}
+
+template <int N>
+static void BM_ByteStreamSplitEncode_FLBA_Neon(benchmark::State& state) {
+  BM_ByteStreamSplitEncode<std::array<int8_t, N>>(
+      state, ::arrow::util::internal::ByteStreamSplitEncodeSimd128<N>);
+}
+
 BENCHMARK(BM_ByteStreamSplitDecode_Float_Neon)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_ByteStreamSplitDecode_Double_Neon)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_ByteStreamSplitEncode_Float_Neon)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_ByteStreamSplitEncode_Double_Neon)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Neon, 2)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitDecode_FLBA_Neon, 16)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Neon, 2)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK_TEMPLATE(BM_ByteStreamSplitEncode_FLBA_Neon, 16)->Range(MIN_RANGE, MAX_RANGE);
 #endif
 
 template <typename DType>
@@ -611,6 +659,20 @@ static auto MakeDeltaBitPackingInputWide(size_t length) {
   return numbers;
 }
 
+// Increasing values with small irregular steps, like event timestamps
+template <typename DType>
+static auto MakeDeltaBitPackingInputIncreasing(size_t length) {
+  using T = typename DType::c_type;
+  auto numbers = std::vector<T>(length);
+  ::arrow::randint<T, T>(length, 0, 1000, &numbers);
+  T value = 0;
+  for (auto& number : numbers) {
+    value += number;
+    number = value;
+  }
+  return numbers;
+}
+
 template <typename DType, typename NumberGenerator>
 static void BM_DeltaBitPackingEncode(benchmark::State& state, NumberGenerator gen) {
   using T = typename DType::c_type;
@@ -697,12 +759,24 @@ static void BM_DeltaBitPackingDecode_Int64_Wide(benchmark::State& state) {
   BM_DeltaBitPackingDecode<Int64Type>(state, MakeDeltaBitPackingInputWide<Int64Type>);
 }
 
+static void BM_DeltaBitPackingDecode_Int32_Increasing(benchmark::State& state) {
+  BM_DeltaBitPackingDecode<Int32Type>(state,
+                                      MakeDeltaBitPackingInputIncreasing<Int32Type>);
+}
+
+static void BM_DeltaBitPackingDecode_Int64_Increasing(benchmark::State& state) {
+  BM_DeltaBitPackingDecode<Int64Type>(state,
+                                      MakeDeltaBitPackingInputIncreasing<Int64Type>);
+}
+
 BENCHMARK(BM_DeltaBitPackingDecode_Int32_Fixed)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingDecode_Int64_Fixed)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingDecode_Int32_Narrow)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingDecode_Int64_Narrow)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingDecode_Int32_Wide)->Range(MIN_RANGE, MAX_RANGE);
 BENCHMARK(BM_DeltaBitPackingDecode_Int64_Wide)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackingDecode_Int32_Increasing)->Range(MIN_RANGE, MAX_RANGE);
+BENCHMARK(BM_DeltaBitPackingDecode_Int64_Increasing)->Range(MIN_RANGE, MAX_RANGE);
 
 static void ByteArrayCustomArguments(benchmark::internal::Benchmark* b) {
   b->ArgsProduct({{8, 64, 1024}, {512, 2048}})
@@ -395,6 +395,17 @@ class AesDecryptor::AesDecryptorImpl {
       EVP_CIPHER_CTX_free(ctx_);
       ctx_ = nullptr;
     }
+    std::fill(context_key_.begin(), context_key_.end(), uint8_t{0});
+    context_key_.clear();
+  }
+
+  std::shared_ptr<AesDecryptor> Clone() const {
+    CheckValid();
+    const auto alg_id =
+        kGcmMode == aes_mode_ ? ParquetCipher::AES_GCM_V1 : ParquetCipher::AES_GCM_CTR_V1;
+    // The mode is already resolved, so the clone needn't be a metadata decryptor
+    return std::make_shared<AesDecryptor>(alg_id, key_length_, /*metadata=*/false,
+                                          length_buffer_length_ > 0);
   }
 
   [[nodiscard]] int32_t PlaintextLength(int32_t ciphertext_len) const {
@@ -434,11 +445,18 @@ class AesDecryptor::AesDecryptorImpl {
   int32_t key_length_;
   int32_t ciphertext_size_delta_;
   int32_t length_buffer_length_;
+  // The key whose schedule is set up in ctx_, empty if none
+  std::vector<uint8_t> context_key_;
 
   /// Get the actual ciphertext length, inclusive of the length buffer length,
   /// and validate that the provided buffer size is large enough.
   [[nodiscard]] int32_t GetCiphertextLength(span<const uint8_t> ciphertext) const;
 
+  /// Set the key and IV of the cipher context.  All modules of a column chunk are
+  /// decrypted with the same key, so its schedule is only expanded when it changes
+  /// and only the IV is reset for every page.
+  void SetKeyAndIv(span<const uint8_t> key, const uint8_t* iv);
+
   int32_t GcmDecrypt(span<const uint8_t> ciphertext, span<const uint8_t> key,
                      span<const uint8_t> aad, span<uint8_t> plaintext);
 
@@ -453,6 +471,8 @@ int32_t AesDecryptor::Decrypt(span<const uint8_t> ciphertext, span<const uint8_t
 
 void AesDecryptor::WipeOut() { impl_->WipeOut(); }
 
+std::shared_ptr<AesDecryptor> AesDecryptor::Clone() const { return impl_->Clone(); }
+
 AesDecryptor::~AesDecryptor() {}
 
 AesDecryptor::AesDecryptorImpl::AesDecryptorImpl(ParquetCipher::type alg_id,
@@ -596,6 +616,20 @@ int32_t AesDecryptor::AesDecryptorImpl::GetCiphertextLength(
   }
 }
 
+void AesDecryptor::AesDecryptorImpl::SetKeyAndIv(span<const uint8_t> key,
+                                                  const uint8_t* iv) {
+  const bool same_key = context_key_.size() == key.size() &&
+                        std::equal(key.begin(), key.end(), context_key_.begin());
+  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, same_key ? nullptr : key.data(),
+                              iv)) {
+    context_key_.clear();
+    throw ParquetException("Couldn't set key and IV");
+  }
+  if (!same_key) {
+    context_key_.assign(key.begin(), key.end());
+  }
+}
+
 int32_t AesDecryptor::AesDecryptorImpl::GcmDecrypt(span<const uint8_t> ciphertext,
                                                    span<const uint8_t> key,
                                                    span<const uint8_t> aad,
@@ -629,9 +663,7 @@ int32_t AesDecryptor::AesDecryptorImpl::GcmDecrypt(span<const uint8_t> ciphertex
             ciphertext.begin() + ciphertext_len, tag.begin());
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key.data(), nonce.data())) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  SetKeyAndIv(key, nonce.data());
 
   // Setting additional authenticated data
   if (aad.size() > static_cast<size_t>(std::numeric_limits<int>::max())) {
@@ -703,9 +735,7 @@ int32_t AesDecryptor::AesDecryptorImpl::CtrDecrypt(span<const uint8_t> ciphertex
   iv[kCtrIvLength - 1] = 1;
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key.data(), iv.data())) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+  SetKeyAndIv(key, iv.data());
 
   // Decryption
   int decryption_length = ciphertext_len - length_buffer_length_ - kNonceLength;
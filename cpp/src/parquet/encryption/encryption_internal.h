@@ -108,6 +108,10 @@ class PARQUET_EXPORT AesDecryptor {
   ~AesDecryptor();
   void WipeOut();
 
+  /// \brief A new decryptor with the same cipher and key length, and its own cipher
+  /// context, to decrypt concurrently with this one.
+  std::shared_ptr<AesDecryptor> Clone() const;
+
   /// The size of the plaintext, for this cipher and the specified ciphertext length.
   [[nodiscard]] int32_t PlaintextLength(int32_t ciphertext_len) const;
 
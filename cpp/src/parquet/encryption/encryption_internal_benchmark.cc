@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "parquet/encryption/encryption_internal.h"
+
+namespace parquet::encryption {
+
+namespace {
+
+constexpr int kNumPages = 16;
+const std::string kKey = "0123456789012345";  // NOLINT
+const std::string kAad = "abcdefgh";          // NOLINT
+
+// Decrypts the pages of a column chunk, all encrypted with the same key.  With several
+// threads, every thread decrypts with its own cipher context, as the prefetched pages
+// of a column chunk are.
+void DecryptPages(::benchmark::State& state, ParquetCipher::type cipher) {
+  const auto page_size = static_cast<int32_t>(state.range(0));
+  const auto key_length = static_cast<int32_t>(kKey.size());
+  std::vector<uint8_t> plaintext(page_size);
+  for (int32_t i = 0; i < page_size; ++i) {
+    plaintext[i] = static_cast<uint8_t>(i * 7);
+  }
+
+  AesEncryptor encryptor(cipher, key_length, /*metadata=*/false);
+  std::vector<std::vector<uint8_t>> pages(kNumPages);
+  for (auto& page : pages) {
+    page.resize(encryptor.CiphertextLength(page_size));
+    encryptor.Encrypt(plaintext, str2span(kKey), str2span(kAad), page);
+  }
+
+  AesDecryptor decryptor(cipher, key_length, /*metadata=*/false);
+  for (auto _ : state) {
+    for (const auto& page : pages) {
+      decryptor.Decrypt(page, str2span(kKey), str2span(kAad), plaintext);
+    }
+    ::benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * kNumPages * page_size);
+  state.SetItemsProcessed(state.iterations() * kNumPages);
+}
+
+void BM_AesGcmDecryptPages(::benchmark::State& state) {
+  DecryptPages(state, ParquetCipher::AES_GCM_V1);
+}
+
+void BM_AesGcmCtrDecryptPages(::benchmark::State& state) {
+  DecryptPages(state, ParquetCipher::AES_GCM_CTR_V1);
+}
+
+}  // namespace
+
+BENCHMARK(BM_AesGcmDecryptPages)
+    ->RangeMultiplier(8)
+    ->Range(1 << 10, 1 << 20)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+BENCHMARK(BM_AesGcmCtrDecryptPages)
+    ->RangeMultiplier(8)
+    ->Range(1 << 10, 1 << 20)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+}  // namespace parquet::encryption
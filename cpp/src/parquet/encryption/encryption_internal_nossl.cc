@@ -70,6 +70,11 @@ int32_t AesDecryptor::Decrypt(::arrow::util::span<const uint8_t> ciphertext,
 
 void AesDecryptor::WipeOut() { ThrowOpenSSLRequiredException(); }
 
+std::shared_ptr<AesDecryptor> AesDecryptor::Clone() const {
+  ThrowOpenSSLRequiredException();
+  return NULLPTR;
+}
+
 AesDecryptor::~AesDecryptor() {}
 
 std::unique_ptr<AesEncryptor> AesEncryptor::Make(ParquetCipher::type alg_id,
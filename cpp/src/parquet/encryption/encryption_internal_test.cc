@@ -15,6 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "parquet/encryption/encryption_internal.h"
@@ -104,6 +108,53 @@ class TestAesEncryption : public ::testing::Test {
                  ParquetException);
   }
 
+  void DecryptWithReusedContext(ParquetCipher::type cipher_type) {
+    bool metadata = false;
+    const std::string other_key = "0987654321098765";
+
+    AesEncryptor encryptor(cipher_type, key_length_, metadata);
+    auto encrypt = [&](const std::string& key) {
+      std::vector<uint8_t> ciphertext(
+          encryptor.CiphertextLength(static_cast<int64_t>(plain_text_.size())));
+      encryptor.Encrypt(str2span(plain_text_), str2span(key), str2span(aad_),
+                        ciphertext);
+      return ciphertext;
+    };
+    std::vector<uint8_t> ciphertext = encrypt(key_);
+    std::vector<uint8_t> other_ciphertext = encrypt(other_key);
+
+    // The cipher context keeps the key schedule between calls, and must only reuse it
+    // for the same key
+    auto decryptor = std::make_shared<AesDecryptor>(cipher_type, key_length_, metadata);
+    auto check_decrypt = [&](AesDecryptor* target, const std::vector<uint8_t>& input,
+                             const std::string& key) {
+      std::vector<uint8_t> decrypted_text(
+          target->PlaintextLength(static_cast<int32_t>(input.size())));
+      int32_t plaintext_length =
+          target->Decrypt(input, str2span(key), str2span(aad_), decrypted_text);
+      ASSERT_EQ(plaintext_length, static_cast<int32_t>(plain_text_.size()));
+      ASSERT_EQ(std::string(decrypted_text.begin(), decrypted_text.end()), plain_text_);
+    };
+    check_decrypt(decryptor.get(), ciphertext, key_);
+    check_decrypt(decryptor.get(), ciphertext, key_);
+    check_decrypt(decryptor.get(), other_ciphertext, other_key);
+    check_decrypt(decryptor.get(), ciphertext, key_);
+
+    if (cipher_type == ParquetCipher::AES_GCM_V1) {
+      // Authentication fails with the wrong key, which mustn't stick to the context
+      std::vector<uint8_t> decrypted_text(
+          decryptor->PlaintextLength(static_cast<int32_t>(ciphertext.size())));
+      EXPECT_THROW(decryptor->Decrypt(ciphertext, str2span(other_key), str2span(aad_),
+                                      decrypted_text),
+                   ParquetException);
+      check_decrypt(decryptor.get(), ciphertext, key_);
+    }
+
+    std::shared_ptr<AesDecryptor> clone = decryptor->Clone();
+    check_decrypt(clone.get(), other_ciphertext, other_key);
+    check_decrypt(decryptor.get(), ciphertext, key_);
+  }
+
  private:
   int32_t key_length_ = 0;
   std::string key_;
@@ -137,4 +188,12 @@ TEST_F(TestAesEncryption, AesGcmCtrDecryptCiphertextBufferTooSmall) {
   DecryptCiphertextBufferTooSmall(ParquetCipher::AES_GCM_CTR_V1);
 }
 
+TEST_F(TestAesEncryption, AesGcmDecryptWithReusedContext) {
+  DecryptWithReusedContext(ParquetCipher::AES_GCM_V1);
+}
+
+TEST_F(TestAesEncryption, AesGcmCtrDecryptWithReusedContext) {
+  DecryptWithReusedContext(ParquetCipher::AES_GCM_CTR_V1);
+}
+
 }  // namespace parquet::encryption::test
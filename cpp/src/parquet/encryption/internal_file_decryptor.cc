@@ -41,6 +41,11 @@ int32_t Decryptor::CiphertextLength(int32_t plaintext_len) const {
   return aes_decryptor_->CiphertextLength(plaintext_len);
 }
 
+std::shared_ptr<Decryptor> Decryptor::Clone() const {
+  return std::make_shared<Decryptor>(aes_decryptor_->Clone(), key_, file_aad_, aad_,
+                                     pool_);
+}
+
 int32_t Decryptor::Decrypt(::arrow::util::span<const uint8_t> ciphertext,
                            ::arrow::util::span<uint8_t> plaintext) {
   return aes_decryptor_->Decrypt(ciphertext, str2span(key_), str2span(aad_), plaintext);
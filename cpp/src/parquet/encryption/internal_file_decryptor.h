@@ -42,9 +42,14 @@ class PARQUET_EXPORT Decryptor {
             ::arrow::MemoryPool* pool);
 
   const std::string& file_aad() const { return file_aad_; }
+  const std::string& aad() const { return aad_; }
   void UpdateAad(const std::string& aad) { aad_ = aad; }
   ::arrow::MemoryPool* pool() { return pool_; }
 
+  /// A decryptor with the same key and AAD and its own cipher context, to decrypt
+  /// concurrently with this one.  It isn't wiped out with the file decryption keys.
+  std::shared_ptr<Decryptor> Clone() const;
+
   [[nodiscard]] int32_t PlaintextLength(int32_t ciphertext_len) const;
   [[nodiscard]] int32_t CiphertextLength(int32_t plaintext_len) const;
   int32_t Decrypt(::arrow::util::span<const uint8_t> ciphertext,
@@ -478,6 +478,75 @@ TEST(ParquetRoundtrip, AllNulls) {
   EXPECT_THAT(def_levels, ElementsAre(0, 0, 0));
 }
 
+std::shared_ptr<Buffer> WriteInt32RowGroups(
+    const std::shared_ptr<GroupNode>& schema,
+    const std::vector<std::vector<int32_t>>& row_groups) {
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema);
+  for (const auto& values : row_groups) {
+    auto column_writer =
+        static_cast<Int32Writer*>(file_writer->AppendRowGroup()->NextColumn());
+    column_writer->WriteBatch(static_cast<int64_t>(values.size()), nullptr, nullptr,
+                              values.data());
+  }
+  file_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  return buffer;
+}
+
+TEST(ParquetRoundtrip, AppendRowGroups) {
+  auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "root", Repetition::REQUIRED,
+      {PrimitiveNode::Make("a", Repetition::REQUIRED, nullptr, Type::INT32)}));
+  auto first = std::make_shared<::arrow::io::BufferReader>(
+      WriteInt32RowGroups(schema, {{1, 2, 3}, {4, 5}}));
+  auto second = std::make_shared<::arrow::io::BufferReader>(
+      WriteInt32RowGroups(schema, {{6}, {7, 8, 9, 10}}));
+  auto first_metadata = ParquetFileReader::Open(first)->metadata();
+  auto second_metadata = ParquetFileReader::Open(second)->metadata();
+
+  // Mix copied row groups with a regular one
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema);
+  int32_t value = 0;
+  static_cast<Int32Writer*>(file_writer->AppendRowGroup()->NextColumn())
+      ->WriteBatch(1, nullptr, nullptr, &value);
+  file_writer->AppendRowGroups(first, *first_metadata);
+  file_writer->AppendRowGroups(second, *second_metadata, {1});
+  ASSERT_EQ(file_writer->num_row_groups(), 4);
+  file_writer->Close();
+  ASSERT_EQ(file_writer->metadata()->num_rows(), 10);
+
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  ASSERT_EQ(file_reader->metadata()->num_row_groups(), 4);
+  const std::vector<std::vector<int32_t>> expected = {
+      {0}, {1, 2, 3}, {4, 5}, {7, 8, 9, 10}};
+  for (int i = 0; i < 4; ++i) {
+    auto row_group_reader = file_reader->RowGroup(i);
+    auto column_reader =
+        std::static_pointer_cast<Int32Reader>(row_group_reader->Column(0));
+    std::vector<int32_t> values(16);
+    int64_t values_read = 0;
+    column_reader->ReadBatch(16, nullptr, nullptr, values.data(), &values_read);
+    values.resize(values_read);
+    EXPECT_EQ(values, expected[i]);
+
+    auto statistics = row_group_reader->metadata()->ColumnChunk(0)->statistics();
+    ASSERT_NE(statistics, nullptr);
+    auto int32_statistics = std::static_pointer_cast<Int32Statistics>(statistics);
+    EXPECT_EQ(int32_statistics->min(), expected[i].front());
+    EXPECT_EQ(int32_statistics->max(), expected[i].back());
+  }
+
+  auto other_schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "root", Repetition::REQUIRED,
+      {PrimitiveNode::Make("b", Repetition::REQUIRED, nullptr, Type::INT32)}));
+  auto other_writer = ParquetFileWriter::Open(CreateOutputStream(), other_schema);
+  ASSERT_THROW(other_writer->AppendRowGroups(first, *first_metadata), ParquetException);
+}
+
 }  // namespace test
 
 }  // namespace parquet
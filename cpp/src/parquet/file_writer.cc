@@ -17,7 +17,9 @@
 
 #include "parquet/file_writer.h"
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <string>
 #include <utility>
@@ -328,6 +330,7 @@ class FileSerializer : public ParquetFileWriter::Contents {
       if (row_group_writer_) {
         num_rows_ += row_group_writer_->num_rows();
         row_group_writer_->Close();
+        WriteRowGroupPageIndex();
       }
       row_group_writer_.reset();
 
@@ -358,6 +361,7 @@ class FileSerializer : public ParquetFileWriter::Contents {
   RowGroupWriter* AppendRowGroup(bool buffered_row_group) {
     if (row_group_writer_) {
       row_group_writer_->Close();
+      WriteRowGroupPageIndex();
     }
     int16_t row_group_ordinal = -1;  // row group ordinal not set
     if (file_encryptor_ != nullptr) {
@@ -386,6 +390,49 @@ class FileSerializer : public ParquetFileWriter::Contents {
 
   RowGroupWriter* AppendBufferedRowGroup() override { return AppendRowGroup(true); }
 
+  void AppendRowGroups(const std::shared_ptr<ArrowInputFile>& source,
+                       const FileMetaData& metadata,
+                       const std::vector<int>& row_groups) override {
+    if (file_encryptor_ != nullptr || metadata.is_encryption_algorithm_set()) {
+      throw ParquetException("Cannot copy row groups from or into an encrypted file");
+    }
+    if (row_group_writer_) {
+      num_rows_ += row_group_writer_->num_rows();
+      row_group_writer_->Close();
+      WriteRowGroupPageIndex();
+      row_group_writer_.reset();
+    }
+
+    std::vector<int> ordinals = row_groups;
+    if (ordinals.empty()) {
+      ordinals.resize(metadata.num_row_groups());
+      std::iota(ordinals.begin(), ordinals.end(), 0);
+    }
+    std::vector<int64_t> column_chunk_offsets(metadata.num_columns());
+    for (int ordinal : ordinals) {
+      auto row_group = metadata.RowGroup(ordinal);
+      for (int i = 0; i < row_group->num_columns(); ++i) {
+        auto column_chunk = row_group->ColumnChunk(i);
+        int64_t start = column_chunk->data_page_offset();
+        if (column_chunk->has_dictionary_page() &&
+            column_chunk->dictionary_page_offset() > 0) {
+          start = column_chunk->dictionary_page_offset();
+        }
+        PARQUET_ASSIGN_OR_THROW(column_chunk_offsets[i], sink_->Tell());
+        CopyBytes(source.get(), start, column_chunk->total_compressed_size());
+      }
+      metadata_->AppendRowGroup(metadata, ordinal, column_chunk_offsets);
+      if (page_index_builder_) {
+        // Keep the page index aligned with the row group ordinals; the copied row
+        // group has no page index of its own.
+        page_index_builder_->AppendRowGroup();
+        WriteRowGroupPageIndex();
+      }
+      num_row_groups_++;
+      num_rows_ += row_group->num_rows();
+    }
+  }
+
   void AddKeyValueMetadata(
       const std::shared_ptr<const KeyValueMetadata>& key_value_metadata) override {
     if (key_value_metadata_ == nullptr) {
@@ -453,14 +500,37 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
   }
 
+  void CopyBytes(ArrowInputFile* source, int64_t offset, int64_t length) {
+    constexpr int64_t kCopyBufferSize = 1 << 20;
+    while (length > 0) {
+      PARQUET_ASSIGN_OR_THROW(auto buffer,
+                              source->ReadAt(offset, std::min(length, kCopyBufferSize)));
+      if (buffer->size() == 0) {
+        throw ParquetException("Unexpected end of file while copying a column chunk");
+      }
+      PARQUET_THROW_NOT_OK(sink_->Write(buffer));
+      offset += buffer->size();
+      length -= buffer->size();
+    }
+  }
+
+  void WriteRowGroupPageIndex() {
+    if (page_index_builder_ != nullptr && properties_->write_page_index_per_row_group()) {
+      // Serialize page index of the closed row group and release its memory. The
+      // location is reported to the file metadata when the file is closed.
+      page_index_builder_->WriteRowGroupsTo(sink_.get(), &page_index_location_);
+    }
+  }
+
   void WritePageIndex() {
     if (page_index_builder_ != nullptr) {
       // Serialize page index after all row groups have been written and report
       // location to the file metadata.
-      PageIndexLocation page_index_location;
       page_index_builder_->Finish();
-      page_index_builder_->WriteTo(sink_.get(), &page_index_location);
-      metadata_->SetPageIndexLocation(page_index_location);
+      if (!properties_->write_page_index_per_row_group()) {
+        page_index_builder_->WriteTo(sink_.get(), &page_index_location_);
+      }
+      metadata_->SetPageIndexLocation(page_index_location_);
     }
   }
 
@@ -473,6 +543,8 @@ class FileSerializer : public ParquetFileWriter::Contents {
   // Only one of the row group writers is active at a time
   std::unique_ptr<RowGroupWriter> row_group_writer_;
   std::unique_ptr<PageIndexBuilder> page_index_builder_;
+  // Location of the page index written so far
+  PageIndexLocation page_index_location_;
   std::unique_ptr<InternalFileEncryptor> file_encryptor_;
 
   void StartFile() {
@@ -632,6 +704,18 @@ RowGroupWriter* ParquetFileWriter::AppendBufferedRowGroup() {
   return contents_->AppendBufferedRowGroup();
 }
 
+void ParquetFileWriter::Contents::AppendRowGroups(
+    const std::shared_ptr<ArrowInputFile>& source, const FileMetaData& metadata,
+    const std::vector<int>& row_groups) {
+  ParquetException::NYI("Appending row groups with this file writer");
+}
+
+void ParquetFileWriter::AppendRowGroups(const std::shared_ptr<ArrowInputFile>& source,
+                                        const FileMetaData& metadata,
+                                        const std::vector<int>& row_groups) {
+  contents_->AppendRowGroups(source, metadata, row_groups);
+}
+
 void ParquetFileWriter::AddKeyValueMetadata(
     const std::shared_ptr<const KeyValueMetadata>& key_value_metadata) {
   if (contents_) {
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "parquet/metadata.h"
 #include "parquet/platform.h"
@@ -149,6 +150,10 @@ class PARQUET_EXPORT ParquetFileWriter {
 
     virtual RowGroupWriter* AppendRowGroup() = 0;
     virtual RowGroupWriter* AppendBufferedRowGroup() = 0;
+    // The default implementation throws ParquetException
+    virtual void AppendRowGroups(const std::shared_ptr<ArrowInputFile>& source,
+                                 const FileMetaData& metadata,
+                                 const std::vector<int>& row_groups);
 
     virtual int64_t num_rows() const = 0;
     virtual int num_columns() const = 0;
@@ -200,6 +205,24 @@ class PARQUET_EXPORT ParquetFileWriter {
   /// until the next call to AppendRowGroup or AppendBufferedRowGroup or Close.
   RowGroupWriter* AppendBufferedRowGroup();
 
+  /// \brief Append row groups of another Parquet file by copying their column chunks
+  /// byte for byte, without decoding or re-encoding any page.
+  ///
+  /// This makes concatenating or compacting files with the same schema as cheap as
+  /// copying their data.  Statistics, encodings and sorting columns of the copied
+  /// row groups are preserved, but not their page index or bloom filters.  Any row
+  /// group writer previously returned is closed first.
+  ///
+  /// \param[in] source the Parquet file to copy the column chunks from.
+  /// \param[in] metadata the file metadata of `source`.
+  /// \param[in] row_groups the ordinals of the row groups to copy, all of them if
+  /// empty.
+  /// \throws ParquetException if the schemas are not equal or either file is
+  /// encrypted.
+  void AppendRowGroups(const std::shared_ptr<ArrowInputFile>& source,
+                       const FileMetaData& metadata,
+                       const std::vector<int>& row_groups = {});
+
   /// \brief Add key-value metadata to the file.
   /// \param[in] key_value_metadata the metadata to add.
   /// \note This will overwrite any existing metadata with the same key(s).
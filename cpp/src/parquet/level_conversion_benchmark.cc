@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <random>
 #include <vector>
 
 #include "benchmark/benchmark.h"
@@ -78,3 +79,88 @@ void BM_DefinitionLevelsToBitmapRepeatedMostPresent(::benchmark::State& state) {
 }
 
 BENCHMARK(BM_DefinitionLevelsToBitmapRepeatedMostPresent);
+
+// Appends the levels of a list of optional values with `length` elements, or an
+// empty list if `length` is zero, to a column at the given nesting depth.
+void AppendListLevels(int64_t length, int16_t list_def_level, int16_t rep_level,
+                      std::default_random_engine* rng, std::vector<int16_t>* def_levels,
+                      std::vector<int16_t>* rep_levels) {
+  if (length == 0) {
+    def_levels->push_back(list_def_level);
+    rep_levels->push_back(rep_level);
+    return;
+  }
+  std::bernoulli_distribution is_null(0.1);
+  for (int64_t i = 0; i < length; ++i) {
+    def_levels->push_back(is_null(*rng) ? list_def_level + 1 : list_def_level + 2);
+    rep_levels->push_back(i == 0 ? rep_level : rep_level + 1);
+  }
+}
+
+void RunDefRepLevelsToList(const std::vector<int16_t>& def_levels,
+                           const std::vector<int16_t>& rep_levels,
+                           parquet::internal::LevelInfo info, ::benchmark::State* state) {
+  std::vector<int32_t> offsets(def_levels.size() + 1, 0);
+  std::vector<uint8_t> bitmap(def_levels.size() / 8 + 1, 0);
+  for (auto _ : *state) {
+    parquet::internal::ValidityBitmapInputOutput validity_io;
+    validity_io.values_read_upper_bound = def_levels.size();
+    validity_io.valid_bits = bitmap.data();
+    parquet::internal::DefRepLevelsToList(def_levels.data(), rep_levels.data(),
+                                          def_levels.size(), info, &validity_io,
+                                          offsets.data());
+    ::benchmark::DoNotOptimize(offsets.data());
+  }
+  state->SetItemsProcessed(int64_t(state->iterations()) * def_levels.size());
+}
+
+// list<int32> with lists of random length averaging state.range(0) elements.
+void BM_DefRepLevelsToList(::benchmark::State& state) {
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int64_t> list_length(0, 2 * state.range(0));
+  std::vector<int16_t> def_levels, rep_levels;
+  while (static_cast<int64_t>(def_levels.size()) < kLevelCount) {
+    AppendListLevels(list_length(rng), /*list_def_level=*/1, /*rep_level=*/0, &rng,
+                     &def_levels, &rep_levels);
+  }
+  parquet::internal::LevelInfo info;
+  info.def_level = 2;
+  info.rep_level = 1;
+  info.repeated_ancestor_def_level = 0;
+  RunDefRepLevelsToList(def_levels, rep_levels, info, &state);
+}
+
+BENCHMARK(BM_DefRepLevelsToList)->Arg(1)->Arg(8)->Arg(64);
+
+// list<list<int32>> with inner lists of random length averaging state.range(0)
+// elements, reconstructing the outer (state.range(1) == 1) or inner lists.
+void BM_DefRepLevelsToNestedList(::benchmark::State& state) {
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int64_t> outer_length(1, 8);
+  std::uniform_int_distribution<int64_t> inner_length(0, 2 * state.range(0));
+  std::vector<int16_t> def_levels, rep_levels;
+  while (static_cast<int64_t>(def_levels.size()) < kLevelCount) {
+    const int64_t num_inner_lists = outer_length(rng);
+    for (int64_t i = 0; i < num_inner_lists; ++i) {
+      const auto begin = rep_levels.size();
+      AppendListLevels(inner_length(rng), /*list_def_level=*/3, /*rep_level=*/1, &rng,
+                       &def_levels, &rep_levels);
+      if (i == 0) {
+        rep_levels[begin] = 0;
+      }
+    }
+  }
+  parquet::internal::LevelInfo info;
+  if (state.range(1) == 1) {
+    info.def_level = 2;
+    info.rep_level = 1;
+    info.repeated_ancestor_def_level = 0;
+  } else {
+    info.def_level = 4;
+    info.rep_level = 2;
+    info.repeated_ancestor_def_level = 2;
+  }
+  RunDefRepLevelsToList(def_levels, rep_levels, info, &state);
+}
+
+BENCHMARK(BM_DefRepLevelsToNestedList)->ArgsProduct({{1, 8, 64}, {1, 2}});
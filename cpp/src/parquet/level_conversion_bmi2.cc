@@ -28,4 +28,18 @@ void DefLevelsToBitmapBmi2WithRepeatedParent(const int16_t* def_levels,
                                                             level_info, output);
 }
 
+void DefRepLevelsToListBmi2(const int16_t* def_levels, const int16_t* rep_levels,
+                            int64_t num_def_levels, LevelInfo level_info,
+                            ValidityBitmapInputOutput* output, int32_t* offsets) {
+  bmi2::DefRepLevelsToListSimd(def_levels, rep_levels, num_def_levels, level_info,
+                               output, offsets);
+}
+
+void DefRepLevelsToListBmi2(const int16_t* def_levels, const int16_t* rep_levels,
+                            int64_t num_def_levels, LevelInfo level_info,
+                            ValidityBitmapInputOutput* output, int64_t* offsets) {
+  bmi2::DefRepLevelsToListSimd(def_levels, rep_levels, num_def_levels, level_info,
+                               output, offsets);
+}
+
 }  // namespace parquet::internal
@@ -21,6 +21,8 @@
 #include <algorithm>
 #include <cstdint>
 #include <limits>
+#include <optional>
+#include <sstream>
 
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
@@ -351,4 +353,124 @@ void DefLevelsToBitmapSimd(const int16_t* def_levels, int64_t num_def_levels,
   writer.Finish();
 }
 
+// The lowest `num_bits` bits set, for 0 <= num_bits <= 64
+inline uint64_t LowBitsMask(int64_t num_bits) {
+  return num_bits >= 64 ? ~uint64_t{0} : (uint64_t{1} << num_bits) - 1;
+}
+
+// Adds `count` elements to the list ending at `*offset`
+template <typename OffsetType>
+void AddListElements(OffsetType* offset, int64_t count) {
+  if (ARROW_PREDICT_FALSE(count > std::numeric_limits<OffsetType>::max() - *offset)) {
+    throw ParquetException("List index overflow.");
+  }
+  *offset += static_cast<OffsetType>(count);
+}
+
+// Reconstructs the lists of up to kExtractBitsSize levels from bitmaps of the levels
+// that start a list and of those that are list elements, instead of level by level.
+// Returns the number of lists started.
+template <typename OffsetType>
+int64_t DefRepLevelsBatchToList(const int16_t* def_levels, const int16_t* rep_levels,
+                                int64_t batch_size, int64_t upper_bound_remaining,
+                                LevelInfo level_info, ValidityBitmapInputOutput* output,
+                                ::arrow::internal::FirstTimeBitmapWriter* writer,
+                                OffsetType** offsets) {
+  ARROW_DCHECK_LE(batch_size, kExtractBitsSize);
+  const uint64_t batch_mask = LowBitsMask(batch_size);
+
+  // Skip items that belong to empty or null ancestor lists and further nested lists.
+  const uint64_t present = internal::GreaterThanBitmap(
+      def_levels, batch_size, level_info.repeated_ancestor_def_level - 1);
+  const uint64_t nested =
+      internal::GreaterThanBitmap(rep_levels, batch_size, level_info.rep_level);
+  const uint64_t continuations =
+      internal::GreaterThanBitmap(rep_levels, batch_size, level_info.rep_level - 1);
+  const uint64_t relevant = present & ~nested & batch_mask;
+  // current_rep < list rep_level i.e. start of a list
+  const uint64_t starts = relevant & ~continuations;
+  const int64_t num_starts = ::arrow::bit_util::PopCount(starts);
+  if (ARROW_PREDICT_FALSE(num_starts > upper_bound_remaining)) {
+    std::stringstream ss;
+    ss << "Definition levels exceeded upper bound: " << output->values_read_upper_bound;
+    throw ParquetException(ss.str());
+  }
+
+  if (writer != nullptr) {
+    // the level_info def level for lists reflects element present level.
+    // the prior level distinguishes between empty lists.
+    const auto non_null = static_cast<extract_bitmap_t>(
+        internal::GreaterThanBitmap(def_levels, batch_size, level_info.def_level - 2));
+    const auto valid_bits = ExtractBits(non_null, static_cast<extract_bitmap_t>(starts));
+    writer->AppendWord(valid_bits, num_starts);
+    output->null_count += num_starts - ::arrow::bit_util::PopCount(valid_bits);
+  }
+
+  // offsets can be null for structs with repeated children (we don't need to know
+  // offsets until we get to the children).
+  if (*offsets != nullptr) {
+    // A continuation is always an element, a list start only if it isn't empty
+    const uint64_t elements =
+        (relevant & continuations) |
+        (starts & internal::GreaterThanBitmap(def_levels, batch_size,
+                                              level_info.def_level - 1));
+    // Elements before the first list start continue the previous list
+    uint64_t remaining_starts = starts;
+    int64_t list_begin =
+        starts == 0 ? batch_size : ::arrow::bit_util::CountTrailingZeros(starts);
+    AddListElements(*offsets, ::arrow::bit_util::PopCount(elements &
+                                                          LowBitsMask(list_begin)));
+    while (remaining_starts != 0) {
+      remaining_starts &= remaining_starts - 1;
+      const int64_t list_end = remaining_starts == 0
+                                   ? batch_size
+                                   : ::arrow::bit_util::CountTrailingZeros(
+                                         remaining_starts);
+      // Use cumulative offsets because variable size lists are more common than
+      // fixed size lists so it should be cheaper to make these cumulative and
+      // subtract when validating fixed size lists.
+      OffsetType* list_offset = ++*offsets;
+      *list_offset = *(list_offset - 1);
+      AddListElements(list_offset,
+                      ::arrow::bit_util::PopCount((elements >> list_begin) &
+                                                  LowBitsMask(list_end - list_begin)));
+      list_begin = list_end;
+    }
+  }
+  return num_starts;
+}
+
+template <typename OffsetType>
+void DefRepLevelsToListSimd(const int16_t* def_levels, const int16_t* rep_levels,
+                            int64_t num_def_levels, LevelInfo level_info,
+                            ValidityBitmapInputOutput* output, OffsetType* offsets) {
+  std::optional<::arrow::internal::FirstTimeBitmapWriter> writer;
+  if (output->valid_bits) {
+    writer.emplace(output->valid_bits, output->valid_bits_offset,
+                   output->values_read_upper_bound);
+  }
+  const bool has_offsets = offsets != nullptr;
+  int64_t num_lists = 0;
+  while (num_def_levels > 0) {
+    const int64_t batch_size = std::min(num_def_levels, kExtractBitsSize);
+    num_lists += DefRepLevelsBatchToList(
+        def_levels, rep_levels, batch_size, output->values_read_upper_bound - num_lists,
+        level_info, output, writer.has_value() ? &*writer : nullptr, &offsets);
+    def_levels += batch_size;
+    rep_levels += batch_size;
+    num_def_levels -= batch_size;
+  }
+  if (writer.has_value()) {
+    writer->Finish();
+  }
+  if (has_offsets || writer.has_value()) {
+    output->values_read = num_lists;
+  }
+  if (output->null_count > 0 && level_info.null_slot_usage > 1) {
+    throw ParquetException(
+        "Null values with null_slot_usage > 1 not supported."
+        "(i.e. FixedSizeLists with null values are not supported)");
+  }
+}
+
 }  // namespace parquet::internal::PARQUET_IMPL_NAMESPACE
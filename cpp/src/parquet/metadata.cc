@@ -19,7 +19,9 @@
 
 #include <algorithm>
 #include <cinttypes>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <random>
 #include <sstream>
@@ -524,6 +526,81 @@ const std::shared_ptr<const KeyValueMetadata>& ColumnChunkMetaData::key_value_me
   return impl_->key_value_metadata();
 }
 
+namespace {
+
+// A row group of a lazily deserialized footer, see
+// ReaderProperties::enable_lazy_metadata_deserialization().
+//
+// The row group is deserialized from the serialized footer in place when first
+// accessed, except for its column chunks, which are deserialized one by one when
+// first accessed.  This class is thread-safe.
+class LazyRowGroup {
+ public:
+  LazyRowGroup(const uint8_t* serialized, uint32_t serialized_len,
+               format::RowGroup* row_group, const ReaderProperties& properties)
+      : serialized_(serialized),
+        serialized_len_(serialized_len),
+        row_group_(row_group),
+        deserializer_(properties) {}
+
+  // Deserialize the fields of the row group other than its column chunks
+  void DeserializeRowGroup() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DeserializeRowGroupUnlocked();
+  }
+
+  const format::ColumnChunk& column(int i) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DeserializeRowGroupUnlocked();
+    DeserializeColumnUnlocked(i);
+    return row_group_->columns[i];
+  }
+
+  // Deserialize the row group and all its column chunks
+  void DeserializeAll() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DeserializeRowGroupUnlocked();
+    for (size_t i = 0; i < column_ranges_.size(); ++i) {
+      DeserializeColumnUnlocked(i);
+    }
+  }
+
+ private:
+  // Field id of RowGroup.columns in parquet.thrift
+  static constexpr int16_t kColumnsFieldId = 1;
+
+  void DeserializeRowGroupUnlocked() {
+    if (row_group_deserialized_) return;
+    uint32_t len = serialized_len_;
+    column_ranges_ = deserializer_.DeserializeMessageExceptList(
+        serialized_, &len, kColumnsFieldId, row_group_);
+    row_group_->columns.resize(column_ranges_.size());
+    column_deserialized_.resize(column_ranges_.size(), false);
+    row_group_deserialized_ = true;
+  }
+
+  void DeserializeColumnUnlocked(size_t i) {
+    if (column_deserialized_[i]) return;
+    const auto& [begin, end] = column_ranges_[i];
+    uint32_t len = end - begin;
+    deserializer_.DeserializeMessage(serialized_ + begin, &len, &row_group_->columns[i]);
+    column_deserialized_[i] = true;
+  }
+
+  std::mutex mutex_;
+  // The serialized RowGroup, owned by the FileMetaData
+  const uint8_t* serialized_;
+  const uint32_t serialized_len_;
+  format::RowGroup* row_group_;
+  ThriftDeserializer deserializer_;
+  bool row_group_deserialized_ = false;
+  // The byte ranges of the serialized column chunks in serialized_
+  std::vector<std::pair<uint32_t, uint32_t>> column_ranges_;
+  std::vector<bool> column_deserialized_;
+};
+
+}  // namespace
+
 // row-group metadata
 class RowGroupMetaData::RowGroupMetaDataImpl {
  public:
@@ -531,12 +608,14 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
                                 const SchemaDescriptor* schema,
                                 const ReaderProperties& properties,
                                 const ApplicationVersion* writer_version,
-                                std::shared_ptr<InternalFileDecryptor> file_decryptor)
+                                std::shared_ptr<InternalFileDecryptor> file_decryptor,
+                                LazyRowGroup* lazy_row_group)
       : row_group_(row_group),
         schema_(schema),
         properties_(properties),
         writer_version_(writer_version),
-        file_decryptor_(std::move(file_decryptor)) {
+        file_decryptor_(std::move(file_decryptor)),
+        lazy_row_group_(lazy_row_group) {
     if (ARROW_PREDICT_FALSE(row_group_->columns.size() >
                             static_cast<size_t>(std::numeric_limits<int>::max()))) {
       throw ParquetException("Row group had too many columns: ",
@@ -545,6 +624,8 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
   }
 
   bool Equals(const RowGroupMetaDataImpl& other) const {
+    if (lazy_row_group_ != nullptr) lazy_row_group_->DeserializeAll();
+    if (other.lazy_row_group_ != nullptr) other.lazy_row_group_->DeserializeAll();
     return *row_group_ == *other.row_group_;
   }
 
@@ -566,8 +647,11 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
     if (i >= 0 && i < num_columns()) {
       int16_t row_group_ordinal =
           row_group_->__isset.ordinal ? row_group_->ordinal : static_cast<int16_t>(-1);
-      return ColumnChunkMetaData::Make(&row_group_->columns[i], schema_->Column(i),
-                                       properties_, writer_version_, row_group_ordinal, i,
+      const format::ColumnChunk* column = lazy_row_group_ != nullptr
+                                              ? &lazy_row_group_->column(i)
+                                              : &row_group_->columns[i];
+      return ColumnChunkMetaData::Make(column, schema_->Column(i), properties_,
+                                       writer_version_, row_group_ordinal, i,
                                        file_decryptor_);
     }
     throw ParquetException("The file only has ", num_columns(),
@@ -592,6 +676,7 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
   const ReaderProperties properties_;
   const ApplicationVersion* writer_version_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  LazyRowGroup* lazy_row_group_;
 };
 
 std::unique_ptr<RowGroupMetaData> RowGroupMetaData::Make(
@@ -605,10 +690,12 @@ std::unique_ptr<RowGroupMetaData> RowGroupMetaData::Make(
 RowGroupMetaData::RowGroupMetaData(const void* metadata, const SchemaDescriptor* schema,
                                    const ReaderProperties& properties,
                                    const ApplicationVersion* writer_version,
-                                   std::shared_ptr<InternalFileDecryptor> file_decryptor)
+                                   std::shared_ptr<InternalFileDecryptor> file_decryptor,
+                                   void* lazy_row_group)
     : impl_{new RowGroupMetaDataImpl(reinterpret_cast<const format::RowGroup*>(metadata),
                                      schema, properties, writer_version,
-                                     std::move(file_decryptor))} {}
+                                     std::move(file_decryptor),
+                                     static_cast<LazyRowGroup*>(lazy_row_group))} {}
 
 RowGroupMetaData::~RowGroupMetaData() = default;
 
@@ -706,9 +793,26 @@ class FileMetaData::FileMetaDataImpl {
         file_decryptor_ != nullptr ? file_decryptor_->GetFooterDecryptor() : nullptr;
 
     ThriftDeserializer deserializer(properties_);
-    deserializer.DeserializeMessage(reinterpret_cast<const uint8_t*>(metadata),
-                                    metadata_len, metadata_.get(),
-                                    footer_decryptor.get());
+    if (properties_.is_lazy_metadata_deserialization_enabled() &&
+        footer_decryptor == nullptr) {
+      // Keep the serialized footer around and only index the row groups
+      serialized_metadata_ = AllocateBuffer(properties_.memory_pool(), *metadata_len);
+      std::memcpy(serialized_metadata_->mutable_data(), metadata, *metadata_len);
+      const uint8_t* serialized = serialized_metadata_->data();
+      auto row_group_ranges = deserializer.DeserializeMessageExceptList(
+          serialized, metadata_len, kRowGroupsFieldId, metadata_.get());
+      metadata_->row_groups.resize(row_group_ranges.size());
+      lazy_row_groups_.reserve(row_group_ranges.size());
+      for (size_t i = 0; i < row_group_ranges.size(); ++i) {
+        const auto& [begin, end] = row_group_ranges[i];
+        lazy_row_groups_.push_back(std::make_unique<LazyRowGroup>(
+            serialized + begin, end - begin, &metadata_->row_groups[i], properties_));
+      }
+    } else {
+      deserializer.DeserializeMessage(reinterpret_cast<const uint8_t*>(metadata),
+                                      metadata_len, metadata_.get(),
+                                      footer_decryptor.get());
+    }
     metadata_len_ = *metadata_len;
 
     if (metadata_->__isset.created_by) {
@@ -728,6 +832,7 @@ class FileMetaData::FileMetaDataImpl {
       throw ParquetException("Decryption not set properly. cannot verify signature");
     }
     // serialize the footer
+    DeserializeAll();
     uint8_t* serialized_data;
     uint32_t serialized_len = metadata_len_;
     ThriftSerializer serializer;
@@ -785,6 +890,7 @@ class FileMetaData::FileMetaDataImpl {
 
   void WriteTo(::arrow::io::OutputStream* dst,
                const std::shared_ptr<Encryptor>& encryptor) const {
+    DeserializeAll();
     ThriftSerializer serializer;
     // Only in encrypted files with plaintext footers the
     // encryption_algorithm is set in footer
@@ -820,11 +926,20 @@ class FileMetaData::FileMetaDataImpl {
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
-    return RowGroupMetaData::Make(&metadata_->row_groups[i], &schema_, properties_,
-                                  &writer_version_, file_decryptor_);
+    if (lazy_row_groups_.empty()) {
+      return RowGroupMetaData::Make(&metadata_->row_groups[i], &schema_, properties_,
+                                    &writer_version_, file_decryptor_);
+    }
+    LazyRowGroup* lazy_row_group = lazy_row_groups_[i].get();
+    lazy_row_group->DeserializeRowGroup();
+    return std::unique_ptr<RowGroupMetaData>(
+        new RowGroupMetaData(&metadata_->row_groups[i], &schema_, properties_,
+                             &writer_version_, file_decryptor_, lazy_row_group));
   }
 
   bool Equals(const FileMetaDataImpl& other) const {
+    DeserializeAll();
+    other.DeserializeAll();
     return *metadata_ == *other.metadata_;
   }
 
@@ -835,6 +950,7 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   void set_file_path(const std::string& path) {
+    DeserializeAll();
     for (format::RowGroup& row_group : metadata_->row_groups) {
       for (format::ColumnChunk& chunk : row_group.columns) {
         chunk.__set_file_path(path);
@@ -849,6 +965,9 @@ class FileMetaData::FileMetaDataImpl {
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
+    if (!lazy_row_groups_.empty()) {
+      lazy_row_groups_[i]->DeserializeAll();
+    }
     return metadata_->row_groups[i];
   }
 
@@ -859,6 +978,11 @@ class FileMetaData::FileMetaDataImpl {
       throw ParquetException(msg);
     }
 
+    // Row groups are appended in place, which would invalidate the lazy ones
+    DeserializeAll();
+    lazy_row_groups_.clear();
+    serialized_metadata_.reset();
+
     // ARROW-13654: `other` may point to self, be careful not to enter an infinite loop
     const int n = other->num_row_groups();
     // ARROW-16613: do not use reserve() as that may suppress overallocation
@@ -914,6 +1038,7 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   std::string SerializeUnencrypted(bool scrub, bool debug) const {
+    DeserializeAll();
     auto md = *metadata_;
     if (scrub) Scrub(&md);
     if (debug) {
@@ -938,8 +1063,24 @@ class FileMetaData::FileMetaDataImpl {
 
  private:
   friend FileMetaDataBuilder;
+
+  // Field id of FileMetaData.row_groups in parquet.thrift
+  static constexpr int16_t kRowGroupsFieldId = 4;
+
+  // Deserialize the row groups not deserialized yet, if the footer is
+  // deserialized lazily
+  void DeserializeAll() const {
+    for (const auto& lazy_row_group : lazy_row_groups_) {
+      lazy_row_group->DeserializeAll();
+    }
+  }
+
   uint32_t metadata_len_ = 0;
   std::unique_ptr<format::FileMetaData> metadata_;
+  // If the footer is deserialized lazily, the serialized footer and a lazy row
+  // group for each of metadata_->row_groups
+  std::shared_ptr<Buffer> serialized_metadata_;
+  std::vector<std::unique_ptr<LazyRowGroup>> lazy_row_groups_;
   SchemaDescriptor schema_;
   ApplicationVersion writer_version_;
   std::shared_ptr<const KeyValueMetadata> key_value_metadata_;
@@ -1930,6 +2071,55 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     return current_row_group_builder_.get();
   }
 
+  void AppendRowGroup(const SchemaDescriptor& source_schema,
+                      const format::RowGroup& source,
+                      const std::vector<int64_t>& column_chunk_offsets) {
+    std::ostringstream diff_output;
+    if (!schema_->Equals(source_schema, &diff_output)) {
+      throw ParquetException("AppendRowGroup requires equal schemas.\n" +
+                             diff_output.str());
+    }
+    if (source.columns.size() != column_chunk_offsets.size()) {
+      throw ParquetException("Expected ", source.columns.size(),
+                             " column chunk offsets, got ",
+                             column_chunk_offsets.size());
+    }
+    current_row_group_builder_.reset();
+    row_groups_.push_back(source);
+
+    format::RowGroup& row_group = row_groups_.back();
+    for (size_t i = 0; i < row_group.columns.size(); ++i) {
+      format::ColumnChunk& column_chunk = row_group.columns[i];
+      format::ColumnMetaData& column_metadata = column_chunk.meta_data;
+      const bool has_dictionary_page = column_metadata.__isset.dictionary_page_offset &&
+                                       column_metadata.dictionary_page_offset > 0;
+      const int64_t delta =
+          column_chunk_offsets[i] - (has_dictionary_page
+                                         ? column_metadata.dictionary_page_offset
+                                         : column_metadata.data_page_offset);
+      column_metadata.data_page_offset += delta;
+      if (has_dictionary_page) {
+        column_metadata.dictionary_page_offset += delta;
+      }
+      if (column_metadata.__isset.index_page_offset) {
+        column_metadata.index_page_offset += delta;
+      }
+      column_metadata.__isset.bloom_filter_offset = false;
+      column_metadata.__isset.bloom_filter_length = false;
+
+      // The `file_offset` field is deprecated and should be set to 0.
+      column_chunk.__set_file_offset(0);
+      column_chunk.__isset.file_path = false;
+      column_chunk.__isset.offset_index_offset = false;
+      column_chunk.__isset.offset_index_length = false;
+      column_chunk.__isset.column_index_offset = false;
+      column_chunk.__isset.column_index_length = false;
+    }
+    row_group.__set_file_offset(column_chunk_offsets.empty() ? 0
+                                                             : column_chunk_offsets[0]);
+    row_group.__isset.ordinal = false;
+  }
+
   void SetPageIndexLocation(const PageIndexLocation& location) {
     auto set_index_location =
         [this](size_t row_group_ordinal,
@@ -2078,6 +2268,13 @@ RowGroupMetaDataBuilder* FileMetaDataBuilder::AppendRowGroup() {
   return impl_->AppendRowGroup();
 }
 
+void FileMetaDataBuilder::AppendRowGroup(
+    const FileMetaData& source, int row_group,
+    const std::vector<int64_t>& column_chunk_offsets) {
+  impl_->AppendRowGroup(*source.schema(), source.impl_->row_group(row_group),
+                        column_chunk_offsets);
+}
+
 void FileMetaDataBuilder::SetPageIndexLocation(const PageIndexLocation& location) {
   impl_->SetPageIndexLocation(location);
 }
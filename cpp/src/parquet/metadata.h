@@ -231,11 +231,15 @@ class PARQUET_EXPORT RowGroupMetaData {
   std::vector<SortingColumn> sorting_columns() const;
 
  private:
+  friend class FileMetaData;
+  // If not null, lazy_row_group deserializes the column chunks of a lazily
+  // deserialized footer as they are accessed.
   explicit RowGroupMetaData(
       const void* metadata, const SchemaDescriptor* schema,
       const ReaderProperties& properties,
       const ApplicationVersion* writer_version = NULLPTR,
-      std::shared_ptr<InternalFileDecryptor> file_decryptor = NULLPTR);
+      std::shared_ptr<InternalFileDecryptor> file_decryptor = NULLPTR,
+      void* lazy_row_group = NULLPTR);
   // PIMPL Idiom
   class RowGroupMetaDataImpl;
   std::unique_ptr<RowGroupMetaDataImpl> impl_;
@@ -525,6 +529,19 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // The prior RowGroupMetaDataBuilder (if any) is destroyed
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  /// \brief Append the metadata of a row group of another file whose column chunks
+  /// have been copied verbatim into this file.
+  ///
+  /// Statistics, encodings and sorting columns are preserved.  The page offsets are
+  /// relocated so that the i-th column chunk starts at `column_chunk_offsets[i]`, and
+  /// the page index and bloom filter locations are dropped as those structures are
+  /// not part of the column chunks.  The prior RowGroupMetaDataBuilder (if any) is
+  /// destroyed.
+  ///
+  /// \throws ParquetException if the schemas are not equal.
+  void AppendRowGroup(const FileMetaData& source, int row_group,
+                      const std::vector<int64_t>& column_chunk_offsets);
+
   // Update location to all page indexes in the parquet file
   void SetPageIndexLocation(const PageIndexLocation& location);
 
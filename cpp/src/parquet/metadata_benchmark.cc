@@ -92,9 +92,9 @@ class MetadataBenchmark {
     return buf;
   }
 
-  void ReadFile(std::shared_ptr<Buffer> contents) {
+  void ReadFile(std::shared_ptr<Buffer> contents,
+                const ReaderProperties& props = default_reader_properties()) {
     auto source = std::make_shared<BufferReader>(contents);
-    ReaderProperties props;
     auto reader = ParquetFileReader::Open(source, props);
     auto metadata = reader->metadata();
     ARROW_CHECK_EQ(metadata->num_columns(), num_columns_);
@@ -104,6 +104,19 @@ class MetadataBenchmark {
     reader->Close();
   }
 
+  // Read the metadata of a single column chunk of each row group
+  void ReadColumnChunks(std::shared_ptr<Buffer> contents,
+                        const ReaderProperties& props = default_reader_properties()) {
+    auto source = std::make_shared<BufferReader>(contents);
+    auto reader = ParquetFileReader::Open(source, props);
+    auto metadata = reader->metadata();
+    for (int rg = 0; rg < num_row_groups_; ++rg) {
+      auto column = metadata->RowGroup(rg)->ColumnChunk(num_columns_ / 2);
+      ARROW_CHECK_EQ(column->num_values(), 1);
+    }
+    reader->Close();
+  }
+
  private:
   int num_columns_;
   int num_row_groups_;
@@ -129,6 +142,16 @@ void WriteMetadataSetArgs(benchmark::internal::Benchmark* bench) {
 
 void ReadMetadataSetArgs(benchmark::internal::Benchmark* bench) {
   WriteMetadataSetArgs(bench);
+  // Wide schemas
+  for (int num_row_groups : {1, 10}) {
+    bench->Args({/*num_columns=*/10000, num_row_groups});
+  }
+}
+
+ReaderProperties LazyMetadataReaderProperties() {
+  ReaderProperties props;
+  props.enable_lazy_metadata_deserialization();
+  return props;
 }
 
 void WriteFileMetadataAndData(benchmark::State& state) {
@@ -150,7 +173,42 @@ void ReadFileMetadata(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations());
 }
 
+void ReadFileMetadataLazy(benchmark::State& state) {
+  MetadataBenchmark benchmark(&state);
+  auto contents = benchmark.WriteFile(&state);
+  auto props = LazyMetadataReaderProperties();
+
+  for (auto _ : state) {
+    benchmark.ReadFile(contents, props);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void ReadColumnChunkMetadata(benchmark::State& state) {
+  MetadataBenchmark benchmark(&state);
+  auto contents = benchmark.WriteFile(&state);
+
+  for (auto _ : state) {
+    benchmark.ReadColumnChunks(contents);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void ReadColumnChunkMetadataLazy(benchmark::State& state) {
+  MetadataBenchmark benchmark(&state);
+  auto contents = benchmark.WriteFile(&state);
+  auto props = LazyMetadataReaderProperties();
+
+  for (auto _ : state) {
+    benchmark.ReadColumnChunks(contents, props);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
 BENCHMARK(WriteFileMetadataAndData)->Apply(WriteMetadataSetArgs);
 BENCHMARK(ReadFileMetadata)->Apply(ReadMetadataSetArgs);
+BENCHMARK(ReadFileMetadataLazy)->Apply(ReadMetadataSetArgs);
+BENCHMARK(ReadColumnChunkMetadata)->Apply(ReadMetadataSetArgs);
+BENCHMARK(ReadColumnChunkMetadataLazy)->Apply(ReadMetadataSetArgs);
 
 }  // namespace parquet
@@ -462,6 +462,58 @@ TEST(Metadata, TestSortingColumns) {
   EXPECT_EQ(sorting_columns, row_group_read_metadata->sorting_columns());
 }
 
+TEST(Metadata, TestLazyDeserialization) {
+  schema::NodeVector fields;
+  fields.push_back(schema::Int32("int_col", Repetition::REQUIRED));
+  fields.push_back(schema::Float("float_col", Repetition::REQUIRED));
+  SchemaDescriptor schema;
+  schema.Init(schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+  EncodedStatistics stats;
+  stats.set_null_count(0);
+  auto expected = GenerateTableMetaData(schema, default_writer_properties(),
+                                        /*nrows=*/1000, stats, stats);
+  const std::string serialized = expected->SerializeToString();
+
+  ReaderProperties properties;
+  properties.enable_lazy_metadata_deserialization();
+  auto make_lazy = [&]() {
+    uint32_t len = static_cast<uint32_t>(serialized.size());
+    auto metadata = FileMetaData::Make(serialized.data(), &len, properties);
+    EXPECT_EQ(serialized.size(), len);
+    return metadata;
+  };
+
+  auto lazy = make_lazy();
+  ASSERT_EQ(expected->num_row_groups(), lazy->num_row_groups());
+  ASSERT_EQ(expected->num_rows(), lazy->num_rows());
+  ASSERT_EQ(expected->created_by(), lazy->created_by());
+  ASSERT_TRUE(expected->schema()->Equals(*lazy->schema()));
+  // Access row groups and column chunks out of order
+  for (int i = lazy->num_row_groups() - 1; i >= 0; --i) {
+    auto expected_row_group = expected->RowGroup(i);
+    auto row_group = lazy->RowGroup(i);
+    ASSERT_EQ(expected_row_group->num_columns(), row_group->num_columns());
+    ASSERT_EQ(expected_row_group->num_rows(), row_group->num_rows());
+    ASSERT_EQ(expected_row_group->total_byte_size(), row_group->total_byte_size());
+    for (int j = row_group->num_columns() - 1; j >= 0; --j) {
+      ASSERT_TRUE(row_group->ColumnChunk(j)->Equals(*expected_row_group->ColumnChunk(j)));
+    }
+    ASSERT_TRUE(row_group->Equals(*expected_row_group));
+  }
+  ASSERT_TRUE(lazy->Equals(*expected));
+
+  // Operations on the whole footer deserialize the rest of it
+  ASSERT_TRUE(make_lazy()->Equals(*expected));
+  ASSERT_EQ(serialized, make_lazy()->SerializeToString());
+  ASSERT_TRUE(make_lazy()->Subset({1})->Equals(*expected->Subset({1})));
+  lazy = make_lazy();
+  lazy->AppendRowGroups(*make_lazy());
+  ASSERT_EQ(4, lazy->num_row_groups());
+  ASSERT_EQ(2 * expected->num_rows(), lazy->num_rows());
+  ASSERT_TRUE(lazy->Subset({1})->Equals(*expected->Subset({1})));
+  ASSERT_TRUE(lazy->Subset({3})->Equals(*expected->Subset({1})));
+}
+
 TEST(ApplicationVersion, Basics) {
   ApplicationVersion version("parquet-mr version 1.7.9");
   ApplicationVersion version1("parquet-mr version 1.8.0");
@@ -29,8 +29,10 @@
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/unreachable.h"
 
+#include <algorithm>
 #include <limits>
 #include <numeric>
+#include <sstream>
 
 namespace parquet {
 
@@ -781,6 +783,25 @@ class PageIndexBuilderImpl final : public PageIndexBuilder {
     return builder.get();
   }
 
+  void WriteRowGroupsTo(::arrow::io::OutputStream* sink,
+                        PageIndexLocation* location) override {
+    if (finished_) {
+      throw ParquetException(
+          "Cannot call WriteRowGroupsTo() to finished PageIndexBuilder.");
+    }
+
+    SerializeIndex(column_index_builders_, sink, &location->column_index_location);
+    SerializeIndex(offset_index_builders_, sink, &location->offset_index_location);
+
+    /// Release the builders of the written row groups.
+    for (size_t row_group = num_written_row_groups_;
+         row_group < column_index_builders_.size(); ++row_group) {
+      column_index_builders_[row_group] = {};
+      offset_index_builders_[row_group] = {};
+    }
+    num_written_row_groups_ = column_index_builders_.size();
+  }
+
   void Finish() override { finished_ = true; }
 
   void WriteTo(::arrow::io::OutputStream* sink,
@@ -811,6 +832,9 @@ class PageIndexBuilderImpl final : public PageIndexBuilder {
     if (offset_index_builders_.empty() || column_index_builders_.empty()) {
       throw ParquetException("No row group appended to PageIndexBuilder.");
     }
+    if (num_written_row_groups_ == column_index_builders_.size()) {
+      throw ParquetException("Page index of the row group is already written.");
+    }
   }
 
   std::shared_ptr<Encryptor> GetColumnMetaEncryptor(int row_group_ordinal,
@@ -839,8 +863,10 @@ class PageIndexBuilderImpl final : public PageIndexBuilder {
                                        ? encryption::kColumnIndex
                                        : encryption::kOffsetIndex;
 
-    /// Serialize the same kind of page index row group by row group.
-    for (size_t row_group = 0; row_group < page_index_builders.size(); ++row_group) {
+    /// Serialize the same kind of page index row group by row group, skipping those
+    /// already written by WriteRowGroupsTo().
+    for (size_t row_group = num_written_row_groups_;
+         row_group < page_index_builders.size(); ++row_group) {
       const auto& row_group_page_index_builders = page_index_builders[row_group];
       DCHECK_EQ(row_group_page_index_builders.size(), num_columns);
 
@@ -884,6 +910,8 @@ class PageIndexBuilderImpl final : public PageIndexBuilder {
   InternalFileEncryptor* file_encryptor_;
   std::vector<std::vector<std::unique_ptr<ColumnIndexBuilder>>> column_index_builders_;
   std::vector<std::vector<std::unique_ptr<OffsetIndexBuilder>>> offset_index_builders_;
+  /// The row groups before it are written by WriteRowGroupsTo() and have no builders.
+  size_t num_written_row_groups_ = 0;
   bool finished_ = false;
 };
 
@@ -1039,6 +1067,9 @@ std::unique_ptr<OffsetIndexBuilder> OffsetIndexBuilder::Make() {
   return std::make_unique<OffsetIndexBuilderImpl>();
 }
 
+void PageIndexBuilder::WriteRowGroupsTo(::arrow::io::OutputStream* sink,
+                                        PageIndexLocation* location) {}
+
 std::unique_ptr<PageIndexBuilder> PageIndexBuilder::Make(
     const SchemaDescriptor* schema, InternalFileEncryptor* file_encryptor) {
   return std::make_unique<PageIndexBuilderImpl>(schema, file_encryptor);
@@ -1050,4 +1081,68 @@ std::ostream& operator<<(std::ostream& out, const PageIndexSelection& selection)
   return out;
 }
 
+RowRanges::RowRanges(std::vector<Range> ranges) {
+  std::sort(ranges.begin(), ranges.end(), [](const Range& left, const Range& right) {
+    return left.begin < right.begin;
+  });
+  for (const Range& range : ranges) {
+    if (range.begin >= range.end) continue;
+    if (!ranges_.empty() && range.begin <= ranges_.back().end) {
+      ranges_.back().end = std::max(ranges_.back().end, range.end);
+    } else {
+      ranges_.push_back(range);
+    }
+  }
+}
+
+RowRanges RowRanges::All(int64_t num_rows) { return RowRanges({{0, num_rows}}); }
+
+int64_t RowRanges::num_rows() const {
+  int64_t num_rows = 0;
+  for (const Range& range : ranges_) num_rows += range.end - range.begin;
+  return num_rows;
+}
+
+bool RowRanges::Overlaps(int64_t begin, int64_t end) const {
+  // The first range which ends after `begin`
+  auto it = std::upper_bound(
+      ranges_.begin(), ranges_.end(), begin,
+      [](int64_t row, const Range& range) { return row < range.end; });
+  return it != ranges_.end() && it->begin < end && begin < end;
+}
+
+RowRanges RowRanges::Intersect(const RowRanges& other) const {
+  std::vector<Range> out;
+  auto left = ranges_.begin();
+  auto right = other.ranges_.begin();
+  while (left != ranges_.end() && right != other.ranges_.end()) {
+    int64_t begin = std::max(left->begin, right->begin);
+    int64_t end = std::min(left->end, right->end);
+    if (begin < end) out.push_back({begin, end});
+    if (left->end < right->end) {
+      ++left;
+    } else {
+      ++right;
+    }
+  }
+  return RowRanges(std::move(out));
+}
+
+RowRanges RowRanges::Union(const RowRanges& other) const {
+  std::vector<Range> out = ranges_;
+  out.insert(out.end(), other.ranges_.begin(), other.ranges_.end());
+  return RowRanges(std::move(out));
+}
+
+std::string RowRanges::ToString() const {
+  std::stringstream ss;
+  ss << "RowRanges{";
+  for (size_t i = 0; i < ranges_.size(); ++i) {
+    if (i > 0) ss << ", ";
+    ss << "[" << ranges_[i].begin << ", " << ranges_[i].end << ")";
+  }
+  ss << "}";
+  return ss.str();
+}
+
 }  // namespace parquet
@@ -23,6 +23,7 @@
 #include "parquet/types.h"
 
 #include <optional>
+#include <string>
 #include <vector>
 
 namespace parquet {
@@ -369,13 +370,27 @@ class PARQUET_EXPORT PageIndexBuilder {
   /// the PageIndexBuilder.
   virtual OffsetIndexBuilder* GetOffsetIndexBuilder(int32_t i) = 0;
 
+  /// \brief Serialize the page index of the row groups appended since the last call
+  /// and release their builders.
+  ///
+  /// This keeps the memory of the builder proportional to a single row group when
+  /// called after every row group.  The builders of the written row groups are no
+  /// longer accessible and WriteTo() skips them.  The default implementation does
+  /// nothing, leaving all the page index to WriteTo().
+  ///
+  /// \param[out] sink The output stream to write the page index.
+  /// \param[in,out] location The location of the written page index to the start of
+  /// sink is added to it.
+  virtual void WriteRowGroupsTo(::arrow::io::OutputStream* sink,
+                                PageIndexLocation* location);
+
   /// \brief Complete the page index builder and no more write is allowed.
   virtual void Finish() = 0;
 
   /// \brief Serialize the page index thrift message.
   ///
-  /// Only valid column indexes and offset indexes are serialized and their locations
-  /// are set.
+  /// Only valid column indexes and offset indexes of the row groups not written by
+  /// WriteRowGroupsTo() are serialized and their locations are set.
   ///
   /// \param[out] sink The output stream to write the page index.
   /// \param[out] location The location of all page index to the start of sink.
@@ -383,4 +398,53 @@ class PARQUET_EXPORT PageIndexBuilder {
                        PageIndexLocation* location) const = 0;
 };
 
+/// \brief A set of rows of a row group.
+///
+/// The rows are held as sorted, non-overlapping and non-adjacent [begin, end) ranges
+/// of row indices within the row group.
+class PARQUET_EXPORT RowRanges {
+ public:
+  struct Range {
+    int64_t begin;
+    int64_t end;
+
+    bool operator==(const Range& other) const {
+      return begin == other.begin && end == other.end;
+    }
+  };
+
+  RowRanges() = default;
+
+  /// \brief Create from ranges in any order, which may overlap.
+  ///
+  /// Empty ranges are dropped.
+  explicit RowRanges(std::vector<Range> ranges);
+
+  /// \brief All rows of a row group with the given number of rows.
+  static RowRanges All(int64_t num_rows);
+
+  const std::vector<Range>& ranges() const { return ranges_; }
+
+  /// \brief The number of rows in the set.
+  int64_t num_rows() const;
+
+  bool empty() const { return ranges_.empty(); }
+
+  /// \brief Whether any of the rows [begin, end) is in the set.
+  bool Overlaps(int64_t begin, int64_t end) const;
+
+  /// \brief The rows which are in both sets.
+  RowRanges Intersect(const RowRanges& other) const;
+
+  /// \brief The rows which are in either set.
+  RowRanges Union(const RowRanges& other) const;
+
+  bool operator==(const RowRanges& other) const { return ranges_ == other.ranges_; }
+
+  std::string ToString() const;
+
+ private:
+  std::vector<Range> ranges_;
+};
+
 }  // namespace parquet
@@ -774,8 +774,9 @@ class PageIndexBuilderTest : public ::testing::Test {
   void WritePageIndexes(int num_row_groups, int num_columns,
                         const std::vector<std::vector<EncodedStatistics>>& page_stats,
                         const std::vector<std::vector<PageLocation>>& page_locations,
-                        int final_position) {
+                        int final_position, bool write_per_row_group = false) {
     auto builder = PageIndexBuilder::Make(&schema_);
+    auto sink = CreateOutputStream();
     for (int row_group = 0; row_group < num_row_groups; ++row_group) {
       ASSERT_NO_THROW(builder->AppendRowGroup());
 
@@ -794,11 +795,19 @@ class PageIndexBuilderTest : public ::testing::Test {
           ASSERT_NO_THROW(offset_index_builder->Finish(final_position));
         }
       }
+
+      if (write_per_row_group) {
+        builder->WriteRowGroupsTo(sink.get(), &page_index_location_);
+        // The builders of the written row group are released.
+        ASSERT_THROW(builder->GetColumnIndexBuilder(0), ParquetException);
+        ASSERT_THROW(builder->GetOffsetIndexBuilder(0), ParquetException);
+      }
     }
     ASSERT_NO_THROW(builder->Finish());
 
-    auto sink = CreateOutputStream();
-    builder->WriteTo(sink.get(), &page_index_location_);
+    if (!write_per_row_group) {
+      builder->WriteTo(sink.get(), &page_index_location_);
+    }
     PARQUET_ASSIGN_OR_THROW(buffer_, sink->Finish());
 
     ASSERT_EQ(static_cast<size_t>(num_row_groups),
@@ -946,4 +955,77 @@ TEST_F(PageIndexBuilderTest, TwoRowGroups) {
   CheckOffsetIndex(/*row_group=*/1, /*column=*/1, page_locations[1][1], final_position);
 }
 
+TEST_F(PageIndexBuilderTest, WriteRowGroupsTo) {
+  schema::NodePtr root = schema::GroupNode::Make(
+      "schema", Repetition::REPEATED, {schema::ByteArray("c1"), schema::ByteArray("c2")});
+  schema_.Init(root);
+
+  const int num_row_groups = 2;
+  const int num_columns = 2;
+  const std::vector<std::vector<EncodedStatistics>> page_stats = {
+      /*row_group_id=0*/
+      {/*column_id=0*/ EncodedStatistics().set_null_count(0).set_min("a").set_max("b"),
+       /*column_id=1*/ EncodedStatistics().set_null_count(0).set_min("A").set_max("B")},
+      /*row_group_id=1*/
+      {/*column_id=0*/ EncodedStatistics().set_null_count(1).set_min("c").set_max("d"),
+       /*column_id=1*/ EncodedStatistics().set_null_count(0).set_min("bar").set_max(
+           "foo")}};
+  const std::vector<std::vector<PageLocation>> page_locations = {
+      /*row_group_id=0*/
+      {/*column_id=0*/ {/*offset=*/128, /*compressed_page_size=*/512,
+                        /*first_row_index=*/0},
+       /*column_id=1*/ {/*offset=*/1024, /*compressed_page_size=*/512,
+                        /*first_row_index=*/0}},
+      /*row_group_id=1*/
+      {/*column_id=0*/ {/*offset=*/2048, /*compressed_page_size=*/256,
+                        /*first_row_index=*/0},
+       /*column_id=1*/ {/*offset=*/4096, /*compressed_page_size=*/256,
+                        /*first_row_index=*/0}}};
+  const int64_t final_position = 200;
+
+  WritePageIndexes(num_row_groups, num_columns, page_stats, page_locations,
+                   final_position, /*write_per_row_group=*/true);
+
+  for (int row_group = 0; row_group < num_row_groups; ++row_group) {
+    for (int column = 0; column < num_columns; ++column) {
+      CheckColumnIndex(row_group, column, page_stats[row_group][column]);
+      CheckOffsetIndex(row_group, column, page_locations[row_group][column],
+                       final_position);
+    }
+  }
+
+  // The page index of the first row group precedes that of the second.
+  ASSERT_LT(page_index_location_.offset_index_location[0][1]->offset,
+            page_index_location_.column_index_location[1][0]->offset);
+}
+
+TEST(RowRanges, Basics) {
+  RowRanges ranges({{10, 20}, {0, 5}, {3, 8}, {20, 25}, {30, 30}});
+  EXPECT_EQ((std::vector<RowRanges::Range>{{0, 8}, {10, 25}}), ranges.ranges());
+  EXPECT_EQ(23, ranges.num_rows());
+  EXPECT_EQ("RowRanges{[0, 8), [10, 25)}", ranges.ToString());
+  EXPECT_FALSE(ranges.empty());
+  EXPECT_TRUE(RowRanges().empty());
+  EXPECT_EQ(RowRanges({{0, 100}}), RowRanges::All(100));
+  EXPECT_TRUE(RowRanges::All(0).empty());
+
+  EXPECT_TRUE(ranges.Overlaps(0, 1));
+  EXPECT_TRUE(ranges.Overlaps(7, 10));
+  EXPECT_FALSE(ranges.Overlaps(8, 10));
+  EXPECT_TRUE(ranges.Overlaps(24, 100));
+  EXPECT_FALSE(ranges.Overlaps(25, 100));
+  EXPECT_FALSE(ranges.Overlaps(5, 5));
+}
+
+TEST(RowRanges, IntersectAndUnion) {
+  RowRanges left({{0, 8}, {10, 25}});
+  RowRanges right({{5, 12}, {20, 30}});
+  EXPECT_EQ(RowRanges({{5, 8}, {10, 12}, {20, 25}}), left.Intersect(right));
+  EXPECT_EQ(left.Intersect(right), right.Intersect(left));
+  EXPECT_EQ(RowRanges({{0, 30}}), left.Union(right));
+  EXPECT_EQ(left, left.Union(RowRanges()));
+  EXPECT_TRUE(left.Intersect(RowRanges()).empty());
+  EXPECT_TRUE(left.Intersect(RowRanges({{8, 10}, {25, 40}})).empty());
+}
+
 }  // namespace parquet
@@ -133,6 +133,37 @@ class PARQUET_EXPORT ReaderProperties {
     page_checksum_verification_ = check_crc;
   }
 
+  /// \brief Return the number of pages read ahead of the decoder in each column chunk.
+  ///
+  /// If positive, the next pages of a column chunk are read, decrypted and
+  /// decompressed on the IO thread pool while the current one is decoded, so that
+  /// reading and decoding overlap.  This mostly helps when column chunks are not
+  /// pre-buffered whole, e.g. because they are too large.  Each prefetched page
+  /// holds its own buffer.  Pages requested from an IO thread are read
+  /// synchronously, without prefetching.
+  ///
+  /// Default is 0, pages are only read when requested.
+  int32_t page_prefetch_depth() const { return page_prefetch_depth_; }
+  /// Set the number of pages read ahead of the decoder in each column chunk.
+  void set_page_prefetch_depth(int32_t depth) { page_prefetch_depth_ = depth; }
+
+  /// \brief Return whether the row groups of the file metadata are deserialized lazily.
+  ///
+  /// If enabled, reading the footer only indexes the row groups.  Each row group is
+  /// deserialized when first accessed, and each of its column chunks when first
+  /// accessed as well.  This makes opening files with many columns or row groups
+  /// cheaper when only some of them are read.  The serialized footer is kept in
+  /// memory.  Footers of files with encrypted footers are always deserialized whole.
+  bool is_lazy_metadata_deserialization_enabled() const {
+    return lazy_metadata_deserialization_;
+  }
+  /// Enable lazy deserialization of the file metadata.
+  void enable_lazy_metadata_deserialization() { lazy_metadata_deserialization_ = true; }
+  /// Disable lazy deserialization of the file metadata.
+  void disable_lazy_metadata_deserialization() {
+    lazy_metadata_deserialization_ = false;
+  }
+
   // Set the default read size to read the footer from a file. For high latency
   // file systems and files with large metadata (>64KB) this can increase performance
   // by reducing the number of round-trips to retrieve the entire file metadata.
@@ -148,7 +179,9 @@ class PARQUET_EXPORT ReaderProperties {
   bool page_checksum_verification_ = false;
   // Used with a RecordReader.
   bool read_dense_for_nullable_ = false;
+  bool lazy_metadata_deserialization_ = false;
   size_t footer_read_size_ = kDefaultFooterReadSize;
+  int32_t page_prefetch_depth_ = 0;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
 };
 
@@ -156,6 +189,7 @@ ReaderProperties PARQUET_EXPORT default_reader_properties();
 
 static constexpr int64_t kDefaultDataPageSize = 1024 * 1024;
 static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
+static constexpr bool DEFAULT_IS_ADAPTIVE_ENCODING_ENABLED = false;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 1024 * 1024;
@@ -214,6 +248,10 @@ class PARQUET_EXPORT ColumnProperties {
     page_index_enabled_ = page_index_enabled;
   }
 
+  void set_adaptive_encoding_enabled(bool adaptive_encoding_enabled) {
+    adaptive_encoding_enabled_ = adaptive_encoding_enabled;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -235,6 +273,8 @@ class PARQUET_EXPORT ColumnProperties {
 
   bool page_index_enabled() const { return page_index_enabled_; }
 
+  bool adaptive_encoding_enabled() const { return adaptive_encoding_enabled_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -243,6 +283,21 @@ class PARQUET_EXPORT ColumnProperties {
   size_t max_stats_size_;
   std::shared_ptr<CodecOptions> codec_options_;
   bool page_index_enabled_;
+  bool adaptive_encoding_enabled_ = DEFAULT_IS_ADAPTIVE_ENCODING_ENABLED;
+};
+
+/// \brief Options of content-defined chunking, see
+/// WriterProperties::Builder::enable_content_defined_chunking()
+struct PARQUET_EXPORT CdcOptions {
+  /// The minimum size of a chunk, in bytes of levels and values before encoding.
+  int64_t min_chunk_size = 256 * 1024;
+  /// The maximum size of a chunk, in bytes of levels and values before encoding.
+  int64_t max_chunk_size = 1024 * 1024;
+  /// Shift the probability of a chunk boundary: each increment halves the expected
+  /// distance between `min_chunk_size` and the next boundary, negative values double
+  /// it.  Chunk sizes are then less spread out but more often cut at
+  /// `max_chunk_size`, where they don't follow the content.
+  int norm_level = 0;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -260,7 +315,9 @@ class PARQUET_EXPORT WriterProperties {
           created_by_(DEFAULT_CREATED_BY),
           store_decimal_as_integer_(false),
           page_checksum_enabled_(false),
-          size_statistics_level_(DEFAULT_SIZE_STATISTICS_LEVEL) {}
+          page_index_per_row_group_(false),
+          size_statistics_level_(DEFAULT_SIZE_STATISTICS_LEVEL),
+          content_defined_chunking_enabled_(false) {}
 
     explicit Builder(const WriterProperties& properties)
         : pool_(properties.memory_pool()),
@@ -273,7 +330,12 @@ class PARQUET_EXPORT WriterProperties {
           created_by_(properties.created_by()),
           store_decimal_as_integer_(properties.store_decimal_as_integer()),
           page_checksum_enabled_(properties.page_checksum_enabled()),
+          page_index_per_row_group_(properties.write_page_index_per_row_group()),
           size_statistics_level_(properties.size_statistics_level()),
+          content_defined_chunking_enabled_(
+              properties.content_defined_chunking_enabled()),
+          content_defined_chunking_options_(
+              properties.content_defined_chunking_options()),
           sorting_columns_(properties.sorting_columns()),
           default_column_properties_(properties.default_column_properties()) {}
 
@@ -325,6 +387,52 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_dictionary(path->ToDotString());
     }
 
+    /// \brief Enable adaptive encoding in general for all columns. Default disabled.
+    ///
+    /// A dictionary encoded column chunk then estimates, after its first few thousand
+    /// values, whether dictionary encoding pays off.  If the values are too distinct,
+    /// it falls back to another encoding right away instead of when the dictionary
+    /// reaches the dictionary page size limit.
+    ///
+    /// The fallback encoding is then the one set with encoding() for the column, if
+    /// any, rather than PLAIN.  Otherwise it is chosen from the sampled values:
+    /// DELTA_BINARY_PACKED for integers of a narrow range, BYTE_STREAM_SPLIT for
+    /// compressed floating point values, DELTA_LENGTH_BYTE_ARRAY for short byte
+    /// arrays and PLAIN for the rest.  Only PLAIN is used with Parquet format
+    /// version 1.0.
+    Builder* enable_adaptive_encoding() {
+      default_column_properties_.set_adaptive_encoding_enabled(true);
+      return this;
+    }
+
+    /// Disable adaptive encoding in general for all columns. Default disabled.
+    Builder* disable_adaptive_encoding() {
+      default_column_properties_.set_adaptive_encoding_enabled(false);
+      return this;
+    }
+
+    /// Enable adaptive encoding for column specified by `path`. Default disabled.
+    Builder* enable_adaptive_encoding(const std::string& path) {
+      adaptive_encoding_enabled_[path] = true;
+      return this;
+    }
+
+    /// Enable adaptive encoding for column specified by `path`. Default disabled.
+    Builder* enable_adaptive_encoding(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_adaptive_encoding(path->ToDotString());
+    }
+
+    /// Disable adaptive encoding for column specified by `path`. Default disabled.
+    Builder* disable_adaptive_encoding(const std::string& path) {
+      adaptive_encoding_enabled_[path] = false;
+      return this;
+    }
+
+    /// Disable adaptive encoding for column specified by `path`. Default disabled.
+    Builder* disable_adaptive_encoding(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_adaptive_encoding(path->ToDotString());
+    }
+
     /// Specify the dictionary page size limit per row group. Default 1MB.
     Builder* dictionary_pagesize_limit(int64_t dictionary_psize_limit) {
       dictionary_pagesize_limit_ = dictionary_psize_limit;
@@ -663,6 +771,24 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_write_page_index(path->ToDotString());
     }
 
+    /// \brief Write the page index of each row group right after the row group.
+    ///
+    /// By default, the page index of all row groups is buffered until the file is
+    /// closed and written in a single place before the footer.  Writing it after every
+    /// row group keeps the memory of the writer proportional to one row group instead
+    /// of the whole file, at the expense of scattering the page index across the file.
+    /// The footer references the page index wherever it is written.  Default disabled.
+    Builder* enable_write_page_index_per_row_group() {
+      page_index_per_row_group_ = true;
+      return this;
+    }
+
+    /// Buffer the page index of all row groups until the file is closed.
+    Builder* disable_write_page_index_per_row_group() {
+      page_index_per_row_group_ = false;
+      return this;
+    }
+
     /// \brief Set the level to write size statistics for all columns. Default is None.
     ///
     /// \param level The level to write size statistics. Note that if page index is not
@@ -673,6 +799,41 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// \brief Choose the data page boundaries from the values written.
+    ///
+    /// A rolling hash of the levels and values of each column decides where a data
+    /// page ends, in addition to the data page size limit.  Inserting or removing
+    /// rows then only changes the pages around the change, and the pages before and
+    /// after it are written byte for byte as in the original file when the encoding
+    /// and compression are the same, so that content-addressable storage can
+    /// deduplicate them.  Choose a data page size larger than
+    /// CdcOptions::max_chunk_size for the pages to follow the content only.
+    ///
+    /// This only applies to the columns written from Arrow arrays.  Default disabled.
+    Builder* enable_content_defined_chunking() {
+      content_defined_chunking_enabled_ = true;
+      return this;
+    }
+
+    /// Disable content-defined chunking.
+    Builder* disable_content_defined_chunking() {
+      content_defined_chunking_enabled_ = false;
+      return this;
+    }
+
+    /// \brief Specify the options of content-defined chunking.
+    ///
+    /// The options don't enable content-defined chunking by themselves.
+    Builder* content_defined_chunking_options(const CdcOptions& options) {
+      if (options.min_chunk_size <= 0 ||
+          options.max_chunk_size < options.min_chunk_size) {
+        throw ParquetException(
+            "Content-defined chunking requires 0 < min_chunk_size <= max_chunk_size");
+      }
+      content_defined_chunking_options_ = options;
+      return this;
+    }
+
     /// \brief Build the WriterProperties with the builder parameters.
     /// \return The WriterProperties defined by the builder.
     std::shared_ptr<WriterProperties> build() {
@@ -695,13 +856,17 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_statistics_enabled(item.second);
       for (const auto& item : page_index_enabled_)
         get(item.first).set_page_index_enabled(item.second);
+      for (const auto& item : adaptive_encoding_enabled_)
+        get(item.first).set_adaptive_encoding_enabled(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
           pagesize_, version_, created_by_, page_checksum_enabled_,
-          size_statistics_level_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties, data_page_version_,
-          store_decimal_as_integer_, std::move(sorting_columns_)));
+          page_index_per_row_group_, size_statistics_level_,
+          std::move(file_encryption_properties_), default_column_properties_,
+          column_properties, data_page_version_, store_decimal_as_integer_,
+          std::move(sorting_columns_), content_defined_chunking_enabled_,
+          content_defined_chunking_options_));
     }
 
    private:
@@ -715,7 +880,10 @@ class PARQUET_EXPORT WriterProperties {
     std::string created_by_;
     bool store_decimal_as_integer_;
     bool page_checksum_enabled_;
+    bool page_index_per_row_group_;
     SizeStatisticsLevel size_statistics_level_;
+    bool content_defined_chunking_enabled_;
+    CdcOptions content_defined_chunking_options_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -730,6 +898,7 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
     std::unordered_map<std::string, bool> page_index_enabled_;
+    std::unordered_map<std::string, bool> adaptive_encoding_enabled_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -754,10 +923,22 @@ class PARQUET_EXPORT WriterProperties {
 
   inline bool page_checksum_enabled() const { return page_checksum_enabled_; }
 
+  inline bool write_page_index_per_row_group() const {
+    return page_index_per_row_group_;
+  }
+
   inline SizeStatisticsLevel size_statistics_level() const {
     return size_statistics_level_;
   }
 
+  inline bool content_defined_chunking_enabled() const {
+    return content_defined_chunking_enabled_;
+  }
+
+  inline const CdcOptions& content_defined_chunking_options() const {
+    return content_defined_chunking_options_;
+  }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -816,6 +997,10 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).page_index_enabled();
   }
 
+  bool adaptive_encoding_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).adaptive_encoding_enabled();
+  }
+
   bool page_index_enabled() const {
     if (default_column_properties_.page_index_enabled()) {
       return true;
@@ -851,12 +1036,13 @@ class PARQUET_EXPORT WriterProperties {
       MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
       int64_t max_row_group_length, int64_t pagesize, ParquetVersion::type version,
       const std::string& created_by, bool page_write_checksum_enabled,
-      SizeStatisticsLevel size_statistics_level,
+      bool page_index_per_row_group, SizeStatisticsLevel size_statistics_level,
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
       ParquetDataPageVersion data_page_version, bool store_short_decimal_as_integer,
-      std::vector<SortingColumn> sorting_columns)
+      std::vector<SortingColumn> sorting_columns, bool content_defined_chunking_enabled,
+      const CdcOptions& content_defined_chunking_options)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
@@ -867,7 +1053,10 @@ class PARQUET_EXPORT WriterProperties {
         parquet_created_by_(created_by),
         store_decimal_as_integer_(store_short_decimal_as_integer),
         page_checksum_enabled_(page_write_checksum_enabled),
+        page_index_per_row_group_(page_index_per_row_group),
         size_statistics_level_(size_statistics_level),
+        content_defined_chunking_enabled_(content_defined_chunking_enabled),
+        content_defined_chunking_options_(content_defined_chunking_options),
         file_encryption_properties_(file_encryption_properties),
         sorting_columns_(std::move(sorting_columns)),
         default_column_properties_(default_column_properties),
@@ -883,7 +1072,10 @@ class PARQUET_EXPORT WriterProperties {
   std::string parquet_created_by_;
   bool store_decimal_as_integer_;
   bool page_checksum_enabled_;
+  bool page_index_per_row_group_;
   SizeStatisticsLevel size_statistics_level_;
+  bool content_defined_chunking_enabled_;
+  CdcOptions content_defined_chunking_options_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -914,7 +1106,8 @@ class PARQUET_EXPORT ArrowReaderProperties {
         cache_options_(::arrow::io::CacheOptions::LazyDefaults()),
         coerce_int96_timestamp_unit_(::arrow::TimeUnit::NANO),
         arrow_extensions_enabled_(false),
-        should_load_statistics_(false) {}
+        should_load_statistics_(false),
+        binary_type_(::arrow::Type::BINARY) {}
 
   /// \brief Set whether to use the IO thread pool to parse columns in parallel.
   ///
@@ -927,8 +1120,11 @@ class PARQUET_EXPORT ArrowReaderProperties {
   ///
   /// If the file metadata contains a serialized Arrow schema, then ...
   ////
-  /// This is only supported for columns with a Parquet physical type of
-  /// BYTE_ARRAY, such as string or binary types.
+  /// This is supported for columns with a Parquet physical type of BYTE_ARRAY,
+  /// such as string or binary types, and for INT32, INT64, FLOAT, DOUBLE and
+  /// FIXED_LEN_BYTE_ARRAY columns, such as integer, decimal or fixed size binary
+  /// types.  Consecutive column chunks with identical dictionaries are read into
+  /// the same result chunk.
   void set_read_dictionary(int column_index, bool read_dict) {
     if (read_dict) {
       read_dict_indices_.insert(column_index);
@@ -1006,6 +1202,21 @@ class PARQUET_EXPORT ArrowReaderProperties {
   /// Return whether loading statistics as much as possible.
   bool should_load_statistics() const { return should_load_statistics_; }
 
+  /// \brief Set the Arrow binary type to read BYTE_ARRAY columns into.
+  ///
+  /// Allowed values are Type::BINARY, Type::LARGE_BINARY and Type::BINARY_VIEW.
+  /// Columns with the STRING or JSON logical type are read into the corresponding
+  /// string type.  With Type::BINARY_VIEW, the values are decoded directly into
+  /// views: short values are inlined and longer ones reference the decompressed
+  /// data pages when the encoding allows it, instead of being copied.  This also
+  /// avoids splitting columns larger than 2GB into several chunks.
+  ///
+  /// A type stored in the serialized Arrow schema of the file takes precedence.
+  /// Default is Type::BINARY.
+  void set_binary_type(::arrow::Type::type binary_type) { binary_type_ = binary_type; }
+  /// Return the Arrow binary type to read BYTE_ARRAY columns into.
+  ::arrow::Type::type binary_type() const { return binary_type_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
@@ -1016,6 +1227,7 @@ class PARQUET_EXPORT ArrowReaderProperties {
   ::arrow::TimeUnit::type coerce_int96_timestamp_unit_;
   bool arrow_extensions_enabled_;
   bool should_load_statistics_;
+  ::arrow::Type::type binary_type_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties
@@ -1115,6 +1327,10 @@ class PARQUET_EXPORT ArrowWriterProperties {
     /// \brief Set whether to use multiple threads to write columns
     /// in parallel in the buffered row group mode.
     ///
+    /// FileWriter::WriteTable then also writes each row group in buffered mode,
+    /// encoding and compressing its columns in parallel before they are written
+    /// to the file in order.  Each row group is held in memory until written.
+    ///
     /// WARNING: If writing multiple files in parallel in the same
     /// executor, deadlock may occur if use_threads is true. Please
     /// disable it in this case.
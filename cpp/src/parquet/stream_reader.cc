@@ -18,12 +18,13 @@
 #include "parquet/stream_reader.h"
 #include "arrow/util/decimal.h"
 
+#include <algorithm>
 #include <set>
 #include <utility>
 
 namespace parquet {
 
-constexpr int64_t StreamReader::kBatchSizeOne;
+constexpr int64_t StreamReader::kDefaultBatchSize;
 
 // The converted type expected by the stream reader does not always
 // exactly match with the schema in the Parquet file.  The following
@@ -43,17 +44,24 @@ static const std::set<std::pair<ConvertedType::type, ConvertedType::type>>
                                  {ConvertedType::INT_64, ConvertedType::DECIMAL},
                                  {ConvertedType::UTF8, ConvertedType::NONE}};
 
-StreamReader::StreamReader(std::unique_ptr<ParquetFileReader> reader)
-    : file_reader_{std::move(reader)}, eof_{false} {
+StreamReader::StreamReader(std::unique_ptr<ParquetFileReader> reader,
+                           int64_t batch_size)
+    : file_reader_{std::move(reader)}, eof_{false}, batch_size_{batch_size} {
+  if (batch_size_ <= 0) {
+    throw ParquetException("StreamReader batch size must be positive, got " +
+                           std::to_string(batch_size_));
+  }
   file_metadata_ = file_reader_->metadata();
 
   auto schema = file_metadata_->schema();
   auto group_node = schema->group_node();
 
   nodes_.resize(schema->num_columns());
+  column_buffers_.resize(schema->num_columns());
 
   for (auto i = 0; i < schema->num_columns(); ++i) {
     nodes_[i] = std::static_pointer_cast<schema::PrimitiveNode>(group_node->field(i));
+    column_buffers_[i].max_definition_level = schema->Column(i)->max_definition_level();
   }
   NextRowGroup();
 }
@@ -322,68 +330,26 @@ void StreamReader::ReadFixedLength(char* ptr, int len) {
   std::memcpy(ptr, flba.ptr, len);
 }
 
-void StreamReader::Read(ByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
-
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read != 1) {
-    ThrowReadFailedException(node);
-  }
-}
+void StreamReader::Read(ByteArray* v) { Read<ByteArrayReader>(v); }
 
 bool StreamReader::ReadOptional(ByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
-
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read == 1) {
-    return true;
-  } else if ((values_read == 0) && (def_level == 0)) {
+  const auto* value = NextValue<ByteArrayReader>();
+  if (value == nullptr) {
     return false;
   }
-  ThrowReadFailedException(node);
+  *v = *value;
+  return true;
 }
 
-void StreamReader::Read(FixedLenByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
-
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read != 1) {
-    ThrowReadFailedException(node);
-  }
-}
+void StreamReader::Read(FixedLenByteArray* v) { Read<FixedLenByteArrayReader>(v); }
 
 bool StreamReader::ReadOptional(FixedLenByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
-
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read == 1) {
-    return true;
-  } else if ((values_read == 0) && (def_level == 0)) {
+  const auto* value = NextValue<FixedLenByteArrayReader>();
+  if (value == nullptr) {
     return false;
   }
-  ThrowReadFailedException(node);
+  *v = *value;
+  return true;
 }
 
 void StreamReader::EndRow() {
@@ -397,11 +363,16 @@ void StreamReader::EndRow() {
   column_index_ = 0;
   ++current_row_;
 
-  if (!column_readers_[0]->HasNext()) {
+  if (!HasNext(0)) {
     NextRowGroup();
   }
 }
 
+bool StreamReader::HasNext(int column) {
+  const ColumnBuffer& buffer = column_buffers_[column];
+  return buffer.level_index < buffer.num_levels || column_readers_[column]->HasNext();
+}
+
 void StreamReader::NextRowGroup() {
   // Find next none-empty row group
   while (row_group_index_ < file_metadata_->num_row_groups()) {
@@ -412,6 +383,7 @@ void StreamReader::NextRowGroup() {
 
     for (int i = 0; i < file_metadata_->num_columns(); ++i) {
       column_readers_[i] = row_group_reader_->Column(i);
+      column_buffers_[i].num_levels = column_buffers_[i].level_index = 0;
     }
     if (column_readers_[0]->HasNext()) {
       row_group_row_offset_ = current_row_;
@@ -430,6 +402,7 @@ void StreamReader::SetEof() {
   row_group_reader_.reset();
   column_readers_.clear();
   nodes_.clear();
+  column_buffers_.clear();
 }
 
 int64_t StreamReader::SkipRows(int64_t num_rows_to_skip) {
@@ -444,8 +417,8 @@ int64_t StreamReader::SkipRows(int64_t num_rows_to_skip) {
         num_rows_in_row_group - (current_row_ - row_group_row_offset_);
 
     if (num_rows_remaining_in_row_group > num_rows_remaining_to_skip) {
-      for (auto reader : column_readers_) {
-        SkipRowsInColumn(reader.get(), num_rows_remaining_to_skip);
+      for (int i = 0; i < static_cast<int>(column_readers_.size()); ++i) {
+        SkipRowsInColumn(i, num_rows_remaining_to_skip);
       }
       current_row_ += num_rows_remaining_to_skip;
       num_rows_remaining_to_skip = 0;
@@ -465,16 +438,30 @@ int64_t StreamReader::SkipColumns(int64_t num_columns_to_skip) {
     for (; (num_columns_to_skip > num_columns_skipped) &&
            static_cast<std::size_t>(column_index_) < nodes_.size();
          ++column_index_) {
-      SkipRowsInColumn(column_readers_[column_index_].get(), 1);
+      SkipRowsInColumn(column_index_, 1);
       ++num_columns_skipped;
     }
   }
   return num_columns_skipped;
 }
 
-void StreamReader::SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip) {
-  int64_t num_skipped = 0;
+void StreamReader::SkipRowsInColumn(int column, int64_t num_rows_to_skip) {
+  // Skip the buffered rows first
+  ColumnBuffer& buffer = column_buffers_[column];
+  const int64_t num_buffered =
+      std::min(num_rows_to_skip, buffer.num_levels - buffer.level_index);
+  for (int64_t i = 0; i < num_buffered; ++i) {
+    if (buffer.IsValid(buffer.level_index++)) {
+      ++buffer.value_index;
+    }
+  }
+  num_rows_to_skip -= num_buffered;
+  if (num_rows_to_skip == 0) {
+    return;
+  }
 
+  int64_t num_skipped = 0;
+  ColumnReader* reader = column_readers_[column].get();
   switch (reader->type()) {
     case Type::BOOLEAN:
       num_skipped = static_cast<BoolReader*>(reader)->Skip(num_rows_to_skip);
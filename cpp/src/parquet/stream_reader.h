@@ -55,6 +55,10 @@ namespace parquet {
 ///
 /// Currently there is no support for repeated fields.
 ///
+/// The values of each column are read from the column readers in
+/// batches of up to `batch_size` values, and then served one at a
+/// time from the buffered batch.
+///
 class PARQUET_EXPORT StreamReader {
  public:
   template <typename T>
@@ -65,7 +69,10 @@ class PARQUET_EXPORT StreamReader {
   //      assigned afterwards.
   StreamReader() = default;
 
-  explicit StreamReader(std::unique_ptr<ParquetFileReader> reader);
+  static constexpr int64_t kDefaultBatchSize = 1024;
+
+  explicit StreamReader(std::unique_ptr<ParquetFileReader> reader,
+                        int64_t batch_size = kDefaultBatchSize);
 
   ~StreamReader() = default;
 
@@ -209,56 +216,52 @@ class PARQUET_EXPORT StreamReader {
   [[noreturn]] void ThrowReadFailedException(
       const std::shared_ptr<schema::PrimitiveNode>& node);
 
-  template <typename ReaderType, typename T>
-  void Read(T* v) {
-    const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    int64_t values_read;
-
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-    if (values_read != 1) {
-      ThrowReadFailedException(node);
+  /// \brief Return the next value of the current column and advance to
+  /// the next column, or return nullptr if the value is null.
+  template <typename ReaderType>
+  const typename ReaderType::T* NextValue() {
+    using T = typename ReaderType::T;
+    const int column = column_index_++;
+    ColumnBuffer& buffer = column_buffers_[column];
+    if (buffer.level_index == buffer.num_levels) {
+      auto reader = static_cast<ReaderType*>(column_readers_[column].get());
+      if (buffer.values == NULLPTR) {
+        buffer.values = AllocateBuffer(::arrow::default_memory_pool(),
+                                       batch_size_ * static_cast<int64_t>(sizeof(T)));
+        buffer.def_levels.resize(static_cast<std::size_t>(batch_size_));
+      }
+      int64_t values_read;
+      buffer.num_levels =
+          reader->ReadBatch(batch_size_, buffer.def_levels.data(), NULLPTR,
+                            buffer.values->mutable_data_as<T>(), &values_read);
+      buffer.level_index = 0;
+      buffer.value_index = 0;
+      if (buffer.num_levels == 0) {
+        ThrowReadFailedException(nodes_[column]);
+      }
     }
+    if (!buffer.IsValid(buffer.level_index++)) {
+      return NULLPTR;
+    }
+    return buffer.values->data_as<T>() + buffer.value_index++;
   }
 
-  template <typename ReaderType, typename ReadType, typename T>
+  template <typename ReaderType, typename ReadType = typename ReaderType::T, typename T>
   void Read(T* v) {
-    const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    ReadType tmp;
-    int64_t values_read;
-
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, &tmp, &values_read);
-
-    if (values_read == 1) {
-      *v = tmp;
-    } else {
-      ThrowReadFailedException(node);
+    const auto* value = NextValue<ReaderType>();
+    if (value == NULLPTR) {
+      ThrowReadFailedException(nodes_[column_index_ - 1]);
     }
+    *v = *value;
   }
 
   template <typename ReaderType, typename ReadType = typename ReaderType::T, typename T>
   void ReadOptional(optional<T>* v) {
-    const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    ReadType tmp;
-    int64_t values_read;
-
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, &tmp, &values_read);
-
-    if (values_read == 1) {
-      *v = T(tmp);
-    } else if ((values_read == 0) && (def_level == 0)) {
-      v->reset();
+    const auto* value = NextValue<ReaderType>();
+    if (value != NULLPTR) {
+      *v = T(*value);
     } else {
-      ThrowReadFailedException(node);
+      v->reset();
     }
   }
 
@@ -277,24 +280,41 @@ class PARQUET_EXPORT StreamReader {
   void CheckColumn(Type::type physical_type, ConvertedType::type converted_type,
                    int length = 0);
 
-  void SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip);
+  void SkipRowsInColumn(int column, int64_t num_rows_to_skip);
+
+  bool HasNext(int column);
 
   void SetEof();
 
  private:
+  // The levels and values of a column read in one batch
+  struct ColumnBuffer {
+    bool IsValid(int64_t level_index) const {
+      return max_definition_level == 0 ||
+             def_levels[static_cast<std::size_t>(level_index)] == max_definition_level;
+    }
+
+    int16_t max_definition_level{0};
+    std::vector<int16_t> def_levels;
+    std::shared_ptr<ResizableBuffer> values;
+    int64_t num_levels{0};
+    int64_t level_index{0};
+    int64_t value_index{0};
+  };
+
   std::unique_ptr<ParquetFileReader> file_reader_;
   std::shared_ptr<FileMetaData> file_metadata_;
   std::shared_ptr<RowGroupReader> row_group_reader_;
   std::vector<std::shared_ptr<ColumnReader>> column_readers_;
   std::vector<std::shared_ptr<schema::PrimitiveNode>> nodes_;
+  std::vector<ColumnBuffer> column_buffers_;
 
   bool eof_{true};
   int row_group_index_{0};
   int column_index_{0};
   int64_t current_row_{0};
   int64_t row_group_row_offset_{0};
-
-  static constexpr int64_t kBatchSizeOne = 1;
+  int64_t batch_size_{kDefaultBatchSize};
 };  // namespace parquet
 
 PARQUET_EXPORT
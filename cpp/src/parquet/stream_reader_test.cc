@@ -725,6 +725,33 @@ TEST_F(TestOptionalFields, ValueChecking) {
   EXPECT_EQ(i, TestData::num_rows);
 }
 
+TEST_F(TestOptionalFields, ReadAndSkipInSmallBatches) {
+  PARQUET_ASSIGN_OR_THROW(auto infile, ::arrow::io::ReadableFile::Open(GetDataFile()));
+  StreamReader reader{ParquetFileReader::Open(infile), /*batch_size=*/3};
+
+  optional<std::string> opt_string;
+  optional<int32_t> opt_int32;
+  int i = 0;
+
+  while (!reader.eof()) {
+    EXPECT_EQ(i, reader.current_row());
+    EXPECT_EQ(1, reader.SkipColumns(1));
+    reader >> opt_string;
+    EXPECT_EQ(4, reader.SkipColumns(4));
+    reader >> opt_int32;
+    EXPECT_EQ(4, reader.SkipColumns(4));
+    reader >> EndRow;
+
+    EXPECT_EQ(opt_string, TestData::GetOptString(i)) << "index: " << i;
+    EXPECT_EQ(opt_int32, TestData::GetOptInt32(i)) << "index: " << i;
+    ++i;
+    if (i % 5 == 0) {
+      i += static_cast<int>(reader.SkipRows(2));
+    }
+  }
+  EXPECT_EQ(i, TestData::num_rows);
+}
+
 TEST_F(TestOptionalFields, ReadOptionalFieldAsRequiredField) {
   /* Test that optional fields can be read using non-optional types
     _provided_ that the optional value is available.
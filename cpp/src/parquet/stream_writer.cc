@@ -23,10 +23,9 @@ namespace parquet {
 
 int64_t StreamWriter::default_row_group_size_{512 * 1024 * 1024};  // 512MB
 
+constexpr int64_t StreamWriter::kDefaultBatchSize;
 constexpr int16_t StreamWriter::kDefLevelZero;
 constexpr int16_t StreamWriter::kDefLevelOne;
-constexpr int16_t StreamWriter::kRepLevelZero;
-constexpr int64_t StreamWriter::kBatchSizeOne;
 
 StreamWriter::FixedStringView::FixedStringView(const char* data_ptr)
     : data{data_ptr}, size{std::strlen(data_ptr)} {}
@@ -34,19 +33,52 @@ StreamWriter::FixedStringView::FixedStringView(const char* data_ptr)
 StreamWriter::FixedStringView::FixedStringView(const char* data_ptr, std::size_t data_len)
     : data{data_ptr}, size{data_len} {}
 
-StreamWriter::StreamWriter(std::unique_ptr<ParquetFileWriter> writer)
+StreamWriter::StreamWriter(std::unique_ptr<ParquetFileWriter> writer,
+                           int64_t batch_size)
     : file_writer_{std::move(writer)},
-      row_group_writer_{file_writer_->AppendBufferedRowGroup()} {
+      row_group_writer_{file_writer_->AppendBufferedRowGroup()},
+      batch_size_{batch_size} {
+  if (batch_size_ <= 0) {
+    throw ParquetException("StreamWriter batch size must be positive, got " +
+                           std::to_string(batch_size_));
+  }
   auto schema = file_writer_->schema();
   auto group_node = schema->group_node();
 
   nodes_.resize(schema->num_columns());
+  column_buffers_.resize(schema->num_columns());
 
   for (auto i = 0; i < schema->num_columns(); ++i) {
     nodes_[i] = std::static_pointer_cast<schema::PrimitiveNode>(group_node->field(i));
   }
 }
 
+StreamWriter::~StreamWriter() {
+  try {
+    FlushBufferedRows();
+  } catch (...) {
+  }
+}
+
+StreamWriter& StreamWriter::operator=(StreamWriter&& other) {
+  if (this != &other) {
+    // The rows buffered by this writer belong to its file, which is closed below
+    FlushBufferedRows();
+    column_index_ = other.column_index_;
+    current_row_ = other.current_row_;
+    row_group_size_ = other.row_group_size_;
+    max_row_group_size_ = other.max_row_group_size_;
+    row_group_writer_ = std::move(other.row_group_writer_);
+    file_writer_ = std::move(other.file_writer_);
+    nodes_ = std::move(other.nodes_);
+    column_buffers_ = std::move(other.column_buffers_);
+    batch_size_ = other.batch_size_;
+    num_buffered_rows_ = other.num_buffered_rows_;
+    buffered_bytes_ = other.buffered_bytes_;
+  }
+  return *this;
+}
+
 void StreamWriter::SetDefaultMaxRowGroupSize(int64_t max_size) {
   default_row_group_size_ = max_size;
 }
@@ -144,20 +176,15 @@ StreamWriter& StreamWriter::WriteVariableLength(const char* data_ptr,
                                                 std::size_t data_len) {
   CheckColumn(Type::BYTE_ARRAY, ConvertedType::UTF8);
 
-  auto writer = static_cast<ByteArrayWriter*>(row_group_writer_->column(column_index_++));
+  ColumnBuffer& buffer = column_buffers_[column_index_++];
 
   if (data_ptr != nullptr) {
-    ByteArray ba_value;
-
-    ba_value.ptr = reinterpret_cast<const uint8_t*>(data_ptr);
-    ba_value.len = static_cast<uint32_t>(data_len);
-
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &ba_value);
+    buffer.def_levels.push_back(kDefLevelOne);
+    buffer.values.insert(buffer.values.end(), data_ptr, data_ptr + data_len);
+    buffer.lengths.push_back(static_cast<uint32_t>(data_len));
+    buffered_bytes_ += static_cast<int64_t>(data_len);
   } else {
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
-  }
-  if (max_row_group_size_ > 0) {
-    row_group_size_ += writer->estimated_buffered_value_bytes();
+    buffer.def_levels.push_back(kDefLevelZero);
   }
   return *this;
 }
@@ -166,19 +193,14 @@ StreamWriter& StreamWriter::WriteFixedLength(const char* data_ptr, std::size_t d
   CheckColumn(Type::FIXED_LEN_BYTE_ARRAY, ConvertedType::NONE,
               static_cast<int>(data_len));
 
-  auto writer =
-      static_cast<FixedLenByteArrayWriter*>(row_group_writer_->column(column_index_++));
+  ColumnBuffer& buffer = column_buffers_[column_index_++];
 
   if (data_ptr != nullptr) {
-    FixedLenByteArray flba_value;
-
-    flba_value.ptr = reinterpret_cast<const uint8_t*>(data_ptr);
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &flba_value);
+    buffer.def_levels.push_back(kDefLevelOne);
+    buffer.values.insert(buffer.values.end(), data_ptr, data_ptr + data_len);
+    buffered_bytes_ += static_cast<int64_t>(data_len);
   } else {
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
-  }
-  if (max_row_group_size_ > 0) {
-    row_group_size_ += writer->estimated_buffered_value_bytes();
+    buffer.def_levels.push_back(kDefLevelZero);
   }
   return *this;
 }
@@ -226,47 +248,94 @@ int64_t StreamWriter::SkipColumns(int num_columns_to_skip) {
       throw ParquetException("Cannot skip column '" + node->name() +
                              "' as it is required.");
     }
-    auto writer = row_group_writer_->column(column_index_++);
-
-    WriteNullValue(writer);
+    WriteNullValue(column_index_++);
   }
   return num_columns_skipped;
 }
 
-void StreamWriter::WriteNullValue(ColumnWriter* writer) {
-  switch (writer->type()) {
-    case Type::BOOLEAN:
-      static_cast<BoolWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                   &kRepLevelZero, nullptr);
-      break;
-    case Type::INT32:
-      static_cast<Int32Writer*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                    &kRepLevelZero, nullptr);
-      break;
-    case Type::INT64:
-      static_cast<Int64Writer*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                    &kRepLevelZero, nullptr);
-      break;
-    case Type::BYTE_ARRAY:
-      static_cast<ByteArrayWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                        &kRepLevelZero, nullptr);
-      break;
-    case Type::FIXED_LEN_BYTE_ARRAY:
-      static_cast<FixedLenByteArrayWriter*>(writer)->WriteBatch(
-          kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
-      break;
-    case Type::FLOAT:
-      static_cast<FloatWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                    &kRepLevelZero, nullptr);
-      break;
-    case Type::DOUBLE:
-      static_cast<DoubleWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                     &kRepLevelZero, nullptr);
-      break;
-    case Type::INT96:
-    case Type::UNDEFINED:
-      throw ParquetException("Unexpected type: " + TypeToString(writer->type()));
-      break;
+void StreamWriter::WriteNullValue(int column) {
+  const Type::type physical_type = nodes_[column]->physical_type();
+  if (physical_type == Type::INT96 || physical_type == Type::UNDEFINED) {
+    throw ParquetException("Unexpected type: " + TypeToString(physical_type));
+  }
+  column_buffers_[column].def_levels.push_back(kDefLevelZero);
+}
+
+namespace {
+
+template <typename WriterType>
+void WriteBufferedValues(ColumnWriter* writer, const std::vector<int16_t>& def_levels,
+                         const std::vector<uint8_t>& values) {
+  using T = typename WriterType::T;
+  static_cast<WriterType*>(writer)->WriteBatch(
+      static_cast<int64_t>(def_levels.size()), def_levels.data(), nullptr,
+      reinterpret_cast<const T*>(values.data()));
+}
+
+}  // namespace
+
+void StreamWriter::FlushBufferedRows() {
+  if (num_buffered_rows_ == 0 || !file_writer_) {
+    return;
+  }
+  for (int i = 0; i < static_cast<int>(column_buffers_.size()); ++i) {
+    ColumnBuffer& buffer = column_buffers_[i];
+    ColumnWriter* writer = row_group_writer_->column(i);
+    // Only the values of the rows which were ended are written
+    buffer.def_levels.resize(static_cast<std::size_t>(num_buffered_rows_));
+    switch (writer->type()) {
+      case Type::BOOLEAN:
+        WriteBufferedValues<BoolWriter>(writer, buffer.def_levels, buffer.values);
+        break;
+      case Type::INT32:
+        WriteBufferedValues<Int32Writer>(writer, buffer.def_levels, buffer.values);
+        break;
+      case Type::INT64:
+        WriteBufferedValues<Int64Writer>(writer, buffer.def_levels, buffer.values);
+        break;
+      case Type::FLOAT:
+        WriteBufferedValues<FloatWriter>(writer, buffer.def_levels, buffer.values);
+        break;
+      case Type::DOUBLE:
+        WriteBufferedValues<DoubleWriter>(writer, buffer.def_levels, buffer.values);
+        break;
+      case Type::BYTE_ARRAY: {
+        std::vector<ByteArray> values(buffer.lengths.size());
+        const uint8_t* ptr = buffer.values.data();
+        for (std::size_t j = 0; j < values.size(); ++j) {
+          values[j] = ByteArray(buffer.lengths[j], ptr);
+          ptr += buffer.lengths[j];
+        }
+        static_cast<ByteArrayWriter*>(writer)->WriteBatch(
+            num_buffered_rows_, buffer.def_levels.data(), nullptr, values.data());
+        break;
+      }
+      case Type::FIXED_LEN_BYTE_ARRAY: {
+        const int type_length = nodes_[i]->type_length();
+        std::vector<FixedLenByteArray> values(buffer.values.size() / type_length);
+        for (std::size_t j = 0; j < values.size(); ++j) {
+          values[j] = FixedLenByteArray(buffer.values.data() + j * type_length);
+        }
+        static_cast<FixedLenByteArrayWriter*>(writer)->WriteBatch(
+            num_buffered_rows_, buffer.def_levels.data(), nullptr, values.data());
+        break;
+      }
+      case Type::INT96:
+      case Type::UNDEFINED:
+        throw ParquetException("Unexpected type: " + TypeToString(writer->type()));
+    }
+    buffer.def_levels.clear();
+    buffer.values.clear();
+    buffer.lengths.clear();
+  }
+  num_buffered_rows_ = 0;
+  buffered_bytes_ = 0;
+
+  // Size of the row group written so far, including the column writer buffers
+  row_group_size_ = row_group_writer_->total_bytes_written() +
+                    row_group_writer_->total_compressed_bytes();
+  for (int i = 0; i < static_cast<int>(column_buffers_.size()); ++i) {
+    row_group_size_ += row_group_writer_->column(i)->estimated_buffered_value_bytes();
   }
 }
 
@@ -288,14 +357,12 @@ void StreamWriter::EndRow() {
   column_index_ = 0;
   ++current_row_;
 
-  if (max_row_group_size_ > 0) {
-    if (row_group_size_ > max_row_group_size_) {
-      EndRowGroup();
-    }
-    // Initialize for each row with size already written
-    // (compressed + uncompressed).
-    row_group_size_ = row_group_writer_->total_bytes_written() +
-                      row_group_writer_->total_compressed_bytes();
+  if (++num_buffered_rows_ == batch_size_) {
+    FlushBufferedRows();
+  }
+  if (max_row_group_size_ > 0 &&
+      row_group_size_ + buffered_bytes_ > max_row_group_size_) {
+    EndRowGroup();
   }
 }
 
@@ -303,10 +370,17 @@ void StreamWriter::EndRowGroup() {
   if (!file_writer_) {
     throw ParquetException("StreamWriter not initialized");
   }
+  if (column_index_ != 0) {
+    throw ParquetException("Cannot end row group with " + std::to_string(column_index_) +
+                           " of " + std::to_string(nodes_.size()) +
+                           " columns of the row written");
+  }
+  FlushBufferedRows();
   // Avoid creating empty row groups.
   if (row_group_writer_->num_rows() > 0) {
     row_group_writer_->Close();
     row_group_writer_.reset(file_writer_->AppendBufferedRowGroup());
+    row_group_size_ = 0;
   }
 }
 
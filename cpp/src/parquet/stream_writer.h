@@ -24,6 +24,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 #include "parquet/column_writer.h"
@@ -59,6 +60,10 @@ namespace parquet {
 ///
 /// Currently there is no support for repeated fields.
 ///
+/// The values are buffered per column, and written to the column
+/// writers in batches of `batch_size` rows, when a row group ends and
+/// when the StreamWriter is destroyed or assigned to.
+///
 class PARQUET_EXPORT StreamWriter {
  public:
   template <typename T>
@@ -69,9 +74,12 @@ class PARQUET_EXPORT StreamWriter {
   //      assigned afterwards.
   StreamWriter() = default;
 
-  explicit StreamWriter(std::unique_ptr<ParquetFileWriter> writer);
+  static constexpr int64_t kDefaultBatchSize = 1024;
+
+  explicit StreamWriter(std::unique_ptr<ParquetFileWriter> writer,
+                        int64_t batch_size = kDefaultBatchSize);
 
-  ~StreamWriter() = default;
+  ~StreamWriter();
 
   static void SetDefaultMaxRowGroupSize(int64_t max_size);
 
@@ -85,7 +93,7 @@ class PARQUET_EXPORT StreamWriter {
 
   // Moving is possible.
   StreamWriter(StreamWriter&&) = default;
-  StreamWriter& operator=(StreamWriter&&) = default;
+  StreamWriter& operator=(StreamWriter&& other);
 
   // Copying is not allowed.
   StreamWriter(const StreamWriter&) = delete;
@@ -180,13 +188,12 @@ class PARQUET_EXPORT StreamWriter {
  protected:
   template <typename WriterType, typename T>
   StreamWriter& Write(const T v) {
-    auto writer = static_cast<WriterType*>(row_group_writer_->column(column_index_++));
-
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &v);
-
-    if (max_row_group_size_ > 0) {
-      row_group_size_ += writer->estimated_buffered_value_bytes();
-    }
+    static_assert(std::is_same_v<T, typename WriterType::T>);
+    ColumnBuffer& buffer = column_buffers_[column_index_++];
+    buffer.def_levels.push_back(kDefLevelOne);
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&v);
+    buffer.values.insert(buffer.values.end(), bytes, bytes + sizeof(T));
+    buffered_bytes_ += static_cast<int64_t>(sizeof(T));
     return *this;
   }
 
@@ -202,9 +209,21 @@ class PARQUET_EXPORT StreamWriter {
   /// not optional.
   void SkipOptionalColumn();
 
-  void WriteNullValue(ColumnWriter* writer);
+  void WriteNullValue(int column);
+
+  /// \brief Write the buffered rows to the column writers.
+  void FlushBufferedRows();
 
  private:
+  // The levels and values of the rows buffered for a column.  The values of
+  // BYTE_ARRAY and FIXED_LEN_BYTE_ARRAY columns are stored in `values`, one after
+  // the other, and the lengths of BYTE_ARRAY values in `lengths`.
+  struct ColumnBuffer {
+    std::vector<int16_t> def_levels;
+    std::vector<uint8_t> values;
+    std::vector<uint32_t> lengths;
+  };
+
   using node_ptr_type = std::shared_ptr<schema::PrimitiveNode>;
 
   struct null_deleter {
@@ -219,11 +238,13 @@ class PARQUET_EXPORT StreamWriter {
   std::unique_ptr<ParquetFileWriter> file_writer_;
   std::unique_ptr<RowGroupWriter, null_deleter> row_group_writer_;
   std::vector<node_ptr_type> nodes_;
+  std::vector<ColumnBuffer> column_buffers_;
+  int64_t batch_size_{kDefaultBatchSize};
+  int64_t num_buffered_rows_{0};
+  int64_t buffered_bytes_{0};
 
   static constexpr int16_t kDefLevelZero = 0;
   static constexpr int16_t kDefLevelOne = 1;
-  static constexpr int16_t kRepLevelZero = 0;
-  static constexpr int64_t kBatchSizeOne = 1;
 
   static int64_t default_row_group_size_;
 };
@@ -25,7 +25,9 @@
 
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
+#include "parquet/column_reader.h"
 #include "parquet/exception.h"
+#include "parquet/file_reader.h"
 
 namespace parquet {
 namespace test {
@@ -297,6 +299,47 @@ TEST_F(TestStreamWriter, SkipColumns) {
   writer_ << EndRow;
 }
 
+TEST_F(TestStreamWriter, SmallBatches) {
+  auto sink = CreateOutputStream();
+  writer_ = StreamWriter{ParquetFileWriter::Open(sink, GetSchema()), /*batch_size=*/3};
+  writer_.SetMaxRowGroupSize(0);
+
+  for (int i = 0; i < 25; ++i) {
+    writer_ << bool(i & 1) << std::to_string(i) << char('A' + i % 26)
+            << std::array<char, 4>{'A', 'B', 'C', 'D'} << int8_t(i) << uint16_t(i)
+            << int32_t(i) << uint64_t(i) << 1.5f * i << 2.5 * i;
+    if (i == 10) {
+      // A row group can't end in the middle of a row
+      EXPECT_THROW(writer_ << EndRowGroup, ParquetException);
+    }
+    writer_ << EndRow;
+    if (i == 9) {
+      writer_ << EndRowGroup;
+    }
+  }
+  // The last rows are written when the writer is replaced
+  writer_ = StreamWriter{};
+
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto metadata = file_reader->metadata();
+  EXPECT_EQ(2, metadata->num_row_groups());
+  EXPECT_EQ(10, metadata->RowGroup(0)->num_rows());
+  EXPECT_EQ(15, metadata->RowGroup(1)->num_rows());
+
+  auto column_reader =
+      std::static_pointer_cast<ByteArrayReader>(file_reader->RowGroup(1)->Column(1));
+  std::vector<ByteArray> values(15);
+  int64_t values_read;
+  column_reader->ReadBatch(15, nullptr, nullptr, values.data(), &values_read);
+  ASSERT_EQ(15, values_read);
+  for (int i = 0; i < 15; ++i) {
+    EXPECT_EQ(std::to_string(i + 10),
+              std::string(reinterpret_cast<const char*>(values[i].ptr), values[i].len));
+  }
+}
+
 TEST_F(TestStreamWriter, AppendNotImplemented) {
   PARQUET_ASSIGN_OR_THROW(auto outfile,
                           ::arrow::io::FileOutputStream::Open(GetDataFile()));
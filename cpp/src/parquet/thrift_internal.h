@@ -451,6 +451,83 @@ class ThriftDeserializer {
     }
   }
 
+  // Deserialize an unencrypted thrift struct from buf/len like DeserializeMessage,
+  // except for the elements of its list field `list_field_id`, which must be structs.
+  // That field is left empty and the byte ranges of its elements in buf are returned
+  // instead, so that they can be deserialized on their own later on.
+  template <class T>
+  std::vector<std::pair<uint32_t, uint32_t>> DeserializeMessageExceptList(
+      const uint8_t* buf, uint32_t* len, int16_t list_field_id, T* deserialized_msg) {
+    using apache::thrift::protocol::TType;
+    std::vector<std::pair<uint32_t, uint32_t>> element_ranges;
+    bool list_found = false;
+    uint32_t list_begin = 0;
+    uint32_t list_end = 0;
+    uint32_t message_len = 0;
+    {
+      // Index the list without deserializing anything
+      auto tmem_transport = CreateReadOnlyMemoryBuffer(const_cast<uint8_t*>(buf), *len);
+      auto tproto = apache::thrift::protocol::TCompactProtocolT<ThriftBuffer>(
+          tmem_transport, string_size_limit_, container_size_limit_);
+      auto position = [&]() { return *len - tmem_transport->available_read(); };
+      try {
+        std::string name;
+        TType field_type;
+        int16_t field_id;
+        tproto.readStructBegin(name);
+        while (true) {
+          tproto.readFieldBegin(name, field_type, field_id);
+          if (field_type == apache::thrift::protocol::T_STOP) break;
+          if (field_id != list_field_id ||
+              field_type != apache::thrift::protocol::T_LIST) {
+            apache::thrift::protocol::skip(tproto, field_type);
+            tproto.readFieldEnd();
+            continue;
+          }
+          list_begin = position();
+          TType element_type;
+          uint32_t size;
+          tproto.readListBegin(element_type, size);
+          if (element_type != apache::thrift::protocol::T_STRUCT) {
+            throw ParquetException("expected a list of structs");
+          }
+          element_ranges.clear();
+          element_ranges.reserve(size);
+          for (uint32_t i = 0; i < size; ++i) {
+            const uint32_t element_begin = position();
+            apache::thrift::protocol::skip(tproto, apache::thrift::protocol::T_STRUCT);
+            element_ranges.emplace_back(element_begin, position());
+          }
+          tproto.readListEnd();
+          list_end = position();
+          list_found = true;
+          tproto.readFieldEnd();
+        }
+        tproto.readStructEnd();
+      } catch (std::exception& e) {
+        std::stringstream ss;
+        ss << "Couldn't deserialize thrift: " << e.what() << "\n";
+        throw ParquetException(ss.str());
+      }
+      message_len = position();
+    }
+    if (!list_found) {
+      DeserializeUnencryptedMessage(buf, len, deserialized_msg);
+      return element_ranges;
+    }
+    // Deserialize the other fields from a copy of the message where the list is
+    // replaced with an empty list of structs, whose compact header is a single byte.
+    // The field headers are left as-is since they are delta encoded.
+    constexpr uint8_t kEmptyStructList = 0x0C;
+    std::vector<uint8_t> message(buf, buf + list_begin);
+    message.push_back(kEmptyStructList);
+    message.insert(message.end(), buf + list_end, buf + message_len);
+    uint32_t stripped_len = static_cast<uint32_t>(message.size());
+    DeserializeUnencryptedMessage(message.data(), &stripped_len, deserialized_msg);
+    *len = message_len;
+    return element_ranges;
+  }
+
  private:
   // On Thrift 0.14.0+, we want to use TConfiguration to raise the max message size
   // limit (ARROW-13655).  If we wanted to protect against huge messages, we could